@@ -5,6 +5,7 @@
 
 #include "Macro.h"
 #include "Patch.h"
+#include "PatchTable.h"
 
 #ifdef PARTICLE
 #  include "Particle.h"
@@ -30,7 +31,7 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Structure   :  AMR_t
 // Description :  Data structure of the AMR implementation
 //
-// Data Member :  patch        : Pointers of all patches
+// Data Member :  patch        : Pointers of all patches (growable table, see PatchTable.h)
 //                num          : Number of patches (real patch + buffer patch) at each level
 //                scale        : Grid scale at each level (grid size normalized to that at the finest level)
 //                FluSg        : Sandglass of the current fluid          data [0/1]
@@ -76,7 +77,7 @@ struct AMR_t
 
 // data members
 // ===================================================================================
-   patch_t    *patch[2][NLEVEL][MAX_PATCH];
+   PatchTable_t patch[2][NLEVEL];
 
 #  ifdef PARTICLE
    Particle_t *Par;
@@ -154,11 +155,6 @@ struct AMR_t
 #        endif
       }
 
-      for (int Sg=0; Sg<2; Sg++)
-      for (int lv=0; lv<NLEVEL; lv++)
-      for (int PID=0; PID<MAX_PATCH; PID++)
-         patch[Sg][lv][PID] = NULL;
-
       for (int lv=0; lv<NLEVEL; lv++)
       for (int m=0; m<28; m++)
          NPatchComma[lv][m] = 0;
@@ -245,8 +241,12 @@ struct AMR_t
 
       const int NewPID = num[lv];
 
-      if ( NewPID > MAX_PATCH-1 )
-         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
+      if ( NewPID == __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "exceed the maximum number of patches (%d) on level %d !!\n", __INT_MAX__, lv );
+
+//    grow the patch tables if necessary (new elements are initialized as NULL)
+      patch[0][lv].Reserve( NewPID+1 );
+      patch[1][lv].Reserve( NewPID+1 );
 
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
@@ -257,9 +257,9 @@ struct AMR_t
             Aux_Error( ERROR_INFO, "conflicting patch allocation (Lv %d, PID %d, FaPID %d) !!\n", lv, NewPID, FaPID );
 #        endif
 
-         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv, 0,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
-         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv, 1,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
       }
 
@@ -280,9 +280,9 @@ struct AMR_t
 //       do NOT initialize field pointers as NULL since they may be allocated already
          const bool InitPtrAsNull_No = false;
 
-         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv, 0,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
-         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv, 1,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
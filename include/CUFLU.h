@@ -161,7 +161,7 @@
 
 // verify that the density and pressure in the intermediate states of Roe's Riemann solver are positive.
 // --> if either is negative, we switch to other Riemann solvers (EXACT/HLLE/HLLC/HLLD)
-#if (  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  RSOLVER == ROE  )
+#if (  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  ( RSOLVER == ROE || RSOLVER_HYBRID == ROE )  )
 #  ifdef MHD
 //#     define CHECK_INTERMEDIATE    HLLD
 #     define CHECK_INTERMEDIATE    HLLE
@@ -173,7 +173,7 @@
 
 
 // use Eulerian with Y factor for Roe Solver in MHD
-#if (  defined MHD  &&  ( RSOLVER == ROE || RSOLVER == HLLE )  )
+#if (  defined MHD  &&  ( RSOLVER == ROE || RSOLVER == HLLE || RSOLVER_HYBRID == ROE || RSOLVER_HYBRID == HLLE )  )
 #  define EULERY
 #endif
 
@@ -220,6 +220,107 @@
 #  define HLLD_WAVESPEED   HLL_WAVESPEED_DAVIS
 
 
+// hybrid Riemann solver (RSOLVER_HYBRID in the Makefile)
+// --> use RSOLVER_HYBRID (ROE/HLLE) for the interfaces in smooth regions and RSOLVER (e.g., HLLC/HLLD) only for
+//     the interfaces flagged by the pressure-jump detector in Hydro_ComputeFlux()
+// --> an interface is flagged if |P_L-P_R| > RSOLVER_HYBRID_PJUMP*min(P_L,P_R), where P_L/R are the total
+//     (i.e., gas + magnetic) pressures of the left/right states
+// --> the fraction of interfaces solved by each solver is recorded in Record__Performance (CPU only)
+#ifdef RSOLVER_HYBRID
+#  define RSOLVER_HYBRID_PJUMP   0.2
+#endif
+
+// Riemann solver applied to all interfaces (i.e., RSOLVER_HYBRID for the hybrid Riemann solver and RSOLVER otherwise)
+#ifdef RSOLVER_HYBRID
+#  define RSOLVER_ALL   RSOLVER_HYBRID
+#else
+#  define RSOLVER_ALL   RSOLVER
+#endif
+
+// CPU only: solve a whole row of interfaces (i.e., along x in g_FC_Var[]) at a time with the batched Riemann solvers
+// --> data are organized as structure-of-arrays so that the compiler can vectorize the loop over interfaces
+//     (e.g., SSE/AVX2/AVX-512 depending on the target architecture set in the Makefile)
+// --> only support pure hydro with EOS_GAMMA and HLL_WAVESPEED_DAVIS for HLLE/HLLC; otherwise the scalar solvers are used
+// --> for RSOLVER_HYBRID, only RSOLVER_HYBRID is batched and the flagged interfaces are re-solved by the scalar RSOLVER
+// --> results are identical to the scalar solvers as long as the compiler does not contract floating-point
+//     operations (e.g., into FMA; see "-ffp-contract=off" in the Makefile for BITWISE_REPRODUCIBILITY)
+#if (  !defined __CUDACC__  &&  !defined MHD  &&  EOS == EOS_GAMMA  &&  \
+       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  \
+       (  RSOLVER_ALL == ROE  ||  \
+         ( RSOLVER_ALL == HLLE && HLLE_WAVESPEED == HLL_WAVESPEED_DAVIS )  ||  \
+         ( RSOLVER_ALL == HLLC && HLLC_WAVESPEED == HLL_WAVESPEED_DAVIS )  )  )
+#  define RSOLVER_BATCH
+#endif
+
+// CPU only: evaluate the PPM slopes on the fly on a sliding window of x-y planes during the data reconstruction
+// instead of storing the slopes of all cells in g_Slope_PPM[] in advance
+// --> only the x/y slopes of the current plane and the z slopes of three adjacent planes are kept in a local array
+//     so that they stay in cache and g_Slope_PPM[] (i.e., h_Slope_PPM[]) is not allocated at all
+// --> results are identical to the unfused reconstruction
+#if (  !defined __CUDACC__  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  \
+       LR_SCHEME == PPM  )
+#  define LR_SLOPE_FUSED
+#endif
+
+// CPU only: convert the conserved variables of all cells to primitive variables at once in the data reconstruction
+// by Hydro_Con2Pri_Batch()
+// --> apply a branch-free conversion to all cells first and then invoke Hydro_Con2Pri() again only for the (rare)
+//     cells requiring the pressure floors so that MinPres/JeansMinPres do not prevent vectorization
+// --> only support pure hydro with EOS_GAMMA; results are identical to Hydro_Con2Pri() (see RSOLVER_BATCH)
+#if (  !defined __CUDACC__  &&  !defined MHD  &&  EOS == EOS_GAMMA  &&  \
+       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
+#  define CON2PRI_BATCH
+#endif
+
+// CPU only: apply the CTU transverse flux-gradient correction to a whole pencil of faces (i.e., along x in g_FC_Var[])
+// at a time so that the compiler can vectorize the loop over faces
+// --> only support pure hydro; results are identical to the cell-by-cell correction
+#if (  !defined __CUDACC__  &&  !defined MHD  &&  FLU_SCHEME == CTU  )
+#  define CTU_TGRAD_PENCIL
+#endif
+
+// CPU only: compute the edge-centered electric field and update the face-centered B field in a single pass
+// by MHD_ComputeElectric_UpdateMagnetic() instead of MHD_ComputeElectric() + MHD_UpdateMagnetic()
+// --> the electric field is only kept on two adjacent x-y planes in a local array
+// --> g_EC_Ele[] (i.e., h_EC_Ele[]) is not allocated for MHM_RP since it is then never used
+//     (CTU still requires it for the half-step transverse-gradient correction)
+// --> results are identical to the unfused CT update
+#if (  !defined __CUDACC__  &&  defined MHD  &&  ( FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
+#  define MHD_CT_FUSED
+#endif
+
+// CPU only: number of pencils (i.e., rows along the sweep direction) advanced together by the RTVD scheme
+// --> data of a block of pencils are organized as [variable][cell][pencil] so that the compiler can vectorize
+//     the loop over pencils
+// --> results are identical to advancing one pencil at a time (see RSOLVER_BATCH)
+#if ( !defined __CUDACC__  &&  FLU_SCHEME == RTVD )
+#  define RTVD_NPENCIL     8
+#endif
+
+// vectorizable FMIN/FMAX for the batched Riemann solvers
+// --> same as fmin/fmax (return the non-NaN argument and the second argument for ties) but without function calls
+#ifdef RSOLVER_BATCH
+#  define FMIN_SIMD( a, b )   (  ( ((a) < (b)) | ((b) != (b)) ) ? (a) : (b)  )
+#  define FMAX_SIMD( a, b )   (  ( ((a) > (b)) | ((b) != (b)) ) ? (a) : (b)  )
+#endif
+
+// invoke the EoS routines in the fluid solvers
+// --> EOS_GAMMA: evaluate the constant-gamma EoS directly instead of through the function pointers so that
+//     the compiler can inline and vectorize it; the function-pointer arguments are then unused
+//     --> same floating-point operations as EoS/Gamma/CPU_EoS_Gamma.cpp (see EoS_SetAuxArray_Gamma() for AuxArray[])
+//     --> disabled in GAMER_DEBUG, for which the EoS routines check the input values
+// --> otherwise: call the EoS routines through the function pointers
+#if ( EOS == EOS_GAMMA  &&  !defined GAMER_DEBUG )
+#  define EOS_DENSEINT2PRES( Func, Dens, Eint, Passive, AuxArray )   (  (real)(Eint)*(real)EOS_AUX_GAMMA_M1(AuxArray)               )
+#  define EOS_DENSPRES2EINT( Func, Dens, Pres, Passive, AuxArray )   (  (real)(Pres)*(real)EOS_AUX__GAMMA_M1(AuxArray)              )
+#  define EOS_DENSPRES2CSQR( Func, Dens, Pres, Passive, AuxArray )   (  (real)EOS_AUX_GAMMA(AuxArray)*(real)(Pres)/(real)(Dens)  )
+#else
+#  define EOS_DENSEINT2PRES( Func, Dens, Eint, Passive, AuxArray )   Func( Dens, Eint, Passive, AuxArray )
+#  define EOS_DENSPRES2EINT( Func, Dens, Pres, Passive, AuxArray )   Func( Dens, Pres, Passive, AuxArray )
+#  define EOS_DENSPRES2CSQR( Func, Dens, Pres, Passive, AuxArray )   Func( Dens, Pres, Passive, AuxArray )
+#endif
+
+
 // 2. ELBDM macro
 //=========================================================================================
 #elif ( MODEL == ELBDM )
@@ -0,0 +1,70 @@
+#ifndef __CKPTLOCAL_TYPEDEF_H__
+#define __CKPTLOCAL_TYPEDEF_H__
+
+
+/*===========================================================================
+Data structures defined here are used by the node-local checkpoints
+(OPT__CKPT_LOCAL and OPT__RESTART_LOCAL)
+===========================================================================*/
+
+#include "Macro.h"
+
+
+// directory storing the checkpoint files of all ranks sharing the same node
+// --> can be a symbolic link to a node-local storage (e.g., NVMe)
+#define CKPT_LOCAL_DIR        "Ckpt_Local"
+
+// file format identifier and version
+#define CKPT_LOCAL_MAGIC      0x47434b50
+#define CKPT_LOCAL_VERSION    1
+
+// rank storing the replica of the checkpoint of rank r (host) and rank whose replica is stored by rank r (owner)
+// --> half of the ranks apart so that the replica likely resides on a different node
+#define CKPT_LOCAL_REPLICA_HOST(  r, NRank )    (  ( (r) + MAX( (NRank)/2, 1 )           ) % (NRank)  )
+#define CKPT_LOCAL_REPLICA_OWNER( r, NRank )    (  ( (r) - MAX( (NRank)/2, 1 ) + (NRank) ) % (NRank)  )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  CkptLocal_t
+// Description :  Header of the checkpoint of a single rank
+//
+// Note        :  1. Followed by the data of all real patches level by level
+//                   --> Corner[NReal][3], NPar[NReal] (PARTICLE only), fluid[NReal][NCOMP_TOTAL][PS1^3],
+//                       magnetic[NReal][NCOMP_MAG][PS1P1*PS1^2] (MHD only), and
+//                       ParAtt[PAR_NATT_TOTAL][NParLv] (PARTICLE only)
+//                2. Followed by CutPoint[NLevel][NRank+1] in the end
+//                3. The checkpoint is an exact copy of the runtime data and is only valid for restarting with
+//                   the same executable and number of ranks
+//-------------------------------------------------------------------------------------------------------
+struct CkptLocal_t
+{
+
+   int    Magic;
+   int    Version;
+   int    NRank;
+   int    Rank;
+   int    NLevel;
+   int    PatchSize;
+   int    NCompTotal;
+   int    NCompMag;
+   int    NParAtt;
+   int    SizeReal;
+   int    DumpID;
+   long   Step;
+   long   Size;                       // total number of bytes including the header
+   double Time          [NLEVEL];
+   double dTime_AllLv   [NLEVEL];
+   long   AdvanceCounter[NLEVEL];
+   int    NPatchTotal   [NLEVEL];
+   int    NReal         [NLEVEL];     // number of real patches in this rank
+   long   NParLv        [NLEVEL];     // number of particles in this rank
+   long   NPar_AllRank;
+   double AveDensity_Init;
+
+}; // struct CkptLocal_t
+
+
+
+#endif // #ifndef __CKPTLOCAL_TYPEDEF_H__
@@ -24,6 +24,22 @@ extern double     Time_Prev[NLEVEL];                  // "previous" physical tim
 extern double     dTime_AllLv[NLEVEL];                // current evolution physical time interval at each level
 extern long       AdvanceCounter[NLEVEL];             // number of sub-steps that each level has been evolved
 extern long       NCorrUnphy[NLEVEL];                 // number of cells corrected by either OPT__1ST_FLUX_CORR or MIN_DENS/PRES
+#ifdef MHD
+extern double     MHD_DivB_Max[NLEVEL], MHD_DivB_Sqr[NLEVEL];  // max and sum of squares of div(B) accumulated by Flu_Close() for OPT__RECORD_DIVB
+extern long       MHD_DivB_NCell[NLEVEL];                      // number of cells accumulated in MHD_DivB_Sqr[]
+#endif
+#if ( MODEL == HYDRO )
+extern double     Cons_Bnd[NCOMP_TOTAL];              // fluxes across the non-periodic boundaries accumulated by Flu_Close() for OPT__RECORD_CONSERVATION
+extern double     Cons_Src[NCOMP_TOTAL];              // source terms accumulated for OPT__RECORD_CONSERVATION
+#endif
+#ifdef RSOLVER_HYBRID
+extern long       NRSolverHybrid[2];                  // number of interfaces solved by RSOLVER_HYBRID/RSOLVER
+#endif
+extern long       NIntTimeSkip[NLEVEL];               // number of coarse patches skipping temporal interpolation (OPT__INT_TIME_LAZY)
+#ifdef PARTICLE
+extern long       ParUpdate_NPar;                     // number of particles updated by Par_UpdateParticle()
+extern double     ParUpdate_Time;                     // elapsed time of Par_UpdateParticle()
+#endif
 extern long       Step;                               // number of main steps
 extern double     dTime_Base;                         // physical time interval at the base level
 
@@ -49,25 +65,47 @@ extern int        PassiveNorm_NVar;
 extern int        PassiveNorm_VarIdx[NCOMP_PASSIVE];
 
 extern double     BOX_SIZE, DT__MAX, DT__FLUID, DT__FLUID_INIT, END_T, OUTPUT_DT, DT__SYNC_PARENT_LV, DT__SYNC_CHILDREN_LV;
+extern double     DT__SUBSTEP_OVERHEAD;
+extern bool       OPT__DT_OPT_SUBSTEP;
+extern bool       OPT__FROZEN_REGION;
+extern int        FROZEN_REGION_NSTEP;
+extern double     FROZEN_REGION_TOL;
 extern long int   END_STEP;
 extern int        NX0_TOT[3], OUTPUT_STEP, REGRID_COUNT, FLU_GPU_NPGROUP, OMP_NTHREAD;
 extern int        MPI_NRank, MPI_NRank_X[3];
 extern int        GPU_NSTREAM, FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, FLAG_BUFFER_SIZE_MAXM2_LV, MAX_LEVEL;
+extern bool       OPT__ADAPTIVE_NPGROUP;
 
 extern int        OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
-extern int        INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+extern int        INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, OPT__MEMORY_POOL, RESTART_LOAD_NRANK;
+extern int        OPT__OUTPUT_COMPRESS, OPT__OUTPUT_CHUNK_NPATCH, OPT__CKPT_LOCAL;
+extern int        OPT__INIT_REFINE_MAP;
+extern int        OUTPUT_SUB_STEP, OUTPUT_SUB_LV_MIN, OUTPUT_SUB_LV_MAX;
+extern long       OUTPUT_SUB_FIELD;
+extern double     OUTPUT_SUB_EDGEL[3], OUTPUT_SUB_EDGER[3];
+extern int        OUTPUT_UG_STEP, OUTPUT_UG_LV;
+extern double     OUTPUT_UG_EDGEL[3], OUTPUT_UG_EDGER[3];
+extern int        OUTPUT_DIAG_STEP, OUTPUT_DIAG_PROJ_LV, OUTPUT_DIAG_PHASE_NBIN;
+extern long       OUTPUT_DIAG_FIELD;
+extern double     OUTPUT_DIAG_PROF_RMAX, OUTPUT_DIAG_PROF_LOGR;
 extern double     OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT_FACTOR, AUTO_REDUCE_DT_FACTOR_MIN;
 extern double     OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
+extern double     INIT_SUBSAMPLING_TOL;
 extern bool       OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
-extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__RESTART_RESET, OPT__RESTART_BULK,
+                  OPT__RESTART_LOCAL, OPT__PATCH_ARENA, OPT__FIRST_TOUCH, OPT__SG_ON_DEMAND;
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
-extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
+extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_TEXT_BINARY, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+extern bool       OPT__OUTPUT_MPIIO, OPT__OUTPUT_ASYNC, OPT__OUTPUT_SHUFFLE, OPT__OUTPUT_INDEX, OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 extern bool       OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
-extern bool       OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
-extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
+extern int        OPT__CK_FLU_OUTPUT;
+extern bool       OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI, OPT__DT_FLU_BYPRODUCT, OPT__GHOST_CACHE;
+extern bool       OPT__INT_TIME_LAZY, OPT__REGRID_LAZY, OPT__TRACE, OPT__TIMING_COUNTER, OPT__RECORD_PATCH_COST;
+extern bool       OPT__FLAG_FLU_BYPRODUCT, OPT__PREP_COST_ORDER;
+extern int        TRACE_NEVENT, OPT__RECORD_TELEMETRY;
+extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT, AUTO_REDUCE_DT_LOCAL;
 extern bool       OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
-extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
+extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER, OPT__RECORD_CONSERVATION;
 
 extern UM_IC_Format_t     OPT__UM_IC_FORMAT;
 extern TestProbID_t       TESTPROB_ID;
@@ -102,7 +140,8 @@ extern double           DUAL_ENERGY_SWITCH;
 #ifdef MHD
 extern double           FlagTable_Current[NLEVEL-1];
 extern IntScheme_t      OPT__MAG_INT_SCHEME, OPT__REF_MAG_INT_SCHEME;
-extern bool             OPT__FIXUP_ELECTRIC, OPT__CK_INTERFACE_B, OPT__OUTPUT_CC_MAG, OPT__FLAG_CURRENT;
+extern bool             OPT__FIXUP_ELECTRIC, OPT__CK_INTERFACE_B, OPT__OUTPUT_CC_MAG, OPT__FLAG_CURRENT, OPT__RECORD_DIVB;
+extern bool             OPT__EMAG_CACHE;
 extern int              OPT__CK_DIVERGENCE_B;
 extern double           UNIT_B;
 extern bool             OPT__INIT_BFIELD_BYFILE;
@@ -131,12 +170,20 @@ extern int        Rho_ParaBuf;                        // number of parallel buff
 
 extern real      *GreenFuncK;
 extern double     GFUNC_COEFF0;
+extern bool       OPT__GFUNC_CACHE;
 extern double     DT__GRAVITY;
 extern double     NEWTON_G;
 extern int        POT_GPU_NPGROUP;
 extern bool       OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__EXTERNAL_POT, OPT__GRAVITY_EXTRA_MASS;
-extern double     SOR_OMEGA;
+extern bool       OPT__FFT_PENCIL, OPT__POT_WARM_START, OPT__RECORD_POI_ITER, OPT__USG_POT_EXT;
+extern bool       OPT__USG_FUSE_EXT_ACC;
+extern double     SOR_OMEGA, SOR_TOLERATED_ERROR;
 extern int        SOR_MAX_ITER, SOR_MIN_ITER;
+extern int        POT_LEVEL_NSWEEP;
+extern int        OPT__RECORD_LEVEL_PS, LEVEL_PS_LV;
+extern bool       LEVEL_PS_INTERLACE;
+extern long       PoiNIter[NLEVEL];                   // number of Poisson-solver iterations summed over all patches (OPT__RECORD_POI_ITER)
+extern long       PoiNPatch[NLEVEL];                  // number of patches solved by the Poisson solver (OPT__RECORD_POI_ITER)
 extern double     MG_TOLERATED_ERROR;
 extern int        MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
 
@@ -160,6 +207,11 @@ extern void (*SetCPUExtPot_Ptr)( ExtPot_t & );
 extern ExtPot_t GPUExtPot_Ptr;
 extern void (*SetGPUExtPot_Ptr)( ExtPot_t & );
 #endif
+extern char       EXT_POT_TABLE_NAME[MAX_STRING];
+extern int        EXT_POT_TABLE_NPOINT[3];
+extern double     EXT_POT_TABLE_DH, EXT_POT_TABLE_EDGEL[3];
+extern real      *ExtPotTable;                        // tabulated external potential and acceleration (CPU_ExtAccPot_Tabular.cpp)
+extern long       ExtPotTable_Size;                   // number of elements in ExtPotTable[]
 #endif // #ifdef GRAVITY
 
 
@@ -177,7 +229,13 @@ extern double     LB_INPUT__WLI_MAX;                  // LB->WLI_Max loaded from
 #ifdef PARTICLE
 extern double     LB_INPUT__PAR_WEIGHT;               // LB->Par_Weight loaded from "Input__Parameter"
 #endif
-extern bool       OPT__RECORD_LOAD_BALANCE;
+extern double     LB_INPUT__MEASURED_COST;            // LB->Cost_EMA loaded from "Input__Parameter"
+#ifdef SUPPORT_GRACKLE
+extern double     LB_INPUT__CHE_WEIGHT;               // LB->Che_Weight loaded from "Input__Parameter"
+#endif
+extern bool       OPT__RECORD_LOAD_BALANCE, OPT__LB_INCREMENTAL, OPT__LB_COUPLE_LEVEL, OPT__LB_DERIVED_TYPE,
+                  OPT__LB_DIST_GRAPH, OPT__MPI_PROGRESS;
+extern OptLBCurve_t OPT__LB_CURVE;
 #endif
 extern bool       OPT__MINIMIZE_MPI_BARRIER;
 
@@ -198,6 +256,9 @@ extern ParOutputDens_t OPT__OUTPUT_PAR_DENS;
 #ifdef SUPPORT_LIBYT
 extern char            YT_SCRIPT[MAX_STRING];
 extern yt_verbose      YT_VERBOSE;
+extern int             YT_STEP, YT_ASYNC_NCORE;
+extern bool            YT_ASYNC;
+extern double          YT_ASYNC_MAX_MEM;
 #endif
 
 
@@ -218,6 +279,8 @@ extern int             GRACKLE_THREE_BODY_RATE;
 extern bool            GRACKLE_CIE_COOLING;
 extern int             GRACKLE_H2_OPA_APPROX;
 extern int             CHE_GPU_NPGROUP;
+extern bool            GRACKLE_ZERO_COPY;
+extern double          GRACKLE_SCREEN_TCOOL;
 #endif
 
 
@@ -242,6 +305,11 @@ extern double EoS_AuxArray[EOS_NAUX_MAX];
 extern EoS_DE2P_t EoS_DensEint2Pres_CPUPtr;
 extern EoS_DP2E_t EoS_DensPres2Eint_CPUPtr;
 extern EoS_DP2C_t EoS_DensPres2CSqr_CPUPtr;
+#if ( EOS == EOS_TABULAR )
+extern char       EOS_TABLE_NAME[MAX_STRING];         // table of the tabulated EoS (CPU_EoS_Tabular.cpp)
+extern real      *EoS_Table;                          // tabulated EoS
+extern long       EoS_Table_Size;                     // number of elements in EoS_Table[]
+#endif
 #ifdef GPU
 extern EoS_DE2P_t EoS_DensEint2Pres_GPUPtr;
 extern EoS_DP2E_t EoS_DensPres2Eint_GPUPtr;
@@ -289,9 +357,11 @@ extern real       (*h_Flu_Array_USG_G[2])[GRA_NIN-1][PS1][PS1][PS1];
 
 #ifdef SUPPORT_GRACKLE
 extern real       (*h_Che_Array      [2]);
+extern double      *h_Che_Cost;
 // do not declare Grackle variables for CUDA source files since they do not include <grackle.h>
 #ifndef __CUDACC__
 extern grackle_field_data *Che_FieldData;
+extern grackle_field_data *Che_FieldData_Patch;
 extern code_units Che_Units;
 #endif
 #endif
@@ -57,6 +57,7 @@ struct KeyInfo_t
 #  if ( MODEL == HYDRO )
    int    Magnetohydrodynamics;
 #  endif
+   int    LBCurve;                  // OPT__LB_CURVE (space-filling curve of Tree/LBIdx)
 
    long   Step;
    long   AdvanceCounter[NLEVEL];
@@ -102,6 +103,7 @@ struct Makefile_t
    int Timing;
    int TimingSolver;
    int Float8;
+   int MixedPrecision;
    int Serial;
    int LoadBalance;
    int OverlapMPI;
@@ -331,6 +333,18 @@ struct InputPara_t
    int    Par_PredictPos;
    double Par_RemoveCell;
    int    Par_GhostSize;
+   int    Par_SortInterval;
+   int    Par_DepositNParThread;
+   int    Par_CollectCache;
+   int    Par_DensCache;
+   int    Par_MaxSubCycle;
+   int    Par_ShortRangeAcc;
+   double Par_SR_Soften;
+   double Par_SR_Radius;
+   double Par_FreezeFluRatio;
+#  ifdef LOAD_BALANCE
+   int    Par_CompressMPI;
+#  endif
    char  *ParAttLabel[PAR_NATT_TOTAL];
 #  endif
 
@@ -363,13 +377,23 @@ struct InputPara_t
    double Dt__SyncChildrenLv;
    int    Opt__DtUser;
    int    Opt__DtLevel;
+   int    Opt__DtOptSubStep;
+   double Dt__SubStepOverhead;
    int    Opt__RecordDt;
    int    AutoReduceDt;
    double AutoReduceDtFactor;
    double AutoReduceDtFactorMin;
+#  if ( MODEL == HYDRO )
+   int    Opt__DtFluByproduct;
+   int    AutoReduceDtLocal;
+   int    Opt__FrozenRegion;
+   int    FrozenRegion_NStep;
+   double FrozenRegion_Tol;
+#  endif
 
 // domain refinement
    int    RegridCount;
+   int    Opt__RegridLazy;
    int    FlagBufferSize;
    int    FlagBufferSizeMaxM1Lv;
    int    FlagBufferSizeMaxM2Lv;
@@ -396,6 +420,7 @@ struct InputPara_t
    int    Opt__Flag_LohnerForm;
    int    Opt__Flag_User;
    int    Opt__Flag_Region;
+   int    Opt__Flag_FluByproduct;
 #  ifdef PARTICLE
    int    Opt__Flag_NParPatch;
    int    Opt__Flag_NParCell;
@@ -408,6 +433,9 @@ struct InputPara_t
 #  endif
    int    Opt__ReuseMemory;
    int    Opt__MemoryPool;
+   int    Opt__PatchArena;
+   int    Opt__FirstTouch;
+   int    Opt__SG_OnDemand;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -416,6 +444,15 @@ struct InputPara_t
    double LB_Par_Weight;
 #  endif
    int    Opt__RecordLoadBalance;
+   double LB_MeasuredCost;
+#  ifdef SUPPORT_GRACKLE
+   double LB_Che_Weight;
+#  endif
+   int    Opt__LB_Incremental;
+   int    Opt__LB_CoupleLevel;
+   int    Opt__LB_DerivedType;
+   int    Opt__LB_DistGraph;
+   int    Opt__MPI_Progress;
 #  endif
    int    Opt__MinimizeMPIBarrier;
 
@@ -424,6 +461,9 @@ struct InputPara_t
    double Gamma;
    double MolecularWeight;
    double IsoTemp;
+#  if ( EOS == EOS_TABULAR )
+   char  *EoS_TableName;
+#  endif
    double MinMod_Coeff;
    int    Opt__LR_Limiter;
    int    Opt__1stFluxCorr;
@@ -444,6 +484,7 @@ struct InputPara_t
 // fluid solvers in different models
    int    Flu_GPU_NPGroup;
    int    GPU_NStream;
+   int    Opt__AdaptiveNPGroup;
    int    Opt__FixUp_Flux;
 #  ifdef MHD
    int    Opt__FixUp_Electric;
@@ -481,6 +522,7 @@ struct InputPara_t
    double SOR_Omega;
    int    SOR_MaxIter;
    int    SOR_MinIter;
+   double SOR_ToleratedError;
 #  elif ( POT_SCHEME == MG )
    int    MG_MaxIter;
    int    MG_NPreSmooth;
@@ -491,7 +533,21 @@ struct InputPara_t
    int    Opt__GraP5Gradient;
    int    Opt__GravityType;
    int    Opt__ExternalPot;
+   int    Opt__USG_PotExt;
+   char  *ExtPotTable_Name;
+   int    ExtPotTable_NPoint[3];
+   double ExtPotTable_dh;
+   double ExtPotTable_EdgeL[3];
+   int    Opt__USG_FuseExtAcc;
    int    Opt__GravityExtraMass;
+   int    Opt__FFT_Pencil;
+   int    Opt__PotWarmStart;
+   int    Opt__RecordPoiIter;
+   int    Pot_LevelNSweep;
+   int    Opt__GFuncCache;
+   int    Opt__RecordLevelPS;
+   int    LevelPS_Lv;
+   int    LevelPS_Interlace;
 #  endif
 
 // Grackle
@@ -510,6 +566,8 @@ struct InputPara_t
    int    Grackle_CIE_Cooling;
    int    Grackle_H2_OpaApprox;
    int    Che_GPU_NPGroup;
+   int    Grackle_ZeroCopy;
+   double Grackle_ScreenTCool;
 #  endif
 
 // star formation
@@ -528,6 +586,8 @@ struct InputPara_t
    int    Opt__Init;
    int    RestartLoadNRank;
    int    Opt__RestartReset;
+   int    Opt__RestartBulk;
+   int    Opt__RestartLocal;
    int    Opt__UM_IC_Level;
    int    Opt__UM_IC_NVar;
    int    Opt__UM_IC_Format;
@@ -536,14 +596,17 @@ struct InputPara_t
    int    Opt__UM_IC_LoadNRank;
    int    Opt__InitRestrict;
    int    Opt__InitGridWithOMP;
+   int    Opt__InitRefineMap;
    int    Opt__GPUID_Select;
    int    Init_Subsampling_NCell;
+   double Init_Subsampling_Tol;
 #  ifdef MHD
    int    Opt__InitBFieldByFile;
 #  endif
 
 // interpolation schemes
    int    Opt__Int_Time;
+   int    Opt__Int_TimeLazy;
 #  if ( MODEL == ELBDM )
    int    Opt__Int_Phase;
 #  endif
@@ -552,6 +615,7 @@ struct InputPara_t
 #  ifdef MHD
    int    Opt__Mag_IntScheme;
    int    Opt__RefMag_IntScheme;
+   int    Opt__EMagCache;
 #  endif
 #  ifdef GRAVITY
    int    Opt__Pot_IntScheme;
@@ -561,6 +625,8 @@ struct InputPara_t
 #  endif
    double IntMonoCoeff;
    int    IntOppSign0thOrder;
+   int    Opt__GhostCache;
+   int    Opt__PrepCostOrder;
 
 // data dump
    int    Opt__Output_Total;
@@ -587,18 +653,57 @@ struct InputPara_t
    double Output_PartY;
    double Output_PartZ;
    int    InitDumpID;
+   int    Opt__Output_MPIIO;
+   int    Opt__Output_Async;
+   int    Opt__Output_Compress;
+   int    Opt__Output_Shuffle;
+   int    Opt__Output_ChunkNPatch;
+   int    Opt__Output_Index;
+   int    Opt__CkptLocal;
+   int    Output_Sub_Step;
+   int    Output_Sub_LvMin;
+   int    Output_Sub_LvMax;
+   long   Output_Sub_Field;
+   double Output_Sub_EdgeL[3];
+   double Output_Sub_EdgeR[3];
+   int    Output_UG_Step;
+   int    Output_UG_Lv;
+   double Output_UG_EdgeL[3];
+   double Output_UG_EdgeR[3];
+   int    Output_Diag_Step;
+   long   Output_Diag_Field;
+   int    Output_Diag_ProjLv;
+   double Output_Diag_ProfRMax;
+   double Output_Diag_ProfLogR;
+   int    Output_Diag_PhaseNBin;
+   int    Opt__Output_TextBinary;
 
 // miscellaneous
    int    Opt__Verbose;
    int    Opt__TimingBarrier;
    int    Opt__TimingBalance;
    int    Opt__TimingMPI;
+   int    Opt__Trace;
+   int    Trace_NEvent;
+   int    Opt__TimingCounter;
    int    Opt__RecordNote;
    int    Opt__RecordUnphy;
    int    Opt__RecordMemory;
    int    Opt__RecordPerformance;
+   int    Opt__RecordTelemetry;
+   int    Opt__RecordPatchCost;
+   int    Opt__RecordConservation;
    int    Opt__ManualControl;
    int    Opt__RecordUser;
+#  ifdef SUPPORT_LIBYT
+   int    Yt_Step;
+   int    Yt_Async;
+   int    Yt_AsyncNCore;
+   double Yt_AsyncMaxMem;
+#  endif
+#  ifdef MHD
+   int    Opt__RecordDivB;
+#  endif
    int    Opt__OptimizeAggressive;
 
 // simulation checks
@@ -610,6 +715,7 @@ struct InputPara_t
    int    Opt__Ck_Finite;
    int    Opt__Ck_PatchAllocate;
    int    Opt__Ck_FluxAllocate;
+   int    Opt__Ck_FluOutput;
 #  if ( MODEL == HYDRO )
    int    Opt__Ck_Negative;
 #  endif
@@ -33,11 +33,26 @@
 //                WLI_Max                 : WLI threshold for redistributing patches at all levels
 //                Par_Weight              : Load-balance weighting of one particle over one cell
 //                                          --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*Par_Weight"
+//                Che_Weight              : Load-balance weighting of the Grackle update of a patch with the average
+//                                          measured Grackle cost over the fluid update of one patch
+//                                          --> <= 0.0 : do not consider the Grackle cost
+//                Cost_EMA                : Weighting of the latest measurement in the exponential moving average of Cost_Factor
+//                                          --> <= 0.0 : disable the measured-cost workload model
+//                Cost_Factor             : Measured compute time per unit estimated workload in this rank normalized
+//                                          by the average over all ranks (see LB_RecordMeasuredCost)
 //                CutPoint                : Cut points in the space filling curve
 //                IdxList_Real            : Sorted LB_Idx list of all real patches
 //                IdxList_Real_IdxTable   : Index table for LB_IdxList_Real
 //                PaddedCr1DList          : Sorted PaddedCr1D list of all patches (real + buffer)
 //                PaddedCr1DList_IdxTable : Index table for LB_PaddedC1DrList
+//                NeighborComm            : Distributed graph communicator connecting this rank to all ranks
+//                                          in any send/recv list below (for OPT__LB_DIST_GRAPH)
+//                NNeighbor               : Number of neighbor ranks in NeighborComm
+//                NeighborRank            : Sorted neighbor ranks in NeighborComm (excluding this rank)
+//                SonDir_N                : Number of entries in the son directory
+//                SonDir_Idx              : Sorted LB_Idx already queried by LB_FindSonNotHome() at each level
+//                SonDir_Found            : Whether the real patch with SonDir_Idx exists in its home rank
+//                                          --> Cached until the real patches at that level change (see ResetSonDir)
 //
 //                SendH_NList             : Number of patches    for sending   hydrodynamic data
 //                SendH_IDList            : Patch indices        for sending   hydrodynamic data
@@ -132,11 +147,22 @@ struct LB_t
 #  ifdef PARTICLE
    double Par_Weight;
 #  endif
+#  ifdef SUPPORT_GRACKLE
+   double Che_Weight;
+#  endif
+   double Cost_EMA;
+   double Cost_Factor;
    long  *CutPoint               [NLEVEL];
    long  *IdxList_Real           [NLEVEL];
    int   *IdxList_Real_IdxTable  [NLEVEL];
    ulong *PaddedCr1DList         [NLEVEL];
    int   *PaddedCr1DList_IdxTable[NLEVEL];
+   MPI_Comm NeighborComm         [NLEVEL];
+   int    NNeighbor              [NLEVEL];
+   int   *NeighborRank           [NLEVEL];
+   int    SonDir_N               [NLEVEL];
+   long  *SonDir_Idx             [NLEVEL];
+   char  *SonDir_Found           [NLEVEL];
 
    int   *SendH_NList            [NLEVEL];
    int  **SendH_IDList           [NLEVEL];
@@ -225,16 +251,24 @@ struct LB_t
    // Parameter   :  NRank             : Number of MPI ranks
    //                Input__WLI_Max    : WLI_Max loaded from the input parameter file
    //                Input__Par_Weight : Par_Weight loaded from the input parameter file
+   //                Input__Cost_EMA   : Cost_EMA loaded from the input parameter file
+   //                Input__Che_Weight : Che_Weight loaded from the input parameter file
    //===================================================================================
-   LB_t( const int NRank, const double Input__WLI_Max, const double Input__Par_Weight )
+   LB_t( const int NRank, const double Input__WLI_Max, const double Input__Par_Weight, const double Input__Cost_EMA,
+         const double Input__Che_Weight )
    {
 
-      MPI_NRank  = NRank;
-      WLI        = NULL_REAL;
-      WLI_Max    = Input__WLI_Max;
+      MPI_NRank   = NRank;
+      WLI         = NULL_REAL;
+      WLI_Max     = Input__WLI_Max;
 #     ifdef PARTICLE
-      Par_Weight = Input__Par_Weight;
+      Par_Weight  = Input__Par_Weight;
+#     endif
+#     ifdef SUPPORT_GRACKLE
+      Che_Weight  = Input__Che_Weight;
 #     endif
+      Cost_EMA    = Input__Cost_EMA;
+      Cost_Factor = 1.0;
 
       for (int lv=0; lv<NLEVEL; lv++)
       {
@@ -253,6 +287,12 @@ struct LB_t
          IdxList_Real_IdxTable  [lv] = NULL;
          PaddedCr1DList         [lv] = NULL;
          PaddedCr1DList_IdxTable[lv] = NULL;
+         NeighborComm           [lv] = MPI_COMM_NULL;
+         NNeighbor              [lv] = 0;
+         NeighborRank           [lv] = NULL;
+         SonDir_N               [lv] = 0;
+         SonDir_Idx             [lv] = NULL;
+         SonDir_Found           [lv] = NULL;
 
          SendH_NList            [lv] = new int   [MPI_NRank];
          SendH_IDList           [lv] = new int*  [MPI_NRank];
@@ -428,6 +468,12 @@ struct LB_t
          if ( CutPoint [lv] != NULL )  delete [] CutPoint[lv];
          CutPoint[lv] = NULL;
 
+//       neighbor graph (not reset by reset() since it is rebuilt together with the send/recv lists)
+         if ( NeighborComm[lv] != MPI_COMM_NULL )  MPI_Comm_free( &NeighborComm[lv] );
+         if ( NeighborRank[lv] != NULL )           delete [] NeighborRank[lv];
+         NeighborRank[lv] = NULL;
+         NNeighbor   [lv] = 0;
+
 //       NList
          if ( SendH_NList   [lv] != NULL )   delete [] SendH_NList   [lv];
          if ( RecvH_NList   [lv] != NULL )   delete [] RecvH_NList   [lv];
@@ -620,6 +666,8 @@ struct LB_t
       PaddedCr1DList         [lv] = NULL;
       PaddedCr1DList_IdxTable[lv] = NULL;
 
+      ResetSonDir( lv );
+
       for (int r=0; r<MPI_NRank; r++)
       {
 //       NList
@@ -757,6 +805,28 @@ struct LB_t
    } // METHOD : reset
 
 
+
+   //===================================================================================
+   // Method      :  ResetSonDir
+   // Description :  Clear the son directory used by LB_FindSonNotHome()
+   //
+   // Note        :  1. Must be invoked whenever the real patches at the target level change
+   //                   (i.e., whenever IdxList_Real[lv] is reconstructed)
+   //                   --> All ranks must invoke it together to keep the cached replies consistent
+   //
+   // Parameter   :  lv : Target refinement level
+   //===================================================================================
+   void ResetSonDir( const int lv )
+   {
+      if ( SonDir_Idx  [lv] != NULL )  free( SonDir_Idx  [lv] );
+      if ( SonDir_Found[lv] != NULL )  free( SonDir_Found[lv] );
+
+      SonDir_N    [lv] = 0;
+      SonDir_Idx  [lv] = NULL;
+      SonDir_Found[lv] = NULL;
+   } // METHOD : ResetSonDir
+
+
 }; // struct LB_t
 
 
@@ -67,6 +67,9 @@
 #define DE_UPDATED_BY_DUAL       ('1')
 #define DE_UPDATED_BY_MIN_PRES   ('2')
 #define DE_UPDATED_BY_ETOT_GRA   ('3')
+
+// patch_t::de_uniform of a patch whose cells have different dual-energy status
+#define DE_STATUS_MIXED          ('\0')
 #endif
 
 
@@ -90,6 +93,7 @@
 // random number implementation
 #define RNG_GNU_EXT  1
 #define RNG_CPP11    2
+#define RNG_PHILOX   3
 
 
 // NCOMP_FLUID : number of active components in each cell (for patch->fluid[])
@@ -532,7 +536,10 @@
 
 
 // patch size (number of cells of a single patch in the x/y/z directions)
-#define PATCH_SIZE                   8
+// --> can be set to 16 in the Makefile to reduce the ghost-zone overhead of the solvers
+#ifndef PATCH_SIZE
+#  define PATCH_SIZE                 8
+#endif
 #define PS1             ( 1*PATCH_SIZE )
 #define PS2             ( 2*PATCH_SIZE )
 #define PS2P1           ( PS2 + 1 )
@@ -569,6 +576,24 @@
 #  define EOS_NAUX_MAX           10    // EoS_AuxArray[]
 #endif
 
+
+// coefficients of the constant-gamma EoS stored in EoS_AuxArray[] (see EoS_SetAuxArray_Gamma())
+// --> GAMMA_CONST: replace them by compile-time constants so that the compiler can constant-fold the
+//     EoS arithmetic in all hydro solvers; EoS_AuxArray[] is still set for the remaining routines
+#if ( MODEL == HYDRO )
+#  ifdef GAMMA_CONST
+#     define EOS_AUX_GAMMA(     AuxArray )   (  GAMMA_CONST                 )
+#     define EOS_AUX_GAMMA_M1(  AuxArray )   (  GAMMA_CONST - 1.0           )
+#     define EOS_AUX__GAMMA_M1( AuxArray )   (  1.0 / ( GAMMA_CONST - 1.0 ) )
+#     define EOS_AUX__GAMMA(    AuxArray )   (  1.0 / GAMMA_CONST           )
+#  else
+#     define EOS_AUX_GAMMA(     AuxArray )   (  (AuxArray)[0]  )
+#     define EOS_AUX_GAMMA_M1(  AuxArray )   (  (AuxArray)[1]  )
+#     define EOS_AUX__GAMMA_M1( AuxArray )   (  (AuxArray)[2]  )
+#     define EOS_AUX__GAMMA(    AuxArray )   (  (AuxArray)[3]  )
+#  endif
+#endif
+
 #ifdef GRAVITY
 #  define EXT_POT_NAUX_MAX       10    // ExtPot_AuxArray[]
 #  define EXT_ACC_NAUX_MAX       10    // ExtAcc_AuxArray[]
@@ -576,6 +601,9 @@
 
 
 // bitwise reproducibility in flux and electric field fix-up operations
+// --> BIT_REP_FLUX accumulates the fine-grid fluxes onto the coarse-grid fluxes in the same order regardless of
+//     the parallelization (see LB_SeedBufferFlux() and Buf_SeedBufferFlux()) and thus requires no additional
+//     flux array
 #if ( MODEL == HYDRO )
 # ifdef BITWISE_REPRODUCIBILITY
 #  define BIT_REP_FLUX
@@ -718,6 +746,30 @@
 #define TIMER_OFF          0
 
 
+// phases recorded by OPT__RECORD_PATCH_COST (see Aux_Record_PatchCost.cpp)
+#define PATCH_COST_FLU_PREPARE   0
+#define PATCH_COST_INTERP        1
+#define PATCH_COST_FIXUP_FLUX    2
+#define PATCH_COST_RESTRICT      3
+#define PATCH_COST_NPHASE        4
+
+
+// types of the patch field arrays allocated from the patch arena for OPT__PATCH_ARENA (see Mis_PatchArena.cpp)
+#define PATCH_ARENA_FLU          0
+#define PATCH_ARENA_MAG          1
+#define PATCH_ARENA_POT          2
+#define PATCH_ARENA_POT_EXT      3
+#define PATCH_ARENA_DE_STATUS    4
+#define PATCH_ARENA_RHO_EXT      5
+#define PATCH_ARENA_NTYPE        6
+
+
+// states of the patch groups for OPT__FROZEN_REGION (see Flu_FrozenRegion.cpp)
+#define FRZ_NONE                 0
+#define FRZ_SKIP                 1
+#define FRZ_CATCHUP              2
+
+
 // symbolic constant for Aux_Error()
 #define ERROR_INFO         __FILE__, __LINE__, __FUNCTION__
 
@@ -834,6 +886,7 @@
 
 #  if ( FLU_SCHEME != MHM  &&  FLU_SCHEME != MHM_RP  &&  FLU_SCHEME != CTU )
 #  undef RSOLVER
+#  undef RSOLVER_HYBRID
 #  endif
 #endif
 
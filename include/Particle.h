@@ -16,6 +16,10 @@
 #  define PARLIST_GROWTH_FACTOR     1.1
 #  define PARLIST_REDUCE_FACTOR     0.8
 
+// Factor used in "Reserve" to grow the particle repository geometrically, which is more aggressive than
+// PARLIST_GROWTH_FACTOR since the repository is large and copying it is expensive (must >= 1.0)
+#  define PARREPO_GROWTH_FACTOR     1.5
+
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 
 
@@ -46,6 +50,23 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                PredictPos              : Predict particle position during mass assignment
 //                RemoveCell              : remove particles RemoveCell-base-level-cells away from the boundary
 //                                          (for non-periodic BC only)
+//                CompressMPI             : Particle exchanges to be compressed losslessly (bitwise PAR_COMPRESS_MPI_*)
+//                                          --> For LOAD_BALANCE only
+//                SortInterval            : Reorder the particle repository by patches every SortInterval root-level
+//                                          steps (<=0 --> off)
+//                DepositNParThread       : Split particles of a single patch across all OpenMP threads in the mass
+//                                          assignment if the patch has at least DepositNParThread particles (<=0 --> off)
+//                CollectCache            : Keep the results of Par_CollectParticle2OneLevel() until particles are moved
+//                DensCache               : Keep the particle density deposited onto rho_ext[] at each level until
+//                                          particles are moved
+//                MaxSubCycle             : Maximum number of power-of-two sub-cycling levels of individual particles
+//                                          within one level step (i.e., at most 2^MaxSubCycle sub-steps; 0 --> off)
+//                ShortRangeAcc           : Add the short-range correction to the particle acceleration interpolated
+//                                          from the mesh potential (see Par_ShortRangeAcc())
+//                SR_Soften               : Plummer softening length of the short-range correction
+//                SR_Radius               : Radius (in units of the cell size) within which the mesh force is corrected
+//                FreezeFluRatio          : Skip the fluid update at levels where the gas mass < FreezeFluRatio*particle mass
+//                                          (<=0 --> off)
 //                GhostSize               : Number of ghost zones required for interpolation scheme
 //                Attribute               : Pointer arrays to different particle attributes (Mass, Pos, Vel, ...)
 //                InactiveParList         : List of inactive particle IDs
@@ -94,8 +115,11 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Method      :  Particle_t        : Constructor
 //               ~Particle_t        : Destructor
 //                InitRepo          : Initialize particle repository
+//                Reserve           : Allocate enough memory for adding new particles
 //                AddOneParticle    : Add one new particle into the particle list
+//                AddParticles      : Add multiple new particles into the particle list
 //                RemoveOneParticle : Remove one particle from the particle list
+//                ReorderRepo       : Reorder the particle repository
 //-------------------------------------------------------------------------------------------------------
 struct Particle_t
 {
@@ -117,6 +141,16 @@ struct Particle_t
    bool          ImproveAcc;
    bool          PredictPos;
    double        RemoveCell;
+   ParCompressMPI_t CompressMPI;
+   int           SortInterval;
+   int           DepositNParThread;
+   bool          CollectCache;
+   bool          DensCache;
+   int           MaxSubCycle;
+   bool          ShortRangeAcc;
+   double        SR_Soften;
+   double        SR_Radius;
+   double        FreezeFluRatio;
    int           GhostSize;
    real         *Attribute[PAR_NATT_TOTAL];
    long         *InactiveParList;
@@ -180,6 +214,16 @@ struct Particle_t
       ImproveAcc          = true;
       PredictPos          = true;
       RemoveCell          = -999.9;
+      CompressMPI         = PAR_COMPRESS_MPI_NONE;
+      SortInterval        = 0;
+      DepositNParThread   = 0;
+      CollectCache        = false;
+      DensCache           = false;
+      MaxSubCycle         = 0;
+      ShortRangeAcc       = false;
+      SR_Soften           = -1.0;
+      SR_Radius           = 1.5;
+      FreezeFluRatio      = 0.0;
       GhostSize           = -1;
 
       for (int lv=0; lv<NLEVEL; lv++)  NPar_Lv[lv] = 0;
@@ -366,6 +410,51 @@ struct Particle_t
 
 
 
+   //===================================================================================
+   // Method      :  Reserve
+   // Description :  Allocate enough memory for adding NNew particles
+   //
+   // Note        :  1. Inactive particle IDs will be reused first
+   //                2. The repository grows at least by a factor of PARREPO_GROWTH_FACTOR so that repeatedly
+   //                   adding particles leads to an amortized O(1) cost per particle
+   //                3. Pointers to the particle attributes (e.g., Mass, PosX) may change after calling
+   //                   this function
+   //                4. Invoke it before adding many particles at once (e.g., by AddOneParticle()) to avoid
+   //                   repeated reallocations
+   //
+   // Parameter   :  NNew : Number of particles to be added
+   //
+   // Return      :  Attribute[], ParListSize, and the pointers to different attributes
+   //===================================================================================
+   void Reserve( const long NNew )
+   {
+
+      const long NParRequired = NPar_AcPlusInac + MAX( NNew - NPar_Inactive, 0L );
+
+      if ( NParRequired <= ParListSize )  return;
+
+      ParListSize = MAX( NParRequired, (long)ceil(PARREPO_GROWTH_FACTOR*ParListSize) );
+
+      for (int v=0; v<PAR_NATT_TOTAL; v++)   Attribute[v] = (real*)realloc( Attribute[v], ParListSize*sizeof(real) );
+
+      Mass = Attribute[PAR_MASS];
+      PosX = Attribute[PAR_POSX];
+      PosY = Attribute[PAR_POSY];
+      PosZ = Attribute[PAR_POSZ];
+      VelX = Attribute[PAR_VELX];
+      VelY = Attribute[PAR_VELY];
+      VelZ = Attribute[PAR_VELZ];
+      Time = Attribute[PAR_TIME];
+#     ifdef STORE_PAR_ACC
+      AccX = Attribute[PAR_ACCX];
+      AccY = Attribute[PAR_ACCY];
+      AccZ = Attribute[PAR_ACCZ];
+#     endif
+
+   } // METHOD : Reserve
+
+
+
    //===================================================================================
    // Method      :  AddOneParticle
    // Description :  Add ONE new particle into the particle list
@@ -422,26 +511,7 @@ struct Particle_t
       else
       {
 //       allocate enough memory for the particle variable array
-         if ( NPar_AcPlusInac >= ParListSize )
-         {
-            ParListSize = (int)ceil( PARLIST_GROWTH_FACTOR*(ParListSize+1) );
-
-            for (int v=0; v<PAR_NATT_TOTAL; v++)   Attribute[v] = (real*)realloc( Attribute[v], ParListSize*sizeof(real) );
-
-            Mass = Attribute[PAR_MASS];
-            PosX = Attribute[PAR_POSX];
-            PosY = Attribute[PAR_POSY];
-            PosZ = Attribute[PAR_POSZ];
-            VelX = Attribute[PAR_VELX];
-            VelY = Attribute[PAR_VELY];
-            VelZ = Attribute[PAR_VELZ];
-            Time = Attribute[PAR_TIME];
-#           ifdef STORE_PAR_ACC
-            AccX = Attribute[PAR_ACCX];
-            AccY = Attribute[PAR_ACCY];
-            AccZ = Attribute[PAR_ACCZ];
-#           endif
-         }
+         if ( NPar_AcPlusInac >= ParListSize )  Reserve( 1 );
 
          ParID = NPar_AcPlusInac;
          NPar_AcPlusInac ++;
@@ -463,6 +533,68 @@ struct Particle_t
 
 
 
+   //===================================================================================
+   // Method      :  AddParticles
+   // Description :  Add NNew new particles into the particle list
+   //
+   // Note        :  1. Invoke Reserve() once and then AddOneParticle() for each particle
+   //                   --> At most one reallocation of the particle repository
+   //                2. Same as AddOneParticle(), this function is not thread-safe
+   //                   --> Collect new particles of different threads first and then add them together
+   //                       (e.g., see SF_CreateStar_AGORA())
+   //
+   // Parameter   :  NNew     : Number of particles to be added
+   //                NewAtt   : Array storing the attributes of new particles with the layout [NNew][PAR_NATT_TOTAL]
+   //                NewParID : Array to store the indices of the new particles (ParID)
+   //
+   // Return      :  NewParID[]
+   //===================================================================================
+   void AddParticles( const long NNew, const real *NewAtt, long *NewParID )
+   {
+
+      Reserve( NNew );
+
+      for (long p=0; p<NNew; p++)   NewParID[p] = AddOneParticle( NewAtt + p*PAR_NATT_TOTAL );
+
+   } // METHOD : AddParticles
+
+
+
+   //===================================================================================
+   // Method      :  AllocateParticleIDs
+   // Description :  Allocate the indices of NNew new particles without setting their attributes
+   //
+   // Note        :  1. Assign the same indices as AddParticles() would, reusing inactive particle
+   //                   IDs first
+   //                2. Attributes of the new particles must be set by the caller afterwards
+   //                   --> Different particles can thus be set by different OpenMP threads
+   //                       (e.g., see SF_CreateStar_AGORA())
+   //                3. Not thread-safe
+   //
+   // Parameter   :  NNew     : Number of particles to be added
+   //                NewParID : Array to store the indices of the new particles (ParID)
+   //
+   // Return      :  NewParID[]
+   //===================================================================================
+   void AllocateParticleIDs( const long NNew, long *NewParID )
+   {
+
+      Reserve( NNew );
+
+      const long NReuse = MIN( NNew, NPar_Inactive );
+
+      for (long p=0; p<NReuse; p++)    NewParID[p] = InactiveParList[ NPar_Inactive-1-p ];
+
+      for (long p=NReuse; p<NNew; p++) NewParID[p] = NPar_AcPlusInac + p - NReuse;
+
+      NPar_Inactive   -= NReuse;
+      NPar_AcPlusInac += NNew - NReuse;
+      NPar_Active     += NNew;
+
+   } // METHOD : AllocateParticleIDs
+
+
+
    //===================================================================================
    // Method      :  RemoveOneParticle
    // Description :  Remove ONE particle from the particle list
@@ -527,6 +659,53 @@ struct Particle_t
    } // METHOD : RemoveOneParticle
 
 
+
+   //===================================================================================
+   // Method      :  ReorderRepo
+   // Description :  Reorder the particle repository
+   //
+   // Note        :  1. The new particle ID of the particle originally stored at OldID[NewID] is NewID
+   //                   --> All particle IDs recorded elsewhere (e.g., ParList[] and InactiveParList[])
+   //                       must be updated by the caller
+   //                2. OldID[] must be a permutation of [0 ... NPar_AcPlusInac-1]
+   //                3. Invoked by Par_SortByPatch()
+   //
+   // Parameter   :  OldID : Old particle IDs in the new order
+   //
+   // Return      :  Attribute[] and the pointers to different attributes
+   //===================================================================================
+   void ReorderRepo( const long *OldID )
+   {
+
+      for (int v=0; v<PAR_NATT_TOTAL; v++)
+      {
+//       use malloc so that realloc can be used later to resize the array
+         real *NewAtt = (real*)malloc( ParListSize*sizeof(real) );
+
+#        pragma omp parallel for schedule( static )
+         for (long t=0; t<NPar_AcPlusInac; t++)    NewAtt[t] = Attribute[v][ OldID[t] ];
+
+         free( Attribute[v] );
+         Attribute[v] = NewAtt;
+      }
+
+      Mass = Attribute[PAR_MASS];
+      PosX = Attribute[PAR_POSX];
+      PosY = Attribute[PAR_POSY];
+      PosZ = Attribute[PAR_POSZ];
+      VelX = Attribute[PAR_VELX];
+      VelY = Attribute[PAR_VELY];
+      VelZ = Attribute[PAR_VELZ];
+      Time = Attribute[PAR_TIME];
+#     ifdef STORE_PAR_ACC
+      AccX = Attribute[PAR_ACCX];
+      AccY = Attribute[PAR_ACCY];
+      AccZ = Attribute[PAR_ACCZ];
+#     endif
+
+   } // METHOD : ReorderRepo
+
+
 }; // struct Particle_t
 
 
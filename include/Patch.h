@@ -15,6 +15,13 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 void Aux_Message( FILE *Type, const char *Format, ... );
 ulong Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
+void *Mis_PatchArena_Alloc( const int Type, const int ArenaID );
+void  Mis_PatchArena_Free( const int Type, const int ArenaID, void *Ptr );
+
+extern bool OPT__PATCH_ARENA;
+
+// cache-line size assumed by the layout of patch_t (see patch_t::operator new)
+#define PATCH_CACHE_LINE   64
 
 
 
@@ -26,6 +33,13 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 // Data Member :  fluid           : Fluid variables (mass density, momentum density x, y ,z, energy density)
 //                                  --> Including passively advected variables (e.g., metal density)
 //                magnetic        : Magnetic field (Bx, By, Bz)
+//                emag            : Cached cell-centered magnetic energy (i.e., 0.5*B^2) for OPT__EMAG_CACHE
+//                                  --> Filled by Flu_Close() for the updated patches and returned by
+//                                      MHD_GetCellCenteredBEnergyInPatch() as long as emag_valid is true
+//                                  --> Allocated on demand and deallocated together with magnetic[]
+//                emag_valid      : Whether emag[] is consistent with magnetic[]
+//                                  --> Must be reset to false whenever magnetic[] of an existing patch is modified
+//                                      outside the fluid solver (e.g., electric field fix-up and restriction)
 //                pot             : Potential
 //                pot_ext         : Potential with GRA_GHOST_SIZE ghost cells on each side
 //                                  --> Allocated only if STORE_POT_GHOST is on
@@ -40,6 +54,11 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                  --> DE_UPDATED_BY_XXX are defined in Macro.h
 //                                  --> It's a character array with the size PS1^3
 //                                  --> Currently it's only allocated for Sg=0
+//                de_uniform      : Dual-energy status shared by all cells in de_status[], or DE_STATUS_MIXED if the
+//                                  cells have different status
+//                                  --> Set by Flu_Close() and Gra_Close() together with de_status[]
+//                                  --> Allows copying de_status[] by a single memset() for uniform patches
+//                                  --> Only meaningful for Sg=0
 //                rho_ext         : Density with RHOEXT_GHOST_SIZE (typically 2) ghost cells on each side
 //                                  --> Only allocated **temporarily** in the function Prepare_PatchData for storing
 //                                      particle mass density
@@ -51,8 +70,6 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                flux[6]         : Fluid flux (for the flux-correction operation)
 //                                  --> Including passively advected flux (for the flux-correction operation)
 //                flux_tmp[6]     : Temporary fluid flux for the option "AUTO_REDUCE_DT"
-//                flux_bitrep[6]  : Fluid flux for achieving bitwise reproducibility (i.e., ensuring that the round-off errors are
-//                                  exactly the same in different parallelization parameters/strategies)
 //                electric        : Electric field for the MHD fix-up operation
 ///                                 --> Array structure = [sibling index][E field index][cell index]
 //                                  --> For sibling indices 0-5, there are two E fields on each face
@@ -104,8 +121,41 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      inactive:  patch has been allocated but deactivated (excluded from num[lv])
 //                                  --> Note that active/inactive have nothing to do with the allocation of field arrays (e.g., fluid)
 //                                      --> For both active and inactive patches, field arrays may be allocated or == NULL
-//                                  --> However, currently the flux arrays (i.e., flux, flux_tmp, and flux_bitrep) are guaranteed
-//                                      to be NULL for inactive patches
+//                                  --> However, currently the flux arrays (i.e., flux and flux_tmp) are guaranteed to be NULL
+//                                      for inactive patches
+//                FluSgSame       : Whether fluid[] in the two sandglasses store bitwise identical data
+//                                  --> For OPT__INT_TIME_LAZY only
+//                ArenaID         : Index of the arena from which the field arrays are allocated (= 2*lv + Sg)
+//                                  --> For OPT__PATCH_ARENA only (see Mis_PatchArena.cpp)
+//                                  --> Set by Prepare_PatchData() and only stored in amr->patch[0][lv][PID]
+//                dt_MaxCFL       : Maximum CFL speed of the latest fluid update recorded by Flu_Close()
+//                                  --> For OPT__DT_FLU_BYPRODUCT only (see dt_InvokeSolver.cpp)
+//                                  --> Negative value means that it is not available and the CFL speed must be
+//                                      re-evaluated from the fluid data
+//                                  --> Only stored in amr->patch[0][lv][PID]
+//                FlagMask        : Refinement flags of this patch and its 26 siblings evaluated from the latest fluid
+//                                  update by Flu_Close()
+//                                  --> For OPT__FLAG_FLU_BYPRODUCT only (see Flag_FluByProduct.cpp)
+//                                  --> Negative value means that it is not available and the refinement criteria
+//                                      must be re-evaluated from the fluid data
+//                                  --> Only stored in amr->patch[0][lv][PID]
+//                Prep_Cost       : Wall-clock time of the latest Prepare_PatchData() call of this patch group
+//                                  --> For OPT__PREP_COST_ORDER only (see Prepare_PatchData.cpp)
+//                                  --> Negative value means that it has not been measured yet
+//                                  --> Only stored in amr->patch[0][lv][PID0] with LocalID==0
+//                Che_Cost        : Wall-clock time of the latest Grackle update of this patch
+//                                  --> For LB_INPUT__CHE_WEIGHT only (see LB_EstimateWorkload_AllPatchGroup.cpp)
+//                                  --> Negative value means that it has not been measured yet
+//                                  --> Only stored in amr->patch[0][lv][PID]
+//                Frz_NQuiet      : Number of consecutive quiescent updates of this patch group
+//                                  --> For OPT__FROZEN_REGION only (see Flu_FrozenRegion.cpp)
+//                                  --> Only stored in amr->patch[0][lv][PID0] with LocalID==0, and so are the other
+//                                      Frz_XXX variables
+//                Frz_Quiet       : Whether the latest fluid update of this patch group is quiescent
+//                Frz_Mode        : FRZ_NONE/FRZ_SKIP/FRZ_CATCHUP --> advanced normally/skipped in this sub-step/
+//                                  advanced with the dt of this and the skipped sub-steps
+//                Frz_Idx         : Index of this patch group in the skip or catch-up list
+//                Frz_MaxCFL      : Maximum CFL speed of the latest quiescent update of this patch group
 //                EdgeL/R         : Left and right edge of the patch
 //                                  --> Note that we always apply periodicity to EdgeL/R. So for an external patch its
 //                                      recorded "EdgeL/R" will still lie inside the simulation domain and will be
@@ -155,11 +205,18 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                  --> for SERIAL only
 //                ParMassPos_Copy : Pointer arrays storing the mass and position of NPar_Copy particles collected from other patches
 //                                  --> for LOAD_BALANCE only
+//                NPar_Desc       : Number of particles in all descendants (sons, grandsons, ...) of this patch
+//                                  --> Excluding the particles in this patch (i.e., NPar)
+//                                  --> Updated incrementally by Par_UpdateDescendantCount() whenever particles are
+//                                      added to or removed from a patch
+//                                  --> for SERIAL only since descendants may live in other ranks for LOAD_BALANCE
 //                NPar_Escp       : Number of particles escaping from this patch
 //                ParList_Escp    : List recording the IDs of all particles escaping from this patch
 //
 // Method      :  patch_t         : Constructor
 //               ~patch_t         : Destructor
+//                operator new    : Allocate patch_t aligned to the cache line
+//                operator delete : Deallocate patch_t allocated by operator new
 //                Activate        : Activate patch
 //                fnew            : Allocate flux[]
 //                fdelete         : Deallocate flux[]
@@ -183,6 +240,20 @@ struct patch_t
 
 // data members
 // ===================================================================================
+// hot data accessed by the tree traversals (e.g., SiblingSearch(), Flag_Real(), and Prepare_PatchData())
+// --> sibling[] ... FluSgSame take exactly the first two cache lines since patch_t is allocated with the
+//     cache-line alignment (see operator new), followed by LB_Idx and the field pointers
+// --> do NOT insert other members before FluSgSame
+   int    sibling[26];
+   int    father;
+   int    son;
+   int    corner[3];
+   bool   flag;
+   bool   Active;
+   bool   FluSgSame;
+
+   long   LB_Idx;
+
    real (*fluid)[PS1][PS1][PS1];
 
 #  ifdef MHD
@@ -198,6 +269,7 @@ struct patch_t
 
 #  ifdef DUAL_ENERGY
    char (*de_status)[PS1][PS1];
+   char   de_uniform;
 #  endif
 
 #  ifdef PARTICLE
@@ -206,10 +278,9 @@ struct patch_t
 
    real (*flux       [6])[PS1][PS1];
    real (*flux_tmp   [6])[PS1][PS1];
-#  ifdef BIT_REP_FLUX
-   real (*flux_bitrep[6])[PS1][PS1];
-#  endif
 
+
+// cold data
 #  ifdef MHD
    real (*electric       [18]);
    real (*electric_tmp   [18]);
@@ -217,19 +288,27 @@ struct patch_t
    real (*electric_bitrep[18]);
 #  endif
    bool ele_corrected[12];
+
+   real (*emag)[PS1][PS1];
+   bool   emag_valid;
 #  endif
 
-   int    corner[3];
-   int    sibling[26];
-   int    father;
-   int    son;
-   bool   flag;
-   bool   Active;
+   int    ArenaID;
+   real   dt_MaxCFL;
+   int    FlagMask;
+   real   Prep_Cost;
+#  ifdef SUPPORT_GRACKLE
+   real   Che_Cost;
+#  endif
+   int    Frz_NQuiet;
+   bool   Frz_Quiet;
+   int    Frz_Mode;
+   int    Frz_Idx;
+   real   Frz_MaxCFL;
    double EdgeL[3];
    double EdgeR[3];
 
    ulong  PaddedCr1D;
-   long   LB_Idx;
 
 #  ifdef PARTICLE
    int    NPar;
@@ -242,6 +321,7 @@ struct patch_t
 #  else
    long  *ParList_Copy;
 #  endif
+   int    NPar_Desc;
 
    int    NPar_Escp[26];
    long  *ParList_Escp[26];
@@ -266,18 +346,19 @@ struct patch_t
    //                DE_Status   : true --> Allocate the dual-energy status array de_status[]
    //                                       --> Useless if "DUAL_ENERGY" is turned off
    //                lv          : Refinement level of the newly created patch
+   //                Sg          : Sandglass of the newly created patch
    //                BoxScale    : Simulation box scale
    //                BoxEdgeL    : Simulation box left edge
    //                dh_min      : Cell size at the maximum level
    //===================================================================================
    patch_t( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
-            const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-            const double BoxEdgeL[], const double dh_min )
+            const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int Sg,
+            const int BoxScale[], const double BoxEdgeL[], const double dh_min )
    {
 
 //    always initialize field pointers (e.g., fluid, pot, ...) as NULL if they are not allocated here
       const bool InitPtrAsNull_Yes = true;
-      Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, BoxScale,
+      Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, Sg, BoxScale,
                 BoxEdgeL, dh_min, InitPtrAsNull_Yes );
 
    } // METHOD : patch_t
@@ -301,6 +382,7 @@ struct patch_t
    //                DE_Status     : true --> Allocate the dual-energy status array de_status[]
    //                                         --> Useless if "DUAL_ENERGY" is turned off
    //                lv            : Refinement level of the newly created patch
+   //                Sg            : Sandglass of the newly created patch
    //                BoxScale      : Simulation box scale
    //                BoxEdgeL      : Simulation box left edge
    //                dh_min        : Cell size at the maximum level
@@ -313,13 +395,13 @@ struct patch_t
    //                                    (not activating) patches and before calling hnew and gnew
    //                                    --> otherwise these pointers become ill-defined, which will make hdelete and
    //                                        gdelete crash
-   //                                --> Does NOT apply to flux arrays (i.e., flux, flux_tmp, and flux_bitrep) which
+   //                                --> Does NOT apply to flux arrays (i.e., flux and flux_tmp) which
    //                                    are always initialized as NULL here
    //                                --> Does not apply to any particle variable (except rho_ext)
    //===================================================================================
    void Activate( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
-                  const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-                  const double BoxEdgeL[], const double dh_min, const bool InitPtrAsNull )
+                  const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int Sg,
+                  const int BoxScale[], const double BoxEdgeL[], const double dh_min, const bool InitPtrAsNull )
    {
 
       corner[0] = scale_x;
@@ -329,6 +411,19 @@ struct patch_t
       son       = -1;
       flag      = false;
       Active    = true;
+      FluSgSame = false;
+      ArenaID   = 2*lv + Sg;
+      dt_MaxCFL = (real)-1.0;
+      FlagMask  = -1;
+      Prep_Cost = (real)-1.0;
+#     ifdef SUPPORT_GRACKLE
+      Che_Cost  = (real)-1.0;
+#     endif
+      Frz_NQuiet = 0;
+      Frz_Quiet  = false;
+      Frz_Mode   = FRZ_NONE;
+      Frz_Idx    = -1;
+      Frz_MaxCFL = (real)-1.0;
 
       for (int s=0; s<26; s++ )  sibling[s] = -1;     // -1 <--> NO sibling
 
@@ -378,6 +473,7 @@ struct patch_t
 
 #        ifdef MHD
          magnetic  = NULL;
+         emag      = NULL;
 #        endif
 
 #        ifdef GRAVITY
@@ -400,12 +496,15 @@ struct patch_t
       {
          flux       [s] = NULL;
          flux_tmp   [s] = NULL;
-#        ifdef BIT_REP_FLUX
-         flux_bitrep[s] = NULL;
-#        endif
       }
 
+#     ifdef DUAL_ENERGY
+      de_uniform = DE_STATUS_MIXED;
+#     endif
+
 #     ifdef MHD
+      emag_valid = false;
+
       for (int s=0; s<18; s++)
       {
          electric       [s] = NULL;
@@ -439,6 +538,7 @@ struct patch_t
 #     else
       ParList_Copy = NULL;
 #     endif
+      NPar_Desc    = 0;          // new patches have no descendants
 
       for (int s=0; s<26; s++)
       {
@@ -499,6 +599,45 @@ struct patch_t
 
 
 
+   //===================================================================================
+   // Method      :  operator new
+   // Description :  Allocate patch_t aligned to the cache line
+   //
+   // Note        :  1. So that the hot data at the beginning of patch_t (sibling[] ... FluSgSame) never straddle
+   //                   more than two cache lines
+   //                2. Must be deallocated by the operator delete below
+   //
+   // Parameter   :  Size : Size of the object in bytes
+   //===================================================================================
+   void *operator new( size_t Size )
+   {
+
+      void *Ptr = NULL;
+
+      if ( posix_memalign( &Ptr, PATCH_CACHE_LINE, Size ) != 0 )
+         Aux_Error( ERROR_INFO, "failed to allocate patch_t (%ld bytes) !!\n", (long)Size );
+
+      return Ptr;
+
+   } // METHOD : operator new
+
+
+
+   //===================================================================================
+   // Method      :  operator delete
+   // Description :  Deallocate patch_t allocated by operator new
+   //
+   // Parameter   :  Ptr : Pointer to the object
+   //===================================================================================
+   void operator delete( void *Ptr )
+   {
+
+      free( Ptr );
+
+   } // METHOD : operator delete
+
+
+
    //===================================================================================
    // Method      :  fnew
    // Description :  Allocate flux[] in the given direction
@@ -520,19 +659,11 @@ struct patch_t
 
       if ( AllocTmp  &&  flux_tmp[SibID] != NULL )
          Aux_Error( ERROR_INFO, "flux_tmp[%d] already exists !!\n", SibID );
-
-#     ifdef BIT_REP_FLUX
-      if ( flux_bitrep[SibID] != NULL )
-         Aux_Error( ERROR_INFO, "flux_bitrep[%d] already exists !!\n", SibID );
-#     endif
 #     endif
 
       flux      [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
       if ( AllocTmp )
       flux_tmp  [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
-#     ifdef BIT_REP_FLUX
-      flux_bitrep[SibID] = new real [NFLUX_TOTAL][PS1][PS1];
-#     endif
 
       for(int v=0; v<NFLUX_TOTAL; v++)
       for(int m=0; m<PS1; m++)
@@ -544,9 +675,6 @@ struct patch_t
          if ( AllocTmp )
          flux_tmp   [SibID][v][m][n] = 0.0;
          */
-#        ifdef BIT_REP_FLUX
-         flux_bitrep[SibID][v][m][n] = 0.0;
-#        endif
       }
 
    } // METHOD : fnew
@@ -567,11 +695,6 @@ struct patch_t
 
          delete [] flux_tmp[s];
          flux_tmp[s] = NULL;
-
-#        ifdef BIT_REP_FLUX
-         delete [] flux_bitrep[s];
-         flux_bitrep[s] = NULL;
-#        endif
       }
 
    } // METHOD : fdelete
@@ -670,7 +793,10 @@ struct patch_t
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+         if ( OPT__PATCH_ARENA )
+            fluid = ( real (*)[PS1][PS1][PS1] )Mis_PatchArena_Alloc( PATCH_ARENA_FLU, ArenaID );
+         else
+            fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
          fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -685,12 +811,12 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_FLU, ArenaID, fluid );
+      else                       delete [] fluid;
       fluid = NULL;
 
 #     ifdef PARTICLE
-      delete [] rho_ext;
-      rho_ext = NULL;
+      ddelete();
 #     endif
 
    } // METHOD : hdelete
@@ -709,7 +835,10 @@ struct patch_t
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         if ( OPT__PATCH_ARENA )
+            magnetic = ( real (*)[ PS1P1*SQR(PS1) ] )Mis_PatchArena_Alloc( PATCH_ARENA_MAG, ArenaID );
+         else
+            magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -719,14 +848,19 @@ struct patch_t
 
    //===================================================================================
    // Method      :  mdelete
-   // Description :  Deallocate magnetic[]
+   // Description :  Deallocate magnetic[] (and emag[] for OPT__EMAG_CACHE)
    //===================================================================================
    void mdelete()
    {
 
-      delete [] magnetic;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_MAG, ArenaID, magnetic );
+      else                       delete [] magnetic;
       magnetic = NULL;
 
+      delete [] emag;
+      emag       = NULL;
+      emag_valid = false;
+
    } // METHOD : mdelete
 #  endif // #ifdef MHD
 
@@ -742,10 +876,22 @@ struct patch_t
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )
+      {
+         if ( OPT__PATCH_ARENA )
+            pot = ( real (*)[PS1][PS1] )Mis_PatchArena_Alloc( PATCH_ARENA_POT, ArenaID );
+         else
+            pot = new real [PS1][PS1][PS1];
+      }
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )
+      {
+         if ( OPT__PATCH_ARENA )
+            pot_ext = ( real (*)[GRA_NXT][GRA_NXT] )Mis_PatchArena_Alloc( PATCH_ARENA_POT_EXT, ArenaID );
+         else
+            pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      }
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
@@ -763,11 +909,13 @@ struct patch_t
    void gdelete()
    {
 
-      delete [] pot;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_POT, ArenaID, pot );
+      else                       delete [] pot;
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
-      delete [] pot_ext;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_POT_EXT, ArenaID, pot_ext );
+      else                       delete [] pot_ext;
       pot_ext = NULL;
 #     endif
 
@@ -788,7 +936,10 @@ struct patch_t
 
       if ( de_status == NULL )
       {
-         de_status = new char [PS1][PS1][PS1];
+         if ( OPT__PATCH_ARENA )
+            de_status = ( char (*)[PS1][PS1] )Mis_PatchArena_Alloc( PATCH_ARENA_DE_STATUS, ArenaID );
+         else
+            de_status = new char [PS1][PS1][PS1];
       }
 
    } // METHOD : snew
@@ -802,7 +953,8 @@ struct patch_t
    void sdelete()
    {
 
-      delete [] de_status;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_DE_STATUS, ArenaID, de_status );
+      else                       delete [] de_status;
       de_status = NULL;
 
    } // METHOD : sdelete
@@ -820,7 +972,13 @@ struct patch_t
    void dnew()
    {
 
-      if ( rho_ext == NULL )  rho_ext = new real [RHOEXT_NXT][RHOEXT_NXT][RHOEXT_NXT];
+      if ( rho_ext == NULL )
+      {
+         if ( OPT__PATCH_ARENA )
+            rho_ext = ( real (*)[RHOEXT_NXT][RHOEXT_NXT] )Mis_PatchArena_Alloc( PATCH_ARENA_RHO_EXT, ArenaID );
+         else
+            rho_ext = new real [RHOEXT_NXT][RHOEXT_NXT][RHOEXT_NXT];
+      }
 
 //    always initialize rho_ext (even if rho_ext != NULL when calling this this function) to indicate that this array
 //    has NOT been properly set --> used by Prepare_PatchData()
@@ -837,7 +995,8 @@ struct patch_t
    void ddelete()
    {
 
-      delete [] rho_ext;
+      if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_RHO_EXT, ArenaID, rho_ext );
+      else                       delete [] rho_ext;
       rho_ext = NULL;
 
    } // METHOD : ddelete
@@ -0,0 +1,179 @@
+#ifndef __PATCHTABLE_H__
+#define __PATCHTABLE_H__
+
+
+
+#include "Macro.h"
+
+struct patch_t;
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+
+
+// number of patch pointers in each chunk (must be a power of two)
+#define PATCH_TABLE_CHUNK_POW    12
+#define PATCH_TABLE_CHUNK_SIZE   ( 1 << PATCH_TABLE_CHUNK_POW )
+#define PATCH_TABLE_CHUNK_MASK   ( PATCH_TABLE_CHUNK_SIZE - 1 )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PatchTable_t
+// Description :  Growable table of the patch pointers on one level and one sandglass
+//
+// Note        :  1. Replace the fixed-size array patch_t *patch[MAX_PATCH] so that the number of patches is only
+//                   limited by the available memory
+//                2. Pointers are stored in chunks of PATCH_TABLE_CHUNK_SIZE elements
+//                   --> Chunks are never moved or released before the destructor so that the address of an element
+//                       (e.g., &amr->patch[Sg][lv][PID] passed to Aux_SwapPointer()) remains valid after the table grows
+//                   --> Only the small chunk directory is reallocated when the table grows
+//                3. New chunks are initialized as NULL, which is assumed by AMR_t::pnew()
+//                4. operator[] never grows the table
+//                   --> The table only grows in AMR_t::pnew() by Reserve(), which is not thread-safe. It is fine
+//                       since patches are only allocated outside OpenMP parallel regions.
+//                   --> Accessing an element beyond Capacity() is checked only when GAMER_DEBUG is on
+//
+// Data Member :  Chunk  : Chunk directory
+//                NChunk : Number of allocated chunks
+//
+// Method      :  PatchTable_t : Constructor
+//               ~PatchTable_t : Destructor
+//                operator[]   : Return a reference to the pointer of the target patch
+//                Capacity     : Return the number of allocated elements
+//                Reserve      : Grow the table to hold at least the given number of elements
+//                Grow         : Allocate new chunks
+//-------------------------------------------------------------------------------------------------------
+struct PatchTable_t
+{
+
+// data members
+// ===================================================================================
+   patch_t ***Chunk;
+   int        NChunk;
+
+
+
+   //===================================================================================
+   // Constructor :  PatchTable_t
+   // Description :  Constructor of the structure "PatchTable_t"
+   //
+   // Note        :  No chunk is allocated until the first access
+   //===================================================================================
+   PatchTable_t()
+   {
+
+      Chunk  = NULL;
+      NChunk = 0;
+
+   } // METHOD : PatchTable_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~PatchTable_t
+   // Description :  Destructor of the structure "PatchTable_t"
+   //
+   // Note        :  Only release the table itself. Patches must be deallocated by AMR_t::Lvdelete() in advance.
+   //===================================================================================
+   ~PatchTable_t()
+   {
+
+      for (int c=0; c<NChunk; c++)  free( Chunk[c] );
+
+      free( Chunk );
+
+      Chunk  = NULL;
+      NChunk = 0;
+
+   } // METHOD : ~PatchTable_t
+
+
+
+   //===================================================================================
+   // Method      :  operator[]
+   // Description :  Return a reference to the pointer of the target patch
+   //
+   // Note        :  PID must be smaller than Capacity()
+   //
+   // Parameter   :  PID : Target patch index
+   //===================================================================================
+   patch_t *&operator[]( const int PID )
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( PID < 0  ||  PID >= Capacity() )
+         Aux_Error( ERROR_INFO, "PID (%d) is out of the range of the patch table [0, %d) !!\n", PID, Capacity() );
+#     endif
+
+      return Chunk[ PID >> PATCH_TABLE_CHUNK_POW ][ PID & PATCH_TABLE_CHUNK_MASK ];
+
+   } // METHOD : operator[]
+
+
+
+   //===================================================================================
+   // Method      :  Capacity
+   // Description :  Return the number of allocated elements
+   //===================================================================================
+   int Capacity() const
+   {
+
+      return NChunk*PATCH_TABLE_CHUNK_SIZE;
+
+   } // METHOD : Capacity
+
+
+
+   //===================================================================================
+   // Method      :  Reserve
+   // Description :  Grow the table to hold at least the given number of elements
+   //
+   // Parameter   :  NElement : Minimum number of elements after growing
+   //===================================================================================
+   void Reserve( const int NElement )
+   {
+
+      Grow( (int)( ( (long)NElement + PATCH_TABLE_CHUNK_SIZE - 1 ) >> PATCH_TABLE_CHUNK_POW ) );
+
+   } // METHOD : Reserve
+
+
+
+   //===================================================================================
+   // Method      :  Grow
+   // Description :  Allocate new chunks initialized as NULL
+   //
+   // Note        :  1. Only the chunk directory is reallocated, which is small (e.g., 245 chunks for 10^6 patches)
+   //                2. Existing chunks are not moved
+   //
+   // Parameter   :  NChunkNew : Total number of chunks after growing
+   //===================================================================================
+   void Grow( const int NChunkNew )
+   {
+
+      if ( NChunkNew <= NChunk )    return;
+
+      Chunk = (patch_t***)realloc( Chunk, NChunkNew*sizeof(patch_t**) );
+
+      if ( Chunk == NULL )
+         Aux_Error( ERROR_INFO, "failed to allocate the patch table directory (%d chunks) !!\n", NChunkNew );
+
+      for (int c=NChunk; c<NChunkNew; c++)
+      {
+         Chunk[c] = (patch_t**)calloc( PATCH_TABLE_CHUNK_SIZE, sizeof(patch_t*) );
+
+         if ( Chunk[c] == NULL )
+            Aux_Error( ERROR_INFO, "failed to allocate a patch table chunk (%d) !!\n", c );
+      }
+
+      NChunk = NChunkNew;
+
+   } // METHOD : Grow
+
+
+}; // struct PatchTable_t
+
+
+
+#endif // #ifndef __PATCHTABLE_H__
@@ -23,7 +23,9 @@ void Aux_Check_Restrict( const int lv, const char *comment );
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 bool Aux_CheckFileExist( const char *FileName );
 void Aux_GetCPUInfo( const char *FileName );
+void Aux_GetCPUInfo( FILE *Note );
 void Aux_GetMemInfo();
+void Aux_GetMemInfo_AddSolver( const long Size );
 void Aux_Message( FILE *Type, const char *Format, ... );
 void Aux_TakeNote();
 void Aux_CreateTimer();
@@ -31,9 +33,35 @@ void Aux_DeleteTimer();
 void Aux_ResetTimer();
 void Aux_AccumulatedTiming( const double TotalT, double InitT, double OtherT );
 void Aux_Record_Timing();
+#ifdef TIMING_SOLVER
+void Aux_PerfCounter_Init();
+void Aux_PerfCounter_End();
+void Aux_PerfCounter_Reset();
+void Aux_PerfCounter_Start();
+void Aux_PerfCounter_Stop( const Solver_t TSolver, const int TStep );
+void Aux_PerfCounter_Record( const char FileName[] );
+#endif
+void Aux_Trace_Init();
+void Aux_Trace_Record( const char *Call, const int Lv, const long T0 );
+void Aux_Trace_Dump();
+void Aux_Trace_End();
 void Aux_Record_PatchCount();
 void Aux_Record_Performance( const double ElapsedTime );
+void Aux_Record_Telemetry( const double ElapsedTime );
+void Aux_PatchCost_Add( const int Phase, const int lv, const long N, const long Time );
+void Aux_PatchCost_AddClass( const int lv, const int NPG, const int *PID0_List );
+void Aux_Record_PatchCost();
 void Aux_Record_CorrUnphy();
+#if ( MODEL == HYDRO )
+void Aux_Record_Conservation();
+#endif
+void Aux_MemoryPool_Grow();
+void Aux_Record_MemoryPool();
+void Aux_Record_RefineMap();
+#ifdef GRAVITY
+void Aux_Record_PoissonIter();
+void Aux_Record_LevelPowerSpectrum();
+#endif
 int  Aux_CountRow( const char *FileName );
 void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double r_max_input, const double dr_min,
                          const bool LogBin, const double LogBinRatio, const bool RemoveEmpty, const long TVarBitIdx[],
@@ -59,12 +87,16 @@ void Buf_AllocateBufferPatch_Base( AMR_t *Tamr );
 void Buf_AllocateBufferPatch( AMR_t *Tamr, const int lv );
 void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
                         const long TVarCC, const long TVarFC, const int ParaBuf, const UseLBFunc_t UseLBFunc );
+void Buf_GetBufferData_Batch( const int NBatch, const GetBufReq_t *BatchList );
 void Buf_RecordBoundaryFlag( const int lv );
 void Buf_RecordBoundaryPatch_Base();
 void Buf_RecordBoundaryPatch( const int lv );
 void Buf_RecordExchangeDataPatchID( const int lv );
 void Buf_RecordExchangeFluxPatchID( const int lv );
 void Buf_ResetBufferFlux( const int lv );
+#if ( !defined LOAD_BALANCE  &&  defined BIT_REP_FLUX )
+void Buf_SeedBufferFlux( const int lv );
+#endif
 void Buf_SortBoundaryPatch( const int NPatch, int *IDList, int *PosList );
 #endif // #ifndef SERIAL
 
@@ -83,7 +115,7 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const bool StoreFlux, const bool StoreElectric,
                       const bool XYZ, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                       const real ELBDM_Eta, real ELBDM_Taylor3_Coeff, const bool ELBDM_Taylor3_Auto,
-                      const double Time, const OptGravityType_t GravityType,
+                      const double Time, const double TimeNew, const bool FuseExtAcc, const OptGravityType_t GravityType,
                       const real MinDens, const real MinPres, const real MinEint, const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
                       const bool JeansMinPres, const real JeansMinPres_Coeff );
@@ -120,6 +152,8 @@ real Hydro_CheckMinEintInEngy( const real Dens, const real MomX, const real MomY
 int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                    const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI, const bool Overlap_Sync );
 void Flu_AllocateFluxArray( const int lv );
+void Flu_RecordFluxPatchList( const int lv );
+const int *Flu_GetFluxPatchList( const int lv, int &NPatch );
 void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                 real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
@@ -138,6 +172,10 @@ void Flu_Prepare( const int lv, const double PrepTime,
 void Flu_FixUp_Flux( const int lv );
 void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg, const int SonMagSg, const int FaMagSg,
                          const int SonPotSg, const int FaPotSg, const long TVarCC, const long TVarFC );
+void Flu_FixUp_Restrict_PatchGroup( const int FaLv, const int SonPID0, const int SonFluSg, const int FaFluSg,
+                                    const int SonMagSg, const int FaMagSg, const int SonPotSg, const int FaPotSg,
+                                    const long TVarCC, const long TVarFC, const int NFluVar, const int TFluVarIdxList[] );
+void Flu_FixUp_RestrictFlux( const int lv );
 void Flu_BoundaryCondition_User( real *Array, const int NVar_Flu, const int ArraySizeX, const int ArraySizeY,
                                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
                                  const int TFluVarIdxList[], const double Time, const double dh, const double *Corner,
@@ -145,7 +183,27 @@ void Flu_BoundaryCondition_User( real *Array, const int NVar_Flu, const int Arra
 void Hydro_BoundaryCondition_Outflow( real *Array, const int BC_Face, const int NVar, const int GhostSize,
                                       const int ArraySizeX, const int ArraySizeY, const int ArraySizeZ,
                                       const int Idx_Start[], const int Idx_End[] );
+void Flu_BoundaryCondition_FillSlab( real *Data, const int SizeX, const int SizeY, const int Start[], const int End[],
+                                     const int Dir, const int Ref, const bool Mirror, const real Sign );
 void Flu_CorrAfterAllSync();
+void Flu_FreezeLevel( const int lv, const int SaveSg_Flu, const int SaveSg_Mag );
+void Flu_RecordFailedPatchGroup( const int PID0, const real Flux[][NFLUX_TOTAL][ SQR(PS2) ] );
+int Flu_RetryFailedPatchGroup( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                               const int SaveSg_Flu );
+void Flu_FrozenRegion_Prepare( const int lv, const double TimeOld, const double dt, const bool AllowSkip );
+void Flu_FrozenRegion_Record( const int lv, const int NPG, const int *PID0_List,
+                              const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                              const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                              const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ], const real dt );
+int Flu_FrozenRegion_Advance( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                              const int SaveSg_Flu );
+void Flu_FrozenRegion_Commit( const int lv );
+void Flu_FrozenRegion_End();
+void Flu_AllocateOldSg( const int lv );
+void Flu_FreeOldSg( const int lv );
+#ifdef PARTICLE
+bool Flu_CheckFreeze( const int lv );
+#endif
 #ifndef SERIAL
 void Flu_AllocateFluxArray_Buffer( const int lv );
 #endif
@@ -161,6 +219,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                         const real MinDens, const real MinPres, const bool DE_Consistency );
+void Prepare_PatchData_InvalidateGhostCache( const int lv );
+void Prepare_PatchData_FreeGhostCache( const int lv );
 
 
 // Init
@@ -174,6 +234,9 @@ void Init_Load_DumpTable();
 void Init_Load_FlagCriteria();
 void Init_Load_Parameter();
 void Init_MemoryPool();
+bool Init_RefineMap_Load();
+void Init_RefineMap_Flag( const int lv );
+void Init_RefineMap_Free();
 void Init_ResetParameter();
 void Init_MemAllocate();
 void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGroup );
@@ -196,6 +259,9 @@ void Init_OpenMP();
 #ifdef SUPPORT_HDF5
 void Init_ByRestart_HDF5( const char *FileName );
 #endif
+#ifdef LOAD_BALANCE
+void Init_ByRestart_Local();
+#endif
 
 
 // Interpolation
@@ -211,8 +277,13 @@ template <typename T> void  Mis_Idx1D2Idx3D( const int Size[], const T Idx1D, in
 template <typename T> int   Mis_BinarySearch( const T Array[], int Min, int Max, const T Key );
 template <typename T> int   Mis_BinarySearch_Real( const T Array[], int Min, int Max, const T Key );
 template <typename T> T     Mis_InterpolateFromTable( const int N, const T Table_x[], const T Table_y[], const T x );
+template <typename T> T     Mis_InterpolateFromTable_Uniform( const int N, const T Table_x[], const T Table_y[], const T x,
+                                                              const TableSpacing_t Spacing );
+template <typename T> TableSpacing_t Mis_CheckTableSpacing( const int N, const T Table_x[] );
 template <typename T> ulong Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 template <typename T> void  Mis_Heapsort( const int N, T Array[], int IdxTable[] );
+template <typename T> void  Mis_RadixSort( const int N, T Array[], int IdxTable[] );
+template <typename T> double Mis_ReproducibleSum( const long N, const T Array[], const bool SkipNonPositive );
 template <typename T> int   Mis_Matching_char( const int N, const T Array[], const int M, const T Key[], char Match[] );
 template <typename T> int   Mis_Matching_int( const int N, const T Array[], const int M, const T Key[], int Match[] );
 template <typename T> bool  Mis_CompareRealValue( const T Input1, const T Input2, const char *comment, const bool Verbose );
@@ -224,7 +295,13 @@ double Mis_Scale2PhySize( const int Scale );
 double Mis_Cell2PhySize( const int NCell, const int lv );
 int    Mis_Scale2Cell( const int Scale, const int lv );
 int    Mis_Cell2Scale( const int NCell, const int lv );
+void  *Mis_PatchArena_Alloc( const int Type, const int ArenaID );
+void   Mis_PatchArena_Free( const int Type, const int ArenaID, void *Ptr );
+void   Mis_PatchArena_End();
 double dt_InvokeSolver( const Solver_t TSolver, const int lv );
+#if ( MODEL == HYDRO  &&  !defined MHD )
+real   dt_GetCFLSpeed_Hydro( const real fluid[] );
+#endif
 void   dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
                        real h_Mag_Array_T[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG, const int *PID0_List );
 #ifdef GRAVITY
@@ -254,11 +331,26 @@ void MPI_Exit();
 void Output_DumpData( const int Stage );
 void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
                            const double z, const char *FileName );
+void Output_DumpData_Part_Binary( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                                  const double z, const char *FileName );
+void Output_BinaryTable( const char *FileName, const int NCol, const char *const *Label, const int SizeElement,
+                         const long NRow, void (*Pack)( const long Row0, const long NRowPack, char *Buf ) );
 void Output_DumpData_Total( const char *FileName );
 #ifdef SUPPORT_HDF5
 void Output_DumpData_Total_HDF5( const char *FileName );
+void Output_Async_Push( const char *FileName, const long Offset, const long NElement, real *Buf );
+void Output_Async_Start();
+void Output_Async_Wait();
+void Output_DumpData_Sub_HDF5();
+void Output_InlineDiag();
 #endif
 void Output_DumpManually( int &Dump_global );
+void Output_UniformGrid();
+#ifdef LOAD_BALANCE
+void Output_CheckpointLocal();
+void Output_CkptLocal_Exchange( const char *SendBuf, const long SendSize, const int SendRank,
+                                char *RecvBuf, const long RecvSize, const int RecvRank );
+#endif
 void Output_FlagMap( const int lv, const int xyz, const char *comment );
 void Output_Flux( const int lv, const int PID, const int Sib, const char *comment );
 void Output_PatchCorner( const int lv, const char *comment );
@@ -269,6 +361,9 @@ void Output_PreparedPatch_Fluid( const int TLv, const int TPID,
                                  const real h_Mag_Array[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                  const int NPG, const int *PID0_List, const int CLv, const char *comment );
 void Output_BasePowerSpectrum( const char *FileName );
+bool Output_BasePowerSpectrum_IsPending( const double PrepTime );
+ulong Output_BasePowerSpectrum_HashDens( const real *RhoK );
+void Output_BasePowerSpectrum_SaveCache( const real *RhoK, const int j_start, const int dj, const ulong DensHash );
 void Output_L1Error( void (*AnalFunc_Flu)( real fluid[], const double x, const double y, const double z, const double Time,
                                            const int lv, double AuxArray[] ),
                      void (*AnalFunc_Mag)( real magnetic[], const double x, const double y, const double z, const double Time,
@@ -291,9 +386,14 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
                  const real *Lohner_Var, const real *Lohner_Ave, const real *Lohner_Slope, const int Lohner_NVar,
                  const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff );
 bool Flag_Region( const int i, const int j, const int k, const int lv, const int PID );
+bool Flag_Region_Patch( const int lv, const int PID );
+#if ( MODEL == HYDRO )
+void Flag_RecordFlagMask( const int lv, const int PID, const int Sg );
+#endif
 bool Flag_Lohner( const int i, const int j, const int k, const OptLohnerForm_t Form, const real *Var1D, const real *Ave1D,
                   const real *Slope1D, const int NVar, const double Threshold, const double Filter, const double Soften );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc );
+bool Refine_CheckFlagChange( const int lv, const UseLBFunc_t UseLBFunc );
 void SiblingSearch( const int lv );
 void SiblingSearch_Base();
 #ifndef SERIAL
@@ -314,12 +414,13 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
                                      char h_DE_Array     [][PS1][PS1][PS1],
                                const real h_Emag_Array   [][PS1][PS1][PS1],
                                const int NPatchGroup, const real dt, const real dh, const int SOR_Min_Iter,
-                               const int SOR_Max_Iter, const real SOR_Omega, const int MG_Max_Iter,
-                               const int MG_NPre_Smooth, const int MG_NPost_Smooth, const real MG_Tolerated_Error,
-                               const real Poi_Coeff, const IntScheme_t IntScheme, const bool P5_Gradient,
-                               const real ELBDM_Eta, const real ELBDM_Lambda, const bool Poisson, const bool GraAcc,
-                               const OptGravityType_t GravityType, const double TimeNew, const double TimeOld,
-                               const bool ExtPot, const real MinEint );
+                               const int SOR_Max_Iter, const real SOR_Omega, const real SOR_Tolerated_Error,
+                               const int MG_Max_Iter, const int MG_NPre_Smooth, const int MG_NPost_Smooth,
+                               const real MG_Tolerated_Error, const real Poi_Coeff, const IntScheme_t IntScheme,
+                               const bool P5_Gradient, const real ELBDM_Eta, const real ELBDM_Lambda,
+                               const bool Poisson, const bool GraAcc, const OptGravityType_t GravityType,
+                               const double TimeNew, const double TimeOld, const bool ExtPot, const real MinEint,
+                               const bool WarmStart, long *Poi_NIter );
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime );
 void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf_SIdx, long *RecvBuf_SIdx,
                  int **List_PID, int **List_k, int *List_NSend_Rho, int *List_NRecv_Rho,
@@ -328,6 +429,22 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_SIdx,
                  int **List_PID, int **List_k, int *List_NSend, int *List_NRecv, const int local_nz, const int FFT_Size[],
                  const int NSendSlice );
+#ifndef SERIAL
+void Patch2Pencil( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf_PIdx, long *RecvBuf_PIdx,
+                   int **List_PID, int **List_kj, int *List_NSend_Rho, int *List_NRecv_Rho,
+                   const int FFT_Size[], const long NRecvRow, const double PrepTime );
+void Pencil2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_PIdx,
+                   int **List_PID, int **List_kj, int *List_NSend, int *List_NRecv, const long NSendRow );
+int  FFT_Pencil_BlockStart( const int N, const int P, const int p );
+int  FFT_Pencil_BlockOwner( const int N, const int P, const int i );
+void FFT_Pencil_Init( const int FFT_Size[] );
+void FFT_Pencil_End();
+void FFT_Pencil_GetLayout( const int N[], const int Rank, int &y_start, int &ny, int &z_start, int &nz );
+void FFT_Pencil_GetLayout_K( const int N[], int &kx_start, int &nkx, int &y_start, int &ny );
+int  FFT_Pencil_GetRank( const int N[], const int y, const int z );
+void FFT_Pencil_Periodic( real *RhoK, const real Poi_Coeff, const real dh );
+fftw_complex* FFT_Pencil_Forward( real *RhoK, const int N[] );
+#endif
 void End_MemFree_PoissonGravity();
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                     const int SaveSg_Flu, const int SaveSg_Pot, const bool Poisson, const bool Gravity,
@@ -366,9 +483,18 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
                       const int NPG, const int *PID0_List );
 void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][RHO_NXT][RHO_NXT][RHO_NXT],
                       const int NPG, const int *PID0_List );
+bool Poi_UseWarmStart( const int lv, const double PrepTime );
+void Poi_Prepare_WarmStart( const int lv, real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                            const int NPG, const int *PID0_List );
 #ifdef STORE_POT_GHOST
 void Poi_StorePotWithGhostZone( const int lv, const int PotSg, const bool AllPatch );
+#ifdef UNSPLIT_GRAVITY
+int  Poi_PotExtSg( const int lv, const double PrepTime, const int GhostSize, const int NPG, const int *PID0_List );
+void Poi_Prepare_PotExt( const int lv, const int PotSg, real *h_Pot, const int GhostSize, const int NPG,
+                         const int *PID0_List, const PrepUnit_t PrepUnit );
 #endif
+#endif
+void Poi_LevelRelax( const int lv, const double PrepTime, const double Poi_Coeff, const int SaveSg_Pot );
 #endif // #ifdef GRAVITY
 
 
@@ -385,6 +511,7 @@ void TABLE_SiblingSharingSameEdge( const int EdgeID, int SibID[], int SibSibID[]
 
 // LoadBalance
 long LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
+void LB_SFC_Init();
 #ifdef LOAD_BALANCE
 void LB_AllocateBufferPatch_Father( const int SonLv, const bool SearchAllSon, const int NInput, int* TargetSonPID0,
                                     const bool RecordFaPID, int* NNewFaBuf0, int** NewFaBufPID0 );
@@ -396,16 +523,27 @@ void LB_FindFather( const int SonLv, const bool SearchAllSon, const int NInput,
 void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput, int* TargetFaPID );
 void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
                        const long TVarCC, const long TVarFC, const int ParaBuf );
+void LB_GetBufferData_Start( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
+                             const long TVarCC, const long TVarFC, const int ParaBuf );
+void LB_GetBufferData_Finish( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
+                              const long TVarCC, const long TVarFC, const int ParaBuf );
+void LB_GetBufferData_Progress();
+void LB_GetBufferData_Batch( const int NBatch, const GetBufReq_t *BatchList );
 real*LB_GetBufferData_MemAllocate_Send( const int NSend );
 real*LB_GetBufferData_MemAllocate_Recv( const int NRecv );
+long LB_GetBufferData_MemSize();
 void LB_GrandsonCheck( const int lv );
-void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv );
+void LB_Init_LoadBalance( const bool Redistribute, const bool Incremental, const double ParWeight, const bool Reset,
+                          const int TLv );
 void LB_Init_ByFunction();
 void LB_Init_Refine( const int FaLv );
 void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bool InputLBIdx0AndLoad,
-                     long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight );
+                     long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const int NPG_Input,
+                     const double ParWeight, const bool Incremental );
+void LB_SetCutPoint_CoupleLevel( const double ParWeight );
 void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
 double LB_EstimateLoadImbalance();
+void LB_RecordMeasuredCost();
 void LB_SetCutPoint( const int lv, long *CutPoint, const bool InputLBIdx0AndLoad, long *LBIdx0_AllRank_Input,
                      double *Load_AllRank_Input, const double ParWeight );
 void LB_Output_LBIdx( const int lv );
@@ -413,7 +551,11 @@ void LB_RecordExchangeDataPatchID( const int Lv, const bool AfterRefine );
 void LB_RecordExchangeFixUpDataPatchID( const int Lv );
 void LB_RecordExchangeRestrictDataPatchID( const int FaLv );
 void LB_RecordOverlapMPIPatchID( const int Lv );
+void LB_RecordNeighborGraph( const int Lv );
 void LB_Refine( const int FaLv );
+#ifdef BIT_REP_FLUX
+void LB_SeedBufferFlux( const int lv );
+#endif
 void LB_SiblingSearch( const int lv, const bool SearchAllPID, const int NInput, int *TargetPID0 );
 void LB_Index2Corner( const int lv, const long Index, int Corner[], const Check_t Check );
 int  LB_Index2Rank( const int lv, const long LB_Idx, const Check_t Check );
@@ -437,6 +579,7 @@ real MHD_GetCellCenteredBEnergy( const real Bx_FC[], const real By_FC[], const r
                                  const int Nx, const int Ny, const int Nz, const int i, const int j, const int k );
 void MHD_GetCellCenteredBFieldInPatch( real B[], const int lv, const int PID, const int i, const int j, const int k,
                                        const int MagSg );
+void MHD_SetCellCenteredBEnergyCache( const int lv, const int PID, const int MagSg );
 real MHD_GetCellCenteredBEnergyInPatch( const int lv, const int PID, const int i, const int j, const int k,
                                         const int MagSg );
 void MHD_InterpolateBField( const real **CData, const int CSize[3][3], const int CStart[3][3], const int CRange[3],
@@ -445,6 +588,7 @@ void MHD_InterpolateBField( const real **CData, const int CSize[3][3], const int
 void MHD_AllocateElectricArray( const int lv );
 void MHD_Aux_Check_InterfaceB( const char *comment );
 void MHD_Aux_Check_DivergenceB( const bool Verbose, const char *comment );
+void MHD_Aux_Record_DivergenceB();
 void MHD_FixUp_Electric( const int lv );
 void MHD_CopyPatchInterfaceBField( const int lv, const int PID, const int SibID, const int MagSg );
 void MHD_BoundaryCondition_Outflow( real **Array, const int BC_Face, const int NVar, const int GhostSize,
@@ -544,6 +688,7 @@ void CUAPI_MemFree_PoissonGravity();
 #ifdef PARTICLE
 void Par_Init_ByFile();
 void Par_Output_TextFile( const char *comment );
+void Par_Output_BinaryFile( const char *FileName );
 void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly,
                                     const long NNewPar, real *NewParAtt[PAR_NATT_TOTAL] );
 void Par_PassParticle2Son_SinglePatch( const int FaLv, const int FaPID );
@@ -561,6 +706,7 @@ void Par_GetTimeStep_VelAcc( double &dt_vel, double &dt_acc, const int lv );
 void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar );
 bool Par_WithinActiveRegion( const real x, const real y, const real z );
 int  Par_CountParticleInDescendant( const int FaLv, const int FaPID );
+void Par_UpdateDescendantCount( const int lv, const int PID, const int dNPar );
 void Par_Aux_GetConservedQuantity( double &Mass, double &MomX, double &MomY, double &MomZ, double &Ek, double &Ep );
 void Par_Aux_InitCheck();
 void Par_Aux_Record_ParticleCount();
@@ -568,10 +714,14 @@ void Par_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, const
                                    const bool SibBufPatch, const bool FaSibBufPatch, const bool JustCountNPar,
                                    const bool TimingSendPar );
 void Par_CollectParticle2OneLevel_FreeMemory( const int FaLv, const bool SibBufPatch, const bool FaSibBufPatch );
+void Par_CollectParticle2OneLevel_InvalidateCache();
 int  Par_Synchronize( const double SyncTime, const ParSync_t SyncOption );
 void Par_Synchronize_Restore( const double SyncTime );
-void Prepare_PatchData_InitParticleDensityArray( const int lv );
+void Par_SortByPatch();
+void Par_ShortRangeAcc( const int lv, real *SRAcc[3] );
+void Prepare_PatchData_InitParticleDensityArray( const int lv, const bool PredictPos, const double PrepTime );
 void Prepare_PatchData_FreeParticleDensityArray( const int lv );
+void Prepare_PatchData_InvalidateParticleDensityArray();
 void Par_PredictPos( const long NPar, const long *ParList, real *ParPosX, real *ParPosY, real *ParPosZ,
                      const double TargetTime );
 void Par_Init_Attribute();
@@ -597,7 +747,11 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
                               int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
                               real *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, int &NRecvParTotal,
                               const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
-                              const bool Exchange_ParDataEachRank, Timer_t *Timer, const char *Timer_Comment );
+                              const bool Exchange_ParDataEachRank, const bool Compress, Timer_t *Timer, const char *Timer_Comment );
+long Par_LB_CompressParticleData_Bound( const long NPar, const int NParAtt );
+long Par_LB_CompressParticleData( const real *Data, const long NPar, const int NParAtt, char *Out, char *Work );
+void Par_LB_DecompressParticleData( const char *In, const long NByteIn, const long NPar, const int NParAtt,
+                                    real *Data, char *Work );
 void Par_LB_RecordExchangeParticlePatchID( const int MainLv );
 void Par_LB_MapBuffer2RealPatch( const int lv, const int  Buff_NPatchTotal, int *&Buff_PIDList, int *Buff_NPatchEachRank,
                                                      int &Real_NPatchTotal, int *&Real_PIDList, int *Real_NPatchEachRank,
@@ -611,6 +765,7 @@ void Par_LB_MapBuffer2RealPatch( const int lv, const int  Buff_NPatchTotal, int
 void YT_Init( int argc, char *argv[] );
 void YT_End();
 void YT_Inline();
+void YT_Inline_Wait();
 #endif // #ifdef SUPPORT_LIBYT
 
 
@@ -625,7 +780,8 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], const int NPG, const int *PID0_List );
 void Grackle_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg,
                         const bool OverlapMPI, const bool Overlap_Sync );
-void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt );
+void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt,
+                        const bool ZeroCopy, double *Cost, const double ScreenTCool );
 #endif // #ifdef SUPPORT_GRACKLE
 
 
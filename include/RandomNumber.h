@@ -9,6 +9,8 @@
 #elif ( RANDOM_NUMBER == RNG_GNU_EXT )
 #include <stdlib.h>
 
+#elif ( RANDOM_NUMBER == RNG_PHILOX )
+
 #else
 #error : ERROR : unsupported RANDOM_NUMBER !!
 #endif
@@ -26,16 +28,24 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                   --> Currently supported options:
 //                          RNG_CPP11  : c++11 library <random>
 //                          RNG_GNU_EXT: GNU extension drand48_r
+//                          RNG_PHILOX : counter-based Philox4x32-10 (Salmon et al. 2011)
 //                2. All implementations must be thread-safe
+//                3. RNG_PHILOX has no internal state except a key and a counter
+//                   --> The random numbers of a stream are simply the cipher of the successive counters
+//                   --> GetValue_Counter() further provides a stateless interface for all implementations, which
+//                       returns the same random number for the same (seed, stream, counter) regardless of the
+//                       number of OpenMP threads and the order of invocation
 //
 // Data Member :  RNG          : Random number generator
 //                Distribution : Random number distribution used by RNG_CP11
 //                N_RNG        : Total number of RNG
 //
-// Method      :  RandomNumber_t : Constructor
-//               ~RandomNumber_t : Destructor
-//                GetValue       : Return random number
-//                SetSeed        : Set random seed
+// Method      :  RandomNumber_t   : Constructor
+//               ~RandomNumber_t   : Destructor
+//                GetValue         : Return random number
+//                SetSeed          : Set random seed
+//                GetValue_Counter : Return a random number keyed by (seed, stream, counter)
+//                Philox4x32       : Philox4x32-10 block cipher
 //-------------------------------------------------------------------------------------------------------
 struct RandomNumber_t
 {
@@ -48,6 +58,10 @@ struct RandomNumber_t
 
 #  elif ( RANDOM_NUMBER == RNG_GNU_EXT )
    struct drand48_data *RNG;
+
+#  elif ( RANDOM_NUMBER == RNG_PHILOX )
+// [0/1] = seed/counter of each RNG
+   unsigned long long (*RNG)[2];
 #  endif
 
    int N_RNG;
@@ -81,6 +95,9 @@ struct RandomNumber_t
       RNG = new std::mt19937 [N];
 #     elif ( RANDOM_NUMBER == RNG_GNU_EXT )
       RNG = new drand48_data [N];
+#     elif ( RANDOM_NUMBER == RNG_PHILOX )
+      RNG = new unsigned long long [N][2];
+      for (int t=0; t<N; t++)    RNG[t][0] = RNG[t][1] = 0;
 #     endif
 
    } // METHOD : RandomNumber_t
@@ -130,6 +147,8 @@ struct RandomNumber_t
       Random = Distribution( RNG[ID] );
 #     elif ( RANDOM_NUMBER == RNG_GNU_EXT )
       drand48_r( RNG+ID, &Random );
+#     elif ( RANDOM_NUMBER == RNG_PHILOX )
+      Random = GetValue_Counter( RNG[ID][0], 0, RNG[ID][1]++, 0.0, 1.0 );
 #     endif
 
 //    convert the range to [Min, Max) and return
@@ -163,11 +182,95 @@ struct RandomNumber_t
       RNG[ID].seed( Seed );
 #     elif ( RANDOM_NUMBER == RNG_GNU_EXT )
       srand48_r( Seed, RNG + ID );
+#     elif ( RANDOM_NUMBER == RNG_PHILOX )
+      RNG[ID][0] = (unsigned long long)Seed;
+      RNG[ID][1] = 0;
 #     endif
 
    } // METHOD : SetSeed
 
 
+
+   //===================================================================================
+   // Method      :  GetValue_Counter
+   // Description :  Return a uniformly distributed random number in the specified range keyed by
+   //                (Seed, Stream, Counter)
+   //
+   // Note        :  1. Stateless and thus thread-safe without specifying the ID of RNG
+   //                   --> Can be invoked by any thread in any order
+   //                2. Use the Philox4x32-10 cipher for all RANDOM_NUMBER implementations
+   //                3. Different streams (e.g., patch IDs) with the same seed are statistically independent
+   //
+   // Parameter   :  Seed    : Random seed
+   //                Stream  : Stream ID (e.g., LB_Idx of a patch)
+   //                Counter : Counter within the stream (e.g., cell index)
+   //                Min     : Lower limit of the random number
+   //                Max     : Upper limit of the random number
+   //
+   // Return      :  Random number in the range [Min, Max)
+   //===================================================================================
+   static double GetValue_Counter( const unsigned long long Seed, const unsigned long long Stream,
+                                   const unsigned long long Counter, const double Min, const double Max )
+   {
+
+      unsigned int Ctr[4] = { (unsigned int)Counter, (unsigned int)(Counter>>32),
+                              (unsigned int)Stream,  (unsigned int)(Stream >>32) };
+      unsigned int Key[2] = { (unsigned int)Seed,    (unsigned int)(Seed   >>32) };
+
+      Philox4x32( Ctr, Key );
+
+//    use the 53 most significant bits of the first two words to get a random number in the range [0.0, 1.0)
+      const unsigned long long Bits   = ( (unsigned long long)Ctr[0] << 32 ) | Ctr[1];
+      const double             Random = (double)( Bits >> 11 ) * ( 1.0/9007199254740992.0 );
+
+      return Random*(Max-Min) + Min;
+
+   } // METHOD : GetValue_Counter
+
+
+
+   //===================================================================================
+   // Method      :  Philox4x32
+   // Description :  Philox4x32-10 block cipher
+   //
+   // Note        :  1. Ref: Salmon et al., 2011, "Parallel random numbers: as easy as 1, 2, 3"
+   //                2. Ctr[] is overwritten by the output
+   //
+   // Parameter   :  Ctr : Counter (input) and random bits (output)
+   //                Key : Key
+   //===================================================================================
+   static void Philox4x32( unsigned int Ctr[4], const unsigned int Key[2] )
+   {
+
+      const unsigned int M0 = 0xD2511F53U;
+      const unsigned int M1 = 0xCD9E8D57U;
+      const unsigned int W0 = 0x9E3779B9U;
+      const unsigned int W1 = 0xBB67AE85U;
+
+      unsigned int K0 = Key[0];
+      unsigned int K1 = Key[1];
+
+      for (int r=0; r<10; r++)
+      {
+         const unsigned long long P0 = (unsigned long long)M0*Ctr[0];
+         const unsigned long long P1 = (unsigned long long)M1*Ctr[2];
+         const unsigned int       H0 = (unsigned int)( P0 >> 32 );
+         const unsigned int       L0 = (unsigned int)( P0       );
+         const unsigned int       H1 = (unsigned int)( P1 >> 32 );
+         const unsigned int       L1 = (unsigned int)( P1       );
+
+         Ctr[0] = H1 ^ Ctr[1] ^ K0;
+         Ctr[1] = L1;
+         Ctr[2] = H0 ^ Ctr[3] ^ K1;
+         Ctr[3] = L0;
+
+         K0 += W0;
+         K1 += W1;
+      }
+
+   } // METHOD : Philox4x32
+
+
 }; // struct RandomNumber_t
 
 
@@ -188,24 +188,66 @@ struct ReadPara_t
    //
    // Note        :  1. Format:   KEY   VALUE
    //                2. Use # to comment out lines
+   //                3. Only rank 0 reads the file, whose content is then broadcast to all ranks
+   //                   --> Avoid accessing the same file from all ranks at the same time
+   //                   --> Must be invoked by all ranks
    //===================================================================================
    void Read( const char *FileName )
    {
 
-      if ( !Aux_CheckFileExist(FileName) )
+//    load the file content on rank 0 and broadcast it
+      long  FileSize = -1L;
+      char *FileBuf  = NULL;
+
+      if ( MPI_Rank == 0  &&  Aux_CheckFileExist(FileName) )
+      {
+         FILE *File = fopen( FileName, "rb" );
+
+         fseek( File, 0, SEEK_END );
+         FileSize = ftell( File );
+         rewind( File );
+
+         FileBuf = new char [FileSize+1];
+
+         if ( (long)fread( FileBuf, sizeof(char), FileSize, File ) != FileSize )
+            Aux_Error( ERROR_INFO, "failed to read the runtime parameter file \"%s\" !!\n", FileName );
+
+         fclose( File );
+      }
+
+      MPI_Bcast( &FileSize, 1, MPI_LONG, 0, MPI_COMM_WORLD );
+
+      if ( FileSize < 0L )
          Aux_Error( ERROR_INFO, "runtime parameter file \"%s\" does not exist !!\n", FileName );
 
+      if ( MPI_Rank != 0 )    FileBuf = new char [FileSize+1];
+
+      MPI_Bcast( FileBuf, (int)FileSize, MPI_CHAR, 0, MPI_COMM_WORLD );
+
+      FileBuf[FileSize] = '\0';
+
 
       char LoadKey[MAX_STRING], LoadValue[MAX_STRING];
       int  MatchIdx, LineNum=0, NLoad;
 
-      char *Line = new char [MAX_STRING];
-      FILE *File = fopen( FileName, "r" );
+      char       *Line   = new char [MAX_STRING];
+      const char *Cursor = FileBuf;
 
 
 //    loop over all lines in the target file
-      while ( fgets( Line, MAX_STRING, File ) != NULL )
+//    --> split lines in the same way as fgets( Line, MAX_STRING, File )
+      while ( *Cursor != '\0' )
       {
+         int LineLen = 0;
+
+         while ( LineLen < MAX_STRING-1  &&  Cursor[LineLen] != '\0'  &&  Cursor[LineLen] != '\n' )  LineLen ++;
+
+         if ( LineLen < MAX_STRING-1  &&  Cursor[LineLen] == '\n' )   LineLen ++;
+
+         memcpy( Line, Cursor, LineLen );
+         Line[LineLen] = '\0';
+         Cursor       += LineLen;
+
          LineNum ++;
 
 //       load the key and value at the target line
@@ -257,10 +299,10 @@ struct ReadPara_t
 
          else if ( MPI_Rank == 0 )
             Aux_Message( stderr, "WARNING : unrecognizable parameter [%-25s] at line %4d !!\n", LoadKey, LineNum );
-      } // while ( fgets( Line, MAX_STRING, File ) != NULL )
+      } // while ( *Cursor != '\0' )
 
 
-      fclose( File );
+      delete [] FileBuf;
       delete [] Line;
 
 
@@ -34,6 +34,7 @@
 
 #define Buf_AllocateBufferPatch( Tpatch, lv ) {}
 #define Buf_GetBufferData( lv, FluSg, MagSg, PotSg, GetBufMode, TVarCC, TVarFC, ParaBuf, UseLBFunc ) {}
+#define Buf_GetBufferData_Batch( NBatch, BatchList ) {}
 #define Buf_RecordExchangeDataPatchID( lv ) {}
 #define Buf_RecordExchangeFluxPatchID( lv ) {}
 #define Buf_RecordBoundaryFlag( lv ) {}
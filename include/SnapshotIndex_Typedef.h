@@ -0,0 +1,48 @@
+#ifndef __SNAPSHOTINDEX_TYPEDEF_H__
+#define __SNAPSHOTINDEX_TYPEDEF_H__
+
+
+/*===========================================================================
+Data structures defined here are used by the sidecar index of the HDF5
+snapshots (OPT__OUTPUT_INDEX)
+--> Must be consistent with tool/analysis/gamer_snapshot_index/SnapshotIndex.h
+===========================================================================*/
+
+
+// suffix of the index file (e.g., "Data_000000.idx")
+#define SNAPIDX_SUFFIX        ".idx"
+
+// file format identifier, version, and fixed length of the field labels
+#define SNAPIDX_MAGIC         "GAMERIDX"
+#define SNAPIDX_VERSION       1
+#define SNAPIDX_LABEL_LEN     32
+
+// number of bits per dimension of the Morton key
+#define SNAPIDX_KEY_NBIT      21
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  SnapIdxRecord_t
+// Description :  Index record of a single patch
+//
+// Note        :  1. Records of the same level are stored together and sorted by Key
+//                2. Key is the Morton key of the patch corner in the unit of the patch size on that level
+//                   --> A box query only needs to examine the records within [Key(box min), Key(box max)]
+//                3. Data of the field v of this patch are located at FieldOffset[v] + GID*PS1^3*sizeof(real)
+//                   in the snapshot, where FieldOffset[] is stored in the header of the index file
+//-------------------------------------------------------------------------------------------------------
+struct SnapIdxRecord_t
+{
+
+   long Key;            // Morton key of the patch corner
+   long LBIdx;          // load-balance index
+   int  GID;            // global patch index in the snapshot
+   int  Corner[3];      // patch corner in the unit of the finest cell
+
+}; // struct SnapIdxRecord_t
+
+
+
+#endif // #ifndef __SNAPSHOTINDEX_TYPEDEF_H__
@@ -21,6 +21,10 @@ static void SetBFieldIC( real magnetic[], const double x, const double y, const
 // function pointers of various user-specified routines
 extern void (*Init_Function_User_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                                        const int lv, double AuxArray[] );
+#if ( MODEL == HYDRO )
+extern void (*Init_Function_Batch_User_Ptr)( real fluid[], const int NCell, const double x[], const double y[],
+                                             const double z[], const double Time, const int lv, double AuxArray[] );
+#endif
 #ifdef MHD
 extern void (*Init_Function_BField_User_Ptr)( real magnetic[], const double x, const double y, const double z, const double Time,
                                               const int lv, double AuxArray[] );
@@ -36,12 +40,17 @@ extern void (*Mis_GetTimeStep_User_Ptr)( const int lv, const double dTime_dt );
 extern void (*Aux_Record_User_Ptr)();
 extern void (*BC_User_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                             const int lv, double AuxArray[] );
+extern void (*BC_User_Batch_Ptr)( real fluid[], const int NCell, const double x[], const double y[],
+                                  const double z[], const double Time, const int lv, double AuxArray[] );
 #ifdef MHD
 extern void (*BC_BField_User_Ptr)( real magnetic[], const double x, const double y, const double z, const double Time,
                                    const int lv, double AuxArray[] );
 #endif
 extern bool (*Flu_ResetByUser_Func_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                                          const int lv, double AuxArray[] );
+extern bool (*Flu_ResetByUser_Batch_Ptr)( real fluid[], bool Reset[], const int NCell, const double x[], const double y[],
+                                          const double z[], const double Time, const int lv, double AuxArray[] );
+extern bool (*Flu_ResetByUser_Patch_Ptr)( const double EdgeL[], const double EdgeR[], const double Time, const int lv );
 extern void (*End_User_Ptr)();
 #ifdef GRAVITY
 extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, const double z, const double Time,
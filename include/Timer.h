@@ -4,6 +4,7 @@
 
 
 #include "sys/time.h"
+#include <time.h>
 
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 void Aux_Message( FILE *Type, const char *Format, ... );
@@ -145,29 +146,222 @@ struct Timer_t
 
 
 
+// number of bytes reserved for the accumulator of each thread in ThreadTimer_t
+// --> must be no smaller than the cache line size to avoid false sharing
+#define THREAD_TIMER_SLOT_SIZE   64
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  ThreadTimer_t
+// Description :  Data structure for measuring the elapsed time of each OpenMP thread separately
+//
+// Note        :  1. Unlike Timer_t, Start() and Stop() can be invoked inside an OpenMP parallel region
+//                   --> Each thread accumulates to its own slot without any lock or atomic operation
+//                   --> Slots are padded to THREAD_TIMER_SLOT_SIZE bytes to avoid false sharing
+//                2. Use clock_gettime( CLOCK_MONOTONIC ), which reads the invariant TSC through vDSO on
+//                   Linux/x86 (~20 ns per call) and is immune to the adjustment of the system clock
+//                3. Threads with an ID >= NThread are ignored
+//                4. Used by TIMING_SOLVER to measure the thread imbalance in the preparation and closing steps
+//                   --> See THREAD_TIMER_SET/START/STOP() below
+//
+// Data Member :  NThread : Number of threads
+//                Slot    : Per-thread accumulators
+//                          --> Slot[t].Time : elapsed time of thread t (in nanoseconds)
+//                              Slot[t].T0   : time when thread t called Start() (in nanoseconds)
+//
+// Method      :  ThreadTimer_t : Constructor
+//               ~ThreadTimer_t : Destructor
+//                Start         : Start timing of the calling thread
+//                Stop          : Stop timing of the calling thread
+//                GetValue      : Get the elapsed time of a thread (in seconds)
+//                Reset         : Reset timer
+//-------------------------------------------------------------------------------------------------------
+struct ThreadTimer_t
+{
+
+// data members
+// ===================================================================================
+   struct Slot_t
+   {
+      long Time;
+      long T0;
+      char Padding[ THREAD_TIMER_SLOT_SIZE - 2*sizeof(long) ];
+   };
+
+   int     NThread;
+   Slot_t *Slot;
+
+
+
+   //===================================================================================
+   // Constructor :  ThreadTimer_t
+   // Description :  Constructor of the structure "ThreadTimer_t"
+   //
+   // Note        :  Allocate and initialize the per-thread accumulators
+   //
+   // Parameter   :  NThread_Input : Number of threads
+   //===================================================================================
+   ThreadTimer_t( const int NThread_Input )
+   {
+      NThread = ( NThread_Input > 0 ) ? NThread_Input : 1;
+      Slot    = new Slot_t [NThread];
+
+      Reset();
+   }
+
+
+
+   //===================================================================================
+   // Destructor  :  ~ThreadTimer_t
+   // Description :  Destructor of the structure "ThreadTimer_t"
+   //
+   // Note        :  Release memory
+   //===================================================================================
+   ~ThreadTimer_t()
+   {
+      delete [] Slot;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  GetNanoSec
+   // Description :  Return the current time of the monotonic clock (in nanoseconds)
+   //===================================================================================
+   static long GetNanoSec()
+   {
+      timespec ts;
+      clock_gettime( CLOCK_MONOTONIC, &ts );
+
+      return (long)ts.tv_sec*1000000000L + (long)ts.tv_nsec;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  GetThreadID
+   // Description :  Return the OpenMP thread ID of the calling thread
+   //===================================================================================
+   static int GetThreadID()
+   {
+#     ifdef OPENMP
+      return omp_get_thread_num();
+#     else
+      return 0;
+#     endif
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Start
+   // Description :  Start timing of the calling thread
+   //
+   // Note        :  1. Can be invoked by all threads simultaneously
+   //                2. Results of multiple Start()/Stop() pairs are accumulated
+   //===================================================================================
+   void Start()
+   {
+      const int TID = GetThreadID();
+
+      if ( TID < NThread )    Slot[TID].T0 = GetNanoSec();
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Stop
+   // Description :  Stop timing of the calling thread
+   //
+   // Note        :  Must be invoked by the same thread calling Start()
+   //===================================================================================
+   void Stop()
+   {
+      const int TID = GetThreadID();
+
+      if ( TID < NThread )    Slot[TID].Time += GetNanoSec() - Slot[TID].T0;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  GetValue
+   // Description :  Get the elapsed time (in seconds) recorded by the target thread
+   //
+   // Note        :  Must be invoked outside the timed region
+   //
+   // Parameter   :  TID : Target thread ID
+   //===================================================================================
+   double GetValue( const int TID )
+   {
+      return ( TID >= 0  &&  TID < NThread ) ? Slot[TID].Time*1.0e-9 : 0.0;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Reset
+   // Description :  Reset the timer of all threads
+   //
+   // Note        :  Must be invoked outside the timed region
+   //===================================================================================
+   void Reset()
+   {
+      for (int t=0; t<NThread; t++)
+      {
+         Slot[t].Time = 0;
+         Slot[t].T0   = 0;
+      }
+   }
+
+
+}; // struct ThreadTimer_t
+
+
+
 // macro for timing functions
 #ifdef TIMING
 
-#  define TIMING_FUNC( call, timer, timer_on )                       \
-   {                                                                 \
-      if ( timer_on )                                                \
-      {                                                              \
-         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
-         timer->Start();                                             \
-      }                                                              \
-                                                                     \
-      call;                                                          \
-                                                                     \
-      if ( timer_on )                                                \
-      {                                                              \
-         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );   \
-         timer->Stop();                                              \
-      }                                                              \
+// --> also record the event for OPT__TRACE (see Aux_Trace.cpp)
+#  define TIMING_FUNC( call, timer, timer_on )                                     \
+   {                                                                               \
+      const long Trace_T0 = ( OPT__TRACE ) ? ThreadTimer_t::GetNanoSec() : 0L;     \
+                                                                                   \
+      if ( timer_on )                                                              \
+      {                                                                            \
+         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );                 \
+         timer->Start();                                                           \
+      }                                                                            \
+                                                                                   \
+      call;                                                                        \
+                                                                                   \
+      if ( timer_on )                                                              \
+      {                                                                            \
+         if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );                 \
+         timer->Stop();                                                            \
+      }                                                                            \
+                                                                                   \
+      if ( OPT__TRACE )    Aux_Trace_Record( #call, NULL_INT, Trace_T0 );          \
+   }
+
+
+// macro for recording an event for OPT__TRACE without timing
+// --> lv: target level (NULL_INT if unknown)
+#  define TRACE_FUNC( call, lv )                                                   \
+   {                                                                               \
+      const long Trace_T0 = ( OPT__TRACE ) ? ThreadTimer_t::GetNanoSec() : 0L;     \
+                                                                                   \
+      call;                                                                        \
+                                                                                   \
+      if ( OPT__TRACE )    Aux_Trace_Record( #call, lv, Trace_T0 );                \
    }
 
 #else
 
 #  define TIMING_FUNC( call, timer, timer_on )  call
+#  define TRACE_FUNC( call, lv )                call
 
 #endif
 
@@ -198,5 +392,27 @@ struct Timer_t
 #endif
 
 
+// macros for timing each OpenMP thread in the preparation and closing steps of the solvers
+// --> THREAD_TIMER_SET() sets the target ThreadTimer_t (NULL to disable) outside OpenMP parallel regions
+// --> THREAD_TIMER_START/STOP() are invoked by each thread inside the instrumented OpenMP parallel regions
+//     (e.g., Prepare_PatchData() and Flu_Close()), which do nothing when no target timer is set
+#if ( defined TIMING_SOLVER  &&  defined TIMING )
+
+// target per-thread timer of the current step (declared in Main.cpp)
+extern ThreadTimer_t *Timer_ThreadPhase;
+
+#  define THREAD_TIMER_SET( timer )    { Timer_ThreadPhase = timer; }
+#  define THREAD_TIMER_START()         { if ( Timer_ThreadPhase != NULL )  Timer_ThreadPhase->Start(); }
+#  define THREAD_TIMER_STOP()          { if ( Timer_ThreadPhase != NULL )  Timer_ThreadPhase->Stop();  }
+
+#else
+
+#  define THREAD_TIMER_SET( timer )
+#  define THREAD_TIMER_START()
+#  define THREAD_TIMER_STOP()
+
+#endif
+
+
 
 #endif // #ifndef __TIMER_H__
@@ -22,6 +22,13 @@ typedef double real;
 typedef float  real;
 #endif
 
+// precision of the face-centered variables in the fluid solvers (see MIXED_PRECISION in the Makefile)
+#if ( defined FLOAT8  &&  defined MIXED_PRECISION )
+typedef float  real_fc;
+#else
+typedef real   real_fc;
+#endif
+
 
 // short names for unsigned type
 typedef unsigned short     ushort;
@@ -85,6 +92,13 @@ const OptRestartH_t
    RESTART_HEADER_CHECK = 1;
 
 
+// space-filling curves for load balancing
+typedef int OptLBCurve_t;
+const OptLBCurve_t
+   LB_CURVE_HILBERT = 1,
+   LB_CURVE_MORTON  = 2;
+
+
 // interpolation schemes
 typedef int IntScheme_t;
 const IntScheme_t
@@ -166,6 +180,14 @@ const Check_t
    CHECK_ON  = 1;
 
 
+// spacing of the x coordinates of an interpolation table (see Mis_CheckTableSpacing())
+typedef int TableSpacing_t;
+const TableSpacing_t
+   TABLE_SPACING_NONE   = 0,
+   TABLE_SPACING_LINEAR = 1,
+   TABLE_SPACING_LOG    = 2;
+
+
 // target solver in InvokeSolver()
 // --> must start from 0 because of the current TIMING_SOLVER implementation
 // --> when adding new solvers, please modify the NSOLVER constant accordingly
@@ -204,8 +226,19 @@ const GetBufMode_t
 #ifdef MHD
   ,COARSE_FINE_ELECTRIC = 8
 #endif
+  ,DATA_RESTRICT_FLUX   = 9
   ;
 
+// a single request of Buf_GetBufferData_Batch()
+// --> members have the same meanings as the corresponding arguments of Buf_GetBufferData()
+struct GetBufReq_t
+{
+   int          lv, FluSg, MagSg, PotSg;
+   GetBufMode_t GetBufMode;
+   long         TVarCC, TVarFC;
+   int          ParaBuf;
+};
+
 
 // fluid boundary conditions
 typedef int OptFluBC_t;
@@ -273,6 +306,14 @@ typedef int ParPass2Son_t;
 const ParPass2Son_t
    PAR_PASS2SON_GENERAL = 1,
    PAR_PASS2SON_EVOLVE  = 2;
+
+typedef int ParCompressMPI_t;
+const ParCompressMPI_t
+   PAR_COMPRESS_MPI_NONE         = 0,
+   PAR_COMPRESS_MPI_EXCHANGE     = 1,
+   PAR_COMPRESS_MPI_COLLECT_REAL = 2,
+   PAR_COMPRESS_MPI_COLLECT_LV   = 4,
+   PAR_COMPRESS_MPI_ALL          = 7;
 #endif // #ifdef PARTICLE
 
 
@@ -309,7 +350,8 @@ const OptRSolver1st_t
    RSOLVER_1ST_ROE     = 1,
    RSOLVER_1ST_HLLC    = 2,
    RSOLVER_1ST_HLLE    = 3,
-   RSOLVER_1ST_HLLD    = 4;
+   RSOLVER_1ST_HLLD    = 4,
+   RSOLVER_1ST_EXACT   = 5;
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -35,6 +35,14 @@ void Aux_Check_Parameter()
 #     error : ERROR : OVERLAP_MPI must work with LOAD_BALANCE !!
 #  endif
 
+#  if ( defined MIXED_PRECISION  &&  !defined FLOAT8 )
+#     error : ERROR : MIXED_PRECISION must work with FLOAT8 !!
+#  endif
+
+#  if ( defined MIXED_PRECISION  &&  defined GPU )
+#     error : ERROR : currently MIXED_PRECISION is only supported by the CPU solvers !!
+#  endif
+
 #  if ( !defined GRAVITY  &&  defined UNSPLIT_GRAVITY )
 #     error : ERROR : UNSPLIT_GRAVITY must work with GRAVITY !!
 #  endif
@@ -50,16 +58,11 @@ void Aux_Check_Parameter()
 #  ifdef SERIAL
    int NRank = 1;
 #  else
-   int NRank, MPI_Thread_Status, MPI_Init_Status;
+   int NRank, MPI_Init_Status;
 
    MPI_Initialized( &MPI_Init_Status );
    if ( MPI_Init_Status == false )  Aux_Error( ERROR_INFO, "MPI_Init() has not been called !!\n" );
 
-   MPI_Query_thread( &MPI_Thread_Status );
-   if ( OPT__OVERLAP_MPI  &&  MPI_Thread_Status == MPI_THREAD_SINGLE )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported since the level of MPI thread support == %s\n",
-                 "OPT__OVERLAP_MPI", "MPI_THREAD_SINGLE" );
-
    MPI_Comm_size( MPI_COMM_WORLD, &NRank );
 #  endif
 
@@ -132,6 +135,11 @@ void Aux_Check_Parameter()
 #  error : ERROR : unsupported MODEL !!
 #  endif
 
+#  if ( MODEL != HYDRO )
+   if ( OPT__FLAG_FLU_BYPRODUCT )
+      Aux_Error( ERROR_INFO, "\"%s\" is only supported in HYDRO !!\n", "OPT__FLAG_FLU_BYPRODUCT" );
+#  endif
+
 #  ifdef GPU
 #  ifdef LAOHU
    if ( OPT__GPUID_SELECT < -3 )
@@ -149,14 +157,24 @@ void Aux_Check_Parameter()
          Aux_Error( ERROR_INFO, "\"MPI_NRank_%c (%d) != 1\" in the serial code !!\n", 'X'+d, MPI_NRank_X[d] );
 #  endif // #ifdef SERIAL
 
-#  ifndef OVERLAP_MPI
+// OPT__OVERLAP_MPI skips the fluid exchange at the end of each sub-step (except for GRAVITY)
+// --> no other operation may modify the fluid data after the fluid and gravity solvers
    if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT enabled in the Makefile for \"%s\" !!\n",
-                 "OVERLAP_MPI", "OPT__OVERLAP_MPI" );
-#  endif
+   {
+#     ifdef MHD
+      Aux_Error( ERROR_INFO, "\"%s\" does not support \"%s\" yet !!\n", "OPT__OVERLAP_MPI", "MHD" );
+#     endif
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE )
+         Aux_Error( ERROR_INFO, "\"%s\" does not support \"%s\" yet !!\n", "OPT__OVERLAP_MPI", "GRACKLE_ACTIVATE" );
+#     endif
+
+#     ifdef STAR_FORMATION
+      if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
+         Aux_Error( ERROR_INFO, "\"%s\" does not support \"%s\" yet !!\n", "OPT__OVERLAP_MPI", "SF_CREATE_STAR_SCHEME" );
+#     endif
+   }
 
    if ( AUTO_REDUCE_DT )
    {
@@ -192,6 +210,9 @@ void Aux_Check_Parameter()
    if ( OPT__DT_LEVEL == DT_LEVEL_SHARED  &&  OPT__INT_TIME )
       Aux_Error( ERROR_INFO, "OPT__INT_TIME should be disabled when \"OPT__DT_LEVEL == DT_LEVEL_SHARED\" !!\n" );
 
+   if ( OPT__SG_ON_DEMAND  &&  OPT__INT_TIME )
+      Aux_Error( ERROR_INFO, "OPT__INT_TIME must be disabled for OPT__SG_ON_DEMAND !!\n" );
+
    if ( INT_MONO_COEFF < 1.0  ||  INT_MONO_COEFF > 4.0 )
       Aux_Error( ERROR_INFO, "INT_MONO_COEFF (%14.7e) is not within the correct range [1.0, 4.0] !!\n", INT_MONO_COEFF );
 
@@ -238,6 +259,15 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "must enable either SERIAL or LOAD_BALANCE for OPT__INIT=3 !!\n" );
 #  endif
 
+   if ( OUTPUT_DIAG_STEP > 0  &&  OUTPUT_DIAG_PROF_LOGR <= 1.0 )
+      Aux_Error( ERROR_INFO, "OUTPUT_DIAG_PROF_LOGR (%14.7e) <= 1.0 !!\n", OUTPUT_DIAG_PROF_LOGR );
+
+// libyt performs collective MPI calls on MPI_COMM_WORLD, which must not overlap with those of the main loop
+#  ifdef SUPPORT_LIBYT
+   if ( YT_ASYNC  &&  MPI_NRank > 1 )
+      Aux_Error( ERROR_INFO, "YT_ASYNC only supports a single MPI rank (current: %d) !!\n", MPI_NRank );
+#  endif
+
 
 
 // general warnings
@@ -283,6 +313,12 @@ void Aux_Check_Parameter()
    if ( !OPT__INIT_RESTRICT )
       Aux_Message( stderr, "WARNING : OPT__INIT_RESTRICT is disabled !!\n" );
 
+   if ( OPT__INIT_REFINE_MAP == 1  &&  OPT__INIT != INIT_BY_FUNCTION )
+      Aux_Message( stderr, "WARNING : OPT__INIT_REFINE_MAP only works with OPT__INIT = %d !!\n", INIT_BY_FUNCTION );
+
+   if ( OPT__INT_TIME_LAZY  &&  !OPT__INT_TIME )
+      Aux_Message( stderr, "WARNING : OPT__INT_TIME_LAZY has no effect when OPT__INT_TIME is disabled !!\n" );
+
 #  ifdef TIMING_SOLVER
    Aux_Message( stderr, "WARNING : \"TIMING_SOLVER\" will disable the concurrent execution\n" );
    Aux_Message( stderr, "          between GPU and CPU and hence will decrease the overall performance !!\n" );
@@ -321,23 +357,9 @@ void Aux_Check_Parameter()
                            "simulation boundaries are NOT allowed for refinement !!\n" );
 
    if ( OPT__OVERLAP_MPI )
-   {
       Aux_Message( stderr, "WARNING : \"%s\" is still experimental and is not fully optimized !!\n",
                    "OPT__OVERLAP_MPI" );
 
-#     ifdef OPENMP
-      omp_set_nested( true );
-
-      if ( !omp_get_nested() )
-         Aux_Message( stderr, "WARNING : OpenMP nested parallelism is NOT supported for \"%s\" !!\n",
-                      "OPT__OVERLAP_MPI" );
-
-      omp_set_nested( false );
-#     else
-      Aux_Message( stderr, "WARNING : OpenMP is NOT turned on for \"%s\" !!\n", "OPT__OVERLAP_MPI" );
-#     endif
-   } // if ( OPT__OVERLAP_MPI )
-
    if ( OPT__TIMING_BARRIER )
       Aux_Message( stderr, "WARNING : \"%s\" may deteriorate performance (especially if %s is on) ...\n",
                    "OPT__TIMING_BARRIER", "OPT__OVERLAP_MPI" );
@@ -434,11 +456,22 @@ void Aux_Check_Parameter()
       MPI_Exit();
    }
 
+#  ifndef TIMING
+   if ( LB_INPUT__MEASURED_COST > 0.0 )
+      Aux_Error( ERROR_INFO, "LB_INPUT__MEASURED_COST (%13.7e) > 0.0 must work with TIMING !!\n", LB_INPUT__MEASURED_COST );
+#  endif
+
 
 // warnings
 // ------------------------------
    if ( MPI_Rank == 0 ) {
 
+   if ( OPT__LB_COUPLE_LEVEL  &&  OPT__LB_INCREMENTAL )
+      Aux_Message( stderr, "WARNING : OPT__LB_INCREMENTAL is ignored when redistributing all levels with OPT__LB_COUPLE_LEVEL !!\n" );
+
+   if ( LB_INPUT__MEASURED_COST > 0.0  &&  OPT__TIMING_BARRIER )
+      Aux_Message( stderr, "WARNING : OPT__TIMING_BARRIER includes the MPI waiting time in the cost measured by LB_INPUT__MEASURED_COST !!\n" );
+
    if ( NX0_TOT[0] != NX0_TOT[1]  ||  NX0_TOT[0] != NX0_TOT[2] )
    {
       Aux_Message( stderr, "WARNING : LOAD_BALANCE has NOT been fully optimized for non-cubic simulation box\n" );
@@ -523,6 +556,11 @@ void Aux_Check_Parameter()
    if ( OPT__RESET_FLUID  &&   OPT__OVERLAP_MPI )
       Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__OVERLAP_MPI", "OPT__RESET_FLUID" );
 
+#  if ( MODEL != HYDRO )
+   if ( OPT__CK_FLU_OUTPUT == 2 )
+      Aux_Error( ERROR_INFO, "OPT__CK_FLU_OUTPUT == 2 only works with MODEL == HYDRO !!\n" );
+#  endif
+
 
 // warnings
 // ------------------------------
@@ -587,6 +625,16 @@ void Aux_Check_Parameter()
 #   endif
 #  endif // MHD
 
+#  ifdef RSOLVER_HYBRID
+#   if ( RSOLVER_HYBRID != ROE  &&  RSOLVER_HYBRID != HLLE )
+#     error : ERROR : unsupported RSOLVER_HYBRID (ROE/HLLE) !!
+#   endif
+
+#   if ( RSOLVER_HYBRID == RSOLVER )
+#     error : ERROR : RSOLVER_HYBRID must be different from RSOLVER !!
+#   endif
+#  endif // #ifdef RSOLVER_HYBRID
+
 #  ifdef DUAL_ENERGY
 #   if ( FLU_SCHEME == RTVD )
 #     error : RTVD does NOT support DUAL_ENERGY !!
@@ -644,6 +692,9 @@ void Aux_Check_Parameter()
       if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE  &&  OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_ROE )
          Aux_Error( ERROR_INFO, "OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_ROE only supports EOS_GAMMA !!\n" );
 
+      if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE  &&  OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_EXACT )
+         Aux_Error( ERROR_INFO, "OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_EXACT only supports EOS_GAMMA !!\n" );
+
       if ( JEANS_MIN_PRES )
          Aux_Error( ERROR_INFO, "JEANS_MIN_PRES currently only supports EOS_GAMMA !!\n" );
 #  endif // if ( EOS != EOS_GAMMA )
@@ -652,8 +703,17 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "EOS_NUCLEAR is not supported yet !!\n" );
 #  endif
 
-#  if ( EOS == EOS_TABULAR )
-      Aux_Error( ERROR_INFO, "EOS_TABULAR is not supported yet !!\n" );
+#  if ( EOS == EOS_TABULAR  &&  defined GPU )
+#     error : ERROR : EOS_TABULAR is only supported by the CPU solvers !!
+#  endif
+
+#  ifdef GAMMA_CONST
+#     if ( EOS != EOS_GAMMA )
+#        error : ERROR : GAMMA_CONST only works with EOS_GAMMA !!
+#     endif
+
+      if ( GAMMA != GAMMA_CONST )
+         Aux_Error( ERROR_INFO, "GAMMA (%20.14e) != GAMMA_CONST (%20.14e) !!\n", GAMMA, GAMMA_CONST );
 #  endif
 
 #  ifdef BAROTROPIC_EOS
@@ -678,7 +738,7 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "MHD does not support \"OPT__1ST_FLUX_CORR\" !!\n" );
 #     else
       if ( OPT__1ST_FLUX_CORR_SCHEME != RSOLVER_1ST_ROE  &&  OPT__1ST_FLUX_CORR_SCHEME != RSOLVER_1ST_HLLC  &&
-           OPT__1ST_FLUX_CORR_SCHEME != RSOLVER_1ST_HLLE )
+           OPT__1ST_FLUX_CORR_SCHEME != RSOLVER_1ST_HLLE  &&  OPT__1ST_FLUX_CORR_SCHEME != RSOLVER_1ST_EXACT )
          Aux_Error( ERROR_INFO, "unsupported parameter \"%s = %d\" !!\n", "OPT__1ST_FLUX_CORR_SCHEME", OPT__1ST_FLUX_CORR_SCHEME );
 #     endif
 
@@ -692,6 +752,120 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "RTVD does not support \"JEANS_MIN_PRES\" !!\n" );
 #  endif
 
+   if ( OPT__DT_FLU_BYPRODUCT )
+   {
+#     ifdef MHD
+      Aux_Error( ERROR_INFO, "MHD does not support \"OPT__DT_FLU_BYPRODUCT\" !!\n" );
+#     endif
+
+#     ifdef GRAVITY
+      Aux_Error( ERROR_INFO, "GRAVITY does not support \"OPT__DT_FLU_BYPRODUCT\" !!\n" );
+#     endif
+
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "GRACKLE_ACTIVATE", "OPT__DT_FLU_BYPRODUCT" );
+#     endif
+
+      if ( OPT__RESET_FLUID )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__RESET_FLUID", "OPT__DT_FLU_BYPRODUCT" );
+   }
+
+   if ( AUTO_REDUCE_DT_LOCAL )
+   {
+#     ifdef GPU
+      Aux_Error( ERROR_INFO, "AUTO_REDUCE_DT_LOCAL is not supported by the GPU solvers yet !!\n" );
+#     endif
+
+#     ifdef MHD
+      Aux_Error( ERROR_INFO, "MHD does not support \"AUTO_REDUCE_DT_LOCAL\" !!\n" );
+#     endif
+
+#     ifdef UNSPLIT_GRAVITY
+      Aux_Error( ERROR_INFO, "UNSPLIT_GRAVITY does not support \"AUTO_REDUCE_DT_LOCAL\" !!\n" );
+#     endif
+
+#     if ( FLU_SCHEME == RTVD )
+      Aux_Error( ERROR_INFO, "RTVD does not support \"AUTO_REDUCE_DT_LOCAL\" !!\n" );
+#     endif
+
+      if ( !OPT__FIXUP_FLUX )
+         Aux_Error( ERROR_INFO, "\"%s\" must work with \"%s\" !!\n", "AUTO_REDUCE_DT_LOCAL", "OPT__FIXUP_FLUX" );
+   }
+
+   if ( OPT__FROZEN_REGION )
+   {
+#     ifdef GPU
+      Aux_Error( ERROR_INFO, "OPT__FROZEN_REGION is not supported by the GPU solvers yet !!\n" );
+#     endif
+
+#     ifdef MHD
+      Aux_Error( ERROR_INFO, "MHD does not support \"OPT__FROZEN_REGION\" !!\n" );
+#     endif
+
+#     ifdef UNSPLIT_GRAVITY
+      Aux_Error( ERROR_INFO, "UNSPLIT_GRAVITY does not support \"OPT__FROZEN_REGION\" !!\n" );
+#     endif
+
+#     if ( FLU_SCHEME == RTVD )
+      Aux_Error( ERROR_INFO, "RTVD does not support \"OPT__FROZEN_REGION\" !!\n" );
+#     endif
+
+      if ( OPT__OVERLAP_MPI )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__OVERLAP_MPI", "OPT__FROZEN_REGION" );
+
+      if ( AUTO_REDUCE_DT_LOCAL )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "AUTO_REDUCE_DT_LOCAL", "OPT__FROZEN_REGION" );
+   }
+
+// OPT__FLAG_FLU_BYPRODUCT only supports the refinement criteria depending solely on the fluid data of the target patch
+// and requires that no operation other than the fix-up modifies the fluid data between the fluid solver and Flag_Real()
+   if ( OPT__FLAG_FLU_BYPRODUCT )
+   {
+#     ifdef MHD
+      Aux_Error( ERROR_INFO, "MHD does not support \"OPT__FLAG_FLU_BYPRODUCT\" !!\n" );
+#     endif
+
+#     ifdef GRAVITY
+      Aux_Error( ERROR_INFO, "GRAVITY does not support \"OPT__FLAG_FLU_BYPRODUCT\" !!\n" );
+#     endif
+
+#     ifdef PARTICLE
+      if ( OPT__FLAG_NPAR_CELL  ||  OPT__FLAG_PAR_MASS_CELL )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n",
+                    "OPT__FLAG_NPAR_CELL/OPT__FLAG_PAR_MASS_CELL", "OPT__FLAG_FLU_BYPRODUCT" );
+#     endif
+
+#     ifdef STAR_FORMATION
+      if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "SF_CREATE_STAR_SCHEME", "OPT__FLAG_FLU_BYPRODUCT" );
+#     endif
+
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "GRACKLE_ACTIVATE", "OPT__FLAG_FLU_BYPRODUCT" );
+#     endif
+
+      if ( OPT__FLAG_LOHNER_DENS  ||  OPT__FLAG_LOHNER_ENGY  ||  OPT__FLAG_LOHNER_PRES  ||  OPT__FLAG_LOHNER_TEMP )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__FLAG_LOHNER_*", "OPT__FLAG_FLU_BYPRODUCT" );
+
+      if ( OPT__FLAG_USER )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__FLAG_USER", "OPT__FLAG_FLU_BYPRODUCT" );
+
+      if ( OPT__RESET_FLUID )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "OPT__RESET_FLUID", "OPT__FLAG_FLU_BYPRODUCT" );
+   }
+
+   if ( OPT__RECORD_CONSERVATION )
+   {
+      if ( !OPT__FIXUP_FLUX )
+         Aux_Error( ERROR_INFO, "must enable \"%s\" for \"%s\" !!\n", "OPT__FIXUP_FLUX", "OPT__RECORD_CONSERVATION" );
+
+#     ifdef COMOVING
+      Aux_Error( ERROR_INFO, "COMOVING does not support \"OPT__RECORD_CONSERVATION\" !!\n" );
+#     endif
+   }
+
 
 // warnings
 // ------------------------------
@@ -775,6 +949,10 @@ void Aux_Check_Parameter()
 // ------------------------------
    if ( MPI_Rank == 0 ) {
 
+#  if ( defined RSOLVER_HYBRID  &&  defined GPU )
+      Aux_Message( stderr, "WARNING : the numbers of interfaces solved by RSOLVER_HYBRID/RSOLVER are not recorded for GPU !!\n" );
+#  endif
+
    } // if ( MPI_Rank == 0 )
 
 #  endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
@@ -1130,11 +1308,74 @@ void Aux_Check_Parameter()
 
    if ( NEWTON_G <= 0.0 )     Aux_Error( ERROR_INFO, "NEWTON_G (%14.7e) <= 0.0 !!\n", NEWTON_G );
 
+#  ifdef SERIAL
+   if ( OPT__FFT_PENCIL )
+      Aux_Error( ERROR_INFO, "OPT__FFT_PENCIL does not support SERIAL !!\n" );
+#  endif
+
+   if ( OPT__FFT_PENCIL  &&  OPT__BC_POT != BC_POT_PERIODIC )
+      Aux_Error( ERROR_INFO, "OPT__FFT_PENCIL only supports the periodic BC for gravity (OPT__BC_POT = 1) !!\n" );
+
+   if ( OPT__RECORD_LEVEL_PS > 0 )
+   {
+#     ifndef SERIAL
+      if ( !OPT__FFT_PENCIL )
+         Aux_Error( ERROR_INFO, "OPT__RECORD_LEVEL_PS must work with OPT__FFT_PENCIL !!\n" );
+#     endif
+
+      if ( NX0_TOT[0] != NX0_TOT[1]  ||  NX0_TOT[0] != NX0_TOT[2] )
+         Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n", "OPT__RECORD_LEVEL_PS" );
+
+      if ( LEVEL_PS_LV > MAX_LEVEL )
+         Aux_Error( ERROR_INFO, "LEVEL_PS_LV (%d) > MAX_LEVEL (%d) !!\n", LEVEL_PS_LV, MAX_LEVEL );
+   }
+
+#  ifdef GPU
+   if ( OPT__POT_WARM_START )
+      Aux_Error( ERROR_INFO, "OPT__POT_WARM_START is not supported by the GPU Poisson solvers yet !!\n" );
+
+   if ( OPT__RECORD_POI_ITER )
+      Aux_Error( ERROR_INFO, "OPT__RECORD_POI_ITER is not supported by the GPU Poisson solvers yet !!\n" );
+
+#  if ( POT_SCHEME == SOR )
+   if ( SOR_TOLERATED_ERROR > 0.0 )
+      Aux_Error( ERROR_INFO, "SOR_TOLERATED_ERROR > 0.0 is not supported by the GPU SOR solver yet !!\n" );
+#  endif
+#  endif // #ifdef GPU
+
+#  ifndef STORE_POT_GHOST
+   if ( OPT__USG_POT_EXT )
+      Aux_Error( ERROR_INFO, "OPT__USG_POT_EXT must work with STORE_POT_GHOST !!\n" );
+#  endif
+
+#  ifdef UNSPLIT_GRAVITY
+   if ( OPT__USG_FUSE_EXT_ACC  &&  OPT__GRAVITY_TYPE != GRAVITY_EXTERNAL )
+      Aux_Error( ERROR_INFO, "OPT__USG_FUSE_EXT_ACC only works with OPT__GRAVITY_TYPE == 2 (EXTERNAL) !!\n" );
+
+#  if ( MODEL == HYDRO  &&  FLU_SCHEME == RTVD )
+   if ( OPT__USG_FUSE_EXT_ACC )
+      Aux_Error( ERROR_INFO, "OPT__USG_FUSE_EXT_ACC does not support FLU_SCHEME == RTVD !!\n" );
+#  endif
+
+#  ifdef GPU
+   if ( OPT__USG_FUSE_EXT_ACC )
+      Aux_Error( ERROR_INFO, "OPT__USG_FUSE_EXT_ACC is not supported by the GPU solvers yet !!\n" );
+#  endif
+#  endif
+
 
 // warnings
 // ------------------------------
    if ( MPI_Rank == 0 ) {
 
+#  ifndef UNSPLIT_GRAVITY
+   if ( OPT__USG_POT_EXT )
+      Aux_Message( stderr, "WARNING : OPT__USG_POT_EXT is useless when UNSPLIT_GRAVITY is off !!\n" );
+
+   if ( OPT__USG_FUSE_EXT_ACC )
+      Aux_Message( stderr, "WARNING : OPT__USG_FUSE_EXT_ACC is useless when UNSPLIT_GRAVITY is off !!\n" );
+#  endif
+
 #  if ( POT_SCHEME == MG  &&  PATCH_SIZE <= 8 )
    {
       Aux_Message( stderr, "WARNING : multigrid scheme gives lower performance than SOR for " );
@@ -1335,6 +1576,30 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "CHE_GPU_NPGROUP (%d) < OMP_NTHREAD (%d) !!\n", CHE_GPU_NPGROUP, OMP_NTHREAD );
 #  endif
 
+// Grackle rescales all fields in place in the comoving frame, which would perturb the patch data by round-off errors
+#  ifdef COMOVING
+   if ( GRACKLE_ZERO_COPY )
+      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "GRACKLE_ZERO_COPY", "COMOVING" );
+#  endif
+
+   if ( GRACKLE_SCREEN_TCOOL > 0.0 )
+   {
+      if ( GRACKLE_PRIMORDIAL != GRACKLE_PRI_CHE_CLOUDY )
+         Aux_Error( ERROR_INFO, "\"%s\" only works with \"%s\" !!\n", "GRACKLE_SCREEN_TCOOL", "GRACKLE_PRIMORDIAL == 0" );
+
+      if ( GRACKLE_ZERO_COPY )
+         Aux_Error( ERROR_INFO, "\"%s\" is NOT supported for \"%s\" !!\n", "GRACKLE_SCREEN_TCOOL", "GRACKLE_ZERO_COPY" );
+
+      if ( GRACKLE_SCREEN_TCOOL < 1.0 )
+         Aux_Error( ERROR_INFO, "GRACKLE_SCREEN_TCOOL (%14.7e) < 1.0 !!\n", GRACKLE_SCREEN_TCOOL );
+   }
+
+// the Grackle cost of each patch is only measured when invoking Grackle for one patch at a time
+#  ifdef LOAD_BALANCE
+   if ( LB_INPUT__CHE_WEIGHT > 0.0  &&  !GRACKLE_ZERO_COPY )
+      Aux_Error( ERROR_INFO, "\"%s\" requires \"%s\" !!\n", "LB_INPUT__CHE_WEIGHT", "GRACKLE_ZERO_COPY" );
+#  endif
+
 // warning
 // ------------------------------
    if ( MPI_Rank == 0 ) {
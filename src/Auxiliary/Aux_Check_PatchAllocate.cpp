@@ -154,7 +154,7 @@ void Aux_Check_PatchAllocate( const int lv, const char *comment )
 
 //       check 3
          memcpy( Cr1D_Sort, Cr1D, NTot*sizeof(ulong) );
-         Mis_Heapsort( NTot, Cr1D_Sort, NULL );
+         Mis_RadixSort( NTot, Cr1D_Sort, NULL );
          for (int t=0; t<NTot-1; t++)
          {
             if ( Cr1D_Sort[t] == Cr1D_Sort[t+1] )
@@ -245,8 +245,8 @@ void Aux_Check_PatchAllocate( const int lv, const char *comment )
 
 
 //    sort all real and buffer patches
-      Mis_Heapsort( NReal_Tot, Cr1D_Real, NULL );
-      Mis_Heapsort( NBuff_Tot, Cr1D_Buff, NULL );
+      Mis_RadixSort( NReal_Tot, Cr1D_Real, NULL );
+      Mis_RadixSort( NBuff_Tot, Cr1D_Buff, NULL );
 
 
 //    check 4
@@ -2,6 +2,7 @@
 
 extern void SetTempIntPara( const int lv, const int Sg_Current, const double PrepTime, const double Time0, const double Time1,
                             bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
+static int GetBin( const double r, const bool LogBin, const double dr_min, const double _dr_min, const double _LogRatio );
 
 
 
@@ -25,6 +26,9 @@ extern void SetTempIntPara( const int lv, const int Sg_Current, const double Pre
 //                   --> Will support other weighting functions in the future
 //                5. Support computing multiple fields
 //                   --> The order of fields to be returned follows TVarBitIdx[]
+//                6. Patches lying entirely outside r_max are skipped by their bounding boxes, and cells of patches
+//                   lying entirely within a single bin skip the bin search
+//                   --> Radii and bin indices are computed for an entire row of cells at once to allow vectorization
 //
 // Parameter   :  Prof        : Profile_t object array to store the results
 //                Center      : Target center coordinates
@@ -191,7 +195,10 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
 
 
 // collect profile data in this rank
+   const int    NBin        = Prof[0]->NBin;
    const double r_max2      = SQR( Prof[0]->MaxRadius );
+   const double _dr_min     = 1.0/dr_min;
+   const double _LogRatio   = ( LogBin ) ? 1.0/log(LogBinRatio) : NULL_REAL;
    const double HalfBox[3]  = { 0.5*amr->BoxSize[0], 0.5*amr->BoxSize[1], 0.5*amr->BoxSize[2] };
    const bool   Periodic[3] = { OPT__BC_FLU[0] == BC_FLU_PERIODIC,
                                 OPT__BC_FLU[2] == BC_FLU_PERIODIC,
@@ -296,6 +303,35 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
             const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh - Center[1];
             const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh - Center[2];
 
+
+//          get the minimum and maximum distances between the target center and the cell centers of this patch
+//          --> measured from the patch center, which is wrapped into the box for the periodic BC
+//          --> both remain valid bounds for the individually wrapped cells below
+            const double HalfWidth = 0.5*( PS1 - 1 )*dh;
+            double r2_min = 0.0, r2_max = 0.0;
+
+            for (int d=0; d<3; d++)
+            {
+               double dc = amr->patch[0][lv][PID]->EdgeL[d] + 0.5*PS1*dh - Center[d];
+
+               if ( Periodic[d] ) {
+                  if      ( dc > +HalfBox[d] )  {  dc -= amr->BoxSize[d];  }
+                  else if ( dc < -HalfBox[d] )  {  dc += amr->BoxSize[d];  }
+               }
+
+               r2_min += SQR(  MAX( fabs(dc) - HalfWidth, 0.0 )  );
+               r2_max += SQR(       fabs(dc) + HalfWidth         );
+            }
+
+//          skip patches lying entirely outside the maximum radius
+            if ( r2_min >= r_max2 )    continue;
+
+//          skip the bin search if the entire patch lies within a single bin
+            const int  bin_min = GetBin( sqrt(r2_min), LogBin, dr_min, _dr_min, _LogRatio );
+            const int  bin_max = GetBin( sqrt(r2_max), LogBin, dr_min, _dr_min, _LogRatio );
+            const bool OneBin  = ( r2_max < r_max2  &&  bin_min == bin_max  &&  bin_max < NBin );
+
+
             for (int k=0; k<PS1; k++)  {  double dz = z0 + k*dh;
                                           if ( Periodic[2] ) {
                                              if      ( dz > +HalfBox[2] )  {  dz -= amr->BoxSize[2];  }
@@ -306,25 +342,51 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                                              if      ( dy > +HalfBox[1] )  {  dy -= amr->BoxSize[1];  }
                                              else if ( dy < -HalfBox[1] )  {  dy += amr->BoxSize[1];  }
                                           }
-            for (int i=0; i<PS1; i++)  {  double dx = x0 + i*dh;
-                                          if ( Periodic[0] ) {
-                                             if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
-                                             else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
-                                          }
+
+//          compute the radii and bin indices of an entire row at once
+//          --> bin = -1 for cells lying outside the maximum radius or the last bin (due to round-off errors)
+            double dx_Row[PS1], r_Row[PS1];
+            int    bin_Row[PS1];
+
+#           pragma omp simd
+            for (int i=0; i<PS1; i++)
+            {
+               double dx = x0 + i*dh;
+
+               if ( Periodic[0] ) {
+                  if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
+                  else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
+               }
 
                const double r2 = SQR(dx) + SQR(dy) + SQR(dz);
 
-               if ( r2 < r_max2 )
+               dx_Row[i] = dx;
+               r_Row [i] = sqrt( r2 );
+               bin_Row[i] = ( r2 < r_max2 ) ? 0 : -1;
+            }
+
+            if ( OneBin )
+               for (int i=0; i<PS1; i++)  bin_Row[i] = bin_min;
+
+            else
+               for (int i=0; i<PS1; i++)
                {
-                  const double r   = sqrt( r2 );
-                  const int    bin = ( LogBin ) ? (  (r<dr_min) ? 0 : int( log(r/dr_min)/log(LogBinRatio) ) + 1  )
-                                                : int( r/dr_min );
-//                prevent from round-off errors
-                  if ( bin >= Prof[0]->NBin )   continue;
+                  if ( bin_Row[i] < 0 )   continue;
+
+                  const int bin = GetBin( r_Row[i], LogBin, dr_min, _dr_min, _LogRatio );
+
+                  bin_Row[i] = ( bin < NBin ) ? bin : -1;
+               }
+
+            for (int i=0; i<PS1; i++)  {  const double dx  = dx_Row [i];
+                                          const double r   = r_Row  [i];
+                                          const int    bin = bin_Row[i];
 
+               if ( bin >= 0 )
+               {
 //                check
 #                 ifdef GAMER_DEBUG
-                  if ( bin < 0 )    Aux_Error( ERROR_INFO, "bin (%d) < 0 !!\n", bin );
+                  if ( bin >= NBin )   Aux_Error( ERROR_INFO, "bin (%d) >= NBin (%d) !!\n", bin, NBin );
 #                 endif
 
 //                prepare passive scalars (for better sustainability, always do it even when unnecessary)
@@ -519,7 +581,7 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                         } // switch ( TVarBitIdx[p] )
                      } // if ( TFluIntIdx[p] != IdxUndef ) ... else ...
                   } // for (int p=0; p<NProf; p++)
-               } // if ( r2 < r_max2 )
+               } // if ( bin >= 0 )
             }}} // i,j,k
          } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
       } // for (int lv=lv_min; lv<=lv_max; lv++)
@@ -643,3 +705,28 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
    } // if ( RemoveEmpty )
 
 } // FUNCTION : Aux_ComputeProfile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetBin
+// Description :  Return the index of the radial bin containing the target radius
+//
+// Note        :  1. Invoked by Aux_ComputeProfile()
+//                2. Do not check whether the returned index exceeds the total number of bins
+//
+// Parameter   :  r         : Target radius
+//                LogBin    : true/false --> log/linear bins
+//                dr_min    : Minimum bin size
+//                _dr_min   : 1/dr_min
+//                _LogRatio : 1/log(LogBinRatio) (useless for linear bins)
+//
+// Return      :  Bin index
+//-------------------------------------------------------------------------------------------------------
+int GetBin( const double r, const bool LogBin, const double dr_min, const double _dr_min, const double _LogRatio )
+{
+
+   if ( LogBin )  return ( r < dr_min ) ? 0 : int( log(r*_dr_min)*_LogRatio ) + 1;
+   else           return int( r*_dr_min );
+
+} // FUNCTION : GetBin
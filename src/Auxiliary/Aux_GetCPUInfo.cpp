@@ -13,6 +13,26 @@ void Aux_GetCPUInfo( const char *FileName )
 {
 
    FILE *Note = fopen( FileName, "a" );
+
+   Aux_GetCPUInfo( Note );
+
+   fclose( Note );
+
+} // FUNCTION : Aux_GetCPUInfo
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_GetCPUInfo
+// Description :  Record the CPU information to an opened stream
+//
+// Note        :  1. Overloaded function used by Aux_TakeNote() to collect the information of all ranks in memory
+//
+// Parameter   :  Note : Output stream
+//-------------------------------------------------------------------------------------------------------
+void Aux_GetCPUInfo( FILE *Note )
+{
+
    char *line = NULL;
    size_t len = 0;
    char String[2][100];
@@ -97,6 +117,5 @@ void Aux_GetCPUInfo( const char *FileName )
    }
 
    fclose( MemInfo );
-   fclose( Note );
 
 } // FUNCTION : Aux_GetCPUInfo
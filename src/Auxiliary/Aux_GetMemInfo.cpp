@@ -1,6 +1,37 @@
 #include "GAMER.h"
 
 
+// categories of the patch data recorded on each level
+#define MEM_FLU         0  // fluid[]
+#define MEM_MAG         1  // magnetic[]
+#define MEM_POT         2  // pot[] and pot_ext[]
+#define MEM_FLUX        3  // flux[] and flux_tmp[]
+#define MEM_ELE         4  // electric[], electric_tmp[], and electric_bitrep[]
+#define MEM_MISC        5  // patch_t objects, de_status[], rho_ext[], ParList[], and the patch pointer table
+#define MEM_POOL        6  // everything held by the inactive patches kept for OPT__REUSE_MEMORY
+#define NMEM_PATCH      7
+
+// categories of the data not associated with any level
+#define MEM_PAR         0  // particle repository
+#define MEM_MPI         1  // MPI buffers of LB_GetBufferData()
+#define MEM_SOL         2  // arrays of the CPU solvers
+#define NMEM_OTHER      3
+
+// additional elements per level in the buffer reduced over all ranks
+#define MEM_LV_TOTAL    ( NMEM_PATCH + 0 )   // sum of all categories
+#define MEM_LV_NPATCH   ( NMEM_PATCH + 1 )   // number of active patches
+#define MEM_LV_NPOOL    ( NMEM_PATCH + 2 )   // number of inactive patches
+#define MEM_LV_NTABLE   ( NMEM_PATCH + 3 )   // capacity of the patch pointer table
+#define NMEM_LV         ( NMEM_PATCH + 4 )
+
+static void GetMemInfo_Detail( const double Resident );
+static void GetMemInfo_Patch( const patch_t *Patch, double Mem[] );
+
+// memory consumption of the solver arrays in bytes (set by Aux_GetMemInfo_AddSolver())
+static long MemInfo_Solver  = 0;
+static long MemInfo_Tracked = 0;
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -10,7 +41,10 @@
 // Note        :  1. This function will record the following information from the file "/proc/[pid]/status"
 //                   (1) VmSize : current virtual memory size
 //                   (2) VmRSS  : current resident set size
-//                2. Only the maximum values among all MPI ranks will be recorded
+//                2. Only the maximum values and the sums over all MPI ranks will be recorded
+//                3. Also record the memory consumption of individual subsystems in the file "Record__MemInfo_Detail"
+//                   --> See GetMemInfo_Detail()
+//                   --> Total tracked memory is appended to "Record__MemInfo" so that it can be compared with VmRSS
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -25,7 +59,7 @@ void Aux_GetMemInfo()
    char   FileName_Status[StrSize], Useless[2][StrSize], *line=NULL;
    char   VmSize[StrSize], VmRSS[StrSize];
    bool   GetVmSize=false, GetVmRSS=false;
-   double Vm_double[2], Vm_max[2], Vm_sum[2];
+   double Vm_double[3], Vm_max[3], Vm_sum[3];
    size_t len=0;
 
 
@@ -68,15 +102,21 @@ void Aux_GetMemInfo()
    if ( line != NULL )  free( line );
 
 
-// 2. gather information from all ranks
+// 2. record the memory consumption of individual subsystems
+// --> must be invoked by all ranks
+   GetMemInfo_Detail( atof(VmRSS)*1024.0 );
+
+
+// 3. gather information from all ranks
    Vm_double[0] = atof( VmSize );
    Vm_double[1] = atof( VmRSS  );
+   Vm_double[2] = MemInfo_Tracked/1024.0;
 
-   MPI_Reduce( Vm_double, Vm_max, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
-   MPI_Reduce( Vm_double, Vm_sum, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Vm_double, Vm_max, 3, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Vm_double, Vm_sum, 3, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
 
-// 3. record memory information
+// 4. record memory information
    if ( MPI_Rank == 0 )
    {
       if ( FirstTime )
@@ -87,14 +127,15 @@ void Aux_GetMemInfo()
          FirstTime = false;
 
          FILE *File_Record = fopen( FileName_Record, "a" );
-         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s\n", "Time", "Step", " ", "Virtual_Max (MB)",
-                  "Virtual_Sum (MB)", "Resident_Max (MB)", "Resident_Sum (MB)" );
+         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s\n", "Time", "Step", " ", "Virtual_Max (MB)",
+                  "Virtual_Sum (MB)", "Resident_Max (MB)", "Resident_Sum (MB)", "Tracked_Max (MB)", "Tracked_Sum (MB)" );
          fclose( File_Record );
       }
 
       FILE *File_Record = fopen( FileName_Record, "a" );
-      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f\n",
-               Time[0], Step, Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0, Vm_sum[1]/1024.0 );
+      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f\n",
+               Time[0], Step, Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0, Vm_sum[1]/1024.0,
+               Vm_max[2]/1024.0, Vm_sum[2]/1024.0 );
       fclose( File_Record );
 
    } // if ( MPI_Rank == 0 )
@@ -102,3 +143,252 @@ void Aux_GetMemInfo()
 } // FUNCTION : Aux_GetMemInfo
 
 
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_GetMemInfo_AddSolver
+// Description :  Add the memory consumption of the solver arrays recorded by Aux_GetMemInfo()
+//
+// Note        :  1. Invoked by Init_MemAllocate_XXX()
+//                2. These arrays are allocated once and have fixed sizes, so the allocation routines simply
+//                   report their total size here
+//                3. The host and device arrays of the GPU solvers (i.e., CUAPI_MemAllocate_XXX()) are not recorded
+//
+// Parameter   :  Size : Number of bytes allocated
+//-------------------------------------------------------------------------------------------------------
+void Aux_GetMemInfo_AddSolver( const long Size )
+{
+
+   MemInfo_Solver += Size;
+
+} // FUNCTION : Aux_GetMemInfo_AddSolver
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMemInfo_Detail
+// Description :  Record the memory consumption of individual subsystems in the file "Record__MemInfo_Detail"
+//
+// Note        :  1. Invoked by Aux_GetMemInfo()
+//                2. Memory is accounted for by walking through the data structures instead of wrapping all
+//                   allocations, so the allocation routines of patches and particles are untouched
+//                   --> Patch data are summed over all real and buffer patches on each level, including the
+//                       inactive patches kept for OPT__REUSE_MEMORY (recorded separately as "Pool")
+//                   --> Also record the particle repository, the MPI buffers of LB_GetBufferData(), and the
+//                       arrays of the CPU solvers (see Aux_GetMemInfo_AddSolver())
+//                   --> Temporary arrays allocated within individual routines are not included
+//                3. Patch data on each level are the maximum values among all ranks, except that the column
+//                   "Total_Sum" is the sum over all ranks
+//                4. "NTable_Max" is the maximum capacity of the patch pointer table (see PatchTable.h) on a single
+//                   rank, which is the number of active and inactive patches rounded up to a multiple of
+//                   PATCH_TABLE_CHUNK_SIZE
+//                5. Also set MemInfo_Tracked to the total tracked memory of this rank
+//
+// Parameter   :  Resident : Resident set size of this rank in bytes
+//-------------------------------------------------------------------------------------------------------
+void GetMemInfo_Detail( const double Resident )
+{
+
+   const char   FileName_Detail[] = "Record__MemInfo_Detail";
+   const double MB                = 1024.0*1024.0;
+   const int    Idx_Other         = NLEVEL*NMEM_LV;          // start of the data not associated with any level
+   const int    Idx_Patch         = Idx_Other + NMEM_OTHER;  // patch data on all levels
+   const int    Idx_Total         = Idx_Patch + 1;           // total tracked memory
+   const int    Idx_Resident      = Idx_Total + 1;           // resident set size
+   const int    NBuf              = Idx_Resident + 1;
+
+   static bool FirstTime = true;
+
+   double *Buf_Local = new double [NBuf];
+   double *Buf_Max   = new double [NBuf];
+   double *Buf_Sum   = new double [NBuf];
+   double *Total_All = new double [MPI_NRank];
+   double  Mem_Pool[NMEM_PATCH];
+
+   for (int t=0; t<NBuf; t++)    Buf_Local[t] = 0.0;
+
+
+// 1. patch data on each level
+// --> inactive patches are always located right after the active ones (see AMR_t::pnew())
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      double *Mem_Lv = Buf_Local + lv*NMEM_LV;
+
+      for (int PID=0; PID<amr->patch[0][lv].Capacity(); PID++)
+      {
+         if ( amr->patch[0][lv][PID] == NULL )  break;
+
+         if ( PID < amr->num[lv] )
+         {
+            for (int Sg=0; Sg<2; Sg++)    GetMemInfo_Patch( amr->patch[Sg][lv][PID], Mem_Lv );
+
+            Mem_Lv[MEM_LV_NPATCH] ++;
+         }
+
+         else
+         {
+            for (int v=0; v<NMEM_PATCH; v++)    Mem_Pool[v] = 0.0;
+
+            for (int Sg=0; Sg<2; Sg++)    GetMemInfo_Patch( amr->patch[Sg][lv][PID], Mem_Pool );
+
+            for (int v=0; v<NMEM_PATCH; v++)    Mem_Lv[MEM_POOL] += Mem_Pool[v];
+
+            Mem_Lv[MEM_LV_NPOOL ] ++;
+         }
+      } // for (int PID=0; PID<amr->patch[0][lv].Capacity(); PID++)
+
+      Mem_Lv[MEM_LV_NTABLE]  = amr->patch[0][lv].Capacity();
+      Mem_Lv[MEM_MISC     ] += (double)( amr->patch[0][lv].Capacity() + amr->patch[1][lv].Capacity() )*sizeof(patch_t*);
+
+      for (int v=0; v<NMEM_PATCH; v++)    Mem_Lv[MEM_LV_TOTAL] += Mem_Lv[v];
+
+      Buf_Local[Idx_Patch] += Mem_Lv[MEM_LV_TOTAL];
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 2. data not associated with any level
+   double *Mem_Other = Buf_Local + Idx_Other;
+
+#  ifdef PARTICLE
+   Mem_Other[MEM_PAR] = (double)amr->Par->ParListSize*PAR_NATT_TOTAL*sizeof(real)
+                      + (double)amr->Par->InactiveParListSize*sizeof(long);
+#  endif
+#  ifdef LOAD_BALANCE
+   Mem_Other[MEM_MPI] = LB_GetBufferData_MemSize();
+#  endif
+   Mem_Other[MEM_SOL] = MemInfo_Solver;
+
+   Buf_Local[Idx_Total] = Buf_Local[Idx_Patch];
+
+   for (int v=0; v<NMEM_OTHER; v++)    Buf_Local[Idx_Total] += Mem_Other[v];
+
+   Buf_Local[Idx_Resident] = Resident;
+
+   MemInfo_Tracked = (long)Buf_Local[Idx_Total];
+
+
+// 3. gather information from all ranks
+   MPI_Reduce( Buf_Local, Buf_Max, NBuf, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Buf_Local, Buf_Sum, NBuf, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Gather( Buf_Local+Idx_Total, 1, MPI_DOUBLE, Total_All, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+
+// 4. record memory information
+   if ( MPI_Rank == 0 )
+   {
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName_Detail) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName_Detail );
+
+         FirstTime = false;
+      }
+
+      int MaxRank = 0;
+      for (int r=1; r<MPI_NRank; r++)
+         if ( Total_All[r] > Total_All[MaxRank] )  MaxRank = r;
+
+      FILE *File_Detail = fopen( FileName_Detail, "a" );
+
+      fprintf( File_Detail, "Time %13.7e, Step %8ld, unit = MB, Max/Sum = maximum/sum over all ranks\n", Time[0], Step );
+      fprintf( File_Detail, "--------------------------------------------------------------------------------------" );
+      fprintf( File_Detail, "-----------------------------------------------------\n" );
+      fprintf( File_Detail, "%3s%11s%11s%13s%10s%10s%10s%10s%10s%10s%10s%12s%12s\n",
+               "Lv", "NPatch_Max", "NPool_Max", "NTable_Max", "Fluid", "Magnetic", "Pot", "Flux", "Electric", "Misc",
+               "Pool", "Total_Max", "Total_Sum" );
+
+      for (int lv=0; lv<=MAX_LEVEL; lv++)
+      {
+         const double *Max_Lv = Buf_Max + lv*NMEM_LV;
+         const double *Sum_Lv = Buf_Sum + lv*NMEM_LV;
+
+         fprintf( File_Detail, "%3d%11d%11d%13d", lv, (int)Max_Lv[MEM_LV_NPATCH], (int)Max_Lv[MEM_LV_NPOOL],
+                  (int)Max_Lv[MEM_LV_NTABLE] );
+         for (int v=0; v<NMEM_PATCH; v++)    fprintf( File_Detail, "%10.2f", Max_Lv[v]/MB );
+         fprintf( File_Detail, "%12.2f%12.2f\n", Max_Lv[MEM_LV_TOTAL]/MB, Sum_Lv[MEM_LV_TOTAL]/MB );
+      }
+
+      const char *Label_Other[NMEM_OTHER] = { "Particle repository", "LB_GetBufferData buffers",
+                                              "Solver arrays (CPU)" };
+
+      fprintf( File_Detail, "\n%-38s%12s%12s\n", "Category", "Max", "Sum" );
+      fprintf( File_Detail, "%-38s%12.2f%12.2f\n", "Patch data (all levels)", Buf_Max[Idx_Patch]/MB, Buf_Sum[Idx_Patch]/MB );
+      for (int v=0; v<NMEM_OTHER; v++)
+      fprintf( File_Detail, "%-38s%12.2f%12.2f\n", Label_Other[v], Buf_Max[Idx_Other+v]/MB, Buf_Sum[Idx_Other+v]/MB );
+      fprintf( File_Detail, "%-26s(rank %5d)%12.2f%12.2f\n", "Tracked total", MaxRank,
+               Buf_Max[Idx_Total]/MB, Buf_Sum[Idx_Total]/MB );
+      fprintf( File_Detail, "%-38s%12.2f%12.2f\n", "Resident set size", Buf_Max[Idx_Resident]/MB, Buf_Sum[Idx_Resident]/MB );
+      fprintf( File_Detail, "--------------------------------------------------------------------------------------" );
+      fprintf( File_Detail, "-----------------------------------------------------\n\n\n" );
+
+      fclose( File_Detail );
+   } // if ( MPI_Rank == 0 )
+
+
+   delete [] Buf_Local;
+   delete [] Buf_Max;
+   delete [] Buf_Sum;
+   delete [] Total_All;
+
+} // FUNCTION : GetMemInfo_Detail
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMemInfo_Patch
+// Description :  Add the memory consumption of a single patch to the target array
+//
+// Note        :  1. Invoked by GetMemInfo_Detail()
+//                2. Array sizes must be consistent with the allocation routines in Patch.h
+//
+// Parameter   :  Patch : Target patch
+//                Mem   : Array to be updated, which is indexed by MEM_FLU, MEM_MAG, ...
+//-------------------------------------------------------------------------------------------------------
+void GetMemInfo_Patch( const patch_t *Patch, double Mem[] )
+{
+
+   Mem[MEM_MISC] += sizeof(patch_t);
+
+   if ( Patch->fluid != NULL )         Mem[MEM_FLU ] += sizeof(real)*NCOMP_TOTAL*CUBE(PS1);
+
+#  ifdef MHD
+   if ( Patch->magnetic != NULL )      Mem[MEM_MAG ] += sizeof(real)*NCOMP_MAG*PS1P1*SQR(PS1);
+#  endif
+
+#  ifdef GRAVITY
+   if ( Patch->pot != NULL )           Mem[MEM_POT ] += sizeof(real)*CUBE(PS1);
+#  ifdef STORE_POT_GHOST
+   if ( Patch->pot_ext != NULL )       Mem[MEM_POT ] += sizeof(real)*CUBE(GRA_NXT);
+#  endif
+#  endif
+
+#  ifdef DUAL_ENERGY
+   if ( Patch->de_status != NULL )     Mem[MEM_MISC] += sizeof(char)*CUBE(PS1);
+#  endif
+
+#  ifdef PARTICLE
+   if ( Patch->rho_ext != NULL )       Mem[MEM_MISC] += sizeof(real)*CUBE(RHOEXT_NXT);
+   if ( Patch->ParList != NULL )       Mem[MEM_MISC] += sizeof(long)*Patch->ParListSize;
+#  endif
+
+   for (int s=0; s<6; s++)
+   {
+      if ( Patch->flux       [s] != NULL )   Mem[MEM_FLUX] += sizeof(real)*NFLUX_TOTAL*SQR(PS1);
+      if ( Patch->flux_tmp   [s] != NULL )   Mem[MEM_FLUX] += sizeof(real)*NFLUX_TOTAL*SQR(PS1);
+   }
+
+#  ifdef MHD
+   for (int s=0; s<18; s++)
+   {
+      const int Size = ( s < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+
+      if ( Patch->electric       [s] != NULL )  Mem[MEM_ELE ] += sizeof(real)*Size;
+      if ( Patch->electric_tmp   [s] != NULL )  Mem[MEM_ELE ] += sizeof(real)*Size;
+#     ifdef BIT_REP_ELECTRIC
+      if ( Patch->electric_bitrep[s] != NULL )  Mem[MEM_ELE ] += sizeof(real)*Size;
+#     endif
+   }
+#  endif
+
+} // FUNCTION : GetMemInfo_Patch
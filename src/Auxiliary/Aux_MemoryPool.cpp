@@ -0,0 +1,136 @@
+#include "GAMER.h"
+
+// high-water mark of the number of patches at each level in this rank for OPT__MEMORY_POOL == 2
+// --> also set by Init_MemoryPool() when loading the table "Record__MemoryPool"
+int MemoryPool_HighWater[NLEVEL];
+
+// minimum fraction of the number of patches at each level kept as inactive patches in the pool
+#define MEMORY_POOL_HEADROOM     0.25
+
+static int GetNAllocated( const int lv );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_MemoryPool_Grow
+// Description :  Update the high-water mark of the number of patches at each level and add inactive patches to
+//                the memory pool if it is running out
+//
+// Note        :  1. Invoked by main() after each root-level step for OPT__MEMORY_POOL == 2
+//                   --> Patches are thus allocated in large chunks outside Refine() and LB_Refine() so that
+//                       the memory allocation rarely shows up in the timing of refinement
+//                2. Headroom = MEMORY_POOL_HEADROOM*(the current number of patches) rounded up to a multiple of
+//                   patch group
+//                   --> Grow the pool only if the number of inactive patches drops below half of the headroom
+//                       so that patches are added in chunks of at least 1/8 of the current number of patches
+//                   --> Levels without any patch are skipped and will be allocated by Refine() for the first time
+//                3. Inactive patches are allocated by amr->pnew() and then deactivated by amr->pdelete() in the
+//                   same way as Init_MemoryPool()
+//                4. Each rank works independently
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_MemoryPool_Grow()
+{
+
+   const bool WithFluData_Yes = true;
+   const bool WithMagData_Yes = true;
+   const bool WithPotData_Yes = true;
+   const bool ReuseMemory_Yes = true;
+
+   for (int lv=0; lv<=MAX_LEVEL; lv++)
+   {
+      const int NActive = amr->num[lv];
+
+      MemoryPool_HighWater[lv] = MAX( MemoryPool_HighWater[lv], NActive );
+
+      if ( NActive == 0 )  continue;
+
+      const int NAlloc   = GetNAllocated( lv );
+      const int Headroom = ( (int)ceil( MEMORY_POOL_HEADROOM*NActive ) + 7 )/8*8;
+
+      if ( NAlloc-NActive >= Headroom/2 )    continue;
+
+      const int NTarget = (int)MIN( (long)MAX( MemoryPool_HighWater[lv], NActive ) + Headroom, (long)__INT_MAX__ );
+
+      if ( NTarget <= NAlloc )   continue;
+
+//    allocate new patches after all allocated patches and then deactivate them
+//    --> temporarily reset amr->num[lv] since pnew() and pdelete() always work on the last patch
+      amr->num[lv] = NAlloc;
+
+      for (int PID=NAlloc; PID<NTarget; PID++)
+         amr->pnew( lv, 0, 0, 0, NULL_INT, WithFluData_Yes, WithMagData_Yes, WithPotData_Yes );
+
+      for (int PID=NAlloc; PID<NTarget; PID++)
+         amr->pdelete( lv, PID, ReuseMemory_Yes );
+
+      amr->num[lv] = NActive;
+   } // for (int lv=0; lv<=MAX_LEVEL; lv++)
+
+} // FUNCTION : Aux_MemoryPool_Grow
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_MemoryPool
+// Description :  Record the high-water mark of the number of patches per rank at each level in the file
+//                "Record__MemoryPool"
+//
+// Note        :  1. Invoked by Output_DumpData() whenever the simulation data are dumped for OPT__MEMORY_POOL == 2
+//                   --> Init_MemoryPool() loads this table when restarting from these data to preallocate the pool
+//                2. Same format as "Input__MemoryPool" so that it can be used for OPT__MEMORY_POOL == 1 as well
+//                3. Record the maximum over all ranks and the number of ranks, which is used to rescale the numbers
+//                   when restarting with a different number of ranks
+//                4. The file is overwritten each time
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_MemoryPool()
+{
+
+   const char FileName[] = "Record__MemoryPool";
+
+   int HighWater_Max[NLEVEL];
+
+   for (int lv=0; lv<NLEVEL; lv++)  MemoryPool_HighWater[lv] = MAX( MemoryPool_HighWater[lv], amr->num[lv] );
+
+   MPI_Reduce( MemoryPool_HighWater, HighWater_Max, NLEVEL, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "w" );
+
+      fprintf( File, "# Level    NPatch      (high-water mark per rank at Step %ld and Time %13.7e; MPI_NRank = %d)\n",
+               Step, Time[0], MPI_NRank );
+
+      for (int lv=0; lv<=MAX_LEVEL; lv++)
+      fprintf( File, "%7d%10d\n", lv, HighWater_Max[lv] );
+
+      fclose( File );
+   }
+
+} // FUNCTION : Aux_Record_MemoryPool
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetNAllocated
+// Description :  Return the number of allocated (i.e., both active and inactive) patches at the target level
+//
+// Note        :  Inactive patches kept for OPT__REUSE_MEMORY are stored right after the active patches
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+int GetNAllocated( const int lv )
+{
+
+   int NAlloc = amr->num[lv];
+
+   while ( NAlloc < amr->patch[0][lv].Capacity()  &&  amr->patch[0][lv][NAlloc] != NULL )   NAlloc ++;
+
+   return NAlloc;
+
+} // FUNCTION : GetNAllocated
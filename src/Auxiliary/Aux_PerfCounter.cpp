@@ -0,0 +1,339 @@
+#include "GAMER.h"
+
+#ifdef TIMING_SOLVER
+
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <sys/ioctl.h>
+#endif
+
+
+
+// hardware events recorded by OPT__TIMING_COUNTER
+// --> the first event is the group leader
+#define PERF_NEVENT        3
+#define PERF_CYCLE         0
+#define PERF_INSTR         1
+#define PERF_LLC_MISS      2
+
+// number of bytes transferred from DRAM per last-level cache miss
+#define PERF_LINE_SIZE     64
+
+static const char *PerfStepName[3] = { "Pre", "Sol", "Clo" };
+static const char *PerfSolverName[NSOLVER] = { "Flu", "Poi", "Gra", "PoiGra", "Che", "dtFlu", "dtGra" };
+
+static bool ReadCount( long Count[] );
+
+// file descriptors of the event groups of all OpenMP threads
+static int  Perf_NThread = 0;
+static int *Perf_FD      = NULL;     // [Perf_NThread][PERF_NEVENT]
+
+// counts and wall-clock time (in nanoseconds) at the latest Aux_PerfCounter_Start()
+static long Perf_Count0[PERF_NEVENT];
+static long Perf_Time0;
+
+// accumulated counts and wall-clock time of each solver and step
+static long Perf_Count[NSOLVER][3][PERF_NEVENT];
+static long Perf_Time [NSOLVER][3];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Init
+// Description :  Open the hardware performance counters of all OpenMP threads
+//
+// Note        :  1. Work with the runtime option "OPT__TIMING_COUNTER", which requires TIMING_SOLVER
+//                2. Use the Linux perf_event interface so that no external library (e.g., PAPI) is required
+//                   --> Only count the user-space events of this process so that it works with the default
+//                       /proc/sys/kernel/perf_event_paranoid = 2
+//                3. Each OpenMP thread opens its own event group since the counters of a thread opened by
+//                   perf_event_open() do not include other threads that already exist
+//                4. OPT__TIMING_COUNTER is disabled with a warning if the counters are not available
+//                   (e.g., non-Linux systems, virtual machines without PMU, or restricted perf_event_paranoid)
+//                5. Invoked by Aux_CreateTimer()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Init()
+{
+
+   if ( !OPT__TIMING_COUNTER )   return;
+
+#  ifdef __linux__
+   const ulong Config[PERF_NEVENT] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES };
+
+   Perf_NThread = OMP_NTHREAD;
+   Perf_FD = new int [ Perf_NThread*PERF_NEVENT ];
+
+   for (int t=0; t<Perf_NThread*PERF_NEVENT; t++)  Perf_FD[t] = -1;
+
+   int NFail = 0;
+
+#  pragma omp parallel num_threads( Perf_NThread ) reduction( +:NFail )
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+      int *FD = Perf_FD + TID*PERF_NEVENT;
+
+      for (int e=0; e<PERF_NEVENT; e++)
+      {
+         perf_event_attr Attr;
+
+         memset( &Attr, 0, sizeof(Attr) );
+         Attr.size           = sizeof(Attr);
+         Attr.type           = PERF_TYPE_HARDWARE;
+         Attr.config         = Config[e];
+         Attr.read_format    = PERF_FORMAT_GROUP;
+         Attr.disabled       = ( e == 0 ) ? 1 : 0;
+         Attr.exclude_kernel = 1;
+         Attr.exclude_hv     = 1;
+
+//       pid = 0 and cpu = -1: the calling thread on any CPU
+         FD[e] = syscall( __NR_perf_event_open, &Attr, 0, -1, ( e == 0 ) ? -1 : FD[0], 0 );
+
+         if ( FD[e] < 0 )
+         {
+            NFail ++;
+            break;
+         }
+      }
+
+      if ( FD[0] >= 0 )
+      {
+         ioctl( FD[0], PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP );
+         ioctl( FD[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+      }
+   } // OpenMP parallel region
+
+   if ( NFail > 0 )
+   {
+      Aux_Message( stderr, "WARNING : perf_event_open() failed on rank %d --> disable \"%s\" !!\n",
+                   MPI_Rank, "OPT__TIMING_COUNTER" );
+      OPT__TIMING_COUNTER = false;
+   }
+
+#  else
+   Aux_Message( stderr, "WARNING : \"%s\" is only supported on Linux --> disabled !!\n", "OPT__TIMING_COUNTER" );
+   OPT__TIMING_COUNTER = false;
+#  endif // #ifdef __linux__ ... else ...
+
+// all ranks must agree on whether the counters are enabled since Aux_PerfCounter_Record() is collective
+   int Enabled_ThisRank = OPT__TIMING_COUNTER, Enabled_AllRank;
+
+   MPI_Allreduce( &Enabled_ThisRank, &Enabled_AllRank, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+
+   if ( !Enabled_AllRank )
+   {
+      Aux_PerfCounter_End();
+      OPT__TIMING_COUNTER = false;
+   }
+
+   Aux_PerfCounter_Reset();
+
+} // FUNCTION : Aux_PerfCounter_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_End
+// Description :  Close the hardware performance counters
+//
+// Note        :  Invoked by Aux_DeleteTimer()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_End()
+{
+
+   if ( Perf_FD == NULL )  return;
+
+#  ifdef __linux__
+   for (int t=0; t<Perf_NThread*PERF_NEVENT; t++)
+      if ( Perf_FD[t] >= 0 )  close( Perf_FD[t] );
+#  endif
+
+   delete [] Perf_FD;
+   Perf_FD      = NULL;
+   Perf_NThread = 0;
+
+} // FUNCTION : Aux_PerfCounter_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Reset
+// Description :  Reset the accumulated counts
+//
+// Note        :  Invoked by Aux_ResetTimer()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Reset()
+{
+
+   for (int v=0; v<NSOLVER; v++)
+   for (int s=0; s<3; s++)
+   {
+      for (int e=0; e<PERF_NEVENT; e++)   Perf_Count[v][s][e] = 0;
+
+      Perf_Time[v][s] = 0;
+   }
+
+} // FUNCTION : Aux_PerfCounter_Reset
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Start
+// Description :  Record the current counts of all threads
+//
+// Note        :  1. Must be invoked outside OpenMP parallel regions
+//                2. Invoked by InvokeSolver() before the preparation, solver, and closing steps
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Start()
+{
+
+   if ( !OPT__TIMING_COUNTER )   return;
+
+   ReadCount( Perf_Count0 );
+   Perf_Time0 = ThreadTimer_t::GetNanoSec();
+
+} // FUNCTION : Aux_PerfCounter_Start
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Stop
+// Description :  Accumulate the counts since the last Aux_PerfCounter_Start() to the target solver and step
+//
+// Note        :  1. Must be invoked outside OpenMP parallel regions
+//                2. Invoked by InvokeSolver() after the preparation, solver, and closing steps
+//
+// Parameter   :  TSolver : Target solver
+//                TStep   : Target step (0/1/2 <--> preparation/solver/closing)
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Stop( const Solver_t TSolver, const int TStep )
+{
+
+   if ( !OPT__TIMING_COUNTER )   return;
+
+   long Count1[PERF_NEVENT];
+
+   if ( ReadCount(Count1) )
+   {
+      for (int e=0; e<PERF_NEVENT; e++)   Perf_Count[TSolver][TStep][e] += Count1[e] - Perf_Count0[e];
+
+      Perf_Time[TSolver][TStep] += ThreadTimer_t::GetNanoSec() - Perf_Time0;
+   }
+
+} // FUNCTION : Aux_PerfCounter_Stop
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Record
+// Description :  Append the hardware counter results to the timing file
+//
+// Note        :  1. Invoked by Timing__Solver() in Aux_Timing.cpp
+//                2. Counts are summed over all levels, threads, and ranks
+//                3. Derived quantities
+//                   --> IPC       : instructions per cycle
+//                       DRAM_GB   : bytes from DRAM estimated as PERF_LINE_SIZE bytes per last-level cache miss
+//                                   --> A lower bound since hardware prefetches are not included
+//                       BW_GB/s   : DRAM_GB divided by the maximum wall-clock time among all ranks
+//                       Instr/B   : instructions per DRAM byte, a proxy of the arithmetic intensity since
+//                                   no portable floating-point event is available
+//                   --> A low Instr/B together with a BW_GB/s close to the STREAM bandwidth of the node
+//                       suggests a bandwidth-bound step
+//
+// Parameter   :  FileName : Name of the output file
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Record( const char FileName[] )
+{
+
+   if ( !OPT__TIMING_COUNTER )   return;
+
+   long Count_Sum[NSOLVER][3][PERF_NEVENT], Time_Max[NSOLVER][3];
+
+   MPI_Reduce( Perf_Count[0][0], Count_Sum[0][0], NSOLVER*3*PERF_NEVENT, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Perf_Time [0],    Time_Max [0],    NSOLVER*3,             MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "Hardware counters of the GPU/CPU solvers (user space, sum over all levels/threads/ranks)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%8s%6s%10s%12s%12s%8s%12s%10s%10s%10s\n",
+               "Solver", "Step", "Time", "Cycle", "Instr", "IPC", "LLC_Miss", "DRAM_GB", "BW_GB/s", "Instr/B" );
+
+      for (int v=0; v<NSOLVER; v++)
+      for (int s=0; s<3; s++)
+      {
+         const long  *C     = Count_Sum[v][s];
+         const double Time  = Time_Max[v][s]*1.0e-9;
+         const double Byte  = (double)C[PERF_LLC_MISS]*PERF_LINE_SIZE;
+
+         if ( C[PERF_CYCLE] == 0 )  continue;
+
+         fprintf( File, "%8s%6s%10.4f%12.4e%12.4e%8.3f%12.4e%10.4f%10.4f%10.4f\n",
+                  PerfSolverName[v], PerfStepName[s], Time, (double)C[PERF_CYCLE], (double)C[PERF_INSTR],
+                  (double)C[PERF_INSTR]/C[PERF_CYCLE], (double)C[PERF_LLC_MISS], Byte*1.0e-9,
+                  ( Time > 0.0 ) ? Byte*1.0e-9/Time : 0.0,
+                  ( Byte > 0.0 ) ? C[PERF_INSTR]/Byte : 0.0 );
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Aux_PerfCounter_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadCount
+// Description :  Read the counts summed over all threads
+//
+// Parameter   :  Count : Array to store the counts
+//
+// Return      :  true/false <--> success/failure
+//-------------------------------------------------------------------------------------------------------
+bool ReadCount( long Count[] )
+{
+
+   for (int e=0; e<PERF_NEVENT; e++)   Count[e] = 0;
+
+#  ifdef __linux__
+// PERF_FORMAT_GROUP: { nr, value[nr] }
+   long Buf[ 1 + PERF_NEVENT ];
+
+   for (int t=0; t<Perf_NThread; t++)
+   {
+      const int FD = Perf_FD[ t*PERF_NEVENT ];
+
+      if ( read( FD, Buf, sizeof(Buf) ) != (ssize_t)sizeof(Buf)  ||  Buf[0] != PERF_NEVENT )   return false;
+
+      for (int e=0; e<PERF_NEVENT; e++)   Count[e] += Buf[ 1 + e ];
+   }
+
+   return true;
+
+#  else
+   return false;
+#  endif
+
+} // FUNCTION : ReadCount
+
+
+
+#endif // #ifdef TIMING_SOLVER
@@ -0,0 +1,129 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_Conservation
+// Description :  Record the total conserved variables tracked incrementally from the budgets accumulated
+//                during the evolution
+//
+// Note        :  1. Invoked by main() for OPT__RECORD_CONSERVATION
+//                2. Budgets of each rank are accumulated in Cons_Bnd[] and Cons_Src[]
+//                   --> Cons_Bnd[]: fluxes across the non-periodic simulation boundaries (see Flu_Close())
+//                       Cons_Src[]: source terms (e.g., gas converted to stars in SF_CreateStar_AGORA())
+//                   --> Both are cumulative since the beginning of this run
+//                3. The reference values are measured by summing over all leaf cells only once during the first
+//                   function call, after which recording only requires reducing 2*NCOMP_TOTAL values over all ranks
+//                   --> Much cheaper than OPT__CK_CONSERVATION, which is recommended for verifying the results
+//                       occasionally
+//                4. Only the variables updated by the fluid fluxes are tracked
+//                   --> Source terms not recorded in Cons_Src[] (e.g., gravity and cooling for energy and momentum)
+//                       are not included
+//                5. Sub-steps repeated by AUTO_REDUCE_DT are counted more than once
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_Conservation()
+{
+
+   const char FileName[] = "Record__ConservationBudget";
+   static bool   FirstTime = true;
+   static double Ref[NCOMP_TOTAL];
+
+// [0 ... NCOMP_TOTAL-1] / [NCOMP_TOTAL ... 2*NCOMP_TOTAL-1] = boundary fluxes / source terms
+   double Budget_ThisRank[2*NCOMP_TOTAL], Budget_AllRank[2*NCOMP_TOTAL];
+   FILE  *File = NULL;
+
+
+// collect the budgets from all ranks
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      Budget_ThisRank[              v] = Cons_Bnd[v];
+      Budget_ThisRank[NCOMP_TOTAL + v] = Cons_Src[v];
+   }
+
+   MPI_Reduce( Budget_ThisRank, Budget_AllRank, 2*NCOMP_TOTAL, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// set the reference values and write the header
+   if ( FirstTime )
+   {
+      double Sum_ThisRank[NCOMP_TOTAL], Sum_AllRank[NCOMP_TOTAL];
+
+      for (int v=0; v<NCOMP_TOTAL; v++)   Sum_ThisRank[v] = 0.0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const double dv    = CUBE( amr->dh[lv] );
+         const int    FluSg = amr->FluSg[lv];
+
+         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         {
+            if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               double Sum = 0.0;
+
+               for (int k=0; k<PS1; k++)
+               for (int j=0; j<PS1; j++)
+               for (int i=0; i<PS1; i++)
+                  Sum += amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
+
+               Sum_ThisRank[v] += Sum*dv;
+            }
+         }
+      }
+
+      MPI_Reduce( Sum_ThisRank, Sum_AllRank, NCOMP_TOTAL, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+      if ( MPI_Rank == 0 )
+      {
+//       exclude the budgets accumulated before this function call so that the reference corresponds to the
+//       beginning of this run
+         for (int v=0; v<NCOMP_TOTAL; v++)
+            Ref[v] = Sum_AllRank[v] - Budget_AllRank[v] - Budget_AllRank[NCOMP_TOTAL+v];
+
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         File = fopen( FileName, "a" );
+
+         fprintf( File, "# Value : reference value + Bnd + Src\n" );
+         fprintf( File, "# Bnd   : accumulated fluxes across the non-periodic simulation boundaries\n" );
+         fprintf( File, "# Src   : accumulated source terms (currently star formation only)\n\n" );
+
+         fprintf( File, "#%13s %9s", "Time", "Step" );
+         for (int v=0; v<NCOMP_TOTAL; v++)
+         fprintf( File, " %14s %10s_Bnd %10s_Src", FieldLabel[v], FieldLabel[v], FieldLabel[v] );
+         fprintf( File, "\n" );
+
+         fclose( File );
+      }
+
+      FirstTime = false;
+   } // if ( FirstTime )
+
+
+// record
+   if ( MPI_Rank == 0 )
+   {
+      File = fopen( FileName, "a" );
+
+      fprintf( File, "%14.7e %9ld", Time[0], Step );
+
+      for (int v=0; v<NCOMP_TOTAL; v++)
+         fprintf( File, " %14.7e %14.7e %14.7e", Ref[v] + Budget_AllRank[v] + Budget_AllRank[NCOMP_TOTAL+v],
+                  Budget_AllRank[v], Budget_AllRank[NCOMP_TOTAL+v] );
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   }
+
+} // FUNCTION : Aux_Record_Conservation
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -0,0 +1,499 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+static void Deposit_Collect( const int lv, const int N[], const bool Interlace, const bool CountOnly,
+                             int *NSeg, int *NVal, long *Seg_Idx, int *Seg_Len, real *Val );
+static void Deposit_Level( const int lv, const int N[], const bool Interlace, const int y_start, const int ny,
+                           const int z_start, const int nz, real *Grid[] );
+static int  GetOwner( const int N[], const int y, const int z );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_LevelPowerSpectrum
+// Description :  Record the density power spectrum at the effective resolution of the target level LEVEL_PS_LV
+//                in "Record__LevelPowerSpectrum"
+//
+// Note        :  1. Enabled by the runtime option "OPT__RECORD_LEVEL_PS", which sets the interval in root-level steps
+//                2. The density is deposited onto a uniform grid of NX0_TOT*2^LEVEL_PS_LV cells
+//                   --> Regions not covered by LEVEL_PS_LV are filled by the coarser leaf patches (i.e., each coarse
+//                       cell is replicated to all target cells it covers)
+//                   --> Particles (if any) are deposited directly onto the same grid by CIC
+//                   --> See Deposit_Level()
+//                3. The forward FFT adopts the pencil decomposition of the base-level Poisson solver (MPI) or
+//                   a temporary rfftwnd plan (SERIAL)
+//                   --> See FFT_Pencil_Forward()
+//                   --> Memory consumption scales with the effective resolution, so LEVEL_PS_LV should be kept small
+//                4. LEVEL_PS_INTERLACE interlaces the particle deposit to suppress the aliasing of CIC
+//                   --> Particles are deposited with half of their mass onto the normal grid and the grid shifted by
+//                       half a target cell in each direction, the latter of which is corrected by the phase factor
+//                       exp(i*k*dh/2) before adding both in the k space
+//                   --> The odd images of the CIC aliasing cancel out
+//                5. Bins and normalization are the same as Output_BasePowerSpectrum() (i.e., modes are rounded to
+//                   the nearest integer wavenumber in units of 2*pi/BoxSize, and the power is normalized by the
+//                   initial average density) so that both spectra agree on the base level
+//                6. Assume a cubic box --> Checked by Aux_Check_Parameter()
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_LevelPowerSpectrum()
+{
+
+   const char FileName[] = "Record__LevelPowerSpectrum";
+   static bool FirstTime = true;
+
+   const int  lv        = LEVEL_PS_LV;
+   const bool Interlace = LEVEL_PS_INTERLACE;
+   const int  NGrid     = ( Interlace ) ? 2 : 1;
+
+   int N[3];
+   for (int d=0; d<3; d++)    N[d] = NX0_TOT[d]*( 1<<lv );
+
+   const int Nxh   = N[0]/2 + 1;
+   const int NxPad = 2*Nxh;
+   const int NBin  = Nxh;
+
+
+// 1. get the x-pencil layout of this rank
+   int y_start, ny, z_start, nz;
+
+#  ifdef SERIAL
+   y_start = 0;
+   ny      = N[1];
+   z_start = 0;
+   nz      = N[2];
+#  else
+   FFT_Pencil_GetLayout( N, MPI_Rank, y_start, ny, z_start, nz );
+#  endif
+
+
+// 2. deposit density onto the uniform grid(s)
+   const long GridSize = (long)nz*ny*NxPad;
+   real *Grid[2] = { NULL, NULL };
+
+   for (int g=0; g<NGrid; g++)
+   {
+      Grid[g] = new real [ GridSize + 1 ];
+      for (long t=0; t<GridSize; t++)  Grid[g][t] = (real)0.0;
+   }
+
+   Deposit_Level( lv, N, Interlace, y_start, ny, z_start, nz, Grid );
+
+
+// 3. forward FFT
+   const fftw_complex *GridK[2] = { NULL, NULL };
+   int kx_start, nkx, ky_start, nky;
+
+#  ifdef SERIAL
+   rfftwnd_plan Plan = rfftw3d_create_plan( N[2], N[1], N[0], FFTW_REAL_TO_COMPLEX, FFTW_ESTIMATE | FFTW_IN_PLACE );
+
+   for (int g=0; g<NGrid; g++)
+   {
+      rfftwnd_one_real_to_complex( Plan, Grid[g], NULL );
+      GridK[g] = (const fftw_complex*)Grid[g];
+   }
+
+   rfftwnd_destroy_plan( Plan );
+
+   kx_start = 0;
+   nkx      = Nxh;
+   ky_start = 0;
+   nky      = N[1];
+
+#  else
+   for (int g=0; g<NGrid; g++)
+   {
+      GridK[g] = FFT_Pencil_Forward( Grid[g], N );
+
+//    the input array is no longer needed
+      delete [] Grid[g];
+      Grid[g] = NULL;
+   }
+
+   FFT_Pencil_GetLayout_K( N, kx_start, nkx, ky_start, nky );
+#  endif
+
+
+// 4. bin the power spectrum on this rank
+   double *PS_local    = new double [NBin];
+   double *PS_total    = new double [NBin];
+   long   *Count_local = new long   [NBin];
+   long   *Count_total = new long   [NBin];
+
+   for (int b=0; b<NBin; b++)
+   {
+      PS_local   [b] = 0.0;
+      Count_local[b] = 0;
+   }
+
+   for (int i=0; i<nkx;  i++)  {  const int kx = kx_start + i;
+   for (int j=0; j<nky;  j++)  {  const int ky = ( ky_start+j <= N[1]/2 ) ? ky_start+j : ky_start+j-N[1];
+   for (int k=0; k<N[2]; k++)  {  const int kz = ( k          <= N[2]/2 ) ? k          : k-N[2];
+
+      const int bin = (int)lround(  sqrt( (double)SQR(kx) + (double)SQR(ky) + (double)SQR(kz) )  );
+
+      if ( bin >= NBin )   continue;
+
+#     ifdef SERIAL
+      const long Idx = ( (long)k*N[1] + j )*Nxh + i;
+#     else
+      const long Idx = ( (long)i*nky + j )*N[2] + k;
+#     endif
+
+      double Re = GridK[0][Idx].re;
+      double Im = GridK[0][Idx].im;
+
+//    add the shifted grid after correcting its phase
+      if ( Interlace )
+      {
+         const double Phase = M_PI*( (double)kx/N[0] + (double)ky/N[1] + (double)kz/N[2] );
+         const double CosP  = cos( Phase );
+         const double SinP  = sin( Phase );
+
+         Re += GridK[1][Idx].re*CosP - GridK[1][Idx].im*SinP;
+         Im += GridK[1][Idx].re*SinP + GridK[1][Idx].im*CosP;
+      }
+
+      PS_local   [bin] += SQR( Re ) + SQR( Im );
+      Count_local[bin] ++;
+   }}} // i,j,k
+
+
+// 5. sum over all ranks and normalize as GetBasePowerSpectrum()
+   MPI_Reduce( PS_local,    PS_total,    NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Count_local, Count_total, NBin, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      const double Coeff = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2]
+                           / SQR( (double)N[0]*(double)N[1]*(double)N[2]*AveDensity_Init );
+
+      for (int b=0; b<NBin; b++)
+         PS_total[b] = ( Count_total[b] > 0 ) ? PS_total[b]*Coeff/(double)Count_total[b] : 0.0;
+   }
+
+
+// 6. record the power spectrum
+// --> one block per record separated by two blank lines (e.g., for the "index" keyword of gnuplot)
+   if ( MPI_Rank == 0 )
+   {
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+      }
+
+      const double WaveK0 = 2.0*M_PI/amr->BoxSize[0];
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "# Time = %14.7e, Step = %ld, Level = %d, N = %d, Interlace = %d\n",
+               Time[0], Step, lv, N[0], Interlace );
+      fprintf( File, "#%12s %13s %13s\n", "k", "Power", "NMode" );
+
+//    DC mode is not recorded
+      for (int b=1; b<NBin; b++)
+         fprintf( File, "%13.6e %13.6e %13ld\n", WaveK0*b, PS_total[b], Count_total[b] );
+
+      fprintf( File, "\n\n" );
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+
+// 7. free memory
+   for (int g=0; g<NGrid; g++)
+   {
+#     ifndef SERIAL
+      delete [] GridK[g];
+#     endif
+      delete [] Grid[g];
+   }
+
+   delete [] PS_local;
+   delete [] PS_total;
+   delete [] Count_local;
+   delete [] Count_total;
+
+} // FUNCTION : Aux_Record_LevelPowerSpectrum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Deposit_Level
+// Description :  Deposit density onto the x-pencil uniform grid(s) at the effective resolution of the target level
+//
+// Note        :  1. Data are sent to the owner rank as contiguous x segments, each of which is described by the
+//                   1D index of its first cell and its length
+//                   --> The index of the shifted grid Grid[1] for Interlace is offset by the total number of cells
+//                2. Received values are accumulated into Grid[]
+//
+// Parameter   :  lv        : Target level
+//                N         : Size of the uniform grid
+//                Interlace : Deposit particles onto the shifted grid Grid[1] as well
+//                y/z_start : Starting y/z coordinates of the x-pencil of this rank
+//                ny/nz     : Number of y/z coordinates of the x-pencil of this rank
+//                Grid      : Uniform grid(s) [z][y][2*(N[0]/2+1)] to be filled
+//-------------------------------------------------------------------------------------------------------
+void Deposit_Level( const int lv, const int N[], const bool Interlace, const int y_start, const int ny,
+                    const int z_start, const int nz, real *Grid[] )
+{
+
+   const long NCell = (long)N[0]*N[1]*N[2];
+   const int  NxPad = 2*( N[0]/2 + 1 );
+
+   int  NSeg_Send[MPI_NRank], NSeg_Recv[MPI_NRank], NVal_Send[MPI_NRank], NVal_Recv[MPI_NRank];
+   int  Seg_Send_Disp[MPI_NRank], Seg_Recv_Disp[MPI_NRank], Val_Send_Disp[MPI_NRank], Val_Recv_Disp[MPI_NRank];
+   long NSeg_Send_Tot=0, NSeg_Recv_Tot=0, NVal_Send_Tot=0, NVal_Recv_Tot=0;
+
+
+// 1. count the number of segments and values sent to each rank
+   Deposit_Collect( lv, N, Interlace, true, NSeg_Send, NVal_Send, NULL, NULL, NULL );
+
+   MPI_Alltoall( NSeg_Send, 1, MPI_INT, NSeg_Recv, 1, MPI_INT, MPI_COMM_WORLD );
+   MPI_Alltoall( NVal_Send, 1, MPI_INT, NVal_Recv, 1, MPI_INT, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Seg_Send_Disp[r] = NSeg_Send_Tot;
+      Seg_Recv_Disp[r] = NSeg_Recv_Tot;
+      Val_Send_Disp[r] = NVal_Send_Tot;
+      Val_Recv_Disp[r] = NVal_Recv_Tot;
+
+      NSeg_Send_Tot += NSeg_Send[r];
+      NSeg_Recv_Tot += NSeg_Recv[r];
+      NVal_Send_Tot += NVal_Send[r];
+      NVal_Recv_Tot += NVal_Recv[r];
+   }
+
+   if ( NVal_Send_Tot > __INT_MAX__  ||  NVal_Recv_Tot > __INT_MAX__ )
+      Aux_Error( ERROR_INFO, "MPI buffer exceeds the maximum integer (send %ld, recv %ld) --> reduce LEVEL_PS_LV or use more MPI ranks !!\n",
+                 NVal_Send_Tot, NVal_Recv_Tot );
+
+
+// 2. fill the send buffers
+   long *SendBuf_Idx = new long [ NSeg_Send_Tot + 1 ];
+   int  *SendBuf_Len = new int  [ NSeg_Send_Tot + 1 ];
+   real *SendBuf_Val = new real [ NVal_Send_Tot + 1 ];
+   long *RecvBuf_Idx = new long [ NSeg_Recv_Tot + 1 ];
+   int  *RecvBuf_Len = new int  [ NSeg_Recv_Tot + 1 ];
+   real *RecvBuf_Val = new real [ NVal_Recv_Tot + 1 ];
+
+// Deposit_Collect() fills each rank from the displacements
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSeg_Send[r] = Seg_Send_Disp[r];
+      NVal_Send[r] = Val_Send_Disp[r];
+   }
+
+   Deposit_Collect( lv, N, Interlace, false, NSeg_Send, NVal_Send, SendBuf_Idx, SendBuf_Len, SendBuf_Val );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSeg_Send[r] -= Seg_Send_Disp[r];
+      NVal_Send[r] -= Val_Send_Disp[r];
+   }
+
+
+// 3. exchange data
+   MPI_Alltoallv( SendBuf_Idx, NSeg_Send, Seg_Send_Disp, MPI_LONG,
+                  RecvBuf_Idx, NSeg_Recv, Seg_Recv_Disp, MPI_LONG,   MPI_COMM_WORLD );
+   MPI_Alltoallv( SendBuf_Len, NSeg_Send, Seg_Send_Disp, MPI_INT,
+                  RecvBuf_Len, NSeg_Recv, Seg_Recv_Disp, MPI_INT,    MPI_COMM_WORLD );
+#  ifdef FLOAT8
+   MPI_Alltoallv( SendBuf_Val, NVal_Send, Val_Send_Disp, MPI_DOUBLE,
+                  RecvBuf_Val, NVal_Recv, Val_Recv_Disp, MPI_DOUBLE, MPI_COMM_WORLD );
+#  else
+   MPI_Alltoallv( SendBuf_Val, NVal_Send, Val_Send_Disp, MPI_FLOAT,
+                  RecvBuf_Val, NVal_Recv, Val_Recv_Disp, MPI_FLOAT,  MPI_COMM_WORLD );
+#  endif
+
+
+// 4. accumulate the received data
+   long v = 0;
+
+   for (long s=0; s<NSeg_Recv_Tot; s++)
+   {
+      const int  g   = RecvBuf_Idx[s] / NCell;
+      const long Idx = RecvBuf_Idx[s] % NCell;
+      const int  x   = Idx % N[0];
+      const int  y   = ( Idx / N[0] ) % N[1];
+      const int  z   = Idx / ( (long)N[0]*N[1] );
+
+#     ifdef GAMER_DEBUG
+      if ( y < y_start  ||  y >= y_start+ny  ||  z < z_start  ||  z >= z_start+nz  ||  x+RecvBuf_Len[s] > N[0] )
+         Aux_Error( ERROR_INFO, "incorrect segment (x %d, y %d, z %d, length %d) !!\n", x, y, z, RecvBuf_Len[s] );
+#     endif
+
+      real *Row = Grid[g] + ( (long)(z-z_start)*ny + (y-y_start) )*NxPad + x;
+
+      for (int i=0; i<RecvBuf_Len[s]; i++)   Row[i] += RecvBuf_Val[ v ++ ];
+   }
+
+
+   delete [] SendBuf_Idx;
+   delete [] SendBuf_Len;
+   delete [] SendBuf_Val;
+   delete [] RecvBuf_Idx;
+   delete [] RecvBuf_Len;
+   delete [] RecvBuf_Val;
+
+} // FUNCTION : Deposit_Level
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Deposit_Collect
+// Description :  Count or fill the segments sent to each rank by Deposit_Level()
+//
+// Note        :  1. Gas: patches on the target level and leaf patches on the coarser levels, which together cover
+//                   the whole domain exactly once
+//                   --> Each cell on level "l" covers 2^(lv-l) target cells along each direction
+//                2. Particles: CIC onto the normal grid, and also onto the grid shifted by -dh/2 for Interlace
+//                   --> Each target cell forms a segment of length one
+//                3. CountOnly : NSeg/NVal return the number of segments/values sent to each rank
+//                   Otherwise : NSeg/NVal must be initialized as the displacements and are advanced while filling
+//
+// Parameter   :  lv        : Target level
+//                N         : Size of the uniform grid
+//                Interlace : Deposit particles onto the shifted grid as well
+//                CountOnly : Only count the number of segments and values
+//                NSeg/NVal : See Note 3
+//                Seg_Idx   : 1D index of the first cell of each segment
+//                Seg_Len   : Length of each segment
+//                Val       : Values of all segments
+//-------------------------------------------------------------------------------------------------------
+void Deposit_Collect( const int lv, const int N[], const bool Interlace, const bool CountOnly,
+                      int *NSeg, int *NVal, long *Seg_Idx, int *Seg_Len, real *Val )
+{
+
+   if ( CountOnly )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSeg[r] = 0;
+      NVal[r] = 0;
+   }
+
+
+// 1. gas
+   for (int l=0; l<=lv; l++)
+   {
+      const int R   = 1 << (lv-l);   // number of target cells per cell along each direction
+      const int Len = PS1*R;
+
+      for (int PID=0; PID<amr->NPatchComma[l][1]; PID++)
+      {
+//       non-leaf patches are covered by the finer levels
+         if ( l < lv  &&  amr->patch[0][l][PID]->son != -1 )   continue;
+
+         const real (*Dens)[PS1][PS1] = amr->patch[ amr->FluSg[l] ][l][PID]->fluid[DENS];
+         int Cr[3];
+
+         for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][l][PID]->corner[d] / amr->scale[l] * R;
+
+         for (int kk=0; kk<Len; kk++)  {  const int z = Cr[2] + kk;  const int k = kk / R;
+         for (int jj=0; jj<Len; jj++)  {  const int y = Cr[1] + jj;  const int j = jj / R;
+
+            const int Owner = GetOwner( N, y, z );
+
+            if ( !CountOnly )
+            {
+               Seg_Idx[ NSeg[Owner] ] = ( (long)z*N[1] + y )*N[0] + Cr[0];
+               Seg_Len[ NSeg[Owner] ] = Len;
+
+               for (int ii=0; ii<Len; ii++)  Val[ NVal[Owner] + ii ] = Dens[k][j][ ii/R ];
+            }
+
+            NSeg[Owner] ++;
+            NVal[Owner] += Len;
+         }} // kk,jj
+      } // for (int PID=0; PID<amr->NPatchComma[l][1]; PID++)
+   } // for (int l=0; l<=lv; l++)
+
+
+// 2. particles
+#  ifdef PARTICLE
+   const long   NCell   = (long)N[0]*N[1]*N[2];
+   const double dh      = amr->dh[lv];
+   const double _dh     = 1.0 / dh;
+   const double _dh3    = CUBE( _dh );
+   const int    NGrid   = ( Interlace ) ? 2 : 1;
+   const double Weight  = ( Interlace ) ? 0.5 : 1.0;
+   const real  *Pos[3]  = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+   const real  *Mass    = amr->Par->Mass;
+
+   int    idxLR[2][3];
+   double dr, Frac[2][3];
+
+   for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)
+   {
+//    skip inactive particles
+      if ( Mass[p] < (real)0.0 )    continue;
+
+      const double ParDens = Weight*Mass[p]*_dh3;
+
+      for (int g=0; g<NGrid; g++)
+      {
+//       the grid "g=1" is shifted by -dh/2 (i.e., the target cells are centered at the cell corners of the normal grid)
+         const double Shift = ( g == 0 ) ? 0.5 : 0.0;
+
+         for (int d=0; d<3; d++)
+         {
+            dr          = ( Pos[d][p] - amr->BoxEdgeL[d] )*_dh - Shift;
+            idxLR[0][d] = (int)floor( dr );
+            dr         -= (double)idxLR[0][d];
+            idxLR[1][d] = idxLR[0][d] + 1;
+
+//          periodicity
+            for (int t=0; t<2; t++)    idxLR[t][d] = ( idxLR[t][d] + N[d] ) % N[d];
+
+            Frac[0][d] = 1.0 - dr;
+            Frac[1][d] =       dr;
+         }
+
+         for (int k=0; k<2; k++)
+         for (int j=0; j<2; j++)
+         {
+            const int Owner = GetOwner( N, idxLR[j][1], idxLR[k][2] );
+
+            for (int i=0; i<2; i++)
+            {
+               if ( !CountOnly )
+               {
+                  Seg_Idx[ NSeg[Owner] ] = g*NCell + ( (long)idxLR[k][2]*N[1] + idxLR[j][1] )*N[0] + idxLR[i][0];
+                  Seg_Len[ NSeg[Owner] ] = 1;
+                  Val    [ NVal[Owner] ] = ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
+               }
+
+               NSeg[Owner] ++;
+               NVal[Owner] ++;
+            }
+         }
+      } // for (int g=0; g<NGrid; g++)
+   } // for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)
+#  endif // #ifdef PARTICLE
+
+} // FUNCTION : Deposit_Collect
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetOwner
+// Description :  Return the MPI rank owning the x row (y,z) of the uniform grid
+//-------------------------------------------------------------------------------------------------------
+int GetOwner( const int N[], const int y, const int z )
+{
+
+#  ifdef SERIAL
+   return 0;
+#  else
+   return FFT_Pencil_GetRank( N, y, z );
+#  endif
+
+} // FUNCTION : GetOwner
+
+
+
+#endif // #ifdef GRAVITY
@@ -0,0 +1,230 @@
+#include "GAMER.h"
+
+#ifdef TIMING
+
+extern Timer_t *Timer_Flu_Advance[NLEVEL];
+
+
+// accumulated number of operations and time (in nanoseconds) of each phase on each level
+static long PatchCost_N   [PATCH_COST_NPHASE][NLEVEL];
+static long PatchCost_Time[PATCH_COST_NPHASE][NLEVEL];
+
+// accumulated number of leaf and coarse-fine boundary patches prepared for the fluid solver on each level
+static long PatchCost_NLeaf[NLEVEL];
+static long PatchCost_NCF  [NLEVEL];
+
+static void ResetCounter();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchCost_Add
+// Description :  Accumulate the number of operations and elapsed time of the target phase
+//
+// Note        :  1. Work with the runtime option "OPT__RECORD_PATCH_COST"
+//                   --> Callers should skip both the timing and this function when the option is off
+//                2. Thread-safe
+//                   --> Time of the phases invoked inside OpenMP parallel regions (i.e., PATCH_COST_INTERP) is
+//                       summed over all threads
+//                3. Phases
+//                   PATCH_COST_FLU_PREPARE : Flu_Prepare()            --> N = number of patches prepared
+//                   PATCH_COST_INTERP      : InterpolateGhostZone()   --> N = number of interpolations
+//                                            (invoked by Prepare_PatchData() for all solvers, attributed to the fine level)
+//                   PATCH_COST_FIXUP_FLUX  : Flu_FixUp_Flux()         --> N = number of coarse patches adjacent to
+//                                                                           the coarse-fine boundaries
+//                   PATCH_COST_RESTRICT    : Flu_FixUp_Restrict()     --> N = number of coarse patches restricted
+//
+// Parameter   :  Phase : Target phase
+//                lv    : Target level
+//                N     : Number of operations
+//                Time  : Elapsed time in nanoseconds
+//-------------------------------------------------------------------------------------------------------
+void Aux_PatchCost_Add( const int Phase, const int lv, const long N, const long Time )
+{
+
+#  pragma omp atomic
+   PatchCost_N   [Phase][lv] += N;
+
+#  pragma omp atomic
+   PatchCost_Time[Phase][lv] += Time;
+
+} // FUNCTION : Aux_PatchCost_Add
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchCost_AddClass
+// Description :  Classify the patches prepared for the fluid solver
+//
+// Note        :  1. Invoked by Flu_Prepare() when OPT__RECORD_PATCH_COST is on
+//                2. Leaf patch               : patch without son
+//                   Coarse-fine boundary patch : patch with at least one of the 26 sibling patches not existing on
+//                                                the same level (i.e., sibling index == -1), for which the ghost zones
+//                                                must be interpolated from the coarse level
+//                   --> Sibling patches outside the simulation domain (i.e., sibling index < -1) are not counted
+//
+// Parameter   :  lv        : Target level
+//                NPG       : Number of patch groups
+//                PID0_List : List recording the patch indices with LocalID==0
+//-------------------------------------------------------------------------------------------------------
+void Aux_PatchCost_AddClass( const int lv, const int NPG, const int *PID0_List )
+{
+
+   long NLeaf=0, NCF=0;
+
+   for (int t=0; t<NPG; t++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const patch_t *Patch = amr->patch[0][lv][ PID0_List[t] + LocalID ];
+
+      if ( Patch->son == -1 )    NLeaf ++;
+
+      for (int s=0; s<26; s++)
+      {
+         if ( Patch->sibling[s] == -1 )
+         {
+            NCF ++;
+            break;
+         }
+      }
+   }
+
+   PatchCost_NLeaf[lv] += NLeaf;
+   PatchCost_NCF  [lv] += NCF;
+
+} // FUNCTION : Aux_PatchCost_AddClass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_PatchCost
+// Description :  Record the cost of the fluid update and the AMR boundary operations on each level in the file
+//                "Record__PatchCost"
+//
+// Note        :  1. Invoked by main() before Aux_ResetTimer() for OPT__RECORD_PATCH_COST
+//                2. Counters are summed over all ranks and time is averaged over all ranks
+//                   --> Time summed over threads (Intp) is further divided by OMP_NTHREAD for comparison with the
+//                       wall-clock time
+//                3. Columns
+//                   NPatch     : number of patches updated by the fluid solver in the current step
+//                   Leaf/CF    : fractions of leaf and coarse-fine boundary patches
+//                   FluAdv     : time of Flu_AdvanceDt() (i.e., Timer_Flu_Advance)
+//                   us/Patch   : FluAdv per patch update
+//                   AMR        : Intp + FixFlux + Restrict
+//                   us/CF      : AMR overhead per coarse-fine boundary patch update
+//                   --> Compare us/CF with us/Patch to estimate the extra cost of a patch on the coarse-fine boundary
+//                       relative to an interior patch
+//                4. Counters are reset after being recorded
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_PatchCost()
+{
+
+   const char FileName[] = "Record__PatchCost";
+   static bool FirstTime = true;
+
+   const int NVar = PATCH_COST_NPHASE*2 + 3;
+   double Send[ NLEVEL*NVar ], Recv[ NLEVEL*NVar ];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      double *Var = Send + lv*NVar;
+
+      for (int p=0; p<PATCH_COST_NPHASE; p++)
+      {
+         Var[2*p+0] = PatchCost_N   [p][lv];
+         Var[2*p+1] = PatchCost_Time[p][lv]*1.0e-9;
+      }
+
+      Var[NVar-3] = PatchCost_NLeaf[lv];
+      Var[NVar-2] = PatchCost_NCF  [lv];
+      Var[NVar-1] = Timer_Flu_Advance[lv]->GetValue();
+   }
+
+   MPI_Reduce( Send, Recv, NLEVEL*NVar, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+      }
+
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "Time %13.7e, Step %8ld\n", Time[0], Step );
+      fprintf( File, "%3s%10s%7s%7s%10s%10s%10s%10s%10s%10s%10s%10s%10s%10s%8s%10s\n",
+               "Lv", "NPatch", "Leaf", "CF", "FluAdv", "us/Patch", "Prepare", "NIntp", "Intp", "NFixFlux", "FixFlux",
+               "NRestrict", "Restrict", "AMR", "AMR/Flu", "us/CF" );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const double *Var     = Recv + lv*NVar;
+         const double  NPatch  = Var[ 2*PATCH_COST_FLU_PREPARE + 0 ];
+         const double  NCF     = Var[NVar-2];
+         const double  FluAdv  = Var[NVar-1]                              / MPI_NRank;
+         const double  Prepare = Var[ 2*PATCH_COST_FLU_PREPARE + 1 ]      / MPI_NRank;
+         const double  Intp    = Var[ 2*PATCH_COST_INTERP      + 1 ]      / MPI_NRank / OMP_NTHREAD;
+         const double  FixFlux = Var[ 2*PATCH_COST_FIXUP_FLUX  + 1 ]      / MPI_NRank;
+         const double  Restr   = Var[ 2*PATCH_COST_RESTRICT    + 1 ]      / MPI_NRank;
+         const double  AMR     = Intp + FixFlux + Restr;
+
+         if ( NPatch == 0.0  &&  Var[ 2*PATCH_COST_RESTRICT + 0 ] == 0.0 )  continue;
+
+         fprintf( File, "%3d%10.0f%6.1f%%%6.1f%%%10.4f%10.3f%10.4f%10.0f%10.4f%10.0f%10.4f%10.0f%10.4f%10.4f%7.1f%%%10.3f\n",
+                  lv, NPatch,
+                  ( NPatch > 0.0 ) ? 100.0*Var[NVar-3]/NPatch : 0.0,
+                  ( NPatch > 0.0 ) ? 100.0*NCF/NPatch         : 0.0,
+                  FluAdv,
+                  ( NPatch > 0.0 ) ? 1.0e6*FluAdv*MPI_NRank/NPatch : 0.0,
+                  Prepare,
+                  Var[ 2*PATCH_COST_INTERP     + 0 ], Intp,
+                  Var[ 2*PATCH_COST_FIXUP_FLUX + 0 ], FixFlux,
+                  Var[ 2*PATCH_COST_RESTRICT   + 0 ], Restr,
+                  AMR,
+                  ( FluAdv > 0.0 ) ? 100.0*AMR/FluAdv : 0.0,
+                  ( NCF    > 0.0 ) ? 1.0e6*AMR*MPI_NRank/NCF : 0.0 );
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+
+   ResetCounter();
+
+} // FUNCTION : Aux_Record_PatchCost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ResetCounter
+// Description :  Reset all counters
+//-------------------------------------------------------------------------------------------------------
+void ResetCounter()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      for (int p=0; p<PATCH_COST_NPHASE; p++)
+      {
+         PatchCost_N   [p][lv] = 0;
+         PatchCost_Time[p][lv] = 0;
+      }
+
+      PatchCost_NLeaf[lv] = 0;
+      PatchCost_NCF  [lv] = 0;
+   }
+
+} // FUNCTION : ResetCounter
+
+
+
+#endif // #ifdef TIMING
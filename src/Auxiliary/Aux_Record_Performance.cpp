@@ -14,6 +14,15 @@
 //                       integration is only approximate since the number of patches at each level may change
 //                       during one global time-step
 //                2. When PARTICLE is on, this routine also records the "total number of particle updates per second"
+//                   --> It also records the number of particles actually updated by Par_UpdateParticle() per second
+//                       per core, where the time is that spent in Par_UpdateParticle() alone
+//                       --> Accumulated in ParUpdate_NPar and ParUpdate_Time by Par_UpdateParticle() and reset here
+//                3. When RSOLVER_HYBRID is on, this routine also records the fractions of interfaces solved by
+//                   RSOLVER_HYBRID and RSOLVER during the current global step (CPU only)
+//                   --> Accumulated in NRSolverHybrid[] by Hydro_ComputeFlux() and reset here
+//                4. When OPT__INT_TIME_LAZY is on, this routine also records the number of coarse patches at each level
+//                   skipping temporal interpolation during the current global step
+//                   --> Accumulated in NIntTimeSkip[] by InterpolateGhostZone() and reset here
 //
 // Parameter   :  ElapsedTime : Elapsed time of the current global step
 //-------------------------------------------------------------------------------------------------------
@@ -28,9 +37,27 @@ void Aux_Record_Performance( const double ElapsedTime )
 #  ifdef PARTICLE
    long NPar_Lv_AllRank[NLEVEL];
    MPI_Reduce( amr->Par->NPar_Lv, NPar_Lv_AllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   long   ParUpdate_NPar_AllRank;
+   double ParUpdate_Time_AllRank;
+   MPI_Reduce( &ParUpdate_NPar, &ParUpdate_NPar_AllRank, 1, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( &ParUpdate_Time, &ParUpdate_Time_AllRank, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+#  endif
+
+
+// get the total number of interfaces solved by RSOLVER_HYBRID/RSOLVER in each rank
+#  if ( defined RSOLVER_HYBRID  &&  !defined GPU )
+   long NRSolverHybrid_AllRank[2];
+   MPI_Reduce( NRSolverHybrid, NRSolverHybrid_AllRank, 2, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
 #  endif
 
 
+// get the total number of coarse patches skipping temporal interpolation in each rank
+   long NIntTimeSkip_AllRank[NLEVEL];
+   if ( OPT__INT_TIME_LAZY )
+   MPI_Reduce( NIntTimeSkip, NIntTimeSkip_AllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
 // only rank 0 needs to take a note
    if ( MPI_Rank == 0 )
    {
@@ -47,8 +74,12 @@ void Aux_Record_Performance( const double ElapsedTime )
          fprintf( File_Record, "#%13s%14s%3s%14s%14s%14s%14s%14s%14s",
                   "Time", "Step", "", "dt", "NCell", "NUpdate_Cell", "ElapsedTime", "Perf_Overall", "Perf_PerRank" );
 #        ifdef PARTICLE
-         fprintf( File_Record, "%14s%14s%17s%17s",
-                  "NParticle", "NUpdate_Par", "ParPerf_Overall", "ParPerf_PerRank" );
+         fprintf( File_Record, "%14s%14s%17s%17s%17s",
+                  "NParticle", "NUpdate_Par", "ParPerf_Overall", "ParPerf_PerRank", "ParUpd_PerCore" );
+#        endif
+#        if ( defined RSOLVER_HYBRID  &&  !defined GPU )
+         fprintf( File_Record, "%14s%14s%14s",
+                  "NFace", "Frac_Hybrid", "Frac_RSolver" );
 #        endif
 
          for (int lv=0; lv<NLEVEL; lv++)
@@ -58,6 +89,14 @@ void Aux_Record_Performance( const double ElapsedTime )
             fprintf( File_Record, "%14s", tmp );
          }
 
+         if ( OPT__INT_TIME_LAZY )
+         for (int lv=0; lv<NLEVEL; lv++)
+         {
+            char tmp[MAX_STRING];
+            sprintf( tmp, "NSkipIntT_Lv%d", lv );
+            fprintf( File_Record, "%14s", tmp );
+         }
+
          fprintf( File_Record, "\n" );
          fclose( File_Record );
       } // if ( FirstTime )
@@ -95,6 +134,8 @@ void Aux_Record_Performance( const double ElapsedTime )
 #     else
       const double NUpdatePar_PerSec_PerRank  = NUpdatePar_PerSec/MPI_NRank/OMP_NTHREAD;
 #     endif
+      const double ParUpdate_PerSec_PerCore   = ( ParUpdate_Time_AllRank > 0.0 ) ?
+                                                ParUpdate_NPar_AllRank/ParUpdate_Time_AllRank/OMP_NTHREAD : 0.0;
 #     endif
 
       FILE *File_Record = fopen( FileName, "a" );
@@ -104,19 +145,45 @@ void Aux_Record_Performance( const double ElapsedTime )
                NUpdateCell_PerSec_PerRank );
 
 #     ifdef PARTICLE
-      fprintf( File_Record, "%14.2e%14.2e%17.2e%17.2e",
-               (double)amr->Par->NPar_Active_AllRank, (double)NUpdatePar, NUpdatePar_PerSec, NUpdatePar_PerSec_PerRank );
+      fprintf( File_Record, "%14.2e%14.2e%17.2e%17.2e%17.2e",
+               (double)amr->Par->NPar_Active_AllRank, (double)NUpdatePar, NUpdatePar_PerSec, NUpdatePar_PerSec_PerRank,
+               ParUpdate_PerSec_PerCore );
+#     endif
+
+#     if ( defined RSOLVER_HYBRID  &&  !defined GPU )
+      const long   NFace = NRSolverHybrid_AllRank[0] + NRSolverHybrid_AllRank[1];
+      const double Frac_Hybrid   = ( NFace == 0 ) ? 0.0 : (double)NRSolverHybrid_AllRank[0]/NFace;
+      const double Frac_RSolver  = ( NFace == 0 ) ? 0.0 : (double)NRSolverHybrid_AllRank[1]/NFace;
+
+      fprintf( File_Record, "%14.2e%14.6f%14.6f", (double)NFace, Frac_Hybrid, Frac_RSolver );
 #     endif
 
       for (int lv=0; lv<NLEVEL; lv++)
       fprintf( File_Record, "%14ld", amr->NUpdateLv[lv] );
 
+      if ( OPT__INT_TIME_LAZY )
+      for (int lv=0; lv<NLEVEL; lv++)
+      fprintf( File_Record, "%14ld", NIntTimeSkip_AllRank[lv] );
+
       fprintf( File_Record, "\n" );
 
       fclose( File_Record );
 
    } // if ( MPI_Rank == 0 )
 
+
+// reset the counters
+#  if ( defined RSOLVER_HYBRID  &&  !defined GPU )
+   for (int t=0; t<2; t++)    NRSolverHybrid[t] = 0;
+#  endif
+
+   for (int lv=0; lv<NLEVEL; lv++)  NIntTimeSkip[lv] = 0;
+
+#  ifdef PARTICLE
+   ParUpdate_NPar = 0;
+   ParUpdate_Time = 0.0;
+#  endif
+
 } // FUNCTION : Aux_Record_Performance
 
 
@@ -0,0 +1,88 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_PoissonIter
+// Description :  Record the average number of iterations per patch of the SOR/multigrid Poisson solver at
+//                each level
+//
+// Note        :  1. Enabled by the runtime option "OPT__RECORD_POI_ITER"
+//                2. The numbers of iterations and patches are accumulated in PoiNIter and PoiNPatch by
+//                   InvokeSolver() since the last record
+//                3. Base level is always zero since it is solved by FFT
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_PoissonIter()
+{
+
+   const char FileName[] = "Record__PoissonIter";
+   static bool FirstTime = true;
+
+   long NIterAllRank[NLEVEL], NPatchAllRank[NLEVEL];
+   FILE *File = NULL;
+
+
+// collect data from all ranks
+   MPI_Reduce( PoiNIter,  NIterAllRank,  NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( PoiNPatch, NPatchAllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// only rank 0 needs to take a note
+   if ( MPI_Rank == 0 )
+   {
+//    header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         File = fopen( FileName, "a" );
+
+         fprintf( File, "#%13s %9s", "Time", "Step" );
+         for (int lv=0; lv<NLEVEL; lv++)  fprintf( File, "%21s %2d ", "Level", lv );
+
+         fprintf( File, "\n" );
+
+         fclose( File );
+      }
+
+
+//    record the average number of iterations per patch and the number of patches solved
+      double AveIter;
+
+      File = fopen( FileName, "a" );
+
+      fprintf( File, "%14.7e %9ld", Time[0], Step );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPatchAllRank[lv] == 0 )    AveIter = 0.0;
+         else                             AveIter = (double)NIterAllRank[lv] / NPatchAllRank[lv];
+
+         fprintf( File, " %8.2f(%14ld)", AveIter, NPatchAllRank[lv] );
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+
+   } // if ( MPI_Rank == 0 )
+
+
+// reset the counters
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      PoiNIter [lv] = 0;
+      PoiNPatch[lv] = 0;
+   }
+
+} // FUNCTION : Aux_Record_PoissonIter
+
+
+
+#endif // #ifdef GRAVITY
@@ -0,0 +1,64 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_RefineMap
+// Description :  Record the corners of all refined patches (i.e., patches with sons) at each level in the file
+//                "Record__RefineMap"
+//
+// Note        :  1. Invoked by Output_DumpData() whenever the simulation data are dumped for OPT__INIT_REFINE_MAP == 2
+//                   --> Init_RefineMap_Load() loads this table in the next run to build the initial AMR hierarchy
+//                       without flagging
+//                2. Same format as "Input__RefineMap" so that it can be used for OPT__INIT_REFINE_MAP == 1 as well
+//                3. Corners are recorded in the unit of cells at the level of each patch (i.e., corner/amr->scale[lv])
+//                   --> Independent of the number of MPI ranks
+//                4. Patches with sons on other ranks (i.e., son < -1 for LOAD_BALANCE) are recorded as well
+//                5. The file is overwritten each time
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_RefineMap()
+{
+
+   const char FileName[] = "Record__RefineMap";
+
+
+// header
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "w" );
+
+      fprintf( File, "# Level      Corner_x      Corner_y      Corner_z      (refined patches at Step %ld and Time %13.7e)\n",
+               Step, Time[0] );
+
+      fclose( File );
+   }
+
+
+// corners of the refined real patches, written rank by rank
+   for (int TRank=0; TRank<MPI_NRank; TRank++)
+   {
+      if ( MPI_Rank == TRank )
+      {
+         FILE *File = fopen( FileName, "a" );
+
+         for (int lv=0; lv<MAX_LEVEL; lv++)
+         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         {
+            if ( amr->patch[0][lv][PID]->son == -1 )  continue;
+
+            const int *Corner = amr->patch[0][lv][PID]->corner;
+
+            fprintf( File, "%7d%14d%14d%14d\n", lv, Corner[0]/amr->scale[lv], Corner[1]/amr->scale[lv],
+                     Corner[2]/amr->scale[lv] );
+         }
+
+         fclose( File );
+      }
+
+      MPI_Barrier( MPI_COMM_WORLD );
+   } // for (int TRank=0; TRank<MPI_NRank; TRank++)
+
+} // FUNCTION : Aux_Record_RefineMap
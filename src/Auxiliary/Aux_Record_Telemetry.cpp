@@ -0,0 +1,183 @@
+#include "GAMER.h"
+
+#ifdef TIMING
+
+extern Timer_t *Timer_Lv[NLEVEL];
+
+static double GetResident();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_Telemetry
+// Description :  Publish the current performance metrics in the Prometheus text format
+//
+// Note        :  1. Work with the runtime option "OPT__RECORD_TELEMETRY" (= interval in root-level steps)
+//                   --> Invoked by main() before Aux_ResetTimer() so that the timers still hold the values of
+//                       the current step
+//                2. The file "Record__Telemetry.prom" is overwritten each time and always contains the latest
+//                   metrics only
+//                   --> Written to a temporary file first and then renamed so that readers never see a partially
+//                       written file
+//                   --> Can be exported directly by the textfile collector of the Prometheus node exporter or
+//                       served by any HTTP server for live dashboards of long production runs
+//                3. Metrics
+//                   gamer_step/time/dt                    : current step, physical time, and root-level time-step
+//                   gamer_cells/patches{level}            : total number of cells and patches on each level
+//                   gamer_step_seconds                    : wall-clock time of the current step
+//                   gamer_cell_updates_per_second         : same as Perf_Overall in Record__Performance
+//                   gamer_level_seconds{level,stat}       : maximum and average over all ranks of the time spent on
+//                                                           each level in the current step (Timer_Lv[])
+//                   gamer_load_imbalance                  : weighted load-imbalance factor estimated by
+//                                                           LB_EstimateLoadImbalance() (LOAD_BALANCE only)
+//                   gamer_memory_resident_bytes{rank}     : resident set size of each rank
+//                4. GPU metrics (e.g., utilization and device memory) are not available
+//
+// Parameter   :  ElapsedTime : Elapsed time of the current global step
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_Telemetry( const double ElapsedTime )
+{
+
+   const char FileName[] = "Record__Telemetry.prom";
+
+
+// 1. collect the per-rank memory consumption
+   double  Send = GetResident();
+   double *Recv = ( MPI_Rank == 0 ) ? new double [MPI_NRank] : NULL;
+
+   MPI_Gather( &Send, 1, MPI_DOUBLE, Recv, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+
+// 2. collect the time spent on each level
+   double Time_Lv[NLEVEL], Time_Lv_Max[NLEVEL], Time_Lv_Sum[NLEVEL];
+
+   for (int lv=0; lv<NLEVEL; lv++)  Time_Lv[lv] = Timer_Lv[lv]->GetValue();
+
+   MPI_Reduce( Time_Lv, Time_Lv_Max, NLEVEL, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Time_Lv, Time_Lv_Sum, NLEVEL, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// 3. only rank 0 writes the file
+   if ( MPI_Rank == 0 )
+   {
+      char FileName_Tmp[MAX_STRING];
+      sprintf( FileName_Tmp, "%s.tmp", FileName );
+
+      FILE *File = fopen( FileName_Tmp, "w" );
+
+      if ( File == NULL )
+      {
+         Aux_Message( stderr, "WARNING : failed to open the telemetry file \"%s\" !!\n", FileName_Tmp );
+         delete [] Recv;
+         return;
+      }
+
+
+//    count the total number of cells and cell updates in the same way as Aux_Record_Performance()
+      long NCell=0, NUpdateCell=0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const long NCellThisLevel = (long)NPatchTotal[lv]*CUBE( PATCH_SIZE );
+         NCell       += NCellThisLevel;
+         NUpdateCell += NCellThisLevel*amr->NUpdateLv[lv];
+      }
+
+      fprintf( File, "# HELP gamer_step Number of root-level steps\n" );
+      fprintf( File, "# TYPE gamer_step counter\n" );
+      fprintf( File, "gamer_step %ld\n", Step );
+
+      fprintf( File, "# HELP gamer_time Physical time\n" );
+      fprintf( File, "# TYPE gamer_time gauge\n" );
+      fprintf( File, "gamer_time %.7e\n", Time[0] );
+
+      fprintf( File, "# HELP gamer_dt Root-level time-step\n" );
+      fprintf( File, "# TYPE gamer_dt gauge\n" );
+      fprintf( File, "gamer_dt %.7e\n", dTime_Base );
+
+      fprintf( File, "# HELP gamer_cells Total number of cells\n" );
+      fprintf( File, "# TYPE gamer_cells gauge\n" );
+      fprintf( File, "gamer_cells %ld\n", NCell );
+
+      fprintf( File, "# HELP gamer_patches Number of patches on each level\n" );
+      fprintf( File, "# TYPE gamer_patches gauge\n" );
+      for (int lv=0; lv<NLEVEL; lv++)
+      fprintf( File, "gamer_patches{level=\"%d\"} %d\n", lv, NPatchTotal[lv] );
+
+      fprintf( File, "# HELP gamer_step_seconds Wall-clock time of the latest root-level step\n" );
+      fprintf( File, "# TYPE gamer_step_seconds gauge\n" );
+      fprintf( File, "gamer_step_seconds %.6e\n", ElapsedTime );
+
+      fprintf( File, "# HELP gamer_cell_updates_per_second Total number of cell updates per second in the latest step\n" );
+      fprintf( File, "# TYPE gamer_cell_updates_per_second gauge\n" );
+      fprintf( File, "gamer_cell_updates_per_second %.6e\n", ( ElapsedTime > 0.0 ) ? NUpdateCell/ElapsedTime : 0.0 );
+
+      fprintf( File, "# HELP gamer_level_seconds Time spent on each level in the latest step over all ranks\n" );
+      fprintf( File, "# TYPE gamer_level_seconds gauge\n" );
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPatchTotal[lv] == 0 )   continue;
+
+         fprintf( File, "gamer_level_seconds{level=\"%d\",stat=\"max\"} %.6e\n", lv, Time_Lv_Max[lv] );
+         fprintf( File, "gamer_level_seconds{level=\"%d\",stat=\"ave\"} %.6e\n", lv, Time_Lv_Sum[lv]/MPI_NRank );
+      }
+
+#     ifdef LOAD_BALANCE
+      fprintf( File, "# HELP gamer_load_imbalance Weighted load-imbalance factor\n" );
+      fprintf( File, "# TYPE gamer_load_imbalance gauge\n" );
+      fprintf( File, "gamer_load_imbalance %.6e\n", amr->LB->WLI );
+#     endif
+
+      fprintf( File, "# HELP gamer_memory_resident_bytes Resident set size of each rank\n" );
+      fprintf( File, "# TYPE gamer_memory_resident_bytes gauge\n" );
+      for (int r=0; r<MPI_NRank; r++)
+      fprintf( File, "gamer_memory_resident_bytes{rank=\"%d\"} %.0f\n", r, Recv[r] );
+
+      fclose( File );
+
+      if ( rename( FileName_Tmp, FileName ) != 0 )
+         Aux_Message( stderr, "WARNING : failed to rename \"%s\" to \"%s\" !!\n", FileName_Tmp, FileName );
+
+      delete [] Recv;
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Aux_Record_Telemetry
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetResident
+// Description :  Return the resident set size of this process in bytes
+//
+// Note        :  1. Read VmRSS from "/proc/self/status" as Aux_GetMemInfo()
+//                2. Return 0.0 if it is unavailable
+//-------------------------------------------------------------------------------------------------------
+double GetResident()
+{
+
+   FILE *File = fopen( "/proc/self/status", "r" );
+
+   if ( File == NULL )  return 0.0;
+
+   char   Line[MAX_STRING];
+   double VmRSS = 0.0;
+
+   while ( fgets( Line, MAX_STRING, File ) != NULL )
+   {
+      if ( strncmp( Line, "VmRSS:", 6 ) == 0 )
+      {
+         VmRSS = atof( Line+6 )*1024.0;
+         break;
+      }
+   }
+
+   fclose( File );
+
+   return VmRSS;
+
+} // FUNCTION : GetResident
+
+
+
+#endif // #ifdef TIMING
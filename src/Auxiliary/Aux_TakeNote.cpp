@@ -8,7 +8,8 @@
 #include <cpuid.h>
 #endif
 
-static int get_cpuid();
+static int  get_cpuid();
+static void WriteNote_AllRank( const char *FileName, FILE *Stream, char *&Text, size_t &Size );
 
 
 
@@ -17,6 +18,10 @@ static int get_cpuid();
 // Function    :  Aux_TakeNote
 // Description :  Record simulation parameters and the content in the file "Input__Note" to the
 //                note file "Record__Note"
+//
+// Note        :  1. Information of individual ranks (e.g., hostname and CPU info) is collected to rank 0 by
+//                   WriteNote_AllRank() instead of letting each rank append to the file in turn
+//                   --> No MPI_Barrier() loop over all ranks so that the cost stays flat with the number of ranks
 //-------------------------------------------------------------------------------------------------------
 void Aux_TakeNote()
 {
@@ -151,6 +156,16 @@ void Aux_TakeNote()
       fprintf( Note, "RSOLVER                         UNKNOWN\n" );
 #     endif
 
+#     if   ( RSOLVER_HYBRID == ROE )
+      fprintf( Note, "RSOLVER_HYBRID                  ROE\n" );
+#     elif ( RSOLVER_HYBRID == HLLE )
+      fprintf( Note, "RSOLVER_HYBRID                  HLLE\n" );
+#     elif ( !defined RSOLVER_HYBRID )
+      fprintf( Note, "RSOLVER_HYBRID                  OFF\n" );
+#     else
+      fprintf( Note, "RSOLVER_HYBRID                  UNKNOWN\n" );
+#     endif
+
 #     if   ( DUAL_ENERGY == DE_ENPY )
       fprintf( Note, "DUAL_ENERGY                     DE_ENPY\n" );
 #     elif ( DUAL_ENERGY == DE_EINT )
@@ -181,6 +196,12 @@ void Aux_TakeNote()
       fprintf( Note, "EOS                             UNKNOWN\n" );
 #     endif
 
+#     ifdef GAMMA_CONST
+      fprintf( Note, "GAMMA_CONST                     %20.14e\n", GAMMA_CONST );
+#     else
+      fprintf( Note, "GAMMA_CONST                     OFF\n" );
+#     endif
+
 #     ifdef BAROTROPIC_EOS
       fprintf( Note, "BAROTROPIC_EOS                  ON\n" );
 #     else
@@ -271,6 +292,12 @@ void Aux_TakeNote()
       fprintf( Note, "FLOAT8                          OFF\n" );
 #     endif
 
+#     ifdef MIXED_PRECISION
+      fprintf( Note, "MIXED_PRECISION                 ON\n" );
+#     else
+      fprintf( Note, "MIXED_PRECISION                 OFF\n" );
+#     endif
+
 #     ifdef SERIAL
       fprintf( Note, "SERIAL                          ON\n" );
 #     else
@@ -339,6 +366,8 @@ void Aux_TakeNote()
       fprintf( Note, "RANDOM_NUMBER                   RNG_GNU_EXT\n" );
 #     elif ( RANDOM_NUMBER == RNG_CPP11 )
       fprintf( Note, "RANDOM_NUMBER                   RNG_CPP11\n" );
+#     elif ( RANDOM_NUMBER == RNG_PHILOX )
+      fprintf( Note, "RANDOM_NUMBER                   RNG_PHILOX\n" );
 #     else
       fprintf( Note, "RANDOM_NUMBER                   UNKNOWN\n" );
 #     endif
@@ -511,7 +540,7 @@ void Aux_TakeNote()
       fprintf( Note, "#define NCOMP_ELE               %d\n",      NCOMP_ELE           );
 #     endif
       fprintf( Note, "#define PATCH_SIZE              %d\n",      PATCH_SIZE          );
-      fprintf( Note, "#define MAX_PATCH               %d\n",      MAX_PATCH           );
+      fprintf( Note, "#define PATCH_TABLE_CHUNK_SIZE  %d\n",      PATCH_TABLE_CHUNK_SIZE );
       fprintf( Note, "#define NLEVEL                  %d\n",      NLEVEL              );
       fprintf( Note, "\n" );
       fprintf( Note, "#define FLU_GHOST_SIZE          %d\n",      FLU_GHOST_SIZE      );
@@ -663,6 +692,7 @@ void Aux_TakeNote()
 #     ifdef GRAVITY
       fprintf( Note, "OPT__BC_POT                     %d\n",      OPT__BC_POT    );
       fprintf( Note, "GFUNC_COEFF0                    %13.7e\n",  GFUNC_COEFF0   );
+      fprintf( Note, "OPT__GFUNC_CACHE                %d\n",      OPT__GFUNC_CACHE );
 #     endif
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -687,6 +717,18 @@ void Aux_TakeNote()
       fprintf( Note, "Par->ImproveAcc                 %d\n",      amr->Par->ImproveAcc          );
       fprintf( Note, "Par->PredictPos                 %d\n",      amr->Par->PredictPos          );
       fprintf( Note, "Par->RemoveCell                 %13.7e\n",  amr->Par->RemoveCell          );
+#     ifdef LOAD_BALANCE
+      fprintf( Note, "Par->CompressMPI                %d\n",      amr->Par->CompressMPI         );
+#     endif
+      fprintf( Note, "Par->SortInterval               %d\n",      amr->Par->SortInterval        );
+      fprintf( Note, "Par->DepositNParThread          %d\n",      amr->Par->DepositNParThread   );
+      fprintf( Note, "Par->CollectCache               %d\n",      amr->Par->CollectCache        );
+      fprintf( Note, "Par->DensCache                  %d\n",      amr->Par->DensCache           );
+      fprintf( Note, "Par->MaxSubCycle                %d\n",      amr->Par->MaxSubCycle         );
+      fprintf( Note, "Par->ShortRangeAcc              %d\n",      amr->Par->ShortRangeAcc       );
+      fprintf( Note, "Par->SR_Soften                  %13.7e\n",  amr->Par->SR_Soften           );
+      fprintf( Note, "Par->SR_Radius                  %13.7e\n",  amr->Par->SR_Radius           );
+      fprintf( Note, "Par->FreezeFluRatio             %13.7e\n",  amr->Par->FreezeFluRatio      );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 #     endif
@@ -728,9 +770,20 @@ void Aux_TakeNote()
       fprintf( Note, "DT__SYNC_CHILDREN_LV            %13.7e\n",  DT__SYNC_CHILDREN_LV      );
       fprintf( Note, "OPT__DT_USER                    %d\n",      OPT__DT_USER              );
       fprintf( Note, "OPT__DT_LEVEL                   %d\n",      OPT__DT_LEVEL             );
+      fprintf( Note, "OPT__DT_OPT_SUBSTEP             %d\n",      OPT__DT_OPT_SUBSTEP       );
+      fprintf( Note, "DT__SUBSTEP_OVERHEAD            %13.7e\n",  DT__SUBSTEP_OVERHEAD      );
+#     if ( MODEL == HYDRO )
+      fprintf( Note, "OPT__DT_FLU_BYPRODUCT           %d\n",      OPT__DT_FLU_BYPRODUCT     );
+#     endif
       fprintf( Note, "AUTO_REDUCE_DT                  %d\n",      AUTO_REDUCE_DT            );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR           %13.7e\n",  AUTO_REDUCE_DT_FACTOR     );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR_MIN       %13.7e\n",  AUTO_REDUCE_DT_FACTOR_MIN );
+#     if ( MODEL == HYDRO )
+      fprintf( Note, "AUTO_REDUCE_DT_LOCAL            %d\n",      AUTO_REDUCE_DT_LOCAL      );
+      fprintf( Note, "OPT__FROZEN_REGION              %d\n",      OPT__FROZEN_REGION        );
+      fprintf( Note, "FROZEN_REGION_NSTEP             %d\n",      FROZEN_REGION_NSTEP       );
+      fprintf( Note, "FROZEN_REGION_TOL               %13.7e\n",  FROZEN_REGION_TOL         );
+#     endif
       fprintf( Note, "OPT__RECORD_DT                  %d\n",      OPT__RECORD_DT            );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -740,6 +793,7 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Domain Refinement\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "REGRID_COUNT                    %d\n",      REGRID_COUNT              );
+      fprintf( Note, "OPT__REGRID_LAZY                %d\n",      OPT__REGRID_LAZY          );
       fprintf( Note, "FLAG_BUFFER_SIZE                %d\n",      FLAG_BUFFER_SIZE          );
       fprintf( Note, "FLAG_BUFFER_SIZE_MAXM1_LV       %d\n",      FLAG_BUFFER_SIZE_MAXM1_LV );
       fprintf( Note, "FLAG_BUFFER_SIZE_MAXM2_LV       %d\n",      FLAG_BUFFER_SIZE_MAXM2_LV );
@@ -776,12 +830,16 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__FLAG_PAR_MASS_CELL         %d\n",      OPT__FLAG_PAR_MASS_CELL   );
 #     endif
       fprintf( Note, "OPT__NO_FLAG_NEAR_BOUNDARY      %d\n",      OPT__NO_FLAG_NEAR_BOUNDARY);
+      fprintf( Note, "OPT__FLAG_FLU_BYPRODUCT         %d\n",      OPT__FLAG_FLU_BYPRODUCT   );
       fprintf( Note, "OPT__PATCH_COUNT                %d\n",      OPT__PATCH_COUNT          );
 #     ifdef PARTICLE
       fprintf( Note, "OPT__PARTICLE_COUNT             %d\n",      OPT__PARTICLE_COUNT       );
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY               %d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL                %d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__PATCH_ARENA                %d\n",      OPT__PATCH_ARENA          );
+      fprintf( Note, "OPT__FIRST_TOUCH                %d\n",      OPT__FIRST_TOUCH          );
+      fprintf( Note, "OPT__SG_ON_DEMAND               %d\n",      OPT__SG_ON_DEMAND         );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -799,8 +857,18 @@ void Aux_TakeNote()
       fprintf( Note, "LB_WLI_MAX                      %13.7e\n",  amr->LB->WLI_Max          );
 #     ifdef PARTICLE
       fprintf( Note, "LB_PAR_WEIGHT                   %13.7e\n",  amr->LB->Par_Weight       );
+#     endif
+      fprintf( Note, "LB_INPUT__MEASURED_COST         %13.7e\n",  amr->LB->Cost_EMA         );
+#     ifdef SUPPORT_GRACKLE
+      fprintf( Note, "LB_INPUT__CHE_WEIGHT            %13.7e\n",  amr->LB->Che_Weight       );
 #     endif
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE        %d\n",      OPT__RECORD_LOAD_BALANCE  );
+      fprintf( Note, "OPT__LB_INCREMENTAL             %d\n",      OPT__LB_INCREMENTAL       );
+      fprintf( Note, "OPT__LB_COUPLE_LEVEL            %d\n",      OPT__LB_COUPLE_LEVEL      );
+      fprintf( Note, "OPT__LB_CURVE                   %d\n",      OPT__LB_CURVE             );
+      fprintf( Note, "OPT__LB_DERIVED_TYPE            %d\n",      OPT__LB_DERIVED_TYPE      );
+      fprintf( Note, "OPT__LB_DIST_GRAPH              %d\n",      OPT__LB_DIST_GRAPH        );
+      fprintf( Note, "OPT__MPI_PROGRESS               %d\n",      OPT__MPI_PROGRESS         );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER       %d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -826,7 +894,9 @@ void Aux_TakeNote()
       fprintf( Note, "GRACKLE_THREE_BODY_RATE         %d\n",      GRACKLE_THREE_BODY_RATE );
       fprintf( Note, "GRACKLE_CIE_COOLING             %d\n",      GRACKLE_CIE_COOLING     );
       fprintf( Note, "GRACKLE_H2_OPA_APPROX           %d\n",      GRACKLE_H2_OPA_APPROX   );
-      fprintf( Note, "CHE_GPU_NPGROUP                 %d\n",      CHE_GPU_NPGROUP         ); }
+      fprintf( Note, "CHE_GPU_NPGROUP                 %d\n",      CHE_GPU_NPGROUP         );
+      fprintf( Note, "GRACKLE_ZERO_COPY               %d\n",      GRACKLE_ZERO_COPY       );
+      fprintf( Note, "GRACKLE_SCREEN_TCOOL            %13.7e\n",  GRACKLE_SCREEN_TCOOL    ); }
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 #     endif // #ifdef SUPPORT_GRACKLE
@@ -859,6 +929,9 @@ void Aux_TakeNote()
       fprintf( Note, "GAMMA                           %13.7e\n",  GAMMA                   );
       fprintf( Note, "MOLECULAR_WEIGHT                %13.7e\n",  MOLECULAR_WEIGHT        );
       fprintf( Note, "ISO_TEMP                        %13.7e\n",  ISO_TEMP                );
+#     if ( EOS == EOS_TABULAR )
+      fprintf( Note, "EOS_TABLE_NAME                  %s\n",      EOS_TABLE_NAME          );
+#     endif
       fprintf( Note, "MINMOD_COEFF                    %13.7e\n",  MINMOD_COEFF            );
       fprintf( Note, "OPT__LR_LIMITER                 %s\n",      ( OPT__LR_LIMITER == VANLEER           ) ? "VANLEER"    :
                                                                   ( OPT__LR_LIMITER == GMINMOD           ) ? "GMINMOD"    :
@@ -871,12 +944,13 @@ void Aux_TakeNote()
                                                                   ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D ) ? "3D1D" :
                                                                   ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_NONE ) ? "NONE" :
                                                                                                                    "UNKNOWN" );
-      fprintf( Note, "OPT__1ST_FLUX_CORR_SCHEME       %s\n",      ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_ROE  ) ? "RSOLVER_1ST_ROE"  :
-                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLC ) ? "RSOLVER_1ST_HLLC" :
-                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLE ) ? "RSOLVER_1ST_HLLE" :
-                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLD ) ? "RSOLVER_1ST_HLLD" :
-                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_NONE ) ? "NONE"             :
-                                                                                                                "UNKNOWN" );
+      fprintf( Note, "OPT__1ST_FLUX_CORR_SCHEME       %s\n",      ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_ROE   ) ? "RSOLVER_1ST_ROE"   :
+                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLC  ) ? "RSOLVER_1ST_HLLC"  :
+                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLE  ) ? "RSOLVER_1ST_HLLE"  :
+                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLD  ) ? "RSOLVER_1ST_HLLD"  :
+                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_EXACT ) ? "RSOLVER_1ST_EXACT" :
+                                                                  ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_NONE  ) ? "NONE"              :
+                                                                                                                        "UNKNOWN" );
 
 #     elif ( MODEL == ELBDM )
       if ( OPT__UNIT ) {
@@ -919,6 +993,7 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "FLU_GPU_NPGROUP                 %d\n",      FLU_GPU_NPGROUP          );
       fprintf( Note, "GPU_NSTREAM                     %d\n",      GPU_NSTREAM              );
+      fprintf( Note, "OPT__ADAPTIVE_NPGROUP           %d\n",      OPT__ADAPTIVE_NPGROUP    );
       fprintf( Note, "OPT__FIXUP_FLUX                 %d\n",      OPT__FIXUP_FLUX          );
 #     ifdef MHD
       fprintf( Note, "OPT__FIXUP_ELECTRIC             %d\n",      OPT__FIXUP_ELECTRIC      );
@@ -983,6 +1058,7 @@ void Aux_TakeNote()
       fprintf( Note, "SOR_OMEGA                       %13.7e\n",  SOR_OMEGA               );
       fprintf( Note, "SOR_MAX_ITER                    %d\n",      SOR_MAX_ITER            );
       fprintf( Note, "SOR_MIN_ITER                    %d\n",      SOR_MIN_ITER            );
+      fprintf( Note, "SOR_TOLERATED_ERROR             %13.7e\n",  SOR_TOLERATED_ERROR     );
 #     elif ( POT_SCHEME == MG )
       fprintf( Note, "MG_MAX_ITER                     %d\n",      MG_MAX_ITER             );
       fprintf( Note, "MG_NPRE_SMOOTH                  %d\n",      MG_NPRE_SMOOTH          );
@@ -994,6 +1070,23 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__GRAVITY_TYPE               %d\n",      OPT__GRAVITY_TYPE       );
       fprintf( Note, "OPT__EXTERNAL_POT               %d\n",      OPT__EXTERNAL_POT       );
       fprintf( Note, "OPT__GRAVITY_EXTRA_MASS         %d\n",      OPT__GRAVITY_EXTRA_MASS );
+      fprintf( Note, "OPT__FFT_PENCIL                 %d\n",      OPT__FFT_PENCIL         );
+      fprintf( Note, "OPT__POT_WARM_START             %d\n",      OPT__POT_WARM_START     );
+      fprintf( Note, "OPT__RECORD_POI_ITER            %d\n",      OPT__RECORD_POI_ITER    );
+      fprintf( Note, "POT_LEVEL_NSWEEP                %d\n",      POT_LEVEL_NSWEEP        );
+      fprintf( Note, "OPT__RECORD_LEVEL_PS            %d\n",      OPT__RECORD_LEVEL_PS    );
+      fprintf( Note, "LEVEL_PS_LV                     %d\n",      LEVEL_PS_LV             );
+      fprintf( Note, "LEVEL_PS_INTERLACE              %d\n",      LEVEL_PS_INTERLACE      );
+      fprintf( Note, "OPT__USG_POT_EXT                %d\n",      OPT__USG_POT_EXT        );
+      fprintf( Note, "OPT__USG_FUSE_EXT_ACC           %d\n",      OPT__USG_FUSE_EXT_ACC   );
+      fprintf( Note, "EXT_POT_TABLE_NAME              %s\n",      EXT_POT_TABLE_NAME      );
+      fprintf( Note, "EXT_POT_TABLE_NPOINT_X          %d\n",      EXT_POT_TABLE_NPOINT[0] );
+      fprintf( Note, "EXT_POT_TABLE_NPOINT_Y          %d\n",      EXT_POT_TABLE_NPOINT[1] );
+      fprintf( Note, "EXT_POT_TABLE_NPOINT_Z          %d\n",      EXT_POT_TABLE_NPOINT[2] );
+      fprintf( Note, "EXT_POT_TABLE_DH                %13.7e\n",  EXT_POT_TABLE_DH        );
+      fprintf( Note, "EXT_POT_TABLE_EDGEL_X           %13.7e\n",  EXT_POT_TABLE_EDGEL[0]  );
+      fprintf( Note, "EXT_POT_TABLE_EDGEL_Y           %13.7e\n",  EXT_POT_TABLE_EDGEL[1]  );
+      fprintf( Note, "EXT_POT_TABLE_EDGEL_Z           %13.7e\n",  EXT_POT_TABLE_EDGEL[2]  );
       fprintf( Note, "AveDensity_Init                 %13.7e\n",  AveDensity_Init         );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -1006,6 +1099,8 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__INIT                       %d\n",      OPT__INIT               );
       fprintf( Note, "RESTART_LOAD_NRANK              %d\n",      RESTART_LOAD_NRANK      );
       fprintf( Note, "OPT__RESTART_RESET              %d\n",      OPT__RESTART_RESET      );
+      fprintf( Note, "OPT__RESTART_BULK               %d\n",      OPT__RESTART_BULK       );
+      fprintf( Note, "OPT__RESTART_LOCAL              %d\n",      OPT__RESTART_LOCAL      );
       fprintf( Note, "OPT__UM_IC_LEVEL                %d\n",      OPT__UM_IC_LEVEL        );
       fprintf( Note, "OPT__UM_IC_NVAR                 %d\n",      OPT__UM_IC_NVAR         );
       fprintf( Note, "OPT__UM_IC_FORMAT               %d\n",      OPT__UM_IC_FORMAT       );
@@ -1013,9 +1108,11 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__UM_IC_REFINE               %d\n",      OPT__UM_IC_REFINE       );
       fprintf( Note, "OPT__UM_IC_LOAD_NRANK           %d\n",      OPT__UM_IC_LOAD_NRANK   );
       fprintf( Note, "OPT__INIT_RESTRICT              %d\n",      OPT__INIT_RESTRICT      );
+      fprintf( Note, "OPT__INIT_REFINE_MAP            %d\n",      OPT__INIT_REFINE_MAP    );
       fprintf( Note, "OPT__INIT_GRID_WITH_OMP         %d\n",      OPT__INIT_GRID_WITH_OMP );
       fprintf( Note, "OPT__GPUID_SELECT               %d\n",      OPT__GPUID_SELECT       );
       fprintf( Note, "INIT_SUBSAMPLING_NCELL          %d\n",      INIT_SUBSAMPLING_NCELL  );
+      fprintf( Note, "INIT_SUBSAMPLING_TOL            %13.7e\n",  INIT_SUBSAMPLING_TOL    );
 #     ifdef MHD
       fprintf( Note, "OPT__INIT_BFIELD_BYFILE         %d\n",      OPT__INIT_BFIELD_BYFILE );
 #     endif
@@ -1027,6 +1124,12 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Interpolation Schemes\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__INT_TIME                   %d\n",      OPT__INT_TIME           );
+      fprintf( Note, "OPT__INT_TIME_LAZY              %d\n",      OPT__INT_TIME_LAZY      );
+      fprintf( Note, "OPT__GHOST_CACHE                %d\n",      OPT__GHOST_CACHE        );
+      fprintf( Note, "OPT__PREP_COST_ORDER            %d\n",      OPT__PREP_COST_ORDER    );
+#     ifdef MHD
+      fprintf( Note, "OPT__EMAG_CACHE                 %d\n",      OPT__EMAG_CACHE         );
+#     endif
 #     if ( MODEL == ELBDM )
       fprintf( Note, "OPT__INT_PHASE                  %d\n",      OPT__INT_PHASE          );
 #     endif
@@ -1112,6 +1215,38 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Data Dump\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__OUTPUT_TOTAL               %d\n",      OPT__OUTPUT_TOTAL    );
+      fprintf( Note, "OPT__OUTPUT_MPIIO               %d\n",      OPT__OUTPUT_MPIIO    );
+      fprintf( Note, "OPT__OUTPUT_ASYNC               %d\n",      OPT__OUTPUT_ASYNC    );
+      fprintf( Note, "OPT__OUTPUT_COMPRESS            %d\n",      OPT__OUTPUT_COMPRESS );
+      fprintf( Note, "OPT__OUTPUT_SHUFFLE             %d\n",      OPT__OUTPUT_SHUFFLE  );
+      fprintf( Note, "OPT__OUTPUT_CHUNK_NPATCH        %d\n",      OPT__OUTPUT_CHUNK_NPATCH );
+      fprintf( Note, "OPT__OUTPUT_INDEX               %d\n",      OPT__OUTPUT_INDEX    );
+      fprintf( Note, "OPT__CKPT_LOCAL                 %d\n",      OPT__CKPT_LOCAL      );
+      fprintf( Note, "OUTPUT_SUB_STEP                 %d\n",      OUTPUT_SUB_STEP      );
+      fprintf( Note, "OUTPUT_SUB_LV_MIN               %d\n",      OUTPUT_SUB_LV_MIN    );
+      fprintf( Note, "OUTPUT_SUB_LV_MAX               %d\n",      OUTPUT_SUB_LV_MAX    );
+      fprintf( Note, "OUTPUT_SUB_FIELD                %ld\n",     OUTPUT_SUB_FIELD     );
+      fprintf( Note, "OUTPUT_SUB_EDGEL_X              %13.7e\n",  OUTPUT_SUB_EDGEL[0]  );
+      fprintf( Note, "OUTPUT_SUB_EDGEL_Y              %13.7e\n",  OUTPUT_SUB_EDGEL[1]  );
+      fprintf( Note, "OUTPUT_SUB_EDGEL_Z              %13.7e\n",  OUTPUT_SUB_EDGEL[2]  );
+      fprintf( Note, "OUTPUT_SUB_EDGER_X              %13.7e\n",  OUTPUT_SUB_EDGER[0]  );
+      fprintf( Note, "OUTPUT_SUB_EDGER_Y              %13.7e\n",  OUTPUT_SUB_EDGER[1]  );
+      fprintf( Note, "OUTPUT_SUB_EDGER_Z              %13.7e\n",  OUTPUT_SUB_EDGER[2]  );
+      fprintf( Note, "OUTPUT_UG_STEP                  %d\n",      OUTPUT_UG_STEP       );
+      fprintf( Note, "OUTPUT_UG_LV                    %d\n",      OUTPUT_UG_LV         );
+      fprintf( Note, "OUTPUT_UG_EDGEL_X               %13.7e\n",  OUTPUT_UG_EDGEL[0]   );
+      fprintf( Note, "OUTPUT_UG_EDGEL_Y               %13.7e\n",  OUTPUT_UG_EDGEL[1]   );
+      fprintf( Note, "OUTPUT_UG_EDGEL_Z               %13.7e\n",  OUTPUT_UG_EDGEL[2]   );
+      fprintf( Note, "OUTPUT_UG_EDGER_X               %13.7e\n",  OUTPUT_UG_EDGER[0]   );
+      fprintf( Note, "OUTPUT_UG_EDGER_Y               %13.7e\n",  OUTPUT_UG_EDGER[1]   );
+      fprintf( Note, "OUTPUT_UG_EDGER_Z               %13.7e\n",  OUTPUT_UG_EDGER[2]   );
+      fprintf( Note, "OUTPUT_DIAG_STEP                %d\n",      OUTPUT_DIAG_STEP     );
+      if ( OUTPUT_DIAG_STEP > 0 ) {
+      fprintf( Note, "   OUTPUT_DIAG_FIELD            %ld\n",     OUTPUT_DIAG_FIELD    );
+      fprintf( Note, "   OUTPUT_DIAG_PROJ_LV          %d\n",      OUTPUT_DIAG_PROJ_LV  );
+      fprintf( Note, "   OUTPUT_DIAG_PROF_RMAX        %13.7e\n",  OUTPUT_DIAG_PROF_RMAX );
+      fprintf( Note, "   OUTPUT_DIAG_PROF_LOGR        %13.7e\n",  OUTPUT_DIAG_PROF_LOGR );
+      fprintf( Note, "   OUTPUT_DIAG_PHASE_NBIN       %d\n",      OUTPUT_DIAG_PHASE_NBIN ); }
       fprintf( Note, "OPT__OUTPUT_PART                %d\n",      OPT__OUTPUT_PART     );
       fprintf( Note, "OPT__OUTPUT_USER                %d\n",      OPT__OUTPUT_USER     );
 #     ifdef PARTICLE
@@ -1119,6 +1254,7 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__OUTPUT_BASEPS              %d\n",      OPT__OUTPUT_BASEPS   );
       fprintf( Note, "OPT__OUTPUT_BASE                %d\n",      OPT__OUTPUT_BASE     );
+      fprintf( Note, "OPT__OUTPUT_TEXT_BINARY         %d\n",      OPT__OUTPUT_TEXT_BINARY );
 #     ifdef GRAVITY
       fprintf( Note, "OPT__OUTPUT_POT                 %d\n",      OPT__OUTPUT_POT      );
 #     endif
@@ -1145,6 +1281,11 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "YT_SCRIPT                       %s\n",      YT_SCRIPT  );
       fprintf( Note, "YT_VERBOSE                      %d\n",      YT_VERBOSE );
+      fprintf( Note, "YT_STEP                         %d\n",      YT_STEP    );
+      fprintf( Note, "YT_ASYNC                        %d\n",      YT_ASYNC   );
+      if ( YT_ASYNC ) {
+      fprintf( Note, "YT_ASYNC_NCORE                  %d\n",      YT_ASYNC_NCORE   );
+      fprintf( Note, "YT_ASYNC_MAX_MEM                %13.7e\n",  YT_ASYNC_MAX_MEM ); }
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 #     endif
@@ -1157,10 +1298,19 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__TIMING_BARRIER             %d\n",      OPT__TIMING_BARRIER      );
       fprintf( Note, "OPT__TIMING_BALANCE             %d\n",      OPT__TIMING_BALANCE      );
       fprintf( Note, "OPT__TIMING_MPI                 %d\n",      OPT__TIMING_MPI          );
+      fprintf( Note, "OPT__TIMING_COUNTER             %d\n",      OPT__TIMING_COUNTER      );
+      fprintf( Note, "OPT__TRACE                      %d\n",      OPT__TRACE               );
+      fprintf( Note, "TRACE_NEVENT                    %d\n",      TRACE_NEVENT             );
       fprintf( Note, "OPT__RECORD_NOTE                %d\n",      OPT__RECORD_NOTE         );
       fprintf( Note, "OPT__RECORD_UNPHY               %d\n",      OPT__RECORD_UNPHY        );
+      fprintf( Note, "OPT__RECORD_CONSERVATION        %d\n",      OPT__RECORD_CONSERVATION );
+#     ifdef MHD
+      fprintf( Note, "OPT__RECORD_DIVB                %d\n",      OPT__RECORD_DIVB         );
+#     endif
       fprintf( Note, "OPT__RECORD_MEMORY              %d\n",      OPT__RECORD_MEMORY       );
       fprintf( Note, "OPT__RECORD_PERFORMANCE         %d\n",      OPT__RECORD_PERFORMANCE  );
+      fprintf( Note, "OPT__RECORD_TELEMETRY           %d\n",      OPT__RECORD_TELEMETRY    );
+      fprintf( Note, "OPT__RECORD_PATCH_COST          %d\n",      OPT__RECORD_PATCH_COST   );
       fprintf( Note, "OPT__MANUAL_CONTROL             %d\n",      OPT__MANUAL_CONTROL      );
       fprintf( Note, "OPT__RECORD_USER                %d\n",      OPT__RECORD_USER         );
       fprintf( Note, "OPT__OPTIMIZE_AGGRESSIVE        %d\n",      OPT__OPTIMIZE_AGGRESSIVE );
@@ -1182,6 +1332,7 @@ void Aux_TakeNote()
 #     if ( MODEL == HYDRO )
       fprintf( Note, "OPT__CK_NEGATIVE                %d\n",      OPT__CK_NEGATIVE          );
 #     endif
+      fprintf( Note, "OPT__CK_FLU_OUTPUT              %d\n",      OPT__CK_FLU_OUTPUT        );
       fprintf( Note, "OPT__CK_MEMFREE                 %13.7e\n",  OPT__CK_MEMFREE           );
 #     ifdef PARTICLE
       fprintf( Note, "OPT__CK_PARTICLE                %d\n",      OPT__CK_PARTICLE          );
@@ -1367,23 +1518,17 @@ void Aux_TakeNote()
        fclose( Note );
    }
 
-   for (int YourTurn=0; YourTurn<MPI_NRank; YourTurn++)
-   {
-      if ( MPI_Rank == YourTurn )
-      {
-         Note = fopen( FileName, "a" );
-         if ( MPI_Rank != 0 )    fprintf( Note, "\n" );
-         fprintf( Note, "MPI_Rank = %3d, hostname = %10s, PID = %5d\n", MPI_Rank, Host, PID );
-         fprintf( Note, "CPU Info :\n" );
-         fflush( Note );
+   char  *RankText = NULL;
+   size_t RankSize = 0;
+   FILE  *RankNote = open_memstream( &RankText, &RankSize );
 
-         Aux_GetCPUInfo( FileName );
+   if ( MPI_Rank != 0 )    fprintf( RankNote, "\n" );
+   fprintf( RankNote, "MPI_Rank = %3d, hostname = %10s, PID = %5d\n", MPI_Rank, Host, PID );
+   fprintf( RankNote, "CPU Info :\n" );
 
-         fclose( Note );
-      }
+   Aux_GetCPUInfo( RankNote );
 
-      MPI_Barrier( MPI_COMM_WORLD );
-   }
+   WriteNote_AllRank( FileName, RankNote, RankText, RankSize );
 
    if ( MPI_Rank == 0 )
    {
@@ -1434,23 +1579,18 @@ void Aux_TakeNote()
 #  pragma omp parallel
    { omp_core_id[ omp_get_thread_num() ] = get_cpuid(); }
 
-   for (int YourTurn=0; YourTurn<MPI_NRank; YourTurn++)
-   {
-      if ( MPI_Rank == YourTurn )
-      {
-         char MPI_Host[1024];
-         gethostname( MPI_Host, 1024 );
-
-         Note = fopen( FileName, "a" );
-         fprintf( Note, "%5d  %10s  %7d", MPI_Rank, MPI_Host, omp_nthread );
-         for (int t=0; t<omp_nthread; t++)   fprintf( Note, "  %6d", omp_core_id[t] );
-         fprintf( Note, "\n" );
-         fflush( Note );
-         fclose( Note );
-      }
+   char MPI_Host[1024];
+   gethostname( MPI_Host, 1024 );
 
-      MPI_Barrier( MPI_COMM_WORLD );
-   }
+   char  *OMPText = NULL;
+   size_t OMPSize = 0;
+   FILE  *OMPNote = open_memstream( &OMPText, &OMPSize );
+
+   fprintf( OMPNote, "%5d  %10s  %7d", MPI_Rank, MPI_Host, omp_nthread );
+   for (int t=0; t<omp_nthread; t++)   fprintf( OMPNote, "  %6d", omp_core_id[t] );
+   fprintf( OMPNote, "\n" );
+
+   WriteNote_AllRank( FileName, OMPNote, OMPText, OMPSize );
 
    delete [] omp_core_id;
 
@@ -1498,3 +1638,71 @@ int get_cpuid()
    return CPU;
 
 } // FUNCTION : get_cpuid
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteNote_AllRank
+// Description :  Collect the text of all ranks to rank 0 and append it to the note file in the order of ranks
+//
+// Note        :  1. Use a single MPI_Gatherv() instead of letting each rank append to the file in turn
+//                2. Text is written to a memory stream opened by open_memstream(), which is closed and freed here
+//                3. Must be invoked by all ranks
+//
+// Parameter   :  FileName : Name of the note file
+//                Stream   : Memory stream of the text of this rank
+//                Text     : Buffer of the memory stream
+//                Size     : Size of the memory stream
+//-------------------------------------------------------------------------------------------------------
+void WriteNote_AllRank( const char *FileName, FILE *Stream, char *&Text, size_t &Size )
+{
+
+   fclose( Stream );    // also update Text and Size
+
+   const int Size_ThisRank = (int)Size;
+   int *Size_AllRank = NULL, *Disp_AllRank = NULL;
+   char *Text_AllRank = NULL;
+
+   if ( MPI_Rank == 0 )
+   {
+      Size_AllRank = new int [MPI_NRank];
+      Disp_AllRank = new int [MPI_NRank];
+   }
+
+   MPI_Gather( &Size_ThisRank, 1, MPI_INT, Size_AllRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      long Size_Sum = 0;
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         Disp_AllRank[r] = (int)Size_Sum;
+         Size_Sum       += Size_AllRank[r];
+      }
+
+      if ( Size_Sum > (long)__INT_MAX__ )
+         Aux_Error( ERROR_INFO, "total size of the notes of all ranks (%ld) exceeds the limit of MPI_Gatherv() !!\n",
+                    Size_Sum );
+
+      Text_AllRank = new char [ MAX(Size_Sum, 1L) ];
+   }
+
+   MPI_Gatherv( Text, Size_ThisRank, MPI_CHAR, Text_AllRank, Size_AllRank, Disp_AllRank, MPI_CHAR, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *Note = fopen( FileName, "a" );
+      fwrite( Text_AllRank, sizeof(char), Disp_AllRank[MPI_NRank-1]+Size_AllRank[MPI_NRank-1], Note );
+      fclose( Note );
+
+      delete [] Size_AllRank;
+      delete [] Disp_AllRank;
+      delete [] Text_AllRank;
+   }
+
+   free( Text );
+   Text = NULL;
+   Size = 0;
+
+} // FUNCTION : WriteNote_AllRank
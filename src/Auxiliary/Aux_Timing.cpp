@@ -6,6 +6,14 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 #ifdef TIMING_SOLVER
 void Timing__Solver( const char FileName[] );
 #endif
+static void Timing__CriticalPath( const char FileName[] );
+#if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+static void Timing__ParCompressMPI( const char FileName[] );
+
+// defined in Par_LB_CompressParticleData.cpp
+extern double Par_CompressMPI_RawByte;
+extern double Par_CompressMPI_SentByte;
+#endif
 
 
 // global timing variables
@@ -27,6 +35,7 @@ extern Timer_t *Timer_Par_2Sib   [NLEVEL];
 extern Timer_t *Timer_Par_2Son   [NLEVEL];
 extern Timer_t *Timer_Par_Collect[NLEVEL];
 extern Timer_t *Timer_Par_MPI    [NLEVEL][6];
+extern Timer_t *Timer_GetBuf_Wait[NLEVEL];
 
 #ifdef TIMING_SOLVER
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
@@ -36,6 +45,8 @@ extern Timer_t *Timer_Poi_PreRho  [NLEVEL];
 extern Timer_t *Timer_Poi_PreFlu  [NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
+extern ThreadTimer_t *Timer_Pre_Thread[NLEVEL][NSOLVER];
+extern ThreadTimer_t *Timer_Clo_Thread[NLEVEL][NSOLVER];
 #endif
 
 // accumulated timing results
@@ -91,6 +102,7 @@ void Aux_CreateTimer()
       Timer_Par_2Son   [lv] = new Timer_t;
       Timer_Par_Collect[lv] = new Timer_t;
       for (int t=0; t<6; t++)    Timer_Par_MPI   [lv][t] = new Timer_t;
+      Timer_GetBuf_Wait[lv] = new Timer_t;
 
 #     ifdef TIMING_SOLVER
       for (int v=0; v<NSOLVER; v++)
@@ -98,6 +110,8 @@ void Aux_CreateTimer()
          Timer_Pre[lv][v]    = new Timer_t;
          Timer_Sol[lv][v]    = new Timer_t;
          Timer_Clo[lv][v]    = new Timer_t;
+         Timer_Pre_Thread[lv][v] = new ThreadTimer_t( OMP_NTHREAD );
+         Timer_Clo_Thread[lv][v] = new ThreadTimer_t( OMP_NTHREAD );
       }
       Timer_Poi_PreRho  [lv] = new Timer_t;
       Timer_Poi_PreFlu  [lv] = new Timer_t;
@@ -106,6 +120,10 @@ void Aux_CreateTimer()
 #     endif
    } // for (int lv=0; lv<NLEVEL; lv++)
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Init();
+#  endif
+
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
@@ -142,6 +160,7 @@ void Aux_DeleteTimer()
       delete Timer_Par_2Son   [lv];
       delete Timer_Par_Collect[lv];
       for (int t=0; t<6; t++)    delete Timer_Par_MPI   [lv][t];
+      delete Timer_GetBuf_Wait[lv];
 
 #     ifdef TIMING_SOLVER
       for (int v=0; v<NSOLVER; v++)
@@ -149,6 +168,8 @@ void Aux_DeleteTimer()
          delete Timer_Pre      [lv][v];
          delete Timer_Sol      [lv][v];
          delete Timer_Clo      [lv][v];
+         delete Timer_Pre_Thread[lv][v];
+         delete Timer_Clo_Thread[lv][v];
       }
       delete Timer_Poi_PreRho  [lv];
       delete Timer_Poi_PreFlu  [lv];
@@ -157,6 +178,10 @@ void Aux_DeleteTimer()
 #     endif
    }
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_End();
+#  endif
+
 } // FUNCTION : Aux_DeleteTimer
 
 
@@ -187,6 +212,7 @@ void Aux_ResetTimer()
       Timer_Par_2Son   [lv]->Reset();
       Timer_Par_Collect[lv]->Reset();
       for (int t=0; t<6; t++)    Timer_Par_MPI   [lv][t]->Reset();
+      Timer_GetBuf_Wait[lv]->Reset();
 
 #     ifdef TIMING_SOLVER
       for (int v=0; v<NSOLVER; v++)
@@ -194,6 +220,8 @@ void Aux_ResetTimer()
          Timer_Pre      [lv][v]->Reset();
          Timer_Sol      [lv][v]->Reset();
          Timer_Clo      [lv][v]->Reset();
+         Timer_Pre_Thread[lv][v]->Reset();
+         Timer_Clo_Thread[lv][v]->Reset();
       }
       Timer_Poi_PreRho  [lv]->Reset();
       Timer_Poi_PreFlu  [lv]->Reset();
@@ -202,6 +230,10 @@ void Aux_ResetTimer()
 #     endif
    }
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Reset();
+#  endif
+
 } // FUNCTION : Aux_ResetTimer
 
 
@@ -349,12 +381,22 @@ void Aux_Record_Timing()
    Timing__EvolveLevel( FileName, Time_LB_Main );
 
 
-// 3. GPU/CPU solvers
+// 3. critical path and load imbalance among ranks
+   Timing__CriticalPath( FileName );
+
+
+// 4. GPU/CPU solvers
 #  ifdef TIMING_SOLVER
    Timing__Solver( FileName );
 #  endif
 
 
+// 5. compression of the particle MPI data
+#  if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+   if ( amr->Par->CompressMPI != PAR_COMPRESS_MPI_NONE )    Timing__ParCompressMPI( FileName );
+#  endif
+
+
    if ( MPI_Rank == 0 )
    {
       FILE *File = fopen( FileName, "a" );
@@ -823,6 +865,143 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__CriticalPath
+// Description :  Record the rank on the critical path of each level and the load-balance diagnostics
+//
+// Note        :  1. Invoked by Aux_Record_Timing() regardless of OPT__TIMING_BALANCE and OPT__TIMING_BARRIER
+//                2. Busy time of a rank = time in the computation routines of EvolveLevel() excluding the MPI
+//                   routines (i.e., Buf_GetBufferData() and the particle MPI)
+//                   --> The rank with the longest busy time is on the critical path since all other ranks
+//                       eventually wait for it in the MPI routines
+//                3. Wait time = time blocked in MPI_Barrier()/MPI_Waitall() of LB_GetBufferData()
+//                   --> A large wait time of a rank other than the slowest one indicates that the imbalance,
+//                       rather than the bandwidth, dominates the MPI time
+//                4. Numbers of patches and particles are recorded at the time of calling this function
+//                5. Suggested LB_INPUT__PAR_WEIGHT (PARTICLE and LOAD_BALANCE only)
+//                   --> Fit the busy time of all ranks and levels by "Busy = A*NCell + B*NPar" using the
+//                       least squares, which gives the relative cost of one particle over one cell as B/A
+//                       (see LB_EstimateWorkload_AllPatchGroup())
+//                   --> Only shown when both A and B are positive and the fit is well conditioned
+//
+// Parameter   :  FileName : Name of the output file
+//-------------------------------------------------------------------------------------------------------
+void Timing__CriticalPath( const char FileName[] )
+{
+
+// 1. collect the busy time, MPI time, wait time, and the numbers of patches and particles of all ranks
+// --> Send[lv*NVar+v] and Recv[(r*NLEVEL+lv)*NVar+v], where v = 0/1/2/3/4 = busy/MPI/wait/NPatch/NPar
+   const int NVar = 5;
+   double  Send[ NLEVEL*NVar ];
+   double *Recv = ( MPI_Rank == 0 ) ? new double [ MPI_NRank*NLEVEL*NVar ] : NULL;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      double *Var    = Send + lv*NVar;
+      double  GetBuf = 0.0, ParMPI = 0.0;
+
+      for (int t=0; t<9; t++)    GetBuf += Timer_GetBuf [lv][t]->GetValue();
+      for (int t=0; t<6; t++)    ParMPI += Timer_Par_MPI[lv][t]->GetValue();
+
+//    Timer_Gra_Advance includes Timer_Par_Collect for lv > 0 (see Timing__EvolveLevel())
+      Var[0]  = Timer_dt         [lv]->GetValue() + Timer_Flu_Advance[lv]->GetValue() +
+                Timer_Gra_Advance[lv]->GetValue() + Timer_Che_Advance[lv]->GetValue() +
+                Timer_SF         [lv]->GetValue() + Timer_FixUp      [lv]->GetValue() +
+                Timer_Flag       [lv]->GetValue() + Timer_Refine     [lv]->GetValue() +
+                Timer_Par_Update [lv][0]->GetValue() + Timer_Par_Update[lv][1]->GetValue() +
+                Timer_Par_Update [lv][2]->GetValue() + Timer_Par_2Sib  [lv]->GetValue() +
+                Timer_Par_2Son   [lv]->GetValue() - ParMPI;
+      if ( lv == 0 )
+      Var[0] += Timer_Par_Collect[lv]->GetValue();
+      Var[1]  = GetBuf + ParMPI;
+      Var[2]  = Timer_GetBuf_Wait[lv]->GetValue();
+      Var[3]  = amr->NPatchComma[lv][1];
+#     ifdef PARTICLE
+      Var[4]  = amr->Par->NPar_Lv[lv];
+#     else
+      Var[4]  = 0.0;
+#     endif
+   }
+
+   MPI_Gather( Send, NLEVEL*NVar, MPI_DOUBLE, Recv, NLEVEL*NVar, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+
+// 2. analyze and output
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "Critical Path (Busy: computation time; MPI: Buf_GetBufferData + particle MPI; Wait: blocked in LB_GetBufferData)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%3s%9s%10s%10s%8s%12s%12s%11s%11s%10s%10s%10s%9s\n",
+               "Lv", "SlowRank", "Busy_Max", "Busy_Ave", "Imb", "NPatch_Slow", "NPatch_Ave", "NPar_Slow", "NPar_Ave",
+               "MPI_Slow", "MPI_Ave", "Wait_Max", "WaitRank" );
+
+//    normal equations of the least-squares fit "Busy = A*NCell + B*NPar"
+      double CC = 0.0, CP = 0.0, PP = 0.0, CT = 0.0, PT = 0.0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         int    SlowRank = 0, WaitRank = 0;
+         double Ave[NVar];
+
+         for (int v=0; v<NVar; v++)    Ave[v] = 0.0;
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            const double *Var = Recv + ( r*NLEVEL + lv )*NVar;
+
+            for (int v=0; v<NVar; v++)    Ave[v] += Var[v] / MPI_NRank;
+
+            if ( Var[0] > Recv[ ( SlowRank*NLEVEL + lv )*NVar + 0 ] )  SlowRank = r;
+            if ( Var[2] > Recv[ ( WaitRank*NLEVEL + lv )*NVar + 2 ] )  WaitRank = r;
+
+            const double NCell = Var[3]*CUBE( PS1 );
+            CC += NCell *NCell;
+            CP += NCell *Var[4];
+            PP += Var[4]*Var[4];
+            CT += NCell *Var[0];
+            PT += Var[4]*Var[0];
+         }
+
+         const double *Slow = Recv + ( SlowRank*NLEVEL + lv )*NVar;
+
+         if ( Ave[3] == 0.0 )    continue;
+
+         fprintf( File, "%3d%9d%10.4f%10.4f%7.1f%%%12d%12.1f%11ld%11.1f%10.4f%10.4f%10.4f%9d\n",
+                  lv, SlowRank, Slow[0], Ave[0], ( Ave[0] > 0.0 ) ? 100.0*( Slow[0]/Ave[0] - 1.0 ) : 0.0,
+                  (int)Slow[3], Ave[3], (long)Slow[4], Ave[4], Slow[1], Ave[1], Recv[ ( WaitRank*NLEVEL + lv )*NVar + 2 ], WaitRank );
+      } // for (int lv=0; lv<NLEVEL; lv++)
+
+#     if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+      const double Det = CC*PP - CP*CP;
+
+      if ( Det > 1.0e-6*CC*PP  &&  Det > 0.0 )
+      {
+         const double A = ( CT*PP - PT*CP ) / Det;
+         const double B = ( PT*CC - CT*CP ) / Det;
+
+         if ( A > 0.0  &&  B > 0.0 )
+            fprintf( File, "Suggested LB_INPUT__PAR_WEIGHT = %13.7e (current = %13.7e)\n", B/A, LB_INPUT__PAR_WEIGHT );
+         else
+            fprintf( File, "Suggested LB_INPUT__PAR_WEIGHT = N/A (fitted costs per cell/particle = %13.7e/%13.7e)\n", A, B );
+      }
+      else
+         fprintf( File, "Suggested LB_INPUT__PAR_WEIGHT = N/A (cell and particle counts are degenerate among ranks)\n" );
+#     endif
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+
+      delete [] Recv;
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Timing__CriticalPath
+
+
+
 #ifdef TIMING_SOLVER
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Timing__Solver
@@ -924,11 +1103,123 @@ void Timing__Solver( const char FileName[] )
       fclose( File );
    } // if ( MPI_Rank == 0 )
 
+
+// per-thread time in the preparation and closing steps
+// --> min/max over all threads of all ranks and the average over all threads of all ranks
+   const char  *SolverName[NSOLVER] = { "Flu", "Poi", "Gra", "PoiGra", "Che", "dtFlu", "dtGra" };
+   ThreadTimer_t *(*ThreadTimer[2])[NSOLVER] = { Timer_Pre_Thread, Timer_Clo_Thread };
+   double Thd_loc[2][3][NLEVEL][NSOLVER], Thd_min[2][NLEVEL][NSOLVER], Thd_sum[2][NLEVEL][NSOLVER], Thd_max[2][NLEVEL][NSOLVER];
+
+   for (int s=0; s<2; s++)
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int v=0; v<NSOLVER; v++)
+   {
+      const ThreadTimer_t *TT = ThreadTimer[s][lv][v];
+
+      Thd_loc[s][0][lv][v] = HUGE_NUMBER;
+      Thd_loc[s][1][lv][v] = 0.0;
+      Thd_loc[s][2][lv][v] = 0.0;
+
+      for (int t=0; t<TT->NThread; t++)
+      {
+         const double TThd = TT->Slot[t].Time*1.0e-9;
+
+         Thd_loc[s][0][lv][v]  = MIN( Thd_loc[s][0][lv][v], TThd );
+         Thd_loc[s][1][lv][v] += TThd / TT->NThread;
+         Thd_loc[s][2][lv][v]  = MAX( Thd_loc[s][2][lv][v], TThd );
+      }
+   }
+
+   for (int s=0; s<2; s++)
+   {
+      MPI_Reduce( Thd_loc[s][0][0], Thd_min[s][0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD );
+      MPI_Reduce( Thd_loc[s][1][0], Thd_sum[s][0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      MPI_Reduce( Thd_loc[s][2][0], Thd_max[s][0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   }
+
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "OpenMP threads in the preparation (Pre) and closing (Clo) steps (busy time of each thread, imbalance = Max/Ave-1)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%3s%8s%10s%10s%10s%10s%10s%10s%10s%10s\n",
+               "Lv", "Solver", "Pre_Min", "Pre_Ave", "Pre_Max", "Pre_Imb", "Clo_Min", "Clo_Ave", "Clo_Max", "Clo_Imb" );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int v=0; v<NSOLVER; v++)
+      {
+         double Ave[2];
+
+         for (int s=0; s<2; s++)    Ave[s] = Thd_sum[s][lv][v] / MPI_NRank;
+
+//       skip solvers not invoked on this level
+         if ( Thd_max[0][lv][v] == 0.0  &&  Thd_max[1][lv][v] == 0.0 )  continue;
+
+         fprintf( File, "%3d%8s", lv, SolverName[v] );
+
+         for (int s=0; s<2; s++)
+            fprintf( File, "%10.4f%10.4f%10.4f%9.1f%%", Thd_min[s][lv][v], Ave[s], Thd_max[s][lv][v],
+                     ( Ave[s] > 0.0 ) ? 100.0*( Thd_max[s][lv][v]/Ave[s] - 1.0 ) : 0.0 );
+
+         fprintf( File, "\n" );
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+
+// hardware counters
+   Aux_PerfCounter_Record( FileName );
+
 } // FUNCTION : TimingSolver
 #endif // TIMING_SOLVER
 
 
 
+#if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__ParCompressMPI
+// Description :  Record the number of bytes saved by PAR_COMPRESS_MPI since the last record
+//
+// Note        :  1. Counters are accumulated by Par_LB_SendParticleData() and summed over all ranks
+//                2. Counters are reset after being recorded
+//-------------------------------------------------------------------------------------------------------
+void Timing__ParCompressMPI( const char FileName[] )
+{
+
+   double Send[2] = { Par_CompressMPI_RawByte, Par_CompressMPI_SentByte };
+   double Recv[2];
+
+   MPI_Reduce( Send, Recv, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "Particle MPI Compression\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%14s%14s%14s%10s\n", "Raw(MB)", "Sent(MB)", "Saved(MB)", "Ratio" );
+      fprintf( File, "%14.3f%14.3f%14.3f%10.3f\n", Recv[0]*1.0e-6, Recv[1]*1.0e-6, (Recv[0]-Recv[1])*1.0e-6,
+               ( Recv[1] > 0.0 ) ? Recv[0]/Recv[1] : 1.0 );
+      fprintf( File, "\n\n" );
+
+      fclose( File );
+   }
+
+   Par_CompressMPI_RawByte  = 0.0;
+   Par_CompressMPI_SentByte = 0.0;
+
+} // FUNCTION : Timing__ParCompressMPI
+#endif // #if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Aux_AccumulatedTiming
 // Description :  Record the accumulated timing results (in second)
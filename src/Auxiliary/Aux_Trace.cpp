@@ -0,0 +1,222 @@
+#include "GAMER.h"
+
+#ifdef TIMING
+
+
+
+// structure of a single event
+struct TraceEvent_t
+{
+   const char *Call;    // stringified function call (string literal --> no need to copy)
+   long        T0;      // start time relative to Trace_TRef (in nanoseconds)
+   long        Dur;     // duration (in nanoseconds)
+   long        Step;    // root-level step when the event ends
+   int         Lv;      // target level (NULL_INT if unknown)
+};
+
+static void WriteName( FILE *File, const char *Call, const bool NameOnly );
+
+// ring buffer of the most recent events
+static TraceEvent_t *Trace_Event  = NULL;
+static long          Trace_NEvent = 0;     // total number of events recorded so far (including overwritten ones)
+static long          Trace_TRef   = 0;     // reference time shared by all ranks (in nanoseconds)
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Init
+// Description :  Allocate the ring buffer of the event tracer and set the reference time
+//
+// Note        :  1. Work with the runtime option "OPT__TRACE"
+//                2. Invoked by Init_GAMER()
+//                3. All ranks synchronize before setting the reference time so that the timelines of different
+//                   ranks can be compared directly
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Init()
+{
+
+   if ( !OPT__TRACE )   return;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+   Trace_Event  = new TraceEvent_t [TRACE_NEVENT];
+   Trace_NEvent = 0;
+
+   MPI_Barrier( MPI_COMM_WORLD );
+   Trace_TRef   = ThreadTimer_t::GetNanoSec();
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Aux_Trace_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Record
+// Description :  Record a completed event in the ring buffer
+//
+// Note        :  1. Invoked by the macro TIMING_FUNC() for all timed code sections and explicitly by a few
+//                   other routines (e.g., EvolveLevel() and InvokeSolver())
+//                2. Must be invoked outside OpenMP parallel regions
+//                3. The oldest event is overwritten when the buffer is full
+//                   --> Memory consumption is fixed to TRACE_NEVENT events per rank
+//                4. Record complete events (i.e., start time + duration) instead of separate begin/end events
+//                   so that overwriting old events never leaves unmatched pairs in the buffer
+//
+// Parameter   :  Call : Stringified function call
+//                       --> Must be a string literal or have a static lifetime
+//                Lv   : Target level (NULL_INT if unknown)
+//                T0   : Start time returned by ThreadTimer_t::GetNanoSec()
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Record( const char *Call, const int Lv, const long T0 )
+{
+
+   if ( Trace_Event == NULL )    return;
+
+   const long    T1    = ThreadTimer_t::GetNanoSec();
+   TraceEvent_t *Event = Trace_Event + ( Trace_NEvent % TRACE_NEVENT );
+
+   Event->Call = Call;
+   Event->T0   = T0 - Trace_TRef;
+   Event->Dur  = T1 - T0;
+   Event->Step = Step;
+   Event->Lv   = Lv;
+
+   Trace_NEvent ++;
+
+} // FUNCTION : Aux_Trace_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Dump
+// Description :  Write the events in the ring buffer to the file "Trace_RankXXXXXX.json"
+//
+// Note        :  1. Chrome trace event format (JSON), which can be loaded by Perfetto (ui.perfetto.dev) and
+//                   chrome://tracing
+//                   --> Each rank writes its own file, where pid = MPI rank
+//                   --> Files of different ranks can be merged by concatenating their "traceEvents" arrays
+//                2. Invoked on each data dump and at the end of the simulation
+//                   --> The file is overwritten each time and always contains the latest TRACE_NEVENT events
+//                3. Timestamps are in microseconds relative to the reference time set by Aux_Trace_Init()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Dump()
+{
+
+   if ( Trace_Event == NULL )    return;
+
+   char FileName[MAX_STRING];
+   sprintf( FileName, "Trace_Rank%06d.json", MPI_Rank );
+
+   FILE *File = fopen( FileName, "w" );
+
+   if ( File == NULL )
+   {
+      Aux_Message( stderr, "WARNING : failed to open the trace file \"%s\" !!\n", FileName );
+      return;
+   }
+
+
+// metadata
+   fprintf( File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+   fprintf( File, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"Rank %d\"}},\n",
+            MPI_Rank, MPI_Rank );
+   fprintf( File, "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"sort_index\":%d}}",
+            MPI_Rank, MPI_Rank );
+
+
+// events from the oldest to the latest
+   const long NEvent = MIN( Trace_NEvent, (long)TRACE_NEVENT );
+
+   for (long e=Trace_NEvent-NEvent; e<Trace_NEvent; e++)
+   {
+      const TraceEvent_t *Event = Trace_Event + ( e % TRACE_NEVENT );
+
+      fprintf( File, ",\n{\"name\":\"" );
+      WriteName( File, Event->Call, true );
+      fprintf( File, "\",\"cat\":\"gamer\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":0,"
+                     "\"args\":{\"step\":%ld,", Event->T0*1.0e-3, Event->Dur*1.0e-3, MPI_Rank, Event->Step );
+      if ( Event->Lv != NULL_INT )  fprintf( File, "\"lv\":%d,", Event->Lv );
+      fprintf( File, "\"call\":\"" );
+      WriteName( File, Event->Call, false );
+      fprintf( File, "\"}}" );
+   }
+
+   fprintf( File, "\n]}\n" );
+
+   fclose( File );
+
+} // FUNCTION : Aux_Trace_Dump
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_End
+// Description :  Write the final trace file and free the ring buffer
+//
+// Note        :  Invoked by End_GAMER()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_End()
+{
+
+   if ( Trace_Event == NULL )    return;
+
+   Aux_Trace_Dump();
+
+   delete [] Trace_Event;
+   Trace_Event = NULL;
+
+} // FUNCTION : Aux_Trace_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteName
+// Description :  Write the name of an event as a JSON string (without the enclosing quotes)
+//
+// Note        :  1. Characters '"' and '\' are escaped
+//                2. For NameOnly, only write the function name
+//                   --> e.g., "FluStatus = Flu_AdvanceDt( lv, ... )" --> "Flu_AdvanceDt"
+//
+// Parameter   :  File     : Target file
+//                Call     : Stringified function call
+//                NameOnly : Write only the function name
+//-------------------------------------------------------------------------------------------------------
+void WriteName( FILE *File, const char *Call, const bool NameOnly )
+{
+
+   const char *Start = Call;
+   const char *End   = Call + strlen( Call );
+
+   if ( NameOnly )
+   {
+      const char *Paren  = strchr( Call, '(' );
+      const char *Assign = strchr( Call, '=' );
+
+      if ( Paren  != NULL )                      End   = Paren;
+      if ( Assign != NULL  &&  Assign < End )    Start = Assign + 1;
+
+      while ( Start < End  &&  *Start  == ' ' )  Start ++;
+      while ( End > Start  &&  End[-1] == ' ' )  End   --;
+   }
+
+   for (const char *c=Start; c<End; c++)
+   {
+      if ( *c == '"'  ||  *c == '\\' )    fputc( '\\', File );
+      fputc( *c, File );
+   }
+
+} // FUNCTION : WriteName
+
+
+
+#endif // #ifdef TIMING
@@ -26,6 +26,8 @@
 //                                 DATA_AFTER_FIXUP     : subset of DATA_GENERAL after fix-up
 //                                 DATA_RESTRICT        : restricted data of the father patches with sons not home
 //                                                        --> useful in LOAD_BALANCE only
+//                                 DATA_RESTRICT_FLUX   : DATA_RESTRICT + COARSE_FINE_FLUX in a single exchange
+//                                                        --> useful in LOAD_BALANCE only
 //                                 POT_FOR_POISSON      : potential for the Poisson solver
 //                                 POT_AFTER_REFINE     : potential after refine for the Poisson solver
 //                                 COARSE_FINE_FLUX     : fluxes across the coarse-fine boundaries (HYDRO ONLY)
@@ -56,6 +58,10 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
                         const long TVarCC, const long TVarFC, const int ParaBuf, const UseLBFunc_t UseLBFunc )
 {
 
+// the interpolated ghost zones cached by Prepare_PatchData() at lv+1 may no longer be valid
+   Prepare_PatchData_InvalidateGhostCache( lv );
+
+
 // invoke the alternative load-balance function
 #  ifdef LOAD_BALANCE
    if ( UseLBFunc == USELB_YES )
@@ -70,8 +76,8 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
    if ( lv < 0  ||  lv >= NLEVEL )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
-   if ( GetBufMode == DATA_RESTRICT )
-      Aux_Error( ERROR_INFO, "mode DATA_RESTRICT is useful only in LOAD_BALANCE !!\n" );
+   if ( GetBufMode == DATA_RESTRICT  ||  GetBufMode == DATA_RESTRICT_FLUX )
+      Aux_Error( ERROR_INFO, "modes DATA_RESTRICT and DATA_RESTRICT_FLUX are useful only in LOAD_BALANCE !!\n" );
 
    if (  GetBufMode != COARSE_FINE_FLUX  &&  ( TVarCC & _TOTAL )  &&  ( FluSg != 0 && FluSg != 1 )  )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "FluSg", FluSg );
@@ -159,6 +165,7 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
 
    int LoopWidth[3], Disp[2][3], Sib, MirSib, TRank[2];
    int SendSize[2], RecvSize[2], PID, Counter;
+   bool SelfExchange;
    real *SendBuffer[2] = { NULL, NULL };
    real *RecvBuffer[2] = { NULL, NULL };
    real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
@@ -172,6 +179,11 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
 //    ==================================================================================================
       for (int d=0; d<3; d++)    LoopWidth[d] = TABLE_01( TSibList[s], 'x'+d, ParaBuf, PATCH_SIZE, ParaBuf );
 
+//    both opposite sibling ranks are this rank (e.g., periodic directions not decomposed among ranks)
+//    --> SendBuffer[1-t] is exactly the data to be received in RecvBuffer[t] (see the tags in MPI_ExchangeData)
+//    --> unpack directly from SendBuffer to skip the receive buffers and the MPI self-messages
+      SelfExchange = ( MPI_SibRank[ TSibList[s] ] == MPI_Rank  &&  MPI_SibRank[ TSibList[s+1] ] == MPI_Rank );
+
       for (int t=0; t<2; t++)
       {
          Sib      = TSibList[s+t];
@@ -188,9 +200,17 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
                        amr->ParaVar->RecvP_NList[lv][Sib]*LoopWidth[0]*LoopWidth[1]*LoopWidth[2]*NVar_Tot;
 
          SendBuffer[t] = new real [ SendSize[t] ];
-         RecvBuffer[t] = new real [ RecvSize[t] ];
+         RecvBuffer[t] = ( SelfExchange ) ? NULL : new real [ RecvSize[t] ];
       } // for (int t=0; t<2; t++)
 
+#     ifdef GAMER_DEBUG
+      if ( SelfExchange )
+      for (int t=0; t<2; t++)
+         if ( RecvSize[t] != SendSize[1-t] )
+            Aux_Error( ERROR_INFO, "RecvSize[%d] (%d) != SendSize[%d] (%d) for the self-exchange (lv %d, sib %d) !!\n",
+                       t, RecvSize[t], 1-t, SendSize[1-t], lv, TSibList[s+t] );
+#     endif
+
 
 //    2. copy data into SendBuffer
 //    ==================================================================================================
@@ -266,7 +286,14 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
 
 //    3. transfer data between different ranks
 //    ==================================================================================================
-      MPI_ExchangeData( TRank, SendSize, RecvSize, SendBuffer, RecvBuffer );
+      if ( SelfExchange )
+      {
+         RecvBuffer[0] = SendBuffer[1];
+         RecvBuffer[1] = SendBuffer[0];
+      }
+
+      else
+         MPI_ExchangeData( TRank, SendSize, RecvSize, SendBuffer, RecvBuffer );
 
 
 //    4. copy data from RecvBuffer back to the amr->patch pointer
@@ -321,13 +348,20 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
                   PID     = amr->ParaVar->RecvF_IDList[lv][Sib][TID];
                   FluxPtr = amr->patch[0][lv][PID]->flux[Sib];
 
+//                add (not replace) flux array with the received flux
+//                --> replace it for BIT_REP_FLUX since the buffer fluxes have been initialized as the coarse-grid
+//                    fluxes by Buf_SeedBufferFlux()
                   for (int v=0; v<NVar_Flu; v++)
                   {
                      TFluVarIdx = TFluVarIdxList[v];
 
                      for (int m=0; m<PATCH_SIZE; m++)
                      for (int n=0; n<PATCH_SIZE; n++)
+#                       ifdef BIT_REP_FLUX
+                        FluxPtr[TFluVarIdx][m][n]  = RecvBuffer[t][ Counter ++ ];
+#                       else
                         FluxPtr[TFluVarIdx][m][n] += RecvBuffer[t][ Counter ++ ];
+#                       endif
                   }
                } // for (int TID=0; TID<amr->ParaVar->RecvF_NList[lv][Sib]; TID++)
                break; // case COARSE_FINE_FLUX :
@@ -342,7 +376,7 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
       for (int t=0; t<2; t++)
       {
          delete [] SendBuffer[t];
-         delete [] RecvBuffer[t];
+         if ( !SelfExchange )    delete [] RecvBuffer[t];
       }
 
    } // for (int s=0; s<MaxSib; s+=2)
@@ -351,4 +385,36 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Buf_GetBufferData_Batch
+// Description :  Perform multiple Buf_GetBufferData() requests together
+//
+// Note        :  1. For LOAD_BALANCE, all requests are exchanged by LB_GetBufferData_Batch() with a single
+//                   message between each pair of ranks
+//                   --> Otherwise, invoke Buf_GetBufferData() for each request in order
+//                2. Equivalent to invoking Buf_GetBufferData() with UseLBFunc=USELB_YES for each request
+//                   --> Requests must be independent of each other (see LB_GetBufferData_Batch())
+//
+// Parameter   :  NBatch    : Number of requests
+//                BatchList : Request list
+//-------------------------------------------------------------------------------------------------------
+void Buf_GetBufferData_Batch( const int NBatch, const GetBufReq_t *BatchList )
+{
+
+#  ifdef LOAD_BALANCE
+   LB_GetBufferData_Batch( NBatch, BatchList );
+
+#  else
+   for (int b=0; b<NBatch; b++)
+   {
+      const GetBufReq_t *R = BatchList + b;
+
+      Buf_GetBufferData( R->lv, R->FluSg, R->MagSg, R->PotSg, R->GetBufMode, R->TVarCC, R->TVarFC, R->ParaBuf, USELB_YES );
+   }
+#  endif
+
+} // FUNCTION : Buf_GetBufferData_Batch
+
+
+
 #endif // #ifndef SERIAL
@@ -0,0 +1,121 @@
+#include "GAMER.h"
+
+#if ( !defined SERIAL  &&  !defined LOAD_BALANCE  &&  defined BIT_REP_FLUX )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Buf_SeedBufferFlux
+// Description :  Initialize the fluxes in the buffer patches as the coarse-grid fluxes stored in the
+//                corresponding real patches
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() for BIT_REP_FLUX after the coarse-grid fluxes have been stored
+//                   by StoreFlux() and the buffer fluxes have been reset by Buf_ResetBufferFlux()
+//                2. Counterpart of LB_SeedBufferFlux() for the non-load-balance MPI mode
+//                   --> Buf_GetBufferData() with COARSE_FINE_FLUX then replaces (instead of adds to) the
+//                       real-patch fluxes with the received fluxes
+//                3. Use the same MPI lists as COARSE_FINE_FLUX but with the send and recv sides swapped
+//                   --> Sending from amr->ParaVar->RecvF_IDList[] and receiving into amr->ParaVar->SendF_IDList[]
+//
+// Parameter   :  lv : Target coarse level
+//-------------------------------------------------------------------------------------------------------
+void Buf_SeedBufferFlux( const int lv )
+{
+
+// check
+   if ( !amr->WithFlux )
+   {
+      Aux_Message( stderr, "WARNING : invoking %s is useless since no flux is required !!\n", __FUNCTION__ );
+      return;
+   }
+
+
+// nothing to do on the highest level
+   if ( lv == TOP_LEVEL )  return;
+
+
+   const int DataUnit = NFLUX_TOTAL*SQR( PS1 );
+
+   int Sib, MirSib, TRank[2], SendSize[2], RecvSize[2];
+   bool SelfExchange;
+   real *SendBuffer[2] = { NULL, NULL };
+   real *RecvBuffer[2] = { NULL, NULL };
+
+
+// loop over all target sibling directions (two opposite directions at a time)
+   for (int s=0; s<6; s+=2)
+   {
+
+//    1. allocate SendBuffer and RecvBuffer
+//    ==================================================================================================
+      SelfExchange = ( MPI_SibRank[s] == MPI_Rank  &&  MPI_SibRank[s+1] == MPI_Rank );
+
+      for (int t=0; t<2; t++)
+      {
+         Sib      = s + t;
+         TRank[t] = MPI_SibRank[Sib];
+
+         SendSize[t] = amr->ParaVar->RecvF_NList[lv][Sib]*DataUnit;
+         RecvSize[t] = amr->ParaVar->SendF_NList[lv][Sib]*DataUnit;
+
+         SendBuffer[t] = new real [ SendSize[t] ];
+         RecvBuffer[t] = ( SelfExchange ) ? NULL : new real [ RecvSize[t] ];
+      }
+
+
+//    2. copy the coarse-grid fluxes of the real patches into SendBuffer
+//    ==================================================================================================
+      for (int t=0; t<2; t++)
+      {
+         Sib = s + t;
+
+         for (int TID=0; TID<amr->ParaVar->RecvF_NList[lv][Sib]; TID++)
+         {
+            const int PID = amr->ParaVar->RecvF_IDList[lv][Sib][TID];
+
+            memcpy( SendBuffer[t] + TID*DataUnit, amr->patch[0][lv][PID]->flux[Sib], DataUnit*sizeof(real) );
+         }
+      }
+
+
+//    3. transfer data between different ranks
+//    ==================================================================================================
+      if ( SelfExchange )
+      {
+         RecvBuffer[0] = SendBuffer[1];
+         RecvBuffer[1] = SendBuffer[0];
+      }
+
+      else
+         MPI_ExchangeData( TRank, SendSize, RecvSize, SendBuffer, RecvBuffer );
+
+
+//    4. store the received coarse-grid fluxes in the buffer patches
+//    ==================================================================================================
+      for (int t=0; t<2; t++)
+      {
+         Sib    = s + t;
+         MirSib = s - t + 1;
+
+         for (int TID=0; TID<amr->ParaVar->SendF_NList[lv][Sib]; TID++)
+         {
+            const int PID = amr->ParaVar->SendF_IDList[lv][Sib][TID];
+
+            memcpy( amr->patch[0][lv][PID]->flux[MirSib], RecvBuffer[t] + TID*DataUnit, DataUnit*sizeof(real) );
+         }
+      }
+
+      for (int t=0; t<2; t++)
+      {
+         delete [] SendBuffer[t];
+         if ( !SelfExchange )    delete [] RecvBuffer[t];
+      }
+
+   } // for (int s=0; s<6; s+=2)
+
+} // FUNCTION : Buf_SeedBufferFlux
+
+
+
+#endif // #if ( !defined SERIAL  &&  !defined LOAD_BALANCE  &&  defined BIT_REP_FLUX )
@@ -100,7 +100,7 @@ static real EoS_DensEint2Pres_Gamma( const real Dens, const real Eint, const rea
 #  endif // GAMER_DEBUG
 
 
-   const real Gamma_m1 = (real)AuxArray[1];
+   const real Gamma_m1 = (real)EOS_AUX_GAMMA_M1(AuxArray);
    real Pres;
 
    Pres = Eint * Gamma_m1;
@@ -142,7 +142,7 @@ static real EoS_DensPres2Eint_Gamma( const real Dens, const real Pres, const rea
 #  endif // GAMER_DEBUG
 
 
-   const real _Gamma_m1 = (real)AuxArray[2];
+   const real _Gamma_m1 = (real)EOS_AUX__GAMMA_M1(AuxArray);
    real Eint;
 
    Eint = Pres * _Gamma_m1;
@@ -184,7 +184,7 @@ static real EoS_DensPres2CSqr_Gamma( const real Dens, const real Pres, const rea
 #  endif // GAMER_DEBUG
 
 
-   const real Gamma = (real)AuxArray[0];
+   const real Gamma = (real)EOS_AUX_GAMMA(AuxArray);
    real Cs2;
 
    Cs2 = Gamma * Pres / Dens;
@@ -0,0 +1,570 @@
+#include "CUFLU.h"
+
+#if ( MODEL == HYDRO  &&  EOS == EOS_TABULAR )
+
+
+
+/********************************************************
+1. Tabulated EoS (EOS_TABULAR)
+   --> Pressure, specific internal energy, and sound speed
+       squared tabulated as functions of density and
+       temperature
+
+2. Only supported by the CPU solvers
+
+3. Three steps are required to implement an EoS
+
+   I.   Set an EoS auxiliary array
+   II.  Implement EoS conversion functions
+   III. Set EoS initialization functions
+
+4. The table is loaded from EOS_TABLE_NAME by EoS_Init_Tabular()
+   and stored in EoS_Table[] (see EoS_LoadTable_Tabular())
+   --> Read-only afterwards and thus thread-safe
+
+5. When an EoS conversion function fails (e.g., non-positive
+   input), it returns NAN in order to trigger auto-correction
+   such as "OPT__1ST_FLUX_CORR" and "AUTO_REDUCE_DT"
+********************************************************/
+
+
+
+// variables stored at each table node
+// --> all variables of a node are stored contiguously and nodes of the same density are stored with
+//     temperature varying fastest so that each lookup touches only a few cache lines
+#define EOS_TABLE_PRES     0     // ln(pressure)
+#define EOS_TABLE_EINT     1     // ln(specific internal energy)
+#define EOS_TABLE_CSQR     2     // ln(sound speed squared)
+#define EOS_TABLE_NVAR     3
+
+// index of each column in AuxArray[]
+#define EOS_TABLE_AUX_NDENS      0     // number of density points
+#define EOS_TABLE_AUX_NTEMP      1     // number of temperature points
+#define EOS_TABLE_AUX_LNDENS0    2     // ln(density) of the first density point
+#define EOS_TABLE_AUX__DLNDENS   3     // 1/(ln(density) spacing)
+
+
+static void EoS_Table_DensStencil( int &IdxD, real &WD, const real Dens, const double AuxArray[] );
+static real EoS_Table_InvertTemp( int &IdxT, const real LnVal, const int Var, const int IdxD, const real WD,
+                                  const double AuxArray[] );
+static real EoS_Table_Interp( const int Var, const int IdxD, const real WD, const int IdxT, const real WT,
+                              const double AuxArray[] );
+static real EoS_Table_Fetch( const int Idx );
+
+
+
+// =============================================
+// I. Set an EoS auxiliary array
+// =============================================
+
+// table dimensions set by EoS_LoadTable_Tabular()
+static int    EoS_Table_NDens, EoS_Table_NTemp;
+static double EoS_Table_LnDens0, EoS_Table_dLnDens;
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_SetAuxArray_Tabular
+// Description :  Set the auxiliary array AuxArray[]
+//
+//                   AuxArray[0] = number of density points
+//                   AuxArray[1] = number of temperature points
+//                   AuxArray[2] = ln(density) of the first density point
+//                   AuxArray[3] = 1/(ln(density) spacing)
+//
+// Note        :  1. Invoked by EoS_Init_Tabular()
+//                   --> Table must be loaded in advance by EoS_LoadTable_Tabular()
+//                2. AuxArray[] has the size of EOS_NAUX_MAX defined in Macro.h (default = 10)
+//
+// Parameter   :  AuxArray : Array to be filled up
+//
+// Return      :  AuxArray[]
+//-------------------------------------------------------------------------------------------------------
+void EoS_SetAuxArray_Tabular( double AuxArray[] )
+{
+
+   AuxArray[EOS_TABLE_AUX_NDENS   ] = (double)EoS_Table_NDens;
+   AuxArray[EOS_TABLE_AUX_NTEMP   ] = (double)EoS_Table_NTemp;
+   AuxArray[EOS_TABLE_AUX_LNDENS0 ] = EoS_Table_LnDens0;
+   AuxArray[EOS_TABLE_AUX__DLNDENS] = 1.0 / EoS_Table_dLnDens;
+
+} // FUNCTION : EoS_SetAuxArray_Tabular
+
+
+
+// =============================================
+// II. Implement EoS conversion functions
+//     (1) EoS_DensEint2Pres_*
+//     (2) EoS_DensPres2Eint_*
+//     (3) EoS_DensPres2CSqr_*
+// =============================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Pres_Tabular
+// Description :  Convert gas mass density and internal energy density to gas pressure
+//
+// Note        :  1. Internal energy density here is per unit volume instead of per unit mass
+//                2. See EoS_SetAuxArray_Tabular() for the values stored in AuxArray[]
+//                3. Bilinear interpolation in ln(density) and ln(temperature)
+//                   --> Temperature is found by inverting ln(specific internal energy) at the given density
+//                       (see EoS_Table_InvertTemp())
+//                   --> Power-law extrapolation outside the table
+//
+// Parameter   :  Dens     : Gas mass density
+//                Eint     : Gas internal energy density
+//                Passive  : Passive scalars (must not used here)
+//                AuxArray : Auxiliary array (see the Note above)
+//
+// Return      :  Gas pressure
+//-------------------------------------------------------------------------------------------------------
+static real EoS_DensEint2Pres_Tabular( const real Dens, const real Eint, const real Passive[], const double AuxArray[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray == NULL )    printf( "ERROR : AuxArray == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Eint) )
+      printf( "ERROR : invalid input internal energy (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Eint, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxT;
+   real WD, WT, Pres;
+
+   if ( Dens <= (real)0.0  ||  Eint <= (real)0.0 )    return NAN;
+
+   EoS_Table_DensStencil( IdxD, WD, Dens, AuxArray );
+   WT   = EoS_Table_InvertTemp( IdxT, LOG(Eint/Dens), EOS_TABLE_EINT, IdxD, WD, AuxArray );
+   Pres = EXP(  EoS_Table_Interp( EOS_TABLE_PRES, IdxD, WD, IdxT, WT, AuxArray )  );
+
+   return Pres;
+
+} // FUNCTION : EoS_DensEint2Pres_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2Eint_Tabular
+// Description :  Convert gas mass density and pressure to gas internal energy density
+//
+// Note        :  1. See EoS_DensEint2Pres_Tabular()
+//
+// Parameter   :  Dens     : Gas mass density
+//                Pres     : Gas pressure
+//                Passive  : Passive scalars (must not used here)
+//                AuxArray : Auxiliary array (see the Note above)
+//
+// Return      :  Gas internal energy density
+//-------------------------------------------------------------------------------------------------------
+static real EoS_DensPres2Eint_Tabular( const real Dens, const real Pres, const real Passive[], const double AuxArray[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray == NULL )    printf( "ERROR : AuxArray == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Pres) )
+      printf( "ERROR : invalid input pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Pres, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxT;
+   real WD, WT, Eint;
+
+   if ( Dens <= (real)0.0  ||  Pres <= (real)0.0 )    return NAN;
+
+   EoS_Table_DensStencil( IdxD, WD, Dens, AuxArray );
+   WT   = EoS_Table_InvertTemp( IdxT, LOG(Pres), EOS_TABLE_PRES, IdxD, WD, AuxArray );
+   Eint = Dens*EXP(  EoS_Table_Interp( EOS_TABLE_EINT, IdxD, WD, IdxT, WT, AuxArray )  );
+
+   return Eint;
+
+} // FUNCTION : EoS_DensPres2Eint_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2CSqr_Tabular
+// Description :  Convert gas mass density and pressure to sound speed squared
+//
+// Note        :  1. See EoS_DensEint2Pres_Tabular()
+//
+// Parameter   :  Dens     : Gas mass density
+//                Pres     : Gas pressure
+//                Passive  : Passive scalars (must not used here)
+//                AuxArray : Auxiliary array (see the Note above)
+//
+// Return      :  Sound speed square
+//-------------------------------------------------------------------------------------------------------
+static real EoS_DensPres2CSqr_Tabular( const real Dens, const real Pres, const real Passive[], const double AuxArray[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray == NULL )    printf( "ERROR : AuxArray == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Pres) )
+      printf( "ERROR : invalid input pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Pres, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxT;
+   real WD, WT, Cs2;
+
+   if ( Dens <= (real)0.0  ||  Pres <= (real)0.0 )    return NAN;
+
+   EoS_Table_DensStencil( IdxD, WD, Dens, AuxArray );
+   WT  = EoS_Table_InvertTemp( IdxT, LOG(Pres), EOS_TABLE_PRES, IdxD, WD, AuxArray );
+   Cs2 = EXP(  EoS_Table_Interp( EOS_TABLE_CSQR, IdxD, WD, IdxT, WT, AuxArray )  );
+
+   return Cs2;
+
+} // FUNCTION : EoS_DensPres2CSqr_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Table_DensStencil
+// Description :  Return the lower density index and the interpolation weight of the given density
+//
+// Note        :  1. Index is clamped to [0, NDens-2] while the weight is not
+//                   --> Linear extrapolation in ln(density) outside the table
+//
+// Parameter   :  IdxD     : Lower density index (call-by-reference)
+//                WD       : Weight of the upper density point (call-by-reference)
+//                Dens     : Gas mass density
+//                AuxArray : Auxiliary array set by EoS_SetAuxArray_Tabular()
+//
+// Return      :  IdxD, WD
+//-------------------------------------------------------------------------------------------------------
+void EoS_Table_DensStencil( int &IdxD, real &WD, const real Dens, const double AuxArray[] )
+{
+
+   const int  NDens = (int)AuxArray[EOS_TABLE_AUX_NDENS];
+   const real s     = ( LOG(Dens) - (real)AuxArray[EOS_TABLE_AUX_LNDENS0] )*(real)AuxArray[EOS_TABLE_AUX__DLNDENS];
+
+   IdxD = (int)FMAX( s, (real)0.0 );
+   IdxD = MIN( IdxD, NDens-2 );
+   WD   = s - (real)IdxD;
+
+} // FUNCTION : EoS_Table_DensStencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Table_InvertTemp
+// Description :  Find the temperature interval and weight at which the target variable interpolated to the
+//                given density equals the input value
+//
+// Note        :  1. Target variable must increase monotonically with temperature
+//                   --> Checked by EoS_LoadTable_Tabular()
+//                2. Initial guess of the interval assumes the target variable is linear in the temperature index
+//                   between the first and last temperature points
+//                   --> Exact for a power-law EoS on an evenly spaced ln(temperature) grid and usually off by
+//                       at most a few intervals otherwise
+//                   --> Fall back to bisection on the remaining side when the guess does not bracket the input
+//                3. The bilinear interpolant is linear in ln(temperature) within each interval, so the
+//                   bracketing interval is inverted exactly without Newton iterations
+//                   --> Index is clamped to [0, NTemp-2] while the weight is not (i.e., extrapolation)
+//
+// Parameter   :  IdxT     : Lower temperature index (call-by-reference)
+//                LnVal    : ln() of the target value
+//                Var      : Target variable (EOS_TABLE_PRES/EINT)
+//                IdxD/WD  : Density stencil returned by EoS_Table_DensStencil()
+//                AuxArray : Auxiliary array set by EoS_SetAuxArray_Tabular()
+//
+// Return      :  IdxT, weight of the upper temperature point
+//-------------------------------------------------------------------------------------------------------
+real EoS_Table_InvertTemp( int &IdxT, const real LnVal, const int Var, const int IdxD, const real WD,
+                           const double AuxArray[] )
+{
+
+   const int NTemp = (int)AuxArray[EOS_TABLE_AUX_NTEMP];
+   const int Idx0  = IdxD*NTemp*EOS_TABLE_NVAR + Var;
+   const int Idx1  = Idx0 + NTemp*EOS_TABLE_NVAR;
+
+#  define VAL( t )   (  ( (real)1.0 - WD )*EoS_Table_Fetch( Idx0 + (t)*EOS_TABLE_NVAR ) + \
+                                     WD  *EoS_Table_Fetch( Idx1 + (t)*EOS_TABLE_NVAR )  )
+
+// 1. initial guess
+   const real ValFirst = VAL( 0       );
+   const real ValLast  = VAL( NTemp-1 );
+
+   int  L, R;
+   real ValL, ValR, Guess;
+
+   Guess = ( LnVal - ValFirst )/( ValLast - ValFirst )*(real)( NTemp - 1 );
+   Guess = FMAX( Guess, (real)0.0           );
+   Guess = FMIN( Guess, (real)( NTemp - 2 ) );
+   L     = (int)Guess;
+   R     = L + 1;
+   ValL  = VAL( L );
+   ValR  = VAL( R );
+
+
+// 2. bisection if the guess does not bracket the input value
+   if (  ( LnVal < ValL  &&  L > 0 )  ||  ( LnVal >= ValR  &&  R < NTemp-1 )  )
+   {
+      if ( LnVal < ValL )  {  R = L;  L = 0;        }
+      else                 {  L = R;  R = NTemp-1;  }
+
+      while ( R - L > 1 )
+      {
+         const int M = ( L + R ) >> 1;
+
+         if ( VAL(M) <= LnVal )  L = M;
+         else                    R = M;
+      }
+
+      ValL = VAL( L );
+      ValR = VAL( R );
+   }
+
+#  undef VAL
+
+   IdxT = L;
+
+   return ( ValR != ValL ) ? ( LnVal - ValL )/( ValR - ValL ) : (real)0.0;
+
+} // FUNCTION : EoS_Table_InvertTemp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Table_Interp
+// Description :  Bilinear interpolation of the target variable
+//
+// Parameter   :  Var      : Target variable (EOS_TABLE_PRES/EINT/CSQR)
+//                IdxD/WD  : Density stencil returned by EoS_Table_DensStencil()
+//                IdxT/WT  : Temperature stencil returned by EoS_Table_InvertTemp()
+//                AuxArray : Auxiliary array set by EoS_SetAuxArray_Tabular()
+//
+// Return      :  Interpolated ln() of the target variable
+//-------------------------------------------------------------------------------------------------------
+real EoS_Table_Interp( const int Var, const int IdxD, const real WD, const int IdxT, const real WT,
+                       const double AuxArray[] )
+{
+
+   const int Stride = (int)AuxArray[EOS_TABLE_AUX_NTEMP]*EOS_TABLE_NVAR;
+   const int Idx00  = ( IdxD*Stride ) + IdxT*EOS_TABLE_NVAR + Var;
+   const int Idx10  = Idx00 + Stride;
+
+   const real Val0 = ( (real)1.0 - WT )*EoS_Table_Fetch( Idx00 ) + WT*EoS_Table_Fetch( Idx00 + EOS_TABLE_NVAR );
+   const real Val1 = ( (real)1.0 - WT )*EoS_Table_Fetch( Idx10 ) + WT*EoS_Table_Fetch( Idx10 + EOS_TABLE_NVAR );
+
+   return ( (real)1.0 - WD )*Val0 + WD*Val1;
+
+} // FUNCTION : EoS_Table_Interp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Table_Fetch
+// Description :  Fetch one element of the table
+//
+// Parameter   :  Idx : Target index
+//
+// Return      :  Table element
+//-------------------------------------------------------------------------------------------------------
+real EoS_Table_Fetch( const int Idx )
+{
+
+   return EoS_Table[Idx];
+
+} // FUNCTION : EoS_Table_Fetch
+
+
+
+// =============================================
+// III. Set EoS initialization functions
+// =============================================
+
+static EoS_DE2P_t EoS_DensEint2Pres_Ptr = EoS_DensEint2Pres_Tabular;
+static EoS_DP2E_t EoS_DensPres2Eint_Ptr = EoS_DensPres2Eint_Tabular;
+static EoS_DP2C_t EoS_DensPres2CSqr_Ptr = EoS_DensPres2CSqr_Tabular;
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_SetCPUFunc_Tabular
+// Description :  Return the function pointers of the CPU EoS routines
+//
+// Note        :  1. Invoked by EoS_Init_Tabular()
+//                2. Call-by-reference
+//
+// Parameter   :  EoS_DensEint2Pres_CPUPtr : CPU function pointers to be set
+//                EoS_DensPres2Eint_CPUPtr : ...
+//                EoS_DensPres2CSqr_CPUPtr : ...
+//
+// Return      :  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr, EoS_DensPres2CSqr_CPUPtr
+//-----------------------------------------------------------------------------------------
+void EoS_SetCPUFunc_Tabular( EoS_DE2P_t &EoS_DensEint2Pres_CPUPtr,
+                             EoS_DP2E_t &EoS_DensPres2Eint_CPUPtr,
+                             EoS_DP2C_t &EoS_DensPres2CSqr_CPUPtr )
+{
+   EoS_DensEint2Pres_CPUPtr = EoS_DensEint2Pres_Ptr;
+   EoS_DensPres2Eint_CPUPtr = EoS_DensPres2Eint_Ptr;
+   EoS_DensPres2CSqr_CPUPtr = EoS_DensPres2CSqr_Ptr;
+}
+
+
+
+// local function prototypes
+static void EoS_LoadTable_Tabular();
+void EoS_SetAuxArray_Tabular( double [] );
+void EoS_SetCPUFunc_Tabular( EoS_DE2P_t &, EoS_DP2E_t &, EoS_DP2C_t & );
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_Init_Tabular
+// Description :  Initialize EoS
+//
+// Note        :  1. Load the table by invoking EoS_LoadTable_Tabular()
+//                2. Set an auxiliary array by invoking EoS_SetAuxArray_*()
+//                3. Set the CPU EoS routines by invoking EoS_SetCPUFunc_*()
+//                4. Invoked by EoS_Init()
+//                   --> Enable it by linking to the function pointer "EoS_Init_Ptr"
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void EoS_Init_Tabular()
+{
+
+   EoS_LoadTable_Tabular();
+   EoS_SetAuxArray_Tabular( EoS_AuxArray );
+   EoS_SetCPUFunc_Tabular( EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr, EoS_DensPres2CSqr_CPUPtr );
+
+} // FUNCTION : EoS_Init_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_LoadTable_Tabular
+// Description :  Load the EoS table from EOS_TABLE_NAME
+//
+// Note        :  1. Invoked by EoS_Init_Tabular()
+//                2. Table format: five columns
+//                      log10(density), log10(temperature), log10(pressure),
+//                      log10(specific internal energy), log10(sound speed squared)
+//                   in cgs units
+//                   --> Rows must be sorted by density first and then by temperature, with temperature
+//                       varying fastest
+//                   --> log10(density) must be evenly spaced, while temperature can be arbitrarily spaced
+//                   --> Pressure and specific internal energy must increase monotonically with temperature
+//                3. Values are converted to ln() in code units and stored in EoS_Table[] as
+//                   [density][temperature][EOS_TABLE_NVAR]
+//-------------------------------------------------------------------------------------------------------
+void EoS_LoadTable_Tabular()
+{
+
+   if ( EoS_Table != NULL )   return;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the EoS table \"%s\" ...\n", EOS_TABLE_NAME );
+
+   if ( !Aux_CheckFileExist(EOS_TABLE_NAME) )
+      Aux_Error( ERROR_INFO, "EoS table \"%s\" does not exist !!\n", EOS_TABLE_NAME );
+
+
+   const bool   RowMajor_No  = false;
+   const bool   AllocMem_Yes = true;
+   const int    NCol         = 5;
+   const int    TCol[NCol]   = { 0, 1, 2, 3, 4 };
+   const double Ln10         = log( 10.0 );
+
+   double *Table = NULL;
+
+   const int     NRow       = Aux_LoadTable( Table, EOS_TABLE_NAME, NCol, TCol, RowMajor_No, AllocMem_Yes );
+   const double *LogDens    = Table + 0*NRow;
+   const double *LogTemp    = Table + 1*NRow;
+   const double *LogVar[EOS_TABLE_NVAR];
+
+   LogVar[EOS_TABLE_PRES] = Table + 2*NRow;
+   LogVar[EOS_TABLE_EINT] = Table + 3*NRow;
+   LogVar[EOS_TABLE_CSQR] = Table + 4*NRow;
+
+
+// get the table dimensions
+   int NTemp = 1;
+   while ( NTemp < NRow  &&  LogDens[NTemp] == LogDens[0] )    NTemp ++;
+
+   const int NDens = NRow / NTemp;
+
+   if ( NTemp < 2  ||  NDens < 2 )
+      Aux_Error( ERROR_INFO, "EoS table \"%s\" must have at least 2 density and 2 temperature points (%d, %d) !!\n",
+                 EOS_TABLE_NAME, NDens, NTemp );
+
+   if ( NDens*NTemp != NRow )
+      Aux_Error( ERROR_INFO, "number of rows in \"%s\" (%d) is not a multiple of the number of temperature points (%d) !!\n",
+                 EOS_TABLE_NAME, NRow, NTemp );
+
+   const double dLogDens = ( LogDens[NRow-1] - LogDens[0] ) / ( NDens - 1 );
+
+   if ( dLogDens <= 0.0 )  Aux_Error( ERROR_INFO, "density in \"%s\" must be in ascending order !!\n", EOS_TABLE_NAME );
+
+
+// check the table
+   for (int d=0; d<NDens; d++)
+   {
+      const int t0 = d*NTemp;
+
+      if (  fabs( LogDens[t0] - LogDens[0] - d*dLogDens ) > 1.0e-6*dLogDens  )
+         Aux_Error( ERROR_INFO, "log10(density) in \"%s\" is not evenly spaced (row %d) !!\n", EOS_TABLE_NAME, t0 );
+
+      for (int t=t0+1; t<t0+NTemp; t++)
+      {
+         if ( LogDens[t] != LogDens[t0] )
+            Aux_Error( ERROR_INFO, "inconsistent density within a temperature block in \"%s\" (row %d) !!\n",
+                       EOS_TABLE_NAME, t );
+
+         if ( LogTemp[t] <= LogTemp[t-1] )
+            Aux_Error( ERROR_INFO, "temperature in \"%s\" must be in ascending order (row %d) !!\n",
+                       EOS_TABLE_NAME, t );
+
+         if ( LogVar[EOS_TABLE_PRES][t] <= LogVar[EOS_TABLE_PRES][t-1]  ||
+              LogVar[EOS_TABLE_EINT][t] <= LogVar[EOS_TABLE_EINT][t-1] )
+            Aux_Error( ERROR_INFO, "pressure and internal energy in \"%s\" must increase with temperature (row %d) !!\n",
+                       EOS_TABLE_NAME, t );
+      }
+   }
+
+
+// convert to ln() in code units and interleave all variables of the same node
+   const double LnUnit[EOS_TABLE_NVAR] = { log(UNIT_P), 2.0*log(UNIT_V), 2.0*log(UNIT_V) };
+
+   EoS_Table_NDens   = NDens;
+   EoS_Table_NTemp   = NTemp;
+   EoS_Table_LnDens0 = LogDens[0]*Ln10 - log(UNIT_D);
+   EoS_Table_dLnDens = dLogDens*Ln10;
+   EoS_Table_Size    = (long)NRow*EOS_TABLE_NVAR;
+   EoS_Table         = new real [EoS_Table_Size];
+
+   for (int t=0; t<NRow; t++)
+   for (int v=0; v<EOS_TABLE_NVAR; v++)
+      EoS_Table[ (long)t*EOS_TABLE_NVAR + v ] = (real)( LogVar[v][t]*Ln10 - LnUnit[v] );
+
+   delete [] Table;
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "      Number of density/temperature points = %d/%d\n", NDens, NTemp );
+      Aux_Message( stdout, "   Loading the EoS table \"%s\" ... done\n", EOS_TABLE_NAME );
+   }
+
+} // FUNCTION : EoS_LoadTable_Tabular
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  EOS == EOS_TABULAR )
@@ -59,12 +59,40 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 #  endif
 
 
+// select the quiescent patch groups to be skipped in this sub-step, which InvokeSolver() will exclude together with
+// those to be caught up
+// --> skip only if the next sub-step catches up before the parent level and the regridding of this level
+#  if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+   if ( OPT__FROZEN_REGION )
+   {
+      const bool AllowSkip = (  lv > 0  &&  TimeNew < Time[lv-1]  &&
+                                ( lv == TOP_LEVEL  ||  (AdvanceCounter[lv]+1) % REGRID_COUNT != 0 )  );
+
+      Flu_FrozenRegion_Prepare( lv, TimeOld, dt, AllowSkip );
+   }
+#  endif
+
+
 // invoke the fluid solver
    FluStatus_ThisRank = GAMER_SUCCESS;
 
    InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
 
 
+// re-advance only the failed patch groups with sub-steps before falling back to the level-wide retry
+#  if ( MODEL == HYDRO  &&  !defined GPU )
+   if ( AUTO_REDUCE_DT_LOCAL  &&  FluStatus_ThisRank == GAMER_FAILED )
+      FluStatus_ThisRank = Flu_RetryFailedPatchGroup( lv, TimeNew, TimeOld, dt, SaveSg_Flu );
+#  endif
+
+
+// copy the skipped patch groups and catch up those skipped in the previous sub-step
+#  if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+   if ( OPT__FROZEN_REGION  &&  FluStatus_ThisRank == GAMER_SUCCESS )
+      FluStatus_ThisRank = Flu_FrozenRegion_Advance( lv, TimeNew, TimeOld, dt, SaveSg_Flu );
+#  endif
+
+
 // collect the fluid solver status from all ranks (only necessary for AUTO_REDUCE_DT)
    int FluStatus_AllRank;
 
@@ -81,6 +109,13 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 //    --> for accumulating the coarse-fine fluxes and electric field later when evolving lv+1
       if ( OPT__FIXUP_FLUX )  Buf_ResetBufferFlux( lv );
 
+//    initialize the buffer fluxes as the coarse-grid fluxes for bitwise reproducibility
+#     if   ( defined BIT_REP_FLUX  &&  defined LOAD_BALANCE )
+      if ( OPT__FIXUP_FLUX )  LB_SeedBufferFlux( lv );
+#     elif ( defined BIT_REP_FLUX  &&  !defined SERIAL )
+      if ( OPT__FIXUP_FLUX )  Buf_SeedBufferFlux( lv );
+#     endif
+
 #     if ( defined MHD  &&  defined LOAD_BALANCE )
       if ( OPT__FIXUP_ELECTRIC )    MHD_LB_ResetBufferElectric( lv );
 #     endif
@@ -105,6 +140,11 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 
 //    swap the flux (and electric in MHD) pointers on the parent level if the fluid solver works successfully
       if ( AUTO_REDUCE_DT  &&  lv != 0 )  Flu_SwapFixUpTempArray( lv-1 );
+
+//    accept the skip and catch-up lists of this sub-step
+#     if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+      if ( OPT__FROZEN_REGION )  Flu_FrozenRegion_Commit( lv );
+#     endif
    }
 
 
@@ -53,6 +53,10 @@ void Flu_AllocateFluxArray( const int lv )
    }
 
 
+// record the real patches with flux arrays for Flu_FixUp_Flux()
+   Flu_RecordFluxPatchList( lv );
+
+
 // allocate flux arrays for the buffer patches
    if ( amr->NPatchComma[lv+1][7] != 0 )  Flu_AllocateFluxArray_Buffer( lv );
 
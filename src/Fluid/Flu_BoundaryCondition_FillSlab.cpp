@@ -0,0 +1,95 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_BoundaryCondition_FillSlab
+// Description :  Fill up the ghost-zone slab of a single field adjacent to a boundary face by copying or
+//                mirroring the data inside the boundary
+//
+// Note        :  1. Shared by the outflow and reflecting B.C. of both the cell-centered variables
+//                   (Hydro_BoundaryCondition_Outflow/Reflecting()) and the face-centered magnetic field
+//                   (MHD_BoundaryCondition_Outflow/Reflecting())
+//                2. Set Data[k][j][i] = Sign*Data[k][j][i'] for all i/j/k in [Start ... End], where
+//                   i' = Ref (Mirror=false) or i' = Ref-i (Mirror=true) when Dir=0, and similarly for Dir=1/2
+//                3. The innermost loop always runs along x with a unit stride and the source cells never
+//                   overlap the target cells
+//                   --> Vectorized by "omp simd" for all faces
+//                   --> For the x faces with Mirror=false, each row is filled with a single value
+//                4. Sign=+1 leaves the data bitwise unchanged
+//
+// Parameter   :  Data    : Array of a single field with dimension [SizeZ][SizeY][SizeX]
+//                SizeX/Y : Array size along x/y
+//                Start   : Minimum target array indices along x/y/z
+//                End     : Maximum target array indices along x/y/z
+//                Dir     : Normal direction of the boundary face (0/1/2 --> x/y/z)
+//                Ref     : Reference index along Dir --> see Note 2
+//                Mirror  : true  --> reflect the data with respect to the boundary face (reflecting B.C.)
+//                          false --> copy the single layer "Ref" (outflow B.C.)
+//                Sign    : +1 or -1 (the latter for the normal vector components of the reflecting B.C.)
+//
+// Return      :  Data
+//-------------------------------------------------------------------------------------------------------
+void Flu_BoundaryCondition_FillSlab( real *Data, const int SizeX, const int SizeY, const int Start[], const int End[],
+                                     const int Dir, const int Ref, const bool Mirror, const real Sign )
+{
+
+   const long dj = SizeX;
+   const long dk = (long)SizeX*SizeY;
+
+   switch ( Dir )
+   {
+      case 0:
+         for (int k=Start[2]; k<=End[2]; k++)
+         for (int j=Start[1]; j<=End[1]; j++)
+         {
+            real *Row = Data + k*dk + j*dj;
+
+            if ( Mirror )
+            {
+#              pragma omp simd
+               for (int i=Start[0]; i<=End[0]; i++)   Row[i] = Sign*Row[ Ref - i ];
+            }
+
+            else
+            {
+               const real Val = Sign*Row[Ref];
+
+#              pragma omp simd
+               for (int i=Start[0]; i<=End[0]; i++)   Row[i] = Val;
+            }
+         }
+         break;
+
+      case 1:
+         for (int k=Start[2]; k<=End[2]; k++)
+         for (int j=Start[1]; j<=End[1]; j++)
+         {
+            const int   jj  = ( Mirror ) ? Ref - j : Ref;
+                  real *Des = Data + k*dk +  j*dj;
+            const real *Src = Data + k*dk + jj*dj;
+
+#           pragma omp simd
+            for (int i=Start[0]; i<=End[0]; i++)   Des[i] = Sign*Src[i];
+         }
+         break;
+
+      case 2:
+         for (int k=Start[2]; k<=End[2]; k++)
+         for (int j=Start[1]; j<=End[1]; j++)
+         {
+            const int   kk  = ( Mirror ) ? Ref - k : Ref;
+                  real *Des = Data +  k*dk + j*dj;
+            const real *Src = Data + kk*dk + j*dj;
+
+#           pragma omp simd
+            for (int i=Start[0]; i<=End[0]; i++)   Des[i] = Sign*Src[i];
+         }
+         break;
+
+      default:
+         Aux_Error( ERROR_INFO, "incorrect direction (%d) !!\n", Dir );
+   } // switch ( Dir )
+
+} // FUNCTION : Flu_BoundaryCondition_FillSlab
@@ -8,6 +8,14 @@ static void BC_User_Template( real fluid[], const double x, const double y, cons
 void (*BC_User_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                      const int lv, double AuxArray[] ) = NULL;
 
+// declare as static so that other functions cannot invoke it directly and must use the function pointer
+static void BC_User_Batch_Template( real fluid[], const int NCell, const double x[], const double y[],
+                                    const double z[], const double Time, const int lv, double AuxArray[] );
+
+// this optional function pointer may be set by a test problem initializer to replace BC_User_Ptr
+void (*BC_User_Batch_Ptr)( real fluid[], const int NCell, const double x[], const double y[],
+                           const double z[], const double Time, const int lv, double AuxArray[] ) = NULL;
+
 #ifdef MHD
 extern void (*BC_BField_User_Ptr)( real magnetic[], const double x, const double y, const double z, const double Time,
                                    const int lv, double AuxArray[] );
@@ -90,12 +98,66 @@ void BC_User_Template( real fluid[], const double x, const double y, const doubl
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BC_User_Batch_Template
+// Description :  User-specified boundary condition template for multiple cells at once
+//
+// Note        :  1. Invoked by Flu_BoundaryCondition_User() using the function pointer
+//                   "BC_User_Batch_Ptr", which may be set by a test problem initializer
+//                   --> Optional. BC_User_Ptr will be invoked for each cell if it is NULL.
+//                2. Must set the same fluid field as BC_User_Ptr but works on arrays so that it can be
+//                   vectorized by the compiler
+//                   --> The output array is stored as fluid[NCOMP_TOTAL][NCell]
+//                3. All cells of a ghost-zone slab are passed in a single call
+//                4. Same energy requirement as BC_User_Template()
+//
+// Parameter   :  fluid    : Fluid field to be set
+//                NCell    : Number of target cells
+//                x/y/z    : Physical coordinates of each cell
+//                Time     : Physical time
+//                lv       : Refinement level
+//                AuxArray : Auxiliary array
+//
+// Return      :  fluid
+//-------------------------------------------------------------------------------------------------------
+void BC_User_Batch_Template( real fluid[], const int NCell, const double x[], const double y[],
+                             const double z[], const double Time, const int lv, double AuxArray[] )
+{
+
+// put your B.C. here
+// ##########################################################################################################
+// Example : set to time-independent values for HYDRO
+   /*
+   const real Dens0 = 1.0;
+   const real Pres0 = 1.0;
+   const real Etot0 = Hydro_ConEint2Etot( Dens0, 0.0, 0.0, 0.0,
+                                          EoS_DensPres2Eint_CPUPtr(Dens0, Pres0, NULL, EoS_AuxArray), 0.0 );
+
+// only the operations free of function calls can be vectorized
+   for (int t=0; t<NCell; t++)
+   {
+      fluid[ DENS*NCell + t ] = Dens0 + 0.2*exp( -SQR(x[t]-0.5*amr->BoxSize[0]) );
+      fluid[ MOMX*NCell + t ] = 0.0;
+      fluid[ MOMY*NCell + t ] = 0.0;
+      fluid[ MOMZ*NCell + t ] = 0.0;
+      fluid[ ENGY*NCell + t ] = Etot0;
+   }
+   */
+
+// ##########################################################################################################
+
+} // FUNCTION : BC_User_Batch_Template
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Flu_BoundaryCondition_User
 // Description :  Fill up the ghost-zone values by the user-specified boundary condition
 //
 // Note        :  1. Work for Prepare_PatchData(), InterpolateGhostZone(), Refine(), and LB_Refine_GetNewRealPatchList()
 //                2. Function pointers "BC_User_Ptr" and "BC_BField_User_Ptr" must be set by a test problem initializer
+//                   --> BC_User_Ptr can be replaced by the batched version "BC_User_Batch_Ptr", which is invoked
+//                       once for all cells in the target slab
 //                3. User-defined boundary conditions for the magnetic field are set in MHD_BoundaryCondition_User()
 //
 // Parameter   :  Array          : Array to store the prepared data including ghost zones
@@ -119,8 +181,8 @@ void Flu_BoundaryCondition_User( real *Array, const int NVar_Flu, const int Arra
 {
 
 // check
-   if ( BC_User_Ptr == NULL )
-      Aux_Error( ERROR_INFO, "BC_User_Ptr == NULL for user-specified boundary conditions !!\n" );
+   if ( BC_User_Ptr == NULL  &&  BC_User_Batch_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "BC_User_Ptr and BC_User_Batch_Ptr are both NULL for user-specified boundary conditions !!\n" );
 
 #  ifdef MHD
    if ( BC_BField_User_Ptr == NULL )
@@ -156,17 +218,51 @@ void Flu_BoundaryCondition_User( real *Array, const int NVar_Flu, const int Arra
 
 
 // set the boundary values
-   int    i, j, k, v2;
+   int    i, j, k, v2, t;
    real   BVal[NCOMP_TOTAL];
    double x, y, z;
 
+// evaluate all cells at once for the batched B.C.
+   const bool UseBatch = ( BC_User_Batch_Ptr != NULL );
+   const int  NCell    = ( Idx_End[0] - Idx_Start[0] + 1 )*( Idx_End[1] - Idx_Start[1] + 1 )*( Idx_End[2] - Idx_Start[2] + 1 );
+
+   real   *BVal_Batch = NULL;
+   double *x_Batch    = NULL;
+   double *y_Batch    = NULL;
+   double *z_Batch    = NULL;
+
+   if ( UseBatch )
+   {
+      BVal_Batch = new real   [ NCOMP_TOTAL*NCell ];
+      x_Batch    = new double [ NCell ];
+      y_Batch    = new double [ NCell ];
+      z_Batch    = new double [ NCell ];
+
+      t = 0;
+      for (k=Idx_Start[2], z=z0; k<=Idx_End[2]; k++, z+=dh)
+      for (j=Idx_Start[1], y=y0; j<=Idx_End[1]; j++, y+=dh)
+      for (i=Idx_Start[0], x=x0; i<=Idx_End[0]; i++, x+=dh)
+      {
+         x_Batch[t] = x;
+         y_Batch[t] = y;
+         z_Batch[t] = z;
+         t ++;
+      }
+
+      BC_User_Batch_Ptr( BVal_Batch, NCell, x_Batch, y_Batch, z_Batch, Time, lv, NULL );
+   }
+
+   t = 0;
    for (k=Idx_Start[2], z=z0; k<=Idx_End[2]; k++, z+=dh)
    for (j=Idx_Start[1], y=y0; j<=Idx_End[1]; j++, y+=dh)
-   for (i=Idx_Start[0], x=x0; i<=Idx_End[0]; i++, x+=dh)
+   for (i=Idx_Start[0], x=x0; i<=Idx_End[0]; i++, x+=dh, t++)
    {
 //    1. primary variables
 //    get the boundary values of all NCOMP_TOTAL fields
-      BC_User_Ptr( BVal, x, y, z, Time, lv, NULL );
+      if ( UseBatch )
+         for (int v=0; v<NCOMP_TOTAL; v++)   BVal[v] = BVal_Batch[ v*NCell + t ];
+      else
+         BC_User_Ptr( BVal, x, y, z, Time, lv, NULL );
 
 //    add the magnetic energy for MHD
 #     if ( MODEL == HYDRO )
@@ -220,4 +316,9 @@ void Flu_BoundaryCondition_User( real *Array, const int NVar_Flu, const int Arra
 #     endif
    } // k,j,i
 
+   delete [] BVal_Batch;
+   delete [] x_Batch;
+   delete [] y_Batch;
+   delete [] z_Batch;
+
 } // FUNCTION : Flu_BoundaryCondition_User
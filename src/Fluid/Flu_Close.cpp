@@ -9,12 +9,16 @@ extern int FluStatus_ThisRank;
 extern bool AutoReduceDt_Continue;
 
 
-static void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
-                       const int NPG, const int *PID0_List, const real dt );
+void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                const int NPG, const int *PID0_List, const real dt );
 static void CorrectFlux( const int SonLv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                          const int NPG, const int *PID0_List, const real dt );
+static void CheckOutput( const int lv, const int PID, const int TID,
+                         const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                         const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+                         const int Table_x, const int Table_y, const int Table_z );
 #if ( MODEL == HYDRO )
-static bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
+bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
 static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                                const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                                real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
@@ -23,11 +27,18 @@ static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List
                                const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
                                const real dt );
+static void RecordBndFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                           const int NPG, const int *PID0_List, const real dt );
+#ifndef MHD
+void RecordMaxCFL( const int lv, const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ], const int NPG,
+                   const int *PID0_List );
+#endif
 #ifdef MHD
 void StoreElectric( const int lv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                     const int NPG, const int *PID0_List, const real dt );
 void CorrectElectric( const int SonLv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                       const int NPG, const int *PID0_List, const real dt );
+static void RecordDivB( const int lv, const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ], const int NPG );
 #endif
 #endif // #if ( MODEL == HYDRO )
 extern void Hydro_RiemannSolver_Roe ( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
@@ -39,6 +50,11 @@ extern void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real
 extern void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                       const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
                                       const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#ifndef MHD
+extern void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                                       const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                       const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#endif
 
 
 
@@ -49,6 +65,16 @@ extern void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
 //                4. Get the minimum time-step information of the fluid solver
+//                   --> Only for OPT__DT_FLU_BYPRODUCT, which records the maximum CFL speed of each patch in
+//                       patch_t::dt_MaxCFL
+//                5. Accumulate the divergence of the updated B field
+//                   --> Only for OPT__RECORD_DIVB in MHD
+//                6. Accumulate the fluxes across the non-periodic simulation boundaries
+//                   --> Only for OPT__RECORD_CONSERVATION in HYDRO
+//                7. Check whether the updated fluid data are finite (and positive)
+//                   --> Only for OPT__CK_FLU_OUTPUT
+//                8. Evaluate the refinement criteria of the updated patches
+//                   --> Only for OPT__FLAG_FLU_BYPRODUCT, which records the results in patch_t::FlagMask
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -84,6 +110,14 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 #  endif
 
 
+// record the quiescence of the updated patch groups and the fluxes adopted by the neighbouring skipped and
+// caught-up patch groups for OPT__FROZEN_REGION
+#  if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+   if ( OPT__FROZEN_REGION )
+      Flu_FrozenRegion_Record( lv, NPG, PID0_List, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_Flux_Array, dt );
+#  endif
+
+
 // operations related to flux fix-up
    if ( OPT__FIXUP_FLUX )
    {
@@ -95,6 +129,12 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
    }
 
 
+// accumulate the fluxes across the simulation boundaries for tracking the conserved variables incrementally
+#  if ( MODEL == HYDRO )
+   if ( OPT__RECORD_CONSERVATION )  RecordBndFlux( lv, h_Flux_Array, NPG, PID0_List, dt );
+#  endif
+
+
 // operations related to electric field fix-up
 #  ifdef MHD
    if ( OPT__FIXUP_ELECTRIC )
@@ -113,7 +153,19 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 #     error : ERROR : FLU_NOUT != NCOMP_TOTAL (one must specify how to copy data from h_Flu_Array_F_Out to fluid) !!
 #  endif
 
-#  pragma omp parallel for schedule( static )
+// --> skip OPT__CK_FLU_OUTPUT when AUTO_REDUCE_DT will discard the results of this step anyway
+   const bool CheckFluOut = ( OPT__CK_FLU_OUTPUT  &&  FluStatus_ThisRank != GAMER_FAILED );
+#  if ( MODEL == HYDRO )
+   const bool RecordFlag  = ( OPT__FLAG_FLU_BYPRODUCT  &&  lv < MAX_LEVEL );
+#  endif
+
+// --> time each thread separately for TIMING_SOLVER
+#  pragma omp parallel
+   {
+
+   THREAD_TIMER_START();
+
+#  pragma omp for schedule( static ) nowait
    for (int TID=0; TID<NPG; TID++)
    {
       const int PID0 = PID0_List[TID];
@@ -128,19 +180,32 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
          int I, J, K, KJI;
 
 //       fluid variables
+//       --> copy each contiguous row of PATCH_SIZE cells at once
          for (int v=0; v<FLU_NOUT; v++)      {
          for (int k=0; k<PATCH_SIZE; k++)    {  K = Table_z + k;
          for (int j=0; j<PATCH_SIZE; j++)    {  J = Table_y + j;
-         for (int i=0; i<PATCH_SIZE; i++)    {  I = Table_x + i;
 
-            KJI = IDX321( I, J, K, PS2, PS2 );
+            KJI = IDX321( Table_x, J, K, PS2, PS2 );
 
-            amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j][i] = h_Flu_Array_F_Out[TID][v][KJI];
+            memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j], h_Flu_Array_F_Out[TID][v]+KJI, PATCH_SIZE*sizeof(real) );
 
-         }}}}
+         }}}
+
+//       check the output while it is still in cache
+         if ( CheckFluOut )
+            CheckOutput( lv, PID, TID, h_Flu_Array_F_Out, h_Mag_Array_F_Out, Table_x, Table_y, Table_z );
+
+//       evaluate the refinement criteria while the data are still in cache
+//       --> also for AUTO_REDUCE_DT failures since the retry will overwrite the results anyway
+#        if ( MODEL == HYDRO )
+         if ( RecordFlag )    Flag_RecordFlagMask( lv, PID, SaveSg_Flu );
+#        endif
 
 //       dual-energy status
+//       --> also record whether all cells share the same status so that later copies can be replaced by memset()
 #        ifdef DUAL_ENERGY
+         char DE_Uniform = h_DE_Array_F_Out[TID][ IDX321( Table_x, Table_y, Table_z, PS2, PS2 ) ];
+
          for (int k=0; k<PATCH_SIZE; k++)    {  K = Table_z + k;
          for (int j=0; j<PATCH_SIZE; j++)    {  J = Table_y + j;
          for (int i=0; i<PATCH_SIZE; i++)    {  I = Table_x + i;
@@ -150,7 +215,11 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 //          de_status is always stored in Sg=0
             amr->patch[0][lv][PID]->de_status[k][j][i] = h_DE_Array_F_Out[TID][KJI];
 
+            if ( h_DE_Array_F_Out[TID][KJI] != DE_Uniform )    DE_Uniform = DE_STATUS_MIXED;
+
          }}}
+
+         amr->patch[0][lv][PID]->de_uniform = DE_Uniform;
 #        endif
 
 //       magnetic field
@@ -171,15 +240,136 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 
             }}}
          } // for (int v=0; v<NCOMP_MAG; v++)
+
+//       cache the cell-centered magnetic energy while the B field is still in cache
+         if ( OPT__EMAG_CACHE )  MHD_SetCellCenteredBEnergyCache( lv, PID, SaveSg_Mag );
 #        endif // #ifdef MHD
 
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int TID=0; TID<NPG; TID++)
 
+   THREAD_TIMER_STOP();
+
+   } // end of OpenMP parallel region
+
+
+// record the maximum CFL speed of the updated data so that Mis_GetTimeStep() can skip the separate dt solver
+#  if ( MODEL == HYDRO  &&  !defined MHD )
+   if ( OPT__DT_FLU_BYPRODUCT )  RecordMaxCFL( lv, h_Flu_Array_F_Out, NPG, PID0_List );
+#  endif
+
+
+// accumulate the divergence of the updated B field so that it can be monitored without OPT__CK_DIVERGENCE_B
+#  ifdef MHD
+   if ( OPT__RECORD_DIVB )    RecordDivB( lv, h_Mag_Array_F_Out, NPG );
+#  endif
+
 } // FUNCTION : Flu_Close
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckOutput
+// Description :  Check whether the updated fluid data of a patch are finite (and positive) for OPT__CK_FLU_OUTPUT
+//
+// Note        :  1. Invoked by Flu_Close() when copying the output array of the fluid solver to the patch pointers
+//                   --> It covers the fluid variables checked by Aux_Check_Finite() and Hydro_Aux_Check_Negative()
+//                       with a single pass over the data already in cache instead of separate sweeps over all
+//                       patches, and catches failures at the step and level where they first appear
+//                2. OPT__CK_FLU_OUTPUT = 1 : check whether all fluid variables are finite
+//                                        2 : also check whether density and pressure (and entropy for DE_ENPY)
+//                                            are positive (HYDRO only)
+//                3. Report the offending cell and abort on failure
+//                   --> Do not synchronize with other ranks since they may invoke Flu_Close() a different number
+//                       of times
+//
+// Parameter   :  lv                : Target refinement level
+//                PID               : Target patch index
+//                TID               : Index of the patch group of PID in the output arrays
+//                h_Flu_Array_F_Out : Host array storing the updated fluid data
+//                h_Mag_Array_F_Out : Host array storing the updated B field (for MHD only)
+//                Table_x/y/z       : Offset of the target patch in the patch group
+//-------------------------------------------------------------------------------------------------------
+void CheckOutput( const int lv, const int PID, const int TID,
+                  const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                  const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+                  const int Table_x, const int Table_y, const int Table_z )
+{
+
+#  if ( MODEL == HYDRO )
+   const bool CheckMinPres_No = false;
+#  endif
+
+   real Fluid[FLU_NOUT];
+
+   for (int k=0; k<PATCH_SIZE; k++)
+   for (int j=0; j<PATCH_SIZE; j++)
+   for (int i=0; i<PATCH_SIZE; i++)
+   {
+      const int KJI = IDX321( Table_x+i, Table_y+j, Table_z+k, PS2, PS2 );
+
+      bool Fail = false;
+#     if ( MODEL == HYDRO )
+      real Pres = NULL_REAL;
+#     endif
+
+      for (int v=0; v<FLU_NOUT; v++)
+      {
+         Fluid[v] = h_Flu_Array_F_Out[TID][v][KJI];
+
+         if ( ! Aux_IsFinite(Fluid[v]) )  Fail = true;
+      }
+
+#     if ( MODEL == HYDRO )
+      if ( !Fail  &&  OPT__CK_FLU_OUTPUT == 2 )
+      {
+#        if ( DUAL_ENERGY == DE_ENPY )
+         Pres = Hydro_DensEntropy2Pres( Fluid[DENS], Fluid[ENPY], EOS_AUX_GAMMA_M1(EoS_AuxArray), CheckMinPres_No, NULL_REAL );
+#        else
+#        ifdef MHD
+         const real Emag = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_Out[TID][MAGX],
+                                                       h_Mag_Array_F_Out[TID][MAGY],
+                                                       h_Mag_Array_F_Out[TID][MAGZ],
+                                                       PS2, PS2, PS2, Table_x+i, Table_y+j, Table_z+k );
+#        else
+         const real Emag = NULL_REAL;
+#        endif
+         Pres = Hydro_Con2Pres( Fluid[DENS], Fluid[MOMX], Fluid[MOMY], Fluid[MOMZ], Fluid[ENGY], Fluid+NCOMP_FLUID,
+                                CheckMinPres_No, NULL_REAL, Emag,
+                                EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
+#        endif // #if ( DUAL_ENERGY == DE_ENPY ) ... else ...
+
+         if ( Fluid[DENS] <= (real)0.0  ||  Pres <= (real)0.0  ||  ! Aux_IsFinite(Pres) )   Fail = true;
+
+#        if ( DUAL_ENERGY == DE_ENPY )
+         if ( Fluid[ENPY] < (real)0.0 )   Fail = true;
+#        endif
+      }
+#     endif // #if ( MODEL == HYDRO )
+
+      if ( Fail )
+      {
+#        pragma omp critical
+         {
+            Aux_Message( stderr, "ERROR : OPT__CK_FLU_OUTPUT failed at Rank %d, lv %d, PID %d, patch corner (%d,%d,%d), "
+                                 "cell (%d,%d,%d), Time %20.14e, Step %ld !!\n",
+                         MPI_Rank, lv, PID, amr->patch[0][lv][PID]->corner[0], amr->patch[0][lv][PID]->corner[1],
+                         amr->patch[0][lv][PID]->corner[2], i, j, k, Time[lv], Step );
+
+            for (int v=0; v<FLU_NOUT; v++)   Aux_Message( stderr, "   %-10s = %21.14e\n", FieldLabel[v], Fluid[v] );
+#           if ( MODEL == HYDRO )
+            Aux_Message( stderr, "   %-10s = %21.14e\n", "Pres", Pres );
+#           endif
+
+            Aux_Error( ERROR_INFO, "unphysical output of the fluid solver !!\n" );
+         }
+      }
+   } // i,j,k
+
+} // FUNCTION : CheckOutput
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  StoreFlux
 // Description :  Save the coarse-grid fluxes across the coarse-fine boundaries for patches at level "lv"
@@ -214,12 +404,7 @@ void StoreFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2
 
          for (int s=0; s<6; s++)
          {
-//          for bitwise reproducibility, store the fluxes to be corrected in flux_bitrep[]
-#           ifdef BIT_REP_FLUX
-            real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux_bitrep[s];
-#           else
             real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
-#           endif
 
             if ( FluxPtr != NULL )
             {
@@ -451,6 +636,9 @@ bool Unphysical( const real Fluid[], const int CheckMode, const real Emag )
 //                      else
 //                         Store the corrected results in the output array
 //                   }
+//                4. Each thread first collects the unphysical cells of a patch group into a compact list and then
+//                   corrects only the cells in that list
+//                   --> The common case without any unphysical cell reduces to a single pass of Unphysical()
 //
 // Parameter   :  lv                : Target refinement level
 //                NPG               : Number of patch groups to be evaluated
@@ -494,6 +682,7 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    real dF[3][NCOMP_TOTAL], Out[NCOMP_TOTAL], Update[NCOMP_TOTAL];
    real FluxL_1D[NCOMP_TOTAL], FluxR_1D[NCOMP_TOTAL];
    int  ijk_out[3];
+   int *UnphyList = new int [ CUBE(PS2) ];
 
 // variables for OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D
    const int  Corr1D_NBuf          = 1;
@@ -518,16 +707,48 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
          = ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D ) ? new real [Corr1D_NCell][Corr1D_NCell][Corr1D_NCell][NCOMP_TOTAL]
                                                           : NULL;
 
-#  pragma omp for reduction( +:NCorrThisTime ) schedule( runtime )
+// --> nowait is safe since the reduction result is only used after the end of the parallel region
+   THREAD_TIMER_START();
+
+#  pragma omp for reduction( +:NCorrThisTime ) schedule( runtime ) nowait
    for (int TID=0; TID<NPG; TID++)
    {
+//    1. collect the cells with unphysical results into a compact list
+//       --> keep this loop free of the correction code below so that the common case (i.e., no unphysical cell)
+//           only costs a single pass of Unphysical()
+      int  NUnphy   = 0;
+      bool FailedPG = false;
+
       for (ijk_out[2]=0; ijk_out[2]<PS2; ijk_out[2]++)
       for (ijk_out[1]=0; ijk_out[1]<PS2; ijk_out[1]++)
       for (ijk_out[0]=0; ijk_out[0]<PS2; ijk_out[0]++)
       {
          const int idx_out = (ijk_out[2]*PS2 + ijk_out[1])*PS2 + ijk_out[0];
 
-//       check if the updated values are unphysical
+         for (int v=0; v<NCOMP_TOTAL; v++)   Out[v] = h_Flu_Array_F_Out[TID][v][idx_out];
+
+#        ifdef MHD
+         const real Emag_Out = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_Out[TID][MAGX],
+                                                           h_Mag_Array_F_Out[TID][MAGY],
+                                                           h_Mag_Array_F_Out[TID][MAGZ],
+                                                           PS2, PS2, PS2, ijk_out[0], ijk_out[1], ijk_out[2] );
+#        else
+         const real Emag_Out = NULL_REAL;
+#        endif
+
+         if ( Unphysical(Out, CheckMinEint, Emag_Out) )  UnphyList[ NUnphy ++ ] = idx_out;
+      }
+
+
+//    2. correct the unphysical cells one by one
+      for (int u=0; u<NUnphy; u++)
+      {
+         const int idx_out = UnphyList[u];
+
+         ijk_out[0] = idx_out % PS2;
+         ijk_out[1] = idx_out % SQR(PS2) / PS2;
+         ijk_out[2] = idx_out / SQR(PS2);
+
          for (int v=0; v<NCOMP_TOTAL; v++)   Out[v] = h_Flu_Array_F_Out[TID][v][idx_out];
 
 //       compute the magnetic energy
@@ -540,451 +761,482 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
          const real Emag_Out = NULL_REAL;
 #        endif
 
-         if ( Unphysical(Out, CheckMinEint, Emag_Out) )
-         {
-            const int idx_in = ( (ijk_out[2]+FLU_GHOST_SIZE)*FLU_NXT + (ijk_out[1]+FLU_GHOST_SIZE) )*FLU_NXT + (ijk_out[0]+FLU_GHOST_SIZE);
+         const int idx_in = ( (ijk_out[2]+FLU_GHOST_SIZE)*FLU_NXT + (ijk_out[1]+FLU_GHOST_SIZE) )*FLU_NXT + (ijk_out[0]+FLU_GHOST_SIZE);
 
-//          try to correct unphysical results using 1st-order fluxes (which should be more diffusive)
-//          ========================================================================================
-//          (A) first apply the directionally **unsplitting** correction
-//          ========================================================================================
-            if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
+//       try to correct unphysical results using 1st-order fluxes (which should be more diffusive)
+//       ========================================================================================
+//       (A) first apply the directionally **unsplitting** correction
+//       ========================================================================================
+         if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
+         {
+//          collect nearby input coserved variables
+            for (int v=0; v<NCOMP_TOTAL; v++)
             {
-//             collect nearby input coserved variables
-               for (int v=0; v<NCOMP_TOTAL; v++)
+//             here we have assumed that the fluid solver does NOT modify the input fluid array
+//             --> not applicable to RTVD
+               VarC[v] = h_Flu_Array_F_In[TID][v][idx_in];
+
+               for (int d=0; d<3; d++)
                {
-//                here we have assumed that the fluid solver does NOT modify the input fluid array
-//                --> not applicable to RTVD
-                  VarC[v] = h_Flu_Array_F_In[TID][v][idx_in];
+                  VarL[d][v] = h_Flu_Array_F_In[TID][v][ idx_in - didx[d] ];
+                  VarR[d][v] = h_Flu_Array_F_In[TID][v][ idx_in + didx[d] ];
+               }
+            }
 
+//          invoke Riemann solver to calculate the fluxes
+//          (note that the recalculated flux does NOT include gravity even for UNSPLIT_GRAVITY --> reduce to 1st-order accuracy)
+            switch ( OPT__1ST_FLUX_CORR_SCHEME )
+            {
+               case RSOLVER_1ST_ROE:
                   for (int d=0; d<3; d++)
                   {
-                     VarL[d][v] = h_Flu_Array_F_In[TID][v][ idx_in - didx[d] ];
-                     VarR[d][v] = h_Flu_Array_F_In[TID][v][ idx_in + didx[d] ];
+                     Hydro_RiemannSolver_Roe ( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                     Hydro_RiemannSolver_Roe ( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
                   }
-               }
+                  break;
 
-//             invoke Riemann solver to calculate the fluxes
-//             (note that the recalculated flux does NOT include gravity even for UNSPLIT_GRAVITY --> reduce to 1st-order accuracy)
-               switch ( OPT__1ST_FLUX_CORR_SCHEME )
-               {
-                  case RSOLVER_1ST_ROE:
-                     for (int d=0; d<3; d++)
-                     {
-                        Hydro_RiemannSolver_Roe ( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                        Hydro_RiemannSolver_Roe ( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                     }
-                     break;
+#              ifndef MHD
+               case RSOLVER_1ST_HLLC:
+                  for (int d=0; d<3; d++)
+                  {
+                     Hydro_RiemannSolver_HLLC( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                     Hydro_RiemannSolver_HLLC( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                  }
+                  break;
+#              endif
 
-#                 ifndef MHD
-                  case RSOLVER_1ST_HLLC:
-                     for (int d=0; d<3; d++)
-                     {
-                        Hydro_RiemannSolver_HLLC( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                        Hydro_RiemannSolver_HLLC( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                     }
-                     break;
-#                 endif
+               case RSOLVER_1ST_HLLE:
+                  for (int d=0; d<3; d++)
+                  {
+                     Hydro_RiemannSolver_HLLE( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                     Hydro_RiemannSolver_HLLE( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                  }
+                  break;
 
-                  case RSOLVER_1ST_HLLE:
-                     for (int d=0; d<3; d++)
-                     {
-                        Hydro_RiemannSolver_HLLE( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                        Hydro_RiemannSolver_HLLE( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                     }
-                     break;
+#              ifndef MHD
+               case RSOLVER_1ST_EXACT:
+                  for (int d=0; d<3; d++)
+                  {
+                     Hydro_RiemannSolver_Exact( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
+                                                EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                     Hydro_RiemannSolver_Exact( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
+                                                EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                  }
+                  break;
+#              endif
 
-#                 ifdef MHD
-                  case RSOLVER_1ST_HLLD:
-                     Aux_Error( ERROR_INFO, "RSOLVER_1ST_HLLD in MHD is NOT supported yet !!\n" );
-                     /*
-                     for (int d=0; d<3; d++)
-                     {
-                        Hydro_RiemannSolver_HLLD( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                        Hydro_RiemannSolver_HLLD( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
-                                                  EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                     }
-                     */
-                     break;
-#                 endif
+#              ifdef MHD
+               case RSOLVER_1ST_HLLD:
+                  Aux_Error( ERROR_INFO, "RSOLVER_1ST_HLLD in MHD is NOT supported yet !!\n" );
+                  /*
+                  for (int d=0; d<3; d++)
+                  {
+                     Hydro_RiemannSolver_HLLD( d, FluxL[d], VarL[d], VarC,    MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                     Hydro_RiemannSolver_HLLD( d, FluxR[d], VarC,    VarR[d], MIN_DENS, MIN_PRES,
+                                               EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                  }
+                  */
+                  break;
+#              endif
 
-                  default:
-                     Aux_Error( ERROR_INFO, "unnsupported Riemann solver (%d) !!\n", OPT__1ST_FLUX_CORR_SCHEME );
-               } // switch ( OPT__1ST_FLUX_CORR_SCHEME )
+               default:
+                  Aux_Error( ERROR_INFO, "unnsupported Riemann solver (%d) !!\n", OPT__1ST_FLUX_CORR_SCHEME );
+            } // switch ( OPT__1ST_FLUX_CORR_SCHEME )
 
-//             recalculate the first-order solution for a full time-step
-               for (int d=0; d<3; d++)
-               for (int v=0; v<NCOMP_TOTAL; v++)   dF[d][v] = FluxR[d][v] - FluxL[d][v];
+//          recalculate the first-order solution for a full time-step
+            for (int d=0; d<3; d++)
+            for (int v=0; v<NCOMP_TOTAL; v++)   dF[d][v] = FluxR[d][v] - FluxL[d][v];
 
-               for (int v=0; v<NCOMP_TOTAL; v++)
-                  Update[v] = h_Flu_Array_F_In[TID][v][idx_in] - dt_dh*( dF[0][v] + dF[1][v] + dF[2][v] );
+            for (int v=0; v<NCOMP_TOTAL; v++)
+               Update[v] = h_Flu_Array_F_In[TID][v][idx_in] - dt_dh*( dF[0][v] + dF[1][v] + dF[2][v] );
 
-            } // if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
+         } // if ( OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
 
 
-//          ========================================================================================
-//          (B) apply the directionally **splitting** correction if the unsplitting correction failed
-//          ========================================================================================
-            if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D )
+//       ========================================================================================
+//       (B) apply the directionally **splitting** correction if the unsplitting correction failed
+//       ========================================================================================
+         if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D )
+         {
+//          apply the dual-energy formalism to correct the internal energy
+//          --> gravity solver may update the internal energy and dual-energy variable again when
+//              UNSPLIT_GRAVITY is adopted
+//          --> if the corrected internal energy (pressure) passes the test, we don't need to apply the
+//              directionally **splitting** correction
+//          --> we do NOT apply the minimum pressure check in Hydro_DualEnergyFix() here
+//              --> otherwise the pressure floor might disable the 1st-order-flux correction
+#           ifdef DUAL_ENERGY
+            Hydro_DualEnergyFix( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY], Update[ENPY],
+                                 h_DE_Array_F_Out[TID][idx_out], EoS_AuxArray[1], EoS_AuxArray[2], CorrPres_No, NULL_REAL,
+                                 DUAL_ENERGY_SWITCH, Emag_Out );
+#           endif
+
+            if ( Unphysical(Update, CheckMinEint, Emag_Out) )
             {
-//             apply the dual-energy formalism to correct the internal energy
-//             --> gravity solver may update the internal energy and dual-energy variable again when
-//                 UNSPLIT_GRAVITY is adopted
-//             --> if the corrected internal energy (pressure) passes the test, we don't need to apply the
-//                 directionally **splitting** correction
-//             --> we do NOT apply the minimum pressure check in Hydro_DualEnergyFix() here
-//                 --> otherwise the pressure floor might disable the 1st-order-flux correction
-#              ifdef DUAL_ENERGY
-               Hydro_DualEnergyFix( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY], Update[ENPY],
-                                    h_DE_Array_F_Out[TID][idx_out], EoS_AuxArray[1], EoS_AuxArray[2], CorrPres_No, NULL_REAL,
-                                    DUAL_ENERGY_SWITCH, Emag_Out );
-#              endif
+//             collect nearby input coserved variables
+               for (int k=0; k<Corr1D_NCell; k++)  { Corr1D_didx2[2] = (k-Corr1D_NBuf)*didx[2];
+               for (int j=0; j<Corr1D_NCell; j++)  { Corr1D_didx2[1] = (j-Corr1D_NBuf)*didx[1];
+               for (int i=0; i<Corr1D_NCell; i++)  { Corr1D_didx2[0] = (i-Corr1D_NBuf)*didx[0];
+
+//                here we have assumed that the fluid solver does NOT modify the input fluid array
+//                --> not applicable to RTVD
+                  for (int v=0; v<NCOMP_TOTAL; v++)
+                     Corr1D_InOut[k][j][i][v] = h_Flu_Array_F_In[TID][v][ idx_in + Corr1D_didx2[0] + Corr1D_didx2[1] + Corr1D_didx2[2] ];
+               }}}
 
-               if ( Unphysical(Update, CheckMinEint, Emag_Out) )
+//             apply the 1st-order-flux correction along different spatial directions **successively**
+               for (int d=0; d<3; d++)
                {
-//                collect nearby input coserved variables
-                  for (int k=0; k<Corr1D_NCell; k++)  { Corr1D_didx2[2] = (k-Corr1D_NBuf)*didx[2];
-                  for (int j=0; j<Corr1D_NCell; j++)  { Corr1D_didx2[1] = (j-Corr1D_NBuf)*didx[1];
-                  for (int i=0; i<Corr1D_NCell; i++)  { Corr1D_didx2[0] = (i-Corr1D_NBuf)*didx[0];
+                  for (int k=Corr1D_idx_min[d][2]; k<=Corr1D_idx_max[d][2]; k++)
+                  for (int j=Corr1D_idx_min[d][1]; j<=Corr1D_idx_max[d][1]; j++)
+                  for (int i=Corr1D_idx_min[d][0]; i<=Corr1D_idx_max[d][0]; i++)
+                  {
+//                   get the pointers to the left and right states for the Riemann solvers
+                     Corr1D_InOut_PtrC = Corr1D_InOut[k][j][i];
+                     Corr1D_InOut_PtrL = Corr1D_InOut_PtrC - Corr1D_didx1[d];
+                     Corr1D_InOut_PtrR = Corr1D_InOut_PtrC + Corr1D_didx1[d];
+
+//                   invoke Riemann solver to calculate the fluxes
+//                   (note that the recalculated flux does NOT include gravity even for UNSPLIT_GRAVITY --> reduce to 1st-order accuracy)
+                     switch ( OPT__1ST_FLUX_CORR_SCHEME )
+                     {
+                        case RSOLVER_1ST_ROE:
+                           Hydro_RiemannSolver_Roe ( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           Hydro_RiemannSolver_Roe ( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                        break;
+
+#                       ifndef MHD
+                        case RSOLVER_1ST_HLLC:
+                           Hydro_RiemannSolver_HLLC( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           Hydro_RiemannSolver_HLLC( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                        break;
+#                       endif
+
+                        case RSOLVER_1ST_HLLE:
+                           Hydro_RiemannSolver_HLLE( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           Hydro_RiemannSolver_HLLE( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                        break;
+
+#                       ifndef MHD
+                        case RSOLVER_1ST_EXACT:
+                           Hydro_RiemannSolver_Exact( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
+                                                      EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           Hydro_RiemannSolver_Exact( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
+                                                      EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                        break;
+#                       endif
+
+#                       ifdef MHD
+                        case RSOLVER_1ST_HLLD:
+                           Aux_Error( ERROR_INFO, "RSOLVER_1ST_HLLD in MHD is NOT supported yet !!\n" );
+                           /*
+                           Hydro_RiemannSolver_HLLD( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           Hydro_RiemannSolver_HLLD( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
+                                                     EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+                           */
+                        break;
+#                       endif
+
+                        default:
+                           Aux_Error( ERROR_INFO, "unnsupported Riemann solver (%d) !!\n", OPT__1ST_FLUX_CORR_SCHEME );
+                     }
 
-//                   here we have assumed that the fluid solver does NOT modify the input fluid array
-//                   --> not applicable to RTVD
+//                   recalculate the first-order solution for a full time-step
                      for (int v=0; v<NCOMP_TOTAL; v++)
-                        Corr1D_InOut[k][j][i][v] = h_Flu_Array_F_In[TID][v][ idx_in + Corr1D_didx2[0] + Corr1D_didx2[1] + Corr1D_didx2[2] ];
-                  }}}
+                        Corr1D_InOut[k][j][i][v] -= dt_dh*( FluxR_1D[v] - FluxL_1D[v] );
 
-//                apply the 1st-order-flux correction along different spatial directions **successively**
-                  for (int d=0; d<3; d++)
-                  {
-                     for (int k=Corr1D_idx_min[d][2]; k<=Corr1D_idx_max[d][2]; k++)
-                     for (int j=Corr1D_idx_min[d][1]; j<=Corr1D_idx_max[d][1]; j++)
-                     for (int i=Corr1D_idx_min[d][0]; i<=Corr1D_idx_max[d][0]; i++)
+//                   store the 1st-order fluxes used for updating the central cell
+                     if ( i == Corr1D_NBuf  &&  j == Corr1D_NBuf  &&  k == Corr1D_NBuf )
                      {
-//                      get the pointers to the left and right states for the Riemann solvers
-                        Corr1D_InOut_PtrC = Corr1D_InOut[k][j][i];
-                        Corr1D_InOut_PtrL = Corr1D_InOut_PtrC - Corr1D_didx1[d];
-                        Corr1D_InOut_PtrR = Corr1D_InOut_PtrC + Corr1D_didx1[d];
-
-//                      invoke Riemann solver to calculate the fluxes
-//                      (note that the recalculated flux does NOT include gravity even for UNSPLIT_GRAVITY --> reduce to 1st-order accuracy)
-                        switch ( OPT__1ST_FLUX_CORR_SCHEME )
+                        for (int v=0; v<NCOMP_TOTAL; v++)
                         {
-                           case RSOLVER_1ST_ROE:
-                              Hydro_RiemannSolver_Roe ( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                              Hydro_RiemannSolver_Roe ( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                           break;
-
-#                          ifndef MHD
-                           case RSOLVER_1ST_HLLC:
-                              Hydro_RiemannSolver_HLLC( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                              Hydro_RiemannSolver_HLLC( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                           break;
-#                          endif
-
-                           case RSOLVER_1ST_HLLE:
-                              Hydro_RiemannSolver_HLLE( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                              Hydro_RiemannSolver_HLLE( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                           break;
-
-#                          ifdef MHD
-                           case RSOLVER_1ST_HLLD:
-                              Aux_Error( ERROR_INFO, "RSOLVER_1ST_HLLD in MHD is NOT supported yet !!\n" );
-                              /*
-                              Hydro_RiemannSolver_HLLD( d, FluxL_1D, Corr1D_InOut_PtrL, Corr1D_InOut_PtrC, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                              Hydro_RiemannSolver_HLLD( d, FluxR_1D, Corr1D_InOut_PtrC, Corr1D_InOut_PtrR, MIN_DENS, MIN_PRES,
-                                                        EoS_DensEint2Pres_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
-                              */
-                           break;
-#                          endif
-
-                           default:
-                              Aux_Error( ERROR_INFO, "unnsupported Riemann solver (%d) !!\n", OPT__1ST_FLUX_CORR_SCHEME );
+                           FluxL[d][v] = FluxL_1D[v];
+                           FluxR[d][v] = FluxR_1D[v];
                         }
+                     }
+                  } // i,j,k
+               } // for (int d=0; d<3; d++)
 
-//                      recalculate the first-order solution for a full time-step
-                        for (int v=0; v<NCOMP_TOTAL; v++)
-                           Corr1D_InOut[k][j][i][v] -= dt_dh*( FluxR_1D[v] - FluxL_1D[v] );
+//             store the corrected results in Update[]
+               for (int v=0; v<NCOMP_TOTAL; v++)
+                  Update[v] = Corr1D_InOut[Corr1D_NBuf][Corr1D_NBuf][Corr1D_NBuf][v];
 
-//                      store the 1st-order fluxes used for updating the central cell
-                        if ( i == Corr1D_NBuf  &&  j == Corr1D_NBuf  &&  k == Corr1D_NBuf )
-                        {
-                           for (int v=0; v<NCOMP_TOTAL; v++)
-                           {
-                              FluxL[d][v] = FluxL_1D[v];
-                              FluxR[d][v] = FluxR_1D[v];
-                           }
-                        }
-                     } // i,j,k
-                  } // for (int d=0; d<3; d++)
+            } // if ( Unphysical(Update, CheckMinEint, Emag_Out) )
+         } // if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D )
 
-//                store the corrected results in Update[]
-                  for (int v=0; v<NCOMP_TOTAL; v++)
-                     Update[v] = Corr1D_InOut[Corr1D_NBuf][Corr1D_NBuf][Corr1D_NBuf][v];
 
-               } // if ( Unphysical(Update, CheckMinEint, Emag_Out) )
-            } // if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D )
+//       ========================================================================================
+//       (C) if OPT__1ST_FLUX_CORR is off, just copy data to Update[] for checking unphysical results
+//           in the next step
+//       ========================================================================================
+         if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_NONE )
+         {
+            for (int v=0; v<NCOMP_TOTAL; v++)   Update[v] = Out[v];
+         }
 
 
-//          ========================================================================================
-//          (C) if OPT__1ST_FLUX_CORR is off, just copy data to Update[] for checking unphysical results
-//              in the next step
-//          ========================================================================================
-            if ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_NONE )
-            {
-               for (int v=0; v<NCOMP_TOTAL; v++)   Update[v] = Out[v];
-            }
+//       ensure positive density
+//       --> apply it only when AutoReduceDt_Continue is false
+//           --> otherwise AUTO_REDUCE_DT may not be triggered due to this density floor
+//       --> note that MIN_DENS is declared as double and must be converted to **real** before the comparison
+//           --> to be consistent with the check in Unphysical()
+//       --> do NOT check the minimum internal energy here since we want to apply the dual-energy correction first
+         if ( ! AutoReduceDt_Continue  &&  OPT__LAST_RESORT_FLOOR )
+            Update[DENS] = FMAX( Update[DENS], (real)MIN_DENS );
 
 
-//          ensure positive density
-//          --> apply it only when AutoReduceDt_Continue is false
-//              --> otherwise AUTO_REDUCE_DT may not be triggered due to this density floor
-//          --> note that MIN_DENS is declared as double and must be converted to **real** before the comparison
-//              --> to be consistent with the check in Unphysical()
-//          --> do NOT check the minimum internal energy here since we want to apply the dual-energy correction first
-            if ( ! AutoReduceDt_Continue  &&  OPT__LAST_RESORT_FLOOR )
-               Update[DENS] = FMAX( Update[DENS], (real)MIN_DENS );
+//       floor and normalize passive scalars
+#        if ( NCOMP_PASSIVE > 0 )
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Update[v] = FMAX( Update[v], TINY_NUMBER );
 
+         if ( OPT__NORMALIZE_PASSIVE )
+            Hydro_NormalizePassive( Update[DENS], Update+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#        endif
 
-//          floor and normalize passive scalars
-#           if ( NCOMP_PASSIVE > 0 )
-            for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Update[v] = FMAX( Update[v], TINY_NUMBER );
 
-            if ( OPT__NORMALIZE_PASSIVE )
-               Hydro_NormalizePassive( Update[DENS], Update+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
-#           endif
+//       apply the dual-energy formalism to correct the internal energy again
+//       --> gravity solver may update the internal energy and dual-energy variable again when
+//           UNSPLIT_GRAVITY is adopted
+//       --> this might be redundant when OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D
+//           --> but it ensures the consistency between all fluid variables since we apply density floor AFTER
+//               the 1st-order-flux correction
+//       --> we apply the minimum pressure check in Hydro_DualEnergyFix() here only when AutoReduceDt_Continue is false
+//           --> otherwise AUTO_REDUCE_DT may not be triggered due to this pressure floor
+#        ifdef DUAL_ENERGY
+         Hydro_DualEnergyFix( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY], Update[ENPY],
+                              h_DE_Array_F_Out[TID][idx_out], EoS_AuxArray[1], EoS_AuxArray[2],
+                              (!AutoReduceDt_Continue && OPT__LAST_RESORT_FLOOR) ? CorrPres_Yes : CorrPres_No,
+                              MIN_PRES, DUAL_ENERGY_SWITCH, Emag_Out );
+
+//       apply internal energy floor if dual-energy formalism is not adopted
+//       --> apply it only when AutoReduceDt_Continue is false
+//           --> otherwise AUTO_REDUCE_DT may not be triggered due to this internal energy floor
+#        else
+         if ( ! AutoReduceDt_Continue  &&  OPT__LAST_RESORT_FLOOR )
+            Update[ENGY] = Hydro_CheckMinEintInEngy( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
+                                                     MIN_EINT, Emag_Out );
+#        endif
 
 
-//          apply the dual-energy formalism to correct the internal energy again
-//          --> gravity solver may update the internal energy and dual-energy variable again when
-//              UNSPLIT_GRAVITY is adopted
-//          --> this might be redundant when OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D
-//              --> but it ensures the consistency between all fluid variables since we apply density floor AFTER
-//                  the 1st-order-flux correction
-//          --> we apply the minimum pressure check in Hydro_DualEnergyFix() here only when AutoReduceDt_Continue is false
-//              --> otherwise AUTO_REDUCE_DT may not be triggered due to this pressure floor
-#           ifdef DUAL_ENERGY
-            Hydro_DualEnergyFix( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY], Update[ENPY],
-                                 h_DE_Array_F_Out[TID][idx_out], EoS_AuxArray[1], EoS_AuxArray[2],
-                                 (!AutoReduceDt_Continue && OPT__LAST_RESORT_FLOOR) ? CorrPres_Yes : CorrPres_No,
-                                 MIN_PRES, DUAL_ENERGY_SWITCH, Emag_Out );
+//       check if the newly updated values are still unphysical
+//       --> note that, when AutoReduceDt_Continue is false, we check Etot instead of Eint since even after calling
+//           Hydro_CheckMinEintInEngy() we may still have Eint < MIN_EINT due to round-off errors (especially when Eint << Ekin)
+//           --> it will not crash the code since we always apply MIN_EINT/MIN_PRES when calculating Eint/pressure
+//       --> when AutoReduceDt_Continue is true, we still check Eint instead of Etot
+         if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
+         {
+//          set CorrectUnphy = GAMER_FAILED if any cells fail
+//          --> use critical directive to avoid thread racing (may not be necessary here?)
+#           pragma omp critical
+            CorrectUnphy = GAMER_FAILED;
 
-//          apply internal energy floor if dual-energy formalism is not adopted
-//          --> apply it only when AutoReduceDt_Continue is false
-//              --> otherwise AUTO_REDUCE_DT may not be triggered due to this internal energy floor
-#           else
-            if ( ! AutoReduceDt_Continue  &&  OPT__LAST_RESORT_FLOOR )
-               Update[ENGY] = Hydro_CheckMinEintInEngy( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
-                                                        MIN_EINT, Emag_Out );
-#           endif
+            FailedPG = true;
 
 
-//          check if the newly updated values are still unphysical
-//          --> note that, when AutoReduceDt_Continue is false, we check Etot instead of Eint since even after calling
-//              Hydro_CheckMinEintInEngy() we may still have Eint < MIN_EINT due to round-off errors (especially when Eint << Ekin)
-//              --> it will not crash the code since we always apply MIN_EINT/MIN_PRES when calculating Eint/pressure
-//          --> when AutoReduceDt_Continue is true, we still check Eint instead of Etot
-            if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
+//          output the debug information (only if AutoReduceDt_Continue is false)
+            if ( ! AutoReduceDt_Continue )
             {
-//             set CorrectUnphy = GAMER_FAILED if any cells fail
-//             --> use critical directive to avoid thread racing (may not be necessary here?)
-#              pragma omp critical
-               CorrectUnphy = GAMER_FAILED;
+               const int  PID_Failed      = PID0_List[TID] + LocalID[ijk_out[2]/PS1][ijk_out[1]/PS1][ijk_out[0]/PS1];
+               const bool CheckMinEint_No = false;
+               real In[NCOMP_TOTAL], tmp[NCOMP_TOTAL];
+
+               char FileName[100];
+               sprintf( FileName, "FailedPatchGroup_r%03d_lv%02d_PID0-%05d", MPI_Rank, lv, PID0_List[TID] );
+
+//             use "a" instead of "w" since there may be more than one failed cell in a given patch group
+               FILE *File = fopen( FileName, "a" );
+
+               for (int v=0; v<NCOMP_TOTAL; v++)   In[v] = h_Flu_Array_F_In[TID][v][idx_in];
+
+#              ifdef MHD
+               const real Emag_In     = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_In[TID][MAGX],
+                                                                    h_Mag_Array_F_In[TID][MAGY],
+                                                                    h_Mag_Array_F_In[TID][MAGZ],
+                                                                    FLU_NXT, FLU_NXT, FLU_NXT,
+                                                                    ijk_out[0]+FLU_GHOST_SIZE,
+                                                                    ijk_out[1]+FLU_GHOST_SIZE,
+                                                                    ijk_out[2]+FLU_GHOST_SIZE );
+               const real Emag_Update = Emag_Out;
+#              else
+               const real Emag_In     = NULL_REAL;
+               const real Emag_Update = NULL_REAL;
+#              endif
 
+//             output information about the failed cell
+               fprintf( File, "PID                              = %5d\n", PID_Failed );
+               fprintf( File, "(i,j,k) in the patch             = (%2d,%2d,%2d)\n", ijk_out[0]%PS1, ijk_out[1]%PS1, ijk_out[2]%PS1 );
+               fprintf( File, "(i,j,k) in the input fluid array = (%2d,%2d,%2d)\n", ijk_out[0], ijk_out[1], ijk_out[2] );
+#              ifdef DUAL_ENERGY
+               fprintf( File, "total energy density update      = %s\n",
+                        ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_ETOT     ) ? "Etot" :
+                        ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_DUAL     ) ? "Dual" :
+                        ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_MIN_PRES ) ? "MinPres" :
+                                                                                       "Unknown" );
+#              endif
+               fprintf( File, "\n" );
 
-//             output the debug information (only if AutoReduceDt_Continue is false)
-               if ( ! AutoReduceDt_Continue )
+               fprintf( File, "               (%14s, %14s, %14s, %14s, %14s, %14s",
+                        FieldLabel[DENS], FieldLabel[MOMX], FieldLabel[MOMY], FieldLabel[MOMZ], FieldLabel[ENGY], "Eint" );
+#              if ( DUAL_ENERGY == DE_ENPY )
+               fprintf( File, ", %14s", FieldLabel[ENPY] );
+#              endif
+               fprintf( File, ")\n" );
+
+               fprintf( File, "input        = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
+                        In[DENS], In[MOMX], In[MOMY], In[MOMZ], In[ENGY],
+                        Hydro_Con2Eint(In[DENS], In[MOMX], In[MOMY], In[MOMZ], In[ENGY],
+                                       CheckMinEint_No, NULL_REAL, Emag_In) );
+#              if ( DUAL_ENERGY == DE_ENPY )
+               fprintf( File, ", %14.7e", In[ENPY] );
+#              endif
+               fprintf( File, ")\n" );
+
+               fprintf( File, "ouptut (old) = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
+                        Out[DENS], Out[MOMX], Out[MOMY], Out[MOMZ], Out[ENGY],
+                        Hydro_Con2Eint(Out[DENS], Out[MOMX], Out[MOMY], Out[MOMZ], Out[ENGY],
+                                       CheckMinEint_No, NULL_REAL, Emag_Out) );
+#              if ( DUAL_ENERGY == DE_ENPY )
+               fprintf( File, ", %14.7e", Out[ENPY] );
+#              endif
+               fprintf( File, ")\n" );
+
+               fprintf( File, "output (new) = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
+                        Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
+                        Hydro_Con2Eint(Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
+                                       CheckMinEint_No, NULL_REAL, Emag_Update) );
+#              if ( DUAL_ENERGY == DE_ENPY )
+               fprintf( File, ", %14.7e", Update[ENPY] );
+#              endif
+               fprintf( File, ")\n" );
+
+//             output all data in the input fluid array (including ghost zones)
+               fprintf( File, "\nFull input array including ghost zones\n" );
+               fprintf( File, "===============================================================================================\n" );
+               fprintf( File, "(%2s,%2s,%2s)", "i", "j", "k" );
+               for (int v=0; v<NCOMP_TOTAL; v++)   fprintf( File, " %14s", FieldLabel[v] );
+               fprintf( File, " %14s", "Eint" );
+               fprintf( File, "\n" );
+
+               for (int k=0; k<FLU_NXT; k++)
+               for (int j=0; j<FLU_NXT; j++)
+               for (int i=0; i<FLU_NXT; i++)
                {
-                  const int  PID_Failed      = PID0_List[TID] + LocalID[ijk_out[2]/PS1][ijk_out[1]/PS1][ijk_out[0]/PS1];
-                  const bool CheckMinEint_No = false;
-                  real In[NCOMP_TOTAL], tmp[NCOMP_TOTAL];
+                  fprintf( File, "(%2d,%2d,%2d)", i-FLU_GHOST_SIZE, j-FLU_GHOST_SIZE, k-FLU_GHOST_SIZE );
 
-                  char FileName[100];
-                  sprintf( FileName, "FailedPatchGroup_r%03d_lv%02d_PID0-%05d", MPI_Rank, lv, PID0_List[TID] );
-
-//                use "a" instead of "w" since there may be more than one failed cell in a given patch group
-                  FILE *File = fopen( FileName, "a" );
-
-                  for (int v=0; v<NCOMP_TOTAL; v++)   In[v] = h_Flu_Array_F_In[TID][v][idx_in];
+                  for (int v=0; v<NCOMP_TOTAL; v++)
+                  {
+                     tmp[v] = h_Flu_Array_F_In[TID][v][ ((k*FLU_NXT)+j)*FLU_NXT+i ];
+                     fprintf( File, " %14.7e", tmp[v] );
+                  }
 
 #                 ifdef MHD
-                  const real Emag_In     = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_In[TID][MAGX],
-                                                                       h_Mag_Array_F_In[TID][MAGY],
-                                                                       h_Mag_Array_F_In[TID][MAGZ],
-                                                                       FLU_NXT, FLU_NXT, FLU_NXT,
-                                                                       ijk_out[0]+FLU_GHOST_SIZE,
-                                                                       ijk_out[1]+FLU_GHOST_SIZE,
-                                                                       ijk_out[2]+FLU_GHOST_SIZE );
-                  const real Emag_Update = Emag_Out;
+                  const real Emag_tmp = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_In[TID][MAGX],
+                                                                    h_Mag_Array_F_In[TID][MAGY],
+                                                                    h_Mag_Array_F_In[TID][MAGZ],
+                                                                    FLU_NXT, FLU_NXT, FLU_NXT, i, j, k );
 #                 else
-                  const real Emag_In     = NULL_REAL;
-                  const real Emag_Update = NULL_REAL;
+                  const real Emag_tmp = NULL_REAL;
 #                 endif
 
-//                output information about the failed cell
-                  fprintf( File, "PID                              = %5d\n", PID_Failed );
-                  fprintf( File, "(i,j,k) in the patch             = (%2d,%2d,%2d)\n", ijk_out[0]%PS1, ijk_out[1]%PS1, ijk_out[2]%PS1 );
-                  fprintf( File, "(i,j,k) in the input fluid array = (%2d,%2d,%2d)\n", ijk_out[0], ijk_out[1], ijk_out[2] );
-#                 ifdef DUAL_ENERGY
-                  fprintf( File, "total energy density update      = %s\n",
-                           ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_ETOT     ) ? "Etot" :
-                           ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_DUAL     ) ? "Dual" :
-                           ( h_DE_Array_F_Out[TID][idx_out] == DE_UPDATED_BY_MIN_PRES ) ? "MinPres" :
-                                                                                          "Unknown" );
-#                 endif
-                  fprintf( File, "\n" );
-
-                  fprintf( File, "               (%14s, %14s, %14s, %14s, %14s, %14s",
-                           FieldLabel[DENS], FieldLabel[MOMX], FieldLabel[MOMY], FieldLabel[MOMZ], FieldLabel[ENGY], "Eint" );
-#                 if ( DUAL_ENERGY == DE_ENPY )
-                  fprintf( File, ", %14s", FieldLabel[ENPY] );
-#                 endif
-                  fprintf( File, ")\n" );
-
-                  fprintf( File, "input        = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
-                           In[DENS], In[MOMX], In[MOMY], In[MOMZ], In[ENGY],
-                           Hydro_Con2Eint(In[DENS], In[MOMX], In[MOMY], In[MOMZ], In[ENGY],
-                                          CheckMinEint_No, NULL_REAL, Emag_In) );
-#                 if ( DUAL_ENERGY == DE_ENPY )
-                  fprintf( File, ", %14.7e", In[ENPY] );
-#                 endif
-                  fprintf( File, ")\n" );
-
-                  fprintf( File, "ouptut (old) = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
-                           Out[DENS], Out[MOMX], Out[MOMY], Out[MOMZ], Out[ENGY],
-                           Hydro_Con2Eint(Out[DENS], Out[MOMX], Out[MOMY], Out[MOMZ], Out[ENGY],
-                                          CheckMinEint_No, NULL_REAL, Emag_Out) );
-#                 if ( DUAL_ENERGY == DE_ENPY )
-                  fprintf( File, ", %14.7e", Out[ENPY] );
-#                 endif
-                  fprintf( File, ")\n" );
-
-                  fprintf( File, "output (new) = (%14.7e, %14.7e, %14.7e, %14.7e, %14.7e, %14.7e",
-                           Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
-                           Hydro_Con2Eint(Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY],
-                                          CheckMinEint_No, NULL_REAL, Emag_Update) );
-#                 if ( DUAL_ENERGY == DE_ENPY )
-                  fprintf( File, ", %14.7e", Update[ENPY] );
-#                 endif
-                  fprintf( File, ")\n" );
-
-//                output all data in the input fluid array (including ghost zones)
-                  fprintf( File, "\nFull input array including ghost zones\n" );
-                  fprintf( File, "===============================================================================================\n" );
-                  fprintf( File, "(%2s,%2s,%2s)", "i", "j", "k" );
-                  for (int v=0; v<NCOMP_TOTAL; v++)   fprintf( File, " %14s", FieldLabel[v] );
-                  fprintf( File, " %14s", "Eint" );
-                  fprintf( File, "\n" );
-
-                  for (int k=0; k<FLU_NXT; k++)
-                  for (int j=0; j<FLU_NXT; j++)
-                  for (int i=0; i<FLU_NXT; i++)
-                  {
-                     fprintf( File, "(%2d,%2d,%2d)", i-FLU_GHOST_SIZE, j-FLU_GHOST_SIZE, k-FLU_GHOST_SIZE );
+                  fprintf( File, " %14.7e\n", Hydro_Con2Eint(tmp[0], tmp[1], tmp[2], tmp[3], tmp[4],
+                                                             CheckMinEint_No, NULL_REAL, Emag_tmp) );
+               }
 
-                     for (int v=0; v<NCOMP_TOTAL; v++)
-                     {
-                        tmp[v] = h_Flu_Array_F_In[TID][v][ ((k*FLU_NXT)+j)*FLU_NXT+i ];
-                        fprintf( File, " %14.7e", tmp[v] );
-                     }
+               fclose( File );
 
-#                    ifdef MHD
-                     const real Emag_tmp = MHD_GetCellCenteredBEnergy( h_Mag_Array_F_In[TID][MAGX],
-                                                                       h_Mag_Array_F_In[TID][MAGY],
-                                                                       h_Mag_Array_F_In[TID][MAGZ],
-                                                                       FLU_NXT, FLU_NXT, FLU_NXT, i, j, k );
-#                    else
-                     const real Emag_tmp = NULL_REAL;
-#                    endif
-
-                     fprintf( File, " %14.7e\n", Hydro_Con2Eint(tmp[0], tmp[1], tmp[2], tmp[3], tmp[4],
-                                                                CheckMinEint_No, NULL_REAL, Emag_tmp) );
-                  }
+//             output the failed patch (mainly for recording the sibling information)
+#              ifdef MHD
+               const int MagSg = amr->MagSg[lv];
+#              else
+               const int MagSg = NULL_INT;
+#              endif
+#              ifdef GRAVITY
+               const int PotSg = amr->PotSg[lv];
+#              else
+               const int PotSg = NULL_INT;
+#              endif
+               Output_Patch( lv, PID_Failed, amr->FluSg[lv], MagSg, PotSg, "Unphy" );
+            } // if ( ! AutoReduceDt_Continue )
+         } // if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
 
-                  fclose( File );
+         else
+         {
+//          store the corrected solution
+            for (int v=0; v<NCOMP_TOTAL; v++)   h_Flu_Array_F_Out[TID][v][idx_out] = Update[v];
 
-//                output the failed patch (mainly for recording the sibling information)
-#                 ifdef MHD
-                  const int MagSg = amr->MagSg[lv];
-#                 else
-                  const int MagSg = NULL_INT;
-#                 endif
-#                 ifdef GRAVITY
-                  const int PotSg = amr->PotSg[lv];
-#                 else
-                  const int PotSg = NULL_INT;
-#                 endif
-                  Output_Patch( lv, PID_Failed, amr->FluSg[lv], MagSg, PotSg, "Unphy" );
-               } // if ( ! AutoReduceDt_Continue )
-            } // if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
 
-            else
+//          replace the original coarse-fine boundary fluxes with the 1st-order fluxes for the flux fix-up
+            if ( OPT__FIXUP_FLUX  &&  OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
             {
-//             store the corrected solution
-               for (int v=0; v<NCOMP_TOTAL; v++)   h_Flu_Array_F_Out[TID][v][idx_out] = Update[v];
+               const int dim_map[3][2] = { {1, 2}, {0, 2}, {0, 1} };
 
+               int   idx_m, idx_n, idx_store, FaceIdx;
+               bool  Store1stFlux;
+               real *FluxPtr=NULL;
 
-//             replace the original coarse-fine boundary fluxes with the 1st-order fluxes for the flux fix-up
-               if ( OPT__FIXUP_FLUX  &&  OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
+               for (int d=0; d<3; d++)
                {
-                  const int dim_map[3][2] = { {1, 2}, {0, 2}, {0, 1} };
+                  Store1stFlux = false;
 
-                  int   idx_m, idx_n, idx_store, FaceIdx;
-                  bool  Store1stFlux;
-                  real *FluxPtr=NULL;
+                  if ( ijk_out[d] == 0  ||  ijk_out[d] == PS1 )
+                  {
+                     FluxPtr      = FluxL[d];
+                     FaceIdx      = 3*d + ijk_out[d]/PS1;
+                     Store1stFlux = true;
+                  }
 
-                  for (int d=0; d<3; d++)
+                  else if ( ijk_out[d] == PS1-1  ||  ijk_out[d] == PS2-1 )
                   {
-                     Store1stFlux = false;
+                     FluxPtr      = FluxR[d];
+                     FaceIdx      = 3*d + (ijk_out[d]+1)/PS1;
+                     Store1stFlux = true;
+                  }
 
-                     if ( ijk_out[d] == 0  ||  ijk_out[d] == PS1 )
-                     {
-                        FluxPtr      = FluxL[d];
-                        FaceIdx      = 3*d + ijk_out[d]/PS1;
-                        Store1stFlux = true;
-                     }
+                  if ( Store1stFlux )
+                  {
+                     idx_m     = ijk_out[ dim_map[d][1] ];
+                     idx_n     = ijk_out[ dim_map[d][0] ];
+                     idx_store = idx_m*PS2 + idx_n;
 
-                     else if ( ijk_out[d] == PS1-1  ||  ijk_out[d] == PS2-1 )
-                     {
-                        FluxPtr      = FluxR[d];
-                        FaceIdx      = 3*d + (ijk_out[d]+1)/PS1;
-                        Store1stFlux = true;
-                     }
+                     for (int v=0; v<NCOMP_TOTAL; v++)   h_Flux_Array[TID][FaceIdx][v][idx_store] = FluxPtr[v];
+                  }
+               } // for (int d=0; d<3; d++)
+            } // if ( OPT__FIXUP_FLUX  &&  OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
 
-                     if ( Store1stFlux )
-                     {
-                        idx_m     = ijk_out[ dim_map[d][1] ];
-                        idx_n     = ijk_out[ dim_map[d][0] ];
-                        idx_store = idx_m*PS2 + idx_n;
+//          record the number of corrected cells
+            NCorrThisTime ++;
 
-                        for (int v=0; v<NCOMP_TOTAL; v++)   h_Flux_Array[TID][FaceIdx][v][idx_store] = FluxPtr[v];
-                     }
-                  } // for (int d=0; d<3; d++)
-               } // if ( OPT__FIXUP_FLUX  &&  OPT__1ST_FLUX_CORR != FIRST_FLUX_CORR_NONE )
+         } // if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) ) ... else ...
+      } // for (int u=0; u<NUnphy; u++)
 
-//             record the number of corrected cells
-               NCorrThisTime ++;
 
-            } // if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) ) ... else ...
-         } // if need correction
-      } // i,j,k
+//    3. record the failed patch group for AUTO_REDUCE_DT_LOCAL
+//       --> after correcting all cells since the 1st-order-flux correction may modify the flux array
+#     ifndef GPU
+      if ( FailedPG  &&  AUTO_REDUCE_DT_LOCAL  &&  AutoReduceDt_Continue )
+         Flu_RecordFailedPatchGroup( PID0_List[TID], h_Flux_Array[TID] );
+#     endif
    } // for (int TID=0; TID<NPG; TID++)
 
+   THREAD_TIMER_STOP();
+
 // "delete" applies to NULL as well
    delete [] Corr1D_InOut;
+   delete [] UnphyList;
 
    } // end of OpenMP parallel region
 
@@ -1367,4 +1619,213 @@ void CorrectElectric( const int SonLv, const real h_Ele_Array[][9][NCOMP_ELE][ P
 } // FUNCTION : CorrectElectric
 
 #endif // #ifdef MHD
+
+
+
+#ifndef MHD
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RecordMaxCFL
+// Description :  Record the maximum CFL speed of each updated patch in patch_t::dt_MaxCFL for OPT__DT_FLU_BYPRODUCT
+//
+// Note        :  1. Invoked by Flu_Close()
+//                2. Adopt the same CFL speed as CPU/CUFLU_dtSolver_HydroCFL() (see dt_GetCFLSpeed_Hydro()) so that
+//                   the resulting dt is identical to that of the dt solver when the fluid data are not modified
+//                   after the fluid solver
+//                   --> Patches updated by the restriction and flux fix-up operations are re-evaluated by
+//                       dt_InvokeSolver()
+//
+// Parameter   :  lv                : Target refinement level
+//                h_Flu_Array_F_Out : Host array storing the updated fluid data
+//                NPG               : Number of patch groups to be evaluated
+//                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
+//-------------------------------------------------------------------------------------------------------
+void RecordMaxCFL( const int lv, const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ], const int NPG,
+                   const int *PID0_List )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int Table_x = TABLE_02( LocalID, 'x', 0, PATCH_SIZE );
+      const int Table_y = TABLE_02( LocalID, 'y', 0, PATCH_SIZE );
+      const int Table_z = TABLE_02( LocalID, 'z', 0, PATCH_SIZE );
+
+      real MaxCFL = (real)0.0;
+
+      for (int k=Table_z; k<Table_z+PATCH_SIZE; k++)
+      for (int j=Table_y; j<Table_y+PATCH_SIZE; j++)
+      for (int i=Table_x; i<Table_x+PATCH_SIZE; i++)
+      {
+         const int t = IDX321( i, j, k, PS2, PS2 );
+
+         real fluid[FLU_NOUT];
+
+         for (int v=0; v<FLU_NOUT; v++)   fluid[v] = h_Flu_Array_F_Out[TID][v][t];
+
+         MaxCFL = FMAX( dt_GetCFLSpeed_Hydro(fluid), MaxCFL );
+      }
+
+      amr->patch[0][lv][ PID0_List[TID] + LocalID ]->dt_MaxCFL = MaxCFL;
+   } // for TID, LocalID
+
+} // FUNCTION : RecordMaxCFL
+#endif // #ifndef MHD
+
+
+
+#endif // #if ( MODEL == HYDRO )
+
+
+
+#if ( MODEL == HYDRO )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RecordBndFlux
+// Description :  Accumulate the fluxes across the non-periodic simulation boundaries at level "lv" for
+//                OPT__RECORD_CONSERVATION
+//
+// Note        :  1. Invoked by Flu_Close()
+//                2. Only leaf patches are considered since the data of non-leaf patches will be replaced by
+//                   the restricted data of their sons
+//                3. Accumulate results in Cons_Bnd[], which are recorded by Aux_Record_Conservation()
+//                   --> Inflow is positive
+//                4. Not parallelized by OpenMP since only the patches adjacent to the simulation boundaries
+//                   have non-trivial work
+//
+// Parameter   :  lv           : Target refinement level
+//                h_Flux_Array : Host array storing the updated flux data
+//                NPG          : Number of patch groups to be evaluated
+//                PID0_List    : List recording the patch indices with LocalID==0 to be udpated
+//                dt           : Evolution time-step
+//-------------------------------------------------------------------------------------------------------
+void RecordBndFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                    const int NPG, const int *PID0_List, const real dt )
+{
+
+   const double dt_dA = dt*SQR( amr->dh[lv] );
+
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int PID0 = PID0_List[TID];
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID = PID0 + LocalID;
+
+         if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+         for (int s=0; s<6; s++)
+         {
+            if ( amr->patch[0][lv][PID]->sibling[s] > SIB_OFFSET_NONPERIODIC )   continue;
+
+            int face_idx, disp_m, disp_n;
+
+            switch ( s )
+            {
+               case 0:  case 1:
+                  face_idx = TABLE_02( LocalID, 'x', 0, 1 ) + s;
+                  disp_m   = TABLE_02( LocalID, 'z', 0, PS1 );
+                  disp_n   = TABLE_02( LocalID, 'y', 0, PS1 );
+                  break;
+
+               case 2:  case 3:
+                  face_idx = TABLE_02( LocalID, 'y', 1, 2 ) + s;
+                  disp_m   = TABLE_02( LocalID, 'z', 0, PS1 );
+                  disp_n   = TABLE_02( LocalID, 'x', 0, PS1 );
+                  break;
+
+               case 4:  case 5:
+                  face_idx = TABLE_02( LocalID, 'z', 2, 3 ) + s;
+                  disp_m   = TABLE_02( LocalID, 'y', 0, PS1 );
+                  disp_n   = TABLE_02( LocalID, 'x', 0, PS1 );
+                  break;
+
+               default:
+                  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "s", s );
+            }
+
+//          fluxes are positive along the +x/y/z directions
+            const double Sign = ( s%2 == 0 ) ? +1.0 : -1.0;
+
+            for (int v=0; v<NFLUX_TOTAL; v++)
+            {
+               double Sum = 0.0;
+
+               for (int m=0; m<PS1; m++)  {  const int mm = m + disp_m;
+               for (int n=0; n<PS1; n++)  {  const int nn = n + disp_n;
+                  Sum += h_Flux_Array[TID][face_idx][v][ mm*PS2 + nn ];
+               }}
+
+               Cons_Bnd[v] += Sign*dt_dA*Sum;
+            }
+         } // for (int s=0; s<6; s++)
+      } // for (int LocalID=0; LocalID<8; LocalID++)
+   } // for (int TID=0; TID<NPG; TID++)
+
+} // FUNCTION : RecordBndFlux
 #endif // #if ( MODEL == HYDRO )
+
+
+
+#ifdef MHD
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RecordDivB
+// Description :  Accumulate the divergence of the updated B field at level "lv" for OPT__RECORD_DIVB
+//
+// Note        :  1. Invoked by Flu_Close()
+//                2. Computed directly from the output array of the fluid solver, which already stores the complete
+//                   face-centered B field of each patch group
+//                   --> Unlike MHD_Aux_Check_DivergenceB(), it requires neither an extra traversal of the
+//                       AMR hierarchy nor any sibling lookup
+//                   --> But modifications after the fluid solver (e.g., restriction and electric field fix-up)
+//                       are not covered
+//                3. Adopt the same normalization as MHD_Aux_Check_DivergenceB()
+//                4. Accumulate results in MHD_DivB_Max/Sqr/NCell[lv], which are recorded and reset by
+//                   MHD_Aux_Record_DivergenceB()
+//
+// Parameter   :  lv                : Target refinement level
+//                h_Mag_Array_F_Out : Host array storing the updated B field
+//                NPG               : Number of patch groups to be evaluated
+//-------------------------------------------------------------------------------------------------------
+void RecordDivB( const int lv, const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ], const int NPG )
+{
+
+   double DivB_Max=0.0, DivB_Sqr=0.0;
+
+#  pragma omp parallel for reduction( max:DivB_Max ) reduction( +:DivB_Sqr ) schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const real (*B)[ PS2P1*SQR(PS2) ] = h_Mag_Array_F_Out[TID];
+
+      for (int k=0; k<PS2; k++)
+      for (int j=0; j<PS2; j++)
+      for (int i=0; i<PS2; i++)
+      {
+         const int idx_BxL = IDX321_BX( i, j, k, PS2, PS2 );
+         const int idx_ByL = IDX321_BY( i, j, k, PS2, PS2 );
+         const int idx_BzL = IDX321_BZ( i, j, k, PS2, PS2 );
+
+         const real BxL = B[MAGX][ idx_BxL            ];
+         const real BxR = B[MAGX][ idx_BxL + 1        ];
+         const real ByL = B[MAGY][ idx_ByL            ];
+         const real ByR = B[MAGY][ idx_ByL + PS2      ];
+         const real BzL = B[MAGZ][ idx_BzL            ];
+         const real BzR = B[MAGZ][ idx_BzL + SQR(PS2) ];
+
+         real DivB = ( BxR - BxL ) + ( ByR - ByL ) + ( BzR - BzL );
+         real AmpB = FABS(BxR) + FABS(BxL) + FABS(ByR) + FABS(ByL) + FABS(BzR) + FABS(BzL);
+
+//       do not normalize DivB if B is already zero on all 6 faces
+         if ( AmpB != (real)0.0 )   DivB = FABS( DivB/AmpB );
+
+         DivB_Max  = MAX( DivB_Max, (double)DivB );
+         DivB_Sqr += SQR( (double)DivB );
+      } // i,j,k
+   } // for (int TID=0; TID<NPG; TID++)
+
+   MHD_DivB_Max  [lv]  = MAX( MHD_DivB_Max[lv], DivB_Max );
+   MHD_DivB_Sqr  [lv] += DivB_Sqr;
+   MHD_DivB_NCell[lv] += (long)NPG*CUBE( PS2 );
+
+} // FUNCTION : RecordDivB
+#endif // #ifdef MHD
@@ -1,6 +1,11 @@
 #include "GAMER.h"
 #include "CUFLU.h"
 
+static void FixUp_Flux_OnePatch( const int lv, const int PID );
+#ifdef GAMER_DEBUG
+static void CheckFixUpFlux();
+#endif
+
 
 
 
@@ -11,10 +16,146 @@
 // Note        :  1. Boundary fluxes from the neighboring ranks must be received in advance by invoking
 //                   Buf_GetBufferData()
 //                2. Invoked by EvolveLevel()
+//                3. Record the time and number of patches adjacent to the coarse-fine boundaries for
+//                   OPT__RECORD_PATCH_COST (see Aux_Record_PatchCost.cpp)
+//                4. Only loop over the real patches adjacent to the coarse-fine boundaries recorded by
+//                   Flu_RecordFluxPatchList() when allocating the flux arrays
+//                5. For BIT_REP_FLUX, the fine-grid fluxes are accumulated directly onto the coarse-grid fluxes
+//                   in the same order regardless of the parallelization (see LB_SeedBufferFlux() and
+//                   Buf_SeedBufferFlux())
+//                   --> No additional flux array or reset is required here
+//                6. For OPT__DT_FLU_BYPRODUCT, reset patch_t::dt_MaxCFL of the corrected patches so that
+//                   GetMaxCFL_ByProduct() re-evaluates their CFL speed from the corrected data
 //
 // Parameter   :  lv : Target coarse level
 //-------------------------------------------------------------------------------------------------------
 void Flu_FixUp_Flux( const int lv )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   CheckFixUpFlux();
+#  endif
+
+
+#  ifdef TIMING
+   const long PatchCost_T0 = ( OPT__RECORD_PATCH_COST ) ? ThreadTimer_t::GetNanoSec() : 0L;
+#  endif
+
+
+   int NFluxPatch;
+   const int *FluxPatchList = Flu_GetFluxPatchList( lv, NFluxPatch );
+
+// 1. correct the patches adjacent to the coarse-fine boundaries
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<NFluxPatch; t++)   FixUp_Flux_OnePatch( lv, FluxPatchList[t] );
+
+
+// 2. record the cost
+#  ifdef TIMING
+   if ( OPT__RECORD_PATCH_COST )
+      Aux_PatchCost_Add( PATCH_COST_FIXUP_FLUX, lv, NFluxPatch, ThreadTimer_t::GetNanoSec()-PatchCost_T0 );
+#  endif
+
+} // FUNCTION : Flu_FixUp_Flux
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FixUp_RestrictFlux
+// Description :  Apply Flu_FixUp_Restrict() and Flu_FixUp_Flux() to all fluid variables at level "lv" in a
+//                single OpenMP parallel region
+//
+// Note        :  1. Invoked by EvolveLevel() when both OPT__FIXUP_RESTRICT and OPT__FIXUP_FLUX are on in the
+//                   serial mode without MHD
+//                   --> Equivalent to Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], NULL_INT,
+//                       NULL_INT, NULL_INT, NULL_INT, _TOTAL, _NONE ) followed by Flu_FixUp_Flux( lv )
+//                2. The two operations update disjoint sets of patches and can thus run concurrently
+//                   --> Restriction only updates the patches with sons, while the flux arrays are only allocated
+//                       for the patches without sons
+//                   --> Threads finishing restriction proceed to the flux fix-up without waiting at a barrier
+//                   --> Not applicable to MHD since restriction also updates the B field of the neighboring
+//                       patches without sons, and the flux fix-up requires the coarse-grid B field corrected by
+//                       MHD_FixUp_Electric()
+//                3. For OPT__RECORD_PATCH_COST, the elapsed time is attributed to PATCH_COST_FIXUP_FLUX and
+//                   PATCH_COST_RESTRICT only records the number of patches
+//
+// Parameter   :  lv : Target coarse level
+//-------------------------------------------------------------------------------------------------------
+void Flu_FixUp_RestrictFlux( const int lv )
+{
+
+   const int SonLv = lv + 1;
+
+// check
+   if ( lv < 0  ||  lv >= NLEVEL-1 )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+
+#  ifdef MHD
+   Aux_Error( ERROR_INFO, "%s does not support MHD !!\n", __FUNCTION__ );
+#  endif
+
+#  ifdef GAMER_DEBUG
+   CheckFixUpFlux();
+#  endif
+
+
+// nothing to do if there are no real patches at lv+1
+   if ( amr->NPatchComma[SonLv][1] == 0 )    return;
+
+// check the synchronization
+   Mis_CompareRealValue( Time[lv], Time[SonLv], __FUNCTION__, true );
+
+
+#  ifdef TIMING
+   const long PatchCost_T0 = ( OPT__RECORD_PATCH_COST ) ? ThreadTimer_t::GetNanoSec() : 0L;
+#  endif
+
+
+   int TFluVarIdxList[NCOMP_TOTAL];
+   for (int v=0; v<NCOMP_TOTAL; v++)   TFluVarIdxList[v] = v;
+
+   int NFluxPatch;
+   const int *FluxPatchList = Flu_GetFluxPatchList( lv, NFluxPatch );
+
+#  pragma omp parallel
+   {
+//    1. restrict
+#     pragma omp for schedule( runtime ) nowait
+      for (int SonPID0=0; SonPID0<amr->NPatchComma[SonLv][1]; SonPID0+=8)
+         Flu_FixUp_Restrict_PatchGroup( lv, SonPID0, amr->FluSg[SonLv], amr->FluSg[lv], NULL_INT, NULL_INT,
+                                        NULL_INT, NULL_INT, _TOTAL, _NONE, NCOMP_TOTAL, TFluVarIdxList );
+
+//    2. flux fix-up
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NFluxPatch; t++)   FixUp_Flux_OnePatch( lv, FluxPatchList[t] );
+   } // OpenMP parallel region
+
+
+// 3. record the cost
+#  ifdef TIMING
+   if ( OPT__RECORD_PATCH_COST )
+   {
+      Aux_PatchCost_Add( PATCH_COST_RESTRICT,   lv, amr->NPatchComma[SonLv][1]/8, 0L );
+      Aux_PatchCost_Add( PATCH_COST_FIXUP_FLUX, lv, NFluxPatch, ThreadTimer_t::GetNanoSec()-PatchCost_T0 );
+   }
+#  endif
+
+} // FUNCTION : Flu_FixUp_RestrictFlux
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FixUp_Flux_OnePatch
+// Description :  Correct the data of a single patch by the fine-grid fluxes across the coarse-fine boundaries
+//
+// Note        :  1. Invoked by Flu_FixUp_Flux() and Flu_FixUp_RestrictFlux()
+//                2. Thread-safe for different patches
+//
+// Parameter   :  lv  : Target coarse level
+//                PID : Target patch index
+//-------------------------------------------------------------------------------------------------------
+void FixUp_Flux_OnePatch( const int lv, const int PID )
 {
 
    const real Const[6]   = { real(-1.0/amr->dh[lv]), real(+1.0/amr->dh[lv]),
@@ -43,321 +184,285 @@ void Flu_FixUp_Flux( const int lv )
 */
 
 
-// check
-#  ifdef GAMER_DEBUG
+// correct fluid variables by the difference between the coarse-grid and fine-grid fluxes
+// loop over all six faces of a given patch
+   for (int s=0; s<6; s++)
+   {
+//    skip the faces not adjacent to the coarse-fine boundaries
+      const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+      if ( FluxPtr == NULL  )  continue;
 
-   if ( !amr->WithFlux )
-      Aux_Error( ERROR_INFO, "amr->WithFlux is off -> no flux array is allocated for OPT__FIXUP_FLUX !!\n" );
 
-#  if ( MODEL == ELBDM )
+//    set the pointers to the target face
+      real *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
+      for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D0[v] = amr->patch[FluSg][lv][PID]->fluid[v][0][0] + Offset[s];
+#     ifdef DUAL_ENERGY
+      const char *DE_StatusPtr1D0 = amr->patch[0][lv][PID]->de_status[0][0] + Offset[s];
+#     endif
 
-#  ifndef CONSERVE_MASS
-   Aux_Error( ERROR_INFO, "CONSERVE_MASS is not turned on in the Makefile for the option OPT__FIXUP_FLUX !!\n" );
-#  endif
 
-#  if ( NFLUX_TOTAL != 1 )
-   Aux_Error( ERROR_INFO, "NFLUX_TOTAL (%d) != 1 for the option OPT__FIXUP_FLUX !!\n", NFLUX_TOTAL );
-#  endif
+//    set the array index strides
+      const int didx_m = didx[s/2][1];
+      const int didx_n = didx[s/2][0];
 
-#  if ( DENS != 0 )
-   Aux_Error( ERROR_INFO, "DENS (%d) != 0 for the option OPT__FIXUP_FLUX !!\n", DENS );
-#  endif
 
-#  if ( FLUX_DENS != 0 )
-   Aux_Error( ERROR_INFO, "FLUX_DENS (%d) != 0 for the option OPT__FIXUP_FLUX !!\n", FLUX_DENS );
-#  endif
+//    loop over all cells on a given face
+      for (int m=0; m<PS1; m++)
+      {
+         for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D[v] = FluidPtr1D0[v] + m*didx_m;
+#        ifdef DUAL_ENERGY
+         const char *DE_StatusPtr1D = DE_StatusPtr1D0 + m*didx_m;
+#        endif
 
+         for (int n=0; n<PS1; n++)
+         {
+//          from now on we also correct cells updated by either the minimum pressure threshold or the 1st-order-flux correction
+//          --> note that we have stored the 1st-order fluxes across the coarse-fine boundaries in Flu_Close()
+            /*
+#           ifdef DUAL_ENERGY
+            if ( *DE_StatusPtr1D == DE_UPDATED_BY_MIN_PRES  ||  *DE_StatusPtr1D == DE_UPDATED_BY_1ST_FLUX )    continue;
+#           endif
+            */
 
-// if "NCOMP_TOTAL != NFLUX_TOTAL", one must specify how to correct cell data from the flux arrays
-// --> specifically, how to map different flux variables to fluid active/passive variables
-// --> for ELBDM, we have assumed that FLUX_DENS == DENS == 0 and NFLUX_TOTAL == 1
-#  elif ( NCOMP_TOTAL != NFLUX_TOTAL )
-#     error : NCOMP_TOTAL != NFLUX_TOTAL (one must specify how to map flux variables to fluid active/passive variables) !!
 
-#  endif // #if ( MODEL == ELBDM ) ... elif ...
+//          calculate the corrected results
+//          --> do NOT **store** these results yet since we want to skip the cells with unphysical results
+            real CorrVal[NFLUX_TOTAL];    // values after applying the flux correction
+            for (int v=0; v<NFLUX_TOTAL; v++)   CorrVal[v] = *FluidPtr1D[v] + FluxPtr[v][m][n]*Const[s];
 
-#  endif // #ifdef GAMER_DEBUG
 
+//          calculate the internal energy density
+#           if ( MODEL == HYDRO  &&  !defined BAROTROPIC_EOS )
+            real Eint;
+            real *ForEint = CorrVal;
 
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-   {
-//    1. sum up the coarse-grid and fine-grid fluxes for bitwise reproducibility
-#     ifdef BIT_REP_FLUX
-      for (int s=0; s<6; s++)
-      {
-         real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+//###EXPERIMENTAL: (does not work well and thus has been disabled for now)
+/*
+            real ForEint[NCOMP_TOTAL];
+//          when FixSEint is on, use FluidPtr1D to calculate the original pressure
+            if ( FixSEint )
+               for (int v=0; v<NCOMP_TOTAL; v++)   ForEint[v] = *FluidPtr1D[v];
+            else
+               for (int v=0; v<NCOMP_TOTAL; v++)   ForEint[v] = CorrVal    [v];
+*/
 
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] += amr->patch[0][lv][PID]->flux_bitrep[s][v][m][n];
-         }
-      }
-#     endif
+//          calculate the magnetic energy first
+#           ifdef MHD
+            int i, j, k;
+            switch ( s )
+            {
+               case 0:  i = 0;      j = n;      k = m;      break;
+               case 1:  i = PS1-1;  j = n;      k = m;      break;
+               case 2:  i = n;      j = 0;      k = m;      break;
+               case 3:  i = n;      j = PS1-1;  k = m;      break;
+               case 4:  i = n;      j = m;      k = 0;      break;
+               case 5:  i = n;      j = m;      k = PS1-1;  break;
+
+               default:
+                  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "s", s );
+                  break;
+            } // switch ( s )
+
+            const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
+#           else
+            const real Emag = NULL_REAL;
+#           endif
 
+//          when adopting the dual-energy formalism, we must determine to use Hydro_Con2Eint() or Hydro_DensEntropy2Pres()
+//          since the fluid variables stored in CorrVal[] may not be fully consistent
+//          --> because they have not been corrected by Hydro_DualEnergyFix()
+//          --> also note that currently we adopt Hydro_DensEntropy2Pres() for DE_UPDATED_BY_MIN_PRES
+//          --> consistency among all dual-energy related variables will be ensured after determining Eint
+#           if ( DUAL_ENERGY == DE_ENPY )
+            if ( *DE_StatusPtr1D == DE_UPDATED_BY_ETOT  ||  *DE_StatusPtr1D == DE_UPDATED_BY_ETOT_GRA )
+#           endif
+            {
+               const bool CheckMinEint_No = false;
+               Eint = Hydro_Con2Eint( ForEint[DENS], ForEint[MOMX], ForEint[MOMY], ForEint[MOMZ], ForEint[ENGY],
+                                      CheckMinEint_No, NULL_REAL, Emag );
+            }
 
-//    2. correct fluid variables by the difference between the coarse-grid and fine-grid fluxes
-//    loop over all six faces of a given patch
-      for (int s=0; s<6; s++)
-      {
-//       skip the faces not adjacent to the coarse-fine boundaries
-         const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
-         if ( FluxPtr == NULL  )  continue;
+#           if ( DUAL_ENERGY == DE_ENPY )
+            else
+            {
+               const bool CheckMinPres_No = false;
+               real Pres;
+               Pres = Hydro_DensEntropy2Pres( ForEint[DENS], ForEint[ENPY], EoS_AuxArray[1], CheckMinPres_No, NULL_REAL );
+//             DE_ENPY only supports EOS_GAMMA, which does not involve passive scalars
+               Eint = EoS_DensPres2Eint_CPUPtr( ForEint[DENS], Pres, NULL, EoS_AuxArray );
+            }
+#           endif
 
+#           if ( DUAL_ENERGY == DE_EINT )
+#           error : DE_EINT is NOT supported yet !!
+#           endif
 
-//       set the pointers to the target face
-         real *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
-         for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D0[v] = amr->patch[FluSg][lv][PID]->fluid[v][0][0] + Offset[s];
-#        ifdef DUAL_ENERGY
-         const char *DE_StatusPtr1D0 = amr->patch[0][lv][PID]->de_status[0][0] + Offset[s];
-#        endif
+#           endif // #if ( MODEL == HYDRO  &&  !defined BAROTROPIC_EOS )
 
 
-//       set the array index strides
-         const int didx_m = didx[s/2][1];
-         const int didx_n = didx[s/2][0];
+//###EXPERIMENTAL: (does not work well and thus has been disabled for now)
+/*
+//          correct internal energy to restore the original specific internal energy
+            if ( FixSEint )   Eint *= CorrVal[DENS] / *FluidPtr1D[DENS];
+*/
 
 
-//       loop over all cells on a given face
-         for (int m=0; m<PS1; m++)
-         {
-            for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D[v] = FluidPtr1D0[v] + m*didx_m;
-#           ifdef DUAL_ENERGY
-            const char *DE_StatusPtr1D = DE_StatusPtr1D0 + m*didx_m;
+//          do not apply the flux correction if there are any unphysical results
+            bool ApplyFix;
+
+#           if   ( MODEL == HYDRO )
+            if ( CorrVal[DENS] <= MIN_DENS
+#                ifndef BAROTROPIC_EOS
+                 ||  Eint <= MIN_EINT  ||  !Aux_IsFinite(Eint)
+#                endif
+#                if   ( DUAL_ENERGY == DE_ENPY )
+                 ||  ( (*DE_StatusPtr1D == DE_UPDATED_BY_DUAL || *DE_StatusPtr1D == DE_UPDATED_BY_MIN_PRES)
+                        && CorrVal[ENPY] <= (real)2.0*TINY_NUMBER )
+
+#                elif ( DUAL_ENERGY == DE_EINT )
+#                error : DE_EINT is NOT supported yet !!
+#                endif
+               )
+
+#           elif ( MODEL == ELBDM  &&  defined CONSERVE_MASS )
+            if ( CorrVal[DENS] <= MIN_DENS )
 #           endif
+            {
+               ApplyFix = false;
+            }
 
-            for (int n=0; n<PS1; n++)
+            else
             {
-//             from now on we also correct cells updated by either the minimum pressure threshold or the 1st-order-flux correction
-//             --> note that we have stored the 1st-order fluxes across the coarse-fine boundaries in Flu_Close()
-               /*
-#              ifdef DUAL_ENERGY
-               if ( *DE_StatusPtr1D == DE_UPDATED_BY_MIN_PRES  ||  *DE_StatusPtr1D == DE_UPDATED_BY_1ST_FLUX )    continue;
-#              endif
-               */
+               ApplyFix = true;
+            }
 
 
-//             calculate the corrected results
-//             --> do NOT **store** these results yet since we want to skip the cells with unphysical results
-               real CorrVal[NFLUX_TOTAL];    // values after applying the flux correction
-               for (int v=0; v<NFLUX_TOTAL; v++)   CorrVal[v] = *FluidPtr1D[v] + FluxPtr[v][m][n]*Const[s];
+            if ( ApplyFix )
+            {
+//             floor and normalize the passive scalars
+#              if ( NCOMP_PASSIVE > 0 )
+               for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  CorrVal[v] = FMAX( CorrVal[v], TINY_NUMBER );
 
+               if ( OPT__NORMALIZE_PASSIVE )
+                  Hydro_NormalizePassive( CorrVal[DENS], CorrVal+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#              endif
 
-//             calculate the internal energy density
-#              if ( MODEL == HYDRO  &&  !defined BAROTROPIC_EOS )
-               real Eint;
-               real *ForEint = CorrVal;
 
-//###EXPERIMENTAL: (does not work well and thus has been disabled for now)
-/*
-               real ForEint[NCOMP_TOTAL];
-//             when FixSEint is on, use FluidPtr1D to calculate the original pressure
-               if ( FixSEint )
-                  for (int v=0; v<NCOMP_TOTAL; v++)   ForEint[v] = *FluidPtr1D[v];
-               else
-                  for (int v=0; v<NCOMP_TOTAL; v++)   ForEint[v] = CorrVal    [v];
-*/
+//             ensure the consistency between pressure, total energy density, and dual-energy variable
+//             --> assuming the variable "Eint" is correct
+//             --> no need to check the internal energy floor here since we have skipped failing cells
+#              if ( MODEL == HYDRO )
+
+//             for barotropic EoS, do not apply flux correction at all
+#              ifdef BAROTROPIC_EOS
+               CorrVal[ENGY] = *FluidPtr1D[ENGY];  // just set to the input value
 
-//             calculate the magnetic energy first
-#              ifdef MHD
-               int i, j, k;
-               switch ( s )
-               {
-                  case 0:  i = 0;      j = n;      k = m;      break;
-                  case 1:  i = PS1-1;  j = n;      k = m;      break;
-                  case 2:  i = n;      j = 0;      k = m;      break;
-                  case 3:  i = n;      j = PS1-1;  k = m;      break;
-                  case 4:  i = n;      j = m;      k = 0;      break;
-                  case 5:  i = n;      j = m;      k = PS1-1;  break;
-
-                  default:
-                     Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "s", s );
-                     break;
-               } // switch ( s )
-
-               const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
 #              else
-               const real Emag = NULL_REAL;
-#              endif
+               CorrVal[ENGY] = Hydro_ConEint2Etot( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], Eint, Emag );
+#              if   ( DUAL_ENERGY == DE_ENPY )
+//             DE_ENPY only supports EOS_GAMMA, which does not involve passive scalars
+               CorrVal[ENPY] = Hydro_DensPres2Entropy( CorrVal[DENS],
+                                                       EoS_DensEint2Pres_CPUPtr(CorrVal[DENS],Eint,NULL,EoS_AuxArray),
+                                                       EoS_AuxArray[1] );
+#              elif ( DUAL_ENERGY == DE_EINT )
+#              error : DE_EINT is NOT supported yet !!
+#              endif // DUAL_ENERGY
 
-//             when adopting the dual-energy formalism, we must determine to use Hydro_Con2Eint() or Hydro_DensEntropy2Pres()
-//             since the fluid variables stored in CorrVal[] may not be fully consistent
-//             --> because they have not been corrected by Hydro_DualEnergyFix()
-//             --> also note that currently we adopt Hydro_DensEntropy2Pres() for DE_UPDATED_BY_MIN_PRES
-//             --> consistency among all dual-energy related variables will be ensured after determining Eint
-#              if ( DUAL_ENERGY == DE_ENPY )
-               if ( *DE_StatusPtr1D == DE_UPDATED_BY_ETOT  ||  *DE_StatusPtr1D == DE_UPDATED_BY_ETOT_GRA )
-#              endif
-               {
-                  const bool CheckMinEint_No = false;
-                  Eint = Hydro_Con2Eint( ForEint[DENS], ForEint[MOMX], ForEint[MOMY], ForEint[MOMZ], ForEint[ENGY],
-                                         CheckMinEint_No, NULL_REAL, Emag );
-               }
+#              endif // #ifdef BAROTROPIC_EOS ... else ...
+#              endif // #if ( MODEL == HYDRO )
 
-#              if ( DUAL_ENERGY == DE_ENPY )
-               else
+
+//             store the corrected results
+               for (int v=0; v<NFLUX_TOTAL; v++)   *FluidPtr1D[v] = CorrVal[v];
+
+
+//             rescale the real and imaginary parts to be consistent with the corrected amplitude
+//             --> must NOT use CorrVal[REAL] and CorrVal[IMAG] below since NFLUX_TOTAL == 1 for ELBDM
+#              if ( MODEL == ELBDM  &&  defined CONSERVE_MASS )
+               real Re, Im, Rho_Corr, Rho_Wrong, Rescale;
+
+               Re        = *FluidPtr1D[REAL];
+               Im        = *FluidPtr1D[IMAG];
+               Rho_Corr  = *FluidPtr1D[DENS];
+               Rho_Wrong = SQR(Re) + SQR(Im);
+
+//             be careful about the negative density introduced from the round-off errors
+               if ( Rho_Wrong <= (real)0.0  ||  Rho_Corr <= (real)0.0 )
                {
-                  const bool CheckMinPres_No = false;
-                  real Pres;
-                  Pres = Hydro_DensEntropy2Pres( ForEint[DENS], ForEint[ENPY], EoS_AuxArray[1], CheckMinPres_No, NULL_REAL );
-//                DE_ENPY only supports EOS_GAMMA, which does not involve passive scalars
-                  Eint = EoS_DensPres2Eint_CPUPtr( ForEint[DENS], Pres, NULL, EoS_AuxArray );
+                  *FluidPtr1D[DENS] = (real)0.0;
+                  Rescale           = (real)0.0;
                }
-#              endif
+               else
+                  Rescale = SQRT( Rho_Corr/Rho_Wrong );
 
-#              if ( DUAL_ENERGY == DE_EINT )
-#              error : DE_EINT is NOT supported yet !!
+               *FluidPtr1D[REAL] *= Rescale;
+               *FluidPtr1D[IMAG] *= Rescale;
 #              endif
+            } // if ( ApplyFix )
 
-#              endif // #if ( MODEL == HYDRO  &&  !defined BAROTROPIC_EOS )
 
+//          update the fluid pointers
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            FluidPtr1D[v]  += didx_n;
 
-//###EXPERIMENTAL: (does not work well and thus has been disabled for now)
-/*
-//             correct internal energy to restore the original specific internal energy
-               if ( FixSEint )   Eint *= CorrVal[DENS] / *FluidPtr1D[DENS];
-*/
+#           ifdef DUAL_ENERGY
+            DE_StatusPtr1D += didx_n;
+#           endif
 
+         } // for (int n=0; n<PS1; n++}
+      } // for (int m=0; m<PS1; m++}
+   } // for (int s=0; s<6; s++)
 
-//             do not apply the flux correction if there are any unphysical results
-               bool ApplyFix;
 
-#              if   ( MODEL == HYDRO )
-               if ( CorrVal[DENS] <= MIN_DENS
-#                   ifndef BAROTROPIC_EOS
-                    ||  Eint <= MIN_EINT  ||  !Aux_IsFinite(Eint)
-#                   endif
-#                   if   ( DUAL_ENERGY == DE_ENPY )
-                    ||  ( (*DE_StatusPtr1D == DE_UPDATED_BY_DUAL || *DE_StatusPtr1D == DE_UPDATED_BY_MIN_PRES)
-                           && CorrVal[ENPY] <= (real)2.0*TINY_NUMBER )
+// the maximum CFL speed recorded by Flu_Close() for OPT__DT_FLU_BYPRODUCT no longer applies to the corrected patch
+   if ( OPT__DT_FLU_BYPRODUCT )  amr->patch[0][lv][PID]->dt_MaxCFL = (real)-1.0;
 
-#                   elif ( DUAL_ENERGY == DE_EINT )
-#                   error : DE_EINT is NOT supported yet !!
-#                   endif
-                  )
+} // FUNCTION : FixUp_Flux_OnePatch
 
-#              elif ( MODEL == ELBDM  &&  defined CONSERVE_MASS )
-               if ( CorrVal[DENS] <= MIN_DENS )
-#              endif
-               {
-                  ApplyFix = false;
-               }
 
-               else
-               {
-                  ApplyFix = true;
-               }
 
 
-               if ( ApplyFix )
-               {
-//                floor and normalize the passive scalars
-#                 if ( NCOMP_PASSIVE > 0 )
-                  for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  CorrVal[v] = FMAX( CorrVal[v], TINY_NUMBER );
-
-                  if ( OPT__NORMALIZE_PASSIVE )
-                     Hydro_NormalizePassive( CorrVal[DENS], CorrVal+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
-#                 endif
-
-
-//                ensure the consistency between pressure, total energy density, and dual-energy variable
-//                --> assuming the variable "Eint" is correct
-//                --> no need to check the internal energy floor here since we have skipped failing cells
-#                 if ( MODEL == HYDRO )
-
-//                for barotropic EoS, do not apply flux correction at all
-#                 ifdef BAROTROPIC_EOS
-                  CorrVal[ENGY] = *FluidPtr1D[ENGY];  // just set to the input value
-
-#                 else
-                  CorrVal[ENGY] = Hydro_ConEint2Etot( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], Eint, Emag );
-#                 if   ( DUAL_ENERGY == DE_ENPY )
-//                DE_ENPY only supports EOS_GAMMA, which does not involve passive scalars
-                  CorrVal[ENPY] = Hydro_DensPres2Entropy( CorrVal[DENS],
-                                                          EoS_DensEint2Pres_CPUPtr(CorrVal[DENS],Eint,NULL,EoS_AuxArray),
-                                                          EoS_AuxArray[1] );
-#                 elif ( DUAL_ENERGY == DE_EINT )
-#                 error : DE_EINT is NOT supported yet !!
-#                 endif // DUAL_ENERGY
-
-#                 endif // #ifdef BAROTROPIC_EOS ... else ...
-#                 endif // #if ( MODEL == HYDRO )
-
-
-//                store the corrected results
-                  for (int v=0; v<NFLUX_TOTAL; v++)   *FluidPtr1D[v] = CorrVal[v];
-
-
-//                rescale the real and imaginary parts to be consistent with the corrected amplitude
-//                --> must NOT use CorrVal[REAL] and CorrVal[IMAG] below since NFLUX_TOTAL == 1 for ELBDM
-#                 if ( MODEL == ELBDM  &&  defined CONSERVE_MASS )
-                  real Re, Im, Rho_Corr, Rho_Wrong, Rescale;
-
-                  Re        = *FluidPtr1D[REAL];
-                  Im        = *FluidPtr1D[IMAG];
-                  Rho_Corr  = *FluidPtr1D[DENS];
-                  Rho_Wrong = SQR(Re) + SQR(Im);
-
-//                be careful about the negative density introduced from the round-off errors
-                  if ( Rho_Wrong <= (real)0.0  ||  Rho_Corr <= (real)0.0 )
-                  {
-                     *FluidPtr1D[DENS] = (real)0.0;
-                     Rescale           = (real)0.0;
-                  }
-                  else
-                     Rescale = SQRT( Rho_Corr/Rho_Wrong );
-
-                  *FluidPtr1D[REAL] *= Rescale;
-                  *FluidPtr1D[IMAG] *= Rescale;
-#                 endif
-               } // if ( ApplyFix )
-
-
-//             update the fluid pointers
-               for (int v=0; v<NCOMP_TOTAL; v++)
-               FluidPtr1D[v]  += didx_n;
-
-#              ifdef DUAL_ENERGY
-               DE_StatusPtr1D += didx_n;
-#              endif
 
-            } // for (int n=0; n<PS1; n++}
-         } // for (int m=0; m<PS1; m++}
-      } // for (int s=0; s<6; s++)
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
 
+#ifdef GAMER_DEBUG
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckFixUpFlux
+// Description :  Check the settings for the flux fix-up operation
+//
+// Note        :  1. Invoked by Flu_FixUp_Flux() and Flu_FixUp_RestrictFlux() in the debug mode
+//-------------------------------------------------------------------------------------------------------
+void CheckFixUpFlux()
+{
 
-// 3. reset all flux arrays (in both real and buffer patches) to zero for bitwise reproducibility
-#  ifdef BIT_REP_FLUX
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
-   {
-      for (int s=0; s<6; s++)
-      {
-         real (*FluxPtr)[PS1][PS1] = NULL;
+   if ( !amr->WithFlux )
+      Aux_Error( ERROR_INFO, "amr->WithFlux is off -> no flux array is allocated for OPT__FIXUP_FLUX !!\n" );
 
-         FluxPtr = amr->patch[0][lv][PID]->flux[s];
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] = (real)0.0;
-         }
-
-         FluxPtr = amr->patch[0][lv][PID]->flux_bitrep[s];
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] = (real)0.0;
-         }
-      }
-   }
-#  endif // #ifdef BIT_REP_FLUX
+#  if ( MODEL == ELBDM )
 
-} // FUNCTION : Flu_FixUp_Flux
+#  ifndef CONSERVE_MASS
+   Aux_Error( ERROR_INFO, "CONSERVE_MASS is not turned on in the Makefile for the option OPT__FIXUP_FLUX !!\n" );
+#  endif
+
+#  if ( NFLUX_TOTAL != 1 )
+   Aux_Error( ERROR_INFO, "NFLUX_TOTAL (%d) != 1 for the option OPT__FIXUP_FLUX !!\n", NFLUX_TOTAL );
+#  endif
+
+#  if ( DENS != 0 )
+   Aux_Error( ERROR_INFO, "DENS (%d) != 0 for the option OPT__FIXUP_FLUX !!\n", DENS );
+#  endif
+
+#  if ( FLUX_DENS != 0 )
+   Aux_Error( ERROR_INFO, "FLUX_DENS (%d) != 0 for the option OPT__FIXUP_FLUX !!\n", FLUX_DENS );
+#  endif
+
+
+// if "NCOMP_TOTAL != NFLUX_TOTAL", one must specify how to correct cell data from the flux arrays
+// --> specifically, how to map different flux variables to fluid active/passive variables
+// --> for ELBDM, we have assumed that FLUX_DENS == DENS == 0 and NFLUX_TOTAL == 1
+#  elif ( NCOMP_TOTAL != NFLUX_TOTAL )
+#     error : NCOMP_TOTAL != NFLUX_TOTAL (one must specify how to map flux variables to fluid active/passive variables) !!
+
+#  endif // #if ( MODEL == ELBDM ) ... elif ...
+
+} // FUNCTION : CheckFixUpFlux
+#endif // #ifdef GAMER_DEBUG
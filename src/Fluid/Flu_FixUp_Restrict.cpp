@@ -80,7 +80,6 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
    Mis_CompareRealValue( Time[FaLv], Time[SonLv], __FUNCTION__, true );
 
 
-   const bool ResFlu  = TVarCC & _TOTAL;
 #  ifdef GRAVITY
    const bool ResPot  = TVarCC & _POTE;
 #  else
@@ -91,7 +90,6 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #  else
    const bool ResMag  = false;
 #  endif
-   const int PS1_half = PS1 / 2;
 
 
 // determine the components to be restricted (TFluVarIdx : target fluid variable indices ( = [0 ... NCOMP_TOTAL-1] )
@@ -109,271 +107,319 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
    }
 
 
+#  ifdef TIMING
+   const long PatchCost_T0 = ( OPT__RECORD_PATCH_COST ) ? ThreadTimer_t::GetNanoSec() : 0L;
+#  endif
+
+
 // restrict
 #  pragma omp parallel for schedule( runtime )
    for (int SonPID0=0; SonPID0<amr->NPatchComma[SonLv][1]; SonPID0+=8)
+      Flu_FixUp_Restrict_PatchGroup( FaLv, SonPID0, SonFluSg, FaFluSg, SonMagSg, FaMagSg, SonPotSg, FaPotSg,
+                                     TVarCC, TVarFC, NFluVar, TFluVarIdxList );
+
+
+// record the cost (one coarse patch per son patch group)
+#  ifdef TIMING
+   if ( OPT__RECORD_PATCH_COST )
+      Aux_PatchCost_Add( PATCH_COST_RESTRICT, FaLv, amr->NPatchComma[SonLv][1]/8, ThreadTimer_t::GetNanoSec()-PatchCost_T0 );
+#  endif
+
+} // FUNCTION : Flu_FixUp_Restrict
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FixUp_Restrict_PatchGroup
+// Description :  Replace the data of a single father patch at level "FaLv" by the average data of its eight sons
+//
+// Note        :  1. Invoked by Flu_FixUp_Restrict() and Flu_FixUp_RestrictFlux()
+//                2. Thread-safe for different son patch groups
+//                3. No argument check here --> done by the callers
+//
+// Parameter   :  FaLv           : Target refinement level at which the data are going to be replaced
+//                SonPID0        : Patch index of the son patch with LocalID == 0
+//                NFluVar        : Number of target fluid variables
+//                TFluVarIdxList : List of target fluid variable indices
+//                Others         : See Flu_FixUp_Restrict()
+//-------------------------------------------------------------------------------------------------------
+void Flu_FixUp_Restrict_PatchGroup( const int FaLv, const int SonPID0, const int SonFluSg, const int FaFluSg,
+                                    const int SonMagSg, const int FaMagSg, const int SonPotSg, const int FaPotSg,
+                                    const long TVarCC, const long TVarFC, const int NFluVar, const int TFluVarIdxList[] )
+{
+
+   const int  SonLv    = FaLv + 1;
+   const bool ResFlu   = TVarCC & _TOTAL;
+#  ifdef GRAVITY
+   const bool ResPot   = TVarCC & _POTE;
+#  endif
+#  ifdef MHD
+   const bool ResMag   = TVarFC & _MAG;
+#  endif
+   const int  PS1_half = PS1 / 2;
+
+   const int FaPID = amr->patch[0][SonLv][SonPID0]->father;
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( FaPID < 0 )
+      Aux_Error( ERROR_INFO, "SonLv %d, SonPID0 %d has no father patch (FaPID = %d) !!\n",
+                 SonLv, SonPID0, FaPID );
+
+   if ( ResFlu  &&  amr->patch[FaFluSg][FaLv][FaPID]->fluid == NULL )
+      Aux_Error( ERROR_INFO, "FaFluSg %d, FaLv %d, FaPID %d has no fluid array allocated !!\n",
+                 FaFluSg, FaLv, FaPID );
+
+#  ifdef GRAVITY
+   if ( ResPot  &&  amr->patch[FaPotSg][FaLv][FaPID]->pot == NULL )
+      Aux_Error( ERROR_INFO, "FaPotSg %d, FaLv %d, FaPID %d has no potential array allocated !!\n",
+                 FaPotSg, FaLv, FaPID );
+#  endif
+
+#  ifdef MHD
+   if ( ResMag  &&  amr->patch[FaMagSg][FaLv][FaPID]->magnetic == NULL )
+      Aux_Error( ERROR_INFO, "FaMagSg %d, FaLv %d, FaPID %d has no B field array allocated !!\n",
+                 FaMagSg, FaLv, FaPID );
+#  endif
+#  endif // #ifdef GAMER_DEBUG
+
+
+// loop over eight sons
+   for (int LocalID=0; LocalID<8; LocalID++)
    {
-      const int FaPID = amr->patch[0][SonLv][SonPID0]->father;
+      const int SonPID = SonPID0 + LocalID;
+      const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1_half );
+      const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1_half );
+      const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1_half );
 
 //    check
 #     ifdef GAMER_DEBUG
-      if ( FaPID < 0 )
-         Aux_Error( ERROR_INFO, "SonLv %d, SonPID0 %d has no father patch (FaPID = %d) !!\n",
-                    SonLv, SonPID0, FaPID );
-
-      if ( ResFlu  &&  amr->patch[FaFluSg][FaLv][FaPID]->fluid == NULL )
-         Aux_Error( ERROR_INFO, "FaFluSg %d, FaLv %d, FaPID %d has no fluid array allocated !!\n",
-                    FaFluSg, FaLv, FaPID );
+      if ( ResFlu  &&  amr->patch[SonFluSg][SonLv][SonPID]->fluid == NULL )
+         Aux_Error( ERROR_INFO, "SonFluSg %d, SonLv %d, SonPID %d has no fluid array allocated !!\n",
+                    SonFluSg, SonLv, SonPID );
 
 #     ifdef GRAVITY
-      if ( ResPot  &&  amr->patch[FaPotSg][FaLv][FaPID]->pot == NULL )
-         Aux_Error( ERROR_INFO, "FaPotSg %d, FaLv %d, FaPID %d has no potential array allocated !!\n",
-                    FaPotSg, FaLv, FaPID );
+      if ( ResPot  &&  amr->patch[SonPotSg][SonLv][SonPID]->pot == NULL )
+         Aux_Error( ERROR_INFO, "SonPotSg %d, SonLv %d, SonPID %d has no potential array allocated !!\n",
+                    SonPotSg, SonLv, SonPID );
 #     endif
 
 #     ifdef MHD
-      if ( ResMag  &&  amr->patch[FaMagSg][FaLv][FaPID]->magnetic == NULL )
-         Aux_Error( ERROR_INFO, "FaMagSg %d, FaLv %d, FaPID %d has no B field array allocated !!\n",
-                    FaMagSg, FaLv, FaPID );
+      if ( ResMag  &&  amr->patch[SonMagSg][SonLv][SonPID]->magnetic == NULL )
+         Aux_Error( ERROR_INFO, "SonMagSg %d, SonLv %d, SonPID %d has no B field array allocated !!\n",
+                    SonMagSg, SonLv, SonPID );
 #     endif
 #     endif // #ifdef GAMER_DEBUG
 
 
-//    loop over eight sons
-      for (int LocalID=0; LocalID<8; LocalID++)
+//    restrict the fluid data
+      if ( ResFlu )
+      for (int v=0; v<NFluVar; v++)
       {
-         const int SonPID = SonPID0 + LocalID;
-         const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1_half );
-         const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1_half );
-         const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1_half );
-
-//       check
-#        ifdef GAMER_DEBUG
-         if ( ResFlu  &&  amr->patch[SonFluSg][SonLv][SonPID]->fluid == NULL )
-            Aux_Error( ERROR_INFO, "SonFluSg %d, SonLv %d, SonPID %d has no fluid array allocated !!\n",
-                       SonFluSg, SonLv, SonPID );
-
-#        ifdef GRAVITY
-         if ( ResPot  &&  amr->patch[SonPotSg][SonLv][SonPID]->pot == NULL )
-            Aux_Error( ERROR_INFO, "SonPotSg %d, SonLv %d, SonPID %d has no potential array allocated !!\n",
-                       SonPotSg, SonLv, SonPID );
-#        endif
-
-#        ifdef MHD
-         if ( ResMag  &&  amr->patch[SonMagSg][SonLv][SonPID]->magnetic == NULL )
-            Aux_Error( ERROR_INFO, "SonMagSg %d, SonLv %d, SonPID %d has no B field array allocated !!\n",
-                       SonMagSg, SonLv, SonPID );
-#        endif
-#        endif // #ifdef GAMER_DEBUG
-
-
-//       restrict the fluid data
-         if ( ResFlu )
-         for (int v=0; v<NFluVar; v++)
-         {
-            const int TFluVarIdx = TFluVarIdxList[v];
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
-
-            int ii, jj, kk, I, J, K, Ip, Jp, Kp;
-
-            for (int k=0; k<PS1_half; k++)  {  K = k*2;  Kp = K+1;  kk = k + Disp_k;
-            for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
-            for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
-
-               FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
-                                           SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
-                                           SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
-                                           SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
-            }}}
-         } // if ( ResFlu )
-
-
-//       restrict the potential data
-#        ifdef GRAVITY
-         if ( ResPot )
-         {
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
-
-            int ii, jj, kk, I, J, K, Ip, Jp, Kp;
-
-            for (int k=0; k<PS1_half; k++)  {  K = k*2;  Kp = K+1;  kk = k + Disp_k;
-            for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
-            for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
-
-               FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
-                                           SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
-                                           SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
-                                           SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
-            }}}
-         } // if ( ResPot )
-#        endif // #ifdef GRAVITY
-
-
-//       restrict the magnetic field
-//       --> currently it always works on all three B field components
+         const int TFluVarIdx = TFluVarIdxList[v];
+         const real (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
+               real (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
+
+         int ii, jj, kk, I, J, K, Ip, Jp, Kp;
+
+         for (int k=0; k<PS1_half; k++)  {  K = k*2;  Kp = K+1;  kk = k + Disp_k;
+         for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
+         for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
+
+            FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
+                                        SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
+                                        SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
+                                        SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
+         }}}
+      } // if ( ResFlu )
+
+
+//    restrict the potential data
+#     ifdef GRAVITY
+      if ( ResPot )
+      {
+         const real (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
+               real (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
+
+         int ii, jj, kk, I, J, K, Ip, Jp, Kp;
+
+         for (int k=0; k<PS1_half; k++)  {  K = k*2;  Kp = K+1;  kk = k + Disp_k;
+         for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
+         for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
+
+            FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
+                                        SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
+                                        SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
+                                        SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
+         }}}
+      } // if ( ResPot )
+#     endif // #ifdef GRAVITY
+
+
+//    restrict the magnetic field
+//    --> currently it always works on all three B field components
 //###OPTIMIZATION: coarse-grid B field on the son patch boundaries (within the same patch group)
 //                 is restricted twice by two adjacent son patches
-#        ifdef MHD
-         if ( ResMag )
-         {
-            int idx_fa, idx_son0, I, J, K;
-
-//          Bx
-            const real *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
-                  real * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
-
-            for (int k=0; k<PS1_half;   k++)  {  K = k*2;
-            for (int j=0; j<PS1_half;   j++)  {  J = j*2;
-            for (int i=0; i<PS1_half+1; i++)  {  I = i*2;
-
-               const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1P1, PS1 );
-               const int idx_son0 = IDX321( I,        J,        K,        PS1P1, PS1 );
-
-               FaBx[idx_fa] = 0.25*( SonBx[ idx_son0                     ] +
-                                     SonBx[ idx_son0 + PS1P1             ] +
-                                     SonBx[ idx_son0 + PS1P1*PS1         ] +
-                                     SonBx[ idx_son0 + PS1P1*PS1 + PS1P1 ] );
-            }}}
-
-//          By
-            const real *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
-                  real * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
-
-            for (int k=0; k<PS1_half;   k++)  {  K = k*2;
-            for (int j=0; j<PS1_half+1; j++)  {  J = j*2;
-            for (int i=0; i<PS1_half;   i++)  {  I = i*2;
-
-               const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1P1 );
-               const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1P1 );
-
-               FaBy[idx_fa] = 0.25*( SonBy[ idx_son0                 ] +
-                                     SonBy[ idx_son0 + 1             ] +
-                                     SonBy[ idx_son0 + PS1P1*PS1     ] +
-                                     SonBy[ idx_son0 + PS1P1*PS1 + 1 ] );
-            }}}
-
-//          Bz
-            const real *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
-                  real * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
-
-            for (int k=0; k<PS1_half+1; k++)  {  K = k*2;
-            for (int j=0; j<PS1_half;   j++)  {  J = j*2;
-            for (int i=0; i<PS1_half;   i++)  {  I = i*2;
-
-               const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1 );
-               const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1 );
-
-               FaBz[idx_fa] = 0.25*( SonBz[ idx_son0           ] +
-                                     SonBz[ idx_son0 + 1       ] +
-                                     SonBz[ idx_son0 + PS1     ] +
-                                     SonBz[ idx_son0 + PS1 + 1 ] );
-            }}}
-         } // if ( ResMag )
-#        endif // ifdef MHD
-      } // for (int LocalID=0; LocalID<8; LocalID++)
-
-
-//    apply the same B field restriction to the data of father-sibling patches on the coarse-fine boundaries
 #     ifdef MHD
-      for (int s=0; s<6; s++)
+      if ( ResMag )
       {
-         const int FaSibPID = amr->patch[0][FaLv][FaPID]->sibling[s];
+         int idx_fa, idx_son0, I, J, K;
 
-#        ifdef GAMER_DEBUG
-         if ( FaSibPID == -1 )
-            Aux_Error( ERROR_INFO, "FaSibPID == -1 (FaLv %d, FaPID %d, s %d, SonPID0 %d) !!\n", FaLv, FaPID, s, SonPID0 );
-#        endif
+//       Bx
+         const real *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
+               real * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
 
-//       skip father patches adjacent to non-periodic boundaries
-         if ( FaSibPID < -1 )    continue;
+         for (int k=0; k<PS1_half;   k++)  {  K = k*2;
+         for (int j=0; j<PS1_half;   j++)  {  J = j*2;
+         for (int i=0; i<PS1_half+1; i++)  {  I = i*2;
 
-//       find the coarse-fine boundaries and copy data
-         if ( amr->patch[0][FaLv][FaSibPID]->son == -1 )    MHD_CopyPatchInterfaceBField( FaLv, FaPID, s, FaMagSg );
-      }
-#     endif // #ifdef MHD
+            const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1P1, PS1 );
+            const int idx_son0 = IDX321( I,        J,        K,        PS1P1, PS1 );
+
+            FaBx[idx_fa] = 0.25*( SonBx[ idx_son0                     ] +
+                                  SonBx[ idx_son0 + PS1P1             ] +
+                                  SonBx[ idx_son0 + PS1P1*PS1         ] +
+                                  SonBx[ idx_son0 + PS1P1*PS1 + PS1P1 ] );
+         }}}
+
+//       By
+         const real *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
+               real * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
+
+         for (int k=0; k<PS1_half;   k++)  {  K = k*2;
+         for (int j=0; j<PS1_half+1; j++)  {  J = j*2;
+         for (int i=0; i<PS1_half;   i++)  {  I = i*2;
 
+            const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1P1 );
+            const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1P1 );
+
+            FaBy[idx_fa] = 0.25*( SonBy[ idx_son0                 ] +
+                                  SonBy[ idx_son0 + 1             ] +
+                                  SonBy[ idx_son0 + PS1P1*PS1     ] +
+                                  SonBy[ idx_son0 + PS1P1*PS1 + 1 ] );
+         }}}
+
+//       Bz
+         const real *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
+               real * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
+
+         for (int k=0; k<PS1_half+1; k++)  {  K = k*2;
+         for (int j=0; j<PS1_half;   j++)  {  J = j*2;
+         for (int i=0; i<PS1_half;   i++)  {  I = i*2;
+
+            const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1 );
+            const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1 );
+
+            FaBz[idx_fa] = 0.25*( SonBz[ idx_son0           ] +
+                                  SonBz[ idx_son0 + 1       ] +
+                                  SonBz[ idx_son0 + PS1     ] +
+                                  SonBz[ idx_son0 + PS1 + 1 ] );
+         }}}
+
+//       the cached magnetic energy for OPT__EMAG_CACHE no longer applies
+         amr->patch[FaMagSg][FaLv][FaPID]->emag_valid = false;
+      } // if ( ResMag )
+#     endif // ifdef MHD
+   } // for (int LocalID=0; LocalID<8; LocalID++)
+
+
+// apply the same B field restriction to the data of father-sibling patches on the coarse-fine boundaries
+#  ifdef MHD
+   for (int s=0; s<6; s++)
+   {
+      const int FaSibPID = amr->patch[0][FaLv][FaPID]->sibling[s];
 
-//    check the minimum pressure/internal energy and, when the dual-energy formalism is adopted, ensure the consistency between
-//    pressure, total energy density, and the dual-energy variable
-#     if ( MODEL == HYDRO )
-//    apply this correction only when preparing all fluid variables or magnetic field
+#     ifdef GAMER_DEBUG
+      if ( FaSibPID == -1 )
+         Aux_Error( ERROR_INFO, "FaSibPID == -1 (FaLv %d, FaPID %d, s %d, SonPID0 %d) !!\n", FaLv, FaPID, s, SonPID0 );
+#     endif
+
+//    skip father patches adjacent to non-periodic boundaries
+      if ( FaSibPID < -1 )    continue;
+
+//    find the coarse-fine boundaries and copy data
+      if ( amr->patch[0][FaLv][FaSibPID]->son == -1 )    MHD_CopyPatchInterfaceBField( FaLv, FaPID, s, FaMagSg );
+   }
+#  endif // #ifdef MHD
+
+
+// check the minimum pressure/internal energy and, when the dual-energy formalism is adopted, ensure the consistency between
+// pressure, total energy density, and the dual-energy variable
+#  if ( MODEL == HYDRO )
+// apply this correction only when preparing all fluid variables or magnetic field
+#  ifdef MHD
+   if (  ( TVarCC & _TOTAL ) == _TOTAL  ||  ResMag  )
+#  else
+   if (  ( TVarCC & _TOTAL ) == _TOTAL  )
+#  endif
+   for (int k=0; k<PS1; k++)
+   for (int j=0; j<PS1; j++)
+   for (int i=0; i<PS1; i++)
+   {
+//    compute magnetic energy
 #     ifdef MHD
-      if (  ( TVarCC & _TOTAL ) == _TOTAL  ||  ResMag  )
+      const real Emag = MHD_GetCellCenteredBEnergyInPatch( FaLv, FaPID, i, j, k, FaMagSg );
 #     else
-      if (  ( TVarCC & _TOTAL ) == _TOTAL  )
+      const real Emag = NULL_REAL;
 #     endif
-      for (int k=0; k<PS1; k++)
-      for (int j=0; j<PS1; j++)
-      for (int i=0; i<PS1; i++)
-      {
-//       compute magnetic energy
-#        ifdef MHD
-         const real Emag = MHD_GetCellCenteredBEnergyInPatch( FaLv, FaPID, i, j, k, FaMagSg );
-#        else
-         const real Emag = NULL_REAL;
-#        endif
-
-#        ifdef DUAL_ENERGY
-//       here we ALWAYS use the dual-energy variable to correct the total energy density
-//       --> we achieve that by setting the dual-energy switch to an extremely larger number and ignore
-//           the runtime parameter DUAL_ENERGY_SWITCH here
-         const bool CheckMinPres_Yes = true;
-         const real UseEnpy2FixEngy  = HUGE_NUMBER;
-         char dummy;    // we do not record the dual-energy status here
-
-         Hydro_DualEnergyFix( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENPY][k][j][i],
-                              dummy, EoS_AuxArray[1], EoS_AuxArray[2], CheckMinPres_Yes, MIN_PRES, UseEnpy2FixEngy, Emag );
-
-#        else // #ifdef DUAL_ENERGY
-
-//       actually it might not be necessary to check the minimum internal energy here
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i]
-            = Hydro_CheckMinEintInEngy( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
-                                        MIN_EINT, Emag );
-#        endif // #ifdef DUAL_ENERGY ... else ...
-      } // i,j,k
-#     endif // #if ( MODEL == HYDRO )
-
-
-//    rescale real and imaginary parts to get the correct density in ELBDM
-#     if ( MODEL == ELBDM )
-      real Real, Imag, Rho_Wrong, Rho_Corr, Rescale;
-
-      if (  ( TVarCC & _DENS )  &&  ( TVarCC & _REAL )  &&  (TVarCC & _IMAG )  )
-      for (int k=0; k<PS1; k++)
-      for (int j=0; j<PS1; j++)
-      for (int i=0; i<PS1; i++)
+
+#     ifdef DUAL_ENERGY
+//    here we ALWAYS use the dual-energy variable to correct the total energy density
+//    --> we achieve that by setting the dual-energy switch to an extremely larger number and ignore
+//        the runtime parameter DUAL_ENERGY_SWITCH here
+      const bool CheckMinPres_Yes = true;
+      const real UseEnpy2FixEngy  = HUGE_NUMBER;
+      char dummy;    // we do not record the dual-energy status here
+
+      Hydro_DualEnergyFix( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
+                           amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
+                           amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
+                           amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
+                           amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
+                           amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENPY][k][j][i],
+                           dummy, EoS_AuxArray[1], EoS_AuxArray[2], CheckMinPres_Yes, MIN_PRES, UseEnpy2FixEngy, Emag );
+
+#     else // #ifdef DUAL_ENERGY
+
+//    actually it might not be necessary to check the minimum internal energy here
+      amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i]
+         = Hydro_CheckMinEintInEngy( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
+                                     amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
+                                     amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
+                                     amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
+                                     amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
+                                     MIN_EINT, Emag );
+#     endif // #ifdef DUAL_ENERGY ... else ...
+   } // i,j,k
+#  endif // #if ( MODEL == HYDRO )
+
+
+// rescale real and imaginary parts to get the correct density in ELBDM
+#  if ( MODEL == ELBDM )
+   real Real, Imag, Rho_Wrong, Rho_Corr, Rescale;
+
+   if (  ( TVarCC & _DENS )  &&  ( TVarCC & _REAL )  &&  (TVarCC & _IMAG )  )
+   for (int k=0; k<PS1; k++)
+   for (int j=0; j<PS1; j++)
+   for (int i=0; i<PS1; i++)
+   {
+      Real      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i];
+      Imag      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i];
+      Rho_Wrong = Real*Real + Imag*Imag;
+      Rho_Corr  = amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i];
+
+//    be careful about the negative density introduced from the round-off errors
+      if ( Rho_Wrong <= (real)0.0  ||  Rho_Corr <= (real)0.0 )
       {
-         Real      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i];
-         Imag      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i];
-         Rho_Wrong = Real*Real + Imag*Imag;
-         Rho_Corr  = amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i];
-
-//       be careful about the negative density introduced from the round-off errors
-         if ( Rho_Wrong <= (real)0.0  ||  Rho_Corr <= (real)0.0 )
-         {
-            amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i] = (real)0.0;
-            Rescale = (real)0.0;
-         }
-         else
-            Rescale = SQRT( Rho_Corr/Rho_Wrong );
-
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i] *= Rescale;
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i] *= Rescale;
+         amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i] = (real)0.0;
+         Rescale = (real)0.0;
       }
-#     endif
+      else
+         Rescale = SQRT( Rho_Corr/Rho_Wrong );
 
-   } // for (int SonPID0=0; SonPID0<amr->NPatchComma[SonLv][1]; SonPID0+=8)
+      amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i] *= Rescale;
+      amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i] *= Rescale;
+   }
+#  endif
 
-} // FUNCTION : Flu_FixUp_Restrict
+} // FUNCTION : Flu_FixUp_Restrict_PatchGroup
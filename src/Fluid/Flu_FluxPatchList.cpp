@@ -0,0 +1,88 @@
+#include "GAMER.h"
+
+// list of the real patches with at least one flux array (i.e., adjacent to the coarse-fine boundaries) on each level
+static int *FluxPatchList     [NLEVEL];
+static int  FluxPatchList_N   [NLEVEL];
+static int  FluxPatchList_Size[NLEVEL];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RecordFluxPatchList
+// Description :  Record the real patches on level lv with at least one flux array allocated
+//
+// Note        :  1. Invoked by Flu_AllocateFluxArray() and LB_AllocateFluxArray() right after allocating the
+//                   flux arrays so that the list is rebuilt once after each regrid
+//                   --> Flu_FixUp_Flux() then loops over these patches only instead of scanning all patches
+//                2. Patches are recorded in ascending order of PID
+//                3. The list is kept until the end of the program and only reallocated when it needs to grow
+//
+// Parameter   :  lv : Coarse-grid level
+//-------------------------------------------------------------------------------------------------------
+void Flu_RecordFluxPatchList( const int lv )
+{
+
+   const int NReal = amr->NPatchComma[lv][1];
+
+   if ( NReal > FluxPatchList_Size[lv] )
+   {
+      FluxPatchList_Size[lv] = NReal;
+      FluxPatchList     [lv] = (int*)realloc( FluxPatchList[lv], FluxPatchList_Size[lv]*sizeof(int) );
+   }
+
+   FluxPatchList_N[lv] = 0;
+
+   for (int PID=0; PID<NReal; PID++)
+   for (int s=0; s<6; s++)
+   {
+      if ( amr->patch[0][lv][PID]->flux[s] != NULL )
+      {
+         FluxPatchList[lv][ FluxPatchList_N[lv] ++ ] = PID;
+         break;
+      }
+   }
+
+} // FUNCTION : Flu_RecordFluxPatchList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_GetFluxPatchList
+// Description :  Return the list recorded by Flu_RecordFluxPatchList()
+//
+// Note        :  1. Check the list against all real patches in the debug mode
+//
+// Parameter   :  lv     : Coarse-grid level
+//                NPatch : Number of patches in the list
+//
+// Return      :  NPatch, list of patch indices
+//-------------------------------------------------------------------------------------------------------
+const int *Flu_GetFluxPatchList( const int lv, int &NPatch )
+{
+
+#  ifdef GAMER_DEBUG
+   int t = 0;
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   for (int s=0; s<6; s++)
+   {
+      if ( amr->patch[0][lv][PID]->flux[s] != NULL )
+      {
+         if ( t >= FluxPatchList_N[lv]  ||  FluxPatchList[lv][t] != PID )
+            Aux_Error( ERROR_INFO, "outdated flux patch list (lv %d, PID %d) !!\n", lv, PID );
+
+         t ++;
+         break;
+      }
+   }
+
+   if ( t != FluxPatchList_N[lv] )
+      Aux_Error( ERROR_INFO, "outdated flux patch list (lv %d, NPatch %d != %d) !!\n", lv, FluxPatchList_N[lv], t );
+#  endif
+
+   NPatch = FluxPatchList_N[lv];
+
+   return FluxPatchList[lv];
+
+} // FUNCTION : Flu_GetFluxPatchList
@@ -0,0 +1,93 @@
+#include "GAMER.h"
+
+
+
+
+#ifdef PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_CheckFreeze
+// Description :  Check whether the fluid at the target level can be frozen since its mass is negligible
+//                compared to the particle mass
+//
+// Note        :  1. Enabled by PAR_FREEZE_FLU_RATIO and invoked by EvolveLevel() once per parent-level step
+//                2. Return true if M_gas < PAR_FREEZE_FLU_RATIO*M_par, where M_gas and M_par are the total
+//                   gas and particle masses in all real patches at lv over all ranks
+//                   --> Levels without particles are never frozen
+//                3. Must be invoked by all ranks
+//
+// Parameter   :  lv : Target refinement level
+//
+// Return      :  true/false --> freeze/evolve the fluid at lv
+//-------------------------------------------------------------------------------------------------------
+bool Flu_CheckFreeze( const int lv )
+{
+
+   if ( amr->Par->FreezeFluRatio <= 0.0 )    return false;
+
+
+   const double dv = CUBE( amr->dh[lv] );
+
+   double Mass_ThisRank[2] = { 0.0, 0.0 }, Mass_AllRank[2];   // [0/1] = gas/particles
+   double MassGas=0.0, MassPar=0.0;
+
+#  pragma omp parallel for reduction( +:MassGas, MassPar ) schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      const real (*Dens)[PS1][PS1] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[DENS];
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)  MassGas += Dens[k][j][i];
+
+      for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+         MassPar += amr->Par->Mass[ amr->patch[0][lv][PID]->ParList[p] ];
+   }
+
+   Mass_ThisRank[0] = MassGas*dv;
+   Mass_ThisRank[1] = MassPar;
+
+   MPI_Allreduce( Mass_ThisRank, Mass_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   return ( Mass_AllRank[1] > 0.0  &&  Mass_AllRank[0] < amr->Par->FreezeFluRatio*Mass_AllRank[1] );
+
+} // FUNCTION : Flu_CheckFreeze
+#endif // #ifdef PARTICLE
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FreezeLevel
+// Description :  Replace the fluid solver by copying the fluid (and magnetic) data to the new sandglass
+//
+// Note        :  1. Invoked by EvolveLevel() when Flu_CheckFreeze() returns true
+//                2. Work on both real and buffer patches so that no MPI communication is required
+//                   --> The buffer data in the old sandglass must be up-to-date
+//                3. Coarse-fine fluxes at lv are not updated
+//                   --> EvolveLevel() must skip the flux fix-up at lv-1
+//
+// Parameter   :  lv         : Target refinement level
+//                SaveSg_Flu : Sandglass to store the fluid data
+//                SaveSg_Mag : Sandglass to store the magnetic field (for MHD only)
+//-------------------------------------------------------------------------------------------------------
+void Flu_FreezeLevel( const int lv, const int SaveSg_Flu, const int SaveSg_Mag )
+{
+
+   const int FluSg = amr->FluSg[lv];
+#  ifdef MHD
+   const int MagSg = amr->MagSg[lv];
+#  endif
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->num[lv]; PID++)
+   {
+      memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid, amr->patch[FluSg][lv][PID]->fluid,
+              NCOMP_TOTAL*CUBE(PS1)*sizeof(real) );
+
+#     ifdef MHD
+      memcpy( amr->patch[SaveSg_Mag][lv][PID]->magnetic, amr->patch[MagSg][lv][PID]->magnetic,
+              NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+      amr->patch[SaveSg_Mag][lv][PID]->emag_valid = false;
+#     endif
+   }
+
+} // FUNCTION : Flu_FreezeLevel
@@ -0,0 +1,518 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+
+
+
+// skip (List=0) and catch-up (List=1) lists of patch groups at each level for OPT__FROZEN_REGION
+// --> allocated with FLU_GPU_NPGROUP elements on demand and freed by Flu_FrozenRegion_End()
+// --> Frz_Flux[lv][List][Idx][Slot][b] = time-integrated fluxes on the boundary face b (in the order -x, +x, -y, +y,
+//     -z, +z) of a patch group adopted by the neighbouring patch group advanced normally in the skipped (Slot=0)
+//     and catch-up (Slot=1) sub-steps
+// --> Frz_dt/TimeOld[lv][List] = dt and physical time before update of the skipped sub-step
+static int    Frz_NPG    [NLEVEL][2];
+static int   *Frz_PID0   [NLEVEL][2];
+static real (*Frz_Flux   [NLEVEL][2])[2][6][NFLUX_TOTAL][ SQR(PS2) ];
+static double Frz_dt     [NLEVEL][2];
+static double Frz_TimeOld[NLEVEL][2];
+
+// whether or not to continue applying AUTO_REDUCE_DT (declared in EvolveLevel.cpp)
+extern bool AutoReduceDt_Continue;
+
+// defined in Flu_RetryFailedPatchGroup.cpp
+int  Flu_SubStepPatchGroup( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                            const int NSub, const int NPG, const int (*NbIdx)[27],
+                            const real Flu_Old[][FLU_NIN][ CUBE(FLU_NXT) ], const real Flu_New[][FLU_NIN][ CUBE(FLU_NXT) ],
+                            const real BndFlux[][6][NFLUX_TOTAL][ SQR(PS2) ], const bool (*BndReplace)[6],
+                            real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ], real Flux_Sub[][9][NFLUX_TOTAL][ SQR(PS2) ] );
+void Flu_StorePatchGroup( const int lv, const int SaveSg_Flu, const int NPG, const int *PID0_List,
+                          const real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ] );
+
+static int  GetSibPID( const int lv, const int PID0, const int dx, const int dy, const int dz );
+static void RecordQuiet( const int lv, const int PID0, const real Flu_In[][ CUBE(FLU_NXT) ],
+                         const real Flu_Out[][ CUBE(PS2) ] );
+
+// index of the boundary face b (in the order -x, +x, -y, +y, -z, +z) in the flux array of the fluid solver
+#define BND_FACE( b )   ( 3*((b)/2) + 2*((b)%2) )
+
+// maximum number of sub-steps of the catch-up update
+#define NSUB_MAX        64
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FrozenRegion_Prepare
+// Description :  Select the quiescent patch groups to be skipped in this sub-step for OPT__FROZEN_REGION
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() before InvokeSolver(), which excludes the patch groups to be
+//                   skipped or caught up in this sub-step
+//                   --> Invoked again for each retry of AUTO_REDUCE_DT, which discards the previous selection
+//                2. A skipped patch group is caught up in the next sub-step by Flu_FrozenRegion_Advance() with
+//                   the accumulated dt, which is a local time-step twice as large as that of the level
+//                   --> AllowSkip must be false if the next sub-step does not belong to the same parent step or
+//                       if this level will be regridded after this sub-step
+//                3. A patch group is skipped only if
+//                   (a) its latest FROZEN_REGION_NSTEP updates are quiescent (see RecordQuiet())
+//                   (b) twice the current dt satisfies the CFL condition of its latest update
+//                   (c) all 26 siblings of it are real patches on this rank
+//                       --> no coarse-fine boundary, no simulation boundary, and no MPI communication of its fluxes
+//                   (d) neither it nor its 26 neighbouring patch groups have sons
+//                       --> no coarse-fine flux fix-up or restriction involves it and no finer patch interpolates
+//                           its stale data
+//                   (e) none of its 26 neighbouring patch groups is caught up in this sub-step
+//                4. At most FLU_GPU_NPGROUP patch groups are skipped so that the catch-up update fits in the host
+//                   arrays of the fluid solver
+//
+// Parameter   :  lv        : Target refinement level
+//                TimeOld   : Physical time before update
+//                dt        : Time interval to advance solution
+//                AllowSkip : Whether to skip any patch group in this sub-step
+//-------------------------------------------------------------------------------------------------------
+void Flu_FrozenRegion_Prepare( const int lv, const double TimeOld, const double dt, const bool AllowSkip )
+{
+
+// 1. reset the fluxes of the catch-up sub-step
+   for (int t=0; t<Frz_NPG[lv][1]; t++)   memset( Frz_Flux[lv][1][t][1], 0, sizeof(Frz_Flux[lv][1][t][1]) );
+
+
+// 2. reset the skip list of the previous attempt
+   for (int t=0; t<Frz_NPG[lv][0]; t++)   amr->patch[0][lv][ Frz_PID0[lv][0][t] ]->Frz_Mode = FRZ_NONE;
+
+   Frz_NPG    [lv][0] = 0;
+   Frz_dt     [lv][0] = dt;
+   Frz_TimeOld[lv][0] = TimeOld;
+
+   if ( !AllowSkip )    return;
+
+
+// 3. allocate the lists
+   if ( Frz_PID0[lv][0] == NULL )
+   {
+      for (int List=0; List<2; List++)
+      {
+         Frz_PID0[lv][List] = new int  [FLU_GPU_NPGROUP];
+         Frz_Flux[lv][List] = new real [FLU_GPU_NPGROUP][2][6][NFLUX_TOTAL][ SQR(PS2) ];
+      }
+   }
+
+
+// 4. select the patch groups to be skipped
+   const real MaxCFL_Skip = DT__FLUID*amr->dh[lv]/( 2.0*dt );
+
+   for (int PID0=0; PID0<amr->NPatchComma[lv][1]  &&  Frz_NPG[lv][0]<FLU_GPU_NPGROUP; PID0+=8)
+   {
+      patch_t *Patch = amr->patch[0][lv][PID0];
+
+      if ( Patch->Frz_Mode != FRZ_NONE  ||  Patch->Frz_NQuiet < FROZEN_REGION_NSTEP  ||
+           Patch->Frz_MaxCFL > MaxCFL_Skip )
+         continue;
+
+      bool Skip = true;
+
+      for (int dz=-1; dz<=1  &&  Skip; dz++)
+      for (int dy=-1; dy<=1  &&  Skip; dy++)
+      for (int dx=-1; dx<=1  &&  Skip; dx++)
+      {
+         int SibPID0 = PID0;
+
+         if ( dx != 0  ||  dy != 0  ||  dz != 0 )
+         {
+            const int SibPID = GetSibPID( lv, PID0, dx, dy, dz );
+
+            if ( SibPID < 0  ||  SibPID >= amr->NPatchComma[lv][1] )    {  Skip = false;  break;  }
+
+            SibPID0 = SibPID - SibPID%8;
+
+            if ( amr->patch[0][lv][SibPID0]->Frz_Mode == FRZ_CATCHUP )  {  Skip = false;  break;  }
+         }
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+            if ( amr->patch[0][lv][ SibPID0 + LocalID ]->son != -1 )     {  Skip = false;  break;  }
+      }
+
+      if ( !Skip )   continue;
+
+      const int Idx = Frz_NPG[lv][0] ++;
+
+      Frz_PID0[lv][0][Idx] = PID0;
+      Patch->Frz_Mode      = FRZ_SKIP;
+      Patch->Frz_Idx       = Idx;
+
+      memset( Frz_Flux[lv][0][Idx][0], 0, sizeof(Frz_Flux[lv][0][Idx][0]) );
+   } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]  &&  Frz_NPG[lv][0]<FLU_GPU_NPGROUP; PID0+=8)
+
+} // FUNCTION : Flu_FrozenRegion_Prepare
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FrozenRegion_Record
+// Description :  Record the quiescence of the patch groups updated by the fluid solver and the fluxes they
+//                adopt on the boundaries of the neighbouring skipped and caught-up patch groups for
+//                OPT__FROZEN_REGION
+//
+// Note        :  1. Invoked by Flu_Close()
+//                2. The input fluxes must be the final fluxes used by StoreFlux() and CorrectFlux()
+//                   (i.e., after CorrectUnphysical())
+//                3. Each boundary face of a skipped or caught-up patch group is shared by exactly one updated
+//                   patch group
+//                   --> No data race in the OpenMP loop
+//
+// Parameter   :  lv                : Target refinement level
+//                NPG               : Number of patch groups to be evaluated
+//                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
+//                h_Flu_Array_F_In  : Host array storing the input fluid variables
+//                h_Flu_Array_F_Out : Host array storing the updated fluid data
+//                h_Flux_Array      : Host array storing the updated flux data
+//                dt                : Evolution time-step
+//-------------------------------------------------------------------------------------------------------
+void Flu_FrozenRegion_Record( const int lv, const int NPG, const int *PID0_List,
+                              const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                              const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                              const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ], const real dt )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int PID0 = PID0_List[TID];
+
+      RecordQuiet( lv, PID0, h_Flu_Array_F_In[TID], h_Flu_Array_F_Out[TID] );
+
+      for (int b=0; b<6; b++)
+      {
+         const int dx     = ( b/2 == 0 ) ? 2*(b%2)-1 : 0;
+         const int dy     = ( b/2 == 1 ) ? 2*(b%2)-1 : 0;
+         const int dz     = ( b/2 == 2 ) ? 2*(b%2)-1 : 0;
+         const int SibPID = GetSibPID( lv, PID0, dx, dy, dz );
+
+//       buffer patches are never skipped
+         if ( SibPID < 0  ||  SibPID >= amr->NPatchComma[lv][1] )    continue;
+
+         const patch_t *Sib = amr->patch[0][lv][ SibPID - SibPID%8 ];
+
+         if ( Sib->Frz_Mode == FRZ_NONE )    continue;
+
+//       skipped sub-step --> slot 0 in the skip list; catch-up sub-step --> slot 1 in the catch-up list
+         const int List = ( Sib->Frz_Mode == FRZ_SKIP ) ? 0 : 1;
+         const int Slot = List;
+         real (*Flux)[ SQR(PS2) ] = Frz_Flux[lv][List][ Sib->Frz_Idx ][Slot][ b^1 ];
+
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         for (int m=0; m<SQR(PS2); m++)
+            Flux[v][m] = dt*h_Flux_Array[TID][ BND_FACE(b) ][v][m];
+      } // for (int b=0; b<6; b++)
+   } // for (int TID=0; TID<NPG; TID++)
+
+} // FUNCTION : Flu_FrozenRegion_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FrozenRegion_Advance
+// Description :  Copy the skipped patch groups to the new sandglass and catch up the patch groups skipped in the
+//                previous sub-step for OPT__FROZEN_REGION
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() after InvokeSolver()
+//                2. The caught-up patch groups are advanced from the data before the skipped sub-step by the dt
+//                   of both sub-steps with the sub-steps required by their latest CFL speed
+//                   --> Ghost zones are fixed at the data of this sub-step except for the cells in the adjacent
+//                       caught-up patch groups, which are advanced together
+//                3. The time-integrated fluxes on the patch-group boundaries are replaced by those adopted by the
+//                   neighbouring patch groups in both sub-steps (see Flu_FrozenRegion_Record())
+//                   --> Conservative without modifying any other patch group
+//                4. Other operators (e.g., gravity and Grackle) still update the skipped patch groups in the
+//                   skipped sub-step, which are then applied before the catch-up fluid update as in operator
+//                   splitting
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//
+// Return      :  GAMER_SUCCESS / GAMER_FAILED
+//-------------------------------------------------------------------------------------------------------
+int Flu_FrozenRegion_Advance( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                              const int SaveSg_Flu )
+{
+
+// 1. copy the skipped patch groups to the new sandglass
+   const int FluSg = amr->FluSg[lv];
+
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<Frz_NPG[lv][0]; t++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int PID = Frz_PID0[lv][0][t] + LocalID;
+
+      memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid, amr->patch[FluSg][lv][PID]->fluid,
+              FLU_NOUT*CUBE(PS1)*sizeof(real) );
+   }
+
+
+// 2. collect the adjacent caught-up patch groups and the boundary fluxes of the caught-up patch groups
+   const int  NPG       = Frz_NPG[lv][1];
+   const int *PID0_List = Frz_PID0[lv][1];
+
+   if ( NPG == 0 )   return GAMER_SUCCESS;
+
+   const double dt_Acc      = Frz_dt[lv][1] + dt;
+   const double TimeOld_Acc = Frz_TimeOld[lv][1];
+
+   int  (*NbIdx     )[27]                       = new int  [NPG][27];
+   bool (*BndReplace)[6]                        = new bool [NPG][6];
+   real (*BndFlux   )[6][NFLUX_TOTAL][ SQR(PS2) ] = new real [NPG][6][NFLUX_TOTAL][ SQR(PS2) ];
+   real  MaxCFL                                 = (real)0.0;
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int PID0 = PID0_List[t];
+
+      for (int dz=-1; dz<=1; dz++)
+      for (int dy=-1; dy<=1; dy++)
+      for (int dx=-1; dx<=1; dx++)
+      {
+         const int Nb = ( (dz+1)*3 + (dy+1) )*3 + (dx+1);
+
+         NbIdx[t][Nb] = -1;
+
+         if ( dx == 0  &&  dy == 0  &&  dz == 0 )  continue;
+
+         const int      SibPID = GetSibPID( lv, PID0, dx, dy, dz );
+         const patch_t *Sib    = amr->patch[0][lv][ SibPID - SibPID%8 ];
+
+         if ( Sib->Frz_Mode == FRZ_CATCHUP )    NbIdx[t][Nb] = Sib->Frz_Idx;
+
+//       the face shared with another caught-up patch group is updated consistently by both
+         if ( dx*dx + dy*dy + dz*dz == 1 )
+         {
+            const int b = ( dx != 0 ) ? (dx+1)/2 : ( dy != 0 ) ? 2+(dy+1)/2 : 4+(dz+1)/2;
+
+            BndReplace[t][b] = ( Sib->Frz_Mode != FRZ_CATCHUP );
+         }
+      }
+
+      for (int b=0; b<6; b++)
+      for (int v=0; v<NFLUX_TOTAL; v++)
+      for (int m=0; m<SQR(PS2); m++)
+         BndFlux[t][b][v][m] = ( Frz_Flux[lv][1][t][0][b][v][m] + Frz_Flux[lv][1][t][1][b][v][m] ) / dt_Acc;
+
+      MaxCFL = FMAX( MaxCFL, amr->patch[0][lv][PID0]->Frz_MaxCFL );
+   } // for (int t=0; t<NPG; t++)
+
+
+// 3. prepare the input data before the skipped sub-step with the ghost zones of this sub-step
+   const bool IntPhase_No        = false;
+   const real MinDens_No         = -1.0;
+   const real MinPres_No         = -1.0;
+   const bool DE_Consistency_Yes = true;
+   const bool DE_Consistency_No  = false;
+   const bool DE_Consistency     = ( OPT__OPTIMIZE_AGGRESSIVE ) ? DE_Consistency_No : DE_Consistency_Yes;
+   const real MinDens            = ( OPT__OPTIMIZE_AGGRESSIVE ) ? MinDens_No : MIN_DENS;
+
+   real (*Flu_Old )[FLU_NIN ][ CUBE(FLU_NXT) ]   = new real [NPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real (*Flu_Sub )[FLU_NOUT][ CUBE(PS2) ]       = new real [NPG][FLU_NOUT][ CUBE(PS2) ];
+   real (*Flux_Sub)[9][NFLUX_TOTAL][ SQR(PS2) ] = new real [NPG][9][NFLUX_TOTAL][ SQR(PS2) ];
+
+   Prepare_PatchData( lv, TimeOld, Flu_Old[0][0], NULL,
+                      FLU_GHOST_SIZE, NPG, PID0_List, _TOTAL, _NONE,
+                      OPT__FLU_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                      OPT__BC_FLU, BC_POT_NONE, MinDens, MinPres_No, DE_Consistency );
+
+
+// 4. advance the caught-up patch groups with an increasing number of sub-steps
+   int Status = GAMER_FAILED;
+
+   for (int NSub=MAX( 1, (int)ceil(dt_Acc*MaxCFL/(DT__FLUID*amr->dh[lv])) ); NSub<=NSUB_MAX; NSub*=2)
+   {
+      Status = Flu_SubStepPatchGroup( lv, TimeNew, TimeOld_Acc, dt_Acc, NSub, NPG, NbIdx, Flu_Old, Flu_Old,
+                                      BndFlux, BndReplace, Flu_Sub, Flux_Sub );
+
+      if ( Status == GAMER_SUCCESS )   break;
+   }
+
+
+// 5. store the results
+   if ( Status == GAMER_SUCCESS )
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int t=0; t<NPG; t++)  RecordQuiet( lv, PID0_List[t], Flu_Old[t], Flu_Sub[t] );
+
+      Flu_StorePatchGroup( lv, SaveSg_Flu, NPG, PID0_List, Flu_Sub );
+   }
+
+   else if ( !AUTO_REDUCE_DT  ||  !AutoReduceDt_Continue )
+      Aux_Error( ERROR_INFO, "catch-up update of %d skipped patch group(s) failed (Rank %d, Lv %2d, counter %8ld) !!\n",
+                 NPG, MPI_Rank, lv, AdvanceCounter[lv] );
+
+
+   delete [] NbIdx;
+   delete [] BndReplace;
+   delete [] BndFlux;
+   delete [] Flu_Old;
+   delete [] Flu_Sub;
+   delete [] Flux_Sub;
+
+   return Status;
+
+} // FUNCTION : Flu_FrozenRegion_Advance
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FrozenRegion_Commit
+// Description :  Accept the fluid update of this sub-step for OPT__FROZEN_REGION
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() after the fluid solver succeeds on all ranks
+//                2. Update the number of consecutive quiescent updates of the advanced patch groups
+//                3. The patch groups skipped in this sub-step will be caught up in the next sub-step
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Flu_FrozenRegion_Commit( const int lv )
+{
+
+// 1. update the number of consecutive quiescent updates
+   for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+   {
+      patch_t *Patch = amr->patch[0][lv][PID0];
+
+      if ( Patch->Frz_Mode == FRZ_SKIP )  continue;
+
+      Patch->Frz_NQuiet = ( Patch->Frz_Quiet ) ? Patch->Frz_NQuiet+1 : 0;
+   }
+
+
+// 2. move the skip list to the catch-up list
+   for (int t=0; t<Frz_NPG[lv][1]; t++)   amr->patch[0][lv][ Frz_PID0[lv][1][t] ]->Frz_Mode = FRZ_NONE;
+   for (int t=0; t<Frz_NPG[lv][0]; t++)   amr->patch[0][lv][ Frz_PID0[lv][0][t] ]->Frz_Mode = FRZ_CATCHUP;
+
+   int  *PID0_Tmp = Frz_PID0[lv][0];
+   real (*Flux_Tmp)[2][6][NFLUX_TOTAL][ SQR(PS2) ] = Frz_Flux[lv][0];
+
+   Frz_PID0[lv][0] = Frz_PID0[lv][1];
+   Frz_Flux[lv][0] = Frz_Flux[lv][1];
+   Frz_PID0[lv][1] = PID0_Tmp;
+   Frz_Flux[lv][1] = Flux_Tmp;
+
+   Frz_NPG    [lv][1] = Frz_NPG    [lv][0];
+   Frz_dt     [lv][1] = Frz_dt     [lv][0];
+   Frz_TimeOld[lv][1] = Frz_TimeOld[lv][0];
+   Frz_NPG    [lv][0] = 0;
+
+} // FUNCTION : Flu_FrozenRegion_Commit
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FrozenRegion_End
+// Description :  Free the lists allocated by Flu_FrozenRegion_Prepare()
+//
+// Note        :  1. Invoked by End_MemFree_Fluid()
+//-------------------------------------------------------------------------------------------------------
+void Flu_FrozenRegion_End()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int List=0; List<2; List++)
+   {
+      delete [] Frz_PID0[lv][List];    Frz_PID0[lv][List] = NULL;
+      delete [] Frz_Flux[lv][List];    Frz_Flux[lv][List] = NULL;
+
+      Frz_NPG[lv][List] = 0;
+   }
+
+} // FUNCTION : Flu_FrozenRegion_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetSibPID
+// Description :  Return the sibling patch of a patch group in the target direction
+//
+// Parameter   :  lv       : Target refinement level
+//                PID0     : Patch index with LocalID==0 of the target patch group
+//                dx/dy/dz : Target direction (-1/0/+1)
+//
+// Return      :  Index of a patch in the sibling patch group (< 0 --> none)
+//-------------------------------------------------------------------------------------------------------
+int GetSibPID( const int lv, const int PID0, const int dx, const int dy, const int dz )
+{
+
+   const int SibID_Array[3][3][3] = {  { {18, 10, 19}, {14,   4, 16}, {20, 11, 21} },
+                                       { { 6,  2,  7}, { 0,  26,  1}, { 8,  3,  9} },
+                                       { {22, 12, 23}, {15,   5, 17}, {24, 13, 25} }  };    // sibling indices
+   const int LocalID[2][2][2]     = { 0, 1, 2, 4, 3, 6, 5, 7 };
+
+// any patch of the patch group adjacent to the target direction works
+   const int PID = PID0 + LocalID[ (dz==1)?1:0 ][ (dy==1)?1:0 ][ (dx==1)?1:0 ];
+
+   return amr->patch[0][lv][PID]->sibling[ SibID_Array[dz+1][dy+1][dx+1] ];
+
+} // FUNCTION : GetSibPID
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RecordQuiet
+// Description :  Record whether an update of a patch group is quiescent and its maximum CFL speed
+//
+// Note        :  1. An update is quiescent if the relative change of density and total energy of all cells
+//                   does not exceed FROZEN_REGION_TOL
+//                2. Store the results in patch_t::Frz_Quiet and patch_t::Frz_MaxCFL, which are applied by
+//                   Flu_FrozenRegion_Commit() and Flu_FrozenRegion_Prepare()
+//
+// Parameter   :  lv      : Target refinement level
+//                PID0    : Patch index with LocalID==0 of the target patch group
+//                Flu_In  : Input fluid data with ghost zones
+//                Flu_Out : Updated fluid data
+//-------------------------------------------------------------------------------------------------------
+void RecordQuiet( const int lv, const int PID0, const real Flu_In[][ CUBE(FLU_NXT) ],
+                  const real Flu_Out[][ CUBE(PS2) ] )
+{
+
+   const int CompIdx[2] = { DENS, ENGY };
+
+   patch_t *Patch = amr->patch[0][lv][PID0];
+   bool     Quiet = true;
+
+   for (int k=0; k<PS2  &&  Quiet; k++)
+   for (int j=0; j<PS2  &&  Quiet; j++)
+   for (int i=0; i<PS2  &&  Quiet; i++)
+   {
+      const int idx_in  = IDX321( i+FLU_GHOST_SIZE, j+FLU_GHOST_SIZE, k+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT );
+      const int idx_out = IDX321( i, j, k, PS2, PS2 );
+
+      for (int c=0; c<2; c++)
+      {
+         const int  v      = CompIdx[c];
+         const real Change = FABS( Flu_Out[v][idx_out] - Flu_In[v][idx_in] );
+
+         if ( Change > FROZEN_REGION_TOL*FABS(Flu_In[v][idx_in]) )   Quiet = false;
+      }
+   }
+
+   Patch->Frz_Quiet = Quiet;
+
+   if ( !Quiet )  return;
+
+   real MaxCFL = (real)0.0;
+
+   for (int idx=0; idx<CUBE(PS2); idx++)
+   {
+      real fluid[FLU_NOUT];
+
+      for (int v=0; v<FLU_NOUT; v++)   fluid[v] = Flu_Out[v][idx];
+
+      MaxCFL = FMAX( dt_GetCFLSpeed_Hydro(fluid), MaxCFL );
+   }
+
+   Patch->Frz_MaxCFL = MaxCFL;
+
+} // FUNCTION : RecordQuiet
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
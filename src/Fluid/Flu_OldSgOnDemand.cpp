@@ -0,0 +1,88 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_AllocateOldSg
+// Description :  Allocate fluid[] (and magnetic[]) in the sandglass not storing the current data for all real and
+//                buffer patches at the target level
+//
+// Note        :  1. Invoked by EvolveLevel() right before the fluid solver for OPT__SG_ON_DEMAND
+//                   --> The fluid solver stores the updated data in this sandglass (i.e., SaveSg_Flu/Mag)
+//                2. Only patches with fluid[] (magnetic[]) allocated in the current sandglass are considered
+//                   --> Buffer patches storing pot[] only are skipped
+//                3. Do nothing for the patches already having the arrays allocated (e.g., new patches created
+//                   by refinement)
+//                4. Arrays are allocated from the patch arena for OPT__PATCH_ARENA, so the blocks released by
+//                   Flu_FreeOldSg() are recycled
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Flu_AllocateOldSg( const int lv )
+{
+
+   if ( !OPT__SG_ON_DEMAND )  return;
+
+   const int FluSg = amr->FluSg[lv];
+#  ifdef MHD
+   const int MagSg = amr->MagSg[lv];
+#  endif
+
+// avoid OpenMP here since the patch arena is not thread-safe
+   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   {
+      if ( amr->patch[  FluSg][lv][PID]->fluid    != NULL )   amr->patch[1-FluSg][lv][PID]->hnew();
+#     ifdef MHD
+      if ( amr->patch[  MagSg][lv][PID]->magnetic != NULL )   amr->patch[1-MagSg][lv][PID]->mnew();
+#     endif
+   }
+
+} // FUNCTION : Flu_AllocateOldSg
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FreeOldSg
+// Description :  Free fluid[] (and magnetic[]) in the sandglass not storing the current data for all real and
+//                buffer patches at the target level
+//
+// Note        :  1. Invoked by EvolveLevel() for OPT__SG_ON_DEMAND once the data at the previous time are no longer
+//                   required, which are
+//                   (1) after the Poisson/gravity solver of each sub-step at lv+1, since the first sub-step at lv+1
+//                       prepares the ghost zones from the data of lv at the previous time
+//                   (2) at the end of each sub-step at lv, in case lv+1 does not exist
+//                   --> Must disable OPT__INT_TIME so that the other sub-steps at lv+1 only use the current data
+//                       of lv (see SetTempIntPara())
+//                2. Do not use patch_t::hdelete() since it also frees rho_ext[] in Sg=0
+//                3. Do nothing if the arrays are not allocated
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Flu_FreeOldSg( const int lv )
+{
+
+   if ( !OPT__SG_ON_DEMAND )  return;
+
+   const int OldFluSg = 1 - amr->FluSg[lv];
+#  ifdef MHD
+   const int OldMagSg = 1 - amr->MagSg[lv];
+#  endif
+
+   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   {
+      patch_t *Patch = amr->patch[OldFluSg][lv][PID];
+
+      if ( Patch->fluid != NULL )
+      {
+         if ( OPT__PATCH_ARENA )    Mis_PatchArena_Free( PATCH_ARENA_FLU, Patch->ArenaID, Patch->fluid );
+         else                       delete [] Patch->fluid;
+         Patch->fluid = NULL;
+      }
+
+#     ifdef MHD
+      if ( amr->patch[OldMagSg][lv][PID]->magnetic != NULL )   amr->patch[OldMagSg][lv][PID]->mdelete();
+#     endif
+   }
+
+} // FUNCTION : Flu_FreeOldSg
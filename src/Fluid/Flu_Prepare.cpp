@@ -7,7 +7,10 @@
 // Function    :  Flu_Prepare
 // Description :  Prepare input arrays for the fluid solver
 //
-// Note        :  Invoke Prepare_PatchData()
+// Note        :  1. Invoke Prepare_PatchData()
+//                2. Potential for UNSPLIT_GRAVITY may be copied from pot_ext[] directly when OPT__USG_POT_EXT
+//                   is on (see Poi_PotExtSg())
+//                3. Record the time and patch classes for OPT__RECORD_PATCH_COST (see Aux_Record_PatchCost.cpp)
 //
 // Parameter   :  lv                   : Target refinement level
 //                PrepTime             : Target physical time to prepare the coarse-grid data
@@ -53,6 +56,10 @@ void Flu_Prepare( const int lv, const double PrepTime,
    const bool   DE_Consistency      = ( OPT__OPTIMIZE_AGGRESSIVE ) ? DE_Consistency_No : DE_Consistency_Yes;
    const real   MinDens             = ( OPT__OPTIMIZE_AGGRESSIVE ) ? MinDens_No : MIN_DENS;
 
+#  ifdef TIMING
+   const long   PatchCost_T0        = ( OPT__RECORD_PATCH_COST ) ? ThreadTimer_t::GetNanoSec() : 0L;
+#  endif
+
 
 // prepare the fluid array
 #  if ( MODEL == ELBDM )
@@ -69,11 +76,21 @@ void Flu_Prepare( const int lv, const double PrepTime,
 
 #  ifdef UNSPLIT_GRAVITY
 // prepare the potential array
+// --> copy from pot_ext[] directly when OPT__USG_POT_EXT is on and pot_ext[] is applicable
    if ( OPT__GRAVITY_TYPE == GRAVITY_SELF  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH )
-   Prepare_PatchData( lv, PrepTime, h_Pot_Array_USG_F[0], NULL,
-                      USG_GHOST_SIZE_F, NPG, PID0_List, _POTE, _NONE,
-                      OPT__GRA_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
-                      OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+   {
+#     ifdef STORE_POT_GHOST
+      const int PotExtSg = Poi_PotExtSg( lv, PrepTime, USG_GHOST_SIZE_F, NPG, PID0_List );
+
+      if ( PotExtSg != -1 )
+      Poi_Prepare_PotExt( lv, PotExtSg, h_Pot_Array_USG_F[0], USG_GHOST_SIZE_F, NPG, PID0_List, UNIT_PATCHGROUP );
+      else
+#     endif
+      Prepare_PatchData( lv, PrepTime, h_Pot_Array_USG_F[0], NULL,
+                         USG_GHOST_SIZE_F, NPG, PID0_List, _POTE, _NONE,
+                         OPT__GRA_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                         OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+   }
 
 // prepare the corner array
    if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
@@ -92,4 +109,14 @@ void Flu_Prepare( const int lv, const double PrepTime,
    }
 #  endif // #ifdef UNSPLIT_GRAVITY
 
+
+// record the cost of different patch classes
+#  ifdef TIMING
+   if ( OPT__RECORD_PATCH_COST )
+   {
+      Aux_PatchCost_Add( PATCH_COST_FLU_PREPARE, lv, 8L*NPG, ThreadTimer_t::GetNanoSec()-PatchCost_T0 );
+      Aux_PatchCost_AddClass( lv, NPG, PID0_List );
+   }
+#  endif
+
 } // FUNCTION : Flu_Prepare
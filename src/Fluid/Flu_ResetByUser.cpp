@@ -3,11 +3,20 @@
 // declare as static so that other functions cannot invoke them directly and must use the function pointers
 static bool Flu_ResetByUser_Func_Template( real fluid[], const double x, const double y, const double z, const double Time,
                                            const int lv, double AuxArray[] );
+static bool Flu_ResetByUser_Batch_Template( real fluid[], bool Reset[], const int NCell, const double x[], const double y[],
+                                            const double z[], const double Time, const int lv, double AuxArray[] );
+static bool Flu_ResetByUser_Patch_Template( const double EdgeL[], const double EdgeR[], const double Time, const int lv );
 static void Flu_ResetByUser_API_Default( const int lv, const int FluSg, const double TTime );
+static void FinalizeResetCell( real fluid[], const int lv, const int PID, const int i, const int j, const int k );
 
-// this function pointer **must** be set by a test problem initializer
+// this function pointer **must** be set by a test problem initializer unless Flu_ResetByUser_Batch_Ptr is set
 bool (*Flu_ResetByUser_Func_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                                   const int lv, double AuxArray[] ) = NULL;
+// this optional function pointer may be set by a test problem initializer to replace Flu_ResetByUser_Func_Ptr
+bool (*Flu_ResetByUser_Batch_Ptr)( real fluid[], bool Reset[], const int NCell, const double x[], const double y[],
+                                   const double z[], const double Time, const int lv, double AuxArray[] ) = NULL;
+// this optional function pointer may be set by a test problem initializer to skip patches outside the reset region
+bool (*Flu_ResetByUser_Patch_Ptr)( const double EdgeL[], const double EdgeR[], const double Time, const int lv ) = NULL;
 // this function pointer **may** be overwritten by a test problem initializer
 void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const double TTime ) = Flu_ResetByUser_API_Default;
 
@@ -85,6 +94,107 @@ bool Flu_ResetByUser_Func_Template( real fluid[], const double x, const double y
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_ResetByUser_Batch_Template
+// Description :  Function template to reset the fluid field of multiple cells at once
+//
+// Note        :  1. Invoked by Flu_ResetByUser_API_Default() and Model_Init_ByFunction_AssignData() using the
+//                   function pointer "Flu_ResetByUser_Batch_Ptr", which may be set by a test problem initializer
+//                   --> Optional. Flu_ResetByUser_Func_Ptr will be invoked for each cell if it is NULL.
+//                2. Must reset the same cells as Flu_ResetByUser_Func_Ptr but works on arrays so that it can be
+//                   vectorized by the compiler
+//                   --> The fluid array is stored as fluid[NCOMP_TOTAL][NCell]
+//                   --> All cells of a patch are passed in a single call, in which case fluid[] points to the
+//                       patch data directly
+//                3. Must set Reset[] for all cells and leave fluid[] untouched for the cells with Reset[] == false
+//                4. Same dual-energy requirement as Flu_ResetByUser_Func_Template()
+//
+// Parameter   :  fluid    : Fluid array storing both the input (origial) and reset values
+//                Reset    : Whether each cell has been reset
+//                NCell    : Number of target cells
+//                x/y/z    : Target physical coordinates of each cell
+//                Time     : Target physical time
+//                lv       : Target refinement level
+//                AuxArray : Auxiliary array
+//
+// Return      :  true  : At least one cell has been reset
+//                false : No cell has been reset
+//-------------------------------------------------------------------------------------------------------
+bool Flu_ResetByUser_Batch_Template( real fluid[], bool Reset[], const int NCell, const double x[], const double y[],
+                                     const double z[], const double Time, const int lv, double AuxArray[] )
+{
+
+// Example : reset the density to a small value if the cell is within a specific sphere
+   /*
+   const double TRad    = 0.3;
+   const real   MinDens = 1.0e-10;
+   bool ResetAny = false;
+
+// only the operations free of function calls can be vectorized
+   for (int t=0; t<NCell; t++)
+   {
+      Reset[t] = (  SQR(x[t]-0.5*amr->BoxSize[0]) + SQR(y[t]-0.5*amr->BoxSize[1]) + SQR(z[t]-0.5*amr->BoxSize[2])
+                    <= SQR(TRad)  );
+
+      if ( Reset[t] )   fluid[ DENS*NCell + t ] = MinDens;
+
+      ResetAny |= Reset[t];
+   }
+
+   return ResetAny;
+   */
+
+   for (int t=0; t<NCell; t++)   Reset[t] = false;
+
+   return false;
+
+} // FUNCTION : Flu_ResetByUser_Batch_Template
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_ResetByUser_Patch_Template
+// Description :  Function template to check whether a patch may contain cells to be reset
+//
+// Note        :  1. Invoked by Flu_ResetByUser_API_Default() using the function pointer "Flu_ResetByUser_Patch_Ptr",
+//                   which may be set by a test problem initializer
+//                   --> Optional. All patches will be checked cell by cell if it is NULL.
+//                2. Patches for which this function returns false are skipped entirely
+//                   --> Useful when the reset region (e.g., jet sources and sink regions) is tiny
+//                   --> Must be conservative: never return false for a patch containing any cell to be reset
+//
+// Parameter   :  EdgeL/R : Left and right edges of the target patch
+//                Time    : Target physical time
+//                lv      : Target refinement level
+//
+// Return      :  true  : The target patch may contain cells to be reset
+//                false : No cell in the target patch will be reset
+//-------------------------------------------------------------------------------------------------------
+bool Flu_ResetByUser_Patch_Template( const double EdgeL[], const double EdgeR[], const double Time, const int lv )
+{
+
+// Example : skip patches not intersecting a specific sphere
+   /*
+   const double TRad = 0.3;
+   double Dis2 = 0.0;
+
+   for (int d=0; d<3; d++)
+   {
+      const double Cen = 0.5*amr->BoxSize[d];
+
+      if      ( Cen < EdgeL[d] )   Dis2 += SQR( EdgeL[d] - Cen );
+      else if ( Cen > EdgeR[d] )   Dis2 += SQR( Cen - EdgeR[d] );
+   }
+
+   return ( Dis2 <= SQR(TRad) );
+   */
+
+   return true;
+
+} // FUNCTION : Flu_ResetByUser_Patch_Template
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Flu_ResetByUser_API_Default
 // Description :  Default API for resetting the fluid array
@@ -97,6 +207,9 @@ bool Flu_ResetByUser_Func_Template( real fluid[], const double x, const double y
 //                3. Currently NOT applied to the input uniform array
 //                   --> Init_ByFile() does NOT call this function
 //                4. Currently does not work with "OPT__OVERLAP_MPI"
+//                5. Patches rejected by Flu_ResetByUser_Patch_Ptr (if set) are skipped
+//                6. Invoke Flu_ResetByUser_Batch_Ptr for all cells in a patch at once if it is set. Otherwise,
+//                   invoke Flu_ResetByUser_Func_Ptr for each cell.
 //
 // Parameter   :  lv    : Target refinement level
 //                FluSg : Target fluid sandglass
@@ -106,70 +219,152 @@ void Flu_ResetByUser_API_Default( const int lv, const int FluSg, const double TT
 {
 
 // check
-   if ( Flu_ResetByUser_Func_Ptr == NULL )
-      Aux_Error( ERROR_INFO, "Flu_ResetByUser_Func_Ptr == NULL for OPT__RESET_FLUID !!\n" );
-
+   if ( Flu_ResetByUser_Func_Ptr == NULL  &&  Flu_ResetByUser_Batch_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "Flu_ResetByUser_Func_Ptr and Flu_ResetByUser_Batch_Ptr are both NULL for OPT__RESET_FLUID !!\n" );
 
-   const double dh = amr->dh[lv];
 
-   bool   Reset;
-   real   fluid[NCOMP_TOTAL];
-   double x, y, z, x0, y0, z0;
+   const double dh       = amr->dh[lv];
+   const bool   UseBatch = ( Flu_ResetByUser_Batch_Ptr != NULL );
+   const int    NCell    = CUBE( PS1 );
 
 
-#  pragma omp parallel for private( Reset, fluid, x, y, z, x0, y0, z0 ) schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+#  pragma omp parallel
    {
-      x0 = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh;
-      y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh;
-      z0 = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
+      bool    Reset;
+      real    fluid[NCOMP_TOTAL];
+      double  x, y, z, x0, y0, z0;
+      double *x_Batch     = ( UseBatch ) ? new double [NCell] : NULL;
+      double *y_Batch     = ( UseBatch ) ? new double [NCell] : NULL;
+      double *z_Batch     = ( UseBatch ) ? new double [NCell] : NULL;
+      bool   *Reset_Batch = ( UseBatch ) ? new bool   [NCell] : NULL;
+
+#     pragma omp for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+//       skip patches outside the reset region
+         if (  Flu_ResetByUser_Patch_Ptr != NULL  &&
+               !Flu_ResetByUser_Patch_Ptr( amr->patch[0][lv][PID]->EdgeL, amr->patch[0][lv][PID]->EdgeR, TTime, lv )  )
+            continue;
+
+         real (*Fluid)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+
+         x0 = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh;
+         y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh;
+         z0 = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
+
+//       reset all cells in this patch at once
+         if ( UseBatch )
+         {
+            int t = 0;
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               x_Batch[t] = x0 + i*dh;
+               y_Batch[t] = y0 + j*dh;
+               z_Batch[t] = z0 + k*dh;
+               t ++;
+            }
 
-      for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
-      for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
-      for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+//          fluid[] of a patch is already stored as [NCOMP_TOTAL][NCell]
+            if (  !Flu_ResetByUser_Batch_Ptr( Fluid[0][0][0], Reset_Batch, NCell, x_Batch, y_Batch, z_Batch, TTime, lv, NULL )  )
+               continue;
 
-         for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
+            t = 0;
 
-//       reset this cell
-         Reset = Flu_ResetByUser_Func_Ptr( fluid, x, y, z, TTime, lv, NULL );
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++, t++)
+            {
+               if ( !Reset_Batch[t] )  continue;
 
-//       operations necessary only when this cell has been reset
-         if ( Reset )
+               for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = Fluid[v][k][j][i];
+
+               FinalizeResetCell( fluid, lv, PID, i, j, k );
+
+               for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][k][j][i] = fluid[v];
+            }
+         } // if ( UseBatch )
+
+//       reset cell by cell
+         else
          {
-#           if ( MODEL == HYDRO )
-#           ifdef MHD
-            const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
-#           else
-            const real Emag = NULL_REAL;
-#           endif
-
-//          apply density and internal energy floors
-            fluid[DENS] = FMAX( fluid[DENS], (real)MIN_DENS );
-            fluid[ENGY] = Hydro_CheckMinEintInEngy( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
-                                                    MIN_EINT, Emag );
-
-//          calculate the dual-energy variable (entropy or internal energy)
-#           if   ( DUAL_ENERGY == DE_ENPY )
-            fluid[ENPY] = Hydro_Con2Entropy( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY], Emag,
-                                             EoS_DensEint2Pres_CPUPtr, EoS_AuxArray );
-#           elif ( DUAL_ENERGY == DE_EINT )
-#           error : DE_EINT is NOT supported yet !!
-#           endif
-
-//          floor and normalize passive scalars
-#           if ( NCOMP_PASSIVE > 0 )
-            for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  fluid[v] = FMAX( fluid[v], TINY_NUMBER );
-
-            if ( OPT__NORMALIZE_PASSIVE )
-               Hydro_NormalizePassive( fluid[DENS], fluid+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
-#           endif
-#           endif // if ( MODEL == HYDRO )
-
-//          store the reset values
-            for (int v=0; v<NCOMP_TOTAL; v++)   amr->patch[FluSg][lv][PID]->fluid[v][k][j][i] = fluid[v];
-         } // if ( Reset )
-
-      }}} // i,j,k
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+            for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
+            for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
+            for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+
+               for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = Fluid[v][k][j][i];
+
+//             reset this cell
+               Reset = Flu_ResetByUser_Func_Ptr( fluid, x, y, z, TTime, lv, NULL );
+
+//             operations necessary only when this cell has been reset
+               if ( Reset )
+               {
+                  FinalizeResetCell( fluid, lv, PID, i, j, k );
+
+//                store the reset values
+                  for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][k][j][i] = fluid[v];
+               }
+
+            }}} // i,j,k
+         } // if ( UseBatch ) ... else ...
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+      delete [] x_Batch;
+      delete [] y_Batch;
+      delete [] z_Batch;
+      delete [] Reset_Batch;
+   } // end of OpenMP parallel region
 
 } // FUNCTION : Flu_ResetByUser_API_Default
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FinalizeResetCell
+// Description :  Apply the floors and set the dual-energy variable of a cell reset by the user
+//
+// Note        :  1. Invoked by Flu_ResetByUser_API_Default()
+//
+// Parameter   :  fluid : Fluid array of the target cell
+//                lv    : Target refinement level
+//                PID   : Target patch index
+//                i/j/k : Target cell indices in the patch
+//
+// Return      :  fluid
+//-------------------------------------------------------------------------------------------------------
+void FinalizeResetCell( real fluid[], const int lv, const int PID, const int i, const int j, const int k )
+{
+
+#  if ( MODEL == HYDRO )
+#  ifdef MHD
+   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
+#  else
+   const real Emag = NULL_REAL;
+#  endif
+
+// apply density and internal energy floors
+   fluid[DENS] = FMAX( fluid[DENS], (real)MIN_DENS );
+   fluid[ENGY] = Hydro_CheckMinEintInEngy( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
+                                           MIN_EINT, Emag );
+
+// calculate the dual-energy variable (entropy or internal energy)
+#  if   ( DUAL_ENERGY == DE_ENPY )
+   fluid[ENPY] = Hydro_Con2Entropy( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY], Emag,
+                                    EoS_DensEint2Pres_CPUPtr, EoS_AuxArray );
+#  elif ( DUAL_ENERGY == DE_EINT )
+#  error : DE_EINT is NOT supported yet !!
+#  endif
+
+// floor and normalize passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  fluid[v] = FMAX( fluid[v], TINY_NUMBER );
+
+   if ( OPT__NORMALIZE_PASSIVE )
+      Hydro_NormalizePassive( fluid[DENS], fluid+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#  endif
+#  endif // if ( MODEL == HYDRO )
+
+} // FUNCTION : FinalizeResetCell
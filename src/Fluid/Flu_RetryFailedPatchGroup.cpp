@@ -0,0 +1,522 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  !defined GPU )
+
+
+
+// patch groups failed in the fluid solver and their fluxes on the patch-group boundaries for AUTO_REDUCE_DT_LOCAL
+// --> recorded by Flu_RecordFailedPatchGroup() and allocated by Init_MemAllocate_Fluid() with FLU_GPU_NPGROUP elements
+// --> [6] = boundary faces in the order -x, +x, -y, +y, -z, +z
+int    FailPG_NPG  = 0;
+int   *FailPG_PID0 = NULL;
+real (*FailPG_Flux)[6][NFLUX_TOTAL][ SQR(PS2) ] = NULL;
+
+// defined in Flu_Close.cpp
+bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
+void StoreFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                const int NPG, const int *PID0_List, const real dt );
+#ifndef MHD
+void RecordMaxCFL( const int lv, const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ], const int NPG,
+                   const int *PID0_List );
+#endif
+
+int Flu_SubStepPatchGroup( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                           const int NSub, const int NPG, const int (*NbIdx)[27],
+                           const real Flu_Old[][FLU_NIN][ CUBE(FLU_NXT) ], const real Flu_New[][FLU_NIN][ CUBE(FLU_NXT) ],
+                           const real BndFlux[][6][NFLUX_TOTAL][ SQR(PS2) ], const bool (*BndReplace)[6],
+                           real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ], real Flux_Sub[][9][NFLUX_TOTAL][ SQR(PS2) ] );
+void Flu_StorePatchGroup( const int lv, const int SaveSg_Flu, const int NPG, const int *PID0_List,
+                          const real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ] );
+
+// index of the boundary face b (in the order -x, +x, -y, +y, -z, +z) in the flux array of the fluid solver
+#define BND_FACE( b )   ( 3*((b)/2) + 2*((b)%2) )
+
+// maximum number of sub-steps before falling back to the level-wide retry
+#define NSUB_MAX        64
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RecordFailedPatchGroup
+// Description :  Record a patch group failed in the fluid solver together with its fluxes on the patch-group
+//                boundaries for AUTO_REDUCE_DT_LOCAL
+//
+// Note        :  1. Invoked by CorrectUnphysical() in Flu_Close.cpp, which may be inside an OpenMP parallel region
+//                2. The input fluxes must be the final fluxes used by StoreFlux() and CorrectFlux()
+//                   (i.e., after the 1st-order-flux correction of other cells in the same patch group)
+//                3. Patch groups beyond the capacity (FLU_GPU_NPGROUP) are only counted so that
+//                   Flu_RetryFailedPatchGroup() falls back to the level-wide retry
+//
+// Parameter   :  PID0 : Patch index with LocalID==0 of the failed patch group
+//                Flux : Flux array of the failed patch group returned by the fluid solver
+//-------------------------------------------------------------------------------------------------------
+void Flu_RecordFailedPatchGroup( const int PID0, const real Flux[][NFLUX_TOTAL][ SQR(PS2) ] )
+{
+
+   int Idx;
+
+#  pragma omp critical
+   Idx = FailPG_NPG ++;
+
+   if ( Idx >= FLU_GPU_NPGROUP )    return;
+
+   FailPG_PID0[Idx] = PID0;
+
+   for (int b=0; b<6; b++)    memcpy( FailPG_Flux[Idx][b], Flux[ BND_FACE(b) ], sizeof(FailPG_Flux[Idx][b]) );
+
+} // FUNCTION : Flu_RecordFailedPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RetryFailedPatchGroup
+// Description :  Re-advance only the patch groups failed in the fluid solver with sub-cycled smaller steps
+//                for AUTO_REDUCE_DT_LOCAL
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() when the fluid solver fails on this rank
+//                   --> Return GAMER_FAILED to fall back to the level-wide retry of AUTO_REDUCE_DT in EvolveLevel()
+//                2. The number of sub-steps starts from 2 and is doubled after each failure until it exceeds
+//                   1/AUTO_REDUCE_DT_FACTOR_MIN or NSUB_MAX
+//                3. Ghost zones at the intermediate times are linearly interpolated between the data at TimeOld
+//                   and TimeNew, except for the cells in the failed patch groups, which are advanced together
+//                   --> Fall back if any failed patch group is adjacent to a buffer patch, whose data at
+//                       TimeNew have not been exchanged yet
+//                4. The time-averaged fluxes on the patch-group boundaries are replaced by the fluxes of the
+//                   failed update, which the neighbouring patch groups have used and StoreFlux() and CorrectFlux()
+//                   have recorded
+//                   --> Conservative without modifying any other patch group or the coarse-fine flux registers
+//                   --> The fluxes inside the patch groups are updated by StoreFlux() for the flux fix-up
+//                5. OPT__CK_FLU_OUTPUT skips the patch groups updated after the failure in the same invocation of
+//                   the fluid solver
+//                   --> The retried patch groups are checked by Unphysical() here instead
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//
+// Return      :  GAMER_SUCCESS / GAMER_FAILED
+//-------------------------------------------------------------------------------------------------------
+int Flu_RetryFailedPatchGroup( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                               const int SaveSg_Flu )
+{
+
+   const int NPG = FailPG_NPG;
+
+// reset the counter for the next invocation
+   FailPG_NPG = 0;
+
+   if ( NPG > FLU_GPU_NPGROUP )  return GAMER_FAILED;
+
+
+// 1. find the failed patch groups adjacent to each failed patch group
+// --> NbIdx[][dz+1][dy+1][dx+1] = index of the adjacent failed patch group in FailPG_PID0[] (-1 --> none)
+   const int SibID_Array[3][3][3] = {  { {18, 10, 19}, {14,   4, 16}, {20, 11, 21} },
+                                       { { 6,  2,  7}, { 0,  26,  1}, { 8,  3,  9} },
+                                       { {22, 12, 23}, {15,   5, 17}, {24, 13, 25} }  };    // sibling indices
+   const int LocalID[2][2][2]     = { 0, 1, 2, 4, 3, 6, 5, 7 };
+
+   int (*NbIdx)[27] = new int [NPG][27];
+   bool Applicable  = true;
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int PID0 = FailPG_PID0[t];
+
+      for (int dz=-1; dz<=1; dz++)
+      for (int dy=-1; dy<=1; dy++)
+      for (int dx=-1; dx<=1; dx++)
+      {
+         const int Nb = ( (dz+1)*3 + (dy+1) )*3 + (dx+1);
+
+         NbIdx[t][Nb] = -1;
+
+         if ( dx == 0  &&  dy == 0  &&  dz == 0 )  continue;
+
+//       any patch of the patch group adjacent to the target direction works
+         const int PID    = PID0 + LocalID[ (dz==1)?1:0 ][ (dy==1)?1:0 ][ (dx==1)?1:0 ];
+         const int SibPID = amr->patch[0][lv][PID]->sibling[ SibID_Array[dz+1][dy+1][dx+1] ];
+
+//       ghost zones from the coarser level or the simulation boundaries are valid at both TimeOld and TimeNew
+         if ( SibPID < 0 )    continue;
+
+         if ( SibPID >= amr->NPatchComma[lv][1] )  Applicable = false;
+
+         const int SibPID0 = SibPID - SibPID%8;
+
+         for (int s=0; s<NPG; s++)
+            if ( FailPG_PID0[s] == SibPID0 )  {  NbIdx[t][Nb] = s;  break;  }
+      }
+   } // for (int t=0; t<NPG; t++)
+
+   if ( !Applicable )
+   {
+      delete [] NbIdx;
+
+      return GAMER_FAILED;
+   }
+
+
+// 2. prepare the input data at TimeOld and TimeNew
+// --> temporarily set the time of SaveSg_Flu to TimeNew since EvolveLevel() only sets it after success
+// --> the data of the failed patch groups at TimeNew are invalid and will be replaced in Flu_SubStepPatchGroup()
+   const bool   IntPhase_No        = false;
+   const real   MinDens_No         = -1.0;
+   const real   MinPres_No         = -1.0;
+   const bool   DE_Consistency_Yes = true;
+   const bool   DE_Consistency_No  = false;
+   const bool   DE_Consistency     = ( OPT__OPTIMIZE_AGGRESSIVE ) ? DE_Consistency_No : DE_Consistency_Yes;
+   const real   MinDens            = ( OPT__OPTIMIZE_AGGRESSIVE ) ? MinDens_No : MIN_DENS;
+   const double SaveSgTime         = amr->FluSgTime[lv][SaveSg_Flu];
+
+   real (*Flu_Old )[FLU_NIN ][ CUBE(FLU_NXT) ]   = new real [NPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real (*Flu_New )[FLU_NIN ][ CUBE(FLU_NXT) ]   = new real [NPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real (*Flu_Sub )[FLU_NOUT][ CUBE(PS2) ]       = new real [NPG][FLU_NOUT][ CUBE(PS2) ];
+   real (*Flux_Sub)[9][NFLUX_TOTAL][ SQR(PS2) ] = new real [NPG][9][NFLUX_TOTAL][ SQR(PS2) ];
+
+   Prepare_PatchData( lv, TimeOld, Flu_Old[0][0], NULL,
+                      FLU_GHOST_SIZE, NPG, FailPG_PID0, _TOTAL, _NONE,
+                      OPT__FLU_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                      OPT__BC_FLU, BC_POT_NONE, MinDens, MinPres_No, DE_Consistency );
+
+   amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
+
+   Prepare_PatchData( lv, TimeNew, Flu_New[0][0], NULL,
+                      FLU_GHOST_SIZE, NPG, FailPG_PID0, _TOTAL, _NONE,
+                      OPT__FLU_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                      OPT__BC_FLU, BC_POT_NONE, MinDens, MinPres_No, DE_Consistency );
+
+   amr->FluSgTime[lv][SaveSg_Flu] = SaveSgTime;
+
+
+// 3. advance the failed patch groups with an increasing number of sub-steps
+   int Status = GAMER_FAILED;
+   int NSub;
+
+   for (NSub=2; NSub<=NSUB_MAX  &&  1.0/NSub>=AUTO_REDUCE_DT_FACTOR_MIN; NSub*=2)
+   {
+      Status = Flu_SubStepPatchGroup( lv, TimeNew, TimeOld, dt, NSub, NPG, NbIdx, Flu_Old, Flu_New,
+                                      FailPG_Flux, NULL, Flu_Sub, Flux_Sub );
+
+      if ( Status == GAMER_SUCCESS )   break;
+   }
+
+
+// 4. store the results
+   if ( Status == GAMER_SUCCESS )
+   {
+//    update the coarse-grid fluxes inside the patch groups on the coarse-fine boundaries
+      StoreFlux( lv, Flux_Sub, NPG, FailPG_PID0, dt );
+
+      Flu_StorePatchGroup( lv, SaveSg_Flu, NPG, FailPG_PID0, Flu_Sub );
+
+      Aux_Message( stderr, "WARNING : fluid solver failed in %d patch group(s) (Rank %d, Lv %2d, counter %8ld) --> ",
+                   NPG, MPI_Rank, lv, AdvanceCounter[lv] );
+      Aux_Message( stderr, "retried them with %d sub-steps\n", NSub );
+   } // if ( Status == GAMER_SUCCESS )
+
+
+   delete [] NbIdx;
+   delete [] Flu_Old;
+   delete [] Flu_New;
+   delete [] Flu_Sub;
+   delete [] Flux_Sub;
+
+   return Status;
+
+} // FUNCTION : Flu_RetryFailedPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SubStepPatchGroup
+// Description :  Advance a list of patch groups by dt with NSub sub-steps and then replace the time-averaged
+//                fluxes on the patch-group boundaries by the given fluxes
+//
+// Note        :  1. Invoked by Flu_RetryFailedPatchGroup() and Flu_FrozenRegion_Advance()
+//                2. Use the host arrays of the fluid solver with ArrayID=0 as the working arrays, which are
+//                   free after InvokeSolver() returns
+//                3. Ghost zones are linearly interpolated in time between Flu_Old and Flu_New, except for the cells
+//                   in the adjacent patch groups of the same list, which are advanced together
+//                4. Replacing the boundary fluxes keeps the update conservative when the given fluxes are the ones
+//                   adopted by the neighbouring patch groups
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                NSub       : Number of sub-steps
+//                NPG        : Number of patch groups
+//                NbIdx      : Indices of the adjacent patch groups in the same list
+//                             --> NbIdx[][dz+1][dy+1][dx+1] (-1 --> none)
+//                Flu_Old    : Input fluid data at TimeOld
+//                Flu_New    : Input fluid data at TimeNew
+//                BndFlux    : Time-averaged fluxes to be adopted on the patch-group boundaries in the order
+//                             -x, +x, -y, +y, -z, +z
+//                BndReplace : Whether to replace the fluxes on each boundary (NULL --> all boundaries)
+//                Flu_Sub    : Array to store the updated fluid data
+//                Flux_Sub   : Array to store the time-averaged fluxes
+//
+// Return      :  GAMER_SUCCESS / GAMER_FAILED
+//-------------------------------------------------------------------------------------------------------
+int Flu_SubStepPatchGroup( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                           const int NSub, const int NPG, const int (*NbIdx)[27],
+                           const real Flu_Old[][FLU_NIN][ CUBE(FLU_NXT) ], const real Flu_New[][FLU_NIN][ CUBE(FLU_NXT) ],
+                           const real BndFlux[][6][NFLUX_TOTAL][ SQR(PS2) ], const bool (*BndReplace)[6],
+                           real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ], real Flux_Sub[][9][NFLUX_TOTAL][ SQR(PS2) ] )
+{
+
+#  ifdef GRAVITY
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const OptGravityType_t OPT__GRAVITY_TYPE = GRAVITY_NONE;
+   const bool JEANS_MIN_PRES     = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+#  ifndef DUAL_ENERGY
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+   char (*h_DE_Array_F_Out[2])[ CUBE(PS2) ] = { NULL, NULL };
+#  else
+   const bool   CorrPres_No        = false;
+#  endif
+
+   const bool   StoreFlux_Yes    = true;
+   const bool   StoreElectric_No = false;
+   const bool   FuseExtAcc_No    = false;
+   const bool   Flu_XYZ          = 1 - ( AdvanceCounter[lv]%2 );
+   const int    CheckMinEint     = 1;
+   const double dh               = amr->dh[lv];
+   const double dt_Sub           = dt/NSub;
+   const double dTime_Sub        = ( TimeNew - TimeOld )/NSub;
+   const real   dt_dh            = dt/dh;
+   const int    dim_map[3][2]    = { {1, 2}, {0, 2}, {0, 1} };
+
+   real (*Flu_In )[FLU_NIN ][ CUBE(FLU_NXT) ]   = h_Flu_Array_F_In [0];
+   real (*Flu_Out)[FLU_NOUT][ CUBE(PS2) ]       = h_Flu_Array_F_Out[0];
+   real (*Flux   )[9][NFLUX_TOTAL][ SQR(PS2) ] = h_Flux_Array     [0];
+
+   bool Fail = false;
+
+
+// initialize the data at TimeOld and the time-averaged fluxes
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<NPG; t++)
+   {
+      for (int v=0; v<FLU_NOUT; v++)
+      for (int k=0; k<PS2; k++)
+      for (int j=0; j<PS2; j++)
+         memcpy( Flu_Sub[t][v] + IDX321( 0, j, k, PS2, PS2 ),
+                 Flu_Old[t][v] + IDX321( FLU_GHOST_SIZE, j+FLU_GHOST_SIZE, k+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT ),
+                 PS2*sizeof(real) );
+
+      memset( Flux_Sub[t], 0, sizeof(Flux_Sub[t]) );
+   }
+
+
+   for (int s=0; s<NSub  &&  !Fail; s++)
+   {
+      const real Weight = (real)s/NSub;
+
+//    1. prepare the input array
+//       --> cells in the failed patch groups are taken from their current data; others are interpolated in time
+#     pragma omp parallel for schedule( runtime )
+      for (int t=0; t<NPG; t++)
+      for (int k=0; k<FLU_NXT; k++)
+      for (int j=0; j<FLU_NXT; j++)
+      for (int i=0; i<FLU_NXT; i++)
+      {
+         const int ii  = i - FLU_GHOST_SIZE;
+         const int jj  = j - FLU_GHOST_SIZE;
+         const int kk  = k - FLU_GHOST_SIZE;
+         const int dx  = ( ii < 0 ) ? -1 : ( ii >= PS2 ) ? 1 : 0;
+         const int dy  = ( jj < 0 ) ? -1 : ( jj >= PS2 ) ? 1 : 0;
+         const int dz  = ( kk < 0 ) ? -1 : ( kk >= PS2 ) ? 1 : 0;
+         const int Nb  = ( (dz+1)*3 + (dy+1) )*3 + (dx+1);
+         const int Src = ( Nb == 13 ) ? t : NbIdx[t][Nb];
+         const int idx = IDX321( i, j, k, FLU_NXT, FLU_NXT );
+
+         if ( Src >= 0 )
+         {
+            const int idx_src = IDX321( ii-dx*PS2, jj-dy*PS2, kk-dz*PS2, PS2, PS2 );
+
+            for (int v=0; v<FLU_NIN; v++)    Flu_In[t][v][idx] = Flu_Sub[Src][v][idx_src];
+         }
+
+         else
+         {
+            for (int v=0; v<FLU_NIN; v++)
+               Flu_In[t][v][idx] = ( (real)1.0 - Weight )*Flu_Old[t][v][idx] + Weight*Flu_New[t][v][idx];
+         }
+      } // t,k,j,i
+
+
+//    2. invoke the CPU fluid solver
+      CPU_FluidSolver( Flu_In, Flu_Out, NULL, NULL, h_DE_Array_F_Out[0], Flux, NULL, NULL, NULL,
+                       NPG, dt_Sub, dh, StoreFlux_Yes, StoreElectric_No, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
+                       NULL_REAL, NULL_REAL, NULL_BOOL,
+                       TimeOld+s*dTime_Sub, TimeOld+(s+1)*dTime_Sub, FuseExtAcc_No, OPT__GRAVITY_TYPE,
+                       MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
+                       OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff );
+
+
+//    3. check the results and accumulate the fluxes
+#     pragma omp parallel for reduction( ||:Fail ) schedule( runtime )
+      for (int t=0; t<NPG; t++)
+      {
+         real Cell[FLU_NOUT];
+
+         for (int idx=0; idx<CUBE(PS2); idx++)
+         {
+            for (int v=0; v<FLU_NOUT; v++)   Cell[v] = Flu_Out[t][v][idx];
+
+            if ( Unphysical(Cell, CheckMinEint, NULL_REAL) )   Fail = true;
+         }
+
+         memcpy( Flu_Sub[t], Flu_Out[t], sizeof(Flu_Out[t]) );
+
+         for (int f=0; f<9; f++)
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         for (int m=0; m<SQR(PS2); m++)
+            Flux_Sub[t][f][v][m] += Flux[t][f][v][m]/NSub;
+      }
+   } // for (int s=0; s<NSub  &&  !Fail; s++)
+
+   if ( Fail )    return GAMER_FAILED;
+
+
+// 4. replace the time-averaged fluxes on the patch-group boundaries by the given fluxes
+#  pragma omp parallel for reduction( ||:Fail ) schedule( runtime )
+   for (int t=0; t<NPG; t++)
+   {
+      int  ijk[3];
+      real Cell[FLU_NOUT];
+
+      for (int b=0; b<6; b++)
+      {
+         if ( BndReplace != NULL  &&  !BndReplace[t][b] )  continue;
+
+         const int  d    = b/2;
+         const real Coef = ( b%2 == 0 ) ? +dt_dh : -dt_dh;
+
+         ijk[d] = ( b%2 == 0 ) ? 0 : PS2-1;
+
+         for (int m=0; m<PS2; m++)
+         for (int n=0; n<PS2; n++)
+         {
+            ijk[ dim_map[d][1] ] = m;
+            ijk[ dim_map[d][0] ] = n;
+
+            const int idx = IDX321( ijk[0], ijk[1], ijk[2], PS2, PS2 );
+
+            for (int v=0; v<NFLUX_TOTAL; v++)
+            {
+               real *Flux_Bnd = Flux_Sub[t][ BND_FACE(b) ][v] + m*PS2 + n;
+
+               Flu_Sub[t][v][idx] += Coef*( BndFlux[t][b][v][ m*PS2 + n ] - *Flux_Bnd );
+               *Flux_Bnd           = BndFlux[t][b][v][ m*PS2 + n ];
+            }
+         }
+      } // for (int b=0; b<6; b++)
+
+//    check the corrected cells after applying the dual-energy formalism and the passive scalar floor
+      for (int k=0; k<PS2; k++)
+      for (int j=0; j<PS2; j++)
+      for (int i=0; i<PS2; i++)
+      {
+         if ( i > 0  &&  i < PS2-1  &&  j > 0  &&  j < PS2-1  &&  k > 0  &&  k < PS2-1 )   continue;
+
+         const int idx = IDX321( i, j, k, PS2, PS2 );
+
+         for (int v=0; v<FLU_NOUT; v++)   Cell[v] = Flu_Sub[t][v][idx];
+
+#        ifdef DUAL_ENERGY
+         Hydro_DualEnergyFix( Cell[DENS], Cell[MOMX], Cell[MOMY], Cell[MOMZ], Cell[ENGY], Cell[ENPY],
+                              h_DE_Array_F_Out[0][t][idx], EoS_AuxArray[1], EoS_AuxArray[2], CorrPres_No, NULL_REAL,
+                              DUAL_ENERGY_SWITCH, NULL_REAL );
+#        endif
+
+#        if ( NCOMP_PASSIVE > 0 )
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Cell[v] = FMAX( Cell[v], TINY_NUMBER );
+
+         if ( OPT__NORMALIZE_PASSIVE )
+            Hydro_NormalizePassive( Cell[DENS], Cell+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#        endif
+
+         if ( Unphysical(Cell, CheckMinEint, NULL_REAL) )   Fail = true;
+
+         for (int v=0; v<FLU_NOUT; v++)   Flu_Sub[t][v][idx] = Cell[v];
+      }
+   } // for (int t=0; t<NPG; t++)
+
+   return ( Fail ) ? GAMER_FAILED : GAMER_SUCCESS;
+
+} // FUNCTION : Flu_SubStepPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_StorePatchGroup
+// Description :  Store the fluid data of a list of patch groups advanced by Flu_SubStepPatchGroup()
+//
+// Note        :  1. Invoked by Flu_RetryFailedPatchGroup() and Flu_FrozenRegion_Advance()
+//                2. Also store the dual-energy status of the last sub-step and the by-products of Flu_Close()
+//                   for OPT__FLAG_FLU_BYPRODUCT and OPT__DT_FLU_BYPRODUCT
+//
+// Parameter   :  lv         : Target refinement level
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                NPG        : Number of patch groups
+//                PID0_List  : List recording the patch indices with LocalID==0 to be stored
+//                Flu_Sub    : Updated fluid data returned by Flu_SubStepPatchGroup()
+//-------------------------------------------------------------------------------------------------------
+void Flu_StorePatchGroup( const int lv, const int SaveSg_Flu, const int NPG, const int *PID0_List,
+                          const real Flu_Sub[][FLU_NOUT][ CUBE(PS2) ] )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<NPG; t++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int PID     = PID0_List[t] + LocalID;
+      const int Table_x = TABLE_02( LocalID, 'x', 0, PATCH_SIZE );
+      const int Table_y = TABLE_02( LocalID, 'y', 0, PATCH_SIZE );
+      const int Table_z = TABLE_02( LocalID, 'z', 0, PATCH_SIZE );
+
+      for (int v=0; v<FLU_NOUT; v++)
+      for (int k=0; k<PATCH_SIZE; k++)
+      for (int j=0; j<PATCH_SIZE; j++)
+         memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j],
+                 Flu_Sub[t][v] + IDX321( Table_x, Table_y+j, Table_z+k, PS2, PS2 ), PATCH_SIZE*sizeof(real) );
+
+//    the dual-energy status of the last sub-step
+#     ifdef DUAL_ENERGY
+      char DE_Uniform = h_DE_Array_F_Out[0][t][ IDX321( Table_x, Table_y, Table_z, PS2, PS2 ) ];
+
+      for (int k=0; k<PATCH_SIZE; k++)
+      for (int j=0; j<PATCH_SIZE; j++)
+      for (int i=0; i<PATCH_SIZE; i++)
+      {
+         const char DE_Status = h_DE_Array_F_Out[0][t][ IDX321( Table_x+i, Table_y+j, Table_z+k, PS2, PS2 ) ];
+
+         amr->patch[0][lv][PID]->de_status[k][j][i] = DE_Status;
+
+         if ( DE_Status != DE_Uniform )   DE_Uniform = DE_STATUS_MIXED;
+      }
+
+      amr->patch[0][lv][PID]->de_uniform = DE_Uniform;
+#     endif
+
+      if ( OPT__FLAG_FLU_BYPRODUCT  &&  lv < MAX_LEVEL )  Flag_RecordFlagMask( lv, PID, SaveSg_Flu );
+   } // for t, LocalID
+
+#  ifndef MHD
+   if ( OPT__DT_FLU_BYPRODUCT )  RecordMaxCFL( lv, Flu_Sub, NPG, PID0_List );
+#  endif
+
+} // FUNCTION : Flu_StorePatchGroup
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  !defined GPU )
@@ -39,7 +39,8 @@ void CUFLU_FluidSolver_MHM(
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff,
@@ -67,7 +68,8 @@ void CUFLU_FluidSolver_CTU(
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff,
@@ -402,7 +404,7 @@ void CUAPI_Asyn_FluidSolver( real h_Flu_Array_In[][FLU_NIN ][ CUBE(FLU_NXT) ],
               d_FC_Mag_Half     + UsedPatch[s],
               d_EC_Ele          + UsedPatch[s],
               dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff,
-              Time, GravityType, GPUExtAcc_Ptr, MinDens, MinPres, MinEint,
+              Time, NULL_REAL, false, GravityType, GPUExtAcc_Ptr, MinDens, MinPres, MinEint,
               DualEnergySwitch, NormPassive, NNorm, JeansMinPres, JeansMinPres_Coeff,
               EoS_DensEint2Pres_GPUPtr, EoS_DensPres2Eint_GPUPtr, EoS_DensPres2CSqr_GPUPtr );
 
@@ -425,7 +427,7 @@ void CUAPI_Asyn_FluidSolver( real h_Flu_Array_In[][FLU_NIN ][ CUBE(FLU_NXT) ],
               d_FC_Mag_Half     + UsedPatch[s],
               d_EC_Ele          + UsedPatch[s],
               dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff,
-              Time, GravityType, GPUExtAcc_Ptr, MinDens, MinPres, MinEint,
+              Time, NULL_REAL, false, GravityType, GPUExtAcc_Ptr, MinDens, MinPres, MinEint,
               DualEnergySwitch, NormPassive, NNorm, JeansMinPres, JeansMinPres_Coeff,
               EoS_DensEint2Pres_GPUPtr, EoS_DensPres2Eint_GPUPtr, EoS_DensPres2CSqr_GPUPtr );
 
@@ -3,6 +3,11 @@
 #ifdef SUPPORT_GRACKLE
 
 
+static void SolveStiffCells( grackle_field_data *Che_FieldData, code_units Che_Units, const int NCell, const int NCellPerRow,
+                             const real dt, const double ScreenTCool );
+
+
+
 
 
 //-----------------------------------------------------------------------------------------
@@ -11,15 +16,63 @@
 //                in the original Grackle library
 //
 // Note        :  1. Currently it is used even when GPU is enabled
+//                2. For ZeroCopy, Che_FieldData[] stores 8*NPatchGroup objects set by Grackle_Prepare(),
+//                   each of which points to the data of one patch
+//                   --> Different patches are advanced by different OpenMP threads, each of which
+//                       invokes local_solve_chemistry() with its own copies of the Grackle objects
+//                       "grackle_data", "grackle_rates", and "Che_Units" so that the UV background rates
+//                       updated by Grackle are not shared
+//                   --> Grackle's internal OpenMP parallelization is disabled for that
+//                   --> Record the wall-clock time of each patch in Cost[] if Cost != NULL
+//                3. For ScreenTCool > 0.0, only cells with |t_cool| < ScreenTCool*dt are sent to the Grackle solver
+//                   --> See SolveStiffCells()
 //
 // Parameter   :  Che_FieldData : Array of Grackle "grackle_field_data" objects
 //                Che_Units     : Grackle "code_units" object
 //                NPatchGroup   : Number of patch groups to be evaluated
 //                dt            : Time interval to advance solution
+//                ZeroCopy      : Invoke Grackle for each patch separately (for GRACKLE_ZERO_COPY)
+//                Cost          : Array to store the Grackle cost of each patch for ZeroCopy (for LB_INPUT__CHE_WEIGHT)
+//                                --> NULL : do not record the cost
+//                ScreenTCool   : Update cells with |t_cool| >= ScreenTCool*dt explicitly (for GRACKLE_SCREEN_TCOOL)
+//                                --> <= 0.0 : send all cells to the Grackle solver
 //-----------------------------------------------------------------------------------------
-void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt )
+void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt,
+                        const bool ZeroCopy, double *Cost, const double ScreenTCool )
 {
 
+// invoke Grackle for one patch at a time
+// --> use dynamic scheduling since the cost of Grackle varies significantly with the gas properties
+   if ( ZeroCopy )
+   {
+#     pragma omp parallel
+      {
+         chemistry_data         Chem_OneThread  = *grackle_data;
+         chemistry_data_storage Rates_OneThread = grackle_rates;
+         code_units             Units_OneThread = Che_Units;
+
+         Chem_OneThread.omp_nthreads = 1;
+
+#        pragma omp for schedule( dynamic, 1 )
+         for (int PID=0; PID<8*NPatchGroup; PID++)
+         {
+#           ifdef LOAD_BALANCE
+            const double Time_Start = ( Cost != NULL ) ? MPI_Wtime() : 0.0;
+#           endif
+
+            if (  local_solve_chemistry( &Chem_OneThread, &Rates_OneThread, &Units_OneThread, Che_FieldData+PID, dt ) == 0  )
+               Aux_Error( ERROR_INFO, "Grackle local_solve_chemistry() failed !!\n" );
+
+#           ifdef LOAD_BALANCE
+            if ( Cost != NULL )  Cost[PID] = MPI_Wtime() - Time_Start;
+#           endif
+         }
+      } // OpenMP parallel region
+
+      return;
+   } // if ( ZeroCopy )
+
+
 // set grid_dimension, grid_start, and grid_end
    const int OptFac = 16;  // optimization factor
    if ( SQR(PS2)%OptFac != 0 )   Aux_Error( ERROR_INFO, "SQR(PS2) %% OptFac != 0 !!\n" );
@@ -34,6 +87,14 @@ void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units,
       Che_FieldData->grid_end  [d] = Che_FieldData->grid_dimension[d] - 1;
    }
 
+// invoke Grackle only for the cells with short cooling time
+   if ( ScreenTCool > 0.0 )
+   {
+      SolveStiffCells( Che_FieldData, Che_Units, CUBE(PS2)*NPatchGroup, Che_FieldData->grid_dimension[0], dt, ScreenTCool );
+
+      return;
+   }
+
 // invoke Grackle
 // --> note that we use the OpenMP implementation in Grackle directly, which applies the parallelization to the first two
 //     dimensiones of the input grid
@@ -45,4 +106,116 @@ void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units,
 
 
 
+//-----------------------------------------------------------------------------------------
+// Function    :  SolveStiffCells
+// Description :  Update the cells with long cooling time explicitly and send only the remaining cells
+//                to the Grackle solver
+//
+// Note        :  1. Invoked by CPU_GrackleSolver()
+//                2. Only work for GRACKLE_PRIMORDIAL == GRACKLE_PRI_CHE_CLOUDY, for which the specific
+//                   internal energy is the only field updated by Grackle
+//                3. Cooling time is estimated by the Grackle function calculate_cooling_time(), which
+//                   interpolates the Cloudy tables without any sub-cycling
+//                   --> Cells with |t_cool| >= ScreenTCool*dt are updated by the forward Euler method
+//                       --> Relative change of the internal energy is at most 1/ScreenTCool
+//                   --> Cells are not skipped entirely since the cooling of many small steps can accumulate
+//                4. Remaining cells are compacted into a separate array before invoking solve_chemistry()
+//                   --> Pad the array by duplicating the last cell so that the grid has NCellPerRow cells per row
+//
+// Parameter   :  Che_FieldData : Grackle "grackle_field_data" object of all cells, whose grid dimension
+//                                has been set by CPU_GrackleSolver()
+//                Che_Units     : Grackle "code_units" object
+//                NCell         : Number of cells in Che_FieldData
+//                NCellPerRow   : Number of cells per row when invoking Grackle
+//                dt            : Time interval to advance solution
+//                ScreenTCool   : Threshold of |t_cool|/dt
+//-----------------------------------------------------------------------------------------
+void SolveStiffCells( grackle_field_data *Che_FieldData, code_units Che_Units, const int NCell, const int NCellPerRow,
+                      const real dt, const double ScreenTCool )
+{
+
+   real *sEint = Che_FieldData->internal_energy;
+   real *TCool = new real [NCell];
+   bool *Stiff = new bool [NCell];
+
+
+// 1. estimate the cooling time
+   if (  calculate_cooling_time( &Che_Units, Che_FieldData, TCool ) == 0  )
+      Aux_Error( ERROR_INFO, "Grackle calculate_cooling_time() failed !!\n" );
+
+
+// 2. update cells with long cooling time explicitly
+// --> t_cool < 0 for cooling
+#  pragma omp parallel for schedule( static )
+   for (int t=0; t<NCell; t++)
+   {
+      Stiff[t] = ( FABS(TCool[t]) < ScreenTCool*dt );
+
+      if ( !Stiff[t] )  sEint[t] += sEint[t]*dt/TCool[t];
+   }
+
+
+// 3. compact the remaining cells
+   int *StiffIdx = new int [NCell];
+   int  NStiff   = 0;
+
+   for (int t=0; t<NCell; t++)
+      if ( Stiff[t] )   StiffIdx[ NStiff ++ ] = t;
+
+   if ( NStiff > 0 )
+   {
+      const int NRow   = ( NStiff + NCellPerRow - 1 ) / NCellPerRow;
+      const int NPad   = NRow*NCellPerRow;
+      const int NField = ( GRACKLE_METAL ) ? 3 : 2;
+
+      real *Buf       = new real [ (long)NField*NPad ];
+      real *Buf_Dens  = Buf;
+      real *Buf_sEint = Buf + NPad;
+      real *Buf_Metal = ( GRACKLE_METAL ) ? Buf + 2*NPad : NULL;
+
+#     pragma omp parallel for schedule( static )
+      for (int t=0; t<NPad; t++)
+      {
+         const int idx = StiffIdx[ MIN(t, NStiff-1) ];
+
+         Buf_Dens [t] = Che_FieldData->density        [idx];
+         Buf_sEint[t] = sEint                         [idx];
+         if ( GRACKLE_METAL )
+         Buf_Metal[t] = Che_FieldData->metal_density  [idx];
+      }
+
+
+//    4. invoke Grackle for the compacted cells
+      int Dim[3]   = { NCellPerRow, 1, NRow };
+      int Start[3] = { 0, 0, 0 };
+      int End[3]   = { NCellPerRow-1, 0, NRow-1 };
+
+      grackle_field_data FieldData_Stiff = *Che_FieldData;
+
+      FieldData_Stiff.grid_dimension  = Dim;
+      FieldData_Stiff.grid_start      = Start;
+      FieldData_Stiff.grid_end        = End;
+      FieldData_Stiff.density         = Buf_Dens;
+      FieldData_Stiff.internal_energy = Buf_sEint;
+      FieldData_Stiff.metal_density   = Buf_Metal;
+
+      if (  solve_chemistry( &Che_Units, &FieldData_Stiff, dt ) == 0  )
+         Aux_Error( ERROR_INFO, "Grackle solve_chemistry() failed !!\n" );
+
+
+//    5. store the updated internal energy
+#     pragma omp parallel for schedule( static )
+      for (int t=0; t<NStiff; t++)  sEint[ StiffIdx[t] ] = Buf_sEint[t];
+
+      delete [] Buf;
+   } // if ( NStiff > 0 )
+
+   delete [] TCool;
+   delete [] Stiff;
+   delete [] StiffIdx;
+
+} // FUNCTION : SolveStiffCells
+
+
+
 #endif // #ifdef SUPPORT_GRACKLE
@@ -27,6 +27,9 @@ void End_MemFree_Grackle()
       h_Che_Array[t] = NULL;
    }
 
+   delete [] h_Che_Cost;
+   h_Che_Cost = NULL;
+
 } // FUNCTION : End_MemFree_Grackle
 
 
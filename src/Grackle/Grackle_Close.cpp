@@ -36,6 +36,11 @@ extern int CheIdx_Metal;
 //                       Grackle_AdvanceDt() in EvolveLevel()
 //                2. Che_NField and the corresponding array indices in h_Che_Array[] (e.g., CheIdx_Dens)
 //                   are declared and set by Init_MemAllocate_Grackle()
+//                3. For GRACKLE_ZERO_COPY, Grackle has already updated the chemical species in place
+//                   --> Only update the total energy, dual-energy variable, and electron density here
+//                   --> SaveSg must be the same as the FluSg used by Grackle_Prepare()
+//                4. Also store the Grackle cost of each patch recorded by CPU_GrackleSolver() in h_Che_Cost[]
+//                   to amr->patch[0][lv][PID]->Che_Cost (for LB_INPUT__CHE_WEIGHT only)
 //
 // Parameter   :  lv          : Target refinement level
 //                SaveSg      : Sandglass to store the updated data
@@ -49,6 +54,12 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
    const int  Size1pg      = CUBE(PS2);
    const int  Size1v       = NPG*Size1pg;
    const real MassRatio_ep = Const_me / Const_mp;
+   const bool ZeroCopy     = GRACKLE_ZERO_COPY;
+
+#  ifdef GAMER_DEBUG
+   if ( ZeroCopy  &&  SaveSg != amr->FluSg[lv] )
+      Aux_Error( ERROR_INFO, "SaveSg (%d) != FluSg (%d) for GRACKLE_ZERO_COPY !!\n", SaveSg, amr->FluSg[lv] );
+#  endif
 
    const real *Ptr_Dens0  = h_Che_Array + CheIdx_Dens *Size1v;
    const real *Ptr_sEint0 = h_Che_Array + CheIdx_sEint*Size1v;
@@ -111,12 +122,14 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
          idx_p = 0;
          fluid = amr->patch[SaveSg][lv][PID]->fluid;
 
+         if ( h_Che_Cost != NULL )  amr->patch[0][lv][PID]->Che_Cost = h_Che_Cost[ 8*TID + LocalID ];
+
          for (int k=0; k<PS1; k++)
          for (int j=0; j<PS1; j++)
          for (int i=0; i<PS1; i++)
          {
 //          apply internal energy floor
-            Dens = Ptr_Dens [idx_pg];
+            Dens = ( ZeroCopy ) ? *( fluid[DENS][0][0] + idx_p ) : Ptr_Dens[idx_pg];
             Eint = Ptr_sEint[idx_pg]*Dens;
             Eint = Hydro_CheckMinEint( Eint, MIN_EINT );
 
@@ -136,8 +149,18 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
 #           endif // #ifdef DUAL_ENERGY
 
 //          update all chemical species
-            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 )
             *( fluid[Idx_e    ][0][0] + idx_p ) = Ptr_e    [idx_pg] * MassRatio_ep;
+
+            if ( ZeroCopy )
+            {
+               idx_p  ++;
+               idx_pg ++;
+               continue;
+            }
+
+//          6-species network
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
             *( fluid[Idx_HI   ][0][0] + idx_p ) = Ptr_HI   [idx_pg];
             *( fluid[Idx_HII  ][0][0] + idx_p ) = Ptr_HII  [idx_pg];
             *( fluid[Idx_HeI  ][0][0] + idx_p ) = Ptr_HeI  [idx_pg];
@@ -11,6 +11,11 @@
 //
 // Note        :  1. Invoked by Grackle_Init()
 //                   --> "Che_FieldData" is freed by End_MemFree()
+//                2. For GRACKLE_ZERO_COPY, also initialize the "Che_FieldData_Patch" array with one object
+//                   per patch of CHE_GPU_NPGROUP patch groups
+//                   --> Each object covers one patch with grid_dimension = { CUBE(PS1), 1, 1 }
+//                   --> Field pointers are set by Grackle_Prepare() during each time-step
+//                   --> "Che_FieldData_Patch" is also freed by End_MemFree()
 //
 // Parameter   :  None
 //
@@ -77,6 +82,36 @@ void Grackle_Init_FieldData()
    Che_FieldData->RT_H2_dissociation_rate = NULL;
    Che_FieldData->RT_heating_rate         = NULL;
 
+
+// one object per patch for GRACKLE_ZERO_COPY
+// --> all objects share the same grid_dimension, grid_start, and grid_end arrays
+   if ( GRACKLE_ZERO_COPY )
+   {
+      const int NPatch = 8*CHE_GPU_NPGROUP;
+
+      Che_FieldData_Patch = new grackle_field_data [NPatch];
+
+      for (int t=0; t<NPatch; t++)  Che_FieldData_Patch[t] = *Che_FieldData;
+
+      Che_FieldData_Patch[0].grid_dimension = new int [NDim];
+      Che_FieldData_Patch[0].grid_start     = new int [NDim];
+      Che_FieldData_Patch[0].grid_end       = new int [NDim];
+
+      for (int d=0; d<NDim; d++)
+      {
+         Che_FieldData_Patch[0].grid_dimension[d] = ( d == 0 ) ? CUBE(PS1) : 1;
+         Che_FieldData_Patch[0].grid_start    [d] = 0;
+         Che_FieldData_Patch[0].grid_end      [d] = Che_FieldData_Patch[0].grid_dimension[d] - 1;
+      }
+
+      for (int t=1; t<NPatch; t++)
+      {
+         Che_FieldData_Patch[t].grid_dimension = Che_FieldData_Patch[0].grid_dimension;
+         Che_FieldData_Patch[t].grid_start     = Che_FieldData_Patch[0].grid_start;
+         Che_FieldData_Patch[t].grid_end       = Che_FieldData_Patch[0].grid_end;
+      }
+   } // if ( GRACKLE_ZERO_COPY )
+
 } // FUNCTION : Grackle_Init_FieldData
 
 
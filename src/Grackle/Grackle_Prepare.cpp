@@ -34,6 +34,12 @@ extern int CheIdx_Metal;
 //                   --> Che_NField and the corresponding array indices in h_Che_Array[] (e.g., CheIdx_Dens)
 //                       are declared and set by Init_MemAllocate_Grackle()
 //                2. This function always prepares the latest FluSg data
+//                3. For GRACKLE_ZERO_COPY, only the specific internal energy, non-thermal energy density, and
+//                   rescaled electron density are stored in h_Che_Array[]
+//                   --> Grackle accesses the mass density, all other chemical species, and metallicity of each
+//                       patch in place through the "Che_FieldData_Patch" objects set here
+//                   --> Grackle thus updates these species in FluSg directly, which must be the same as the
+//                       SaveSg passed to Grackle_Close()
 //
 // Parameter   :  lv          : Target refinement level
 //                h_Che_Array : Host array to store the prepared data
@@ -45,7 +51,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 
 // check
 #  ifdef GAMER_DEBUG
-   if ( CheIdx_Dens == Idx_Undefined )
+   if ( !GRACKLE_ZERO_COPY  &&  CheIdx_Dens == Idx_Undefined )
       Aux_Error( ERROR_INFO, "CheIdx_Dens is undefined !!\n" );
    if ( CheIdx_sEint == Idx_Undefined )
       Aux_Error( ERROR_INFO, "CheIdx_sEint is undefined !!\n" );
@@ -55,38 +61,38 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
    if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
       if (  Idx_e == Idx_Undefined  ||  CheIdx_e == Idx_Undefined  )
          Aux_Error( ERROR_INFO, "[Che]Idx_e is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
-      if (  Idx_HI == Idx_Undefined  ||  CheIdx_HI == Idx_Undefined  )
+      if (  Idx_HI == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HI == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HI is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
-      if (  Idx_HII == Idx_Undefined  ||  CheIdx_HII == Idx_Undefined  )
+      if (  Idx_HII == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HII == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HII is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
-      if (  Idx_HeI == Idx_Undefined  ||  CheIdx_HeI == Idx_Undefined  )
+      if (  Idx_HeI == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HeI == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HeI is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
-      if (  Idx_HeII == Idx_Undefined  ||  CheIdx_HeII == Idx_Undefined  )
+      if (  Idx_HeII == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HeII == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HeII is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
-      if (  Idx_HeIII == Idx_Undefined  ||  CheIdx_HeIII == Idx_Undefined  )
+      if (  Idx_HeIII == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HeIII == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HeIII is undefined for \"GRACKLE_PRI_CHE_NSPE6\" !!\n" );
    }
 
    if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE9 ) {
-      if (  Idx_HM == Idx_Undefined  ||  CheIdx_HM == Idx_Undefined  )
+      if (  Idx_HM == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HM == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HM is undefined for \"GRACKLE_PRI_CHE_NSPE9\" !!\n" );
-      if (  Idx_H2I == Idx_Undefined  ||  CheIdx_H2I == Idx_Undefined  )
+      if (  Idx_H2I == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_H2I == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_H2I is undefined for \"GRACKLE_PRI_CHE_NSPE9\" !!\n" );
-      if (  Idx_H2II == Idx_Undefined  ||  CheIdx_H2II == Idx_Undefined  )
+      if (  Idx_H2II == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_H2II == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_H2II is undefined for \"GRACKLE_PRI_CHE_NSPE9\" !!\n" );
    }
 
    if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE12 ) {
-      if (  Idx_DI == Idx_Undefined  ||  CheIdx_DI == Idx_Undefined  )
+      if (  Idx_DI == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_DI == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_DI is undefined for \"GRACKLE_PRI_CHE_NSPE12\" !!\n" );
-      if (  Idx_DII == Idx_Undefined  ||  CheIdx_DII == Idx_Undefined  )
+      if (  Idx_DII == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_DII == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_DII is undefined for \"GRACKLE_PRI_CHE_NSPE12\" !!\n" );
-      if (  Idx_HDI == Idx_Undefined  ||  CheIdx_HDI == Idx_Undefined  )
+      if (  Idx_HDI == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_HDI == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_HDI is undefined for \"GRACKLE_PRI_CHE_NSPE12\" !!\n" );
    }
 
    if ( GRACKLE_METAL ) {
-      if (  Idx_Metal == Idx_Undefined  ||  CheIdx_Metal == Idx_Undefined  )
+      if (  Idx_Metal == Idx_Undefined  ||  ( !GRACKLE_ZERO_COPY && CheIdx_Metal == Idx_Undefined )  )
          Aux_Error( ERROR_INFO, "[Che]Idx_Metal is undefined for \"GRACKLE_METAL\" !!\n" );
    }
 #  endif // #ifdef GAMER_DEBUG
@@ -95,6 +101,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
    const int  Size1pg          = CUBE(PS2);
    const int  Size1v           = NPG*Size1pg;
    const real MassRatio_pe    = Const_mp / Const_me;
+   const bool ZeroCopy         = GRACKLE_ZERO_COPY;
 #  ifdef DUAL_ENERGY
    const bool CheckMinPres_No  = false;
 #  else
@@ -196,13 +203,24 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 #           endif // #ifdef DUAL_ENERGY ... else
 
 //          mandatory fields
-            Ptr_Dens [idx_pg] = Dens;
             Ptr_sEint[idx_pg] = Eint / Dens;
             Ptr_Ent  [idx_pg] = Etot - Eint; // non-thermal energy density
 
+//          electron density must be rescaled even for GRACKLE_ZERO_COPY
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 )
+            Ptr_e    [idx_pg] = *( fluid[Idx_e    ][0][0] + idx_p ) * MassRatio_pe;
+
+            if ( ZeroCopy )
+            {
+               idx_p  ++;
+               idx_pg ++;
+               continue;
+            }
+
+            Ptr_Dens [idx_pg] = Dens;
+
 //          6-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
-            Ptr_e    [idx_pg] = *( fluid[Idx_e    ][0][0] + idx_p ) * MassRatio_pe;
             Ptr_HI   [idx_pg] = *( fluid[Idx_HI   ][0][0] + idx_p );
             Ptr_HII  [idx_pg] = *( fluid[Idx_HII  ][0][0] + idx_p );
             Ptr_HeI  [idx_pg] = *( fluid[Idx_HeI  ][0][0] + idx_p );
@@ -232,12 +250,50 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
             idx_pg ++;
          } // i,j,k
 
+//       link Grackle to the patch data directly
+         if ( ZeroCopy )
+         {
+            grackle_field_data *FieldData = Che_FieldData_Patch + 8*TID + LocalID;
+            const int           offset_p  = LocalID*CUBE(PS1);
+
+            FieldData->grid_dx         = amr->dh[lv];
+            FieldData->density         = fluid[DENS][0][0];
+            FieldData->internal_energy = Ptr_sEint + offset_p;
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
+            FieldData->e_density       = Ptr_e + offset_p;
+            FieldData->HI_density      = fluid[Idx_HI   ][0][0];
+            FieldData->HII_density     = fluid[Idx_HII  ][0][0];
+            FieldData->HeI_density     = fluid[Idx_HeI  ][0][0];
+            FieldData->HeII_density    = fluid[Idx_HeII ][0][0];
+            FieldData->HeIII_density   = fluid[Idx_HeIII][0][0];
+            }
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE9 ) {
+            FieldData->HM_density      = fluid[Idx_HM   ][0][0];
+            FieldData->H2I_density     = fluid[Idx_H2I  ][0][0];
+            FieldData->H2II_density    = fluid[Idx_H2II ][0][0];
+            }
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE12 ) {
+            FieldData->DI_density      = fluid[Idx_DI   ][0][0];
+            FieldData->DII_density     = fluid[Idx_DII  ][0][0];
+            FieldData->HDI_density     = fluid[Idx_HDI  ][0][0];
+            }
+
+            if ( GRACKLE_METAL )
+            FieldData->metal_density   = fluid[Idx_Metal][0][0];
+         } // if ( ZeroCopy )
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int TID=0; TID<NPG; TID++)
 
    } // end of OpenMP parallel region
 
 
+// field pointers of GRACKLE_ZERO_COPY have been set above
+   if ( ZeroCopy )   return;
+
+
 // set cell size and link pointers for different fields
    Che_FieldData->grid_dx         = amr->dh[lv];
 
@@ -35,6 +35,11 @@ int CheIdx_Metal = Idx_Undefined;
 //                2. Invoked by Init_MemAllocate()
 //                3. Also set global variables for accessing h_Che_Array[]
 //                   --> Declared on the top of this file
+//                4. For GRACKLE_ZERO_COPY, h_Che_Array[] only stores the fields that cannot be passed to Grackle
+//                   directly from the patch data (i.e., specific internal energy, non-thermal energy density,
+//                   and the rescaled electron density)
+//                   --> The array indices of all other fields remain Idx_Undefined
+//                5. Allocate h_Che_Cost[] to record the Grackle cost of each patch for LB_INPUT__CHE_WEIGHT
 //
 // Parameter   :  Che_NPG : Number of patch groups to be evaluated at a time
 //-------------------------------------------------------------------------------------------------------
@@ -48,6 +53,15 @@ void Init_MemAllocate_Grackle( const int Che_NPG )
 // set global variables related to h_Che_Array[]
    Che_NField   = 0;
 
+   if ( GRACKLE_ZERO_COPY ) {
+   CheIdx_sEint = Che_NField ++;
+   CheIdx_Ent   = Che_NField ++;
+
+   if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 )
+   CheIdx_e     = Che_NField ++;
+   }
+
+   else {
    CheIdx_Dens  = Che_NField ++;
    CheIdx_sEint = Che_NField ++;
    CheIdx_Ent   = Che_NField ++;
@@ -75,12 +89,18 @@ void Init_MemAllocate_Grackle( const int Che_NPG )
 
    if ( GRACKLE_METAL )
    CheIdx_Metal = Che_NField ++;
+   } // if ( GRACKLE_ZERO_COPY ) ... else ...
 
 
 // allocate the input/output array for the Grackle solver
    for (int t=0; t<2; t++)
       h_Che_Array[t] = new real [ (long)Che_NField*(long)Che_NPG*(long)CUBE(PS2) ];
 
+#  ifdef LOAD_BALANCE
+   if ( GRACKLE_ZERO_COPY  &&  LB_INPUT__CHE_WEIGHT > 0.0 )
+      h_Che_Cost = new double [ 8*Che_NPG ];
+#  endif
+
 } // FUNCTION : Init_MemAllocate_Grackle
 
 
@@ -10,6 +10,7 @@ extern void (*End_User_Ptr)();
 // Description :  Put everything you want to do before terminating the program right here
 //
 // Note        :  1. Function pointer "End_User_Ptr" may be set by a test problem initializer
+//                2. Wait for the asynchronous snapshot (OPT__OUTPUT_ASYNC) to be completed before terminating
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -19,7 +20,13 @@ void End_GAMER()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// wait for the asynchronous output to be completed
+#  ifdef SUPPORT_HDF5
+   Output_Async_Wait();
+#  endif
+
 #  ifdef TIMING
+   Aux_Trace_End();
    Aux_DeleteTimer();
 #  endif
 
@@ -22,6 +22,8 @@ void End_MemFree()
    {
 //    free particle variables first to avoid warning messages when deleting patches with particles
 #     ifdef PARTICLE
+      Par_CollectParticle2OneLevel_InvalidateCache();
+
       for (int lv=0; lv<NLEVEL; lv++)
       for (int PID=0; PID<amr->num[lv]; PID++)
       {
@@ -35,6 +37,9 @@ void End_MemFree()
       amr = NULL;
    }
 
+// release the patch arena after deleting all patches
+   if ( OPT__PATCH_ARENA )    Mis_PatchArena_End();
+
 
 // 2. BaseP
    if ( BaseP != NULL )
@@ -57,6 +62,12 @@ void End_MemFree()
 #     else
       End_MemFree_PoissonGravity();
 #     endif
+
+   delete [] ExtPotTable;  ExtPotTable = NULL;
+#  endif
+
+#  if ( MODEL == HYDRO  &&  EOS == EOS_TABULAR )
+   delete [] EoS_Table;    EoS_Table = NULL;
 #  endif
 
 #  ifdef SUPPORT_GRACKLE
@@ -69,6 +80,15 @@ void End_MemFree()
          delete Che_FieldData;
          Che_FieldData = NULL;
       }
+
+      if ( Che_FieldData_Patch != NULL )
+      {
+         delete [] Che_FieldData_Patch[0].grid_dimension;
+         delete [] Che_FieldData_Patch[0].grid_start;
+         delete [] Che_FieldData_Patch[0].grid_end;
+         delete [] Che_FieldData_Patch;
+         Che_FieldData_Patch = NULL;
+      }
    }
 #  endif
 
@@ -93,6 +113,10 @@ void End_MemFree()
 #  endif
 
 
+// 7. ghost-zone cache of Prepare_PatchData()
+   for (int lv=0; lv<NLEVEL; lv++)  Prepare_PatchData_FreeGhostCache( lv );
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
@@ -7,7 +7,7 @@
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 extern real (*h_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
 extern real (*h_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
+extern real_fc (*h_FC_Var)[6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
 extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
 #ifdef MHD
 extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
@@ -15,6 +15,11 @@ extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
 #endif
 #endif // FLU_SCHEME
 
+#if ( MODEL == HYDRO )
+extern int   *FailPG_PID0;
+extern real (*FailPG_Flux)[6][NFLUX_TOTAL][ SQR(PS2) ];
+#endif
+
 
 
 
@@ -62,6 +67,15 @@ void End_MemFree_Fluid()
 #  endif
 #  endif // FLU_SCHEME
 
+#  if ( MODEL == HYDRO )
+   delete [] FailPG_PID0;     FailPG_PID0   = NULL;
+   delete [] FailPG_Flux;     FailPG_Flux   = NULL;
+#  endif
+
+#  if ( MODEL == HYDRO  &&  !defined MHD  &&  !defined GPU )
+   Flu_FrozenRegion_End();
+#  endif
+
 } // FUNCTION : End_MemFree_Fluid
 
 
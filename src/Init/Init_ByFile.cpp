@@ -10,6 +10,9 @@ void (*Init_ByFile_User_Ptr)( real fluid_out[], const real fluid_in[], const int
                               const double x, const double y, const double z, const double Time,
                               const int lv, double AuxArray[] ) = Init_ByFile_Default;
 
+// maximum number of patch groups adjacent along x loaded together by Init_ByFile_AssignData()
+#define UM_IC_LOAD_MAX_NPG    64
+
 static void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const int UM_NVar, const int UM_LoadNRank,
                                     const UM_IC_Format_t UM_Format );
 
@@ -114,7 +117,10 @@ void Init_ByFile()
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
          amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
 
-      Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+      Mis_RadixSort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+//    the son directory at lv is no longer valid (see LB_FindSonNotHome())
+      amr->LB->ResetSonDir( lv );
 #     endif
 
 //    get the total number of real patches
@@ -136,11 +142,12 @@ void Init_ByFile()
    const double ParWeight_Zero   = 0.0;
    const bool   Redistribute_Yes = true;
    const bool   Redistribute_No  = false;
+   const bool   Incremental_No   = false;
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, Incremental_No, ParWeight_Zero, ResetLB_No, AllLv );
 
 #  else // for SERIAL
 
@@ -201,7 +208,7 @@ void Init_ByFile()
 // 5. optimize load-balancing to take into account particle weighting
 #  if ( defined PARTICLE  &&  defined LOAD_BALANCE )
    if ( amr->LB->Par_Weight > 0.0 )
-      LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+      LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
 #  endif
 
 
@@ -235,7 +242,7 @@ void Init_ByFile()
       Buf_GetBufferData( lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
                          _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
 
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1 );
+      LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, Par_Weight, ResetLB_Yes, lv+1 );
 #     endif
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
@@ -261,7 +268,7 @@ void Init_ByFile()
       Buf_GetBufferData( lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
                          _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
 
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1 );
+      LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, Par_Weight, ResetLB_Yes, lv+1 );
 #     endif
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
@@ -307,6 +314,11 @@ void Init_ByFile()
 //
 // Note        :  1. The function pointer Init_ByFile_User_Ptr() points to Init_ByFile_Default() by default
 //                   but may be overwritten by various test problem initializers
+//                2. Each rank only reads the data of its own real patches, which are already distributed along the
+//                   space-filling curve by Init_UniformGrid()
+//                3. Patch groups are sorted by their file offsets, and up to UM_IC_LOAD_MAX_NPG patch groups
+//                   adjacent along x are loaded together
+//                   --> Each fread() loads a row of NPG_Run*PS2 cells instead of PS2 cells
 //
 // Parameter   :  UM_Filename  : Target file name
 //                UM_lv        : Target AMR level
@@ -337,11 +349,31 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
    const int    scale        = amr->scale[UM_lv];
    const double dh           = amr->dh[UM_lv];
 
-   long   Offset3D_File0[3], Offset_File0, Offset_File, Offset_PG;
+   const int    NPG          = amr->NPatchComma[UM_lv][1] / 8;
+   const long   PG_Size      = (long)CUBE(PS2)*UM_NVar;
+
+   long   Offset_File0, Offset_File, Offset_PG, Offset_Run;
    real   fluid_in[UM_NVar], fluid_out[NCOMP_TOTAL];
    double x, y, z;
 
-   real *PG_Data = new real [ CUBE(PS2)*UM_NVar ];
+   real *Run_Data = new real [ UM_IC_LOAD_MAX_NPG*PG_Size ];
+   real *Row_Data = new real [ (long)UM_IC_LOAD_MAX_NPG*NVarPerLoad*PS2 ];
+
+
+// sort patch groups by their offsets in the file so that the patch groups adjacent along x can be loaded together
+// --> patch groups in the same rank are spatially compact thanks to the space-filling curve
+   long *PG_Offset = new long [NPG];
+   int  *PG_Order  = new int  [NPG];
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int *Corner = amr->patch[0][UM_lv][8*t]->corner;
+
+      PG_Offset[t] = IDX321( (long)Corner[0]/scale, (long)Corner[1]/scale, (long)Corner[2]/scale,
+                             UM_Size3D[0], UM_Size3D[1] );
+   }
+
+   Mis_RadixSort( NPG, PG_Offset, PG_Order );
 
 
 // load data with UM_LoadNRank ranks at a time
@@ -354,17 +386,21 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
 
          FILE *File = fopen( UM_Filename, "rb" );
 
-//       load one patch group at a time
-         for (int PID0=0; PID0<amr->NPatchComma[UM_lv][1]; PID0+=8)
+//       load a run of patch groups adjacent along x at a time
+         for (int t0=0; t0<NPG; )
          {
-//          calculate the file offset of the target patch group
-            for (int d=0; d<3; d++)    Offset3D_File0[d] = amr->patch[0][UM_lv][PID0]->corner[d] / scale;
+//          find the patch groups in this run
+            int NPG_Run = 1;
 
-            Offset_File0  = IDX321( Offset3D_File0[0], Offset3D_File0[1], Offset3D_File0[2], UM_Size3D[0], UM_Size3D[1] );
-            Offset_File0 *= (long)NVarPerLoad*sizeof(real);
+            while (  t0+NPG_Run < NPG  &&  NPG_Run < UM_IC_LOAD_MAX_NPG  &&
+                     PG_Offset[ t0+NPG_Run ] == PG_Offset[t0] + NPG_Run*PS2  &&
+                     PG_Offset[ t0+NPG_Run ] % UM_Size3D[0] != 0  )
+               NPG_Run ++;
 
+            Offset_File0 = PG_Offset[t0]*NVarPerLoad*sizeof(real);
 
-//          load data from the disk (one row at a time)
+
+//          load data from the disk (one row of the entire run at a time)
             Offset_PG = 0;
 
             for (int v=0; v<UM_NVar; v+=NVarPerLoad )
@@ -376,46 +412,59 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
                                 + v*UM_Size1v*sizeof(real);
 
                   fseek( File, Offset_File, SEEK_SET );
-                  fread( PG_Data+Offset_PG, sizeof(real), NVarPerLoad*PS2, File );
+                  fread( Row_Data, sizeof(real), (long)NVarPerLoad*PS2*NPG_Run, File );
 
 //                verify that the file size is not exceeded
                   if ( feof(File) )   Aux_Error( ERROR_INFO, "reaching the end of the file \"%s\" !!\n", UM_Filename );
 
+//                distribute the row to each patch group
+                  for (int r=0; r<NPG_Run; r++)
+                     memcpy( Run_Data + r*PG_Size + Offset_PG, Row_Data + (long)r*NVarPerLoad*PS2,
+                             NVarPerLoad*PS2*sizeof(real) );
+
                   Offset_PG += NVarPerLoad*PS2;
                }
             }
 
 
 //          copy data to each patch
-            for (int LocalID=0; LocalID<8; LocalID++)
+            for (int r=0; r<NPG_Run; r++)
             {
-               const int PID    = PID0 + LocalID;
-               const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
-               const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
-               const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+               const int   PID0    = 8*PG_Order[ t0+r ];
+               const real *PG_Data = Run_Data + r*PG_Size;
+
+               for (int LocalID=0; LocalID<8; LocalID++)
+               {
+                  const int PID    = PID0 + LocalID;
+                  const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
+                  const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
+                  const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+
+                  for (int k=0; k<PS1; k++)  {  z = amr->patch[0][UM_lv][PID]->EdgeL[2] + (k+0.5)*dh;
+                  for (int j=0; j<PS1; j++)  {  y = amr->patch[0][UM_lv][PID]->EdgeL[1] + (j+0.5)*dh;
+                  for (int i=0; i<PS1; i++)  {  x = amr->patch[0][UM_lv][PID]->EdgeL[0] + (i+0.5)*dh;
 
-               for (int k=0; k<PS1; k++)  {  z = amr->patch[0][UM_lv][PID]->EdgeL[2] + (k+0.5)*dh;
-               for (int j=0; j<PS1; j++)  {  y = amr->patch[0][UM_lv][PID]->EdgeL[1] + (j+0.5)*dh;
-               for (int i=0; i<PS1; i++)  {  x = amr->patch[0][UM_lv][PID]->EdgeL[0] + (i+0.5)*dh;
+                     Offset_Run = (long)NVarPerLoad*IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS2, PS2 );
 
-                  Offset_PG = (long)NVarPerLoad*IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS2, PS2 );
+                     if ( UM_Format == UM_IC_FORMAT_ZYXV )
+                        memcpy( fluid_in, PG_Data+Offset_Run, UM_NVar*sizeof(real) );
 
-                  if ( UM_Format == UM_IC_FORMAT_ZYXV )
-                     memcpy( fluid_in, PG_Data+Offset_PG, UM_NVar*sizeof(real) );
+                     else
+                     {
+                        for (int v=0; v<UM_NVar; v++)
+                           fluid_in[v] = *( PG_Data + Offset_Run + v*CUBE(PS2) );
+                     }
 
-                  else
-                  {
-                     for (int v=0; v<UM_NVar; v++)
-                        fluid_in[v] = *( PG_Data + Offset_PG + v*CUBE(PS2) );
-                  }
+                     Init_ByFile_User_Ptr( fluid_out, fluid_in, UM_NVar, x, y, z, Time[UM_lv], UM_lv, NULL );
 
-                  Init_ByFile_User_Ptr( fluid_out, fluid_in, UM_NVar, x, y, z, Time[UM_lv], UM_lv, NULL );
+                     for (int v=0; v<NCOMP_TOTAL; v++)
+                        amr->patch[ amr->FluSg[UM_lv] ][UM_lv][PID]->fluid[v][k][j][i] = fluid_out[v];
+                  }}}
+               } // for (int LocalID=0; LocalID<8; LocalID++)
+            } // for (int r=0; r<NPG_Run; r++)
 
-                  for (int v=0; v<NCOMP_TOTAL; v++)
-                     amr->patch[ amr->FluSg[UM_lv] ][UM_lv][PID]->fluid[v][k][j][i] = fluid_out[v];
-               }}}
-            } // for (int LocalID=0; LocalID<8; LocalID++)
-         } // for (int PID0=0; PID0<amr->NPatchComma[UM_lv][1]; PID0+=8)
+            t0 += NPG_Run;
+         } // for (int t0=0; t0<NPG; )
 
          fclose( File );
 
@@ -425,7 +474,10 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
       MPI_Barrier( MPI_COMM_WORLD );
    } // for (int TRank0=0; TRank0<MPI_NRank; TRank0+=UM_LoadNRank)
 
-   delete [] PG_Data;
+   delete [] Run_Data;
+   delete [] Row_Data;
+   delete [] PG_Offset;
+   delete [] PG_Order;
 
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data from the input file ... done\n" );
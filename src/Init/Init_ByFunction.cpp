@@ -10,6 +10,8 @@ void Init_ByFunction_AssignData( const int lv );
 // Description :  Set up the initial condition by invoking Init_ByFunction_AssignData()
 //
 // Note        :  1. Invoke the alternative function LB_Init_ByFunction() when LOAD_BALANCE is adopted
+//                2. Replace Flag_Real() by Init_RefineMap_Flag() when the refinement map is loaded for
+//                   OPT__INIT_REFINE_MAP
 //-------------------------------------------------------------------------------------------------------
 void Init_ByFunction()
 {
@@ -24,6 +26,10 @@ void Init_ByFunction()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// load the refinement map
+   const bool UseRefineMap = Init_RefineMap_Load();
+
+
 // construct levels 0 ~ NLEVEL-1
    for (int lv=0; lv<NLEVEL; lv++)
    {
@@ -38,7 +44,8 @@ void Init_ByFunction()
 
       if ( lv != TOP_LEVEL )
       {
-         Flag_Real( lv, USELB_NO );
+         if ( UseRefineMap )  Init_RefineMap_Flag( lv );
+         else                 Flag_Real( lv, USELB_NO );
 
          MPI_ExchangeBoundaryFlag( lv );
 
@@ -51,6 +58,8 @@ void Init_ByFunction()
 
    } // for (int lv=0; lv<NLEVEL; lv++)
 
+   if ( UseRefineMap )  Init_RefineMap_Free();
+
 
 // restrict all variables to be consistent with the finite volume scheme
    if ( OPT__INIT_RESTRICT )
@@ -18,6 +18,15 @@ static void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, co
                           const hid_t *H5_SetID_FCMag, const hid_t *H5_SpaceID_FCMag, const hid_t *H5_MemID_FCMag,
                           const int *NParList, real **ParBuf, long *NewParList, const hid_t *H5_SetID_ParData,
                           const hid_t H5_SpaceID_ParData, const long *GParID_Offset, const long NParThisRank );
+#ifdef LOAD_BALANCE
+static void LoadPatch_Bulk( const int lv, const int NLoad, const int *GIDList, const int (*CrList)[3],
+                            const hid_t *H5_SetID_Field, const hid_t H5_SpaceID_Field,
+                            const hid_t *H5_SetID_FCMag, const hid_t *H5_SpaceID_FCMag,
+                            const int *NParList, const hid_t *H5_SetID_ParData, const hid_t H5_SpaceID_ParData,
+                            const long *GParID_Offset, const long NParThisRank, const hid_t H5_DataXferPropList );
+static void LoadLBIdx_Distributed( const hid_t H5_SetID_LBIdx, const int lv, const int NPG_Total, const int GID_LvStart,
+                                   int *&LoadGID0, int &NLoadPG );
+#endif
 static void Check_Makefile ( const char *FileName, const int FormatVersion );
 static void Check_SymConst ( const char *FileName, const int FormatVersion );
 static void Check_InputPara( const char *FileName, const int FormatVersion );
@@ -33,6 +42,12 @@ static void ResetParameter( const char *FileName, double *EndT, long *EndStep );
 // Note        :  1. This function will be invoked by "Init_ByRestart" automatically if the restart file
 //                   is in the HDF5 format
 //                2. Only work for format version >= 2100 (PARTICLE only works for version >= 2200)
+//                3. For OPT__RESTART_BULK, each rank loads all its patches and particles at each level by a few
+//                   large reads (see LoadPatch_Bulk())
+//                   --> All ranks read at once with collective MPI-IO if HDF5 supports parallel I/O (i.e.,
+//                       H5_HAVE_PARALLEL). Otherwise RESTART_LOAD_NRANK ranks read at a time.
+//                4. For LOAD_BALANCE, the LBIdx table is sorted in parallel and no rank holds the global list
+//                   (see LoadLBIdx_Distributed())
 //
 // Parameter   :  FileName : Target file name
 //-------------------------------------------------------------------------------------------------------
@@ -175,6 +190,16 @@ void Init_ByRestart_HDF5( const char *FileName )
    LoadField( "Magnetohydrodynamics", &KeyInfo.Magnetohydrodynamics, H5_SetID_KeyInfo, H5_TypeID_KeyInfo,    Fatal, &Magnetohydrodynamics,  1,    Fatal );
 #  endif
 
+// the loaded LBIdx must be computed with the same space-filling curve
+// --> the Hilbert curve is always adopted for version < 2418
+#  ifdef LOAD_BALANCE
+   if ( KeyInfo.FormatVersion >= 2418 )
+   LoadField( "LBCurve",              &KeyInfo.LBCurve,              H5_SetID_KeyInfo, H5_TypeID_KeyInfo,    Fatal, &OPT__LB_CURVE,         1,    Fatal );
+   else if ( OPT__LB_CURVE != LB_CURVE_HILBERT )
+      Aux_Error( ERROR_INFO, "OPT__LB_CURVE (%d) != %d (Hilbert) is not supported for the data format version < 2418 !!\n",
+                 OPT__LB_CURVE, LB_CURVE_HILBERT );
+#  endif
+
    LoadField( "Step",                 &KeyInfo.Step,                 H5_SetID_KeyInfo, H5_TypeID_KeyInfo,    Fatal,  NullPtr,              -1, NonFatal );
    LoadField( "AdvanceCounter",        KeyInfo.AdvanceCounter,       H5_SetID_KeyInfo, H5_TypeID_KeyInfo,    Fatal,  NullPtr,              -1, NonFatal );
 #  ifdef PARTICLE
@@ -322,126 +347,30 @@ void Init_ByRestart_HDF5( const char *FileName )
 #  ifdef LOAD_BALANCE
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ...\n" );
 
-   long *LBIdxList_AllLv;
-   long *LBIdxList_EachLv         [NLEVEL];
-   int  *LBIdxList_EachLv_IdxTable[NLEVEL];
-   int   LoadIdx_Start[NLEVEL], LoadIdx_Stop[NLEVEL];
-
-// 2-2-1. allocate memory
-   LBIdxList_AllLv = new long [ NPatchAllLv ];
+   int  *LoadGID0[NLEVEL];
+   int   NLoadPG [NLEVEL];
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
-      if ( lv < KeyInfo.NLevel )
-      {
-         LBIdxList_EachLv         [lv] = LBIdxList_AllLv + GID_LvStart[lv];
-         LBIdxList_EachLv_IdxTable[lv] = new int [ NPatchTotal[lv] ];
-      }
-
-      else
-      {
-         LBIdxList_EachLv         [lv] = NULL;
-         LBIdxList_EachLv_IdxTable[lv] = NULL;
-      }
+      LoadGID0[lv] = NULL;
+      NLoadPG [lv] = 0;
    }
 
+#  if ( LOAD_BALANCE != HILBERT )
+   if ( NLvRescale != 1  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : please make sure that the patch LBIdx doesn't change when NLvRescale != 1 !!\n" );
+#  endif
 
-// 2-2-2. load LBIdx list (sorted by GID)
+// set the load-balance cut points and get the target patch groups of each rank level by level
+// --> no rank holds the global LBIdx list (see LoadLBIdx_Distributed())
    H5_SetID_LBIdx = H5Dopen( H5_FileID, "Tree/LBIdx", H5P_DEFAULT );
 
    if ( H5_SetID_LBIdx < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/LBIdx" );
 
-   H5_Status = H5Dread( H5_SetID_LBIdx, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, LBIdxList_AllLv );
-   H5_Status = H5Dclose( H5_SetID_LBIdx );
-
-
    for (int lv=0; lv<KeyInfo.NLevel; lv++)
-   {
-//    2-2-3. sort the LBIdx list at each level and set the load-balance cut points
-#     if ( LOAD_BALANCE != HILBERT )
-      if ( NLvRescale != 1 )
-      Aux_Message( stderr, "WARNING : please make sure that the patch LBIdx doesn't change when NLvRescale != 1 !!\n" );
-#     endif
-
-//    Mis_Heapsort must be called before LB_SetCutPoint in order to get LBIdxList_EachLv_IdxTable
-//    (since LB_SetCutPoint will sort LBIdxList_EachLv as well)
-//    --> Actually it's not necessary anymore since we now send LBIdx0_AllRank instead of LBIdxList_EachLv into LB_SetCutPoint()
-      Mis_Heapsort( NPatchTotal[lv], LBIdxList_EachLv[lv], LBIdxList_EachLv_IdxTable[lv] );
-
-//    prepare LBIdx and load-balance weighting of each **patch group** for LB_SetCutPoint()
-      const bool InputLBIdx0AndLoad_Yes = true;
-      long   *LBIdx0_AllRank = NULL;
-      double *Load_AllRank   = NULL;
-
-      if ( MPI_Rank == 0 )
-      {
-         LBIdx0_AllRank = new long   [ NPatchTotal[lv] / 8 ];
-         Load_AllRank   = new double [ NPatchTotal[lv] / 8 ];
-
-         for (int t=0; t<NPatchTotal[lv]/8; t++)
-         {
-            LBIdx0_AllRank[t]  = LBIdxList_EachLv[lv][t*8];
-            LBIdx0_AllRank[t] -= LBIdx0_AllRank[t] % 8;     // assuming LBIdxList_EachLv is NOT sorted yet
-            Load_AllRank  [t]  = 8.0;                       // assuming all patches have the same weighting == 1.0
-         }
-      }
-
-//    do NOT consider load-balance weighting of particles since at this point we don't have that information
-      const double ParWeight_Zero = 0.0;
-      LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
-                      ParWeight_Zero );
-
-//    free memory
-      if ( MPI_Rank == 0 )
-      {
-         delete [] LBIdx0_AllRank;
-         delete [] Load_AllRank;
-      }
-
-
-//    2-2-4. get the target LBIdx range of each rank
-      LoadIdx_Start[lv] = -1;    // -1 --> indicate that it has not been set
-      LoadIdx_Stop [lv] = -1;    // must be initialized as <= LoadIdx_Start[lv]
-
-//    skip levels with no patch (otherwise LoadIdx_Start and LoadIdx_Stop will be set incorrectly)
-      if ( NPatchTotal[lv] == 0 )   continue;
-
-      for (int t=0; t<NPatchTotal[lv]; t++)
-      {
-//       set LoadIdx_Start to "the first patch belonging to this rank"
-         if (  LoadIdx_Start[lv] == -1  &&  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) == MPI_Rank  )
-            LoadIdx_Start[lv] = t;
-
-//       set LoadIdx_Stop to "the last patch belonging to this rank + 1"
-         if ( LoadIdx_Start[lv] != -1 )
-         {
-            if (  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) > MPI_Rank  )
-            {
-               LoadIdx_Stop[lv] = t;
-               break;
-            }
+      LoadLBIdx_Distributed( H5_SetID_LBIdx, lv, NPatchTotal[lv]/8, GID_LvStart[lv], LoadGID0[lv], NLoadPG[lv] );
 
-//          rank owning the last patch needs to be treated separately
-            else if ( t == NPatchTotal[lv] - 1 )
-            {
-               LoadIdx_Stop[lv] = NPatchTotal[lv];
-               break;
-            }
-         }
-      }
-
-#     ifdef DEBUG_HDF5
-      if ( LoadIdx_Start[lv]%8 != 0  &&  LoadIdx_Start[lv] != -1 )
-         Aux_Error( ERROR_INFO, "LoadIdx_Start[%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Start[lv]%8 );
-
-      if ( LoadIdx_Stop [lv]%8 != 0  &&  LoadIdx_Stop[lv] != -1 )
-         Aux_Error( ERROR_INFO, "LoadIdx_Stop [%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Stop [lv]%8 );
-
-      if (  ( LoadIdx_Start[lv] == -1 && LoadIdx_Stop[lv] != -1 )  ||
-            ( LoadIdx_Start[lv] != -1 && LoadIdx_Stop[lv] == -1 )   )
-         Aux_Error( ERROR_INFO, "LoadIdx_Start/Stop[%d] = %d/%d !!\n", lv, LoadIdx_Start[lv], LoadIdx_Stop[lv] );
-#     endif
-   } // for (int lv=0; lv<KeyInfo.NLevel; lv++)
+   H5_Status = H5Dclose( H5_SetID_LBIdx );
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ... done\n" );
 
@@ -498,15 +427,9 @@ void Init_ByRestart_HDF5( const char *FileName )
    NParThisRank = 0;
 
    for (int lv=0; lv<KeyInfo.NLevel; lv++)
-   for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t++)
-   {
-#     ifdef DEBUG_HDF5
-      if ( t < 0  ||  t >= NPatchTotal[lv] )
-         Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
-#     endif
-
-      NParThisRank += NParList_AllLv[ LBIdxList_EachLv_IdxTable[lv][t] + GID_LvStart[lv] ];
-   }
+   for (int g=0; g<NLoadPG[lv]; g++)
+   for (int GID=LoadGID0[lv][g]; GID<LoadGID0[lv][g]+8; GID++)
+      NParThisRank += NParList_AllLv[GID];
 
 #  ifdef DEBUG_HDF5
    long NParAllRank;
@@ -661,13 +584,39 @@ void Init_ByRestart_HDF5( const char *FileName )
 #  endif
 
 
-// load data with RESTART_LOAD_NRANK ranks at a time
-   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+// set the file-access and data-transfer property lists for OPT__RESTART_BULK
+// --> all ranks read at once with collective MPI-IO if possible
+#  if ( defined LOAD_BALANCE  &&  defined H5_HAVE_PARALLEL )
+   const bool Collective = OPT__RESTART_BULK;
+#  else
+   const bool Collective = false;
+#  endif
+   const int  NLoadRank  = ( Collective ) ? MPI_NRank : RESTART_LOAD_NRANK;
+
+   hid_t H5_FileAccPropList  = H5P_DEFAULT;
+   hid_t H5_DataXferPropList = H5P_DEFAULT;
+
+#  ifdef H5_HAVE_PARALLEL
+   if ( Collective )
    {
-      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      H5_FileAccPropList  = H5Pcreate( H5P_FILE_ACCESS );
+      H5_Status           = H5Pset_fapl_mpio( H5_FileAccPropList, MPI_COMM_WORLD, MPI_INFO_NULL );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the MPI-IO file driver !!\n" );
+
+      H5_DataXferPropList = H5Pcreate( H5P_DATASET_XFER );
+      H5_Status           = H5Pset_dxpl_mpio( H5_DataXferPropList, H5FD_MPIO_COLLECTIVE );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the collective MPI-IO transfer mode !!\n" );
+   }
+#  endif
+
+
+// load data with NLoadRank ranks at a time
+   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
+   {
+      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
       {
 //       3-3. open the target datasets just once
-         H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+         H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5_FileAccPropList );
          if ( H5_FileID < 0 )
             Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
 
@@ -709,19 +658,40 @@ void Init_ByRestart_HDF5( const char *FileName )
          {
             if ( MPI_Rank == TRanks )
             Aux_Message( stdout, "      Loading ranks %4d -- %4d, lv %2d ... ",
-                         TRanks, MIN(TRanks+RESTART_LOAD_NRANK-1, MPI_NRank-1), lv );
+                         TRanks, MIN(TRanks+NLoadRank-1, MPI_NRank-1), lv );
+
+//          load all target patches at once
+            if ( OPT__RESTART_BULK )
+            {
+               const int NLoad = 8*NLoadPG[lv];
+               int *GIDList = new int [NLoad];
+
+               for (int g=0, i=0; g<NLoadPG[lv]; g++)
+               {
+                  GID0 = LoadGID0[lv][g];
+
+                  for (int GID=GID0; GID<GID0+8; GID++)  GIDList[ i ++ ] = GID;
+               }
+
+               LoadPatch_Bulk( lv, NLoad, GIDList, CrList_AllLv, H5_SetID_Field, H5_SpaceID_Field,
+                               H5_SetID_FCMag, H5_SpaceID_FCMag, NParList_AllLv, H5_SetID_ParData, H5_SpaceID_ParData,
+                               GParID_Offset, NParThisRank, H5_DataXferPropList );
+
+               delete [] GIDList;
+            }
 
 //          loop over all target LBIdx
-            for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t+=8)
+            else
+            for (int g=0; g<NLoadPG[lv]; g++)
             {
+//             make sure that we load patch from LocalID == 0
+               GID0 = LoadGID0[lv][g];
+
 #              ifdef DEBUG_HDF5
-               if ( t < 0  ||  t >= NPatchTotal[lv]  ||  t%8 != 0 )
-                 Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
+               if ( GID0 < GID_LvStart[lv]  ||  GID0 >= GID_LvStart[lv]+NPatchTotal[lv]  ||  (GID0-GID_LvStart[lv])%8 != 0 )
+                 Aux_Error( ERROR_INFO, "incorrect GID0 (%d) !!\n", GID0 );
 #              endif
 
-//             make sure that we load patch from LocalID == 0
-               GID0 = LBIdxList_EachLv_IdxTable[lv][t] - LBIdxList_EachLv_IdxTable[lv][t]%8 + GID_LvStart[lv];
-
                for (int GID=GID0; GID<GID0+8; GID++)
                   LoadOnePatch( H5_FileID, lv, GID, Recursive_No, NULL, CrList_AllLv,
                                 H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
@@ -800,10 +770,16 @@ void Init_ByRestart_HDF5( const char *FileName )
 #        endif
 
          H5_Status = H5Fclose( H5_FileID );
-      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
 
       MPI_Barrier( MPI_COMM_WORLD );
-   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
+
+   if ( Collective )
+   {
+      H5_Status = H5Pclose( H5_FileAccPropList );
+      H5_Status = H5Pclose( H5_DataXferPropList );
+   }
 
 // free HDF5 objects
    H5_Status = H5Sclose( H5_SpaceID_Field );
@@ -835,7 +811,10 @@ void Init_ByRestart_HDF5( const char *FileName )
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
          amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
 
-      Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+      Mis_RadixSort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+//    the son directory at lv is no longer valid (see LB_FindSonNotHome())
+      amr->LB->ResetSonDir( lv );
 #     endif
 
 //    get the total number of real patches at all ranks
@@ -877,8 +856,7 @@ void Init_ByRestart_HDF5( const char *FileName )
    delete [] FCMagName;
 #  endif
 #  ifdef LOAD_BALANCE
-   delete [] LBIdxList_AllLv;
-   for (int lv=0; lv<NLEVEL; lv++)  delete [] LBIdxList_EachLv_IdxTable[lv];
+   for (int lv=0; lv<NLEVEL; lv++)  delete [] LoadGID0[lv];
 #  else
    delete [] SonList_AllLv;
 #  endif
@@ -910,16 +888,17 @@ void Init_ByRestart_HDF5( const char *FileName )
    const double ParWeight_Zero   = 0.0;
    const bool   Redistribute_Yes = true;
    const bool   Redistribute_No  = false;
+   const bool   Incremental_No   = false;
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, Incremental_No, ParWeight_Zero, ResetLB_No, AllLv );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
 #  ifdef PARTICLE
    if ( amr->LB->Par_Weight > 0.0 )
-   LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+   LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
 #  endif
 
 
@@ -961,6 +940,15 @@ void Init_ByRestart_HDF5( const char *FileName )
 
    } // for (int lv=0; lv<NLEVEL; lv++)
 
+
+// initialize the descendant particle counts
+// --> must be done after FindFather() since the father <-> son relation is unknown when loading particles
+#  ifdef PARTICLE
+   for (int lv=1; lv<NLEVEL; lv++)
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      Par_UpdateDescendantCount( lv, PID, amr->patch[0][lv][PID]->NPar );
+#  endif
+
 #  endif // #ifdef LOAD_BALANCE ... else ...
 
 
@@ -1348,6 +1336,506 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 
 
 
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadPatch_Bulk
+// Description :  Allocate and load all target patches (and their particles if PARTICLE is on) at the target
+//                level by a few large reads
+//
+// Note        :  1. Invoked by Init_ByRestart_HDF5() for OPT__RESTART_BULK
+//                2. Patches are allocated in the order of GIDList[], which must store complete patch groups
+//                   (i.e., 8 consecutive GIDs starting from LocalID == 0)
+//                3. GIDs are sorted and merged into runs of consecutive GIDs, whose union is read by a single
+//                   H5Dread() call for each field, magnetic field component, and particle attribute
+//                   --> HDF5 returns the selected elements in the file order, and thus the I/O buffers are
+//                       ordered by GID
+//                4. Must be invoked by all ranks participating in the read, even if NLoad == 0, since
+//                   H5Dread() is collective for the collective MPI-IO transfer mode
+//
+// Parameter   :  lv                  : Target level
+//                NLoad               : Number of patches to be loaded
+//                GIDList             : List of target GIDs
+//                CrList              : List of patch corners
+//                H5_SetID_Field      : HDF5 dataset ID for cell-centered grid data
+//                H5_SpaceID_Field    : HDF5 dataset dataspace ID for cell-centered grid data
+//                H5_SetID_FCMag      : HDF5 dataset ID for face-centered magnetic field
+//                H5_SpaceID_FCMag    : HDF5 dataset dataspace ID for face-centered magnetic field
+//                NParList            : List of particle counts
+//                H5_SetID_ParData    : HDF5 dataset ID for particle data
+//                H5_SpaceID_ParData  : HDF5 dataset dataspace ID for particle data
+//                GParID_Offset       : Starting global particle indices for all patches
+//                NParThisRank        : Total number of particles in this rank (for check only)
+//                H5_DataXferPropList : HDF5 data-transfer property list
+//-------------------------------------------------------------------------------------------------------
+void LoadPatch_Bulk( const int lv, const int NLoad, const int *GIDList, const int (*CrList)[3],
+                     const hid_t *H5_SetID_Field, const hid_t H5_SpaceID_Field,
+                     const hid_t *H5_SetID_FCMag, const hid_t *H5_SpaceID_FCMag,
+                     const int *NParList, const hid_t *H5_SetID_ParData, const hid_t H5_SpaceID_ParData,
+                     const long *GParID_Offset, const long NParThisRank, const hid_t H5_DataXferPropList )
+{
+
+   const bool WithData_Yes = true;
+   const int  PID_Start    = amr->num[lv];
+
+   hsize_t H5_Count[4], H5_Offset[4], H5_MemDims[4];
+   hid_t   H5_MemID;
+   herr_t  H5_Status;
+
+
+// 1. allocate patches in the order of GIDList[]
+   for (int i=0; i<NLoad; i++)
+   {
+      const int GID = GIDList[i];
+
+      amr->pnew( lv, CrList[GID][0], CrList[GID][1], CrList[GID][2], -1, WithData_Yes, WithData_Yes, WithData_Yes );
+   }
+
+
+// 2. sort GIDs to match the file order
+// --> GIDSort[s] = GIDList[ IdxTable[s] ]
+   int *GIDSort  = new int [NLoad];
+   int *IdxTable = new int [NLoad];
+
+   memcpy( GIDSort, GIDList, NLoad*sizeof(int) );
+   Mis_Heapsort( NLoad, GIDSort, IdxTable );
+
+
+// 3. load cell-centered intrinsic variables
+// 3-1. select the union of all runs of consecutive GIDs
+   H5_Status = H5Sselect_none( H5_SpaceID_Field );
+
+   for (int s0=0, s1; s0<NLoad; s0=s1)
+   {
+      for (s1=s0+1; s1<NLoad; s1++)    if ( GIDSort[s1] != GIDSort[s1-1]+1 )  break;
+
+      H5_Offset[0] = GIDSort[s0];
+      H5_Count [0] = s1 - s0;
+      for (int t=1; t<4; t++)
+      {
+         H5_Offset[t] = 0;
+         H5_Count [t] = PS1;
+      }
+
+      H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_OR, H5_Offset, NULL, H5_Count, NULL );
+      if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
+   }
+
+   H5_MemDims[0] = NLoad;
+   for (int t=1; t<4; t++)    H5_MemDims[t] = PS1;
+
+   H5_MemID = H5Screate_simple( 4, H5_MemDims, NULL );
+   if ( H5_MemID < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID" );
+   if ( NLoad == 0 )    H5_Status = H5Sselect_none( H5_MemID );
+
+// 3-2. load one field at a time and distribute it to patches
+   real (*FieldBuf)[ CUBE(PS1) ] = new real [NLoad][ CUBE(PS1) ];
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL, H5_MemID, H5_SpaceID_Field, H5_DataXferPropList, FieldBuf );
+      if ( H5_Status < 0 )
+         Aux_Error( ERROR_INFO, "failed to load a field variable (lv %d, v %d) !!\n", lv, v );
+
+      for (int s=0; s<NLoad; s++)
+         memcpy( amr->patch[ amr->FluSg[lv] ][lv][ PID_Start+IdxTable[s] ]->fluid[v], FieldBuf[s], CUBE(PS1)*sizeof(real) );
+   }
+
+   delete [] FieldBuf;
+   H5_Status = H5Sclose( H5_MemID );
+
+
+// 4. load face-centered magnetic field
+#  ifdef MHD
+   real (*FCMagBuf)[ PS1P1*SQR(PS1) ] = new real [NLoad][ PS1P1*SQR(PS1) ];
+
+   for (int v=0; v<NCOMP_MAG; v++)
+   {
+      H5_Status = H5Sselect_none( H5_SpaceID_FCMag[v] );
+
+      for (int s0=0, s1; s0<NLoad; s0=s1)
+      {
+         for (s1=s0+1; s1<NLoad; s1++)    if ( GIDSort[s1] != GIDSort[s1-1]+1 )  break;
+
+         H5_Offset[0] = GIDSort[s0];
+         H5_Count [0] = s1 - s0;
+         for (int t=1; t<4; t++)
+         {
+            H5_Offset[t] = 0;
+            H5_Count [t] = ( 3-t == v ) ? PS1P1 : PS1;
+         }
+
+         H5_Status = H5Sselect_hyperslab( H5_SpaceID_FCMag[v], H5S_SELECT_OR, H5_Offset, NULL, H5_Count, NULL );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field %d !!\n", v );
+      }
+
+      H5_MemDims[0] = NLoad;
+      for (int t=1; t<4; t++)    H5_MemDims[t] = ( 3-t == v ) ? PS1P1 : PS1;
+
+      H5_MemID = H5Screate_simple( 4, H5_MemDims, NULL );
+      if ( H5_MemID < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID" );
+      if ( NLoad == 0 )    H5_Status = H5Sselect_none( H5_MemID );
+
+      H5_Status = H5Dread( H5_SetID_FCMag[v], H5T_GAMER_REAL, H5_MemID, H5_SpaceID_FCMag[v], H5_DataXferPropList, FCMagBuf );
+      if ( H5_Status < 0 )
+         Aux_Error( ERROR_INFO, "failed to load magnetic field (lv %d, v %d) !!\n", lv, v );
+
+      for (int s=0; s<NLoad; s++)
+         memcpy( amr->patch[ amr->MagSg[lv] ][lv][ PID_Start+IdxTable[s] ]->magnetic[v], FCMagBuf[s],
+                 PS1P1*SQR(PS1)*sizeof(real) );
+
+      H5_Status = H5Sclose( H5_MemID );
+   } // for (int v=0; v<NCOMP_MAG; v++)
+
+   delete [] FCMagBuf;
+#  endif // #ifdef MHD
+
+
+// 5. load particles
+#  ifdef PARTICLE
+// 5-1. get the starting index of the particles of each patch in the I/O buffer
+// --> particles of consecutive GIDs are also consecutive on disk
+   long  NParLoad    = 0;
+   long *ParBufStart = new long [NLoad];   // indexed by the position in GIDList[]
+
+   for (int s=0; s<NLoad; s++)
+   {
+      ParBufStart[ IdxTable[s] ]  = NParLoad;
+      NParLoad                   += NParList[ GIDSort[s] ];
+   }
+
+// 5-2. select the union of the particles of all runs of consecutive GIDs
+   hsize_t H5_Offset_ParData[1], H5_Count_ParData[1], H5_MemDims_ParData[1];
+
+   H5_Status = H5Sselect_none( H5_SpaceID_ParData );
+
+   for (int s0=0, s1; s0<NLoad; s0=s1)
+   {
+      long NParRun = NParList[ GIDSort[s0] ];
+
+      for (s1=s0+1; s1<NLoad; s1++)
+      {
+         if ( GIDSort[s1] != GIDSort[s1-1]+1 )  break;
+
+         NParRun += NParList[ GIDSort[s1] ];
+      }
+
+      if ( NParRun == 0 )  continue;
+
+      H5_Offset_ParData[0] = GParID_Offset[ GIDSort[s0] ];
+      H5_Count_ParData [0] = NParRun;
+
+      H5_Status = H5Sselect_hyperslab( H5_SpaceID_ParData, H5S_SELECT_OR, H5_Offset_ParData, NULL, H5_Count_ParData, NULL );
+      if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the particle data !!\n" );
+   }
+
+   H5_MemDims_ParData[0] = NParLoad;
+   H5_MemID = H5Screate_simple( 1, H5_MemDims_ParData, NULL );
+   if ( H5_MemID < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID" );
+   if ( NParLoad == 0 ) H5_Status = H5Sselect_none( H5_MemID );
+
+// 5-3. load all particle attributes
+   real **ParBuf = new real* [PAR_NATT_STORED];
+
+   for (int v=0; v<PAR_NATT_STORED; v++)
+   {
+      ParBuf[v] = new real [NParLoad];
+
+      H5_Status = H5Dread( H5_SetID_ParData[v], H5T_GAMER_REAL, H5_MemID, H5_SpaceID_ParData, H5_DataXferPropList, ParBuf[v] );
+      if ( H5_Status < 0 )
+         Aux_Error( ERROR_INFO, "failed to load a particle attribute (lv %d, v %d) !!\n", lv, v );
+   }
+
+   H5_Status = H5Sclose( H5_MemID );
+
+// 5-4. store particles to the particle repository and link them to their home patches
+   long *NewParList = NULL;
+   long  MaxNParInOnePatch = 0;
+   real  NewParAtt[PAR_NATT_TOTAL];
+
+   for (int i=0; i<NLoad; i++)   MaxNParInOnePatch = MAX( MaxNParInOnePatch, NParList[ GIDList[i] ] );
+
+   NewParList = new long [MaxNParInOnePatch];
+
+   NewParAtt[PAR_TIME] = Time[0];   // all particles are assumed to be synchronized with the base level
+
+   for (int i=0; i<NLoad; i++)
+   {
+      const int GID           = GIDList[i];
+      const int PID           = PID_Start + i;
+      const int NParThisPatch = NParList[GID];
+
+      if ( NParThisPatch == 0 )  continue;
+
+      for (int p=0; p<NParThisPatch; p++)
+      {
+//       skip the last PAR_NATT_UNSTORED attributes since we do not store them on disk
+         for (int v=0; v<PAR_NATT_STORED; v++)  NewParAtt[v] = ParBuf[v][ ParBufStart[i] + p ];
+
+         NewParList[p] = amr->Par->AddOneParticle( NewParAtt );
+
+//       check
+         if ( NewParList[p] >= NParThisRank )
+            Aux_Error( ERROR_INFO, "New particle ID (%ld) >= maximum allowed value (%ld) !!\n",
+                       NewParList[p], NParThisRank );
+      }
+
+#     ifdef DEBUG_PARTICLE
+      const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+      char Comment[MAX_STRING];
+      sprintf( Comment, "%s, lv %d, PID %d, GID %d, NPar %d", __FUNCTION__, lv, PID, GID, NParThisPatch );
+      amr->patch[0][lv][PID]->AddParticle( NParThisPatch, NewParList, &amr->Par->NPar_Lv[lv],
+                                           ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#     else
+      amr->patch[0][lv][PID]->AddParticle( NParThisPatch, NewParList, &amr->Par->NPar_Lv[lv] );
+#     endif
+
+      Par_UpdateDescendantCount( lv, PID, NParThisPatch );
+   } // for (int i=0; i<NLoad; i++)
+
+// 5-5. free resource
+   for (int v=0; v<PAR_NATT_STORED; v++)  delete [] ParBuf[v];
+   delete [] ParBuf;
+   delete [] ParBufStart;
+   delete [] NewParList;
+#  endif // #ifdef PARTICLE
+
+
+   delete [] GIDSort;
+   delete [] IdxTable;
+
+} // FUNCTION : LoadPatch_Bulk
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadLBIdx_Distributed
+// Description :  Set the load-balance cut points at the target level and return the patch groups to be
+//                loaded by this rank without constructing the global LBIdx list on any rank
+//
+// Note        :  1. Invoked by Init_ByRestart_HDF5()
+//                2. Procedure
+//                   (1) Each rank reads the LBIdx of the first patch in a contiguous chunk of ~NPG_Total/MPI_NRank
+//                       patch groups (sorted by GID)
+//                   (2) Sort all patch groups by LBIdx in parallel with a sample sort
+//                       --> After that, the patch groups of each rank are sorted and all LBIdx in rank r are
+//                           smaller than those in rank r+1, which is what LB_SetCutPoint() expects
+//                   (3) Set the cut points by LB_SetCutPoint() with the distributed lists
+//                   (4) Send each patch group to the rank owning it
+//                3. Memory consumption of each rank is O(NPG_Total/MPI_NRank) for a balanced sample sort,
+//                   independent of the number of ranks used to create the restart file
+//                4. Must be invoked by all ranks
+//
+// Parameter   :  H5_SetID_LBIdx : HDF5 dataset ID of "Tree/LBIdx"
+//                lv             : Target level
+//                NPG_Total      : Total number of patch groups at lv
+//                GID_LvStart    : GID of the first patch at lv
+//                LoadGID0       : GIDs of the first patch in the patch groups to be loaded by this rank
+//                                 --> Sorted by LBIdx
+//                                 --> Allocated here and must be freed by the caller
+//                NLoadPG        : Number of patch groups in LoadGID0[]
+//
+// Return      :  amr->LB->CutPoint[lv], LoadGID0, NLoadPG
+//-------------------------------------------------------------------------------------------------------
+void LoadLBIdx_Distributed( const hid_t H5_SetID_LBIdx, const int lv, const int NPG_Total, const int GID_LvStart,
+                            int *&LoadGID0, int &NLoadPG )
+{
+
+   const int NSample_Max = 16;   // maximum number of samples per rank for the sample sort
+
+   herr_t H5_Status;
+
+
+// 1. read the LBIdx of the first patch in each patch group of a contiguous GID chunk
+   const int PG_Start = (int)( (long)NPG_Total*(MPI_Rank  )/MPI_NRank );
+   const int PG_Stop  = (int)( (long)NPG_Total*(MPI_Rank+1)/MPI_NRank );
+   const int NPG_Read = PG_Stop - PG_Start;
+
+   long *Key_Read  = new long [NPG_Read];    // LBIdx of LocalID == 0
+   int  *GID0_Read = new int  [NPG_Read];
+
+   if ( NPG_Read > 0 )
+   {
+      const hsize_t H5_Offset = GID_LvStart + 8*PG_Start;
+      const hsize_t H5_Stride = 8;
+      const hsize_t H5_Count  = NPG_Read;
+
+      const hid_t H5_SpaceID_File = H5Dget_space( H5_SetID_LBIdx );
+      const hid_t H5_SpaceID_Mem  = H5Screate_simple( 1, &H5_Count, NULL );
+
+      H5_Status = H5Sselect_hyperslab( H5_SpaceID_File, H5S_SELECT_SET, &H5_Offset, &H5_Stride, &H5_Count, NULL );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to select the LBIdx of lv %d !!\n", lv );
+
+      H5_Status = H5Dread( H5_SetID_LBIdx, H5T_NATIVE_LONG, H5_SpaceID_Mem, H5_SpaceID_File, H5P_DEFAULT, Key_Read );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to load the LBIdx of lv %d !!\n", lv );
+
+      H5_Status = H5Sclose( H5_SpaceID_Mem );
+      H5_Status = H5Sclose( H5_SpaceID_File );
+   }
+
+   for (int g=0; g<NPG_Read; g++)
+   {
+      Key_Read [g] -= Key_Read[g] % 8;
+      GID0_Read[g]  = GID_LvStart + 8*( PG_Start + g );
+   }
+
+
+// 2. sample sort
+// 2-1. sort locally
+   int  *IdxTable  = new int  [NPG_Read];
+   int  *GID0_Sort = new int  [NPG_Read];
+
+   Mis_RadixSort( NPG_Read, Key_Read, IdxTable );
+
+   for (int g=0; g<NPG_Read; g++)   GID0_Sort[g] = GID0_Read[ IdxTable[g] ];
+
+   delete [] IdxTable;
+   delete [] GID0_Read;
+
+// 2-2. gather the regular samples of all ranks
+   const int NSample_ThisRank = MIN( NSample_Max, NPG_Read );
+
+   long *Sample_ThisRank = new long [NSample_ThisRank];
+   int  *NSample_EachRank = new int [MPI_NRank];
+   int  *Disp_EachRank    = new int [MPI_NRank];
+
+   for (int s=0; s<NSample_ThisRank; s++)
+      Sample_ThisRank[s] = Key_Read[ (int)( (long)s*NPG_Read/NSample_ThisRank ) ];
+
+   MPI_Allgather( &NSample_ThisRank, 1, MPI_INT, NSample_EachRank, 1, MPI_INT, MPI_COMM_WORLD );
+
+   int NSample_AllRank = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Disp_EachRank[r]  = NSample_AllRank;
+      NSample_AllRank  += NSample_EachRank[r];
+   }
+
+   long *Sample_AllRank = new long [NSample_AllRank];
+
+   MPI_Allgatherv( Sample_ThisRank, NSample_ThisRank, MPI_LONG, Sample_AllRank, NSample_EachRank, Disp_EachRank,
+                   MPI_LONG, MPI_COMM_WORLD );
+
+   Mis_RadixSort( NSample_AllRank, Sample_AllRank, (int*)NULL );
+
+// 2-3. send each patch group to the rank whose bucket contains its LBIdx
+// --> bucket r covers [ Sample_AllRank[r*NSample_AllRank/MPI_NRank], Sample_AllRank[(r+1)*NSample_AllRank/MPI_NRank] )
+//     except that the first and last buckets are unbounded
+   int *Send_NCount = new int [MPI_NRank];
+   int *Recv_NCount = new int [MPI_NRank];
+   int *Send_NDisp  = new int [MPI_NRank];
+   int *Recv_NDisp  = new int [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (int g=0, r=0; g<NPG_Read; g++)
+   {
+      while (  r < MPI_NRank-1  &&  Key_Read[g] >= Sample_AllRank[ (int)( (long)(r+1)*NSample_AllRank/MPI_NRank ) ]  )
+         r ++;
+
+      Send_NCount[r] ++;
+   }
+
+   MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   int NPG_Bucket = 0;
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+   for (int r=0; r<MPI_NRank; r++)  NPG_Bucket += Recv_NCount[r];
+
+   long *Key_Bucket  = new long [NPG_Bucket];
+   int  *GID0_Bucket = new int  [NPG_Bucket];
+
+   MPI_Alltoallv( Key_Read,  Send_NCount, Send_NDisp, MPI_LONG, Key_Bucket,  Recv_NCount, Recv_NDisp, MPI_LONG,
+                  MPI_COMM_WORLD );
+   MPI_Alltoallv( GID0_Sort, Send_NCount, Send_NDisp, MPI_INT,  GID0_Bucket, Recv_NCount, Recv_NDisp, MPI_INT,
+                  MPI_COMM_WORLD );
+
+   delete [] Key_Read;
+   delete [] GID0_Sort;
+   delete [] Sample_ThisRank;
+   delete [] Sample_AllRank;
+   delete [] NSample_EachRank;
+   delete [] Disp_EachRank;
+
+// 2-4. sort the received patch groups
+   IdxTable  = new int [NPG_Bucket];
+   GID0_Sort = new int [NPG_Bucket];
+
+   Mis_RadixSort( NPG_Bucket, Key_Bucket, IdxTable );
+
+   for (int g=0; g<NPG_Bucket; g++)    GID0_Sort[g] = GID0_Bucket[ IdxTable[g] ];
+
+   delete [] IdxTable;
+   delete [] GID0_Bucket;
+
+
+// 3. set the cut points
+// --> all patches are assumed to have the same weighting == 1.0
+// --> do NOT consider load-balance weighting of particles since at this point we don't have that information
+// --> LB_SetCutPoint() sorts Key_Bucket[] in place, which is a no-op here since the LBIdx are already sorted and unique
+   const bool   InputLBIdx0AndLoad_Yes = true;
+   const double ParWeight_Zero         = 0.0;
+   const bool   Incremental_No         = false;
+
+   double *Load_Bucket = new double [NPG_Bucket];
+
+   for (int g=0; g<NPG_Bucket; g++)    Load_Bucket[g] = 8.0;
+
+   LB_SetCutPoint( lv, NPG_Total, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, Key_Bucket, Load_Bucket,
+                   NPG_Bucket, ParWeight_Zero, Incremental_No );
+
+   delete [] Load_Bucket;
+
+
+// 4. send each patch group to the rank owning it
+// --> the target ranks are monotonically increasing since Key_Bucket[] is sorted
+// --> the received patch groups remain sorted by LBIdx since they arrive in the order of the source ranks
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (int g=0; g<NPG_Bucket; g++)    Send_NCount[ LB_Index2Rank( lv, Key_Bucket[g], CHECK_ON ) ] ++;
+
+   MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   NLoadPG = 0;
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+   for (int r=0; r<MPI_NRank; r++)  NLoadPG += Recv_NCount[r];
+
+   LoadGID0 = new int [NLoadPG];
+
+   MPI_Alltoallv( GID0_Sort, Send_NCount, Send_NDisp, MPI_INT, LoadGID0, Recv_NCount, Recv_NDisp, MPI_INT,
+                  MPI_COMM_WORLD );
+
+#  ifdef DEBUG_HDF5
+   long NLoadPG_AllRank, NLoadPG_ThisRank = NLoadPG;
+   MPI_Allreduce( &NLoadPG_ThisRank, &NLoadPG_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+   if ( NLoadPG_AllRank != NPG_Total )
+      Aux_Error( ERROR_INFO, "lv %d: total number of loaded patch groups (%ld) != expect (%d) !!\n",
+                 lv, NLoadPG_AllRank, NPG_Total );
+#  endif
+
+   delete [] Key_Bucket;
+   delete [] GID0_Sort;
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+
+} // FUNCTION : LoadLBIdx_Distributed
+#endif // #ifdef LOAD_BALANCE
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Check_Makefile
 // Description :  Load and compare the Makefile_t structure (runtime vs. restart file)
@@ -1402,6 +1890,7 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "Timing",                 &RS.Timing,                 SID, TID, NonFatal, &RT.Timing,                 1, NonFatal );
    LoadField( "TimingSolver",           &RS.TimingSolver,           SID, TID, NonFatal, &RT.TimingSolver,           1, NonFatal );
    LoadField( "Float8",                 &RS.Float8,                 SID, TID, NonFatal, &RT.Float8,                 1, NonFatal );
+   LoadField( "MixedPrecision",         &RS.MixedPrecision,         SID, TID, NonFatal, &RT.MixedPrecision,         1, NonFatal );
    LoadField( "Serial",                 &RS.Serial,                 SID, TID, NonFatal, &RT.Serial,                 1, NonFatal );
    LoadField( "LoadBalance",            &RS.LoadBalance,            SID, TID, NonFatal, &RT.LoadBalance,            1, NonFatal );
    LoadField( "OverlapMPI",             &RS.OverlapMPI,             SID, TID, NonFatal, &RT.OverlapMPI,             1, NonFatal );
@@ -1414,7 +1903,6 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "RandomNumber",           &RS.RandomNumber,           SID, TID, NonFatal, &RT.RandomNumber,           1, NonFatal );
 
    LoadField( "NLevel",                 &RS.NLevel,                 SID, TID, NonFatal, &RT.NLevel,                 1, NonFatal );
-   LoadField( "MaxPatch",               &RS.MaxPatch,               SID, TID, NonFatal, &RT.MaxPatch,               1, NonFatal );
 
 #  ifdef GRAVITY
    LoadField( "PotScheme",              &RS.PotScheme,              SID, TID, NonFatal, &RT.PotScheme,              1, NonFatal );
@@ -1711,6 +2199,18 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Par_PredictPos",          &RS.Par_PredictPos,          SID, TID, NonFatal, &RT.Par_PredictPos,           1, NonFatal );
    LoadField( "Par_RemoveCell",          &RS.Par_RemoveCell,          SID, TID, NonFatal, &RT.Par_RemoveCell,           1, NonFatal );
    LoadField( "Par_GhostSize",           &RS.Par_GhostSize,           SID, TID, NonFatal, &RT.Par_GhostSize,            1, NonFatal );
+   LoadField( "Par_SortInterval",        &RS.Par_SortInterval,        SID, TID, NonFatal, &RT.Par_SortInterval,         1, NonFatal );
+   LoadField( "Par_DepositNParThread",   &RS.Par_DepositNParThread,   SID, TID, NonFatal, &RT.Par_DepositNParThread,    1, NonFatal );
+   LoadField( "Par_CollectCache",        &RS.Par_CollectCache,        SID, TID, NonFatal, &RT.Par_CollectCache,         1, NonFatal );
+   LoadField( "Par_DensCache",           &RS.Par_DensCache,           SID, TID, NonFatal, &RT.Par_DensCache,            1, NonFatal );
+   LoadField( "Par_MaxSubCycle",         &RS.Par_MaxSubCycle,         SID, TID, NonFatal, &RT.Par_MaxSubCycle,          1, NonFatal );
+   LoadField( "Par_ShortRangeAcc",       &RS.Par_ShortRangeAcc,       SID, TID, NonFatal, &RT.Par_ShortRangeAcc,        1, NonFatal );
+   LoadField( "Par_SR_Soften",           &RS.Par_SR_Soften,           SID, TID, NonFatal, &RT.Par_SR_Soften,            1, NonFatal );
+   LoadField( "Par_SR_Radius",           &RS.Par_SR_Radius,           SID, TID, NonFatal, &RT.Par_SR_Radius,            1, NonFatal );
+   LoadField( "Par_FreezeFluRatio",      &RS.Par_FreezeFluRatio,      SID, TID, NonFatal, &RT.Par_FreezeFluRatio,       1, NonFatal );
+#  ifdef LOAD_BALANCE
+   LoadField( "Par_CompressMPI",         &RS.Par_CompressMPI,         SID, TID, NonFatal, &RT.Par_CompressMPI,          1, NonFatal );
+#  endif
 #  endif
 
 // cosmology
@@ -1742,14 +2242,24 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Dt__SyncChildrenLv",      &RS.Dt__SyncChildrenLv,      SID, TID, NonFatal, &RT.Dt__SyncChildrenLv,       1, NonFatal );
    LoadField( "Opt__DtUser",             &RS.Opt__DtUser,             SID, TID, NonFatal, &RT.Opt__DtUser,              1, NonFatal );
    LoadField( "Opt__DtLevel",            &RS.Opt__DtLevel,            SID, TID, NonFatal, &RT.Opt__DtLevel,             1, NonFatal );
+   LoadField( "Opt__DtOptSubStep",       &RS.Opt__DtOptSubStep,       SID, TID, NonFatal, &RT.Opt__DtOptSubStep,        1, NonFatal );
+   LoadField( "Dt__SubStepOverhead",     &RS.Dt__SubStepOverhead,     SID, TID, NonFatal, &RT.Dt__SubStepOverhead,      1, NonFatal );
    LoadField( "Opt__RecordDt",           &RS.Opt__RecordDt,           SID, TID, NonFatal, &RT.Opt__RecordDt,            1, NonFatal );
    LoadField( "AutoReduceDt",            &RS.AutoReduceDt,            SID, TID, NonFatal, &RT.AutoReduceDt,             1, NonFatal );
    LoadField( "AutoReduceDtFactor",      &RS.AutoReduceDtFactor,      SID, TID, NonFatal, &RT.AutoReduceDtFactor,       1, NonFatal );
    LoadField( "AutoReduceDtFactorMin",   &RS.AutoReduceDtFactorMin,   SID, TID, NonFatal, &RT.AutoReduceDtFactorMin,    1, NonFatal );
+#  if ( MODEL == HYDRO )
+   LoadField( "Opt__DtFluByproduct",     &RS.Opt__DtFluByproduct,     SID, TID, NonFatal, &RT.Opt__DtFluByproduct,      1, NonFatal );
+   LoadField( "AutoReduceDtLocal",       &RS.AutoReduceDtLocal,       SID, TID, NonFatal, &RT.AutoReduceDtLocal,        1, NonFatal );
+   LoadField( "Opt__FrozenRegion",       &RS.Opt__FrozenRegion,       SID, TID, NonFatal, &RT.Opt__FrozenRegion,        1, NonFatal );
+   LoadField( "FrozenRegion_NStep",      &RS.FrozenRegion_NStep,      SID, TID, NonFatal, &RT.FrozenRegion_NStep,       1, NonFatal );
+   LoadField( "FrozenRegion_Tol",        &RS.FrozenRegion_Tol,        SID, TID, NonFatal, &RT.FrozenRegion_Tol,         1, NonFatal );
+#  endif
 
 
 // domain refinement
    LoadField( "RegridCount",             &RS.RegridCount,             SID, TID, NonFatal, &RT.RegridCount,              1, NonFatal );
+   LoadField( "Opt__RegridLazy",         &RS.Opt__RegridLazy,         SID, TID, NonFatal, &RT.Opt__RegridLazy,          1, NonFatal );
    LoadField( "FlagBufferSize",          &RS.FlagBufferSize,          SID, TID, NonFatal, &RT.FlagBufferSize,           1, NonFatal );
    LoadField( "FlagBufferSizeMaxM1Lv",   &RS.FlagBufferSizeMaxM1Lv,   SID, TID, NonFatal, &RT.FlagBufferSizeMaxM1Lv,    1, NonFatal );
    LoadField( "FlagBufferSizeMaxM2Lv",   &RS.FlagBufferSizeMaxM2Lv,   SID, TID, NonFatal, &RT.FlagBufferSizeMaxM2Lv,    1, NonFatal );
@@ -1776,6 +2286,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Flag_LohnerForm",    &RS.Opt__Flag_LohnerForm,    SID, TID, NonFatal, &RT.Opt__Flag_LohnerForm,     1, NonFatal );
    LoadField( "Opt__Flag_User",          &RS.Opt__Flag_User,          SID, TID, NonFatal, &RT.Opt__Flag_User,           1, NonFatal );
    LoadField( "Opt__Flag_Region",        &RS.Opt__Flag_Region,        SID, TID, NonFatal, &RT.Opt__Flag_Region,         1, NonFatal );
+   LoadField( "Opt__Flag_FluByproduct",  &RS.Opt__Flag_FluByproduct,  SID, TID, NonFatal, &RT.Opt__Flag_FluByproduct,   1, NonFatal );
 #  ifdef PARTICLE
    LoadField( "Opt__Flag_NParPatch",     &RS.Opt__Flag_NParPatch,     SID, TID, NonFatal, &RT.Opt__Flag_NParPatch,      1, NonFatal );
    LoadField( "Opt__Flag_NParCell",      &RS.Opt__Flag_NParCell,      SID, TID, NonFatal, &RT.Opt__Flag_NParCell,       1, NonFatal );
@@ -1788,6 +2299,9 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__ReuseMemory",        &RS.Opt__ReuseMemory,        SID, TID, NonFatal, &RT.Opt__ReuseMemory,         1, NonFatal );
    LoadField( "Opt__MemoryPool",         &RS.Opt__MemoryPool,         SID, TID, NonFatal, &RT.Opt__MemoryPool,          1, NonFatal );
+   LoadField( "Opt__PatchArena",         &RS.Opt__PatchArena,         SID, TID, NonFatal, &RT.Opt__PatchArena,          1, NonFatal );
+   LoadField( "Opt__FirstTouch",         &RS.Opt__FirstTouch,         SID, TID, NonFatal, &RT.Opt__FirstTouch,          1, NonFatal );
+   LoadField( "Opt__SG_OnDemand",        &RS.Opt__SG_OnDemand,        SID, TID, NonFatal, &RT.Opt__SG_OnDemand,         1, NonFatal );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -1796,6 +2310,15 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "LB_Par_Weight",           &RS.LB_Par_Weight,           SID, TID, NonFatal, &RT.LB_Par_Weight,            1, NonFatal );
 #  endif
    LoadField( "Opt__RecordLoadBalance",  &RS.Opt__RecordLoadBalance,  SID, TID, NonFatal, &RT.Opt__RecordLoadBalance,   1, NonFatal );
+   LoadField( "LB_MeasuredCost",         &RS.LB_MeasuredCost,         SID, TID, NonFatal, &RT.LB_MeasuredCost,          1, NonFatal );
+#  ifdef SUPPORT_GRACKLE
+   LoadField( "LB_Che_Weight",           &RS.LB_Che_Weight,           SID, TID, NonFatal, &RT.LB_Che_Weight,            1, NonFatal );
+#  endif
+   LoadField( "Opt__LB_Incremental",     &RS.Opt__LB_Incremental,     SID, TID, NonFatal, &RT.Opt__LB_Incremental,      1, NonFatal );
+   LoadField( "Opt__LB_CoupleLevel",     &RS.Opt__LB_CoupleLevel,     SID, TID, NonFatal, &RT.Opt__LB_CoupleLevel,      1, NonFatal );
+   LoadField( "Opt__LB_DerivedType",     &RS.Opt__LB_DerivedType,     SID, TID, NonFatal, &RT.Opt__LB_DerivedType,      1, NonFatal );
+   LoadField( "Opt__LB_DistGraph",       &RS.Opt__LB_DistGraph,       SID, TID, NonFatal, &RT.Opt__LB_DistGraph,        1, NonFatal );
+   LoadField( "Opt__MPI_Progress",       &RS.Opt__MPI_Progress,       SID, TID, NonFatal, &RT.Opt__MPI_Progress,        1, NonFatal );
 #  endif
    LoadField( "Opt__MinimizeMPIBarrier", &RS.Opt__MinimizeMPIBarrier, SID, TID, NonFatal, &RT.Opt__MinimizeMPIBarrier,  1, NonFatal );
 
@@ -1804,6 +2327,9 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Gamma",                   &RS.Gamma,                   SID, TID, NonFatal, &RT.Gamma,                    1, NonFatal );
    LoadField( "MolecularWeight",         &RS.MolecularWeight,         SID, TID, NonFatal, &RT.MolecularWeight,          1, NonFatal );
    LoadField( "IsoTemp",                 &RS.IsoTemp,                 SID, TID, NonFatal, &RT.IsoTemp,                  1, NonFatal );
+#  if ( EOS == EOS_TABULAR )
+   LoadField( "EoS_TableName",            RS.EoS_TableName,           SID, TID, NonFatal,  RT.EoS_TableName,            1, NonFatal );
+#  endif
    LoadField( "MinMod_Coeff",            &RS.MinMod_Coeff,            SID, TID, NonFatal, &RT.MinMod_Coeff,             1, NonFatal );
    LoadField( "Opt__LR_Limiter",         &RS.Opt__LR_Limiter,         SID, TID, NonFatal, &RT.Opt__LR_Limiter,          1, NonFatal );
    LoadField( "Opt__1stFluxCorr",        &RS.Opt__1stFluxCorr,        SID, TID, NonFatal, &RT.Opt__1stFluxCorr,         1, NonFatal );
@@ -1824,6 +2350,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 // fluid solvers in both HYDRO/ELBDM
    LoadField( "Flu_GPU_NPGroup",         &RS.Flu_GPU_NPGroup,         SID, TID, NonFatal, &RT.Flu_GPU_NPGroup,          1, NonFatal );
    LoadField( "GPU_NStream",             &RS.GPU_NStream,             SID, TID, NonFatal, &RT.GPU_NStream,              1, NonFatal );
+   LoadField( "Opt__AdaptiveNPGroup",    &RS.Opt__AdaptiveNPGroup,    SID, TID, NonFatal, &RT.Opt__AdaptiveNPGroup,     1, NonFatal );
    LoadField( "Opt__FixUp_Flux",         &RS.Opt__FixUp_Flux,         SID, TID, NonFatal, &RT.Opt__FixUp_Flux,          1, NonFatal );
 #  ifdef MHD
    LoadField( "Opt__FixUp_Electric",     &RS.Opt__FixUp_Electric,     SID, TID, NonFatal, &RT.Opt__FixUp_Electric,      1, NonFatal );
@@ -1857,6 +2384,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "SOR_Omega",               &RS.SOR_Omega,               SID, TID, NonFatal, &RT.SOR_Omega,                1, NonFatal );
    LoadField( "SOR_MaxIter",             &RS.SOR_MaxIter,             SID, TID, NonFatal, &RT.SOR_MaxIter,              1, NonFatal );
    LoadField( "SOR_MinIter",             &RS.SOR_MinIter,             SID, TID, NonFatal, &RT.SOR_MinIter,              1, NonFatal );
+   LoadField( "SOR_ToleratedError",      &RS.SOR_ToleratedError,      SID, TID, NonFatal, &RT.SOR_ToleratedError,       1, NonFatal );
 #  elif ( POT_SCHEME == MG )
    LoadField( "MG_MaxIter",              &RS.MG_MaxIter,              SID, TID, NonFatal, &RT.MG_MaxIter,               1, NonFatal );
    LoadField( "MG_NPreSmooth",           &RS.MG_NPreSmooth,           SID, TID, NonFatal, &RT.MG_NPreSmooth,            1, NonFatal );
@@ -1867,7 +2395,21 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__GraP5Gradient",      &RS.Opt__GraP5Gradient,      SID, TID, NonFatal, &RT.Opt__GraP5Gradient,       1, NonFatal );
    LoadField( "Opt__GravityType",        &RS.Opt__GravityType,        SID, TID, NonFatal, &RT.Opt__GravityType,         1, NonFatal );
    LoadField( "Opt__ExternalPot",        &RS.Opt__ExternalPot,        SID, TID, NonFatal, &RT.Opt__ExternalPot,         1, NonFatal );
+   LoadField( "Opt__USG_PotExt",         &RS.Opt__USG_PotExt,         SID, TID, NonFatal, &RT.Opt__USG_PotExt,          1, NonFatal );
+   LoadField( "ExtPotTable_Name",         RS.ExtPotTable_Name,        SID, TID, NonFatal,  RT.ExtPotTable_Name,         1, NonFatal );
+   LoadField( "ExtPotTable_NPoint",       RS.ExtPotTable_NPoint,      SID, TID, NonFatal,  RT.ExtPotTable_NPoint,       3, NonFatal );
+   LoadField( "ExtPotTable_dh",          &RS.ExtPotTable_dh,          SID, TID, NonFatal, &RT.ExtPotTable_dh,           1, NonFatal );
+   LoadField( "ExtPotTable_EdgeL",        RS.ExtPotTable_EdgeL,       SID, TID, NonFatal,  RT.ExtPotTable_EdgeL,        3, NonFatal );
+   LoadField( "Opt__USG_FuseExtAcc",     &RS.Opt__USG_FuseExtAcc,     SID, TID, NonFatal, &RT.Opt__USG_FuseExtAcc,      1, NonFatal );
    LoadField( "Opt__GravityExtraMass",   &RS.Opt__GravityExtraMass,   SID, TID, NonFatal, &RT.Opt__GravityExtraMass,    1, NonFatal );
+   LoadField( "Opt__FFT_Pencil",         &RS.Opt__FFT_Pencil,         SID, TID, NonFatal, &RT.Opt__FFT_Pencil,          1, NonFatal );
+   LoadField( "Opt__PotWarmStart",       &RS.Opt__PotWarmStart,       SID, TID, NonFatal, &RT.Opt__PotWarmStart,        1, NonFatal );
+   LoadField( "Opt__RecordPoiIter",      &RS.Opt__RecordPoiIter,      SID, TID, NonFatal, &RT.Opt__RecordPoiIter,       1, NonFatal );
+   LoadField( "Pot_LevelNSweep",         &RS.Pot_LevelNSweep,         SID, TID, NonFatal, &RT.Pot_LevelNSweep,          1, NonFatal );
+   LoadField( "Opt__GFuncCache",         &RS.Opt__GFuncCache,         SID, TID, NonFatal, &RT.Opt__GFuncCache,          1, NonFatal );
+   LoadField( "Opt__RecordLevelPS",      &RS.Opt__RecordLevelPS,      SID, TID, NonFatal, &RT.Opt__RecordLevelPS,       1, NonFatal );
+   LoadField( "LevelPS_Lv",              &RS.LevelPS_Lv,              SID, TID, NonFatal, &RT.LevelPS_Lv,               1, NonFatal );
+   LoadField( "LevelPS_Interlace",       &RS.LevelPS_Interlace,       SID, TID, NonFatal, &RT.LevelPS_Interlace,        1, NonFatal );
 #  endif
 
 // Grackle
@@ -1886,6 +2428,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Grackle_CIE_Cooling",     &RS.Grackle_CIE_Cooling,     SID, TID, NonFatal, &RT.Grackle_CIE_Cooling,      1, NonFatal );
    LoadField( "Grackle_H2_OpaApprox",    &RS.Grackle_H2_OpaApprox,    SID, TID, NonFatal, &RT.Grackle_H2_OpaApprox,     1, NonFatal );
    LoadField( "Che_GPU_NPGroup",         &RS.Che_GPU_NPGroup,         SID, TID, NonFatal, &RT.Che_GPU_NPGroup,          1, NonFatal );
+   LoadField( "Grackle_ZeroCopy",        &RS.Grackle_ZeroCopy,        SID, TID, NonFatal, &RT.Grackle_ZeroCopy,         1, NonFatal );
+   LoadField( "Grackle_ScreenTCool",     &RS.Grackle_ScreenTCool,     SID, TID, NonFatal, &RT.Grackle_ScreenTCool,      1, NonFatal );
 #  endif
 
 // star formation
@@ -1904,6 +2448,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Init",               &RS.Opt__Init,               SID, TID, NonFatal, &RT.Opt__Init,                1, NonFatal );
    LoadField( "RestartLoadNRank",        &RS.RestartLoadNRank,        SID, TID, NonFatal, &RT.RestartLoadNRank,         1, NonFatal );
    LoadField( "Opt__RestartReset",       &RS.Opt__RestartReset,       SID, TID, NonFatal, &RT.Opt__RestartReset,        1, NonFatal );
+   LoadField( "Opt__RestartBulk",        &RS.Opt__RestartBulk,        SID, TID, NonFatal, &RT.Opt__RestartBulk,         1, NonFatal );
+   LoadField( "Opt__RestartLocal",       &RS.Opt__RestartLocal,       SID, TID, NonFatal, &RT.Opt__RestartLocal,        1, NonFatal );
    LoadField( "Opt__UM_IC_Level",        &RS.Opt__UM_IC_Level,        SID, TID, NonFatal, &RT.Opt__UM_IC_Level,         1, NonFatal );
    LoadField( "Opt__UM_IC_NVar",         &RS.Opt__UM_IC_NVar,         SID, TID, NonFatal, &RT.Opt__UM_IC_NVar,          1, NonFatal );
    LoadField( "Opt__UM_IC_Format",       &RS.Opt__UM_IC_Format,       SID, TID, NonFatal, &RT.Opt__UM_IC_Format,        1, NonFatal );
@@ -1912,11 +2458,14 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__UM_IC_LoadNRank",    &RS.Opt__UM_IC_LoadNRank,    SID, TID, NonFatal, &RT.Opt__UM_IC_LoadNRank,     1, NonFatal );
    LoadField( "Opt__InitRestrict",       &RS.Opt__InitRestrict,       SID, TID, NonFatal, &RT.Opt__InitRestrict,        1, NonFatal );
    LoadField( "Opt__InitGridWithOMP",    &RS.Opt__InitGridWithOMP,    SID, TID, NonFatal, &RT.Opt__InitGridWithOMP,     1, NonFatal );
+   LoadField( "Opt__InitRefineMap",      &RS.Opt__InitRefineMap,      SID, TID, NonFatal, &RT.Opt__InitRefineMap,       1, NonFatal );
    LoadField( "Opt__GPUID_Select",       &RS.Opt__GPUID_Select,       SID, TID, NonFatal, &RT.Opt__GPUID_Select,        1, NonFatal );
    LoadField( "Init_Subsampling_NCell",  &RS.Init_Subsampling_NCell,  SID, TID, NonFatal, &RT.Init_Subsampling_NCell,   1, NonFatal );
+   LoadField( "Init_Subsampling_Tol",    &RS.Init_Subsampling_Tol,    SID, TID, NonFatal, &RT.Init_Subsampling_Tol,     1, NonFatal );
 
 // interpolation schemes
    LoadField( "Opt__Int_Time",           &RS.Opt__Int_Time,           SID, TID, NonFatal, &RT.Opt__Int_Time,            1, NonFatal );
+   LoadField( "Opt__Int_TimeLazy",       &RS.Opt__Int_TimeLazy,       SID, TID, NonFatal, &RT.Opt__Int_TimeLazy,        1, NonFatal );
 #  if ( MODEL == ELBDM )
    LoadField( "Opt__Int_Phase",          &RS.Opt__Int_Phase,          SID, TID, NonFatal, &RT.Opt__Int_Phase,           1, NonFatal );
 #  endif
@@ -1925,6 +2474,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  ifdef MHD
    LoadField( "Opt__Mag_IntScheme",      &RS.Opt__Mag_IntScheme,      SID, TID, NonFatal, &RT.Opt__Mag_IntScheme,       1, NonFatal );
    LoadField( "Opt__RefMag_IntScheme",   &RS.Opt__RefMag_IntScheme,   SID, TID, NonFatal, &RT.Opt__RefMag_IntScheme,    1, NonFatal );
+   LoadField( "Opt__EMagCache",          &RS.Opt__EMagCache,          SID, TID, NonFatal, &RT.Opt__EMagCache,           1, NonFatal );
 #  endif
 #  ifdef GRAVITY
    LoadField( "Opt__Pot_IntScheme",      &RS.Opt__Pot_IntScheme,      SID, TID, NonFatal, &RT.Opt__Pot_IntScheme,       1, NonFatal );
@@ -1934,6 +2484,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "IntMonoCoeff",            &RS.IntMonoCoeff,            SID, TID, NonFatal, &RT.IntMonoCoeff,             1, NonFatal );
    LoadField( "IntOppSign0thOrder",      &RS.IntOppSign0thOrder,      SID, TID, NonFatal, &RT.IntOppSign0thOrder,       1, NonFatal );
+   LoadField( "Opt__GhostCache",         &RS.Opt__GhostCache,         SID, TID, NonFatal, &RT.Opt__GhostCache,          1, NonFatal );
+   LoadField( "Opt__PrepCostOrder",      &RS.Opt__PrepCostOrder,      SID, TID, NonFatal, &RT.Opt__PrepCostOrder,       1, NonFatal );
 
 // data dump
    LoadField( "Opt__Output_Total",       &RS.Opt__Output_Total,       SID, TID, NonFatal, &RT.Opt__Output_Total,        1, NonFatal );
@@ -1969,18 +2521,57 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Output_PartZ",            &RS.Output_PartZ,            SID, TID, NonFatal, &RT.Output_PartZ,             1, NonFatal );
    }
    LoadField( "InitDumpID",              &RS.InitDumpID,              SID, TID, NonFatal, &RT.InitDumpID,               1, NonFatal );
+   LoadField( "Opt__Output_MPIIO",       &RS.Opt__Output_MPIIO,       SID, TID, NonFatal, &RT.Opt__Output_MPIIO,        1, NonFatal );
+   LoadField( "Opt__Output_Async",       &RS.Opt__Output_Async,       SID, TID, NonFatal, &RT.Opt__Output_Async,        1, NonFatal );
+   LoadField( "Opt__Output_Compress",    &RS.Opt__Output_Compress,    SID, TID, NonFatal, &RT.Opt__Output_Compress,     1, NonFatal );
+   LoadField( "Opt__Output_Shuffle",     &RS.Opt__Output_Shuffle,     SID, TID, NonFatal, &RT.Opt__Output_Shuffle,      1, NonFatal );
+   LoadField( "Opt__Output_ChunkNPatch", &RS.Opt__Output_ChunkNPatch, SID, TID, NonFatal, &RT.Opt__Output_ChunkNPatch,  1, NonFatal );
+   LoadField( "Opt__Output_Index",       &RS.Opt__Output_Index,       SID, TID, NonFatal, &RT.Opt__Output_Index,        1, NonFatal );
+   LoadField( "Opt__CkptLocal",          &RS.Opt__CkptLocal,          SID, TID, NonFatal, &RT.Opt__CkptLocal,           1, NonFatal );
+   LoadField( "Output_Sub_Step",         &RS.Output_Sub_Step,         SID, TID, NonFatal, &RT.Output_Sub_Step,          1, NonFatal );
+   LoadField( "Output_Sub_LvMin",        &RS.Output_Sub_LvMin,        SID, TID, NonFatal, &RT.Output_Sub_LvMin,         1, NonFatal );
+   LoadField( "Output_Sub_LvMax",        &RS.Output_Sub_LvMax,        SID, TID, NonFatal, &RT.Output_Sub_LvMax,         1, NonFatal );
+   LoadField( "Output_Sub_Field",        &RS.Output_Sub_Field,        SID, TID, NonFatal, &RT.Output_Sub_Field,         1, NonFatal );
+   LoadField( "Output_Sub_EdgeL",         RS.Output_Sub_EdgeL,        SID, TID, NonFatal,  RT.Output_Sub_EdgeL,         3, NonFatal );
+   LoadField( "Output_Sub_EdgeR",         RS.Output_Sub_EdgeR,        SID, TID, NonFatal,  RT.Output_Sub_EdgeR,         3, NonFatal );
+   LoadField( "Output_UG_Step",          &RS.Output_UG_Step,          SID, TID, NonFatal, &RT.Output_UG_Step,           1, NonFatal );
+   LoadField( "Output_UG_Lv",            &RS.Output_UG_Lv,            SID, TID, NonFatal, &RT.Output_UG_Lv,             1, NonFatal );
+   LoadField( "Output_UG_EdgeL",          RS.Output_UG_EdgeL,         SID, TID, NonFatal,  RT.Output_UG_EdgeL,          3, NonFatal );
+   LoadField( "Output_UG_EdgeR",          RS.Output_UG_EdgeR,         SID, TID, NonFatal,  RT.Output_UG_EdgeR,          3, NonFatal );
+   LoadField( "Output_Diag_Step",        &RS.Output_Diag_Step,        SID, TID, NonFatal, &RT.Output_Diag_Step,         1, NonFatal );
+   LoadField( "Output_Diag_Field",       &RS.Output_Diag_Field,       SID, TID, NonFatal, &RT.Output_Diag_Field,        1, NonFatal );
+   LoadField( "Output_Diag_ProjLv",      &RS.Output_Diag_ProjLv,      SID, TID, NonFatal, &RT.Output_Diag_ProjLv,       1, NonFatal );
+   LoadField( "Output_Diag_ProfRMax",    &RS.Output_Diag_ProfRMax,    SID, TID, NonFatal, &RT.Output_Diag_ProfRMax,     1, NonFatal );
+   LoadField( "Output_Diag_ProfLogR",    &RS.Output_Diag_ProfLogR,    SID, TID, NonFatal, &RT.Output_Diag_ProfLogR,     1, NonFatal );
+   LoadField( "Output_Diag_PhaseNBin",   &RS.Output_Diag_PhaseNBin,   SID, TID, NonFatal, &RT.Output_Diag_PhaseNBin,    1, NonFatal );
+   LoadField( "Opt__Output_TextBinary",  &RS.Opt__Output_TextBinary,  SID, TID, NonFatal, &RT.Opt__Output_TextBinary,   1, NonFatal );
 
 // miscellaneous
    LoadField( "Opt__Verbose",            &RS.Opt__Verbose,            SID, TID, NonFatal, &RT.Opt__Verbose,             1, NonFatal );
    LoadField( "Opt__TimingBarrier",      &RS.Opt__TimingBarrier,      SID, TID, NonFatal, &RT.Opt__TimingBarrier,       1, NonFatal );
    LoadField( "Opt__TimingBalance",      &RS.Opt__TimingBalance,      SID, TID, NonFatal, &RT.Opt__TimingBalance,       1, NonFatal );
    LoadField( "Opt__TimingMPI",          &RS.Opt__TimingMPI,          SID, TID, NonFatal, &RT.Opt__TimingMPI,           1, NonFatal );
+   LoadField( "Opt__Trace",              &RS.Opt__Trace,              SID, TID, NonFatal, &RT.Opt__Trace,               1, NonFatal );
+   LoadField( "Trace_NEvent",            &RS.Trace_NEvent,            SID, TID, NonFatal, &RT.Trace_NEvent,             1, NonFatal );
+   LoadField( "Opt__TimingCounter",      &RS.Opt__TimingCounter,      SID, TID, NonFatal, &RT.Opt__TimingCounter,       1, NonFatal );
    LoadField( "Opt__RecordNote",         &RS.Opt__RecordNote,         SID, TID, NonFatal, &RT.Opt__RecordNote,          1, NonFatal );
    LoadField( "Opt__RecordUnphy",        &RS.Opt__RecordUnphy,        SID, TID, NonFatal, &RT.Opt__RecordUnphy,         1, NonFatal );
    LoadField( "Opt__RecordMemory",       &RS.Opt__RecordMemory,       SID, TID, NonFatal, &RT.Opt__RecordMemory,        1, NonFatal );
    LoadField( "Opt__RecordPerformance",  &RS.Opt__RecordPerformance,  SID, TID, NonFatal, &RT.Opt__RecordPerformance,   1, NonFatal );
+   LoadField( "Opt__RecordTelemetry",    &RS.Opt__RecordTelemetry,    SID, TID, NonFatal, &RT.Opt__RecordTelemetry,     1, NonFatal );
+   LoadField( "Opt__RecordPatchCost",    &RS.Opt__RecordPatchCost,    SID, TID, NonFatal, &RT.Opt__RecordPatchCost,     1, NonFatal );
+   LoadField( "Opt__RecordConservation", &RS.Opt__RecordConservation, SID, TID, NonFatal, &RT.Opt__RecordConservation,  1, NonFatal );
    LoadField( "Opt__ManualControl",      &RS.Opt__ManualControl,      SID, TID, NonFatal, &RT.Opt__ManualControl,       1, NonFatal );
    LoadField( "Opt__RecordUser",         &RS.Opt__RecordUser,         SID, TID, NonFatal, &RT.Opt__RecordUser,          1, NonFatal );
+#  ifdef SUPPORT_LIBYT
+   LoadField( "Yt_Step",                 &RS.Yt_Step,                 SID, TID, NonFatal, &RT.Yt_Step,                  1, NonFatal );
+   LoadField( "Yt_Async",                &RS.Yt_Async,                SID, TID, NonFatal, &RT.Yt_Async,                 1, NonFatal );
+   LoadField( "Yt_AsyncNCore",           &RS.Yt_AsyncNCore,           SID, TID, NonFatal, &RT.Yt_AsyncNCore,            1, NonFatal );
+   LoadField( "Yt_AsyncMaxMem",          &RS.Yt_AsyncMaxMem,          SID, TID, NonFatal, &RT.Yt_AsyncMaxMem,           1, NonFatal );
+#  endif
+#  ifdef MHD
+   LoadField( "Opt__RecordDivB",         &RS.Opt__RecordDivB,         SID, TID, NonFatal, &RT.Opt__RecordDivB,          1, NonFatal );
+#  endif
    LoadField( "Opt__OptimizeAggressive", &RS.Opt__OptimizeAggressive, SID, TID, NonFatal, &RT.Opt__OptimizeAggressive,  1, NonFatal );
 
 // simulation checks
@@ -1992,6 +2583,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Ck_Finite",          &RS.Opt__Ck_Finite,          SID, TID, NonFatal, &RT.Opt__Ck_Finite,           1, NonFatal );
    LoadField( "Opt__Ck_PatchAllocate",   &RS.Opt__Ck_PatchAllocate,   SID, TID, NonFatal, &RT.Opt__Ck_PatchAllocate,    1, NonFatal );
    LoadField( "Opt__Ck_FluxAllocate",    &RS.Opt__Ck_FluxAllocate,    SID, TID, NonFatal, &RT.Opt__Ck_FluxAllocate,     1, NonFatal );
+   LoadField( "Opt__Ck_FluOutput",       &RS.Opt__Ck_FluOutput,       SID, TID, NonFatal, &RT.Opt__Ck_FluOutput,        1, NonFatal );
 #  if ( MODEL == HYDRO )
    LoadField( "Opt__Ck_Negative",        &RS.Opt__Ck_Negative,        SID, TID, NonFatal, &RT.Opt__Ck_Negative,         1, NonFatal );
 #  endif
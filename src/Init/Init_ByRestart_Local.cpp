@@ -0,0 +1,363 @@
+#include "GAMER.h"
+#include "CkptLocal_Typedef.h"
+
+#ifdef LOAD_BALANCE
+
+static long LoadFile( const char *FileName, const int TargetRank, char *&Buf );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ByRestart_Local
+// Description :  Reload the node-local checkpoints written by Output_CheckpointLocal() as the initial condition
+//
+// Note        :  1. Enabled by OPT__RESTART_LOCAL and invoked by Init_ByRestart()
+//                2. Each rank reloads CKPT_LOCAL_DIR/Rank_XXXXXX
+//                   --> If it is missing, corrupted, or older than that of other ranks (e.g., the job was killed
+//                       while writing the checkpoint), the replica stored by CKPT_LOCAL_REPLICA_HOST() is used
+//                       instead and sent by MPI
+//                3. Must restart with the same executable and number of ranks
+//                   --> Use the HDF5 snapshots to restart with a different number of ranks
+//                4. Patches are restored on the same ranks and with the same cut points, and thus no data
+//                   redistribution is required
+//-------------------------------------------------------------------------------------------------------
+void Init_ByRestart_Local()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
+
+   const int Host  = CKPT_LOCAL_REPLICA_HOST ( MPI_Rank, MPI_NRank );
+   const int Owner = CKPT_LOCAL_REPLICA_OWNER( MPI_Rank, MPI_NRank );
+
+   char FileName[2*MAX_STRING];
+
+
+// 1. load the checkpoint of this rank
+   char *Buf  = NULL;
+   long  Size;
+
+   sprintf( FileName, "%s/Rank_%06d", CKPT_LOCAL_DIR, MPI_Rank );
+   Size = LoadFile( FileName, MPI_Rank, Buf );
+
+// only the latest checkpoint of all ranks is valid
+   long Step_ThisRank = ( Size > 0 ) ? ( (CkptLocal_t*)Buf )->Step : -1L;
+   long Step_Latest;
+
+   MPI_Allreduce( &Step_ThisRank, &Step_Latest, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   if ( Step_Latest < 0 )
+      Aux_Error( ERROR_INFO, "no valid checkpoint is found in the directory \"%s\" !!\n", CKPT_LOCAL_DIR );
+
+   int  Valid_ThisRank = ( Step_ThisRank == Step_Latest );
+   int *Valid_AllRank  = new int [MPI_NRank];
+
+   MPI_Allgather( &Valid_ThisRank, 1, MPI_INT, Valid_AllRank, 1, MPI_INT, MPI_COMM_WORLD );
+
+
+// 2. recover the invalid checkpoints from their replicas
+   char *ReplicaBuf  = NULL;
+   long  ReplicaSize = 0, RecvSize;
+
+   if ( !Valid_AllRank[Owner] )
+   {
+      sprintf( FileName, "%s/Replica_%06d", CKPT_LOCAL_DIR, Owner );
+      ReplicaSize = LoadFile( FileName, Owner, ReplicaBuf );
+
+      if ( ReplicaSize > 0  &&  ( (CkptLocal_t*)ReplicaBuf )->Step != Step_Latest )   ReplicaSize = -1L;
+   }
+
+   MPI_Sendrecv( &ReplicaSize, 1, MPI_LONG, Owner, 0, &RecvSize, 1, MPI_LONG, Host, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+
+   if ( !Valid_ThisRank )
+   {
+      if ( RecvSize <= 0 )
+         Aux_Error( ERROR_INFO, "rank %d: both the checkpoint and its replica (on rank %d) of step %ld are unavailable !!\n",
+                    MPI_Rank, Host, Step_Latest );
+
+      delete [] Buf;
+      Buf  = new char [RecvSize];
+      Size = RecvSize;
+   }
+
+   Output_CkptLocal_Exchange( ReplicaBuf, MAX( ReplicaSize, 0L ), Owner, Buf, ( Valid_ThisRank ) ? 0L : Size, Host );
+
+   delete [] ReplicaBuf;
+
+   int NRecover = 0;
+   for (int r=0; r<MPI_NRank; r++)  NRecover += !Valid_AllRank[r];
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "   Step %ld, %d rank(s) recovered from replicas\n", Step_Latest, NRecover );
+
+   delete [] Valid_AllRank;
+
+
+// 3. set internal parameters (see also Init_ByRestart_HDF5())
+   const CkptLocal_t *Header = (CkptLocal_t*)Buf;
+
+   for (int lv=0; lv<NLEVEL; lv++)  NPatchTotal[lv] = Header->NPatchTotal[lv];
+
+#  ifdef PARTICLE
+   amr->Par->NPar_Active_AllRank = Header->NPar_AllRank;
+#  endif
+
+   if ( ! OPT__RESTART_RESET )
+   {
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         Time          [lv] = Header->Time          [lv];
+         AdvanceCounter[lv] = Header->AdvanceCounter[lv];
+         dTime_AllLv   [lv] = Header->dTime_AllLv   [lv];
+      }
+
+      Step            = Header->Step;
+#     ifdef GRAVITY
+      AveDensity_Init = Header->AveDensity_Init;
+#     endif
+   }
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      amr->FluSgTime[lv][ amr->FluSg[lv] ] = Time[lv];
+#     ifdef MHD
+      amr->MagSgTime[lv][ amr->MagSg[lv] ] = Time[lv];
+#     endif
+#     ifdef GRAVITY
+      amr->PotSgTime[lv][ amr->PotSg[lv] ] = Time[lv];
+#     endif
+   }
+
+// the checkpoint stores the ID of the next dump already
+   if ( INIT_DUMPID < 0 )
+      DumpID = ( OPT__RESTART_RESET ) ? 0 : Header->DumpID;
+   else
+      DumpID = INIT_DUMPID;
+
+
+// 4. restore the load-balance cut points stored in the end of the buffer
+   const long *CutPoint = (const long*)( Buf + Size - NLEVEL*( MPI_NRank + 1 )*sizeof(long) );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+      memcpy( amr->LB->CutPoint[lv], CutPoint + lv*( MPI_NRank + 1 ), ( MPI_NRank + 1 )*sizeof(long) );
+
+
+// 5. initialize the particle repository
+#  ifdef PARTICLE
+   long NParThisRank = 0;
+   int  NParMax      = 0;
+   for (int lv=0; lv<NLEVEL; lv++)  NParThisRank += Header->NParLv[lv];
+
+   amr->Par->InitRepo( NParThisRank, MPI_NRank );
+
+   amr->Par->NPar_AcPlusInac = 0;
+   amr->Par->NPar_Active     = 0;
+#  endif
+
+
+// 6. allocate patches and restore data
+   const bool WithData_Yes = true;
+   const long FluSize      = NCOMP_TOTAL*CUBE(PS1)*sizeof(real);
+#  ifdef MHD
+   const long MagSize      = NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real);
+#  endif
+
+   const char *Ptr = Buf + sizeof(CkptLocal_t);
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int   NReal = Header->NReal[lv];
+      const int (*Cr)[3] = (const int(*)[3])Ptr;
+      Ptr += NReal*3*sizeof(int);
+
+#     ifdef PARTICLE
+      const int *NPar = (const int*)Ptr;
+      Ptr += NReal*sizeof(int);
+#     endif
+
+      const char *Flu = Ptr;
+      Ptr += NReal*FluSize;
+
+#     ifdef MHD
+      const char *Mag = Ptr;
+      Ptr += NReal*MagSize;
+#     endif
+
+#     ifdef PARTICLE
+      const long  NParLv = Header->NParLv[lv];
+      const real *ParAtt = (const real*)Ptr;
+      Ptr += NParLv*PAR_NATT_TOTAL*sizeof(real);
+
+      for (int t=0; t<NReal; t++)   NParMax = MAX( NParMax, NPar[t] );
+
+      long *NewParList = new long [NParMax];
+      long  ParIdx     = 0;
+      real  NewParAtt[PAR_NATT_TOTAL];
+#     endif
+
+      for (int t=0; t<NReal; t++)
+      {
+         amr->pnew( lv, Cr[t][0], Cr[t][1], Cr[t][2], -1, WithData_Yes, WithData_Yes, WithData_Yes );
+
+         const int PID = amr->num[lv] - 1;
+
+         memcpy( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, Flu + t*FluSize, FluSize );
+#        ifdef MHD
+         memcpy( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, Mag + t*MagSize, MagSize );
+#        endif
+
+#        ifdef PARTICLE
+         if ( NPar[t] == 0 )  continue;
+
+         for (int p=0; p<NPar[t]; p++)
+         {
+            for (int v=0; v<PAR_NATT_TOTAL; v++)   NewParAtt[v] = ParAtt[ v*NParLv + ParIdx ];
+
+            NewParList[p] = amr->Par->AddOneParticle( NewParAtt );
+            ParIdx ++;
+         }
+
+#        ifdef DEBUG_PARTICLE
+         const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+         char Comment[MAX_STRING];
+         sprintf( Comment, "%s, lv %d, PID %d, NPar %d", __FUNCTION__, lv, PID, NPar[t] );
+         amr->patch[0][lv][PID]->AddParticle( NPar[t], NewParList, &amr->Par->NPar_Lv[lv],
+                                              ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#        else
+         amr->patch[0][lv][PID]->AddParticle( NPar[t], NewParList, &amr->Par->NPar_Lv[lv] );
+#        endif
+
+         Par_UpdateDescendantCount( lv, PID, NPar[t] );
+#        endif // #ifdef PARTICLE
+      } // for (int t=0; t<NReal; t++)
+
+#     ifdef PARTICLE
+      delete [] NewParList;
+#     endif
+
+
+//    record the number of real patches and LB_IdxList_Real
+      for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = amr->num[lv];
+
+      if ( amr->LB->IdxList_Real         [lv] != NULL )   delete [] amr->LB->IdxList_Real         [lv];
+      if ( amr->LB->IdxList_Real_IdxTable[lv] != NULL )   delete [] amr->LB->IdxList_Real_IdxTable[lv];
+
+      amr->LB->IdxList_Real         [lv] = new long [ amr->NPatchComma[lv][1] ];
+      amr->LB->IdxList_Real_IdxTable[lv] = new int  [ amr->NPatchComma[lv][1] ];
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+      Mis_RadixSort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+//    the son directory at lv is no longer valid (see LB_FindSonNotHome())
+      amr->LB->ResetSonDir( lv );
+
+      Mis_GetTotalPatchNumber( lv );
+
+      if ( NPatchTotal[lv] != Header->NPatchTotal[lv] )
+         Aux_Error( ERROR_INFO, "lv %d: total number of restored patches (%d) != expect (%d) !!\n",
+                    lv, NPatchTotal[lv], Header->NPatchTotal[lv] );
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+#  ifdef PARTICLE
+   if ( amr->Par->NPar_AcPlusInac != NParThisRank )
+      Aux_Error( ERROR_INFO, "total number of particles in the repository (%ld) != expect (%ld) !!\n",
+                 amr->Par->NPar_AcPlusInac, NParThisRank );
+#  endif
+
+   delete [] Buf;
+
+
+// 7. construct the AMR hierarchy without redistributing patches
+// --> must not reset the load-balance variables since IdxList_Real[] has been set above
+   const double ParWeight_Zero  = 0.0;
+   const bool   Redistribute_No = false;
+   const bool   Incremental_No  = false;
+   const bool   ResetLB_No      = false;
+   const int    AllLv           = -1;
+
+   LB_Init_LoadBalance( Redistribute_No, Incremental_No, ParWeight_Zero, ResetLB_No, AllLv );
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : Init_ByRestart_Local
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadFile
+// Description :  Load and validate a checkpoint file
+//
+// Note        :  1. Buf is allocated here and must be freed by the caller
+//                2. Return -1 (and Buf == NULL) if the file is missing, truncated, or incompatible with the
+//                   current run
+//
+// Parameter   :  FileName   : Target file name
+//                TargetRank : Rank that the checkpoint is expected to belong to
+//                Buf        : Buffer to store the file content
+//
+// Return      :  Buf, number of bytes in Buf
+//-------------------------------------------------------------------------------------------------------
+long LoadFile( const char *FileName, const int TargetRank, char *&Buf )
+{
+
+   Buf = NULL;
+
+   if ( !Aux_CheckFileExist(FileName) )
+   {
+      Aux_Message( stderr, "WARNING : rank %d: checkpoint \"%s\" does not exist !!\n", MPI_Rank, FileName );
+      return -1L;
+   }
+
+   FILE *File = fopen( FileName, "rb" );
+   long  Size;
+
+   fseek( File, 0, SEEK_END );
+   Size = ftell( File );
+   fseek( File, 0, SEEK_SET );
+
+   if ( Size < (long)sizeof(CkptLocal_t) )
+   {
+      Aux_Message( stderr, "WARNING : rank %d: checkpoint \"%s\" is truncated !!\n", MPI_Rank, FileName );
+      fclose( File );
+      return -1L;
+   }
+
+   Buf = new char [Size];
+
+   const bool ReadOK = ( (long)fread( Buf, 1, Size, File ) == Size );
+
+   fclose( File );
+
+   const CkptLocal_t *Header = (CkptLocal_t*)Buf;
+
+   if (  !ReadOK  ||  Header->Magic != CKPT_LOCAL_MAGIC  ||  Header->Version != CKPT_LOCAL_VERSION  ||
+         Header->Size != Size  ||  Header->Rank != TargetRank  )
+   {
+      Aux_Message( stderr, "WARNING : rank %d: checkpoint \"%s\" is corrupted !!\n", MPI_Rank, FileName );
+      delete [] Buf;
+      Buf = NULL;
+      return -1L;
+   }
+
+#  ifdef PARTICLE
+   const int NParAtt = PAR_NATT_TOTAL;
+#  else
+   const int NParAtt = 0;
+#  endif
+
+   if (  Header->NRank != MPI_NRank  ||  Header->NLevel != NLEVEL  ||  Header->PatchSize != PS1  ||
+         Header->NCompTotal != NCOMP_TOTAL  ||  Header->NCompMag != NCOMP_MAG  ||  Header->NParAtt != NParAtt  ||
+         Header->SizeReal != (int)sizeof(real)  )
+      Aux_Error( ERROR_INFO, "checkpoint \"%s\" is incompatible with the current run (e.g., NRank %d != %d) !!\n",
+                 FileName, Header->NRank, MPI_NRank );
+
+   return Size;
+
+} // FUNCTION : LoadFile
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -320,8 +320,9 @@ void Init_ByRestart_v1( const char FileName[] )
 //    d0-2. set the cut points
 //    --> do NOT consider load-balance weighting of particles since at this point we don't have that information
       const double ParWeight_Zero = 0.0;
+      const bool   Incremental_No = false;
       LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
-                      ParWeight_Zero );
+                      ( MPI_Rank == 0 ) ? NPatchTotal[lv]/8 : 0, ParWeight_Zero, Incremental_No );
 
       if ( MPI_Rank == 0 )
       {
@@ -434,7 +435,10 @@ void Init_ByRestart_v1( const char FileName[] )
             for (int RPID=0; RPID<amr->NPatchComma[lv][1]; RPID++)
                amr->LB->IdxList_Real[lv][RPID] = amr->patch[0][lv][RPID]->LB_Idx;
 
-            Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+            Mis_RadixSort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+//          the son directory at lv is no longer valid (see LB_FindSonNotHome())
+            amr->LB->ResetSonDir( lv );
 #           endif // #ifdef LOAD_BALANCE
 
             Offset += DataSize[lv];
@@ -478,11 +482,12 @@ void Init_ByRestart_v1( const char FileName[] )
    const double ParWeight_Zero   = 0.0;
    const bool   Redistribute_Yes = true;
    const bool   Redistribute_No  = false;
+   const bool   Incremental_No   = false;
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, Incremental_No, ParWeight_Zero, ResetLB_No, AllLv );
 
 
 // fill up the data of non-leaf patches
@@ -728,10 +733,6 @@ void Load_Parameter_Before_1200( FILE *File, const int FormatVersion, int &NLv_R
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      if ( max_patch != MAX_PATCH )
-         Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
-                      "MAX_PATCH", max_patch, MAX_PATCH );
-
       if ( flu_ghost_size != FLU_GHOST_SIZE )
          Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
                       "FLU_GHOST_SIZE", flu_ghost_size, FLU_GHOST_SIZE );
@@ -1198,8 +1199,6 @@ void Load_Parameter_After_1200( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
-
 
 
 //    d-2. check the symbolic constants defined in "Macro.h, CUPOT.h, and CUFLU.h"
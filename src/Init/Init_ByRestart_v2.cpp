@@ -6,6 +6,9 @@
 #ifdef SUPPORT_HDF5
 #include "hdf5.h"
 #endif
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 void Init_ByRestart_v1( const char FileName[] );
 void Load_Parameter_After_2000( FILE *File, const int FormatVersion, int &NLv_Restart,
@@ -17,6 +20,7 @@ void CompareVar( const char *VarName, const int    RestartVar, const int    Runt
 void CompareVar( const char *VarName, const long   RestartVar, const long   RuntimeVar, const bool Fatal );
 void CompareVar( const char *VarName, const real   RestartVar, const real   RuntimeVar, const bool Fatal );
 void CompareVar( const char *VarName, const double RestartVar, const double RuntimeVar, const bool Fatal );
+static const char *MapFile( const char *FileName, const long Size );
 
 
 
@@ -34,6 +38,12 @@ void CompareVar( const char *VarName, const double RestartVar, const double Runt
 //
 //                3. This function will invoke "Init_ByRestart_v1" automatically if the restart file
 //                   is in a simple binary format in version 1 (i.e., FormatVersion < 2000)
+//
+//                4. This function will invoke "Init_ByRestart_Local" instead if OPT__RESTART_LOCAL is on
+//
+//                5. For FormatVersion >= 2230, the RESTART file is memory-mapped and all ranks load their patches
+//                   simultaneously by locating them with the patch index
+//                   --> Otherwise, or if the file cannot be mapped, RESTART_LOAD_NRANK ranks scan the file at a time
 //-------------------------------------------------------------------------------------------------------
 void Init_ByRestart()
 {
@@ -41,6 +51,16 @@ void Init_ByRestart()
    const char FileName[] = "RESTART";
 
 
+// load the node-local checkpoints
+#  ifdef LOAD_BALANCE
+   if ( OPT__RESTART_LOCAL )
+   {
+      Init_ByRestart_Local();
+      return;
+   }
+#  endif
+
+
 // load the HDF5 data
 #  ifdef SUPPORT_HDF5
    if (  Aux_CheckFileExist(FileName)  &&  H5Fis_hdf5(FileName)  )
@@ -210,6 +230,7 @@ void Init_ByRestart()
 
 // load information necessary for restart
    int  NDataPatch_Total[NLv_Restart];
+   long FileOffset_Level[NLv_Restart], FileOffset_PatchIdx;
 #  ifdef PARTICLE
    long FileOffset_Particle;
 #  endif
@@ -237,6 +258,12 @@ void Init_ByRestart()
    if ( FormatVersion >= 2130 )
    fread( dTime_AllLv,                    sizeof(double), NLv_Restart, File );
 
+   if ( FormatVersion >= 2230 )
+   {
+   fread( FileOffset_Level,               sizeof(long),   NLv_Restart, File );
+   fread( &FileOffset_PatchIdx,           sizeof(long),             1, File );
+   }
+
 
 // set parameters in levels that do not exist in the input file
 // --> assuming dTime_AllLv[] has been initialized as 0.0 properly
@@ -331,6 +358,16 @@ void Init_ByRestart()
    ExpectSize += (long)PAR_NATT_STORED*amr->Par->NPar_Active_AllRank*sizeof(real);
 #  endif
 
+   if ( FormatVersion >= 2230 )
+   {
+      if ( FileOffset_PatchIdx != ExpectSize  &&  MPI_Rank == 0 )
+         Aux_Error( ERROR_INFO, "incorrect offset of the patch index in the file <%s> --> input = %ld <-> expect = %ld !!\n",
+                    FileName, FileOffset_PatchIdx, ExpectSize );
+
+      for (int lv=0; lv<NLv_Restart; lv++)
+         ExpectSize += (long)NPatchTotal[lv]*4*sizeof(int);      // 4 = corner(3) + son(1)
+   }
+
    fseek( File, 0, SEEK_END );
    InputSize = ftell( File );
 
@@ -344,6 +381,35 @@ void Init_ByRestart()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading simulation information ... done\n" );
 
 
+// map the RESTART file with the patch index into memory
+// --> all ranks must agree on whether to use it since the ranks loading data at a time are synchronized
+   const char *Map = ( FormatVersion >= 2230 ) ? MapFile( FileName, InputSize ) : NULL;
+   const char *PatchIdx[NLv_Restart];
+   int MapFailed_ThisRank = ( FormatVersion >= 2230  &&  Map == NULL );
+   int MapFailed_AnyRank;
+
+   MPI_Allreduce( &MapFailed_ThisRank, &MapFailed_AnyRank, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD );
+
+   if ( MapFailed_AnyRank )
+   {
+      if ( Map != NULL )   munmap( (void*)Map, InputSize );
+      Map = NULL;
+
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : failed to map the RESTART file --> load data by %d rank(s) at a time !!\n",
+                      RESTART_LOAD_NRANK );
+   }
+
+   if ( Map != NULL )
+   {
+      PatchIdx[0] = Map + FileOffset_PatchIdx;
+
+      for (int lv=1; lv<NLv_Restart; lv++)   PatchIdx[lv] = PatchIdx[lv-1] + (long)NPatchTotal[lv-1]*4*sizeof(int);
+   }
+
+   const int NLoadRank = ( Map != NULL ) ? MPI_NRank : RESTART_LOAD_NRANK;
+
+
 
 // d. load the simulation grid data
 // =================================================================================================
@@ -367,7 +433,7 @@ void Init_ByRestart()
    long   *LBIdx0_AllRank = NULL;
    double *Load_AllRank   = NULL;
 
-   if ( MPI_Rank == 0 )
+   if ( MPI_Rank == 0  &&  Map == NULL )
    {
       File = fopen( FileName, "rb" );
       fseek( File, HeaderSize_Total, SEEK_SET );
@@ -385,7 +451,8 @@ void Init_ByRestart()
          for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
          {
 //          load the corner and son of this patch
-            fread( Load_Cr_and_Son, sizeof(int), 4, File );
+            if ( Map != NULL )   memcpy( Load_Cr_and_Son, PatchIdx[lv]+(long)LoadPID*4*sizeof(int), 4*sizeof(int) );
+            else                 fread( Load_Cr_and_Son, sizeof(int), 4, File );
 
 //          only store the minimum LBIdx in each patch group
             if ( LoadPID%8 == 0 )
@@ -398,7 +465,7 @@ void Init_ByRestart()
                LBIdx0_AllRank[t] -= LBIdx0_AllRank[t] % 8;
             }
 
-            if ( *LoadSon == -1 )
+            if ( *LoadSon == -1  &&  Map == NULL )
             {
 //             for particles, skip NPar and GParID as well
 #              ifdef PARTICLE
@@ -416,8 +483,9 @@ void Init_ByRestart()
 //    d0-2. set the cut points
 //    --> do NOT consider load-balance weighting of particles since at this point we don't have that information
       const double ParWeight_Zero = 0.0;
+      const bool   Incremental_No = false;
       LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank,
-                      Load_AllRank, ParWeight_Zero );
+                      Load_AllRank, ( MPI_Rank == 0 ) ? NPatchTotal[lv]/8 : 0, ParWeight_Zero, Incremental_No );
 
       if ( MPI_Rank == 0 )
       {
@@ -426,12 +494,19 @@ void Init_ByRestart()
       }
    } // for (int lv=0; lv<NLv_Restart; lv++)
 
-   if ( MPI_Rank == 0 )    fclose( File );
+   if ( MPI_Rank == 0  &&  Map == NULL )  fclose( File );
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Setting load-balance cut points ... done\n" );
 #  endif // #ifdef LOAD_BALANCE
 
 
 // begin to load data
+   const long RecordSize_NonLeaf = 4*sizeof(int);      // 4 = corner(3) + son(1)
+#  ifdef PARTICLE
+   const long RecordSize_Leaf    = RecordSize_NonLeaf + 2*sizeof(long) + PatchDataSize;
+#  else
+   const long RecordSize_Leaf    = RecordSize_NonLeaf + PatchDataSize;
+#  endif
+
    long Offset = HeaderSize_Total;
    int  PID;
 #  ifndef LOAD_BALANCE
@@ -440,13 +515,13 @@ void Init_ByRestart()
 
    for (int lv=0; lv<NLv_Restart; lv++)
    {
-      for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+      for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
       {
          if ( MPI_Rank == 0 )
             Aux_Message( stdout, "   Loading grid data at level %2d, MPI ranks %4d -- %4d ... ",
-                         lv, TRanks, MIN(TRanks+RESTART_LOAD_NRANK-1, MPI_NRank-1) );
+                         lv, TRanks, MIN(TRanks+NLoadRank-1, MPI_NRank-1) );
 
-         if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+         if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
          {
 //          d1. set the range of the target sub-domain
 #           ifndef LOAD_BALANCE
@@ -458,39 +533,66 @@ void Init_ByRestart()
 #           endif
 
 
-            File = fopen( FileName, "rb" );
-            fseek( File, Offset, SEEK_SET );
-
-            for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
+//          d2-d3. copy the patches within the target range from the mapped file
+//          --> find these patches and their file offsets from the patch index first so that the operating system
+//              can be advised to read ahead each contiguous range of them
+            if ( Map != NULL )
             {
-//             d2. load the corner and son of this patch
-               fread( Load_Cr_and_Son, sizeof(int), 4, File );
+               const long PageSize   = sysconf( _SC_PAGESIZE );
+               long      *RecOffset  = new long [ NPatchTotal[lv] + 1 ];
+               bool      *LoadThis   = new bool [ NPatchTotal[lv] ];
 
-               for (int d=0; d<3; d++)    LoadCorner[d] *= rescale;
+               RecOffset[0] = FileOffset_Level[lv];
 
+               for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
+               {
+                  memcpy( Load_Cr_and_Son, PatchIdx[lv]+(long)LoadPID*4*sizeof(int), 4*sizeof(int) );
 
-//             verify that the loaded patch is within the target range
-#              ifdef LOAD_BALANCE
-               if (  MPI_Rank == LB_Index2Rank( lv, LB_Corner2Index(lv,LoadCorner,CHECK_ON), CHECK_ON )  )
-#              else
-               if (  LoadCorner[0] >= TargetRange_Min[0]  &&  LoadCorner[0] < TargetRange_Max[0]  &&
-                     LoadCorner[1] >= TargetRange_Min[1]  &&  LoadCorner[1] < TargetRange_Max[1]  &&
-                     LoadCorner[2] >= TargetRange_Min[2]  &&  LoadCorner[2] < TargetRange_Max[2]     )
-#              endif
+                  for (int d=0; d<3; d++)    LoadCorner[d] *= rescale;
+
+                  RecOffset[ LoadPID + 1 ] = RecOffset[LoadPID] + ( ( *LoadSon == -1 ) ? RecordSize_Leaf : RecordSize_NonLeaf );
+
+#                 ifdef LOAD_BALANCE
+                  LoadThis[LoadPID] = (  MPI_Rank == LB_Index2Rank( lv, LB_Corner2Index(lv,LoadCorner,CHECK_ON), CHECK_ON )  );
+#                 else
+                  LoadThis[LoadPID] = (  LoadCorner[0] >= TargetRange_Min[0]  &&  LoadCorner[0] < TargetRange_Max[0]  &&
+                                         LoadCorner[1] >= TargetRange_Min[1]  &&  LoadCorner[1] < TargetRange_Max[1]  &&
+                                         LoadCorner[2] >= TargetRange_Min[2]  &&  LoadCorner[2] < TargetRange_Max[2]     );
+#                 endif
+               }
+
+               for (int PID0=0, PID1; PID0<NPatchTotal[lv]; PID0=PID1)
+               {
+                  for (PID1=PID0+1; PID1<NPatchTotal[lv]  &&  LoadThis[PID1] == LoadThis[PID0]; PID1++)  {}
+
+                  if ( LoadThis[PID0] )
+                  {
+                     const long Start = RecOffset[PID0] - RecOffset[PID0]%PageSize;
+
+                     madvise( (void*)( Map + Start ), RecOffset[PID1] - Start, MADV_WILLNEED );
+                  }
+               }
+
+               for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
                {
+                  if ( !LoadThis[LoadPID] )  continue;
+
+                  memcpy( Load_Cr_and_Son, PatchIdx[lv]+(long)LoadPID*4*sizeof(int), 4*sizeof(int) );
+
+                  for (int d=0; d<3; d++)    LoadCorner[d] *= rescale;
+
                   amr->pnew( lv, LoadCorner[0], LoadCorner[1], LoadCorner[2], -1, true, true, true );
 
-//                d3. load the physical data if it is a leaf patch
                   if ( *LoadSon == -1 )
                   {
+                     const char *Ptr = Map + RecOffset[LoadPID] + 4*sizeof(int);
+
                      PID = amr->num[lv] - 1;
 
-//                   d3-0. load the particle information (for leaf patches only)
 #                    ifdef PARTICLE
-                     fread( Load_NPar_and_GParID, sizeof(long), 2, File );
+                     memcpy( Load_NPar_and_GParID, Ptr, 2*sizeof(long) );
+                     Ptr += 2*sizeof(long);
 
-//                   note that we temporarily store GParID in the LB_Idx of Sg=1
-//                   (since it's the only variable declared as long and it's useless anyway for Sg=1)
                      amr->patch[0][lv][PID]->NPar   = *Load_NPar;
                      amr->patch[1][lv][PID]->LB_Idx = *Load_GParID;
 
@@ -498,43 +600,111 @@ void Init_ByRestart()
                      MaxNParInOnePatch = MAX( MaxNParInOnePatch, *Load_NPar );
 #                    endif
 
-//                   d3-1. load the fluid variables
-                     fread( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, sizeof(real), CUBE(PS1)*NCOMP_TOTAL, File );
+                     memcpy( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, Ptr, CUBE(PS1)*NCOMP_TOTAL*sizeof(real) );
+                     Ptr += CUBE(PS1)*NCOMP_TOTAL*sizeof(real);
 
-//                   d3-2. skip gravitational potential
 #                    ifdef GRAVITY
-                     if ( LoadPot )       fseek( File, CUBE(PS1)*sizeof(real), SEEK_CUR );
+                     if ( LoadPot )       Ptr += CUBE(PS1)*sizeof(real);
 #                    endif
 
-//                   d3-3. skip particle density
 #                    ifdef PARTICLE
-                     if ( LoadParDens )   fseek( File, CUBE(PS1)*sizeof(real), SEEK_CUR );
+                     if ( LoadParDens )   Ptr += CUBE(PS1)*sizeof(real);
 #                    endif
 
-//                   d3-4. load magnetic field
 #                    ifdef MHD
-//                   skip the cell-centered data
-                     if ( LoadCCMag )     fseek( File, CUBE(PS1)*NCOMP_MAG*sizeof(real), SEEK_CUR );
+                     if ( LoadCCMag )     Ptr += CUBE(PS1)*NCOMP_MAG*sizeof(real);
 
-//                   load the face-centered data
-                     fread( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+                     memcpy( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, Ptr, PS1P1*SQR(PS1)*NCOMP_MAG*sizeof(real) );
 #                    endif
                   } // if ( *LoadSon == -1 )
-               } // within the target range
+               } // for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
 
-//             for the case that the patch is NOT within the target range
-               else if ( *LoadSon == -1 )
+               delete [] RecOffset;
+               delete [] LoadThis;
+            } // if ( Map != NULL )
+
+
+//          d2-d3. otherwise scan the file sequentially
+            else
+            {
+               File = fopen( FileName, "rb" );
+               fseek( File, Offset, SEEK_SET );
+
+               for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
                {
-//                for particles, skip NPar and GParID as well
-#                 ifdef PARTICLE
-                  fseek( File, PatchDataSize+2*sizeof(long), SEEK_CUR );
+//                d2. load the corner and son of this patch
+                  fread( Load_Cr_and_Son, sizeof(int), 4, File );
+
+                  for (int d=0; d<3; d++)    LoadCorner[d] *= rescale;
+
+
+//                verify that the loaded patch is within the target range
+#                 ifdef LOAD_BALANCE
+                  if (  MPI_Rank == LB_Index2Rank( lv, LB_Corner2Index(lv,LoadCorner,CHECK_ON), CHECK_ON )  )
 #                 else
-                  fseek( File, PatchDataSize, SEEK_CUR );
+                  if (  LoadCorner[0] >= TargetRange_Min[0]  &&  LoadCorner[0] < TargetRange_Max[0]  &&
+                        LoadCorner[1] >= TargetRange_Min[1]  &&  LoadCorner[1] < TargetRange_Max[1]  &&
+                        LoadCorner[2] >= TargetRange_Min[2]  &&  LoadCorner[2] < TargetRange_Max[2]     )
 #                 endif
-               }
-            } // for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
+                  {
+                     amr->pnew( lv, LoadCorner[0], LoadCorner[1], LoadCorner[2], -1, true, true, true );
+
+//                   d3. load the physical data if it is a leaf patch
+                     if ( *LoadSon == -1 )
+                     {
+                        PID = amr->num[lv] - 1;
+
+//                      d3-0. load the particle information (for leaf patches only)
+#                       ifdef PARTICLE
+                        fread( Load_NPar_and_GParID, sizeof(long), 2, File );
+
+//                      note that we temporarily store GParID in the LB_Idx of Sg=1
+//                      (since it's the only variable declared as long and it's useless anyway for Sg=1)
+                        amr->patch[0][lv][PID]->NPar   = *Load_NPar;
+                        amr->patch[1][lv][PID]->LB_Idx = *Load_GParID;
+
+                        NParThisRank     += *Load_NPar;
+                        MaxNParInOnePatch = MAX( MaxNParInOnePatch, *Load_NPar );
+#                       endif
+
+//                      d3-1. load the fluid variables
+                        fread( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, sizeof(real), CUBE(PS1)*NCOMP_TOTAL, File );
+
+//                      d3-2. skip gravitational potential
+#                       ifdef GRAVITY
+                        if ( LoadPot )       fseek( File, CUBE(PS1)*sizeof(real), SEEK_CUR );
+#                       endif
+
+//                      d3-3. skip particle density
+#                       ifdef PARTICLE
+                        if ( LoadParDens )   fseek( File, CUBE(PS1)*sizeof(real), SEEK_CUR );
+#                       endif
+
+//                      d3-4. load magnetic field
+#                       ifdef MHD
+//                      skip the cell-centered data
+                        if ( LoadCCMag )     fseek( File, CUBE(PS1)*NCOMP_MAG*sizeof(real), SEEK_CUR );
+
+//                      load the face-centered data
+                        fread( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+#                       endif
+                     } // if ( *LoadSon == -1 )
+                  } // within the target range
+
+//                for the case that the patch is NOT within the target range
+                  else if ( *LoadSon == -1 )
+                  {
+//                   for particles, skip NPar and GParID as well
+#                    ifdef PARTICLE
+                     fseek( File, PatchDataSize+2*sizeof(long), SEEK_CUR );
+#                    else
+                     fseek( File, PatchDataSize, SEEK_CUR );
+#                    endif
+                  }
+               } // for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
 
-            fclose( File );
+               fclose( File );
+            } // if ( Map != NULL ) ... else ...
 
 
 //          d4. record the number of the real patches and the LB_IdxList_real
@@ -550,18 +720,21 @@ void Init_ByRestart()
             for (int RPID=0; RPID<amr->NPatchComma[lv][1]; RPID++)
                amr->LB->IdxList_Real[lv][RPID] = amr->patch[0][lv][RPID]->LB_Idx;
 
-            Mis_Heapsort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+            Mis_RadixSort( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+//          the son directory at lv is no longer valid (see LB_FindSonNotHome())
+            amr->LB->ResetSonDir( lv );
 #           endif // #ifdef LOAD_BALANCE
 
             Offset += DataSize[lv];
 
-         } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+         } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
 
          MPI_Barrier( MPI_COMM_WORLD );
 
          if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
-      } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+      } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
    } // for (int lv=0; lv<NLv_Restart; lv++)
 
 
@@ -606,15 +779,15 @@ void Init_ByRestart()
    const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
 #  endif
 
-   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
    {
       if ( MPI_Rank == 0 )
          Aux_Message( stdout, "   Loading particle data, MPI ranks %4d -- %4d ... ",
-                      TRanks, MIN(TRanks+RESTART_LOAD_NRANK-1, MPI_NRank-1) );
+                      TRanks, MIN(TRanks+NLoadRank-1, MPI_NRank-1) );
 
-      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
       {
-         File = fopen( FileName, "rb" );
+         if ( Map == NULL )   File = fopen( FileName, "rb" );
 
          for (int lv=0; lv<NLEVEL; lv++)
          for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
@@ -631,10 +804,17 @@ void Init_ByRestart()
 //             load one particle attribute at a time
                for (int v=0; v<PAR_NATT_STORED; v++)
                {
-                  fseek( File, FileOffset_Particle + v*ParDataSize1v + GParID*sizeof(real), SEEK_SET );
+                  const long FileOffset_ThisVar = FileOffset_Particle + v*ParDataSize1v + GParID*sizeof(real);
 
 //                using ParBuf[v] here is safe since it's NOT called when NParThisPatch == 0
-                  fread( ParBuf[v], sizeof(real), NParThisPatch, File );
+                  if ( Map != NULL )
+                     memcpy( ParBuf[v], Map+FileOffset_ThisVar, NParThisPatch*sizeof(real) );
+
+                  else
+                  {
+                     fseek( File, FileOffset_ThisVar, SEEK_SET );
+                     fread( ParBuf[v], sizeof(real), NParThisPatch, File );
+                  }
                }
 
 //             store particles to the particle repository (one particle at a time)
@@ -664,17 +844,17 @@ void Init_ByRestart()
             } // if ( amr->patch[0][lv][PID]->NPar > 0 )
          } // for PID, lv
 
-         fclose( File );
+         if ( Map == NULL )   fclose( File );
 
          if ( amr->Par->NPar_AcPlusInac != NParThisRank )
             Aux_Error( ERROR_INFO, "total number of particles in the repository (%ld) != expect (%ld) !!\n",
                        amr->Par->NPar_AcPlusInac, NParThisRank );
-      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+NLoadRank )
 
       MPI_Barrier( MPI_COMM_WORLD );
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
-   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=NLoadRank)
 
 
 // free memory
@@ -683,6 +863,10 @@ void Init_ByRestart()
 #  endif // #ifdef PARTICLE
 
 
+// unmap the RESTART file
+   if ( Map != NULL )   munmap( (void*)Map, InputSize );
+
+
 
 // f-1. improve load balance
 // ===================================================================================================================
@@ -702,16 +886,17 @@ void Init_ByRestart()
    const double ParWeight_Zero   = 0.0;
    const bool   Redistribute_Yes = true;
    const bool   Redistribute_No  = false;
+   const bool   Incremental_No   = false;
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, Incremental_No, ParWeight_Zero, ResetLB_No, AllLv );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
 #  ifdef PARTICLE
    if ( amr->LB->Par_Weight > 0.0 )
-   LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+   LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
 #  endif
 
 
@@ -762,6 +947,15 @@ void Init_ByRestart()
    } // for (int lv=0; lv<NLEVEL; lv++)
 
 
+// initialize the descendant particle counts
+// --> must be done after FindFather() since the father <-> son relation is unknown when loading particles
+#  ifdef PARTICLE
+   for (int lv=1; lv<NLEVEL; lv++)
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      Par_UpdateDescendantCount( lv, PID, amr->patch[0][lv][PID]->NPar );
+#  endif
+
+
 // fill up the data for top-level buffer patches
    Buf_GetBufferData( NLEVEL-1, amr->FluSg[NLEVEL-1], amr->MagSg[NLEVEL-1], NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf, USELB_NO );
 
@@ -1184,8 +1378,6 @@ void Load_Parameter_After_2000( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
-
       CompareVar( "EOS",       eos,       EOS,       NonFatal );
 
 
@@ -1642,3 +1834,32 @@ void CompareVar( const char *VarName, const double RestartVar, const double Runt
    }
 
 } // FUNCTION : CompareVar (double)
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MapFile
+// Description :  Map the target file into memory as read-only
+//
+// Note        :  1. Invoked by Init_ByRestart()
+//                2. Must be unmapped by munmap() with the same size
+//
+// Parameter   :  FileName : Name of the target file
+//                Size     : Size of the target file in bytes
+//
+// Return      :  Pointer to the mapped file on success and NULL on failure
+//-------------------------------------------------------------------------------------------------------
+const char *MapFile( const char *FileName, const long Size )
+{
+
+   const int File = open( FileName, O_RDONLY );
+
+   if ( File < 0 )   return NULL;
+
+   void *Map = mmap( NULL, Size, PROT_READ, MAP_SHARED, File, 0 );
+
+   close( File );
+
+   return ( Map == MAP_FAILED ) ? NULL : (const char*)Map;
+
+} // FUNCTION : MapFile
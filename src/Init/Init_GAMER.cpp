@@ -45,6 +45,10 @@ void Init_GAMER( int *argc, char ***argv )
    Init_Load_Parameter();
 
 
+// construct the lookup tables of the space-filling curves --> must be called before constructing any patch
+   LB_SFC_Init();
+
+
 // set code units
    Init_Unit();
 
@@ -136,6 +140,7 @@ void Init_GAMER( int *argc, char ***argv )
 // initialize the timer function
 #  ifdef TIMING
    Aux_CreateTimer();
+   Aux_Trace_Init();
 #  endif
 
 
@@ -67,6 +67,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__BC_POT",                &OPT__BC_POT,                    -1,               1,             2              );
 // do not check GFUNC_COEFF0 since it may be reset by Init_ResetDefaultParameter()
    ReadPara->Add( "GFUNC_COEFF0",               &GFUNC_COEFF0,                   -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OPT__GFUNC_CACHE",           &OPT__GFUNC_CACHE,                false,           Useless_bool,  Useless_bool   );
 #  endif
 
 
@@ -83,6 +84,19 @@ void Init_Load_Parameter()
    ReadPara->Add( "PAR_PREDICT_POS",            &amr->Par->PredictPos,            true,            Useless_bool,  Useless_bool   );
 // do not check PAR_REMOVE_CELL since it may be reset by Init_ResetDefaultParameter()
    ReadPara->Add( "PAR_REMOVE_CELL",            &amr->Par->RemoveCell,           -1.0,             NoMin_double,  NoMax_double   );
+#  ifdef LOAD_BALANCE
+   ReadPara->Add( "PAR_COMPRESS_MPI",           &amr->Par->CompressMPI,           0,               0,             7              );
+#  endif
+   ReadPara->Add( "PAR_SORT_INTERVAL",          &amr->Par->SortInterval,          0,               0,             NoMax_int      );
+   ReadPara->Add( "PAR_DEPOSIT_NPAR_THREAD",    &amr->Par->DepositNParThread,     0,               0,             NoMax_int      );
+   ReadPara->Add( "PAR_COLLECT_CACHE",          &amr->Par->CollectCache,          false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "PAR_DENS_CACHE",             &amr->Par->DensCache,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "PAR_MAX_SUBCYCLE",           &amr->Par->MaxSubCycle,           0,               0,             20             );
+   ReadPara->Add( "PAR_SR_ACC",                 &amr->Par->ShortRangeAcc,         false,           Useless_bool,  Useless_bool   );
+// do not check PAR_SR_SOFTEN since it may be reset by Init_ResetDefaultParameter()
+   ReadPara->Add( "PAR_SR_SOFTEN",              &amr->Par->SR_Soften,            -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "PAR_SR_RADIUS",              &amr->Par->SR_Radius,             1.5,             Eps_double,    (double)PS1    );
+   ReadPara->Add( "PAR_FREEZE_FLU_RATIO",       &amr->Par->FreezeFluRatio,        0.0,             0.0,           NoMax_double   );
 #  endif // #ifdef PARTICLE
 
 
@@ -117,14 +131,26 @@ void Init_Load_Parameter()
    ReadPara->Add( "DT__SYNC_CHILDREN_LV",       &DT__SYNC_CHILDREN_LV,            0.1,             0.0,           1.0            );
    ReadPara->Add( "OPT__DT_USER",               &OPT__DT_USER,                    false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__DT_LEVEL",              &OPT__DT_LEVEL,                   3,               1,             3              );
+   ReadPara->Add( "OPT__DT_OPT_SUBSTEP",        &OPT__DT_OPT_SUBSTEP,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "DT__SUBSTEP_OVERHEAD",       &DT__SUBSTEP_OVERHEAD,            8.0,             0.0,           NoMax_double   );
+#  if ( MODEL == HYDRO )
+   ReadPara->Add( "OPT__DT_FLU_BYPRODUCT",      &OPT__DT_FLU_BYPRODUCT,           false,           Useless_bool,  Useless_bool   );
+#  endif
    ReadPara->Add( "OPT__RECORD_DT",             &OPT__RECORD_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT",             &AUTO_REDUCE_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR",      &AUTO_REDUCE_DT_FACTOR,           0.8,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR_MIN",  &AUTO_REDUCE_DT_FACTOR_MIN,       0.1,             0.0,           1.0            );
+#  if ( MODEL == HYDRO )
+   ReadPara->Add( "AUTO_REDUCE_DT_LOCAL",       &AUTO_REDUCE_DT_LOCAL,            false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FROZEN_REGION",         &OPT__FROZEN_REGION,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "FROZEN_REGION_NSTEP",        &FROZEN_REGION_NSTEP,             4,               1,             NoMax_int      );
+   ReadPara->Add( "FROZEN_REGION_TOL",          &FROZEN_REGION_TOL,               1.0e-4,          0.0,           NoMax_double   );
+#  endif
 
 
 // grid refinement
    ReadPara->Add( "REGRID_COUNT",               &REGRID_COUNT,                    4,               1,             NoMax_int      );
+   ReadPara->Add( "OPT__REGRID_LAZY",           &OPT__REGRID_LAZY,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "FLAG_BUFFER_SIZE",           &FLAG_BUFFER_SIZE,                PS1,             0,             PS1            );
    ReadPara->Add( "FLAG_BUFFER_SIZE_MAXM1_LV",  &FLAG_BUFFER_SIZE_MAXM1_LV,      -1,               NoMin_int,     PS1            );
    ReadPara->Add( "FLAG_BUFFER_SIZE_MAXM2_LV",  &FLAG_BUFFER_SIZE_MAXM2_LV,      -1,               NoMin_int,     PS1            );
@@ -155,12 +181,16 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__FLAG_PAR_MASS_CELL",    &OPT__FLAG_PAR_MASS_CELL,         false,           Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "OPT__NO_FLAG_NEAR_BOUNDARY", &OPT__NO_FLAG_NEAR_BOUNDARY,      false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FLAG_FLU_BYPRODUCT",    &OPT__FLAG_FLU_BYPRODUCT,         false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__PATCH_COUNT",           &OPT__PATCH_COUNT,                1,               0,             2              );
 #  ifdef PARTICLE
    ReadPara->Add( "OPT__PARTICLE_COUNT",        &OPT__PARTICLE_COUNT,             1,               0,             2              );
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
-   ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                0,               0,             2              );
+   ReadPara->Add( "OPT__PATCH_ARENA",           &OPT__PATCH_ARENA,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FIRST_TOUCH",           &OPT__FIRST_TOUCH,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__SG_ON_DEMAND",          &OPT__SG_ON_DEMAND,               false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -168,8 +198,18 @@ void Init_Load_Parameter()
    ReadPara->Add( "LB_INPUT__WLI_MAX",          &LB_INPUT__WLI_MAX,               0.1,             0.0,           NoMax_double   );
 #  ifdef PARTICLE
    ReadPara->Add( "LB_INPUT__PAR_WEIGHT",       &LB_INPUT__PAR_WEIGHT,            0.0,             0.0,           NoMax_double   );
+#  endif
+   ReadPara->Add( "LB_INPUT__MEASURED_COST",    &LB_INPUT__MEASURED_COST,         0.0,             0.0,           1.0            );
+#  ifdef SUPPORT_GRACKLE
+   ReadPara->Add( "LB_INPUT__CHE_WEIGHT",       &LB_INPUT__CHE_WEIGHT,            0.0,             0.0,           NoMax_double   );
 #  endif
    ReadPara->Add( "OPT__RECORD_LOAD_BALANCE",   &OPT__RECORD_LOAD_BALANCE,        true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_INCREMENTAL",        &OPT__LB_INCREMENTAL,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_COUPLE_LEVEL",       &OPT__LB_COUPLE_LEVEL,            false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_CURVE",              &OPT__LB_CURVE,                   1,               1,             2              );
+   ReadPara->Add( "OPT__LB_DERIVED_TYPE",       &OPT__LB_DERIVED_TYPE,            false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_DIST_GRAPH",         &OPT__LB_DIST_GRAPH,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__MPI_PROGRESS",          &OPT__MPI_PROGRESS,               false,           Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       true,            Useless_bool,  Useless_bool   );
 
@@ -191,6 +231,8 @@ void Init_Load_Parameter()
    ReadPara->Add( "GRACKLE_H2_OPA_APPROX",      &GRACKLE_H2_OPA_APPROX,           0,               0,             1              );
 // do not check CHE_GPU_NPGROUP since it may be reset by either Init_ResetDefaultParameter() or CUAPI_Set_Default_GPU_Parameter()
    ReadPara->Add( "CHE_GPU_NPGROUP",            &CHE_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "GRACKLE_ZERO_COPY",          &GRACKLE_ZERO_COPY,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "GRACKLE_SCREEN_TCOOL",       &GRACKLE_SCREEN_TCOOL,            0.0,             NoMin_double,  NoMax_double   );
 #  endif
 
 
@@ -210,7 +252,9 @@ void Init_Load_Parameter()
 
 // fluid solvers in HYDRO
 #  if ( MODEL == HYDRO )
-#  if ( EOS == EOS_GAMMA )
+#  if   ( EOS == EOS_GAMMA  &&  defined GAMMA_CONST )
+   ReadPara->Add( "GAMMA",                      &GAMMA,                           GAMMA_CONST,     1.0,           NoMax_double   );
+#  elif ( EOS == EOS_GAMMA )
    ReadPara->Add( "GAMMA",                      &GAMMA,                           5.0/3.0,         1.0,           NoMax_double   );
 #  else
    ReadPara->Add( "GAMMA",                      &GAMMA,                           __DBL_MAX__,     NoMin_double,  NoMax_double   );
@@ -220,6 +264,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "ISO_TEMP",                   &ISO_TEMP,                       -1.0,             Eps_double,    NoMax_double   );
 #  else
    ReadPara->Add( "ISO_TEMP",                   &ISO_TEMP,                       __DBL_MAX__,      NoMin_double,  NoMax_double   );
+#  endif
+#  if ( EOS == EOS_TABULAR )
+   ReadPara->Add( "EOS_TABLE_NAME",              EOS_TABLE_NAME,                  Useless_str,     Useless_str,   Useless_str    );
 #  endif
    ReadPara->Add( "MINMOD_COEFF",               &MINMOD_COEFF,                    1.5,             1.0,           2.0            );
    ReadPara->Add( "OPT__LR_LIMITER",            &OPT__LR_LIMITER,                 VL_GMINMOD,      0,             5              );
@@ -227,7 +274,7 @@ void Init_Load_Parameter()
 #  ifdef MHD
    ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,   RSOLVER_1ST_DEFAULT, NoMin_int,     4              );
 #  else
-   ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,   RSOLVER_1ST_DEFAULT, NoMin_int,     3              );
+   ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,   RSOLVER_1ST_DEFAULT, NoMin_int,     5              );
 #  endif
 #  ifdef DUAL_ENERGY
    ReadPara->Add( "DUAL_ENERGY_SWITCH",         &DUAL_ENERGY_SWITCH,              2.0e-2,          0.0,           NoMax_double   );
@@ -252,6 +299,7 @@ void Init_Load_Parameter()
 // do not check FLU_GPU_NPGROUP and GPU_NSTREAM since they may be reset by either Init_ResetDefaultParameter() or CUAPI_Set_Default_GPU_Parameter()
    ReadPara->Add( "FLU_GPU_NPGROUP",            &FLU_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "GPU_NSTREAM",                &GPU_NSTREAM,                    -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__ADAPTIVE_NPGROUP",      &OPT__ADAPTIVE_NPGROUP,           false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FIXUP_FLUX",            &OPT__FIXUP_FLUX,                 true,            Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__FIXUP_ELECTRIC",        &OPT__FIXUP_ELECTRIC,             true,            Useless_bool,  Useless_bool   );
@@ -285,6 +333,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "SOR_OMEGA",                  &SOR_OMEGA,                      -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "SOR_MAX_ITER",               &SOR_MAX_ITER,                   -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "SOR_MIN_ITER",               &SOR_MIN_ITER,                   -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "SOR_TOLERATED_ERROR",        &SOR_TOLERATED_ERROR,             0.0,             0.0,           NoMax_double   );
 // do not check MG_XXX since they may be reset by Init_Set_Default_MG_Parameter()
    ReadPara->Add( "MG_MAX_ITER",                &MG_MAX_ITER,                    -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPRE_SMOOTH",             &MG_NPRE_SMOOTH,                 -1,               NoMin_int,     NoMax_int      );
@@ -296,6 +345,23 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__GRAVITY_TYPE",          &OPT__GRAVITY_TYPE,              -1,               1,             3              );
    ReadPara->Add( "OPT__EXTERNAL_POT",          &OPT__EXTERNAL_POT,               false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__GRAVITY_EXTRA_MASS",    &OPT__GRAVITY_EXTRA_MASS,         false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FFT_PENCIL",            &OPT__FFT_PENCIL,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__POT_WARM_START",        &OPT__POT_WARM_START,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RECORD_POI_ITER",       &OPT__RECORD_POI_ITER,            false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "POT_LEVEL_NSWEEP",           &POT_LEVEL_NSWEEP,                0,               0,             NoMax_int      );
+   ReadPara->Add( "OPT__RECORD_LEVEL_PS",       &OPT__RECORD_LEVEL_PS,            0,               0,             NoMax_int      );
+   ReadPara->Add( "LEVEL_PS_LV",                &LEVEL_PS_LV,                     0,               0,             TOP_LEVEL      );
+   ReadPara->Add( "LEVEL_PS_INTERLACE",         &LEVEL_PS_INTERLACE,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__USG_POT_EXT",           &OPT__USG_POT_EXT,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__USG_FUSE_EXT_ACC",      &OPT__USG_FUSE_EXT_ACC,           false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "EXT_POT_TABLE_NAME",          EXT_POT_TABLE_NAME,              Useless_str,     Useless_str,   Useless_str    );
+   ReadPara->Add( "EXT_POT_TABLE_NPOINT_X",     &EXT_POT_TABLE_NPOINT[0],        -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EXT_POT_TABLE_NPOINT_Y",     &EXT_POT_TABLE_NPOINT[1],        -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EXT_POT_TABLE_NPOINT_Z",     &EXT_POT_TABLE_NPOINT[2],        -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EXT_POT_TABLE_DH",           &EXT_POT_TABLE_DH,               -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EXT_POT_TABLE_EDGEL_X",      &EXT_POT_TABLE_EDGEL[0],          0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EXT_POT_TABLE_EDGEL_Y",      &EXT_POT_TABLE_EDGEL[1],          0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EXT_POT_TABLE_EDGEL_Z",      &EXT_POT_TABLE_EDGEL[2],          0.0,             NoMin_double,  NoMax_double   );
 #  endif // #ifdef GRAVITY
 
 
@@ -303,6 +369,8 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__INIT",                  &OPT__INIT,                      -1,               1,             3              );
    ReadPara->Add( "RESTART_LOAD_NRANK",         &RESTART_LOAD_NRANK,              1,               1,             NoMax_int      );
    ReadPara->Add( "OPT__RESTART_RESET",         &OPT__RESTART_RESET,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RESTART_BULK",          &OPT__RESTART_BULK,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RESTART_LOCAL",         &OPT__RESTART_LOCAL,              false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__UM_IC_LEVEL",           &OPT__UM_IC_LEVEL,                0,               0,             TOP_LEVEL      );
 // do not check OPT__UM_IC_NVAR since it depends on OPT__INIT and MODEL
 // --> also, we do not load the density field for ELBDM
@@ -316,15 +384,23 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__UM_IC_REFINE",          &OPT__UM_IC_REFINE,               true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__UM_IC_LOAD_NRANK",      &OPT__UM_IC_LOAD_NRANK,           1,               1,             NoMax_int      );
    ReadPara->Add( "OPT__INIT_RESTRICT",         &OPT__INIT_RESTRICT,              true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__INIT_REFINE_MAP",       &OPT__INIT_REFINE_MAP,            0,               0,             2              );
    ReadPara->Add( "OPT__INIT_GRID_WITH_OMP",    &OPT__INIT_GRID_WITH_OMP,         true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__GPUID_SELECT",          &OPT__GPUID_SELECT,              -1,              -3,             NoMax_int      );
    ReadPara->Add( "INIT_SUBSAMPLING_NCELL",     &INIT_SUBSAMPLING_NCELL,          0,               0,             NoMax_int      );
+   ReadPara->Add( "INIT_SUBSAMPLING_TOL",       &INIT_SUBSAMPLING_TOL,            0.0,             0.0,           NoMax_double   );
 #  ifdef MHD
    ReadPara->Add( "OPT__INIT_BFIELD_BYFILE",    &OPT__INIT_BFIELD_BYFILE,         false,           Useless_bool,  Useless_bool   );
 #  endif
 
 // interpolation schemes
    ReadPara->Add( "OPT__INT_TIME",              &OPT__INT_TIME,                   true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__INT_TIME_LAZY",         &OPT__INT_TIME_LAZY,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__GHOST_CACHE",           &OPT__GHOST_CACHE,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PREP_COST_ORDER",       &OPT__PREP_COST_ORDER,            false,           Useless_bool,  Useless_bool   );
+#  ifdef MHD
+   ReadPara->Add( "OPT__EMAG_CACHE",            &OPT__EMAG_CACHE,                 false,           Useless_bool,  Useless_bool   );
+#  endif
 #  if ( MODEL == ELBDM )
    ReadPara->Add( "OPT__INT_PHASE",             &OPT__INT_PHASE,                  true,            Useless_bool,  Useless_bool   );
 #  endif
@@ -353,6 +429,37 @@ void Init_Load_Parameter()
 
 // data dump
    ReadPara->Add( "OPT__OUTPUT_TOTAL",          &OPT__OUTPUT_TOTAL,               1,               0,             2              );
+   ReadPara->Add( "OPT__OUTPUT_MPIIO",          &OPT__OUTPUT_MPIIO,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_ASYNC",          &OPT__OUTPUT_ASYNC,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_COMPRESS",       &OPT__OUTPUT_COMPRESS,            0,               0,             9              );
+   ReadPara->Add( "OPT__OUTPUT_SHUFFLE",        &OPT__OUTPUT_SHUFFLE,             true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_CHUNK_NPATCH",   &OPT__OUTPUT_CHUNK_NPATCH,        8,               1,             NoMax_int      );
+   ReadPara->Add( "OPT__OUTPUT_INDEX",          &OPT__OUTPUT_INDEX,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__CKPT_LOCAL",            &OPT__CKPT_LOCAL,                 0,               0,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_SUB_STEP",            &OUTPUT_SUB_STEP,                 0,               0,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_SUB_LV_MIN",          &OUTPUT_SUB_LV_MIN,               0,               0,             TOP_LEVEL      );
+   ReadPara->Add( "OUTPUT_SUB_LV_MAX",          &OUTPUT_SUB_LV_MAX,               TOP_LEVEL,       0,             TOP_LEVEL      );
+   ReadPara->Add( "OUTPUT_SUB_FIELD",           &OUTPUT_SUB_FIELD,               -1L,              -1L,           NoMax_long     );
+   ReadPara->Add( "OUTPUT_SUB_EDGEL_X",         &OUTPUT_SUB_EDGEL[0],             0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_SUB_EDGEL_Y",         &OUTPUT_SUB_EDGEL[1],             0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_SUB_EDGEL_Z",         &OUTPUT_SUB_EDGEL[2],             0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_SUB_EDGER_X",         &OUTPUT_SUB_EDGER[0],            -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_SUB_EDGER_Y",         &OUTPUT_SUB_EDGER[1],            -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_SUB_EDGER_Z",         &OUTPUT_SUB_EDGER[2],            -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_STEP",             &OUTPUT_UG_STEP,                  0,               0,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_UG_LV",               &OUTPUT_UG_LV,                    0,               0,             TOP_LEVEL      );
+   ReadPara->Add( "OUTPUT_UG_EDGEL_X",          &OUTPUT_UG_EDGEL[0],              0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_EDGEL_Y",          &OUTPUT_UG_EDGEL[1],              0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_EDGEL_Z",          &OUTPUT_UG_EDGEL[2],              0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_EDGER_X",          &OUTPUT_UG_EDGER[0],             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_EDGER_Y",          &OUTPUT_UG_EDGER[1],             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_UG_EDGER_Z",          &OUTPUT_UG_EDGER[2],             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_DIAG_STEP",           &OUTPUT_DIAG_STEP,                0,               0,             NoMax_int      );
+   ReadPara->Add( "OUTPUT_DIAG_FIELD",          &OUTPUT_DIAG_FIELD,              _DENS,            -1L,           NoMax_long     );
+   ReadPara->Add( "OUTPUT_DIAG_PROJ_LV",        &OUTPUT_DIAG_PROJ_LV,             0,               0,             TOP_LEVEL      );
+   ReadPara->Add( "OUTPUT_DIAG_PROF_RMAX",      &OUTPUT_DIAG_PROF_RMAX,          -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_DIAG_PROF_LOGR",      &OUTPUT_DIAG_PROF_LOGR,           1.25,            Eps_double,    NoMax_double   );
+   ReadPara->Add( "OUTPUT_DIAG_PHASE_NBIN",     &OUTPUT_DIAG_PHASE_NBIN,          64,              0,             NoMax_int      );
    ReadPara->Add( "OPT__OUTPUT_PART",           &OPT__OUTPUT_PART,                0,               0,             7              );
    ReadPara->Add( "OPT__OUTPUT_USER",           &OPT__OUTPUT_USER,                false,           Useless_bool,  Useless_bool   );
 #  ifdef PARTICLE
@@ -360,6 +467,7 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__OUTPUT_BASEPS",         &OPT__OUTPUT_BASEPS,              false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OUTPUT_BASE",           &OPT__OUTPUT_BASE,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_TEXT_BINARY",    &OPT__OUTPUT_TEXT_BINARY,         false,           Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__OUTPUT_CC_MAG",         &OPT__OUTPUT_CC_MAG,              true,            Useless_bool,  Useless_bool   );
 #  endif
@@ -384,6 +492,10 @@ void Init_Load_Parameter()
 #  ifdef SUPPORT_LIBYT
    ReadPara->Add( "YT_SCRIPT",                   YT_SCRIPT,                       Useless_str,     Useless_str,   Useless_str    );
    ReadPara->Add( "YT_VERBOSE",           (int*)&YT_VERBOSE,                      1,               0,             3              );
+   ReadPara->Add( "YT_STEP",                    &YT_STEP,                         1,               1,             NoMax_int      );
+   ReadPara->Add( "YT_ASYNC",                   &YT_ASYNC,                        false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "YT_ASYNC_NCORE",             &YT_ASYNC_NCORE,                  1,               0,             NoMax_int      );
+   ReadPara->Add( "YT_ASYNC_MAX_MEM",           &YT_ASYNC_MAX_MEM,                1.0e3,           0.0,           NoMax_double   );
 #  endif
 
 
@@ -393,10 +505,19 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__TIMING_BARRIER",        &OPT__TIMING_BARRIER,            -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__TIMING_BALANCE",        &OPT__TIMING_BALANCE,             false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__TIMING_MPI",            &OPT__TIMING_MPI,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__TIMING_COUNTER",        &OPT__TIMING_COUNTER,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__TRACE",                 &OPT__TRACE,                      false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "TRACE_NEVENT",               &TRACE_NEVENT,                    100000,          1,             NoMax_int      );
    ReadPara->Add( "OPT__RECORD_NOTE",           &OPT__RECORD_NOTE,                true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_UNPHY",          &OPT__RECORD_UNPHY,               true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RECORD_CONSERVATION",   &OPT__RECORD_CONSERVATION,        false,           Useless_bool,  Useless_bool   );
+#  ifdef MHD
+   ReadPara->Add( "OPT__RECORD_DIVB",           &OPT__RECORD_DIVB,                true,            Useless_bool,  Useless_bool   );
+#  endif
    ReadPara->Add( "OPT__RECORD_MEMORY",         &OPT__RECORD_MEMORY,              true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_PERFORMANCE",    &OPT__RECORD_PERFORMANCE,         true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RECORD_TELEMETRY",      &OPT__RECORD_TELEMETRY,           0,               0,             NoMax_int      );
+   ReadPara->Add( "OPT__RECORD_PATCH_COST",     &OPT__RECORD_PATCH_COST,          false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__MANUAL_CONTROL",        &OPT__MANUAL_CONTROL,             true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_USER",           &OPT__RECORD_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OPTIMIZE_AGGRESSIVE",   &OPT__OPTIMIZE_AGGRESSIVE,        false,           Useless_bool,  Useless_bool   );
@@ -414,6 +535,7 @@ void Init_Load_Parameter()
 #  if ( MODEL == HYDRO )
    ReadPara->Add( "OPT__CK_NEGATIVE",           &OPT__CK_NEGATIVE,                0,               0,             3              );
 #  endif
+   ReadPara->Add( "OPT__CK_FLU_OUTPUT",         &OPT__CK_FLU_OUTPUT,              0,               0,             2              );
    ReadPara->Add( "OPT__CK_MEMFREE",            &OPT__CK_MEMFREE,                 1.0,             0.0,           NoMax_double   );
 #  ifdef PARTICLE
    ReadPara->Add( "OPT__CK_PARTICLE",           &OPT__CK_PARTICLE,                false,           Useless_bool,  Useless_bool   );
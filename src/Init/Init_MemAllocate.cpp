@@ -53,10 +53,17 @@ void Init_MemAllocate()
 // c. allocate load-balance variables
 #  ifdef LOAD_BALANCE
 #  ifdef PARTICLE
-   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, LB_INPUT__PAR_WEIGHT );
+   const double Par_Weight = LB_INPUT__PAR_WEIGHT;
 #  else
-   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, NULL_REAL );
+   const double Par_Weight = NULL_REAL;
 #  endif
+#  ifdef SUPPORT_GRACKLE
+   const double Che_Weight = LB_INPUT__CHE_WEIGHT;
+#  else
+   const double Che_Weight = NULL_REAL;
+#  endif
+
+   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, Par_Weight, LB_INPUT__MEASURED_COST, Che_Weight );
 #  endif // #ifdef LOAD_BALANCE
 
 
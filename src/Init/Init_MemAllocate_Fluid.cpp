@@ -7,7 +7,7 @@
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 extern real (*h_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
 extern real (*h_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
+extern real_fc (*h_FC_Var)[6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
 extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
 #ifdef MHD
 extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
@@ -15,6 +15,14 @@ extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
 #endif
 #endif // FLU_SCHEME
 
+#if ( MODEL == HYDRO )
+extern int   *FailPG_PID0;
+extern real (*FailPG_Flux)[6][NFLUX_TOTAL][ SQR(PS2) ];
+#endif
+
+static void FirstTouch_PerPatchGroup( void *Array, const long Size_1PG, const int NPG );
+static void FirstTouch_PerThread( void *Array, const long Size_1PG, const int NPG );
+
 
 
 
@@ -22,7 +30,13 @@ extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
 // Function    :  Init_MemAllocate_Fluid
 // Description :  Allocate memory for the fluid solver
 //
-// Note        :  Work when using CPUs only
+// Note        :  1. Work when using CPUs only
+//                2. For OPT__FIRST_TOUCH, the memory pages are first touched by the OpenMP threads (instead of
+//                   the master thread) so that they are distributed over the NUMA nodes
+//                   --> Per-thread scratch arrays of the CPU solvers (e.g., h_FC_Var, h_PriVar) are touched by the
+//                       thread that uses them (i.e., array_idx == omp_get_thread_num())
+//                   --> Input/output arrays shared by all threads (e.g., h_Flu_Array_F_In) are touched by all
+//                       threads with a static schedule since the patch groups are assigned to threads dynamically
 //-------------------------------------------------------------------------------------------------------
 void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGroup )
 {
@@ -70,20 +84,160 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
 
 
 #  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-   h_FC_Var      = new real [Flu_NPatchGroup][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
+   h_FC_Var      = new real_fc [Flu_NPatchGroup][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
    h_FC_Flux     = new real [Flu_NPatchGroup][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
    h_PriVar      = new real [Flu_NPatchGroup]   [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
-#  if ( LR_SCHEME == PPM )
+#  if ( LR_SCHEME == PPM  &&  !defined LR_SLOPE_FUSED )
    h_Slope_PPM   = new real [Flu_NPatchGroup][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
 #  endif
 #  ifdef MHD
    h_FC_Mag_Half = new real [Flu_NPatchGroup][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
+#  if ( !defined MHD_CT_FUSED  ||  FLU_SCHEME == CTU )
    h_EC_Ele      = new real [Flu_NPatchGroup][NCOMP_MAG][ CUBE(N_EC_ELE)          ];
 #  endif
+#  endif
 #  endif // FLU_SCHEME
 
+#  if ( MODEL == HYDRO )
+   if ( AUTO_REDUCE_DT_LOCAL )
+   {
+      FailPG_PID0 = new int  [Flu_NPatchGroup];
+      FailPG_Flux = new real [Flu_NPatchGroup][6][NFLUX_TOTAL][ SQR(PS2) ];
+   }
+#  endif
+
+
+// first touch the allocated memory
+   if ( OPT__FIRST_TOUCH )
+   {
+      for (int t=0; t<2; t++)
+      {
+         FirstTouch_PerPatchGroup( h_Flu_Array_F_In [t], sizeof(*h_Flu_Array_F_In [t]), Flu_NPatchGroup );
+         FirstTouch_PerPatchGroup( h_Flu_Array_F_Out[t], sizeof(*h_Flu_Array_F_Out[t]), Flu_NPatchGroup );
+
+         if ( amr->WithFlux )
+         FirstTouch_PerPatchGroup( h_Flux_Array     [t], sizeof(*h_Flux_Array     [t]), Flu_NPatchGroup );
+
+#        ifdef MHD
+         FirstTouch_PerPatchGroup( h_Mag_Array_F_In [t], sizeof(*h_Mag_Array_F_In [t]), Flu_NPatchGroup );
+         FirstTouch_PerPatchGroup( h_Mag_Array_F_Out[t], sizeof(*h_Mag_Array_F_Out[t]), Flu_NPatchGroup );
+#        endif
+      }
+
+#     if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+      FirstTouch_PerThread( h_FC_Var,      sizeof(*h_FC_Var),      Flu_NPatchGroup );
+      FirstTouch_PerThread( h_FC_Flux,     sizeof(*h_FC_Flux),     Flu_NPatchGroup );
+      FirstTouch_PerThread( h_PriVar,      sizeof(*h_PriVar),      Flu_NPatchGroup );
+#     if ( LR_SCHEME == PPM  &&  !defined LR_SLOPE_FUSED )
+      FirstTouch_PerThread( h_Slope_PPM,   sizeof(*h_Slope_PPM),   Flu_NPatchGroup );
+#     endif
+#     ifdef MHD
+      FirstTouch_PerThread( h_FC_Mag_Half, sizeof(*h_FC_Mag_Half), Flu_NPatchGroup );
+#     if ( !defined MHD_CT_FUSED  ||  FLU_SCHEME == CTU )
+      FirstTouch_PerThread( h_EC_Ele,      sizeof(*h_EC_Ele),      Flu_NPatchGroup );
+#     endif
+#     endif
+#     endif // FLU_SCHEME
+   } // if ( OPT__FIRST_TOUCH )
+
+
+// record the memory consumption for Aux_GetMemInfo()
+   long HostSize = Flu_NPatchGroup*( sizeof(*h_Flu_Array_F_In[0]) + sizeof(*h_Flu_Array_F_Out[0]) )
+                 + dt_NPatch*sizeof(real) + Flu_NPatch*sizeof(*h_Flu_Array_T[0]);
+
+   if ( amr->WithFlux )
+   HostSize += Flu_NPatchGroup*sizeof(*h_Flux_Array[0]);
+
+#  ifdef UNSPLIT_GRAVITY
+   HostSize += Flu_NPatchGroup*sizeof(*h_Pot_Array_USG_F[0]);
+
+   if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
+   HostSize += Flu_NPatchGroup*sizeof(*h_Corner_Array_F[0]);
+#  endif
+
+#  ifdef DUAL_ENERGY
+   HostSize += Flu_NPatchGroup*sizeof(*h_DE_Array_F_Out[0]);
+#  endif
+
+#  ifdef MHD
+   HostSize += Flu_NPatchGroup*( sizeof(*h_Mag_Array_F_In[0]) + sizeof(*h_Mag_Array_F_Out[0]) )
+             + Flu_NPatch*sizeof(*h_Mag_Array_T[0]);
+
+   if ( amr->WithElectric )
+   HostSize += Flu_NPatchGroup*sizeof(*h_Ele_Array[0]);
+#  endif
+
+   HostSize *= 2;
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   HostSize += Flu_NPatchGroup*( sizeof(*h_FC_Var) + sizeof(*h_FC_Flux) + sizeof(*h_PriVar) );
+#  if ( LR_SCHEME == PPM  &&  !defined LR_SLOPE_FUSED )
+   HostSize += Flu_NPatchGroup*sizeof(*h_Slope_PPM);
+#  endif
+#  ifdef MHD
+   HostSize += Flu_NPatchGroup*sizeof(*h_FC_Mag_Half);
+#  if ( !defined MHD_CT_FUSED  ||  FLU_SCHEME == CTU )
+   HostSize += Flu_NPatchGroup*sizeof(*h_EC_Ele);
+#  endif
+#  endif
+#  endif // FLU_SCHEME
+
+#  if ( MODEL == HYDRO )
+   if ( AUTO_REDUCE_DT_LOCAL )
+   HostSize += Flu_NPatchGroup*( sizeof(*FailPG_PID0) + sizeof(*FailPG_Flux) );
+#  endif
+
+   Aux_GetMemInfo_AddSolver( HostSize );
+
 } // FUNCTION : Init_MemAllocate_Fluid
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FirstTouch_PerPatchGroup
+// Description :  Zero out an array shared by all OpenMP threads with a static schedule over patch groups
+//
+// Parameter   :  Array    : Target array
+//                Size_1PG : Size of one patch group in bytes
+//                NPG      : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void FirstTouch_PerPatchGroup( void *Array, const long Size_1PG, const int NPG )
+{
+
+#  pragma omp parallel for schedule( static )
+   for (int PG=0; PG<NPG; PG++)  memset( (char*)Array + PG*Size_1PG, 0, Size_1PG );
+
+} // FUNCTION : FirstTouch_PerPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FirstTouch_PerThread
+// Description :  Zero out the slice of a per-thread scratch array by the thread using it
+//
+// Note        :  1. The CPU solvers use slice omp_get_thread_num() of these arrays
+//                2. Slices beyond the number of threads are never used by the CPU solvers and are left untouched
+//
+// Parameter   :  Array    : Target array
+//                Size_1PG : Size of one slice in bytes
+//                NPG      : Number of slices
+//-------------------------------------------------------------------------------------------------------
+void FirstTouch_PerThread( void *Array, const long Size_1PG, const int NPG )
+{
+
+#  pragma omp parallel
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+
+      if ( TID < NPG )  memset( (char*)Array + TID*Size_1PG, 0, Size_1PG );
+   }
+
+} // FUNCTION : FirstTouch_PerThread
+
+
+
 #endif // #ifndef GPU
@@ -1,5 +1,6 @@
 #include "GAMER.h"
 
+extern int MemoryPool_HighWater[NLEVEL];
 
 
 
@@ -13,6 +14,13 @@
 //                2. Preallocate patches with both fluid and pot data allocated
 //                3. Controlled by the option "OPT__MEMORY_POOL"
 //                   --> Must turn on "OPT__REUSE_MEMORY" as well
+//                4. OPT__MEMORY_POOL == 2 : load the table "Record__MemoryPool" recorded by Aux_Record_MemoryPool()
+//                   in the previous run instead
+//                   --> It has the same format as "Input__MemoryPool" and stores the high-water mark of the number
+//                       of patches per rank at each level
+//                   --> Rescale the numbers by the ratio of the previous and current numbers of MPI ranks
+//                   --> Skip the preallocation if the table does not exist, in which case the pool will be
+//                       built up by Aux_MemoryPool_Grow() during the run
 //
 // Parameter   :  None
 //
@@ -27,23 +35,47 @@ void Init_MemoryPool()
    if ( ! OPT__REUSE_MEMORY )    Aux_Error( ERROR_INFO, "Please turn on OPT__REUSE_MEMORY for OPT__MEMORY_POOL !!\n" );
 
 
-   const char FileName[] = "Input__MemoryPool";
+   const char *FileName = ( OPT__MEMORY_POOL == 2 ) ? "Record__MemoryPool" : "Input__MemoryPool";
 
-   if ( !Aux_CheckFileExist(FileName) )   Aux_Error( ERROR_INFO, "file \"%s\" does not exist !!\n", FileName );
+   if ( !Aux_CheckFileExist(FileName) )
+   {
+      if ( OPT__MEMORY_POOL == 2 )
+      {
+         if ( MPI_Rank == 0 )
+         {
+            Aux_Message( stdout, "   File \"%s\" does not exist --> patches will be added to the pool during the run\n",
+                         FileName );
+            Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+         }
+
+         return;
+      }
+
+      else
+         Aux_Error( ERROR_INFO, "file \"%s\" does not exist !!\n", FileName );
+   }
 
    FILE *File = fopen( FileName, "r" );
 
    char  *input_line = NULL;
    size_t len = 0;
-   int    Trash, n;
+   int    Trash, n, Record_NRank = MPI_NRank;
 
    int *NPatchInPool = new int [MAX_LEVEL+1];
 
    for (int lv=0; lv<=MAX_LEVEL; lv++)    NPatchInPool[lv] = 0;
 
 // skip the header
+// --> the header of Record__MemoryPool also records the number of MPI ranks
    getline( &input_line, &len, File );
 
+   if ( OPT__MEMORY_POOL == 2 )
+   {
+      const char *NRank_Str = strstr( input_line, "MPI_NRank =" );
+
+      if ( NRank_Str != NULL )   sscanf( NRank_Str+11, "%d", &Record_NRank );
+   }
+
 // begin to read
    for (int lv=0; lv<=MAX_LEVEL; lv++)
    {
@@ -62,6 +94,16 @@ void Init_MemoryPool()
       }
 
       sscanf( input_line, "%d%d", &Trash, NPatchInPool+lv );
+
+//    rescale the high-water mark per rank recorded with a different number of MPI ranks
+//    --> and round up to a multiple of patch group
+      if ( OPT__MEMORY_POOL == 2 )
+      {
+         const long NPatch = ( (long)NPatchInPool[lv]*Record_NRank + MPI_NRank - 1 ) / MPI_NRank;
+
+         MemoryPool_HighWater[lv] = (int)MIN( NPatch,             (long)__INT_MAX__ );
+         NPatchInPool        [lv] = (int)MIN( ( NPatch + 7 )/8*8, (long)__INT_MAX__/8*8 );
+      }
    }
 
    fclose( File );
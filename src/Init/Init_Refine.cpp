@@ -17,6 +17,12 @@ void Init_Refine( const int lv )
    if ( lv == NLEVEL-1 )   Aux_Error( ERROR_INFO, "refine the maximum level !!\n" );
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after refinement
+#  ifdef PARTICLE
+   Par_CollectParticle2OneLevel_InvalidateCache();
+#  endif
+
+
    const int Width = PATCH_SIZE*amr->scale[lv+1];
    bool AllocData[8];         // allocate data or not
    int *Cr;
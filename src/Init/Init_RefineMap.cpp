@@ -0,0 +1,230 @@
+#include "GAMER.h"
+
+// sorted 1D indices of the refined patches at each level loaded from the refinement map
+// --> NULL if the map is not loaded
+static ulong *RefineMap_Idx[NLEVEL];
+static int    RefineMap_N  [NLEVEL];
+static bool   RefineMap_Loaded = false;
+
+static void GetNPatch( const int lv, int NPatch[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_RefineMap_Load
+// Description :  Load the refinement map used to build the initial AMR hierarchy without flagging
+//
+// Note        :  1. Load the table "Input__RefineMap" for OPT__INIT_REFINE_MAP == 1 and the table "Record__RefineMap"
+//                   recorded by Aux_Record_RefineMap() in the previous run for OPT__INIT_REFINE_MAP == 2
+//                   --> Skip the map and use the regular flagging if "Record__RefineMap" does not exist
+//                2. Each row lists the level and the corner of a patch to be refined in the unit of cells at that
+//                   level (i.e., corner/amr->scale[lv])
+//                   --> Currently the table must have one header line
+//                   --> Patches at MAX_LEVEL or outside the simulation domain are ignored
+//                   --> The map must be recorded with the same base-level resolution
+//                3. The map defines the entire hierarchy
+//                   --> Levels without any entry will not be refined
+//                   --> Flag_Real() and all refinement criteria are bypassed
+//                4. Every rank loads the whole map, which is small compared to the patch data
+//                5. Invoked by Init_ByFunction() and LB_Init_ByFunction()
+//                   --> Must call Init_RefineMap_Free() afterward
+//
+// Parameter   :  None
+//
+// Return      :  true  --> map is loaded
+//                false --> map is not used
+//-------------------------------------------------------------------------------------------------------
+bool Init_RefineMap_Load()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      RefineMap_Idx[lv] = NULL;
+      RefineMap_N  [lv] = 0;
+   }
+
+   RefineMap_Loaded = false;
+
+   if ( OPT__INIT_REFINE_MAP == 0 )    return false;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   %s ...\n", __FUNCTION__ );
+
+
+   const char *FileName = ( OPT__INIT_REFINE_MAP == 2 ) ? "Record__RefineMap" : "Input__RefineMap";
+
+   if ( !Aux_CheckFileExist(FileName) )
+   {
+      if ( OPT__INIT_REFINE_MAP == 2 )
+      {
+         if ( MPI_Rank == 0 )
+         {
+            Aux_Message( stdout, "      File \"%s\" does not exist --> use the regular flagging\n", FileName );
+            Aux_Message( stdout, "   %s ... done\n", __FUNCTION__ );
+         }
+
+         return false;
+      }
+
+      else
+         Aux_Error( ERROR_INFO, "file \"%s\" does not exist !!\n", FileName );
+   }
+
+
+   FILE *File = fopen( FileName, "r" );
+
+   char  *input_line = NULL;
+   size_t len = 0;
+   int    lv, Corner[3], NPatch[3], Idx3D[3], NItem;
+
+// 1. count the number of valid entries at each level
+   getline( &input_line, &len, File );    // skip the header
+
+   while ( getline( &input_line, &len, File ) != -1 )
+   {
+      NItem = sscanf( input_line, "%d%d%d%d", &lv, Corner, Corner+1, Corner+2 );
+
+      if ( NItem != 4 )          continue;
+      if ( lv < 0  ||  lv >= MAX_LEVEL )  continue;
+
+      RefineMap_N[lv] ++;
+   }
+
+
+// 2. load the 1D patch indices
+   for (lv=0; lv<MAX_LEVEL; lv++)
+   {
+      RefineMap_Idx[lv] = new ulong [ MAX( RefineMap_N[lv], 1 ) ];
+      RefineMap_N  [lv] = 0;
+   }
+
+   rewind( File );
+   getline( &input_line, &len, File );    // skip the header
+
+   while ( getline( &input_line, &len, File ) != -1 )
+   {
+      NItem = sscanf( input_line, "%d%d%d%d", &lv, Corner, Corner+1, Corner+2 );
+
+      if ( NItem != 4 )          continue;
+      if ( lv < 0  ||  lv >= MAX_LEVEL )  continue;
+
+      GetNPatch( lv, NPatch );
+
+      bool Valid = true;
+
+      for (int d=0; d<3; d++)
+      {
+         if ( Corner[d] % PS1 != 0 )
+            Aux_Error( ERROR_INFO, "corner (%d, %d, %d) at level %d in \"%s\" is not a multiple of PATCH_SIZE !!\n",
+                       Corner[0], Corner[1], Corner[2], lv, FileName );
+
+         Idx3D[d] = Corner[d] / PS1;
+
+         if ( Corner[d] < 0  ||  Idx3D[d] >= NPatch[d] )    Valid = false;
+      }
+
+      if ( Valid )   RefineMap_Idx[lv][ RefineMap_N[lv] ++ ] = Mis_Idx3D2Idx1D( NPatch, Idx3D );
+   }
+
+   fclose( File );
+
+   if ( input_line != NULL )  free( input_line );
+
+
+// 3. sort the indices for the binary search in Init_RefineMap_Flag()
+   for (lv=0; lv<MAX_LEVEL; lv++)   Mis_Heapsort( RefineMap_N[lv], RefineMap_Idx[lv], (int*)NULL );
+
+   RefineMap_Loaded = true;
+
+
+   if ( MPI_Rank == 0 )
+   {
+      for (lv=0; lv<MAX_LEVEL; lv++)
+         Aux_Message( stdout, "      Lv %2d: %10d refined patches\n", lv, RefineMap_N[lv] );
+
+      Aux_Message( stdout, "   %s ... done\n", __FUNCTION__ );
+   }
+
+   return true;
+
+} // FUNCTION : Init_RefineMap_Load
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_RefineMap_Flag
+// Description :  Set the refinement flags of all real patches at the target level according to the refinement map
+//
+// Note        :  1. Replace Flag_Real() during initialization when the map is loaded by Init_RefineMap_Load()
+//                2. Only apply to real patches
+//                   --> Buffer patches are flagged by MPI_ExchangeBoundaryFlag() and Flag_Buffer() as usual for
+//                       the serial version, and are not required by LB_Init_Refine() for LOAD_BALANCE
+//                3. Assume the map is properly nested since it is recorded from an existing AMR hierarchy
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Init_RefineMap_Flag( const int lv )
+{
+
+   if ( !RefineMap_Loaded )   Aux_Error( ERROR_INFO, "refinement map has not been loaded !!\n" );
+
+
+   int NPatch[3];
+
+   GetNPatch( lv, NPatch );
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      const int *Corner = amr->patch[0][lv][PID]->corner;
+
+      int Idx3D[3];
+
+      for (int d=0; d<3; d++)    Idx3D[d] = Corner[d] / ( PS1*amr->scale[lv] );
+
+      amr->patch[0][lv][PID]->flag = ( lv < MAX_LEVEL  &&
+                                       Mis_BinarySearch( RefineMap_Idx[lv], 0, RefineMap_N[lv]-1,
+                                                         Mis_Idx3D2Idx1D(NPatch, Idx3D) ) != -1 );
+   }
+
+} // FUNCTION : Init_RefineMap_Flag
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_RefineMap_Free
+// Description :  Free the refinement map loaded by Init_RefineMap_Load()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Init_RefineMap_Free()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] RefineMap_Idx[lv];
+
+      RefineMap_Idx[lv] = NULL;
+      RefineMap_N  [lv] = 0;
+   }
+
+   RefineMap_Loaded = false;
+
+} // FUNCTION : Init_RefineMap_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetNPatch
+// Description :  Return the number of patches along each direction covering the simulation domain at the target level
+//
+// Parameter   :  lv     : Target refinement level
+//                NPatch : Output number of patches
+//-------------------------------------------------------------------------------------------------------
+void GetNPatch( const int lv, int NPatch[] )
+{
+
+   for (int d=0; d<3; d++)    NPatch[d] = NX0_TOT[d]*( 1 << lv ) / PS1;
+
+} // FUNCTION : GetNPatch
@@ -346,6 +346,44 @@ void Init_ResetParameter()
 
       PRINT_WARNING( amr->Par->GhostSize, FORMAT_INT, "for the adopted PAR_INTERP scheme" );
    }
+
+// splitting the mass assignment of one patch across threads requires OpenMP and changes the order of summation
+#  if ( !defined OPENMP  ||  defined BITWISE_REPRODUCIBILITY )
+   if ( amr->Par->DepositNParThread > 0 )
+   {
+      amr->Par->DepositNParThread = 0;
+
+      const int PAR_DEPOSIT_NPAR_THREAD = amr->Par->DepositNParThread;
+      PRINT_WARNING( PAR_DEPOSIT_NPAR_THREAD, FORMAT_INT, "since either OPENMP is off or BITWISE_REPRODUCIBILITY is on" );
+   }
+#  endif
+
+// sub-cycling of particles relies on the KDK scheme and the particle acceleration criterion
+   if (  amr->Par->MaxSubCycle > 0  &&  ( amr->Par->Integ != PAR_INTEG_KDK || DT__PARACC <= 0.0 )  )
+   {
+      amr->Par->MaxSubCycle = 0;
+
+      const int PAR_MAX_SUBCYCLE = amr->Par->MaxSubCycle;
+      PRINT_WARNING( PAR_MAX_SUBCYCLE, FORMAT_INT, "since either PAR_INTEG != KDK or DT__PARACC <= 0.0" );
+   }
+
+// short-range correction only applies to self-gravity
+   if ( amr->Par->ShortRangeAcc  &&  OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL )
+   {
+      amr->Par->ShortRangeAcc = false;
+
+      const int PAR_SR_ACC = amr->Par->ShortRangeAcc;
+      PRINT_WARNING( PAR_SR_ACC, FORMAT_INT, "since OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL" );
+   }
+
+// default softening length of the short-range correction
+   if ( amr->Par->ShortRangeAcc  &&  amr->Par->SR_Soften <= 0.0 )
+   {
+      amr->Par->SR_Soften = 0.1*amr->dh[MAX_LEVEL];
+
+      const double PAR_SR_SOFTEN = amr->Par->SR_Soften;
+      PRINT_WARNING( PAR_SR_SOFTEN, FORMAT_FLT, "to 0.1 times the cell size at MAX_LEVEL" );
+   }
 #  endif // #ifdef PARTICLE
 
 
@@ -461,17 +499,9 @@ void Init_ResetParameter()
    }
 
 
-// turn off "OPT__OVERLAP_MPI" if (1) OVERLAP_MPI=ff, (2) SERIAL=on, (3) LOAD_BALANCE=off,
-//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE
-#  ifndef OVERLAP_MPI
-   if ( OPT__OVERLAP_MPI )
-   {
-      OPT__OVERLAP_MPI = false;
-
-      PRINT_WARNING( OPT__OVERLAP_MPI, FORMAT_INT, "since OVERLAP_MPI is disabled in the makefile" );
-   }
-#  endif
-
+// turn off "OPT__OVERLAP_MPI" if (1) SERIAL=on, (2) LOAD_BALANCE=off
+// --> it relies on the non-blocking point-to-point exchange and thus requires neither OVERLAP_MPI,
+//     OpenMP, nor multi-threaded MPI
 #  ifdef SERIAL
    if ( OPT__OVERLAP_MPI )
    {
@@ -490,24 +520,14 @@ void Init_ResetParameter()
    }
 #  endif // #ifndef LOAD_BALANCE
 
-#  ifndef OPENMP
-   if ( OPT__OVERLAP_MPI )
-   {
-      OPT__OVERLAP_MPI = false;
 
-      PRINT_WARNING( OPT__OVERLAP_MPI, FORMAT_INT, "since OPENMP is disabled" );
-   }
-#  endif
-
-#  ifndef SERIAL
-// check the level of MPI thread support
-   int MPI_Thread_Status;
-   MPI_Query_thread( &MPI_Thread_Status );
-   if ( OPT__OVERLAP_MPI  &&  MPI_Thread_Status == MPI_THREAD_SINGLE )
+// turn off "OPT__MPI_PROGRESS" if there is no exchange to overlap with computation
+#  ifdef LOAD_BALANCE
+   if ( OPT__MPI_PROGRESS  &&  !OPT__OVERLAP_MPI )
    {
-      OPT__OVERLAP_MPI = false;
+      OPT__MPI_PROGRESS = false;
 
-      PRINT_WARNING( OPT__OVERLAP_MPI, FORMAT_INT, "since the level of MPI thread support == MPI_THREAD_SINGLE" );
+      PRINT_WARNING( OPT__MPI_PROGRESS, FORMAT_INT, "since OPT__OVERLAP_MPI is disabled" );
    }
 #  endif
 
@@ -530,6 +550,137 @@ void Init_ResetParameter()
    }
 
 
+// bulk restart is only supported with LOAD_BALANCE
+#  ifndef LOAD_BALANCE
+   if ( OPT__RESTART_BULK )
+   {
+      OPT__RESTART_BULK = false;
+
+      PRINT_WARNING( OPT__RESTART_BULK, FORMAT_INT, "since LOAD_BALANCE is disabled" );
+   }
+#  endif
+
+
+// node-local checkpoints are only supported with LOAD_BALANCE
+#  ifndef LOAD_BALANCE
+   if ( OPT__CKPT_LOCAL > 0 )
+   {
+      OPT__CKPT_LOCAL = 0;
+
+      PRINT_WARNING( OPT__CKPT_LOCAL, FORMAT_INT, "since LOAD_BALANCE is disabled" );
+   }
+
+   if ( OPT__RESTART_LOCAL )
+   {
+      OPT__RESTART_LOCAL = false;
+
+      PRINT_WARNING( OPT__RESTART_LOCAL, FORMAT_INT, "since LOAD_BALANCE is disabled" );
+   }
+#  endif
+
+// subvolume output is only supported in the HDF5 format
+#  ifndef SUPPORT_HDF5
+   if ( OUTPUT_SUB_STEP > 0 )
+   {
+      OUTPUT_SUB_STEP = 0;
+
+      PRINT_WARNING( OUTPUT_SUB_STEP, FORMAT_INT, "since SUPPORT_HDF5 is disabled" );
+   }
+
+   if ( OUTPUT_DIAG_STEP > 0 )
+   {
+      OUTPUT_DIAG_STEP = 0;
+
+      PRINT_WARNING( OUTPUT_DIAG_STEP, FORMAT_INT, "since SUPPORT_HDF5 is disabled" );
+   }
+#  endif
+
+// phase histograms of the inline diagnostics are only supported in HYDRO
+#  if ( MODEL != HYDRO )
+   if ( OUTPUT_DIAG_PHASE_NBIN > 0 )
+   {
+      OUTPUT_DIAG_PHASE_NBIN = 0;
+
+      PRINT_WARNING( OUTPUT_DIAG_PHASE_NBIN, FORMAT_INT, "since MODEL != HYDRO" );
+   }
+#  endif
+
+// set the default right edge of the subvolume output to the box size
+   for (int d=0; d<3; d++)
+   {
+      if ( OUTPUT_SUB_EDGER[d] < 0.0 )
+      {
+         OUTPUT_SUB_EDGER[d] = amr->BoxSize[d];
+
+         if ( MPI_Rank == 0  &&  OUTPUT_SUB_STEP > 0 )
+            Aux_Message( stderr, "WARNING : parameter [%-28s] is reset to [%- 21.14e]\n",
+                         ( d == 0 ) ? "OUTPUT_SUB_EDGER_X" : ( d == 1 ) ? "OUTPUT_SUB_EDGER_Y" : "OUTPUT_SUB_EDGER_Z",
+                         OUTPUT_SUB_EDGER[d] );
+      }
+   }
+
+// set the default right edge of the uniform-grid output to the box size
+   for (int d=0; d<3; d++)
+   {
+      if ( OUTPUT_UG_EDGER[d] < 0.0 )
+      {
+         OUTPUT_UG_EDGER[d] = amr->BoxSize[d];
+
+         if ( MPI_Rank == 0  &&  OUTPUT_UG_STEP > 0 )
+            Aux_Message( stderr, "WARNING : parameter [%-28s] is reset to [%- 21.14e]\n",
+                         ( d == 0 ) ? "OUTPUT_UG_EDGER_X" : ( d == 1 ) ? "OUTPUT_UG_EDGER_Y" : "OUTPUT_UG_EDGER_Z",
+                         OUTPUT_UG_EDGER[d] );
+      }
+   }
+
+   if ( OPT__RESTART_LOCAL  &&  OPT__INIT != INIT_BY_RESTART )
+   {
+      OPT__RESTART_LOCAL = false;
+
+      PRINT_WARNING( OPT__RESTART_LOCAL, FORMAT_INT, "since OPT__INIT != INIT_BY_RESTART" );
+   }
+
+
+// asynchronous output is only supported by the HDF5 snapshot and supersedes "OPT__OUTPUT_MPIIO"
+   if ( OPT__OUTPUT_ASYNC  &&  OPT__OUTPUT_TOTAL != OUTPUT_FORMAT_HDF5 )
+   {
+      OPT__OUTPUT_ASYNC = false;
+
+      PRINT_WARNING( OPT__OUTPUT_ASYNC, FORMAT_INT, "since OPT__OUTPUT_TOTAL != OUTPUT_FORMAT_HDF5" );
+   }
+
+// asynchronous output writes raw bytes to the contiguous datasets and thus supports neither compression nor
+// the chunked layout (of OPT__OUTPUT_CHUNK_NPATCH patches per chunk), which is adopted whenever OPT__OUTPUT_COMPRESS > 0
+   if ( OPT__OUTPUT_ASYNC  &&  OPT__OUTPUT_COMPRESS > 0 )
+   {
+      OPT__OUTPUT_ASYNC = false;
+
+      PRINT_WARNING( OPT__OUTPUT_ASYNC, FORMAT_INT, "since OPT__OUTPUT_COMPRESS > 0 (i.e., chunked and compressed datasets)" );
+   }
+
+   if ( OPT__OUTPUT_ASYNC  &&  OPT__OUTPUT_MPIIO )
+   {
+      OPT__OUTPUT_MPIIO = false;
+
+      PRINT_WARNING( OPT__OUTPUT_MPIIO, FORMAT_INT, "since OPT__OUTPUT_ASYNC is enabled" );
+   }
+
+// sidecar index is only supported by the HDF5 snapshot and requires contiguous (i.e., uncompressed) datasets
+   if ( OPT__OUTPUT_INDEX  &&  OPT__OUTPUT_TOTAL != OUTPUT_FORMAT_HDF5 )
+   {
+      OPT__OUTPUT_INDEX = false;
+
+      PRINT_WARNING( OPT__OUTPUT_INDEX, FORMAT_INT, "since OPT__OUTPUT_TOTAL != OUTPUT_FORMAT_HDF5" );
+   }
+
+   if ( OPT__OUTPUT_INDEX  &&  OPT__OUTPUT_COMPRESS > 0 )
+   {
+      OPT__OUTPUT_INDEX = false;
+
+      PRINT_WARNING( OPT__OUTPUT_INDEX, FORMAT_INT, "since OPT__OUTPUT_COMPRESS > 0" );
+   }
+
+
 // always turn on "OPT__VERBOSE" in the debug mode
 #  ifdef GAMER_DEBUG
    if ( !OPT__VERBOSE )
@@ -594,6 +745,15 @@ void Init_ResetParameter()
    }
 #  endif
 
+#  if ( MODEL != HYDRO )
+   if ( OPT__RECORD_CONSERVATION )
+   {
+      OPT__RECORD_CONSERVATION = false;
+
+      PRINT_WARNING( OPT__RECORD_CONSERVATION, FORMAT_INT, "since it's only supported in HYDRO" );
+   }
+#  endif
+
 
 // disable OPT__LR_LIMITER if it is useless
 #  if ( MODEL == HYDRO  &&  FLU_SCHEME != MHM  &&  FLU_SCHEME != MHM_RP  &&  FLU_SCHEME != CTU )
@@ -646,6 +806,17 @@ void Init_ResetParameter()
 #  endif
 
 
+// LEVEL_PS_INTERLACE only applies to the particle deposit
+#  if ( defined GRAVITY  &&  !defined PARTICLE )
+   if ( LEVEL_PS_INTERLACE )
+   {
+      LEVEL_PS_INTERLACE = false;
+
+      PRINT_WARNING( LEVEL_PS_INTERLACE, FORMAT_INT, "since PARTICLE is disabled" );
+   }
+#  endif
+
+
 // reset MPI_NRank_X
 #  ifdef SERIAL
    for (int d=0; d<3; d++)
@@ -696,9 +867,41 @@ void Init_ResetParameter()
 
       PRINT_WARNING( OPT__TIMING_MPI, FORMAT_INT, "since TIMING is disabled" );
    }
+
+   if ( OPT__TRACE )
+   {
+      OPT__TRACE = false;
+
+      PRINT_WARNING( OPT__TRACE, FORMAT_INT, "since TIMING is disabled" );
+   }
+
+   if ( OPT__RECORD_TELEMETRY > 0 )
+   {
+      OPT__RECORD_TELEMETRY = 0;
+
+      PRINT_WARNING( OPT__RECORD_TELEMETRY, FORMAT_INT, "since TIMING is disabled" );
+   }
+
+   if ( OPT__RECORD_PATCH_COST )
+   {
+      OPT__RECORD_PATCH_COST = false;
+
+      PRINT_WARNING( OPT__RECORD_PATCH_COST, FORMAT_INT, "since TIMING is disabled" );
+   }
 #  endif // #ifndef TIMING
 
 
+// OPT__TIMING_COUNTER only works with TIMING_SOLVER
+#  ifndef TIMING_SOLVER
+   if ( OPT__TIMING_COUNTER )
+   {
+      OPT__TIMING_COUNTER = false;
+
+      PRINT_WARNING( OPT__TIMING_COUNTER, FORMAT_INT, "since TIMING_SOLVER is disabled" );
+   }
+#  endif
+
+
 // only load-balance routines support OPT__TIMING_MPI
 #  ifndef LOAD_BALANCE
    if ( OPT__TIMING_MPI )
@@ -710,6 +913,15 @@ void Init_ResetParameter()
 #  endif
 
 
+// automatic memory pool requires OPT__REUSE_MEMORY
+   if ( OPT__MEMORY_POOL == 2  &&  !OPT__REUSE_MEMORY )
+   {
+      OPT__REUSE_MEMORY = 1;
+
+      PRINT_WARNING( OPT__REUSE_MEMORY, FORMAT_INT, "for OPT__MEMORY_POOL == 2" );
+   }
+
+
 // OPT__UM_IC_NVAR
    if ( OPT__INIT == INIT_BY_FILE  &&  OPT__UM_IC_NVAR <= 0 )
    {
@@ -797,6 +1009,37 @@ void Init_ResetParameter()
    }
 
 
+// AUTO_REDUCE_DT_LOCAL only works with AUTO_REDUCE_DT
+#  if ( MODEL == HYDRO )
+   if ( AUTO_REDUCE_DT_LOCAL  &&  !AUTO_REDUCE_DT )
+   {
+      AUTO_REDUCE_DT_LOCAL = false;
+
+      PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since AUTO_REDUCE_DT is disabled" );
+   }
+#  endif
+
+
+// OPT__FROZEN_REGION has no effect when each level takes only one sub-step per parent step
+#  if ( MODEL == HYDRO )
+   if ( OPT__FROZEN_REGION  &&  OPT__DT_LEVEL == DT_LEVEL_SHARED )
+   {
+      OPT__FROZEN_REGION = false;
+
+      PRINT_WARNING( OPT__FROZEN_REGION, FORMAT_INT, "since OPT__DT_LEVEL == DT_LEVEL_SHARED" );
+   }
+#  endif
+
+
+// OPT__DT_OPT_SUBSTEP only works for DT_LEVEL_FLEXIBLE
+   if ( OPT__DT_OPT_SUBSTEP  &&  OPT__DT_LEVEL != DT_LEVEL_FLEXIBLE )
+   {
+      OPT__DT_OPT_SUBSTEP = false;
+
+      PRINT_WARNING( OPT__DT_OPT_SUBSTEP, FORMAT_INT, "since OPT__DT_LEVEL != DT_LEVEL_FLEXIBLE" );
+   }
+
+
 // FLAG_BUFFER_SIZE at the level MAX_LEVEL-1 and MAX_LEVEL-2
    if ( FLAG_BUFFER_SIZE_MAXM1_LV < 0 )
    {
@@ -874,6 +1117,28 @@ void Init_ResetParameter()
 #  endif
 
 
+// disable OPT__FIRST_TOUCH if OPENMP is disabled
+#  ifndef OPENMP
+   if ( OPT__FIRST_TOUCH )
+   {
+      OPT__FIRST_TOUCH = false;
+
+      PRINT_WARNING( OPT__FIRST_TOUCH, FORMAT_INT, "since OPENMP is disabled" );
+   }
+#  endif
+
+
+// disable OPT__PREP_COST_ORDER if OPENMP is disabled
+#  ifndef OPENMP
+   if ( OPT__PREP_COST_ORDER )
+   {
+      OPT__PREP_COST_ORDER = false;
+
+      PRINT_WARNING( OPT__PREP_COST_ORDER, FORMAT_INT, "since OPENMP is disabled" );
+   }
+#  endif
+
+
 // remove symbolic constants and macros only used in this structure
 #  undef FORMAT_INT
 #  undef FORMAT_FLT
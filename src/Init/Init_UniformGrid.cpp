@@ -38,6 +38,7 @@ void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
 #  ifdef LOAD_BALANCE
    const bool   InputLBIdx0AndLoad_Yes = true;
    const double ParWeight_Zero         = 0.0;
+   const bool   Incremental_No         = false;
    const long   NPG_Total              = (long)NPG_EachDim[0]*(long)NPG_EachDim[1]*(long)NPG_EachDim[2];
 
    long   *LBIdx0_AllRank = NULL;
@@ -67,7 +68,7 @@ void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
 // 1.2 set CutPoint[]
 //     --> do NOT consider load-balance weighting of particles since we have not assoicated particles with patches yet
    LB_SetCutPoint( lv, NPG_Total, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
-                   ParWeight_Zero );
+                   ( MPI_Rank == 0 ) ? NPG_Total : 0, ParWeight_Zero, Incremental_No );
 
 // 1.3 free memory
    if ( MPI_Rank == 0 )
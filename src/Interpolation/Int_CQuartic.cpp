@@ -1,5 +1,9 @@
 #include "GAMER.h"
 
+static inline real CQuar_SlopeDh_4( const real InL2, const real InL1, const real InC, const real InR1, const real InR2,
+                                    const real IntCoeff[], const bool Mono, const real MonoCoeff,
+                                    const bool OppSign0thOrder );
+
 
 
 
@@ -15,6 +19,8 @@
 //		     in order
 //		  4. The "Monotonic" option is used to ensure that the interpolation results are monotonic
 //		     --> A slope limiter is adopted to ensure the monotonicity
+//                5. Each direction is interpolated pencil by pencil with a unit-stride inner loop and a branch-free
+//                   kernel (see CQuar_SlopeDh_4()) so that the compiler can vectorize it
 //
 // Parameter   :  CData	          : Input coarse-grid array
 //		  CSize	          : Size of the CData array
@@ -69,12 +75,13 @@ void Int_CQuartic( real CData[], const int CSize[3], const int CStart[3], const
    real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];   // temporary array after x interpolation
    real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];   // temporary array after y interpolation
 
-   int Idx_InL2, Idx_InL1, Idx_InC, Idx_InR1, Idx_InR2, Idx_Out;
-   real LSlopeDh_4, RSlopeDh_4, SlopeDh_4, Sign;
+   int Idx_InL1, Idx_InC;
 
 
    for (int v=0; v<NComp; v++)
    {
+      const bool Mono = Monotonic[v];
+
 //    unwrap phase along x direction
 #     if ( MODEL == ELBDM )
       if ( UnwrapPhase )
@@ -94,50 +101,22 @@ void Int_CQuartic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along x direction
       for (int In_z=CStart[2]-CGhost, Out_z=0;  In_z<CStart[2]+CRange[2]+CGhost;  In_z++, Out_z++)
       for (int In_y=CStart[1]-CGhost, Out_y=0;  In_y<CStart[1]+CRange[1]+CGhost;  In_y++, Out_y++)
-      for (int In_x=CStart[0],        Out_x=0;  In_x<CStart[0]+CRange[0];         In_x++, Out_x+=2)
       {
-         Idx_Out  = Out_z*TdzX + Out_y*Tdy + Out_x*Tdx;
-         Idx_InC  =  In_z*Cdz  +  In_y*Cdy +  In_x*Cdx;
-         Idx_InL1 = Idx_InC  - Cdx;
-         Idx_InL2 = Idx_InL1 - Cdx;
-         Idx_InR1 = Idx_InC  + Cdx;
-         Idx_InR2 = Idx_InR1 + Cdx;
-
-         SlopeDh_4 = IntCoeff[0]*CPtr[Idx_InL2] + IntCoeff[1]*CPtr[Idx_InL1] +
-                     IntCoeff[3]*CPtr[Idx_InR1] + IntCoeff[4]*CPtr[Idx_InR2];
-
-//       ensure monotonicity
-         if ( Monotonic[v] )
-         {
-            LSlopeDh_4 = (real)0.25*( CPtr[Idx_InC ] - CPtr[Idx_InL1]) ;
-            RSlopeDh_4 = (real)0.25*( CPtr[Idx_InR1] - CPtr[Idx_InC ]) ;
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( SlopeDh_4*LSlopeDh_4 < (real)0.0 )   SlopeDh_4 = (real)0.125*( CPtr[Idx_InR1] - CPtr[Idx_InL1] );
-
-               Sign        = SIGN( LSlopeDh_4 );
-               SlopeDh_4  *= Sign;
-               LSlopeDh_4 *= Sign;
-               RSlopeDh_4 *= Sign;
-
-               if ( LSlopeDh_4 < RSlopeDh_4 )   LSlopeDh_4 *= MonoCoeff;
-               else                             RSlopeDh_4 *= MonoCoeff;
-
-               SlopeDh_4  = FMIN( LSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4  = FMIN( RSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4 *= Sign;
-            }
+         const real *In  = CPtr   + In_z*Cdz   + In_y*Cdy + CStart[0]*Cdx;
+               real *Out = TDataX + Out_z*TdzX + Out_y*Tdy;
 
-            else
-               SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  CPtr[Idx_InL1]*CPtr[Idx_InR1] < (real)0.0 )   SlopeDh_4 = (real)0.0;
+#        pragma omp simd
+         for (int i=0; i<CRange[0]; i++)
+         {
+            const real InC       = In[ i*Cdx ];
+            const real SlopeDh_4 = CQuar_SlopeDh_4( In[ i*Cdx - 2*Cdx ], In[ i*Cdx - Cdx ], InC,
+                                                    In[ i*Cdx + Cdx ], In[ i*Cdx + 2*Cdx ], IntCoeff,
+                                                    Mono, MonoCoeff, OppSign0thOrder );
 
-         TDataX[ Idx_Out       ] = CPtr[Idx_InC] - SlopeDh_4;
-         TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC] + SlopeDh_4;
-      } // k,j,i
+            Out[ 2*i*Tdx       ] = InC - SlopeDh_4;
+            Out[ 2*i*Tdx + Tdx ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
 
 //    unwrap phase along y direction
@@ -159,49 +138,22 @@ void Int_CQuartic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along y direction
       for (int InOut_z=0;             InOut_z<CRange[2]+2*CGhost;  InOut_z++)
       for (int In_y=CGhost, Out_y=0;  In_y   <CGhost+CRange[1];    In_y++, Out_y+=2)
-      for (int InOut_x=0;             InOut_x<2*CRange[0];         InOut_x++)
       {
-         Idx_Out  = InOut_z*TdzY + Out_y*Tdy + InOut_x*Tdx;
-         Idx_InC  = InOut_z*TdzX +  In_y*Tdy + InOut_x*Tdx;
-         Idx_InL1 = Idx_InC  - Tdy;
-         Idx_InL2 = Idx_InL1 - Tdy;
-         Idx_InR1 = Idx_InC  + Tdy;
-         Idx_InR2 = Idx_InR1 + Tdy;
+         const real *In  = TDataX + InOut_z*TdzX + In_y*Tdy;
+               real *Out = TDataY + InOut_z*TdzY + Out_y*Tdy;
 
-         SlopeDh_4 = IntCoeff[0]*TDataX[Idx_InL2] + IntCoeff[1]*TDataX[Idx_InL1] +
-                     IntCoeff[3]*TDataX[Idx_InR1] + IntCoeff[4]*TDataX[Idx_InR2];
-
-         if ( Monotonic[v] )
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
          {
-            LSlopeDh_4 = (real)0.25*( TDataX[Idx_InC ] - TDataX[Idx_InL1] );
-            RSlopeDh_4 = (real)0.25*( TDataX[Idx_InR1] - TDataX[Idx_InC ] );
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( SlopeDh_4*LSlopeDh_4 < (real)0.0 )   SlopeDh_4 = (real)0.125*( TDataX[Idx_InR1] - TDataX[Idx_InL1] );
-
-               Sign        = SIGN( LSlopeDh_4 );
-               SlopeDh_4  *= Sign;
-               LSlopeDh_4 *= Sign;
-               RSlopeDh_4 *= Sign;
+            const real InC       = In[ i*Tdx ];
+            const real SlopeDh_4 = CQuar_SlopeDh_4( In[ i*Tdx - 2*Tdy ], In[ i*Tdx - Tdy ], InC,
+                                                    In[ i*Tdx + Tdy ], In[ i*Tdx + 2*Tdy ], IntCoeff,
+                                                    Mono, MonoCoeff, OppSign0thOrder );
 
-               if ( LSlopeDh_4 < RSlopeDh_4 )   LSlopeDh_4 *= MonoCoeff;
-               else                             RSlopeDh_4 *= MonoCoeff;
-
-               SlopeDh_4  = FMIN( LSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4  = FMIN( RSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4 *= Sign;
-            }
-
-            else
-               SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  TDataX[Idx_InL1]*TDataX[Idx_InR1] < (real)0.0 )  SlopeDh_4 = (real)0.0;
-
-         TDataY[ Idx_Out       ] = TDataX[Idx_InC] - SlopeDh_4;
-         TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC] + SlopeDh_4;
-      } // k,j,i
+            Out[ i*Tdx       ] = InC - SlopeDh_4;
+            Out[ i*Tdx + Tdy ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
 
 //    unwrap phase along z direction
@@ -223,49 +175,22 @@ void Int_CQuartic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along z direction
       for (int In_z=CGhost, Out_z=FStart[2];  In_z<CGhost+CRange[2];  In_z++, Out_z+=2)
       for (int In_y=0,      Out_y=FStart[1];  In_y<2*CRange[1];       In_y++, Out_y++)
-      for (int In_x=0,      Out_x=FStart[0];  In_x<2*CRange[0];       In_x++, Out_x++)
       {
-         Idx_Out  = Out_z*Fdz  + Out_y*Fdy + Out_x*Fdx;
-         Idx_InC  =  In_z*TdzY +  In_y*Tdy +  In_x*Tdx;
-         Idx_InL1 = Idx_InC  - TdzY;
-         Idx_InL2 = Idx_InL1 - TdzY;
-         Idx_InR1 = Idx_InC  + TdzY;
-         Idx_InR2 = Idx_InR1 + TdzY;
-
-         SlopeDh_4 = IntCoeff[0]*TDataY[Idx_InL2] + IntCoeff[1]*TDataY[Idx_InL1] +
-                     IntCoeff[3]*TDataY[Idx_InR1] + IntCoeff[4]*TDataY[Idx_InR2];
+         const real *In  = TDataY + In_z*TdzY  + In_y*Tdy;
+               real *Out = FPtr   + Out_z*Fdz  + Out_y*Fdy + FStart[0]*Fdx;
 
-         if ( Monotonic[v] )
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
          {
-            LSlopeDh_4 = (real)0.25*( TDataY[Idx_InC ] - TDataY[Idx_InL1] );
-            RSlopeDh_4 = (real)0.25*( TDataY[Idx_InR1] - TDataY[Idx_InC ] );
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( SlopeDh_4*LSlopeDh_4 < (real)0.0 )   SlopeDh_4 = (real)0.125*( TDataY[Idx_InR1] - TDataY[Idx_InL1] );
+            const real InC       = In[ i*Tdx ];
+            const real SlopeDh_4 = CQuar_SlopeDh_4( In[ i*Tdx - 2*TdzY ], In[ i*Tdx - TdzY ], InC,
+                                                    In[ i*Tdx + TdzY ], In[ i*Tdx + 2*TdzY ], IntCoeff,
+                                                    Mono, MonoCoeff, OppSign0thOrder );
 
-               Sign        = SIGN( LSlopeDh_4 );
-               SlopeDh_4  *= Sign;
-               LSlopeDh_4 *= Sign;
-               RSlopeDh_4 *= Sign;
-
-               if ( LSlopeDh_4 < RSlopeDh_4 )   LSlopeDh_4 *= MonoCoeff;
-               else                             RSlopeDh_4 *= MonoCoeff;
-
-               SlopeDh_4  = FMIN( LSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4  = FMIN( RSlopeDh_4, SlopeDh_4 );
-               SlopeDh_4 *= Sign;
-            }
-
-            else
-               SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  TDataY[Idx_InL1]*TDataY[Idx_InR1] < (real)0.0 )  SlopeDh_4 = (real)0.0;
-
-         FPtr[ Idx_Out       ] = TDataY[Idx_InC] - SlopeDh_4;
-         FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC] + SlopeDh_4;
-      }
+            Out[ i*Fdx       ] = InC - SlopeDh_4;
+            Out[ i*Fdx + Fdz ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
       CPtr += CDisp;
       FPtr += FDisp;
@@ -276,3 +201,63 @@ void Int_CQuartic( real CData[], const int CSize[3], const int CStart[3], const
    delete [] TDataY;
 
 } // FUNCTION : Int_CQuartic
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CQuar_SlopeDh_4
+// Description :  Return the slope*dh/4 of the conservative quartic interpolation for one coarse cell
+//
+// Note        :  1. Branch-free version of the original monotonic slope limiter so that the pencil loops in
+//                   Int_CQuartic() can be vectorized
+//                   --> Arithmetic operations are performed in the same order as the original cell-by-cell
+//                       implementation so that the results are bitwise identical
+//                2. See CQuad_SlopeDh_4() in Int_CQuadratic.cpp for replacing FMIN() by MIN()
+//
+// Parameter   :  InL2/L1/C/R1/R2 : Coarse-grid values from left to right
+//                IntCoeff        : Interpolation coefficients
+//                Mono            : Ensure that the interpolation results are monotonic
+//                MonoCoeff       : Slope limiter coefficient for the option "Monotonic"
+//                OppSign0thOrder : See Int_MinMod1D()
+//
+// Return      :  SlopeDh_4
+//-------------------------------------------------------------------------------------------------------
+inline real CQuar_SlopeDh_4( const real InL2, const real InL1, const real InC, const real InR1, const real InR2,
+                             const real IntCoeff[], const bool Mono, const real MonoCoeff,
+                             const bool OppSign0thOrder )
+{
+
+   real SlopeDh_4 = IntCoeff[0]*InL2 + IntCoeff[1]*InL1 + IntCoeff[3]*InR1 + IntCoeff[4]*InR2;
+
+// ensure monotonicity
+   if ( Mono )
+   {
+      real LSlopeDh_4 = (real)0.25*( InC  - InL1 );
+      real RSlopeDh_4 = (real)0.25*( InR1 - InC  );
+
+      const bool Extrema  = !( LSlopeDh_4*RSlopeDh_4 > (real)0.0 );
+
+      SlopeDh_4 = ( SlopeDh_4*LSlopeDh_4 < (real)0.0 ) ? (real)0.125*( InR1 - InL1 ) : SlopeDh_4;
+
+      const real Sign     = SIGN( LSlopeDh_4 );
+
+      SlopeDh_4  *= Sign;
+      LSlopeDh_4 *= Sign;
+      RSlopeDh_4 *= Sign;
+
+      const bool LSmaller = ( LSlopeDh_4 < RSlopeDh_4 );
+
+      LSlopeDh_4 = ( LSmaller ) ? LSlopeDh_4*MonoCoeff : LSlopeDh_4;
+      RSlopeDh_4 = ( LSmaller ) ? RSlopeDh_4           : RSlopeDh_4*MonoCoeff;
+
+      SlopeDh_4  = MIN( LSlopeDh_4, SlopeDh_4 );
+      SlopeDh_4  = MIN( RSlopeDh_4, SlopeDh_4 );
+      SlopeDh_4 *= Sign;
+      SlopeDh_4  = ( Extrema ) ? (real)0.0 : SlopeDh_4;
+   } // if ( Mono )
+
+   if ( OppSign0thOrder  &&  InL1*InR1 < (real)0.0 )  SlopeDh_4 = (real)0.0;
+
+   return SlopeDh_4;
+
+} // FUNCTION : CQuar_SlopeDh_4
@@ -1,5 +1,9 @@
 #include "GAMER.h"
 
+static inline void Quad_Interp( const real InL, const real InC, const real InR, const real L[], const real R[],
+                                const bool Mono, const real MonoCoeff_4, const bool OppSign0thOrder,
+                                real &OutL, real &OutR );
+
 
 
 
@@ -16,6 +20,8 @@
 //		     in order
 //		  4. The "Monotonic" option is used to ensure that the interpolation results are monotonic
 //		     --> A slope limiter is adopted to ensure the monotonicity
+//                5. Each direction is interpolated pencil by pencil with a unit-stride inner loop and a branch-free
+//                   kernel (see Quad_Interp()) so that the compiler can vectorize it
 //
 // Parameter   :  CData	          : Input coarse-grid array
 //		  CSize	          : Size of the CData array
@@ -74,12 +80,13 @@ void Int_Quadratic( real CData[], const int CSize[3], const int CStart[3], const
    real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];   // temporary array after x interpolation
    real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];   // temporary array after y interpolation
 
-   int Idx_InL, Idx_InC, Idx_InR, Idx_Out;
-   real LSlopeDh_4, RSlopeDh_4, SlopeDh_4, Sign, CDataMax, CDataMin;
+   int Idx_InL, Idx_InC;
 
 
    for (int v=0; v<NComp; v++)
    {
+      const bool Mono = Monotonic[v];
+
 //    unwrap phase along x direction
 #     if ( MODEL == ELBDM )
       if ( UnwrapPhase )
@@ -99,66 +106,17 @@ void Int_Quadratic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along x direction
       for (int In_z=CStart[2]-CGhost, Out_z=0;  In_z<CStart[2]+CRange[2]+CGhost;  In_z++, Out_z++)
       for (int In_y=CStart[1]-CGhost, Out_y=0;  In_y<CStart[1]+CRange[1]+CGhost;  In_y++, Out_y++)
-      for (int In_x=CStart[0],        Out_x=0;  In_x<CStart[0]+CRange[0];         In_x++, Out_x+=2)
       {
-         Idx_Out = Out_z*TdzX + Out_y*Tdy + Out_x*Tdx;
-         Idx_InC =  In_z*Cdz  +  In_y*Cdy +  In_x*Cdx;
-         Idx_InL = Idx_InC - Cdx;
-         Idx_InR = Idx_InC + Cdx;
+         const real *In  = CPtr   + In_z*Cdz   + In_y*Cdy + CStart[0]*Cdx;
+               real *Out = TDataX + Out_z*TdzX + Out_y*Tdy;
 
-         TDataX[ Idx_Out       ] = L[0]*CPtr[Idx_InL] + L[1]*CPtr[Idx_InC] + L[2]*CPtr[Idx_InR];
-         TDataX[ Idx_Out + Tdx ] = R[0]*CPtr[Idx_InL] + R[1]*CPtr[Idx_InC] + R[2]*CPtr[Idx_InR];
-
-//       ensure monotonicity
-         if ( Monotonic[v] )
-         {
-            LSlopeDh_4 = CPtr[Idx_InC] - CPtr[Idx_InL];
-            RSlopeDh_4 = CPtr[Idx_InR] - CPtr[Idx_InC];
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( LSlopeDh_4 > (real)0.0 )
-               {
-                  CDataMax = CPtr[Idx_InR];
-                  CDataMin = CPtr[Idx_InL];
-               }
-               else
-               {
-                  CDataMax = CPtr[Idx_InL];
-                  CDataMin = CPtr[Idx_InR];
-               }
-
-               if (  FMAX( TDataX[Idx_Out], TDataX[Idx_Out+Tdx] ) > CDataMax  ||
-                     FMIN( TDataX[Idx_Out], TDataX[Idx_Out+Tdx] ) < CDataMin    )
-               {
-                  SlopeDh_4   = (real)0.125*( CPtr[Idx_InR] - CPtr[Idx_InL] );
-                  LSlopeDh_4 *= MonoCoeff_4;
-                  RSlopeDh_4 *= MonoCoeff_4;
-                  Sign        = SIGN( LSlopeDh_4 );
-
-                  SlopeDh_4 *= Sign;
-                  SlopeDh_4  = FMIN( Sign*LSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4  = FMIN( Sign*RSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4 *= Sign;
-
-                  TDataX[ Idx_Out       ] = CPtr[Idx_InC] - SlopeDh_4;
-                  TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC] + SlopeDh_4;
-               }
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-
-            else
-            {
-               TDataX[ Idx_Out       ] = CPtr[Idx_InC];
-               TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC];
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  CPtr[Idx_InL]*CPtr[Idx_InR] < (real)0.0 )
+#        pragma omp simd
+         for (int i=0; i<CRange[0]; i++)
          {
-            TDataX[ Idx_Out       ] = CPtr[Idx_InC];
-            TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC];
+            Quad_Interp( In[ i*Cdx - Cdx ], In[ i*Cdx ], In[ i*Cdx + Cdx ], L, R, Mono, MonoCoeff_4, OppSign0thOrder,
+                         Out[ 2*i*Tdx ], Out[ 2*i*Tdx + Tdx ] );
          }
-      } // k,j,i
+      } // for k,j
 
 
 //    unwrap phase along y direction
@@ -180,66 +138,17 @@ void Int_Quadratic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along y direction
       for (int InOut_z=0;             InOut_z<CRange[2]+2*CGhost;  InOut_z++)
       for (int In_y=CGhost, Out_y=0;  In_y   <CGhost+CRange[1];    In_y++, Out_y+=2)
-      for (int InOut_x=0;             InOut_x<2*CRange[0];         InOut_x++)
       {
-         Idx_Out = InOut_z*TdzY + Out_y*Tdy + InOut_x*Tdx;
-         Idx_InC = InOut_z*TdzX +  In_y*Tdy + InOut_x*Tdx;
-         Idx_InL = Idx_InC - Tdy;
-         Idx_InR = Idx_InC + Tdy;
+         const real *In  = TDataX + InOut_z*TdzX + In_y*Tdy;
+               real *Out = TDataY + InOut_z*TdzY + Out_y*Tdy;
 
-         TDataY[ Idx_Out       ] = L[0]*TDataX[Idx_InL] + L[1]*TDataX[Idx_InC] + L[2]*TDataX[Idx_InR];
-         TDataY[ Idx_Out + Tdy ] = R[0]*TDataX[Idx_InL] + R[1]*TDataX[Idx_InC] + R[2]*TDataX[Idx_InR];
-
-//       ensure monotonicity
-         if ( Monotonic[v] )
-         {
-            LSlopeDh_4 = TDataX[Idx_InC] - TDataX[Idx_InL];
-            RSlopeDh_4 = TDataX[Idx_InR] - TDataX[Idx_InC];
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( LSlopeDh_4 > (real)0.0 )
-               {
-                  CDataMax = TDataX[Idx_InR];
-                  CDataMin = TDataX[Idx_InL];
-               }
-               else
-               {
-                  CDataMax = TDataX[Idx_InL];
-                  CDataMin = TDataX[Idx_InR];
-               }
-
-               if (  FMAX( TDataY[Idx_Out], TDataY[Idx_Out+Tdy] ) > CDataMax  ||
-                     FMIN( TDataY[Idx_Out], TDataY[Idx_Out+Tdy] ) < CDataMin    )
-               {
-                  SlopeDh_4   = (real)0.125*( TDataX[Idx_InR] - TDataX[Idx_InL] );
-                  LSlopeDh_4 *= MonoCoeff_4;
-                  RSlopeDh_4 *= MonoCoeff_4;
-                  Sign        = SIGN( LSlopeDh_4 );
-
-                  SlopeDh_4 *= Sign;
-                  SlopeDh_4  = FMIN( Sign*LSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4  = FMIN( Sign*RSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4 *= Sign;
-
-                  TDataY[ Idx_Out       ] = TDataX[Idx_InC] - SlopeDh_4;
-                  TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC] + SlopeDh_4;
-               }
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-
-            else
-            {
-               TDataY[ Idx_Out       ] = TDataX[Idx_InC];
-               TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC];
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  TDataX[Idx_InL]*TDataX[Idx_InR] < (real)0.0 )
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
          {
-            TDataY[ Idx_Out       ] = TDataX[Idx_InC];
-            TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC];
+            Quad_Interp( In[ i*Tdx - Tdy ], In[ i*Tdx ], In[ i*Tdx + Tdy ], L, R, Mono, MonoCoeff_4, OppSign0thOrder,
+                         Out[ i*Tdx ], Out[ i*Tdx + Tdy ] );
          }
-      } // k,j,i
+      } // for k,j
 
 
 //    unwrap phase along z direction
@@ -261,66 +170,17 @@ void Int_Quadratic( real CData[], const int CSize[3], const int CStart[3], const
 //    interpolation along z direction
       for (int In_z=CGhost, Out_z=FStart[2];  In_z<CGhost+CRange[2];  In_z++, Out_z+=2)
       for (int In_y=0,      Out_y=FStart[1];  In_y<2*CRange[1];       In_y++, Out_y++)
-      for (int In_x=0,      Out_x=FStart[0];  In_x<2*CRange[0];       In_x++, Out_x++)
       {
-         Idx_Out = Out_z*Fdz  + Out_y*Fdy + Out_x*Fdx;
-         Idx_InC =  In_z*TdzY +  In_y*Tdy +  In_x*Tdx;
-         Idx_InL = Idx_InC - TdzY;
-         Idx_InR = Idx_InC + TdzY;
+         const real *In  = TDataY + In_z*TdzY  + In_y*Tdy;
+               real *Out = FPtr   + Out_z*Fdz  + Out_y*Fdy + FStart[0]*Fdx;
 
-         FPtr[ Idx_Out       ] = L[0]*TDataY[Idx_InL] + L[1]*TDataY[Idx_InC] + L[2]*TDataY[Idx_InR];
-         FPtr[ Idx_Out + Fdz ] = R[0]*TDataY[Idx_InL] + R[1]*TDataY[Idx_InC] + R[2]*TDataY[Idx_InR];
-
-//       ensure monotonicity
-         if ( Monotonic[v] )
-         {
-            LSlopeDh_4 = TDataY[Idx_InC] - TDataY[Idx_InL];
-            RSlopeDh_4 = TDataY[Idx_InR] - TDataY[Idx_InC];
-
-            if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-            {
-               if ( LSlopeDh_4 > (real)0.0 )
-               {
-                  CDataMax = TDataY[Idx_InR];
-                  CDataMin = TDataY[Idx_InL];
-               }
-               else
-               {
-                  CDataMax = TDataY[Idx_InL];
-                  CDataMin = TDataY[Idx_InR];
-               }
-
-               if (  FMAX( FPtr[Idx_Out], FPtr[Idx_Out+Fdz] ) > CDataMax  ||
-                     FMIN( FPtr[Idx_Out], FPtr[Idx_Out+Fdz] ) < CDataMin    )
-               {
-                  SlopeDh_4   = (real)0.125*( TDataY[Idx_InR] - TDataY[Idx_InL] );
-                  LSlopeDh_4 *= MonoCoeff_4;
-                  RSlopeDh_4 *= MonoCoeff_4;
-                  Sign        = SIGN( LSlopeDh_4 );
-
-                  SlopeDh_4 *= Sign;
-                  SlopeDh_4  = FMIN( Sign*LSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4  = FMIN( Sign*RSlopeDh_4, SlopeDh_4 );
-                  SlopeDh_4 *= Sign;
-
-                  FPtr[ Idx_Out       ] = TDataY[Idx_InC] - SlopeDh_4;
-                  FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC] + SlopeDh_4;
-               }
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
-
-            else
-            {
-               FPtr[ Idx_Out       ] = TDataY[Idx_InC];
-               FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC];
-            } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
-
-         if ( OppSign0thOrder  &&  TDataY[Idx_InL]*TDataY[Idx_InR] < (real)0.0 )
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
          {
-            FPtr[ Idx_Out       ] = TDataY[Idx_InC];
-            FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC];
+            Quad_Interp( In[ i*Tdx - TdzY ], In[ i*Tdx ], In[ i*Tdx + TdzY ], L, R, Mono, MonoCoeff_4, OppSign0thOrder,
+                         Out[ i*Fdx ], Out[ i*Fdx + Fdz ] );
          }
-      } // k,j,i
+      } // for k,j
 
       CPtr += CDisp;
       FPtr += FDisp;
@@ -331,3 +191,69 @@ void Int_Quadratic( real CData[], const int CSize[3], const int CStart[3], const
    delete [] TDataY;
 
 } // FUNCTION : Int_Quadratic
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Quad_Interp
+// Description :  Interpolate one coarse cell into two fine cells with the quadratic interpolation
+//
+// Note        :  1. Branch-free version of the original monotonic correction so that the pencil loops in
+//                   Int_Quadratic() can be vectorized
+//                   --> Both the quadratic and the limited linear results are always evaluated and then
+//                       selected, which gives results bitwise identical to the original cell-by-cell
+//                       implementation
+//                2. See CQuad_SlopeDh_4() in Int_CQuadratic.cpp for replacing FMIN/FMAX() by MIN/MAX()
+//
+// Parameter   :  InL/C/R         : Left/center/right coarse-grid values
+//                L/R             : Interpolation coefficients of the left/right fine cells
+//                Mono            : Ensure that the interpolation results are monotonic
+//                MonoCoeff_4     : Slope limiter coefficient for the option "Monotonic" divided by 4
+//                OppSign0thOrder : See Int_MinMod1D()
+//                OutL/R          : Interpolation results of the left/right fine cells
+//-------------------------------------------------------------------------------------------------------
+inline void Quad_Interp( const real InL, const real InC, const real InR, const real L[], const real R[],
+                         const bool Mono, const real MonoCoeff_4, const bool OppSign0thOrder,
+                         real &OutL, real &OutR )
+{
+
+   real FL = L[0]*InL + L[1]*InC + L[2]*InR;
+   real FR = R[0]*InL + R[1]*InC + R[2]*InR;
+
+// ensure monotonicity
+   if ( Mono )
+   {
+      real LSlopeDh_4 = InC - InL;
+      real RSlopeDh_4 = InR - InC;
+
+      const bool Extrema   = !( LSlopeDh_4*RSlopeDh_4 > (real)0.0 );
+      const bool Increase  = ( LSlopeDh_4 > (real)0.0 );
+      const real CDataMax  = ( Increase ) ? InR : InL;
+      const real CDataMin  = ( Increase ) ? InL : InR;
+      const bool Overshoot = ( MAX( FL, FR ) > CDataMax  ||  MIN( FL, FR ) < CDataMin );
+
+      real SlopeDh_4 = (real)0.125*( InR - InL );
+      LSlopeDh_4 *= MonoCoeff_4;
+      RSlopeDh_4 *= MonoCoeff_4;
+
+      const real Sign = SIGN( LSlopeDh_4 );
+
+      SlopeDh_4 *= Sign;
+      SlopeDh_4  = MIN( Sign*LSlopeDh_4, SlopeDh_4 );
+      SlopeDh_4  = MIN( Sign*RSlopeDh_4, SlopeDh_4 );
+      SlopeDh_4 *= Sign;
+
+      FL = ( Extrema ) ? InC : ( Overshoot ) ? InC - SlopeDh_4 : FL;
+      FR = ( Extrema ) ? InC : ( Overshoot ) ? InC + SlopeDh_4 : FR;
+   } // if ( Mono )
+
+   if ( OppSign0thOrder  &&  InL*InR < (real)0.0 )
+   {
+      FL = InC;
+      FR = InC;
+   }
+
+   OutL = FL;
+   OutR = FR;
+
+} // FUNCTION : Quad_Interp
@@ -1,5 +1,7 @@
 #include "GAMER.h"
 
+static inline real vanLeer_SlopeDh_4( const real InL, const real InC, const real InR, const bool OppSign0thOrder );
+
 
 
 
@@ -12,6 +14,8 @@
 //                3. The interpolation result is BOTH conservative and monotonic
 //		  4. 3D interpolation is achieved by performing interpolation along x, y, and z directions
 //		     in order --> different from MINMOD1D
+//                5. Each direction is interpolated pencil by pencil with a unit-stride inner loop and a branch-free
+//                   kernel (see vanLeer_SlopeDh_4()) so that the compiler can vectorize it
 //
 // Parameter   :  CData           : Input coarse-grid array
 //                CSize           : Size of the CData array
@@ -60,8 +64,7 @@ void Int_vanLeer( real CData[], const int CSize[3], const int CStart[3], const i
    real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];   // temporary array after x interpolation
    real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];   // temporary array after y interpolation
 
-   int  Idx_InL, Idx_InC, Idx_InR, Idx_Out;
-   real LSlope, RSlope, SlopeDh_4;
+   int Idx_InL, Idx_InC;
 
 
    for (int v=0; v<NComp; v++)
@@ -85,25 +88,20 @@ void Int_vanLeer( real CData[], const int CSize[3], const int CStart[3], const i
 //    interpolation along x direction
       for (int In_z=CStart[2]-CGhost, Out_z=0;  In_z<CStart[2]+CRange[2]+CGhost;  In_z++, Out_z++)
       for (int In_y=CStart[1]-CGhost, Out_y=0;  In_y<CStart[1]+CRange[1]+CGhost;  In_y++, Out_y++)
-      for (int In_x=CStart[0],        Out_x=0;  In_x<CStart[0]+CRange[0];         In_x++, Out_x+=2)
       {
-         Idx_Out = Out_z*TdzX + Out_y*Tdy + Out_x*Tdx;
-         Idx_InC =  In_z*Cdz  +  In_y*Cdy +  In_x*Cdx;
-         Idx_InL = Idx_InC - Cdx;
-         Idx_InR = Idx_InC + Cdx;
-
-         LSlope  = CPtr[Idx_InC] - CPtr[Idx_InL];
-         RSlope  = CPtr[Idx_InR] - CPtr[Idx_InC];
-
-         if ( RSlope*LSlope <= (real)0.0 )   SlopeDh_4 = (real)0.0;
-         else                                SlopeDh_4 = (real)0.5*LSlope*RSlope/(LSlope+RSlope);
-
-         if ( OppSign0thOrder  &&  CPtr[Idx_InL]*CPtr[Idx_InR] < (real)0.0 )  SlopeDh_4 = (real)0.0;
+         const real *In  = CPtr   + In_z*Cdz   + In_y*Cdy + CStart[0]*Cdx;
+               real *Out = TDataX + Out_z*TdzX + Out_y*Tdy;
 
-         TDataX[ Idx_Out       ] = CPtr[Idx_InC] - SlopeDh_4;
-         TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC] + SlopeDh_4;
+#        pragma omp simd
+         for (int i=0; i<CRange[0]; i++)
+         {
+            const real InC       = In[ i*Cdx ];
+            const real SlopeDh_4 = vanLeer_SlopeDh_4( In[ i*Cdx - Cdx ], InC, In[ i*Cdx + Cdx ], OppSign0thOrder );
 
-      } // for k,j,i
+            Out[ 2*i*Tdx       ] = InC - SlopeDh_4;
+            Out[ 2*i*Tdx + Tdx ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
 
 //    unwrap phase along y direction
@@ -125,25 +123,20 @@ void Int_vanLeer( real CData[], const int CSize[3], const int CStart[3], const i
 //    interpolation along y direction
       for (int InOut_z=0;             InOut_z<CRange[2]+2*CGhost;  InOut_z++)
       for (int In_y=CGhost, Out_y=0;  In_y   <CGhost+CRange[1];    In_y++, Out_y+=2)
-      for (int InOut_x=0;             InOut_x<2*CRange[0];         InOut_x++)
       {
-         Idx_Out = InOut_z*TdzY + Out_y*Tdy + InOut_x*Tdx;
-         Idx_InC = InOut_z*TdzX +  In_y*Tdy + InOut_x*Tdx;
-         Idx_InL = Idx_InC - Tdy;
-         Idx_InR = Idx_InC + Tdy;
-
-         LSlope  = TDataX[Idx_InC] - TDataX[Idx_InL];
-         RSlope  = TDataX[Idx_InR] - TDataX[Idx_InC];
-
-         if ( RSlope*LSlope <= (real)0.0 )   SlopeDh_4 = (real)0.0;
-         else                                SlopeDh_4 = (real)0.5*LSlope*RSlope/(LSlope+RSlope);
+         const real *In  = TDataX + InOut_z*TdzX + In_y*Tdy;
+               real *Out = TDataY + InOut_z*TdzY + Out_y*Tdy;
 
-         if ( OppSign0thOrder  &&  TDataX[Idx_InL]*TDataX[Idx_InR] < (real)0.0 )    SlopeDh_4 = (real)0.0;
-
-         TDataY[ Idx_Out       ] = TDataX[Idx_InC] - SlopeDh_4;
-         TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC] + SlopeDh_4;
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
+         {
+            const real InC       = In[ i*Tdx ];
+            const real SlopeDh_4 = vanLeer_SlopeDh_4( In[ i*Tdx - Tdy ], InC, In[ i*Tdx + Tdy ], OppSign0thOrder );
 
-      } // for k,j,i
+            Out[ i*Tdx       ] = InC - SlopeDh_4;
+            Out[ i*Tdx + Tdy ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
 
 //    unwrap phase along z direction
@@ -165,25 +158,20 @@ void Int_vanLeer( real CData[], const int CSize[3], const int CStart[3], const i
 //    interpolation along z direction
       for (int In_z=CGhost, Out_z=FStart[2];  In_z<CGhost+CRange[2];  In_z++, Out_z+=2)
       for (int In_y=0,      Out_y=FStart[1];  In_y<2*CRange[1];       In_y++, Out_y++)
-      for (int In_x=0,      Out_x=FStart[0];  In_x<2*CRange[0];       In_x++, Out_x++)
       {
-         Idx_Out = Out_z*Fdz  + Out_y*Fdy + Out_x*Fdx;
-         Idx_InC =  In_z*TdzY +  In_y*Tdy +  In_x*Tdx;
-         Idx_InL = Idx_InC - TdzY;
-         Idx_InR = Idx_InC + TdzY;
-
-         LSlope  = TDataY[Idx_InC] - TDataY[Idx_InL];
-         RSlope  = TDataY[Idx_InR] - TDataY[Idx_InC];
+         const real *In  = TDataY + In_z*TdzY  + In_y*Tdy;
+               real *Out = FPtr   + Out_z*Fdz  + Out_y*Fdy + FStart[0]*Fdx;
 
-         if ( RSlope*LSlope <= (real)0.0 )   SlopeDh_4 = (real)0.0;
-         else                                SlopeDh_4 = (real)0.5*LSlope*RSlope/(LSlope+RSlope);
-
-         if ( OppSign0thOrder  &&  TDataY[Idx_InL]*TDataY[Idx_InR] < (real)0.0 )    SlopeDh_4 = (real)0.0;
-
-         FPtr[ Idx_Out       ] = TDataY[Idx_InC] - SlopeDh_4;
-         FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC] + SlopeDh_4;
+#        pragma omp simd
+         for (int i=0; i<2*CRange[0]; i++)
+         {
+            const real InC       = In[ i*Tdx ];
+            const real SlopeDh_4 = vanLeer_SlopeDh_4( In[ i*Tdx - TdzY ], InC, In[ i*Tdx + TdzY ], OppSign0thOrder );
 
-      } // for k,j,i
+            Out[ i*Fdx       ] = InC - SlopeDh_4;
+            Out[ i*Fdx + Fdz ] = InC + SlopeDh_4;
+         }
+      } // for k,j
 
       CPtr += CDisp;
       FPtr += FDisp;
@@ -194,3 +182,33 @@ void Int_vanLeer( real CData[], const int CSize[3], const int CStart[3], const i
    delete [] TDataY;
 
 } // FUNCTION : Int_vanLeer
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  vanLeer_SlopeDh_4
+// Description :  Return the van Leer slope*dh/4 for one coarse cell
+//
+// Note        :  1. Branch-free version so that the pencil loops in Int_vanLeer() can be vectorized
+//                   --> The harmonic mean is always evaluated and then discarded for extrema, which gives
+//                       results bitwise identical to the original cell-by-cell implementation
+//
+// Parameter   :  InL/C/R         : Left/center/right coarse-grid values
+//                OppSign0thOrder : See Int_MinMod1D()
+//
+// Return      :  SlopeDh_4
+//-------------------------------------------------------------------------------------------------------
+inline real vanLeer_SlopeDh_4( const real InL, const real InC, const real InR, const bool OppSign0thOrder )
+{
+
+   const real LSlope  = InC - InL;
+   const real RSlope  = InR - InC;
+   const real Slope   = (real)0.5*LSlope*RSlope/(LSlope+RSlope);
+
+   real SlopeDh_4 = ( RSlope*LSlope <= (real)0.0 ) ? (real)0.0 : Slope;
+
+   if ( OppSign0thOrder  &&  InL*InR < (real)0.0 )    SlopeDh_4 = (real)0.0;
+
+   return SlopeDh_4;
+
+} // FUNCTION : vanLeer_SlopeDh_4
@@ -274,6 +274,10 @@ void LB_AllocateFluxArray( const int FaLv )
    } // for (int r=0; r<MPI_NRank; r++)
 
 
+// record the real patches with flux arrays for Flu_FixUp_Flux()
+   Flu_RecordFluxPatchList( FaLv );
+
+
 // free memory
    for (int r=0; r<MPI_NRank; r++)
    {
@@ -19,7 +19,9 @@
 //                       children patches
 //                       --> WLI estimated here will be different from both Record__PatchCount and
 //                           Record__ParticleCount. The latter only considers particles in the leaf patches
-//                4. Invoked by main() to determine whether we should redistribute all patches
+//                4. For OPT__LB_COUPLE_LEVEL, Load_Max is replaced by the maximum total workload of all levels
+//                   in one rank since LB_SetCutPoint_CoupleLevel() only balances the total workload
+//                5. Invoked by main() to determine whether we should redistribute all patches
 //                   (by calling LB_Init_LoadBalance()) to improve the load balance
 //
 // Return      :  amr->LB->WLI
@@ -92,6 +94,19 @@ double LB_EstimateLoadImbalance()
          Load_Ave_AllLv += Load_Ave[lv];
       }
 
+      if ( OPT__LB_COUPLE_LEVEL )
+      {
+         Load_Max_AllLv = -1.0;
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            double Load_AllLv = 0.0;
+            for (int lv=0; lv<NLEVEL; lv++)  Load_AllLv += Load_AllRank[r][lv];
+
+            Load_Max_AllLv = MAX( Load_Max_AllLv, Load_AllLv );
+         }
+      }
+
       amr->LB->WLI = ( Load_Max_AllLv - Load_Ave_AllLv ) / Load_Ave_AllLv;
 
 
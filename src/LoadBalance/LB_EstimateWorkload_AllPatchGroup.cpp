@@ -15,7 +15,16 @@
 //                   --> Workload of a single patch (without particles) is normalized to 1.0
 //                2. Workload of each patch **includes particles in the children patches"
 //                   --> For non-leaf patches, this function will collect particles from the leaf patches
-//                3. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
+//                3. For LB->Che_Weight > 0.0, add "Che_Weight*Che_Cost/Che_Cost_Mean" to the workload of each patch,
+//                   where "Che_Cost" is the measured Grackle cost of this patch and "Che_Cost_Mean" is the average
+//                   cost of all measured patches at this level among all ranks
+//                   --> Patches without measurement (e.g., newly created patches) assume Che_Cost = Che_Cost_Mean
+//                   --> Require GRACKLE_ZERO_COPY (see CPU_GrackleSolver())
+//                   --> Must be invoked by all ranks
+//                4. Workload is multiplied by the measured cost factor of this rank (amr->LB->Cost_Factor)
+//                   when LB_INPUT__MEASURED_COST > 0.0
+//                   --> See LB_RecordMeasuredCost()
+//                5. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
 //                   function "Mis_GetTotalPatchNumber( lv )"
 //
 // Parameter   :  lv        : Target refinement level
@@ -80,6 +89,46 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
    } // if ( ParWeight_Norm > 0.0 )
 #  endif // #ifdef PARTICLE
 
+
+// 3. workload of Grackle
+#  ifdef SUPPORT_GRACKLE
+   if ( GRACKLE_ACTIVATE  &&  amr->LB->Che_Weight > 0.0 )
+   {
+//    get the average measured cost of all patches at this level
+      double Cost_ThisRank[2] = { 0.0, 0.0 }, Cost_AllRank[2];  // [0/1]: sum of cost / number of measured patches
+
+      for (int PID=0; PID<8*NPG_ThisRank; PID++)
+      {
+         const real Cost = amr->patch[0][lv][PID]->Che_Cost;
+
+         if ( Cost >= (real)0.0 )
+         {
+            Cost_ThisRank[0] += Cost;
+            Cost_ThisRank[1] += 1.0;
+         }
+      }
+
+      MPI_Allreduce( Cost_ThisRank, Cost_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+//    add the normalized cost of each patch
+      const double Cost_Mean = ( Cost_AllRank[1] > 0.0 ) ? Cost_AllRank[0]/Cost_AllRank[1] : 0.0;
+
+      for (int t=0; t<NPG_ThisRank; t++)
+      for (int PID=t*8; PID<(t+1)*8; PID++)
+      {
+         const real Cost = amr->patch[0][lv][PID]->Che_Cost;
+
+         if ( Cost >= (real)0.0  &&  Cost_Mean > 0.0 )   Load_PG[t] += amr->LB->Che_Weight*Cost/Cost_Mean;
+         else                                             Load_PG[t] += amr->LB->Che_Weight;
+      }
+   } // if ( GRACKLE_ACTIVATE  &&  amr->LB->Che_Weight > 0.0 )
+#  endif // #ifdef SUPPORT_GRACKLE
+
+
+// 4. measured cost of this rank
+   if ( amr->LB->Cost_EMA > 0.0 )
+      for (int t=0; t<NPG_ThisRank; t++)  Load_PG[t] *= amr->LB->Cost_Factor;
+
 } // FUNCTION : LB_EstimateWorkload_AllPatchGroup
 
 
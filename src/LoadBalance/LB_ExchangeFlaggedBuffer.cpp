@@ -12,8 +12,14 @@
 //
 // Note        :  1. After calling this function, all ranks should have correct flag results for
 //                   all real patches
-//                2. Flag list is sorted by the recv rank instead of the send rank
-//                   --> Sorting and matching only need to be done once
+//                2. Flagged patches are exchanged as runs of consecutive LB_Idx [start, count]
+//                   --> Flagged sibling-buffer patches come in patch groups and clusters along the space-filling
+//                       curve, so a run usually covers at least the 8 patches of a patch group
+//                   --> Each send list is sorted before run-length encoding, which only involves the patches
+//                       sent to the same rank
+//                3. The receiver locates each run in the sorted list of real patches (IdxList_Real) by a single
+//                   binary search and flags the following "count" entries directly
+//                   --> No need to sort and match the received list
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -23,7 +29,7 @@ void LB_ExchangeFlaggedBuffer( const int lv )
    const int NSibBuf = amr->NPatchComma[lv][2] - amr->NPatchComma[lv][1];
    const int MemUnit = 1 + NSibBuf/MPI_NRank;      // set arbitrarily
 
-   int   TRank, MemSize[MPI_NRank], NSend[MPI_NRank];
+   int   TRank, MemSize[MPI_NRank], NFlag[MPI_NRank], NSend[MPI_NRank];
    long  LBIdx;
    long *Send_Temp[MPI_NRank];
 
@@ -32,7 +38,7 @@ void LB_ExchangeFlaggedBuffer( const int lv )
    {
       MemSize  [r] = MemUnit;
       Send_Temp[r] = (long*)malloc( MemSize[r]*sizeof(long) );
-      NSend    [r] = 0;
+      NFlag    [r] = 0;
    }
 
 
@@ -46,74 +52,100 @@ void LB_ExchangeFlaggedBuffer( const int lv )
          TRank = LB_Index2Rank( lv, LBIdx, CHECK_ON );
 
 //       allocate enough memory
-         if ( NSend[TRank] >= MemSize[TRank] )
+         if ( NFlag[TRank] >= MemSize[TRank] )
          {
             MemSize  [TRank] += MemUnit;
             Send_Temp[TRank]  = (long*)realloc( Send_Temp[TRank], MemSize[TRank]*sizeof(long) );
          }
 
 //       record list
-         Send_Temp[TRank][ NSend[TRank] ++ ] = LBIdx;
+         Send_Temp[TRank][ NFlag[TRank] ++ ] = LBIdx;
 
       } // if ( amr->patch[0][lv][PID]->flag )
    } // for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][2]; PID++)
 
 
-// 2. broadcast the unsorted send list to all other ranks
+// 2. encode the flagged patches sent to each rank as runs of consecutive LB_Idx
 // ==========================================================================================
-   int   NRecv[MPI_NRank], Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank], NSend_Total, NRecv_Total, Counter;
+// --> store each run as [start, count] directly in the MPI send buffer
+// --> the number of runs never exceeds the number of flagged patches
+   int   NRecv[MPI_NRank], Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank], NFlag_Total=0, NSend_Total, NRecv_Total;
    long *SendBuf=NULL, *RecvBuf=NULL;
 
-// 2.1 broadcast the number of elements sent to different ranks
+   for (int r=0; r<MPI_NRank; r++)  NFlag_Total += NFlag[r];
+
+   SendBuf     = new long [ 2*NFlag_Total ];
+   NSend_Total = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Mis_Heapsort( NFlag[r], Send_Temp[r], NULL );
+
+      Send_Disp[r] = NSend_Total;
+
+      for (int t=0; t<NFlag[r]; )
+      {
+         const long Start = Send_Temp[r][t];
+         int        Count = 1;
+
+         while ( t+Count < NFlag[r]  &&  Send_Temp[r][t+Count] == Start+Count )   Count ++;
+
+         SendBuf[ NSend_Total ++ ] = Start;
+         SendBuf[ NSend_Total ++ ] = Count;
+
+         t += Count;
+      }
+
+      NSend[r] = NSend_Total - Send_Disp[r];
+   } // for (int r=0; r<MPI_NRank; r++)
+
+
+// 3. broadcast the run list to all other ranks
+// ==========================================================================================
+// 3.1 broadcast the number of elements sent to different ranks
    MPI_Alltoall( NSend, 1, MPI_INT, NRecv, 1, MPI_INT, MPI_COMM_WORLD );
 
-// 2.2 prepare the MPI buffers
-   Send_Disp[0] = 0;
+// 3.2 prepare the MPI receive buffer
    Recv_Disp[0] = 0;
-   for (int r=1; r<MPI_NRank; r++)
-   {
-      Send_Disp[r] = Send_Disp[r-1] + NSend[r-1];
-      Recv_Disp[r] = Recv_Disp[r-1] + NRecv[r-1];
-   }
-   NSend_Total = Send_Disp[MPI_NRank-1] + NSend[MPI_NRank-1];
+   for (int r=1; r<MPI_NRank; r++)  Recv_Disp[r] = Recv_Disp[r-1] + NRecv[r-1];
    NRecv_Total = Recv_Disp[MPI_NRank-1] + NRecv[MPI_NRank-1];
 
-   SendBuf = new long [NSend_Total];
    RecvBuf = new long [NRecv_Total];
 
-   Counter = 0;
-   for (int r=0; r<MPI_NRank; r++)
-   for (int t=0; t<NSend[r]; t++)
-      SendBuf[ Counter ++ ] = Send_Temp[r][t];
-
-// 2.3 broadcast the send list
+// 3.3 broadcast the run list
    MPI_Alltoallv( SendBuf, NSend, Send_Disp, MPI_LONG,
                   RecvBuf, NRecv, Recv_Disp, MPI_LONG, MPI_COMM_WORLD );
 
 
-// 3. flag real patches according to the received flag results
+// 4. flag real patches according to the received runs
 // ============================================================================================================
-   int  TPID;
-   int *Match = new int [NRecv_Total];
+   const int   NReal   = amr->NPatchComma[lv][1];
+   const long *IdxList = amr->LB->IdxList_Real[lv];
 
-// 3.1 sort the received list
-   Mis_Heapsort( NRecv_Total, RecvBuf, NULL );
-
-// 3.2 match the corresponding PID
-   Mis_Matching_int( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], NRecv_Total, RecvBuf, Match );
-
-// 3.3 flag
-   for (int t=0; t<NRecv_Total; t++)
+   for (int t=0; t<NRecv_Total; t+=2)
    {
+      const long Start = RecvBuf[t  ];
+      const long Count = RecvBuf[t+1];
+
 //    all target real patches must be found
+//    --> the LB_Idx of real patches are unique and sorted, so a run of consecutive LB_Idx occupies
+//        consecutive entries in IdxList_Real
+      const int Idx0 = Mis_BinarySearch( IdxList, 0, NReal-1, Start );
+
 #     ifdef GAMER_DEBUG
-      if ( Match[t] == -1 )
-         Aux_Error( ERROR_INFO, "lv %d, LB_Idx %ld found no matching patches !!\n", lv, RecvBuf[t] );
+      if ( Idx0 == -1 )
+         Aux_Error( ERROR_INFO, "lv %d, LB_Idx %ld found no matching patches !!\n", lv, Start );
+
+      if ( Idx0+Count > NReal  ||  IdxList[ Idx0+Count-1 ] != Start+Count-1 )
+         Aux_Error( ERROR_INFO, "lv %d, run [%ld, %ld] found no matching patches !!\n", lv, Start, Count );
 #     endif
 
-      TPID = amr->LB->IdxList_Real_IdxTable[lv][ Match[t] ];
+      for (int c=0; c<Count; c++)
+      {
+         const int TPID = amr->LB->IdxList_Real_IdxTable[lv][ Idx0+c ];
 
-      amr->patch[0][lv][TPID]->flag = true;
+         amr->patch[0][lv][TPID]->flag = true;
+      }
    }
 
 
@@ -122,7 +154,6 @@ void LB_ExchangeFlaggedBuffer( const int lv )
 
    delete [] SendBuf;
    delete [] RecvBuf;
-   delete [] Match;
 
 } // FUNCTION : LB_ExchangeFlaggedBuffer
 
@@ -4,6 +4,10 @@
 
 
 
+static void SetSonNotHome( const int FaLv, const int FaPID, const int SonRank, const char Found );
+
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_FindSonNotHome
@@ -25,6 +29,10 @@
 //                       buffer patch at FaLv will still be set to "SON_OFFSET_LB-SonRank" with SonRank == MPI_Rank
 //                5. Must invoke LB_FindFather( FaLv+1 ) in advance to properly set the son indices of patches
 //                   at FaLv with sons at home
+//                6. The home rank of each son is computed directly from its LB_Idx and the cut points, and only
+//                   that rank is queried for whether the son exists
+//                   --> Replies are cached in the son directory amr->LB->SonDir_*[SonLv] and reused until the
+//                       real patches at SonLv change
 //
 // Parameter   :  FaLv        : Target refinement level of fathers
 //                SearchAllFa : Whether to search over all father patches or not
@@ -73,6 +81,10 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
    long *Query_Temp[MPI_NRank];
    bool  Internal;
 
+   const int   SonDir_N     = amr->LB->SonDir_N    [SonLv];
+   const long *SonDir_Idx   = amr->LB->SonDir_Idx  [SonLv];
+   const char *SonDir_Found = amr->LB->SonDir_Found[SonLv];
+
 // 1.1 set memory allocation unit
    for (int r=0; r<MPI_NRank; r++)
    {
@@ -136,6 +148,15 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
             continue;
          }
 
+//       look up the son directory first since the reply depends only on the real patches at SonLv
+         const int DirIdx = ( SonDir_N > 0 ) ? Mis_BinarySearch( SonDir_Idx, 0, SonDir_N-1, LB_Idx ) : -1;
+
+         if ( DirIdx != -1 )
+         {
+            SetSonNotHome( FaLv, FaPID, TRank, SonDir_Found[DirIdx] );
+            continue;
+         }
+
 //       allocate enough memory
          if ( NQuery[TRank] >= MemSize_Query[TRank] )
          {
@@ -162,10 +183,13 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
 
 
 // 2 transfer data : (SendBuf_Query --> RecvBuf_Query --> SendBuf_Reply --> RecvBuf_Reply)
+// --> only exchange data with the home ranks of the target sons by point-to-point communication
+// --> queries to this rank are answered locally
 // ==========================================================================================
-   int   Query_Disp[MPI_NRank], Reply_Disp[MPI_NRank], NReply[MPI_NRank], NQuery_Total, NReply_Total, Counter;
+   int   Query_Disp[MPI_NRank], Reply_Disp[MPI_NRank], NReply[MPI_NRank], NQuery_Total, NReply_Total, Counter, NReq;
    long *SendBuf_Query=NULL, *RecvBuf_Query=NULL;
    char *SendBuf_Reply=NULL, *RecvBuf_Reply=NULL;
+   MPI_Request *Req = new MPI_Request [ 2*MPI_NRank ];
 
 // 2.1 send the number of queries
    MPI_Alltoall( NQuery, 1, MPI_INT, NReply, 1, MPI_INT, MPI_COMM_WORLD );
@@ -192,8 +216,23 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
       SendBuf_Query[ Counter ++ ] = Query_Temp[r][t];
 
 // 2.3 send queries
-   MPI_Alltoallv( SendBuf_Query, NQuery, Query_Disp, MPI_LONG,
-                  RecvBuf_Query, NReply, Reply_Disp, MPI_LONG, MPI_COMM_WORLD );
+   NReq = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )
+      {
+         memcpy( RecvBuf_Query+Reply_Disp[r], SendBuf_Query+Query_Disp[r], NQuery[r]*sizeof(long) );
+         continue;
+      }
+
+      if ( NReply[r] > 0 )
+         MPI_Irecv( RecvBuf_Query+Reply_Disp[r], NReply[r], MPI_LONG, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+
+      if ( NQuery[r] > 0 )
+         MPI_Isend( SendBuf_Query+Query_Disp[r], NQuery[r], MPI_LONG, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
 
 // 2.4 prepare replies
    for (int r=0; r<MPI_NRank; r++)
@@ -201,8 +240,23 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
                          RecvBuf_Query+Reply_Disp[r], SendBuf_Reply+Reply_Disp[r] );
 
 // 2.5 send replies
-   MPI_Alltoallv( SendBuf_Reply, NReply, Reply_Disp, MPI_CHAR,
-                  RecvBuf_Reply, NQuery, Query_Disp, MPI_CHAR, MPI_COMM_WORLD );
+   NReq = 0;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )
+      {
+         memcpy( RecvBuf_Reply+Query_Disp[r], SendBuf_Reply+Reply_Disp[r], NReply[r]*sizeof(char) );
+         continue;
+      }
+
+      if ( NQuery[r] > 0 )
+         MPI_Irecv( RecvBuf_Reply+Query_Disp[r], NQuery[r], MPI_CHAR, r, 1, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+
+      if ( NReply[r] > 0 )
+         MPI_Isend( SendBuf_Reply+Reply_Disp[r], NReply[r], MPI_CHAR, r, 1, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
 
 
 // 3 set SonPID to "SON_OFFSET_LB-SonRank"
@@ -214,33 +268,47 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
    {
       FaPID = FaPID_List[r][ FaPID_IdxTable[r][t] ];
 
-      if ( RecvBuf_Reply[ Counter ++ ] == 1 )
+      SetSonNotHome( FaLv, FaPID, r, RecvBuf_Reply[ Counter ++ ] );
+   }
+
+
+// 3.1 add the replies to the son directory
+// --> all ranks must reconstruct the directory at SonLv whenever the real patches at SonLv change
+//     (see LB_t::ResetSonDir())
+   if ( NQuery_Total > 0 )
+   {
+      const int NOld = amr->LB->SonDir_N[SonLv];
+      const int NNew = NOld + NQuery_Total;
+
+      long *NewDir_Idx      = (long*)malloc( NNew*sizeof(long) );
+      char *NewDir_Found    = (char*)malloc( NNew*sizeof(char) );
+      int  *NewDir_IdxTable = new int [NNew];
+
+      for (int t=0; t<NOld; t++)
       {
-         amr->patch[0][FaLv][FaPID]->son = SON_OFFSET_LB - r;
+         NewDir_Idx     [t] = amr->LB->SonDir_Idx[SonLv][t];
+         NewDir_IdxTable[t] = t;
+      }
 
-//       check : only external buffer patches can have sons at home but with son indices < -1
-#        ifdef GAMER_DEBUG
-         Cr = amr->patch[0][FaLv][FaPID]->corner;
+      for (int t=0; t<NQuery_Total; t++)  NewDir_Idx[ NOld + t ] = SendBuf_Query[t];
 
-         Internal = true;
-         for (int d=0; d<3; d++)
-         {
-            if ( Cr[d] < 0  ||  Cr[d] >= amr->BoxScale[d] )
-            {
-               Internal = false;
-               break;
-            }
-         }
+      Mis_Heapsort( NNew, NewDir_Idx, NewDir_IdxTable );
 
-         if ( Internal  &&  r == MPI_Rank )
-            Aux_Error( ERROR_INFO, "FaLv %d, FaPID %d's son should be home !!\n", FaLv, FaPID );
-#        endif
-      } // if ( RecvBuf_Reply[ Counter ++ ] == 1 )
+      for (int t=0; t<NNew; t++)
+      {
+         const int Idx = NewDir_IdxTable[t];
+
+         NewDir_Found[t] = ( Idx < NOld ) ? amr->LB->SonDir_Found[SonLv][Idx] : RecvBuf_Reply[ Idx - NOld ];
+      }
 
-      else
-         amr->patch[0][FaLv][FaPID]->son = -1;
+      amr->LB->ResetSonDir( SonLv );
 
-   } // for (int r=0; r<MPI_NRank; r++) ... for (int t=0; t<NQuery[r]; t++)
+      amr->LB->SonDir_N    [SonLv] = NNew;
+      amr->LB->SonDir_Idx  [SonLv] = NewDir_Idx;
+      amr->LB->SonDir_Found[SonLv] = NewDir_Found;
+
+      delete [] NewDir_IdxTable;
+   } // if ( NQuery_Total > 0 )
 
 
 // 4. check results in debug mode
@@ -332,10 +400,55 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
    delete [] RecvBuf_Query;
    delete [] SendBuf_Reply;
    delete [] RecvBuf_Reply;
+   delete [] Req;
    if ( SearchAllFa )   delete [] TargetFaPID;
 
 } // FUNCTION : LB_FindSonNotHome
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetSonNotHome
+// Description :  Set the son index of a father patch whose son is not home
+//
+// Note        :  1. Invoked by LB_FindSonNotHome()
+//
+// Parameter   :  FaLv    : Target refinement level of fathers
+//                FaPID   : Target father patch index
+//                SonRank : Home rank of the son patch
+//                Found   : Whether the son patch exists in SonRank
+//-------------------------------------------------------------------------------------------------------
+void SetSonNotHome( const int FaLv, const int FaPID, const int SonRank, const char Found )
+{
+
+   if ( Found == 1 )
+   {
+      amr->patch[0][FaLv][FaPID]->son = SON_OFFSET_LB - SonRank;
+
+//    check : only external buffer patches can have sons at home but with son indices < -1
+#     ifdef GAMER_DEBUG
+      const int *Cr = amr->patch[0][FaLv][FaPID]->corner;
+
+      bool Internal = true;
+      for (int d=0; d<3; d++)
+      {
+         if ( Cr[d] < 0  ||  Cr[d] >= amr->BoxScale[d] )
+         {
+            Internal = false;
+            break;
+         }
+      }
+
+      if ( Internal  &&  SonRank == MPI_Rank )
+         Aux_Error( ERROR_INFO, "FaLv %d, FaPID %d's son should be home !!\n", FaLv, FaPID );
+#     endif
+   } // if ( Found == 1 )
+
+   else
+      amr->patch[0][FaLv][FaPID]->son = -1;
+
+} // FUNCTION : SetSonNotHome
+
+
+
 #endif // #ifdef LOAD_BALANCE
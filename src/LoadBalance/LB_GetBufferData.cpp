@@ -13,8 +13,37 @@ static int   RecvBufSize        = -1;
 
 #ifdef TIMING
 extern Timer_t *Timer_MPI[3];
+extern Timer_t *Timer_GetBuf_Wait[NLEVEL];
 #endif
 
+// requests (and derived datatypes for OPT__LB_DERIVED_TYPE and count arrays for OPT__LB_DIST_GRAPH) of the exchange started by LB_GetBufferData_Start()
+// and not yet completed by LB_GetBufferData_Finish()
+static MPI_Request  *Pending_Req   = NULL;
+static int           Pending_NReq  = 0;
+static MPI_Datatype *Pending_Type  = NULL;
+static int           Pending_NType = 0;
+static int          *Pending_NeighborCount = NULL;
+
+// stages of LB_GetBufferData_Batch(), in which LB_GetBufferData_Phase() only returns the counts (BATCH_COUNT),
+// prepares the send array (BATCH_PACK), or stores the received data (BATCH_UNPACK) of a single request
+// --> the send/recv buffers and the displacements of the target request are set by LB_GetBufferData_Batch()
+enum { BATCH_NONE, BATCH_COUNT, BATCH_PACK, BATCH_UNPACK };
+static int           Batch_Stage     = BATCH_NONE;
+static int          *Batch_SendCount = NULL;
+static int          *Batch_RecvCount = NULL;
+static const int    *Batch_SendDisp  = NULL;
+static const int    *Batch_RecvDisp  = NULL;
+static real         *Batch_SendBuf   = NULL;
+static real         *Batch_RecvBuf   = NULL;
+
+static void LB_GetBufferData_Phase( const int lv, const int FluSg, const int MagSg, const int PotSg,
+                                    const GetBufMode_t GetBufMode, const long TVarCC, const long TVarFC,
+                                    const int ParaBuf, const bool Start, const bool Finish );
+static MPI_Datatype LB_GetBufferData_CreateType( const int lv, const int FluSg, const int PotSg, const int NList,
+                                                 const int *IDList, const int *IDList_IdxTable, const int *SibList,
+                                                 const int NVarCC_Flu, const int *TFluVarIdxList, const bool ExchangePot,
+                                                 const MPI_Datatype SlabType[] );
+
 
 
 
@@ -28,6 +57,16 @@ extern Timer_t *Timer_MPI[3];
 //                3. The modes "POT_FOR_POISSON" and "POT_AFTER_REFINE" will exchange the potential data only.
 //                   The mode "COARSE_FINE_ELECTRIC" will exchange all electric field components.
 //                   For others modes, the variables to be exchanged depend on the input parameters "TVarCC" and "TVarFC".
+//                4. Data are transferred by MPI_Irecv/MPI_Isend only between the ranks with data to exchange
+//                   instead of MPI_Alltoallv
+//                   --> Receives are posted before preparing the send array
+//                5. Use LB_GetBufferData_Start() and LB_GetBufferData_Finish() to overlap the transfer with computation
+//                6. For OPT__LB_DERIVED_TYPE, the cell-centered data in DATA_GENERAL, DATA_AFTER_REFINE, POT_FOR_POISSON,
+//                   and POT_AFTER_REFINE are transferred directly between patches by MPI derived datatypes
+//                   --> Skip the send/recv buffers and the pack/unpack steps 3 and 5
+//                   --> Not applied to the B field
+//                7. For OPT__LB_DIST_GRAPH, data not transferred by derived datatypes are exchanged by a single
+//                   MPI_Ineighbor_alltoallv() on the distributed graph communicator constructed by LB_RecordNeighborGraph()
 //
 // Parameter   :  lv         : Target refinement level to exchage data
 //                FluSg      : Sandglass of the requested fluid data
@@ -42,6 +81,10 @@ extern Timer_t *Timer_MPI[3];
 //                                 DATA_AFTER_REFINE    : subset of DATA_GENERAL after refine
 //                                 DATA_AFTER_FIXUP     : subset of DATA_GENERAL after fix-up
 //                                 DATA_RESTRICT        : restricted data of the father patches with sons not home
+//                                 DATA_RESTRICT_FLUX   : DATA_RESTRICT + COARSE_FINE_FLUX in a single exchange
+//                                                        --> All flux components are exchanged regardless of TVarCC
+//                                                        --> Also include COARSE_FINE_ELECTRIC for MHD when
+//                                                            OPT__FIXUP_ELECTRIC is on
 //                                 POT_FOR_POISSON      : potential for the Poisson solver
 //                                 POT_AFTER_REFINE     : potential after refine for the Poisson solver
 //                                 COARSE_FINE_FLUX     : fluxes across the coarse-fine boundaries (HYDRO ONLY)
@@ -62,12 +105,336 @@ extern Timer_t *Timer_MPI[3];
 //                                 HYDRO+MHD : _MAGX, _MAGY, _MAGZ, _MAG
 //                                 ELBDM     : none
 //                ParaBuf    : Number of ghost zones to exchange
-//                             --> Useless in DATA_RESTRICT, COARSE_FINE_FLUX, and COARSE_FINE_ELECTRIC
+//                             --> Useless in DATA_RESTRICT, DATA_RESTRICT_FLUX, COARSE_FINE_FLUX, and COARSE_FINE_ELECTRIC
 //-------------------------------------------------------------------------------------------------------
 void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
                        const long TVarCC, const long TVarFC, const int ParaBuf )
 {
 
+   LB_GetBufferData_Phase( lv, FluSg, MagSg, PotSg, GetBufMode, TVarCC, TVarFC, ParaBuf, true, true );
+
+} // FUNCTION : LB_GetBufferData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_Start / LB_GetBufferData_Finish
+// Description :  Split LB_GetBufferData() into two phases so that the data transfer can overlap with computation
+//
+// Note        :  1. LB_GetBufferData_Start() posts all receives, prepares the send array, and posts all sends
+//                   LB_GetBufferData_Finish() waits for the transfer and stores the received data to the buffer patches
+//                2. The two functions must be invoked in pairs with exactly the same arguments, and no other
+//                   LB_GetBufferData() call (or any particle routine using the shared MPI buffers) is allowed in between
+//                3. Data of the real patches in the send lists must not be modified in between, and the buffer-patch
+//                   data being received must not be accessed in between
+//                   --> Used by EvolveLevel() for OPT__OVERLAP_MPI, which advances the patch groups not in
+//                       the send lists (amr->LB->OverlapMPI_FluAsyncPID0) during the transfer
+//                4. Only DATA_GENERAL and POT_FOR_POISSON are supported
+//                   --> POT_FOR_POISSON is used by Gra_AdvanceDt() to overlap the potential exchange with the
+//                       Poisson solver (amr->LB->OverlapMPI_PotAsyncPID0)
+//                5. LB_GetBufferData_Progress() can be invoked in between to drive the transfer (OPT__MPI_PROGRESS)
+//
+// Parameter   :  See LB_GetBufferData()
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_Start( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
+                             const long TVarCC, const long TVarFC, const int ParaBuf )
+{
+
+#  ifdef GRAVITY
+   if ( GetBufMode != DATA_GENERAL  &&  GetBufMode != POT_FOR_POISSON )
+#  else
+   if ( GetBufMode != DATA_GENERAL )
+#  endif
+      Aux_Error( ERROR_INFO, "unsupported mode %d for %s() !!\n", GetBufMode, __FUNCTION__ );
+
+   LB_GetBufferData_Phase( lv, FluSg, MagSg, PotSg, GetBufMode, TVarCC, TVarFC, ParaBuf, true, false );
+
+} // FUNCTION : LB_GetBufferData_Start
+
+
+
+void LB_GetBufferData_Finish( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
+                              const long TVarCC, const long TVarFC, const int ParaBuf )
+{
+
+#  ifdef GRAVITY
+   if ( GetBufMode != DATA_GENERAL  &&  GetBufMode != POT_FOR_POISSON )
+#  else
+   if ( GetBufMode != DATA_GENERAL )
+#  endif
+      Aux_Error( ERROR_INFO, "unsupported mode %d for %s() !!\n", GetBufMode, __FUNCTION__ );
+
+   LB_GetBufferData_Phase( lv, FluSg, MagSg, PotSg, GetBufMode, TVarCC, TVarFC, ParaBuf, false, true );
+
+} // FUNCTION : LB_GetBufferData_Finish
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_Progress
+// Description :  Drive the exchange started by LB_GetBufferData_Start() by polling its requests with MPI_Testall()
+//
+// Note        :  1. Invoked by InvokeSolver() between the steps of each batch when OPT__MPI_PROGRESS is on
+//                   --> Many MPI implementations only progress the non-blocking transfer (e.g., the rendezvous
+//                       protocol of large messages) inside MPI calls, in which case the transfer would otherwise
+//                       not start until MPI_Waitall() in LB_GetBufferData_Finish()
+//                2. Must be invoked outside OpenMP parallel regions since MPI is initialized with MPI_THREAD_SERIALIZED
+//                3. Completed requests are set to MPI_REQUEST_NULL, which are ignored by MPI_Waitall() in
+//                   LB_GetBufferData_Finish()
+//                4. Do nothing if there is no pending exchange
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_Progress()
+{
+
+   if ( Pending_Req == NULL  ||  Pending_NReq == 0 )  return;
+
+   int AllDone;
+   MPI_Testall( Pending_NReq, Pending_Req, &AllDone, MPI_STATUSES_IGNORE );
+
+// skip the subsequent polls once all requests have completed
+   if ( AllDone )    Pending_NReq = 0;
+
+} // FUNCTION : LB_GetBufferData_Progress
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_Batch
+// Description :  Perform multiple LB_GetBufferData() requests with a single message between each pair of ranks
+//
+// Note        :  1. Each request is equivalent to LB_GetBufferData() with the same arguments, but the data of
+//                   all requests sent to the same rank are packed into a contiguous segment of the send buffer
+//                   --> One message per neighbor rank instead of one per request, which reduces the latency on
+//                       coarse levels with only a few patches per rank
+//                2. Requests can target different levels, sandglasses, variables, modes, and ghost-zone sizes
+//                   --> But they must be independent: all send arrays are prepared before any received data are
+//                       stored, and the requests are stored in the input order
+//                3. Invoked by Buf_GetBufferData_Batch()
+//                4. Fall back to separate LB_GetBufferData() calls for OPT__LB_DERIVED_TYPE and OPT__LB_DIST_GRAPH,
+//                   which transfer the data without the packed send/recv buffers
+//
+// Parameter   :  NBatch    : Number of requests
+//                BatchList : Request list
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_Batch( const int NBatch, const GetBufReq_t *BatchList )
+{
+
+// check
+   if ( Pending_Req != NULL )
+      Aux_Error( ERROR_INFO, "the previous exchange started by LB_GetBufferData_Start() has not finished !!\n" );
+
+   if ( NBatch <= 0 )   return;
+
+   if ( OPT__LB_DERIVED_TYPE  ||  OPT__LB_DIST_GRAPH )
+   {
+      for (int b=0; b<NBatch; b++)
+      {
+         const GetBufReq_t *R = BatchList + b;
+
+         LB_GetBufferData( R->lv, R->FluSg, R->MagSg, R->PotSg, R->GetBufMode, R->TVarCC, R->TVarFC, R->ParaBuf );
+      }
+
+      return;
+   }
+
+
+// 1. get the number of elements to be sent to and received from each rank by each request
+   int **SendCount = new int* [NBatch];
+   int **RecvCount = new int* [NBatch];
+   int **SendDisp  = new int* [NBatch];
+   int **RecvDisp  = new int* [NBatch];
+
+   Batch_Stage = BATCH_COUNT;
+
+   for (int b=0; b<NBatch; b++)
+   {
+      const GetBufReq_t *R = BatchList + b;
+
+      SendCount[b] = new int [MPI_NRank];
+      RecvCount[b] = new int [MPI_NRank];
+      SendDisp [b] = new int [MPI_NRank];
+      RecvDisp [b] = new int [MPI_NRank];
+
+      Batch_SendCount = SendCount[b];
+      Batch_RecvCount = RecvCount[b];
+
+      LB_GetBufferData_Phase( R->lv, R->FluSg, R->MagSg, R->PotSg, R->GetBufMode, R->TVarCC, R->TVarFC, R->ParaBuf,
+                              true, false );
+   }
+
+
+// 2. set the displacements ordered by rank first and then by request
+   int *Send_NCount = new int [MPI_NRank];
+   int *Recv_NCount = new int [MPI_NRank];
+   int *Send_NDisp  = new int [MPI_NRank];
+   int *Recv_NDisp  = new int [MPI_NRank];
+   int  NSend_Total = 0, NRecv_Total = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Send_NDisp [r] = NSend_Total;
+      Recv_NDisp [r] = NRecv_Total;
+
+      for (int b=0; b<NBatch; b++)
+      {
+         SendDisp[b][r] = NSend_Total;
+         RecvDisp[b][r] = NRecv_Total;
+
+         NSend_Total   += SendCount[b][r];
+         NRecv_Total   += RecvCount[b][r];
+      }
+
+      Send_NCount[r] = NSend_Total - Send_NDisp[r];
+      Recv_NCount[r] = NRecv_Total - Recv_NDisp[r];
+   }
+
+   if ( Send_NCount[MPI_Rank] != Recv_NCount[MPI_Rank] )
+      Aux_Error( ERROR_INFO, "Send_NCount[%d] (%d) != Recv_NCount[%d] (%d) !!\n",
+                 MPI_Rank, Send_NCount[MPI_Rank], MPI_Rank, Recv_NCount[MPI_Rank] );
+
+
+// 3. post the receives, prepare the send array of all requests, and post the sends
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
+
+   Batch_SendBuf = LB_GetBufferData_MemAllocate_Send( NSend_Total );
+   Batch_RecvBuf = LB_GetBufferData_MemAllocate_Recv( NRecv_Total );
+
+   MPI_Request *Req  = new MPI_Request [ 2*MPI_NRank ];
+   int          NReq = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Recv_NCount[r] > 0  &&  r != MPI_Rank )
+         MPI_Irecv( Batch_RecvBuf + Recv_NDisp[r], Recv_NCount[r], RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   Batch_Stage = BATCH_PACK;
+
+   for (int b=0; b<NBatch; b++)
+   {
+      const GetBufReq_t *R = BatchList + b;
+
+      Batch_SendDisp = SendDisp[b];
+      Batch_RecvDisp = RecvDisp[b];
+
+      LB_GetBufferData_Phase( R->lv, R->FluSg, R->MagSg, R->PotSg, R->GetBufMode, R->TVarCC, R->TVarFC, R->ParaBuf,
+                              true, false );
+   }
+
+#  ifdef TIMING
+   if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
+#  endif
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Send_NCount[r] == 0 )    continue;
+
+      if ( r == MPI_Rank )
+         memcpy( Batch_RecvBuf + Recv_NDisp[r], Batch_SendBuf + Send_NDisp[r], Send_NCount[r]*sizeof(real) );
+      else
+         MPI_Isend( Batch_SendBuf + Send_NDisp[r], Send_NCount[r], RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+#  ifdef TIMING
+   if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
+#  endif
+
+
+// 4. store the received data of all requests
+   Batch_Stage = BATCH_UNPACK;
+
+   for (int b=0; b<NBatch; b++)
+   {
+      const GetBufReq_t *R = BatchList + b;
+
+      Batch_SendDisp = SendDisp[b];
+      Batch_RecvDisp = RecvDisp[b];
+
+      LB_GetBufferData_Phase( R->lv, R->FluSg, R->MagSg, R->PotSg, R->GetBufMode, R->TVarCC, R->TVarFC, R->ParaBuf,
+                              false, true );
+   }
+
+   Batch_Stage     = BATCH_NONE;
+   Batch_SendCount = NULL;
+   Batch_RecvCount = NULL;
+   Batch_SendDisp  = NULL;
+   Batch_RecvDisp  = NULL;
+   Batch_SendBuf   = NULL;
+   Batch_RecvBuf   = NULL;
+
+
+// 5. record the achieved MPI bandwidth of all requests together
+#  ifdef TIMING
+   if ( OPT__TIMING_MPI )
+   {
+      char FileName[100];
+      sprintf( FileName, "Record__TimingMPI_Rank%05d", MPI_Rank );
+
+      FILE *File = fopen( FileName, "a" );
+
+      const double SendMB = NSend_Total*sizeof(real)*1.0e-6;
+      const double RecvMB = NRecv_Total*sizeof(real)*1.0e-6;
+
+      fprintf( File, "%3d %15s %4d %4d %10.5f %10.5f %10.5f %8.3f %8.3f %10.3f %10.3f\n",
+               BatchList[0].lv, "Batch", NBatch, -1,
+               Timer_MPI[0]->GetValue(), Timer_MPI[2]->GetValue(), Timer_MPI[1]->GetValue(),
+               SendMB, RecvMB, SendMB/Timer_MPI[1]->GetValue(), RecvMB/Timer_MPI[1]->GetValue() );
+
+      fclose( File );
+
+      for (int t=0; t<3; t++)    Timer_MPI[t]->Reset();
+   }
+#  endif
+
+
+// 6. free memory
+   for (int b=0; b<NBatch; b++)
+   {
+      delete [] SendCount[b];
+      delete [] RecvCount[b];
+      delete [] SendDisp [b];
+      delete [] RecvDisp [b];
+   }
+
+   delete [] SendCount;
+   delete [] RecvCount;
+   delete [] SendDisp;
+   delete [] RecvDisp;
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+   delete [] Req;
+
+} // FUNCTION : LB_GetBufferData_Batch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_Phase
+// Description :  Perform the start and/or finish phases of LB_GetBufferData()
+//
+// Note        :  1. Start phase  : steps 1-4 except MPI_Waitall()
+//                   Finish phase : steps 1-2 (to recover the lists and counts), MPI_Waitall(), and steps 5-9
+//                2. MPI requests of an unfinished exchange are kept in Pending_Req[]
+//
+// Parameter   :  Start  : Post receives, prepare the send array, and post sends
+//                Finish : Wait for the transfer and store the received data
+//                Others : See LB_GetBufferData()
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_Phase( const int lv, const int FluSg, const int MagSg, const int PotSg, const GetBufMode_t GetBufMode,
+                             const long TVarCC, const long TVarFC, const int ParaBuf, const bool Start, const bool Finish )
+{
+
+// the interpolated ghost zones cached by Prepare_PatchData() at lv+1 may no longer be valid
+   Prepare_PatchData_InvalidateGhostCache( lv );
+
    bool ExchangeFlu = ( GetBufMode == COARSE_FINE_FLUX ) ?
                       TVarCC & _FLUX_TOTAL : TVarCC & _TOTAL;  // whether or not to exchage the fluid data
 #  ifdef GRAVITY
@@ -127,7 +494,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
    if (  ( GetBufMode == DATA_GENERAL || GetBufMode == DATA_AFTER_FIXUP || GetBufMode == DATA_AFTER_REFINE ||
-           GetBufMode == DATA_RESTRICT )  &&  NVarCC_Tot + NVarFC_Mag == 0  )
+           GetBufMode == DATA_RESTRICT || GetBufMode == DATA_RESTRICT_FLUX )  &&  NVarCC_Tot + NVarFC_Mag == 0  )
       Aux_Error( ERROR_INFO, "no target variable is found !!\n" );
 
    if ( GetBufMode == COARSE_FINE_FLUX  &&  NVarCC_Flu == 0 )
@@ -161,16 +528,28 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d --> accepted range = [0 ... PATCH_SIZE] !!\n",
                  "ParaBuf", ParaBuf );
 
-   if ( GetBufMode == COARSE_FINE_FLUX  &&  !amr->WithFlux )
-      Aux_Error( ERROR_INFO, "COARSE_FINE_FLUX failed since flux arrays are not allocated !!\n" );
+   if (  ( GetBufMode == COARSE_FINE_FLUX || GetBufMode == DATA_RESTRICT_FLUX )  &&  !amr->WithFlux  )
+      Aux_Error( ERROR_INFO, "mode %d failed since flux arrays are not allocated !!\n", GetBufMode );
 
 #  ifdef MHD
    if ( GetBufMode == COARSE_FINE_ELECTRIC  &&  !amr->WithElectric )
       Aux_Error( ERROR_INFO, "WARNING : COARSE_FINE_ELECTRIC failed since electric field arrays are not allocated !!\n" );
 #  endif
 
+   if ( Start  &&  Pending_Req != NULL )
+      Aux_Error( ERROR_INFO, "the previous exchange started by LB_GetBufferData_Start() has not finished !!\n" );
+
+   if ( !Start  &&  Pending_Req == NULL  &&  Batch_Stage == BATCH_NONE )
+      Aux_Error( ERROR_INFO, "no exchange has been started by LB_GetBufferData_Start() !!\n" );
+
 // _X : for exchanging data after the flux fix-up, which has ParaBuf=1
    const int DataUnit_Flux = SQR( PS1 )*NVarCC_Flu;
+#  ifdef MHD
+   const int DataUnit_Res  = CUBE( PS1 )*NVarCC_Tot + SQR( PS1 )*PS1P1*NVarFC_Mag;
+#  else
+   const int DataUnit_Res  = CUBE( PS1 )*NVarCC_Tot;
+#  endif
+   const int DataUnit_ResF = SQR( PS1 )*NFLUX_TOTAL;
 #  ifdef MHD
    const int ParaBufP1     = ParaBuf + 1;
 #  endif
@@ -187,6 +566,17 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    int  *RecvY_NList=NULL, **RecvY_IDList=NULL, **RecvY_SibList=NULL;
 #  endif
 
+// _ResF : flux lists of DATA_RESTRICT_FLUX, whose data are stored after the restricted data sent to the same rank
+   int  *SendResF_NList=NULL, **SendResF_IDList=NULL, **SendResF_SibList=NULL;
+   int  *RecvResF_NList=NULL, **RecvResF_IDList=NULL, **RecvResF_IDList_IdxTable=NULL, **RecvResF_SibList=NULL;
+
+// _ResE : electric field lists of DATA_RESTRICT_FLUX, whose data are stored after the fluxes sent to the same rank
+#  ifdef MHD
+   const bool WithResE = ( GetBufMode == DATA_RESTRICT_FLUX  &&  OPT__FIXUP_ELECTRIC );
+   int  *SendResE_NList=NULL, **SendResE_IDList=NULL, **SendResE_SibList=NULL;
+   int  *RecvResE_NList=NULL, **RecvResE_IDList=NULL, **RecvResE_IDList_IdxTable=NULL, **RecvResE_SibList=NULL;
+#  endif
+
    int *Send_NCount = new int [MPI_NRank];
    int *Recv_NCount = new int [MPI_NRank];
    int *Send_NDisp  = new int [MPI_NRank];
@@ -244,6 +634,32 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          Recv_IDList          = amr->LB->RecvR_IDList         [lv];
          break;
 
+      case DATA_RESTRICT_FLUX :     // restricted data + hydro fluxes
+         Send_NList               = amr->LB->SendR_NList          [lv];
+         Send_IDList              = amr->LB->SendR_IDList         [lv];
+         Send_IDList_IdxTable     = amr->LB->SendR_IDList_IdxTable[lv];
+         Recv_NList               = amr->LB->RecvR_NList          [lv];
+         Recv_IDList              = amr->LB->RecvR_IDList         [lv];
+         SendResF_NList           = amr->LB->SendF_NList          [lv];
+         SendResF_IDList          = amr->LB->SendF_IDList         [lv];
+         SendResF_SibList         = amr->LB->SendF_SibList        [lv];
+         RecvResF_NList           = amr->LB->RecvF_NList          [lv];
+         RecvResF_IDList          = amr->LB->RecvF_IDList         [lv];
+         RecvResF_IDList_IdxTable = amr->LB->RecvF_IDList_IdxTable[lv];
+         RecvResF_SibList         = amr->LB->RecvF_SibList        [lv];
+#        ifdef MHD
+         if ( WithResE ) {
+         SendResE_NList           = amr->LB->SendE_NList          [lv];
+         SendResE_IDList          = amr->LB->SendE_IDList         [lv];
+         SendResE_SibList         = amr->LB->SendE_SibList        [lv];
+         RecvResE_NList           = amr->LB->RecvE_NList          [lv];
+         RecvResE_IDList          = amr->LB->RecvE_IDList         [lv];
+         RecvResE_IDList_IdxTable = amr->LB->RecvE_IDList_IdxTable[lv];
+         RecvResE_SibList         = amr->LB->RecvE_SibList        [lv];
+         }
+#        endif
+         break;
+
 #     ifdef GRAVITY
       case POT_FOR_POISSON :        // potential for the Poisson solver
          Send_NList           = amr->LB->SendG_NList          [lv];
@@ -529,18 +945,28 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          break; // case DATA_AFTER_FIXUP
 
 
-      case DATA_RESTRICT :
+      case DATA_RESTRICT : case DATA_RESTRICT_FLUX :
 //    ----------------------------------------------
          for (int r=0; r<MPI_NRank; r++)
          {
-            Send_NCount[r]  = Send_NList[r]*CUBE( PS1 )*NVarCC_Tot;
-            Recv_NCount[r]  = Recv_NList[r]*CUBE( PS1 )*NVarCC_Tot;
+            Send_NCount[r]  = Send_NList[r]*DataUnit_Res;
+            Recv_NCount[r]  = Recv_NList[r]*DataUnit_Res;
+
+            if ( GetBufMode == DATA_RESTRICT_FLUX )
+            {
+               Send_NCount[r] += SendResF_NList[r]*DataUnit_ResF;
+               Recv_NCount[r] += RecvResF_NList[r]*DataUnit_ResF;
+            }
+
 #           ifdef MHD
-            Send_NCount[r] += Send_NList[r]*SQR( PS1 )*PS1P1*NVarFC_Mag;
-            Recv_NCount[r] += Recv_NList[r]*SQR( PS1 )*PS1P1*NVarFC_Mag;
+            if ( WithResE )
+            {
+               for (int t=0; t<SendResE_NList[r]; t++)  Send_NCount[r] += ( SendResE_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+               for (int t=0; t<RecvResE_NList[r]; t++)  Recv_NCount[r] += ( RecvResE_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            }
 #           endif
          }
-         break; // case DATA_RESTRICT
+         break; // case DATA_RESTRICT and DATA_RESTRICT_FLUX
 
 
       case COARSE_FINE_FLUX :
@@ -583,18 +1009,142 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    NRecv_Total = Recv_NDisp[ MPI_NRank-1 ] + Recv_NCount[ MPI_NRank-1 ];
 
 
+// return the counts to LB_GetBufferData_Batch() or adopt its displacements in the batched send/recv buffers
+   if ( Batch_Stage == BATCH_COUNT )
+   {
+      memcpy( Batch_SendCount, Send_NCount, MPI_NRank*sizeof(int) );
+      memcpy( Batch_RecvCount, Recv_NCount, MPI_NRank*sizeof(int) );
+
+      delete [] Send_NCount;
+      delete [] Recv_NCount;
+      delete [] Send_NDisp;
+      delete [] Recv_NDisp;
+      delete [] TFluVarIdxList;
+#     ifdef MHD
+      delete [] TMagVarIdxList;
+#     endif
+
+      return;
+   }
+
+   else if ( Batch_Stage != BATCH_NONE )
+   {
+      memcpy( Send_NDisp, Batch_SendDisp, MPI_NRank*sizeof(int) );
+      memcpy( Recv_NDisp, Batch_RecvDisp, MPI_NRank*sizeof(int) );
+   }
+
+
+// transfer data directly between patches by MPI derived datatypes for OPT__LB_DERIVED_TYPE
+   bool UseDerivedType = (  OPT__LB_DERIVED_TYPE  &&  ParaBuf > 0  &&  Batch_Stage == BATCH_NONE  &&
+                            ( GetBufMode == DATA_GENERAL || GetBufMode == DATA_AFTER_REFINE
+#                             ifdef GRAVITY
+                              || GetBufMode == POT_FOR_POISSON || GetBufMode == POT_AFTER_REFINE
+#                             endif
+                            )  );
+#  ifdef MHD
+   if ( ExchangeMag )   UseDerivedType = false;
+#  endif
+#  ifdef GRAVITY
+   const bool ExchangePot_DT = ExchangePot;
+#  else
+   const bool ExchangePot_DT = false;
+#  endif
+
+// transfer data by the neighborhood collective for OPT__LB_DIST_GRAPH
+// --> the graph is not constructed yet during the initialization
+   const bool UseDistGraph = (  OPT__LB_DIST_GRAPH  &&  !UseDerivedType  &&  amr->LB->NeighborComm[lv] != MPI_COMM_NULL  &&
+                                Batch_Stage == BATCH_NONE  );
+
+
 // allocate send/recv buffers (only when the current buffer size is not large enough --> improve performance)
-   real *SendBuf = LB_GetBufferData_MemAllocate_Send( NSend_Total );
-   real *RecvBuf = LB_GetBufferData_MemAllocate_Recv( NRecv_Total );
+// --> LB_GetBufferData_Batch() has allocated the buffers for all requests
+   real *SendBuf = ( Batch_Stage != BATCH_NONE ) ? Batch_SendBuf :
+                   ( UseDerivedType )            ? NULL          : LB_GetBufferData_MemAllocate_Send( NSend_Total );
+   real *RecvBuf = ( Batch_Stage != BATCH_NONE ) ? Batch_RecvBuf :
+                   ( UseDerivedType )            ? NULL          : LB_GetBufferData_MemAllocate_Recv( NRecv_Total );
+
+
+// post the non-blocking receives before preparing the send array so that the incoming data can be stored
+// directly to RecvBuf without being buffered by MPI
+// --> only communicate with the ranks having data to exchange
+// --> data sent to this rank itself (e.g., periodic B.C. with a single rank) are copied directly in step 4
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
+
+// --> the finish phase reuses the requests posted by the start phase
+//     --> the shared buffers are not reallocated since their sizes have not changed
+   MPI_Request  *Req   = ( Start ) ? new MPI_Request [ 2*MPI_NRank ] : Pending_Req;
+   int           NReq  = ( Start ) ? 0                               : Pending_NReq;
+   MPI_Datatype *Type  = ( Start ) ? new MPI_Datatype[ 2*MPI_NRank ] : Pending_Type;
+   int           NType = ( Start ) ? 0                               : Pending_NType;
+   int           NType_Recv = 0;
+   int          *NeighborCount = ( Start ) ? NULL : Pending_NeighborCount;
+
+// slabs of a single variable in a patch for OPT__LB_DERIVED_TYPE
+// --> data sent to this rank itself are also transferred by MPI since there is no buffer to copy from
+   MPI_Datatype SlabType[27];
+
+   if ( Start  &&  UseDerivedType )
+   {
+      for (int s=0; s<27; s++)
+      {
+         const int Size   [3] = { PS1, PS1, PS1 };
+         const int SubSize[3] = { LoopEnd[s][2]-LoopStart[s][2], LoopEnd[s][1]-LoopStart[s][1], LoopEnd[s][0]-LoopStart[s][0] };
+         const int Offset [3] = { LoopStart[s][2], LoopStart[s][1], LoopStart[s][0] };
+
+         MPI_Type_create_subarray( 3, Size, SubSize, Offset, MPI_ORDER_C, RealType, &SlabType[s] );
+      }
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         if ( Recv_NCount[r] == 0 )    continue;
+
+         Type[NType] = LB_GetBufferData_CreateType( lv, FluSg, PotSg, Recv_NList[r], Recv_IDList[r], Recv_IDList_IdxTable[r],
+                                                    Recv_SibList[r], (ExchangeFlu)?NVarCC_Flu:0, TFluVarIdxList,
+                                                    ExchangePot_DT, SlabType );
+         MPI_Irecv( MPI_BOTTOM, 1, Type[NType], r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+         NType ++;
+      }
+
+      NType_Recv = NType;
+   }
+
+   else if ( Start  &&  !UseDistGraph  &&  Batch_Stage == BATCH_NONE )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Recv_NCount[r] > 0  &&  r != MPI_Rank )
+         MPI_Irecv( RecvBuf + Recv_NDisp[r], Recv_NCount[r], RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
 
 
 
 // 3. prepare the send array
 // ============================================================================================================
 #  ifdef TIMING
-   if ( OPT__TIMING_MPI )  Timer_MPI[0]->Start();
+   if ( OPT__TIMING_MPI  &&  Start )   Timer_MPI[0]->Start();
 #  endif
 
+// build the send datatypes instead for OPT__LB_DERIVED_TYPE
+   if ( Start  &&  UseDerivedType )
+   {
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         if ( Send_NCount[r] == 0 )    continue;
+
+         Type[NType] = LB_GetBufferData_CreateType( lv, FluSg, PotSg, Send_NList[r], Send_IDList[r], NULL,
+                                                    Send_SibList[r], (ExchangeFlu)?NVarCC_Flu:0, TFluVarIdxList,
+                                                    ExchangePot_DT, SlabType );
+         NType ++;
+      }
+
+      for (int s=0; s<27; s++)   MPI_Type_free( &SlabType[s] );
+   }
+
+// skip the entire switch in the finish phase
+   else if ( Start )
    switch ( GetBufMode )
    {
       case DATA_GENERAL : case DATA_AFTER_REFINE :
@@ -956,7 +1506,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          break; // case DATA_AFTER_FIXUP
 
 
-      case DATA_RESTRICT :
+      case DATA_RESTRICT : case DATA_RESTRICT_FLUX :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
@@ -1021,8 +1571,50 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                }
 #              endif
             } // for (int t=0; t<Send_NList[r]; t++)
+
+//          fluxes of DATA_RESTRICT_FLUX
+            if ( GetBufMode == DATA_RESTRICT_FLUX )
+            for (int t=0; t<SendResF_NList[r]; t++)
+            {
+               const int SPID = SendResF_IDList [r][t];
+               const int SSib = SendResF_SibList[r][t];
+               const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
+
+#              ifdef GAMER_DEBUG
+               if ( FluxPtr == NULL )
+                  Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
+                             GetBufMode, lv, SPID, SSib );
+#              endif
+
+               memcpy( SendPtr, FluxPtr[0], DataUnit_ResF*sizeof(real) );
+
+               SendPtr += DataUnit_ResF;
+            }
+
+//          electric field of DATA_RESTRICT_FLUX
+#           ifdef MHD
+            if ( WithResE )
+            for (int t=0; t<SendResE_NList[r]; t++)
+            {
+               const int SPID  = SendResE_IDList [r][t];
+               const int SSib  = SendResE_SibList[r][t];
+               const int SSize = ( SSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+
+               const real *ElePtr = amr->patch[0][lv][SPID]->electric[SSib];
+
+#              ifdef GAMER_DEBUG
+               if ( ElePtr == NULL )
+                  Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
+                             GetBufMode, lv, SPID, SSib );
+#              endif
+
+               memcpy( SendPtr, ElePtr, SSize*sizeof(real) );
+
+               SendPtr += SSize;
+            }
+#           endif
          } // for (int r=0; r<MPI_NRank; r++)
-         break; // case DATA_RESTRICT
+         break; // case DATA_RESTRICT and DATA_RESTRICT_FLUX
 
 
       case COARSE_FINE_FLUX :
@@ -1094,36 +1686,152 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    } // switch ( GetBufMode )
 
 #  ifdef TIMING
-   if ( OPT__TIMING_MPI )  Timer_MPI[0]->Stop();
+   if ( OPT__TIMING_MPI  &&  Start )   Timer_MPI[0]->Stop();
 #  endif
 
 
 
-// 4. transfer data by MPI_Alltoallv
+// 4. transfer data by the non-blocking point-to-point communication (or neighborhood collective)
 // ============================================================================================================
 #  ifdef TIMING
 // it's better to add barrier before timing transferring data through MPI
 // --> so that the timing results (i.e., the MPI bandwidth reported by OPT__TIMING_MPI ) does NOT include
 //     the time waiting for other ranks to reach here
 // --> make the MPI bandwidth measured here more accurate
-   if ( OPT__TIMING_BARRIER )    MPI_Barrier( MPI_COMM_WORLD );
+// --> the barrier is skipped when overlapping the transfer with computation
+   if ( OPT__TIMING_BARRIER  &&  Start  &&  Finish )
+   {
+      Timer_GetBuf_Wait[lv]->Start();
+      MPI_Barrier( MPI_COMM_WORLD );
+      Timer_GetBuf_Wait[lv]->Stop();
+   }
 
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
 #  endif
 
-#  ifdef FLOAT8
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_DOUBLE,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_DOUBLE, MPI_COMM_WORLD );
-#  else
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_FLOAT,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_FLOAT,  MPI_COMM_WORLD );
-#  endif
+// send types are stored after all recv types
+   if ( Start  &&  UseDerivedType )
+   for (int r=0, t=NType_Recv; r<MPI_NRank; r++)
+   {
+      if ( Send_NCount[r] > 0 )
+         MPI_Isend( MPI_BOTTOM, 1, Type[ t ++ ], r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   else if ( Start  &&  UseDistGraph )
+   {
+      const int  NNeighbor    = amr->LB->NNeighbor   [lv];
+      const int *NeighborRank = amr->LB->NeighborRank[lv];
+
+#     ifdef GAMER_DEBUG
+      for (int r=0, n=0; r<MPI_NRank; r++)
+      {
+         if ( n < NNeighbor  &&  NeighborRank[n] == r )
+         {
+            n ++;
+            continue;
+         }
+
+         if (  r != MPI_Rank  &&  ( Send_NCount[r] > 0 || Recv_NCount[r] > 0 )  )
+            Aux_Error( ERROR_INFO, "rank %d is not a neighbor at lv %d (send %d, recv %d) !!\n",
+                       r, lv, Send_NCount[r], Recv_NCount[r] );
+      }
+#     endif
+
+//    the count and displacement arrays must not be released until the transfer completes
+      NeighborCount = new int [ 4*NNeighbor + 1 ];
+
+      int *Send_NCount_Nei = NeighborCount;
+      int *Send_NDisp_Nei  = NeighborCount + 1*NNeighbor;
+      int *Recv_NCount_Nei = NeighborCount + 2*NNeighbor;
+      int *Recv_NDisp_Nei  = NeighborCount + 3*NNeighbor;
+
+      for (int n=0; n<NNeighbor; n++)
+      {
+         Send_NCount_Nei[n] = Send_NCount[ NeighborRank[n] ];
+         Send_NDisp_Nei [n] = Send_NDisp [ NeighborRank[n] ];
+         Recv_NCount_Nei[n] = Recv_NCount[ NeighborRank[n] ];
+         Recv_NDisp_Nei [n] = Recv_NDisp [ NeighborRank[n] ];
+      }
+
+      if ( Send_NCount[MPI_Rank] > 0 )
+         memcpy( RecvBuf + Recv_NDisp[MPI_Rank], SendBuf + Send_NDisp[MPI_Rank], Send_NCount[MPI_Rank]*sizeof(real) );
+
+      MPI_Ineighbor_alltoallv( SendBuf, Send_NCount_Nei, Send_NDisp_Nei, RealType,
+                               RecvBuf, Recv_NCount_Nei, Recv_NDisp_Nei, RealType,
+                               amr->LB->NeighborComm[lv], &Req[ NReq ++ ] );
+   } // else if ( Start  &&  UseDistGraph )
+
+   else if ( Start  &&  Batch_Stage == BATCH_NONE )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Send_NCount[r] == 0 )    continue;
+
+      if ( r == MPI_Rank )
+         memcpy( RecvBuf + Recv_NDisp[r], SendBuf + Send_NDisp[r], Send_NCount[r]*sizeof(real) );
+      else
+         MPI_Isend( SendBuf + Send_NDisp[r], Send_NCount[r], RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+// record the time blocked in MPI_Waitall() for the critical-path analysis in Aux_Record_Timing()
+   if ( Finish )
+   {
+#     ifdef TIMING
+      Timer_GetBuf_Wait[lv]->Start();
+#     endif
+
+      MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+#     ifdef TIMING
+      Timer_GetBuf_Wait[lv]->Stop();
+#     endif
+   }
+
+   if ( Finish )
+   for (int t=0; t<NType; t++)   MPI_Type_free( &Type[t] );
+
+   if ( Finish )
+   {
+      delete [] NeighborCount;
+      NeighborCount = NULL;
+   }
 
 #  ifdef TIMING
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
 #  endif
 
 
+// keep the requests and return in the start phase
+// --> LB_GetBufferData_Batch() transfers the data by itself
+   if ( !Finish )
+   {
+      if ( Batch_Stage == BATCH_PACK )
+      {
+         delete [] Req;
+         delete [] Type;
+      }
+
+      else
+      {
+         Pending_Req   = Req;
+         Pending_NReq  = NReq;
+         Pending_Type  = Type;
+         Pending_NType = NType;
+         Pending_NeighborCount = NeighborCount;
+      }
+
+      delete [] Send_NCount;
+      delete [] Recv_NCount;
+      delete [] Send_NDisp;
+      delete [] Recv_NDisp;
+      delete [] TFluVarIdxList;
+#     ifdef MHD
+      delete [] TMagVarIdxList;
+#     endif
+
+      return;
+   }
+
+
 
 // 5. store the received data to their corresponding patches
 // ============================================================================================================
@@ -1131,6 +1839,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    if ( OPT__TIMING_MPI )  Timer_MPI[2]->Start();
 #  endif
 
+// data have been stored to the patches directly for OPT__LB_DERIVED_TYPE
+   if ( !UseDerivedType )
    switch ( GetBufMode )
    {
       case DATA_GENERAL : case DATA_AFTER_REFINE :
@@ -1260,6 +1970,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               break;
                          } // switch ( TMagVarIdx )
                      } //for (int v=0; v<NVarFC_Mag; v++)
+                     if ( ExchangeMag )  amr->patch[MagSg][lv][RPID]->emag_valid = false;
 #                    endif // #ifdef MHD
 
                   } // if ( RSib & (1<<s) )
@@ -1376,6 +2087,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               break;
                          } // switch ( TMagVarIdx )
                      } //for (int v=0; v<NVarFC_Mag; v++)
+                     if ( ExchangeMag )  amr->patch[MagSg][lv][RPID]->emag_valid = false;
 #                    endif // #ifdef MHD
 
                   } // if ( RSib & (1<<s) )
@@ -1483,6 +2195,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               break;
                          } // switch ( TMagVarIdx )
                      } //for (int v=0; v<NVarFC_Mag; v++)
+                     if ( ExchangeMag )  amr->patch[MagSg][lv][RPID]->emag_valid = false;
                   } // if ( RSib & (1<<s) )
                } // for (int s=0; s<27; s++)
             } // for (int t=0; t<RecvY_NList[r]; t++)
@@ -1492,7 +2205,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          break; // case DATA_AFTER_FIXUP
 
 
-      case DATA_RESTRICT :
+      case DATA_RESTRICT : case DATA_RESTRICT_FLUX :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
@@ -1548,10 +2261,70 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                   memcpy( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1*sizeof(real) );
                   RecvPtr += SQR( PS1 )*PS1P1;
                }
+               if ( ExchangeMag )  amr->patch[MagSg][lv][RPID]->emag_valid = false;
 #              endif
             } // for (int t=0; t<Recv_NList[r]; t++)
+
+//          fluxes of DATA_RESTRICT_FLUX
+            if ( GetBufMode == DATA_RESTRICT_FLUX )
+            for (int t=0; t<RecvResF_NList[r]; t++)
+            {
+               const int RPID = RecvResF_IDList [r][ RecvResF_IDList_IdxTable[r][t] ];
+               const int RSib = RecvResF_SibList[r][t];
+               real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
+
+#              ifdef GAMER_DEBUG
+               if ( FluxPtr == NULL )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
+                             GetBufMode, lv, RPID, RSib );
+#              endif
+
+//             add (not replace) flux array with the received flux
+//             --> replace it for BIT_REP_FLUX since the buffer fluxes have been initialized as the coarse-grid
+//                 fluxes by LB_SeedBufferFlux()
+               for (int v=0; v<NFLUX_TOTAL; v++)
+               for (int m=0; m<PS1; m++)
+               for (int n=0; n<PS1; n++)
+#                 ifdef BIT_REP_FLUX
+                  FluxPtr[v][m][n]  = *RecvPtr ++;
+#                 else
+                  FluxPtr[v][m][n] += *RecvPtr ++;
+#                 endif
+            }
+
+//          electric field of DATA_RESTRICT_FLUX
+#           ifdef MHD
+            if ( WithResE )
+            for (int t=0; t<RecvResE_NList[r]; t++)
+            {
+               const int RPID  = RecvResE_IDList [r][ RecvResE_IDList_IdxTable[r][t] ];
+               const int RSib  = RecvResE_SibList[r][t];
+               const int RSize = ( RSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+
+               real *ElePtr = amr->patch[0][lv][RPID]->electric[RSib];
+
+#              ifdef GAMER_DEBUG
+               if ( ElePtr == NULL )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
+                             GetBufMode, lv, RPID, RSib );
+
+               if ( RSib >= 6  &&  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, electric field has been corrected already (lv %d, RPID %d, RSib %d) !!\n",
+                             GetBufMode, lv, RPID, RSib );
+#              endif
+
+//             add (not replace) electric field array with the received data
+               for (int i=0; i<RSize; i++)   ElePtr[i] += RecvPtr[i];
+
+               RecvPtr += RSize;
+
+#              ifdef GAMER_DEBUG
+               if ( RSib >= 6 )  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] = true;
+#              endif
+            }
+#           endif
          } // for (int r=0; r<MPI_NRank; r++)
-         break; // case DATA_RESTRICT
+         break; // case DATA_RESTRICT and DATA_RESTRICT_FLUX
 
 
       case COARSE_FINE_FLUX :
@@ -1575,13 +2348,19 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #              endif
 
 //             add (not replace) flux array with the received flux
+//             --> replace it for BIT_REP_FLUX since the buffer fluxes have been initialized as the coarse-grid
+//                 fluxes by LB_SeedBufferFlux()
                for (int v=0; v<NVarCC_Flu; v++)
                {
                   const int TFluVarIdx = TFluVarIdxList[v];
 
                   for (int m=0; m<PS1; m++)
                   for (int n=0; n<PS1; n++)
+#                    ifdef BIT_REP_FLUX
+                     FluxPtr[TFluVarIdx][m][n]  = RecvPtr[ Counter ++ ];
+#                    else
                      FluxPtr[TFluVarIdx][m][n] += RecvPtr[ Counter ++ ];
+#                    endif
                }
             } // for (int t=0; t<Recv_NList[r]; t++)
          } // for (int r=0; r<MPI_NRank; r++)
@@ -1640,8 +2419,9 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 // 6. record the achieved MPI bandwidth
 // ============================================================================================================
+// --> recorded for all requests together by LB_GetBufferData_Batch()
 #  ifdef TIMING
-   if ( OPT__TIMING_MPI )
+   if ( OPT__TIMING_MPI  &&  Batch_Stage == BATCH_NONE )
    {
       char FileName[100];
       sprintf( FileName, "Record__TimingMPI_Rank%05d", MPI_Rank );
@@ -1653,6 +2433,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          case DATA_AFTER_REFINE :   sprintf( ModeName, "%s", "FluAfRef"                 );   break;
          case DATA_AFTER_FIXUP :    sprintf( ModeName, "%s", "FluAfFix"                 );   break;
          case DATA_RESTRICT :       sprintf( ModeName, "%s", "FluRes"                   );   break;
+         case DATA_RESTRICT_FLUX :  sprintf( ModeName, "%s", "FluResFlux"               );   break;
 #        ifdef GRAVITY
          case POT_FOR_POISSON :     sprintf( ModeName, "%s", "Pot4Poi"                  );   break;
          case POT_AFTER_REFINE :    sprintf( ModeName, "%s", "PotAfRef"                 );   break;
@@ -1673,7 +2454,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       const double RecvMB = NRecv_Total*sizeof(real)*1.0e-6;
 
       fprintf( File, "%3d %15s %4d %4d %10.5f %10.5f %10.5f %8.3f %8.3f %10.3f %10.3f\n",
-               lv, ModeName, NVarCC_Tot, (GetBufMode==DATA_RESTRICT || GetBufMode==COARSE_FINE_FLUX)?-1:ParaBuf,
+               lv, ModeName, NVarCC_Tot, (GetBufMode==DATA_RESTRICT || GetBufMode==DATA_RESTRICT_FLUX || GetBufMode==COARSE_FINE_FLUX)?-1:ParaBuf,
                Timer_MPI[0]->GetValue(), Timer_MPI[2]->GetValue(), Timer_MPI[1]->GetValue(),
                SendMB, RecvMB, SendMB/Timer_MPI[1]->GetValue(), RecvMB/Timer_MPI[1]->GetValue() );
 
@@ -1692,6 +2473,13 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    delete [] Recv_NCount;
    delete [] Send_NDisp;
    delete [] Recv_NDisp;
+   delete [] Req;
+   delete [] Type;
+   Pending_Req   = NULL;
+   Pending_NReq  = 0;
+   Pending_Type  = NULL;
+   Pending_NType = 0;
+   Pending_NeighborCount = NULL;
    delete [] TFluVarIdxList;
 #  ifdef MHD
    delete [] TMagVarIdxList;
@@ -1701,7 +2489,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 #  ifdef MHD
 // 8. ensure consistency of B field on the common interfaces between nearby **leaf and non-leaf real** patches
-//    on level lv for the mode DATA_RESTRICT
+//    on level lv for the modes DATA_RESTRICT and DATA_RESTRICT_FLUX
 //    --> do this after recording MPI bandwidth to avoid overwriting Timer_MPI[]
 //    --> this operation is necessary because the MPI communication of DATA_RESTRICT only fills up the data of
 //        **non-leaf real** patches whose sons are not home
@@ -1720,7 +2508,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 //        for the mode DATA_AFTER_FIXUP to ensure consistency of B field on the common interfaces between
 //        nearby **buffer** patches
 // ============================================================================================================
-   if ( GetBufMode == DATA_RESTRICT )
+   if ( GetBufMode == DATA_RESTRICT  ||  GetBufMode == DATA_RESTRICT_FLUX )
    {
 //    8.1. case (2) above
       for (int r=0; r<MPI_NRank; r++)
@@ -1761,6 +2549,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 //    8.2.2. copy data from non-leaf buffer patches to leaf real patches
 //    --> for simplicity, it always works on all three components regardless of TVarFC
       const int MirrorSib[6] = { 1, 0, 3, 2, 5, 4 };
+#     pragma omp parallel for schedule( runtime )
       for (int RealPID=0; RealPID<amr->NPatchComma[lv][1]; RealPID++)
       {
          if ( amr->patch[0][lv][RealPID]->son == -1 )
@@ -1774,7 +2563,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             }
          }
       }
-   } // if ( GetBufMode == DATA_RESTRICT )
+   } // if ( GetBufMode == DATA_RESTRICT  ||  GetBufMode == DATA_RESTRICT_FLUX )
 
 
 
@@ -1790,7 +2579,95 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       MHD_LB_EnsureBFieldConsistencyAfterRestrict( lv );
 #  endif // #ifdef MHD
 
-} // FUNCTION : LB_GetBufferData
+} // FUNCTION : LB_GetBufferData_Phase
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_CreateType
+// Description :  Create the MPI derived datatype describing all cell-centered data exchanged with one rank
+//                for OPT__LB_DERIVED_TYPE
+//
+// Note        :  1. Invoked by LB_GetBufferData_Phase()
+//                2. Each block is a slab of one variable in one patch with the absolute address as the displacement
+//                   --> Must be used with the buffer MPI_BOTTOM
+//                   --> Blocks follow the same order as the send/recv arrays: patch -> sibling -> fluid variables -> potential
+//                3. The returned type is committed and must be freed by MPI_Type_free()
+//
+// Parameter   :  lv              : Target refinement level
+//                FluSg/PotSg     : Sandglasses of the fluid and potential data
+//                NList           : Number of target patches
+//                IDList          : Target patch indices
+//                IDList_IdxTable : Table mapping the sorted SibList to IDList (NULL --> identity)
+//                SibList         : Sibling bitmasks of the target patches
+//                NVarCC_Flu      : Number of fluid variables
+//                TFluVarIdxList  : Fluid variable indices
+//                ExchangePot     : Exchange the potential as well
+//                SlabType        : Datatypes of the slabs in all 27 directions
+//
+// Return      :  Committed MPI datatype
+//-------------------------------------------------------------------------------------------------------
+MPI_Datatype LB_GetBufferData_CreateType( const int lv, const int FluSg, const int PotSg, const int NList,
+                                          const int *IDList, const int *IDList_IdxTable, const int *SibList,
+                                          const int NVarCC_Flu, const int *TFluVarIdxList, const bool ExchangePot,
+                                          const MPI_Datatype SlabType[] )
+{
+
+   const int NVar = NVarCC_Flu + ( (ExchangePot) ? 1 : 0 );
+
+// count the number of blocks
+   int NBlock = 0;
+
+   for (int t=0; t<NList; t++)
+   for (int s=0; s<27; s++)
+      if ( SibList[t] & (1<<s) )    NBlock += NVar;
+
+   int          *BlockLen  = new int          [NBlock];
+   MPI_Aint     *BlockDisp = new MPI_Aint     [NBlock];
+   MPI_Datatype *BlockType = new MPI_Datatype [NBlock];
+
+// record the slabs
+   int b = 0;
+
+   for (int t=0; t<NList; t++)
+   {
+      const int PID = ( IDList_IdxTable == NULL ) ? IDList[t] : IDList[ IDList_IdxTable[t] ];
+
+      for (int s=0; s<27; s++)
+      {
+         if ( !( SibList[t] & (1<<s) ) )  continue;
+
+         for (int v=0; v<NVarCC_Flu; v++)
+         {
+            BlockLen [b] = 1;
+            BlockType[b] = SlabType[s];
+            MPI_Get_address( amr->patch[FluSg][lv][PID]->fluid[ TFluVarIdxList[v] ], &BlockDisp[b] );
+            b ++;
+         }
+
+#        ifdef GRAVITY
+         if ( ExchangePot )
+         {
+            BlockLen [b] = 1;
+            BlockType[b] = SlabType[s];
+            MPI_Get_address( amr->patch[PotSg][lv][PID]->pot, &BlockDisp[b] );
+            b ++;
+         }
+#        endif
+      }
+   } // for (int t=0; t<NList; t++)
+
+   MPI_Datatype Type;
+   MPI_Type_create_struct( NBlock, BlockLen, BlockDisp, BlockType, &Type );
+   MPI_Type_commit( &Type );
+
+   delete [] BlockLen;
+   delete [] BlockDisp;
+   delete [] BlockType;
+
+   return Type;
+
+} // FUNCTION : LB_GetBufferData_CreateType
 
 
 
@@ -1883,4 +2760,28 @@ void LB_GetBufferData_MemFree()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_MemSize
+// Description :  Return the memory consumption of the MPI send and recv buffers
+//
+// Note        :  Invoked by Aux_GetMemInfo()
+//
+// Parameter   :  None
+//
+// Return      :  Number of bytes allocated for the MPI send and recv buffers
+//-------------------------------------------------------------------------------------------------------
+long LB_GetBufferData_MemSize()
+{
+
+   long MemSize = 0;
+
+   if ( MPI_SendBuf_Shared != NULL )   MemSize += (long)SendBufSize*sizeof(real);
+   if ( MPI_RecvBuf_Shared != NULL )   MemSize += (long)RecvBufSize*sizeof(real);
+
+   return MemSize;
+
+} // FUNCTION : LB_GetBufferData_MemSize
+
+
+
 #endif // #ifdef LOAD_BALANCE
@@ -14,6 +14,10 @@ void Init_ByFunction_AssignData( const int lv );
 // Note        :  1. Alternative function of Init_ByFunction()
 //                2. Optimize load balancing on a level-by-level basis
 //                   --> By invoking LB_Init_LoadBalance()
+//                3. When the refinement map is loaded for OPT__INIT_REFINE_MAP, construct the entire AMR hierarchy
+//                   first and then optimize load balancing of all levels jointly by a single LB_Init_LoadBalance()
+//                   --> Initial condition is assigned only once, after the patches are redistributed
+//                   --> Flag_Real() is replaced by Init_RefineMap_Flag()
 //
 // Parameter   :  None
 //
@@ -27,6 +31,7 @@ void LB_Init_ByFunction()
 
    const bool   FindHomePatchForPar_Yes = true;
    const bool   Redistribute_Yes        = true;
+   const bool   Incremental_No          = false;
    const bool   ResetLB_Yes             = true;
 #  ifdef PARTICLE
    const double Par_Weight              = amr->LB->Par_Weight;
@@ -35,7 +40,54 @@ void LB_Init_ByFunction()
 #  endif
 
 
-// construct all levels
+// load the refinement map
+   const bool UseRefineMap = Init_RefineMap_Load();
+
+
+// construct all levels from the refinement map
+   if ( UseRefineMap )
+   {
+//    1. construct the AMR hierarchy without assigning data
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ...\n", lv );
+
+         if ( lv == 0 )
+            Init_UniformGrid( lv, FindHomePatchForPar_Yes );
+
+         else
+         {
+            Init_RefineMap_Flag( lv-1 );
+
+            LB_Init_Refine( lv-1 );
+         }
+
+         Mis_GetTotalPatchNumber( lv );
+
+         if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ... done\n", lv );
+      }
+
+      Init_RefineMap_Free();
+
+//    2. load balance all levels at once
+      LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, Par_Weight, ResetLB_Yes, -1 );
+
+//    3. assign initial condition on grids and fill up the buffer patches
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Assigning data on level %d ...\n", lv );
+
+         Init_ByFunction_AssignData( lv );
+
+         Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
+
+         if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Assigning data on level %d ... done\n", lv );
+      }
+   } // if ( UseRefineMap )
+
+
+// construct all levels by flagging
+   else
    for (int lv=0; lv<NLEVEL; lv++)
    {
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ...\n", lv );
@@ -59,7 +111,7 @@ void LB_Init_ByFunction()
       Init_ByFunction_AssignData( lv );
 
 //    load balance
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv );
+      LB_Init_LoadBalance( Redistribute_Yes, Incremental_No, Par_Weight, ResetLB_Yes, lv );
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ... done\n", lv );
 
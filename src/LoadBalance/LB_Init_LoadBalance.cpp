@@ -31,6 +31,10 @@ static void LB_RedistributeParticle_End( real **ParAtt_Old );
 //                                         and LB_RedistributeRealPatch() to redistribute all real patches
 //                                     --> Currently it is used only during the RESTART process since we already call
 //                                         LB_SetCutPoint() and load real patches accordingly when calling Init_ByRestart_*()
+//                Incremental  : Only shift the existing cut points by the minimum amount required to bound the
+//                               load imbalance instead of recomputing them from scratch
+//                               --> Useful only when "Redistribute == true"
+//                               --> See LB_SetCutPoint()
 //                ParWeight    : Relative load-balance weighting of particles
 //                               --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*ParWeight"
 //                               --> <= 0.0 : do not consider particle weighting
@@ -46,7 +50,8 @@ static void LB_RedistributeParticle_End( real **ParAtt_Old );
 //                               --> 0~TOP_LEVEL : only apply to a specific level
 //                                   <0          : apply to all levels
 //-------------------------------------------------------------------------------------------------------
-void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv )
+void LB_Init_LoadBalance( const bool Redistribute, const bool Incremental, const double ParWeight, const bool Reset,
+                          const int TLv )
 {
 
    if ( MPI_Rank == 0 )
@@ -83,12 +88,29 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
    const int lv_max = ( TLv < 0 ) ? TOP_LEVEL : TLv;
 
 
+// the ghost zones cached by Prepare_PatchData() no longer apply to the redistributed patches
+   for (int lv=lv_min; lv<=lv_max; lv++)
+   {
+      Prepare_PatchData_InvalidateGhostCache( lv );
+
+      if ( lv+1 < NLEVEL )    Prepare_PatchData_FreeGhostCache( lv+1 );
+   }
+
+
 // 1. set up the load-balance cut points (must do this before calling LB_RedistributeParticle_Init())
+//    --> set the cut points of all levels jointly for OPT__LB_COUPLE_LEVEL
    const bool InputLBIdxAndLoad_No = false;
 
    if ( Redistribute )
-   for (int lv=lv_min; lv<=lv_max; lv++)
-      LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdxAndLoad_No, NULL, NULL, ParWeight );
+   {
+      if ( OPT__LB_COUPLE_LEVEL  &&  TLv < 0 )
+         LB_SetCutPoint_CoupleLevel( ParWeight );
+
+      else
+      for (int lv=lv_min; lv<=lv_max; lv++)
+         LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdxAndLoad_No, NULL, NULL, NULL_INT,
+                         ParWeight, Incremental );
+   }
 
 
 // 2. reinitialize arrays used by the load-balance routines
@@ -103,6 +125,12 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
 
 
 // 3. re-distribute and allocate all patches (and their associated particles)
+// --> particles collected by Par_CollectParticle2OneLevel() (e.g., in LB_SetCutPoint()) no longer apply
+//     after redistribution
+#  ifdef PARTICLE
+   Par_CollectParticle2OneLevel_InvalidateCache();
+#  endif
+
    const bool RemoveParFromRepo_Yes = true;
    const bool RemoveParFromRepo_No  = false;
 
@@ -234,7 +262,11 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
       if ( OPT__OVERLAP_MPI )
       LB_RecordOverlapMPIPatchID( lv );
 
-//    5.7 list for exchanging particles
+//    5.7 communicator for the neighborhood collectives
+      if ( OPT__LB_DIST_GRAPH )
+      LB_RecordNeighborGraph( lv );
+
+//    5.8 list for exchanging particles
 #     ifdef PARTICLE
       Par_LB_RecordExchangeParticlePatchID( lv );
 #     endif
@@ -242,7 +274,7 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
    } // for (int lv=lv_min_mpi; lv<=lv_max_mpi; lv++)
 
-// 5.8 list for exchanging particles on TLv+1
+// 5.9 list for exchanging particles on TLv+1
 #  ifdef PARTICLE
    if ( TLv >= 0  &&  TLv < TOP_LEVEL )
    Par_LB_RecordExchangeParticlePatchID( TLv+1 );
@@ -713,6 +745,9 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
    for (int t=0; t<NRecv_Total_Patch; t++)   ParListSizeMax = MAX( ParListSizeMax, RecvBuf_NPar[t] );
 
    ParList = new long [ParListSizeMax];
+
+// enlarge the particle repository only once for all received particles
+   amr->Par->Reserve( NRecv_Total_ParData/PAR_NATT_TOTAL );
 #  endif // #ifdef PARTICLE
 
    for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
@@ -769,27 +804,26 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 
 //       particle
 #        ifdef PARTICLE
+//       add particles to the particle repository and store the new particle indices
+         amr->Par->AddParticles( RecvBuf_NPar[PID], RecvPtr_Par, ParList );
+         RecvPtr_Par += (long)RecvBuf_NPar[PID]*PAR_NATT_TOTAL;
+
+//       we do not transfer inactive particles
+#        ifdef DEBUG_PARTICLE
          for (int p=0; p<RecvBuf_NPar[PID]; p++)
          {
-//          add a single particle to the particle repository
-            ParID        = amr->Par->AddOneParticle( RecvPtr_Par );
-            RecvPtr_Par += PAR_NATT_TOTAL;
-
-//          store the new particle index
-            ParList[p] = ParID;
+            ParID = ParList[p];
 
-//          we do not transfer inactive particles
-#           ifdef DEBUG_PARTICLE
             if ( amr->Par->Attribute[PAR_MASS][ParID] < (real)0.0 )
                Aux_Error( ERROR_INFO, "Transferring inactive particle (ParID %d, Mass %14.7e) !!\n",
                           ParID, amr->Par->Attribute[PAR_MASS][ParID] );
-#           endif
          }
+#        endif
 
 //       6.3 associate particles with their home patches
 #        ifdef DEBUG_PARTICLE
 //       do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//       may change after calling amr->Par->AddOneParticle()
+//       may change after calling amr->Par->AddParticles()
          const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
          char Comment[100];
          sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, RecvBuf_NPar[PID] );
@@ -821,7 +855,10 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 
    for (int PID=0; PID<NRecv_Total_Patch; PID++)   amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
 
-   Mis_Heapsort( NRecv_Total_Patch, amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+   Mis_RadixSort( NRecv_Total_Patch, amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+// the son directory at lv is no longer valid (see LB_FindSonNotHome())
+   amr->LB->ResetSonDir( lv );
 
 
 // 8. deallocate the MPI recv buffers
@@ -35,6 +35,12 @@ void LB_Init_Refine( const int FaLv )
       Aux_Error( ERROR_INFO, "number of son patches on level %d = %d != 0 !!\n", SonLv, amr->num[SonLv] );
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after refinement
+#  ifdef PARTICLE
+   Par_CollectParticle2OneLevel_InvalidateCache();
+#  endif
+
+
 // loop over all **real** patches on FaLv
    for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
    {
@@ -9,8 +9,12 @@
 // Function    :  LB_Output_LBIdx
 // Description :  Output the load-balance indices and their corresponding coordinates for all real patches
 //
-// Note        :  Output file can be directly plotted by gnuplot
-//                For example, try "splot 'LBIdxMap_Lv00' u 2:3:4 every :::0::0 w lp"
+// Note        :  1. Output file can be directly plotted by gnuplot
+//                   For example, try "splot 'LBIdxMap_Lv00' u 2:3:4 every :::0::0 w lp"
+//                2. Also report the fraction of real patches on lv whose sons reside in a different rank
+//                   --> Data exchanges between these fathers and sons (e.g., restriction and flux fix-up)
+//                       require MPI communication
+//                   --> Useful for evaluating OPT__LB_COUPLE_LEVEL
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -70,6 +74,37 @@ void LB_Output_LBIdx( const int lv )
 
    } // for (int YourTurn=0; YourTurn<MPI_NRank; YourTurn++)
 
+
+// report the fraction of fathers with sons in other ranks
+// --> son <= SON_OFFSET_LB indicates that the sons reside in the rank "SON_OFFSET_LB-son"
+   long NFa_ThisRank[2] = { 0, 0 };    // [0/1] : all fathers / fathers with sons in other ranks
+   long NFa_AllRank [2];
+
+   for (int PID=0; PID<NP; PID++)
+   {
+      const int SonPID = amr->patch[0][lv][PID]->son;
+
+      if ( SonPID == -1 )  continue;
+
+      NFa_ThisRank[0] ++;
+      if ( SonPID <= SON_OFFSET_LB )   NFa_ThisRank[1] ++;
+   }
+
+   MPI_Reduce( NFa_ThisRank, NFa_AllRank, 2, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      const double Frac = ( NFa_AllRank[0] == 0 ) ? 0.0 : 100.0*NFa_AllRank[1]/NFa_AllRank[0];
+
+      FILE *File = fopen( FileName, "a" );
+      fprintf( File, "# Lv %2d: fathers with sons in other ranks = %ld / %ld (%6.2f%%)\n",
+               lv, NFa_AllRank[1], NFa_AllRank[0], Frac );
+      fclose( File );
+
+      Aux_Message( stdout, "   Lv %2d: fathers with sons in other ranks = %ld / %ld (%6.2f%%)\n",
+                   lv, NFa_AllRank[1], NFa_AllRank[0], Frac );
+   }
+
 } // FUNCTION : LB_Output_LBIdx
 
 
@@ -0,0 +1,93 @@
+#include "GAMER.h"
+
+#if ( defined LOAD_BALANCE  &&  defined TIMING )
+
+extern Timer_t *Timer_Flu_Advance[NLEVEL];
+extern Timer_t *Timer_Gra_Advance[NLEVEL];
+extern Timer_t *Timer_Che_Advance[NLEVEL];
+extern Timer_t *Timer_SF         [NLEVEL];
+extern Timer_t *Timer_Par_Update [NLEVEL][3];
+
+static const double Cost_Factor_Min = 0.1;   // lower and upper bounds of LB->Cost_Factor to avoid noisy
+static const double Cost_Factor_Max = 10.0;  // measurements from concentrating or emptying a rank
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_RecordMeasuredCost
+// Description :  Measure the compute time per unit workload of this rank in the current root-level step and
+//                record its exponential moving average in amr->LB->Cost_Factor
+//
+// Note        :  1. Invoked by main() before LB_EstimateLoadImbalance() when LB_INPUT__MEASURED_COST > 0.0
+//                   --> Must be called before Aux_ResetTimer()
+//                2. Compute time includes the fluid, gravity, chemistry, star-formation, and particle-update
+//                   timers at all levels
+//                   --> MPI communication and flag/refine are excluded since they do not scale with the
+//                       local workload
+//                3. Workload follows the model of LB_EstimateWorkload_AllPatchGroup() weighted by the number
+//                   of updates at each level (amr->NUpdateLv[])
+//                   --> Particles are counted only at the leaf levels (amr->Par->NPar_Lv[])
+//                4. The measurement is normalized by the average over all ranks with a non-zero workload so
+//                   that Cost_Factor ~ 1.0 on a homogeneous system
+//                   --> Cost_Factor > 1.0 indicates a rank running slower than average for the same estimated
+//                       workload (e.g., slower node or more expensive cells)
+//                5. Cost_Factor is bounded by [Cost_Factor_Min, Cost_Factor_Max]
+//                6. Granularity is per rank instead of per patch group since the solvers process patch groups
+//                   in batches
+//-------------------------------------------------------------------------------------------------------
+void LB_RecordMeasuredCost()
+{
+
+// 1. compute time of this rank in this step
+   double Time = 0.0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Time += Timer_Flu_Advance[lv]->GetValue() + Timer_Gra_Advance[lv]->GetValue() +
+              Timer_Che_Advance[lv]->GetValue() + Timer_SF         [lv]->GetValue();
+
+      for (int t=0; t<3; t++)    Time += Timer_Par_Update[lv][t]->GetValue();
+   }
+
+
+// 2. estimated workload of this rank in this step
+   double Load = 0.0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      double Load_lv = amr->NPatchComma[lv][1];
+
+#     ifdef PARTICLE
+      if ( amr->LB->Par_Weight > 0.0 )
+         Load_lv += amr->Par->NPar_Lv[lv]*amr->LB->Par_Weight/(double)CUBE(PS1);
+#     endif
+
+      Load += Load_lv*amr->NUpdateLv[lv];
+   }
+
+
+// 3. normalize by the average over all ranks
+   double Send[2], Recv[2];
+
+   Send[0] = ( Load > 0.0  &&  Time > 0.0 ) ? Time/Load : 0.0;
+   Send[1] = ( Send[0] > 0.0 ) ? 1.0 : 0.0;
+
+   MPI_Allreduce( Send, Recv, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+// skip ranks without a valid measurement and keep their previous Cost_Factor
+   if ( Send[0] == 0.0  ||  Recv[0] == 0.0 )    return;
+
+   double Factor = Send[0] / ( Recv[0]/Recv[1] );
+
+   Factor = MIN( MAX( Factor, Cost_Factor_Min ), Cost_Factor_Max );
+
+
+// 4. exponential moving average
+   amr->LB->Cost_Factor = amr->LB->Cost_EMA*Factor + ( 1.0 - amr->LB->Cost_EMA )*amr->LB->Cost_Factor;
+
+} // FUNCTION : LB_RecordMeasuredCost
+
+
+
+#endif // #if ( defined LOAD_BALANCE  &&  defined TIMING )
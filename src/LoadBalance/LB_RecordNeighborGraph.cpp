@@ -0,0 +1,77 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_RecordNeighborGraph
+// Description :  Construct the distributed graph communicator of the ranks exchanging data at the target level
+//
+// Note        :  1. Invoked by LB_Init_LoadBalance() and LB_Refine() when OPT__LB_DIST_GRAPH is on
+//                   --> Must be invoked AFTER all the send/recv lists at Lv are constructed
+//                       (i.e., LB_RecordExchangeDataPatchID(), LB_RecordExchangeRestrictDataPatchID(),
+//                       LB_AllocateFluxArray(), MHD_LB_AllocateElectricArray(), and LB_RecordExchangeFixUpDataPatchID())
+//                2. Neighbors = all ranks in any send or recv list at Lv excluding this rank
+//                   --> The graph is symmetric since rank A sends data to rank B if and only if B receives data from A
+//                   --> A superset of the ranks involved in any single GetBufMode so that LB_GetBufferData() can use
+//                       the same communicator for all modes
+//                3. Ranks are NOT reordered since the patch distribution is tied to the rank in MPI_COMM_WORLD
+//                4. Used by LB_GetBufferData() for MPI_Ineighbor_alltoallv()
+//
+// Parameter   :  Lv : Target refinement level for constructing the graph
+//-------------------------------------------------------------------------------------------------------
+void LB_RecordNeighborGraph( const int Lv )
+{
+
+// 1. collect the ranks in any send/recv list
+   bool *IsNeighbor = new bool [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      IsNeighbor[r] = (  amr->LB->SendH_NList[Lv][r] > 0  ||  amr->LB->RecvH_NList[Lv][r] > 0  ||
+                         amr->LB->SendX_NList[Lv][r] > 0  ||  amr->LB->RecvX_NList[Lv][r] > 0  ||
+                         amr->LB->SendR_NList[Lv][r] > 0  ||  amr->LB->RecvR_NList[Lv][r] > 0  ||
+                         amr->LB->SendF_NList[Lv][r] > 0  ||  amr->LB->RecvF_NList[Lv][r] > 0  );
+#     ifdef MHD
+      IsNeighbor[r] |= (  amr->LB->SendY_NList[Lv][r] > 0  ||  amr->LB->RecvY_NList[Lv][r] > 0  ||
+                          amr->LB->SendE_NList[Lv][r] > 0  ||  amr->LB->RecvE_NList[Lv][r] > 0  );
+#     endif
+#     ifdef GRAVITY
+      IsNeighbor[r] |= (  amr->LB->SendG_NList[Lv][r] > 0  ||  amr->LB->RecvG_NList[Lv][r] > 0  );
+#     endif
+   }
+
+// data exchanged with this rank itself are copied directly
+   IsNeighbor[MPI_Rank] = false;
+
+
+// 2. record the neighbor ranks
+   if ( amr->LB->NeighborRank[Lv] != NULL )  delete [] amr->LB->NeighborRank[Lv];
+
+   int  NNeighbor    = 0;
+   int *NeighborRank = new int [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+      if ( IsNeighbor[r] )    NeighborRank[ NNeighbor ++ ] = r;
+
+   amr->LB->NNeighbor   [Lv] = NNeighbor;
+   amr->LB->NeighborRank[Lv] = NeighborRank;
+
+
+// 3. construct the communicator
+   if ( amr->LB->NeighborComm[Lv] != MPI_COMM_NULL )  MPI_Comm_free( &amr->LB->NeighborComm[Lv] );
+
+   MPI_Dist_graph_create_adjacent( MPI_COMM_WORLD, NNeighbor, NeighborRank, MPI_UNWEIGHTED,
+                                   NNeighbor, NeighborRank, MPI_UNWEIGHTED, MPI_INFO_NULL, false,
+                                   &amr->LB->NeighborComm[Lv] );
+
+
+   delete [] IsNeighbor;
+
+} // FUNCTION : LB_RecordNeighborGraph
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -18,6 +18,7 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 #ifdef PARTICLE
 void Par_LB_Refine_SendParticle2Father( const int FaLv, const int RefineS2F_Send_NPatchTotal, int *RefineS2F_Send_PIDList );
 #endif
+static void LB_Refine_ClearSibDiffList( const int lv );
 #ifdef MHD
 void MHD_LB_Refine_GetCoarseFineInterfaceBField(
    const int FaLv, const int NNew_Home, const int NNew_Away,
@@ -36,6 +37,9 @@ void MHD_LB_Refine_GetCoarseFineInterfaceBField(
 // Note        :  1. This function will also construct buffer patches at both FaLv and FaLv+1
 //                2. Data of all sibling-buffer patches must be prepared in advance for creating new
 //                   patches at FaLv+1 by spatial interpolation
+//                3. Only patches and MPI lists at FaLv and FaLv+1 are reconstructed
+//                   --> Skip the reconstruction and reuse the previous lists if no patch is allocated or
+//                       deallocated on any rank
 //
 // Parameter   :  FaLv : Target refinement level to be refined
 //-------------------------------------------------------------------------------------------------------
@@ -97,65 +101,89 @@ void LB_Refine( const int FaLv )
                                   CFB_SibLBIdx_Home, CFB_SibLBIdx_Away );
 
 
-// 3. get the magnetic field on the coarse-fine interfaces for the divergence-free interpolation
-// ==========================================================================================
-#  ifdef MHD
-   MHD_LB_Refine_GetCoarseFineInterfaceBField( FaLv, NNew_Home, NNew_Away, CFB_SibLBIdx_Home, CFB_SibLBIdx_Away,
-                                               CFB_SibRank_Home, CFB_SibRank_Away, CFB_BField, CFB_NSibEachRank );
-#  endif
+// skip steps 3-5 if no patch is allocated or deallocated at SonLv on any rank
+// --> the real and buffer patches at FaLv and SonLv and their MPI lists all remain the same and are reused
+// --> only clear the SibDiff lists so that the exchanges after refine (DATA_AFTER_REFINE and POT_AFTER_REFINE)
+//     transfer nothing
+   int NChange_Local = NNew_Home + NDel_Home, NChange_AllRank;
 
+   MPI_Allreduce( &NChange_Local, &NChange_AllRank, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
 
-// 4. allocate/deallocate son patches at FaLv+1
-// ==========================================================================================
-   LB_Refine_AllocateNewPatch( FaLv, NNew_Home, NewPID_Home, NNew_Away, NewCr1D_Away, NewCr1D_Away_IdxTable, NewCData_Away,
-                               NDel_Home, DelPID_Home, NDel_Away, DelCr1D_Away,
-                               RefineS2F_Send_NPatchTotal, RefineS2F_Send_PIDList,
-                               CFB_SibRank_Home, CFB_SibRank_Away, CFB_BField, CFB_NSibEachRank );
-
-
-// 5. construct the MPI send and recv data list
-// ==========================================================================================
-// 5.1 list for exchanging hydro, potential, and magnetic field data in buffer patches (also construct the "SibDiff" lists)
-   LB_RecordExchangeDataPatchID(  FaLv, true );
-   LB_RecordExchangeDataPatchID( SonLv, true );
-
-// 5.2 list for exchanging restricted hydro and magnetic field data
-//     --> note that even when OPT__FIXUP_RESTRICT is off we still need to do data restriction in several places
-//         (e.g., restart, and OPT__CORR_AFTER_ALL_SYNC)
-//     --> for simplicity and sustainability, we always invoke LB_RecordExchangeRestrictDataPatchID()
-   LB_RecordExchangeRestrictDataPatchID(  FaLv );
-   LB_RecordExchangeRestrictDataPatchID( SonLv );
-
-// 5.3 list for exchanging hydro fluxes (and also allocate flux arrays)
-   if ( amr->WithFlux )
+   if ( NChange_AllRank == 0 )
    {
-      LB_AllocateFluxArray(  FaLv );
-      LB_AllocateFluxArray( SonLv );
+      LB_Refine_ClearSibDiffList(  FaLv );
+      LB_Refine_ClearSibDiffList( SonLv );
    }
 
-// 5.4 list for exchanging MHD electric field (and also allocate electric field arrays)
-#  ifdef MHD
-   if ( amr->WithElectric )
+   else
    {
-      MHD_LB_AllocateElectricArray(  FaLv );
-      MHD_LB_AllocateElectricArray( SonLv );
-   }
-#  endif
+   // 3. get the magnetic field on the coarse-fine interfaces for the divergence-free interpolation
+   // ==========================================================================================
+#     ifdef MHD
+      MHD_LB_Refine_GetCoarseFineInterfaceBField( FaLv, NNew_Home, NNew_Away, CFB_SibLBIdx_Home, CFB_SibLBIdx_Away,
+                                                  CFB_SibRank_Home, CFB_SibRank_Away, CFB_BField, CFB_NSibEachRank );
+#     endif
 
-// 5.5 list for exchanging hydro and magnetic field data after the fix-up operation
-//     --> for simplicity and sustainability, we always invoke LB_RecordExchangeFixUpDataPatchID()
-//     --> see the comments 4.2 above
-   LB_RecordExchangeFixUpDataPatchID(  FaLv );
-   LB_RecordExchangeFixUpDataPatchID( SonLv );
 
-// 5.6 list for overlapping MPI time with CPU/GPU computation
-   if ( OPT__OVERLAP_MPI )
-   {
-      LB_RecordOverlapMPIPatchID(  FaLv );
-      LB_RecordOverlapMPIPatchID( SonLv );
-   }
-
-// 5.7 list for exchanging particles
+   // 4. allocate/deallocate son patches at FaLv+1
+   // ==========================================================================================
+      LB_Refine_AllocateNewPatch( FaLv, NNew_Home, NewPID_Home, NNew_Away, NewCr1D_Away, NewCr1D_Away_IdxTable, NewCData_Away,
+                                  NDel_Home, DelPID_Home, NDel_Away, DelCr1D_Away,
+                                  RefineS2F_Send_NPatchTotal, RefineS2F_Send_PIDList,
+                                  CFB_SibRank_Home, CFB_SibRank_Away, CFB_BField, CFB_NSibEachRank );
+
+
+   // 5. construct the MPI send and recv data list
+   // ==========================================================================================
+   // 5.1 list for exchanging hydro, potential, and magnetic field data in buffer patches (also construct the "SibDiff" lists)
+      LB_RecordExchangeDataPatchID(  FaLv, true );
+      LB_RecordExchangeDataPatchID( SonLv, true );
+
+   // 5.2 list for exchanging restricted hydro and magnetic field data
+   //     --> note that even when OPT__FIXUP_RESTRICT is off we still need to do data restriction in several places
+   //         (e.g., restart, and OPT__CORR_AFTER_ALL_SYNC)
+   //     --> for simplicity and sustainability, we always invoke LB_RecordExchangeRestrictDataPatchID()
+      LB_RecordExchangeRestrictDataPatchID(  FaLv );
+      LB_RecordExchangeRestrictDataPatchID( SonLv );
+
+   // 5.3 list for exchanging hydro fluxes (and also allocate flux arrays)
+      if ( amr->WithFlux )
+      {
+         LB_AllocateFluxArray(  FaLv );
+         LB_AllocateFluxArray( SonLv );
+      }
+
+   // 5.4 list for exchanging MHD electric field (and also allocate electric field arrays)
+#     ifdef MHD
+      if ( amr->WithElectric )
+      {
+         MHD_LB_AllocateElectricArray(  FaLv );
+         MHD_LB_AllocateElectricArray( SonLv );
+      }
+#     endif
+
+   // 5.5 list for exchanging hydro and magnetic field data after the fix-up operation
+   //     --> for simplicity and sustainability, we always invoke LB_RecordExchangeFixUpDataPatchID()
+   //     --> see the comments 4.2 above
+      LB_RecordExchangeFixUpDataPatchID(  FaLv );
+      LB_RecordExchangeFixUpDataPatchID( SonLv );
+
+   // 5.6 list for overlapping MPI time with CPU/GPU computation
+      if ( OPT__OVERLAP_MPI )
+      {
+         LB_RecordOverlapMPIPatchID(  FaLv );
+         LB_RecordOverlapMPIPatchID( SonLv );
+      }
+
+   // 5.7 communicator for the neighborhood collectives
+      if ( OPT__LB_DIST_GRAPH )
+      {
+         LB_RecordNeighborGraph(  FaLv );
+         LB_RecordNeighborGraph( SonLv );
+      }
+   } // if ( NChange_AllRank == 0 ) ... else ...
+
+// 5.8 list for exchanging particles
 #  ifdef PARTICLE
    Par_LB_RecordExchangeParticlePatchID( SonLv );
 
@@ -249,4 +277,32 @@ void LB_Refine( const int FaLv )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Refine_ClearSibDiffList
+// Description :  Reset the SibDiff lists at the target level so that no buffer data are exchanged after refine
+//
+// Note        :  1. Invoked by LB_Refine() when no patch is allocated or deallocated
+//                   --> The SibDiff lists would otherwise still record the difference of the previous refine
+//                2. The SibDiff lists share the sizes of the corresponding send/recv lists
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_Refine_ClearSibDiffList( const int lv )
+{
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      for (int t=0; t<amr->LB->SendH_NList[lv][r]; t++)  amr->LB->SendH_SibDiffList[lv][r][t] = 0;
+      for (int t=0; t<amr->LB->RecvH_NList[lv][r]; t++)  amr->LB->RecvH_SibDiffList[lv][r][t] = 0;
+
+#     ifdef GRAVITY
+      for (int t=0; t<amr->LB->SendG_NList[lv][r]; t++)  amr->LB->SendG_SibDiffList[lv][r][t] = 0;
+      for (int t=0; t<amr->LB->RecvG_NList[lv][r]; t++)  amr->LB->RecvG_SibDiffList[lv][r][t] = 0;
+#     endif
+   }
+
+} // FUNCTION : LB_Refine_ClearSibDiffList
+
+
+
 #endif // #ifdef LOAD_BALANCE
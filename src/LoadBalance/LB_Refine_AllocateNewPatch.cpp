@@ -202,6 +202,8 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 #           ifdef MHD
             Aux_SwapPointer( (void**)&amr->patch[FSg_Mag ][SonLv][SonPID]->magnetic,
                              (void**)&amr->patch[FSg_Mag2][SonLv][SonPID]->magnetic );
+            amr->patch[FSg_Mag ][SonLv][SonPID]->emag_valid = false;
+            amr->patch[FSg_Mag2][SonLv][SonPID]->emag_valid = false;
 #           endif
          }
 
@@ -469,7 +471,10 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    for (int SonPID=0; SonPID<SonNReal_New; SonPID++)
       amr->LB->IdxList_Real[SonLv][SonPID] = amr->patch[0][SonLv][SonPID]->LB_Idx;
 
-   Mis_Heapsort( SonNReal_New, amr->LB->IdxList_Real[SonLv], amr->LB->IdxList_Real_IdxTable[SonLv] );
+   Mis_RadixSort( SonNReal_New, amr->LB->IdxList_Real[SonLv], amr->LB->IdxList_Real_IdxTable[SonLv] );
+
+// the son directory at SonLv is no longer valid (see LB_FindSonNotHome())
+   amr->LB->ResetSonDir( SonLv );
 
 
 // 6.4 check : no duplicate patches at FaLv and SonLv
@@ -605,6 +610,8 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 #           ifdef MHD
             Aux_SwapPointer( (void**)&amr->patch[FSg_Mag ][SonLv][     MPID]->magnetic,
                              (void**)&amr->patch[FSg_Mag2][SonLv][OldBufPID]->magnetic );
+            amr->patch[FSg_Mag ][SonLv][     MPID]->emag_valid = false;
+            amr->patch[FSg_Mag2][SonLv][OldBufPID]->emag_valid = false;
 #           endif
 
 //          we must reallocate memory for OldBufPID if it becomes a new real patch (which always have data array allocated)
@@ -647,13 +654,27 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 
       else if ( ! OPT__REUSE_MEMORY )
       {
-         delete [] flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        ifdef GRAVITY
-         delete [] pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        endif
-#        ifdef MHD
-         delete [] mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
-#        endif
+         if ( OPT__PATCH_ARENA )
+         {
+            Mis_PatchArena_Free( PATCH_ARENA_FLU, 2*SonLv+FSg_Flu, flu_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
+#           ifdef GRAVITY
+            Mis_PatchArena_Free( PATCH_ARENA_POT, 2*SonLv+FSg_Pot, pot_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
+#           endif
+#           ifdef MHD
+            Mis_PatchArena_Free( PATCH_ARENA_MAG, 2*SonLv+FSg_Mag, mag_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
+#           endif
+         }
+
+         else
+         {
+            delete [] flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+#           ifdef GRAVITY
+            delete [] pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+#           endif
+#           ifdef MHD
+            delete [] mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+#           endif
+         }
       } // if ( Match_BufBk[t] != -1 ) ... else if ...
    } // for (int t=0; t<NBufBk; t++)
 
@@ -897,9 +918,9 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
 
 #  else // #if ( MODEL == ELBDM )
 
-   for (int v=0; v<NCOMP_TOTAL; v++)
-   Interpolate( CData_Flu+v*CSize_Flu1v, CSize_Flu3, CStart_Flu, CRange_CC, &FData_Flu[v][0][0][0],
-                FSize_CC3, FStart_CC, 1, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, Monotonicity,
+// interpolate all components of the whole patch group at once to share the temporary arrays in Interpolate()
+   Interpolate( CData_Flu, CSize_Flu3, CStart_Flu, CRange_CC, &FData_Flu[0][0][0][0],
+                FSize_CC3, FStart_CC, NCOMP_TOTAL, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, Monotonicity,
                 INT_OPP_SIGN_0TH_ORDER );
 
 #  endif // #if ( MODEL == ELBDM ) ... else
@@ -1262,6 +1283,8 @@ void DeallocateSonPatch( const int FaLv, const int FaPID, const int NNew_Real0,
             const int FSg_Mag2 = 1 - amr->MagSg[SonLv];
             Aux_SwapPointer( (void**)&amr->patch[FSg_Mag2][SonLv][OldPID]->magnetic,
                              (void**)&amr->patch[FSg_Mag2][SonLv][NewPID]->magnetic );
+            amr->patch[FSg_Mag2][SonLv][OldPID]->emag_valid = false;
+            amr->patch[FSg_Mag2][SonLv][NewPID]->emag_valid = false;
 #           endif
          }
 
@@ -0,0 +1,163 @@
+#include "GAMER.h"
+
+#if ( defined LOAD_BALANCE  &&  defined BIT_REP_FLUX )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SeedBufferFlux
+// Description :  Initialize the fluxes in the buffer patches as the coarse-grid fluxes stored in the
+//                corresponding real patches
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() for BIT_REP_FLUX after the coarse-grid fluxes have been stored
+//                   by StoreFlux() and the buffer fluxes have been reset by Buf_ResetBufferFlux()
+//                2. All fine-grid fluxes across a given coarse face come from a single patch group, which lives in
+//                   a single rank
+//                   --> By seeding the buffer fluxes with the coarse-grid fluxes, the fine-grid fluxes are always
+//                       accumulated onto the coarse-grid fluxes by CorrectFlux() in the same order, no matter
+//                       whether the target coarse patch is a real or buffer patch
+//                   --> LB_GetBufferData() with COARSE_FINE_FLUX/DATA_RESTRICT_FLUX then replaces (instead of
+//                       adds to) the real-patch fluxes with the received fluxes
+//                   --> Results are bitwise reproducible without any additional flux array
+//                3. Use the same MPI lists as COARSE_FINE_FLUX but with the send and recv sides swapped
+//                   --> Sending from amr->LB->RecvF_IDList[] and receiving into amr->LB->SendF_IDList[]
+//                4. Use its own MPI buffers since the shared buffers of LB_GetBufferData() may still be in use
+//                   by a pending asynchronous exchange
+//
+// Parameter   :  lv : Target coarse level
+//-------------------------------------------------------------------------------------------------------
+void LB_SeedBufferFlux( const int lv )
+{
+
+// check
+   if ( !amr->WithFlux )
+   {
+      Aux_Message( stderr, "WARNING : invoking %s is useless since no flux is required !!\n", __FUNCTION__ );
+      return;
+   }
+
+
+// nothing to do on the highest level
+   if ( lv == TOP_LEVEL )  return;
+
+
+   const int  DataUnit       = NFLUX_TOTAL*SQR( PS1 );
+   const int *Send_NList     = amr->LB->RecvF_NList          [lv];
+   int      **Send_IDList    = amr->LB->RecvF_IDList         [lv];
+   int      **Send_IdxTable  = amr->LB->RecvF_IDList_IdxTable[lv];
+   int      **Send_SibList   = amr->LB->RecvF_SibList        [lv];
+   const int *Recv_NList     = amr->LB->SendF_NList          [lv];
+   int      **Recv_IDList    = amr->LB->SendF_IDList         [lv];
+   int      **Recv_SibList   = amr->LB->SendF_SibList        [lv];
+
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
+
+
+// 1. set the send/recv counts and displacements
+   long *Send_NDisp = new long [MPI_NRank];
+   long *Recv_NDisp = new long [MPI_NRank];
+   long  NSend_Total = 0, NRecv_Total = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = NSend_Total;
+      Recv_NDisp[r] = NRecv_Total;
+
+      NSend_Total  += (long)Send_NList[r]*DataUnit;
+      NRecv_Total  += (long)Recv_NList[r]*DataUnit;
+   }
+
+   real        *SendBuf = new real [NSend_Total];
+   real        *RecvBuf = new real [NRecv_Total];
+   MPI_Request *Req     = new MPI_Request [ 2*MPI_NRank ];
+   int          NReq    = 0;
+
+
+// 2. post the non-blocking receives
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Recv_NList[r] > 0  &&  r != MPI_Rank )
+         MPI_Irecv( RecvBuf + Recv_NDisp[r], Recv_NList[r]*DataUnit, RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+
+// 3. prepare the send array
+// --> must follow the order expected by the receiving side of COARSE_FINE_FLUX
+#  pragma omp parallel for schedule( runtime )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      real *SendPtr = SendBuf + Send_NDisp[r];
+
+      for (int t=0; t<Send_NList[r]; t++)
+      {
+         const int SPID = Send_IDList [r][ Send_IdxTable[r][t] ];
+         const int SSib = Send_SibList[r][t];
+         const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
+
+#        ifdef GAMER_DEBUG
+         if ( FluxPtr == NULL )
+            Aux_Error( ERROR_INFO, "patch[0][%d][%d]->flux[%d] has not been allocated !!\n", lv, SPID, SSib );
+#        endif
+
+         memcpy( SendPtr, FluxPtr, DataUnit*sizeof(real) );
+
+         SendPtr += DataUnit;
+      }
+   }
+
+
+// 4. send data (data sent to this rank itself are copied directly)
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Send_NList[r] == 0 )  continue;
+
+      if ( r == MPI_Rank )
+         memcpy( RecvBuf + Recv_NDisp[r], SendBuf + Send_NDisp[r], (long)Send_NList[r]*DataUnit*sizeof(real) );
+      else
+         MPI_Isend( SendBuf + Send_NDisp[r], Send_NList[r]*DataUnit, RealType, r, 0, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+
+// 5. store the received coarse-grid fluxes in the buffer patches
+#  pragma omp parallel for schedule( runtime )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      const real *RecvPtr = RecvBuf + Recv_NDisp[r];
+
+      for (int t=0; t<Recv_NList[r]; t++)
+      {
+         const int RPID = Recv_IDList [r][t];
+         const int RSib = Recv_SibList[r][t];
+         real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
+
+#        ifdef GAMER_DEBUG
+         if ( FluxPtr == NULL )
+            Aux_Error( ERROR_INFO, "patch[0][%d][%d]->flux[%d] has not been allocated !!\n", lv, RPID, RSib );
+#        endif
+
+         memcpy( FluxPtr, RecvPtr, DataUnit*sizeof(real) );
+
+         RecvPtr += DataUnit;
+      }
+   }
+
+
+// 6. free memory
+   delete [] Send_NDisp;
+   delete [] Recv_NDisp;
+   delete [] SendBuf;
+   delete [] RecvBuf;
+   delete [] Req;
+
+} // FUNCTION : LB_SeedBufferFlux
+
+
+
+#endif // #if ( defined LOAD_BALANCE  &&  defined BIT_REP_FLUX )
@@ -4,6 +4,19 @@
 
 
 
+// modes of FindBoundary()
+static const int BOUNDARY_NONE     = 0;  // skip this query
+static const int BOUNDARY_CLOSEST  = 1;  // patch-group boundary with an accumulated workload closest to the target
+static const int BOUNDARY_FIRST_GE = 2;  // first patch-group boundary with an accumulated workload >= target
+static const int BOUNDARY_LAST_LE  = 3;  // last  patch-group boundary with an accumulated workload <= target
+
+static void FindBoundary( const int NQuery, const int Mode[], const double Target[], long Cut[], double Acc[],
+                          const int NPG, const long LBIdx0[], const double LoadAcc[], const double Load_Start,
+                          const double Load_Total, const long Cut_Next, const long Cut_Min, const long Cut_Max );
+static int LowerBound( const long Array[], const int N, const long Key );
+
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_SetCutPoint
@@ -17,6 +30,22 @@
 //                   particle information yet ...)
 //                   --> See the description of "InputLBIdx0AndLoad, LBIdx0_AllRank_Input, and
 //                       Load_AllRank_Input" below
+//                4. Option "Incremental" shifts the existing cut points only when necessary
+//                   --> An internal cut point is kept if its accumulated workload differs from the balanced value
+//                       by at most 0.25*WLI_Max*Load_Ave. Otherwise it is moved to the nearest patch group satisfying
+//                       this bound, falling back to the balanced cut point if no such patch group exists.
+//                   --> Bound the workload of each rank to Load_Ave*(1 +- WLI_Max/2) while only moving patches
+//                       between neighboring ranks around the shifted cut points
+//                   --> The input CutPoint[] must store the current cut points on all ranks
+//                5. Cut points are computed without collecting the patch groups of all ranks on one rank
+//                   --> Real patches in rank r already satisfy "CutPoint[r] <= LB_Idx < CutPoint[r+1]", so the
+//                       local sorted lists concatenated in the order of MPI ranks form the global sorted list
+//                   --> Each rank sorts its own list and accumulates its workload, and only the total workload
+//                       and LB_Idx range of each rank are exchanged
+//                   --> Each cut point is then determined by the rank whose accumulated workload range contains
+//                       the target (see FindBoundary())
+//                   --> With "InputLBIdx0AndLoad", the input patch groups are treated as belonging to the ranks
+//                       providing them (e.g., all patch groups belong to rank 0 if only rank 0 provides the lists)
 //
 // Parameter   :  lv                   : Target refinement level
 //                NPG_Total            : Total number of patch groups on level "lv"
@@ -24,24 +53,32 @@
 //                InputLBIdx0AndLoad   : Provide both LBIdx0_AllRank_Input[] and Load_AllRank_Input[] directly
 //                                       so that they don't have to be collected from all ranks again
 //                                       --> Useful during RESTART
-//                LBIdx0_AllRank_Input : LBIdx of all patch groups in all ranks
+//                LBIdx0_AllRank_Input : LBIdx of the patch groups provided by this rank
 //                                       --> Useful only when InputLBIdx0AndLoad == true
 //                                       --> Only need the **minimum** LBIdx in each patch group
-//                                       --> Only rank 0 needs to provide this list
-//                                       --> Can be unsorted
+//                                       --> Either only rank 0 provides the lists of all patch groups, or the lists
+//                                           of all ranks are disjoint and ordered by MPI ranks
+//                                           (i.e., all LBIdx in rank r < all LBIdx in rank r+1)
+//                                       --> Can be unsorted within each rank
+//                                       --> Will be sorted in place
 //                Load_AllRank_Input   : Load-balance weighting of all patch groups in all ranks
 //                                       --> Useful only when InputLBIdx0AndLoad == true
 //                                       --> Please provide the **sum** of all patches within each patch group
-//                                       --> Only rank 0 needs to provide this list
 //                                       --> Must be in the same order as LBIdx0_AllRank_Input
+//                NPG_Input            : Number of patch groups in LBIdx0_AllRank_Input[] and Load_AllRank_Input[]
+//                                       on this rank
+//                                       --> Useful only when InputLBIdx0AndLoad == true
 //                ParWeight            : Relative load-balance weighting of particles
 //                                       --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*ParWeight"
 //                                       --> <= 0.0 : do not consider particle weighting
+//                Incremental          : Shift the input cut points by the minimum amount required to bound the
+//                                       load imbalance instead of recomputing them from scratch
 //
 // Return      :  CutPoint[]
 //-------------------------------------------------------------------------------------------------------
 void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bool InputLBIdx0AndLoad,
-                     long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight )
+                     long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const int NPG_Input,
+                     const double ParWeight, const bool Incremental )
 {
 
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
@@ -49,60 +86,38 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 
 
 // check
-   if ( MPI_Rank == 0  &&  InputLBIdx0AndLoad  &&  ( LBIdx0_AllRank_Input == NULL || Load_AllRank_Input == NULL )  )
+   if ( InputLBIdx0AndLoad  &&  NPG_Input > 0  &&  ( LBIdx0_AllRank_Input == NULL || Load_AllRank_Input == NULL )  )
       Aux_Error( ERROR_INFO, "LBIdx0_AllRank_Input/Load_AllRank_Input == NULL when InputLBIdx0AndLoad is on !!\n" );
 
+   if ( InputLBIdx0AndLoad  &&  NPG_Input < 0 )
+      Aux_Error( ERROR_INFO, "NPG_Input (%d) < 0 !!\n", NPG_Input );
+
    if ( NPG_Total < 0 )
       Aux_Error( ERROR_INFO, "NPG_Total (%d) < 0 !!\n", NPG_Total );
 
 
-// 1. collect the load-balance weighting and LB_Idx of all patch groups from all ranks
-   long   *LBIdx0_AllRank = NULL;
-   double *Load_AllRank   = NULL;
-   int    *IdxTable       = ( MPI_Rank == 0 ) ? new int [NPG_Total] : NULL;
+// 1. get the load-balance weighting and LB_Idx of all patch groups in this rank
+   int     NPG_ThisRank;
+   long   *LBIdx0_ThisRank = NULL;
+   double *Load_ThisRank   = NULL;
 
 // use the input tables directly
 // --> useful during RESTART, where we have very limited information
 //     (e.g., we don't know the number of patches in each rank, amr->NPatchComma, and any particle information yet ...)
    if ( InputLBIdx0AndLoad )
    {
-      if ( MPI_Rank == 0 )
-      {
-         LBIdx0_AllRank = LBIdx0_AllRank_Input;
-         Load_AllRank   = Load_AllRank_Input;
-      }
+      NPG_ThisRank    = NPG_Input;
+      LBIdx0_ThisRank = LBIdx0_AllRank_Input;
+      Load_ThisRank   = Load_AllRank_Input;
    }
 
    else
    {
-//    allocate memory
-      int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
-
-      long   *LBIdx0_ThisRank = new long   [ NPG_ThisRank ];
-      double *Load_ThisRank   = new double [ NPG_ThisRank ];
-      int    *NPG_EachRank    = NULL;
-      int    *Recv_Disp       = NULL;
-
-      if ( MPI_Rank == 0 )
-      {
-         NPG_EachRank   = new int    [ MPI_NRank ];
-         Recv_Disp      = new int    [ MPI_NRank ];
-         LBIdx0_AllRank = new long   [ NPG_Total ];
-         Load_AllRank   = new double [ NPG_Total ];
-      }
-
-
-//    collect the number of patch groups in each rank
-      MPI_Gather( &NPG_ThisRank, 1, MPI_INT, NPG_EachRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
-
-      if ( MPI_Rank == 0 )
-      {
-         Recv_Disp[0] = 0;
-         for (int r=0; r<MPI_NRank-1; r++)   Recv_Disp[r+1] = Recv_Disp[r] + NPG_EachRank[r];
-      }
-
+      NPG_ThisRank    = amr->NPatchComma[lv][1] / 8;
+      LBIdx0_ThisRank = new long   [ NPG_ThisRank ];
+      Load_ThisRank   = new double [ NPG_ThisRank ];
 
-//    collect the minimum LBIdx in each patch group
+//    get the minimum LBIdx in each patch group
 //    --> assuming patches within the same patch group have consecutive LBIdx
       for (int t=0; t<NPG_ThisRank; t++)
       {
@@ -112,181 +127,248 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
          LBIdx0_ThisRank[t] -= LBIdx0_ThisRank[t] % 8;         // get the **minimum** LBIdx in this patch group
       }
 
-      MPI_Gatherv( LBIdx0_ThisRank, NPG_ThisRank, MPI_LONG, LBIdx0_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_LONG, 0, MPI_COMM_WORLD );
+//    get the load-balance weighting in each patch group
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+   } // if ( InputLBIdx0AndLoad ) ... else ...
 
 
-//    collect the load-balance weighting in each patch group
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+// 2. sort LB_Idx and accumulate the workload in this rank
+//    --> after sorting, we must use IdxTable to access the Load_ThisRank[] array
+   int    *IdxTable         = new int    [ NPG_ThisRank   ];
+   double *LoadAcc_ThisRank = new double [ NPG_ThisRank+1 ];   // accumulated workload before each patch group
 
-      MPI_Gatherv( Load_ThisRank, NPG_ThisRank, MPI_DOUBLE, Load_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_DOUBLE, 0, MPI_COMM_WORLD );
+   Mis_RadixSort( NPG_ThisRank, LBIdx0_ThisRank, IdxTable );
 
+   LoadAcc_ThisRank[0] = 0.0;
+   for (int t=0; t<NPG_ThisRank; t++)  LoadAcc_ThisRank[t+1] = LoadAcc_ThisRank[t] + Load_ThisRank[ IdxTable[t] ];
 
-//    free memory
-      delete [] LBIdx0_ThisRank;
-      delete [] Load_ThisRank;
 
-      if ( MPI_Rank == 0 )
-      {
-         delete [] NPG_EachRank;
-         delete [] Recv_Disp;
-      }
-   } // if ( InputLBIdx0AndLoad ) ... else ...
+// 3. collect the total workload and the LB_Idx range of each rank
+   double *Load_EachRank  = new double [ MPI_NRank   ];
+   long   *Range_EachRank = new long   [ MPI_NRank*2 ];
+   long    Range_ThisRank[2];
 
+   Range_ThisRank[0] = ( NPG_ThisRank > 0 ) ? LBIdx0_ThisRank[               0 ] : -1;
+   Range_ThisRank[1] = ( NPG_ThisRank > 0 ) ? LBIdx0_ThisRank[ NPG_ThisRank -1 ] : -1;
 
-   if ( MPI_Rank == 0 )
-   {
-      double *Load_Record = ( OPT__VERBOSE ) ? new double [MPI_NRank] : NULL;
-      double  Load_Ave;
+   MPI_Allgather( &LoadAcc_ThisRank[NPG_ThisRank], 1, MPI_DOUBLE, Load_EachRank,  1, MPI_DOUBLE, MPI_COMM_WORLD );
+   MPI_Allgather( Range_ThisRank,                  2, MPI_LONG,   Range_EachRank, 2, MPI_LONG,   MPI_COMM_WORLD );
 
-//    3. sort LB_Idx
-//    --> after sorting, we must use IdxTable to access the Load_AllRank[] array
-      Mis_Heapsort( NPG_Total, LBIdx0_AllRank, IdxTable );
+// accumulated workload before this rank and the total workload
+   double Load_Start = 0.0, Load_Total = 0.0, Load_Ave;
 
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )    Load_Start = Load_Total;
 
-//    4. set the cut points
-      for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+      Load_Total += Load_EachRank[r];
+   }
 
-//    4-1. take care of the case with no patches at all
-      if ( NPG_Total == 0 )
-      {
-         Load_Ave = 0.0;
+   Load_Ave = Load_Total / (double)MPI_NRank;
 
-         if ( OPT__VERBOSE )
-            for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = 0.0;
-      }
+// min and max cut points and the first LBIdx after this rank
+   long Cut_Min = -1, Cut_Max = -1, Cut_Next = -1;
 
-      else
-      {
-//       4-2. get the average workload for each rank
-         Load_Ave = 0.0;
-         for (int t=0; t<NPG_Total; t++)  Load_Ave += Load_AllRank[t];
-         Load_Ave /= (double)MPI_NRank;
-
-//       4-3. set the min and max cut points
-         const long LBIdx0_Min = LBIdx0_AllRank[             0 ];
-         const long LBIdx0_Max = LBIdx0_AllRank[ NPG_Total - 1 ];
-         CutPoint[        0] = LBIdx0_Min;
-         CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
-
-//       4-4. find the LBIdx with an accumulated workload (LoadAcc) closest to the average workload of each rank (LoadTarget)
-         int    CutIdx     = 1;                 // target array index for CutPoint[]
-                                                // --> note that CutPoint[CutIdx] is the **exclusive** upper bound of rank "CutIdx-1"
-         double LoadAcc    = 0.0;               // accumulated workload
-         double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
-         double LoadThisPG;                     // workload of the target patch group
-
-         for (int PG=0; PG<NPG_Total; PG++)
-         {
-//          nothing to do if all cut points have been set already
-            if ( CutIdx == MPI_NRank )    break;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Range_EachRank[2*r] == -1 )    continue;
 
-//          remember to use IdxTable to access Load_AllRank
-            LoadThisPG = Load_AllRank[ IdxTable[PG] ];
+      if ( Cut_Min == -1 )    Cut_Min = Range_EachRank[2*r];
+      if ( Cut_Next == -1  &&  r > MPI_Rank )   Cut_Next = Range_EachRank[2*r];
 
-//          check if adding a new patch group will exceed the target accumulated workload
-            if ( LoadAcc+LoadThisPG >= LoadTarget )
-            {
-//             determine the cut point with an accumulated workload **closest** to the target accumulated workload
-//             (a) if adding a new patch group will exceed the target accumulated workload too much
-//                 --> exclude this patch group from the rank "CutIdx-1"
-//             note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
-               if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
-               {
-                  CutPoint[CutIdx] = LBIdx0_AllRank[PG];
+      Cut_Max = Range_EachRank[2*r+1] + 8;   // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+   }
 
-                  PG --;   // because this patch group has been **excluded** from this cut point
-               }
+   if ( Cut_Next == -1 )   Cut_Next = Cut_Max;
 
-//             (b) if adding a new patch group will NOT exceed the target accumulated workload too much
-//                 --> include this patch group in the rank "CutIdx-1"
-               else
-               {
-//                be careful about the special case "PG == NPG_Total-1"
-                  CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
+#  ifdef GAMER_DEBUG
+// the local lists must be disjoint and ordered by MPI ranks
+   long LBIdx0_Prev = -1;
 
-                  LoadAcc += LoadThisPG;
-               }
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Range_EachRank[2*r] == -1 )    continue;
 
-//             record the **accumulated** workload of each rank
-               if ( OPT__VERBOSE )  Load_Record[ CutIdx - 1 ] = LoadAcc;
+      if ( Range_EachRank[2*r] <= LBIdx0_Prev )
+         Aux_Error( ERROR_INFO, "lv %d, LBIdx0 range of rank %d (%ld -> %ld) overlaps with the previous ranks (%ld) !!\n",
+                    lv, r, Range_EachRank[2*r], Range_EachRank[2*r+1], LBIdx0_Prev );
 
-               CutIdx ++;
-               LoadTarget = CutIdx*Load_Ave;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget )
+      LBIdx0_Prev = Range_EachRank[2*r+1];
+   }
+#  endif
 
-            else
-            {
-               LoadAcc += LoadThisPG;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
 
-         } // for (int PG=0; PG<NPG_Total; PG++)
+// 4. set the cut points
+   long   *CutPoint_Old = ( Incremental ) ? new long [MPI_NRank+1] : NULL;
+   double *LoadAcc_Cut  = new double [MPI_NRank+1];   // accumulated workload before each cut point
 
-//       4.5 take care of the special case where the last several ranks have no patches at all
-         for (int t=CutIdx; t<MPI_NRank; t++)
-         {
-            CutPoint[t] = CutPoint[MPI_NRank];
+// backup the current cut points for the incremental mode
+   if ( Incremental )
+      for (int t=0; t<MPI_NRank+1; t++)   CutPoint_Old[t] = CutPoint[t];
 
-            if ( OPT__VERBOSE )  Load_Record[ t - 1 ] = Load_Ave*MPI_NRank;
-         }
+   for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
 
-//       4.6 check
-#        ifdef GAMER_DEBUG
-//       all cut points must be set properly
-         for (int t=0; t<MPI_NRank+1; t++)
-            if ( CutPoint[t] == -1 )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] == -1 !!\n", lv, t );
+// 4-1. take care of the case with no patches at all
+   if ( NPG_Total == 0 )
+   {
+      for (int t=0; t<MPI_NRank+1; t++)   LoadAcc_Cut[t] = 0.0;
+   }
 
-//       monotonicity
-         for (int t=0; t<MPI_NRank; t++)
-            if ( CutPoint[t+1] < CutPoint[t] )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
-                          lv, t+1, CutPoint[t+1], t, CutPoint[t] );
-#        endif
-      } // if ( NPG_Total == 0 ) ... else ...
+   else
+   {
+      int    *Mode   = new int    [MPI_NRank+1];
+      double *Target = new double [MPI_NRank+1];
+      long   *Cut    = new long   [MPI_NRank+1];
+      double *Acc    = new double [MPI_NRank+1];
+
+//    4-2. set the min and max cut points
+      CutPoint   [        0] = Cut_Min;
+      CutPoint   [MPI_NRank] = Cut_Max;
+      LoadAcc_Cut[        0] = 0.0;
+      LoadAcc_Cut[MPI_NRank] = Load_Total;
+
+//    4-3. find the patch-group boundary with an accumulated workload closest to the target accumulated workload
+//         "r*Load_Ave" of each internal cut point
+      Mode[0] = Mode[MPI_NRank] = BOUNDARY_NONE;
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         Mode  [r] = BOUNDARY_CLOSEST;
+         Target[r] = r*Load_Ave;
+      }
 
+      FindBoundary( MPI_NRank+1, Mode, Target, Cut, Acc, NPG_ThisRank, LBIdx0_ThisRank, LoadAcc_ThisRank,
+                    Load_Start, Load_Total, Cut_Next, Cut_Min, Cut_Max );
 
-//    5. output the cut points and workload of each MPI rank
-      if ( OPT__VERBOSE )
+      for (int r=1; r<MPI_NRank; r++)
       {
-//       convert the accumulated workload to the actual workload of each rank
-         Load_Record[ MPI_NRank - 1 ] = Load_Ave*MPI_NRank;
-         for (int r=MPI_NRank-1; r>=1; r--)  Load_Record[r] -= Load_Record[r-1];
+         CutPoint   [r] = Cut[r];
+         LoadAcc_Cut[r] = Acc[r];
+      }
 
-         double Load_Max = -1.0;
+//    4-4. incremental mode: replace the balanced cut points set above by the current cut points shifted
+//         toward them only as far as necessary
+      if ( Incremental )
+      {
+         const double Tolerance   = 0.25*amr->LB->WLI_Max*Load_Ave;
+         double      *LoadAcc_Old = new double [MPI_NRank+1];
 
-         for (int r=0; r<MPI_NRank; r++)
+//       accumulated workload before the current cut points
+//       --> sum of the accumulated workload before the cut point in each rank
+         for (int r=0; r<MPI_NRank+1; r++)
+            Acc[r] = LoadAcc_ThisRank[ LowerBound( LBIdx0_ThisRank, NPG_ThisRank, CutPoint_Old[r] ) ];
+
+         MPI_Allreduce( Acc, LoadAcc_Old, MPI_NRank+1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+//       find the nearest patch-group boundary within the tolerance for the cut points to be shifted
+         for (int r=1; r<MPI_NRank; r++)
          {
-            Aux_Message( stdout, "         Lv %2d: Rank %4d, Cut %15ld -> %15ld, Load_Weighted %9.3e\n",
-                         lv, r, CutPoint[r], CutPoint[r+1], Load_Record[r] );
+            if      ( fabs( LoadAcc_Old[r] - r*Load_Ave ) <= Tolerance )
+            {
+               Mode  [r] = BOUNDARY_NONE;
+            }
+            else if ( LoadAcc_Old[r] < r*Load_Ave )
+            {
+               Mode  [r] = BOUNDARY_FIRST_GE;
+               Target[r] = r*Load_Ave - Tolerance;
+            }
+            else
+            {
+               Mode  [r] = BOUNDARY_LAST_LE;
+               Target[r] = r*Load_Ave + Tolerance;
+            }
+         }
 
-            if ( Load_Record[r] > Load_Max )    Load_Max = Load_Record[r];
+         FindBoundary( MPI_NRank+1, Mode, Target, Cut, Acc, NPG_ThisRank, LBIdx0_ThisRank, LoadAcc_ThisRank,
+                       Load_Start, Load_Total, Cut_Next, Cut_Min, Cut_Max );
+
+         for (int r=1; r<MPI_NRank; r++)
+         {
+//          (a) the current cut point is acceptable --> keep it
+            if ( Mode[r] == BOUNDARY_NONE )
+            {
+               CutPoint   [r] = MIN( MAX( CutPoint_Old[r], Cut_Min ), Cut_Max );
+               LoadAcc_Cut[r] = LoadAcc_Old[r];
+            }
+
+//          (b) shift it to the nearest boundary within the tolerance
+//              --> fall back to the balanced cut point if no patch group satisfies the tolerance
+            else if ( fabs( Acc[r] - r*Load_Ave ) <= Tolerance )
+            {
+               CutPoint   [r] = Cut[r];
+               LoadAcc_Cut[r] = Acc[r];
+            }
          }
 
-         Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
-                      Load_Ave, Load_Max, (NPG_Total == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
-         Aux_Message( stdout, "         =============================================================================\n" );
+         delete [] LoadAcc_Old;
+      } // if ( Incremental )
 
-         delete [] Load_Record;
+//    4-5. ensure monotonicity
+//         --> a patch group with a workload larger than the tolerance or Load_Ave can be the closest boundary
+//             of more than one cut point
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         if ( CutPoint[r] < CutPoint[r-1] )
+         {
+            CutPoint   [r] = CutPoint   [r-1];
+            LoadAcc_Cut[r] = LoadAcc_Cut[r-1];
+         }
       }
-   } // if ( MPI_Rank == 0 )
 
+//    4-6. check
+#     ifdef GAMER_DEBUG
+//    all cut points must be set properly
+      for (int t=0; t<MPI_NRank+1; t++)
+         if ( CutPoint[t] == -1 )
+            Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] == -1 !!\n", lv, t );
 
-// 6. broadcast the cut points
-   MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
+//    monotonicity
+      for (int t=0; t<MPI_NRank; t++)
+         if ( CutPoint[t+1] < CutPoint[t] )
+            Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                       lv, t+1, CutPoint[t+1], t, CutPoint[t] );
+#     endif
 
+      delete [] Mode;
+      delete [] Target;
+      delete [] Cut;
+      delete [] Acc;
+   } // if ( NPG_Total == 0 ) ... else ...
 
-// free memory
-   if ( MPI_Rank == 0 )
+
+// 5. output the cut points and workload of each MPI rank
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
    {
-      delete [] IdxTable;
+      double Load_Max = -1.0;
 
-      if ( !InputLBIdx0AndLoad )
+      for (int r=0; r<MPI_NRank; r++)
       {
-         delete [] LBIdx0_AllRank;
-         delete [] Load_AllRank;
+         const double Load_ThisCut = LoadAcc_Cut[r+1] - LoadAcc_Cut[r];
+
+         Aux_Message( stdout, "         Lv %2d: Rank %4d, Cut %15ld -> %15ld, Load_Weighted %9.3e\n",
+                      lv, r, CutPoint[r], CutPoint[r+1], Load_ThisCut );
+
+         if ( Load_ThisCut > Load_Max )   Load_Max = Load_ThisCut;
       }
+
+      Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
+                   Load_Ave, Load_Max, (NPG_Total == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
+      Aux_Message( stdout, "         =============================================================================\n" );
+   }
+
+
+// free memory
+   delete [] IdxTable;
+   delete [] LoadAcc_ThisRank;
+   delete [] Load_EachRank;
+   delete [] Range_EachRank;
+   delete [] CutPoint_Old;
+   delete [] LoadAcc_Cut;
+
+   if ( !InputLBIdx0AndLoad )
+   {
+      delete [] LBIdx0_ThisRank;
+      delete [] Load_ThisRank;
    }
 
 
@@ -297,4 +379,171 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FindBoundary
+// Description :  Find the patch-group boundaries in the global sorted list of patch groups with the target
+//                accumulated workloads
+//
+// Note        :  1. Invoked by LB_SetCutPoint()
+//                2. Must be invoked by all ranks with the same input queries
+//                   --> Each query is resolved by the rank whose accumulated workload range contains the target
+//                       and the results are then shared with all ranks
+//                3. The boundary before the first patch group of this rank is represented by LBIdx0[0], and
+//                   the boundary after its last patch group is represented by "Cut_Next", which is the first
+//                   LBIdx0 of the next non-empty rank (or Cut_Max if there is none)
+//                4. Targets out of the range of the total workload return Cut_Min or Cut_Max
+//
+// Parameter   :  NQuery     : Number of queries
+//                Mode       : Query mode (BOUNDARY_NONE/CLOSEST/FIRST_GE/LAST_LE)
+//                Target     : Target accumulated workload of each query
+//                Cut        : LBIdx of the boundary found for each query
+//                Acc        : Accumulated workload before the boundary found for each query
+//                NPG        : Number of patch groups in this rank
+//                LBIdx0     : Sorted minimum LBIdx of each patch group in this rank
+//                LoadAcc    : Accumulated workload before each patch group in this rank (with NPG+1 elements)
+//                Load_Start : Accumulated workload before this rank
+//                Load_Total : Total workload of all ranks
+//                Cut_Next   : LBIdx representing the boundary after the last patch group of this rank
+//                Cut_Min    : Minimum cut point
+//                Cut_Max    : Maximum cut point
+//
+// Return      :  Cut[], Acc[]
+//-------------------------------------------------------------------------------------------------------
+void FindBoundary( const int NQuery, const int Mode[], const double Target[], long Cut[], double Acc[],
+                   const int NPG, const long LBIdx0[], const double LoadAcc[], const double Load_Start,
+                   const double Load_Total, const long Cut_Next, const long Cut_Min, const long Cut_Max )
+{
+
+   const double Load_End = Load_Start + LoadAcc[NPG];
+
+   long   *Cut_ThisRank = new long   [NQuery];
+   double *Acc_ThisRank = new double [NQuery];
+
+   for (int q=0; q<NQuery; q++)
+   {
+      const double X = Target[q];
+      int Min, Max, Mid, b = -1;    // b: local index of the target boundary (0 ~ NPG)
+
+      Cut_ThisRank[q] = -1;
+      Acc_ThisRank[q] = -1.0;
+
+      switch ( Mode[q] )
+      {
+         case BOUNDARY_NONE:
+            break;
+
+//       closest boundary around the patch group crossing the target
+//       --> owned by the rank with "Load_Start <= X < Load_End"
+         case BOUNDARY_CLOSEST:
+            if ( NPG > 0  &&  X >= Load_Start  &&  X < Load_End )
+            {
+               for (Min=0, Max=NPG-1; Min<Max; )
+               {
+                  Mid = ( Min + Max ) / 2;
+                  if ( Load_Start + LoadAcc[Mid+1] >= X )   Max = Mid;
+                  else                                      Min = Mid + 1;
+               }
+
+               b = ( fabs( Load_Start + LoadAcc[Min] - X ) < Load_Start + LoadAcc[Min+1] - X ) ? Min : Min+1;
+            }
+            break;
+
+//       first boundary with an accumulated workload >= X
+//       --> owned by the rank with "Load_Start < X <= Load_End"
+         case BOUNDARY_FIRST_GE:
+            if ( X <= 0.0 )
+            {
+               Cut_ThisRank[q] = Cut_Min;
+               Acc_ThisRank[q] = 0.0;
+            }
+
+            else if ( NPG > 0  &&  X > Load_Start  &&  X <= Load_End )
+            {
+               for (Min=0, Max=NPG-1; Min<Max; )
+               {
+                  Mid = ( Min + Max ) / 2;
+                  if ( Load_Start + LoadAcc[Mid+1] >= X )   Max = Mid;
+                  else                                      Min = Mid + 1;
+               }
+
+               b = Min + 1;
+            }
+            break;
+
+//       last boundary with an accumulated workload <= X
+//       --> owned by the rank with "Load_Start <= X < Load_End"
+         case BOUNDARY_LAST_LE:
+            if ( X >= Load_Total )
+            {
+               Cut_ThisRank[q] = Cut_Max;
+               Acc_ThisRank[q] = Load_Total;
+            }
+
+            else if ( NPG > 0  &&  X >= Load_Start  &&  X < Load_End )
+            {
+               for (Min=0, Max=NPG-1; Min<Max; )
+               {
+                  Mid = ( Min + Max ) / 2;
+                  if ( Load_Start + LoadAcc[Mid+1] > X )    Max = Mid;
+                  else                                      Min = Mid + 1;
+               }
+
+               b = Min;
+            }
+            break;
+
+         default:
+            Aux_Error( ERROR_INFO, "unsupported mode (%d) !!\n", Mode[q] );
+      } // switch ( Mode[q] )
+
+      if ( b != -1 )
+      {
+         Cut_ThisRank[q] = ( b < NPG ) ? LBIdx0[b] : Cut_Next;
+         Acc_ThisRank[q] = Load_Start + LoadAcc[b];
+      }
+   } // for (int q=0; q<NQuery; q++)
+
+
+// share the results owned by different ranks
+   MPI_Allreduce( Cut_ThisRank, Cut, NQuery, MPI_LONG,   MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( Acc_ThisRank, Acc, NQuery, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+
+   delete [] Cut_ThisRank;
+   delete [] Acc_ThisRank;
+
+} // FUNCTION : FindBoundary
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LowerBound
+// Description :  Return the index of the first element in the sorted array "Array" that is not smaller than "Key"
+//
+// Note        :  1. Return N if all elements are smaller than Key
+//
+// Parameter   :  Array : Sorted look-up array (in ascending numerical order)
+//                N     : Size of Array
+//                Key   : Target value to search for
+//
+// Return      :  0 ~ N
+//-------------------------------------------------------------------------------------------------------
+int LowerBound( const long Array[], const int N, const long Key )
+{
+
+   int Min = 0, Max = N, Mid;
+
+   while ( Min < Max )
+   {
+      Mid = ( Min + Max ) / 2;
+
+      if ( Array[Mid] < Key )    Min = Mid + 1;
+      else                       Max = Mid;
+   }
+
+   return Min;
+
+} // FUNCTION : LowerBound
+
+
+
 #endif // #ifdef LOAD_BALANCE
@@ -0,0 +1,381 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+static void GetLoadBelow( const int NKey, const long Key[], double LoadBelow[], const int NPG, const long PGKey[],
+                          const double LoadAcc[] );
+static int LowerBound( const long Array[], const int N, const long Key );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SetCutPoint_CoupleLevel
+// Description :  Set the load-balance cut points of all levels jointly so that fathers and sons tend to reside
+//                in the same rank
+//
+// Note        :  1. Invoked by LB_Init_LoadBalance() when OPT__LB_COUPLE_LEVEL is on and all levels are
+//                   redistributed
+//                2. Patch groups of all levels are sorted along a single Hilbert ordering by mapping LBIdx0 on
+//                   level "lv" to the finest level, i.e., "Key = LBIdx0*8^(NLEVEL-1-lv)"
+//                   --> The key of a father patch is no larger than the keys of its sons, and a son patch group
+//                       is always adjacent to its father in this ordering
+//                3. Workload of each patch group is estimated by LB_EstimateWorkload_AllPatchGroup() multiplied
+//                   by the weighting of each level "amr->NUpdateLv[lv]"
+//                4. One cut key is found for each rank by a parallel bisection on the key space, where each
+//                   iteration only reduces the accumulated workload below the candidate keys of all ranks
+//                   --> The global list of patch groups is never collected on a single rank
+//                   --> The cut key is the patch-group boundary with the accumulated workload closest to the
+//                       target "r*Load_Ave", as in LB_SetCutPoint()
+//                5. Each cut key is then moved to the boundary of the coarsest patch group whose accumulated
+//                   workload is still within 0.25*WLI_Max*Load_Ave of the target
+//                   --> Such a cut does not separate any father and son on that level and all finer levels
+//                6. The cut key is then converted to CutPoint[lv][] on each level without any approximation
+//                   --> A patch group is assigned to the rank whose key range contains its key
+//                   --> Father and son patches are thus separated only around the cut keys
+//                7. Only the total workload of all levels is balanced, and each individual level may be
+//                   imbalanced
+//                   --> LB_EstimateLoadImbalance() estimates the imbalance of the total workload accordingly
+//
+// Parameter   :  ParWeight : Relative load-balance weighting of particles
+//                            --> <= 0.0 : do not consider particle weighting
+//
+// Return      :  amr->LB->CutPoint[][]
+//-------------------------------------------------------------------------------------------------------
+void LB_SetCutPoint_CoupleLevel( const double ParWeight )
+{
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      %s ...\n", __FUNCTION__ );
+
+
+// 1. get the keys and workload of all patch groups on all levels in this rank
+   int NPG_ThisRank = 0;
+
+   for (int lv=0; lv<NLEVEL; lv++)  NPG_ThisRank += amr->NPatchComma[lv][1] / 8;
+
+   long   *Key_ThisRank     = new long   [ NPG_ThisRank   ];
+   double *Load_ThisRank    = new double [ NPG_ThisRank   ];
+   double *LoadAcc_ThisRank = new double [ NPG_ThisRank+1 ];   // accumulated workload before each sorted patch group
+   int    *IdxTable         = new int    [ NPG_ThisRank   ];
+   long    LBIdx0_Range[2][NLEVEL];                              // min and max LBIdx0 on each level in this rank
+   int     Counter = 0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NPG_Lv = amr->NPatchComma[lv][1] / 8;
+      const int Shift  = 3*( NLEVEL - 1 - lv );
+
+      LBIdx0_Range[0][lv] = __LONG_MAX__;
+      LBIdx0_Range[1][lv] = -1;
+
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank+Counter );
+
+      for (int t=0; t<NPG_Lv; t++)
+      {
+         long LBIdx0 = amr->patch[0][lv][t*8]->LB_Idx;
+         LBIdx0 -= LBIdx0 % 8;
+
+         LBIdx0_Range[0][lv] = MIN( LBIdx0_Range[0][lv], LBIdx0 );
+         LBIdx0_Range[1][lv] = MAX( LBIdx0_Range[1][lv], LBIdx0 );
+
+         Key_ThisRank [Counter] = LBIdx0 << Shift;
+         Load_ThisRank[Counter] *= (double)amr->NUpdateLv[lv];
+
+         Counter ++;
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   Mis_RadixSort( NPG_ThisRank, Key_ThisRank, IdxTable );
+
+   LoadAcc_ThisRank[0] = 0.0;
+   for (int t=0; t<NPG_ThisRank; t++)  LoadAcc_ThisRank[t+1] = LoadAcc_ThisRank[t] + Load_ThisRank[ IdxTable[t] ];
+
+
+// 2. get the total workload, the key range, and the LBIdx0 range on each level of all ranks
+   long   Key_Range[2], LBIdx0_Min[NLEVEL], LBIdx0_Max[NLEVEL];
+   double Load_Total, Load_Ave;
+
+   Key_Range[0] = ( NPG_ThisRank > 0 ) ? -Key_ThisRank[0]                  : -__LONG_MAX__;
+   Key_Range[1] = ( NPG_ThisRank > 0 ) ?  Key_ThisRank[NPG_ThisRank-1] + 1 : -1;
+
+   MPI_Allreduce( &LoadAcc_ThisRank[NPG_ThisRank], &Load_Total, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+   MPI_Allreduce( MPI_IN_PLACE, Key_Range,       2,      MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( LBIdx0_Range[0], LBIdx0_Min, NLEVEL, MPI_LONG, MPI_MIN, MPI_COMM_WORLD );
+   MPI_Allreduce( LBIdx0_Range[1], LBIdx0_Max, NLEVEL, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   Key_Range[0] = -Key_Range[0];
+   Load_Ave     = Load_Total / (double)MPI_NRank;
+
+
+// 3. parallel bisection for the minimum key "Key_Hi[r]" with an accumulated workload below it >= r*Load_Ave
+//    --> invariant: LoadBelow(Key_Lo) < target <= LoadBelow(Key_Hi)
+   const int NCut = MPI_NRank - 1;
+
+   long   *Key_Lo    = new long   [ NCut+1 ];  // +1 to avoid allocating zero-size arrays for MPI_NRank == 1
+   long   *Key_Hi    = new long   [ NCut+1 ];
+   long   *Key_Mid   = new long   [ NCut+1 ];
+   double *Load_Mid  = new double [ NCut+1 ];
+   double *Load_Buf  = new double [ NCut+1 ];
+   double *Load_Hi   = new double [ NCut+1 ];
+   double *Load_Lo   = new double [ NCut+1 ];
+   long   *Key_Cut   = new long   [ NCut+1 ];
+   double *Load_Cut  = new double [ NCut+1 ];
+   bool    Converged = false;
+
+   for (int c=0; c<NCut; c++)
+   {
+      Key_Lo[c] = Key_Range[0];
+      Key_Hi[c] = Key_Range[1];
+   }
+
+   if ( Load_Total > 0.0 )
+   while ( !Converged )
+   {
+      Converged = true;
+
+      for (int c=0; c<NCut; c++)
+      {
+         Key_Mid[c] = Key_Lo[c] + ( Key_Hi[c] - Key_Lo[c] )/2;
+
+         if ( Key_Hi[c] - Key_Lo[c] > 1 )    Converged = false;
+      }
+
+      if ( Converged )  break;
+
+      GetLoadBelow( NCut, Key_Mid, Load_Buf, NPG_ThisRank, Key_ThisRank, LoadAcc_ThisRank );
+      MPI_Allreduce( Load_Buf, Load_Mid, NCut, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      for (int c=0; c<NCut; c++)
+      {
+         if ( Key_Hi[c] - Key_Lo[c] <= 1 )   continue;
+
+         if ( Load_Mid[c] >= (c+1)*Load_Ave )   Key_Hi[c] = Key_Mid[c];
+         else                                   Key_Lo[c] = Key_Mid[c];
+      }
+   } // while ( !Converged )
+
+
+// 4. choose the closer one of the two patch-group boundaries around the target
+//    --> Key_Lo is the key of the patch group crossing the target, i.e., the boundary before it
+   GetLoadBelow( NCut, Key_Lo, Load_Buf, NPG_ThisRank, Key_ThisRank, LoadAcc_ThisRank );
+   MPI_Allreduce( Load_Buf, Load_Lo, NCut, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   GetLoadBelow( NCut, Key_Hi, Load_Buf, NPG_ThisRank, Key_ThisRank, LoadAcc_ThisRank );
+   MPI_Allreduce( Load_Buf, Load_Hi, NCut, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   for (int c=0; c<NCut; c++)
+   {
+      const double LoadTarget = (c+1)*Load_Ave;
+
+      if ( Load_Total > 0.0  &&  fabs( Load_Lo[c] - LoadTarget ) < Load_Hi[c] - LoadTarget )
+      {
+         Key_Cut [c] = Key_Lo [c];
+         Load_Cut[c] = Load_Lo[c];
+      }
+
+      else
+      {
+         Key_Cut [c] = Key_Hi [c];
+         Load_Cut[c] = Load_Hi[c];
+      }
+   }
+
+
+// 5. move each cut key to the boundary of the coarsest possible patch group within the tolerance
+//    --> a cut key aligned with the patch-group boundaries on level "lv" does not separate any father
+//        and son on levels >= lv
+//    --> candidates on each level are the patch-group boundaries just below and above the cut key
+   const double Tolerance = 0.25*amr->LB->WLI_Max*Load_Ave;
+   const int    NCand     = 2*NLEVEL*NCut;
+
+   long   *Key_Cand  = new long   [ NCand+1 ];
+   double *Load_Cand = new double [ NCand+1 ];
+   double *Buf_Cand  = new double [ NCand+1 ];
+
+   for (int c=0; c<NCut; c++)
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const long Unit = 8L << 3*( NLEVEL - 1 - lv );
+      const int  Idx  = 2*( c*NLEVEL + lv );
+
+      Key_Cand[Idx  ] = Key_Cut[c] / Unit * Unit;
+      Key_Cand[Idx+1] = ( Key_Cand[Idx] == Key_Cut[c] ) ? Key_Cut[c] : Key_Cand[Idx] + Unit;
+   }
+
+   GetLoadBelow( NCand, Key_Cand, Buf_Cand, NPG_ThisRank, Key_ThisRank, LoadAcc_ThisRank );
+   MPI_Allreduce( Buf_Cand, Load_Cand, NCand, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   for (int c=0; c<NCut; c++)
+   {
+      const double LoadTarget = (c+1)*Load_Ave;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const int Idx  = 2*( c*NLEVEL + lv );
+         const int Best = ( fabs( Load_Cand[Idx] - LoadTarget ) <= fabs( Load_Cand[Idx+1] - LoadTarget ) ) ? Idx : Idx+1;
+
+         if ( fabs( Load_Cand[Best] - LoadTarget ) <= Tolerance )
+         {
+            Key_Cut [c] = Key_Cand [Best];
+            Load_Cut[c] = Load_Cand[Best];
+            break;
+         }
+      }
+
+//    ensure monotonicity
+      if ( c > 0  &&  Key_Cut[c] < Key_Cut[c-1] )
+      {
+         Key_Cut [c] = Key_Cut [c-1];
+         Load_Cut[c] = Load_Cut[c-1];
+      }
+   }
+
+   delete [] Key_Cand;
+   delete [] Load_Cand;
+   delete [] Buf_Cand;
+
+
+// 6. convert the cut keys to the cut points on each level
+//    --> a patch group on level "lv" with "LBIdx0 << Shift < Key_Cut" has "LBIdx0 < ceil( Key_Cut/2^Shift )"
+//    --> round up to a multiple of 8 so that all patches in a patch group are assigned to the same rank
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      long *CutPoint = amr->LB->CutPoint[lv];
+
+      const int  Shift = 3*( NLEVEL - 1 - lv );
+      const long Unit  = 1L << Shift;
+
+//    no patches at all on this level
+      if ( LBIdx0_Max[lv] == -1 )
+      {
+         for (int r=0; r<MPI_NRank+1; r++)   CutPoint[r] = -1;
+         continue;
+      }
+
+      CutPoint[        0] = LBIdx0_Min[lv];
+      CutPoint[MPI_NRank] = LBIdx0_Max[lv] + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         long Cut = ( Key_Cut[r-1] + Unit - 1 ) / Unit;
+
+         Cut = ( Cut + 7 ) / 8 * 8;
+
+         CutPoint[r] = MIN( MAX( Cut, CutPoint[0] ), CutPoint[MPI_NRank] );
+      }
+
+#     ifdef GAMER_DEBUG
+      for (int r=0; r<MPI_NRank; r++)
+         if ( CutPoint[r+1] < CutPoint[r] )
+            Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                       lv, r+1, CutPoint[r+1], r, CutPoint[r] );
+#     endif
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 7. output the cut keys and workload of each MPI rank
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+   {
+      double Load_Max = -1.0;
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         const double Load_Start = ( r == 0           ) ? 0.0        : Load_Cut[r-1];
+         const double Load_End   = ( r == MPI_NRank-1 ) ? Load_Total : Load_Cut[r  ];
+         const long   Key_Start  = ( r == 0           ) ? Key_Range[0] : Key_Cut[r-1];
+         const long   Key_End    = ( r == MPI_NRank-1 ) ? Key_Range[1] : Key_Cut[r  ];
+
+         Aux_Message( stdout, "         All Lv: Rank %4d, Key %20ld -> %20ld, Load_Weighted %9.3e\n",
+                      r, Key_Start, Key_End, Load_End-Load_Start );
+
+         Load_Max = MAX( Load_Max, Load_End-Load_Start );
+      }
+
+      Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
+                   Load_Ave, Load_Max, (Load_Total == 0.0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
+      Aux_Message( stdout, "         =============================================================================\n" );
+   }
+
+
+// free memory
+   delete [] Key_ThisRank;
+   delete [] Load_ThisRank;
+   delete [] LoadAcc_ThisRank;
+   delete [] IdxTable;
+   delete [] Key_Lo;
+   delete [] Key_Hi;
+   delete [] Key_Mid;
+   delete [] Load_Mid;
+   delete [] Load_Buf;
+   delete [] Load_Hi;
+   delete [] Load_Lo;
+   delete [] Key_Cut;
+   delete [] Load_Cut;
+
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      %s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : LB_SetCutPoint_CoupleLevel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLoadBelow
+// Description :  Get the accumulated workload of all patch groups in this rank with keys smaller than the
+//                input keys
+//
+// Parameter   :  NKey      : Number of input keys
+//                Key       : Input keys
+//                LoadBelow : Accumulated workload below each input key
+//                NPG       : Number of patch groups in this rank
+//                PGKey     : Sorted keys of all patch groups in this rank
+//                LoadAcc   : Accumulated workload before each sorted patch group (with NPG+1 elements)
+//
+// Return      :  LoadBelow[]
+//-------------------------------------------------------------------------------------------------------
+void GetLoadBelow( const int NKey, const long Key[], double LoadBelow[], const int NPG, const long PGKey[],
+                   const double LoadAcc[] )
+{
+
+   for (int k=0; k<NKey; k++)    LoadBelow[k] = LoadAcc[ LowerBound( PGKey, NPG, Key[k] ) ];
+
+} // FUNCTION : GetLoadBelow
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LowerBound
+// Description :  Return the index of the first element in the sorted array "Array" that is not smaller than "Key"
+//
+// Note        :  1. Return N if all elements are smaller than Key
+//
+// Parameter   :  Array : Sorted look-up array (in ascending numerical order)
+//                N     : Size of Array
+//                Key   : Target value to search for
+//
+// Return      :  0 ~ N
+//-------------------------------------------------------------------------------------------------------
+int LowerBound( const long Array[], const int N, const long Key )
+{
+
+   int Min = 0, Max = N, Mid;
+
+   while ( Min < Max )
+   {
+      Mid = ( Min + Max ) / 2;
+
+      if ( Array[Mid] < Key )    Min = Mid + 1;
+      else                       Max = Mid;
+   }
+
+   return Min;
+
+} // FUNCTION : LowerBound
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -0,0 +1,228 @@
+#include "GAMER.h"
+
+
+/*=======================================================================================
+// These functions are defined even when LOAD_BALANCE is off since we want to invoke
+// "LB_Corner2Index" to store LB_Idx for all patches in any case
+=======================================================================================*/
+
+ulong LB_Hilbert_c2i( ulong const coord[], const uint nBits );
+
+static const int HILBERT_NSTATE = 12;                 // number of states in the Hilbert state machine
+
+static ulong SFC_Spread3[256];                        // spread the 8 bits of a byte to every third bit
+static short Hilbert_Table1[HILBERT_NSTATE][ 8];      // Hilbert state machine processing one octant per lookup
+static short Hilbert_Table2[HILBERT_NSTATE][64];      // Hilbert state machine processing two octants per lookup
+static bool  SFC_Initialized = false;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SFC_Init
+// Description :  Construct the lookup tables of the space-filling curves
+//
+// Note        :  1. Must be called before invoking LB_Morton_c2i() and LB_Hilbert_c2i_Table()
+//                   --> Invoked by Init_GAMER() before constructing any patch
+//                2. Hilbert state machine is derived from the Butz algorithm in LB_HilbertCurve.cpp so that
+//                   LB_Hilbert_c2i_Table() returns exactly the same indices as LB_Hilbert_c2i()
+//                   --> Each state is a pair of (rotation, flip bit) of the current sub-cube, where
+//                       rotation = [0 ... 2] and flip bit = [0, 1, 2, 4]
+//                   --> Each table entry stores the output digit(s) in the lower bits and the next state
+//                       in the upper bits
+//-------------------------------------------------------------------------------------------------------
+void LB_SFC_Init()
+{
+
+   if ( SFC_Initialized )  return;
+
+
+// 1. Morton: spread bit b of a byte to bit 3*b
+   for (int v=0; v<256; v++)
+   {
+      SFC_Spread3[v] = 0;
+      for (int b=0; b<8; b++)    SFC_Spread3[v] |= (ulong)( (v>>b) & 1 ) << (3*b);
+   }
+
+
+// 2. Hilbert: one octant per lookup
+   const int FlipBit[4] = { 0, 1, 2, 4 };
+
+   for (int s=0; s<HILBERT_NSTATE; s++)
+   for (int Oct=0; Oct<8; Oct++)
+   {
+      const int Rot  = s / 4;
+      const int Flip = FlipBit[ s%4 ];
+
+//    rotate the flipped octant to the right by Rot bits
+      const int In    = Flip ^ Oct;
+      const int Digit = ( (In>>Rot) | (In<<(3-Rot)) ) & 7;
+
+//    next rotation = ( Rot + 1 + position of the lowest set bit among the two lowest bits of Digit ) % 3
+      int NextRot = Rot + 1;
+      if      ( Digit & 1 )   NextRot += 1;
+      else if ( Digit & 2 )   NextRot += 2;
+      NextRot %= 3;
+
+//    next flip bit = 1 << Rot
+      const int NextState = NextRot*4 + Rot + 1;
+
+      Hilbert_Table1[s][Oct] = (short)( Digit | (NextState<<3) );
+   }
+
+
+// 3. Hilbert: two octants per lookup
+   for (int s=0; s<HILBERT_NSTATE; s++)
+   for (int Oct2=0; Oct2<64; Oct2++)
+   {
+      const int Entry_Hi = Hilbert_Table1[s                ][ Oct2 >> 3 ];
+      const int Entry_Lo = Hilbert_Table1[ Entry_Hi >> 3   ][ Oct2 &  7 ];
+
+      Hilbert_Table2[s][Oct2] = (short)(  ( (Entry_Hi&7)<<3 ) | ( Entry_Lo&7 ) | ( (Entry_Lo>>3)<<6 )  );
+   }
+
+   SFC_Initialized = true;
+
+} // FUNCTION : LB_SFC_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Morton_c2i
+// Description :  Convert the 3D coordinates to the Morton (Z-order) index
+//
+// Note        :  1. Bit "3*b+d" of the output index = bit "b" of coord[d]
+//                   --> Same bit order as the interleaved coordinates in the Hilbert encoder
+//                2. Interleave one byte of each coordinate per lookup
+//                3. Satisfy "FaIdx*8 == SonIdx - SonIdx%8" as the Hilbert curve
+//
+// Parameter   :  coord : Array of 3 coordinates, each with nBits bits
+//                nBits : Number of bits per coordinate (must be <= 21)
+//
+// Return      :  Morton index
+//-------------------------------------------------------------------------------------------------------
+ulong LB_Morton_c2i( ulong const coord[], const uint nBits )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( !SFC_Initialized )    Aux_Error( ERROR_INFO, "LB_SFC_Init() has not been called !!\n" );
+
+   if ( 3*nBits > 8*sizeof(ulong) )
+      Aux_Error( ERROR_INFO, "3 * nBits (%u) must not exceed %ld\n", nBits, 8*sizeof(ulong) );
+
+   for (int d=0; d<3; d++)
+      if ( coord[d] >= (1UL<<nBits) )
+         Aux_Error( ERROR_INFO, "coord[%d] = %lu >= 2^%u = %lu !!\n", d, coord[d], nBits, (1UL<<nBits) );
+#  endif
+
+   ulong index = 0;
+
+   for (uint b=0; b<nBits; b+=8)
+      index |= (  SFC_Spread3[ (coord[0]>>b) & 255 ]       |
+                  SFC_Spread3[ (coord[1]>>b) & 255 ] << 1  |
+                  SFC_Spread3[ (coord[2]>>b) & 255 ] << 2  ) << (3*b);
+
+   return index;
+
+} // FUNCTION : LB_Morton_c2i
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Morton_i2c
+// Description :  Convert the Morton (Z-order) index to the 3D coordinates
+//
+// Note        :  1. Inverse of LB_Morton_c2i()
+//
+// Parameter   :  index : Morton index
+//                coord : Array of 3 coordinates to be returned
+//                nBits : Number of bits per coordinate
+//-------------------------------------------------------------------------------------------------------
+void LB_Morton_i2c( const ulong index, ulong coord[], const uint nBits )
+{
+
+   for (int d=0; d<3; d++)
+   {
+      coord[d] = 0;
+      for (uint b=0; b<nBits; b++)  coord[d] |= ( (index >> (3*b+d)) & 1UL ) << b;
+   }
+
+} // FUNCTION : LB_Morton_i2c
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Hilbert_c2i_Table
+// Description :  Table-driven version of LB_Hilbert_c2i()
+//
+// Note        :  1. Return exactly the same index as LB_Hilbert_c2i()
+//                   --> Verified against LB_Hilbert_c2i() in the debug mode
+//                2. Procedure:
+//                   (1) interleave the coordinates with LB_Morton_c2i()
+//                   (2) XOR each octant with its next higher octant
+//                   (3) map two octants (6 bits) per lookup with the Hilbert state machine in Hilbert_Table2[]
+//                       starting from the most significant octant
+//                       --> the first octant is mapped alone with Hilbert_Table1[] when nBits is odd
+//                   (4) flip bit 2 of all but the most significant octants and apply the Gray decoding
+//                3. Replace the bit-by-bit loop in LB_Hilbert_c2i(), which also uses a division and a bit
+//                   transpose of all coordinates
+//
+// Parameter   :  coord : Array of 3 coordinates, each with nBits bits
+//                nBits : Number of bits per coordinate (must be <= 21)
+//
+// Return      :  Hilbert index
+//-------------------------------------------------------------------------------------------------------
+ulong LB_Hilbert_c2i_Table( ulong const coord[], const uint nBits )
+{
+
+   if ( nBits == 0 )    return 0;
+
+
+// 1. interleave the coordinates and XOR each octant with its next higher octant
+   ulong Oct = LB_Morton_c2i( coord, nBits );
+   Oct ^= Oct >> 3;
+
+
+// 2. apply the state machine from the most significant octant
+   ulong index = 0;
+   int   State = 0;
+   int   Shift = 3*nBits;
+
+   if ( nBits & 1 )
+   {
+      Shift -= 3;
+
+      const int Entry = Hilbert_Table1[State][ (Oct>>Shift) & 7 ];
+      index = Entry & 7;
+      State = Entry >> 3;
+   }
+
+   while ( Shift > 0 )
+   {
+      Shift -= 6;
+
+      const int Entry = Hilbert_Table2[State][ (Oct>>Shift) & 63 ];
+      index = ( index << 6 ) | ( Entry & 63 );
+      State = Entry >> 6;
+   }
+
+
+// 3. flip bit 2 of all but the most significant octants and apply the Gray decoding
+   const ulong OctBit0 = 0x1249249249249249UL & ( (1UL<<(3*nBits)) - 1UL );   // bit 0 of all octants
+
+   index ^= OctBit0 >> 1;
+
+   for (uint d=1; d<3*nBits; d*=2)   index ^= index >> d;
+
+
+#  ifdef GAMER_DEBUG
+   const ulong index_ref = LB_Hilbert_c2i( coord, nBits );
+
+   if ( index != index_ref )
+      Aux_Error( ERROR_INFO, "table-driven Hilbert index (%lu) != reference (%lu) for coord (%lu, %lu, %lu), nBits %u !!\n",
+                 index, index_ref, coord[0], coord[1], coord[2], nBits );
+#  endif
+
+   return index;
+
+} // FUNCTION : LB_Hilbert_c2i_Table
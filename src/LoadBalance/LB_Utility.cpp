@@ -2,7 +2,9 @@
 
 
 void  LB_Hilbert_i2c( ulong index, ulong coord[], const uint NBits );
-ulong LB_Hilbert_c2i( ulong const coord[], const uint NBits );
+ulong LB_Hilbert_c2i_Table( ulong const coord[], const uint NBits );
+void  LB_Morton_i2c( const ulong index, ulong coord[], const uint NBits );
+ulong LB_Morton_c2i( ulong const coord[], const uint NBits );
 
 
 
@@ -22,6 +24,10 @@ ulong LB_Hilbert_c2i( ulong const coord[], const uint NBits );
 //                5. Experiments show that "LB_Hilbert_c2i( Coord, NBits1 )" and ""LB_Hilbert_c2i( Coord, NBits2 )"
 //                   return the same value if NBits1%3 = NBits2%3
 //                   --> LB_Hilbert_c2i( Coord, NBits1 ) = LB_Hilbert_c2i( Coord, NBits1+3 ) = LB_Hilbert_c2i( Coord, NBits1+6 ) ...
+//                6. Use the table-driven encoder LB_Hilbert_c2i_Table(), which returns the same indices as
+//                   LB_Hilbert_c2i()
+//                7. Use the Morton curve instead when OPT__LB_CURVE == LB_CURVE_MORTON
+//                   --> Also satisfy the property in Note 3
 //
 // Parameter   :  Check : Check whether the input corner lies in the simulation box
 //                        --> effective only in the DEBUG mode
@@ -60,7 +66,12 @@ long LB_Corner2Index( const int lv, const int Corner[], const Check_t Check )
       Coord      [d] = Cr_Periodic[d] / PatchScale;
    }
 
-   return LB_Hilbert_c2i( Coord, amr->ResPower2[lv]-PatchPower2 );
+#  ifdef LOAD_BALANCE
+   if ( OPT__LB_CURVE == LB_CURVE_MORTON )
+   return LB_Morton_c2i( Coord, amr->ResPower2[lv]-PatchPower2 );
+#  endif
+
+   return LB_Hilbert_c2i_Table( Coord, amr->ResPower2[lv]-PatchPower2 );
 
 } // FUNCTION : LB_Corner2Index
 
@@ -77,6 +88,7 @@ long LB_Corner2Index( const int lv, const int Corner[], const Check_t Check )
 //                   "FaLBIdx*8 == SonLBIdx - SonLBIdx%8"
 //                   --> Hilbert curve in different levels have the similar indexing order in space
 //                   --> Son patches are more likely to be put in the same MPI rank as their father patches
+//                3. Use the Morton curve instead when OPT__LB_CURVE == LB_CURVE_MORTON
 //
 // Parameter   :  Check : Check whether the output corner lies in the simulation box
 //                        --> effective only in the DEBUG mode
@@ -92,6 +104,9 @@ void LB_Index2Corner( const int lv, const long LB_Idx, int Corner[], const Check
    if ( 1<<PatchPower2 != PS1 )  Aux_Error( ERROR_INFO, "2^%d != %d !!\n", PatchPower2, PS1 );
 #  endif
 
+   if ( OPT__LB_CURVE == LB_CURVE_MORTON )
+   LB_Morton_i2c ( LB_Idx, Coord, amr->ResPower2[lv]-PatchPower2 );
+   else
    LB_Hilbert_i2c( LB_Idx, Coord, amr->ResPower2[lv]-PatchPower2 );
 
    for (int d=0; d<3; d++)    Corner[d] = Coord[d]*PatchScale;
@@ -114,7 +129,9 @@ void LB_Index2Corner( const int lv, const long LB_Idx, int Corner[], const Check
 // Function    :  LB_Index2Rank
 // Description :  Return the MPI rank which the input LB_Idx belongs to
 //
-// Note        :  "LB_CutPoint[lv]" must be prepared in advance
+// Note        :  1. "LB_CutPoint[lv]" must be prepared in advance
+//                2. Use a binary search since CutPoint[lv][] is in ascending numerical order
+//                   --> Ranks without any patch (i.e., CutPoint[lv][r] == CutPoint[lv][r+1]) are never returned
 //
 // Parameter   :  lv     : Refinement level of the input LB_Idx
 //                LB_Idx : Space-filling-curve index for load balance
@@ -128,9 +145,23 @@ void LB_Index2Corner( const int lv, const long LB_Idx, int Corner[], const Check
 int LB_Index2Rank( const int lv, const long LB_Idx, const Check_t Check )
 {
 
-//###OPTIMIZATION: better search algorithm
-   for (int r=0; r<MPI_NRank; r++)
-      if ( LB_Idx >= amr->LB->CutPoint[lv][r]  &&  LB_Idx < amr->LB->CutPoint[lv][r+1] )  return r;
+   const long *CutPoint = amr->LB->CutPoint[lv];
+
+   if ( LB_Idx >= CutPoint[0]  &&  LB_Idx < CutPoint[MPI_NRank] )
+   {
+//    find the last rank with CutPoint <= LB_Idx
+      int Min = 0, Max = MPI_NRank - 1;
+
+      while ( Min < Max )
+      {
+         const int Mid = ( Min + Max + 1 ) / 2;
+
+         if ( CutPoint[Mid] <= LB_Idx )   Min = Mid;
+         else                             Max = Mid - 1;
+      }
+
+      return Min;
+   }
 
    if ( Check == CHECK_ON )
       Aux_Error( ERROR_INFO, "no target rank was found for lv %d, LB_Idx %ld !!\n",
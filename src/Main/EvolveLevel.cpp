@@ -18,6 +18,9 @@ extern Timer_t *Timer_Par_2Son   [NLEVEL];
 
 bool AutoReduceDt_Continue;
 
+// whether the fluid at each level is frozen for PAR_FREEZE_FLU_RATIO (see Flu_CheckFreeze())
+static bool FluFrozen[NLEVEL];
+
 
 
 
@@ -26,6 +29,12 @@ bool AutoReduceDt_Continue;
 // Description :  Advance all physical attributes at the target level
 //
 // Note        :  1. Invoked by Main()
+//                2. For PAR_FREEZE_FLU_RATIO, the fluid solver, the gravity solver on the fluid, Grackle, and the
+//                   flux fix-up are skipped at levels where the gas mass is negligible compared to the particle mass
+//                   --> Only the Poisson solver and the particle update are performed
+//                   --> Decided once per parent-level step so that the coarse-fine fluxes accumulated for lv-1
+//                       are consistent among all sub-steps
+//                   --> All finer levels are frozen as well once a level is frozen
 //
 // Parameter   :  lv         : Target refinement level
 //                dTime_FaLv : Physical time interval at the parent level
@@ -36,6 +45,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 #  ifdef TIMING
    MPI_Barrier( MPI_COMM_WORLD );
    Timer_Lv[lv]->Start();
+
+// record the whole evolution at this level as a single event for OPT__TRACE
+   const long Trace_T0 = ( OPT__TRACE ) ? ThreadTimer_t::GetNanoSec() : 0L;
 #  endif
 
 
@@ -53,6 +65,18 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    double dTime_SoFar, dTime_SubStep, dt_SubStep, TimeOld, TimeNew, AutoReduceDtCoeff;
 
 
+// check whether the fluid at this level should be frozen
+// --> all ranks share the same FluFrozen[lv-1] and thus invoke Flu_CheckFreeze() consistently
+#  ifdef PARTICLE
+   FluFrozen[lv] = (  ( lv > 0  &&  FluFrozen[lv-1] )  ||  Flu_CheckFreeze( lv )  );
+
+   if ( FluFrozen[lv]  &&  OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "   Lv %2d: fluid is frozen for PAR_FREEZE_FLU_RATIO\n", lv );
+#  else
+   FluFrozen[lv] = false;
+#  endif
+
+
 // reset the workload weighting at each level to be recorded later
    if ( lv == 0 ) {
       for (int TLv=0; TLv<NLEVEL; TLv++)  amr->NUpdateLv[TLv] = 0; }
@@ -152,51 +176,41 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       const int SaveSg_Mag = NULL_INT;
 #     endif
 
+//    allocate the sandglass storing the updated data for OPT__SG_ON_DEMAND
+      Flu_AllocateOldSg( lv );
+
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Flu_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
-      if ( false ) {}
-      /*
-      if ( OPT__OVERLAP_MPI )
+//    frozen fluid: just copy the data to the new sandglass
+      if ( FluFrozen[lv] )
       {
-//       enable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( true );
-#        endif
+         TIMING_FUNC(   Flu_FreezeLevel( lv, SaveSg_Flu, SaveSg_Mag ),
+                        Timer_Flu_Advance[lv],   TIMER_ON   );
+      }
 
+#     ifdef LOAD_BALANCE
+      else if ( OPT__OVERLAP_MPI )
+      {
 //       advance patches needed to be sent
          TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, true ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
-#        pragma omp parallel sections num_threads(2)
-         {
-#           pragma omp section
-            {
-//             transfer data simultaneously
-#              ifdef GRAVITY
-               if ( SelfGravity )
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT,   NULL_INT, DATA_GENERAL, _DENS,  _NONE, Rho_ParaBuf, USELB_YES ),
-                              Timer_GetBuf[lv][0],   TIMER_ON   );
-#              else
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
-                              Timer_GetBuf[lv][2],   TIMER_ON   );
-#              endif
-            }
+//       start transferring their data to other ranks
+         TIMING_FUNC(   LB_GetBufferData_Start ( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf ),
+                        Timer_GetBuf[lv][2],   TIMER_ON   );
 
-#           pragma omp section
-            {
-//             advance patches not needed to be sent
-               TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
-                              Timer_Flu_Advance[lv],   TIMER_ON   );
-            }
-         } // OpenMP parallel sections
+//       advance patches not needed to be sent during the transfer
+         TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
+                        Timer_Flu_Advance[lv],   TIMER_ON   );
 
-//       disable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( false );
-#        endif
+//       complete the transfer
+//       --> replace the exchange of the updated fluid field at the end of this sub-step since Aux_Check_Parameter()
+//           ensures that no other operation modifies the fluid data in between
+         TIMING_FUNC(   LB_GetBufferData_Finish( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf ),
+                        Timer_GetBuf[lv][2],   TIMER_ON   );
       } // if ( OPT__OVERLAP_MPI )
-      */
+#     endif
 
       else
       {
@@ -305,54 +319,29 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          Aux_Message( stdout, "   Lv %2d: Gra_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
       if ( lv == 0 )
-         Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot, SelfGravity, true, false, false, true );
+         Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot, SelfGravity, !FluFrozen[lv], false, false, true );
 
       else // lv > 0
       {
-         if ( false ) {}
-         /*
-         if ( OPT__OVERLAP_MPI )
+#        ifdef LOAD_BALANCE
+         if ( OPT__OVERLAP_MPI  &&  SelfGravity )
          {
-//          enable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( true );
-#           endif
+//          exchange the updated density field in the buffer patches for the Poisson solver
+//          --> already done in step 2 unless Flu_ParaBuf < Rho_ParaBuf
+            if ( Flu_ParaBuf < Rho_ParaBuf )
+            TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
+                                              _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
+                           Timer_GetBuf[lv][0],   TIMER_ON   );
 
-//          advance patches needed to be sent
+//          overlap the exchange of the updated potential with the Poisson solver
+//          --> the exchange is completed in Gra_AdvanceDt() before invoking the Gravity solver
             TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                           SelfGravity, true, true, true, true ),
+                                          SelfGravity, !FluFrozen[lv], true, false, true ),
                            Timer_Gra_Advance[lv],   TIMER_ON   );
-
-#           pragma omp parallel sections num_threads(2)
-            {
-#              pragma omp section
-               {
-//                transfer data simultaneously
-                  if ( SelfGravity )
-                  TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
-                                                    _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][1],   TIMER_ON   );
-
-                  TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
-                                                    _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][2],   TIMER_ON   );
-               }
-
-#              pragma omp section
-               {
-//                advance patches not needed to be sent
-                  TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                                SelfGravity, true, true, false, true ),
-                                 Timer_Gra_Advance[lv],   TIMER_ON   );
-               }
-            } // OpenMP parallel sections
-
-//          disable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( false );
-#           endif
-         } // if ( OPT__OVERLAP_MPI )
-         */
+         } // if ( OPT__OVERLAP_MPI  &&  SelfGravity )
+#        else
+         if ( false ) {}
+#        endif
 
          else
          {
@@ -363,7 +352,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
                            Timer_GetBuf[lv][0],   TIMER_ON   );
 
             TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                          SelfGravity, true, false, false, true ),
+                                          SelfGravity, !FluFrozen[lv], false, false, true ),
                            Timer_Gra_Advance[lv],   TIMER_ON   );
 
 //          exchange the updated potential in the buffer patches
@@ -387,6 +376,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 #     endif // #ifdef GRAVITY
+
+
+//    free the data of lv-1 at the previous time for OPT__SG_ON_DEMAND
+//    --> no longer required after the fluid and gravity solvers of the first sub-step at this level
+      if ( lv > 0 )  Flu_FreeOldSg( lv-1 );
 // ===============================================================================================
 
 
@@ -449,7 +443,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //    6-1. Grackle cooling/heating
 // *********************************
 #     ifdef SUPPORT_GRACKLE
-      if ( GRACKLE_ACTIVATE )
+      if ( GRACKLE_ACTIVATE  &&  !FluFrozen[lv] )
       {
          const int SaveSg_Che = SaveSg_Flu;  // save in the same FluSg
 
@@ -501,18 +495,29 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 // ===============================================================================================
 
 
-//    exchange the updated fluid field in the buffer patches
-      TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
-                                        _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
-                     Timer_GetBuf[lv][2],   TIMER_ON   );
+//    exchange the updated fluid field and potential in the buffer patches together by a single batched exchange
+      {
+         GetBufReq_t BufReq[2];
+         int         NBufReq = 0;
+
+//       fluid
+//       --> already done in step 2 for OPT__OVERLAP_MPI unless the gravity solver has updated the fluid afterwards
+         const GetBufReq_t FluReq = { lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf };
+#        ifndef GRAVITY
+         if ( !OPT__OVERLAP_MPI )
+#        endif
+         BufReq[ NBufReq ++ ] = FluReq;
 
-//    exchange the updated potential in the buffer patches here if OPT__MINIMIZE_MPI_BARRIER is adopted
-#     ifdef GRAVITY
-      if ( lv > 0  &&  SelfGravity  &&  OPT__MINIMIZE_MPI_BARRIER )
-      TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
-                                        _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                     Timer_GetBuf[lv][1],   TIMER_ON   );
-#     endif
+//       potential here if OPT__MINIMIZE_MPI_BARRIER is adopted
+#        ifdef GRAVITY
+         const GetBufReq_t PotReq = { lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf };
+         if ( lv > 0  &&  SelfGravity  &&  OPT__MINIMIZE_MPI_BARRIER  &&  !OPT__OVERLAP_MPI )
+         BufReq[ NBufReq ++ ] = PotReq;
+#        endif
+
+         TIMING_FUNC(   Buf_GetBufferData_Batch( NBufReq, BufReq ),
+                        Timer_GetBuf[lv][2],   TIMER_ON   );
+      }
 
 
       dTime_SoFar       += dTime_SubStep;
@@ -547,8 +552,46 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 // ===============================================================================================
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "   Lv %2d: Flu_FixUp %24s... ", lv, "" );
 
+//       8-0. apply restriction and flux fix-up together
+//            --> serial: a single OpenMP traversal (see Flu_FixUp_RestrictFlux())
+//                --> not applicable to MHD since the electric field fix-up must be applied in between
+//            --> not applicable to the non-load-balance MPI mode since the boundary fluxes must be exchanged
+//                before the flux fix-up (see 8-3)
+//            --> load balance: restricted data, boundary fluxes, and boundary electric field (for MHD) are
+//                exchanged in a single LB_GetBufferData() call
+#        if (  ( !defined MHD  &&  defined SERIAL )  ||  defined LOAD_BALANCE  )
+         const bool FixUp_Fused = ( OPT__FIXUP_RESTRICT  &&  OPT__FIXUP_FLUX  &&  !FluFrozen[lv+1] );
+#        else
+         const bool FixUp_Fused = false;
+#        endif
+
+         if ( FixUp_Fused )
+         {
+#           ifdef LOAD_BALANCE
+            TIMING_FUNC(   Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv],
+                                               NULL_INT, NULL_INT, _TOTAL, _MAG ),
+                           Timer_FixUp[lv],   TIMER_ON   );
+
+            TIMING_FUNC(   LB_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_RESTRICT_FLUX,
+                                             _TOTAL, _MAG, NULL_INT ),
+                           Timer_GetBuf[lv][7],   TIMER_ON   );
+
+#           ifdef MHD
+            if ( OPT__FIXUP_ELECTRIC )
+            TIMING_FUNC(   MHD_FixUp_Electric( lv ),
+                           Timer_FixUp[lv],   TIMER_ON   );
+#           endif
+
+            TIMING_FUNC(   Flu_FixUp_Flux( lv ),
+                           Timer_FixUp[lv],   TIMER_ON   );
+#           else
+            TIMING_FUNC(   Flu_FixUp_RestrictFlux( lv ),
+                           Timer_FixUp[lv],   TIMER_ON   );
+#           endif
+         }
+
 //       8-1. use the average data on fine grids to correct the coarse-grid data
-         if ( OPT__FIXUP_RESTRICT )
+         if ( OPT__FIXUP_RESTRICT  &&  !FixUp_Fused )
          {
             TIMING_FUNC(   Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv],
                                                NULL_INT, NULL_INT, _TOTAL, _MAG ),
@@ -562,8 +605,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          }
 
 //       8-2. use the fine-grid electric field on the coarse-fine boundaries to correct the coarse-grid magnetic field
+//       --> skip it if lv+1 is frozen since the fine-grid electric field and fluxes have not been computed
 #        ifdef MHD
-         if ( OPT__FIXUP_ELECTRIC )
+         if ( OPT__FIXUP_ELECTRIC  &&  !FluFrozen[lv+1]  &&  !FixUp_Fused )
          {
 #           ifdef LOAD_BALANCE
             TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, NULL_INT, COARSE_FINE_ELECTRIC,
@@ -579,9 +623,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //       8-3. use the fine-grid fluxes across the coarse-fine boundaries to correct the coarse-grid data
 //            --> apply AFTER other fix-up operations since it will check negative pressure as well
 //                (which requires the coarse-grid B field updated by Flu_FixUp_Restrict() and MHD_FixUp_Electric())
-         if ( OPT__FIXUP_FLUX )
+         if ( OPT__FIXUP_FLUX  &&  !FluFrozen[lv+1]  &&  !FixUp_Fused )
          {
-#           ifdef LOAD_BALANCE
+#           ifndef SERIAL
             TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, NULL_INT, COARSE_FINE_FLUX,
                                               _FLUX_TOTAL, _NONE, NULL_INT, USELB_YES ),
                            Timer_GetBuf[lv][6],   TIMER_ON   );
@@ -628,8 +672,16 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 //       refine
+//       --> skip it for OPT__REGRID_LAZY if no patch at lv changes its refinement state
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "   Lv %2d: Refine %27s... ", lv, "" );
 
+         bool DoRefine = true;
+
+         if ( OPT__REGRID_LAZY )
+         TIMING_FUNC(   DoRefine = Refine_CheckFlagChange( lv, USELB_YES ),
+                        Timer_Refine[lv],   TIMER_ON   );
+
+         if ( DoRefine )
          TIMING_FUNC(   Refine( lv, USELB_YES ),
                         Timer_Refine[lv],   TIMER_ON   );
 
@@ -644,27 +696,40 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          amr->PotSgTime[lv+1][ amr->PotSg[lv+1] ] = Time[lv];
 #        endif
 
-#        ifdef LOAD_BALANCE
-         TIMING_FUNC(   Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_AFTER_REFINE,
-                                           _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
-                        Timer_GetBuf[lv][4],   TIMER_ON   );
-#        ifdef GRAVITY
-         if ( SelfGravity )
-         TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, amr->PotSg[lv], POT_AFTER_REFINE,
-                                           _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                        Timer_GetBuf[lv][5],   TIMER_ON   );
-#        endif
-#        endif // #ifdef LOAD_BALANCE
+//       exchange the fluid and potential data after refine at lv (LOAD_BALANCE only) and lv+1 by a single
+//       batched exchange
+//       --> skip it if refine is skipped since no buffer patch has been allocated and all buffer data are
+//           still up-to-date (the SibDiff lists used by DATA_AFTER_REFINE may also be stale)
+         if ( DoRefine )
+         {
+            GetBufReq_t BufReq[4];
+            int         NBufReq = 0;
 
-         TIMING_FUNC(   Buf_GetBufferData( lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
-                                           _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
-                        Timer_GetBuf[lv][4],   TIMER_ON   );
-#        ifdef GRAVITY
-         if ( SelfGravity )
-         TIMING_FUNC(   Buf_GetBufferData( lv+1, NULL_INT, NULL_INT, amr->PotSg[lv+1], POT_AFTER_REFINE,
-                                           _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                        Timer_GetBuf[lv][5],   TIMER_ON   );
-#        endif
+#           ifdef LOAD_BALANCE
+            const GetBufReq_t FluReq   = { lv,   amr->FluSg[lv],   amr->MagSg[lv],   NULL_INT, DATA_AFTER_REFINE,
+                                           _TOTAL, _MAG, Flu_ParaBuf };
+            BufReq[ NBufReq ++ ] = FluReq;
+#           ifdef GRAVITY
+            const GetBufReq_t PotReq   = { lv,   NULL_INT, NULL_INT, amr->PotSg[lv],             POT_AFTER_REFINE,
+                                           _POTE, _NONE, Pot_ParaBuf };
+            if ( SelfGravity )
+            BufReq[ NBufReq ++ ] = PotReq;
+#           endif
+#           endif // #ifdef LOAD_BALANCE
+
+            const GetBufReq_t FluReqP1 = { lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
+                                           _TOTAL, _MAG, Flu_ParaBuf };
+            BufReq[ NBufReq ++ ] = FluReqP1;
+#           ifdef GRAVITY
+            const GetBufReq_t PotReqP1 = { lv+1, NULL_INT, NULL_INT, amr->PotSg[lv+1],           POT_AFTER_REFINE,
+                                           _POTE, _NONE, Pot_ParaBuf };
+            if ( SelfGravity )
+            BufReq[ NBufReq ++ ] = PotReqP1;
+#           endif
+
+            TIMING_FUNC(   Buf_GetBufferData_Batch( NBufReq, BufReq ),
+                           Timer_GetBuf[lv][4],   TIMER_ON   );
+         }
 
 //       must call Poi_StorePotWithGhostZone AFTER collecting potential for buffer patches
 #        ifdef STORE_POT_GHOST
@@ -683,12 +748,18 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       } // if ( lv != TOP_LEVEL  &&  AdvanceCounter[lv] % REGRID_COUNT == 0 )
 // ===============================================================================================
 
+
+//    free the data at the previous time for OPT__SG_ON_DEMAND
+      Flu_FreeOldSg( lv );
+
    } // while()
 
 
 #  ifdef TIMING
    MPI_Barrier( MPI_COMM_WORLD );
    Timer_Lv[lv]->Stop();
+
+   if ( OPT__TRACE )    Aux_Trace_Record( "EvolveLevel", lv, Trace_T0 );
 #  endif
 
 } // FUNCTION : EvolveLevel
@@ -81,6 +81,8 @@ void SetTempIntPara( const int lv, const int Sg_Current, const double PrepTime,
 //                DE_Consistency    : Ensure the consistency between pressure, total energy density, and the
 //                                    dual-energy variable when DUAL_ENERGY is on
 //                FInterface        : B field on the coarse-fine interfaces for the divergence-preserving interpolation
+//                FluIntTimeLazy    : Skip the temporal interpolation of fluid for the coarse-grid patches whose two
+//                                    sandglasses store identical data (i.e., patch_t::FluSgSame) --> for OPT__INT_TIME_LAZY
 //-------------------------------------------------------------------------------------------------------
 void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real IntData_FC[],
                            const int FSide, const double PrepTime, const int GhostSize,
@@ -91,7 +93,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                            const long TVarFC, const int NVarFC_Tot, const int TVarFCIdxList[],
                            const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                            const int BC_Face[], const real MinPres, const bool DE_Consistency,
-                           const real *FInterface[6] )
+                           const real *FInterface[6], const bool FluIntTimeLazy )
 {
 
 // check
@@ -215,7 +217,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
 
 // temporal interpolation parameters
-   bool FluIntTime;
+   bool FluIntTime = false;
    int  FluSg, FluSg_IntT;
    real FluWeighting, FluWeighting_IntT;
 
@@ -286,6 +288,17 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
    }
 
 
+// skip temporal interpolation if both fluid sandglasses of PID store identical data (for OPT__INT_TIME_LAZY only)
+   bool FluIntTime_Patch = FluIntTime;
+
+   if ( FluIntTime  &&  FluIntTimeLazy  &&  amr->patch[0][lv][PID]->FluSgSame )
+   {
+      FluIntTime_Patch = false;
+#     pragma omp atomic
+      NIntTimeSkip[lv] ++;
+   }
+
+
 // a1. fluid data
    CData_CC_Ptr = CData_CC;
 
@@ -300,7 +313,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
          CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[TVarCCIdx_Flu][k1][j1][i1];
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                              + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][PID]->fluid[TVarCCIdx_Flu][k1][j1][i1];
 
@@ -323,7 +336,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
          CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMX][k1][j1][i1] /
                              amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                              + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMX][k1][j1][i1] /
                                                    amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
@@ -343,7 +356,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
          CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMY][k1][j1][i1] /
                              amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                              + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMY][k1][j1][i1] /
                                                    amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
@@ -363,7 +376,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
          CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMZ][k1][j1][i1] /
                              amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                              + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMZ][k1][j1][i1] /
                                                    amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
@@ -392,7 +405,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                              (MinPres>=(real)0.0), MinPres, Emag,
                                              EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          {
             for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k1][j1][i1];
 
@@ -434,7 +447,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                              (MinPres>=(real)0.0), MinPres, Emag,
                                              EoS_DensEint2Pres_CPUPtr, EoS_AuxArray );
 
-         if ( FluIntTime ) // temporal interpolation
+         if ( FluIntTime_Patch ) // temporal interpolation
          {
             for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k1][j1][i1];
 
@@ -570,6 +583,16 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
       {
          CData_CC_Ptr = CData_CC;
 
+//       skip temporal interpolation for SibPID as well if possible
+         FluIntTime_Patch = FluIntTime;
+
+         if ( FluIntTime  &&  FluIntTimeLazy  &&  amr->patch[0][lv][SibPID]->FluSgSame )
+         {
+            FluIntTime_Patch = false;
+#           pragma omp atomic
+            NIntTimeSkip[lv] ++;
+         }
+
 //       b1-1. fluid data
          for (int v=0; v<NVarCC_Flu; v++)
          {
@@ -582,7 +605,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
                CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[TVarCCIdx_Flu][k2][j2][i2];
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                                    + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][SibPID]->fluid[TVarCCIdx_Flu][k2][j2][i2];
 
@@ -605,7 +628,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMX][k2][j2][i2] /
                                    amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                                    + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMX][k2][j2][i2] /
                                                          amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
@@ -625,7 +648,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMY][k2][j2][i2] /
                                    amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                                    + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMY][k2][j2][i2] /
                                                          amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
@@ -645,7 +668,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMZ][k2][j2][i2] /
                                    amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
                                    + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMZ][k2][j2][i2] /
                                                          amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
@@ -674,7 +697,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                    (MinPres>=(real)0.0), MinPres, Emag,
                                                    EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                {
                   for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][k2][j2][i2];
 
@@ -716,7 +739,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                    (MinPres>=(real)0.0), MinPres, Emag,
                                                    EoS_DensEint2Pres_CPUPtr, EoS_AuxArray );
 
-               if ( FluIntTime ) // temporal interpolation
+               if ( FluIntTime_Patch ) // temporal interpolation
                {
                   for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][k2][j2][i2];
 
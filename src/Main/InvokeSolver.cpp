@@ -10,6 +10,10 @@ static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Clo         [NLEVEL][NSOLVER];
+#ifdef TIMING_SOLVER
+extern ThreadTimer_t *Timer_Pre_Thread[NLEVEL][NSOLVER];
+extern ThreadTimer_t *Timer_Clo_Thread[NLEVEL][NSOLVER];
+#endif
 #ifdef GRAVITY
 extern Timer_t *Timer_Poi_PreRho  [NLEVEL];
 extern Timer_t *Timer_Poi_PreFlu  [NLEVEL];
@@ -33,6 +37,15 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. Patch groups are processed in batches of at most NPG_Max patch groups using two sets of
+//                   host arrays (i.e., ArrayID = 0/1)
+//                   --> The preparation step of one batch and the closing step of the previous batch overlap
+//                       with the GPU solver
+//                   --> OPT__ADAPTIVE_NPGROUP evens out the batch size of each level (see NPG_Batch below)
+//                6. For OPT__TRACE, each step of each batch and the wait for the GPU solvers are recorded as
+//                   separate events by TRACE_FUNC()
+//                7. For OPT__MPI_PROGRESS, the exchange started by LB_GetBufferData_Start() is polled after each step
+//                   when advancing the patches overlapped with MPI communication (i.e., Overlap_Sync == false)
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -180,71 +193,127 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       NTotal       = amr->NPatchComma[lv][1] / 8;
       PID0_List    = new int [NTotal];
 
-      for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
+//    exclude the patch groups skipped or caught up separately by Flu_FrozenRegion_Advance() for OPT__FROZEN_REGION
+      if ( TSolver == FLUID_SOLVER  &&  OPT__FROZEN_REGION )
+      {
+         NTotal = 0;
+
+         for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+            if ( amr->patch[0][lv][PID0]->Frz_Mode == FRZ_NONE )  PID0_List[ NTotal ++ ] = PID0;
+      }
+
+      else
+         for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
    } // if ( OverlapMPI ) ... else ...
 
-   NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
+// number of patch groups per batch
+// --> for OPT__ADAPTIVE_NPGROUP, split NTotal evenly into the fewest batches allowed by NPG_Max and round the
+//     batch size up to a multiple of the GPU streams (GPU) or OpenMP threads (CPU) so that neither the last batch
+//     nor the work shared among streams/threads is under-filled
+// --> never exceed NPG_Max, which sets the size of the host and device arrays
+   int NPG_Batch = NPG_Max;
 
+   if ( OPT__ADAPTIVE_NPGROUP  &&  NTotal > 0 )
+   {
+#     ifdef GPU
+      const int NGranule = GPU_NSTREAM;
+#     else
+      const int NGranule = OMP_NTHREAD;
+#     endif
+      const int NBatch_Min = ( NTotal + NPG_Max - 1 )/NPG_Max;
 
-//-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID ),
-                  Timer_Pre[lv][TSolver]  );
-//-------------------------------------------------------------------------------------------------------------
+      NPG_Batch = ( NTotal + NBatch_Min - 1 )/NBatch_Min;
+      NPG_Batch = ( NPG_Batch + NGranule - 1 )/NGranule*NGranule;
+      NPG_Batch = MIN( NPG_Batch, NPG_Max );
+   }
 
+// number of patch-group batches
+// --> always invoke the solvers at least once even if there is no patch group to be updated
+   const int NBatch = ( NTotal > 0 ) ? ( NTotal + NPG_Batch - 1 )/NPG_Batch : 1;
 
-//-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
-                  Timer_Sol[lv][TSolver]  );
-//-------------------------------------------------------------------------------------------------------------
+// poll the pending MPI exchange between steps so that it progresses during computation
+#  ifdef LOAD_BALANCE
+   const bool PollMPI = ( OPT__MPI_PROGRESS  &&  OverlapMPI  &&  !Overlap_Sync );
+#  endif
 
 
-   for (Disp=NPG_Max; Disp<NTotal; Disp+=NPG_Max)
+// preparation(b) -> solver(b) [asynchronous for GPU] -> closing(b-1)
+// --> the closing step of each batch is delayed by exactly one batch so that it overlaps with the GPU solver of
+//     the next batch
+// --> a longer delay is not allowed since there are only two sets of host arrays (ArrayID = 0/1) and batch b
+//     reuses the arrays of batch b-2, which must have been closed already
+   for (int b=0; b<=NBatch; b++)
    {
-
-      ArrayID      = 1 - ArrayID;
-      NPG[ArrayID] = ( NPG_Max < NTotal-Disp ) ? NPG_Max : NTotal-Disp;
+      if ( b < NBatch )
+      {
+         ArrayID      = b % 2;
+         Disp         = b*NPG_Batch;
+         NPG[ArrayID] = ( NPG_Batch < NTotal-Disp ) ? NPG_Batch : NTotal-Disp;
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
-                     Timer_Pre[lv][TSolver]  );
-//-------------------------------------------------------------------------------------------------------------
+         THREAD_TIMER_SET( Timer_Pre_Thread[lv][TSolver] );
 
+         TIMING_SYNC(   TRACE_FUNC( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
+                                    lv ),
+                        Timer_Pre[lv][TSolver]  );
 
-//-------------------------------------------------------------------------------------------------------------
-#     ifdef GPU
-      CUAPI_Synchronize();
-#     endif
+         THREAD_TIMER_SET( NULL );
+
+#        ifdef LOAD_BALANCE
+         if ( PollMPI )    LB_GetBufferData_Progress();
+#        endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
-                     Timer_Sol[lv][TSolver]  );
+#        ifdef GPU
+         if ( b > 0 )   TRACE_FUNC( CUAPI_Synchronize(), lv );
+#        endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
-                     Timer_Clo[lv][TSolver]  );
+         TIMING_SYNC(   TRACE_FUNC( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+                                    lv ),
+                        Timer_Sol[lv][TSolver]  );
+
+#        ifdef LOAD_BALANCE
+         if ( PollMPI )    LB_GetBufferData_Progress();
+#        endif
 //-------------------------------------------------------------------------------------------------------------
+      } // if ( b < NBatch )
 
-   } // for (int Disp=NPG_Max; Disp<NTotal; Disp+=NPG_Max)
 
+      if ( b > 0 )
+      {
+         const int bClose       = b - 1;
+         const int ArrayIDClose = bClose % 2;
 
 //-------------------------------------------------------------------------------------------------------------
-#  ifdef GPU
-   CUAPI_Synchronize();
-#  endif
+//       the GPU solver of the last batch has not been synchronized by the loop above
+#        ifdef GPU
+         if ( b >= NBatch )   TRACE_FUNC( CUAPI_Synchronize(), lv );
+#        endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
-                  Timer_Clo[lv][TSolver]  );
+         THREAD_TIMER_SET( Timer_Clo_Thread[lv][TSolver] );
+
+         TIMING_SYNC(   TRACE_FUNC( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                                  NPG[ArrayIDClose], PID0_List+bClose*NPG_Batch, ArrayIDClose, dt ),
+                                    lv ),
+                        Timer_Clo[lv][TSolver]  );
+
+         THREAD_TIMER_SET( NULL );
+
+#        ifdef LOAD_BALANCE
+         if ( PollMPI )    LB_GetBufferData_Progress();
+#        endif
 //-------------------------------------------------------------------------------------------------------------
+      } // if ( b > 0 )
+   } // for (int b=0; b<=NBatch; b++)
 
 
    if ( AllocateList )  delete [] PID0_List;
@@ -299,6 +368,10 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 #  endif
 
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Start();
+#  endif
+
    switch ( TSolver )
    {
       case FLUID_SOLVER :
@@ -313,6 +386,10 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 
          TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
+
+         if ( Poi_UseWarmStart(lv, TimeNew) )
+         TIMING_SYNC(   Poi_Prepare_WarmStart( lv, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List ),
+                        Timer_Poi_PrePot_F[lv]   );
       break;
 
       case GRAVITY_SOLVER :
@@ -343,6 +420,10 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
          TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
 
+         if ( Poi_UseWarmStart(lv, TimeNew) )
+         TIMING_SYNC(   Poi_Prepare_WarmStart( lv, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List ),
+                        Timer_Poi_PrePot_F[lv]   );
+
          TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
                                          NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
@@ -384,6 +465,10 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 
    } // switch ( TSolver )
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Stop( TSolver, 0 );
+#  endif
+
 } // FUNCTION : Preparation_Step
 
 
@@ -455,6 +540,12 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
    const double ELBDM_LAMBDA = NULL_REAL;
 #  endif
 
+#  ifdef UNSPLIT_GRAVITY
+   const bool FuseExtAcc = OPT__USG_FUSE_EXT_ACC;
+#  else
+   const bool FuseExtAcc = false;
+#  endif
+
 #  ifndef UNSPLIT_GRAVITY
    real (*h_Pot_Array_USG_F[2])[ CUBE(USG_NXT_F) ]                    = { NULL, NULL };
 #  ifdef GRAVITY
@@ -494,6 +585,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 #  endif
 
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Start();
+#  endif
+
    switch ( TSolver )
    {
       case FLUID_SOLVER :
@@ -514,7 +609,7 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
                                  NPG, dt, dh, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
-                                 TimeOld, OPT__GRAVITY_TYPE, MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
+                                 TimeOld, TimeNew, FuseExtAcc, OPT__GRAVITY_TYPE, MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff );
 #        endif
       break;
@@ -537,10 +632,13 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_P_Out[ArrayID], NULL, NULL,
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
-                                          SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
+                                          SOR_OMEGA, SOR_TOLERATED_ERROR, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
                                           NULL_BOOL, ELBDM_ETA, NULL_REAL, POISSON_ON, GRAVITY_OFF,
-                                          GRAVITY_NONE, NULL_REAL, NULL_REAL, NULL_BOOL, NULL_REAL );
+                                          GRAVITY_NONE, NULL_REAL, NULL_REAL, NULL_BOOL, NULL_REAL,
+                                          Poi_UseWarmStart(lv, TimeNew), (OPT__RECORD_POI_ITER) ? PoiNIter+lv : NULL );
+
+         if ( OPT__RECORD_POI_ITER )   PoiNPatch[lv] += 8*NPG;
 #        endif
       break;
 
@@ -563,10 +661,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
                                           h_Emag_Array_G[ArrayID],
                                           NPG, dt, dh, NULL_INT, NULL_INT,
-                                          NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
+                                          NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
                                           OPT__GRA_P5_GRADIENT, ELBDM_ETA, ELBDM_LAMBDA, POISSON_OFF, GRAVITY_ON,
-                                          OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MIN_EINT );
+                                          OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MIN_EINT,
+                                          false, NULL );
 #        endif
       break;
 
@@ -589,10 +688,13 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
                                           h_Emag_Array_G[ArrayID],
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
-                                          SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
+                                          SOR_OMEGA, SOR_TOLERATED_ERROR, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
                                           OPT__GRA_P5_GRADIENT, ELBDM_ETA, ELBDM_LAMBDA, POISSON_ON, GRAVITY_ON,
-                                          OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MIN_EINT );
+                                          OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MIN_EINT,
+                                          Poi_UseWarmStart(lv, TimeNew), (OPT__RECORD_POI_ITER) ? PoiNIter+lv : NULL );
+
+         if ( OPT__RECORD_POI_ITER )   PoiNPatch[lv] += 8*NPG;
 #        endif
       break;
 #     endif // #ifdef GRAVITY
@@ -600,7 +702,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         CPU_GrackleSolver( Che_FieldData, Che_Units, NPG, dt );
+         CPU_GrackleSolver( (GRACKLE_ZERO_COPY)?Che_FieldData_Patch:Che_FieldData, Che_Units, NPG, dt, GRACKLE_ZERO_COPY,
+                            h_Che_Cost, GRACKLE_SCREEN_TCOOL );
 
       break;
 #     endif // #ifdef SUPPORT_GRACKLE
@@ -649,6 +752,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
    } // switch ( TSolver )
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Stop( TSolver, 1 );
+#  endif
+
 } // FUNCTION : Solver
 
 
@@ -695,6 +802,10 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
    real (*h_Emag_Array_G   [2])[PS1][PS1][PS1]                        = { NULL, NULL };
 #  endif
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Start();
+#  endif
+
    switch ( TSolver )
    {
       case FLUID_SOLVER :
@@ -741,6 +852,10 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 
    } // switch ( TSolver )
 
+#  ifdef TIMING_SOLVER
+   Aux_PerfCounter_Stop( TSolver, 2 );
+#  endif
+
 } // FUNCTION : Closing_Step
 
 
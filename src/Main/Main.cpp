@@ -22,6 +22,23 @@ double               Time[NLEVEL]           = { 0.0 };
 double               dTime_AllLv[NLEVEL]    = { 0.0 };
 long                 AdvanceCounter[NLEVEL] = { 0 };
 long                 NCorrUnphy[NLEVEL]     = { 0 };
+#ifdef MHD
+double               MHD_DivB_Max[NLEVEL]   = { 0.0 };
+double               MHD_DivB_Sqr[NLEVEL]   = { 0.0 };
+long                 MHD_DivB_NCell[NLEVEL] = { 0 };
+#endif
+#if ( MODEL == HYDRO )
+double               Cons_Bnd[NCOMP_TOTAL]  = { 0.0 };
+double               Cons_Src[NCOMP_TOTAL]  = { 0.0 };
+#endif
+#ifdef RSOLVER_HYBRID
+long                 NRSolverHybrid[2]      = { 0 };
+#endif
+long                 NIntTimeSkip[NLEVEL]   = { 0 };
+#ifdef PARTICLE
+long                 ParUpdate_NPar         = 0;
+double               ParUpdate_Time         = 0.0;
+#endif
 long                 Step                   = 0;
 int                  DumpID                 = 0;
 double               DumpTime               = 0.0;
@@ -42,26 +59,48 @@ int                 *BaseP = NULL;
 int                  Flu_ParaBuf;
 
 double               BOX_SIZE, DT__MAX, DT__FLUID, DT__FLUID_INIT, END_T, OUTPUT_DT, DT__SYNC_PARENT_LV, DT__SYNC_CHILDREN_LV;
+double               DT__SUBSTEP_OVERHEAD;
+bool                 OPT__DT_OPT_SUBSTEP;
+bool                 OPT__FROZEN_REGION;
+int                  FROZEN_REGION_NSTEP;
+double               FROZEN_REGION_TOL;
 long                 END_STEP;
 int                  NX0_TOT[3], OUTPUT_STEP, REGRID_COUNT, FLU_GPU_NPGROUP, OMP_NTHREAD;
 int                  MPI_NRank, MPI_NRank_X[3];
 int                  GPU_NSTREAM, FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, FLAG_BUFFER_SIZE_MAXM2_LV, MAX_LEVEL;
+bool                 OPT__ADAPTIVE_NPGROUP;
 
 IntScheme_t          OPT__FLU_INT_SCHEME, OPT__REF_FLU_INT_SCHEME;
 double               OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT_FACTOR, AUTO_REDUCE_DT_FACTOR_MIN;
 double               OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
+double               INIT_SUBSAMPLING_TOL;
 int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
-int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, OPT__MEMORY_POOL, RESTART_LOAD_NRANK;
+int                  OPT__INIT_REFINE_MAP;
+int                  OPT__OUTPUT_COMPRESS, OPT__OUTPUT_CHUNK_NPATCH, OPT__CKPT_LOCAL;
+int                  OUTPUT_SUB_STEP, OUTPUT_SUB_LV_MIN, OUTPUT_SUB_LV_MAX;
+long                 OUTPUT_SUB_FIELD;
+double               OUTPUT_SUB_EDGEL[3], OUTPUT_SUB_EDGER[3];
+int                  OUTPUT_UG_STEP, OUTPUT_UG_LV;
+double               OUTPUT_UG_EDGEL[3], OUTPUT_UG_EDGER[3];
+int                  OUTPUT_DIAG_STEP, OUTPUT_DIAG_PROJ_LV, OUTPUT_DIAG_PHASE_NBIN;
+long                 OUTPUT_DIAG_FIELD;
+double               OUTPUT_DIAG_PROF_RMAX, OUTPUT_DIAG_PROF_LOGR;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
-bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__RESTART_RESET, OPT__RESTART_BULK,
+                     OPT__RESTART_LOCAL, OPT__PATCH_ARENA, OPT__FIRST_TOUCH, OPT__SG_ON_DEMAND;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
-bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
+bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_TEXT_BINARY, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+bool                 OPT__OUTPUT_MPIIO, OPT__OUTPUT_ASYNC, OPT__OUTPUT_SHUFFLE, OPT__OUTPUT_INDEX, OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
-bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
-bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
+int                  OPT__CK_FLU_OUTPUT;
+bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI, OPT__DT_FLU_BYPRODUCT, OPT__GHOST_CACHE;
+bool                 OPT__INT_TIME_LAZY, OPT__REGRID_LAZY, OPT__TRACE, OPT__TIMING_COUNTER, OPT__RECORD_PATCH_COST;
+bool                 OPT__FLAG_FLU_BYPRODUCT, OPT__PREP_COST_ORDER;
+int                  TRACE_NEVENT, OPT__RECORD_TELEMETRY;
+bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT, AUTO_REDUCE_DT_LOCAL;
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
-bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
+bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER, OPT__RECORD_CONSERVATION;
 UM_IC_Format_t       OPT__UM_IC_FORMAT;
 TestProbID_t         TESTPROB_ID;
 OptInit_t            OPT__INIT;
@@ -93,7 +132,8 @@ double               DUAL_ENERGY_SWITCH;
 #ifdef MHD
 double               FlagTable_Current[NLEVEL-1];
 IntScheme_t          OPT__MAG_INT_SCHEME, OPT__REF_MAG_INT_SCHEME;
-bool                 OPT__FIXUP_ELECTRIC, OPT__CK_INTERFACE_B, OPT__OUTPUT_CC_MAG, OPT__FLAG_CURRENT;
+bool                 OPT__FIXUP_ELECTRIC, OPT__CK_INTERFACE_B, OPT__OUTPUT_CC_MAG, OPT__FLAG_CURRENT, OPT__RECORD_DIVB;
+bool                 OPT__EMAG_CACHE;
 int                  OPT__CK_DIVERGENCE_B;
 double               UNIT_B;
 bool                 OPT__INIT_BFIELD_BYFILE;
@@ -120,12 +160,20 @@ int                  Pot_ParaBuf, Rho_ParaBuf;
 
 real                *GreenFuncK = NULL;
 double               GFUNC_COEFF0;
+bool                 OPT__GFUNC_CACHE;
 double               DT__GRAVITY;
 double               NEWTON_G;
 int                  POT_GPU_NPGROUP;
 bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__EXTERNAL_POT, OPT__GRAVITY_EXTRA_MASS;
-double               SOR_OMEGA;
+bool                 OPT__FFT_PENCIL, OPT__POT_WARM_START, OPT__RECORD_POI_ITER, OPT__USG_POT_EXT;
+bool                 OPT__USG_FUSE_EXT_ACC;
+double               SOR_OMEGA, SOR_TOLERATED_ERROR;
 int                  SOR_MAX_ITER, SOR_MIN_ITER;
+int                  POT_LEVEL_NSWEEP;
+int                  OPT__RECORD_LEVEL_PS, LEVEL_PS_LV;
+bool                 LEVEL_PS_INTERLACE;
+long                 PoiNIter[NLEVEL]       = { 0 };
+long                 PoiNPatch[NLEVEL]      = { 0 };
 double               MG_TOLERATED_ERROR;
 int                  MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
 IntScheme_t          OPT__POT_INT_SCHEME, OPT__RHO_INT_SCHEME, OPT__GRA_INT_SCHEME, OPT__REF_POT_INT_SCHEME;
@@ -153,6 +201,13 @@ void (*SetCPUExtPot_Ptr)( ExtPot_t & )       = NULL;
 ExtPot_t GPUExtPot_Ptr                       = NULL;
 void (*SetGPUExtPot_Ptr)( ExtPot_t & )       = NULL;
 #endif
+
+// c. tabulated external potential and acceleration
+char   EXT_POT_TABLE_NAME[MAX_STRING];
+int    EXT_POT_TABLE_NPOINT[3];
+double EXT_POT_TABLE_DH, EXT_POT_TABLE_EDGEL[3];
+real  *ExtPotTable                           = NULL;
+long   ExtPotTable_Size                      = 0;
 #endif // #ifdef GRAVITY
 
 // (2-3) cosmological simulations
@@ -166,7 +221,13 @@ double               LB_INPUT__WLI_MAX;
 #ifdef PARTICLE
 double               LB_INPUT__PAR_WEIGHT;
 #endif
-bool                 OPT__RECORD_LOAD_BALANCE;
+double               LB_INPUT__MEASURED_COST;
+#ifdef SUPPORT_GRACKLE
+double               LB_INPUT__CHE_WEIGHT;
+#endif
+bool                 OPT__RECORD_LOAD_BALANCE, OPT__LB_INCREMENTAL, OPT__LB_COUPLE_LEVEL, OPT__LB_DERIVED_TYPE,
+                     OPT__LB_DIST_GRAPH, OPT__MPI_PROGRESS;
+OptLBCurve_t         OPT__LB_CURVE;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 
@@ -183,6 +244,9 @@ ParOutputDens_t      OPT__OUTPUT_PAR_DENS;
 #ifdef SUPPORT_LIBYT
 char                 YT_SCRIPT[MAX_STRING];
 yt_verbose           YT_VERBOSE;
+int                  YT_STEP, YT_ASYNC_NCORE;
+bool                 YT_ASYNC;
+double               YT_ASYNC_MAX_MEM;
 #endif
 
 // (2-7) Grackle
@@ -201,6 +265,8 @@ int                  GRACKLE_THREE_BODY_RATE;
 bool                 GRACKLE_CIE_COOLING;
 int                  GRACKLE_H2_OPA_APPROX;
 int                  CHE_GPU_NPGROUP;
+bool                 GRACKLE_ZERO_COPY;
+double               GRACKLE_SCREEN_TCOOL;
 #endif
 
 // (2-8) star formation
@@ -229,6 +295,13 @@ EoS_DE2P_t EoS_DensEint2Pres_GPUPtr = NULL;
 EoS_DP2E_t EoS_DensPres2Eint_GPUPtr = NULL;
 EoS_DP2C_t EoS_DensPres2CSqr_GPUPtr = NULL;
 #endif
+
+// tabulated EoS
+#if ( EOS == EOS_TABULAR )
+char  EOS_TABLE_NAME[MAX_STRING];
+real *EoS_Table      = NULL;
+long  EoS_Table_Size = 0;
+#endif
 #endif // HYDRO
 
 
@@ -250,7 +323,7 @@ real (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ]            = { NULL, NUL
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 real (*h_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ]  = NULL;
 real (*h_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ]  = NULL;
-real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]  = NULL;
+real_fc (*h_FC_Var)[6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]  = NULL;
 real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ]  = NULL;
 #ifdef MHD
 real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]        = NULL;
@@ -283,7 +356,9 @@ real (*h_Flu_Array_USG_G[2])[GRA_NIN-1][PS1][PS1][PS1]             = { NULL, NUL
 // (3-4) Grackle chemistry
 #ifdef SUPPORT_GRACKLE
 real (*h_Che_Array[2])                                             = { NULL, NULL };
+double *h_Che_Cost                                                 = NULL;
 grackle_field_data *Che_FieldData                                  = NULL;
+grackle_field_data *Che_FieldData_Patch                            = NULL;
 code_units Che_Units;
 #endif
 
@@ -317,7 +392,7 @@ real (*d_Ele_Array      )[9][NCOMP_ELE][ PS2P1*PS2 ]              = NULL;
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 real (*d_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ] = NULL;
 real (*d_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = NULL;
-real (*d_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = NULL;
+real_fc (*d_FC_Var)[6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = NULL;
 real (*d_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = NULL;
 #ifdef MHD
 real (*d_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]       = NULL;
@@ -381,6 +456,7 @@ Timer_t *Timer_Par_2Sib   [NLEVEL];
 Timer_t *Timer_Par_2Son   [NLEVEL];
 Timer_t *Timer_Par_Collect[NLEVEL];
 Timer_t *Timer_Par_MPI    [NLEVEL][6];
+Timer_t *Timer_GetBuf_Wait[NLEVEL];
 #endif
 
 #ifdef TIMING_SOLVER
@@ -391,6 +467,9 @@ Timer_t *Timer_Poi_PreRho  [NLEVEL];
 Timer_t *Timer_Poi_PreFlu  [NLEVEL];
 Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 Timer_t *Timer_Poi_PrePot_F[NLEVEL];
+ThreadTimer_t *Timer_Pre_Thread[NLEVEL][NSOLVER];
+ThreadTimer_t *Timer_Clo_Thread[NLEVEL][NSOLVER];
+ThreadTimer_t *Timer_ThreadPhase = NULL;
 #endif
 
 
@@ -439,6 +518,10 @@ int main( int argc, char *argv[] )
          Aux_Error( ERROR_INFO, "Aux_Record_User_Ptr == NULL for OPT__RECORD_USER !!\n" );
    }
 
+#  ifdef GRAVITY
+   if ( OPT__RECORD_LEVEL_PS > 0 )        Aux_Record_LevelPowerSpectrum();
+#  endif
+
 #  ifdef PARTICLE
    if ( OPT__PARTICLE_COUNT > 0 )         Par_Aux_Record_ParticleCount();
 #  endif
@@ -491,9 +574,30 @@ int main( int argc, char *argv[] )
 //    ---------------------------------------------------------------------------------------------------
       TIMING_FUNC(   Output_DumpData( 1 ),            Timer_Main[3],   TIMER_ON   );
 
+#     ifdef SUPPORT_HDF5
+      if ( OUTPUT_SUB_STEP > 0  &&  Step%OUTPUT_SUB_STEP == 0 )
+      TIMING_FUNC(   Output_DumpData_Sub_HDF5(),      Timer_Main[3],   TIMER_ON   );
+#     endif
+
+      if ( OUTPUT_UG_STEP > 0  &&  Step%OUTPUT_UG_STEP == 0 )
+      TIMING_FUNC(   Output_UniformGrid(),            Timer_Main[3],   TIMER_ON   );
+
+#     ifdef SUPPORT_HDF5
+      if ( OUTPUT_DIAG_STEP > 0  &&  Step%OUTPUT_DIAG_STEP == 0 )
+      TIMING_FUNC(   Output_InlineDiag(),             Timer_Main[3],   TIMER_ON   );
+#     endif
+
+#     ifdef LOAD_BALANCE
+      if ( OPT__CKPT_LOCAL > 0  &&  Step%OPT__CKPT_LOCAL == 0 )
+      TIMING_FUNC(   Output_CheckpointLocal(),        Timer_Main[3],   TIMER_ON   );
+#     endif
+
       if ( OPT__PATCH_COUNT == 1 )
       TIMING_FUNC(   Aux_Record_PatchCount(),         Timer_Main[4],   TIMER_ON   );
 
+      if ( OPT__MEMORY_POOL == 2 )
+      TIMING_FUNC(   Aux_MemoryPool_Grow(),           Timer_Main[4],   TIMER_ON   );
+
       if ( OPT__RECORD_MEMORY )
       TIMING_FUNC(   Aux_GetMemInfo(),                Timer_Main[4],   TIMER_ON   );
 
@@ -503,6 +607,24 @@ int main( int argc, char *argv[] )
       if ( OPT__RECORD_UNPHY )
       TIMING_FUNC(   Aux_Record_CorrUnphy(),          Timer_Main[4],   TIMER_ON   );
 
+#     ifdef MHD
+      if ( OPT__RECORD_DIVB )
+      TIMING_FUNC(   MHD_Aux_Record_DivergenceB(),    Timer_Main[4],   TIMER_ON   );
+#     endif
+
+#     if ( MODEL == HYDRO )
+      if ( OPT__RECORD_CONSERVATION )
+      TIMING_FUNC(   Aux_Record_Conservation(),       Timer_Main[4],   TIMER_ON   );
+#     endif
+
+#     ifdef GRAVITY
+      if ( OPT__RECORD_POI_ITER )
+      TIMING_FUNC(   Aux_Record_PoissonIter(),        Timer_Main[4],   TIMER_ON   );
+
+      if ( OPT__RECORD_LEVEL_PS > 0  &&  Step%OPT__RECORD_LEVEL_PS == 0 )
+      TIMING_FUNC(   Aux_Record_LevelPowerSpectrum(), Timer_Main[4],   TIMER_ON   );
+#     endif
+
 #     ifdef PARTICLE
       if ( OPT__PARTICLE_COUNT == 1 )
       TIMING_FUNC(   Par_Aux_Record_ParticleCount(),  Timer_Main[4],   TIMER_ON   );
@@ -538,6 +660,10 @@ int main( int argc, char *argv[] )
       Timer_Main[5]->Start();    // timer for load balance
 #     endif
 
+#     ifdef TIMING
+      if ( amr->LB->Cost_EMA > 0.0 )   LB_RecordMeasuredCost();
+#     endif
+
       if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
       {
          if ( MPI_Rank == 0 )
@@ -556,7 +682,7 @@ int main( int argc, char *argv[] )
 #        endif
          const int    AllLv            = -1;
 
-         LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv );
+         LB_Init_LoadBalance( Redistribute_Yes, OPT__LB_INCREMENTAL, ParWeight, ResetLB_Yes, AllLv );
 
          if ( OPT__PATCH_COUNT > 0 )         Aux_Record_PatchCount();
 
@@ -572,7 +698,16 @@ int main( int argc, char *argv[] )
 //    ---------------------------------------------------------------------------------------------------
 
 
-//    7. record timing
+//    7. reorder the particle repository by patches
+//    ---------------------------------------------------------------------------------------------------
+#     ifdef PARTICLE
+      if ( amr->Par->SortInterval > 0  &&  Step % amr->Par->SortInterval == 0 )
+      TIMING_FUNC(   Par_SortByPatch(),               Timer_Main[4],   TIMER_ON   );
+#     endif
+//    ---------------------------------------------------------------------------------------------------
+
+
+//    8. record timing
 //    ---------------------------------------------------------------------------------------------------
 #     ifdef TIMING
       MPI_Barrier( MPI_COMM_WORLD );
@@ -583,6 +718,12 @@ int main( int argc, char *argv[] )
       if ( OPT__RECORD_PERFORMANCE )
       Aux_Record_Performance( Timer_Main[0]->GetValue() );
 
+      if ( OPT__RECORD_TELEMETRY > 0  &&  Step % OPT__RECORD_TELEMETRY == 0 )
+      Aux_Record_Telemetry( Timer_Main[0]->GetValue() );
+
+      if ( OPT__RECORD_PATCH_COST )
+      Aux_Record_PatchCost();
+
       Aux_Record_Timing();
 
       Aux_ResetTimer();
@@ -9,8 +9,11 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                            const long TVarFC, const int NVarFC_Tot, const int TVarFCIdxList[],
                            const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                            const int BC_Face[], const real MinPres, const bool DE_Consistency,
-                           const real *FInterface[6] );
+                           const real *FInterface[6], const bool FluIntTimeLazy );
 static void SetTargetSibling( int NTSib[], int *TSib[] );
+#ifdef PARTICLE
+static void ParMassAssignment_RhoExt( const int lv, const int PID, const double PrepTime, const bool ManyParOnly );
+#endif
 static int Table_01( const int SibID, const char dim, const int Count, const int GhostSize );
 static int Table_02( const int lv, const int PID, const int Side );
 void SetTempIntPara( const int lv, const int Sg_Current, const double PrepTime, const double Time0, const double Time1,
@@ -29,6 +32,22 @@ bool ParDensArray_Initialized = false;
 #endif
 
 
+// time stamp of the particle density stored in rho_ext[] for PAR_DENS_CACHE
+// --> one entry for each level recording the options of the deposit still stored in rho_ext[]
+// --> an entry is reused as long as no particle has been moved since then (i.e., no call to
+//     Prepare_PatchData_InvalidateParticleDensityArray())
+#ifdef PARTICLE
+struct DensCache_t
+{
+   bool   Valid;
+   bool   PredictPos;
+   double PrepTime;
+};
+
+static DensCache_t DensCache[NLEVEL];
+#endif
+
+
 // check the divergence-free B field (for debug)
 #ifdef MHD
 //#  define MHD_CHECK_DIV_B
@@ -46,6 +65,35 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 #endif // MHD
 
 
+// ghost-zone cache for OPT__GHOST_CACHE
+// --> one entry for each sibling direction of each patch group storing the latest result of InterpolateGhostZone()
+// --> an entry is reused only if all the parameters affecting the interpolation are identical and the coarse-grid
+//     data have not been modified since then (i.e., GhostCache_Gen[lv-1] is unchanged)
+struct GhostCache_t
+{
+   real       *Data;         // interpolated cell-centered data
+   int         Size;         // allocated number of elements in Data[]
+   long        Gen;          // GhostCache_Gen[lv-1] when this entry was filled (-1 --> empty)
+   int         FaSibPID;     // coarse-grid patch used for interpolation
+   int         Corner[3];    // corner of the target patch group (to detect any change of the patch topology)
+   double      PrepTime;
+   long        TVarCC;
+   int         GhostSize;
+   IntScheme_t IntScheme;
+   bool        IntPhase;
+   real        MinPres;
+   bool        DE_Consistency;
+   int         BC;           // FluBC[] and PotBC packed into a single integer
+};
+
+static GhostCache_t *GhostCache    [NLEVEL] = { NULL };
+static int           GhostCache_NPG[NLEVEL] = { 0 };
+static long          GhostCache_Gen[NLEVEL] = { 0 };
+
+static void GhostCache_Allocate( const int lv );
+static void SetFluSgSame( const int lv );
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -81,6 +129,8 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                   --> Before calling this function, one must call
 //                       (1) Par_CollectParticle2OneLevel() --> to collect particles from higher levels and from other MPI ranks
 //                       (2) Prepare_PatchData_InitParticleDensityArray() --> to initialize all rho_ext[] arrays
+//                           --> For PAR_DENS_CACHE, rho_ext[] deposited by the previous call at the same level and
+//                               time is reused (see Prepare_PatchData_InitParticleDensityArray())
 //                   --> After calling this function, one must call the following two functions to free memory
 //                       (1) Par_CollectParticle2OneLevel_FreeMemory()
 //                       (2) Prepare_PatchData_FreeParticleDensityArray()
@@ -96,6 +146,12 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                            field on the coarse-fine interfaces of the central patch group
 //                        --> It's OK for the MHD solver since it will still guarantee that the updated B field within the patch group
 //                            is divergence free
+//                11. For OPT__PREP_COST_ORDER, patch groups are prepared in descending order of their cost measured by the
+//                    previous call (i.e., patch_t::Prep_Cost) and distributed to threads dynamically
+//                    --> Expensive patch groups (e.g., those adjacent to coarse-fine boundaries) no longer end up at the
+//                        tail of the loop and leave the other threads idle
+//                    --> Patch groups without measurement (e.g., newly created ones) assume the average cost
+//                    --> Does not affect the prepared data
 //
 // Parameter   :  lv             : Target refinement level
 //                PrepTime       : Target physical time to prepare data
@@ -269,6 +325,10 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
       if ( ! ParDensArray_Initialized )
          Aux_Error( ERROR_INFO, "please call \"Prepare_PatchData_InitParticleDensityArray\" in advance !!\n" );
+
+      if ( DensCache[lv].Valid  &&  PrepTime != DensCache[lv].PrepTime )
+         Aux_Error( ERROR_INFO, "PrepTime (%20.14e) != time of the cached particle density (%20.14e) at level %d !!\n",
+                    PrepTime, DensCache[lv].PrepTime, lv );
    }
 
 // _DENS, _PAR_DENS, and _TOTAL_DENS do not work together (actually we should be able to support _DENS + _PAR_DENS)
@@ -335,10 +395,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 // TVarCCIdxList_Flu: list recording the target cell-centered fluid and passive variable indices (e.g., [0 ... NCOMP_TOTAL-1] )
 // TVarCCList_Der   : list recording the target cell-centered derived variable (e.g., _VELX, _PRES)
 // TVarFCIdxList    : list recording the target face-centered variable indices (e.g., [0 ... NCOMP_MAG-1])
-   int NTSib[26], *TSib[26], NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
+   int NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
 
 // set up the target sibling indices for InterpolateGhostZone()
-   SetTargetSibling( NTSib, TSib );
+// --> they never change so we set them only once (the initialization of a local static variable is thread-safe,
+//     which is necessary since this function may be invoked by multiple threads)
+   static int  NTSib[26], *TSib[26];
+   static bool TSib_Initialized = ( SetTargetSibling( NTSib, TSib ), true );
 
 // determine the cell-centered fluid components to be prepared
 // --> assuming that _VAR_NAME = 1L<<VAR_NAME (e.g., _DENS == 1L<<DENS)
@@ -500,6 +563,24 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
    }
 
 
+// gather plan shared by all steps below
+// --> SibPID0_List[TID*26+Side]: the 0th patch of the sibling patch group of PID0_List[TID] along Side
+//     (-1 --> requires interpolation; <= SIB_OFFSET_NONPERIODIC --> outside the non-periodic boundaries)
+// --> Disp_Sib[Side][Count][d]: displacement of the Count-th sibling patch along Side in Data1PG_CC[]
+// --> set them once here instead of re-deriving them for each patch group and for each use
+   int *SibPID0_List = new int [ NPG*26 ];
+   int  Disp_Sib[26][4][3];
+
+   for (int TID=0; TID<NPG; TID++)
+   for (int Side=0; Side<26; Side++)
+      SibPID0_List[ TID*26 + Side ] = Table_02( lv, PID0_List[TID], Side );
+
+   for (int Side=0; Side<26; Side++)
+   for (int Count=0; Count<TABLE_04( Side ); Count++)
+   for (int d=0; d<3; d++)
+      Disp_Sib[Side][Count][d] = Table_01( Side, 'x'+d, Count, GhostSize );
+
+
 // determine the patch list for assigning particle mass
 #  ifdef PARTICLE
    const int NNearByPatchMax   = 64;   // maximum number of neaby patches of a patch group (including 8 local patches)
@@ -510,13 +591,10 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
    int  ParMass_NPatch;
 
 // constant settings related to particle mass assignment
-   const bool InitZero_Yes     = true;
    const bool InitZero_No      = false;
-   const bool Periodic_No[3]   = { false, false, false };
    const bool Periodic_Check[3]= { FluBC[0]==BC_FLU_PERIODIC, FluBC[2]==BC_FLU_PERIODIC, FluBC[4]==BC_FLU_PERIODIC };
    const bool UnitDens_No      = false;
    const bool CheckFarAway_Yes = true;
-   const bool CheckFarAway_No  = false;
    const int  PeriodicNCell[3] = { NX0_TOT[0]*(1<<lv),
                                    NX0_TOT[1]*(1<<lv),
                                    NX0_TOT[2]*(1<<lv) };
@@ -539,7 +617,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
          if ( amr->Par->GhostSize > 0  ||  GhostSize > 0  ||  amr->Par->PredictPos )
          for (int Side=0; Side<26; Side++)
          {
-            const int SibPID0 = Table_02( lv, PID0_List[TID], Side );   // the 0th patch of the sibling patch group
+            const int SibPID0 = SibPID0_List[ TID*26 + Side ];   // the 0th patch of the sibling patch group
 
             if ( SibPID0 >= 0 )
             {
@@ -608,10 +686,89 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
          if ( amr->patch[0][lv][TPID]->rho_ext == NULL )    amr->patch[0][lv][TPID]->dnew();
       }
 
+
+//    deposit particle mass for patches with NPar >= PAR_DEPOSIT_NPAR_THREAD one at a time, for which
+//    Par_MassAssignment() splits the particles across all OpenMP threads
+//    --> all other patches are done in the OpenMP parallel region below
+      if ( amr->Par->DepositNParThread > 0 )
+      for (int t=0; t<ParMass_NPatch; t++)
+         ParMassAssignment_RhoExt( lv, ParMass_PID_List[t], PrepTime, true );
+
    } //if ( PrepParOnlyDens || PrepTotalDens )
 #  endif // #ifdef PARTICLE
 
 
+// whether or not to reuse the interpolated ghost zones of previous calls
+// --> the face-centered interpolation depends on the fine-grid B field on the coarse-fine interfaces and the
+//     particle density depends on the temporary rho_ext[] arrays, both of which are not tracked by GhostCache_Gen[]
+   bool UseGhostCache = ( OPT__GHOST_CACHE  &&  lv > 0  &&  GhostSize > 0  &&  NVarFC_Tot == 0 );
+#  ifdef PARTICLE
+   if ( PrepParOnlyDens || PrepTotalDens )   UseGhostCache = false;
+#  endif
+
+// the cache cannot be resized safely when this function is invoked by multiple threads (e.g., Poi_StorePotWithGhostZone())
+#  ifdef OPENMP
+   if ( omp_in_parallel() )   UseGhostCache = false;
+#  endif
+
+   int GhostCache_BC = PotBC;
+   for (int f=0; f<6; f++)    GhostCache_BC = GhostCache_BC*8 + FluBC[f];
+
+   if ( UseGhostCache )    GhostCache_Allocate( lv );
+
+
+// whether or not to skip the temporal interpolation of fluid for the coarse-grid patches with identical sandglasses
+// --> update patch_t::FluSgSame at lv-1 here since it cannot be done by multiple threads
+   bool FluIntTimeLazy = ( OPT__INT_TIME  &&  OPT__INT_TIME_LAZY  &&  lv > 0  &&  GhostSize > 0  &&
+                           NVarCC_Flu+NVarCC_Der > 0 );
+#  ifdef OPENMP
+   if ( omp_in_parallel() )   FluIntTimeLazy = false;
+#  endif
+
+   if ( FluIntTimeLazy )   SetFluSgSame( lv-1 );
+
+
+// order the patch groups by their measured cost in descending order for OPT__PREP_COST_ORDER
+// --> the OpenMP loop below adopts the runtime schedule, which is set to dynamic by Init_OpenMP()
+   bool PrepCostOrder = ( OPT__PREP_COST_ORDER  &&  NPG > 1 );
+#  ifdef OPENMP
+   if ( omp_in_parallel() )   PrepCostOrder = false;
+#  endif
+
+   int *PrepOrder = NULL;
+
+   if ( PrepCostOrder )
+   {
+      real *PrepCost = new real [NPG];
+      int  *IdxTable = new int  [NPG];
+      real  CostSum  = (real)0.0;
+      int   NCost    = 0;
+
+      for (int TID=0; TID<NPG; TID++)
+      {
+         PrepCost[TID] = amr->patch[0][lv][ PID0_List[TID] ]->Prep_Cost;
+
+         if ( PrepCost[TID] >= (real)0.0 )   {  CostSum += PrepCost[TID];  NCost ++;  }
+      }
+
+      if ( NCost > 0 )
+      {
+         const real CostMean = CostSum / NCost;
+
+         for (int TID=0; TID<NPG; TID++)
+            if ( PrepCost[TID] < (real)0.0 )    PrepCost[TID] = CostMean;
+
+         Mis_Heapsort( NPG, PrepCost, IdxTable );
+
+         PrepOrder = new int [NPG];
+         for (int t=0; t<NPG; t++)  PrepOrder[t] = IdxTable[ NPG-1-t ];
+      }
+
+      delete [] PrepCost;
+      delete [] IdxTable;
+   } // if ( PrepCostOrder )
+
+
 // start to prepare data
 #  pragma omp parallel
    {
@@ -655,93 +812,14 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //    assign particle mass onto grids
+//    --> patches with NPar >= PAR_DEPOSIT_NPAR_THREAD have been done before entering this parallel region
 #     ifdef PARTICLE
       if ( PrepParOnlyDens || PrepTotalDens )
       {
-//       thread-private variables
-         long  *ParList = NULL;
-         int    NPar, PID;
-         double EdgeL[3];
-         bool   UseInputMassPos;
-         real **InputMassPos = NULL;
-
 #        pragma omp for schedule( runtime )
          for (int t=0; t<ParMass_NPatch; t++)
-         {
-            PID = ParMass_PID_List[t];
-
-#           ifdef DEBUG_PARTICLE
-            if ( amr->patch[0][lv][PID]->rho_ext == NULL  ||
-                 amr->patch[0][lv][PID]->rho_ext[0][0][0] != RHO_EXT_NEED_INIT )
-               Aux_Error( ERROR_INFO, "lv %d, PID %d, rho_ext == NULL (or has been calculated already) !!\n", lv, PID );
-#           endif
-
-//          determine the number of particles and the particle list
-            if ( amr->patch[0][lv][PID]->son == -1  &&  PID < amr->NPatchComma[lv][1] )
-            {
-               NPar            = amr->patch[0][lv][PID]->NPar;
-               ParList         = amr->patch[0][lv][PID]->ParList;
-               UseInputMassPos = false;
-               InputMassPos    = NULL;
-
-#              ifdef DEBUG_PARTICLE
-               if ( amr->patch[0][lv][PID]->NPar_Copy != -1 )
-                  Aux_Error( ERROR_INFO, "lv %d, PID %d, NPar_Copy = %d != -1 !!\n",
-                             lv, PID, amr->patch[0][lv][PID]->NPar_Copy );
-#              endif
-            }
-
-            else
-            {
-//             note that amr->patch[0][lv][PID]->NPar>0 is still possible
-               NPar            = amr->patch[0][lv][PID]->NPar_Copy;
-#              ifdef LOAD_BALANCE
-               ParList         = NULL;
-               UseInputMassPos = true;
-               InputMassPos    = amr->patch[0][lv][PID]->ParMassPos_Copy;
-#              else
-               ParList         = amr->patch[0][lv][PID]->ParList_Copy;
-               UseInputMassPos = false;
-               InputMassPos    = NULL;
-#              endif
-            }
-
-#           ifdef DEBUG_PARTICLE
-            if ( NPar <= 0 )
-               Aux_Error( ERROR_INFO, "NPar (%d) <= 0 (lv %d, PID %d) !!\n", NPar, lv, PID );
-
-            else
-            {
-               if ( UseInputMassPos )
-               {
-                  for (int v=0; v<4; v++)
-                  if ( InputMassPos[v] == NULL )
-                  Aux_Error( ERROR_INFO, "InputMassPos[%d] == NULL for NPar (%d) > 0 (lv %d, PID %d) !!\n",
-                             v, NPar, lv, PID );
-               }
-
-               else if ( ParList == NULL )
-               Aux_Error( ERROR_INFO, "ParList == NULL for NPar (%d) > 0 (lv %d, PID %d) !!\n",
-                          NPar, lv, PID );
-            }
-#           endif // #ifdef DEBUG_PARTICLE
-
-//          set the left edge of rho_ext[]
-            const double RhoExtGhostPhySize = RHOEXT_GHOST_SIZE*dh;
-            for (int d=0; d<3; d++)    EdgeL[d] = amr->patch[0][lv][PID]->EdgeL[d] - RhoExtGhostPhySize;
-
-
-//          deposit particle mass onto grids (**from particles in their home patch**)
-//          --> don't have to worry about the periodicity (even for external buffer patches) here since
-//              (1) all input particles should be close to the target patches even with position prediction
-//              (2) amr->patch[0][lv][PID]->EdgeL/R already assumes periodicity for external buffer patches
-//              --> Periodic_No, CheckFarAway_No
-//          --> remember to initialize rho_ext[] as zero (by InitZero_Yes)
-            Par_MassAssignment( ParList, NPar, amr->Par->Interp, amr->patch[0][lv][PID]->rho_ext[0][0], RHOEXT_NXT,
-                                EdgeL, dh, (amr->Par->PredictPos && !UseInputMassPos), PrepTime, InitZero_Yes,
-                                Periodic_No, NULL, UnitDens_No, CheckFarAway_No, UseInputMassPos, InputMassPos );
-         } // for (int t=0; t<ParMass_NPatch; t++)
-      } // if ( PrepParOnlyDens || PrepTotalDens )
+            ParMassAssignment_RhoExt( lv, ParMass_PID_List[t], PrepTime, false );
+      }
 #     endif // #ifdef PARTICLE
 
 
@@ -751,9 +829,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //    prepare eight nearby patches (one patch group) at a time
-#     pragma omp for schedule( runtime )
-      for (int TID=0; TID<NPG; TID++)
+//    --> nowait since there is nothing to synchronize before the end of the parallel region
+//        --> also allows THREAD_TIMER_STOP() to measure the busy time of each thread
+      THREAD_TIMER_START();
+
+#     pragma omp for schedule( runtime ) nowait
+      for (int Order=0; Order<NPG; Order++)
       {
+         const int  TID         = ( PrepOrder == NULL ) ? Order : PrepOrder[Order];
+         const long PrepCost_T0 = ( PrepCostOrder ) ? ThreadTimer_t::GetNanoSec() : 0L;
+
          PID0 = PID0_List[TID];
 
 #        ifdef GAMER_DEBUG
@@ -787,6 +872,12 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             Data1PG_FC_Ptr = Data1PG_FC;
 
 //          (a1) fluid data (cell-centered)
+//               --> copy each row of PS1 cells as a whole since both the source and target rows are contiguous
+//                   (the eight patches of a patch group are also adjacent in memory for OPT__PATCH_ARENA)
+//               --> FluSg and FluIntTime are set only when fluid data are requested
+            const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Flu > 0               ) ? amr->patch[FluSg     ][lv][PID]->fluid : NULL;
+            const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Flu > 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][PID]->fluid : NULL;
+
             for (int v=0; v<NVarCC_Flu; v++)
             {
                TVarCCIdx_Flu = TVarCCIdxList_Flu[v];
@@ -794,15 +885,17 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                for (int k=0; k<PS1; k++)  {  K    = k + Disp_k;
                for (int j=0; j<PS1; j++)  {  J    = j + Disp_j;
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
-               for (int i=0; i<PS1; i++)  {
-
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][PID]->fluid[TVarCCIdx_Flu][k][j][i];
 
                   if ( FluIntTime ) // temporal interpolation
-                  Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][PID]->fluid[TVarCCIdx_Flu][k][j][i];
-                  Idx1 ++;
-               }}}
+                  {
+                     for (int i=0; i<PS1; i++)
+                        Data1PG_CC_Ptr[ Idx1 + i ] =   FluWeighting     *Fluid     [TVarCCIdx_Flu][k][j][i]
+                                                     + FluWeighting_IntT*Fluid_IntT[TVarCCIdx_Flu][k][j][i];
+                  }
+
+                  else
+                     memcpy( Data1PG_CC_Ptr + Idx1, Fluid[TVarCCIdx_Flu][k][j], PS1*sizeof(real) );
+               }}
 
                Data1PG_CC_Ptr += PGSize3D_CC;
             }
@@ -1054,7 +1147,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             if ( GhostSize == 0 )   break;
 
 
-            const int SibPID0 = Table_02( lv, PID0, Side );    // the 0th patch of the sibling patch group
+            const int SibPID0 = SibPID0_List[ TID*26 + Side ];    // the 0th patch of the sibling patch group
 
 //          (b1) if the target sibling patch exists --> just copy data from the nearby patches at the same level
             if ( SibPID0 >= 0 )
@@ -1072,13 +1165,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                   const int LocalID = TABLE_03( Side, Count );
                   const int SibPID  = SibPID0 + LocalID;
 
-                  int disp[3];
-                  for (int d=0; d<3; d++)    disp[d] = Table_01( Side, 'x'+d, Count, GhostSize );
+                  const int *disp = Disp_Sib[Side][Count];
 
                   Data1PG_CC_Ptr = Data1PG_CC;
                   Data1PG_FC_Ptr = Data1PG_FC;
 
 //                (b1-1) fluid data (cell-centered)
+//                       --> copy each row of loop[0] cells as a whole as step (a1)
+                  const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Flu > 0               ) ? amr->patch[FluSg     ][lv][SibPID]->fluid : NULL;
+                  const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Flu > 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][SibPID]->fluid : NULL;
+
                   for (int v=0; v<NVarCC_Flu; v++)
                   {
                      TVarCCIdx_Flu = TVarCCIdxList_Flu[v];
@@ -1086,17 +1182,18 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                      for (int k=0; k<loop[2]; k++)  { K = k + disp[2];   K2 = k + disp2[2];
                      for (int j=0; j<loop[1]; j++)  { J = j + disp[1];   J2 = j + disp2[1];
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
-                     for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
-
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][SibPID]->fluid[TVarCCIdx_Flu][K2][J2][I2];
 
                         if ( FluIntTime ) // temporal interpolation
-                        Data1PG_CC_Ptr[Idx1] =
-                           FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                         + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][SibPID]->fluid[TVarCCIdx_Flu][K2][J2][I2];
+                        {
+                           for (int i=0; i<loop[0]; i++)
+                              Data1PG_CC_Ptr[ Idx1 + i ] =
+                                 FluWeighting     *Fluid     [TVarCCIdx_Flu][K2][J2][ disp2[0] + i ]
+                               + FluWeighting_IntT*Fluid_IntT[TVarCCIdx_Flu][K2][J2][ disp2[0] + i ];
+                        }
 
-                        Idx1 ++;
-                     }}}
+                        else
+                           memcpy( Data1PG_CC_Ptr + Idx1, Fluid[TVarCCIdx_Flu][K2][J2] + disp2[0], loop[0]*sizeof(real) );
+                     }}
 
                      Data1PG_CC_Ptr += PGSize3D_CC;
                   }
@@ -1356,7 +1453,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             if ( GhostSize == 0 )   break;
 
 
-            const int SibPID0 = Table_02( lv, PID0, Side );    // the 0th patch of the sibling patch group
+            const int SibPID0 = SibPID0_List[ TID*26 + Side ];    // the 0th patch of the sibling patch group
 
 //          (b2) if the target sibling patch does not exist --> interpolate from patches at level lv-1
             if ( SibPID0 == -1 )
@@ -1396,11 +1493,61 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //             (b2-3) perform interpolation and store the results in IntData_CC[] and IntData_FC[]
-               InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, Side, PrepTime, GhostSize,
-                                     IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
-                                     TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
-                                     IntPhase, FluBC, PotBC, BC_Face, MinPres, DE_Consistency,
-                                     (const real **)FInterface_Ptr );
+//             --> copy the result of an identical previous interpolation directly if OPT__GHOST_CACHE is on
+//             --> each entry is accessed by only one thread since different threads work on different patch groups
+               GhostCache_t *Cache      = ( UseGhostCache ) ? GhostCache[lv] + (PID0/8)*26 + Side : NULL;
+               const int     IntSize_CC = NVarCC_Tot*FSize[0]*FSize[1]*FSize[2];
+               const int    *Corner     = amr->patch[0][lv][PID0]->corner;
+
+               if ( Cache != NULL  &&  Cache->Gen == GhostCache_Gen[lv-1]  &&  Cache->FaSibPID == FaSibPID  &&
+                    Cache->Corner[0] == Corner[0]  &&  Cache->Corner[1] == Corner[1]  &&  Cache->Corner[2] == Corner[2]  &&
+                    Cache->PrepTime == PrepTime  &&  Cache->TVarCC == TVarCC  &&  Cache->GhostSize == GhostSize  &&
+                    Cache->IntScheme == IntScheme_CC  &&  Cache->IntPhase == IntPhase  &&  Cache->MinPres == MinPres  &&
+                    Cache->DE_Consistency == DE_Consistency  &&  Cache->BC == GhostCache_BC )
+                  memcpy( IntData_CC, Cache->Data, IntSize_CC*sizeof(real) );
+
+               else
+               {
+#                 ifdef TIMING
+                  const long PatchCost_T0 = ( OPT__RECORD_PATCH_COST ) ? ThreadTimer_t::GetNanoSec() : 0L;
+#                 endif
+
+                  InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, Side, PrepTime, GhostSize,
+                                        IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
+                                        TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
+                                        IntPhase, FluBC, PotBC, BC_Face, MinPres, DE_Consistency,
+                                        (const real **)FInterface_Ptr, FluIntTimeLazy );
+
+#                 ifdef TIMING
+                  if ( OPT__RECORD_PATCH_COST )
+                     Aux_PatchCost_Add( PATCH_COST_INTERP, lv, 1, ThreadTimer_t::GetNanoSec()-PatchCost_T0 );
+#                 endif
+
+                  if ( Cache != NULL )
+                  {
+                     if ( Cache->Size < IntSize_CC )
+                     {
+                        delete [] Cache->Data;
+                        Cache->Data = new real [IntSize_CC];
+                        Cache->Size = IntSize_CC;
+                     }
+
+                     memcpy( Cache->Data, IntData_CC, IntSize_CC*sizeof(real) );
+
+                     Cache->Gen            = GhostCache_Gen[lv-1];
+                     Cache->FaSibPID       = FaSibPID;
+                     for (int d=0; d<3; d++)
+                     Cache->Corner[d]      = Corner[d];
+                     Cache->PrepTime       = PrepTime;
+                     Cache->TVarCC         = TVarCC;
+                     Cache->GhostSize      = GhostSize;
+                     Cache->IntScheme      = IntScheme_CC;
+                     Cache->IntPhase       = IntPhase;
+                     Cache->MinPres        = MinPres;
+                     Cache->DE_Consistency = DE_Consistency;
+                     Cache->BC             = GhostCache_BC;
+                  }
+               } // if ( Cache != NULL  &&  ... ) ... else ...
 
 
 //             (b2-4) copy cell-centered data from IntData_CC[] to Data1PG_CC[]
@@ -1682,7 +1829,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             if ( amr->Par->GhostSize > 0  ||  GhostSize > 0  ||  amr->Par->PredictPos )
             for (int Side=0; Side<26; Side++)
             {
-               const int SibPID0 = Table_02( lv, PID0, Side );    // the 0th patch of the sibling patch group
+               const int SibPID0 = SibPID0_List[ TID*26 + Side ];    // the 0th patch of the sibling patch group
 
 //             (c3-1) if the target sibling patch exists --> loop over nearby patches at the same level
                if ( SibPID0 >= 0 )
@@ -1938,7 +2085,14 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             } // for (int LocalID=0; LocalID<8; LocalID++)
          } // if ( PrepUnit == UNIT_PATCH )
 
-      } // for (int TID=0; TID<NPG; TID++)
+
+//       record the cost of this patch group for the next call
+         if ( PrepCostOrder )
+            amr->patch[0][lv][PID0]->Prep_Cost = (real)( ThreadTimer_t::GetNanoSec() - PrepCost_T0 );
+
+      } // for (int Order=0; Order<NPG; Order++)
+
+      THREAD_TIMER_STOP();
 
       if ( PrepUnit == UNIT_PATCH )
       {
@@ -1956,7 +2110,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 // free memroy
-   for (int s=0; s<26; s++)   delete [] TSib[s];
+   delete [] SibPID0_List;
+   delete [] PrepOrder;
 
 #  ifdef PARTICLE
    if ( PrepParOnlyDens || PrepTotalDens )   delete [] ParMass_PID_List;
@@ -2397,7 +2552,8 @@ int Table_02( const int lv, const int PID, const int Side )
 // Description :  Set the target sibling directions for preparing the ghost-zone data at the coarse-grid level
 //
 // Note        :  1. Work for Prepare_PatchData()
-//                2. TSib needs to be deallocated manually
+//                2. TSib is allocated here and kept until the end of the program since Prepare_PatchData()
+//                   sets it only once
 //                3. Sibling directions recorded in TSib must be in ascending numerical order for filling the
 //                   non-periodic ghost-zone data in InterpolateGhostZone()
 //                   --> Therefore, this function CANNOT be applied in LB_RecordExchangeDataPatchID(), in which
@@ -2735,22 +2891,290 @@ void SetTargetSibling( int NTSib[], int *TSib[] )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GhostCache_Allocate
+// Description :  Allocate the ghost-zone cache entries for all real patch groups at the target level
+//
+// Note        :  1. Invoked by Prepare_PatchData() when OPT__GHOST_CACHE is on
+//                2. Existing entries are kept so that the cache can grow with the number of patches
+//                3. Must be called outside any OpenMP parallel region
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void GhostCache_Allocate( const int lv )
+{
+
+   const int NPG = amr->NPatchComma[lv][1] / 8;
+
+   if ( NPG <= GhostCache_NPG[lv] )    return;
+
+   GhostCache_t *NewCache = new GhostCache_t [ NPG*26 ];
+
+   for (int t=0; t<GhostCache_NPG[lv]*26; t++)  NewCache[t] = GhostCache[lv][t];
+
+   for (int t=GhostCache_NPG[lv]*26; t<NPG*26; t++)
+   {
+      NewCache[t].Data = NULL;
+      NewCache[t].Size = 0;
+      NewCache[t].Gen  = -1;
+   }
+
+   delete [] GhostCache[lv];
+
+   GhostCache    [lv] = NewCache;
+   GhostCache_NPG[lv] = NPG;
+
+} // FUNCTION : GhostCache_Allocate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_InvalidateGhostCache
+// Description :  Invalidate all ghost-zone cache entries interpolated from the data at the target level
+//
+// Note        :  1. Must be called whenever the fluid or potential data at level "lv" (including the buffer
+//                   patches) are modified
+//                   --> Currently invoked by Buf_GetBufferData(), LB_GetBufferData(), and Refine()
+//                   --> Since any modification of the data at lv must be followed by the exchange of the buffer
+//                       data before the next Prepare_PatchData() at lv+1, it suffices to invoke it there
+//                2. Entries are invalidated by increasing the generation counter of level "lv" so that
+//                   no memory is freed here
+//
+// Parameter   :  lv : Target refinement level whose data have been modified
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_InvalidateGhostCache( const int lv )
+{
+
+   GhostCache_Gen[lv] ++;
+
+} // FUNCTION : Prepare_PatchData_InvalidateGhostCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_FreeGhostCache
+// Description :  Free all ghost-zone cache entries of the target level
+//
+// Note        :  1. Invoked by Refine() when the patches at lv are reconstructed, LB_Init_LoadBalance(),
+//                   and End_MemFree()
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_FreeGhostCache( const int lv )
+{
+
+   for (int t=0; t<GhostCache_NPG[lv]*26; t++)  delete [] GhostCache[lv][t].Data;
+
+   delete [] GhostCache[lv];
+
+   GhostCache    [lv] = NULL;
+   GhostCache_NPG[lv] = 0;
+
+} // FUNCTION : Prepare_PatchData_FreeGhostCache
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetFluSgSame
+// Description :  Record whether the two fluid sandglasses of each patch at the target level store bitwise
+//                identical data
+//
+// Note        :  1. Invoked by Prepare_PatchData() when OPT__INT_TIME_LAZY is on
+//                   --> Results are stored in amr->patch[0][lv][PID]->FluSgSame and used by InterpolateGhostZone()
+//                       to skip the temporal interpolation of these patches
+//                2. Results are reused until either GhostCache_Gen[lv] or FluSgTime[lv][0/1] changes
+//                   --> Same assumption as OPT__GHOST_CACHE (see Prepare_PatchData_InvalidateGhostCache())
+//                3. Apply to both real and buffer patches since both can be used for interpolation
+//                4. Must be called outside any OpenMP parallel region
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void SetFluSgSame( const int lv )
+{
+
+   static bool   Initialized[NLEVEL] = { false };
+   static long   Gen        [NLEVEL];
+   static double SgTime     [NLEVEL][2];
+
+   if ( Initialized[lv]  &&  Gen[lv] == GhostCache_Gen[lv]  &&
+        SgTime[lv][0] == amr->FluSgTime[lv][0]  &&  SgTime[lv][1] == amr->FluSgTime[lv][1] )
+      return;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   {
+      const real (*Flu0)[PS1][PS1][PS1] = amr->patch[0][lv][PID]->fluid;
+      const real (*Flu1)[PS1][PS1][PS1] = amr->patch[1][lv][PID]->fluid;
+
+      amr->patch[0][lv][PID]->FluSgSame = ( Flu0 != NULL  &&  Flu1 != NULL  &&
+                                            memcmp( Flu0, Flu1, NCOMP_TOTAL*CUBE(PS1)*sizeof(real) ) == 0 );
+   }
+
+   Initialized[lv] = true;
+   Gen        [lv] = GhostCache_Gen[lv];
+   SgTime  [lv][0] = amr->FluSgTime[lv][0];
+   SgTime  [lv][1] = amr->FluSgTime[lv][1];
+
+} // FUNCTION : SetFluSgSame
+
+
+
 #ifdef PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ParMassAssignment_RhoExt
+// Description :  Deposit the mass of particles in the target patch onto its rho_ext[]
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. Only particles in their home patch (or the copied particles from its descendants) are deposited
+//                3. Patches with NPar >= PAR_DEPOSIT_NPAR_THREAD are deposited before entering the OpenMP parallel
+//                   region of Prepare_PatchData() so that Par_MassAssignment() can split their particles across
+//                   all threads
+//                   --> ManyParOnly == true : only deposit patches with NPar >= PAR_DEPOSIT_NPAR_THREAD
+//                                      false: only deposit patches with NPar <  PAR_DEPOSIT_NPAR_THREAD
+//
+// Parameter   :  lv          : Target refinement level
+//                PID         : Target patch index
+//                PrepTime    : Target physical time for predicting the particle position
+//                ManyParOnly : See Note 3
+//-------------------------------------------------------------------------------------------------------
+void ParMassAssignment_RhoExt( const int lv, const int PID, const double PrepTime, const bool ManyParOnly )
+{
+
+   const double dh              = amr->dh[lv];
+   const bool   InitZero_Yes    = true;
+   const bool   Periodic_No[3]  = { false, false, false };
+   const bool   UnitDens_No     = false;
+   const bool   CheckFarAway_No = false;
+
+   long  *ParList = NULL;
+   int    NPar;
+   double EdgeL[3];
+   bool   UseInputMassPos;
+   real **InputMassPos = NULL;
+
+
+// determine the number of particles and the particle list
+   if ( amr->patch[0][lv][PID]->son == -1  &&  PID < amr->NPatchComma[lv][1] )
+   {
+      NPar            = amr->patch[0][lv][PID]->NPar;
+      ParList         = amr->patch[0][lv][PID]->ParList;
+      UseInputMassPos = false;
+      InputMassPos    = NULL;
+
+#     ifdef DEBUG_PARTICLE
+      if ( amr->patch[0][lv][PID]->NPar_Copy != -1 )
+         Aux_Error( ERROR_INFO, "lv %d, PID %d, NPar_Copy = %d != -1 !!\n",
+                    lv, PID, amr->patch[0][lv][PID]->NPar_Copy );
+#     endif
+   }
+
+   else
+   {
+//    note that amr->patch[0][lv][PID]->NPar>0 is still possible
+      NPar            = amr->patch[0][lv][PID]->NPar_Copy;
+#     ifdef LOAD_BALANCE
+      ParList         = NULL;
+      UseInputMassPos = true;
+      InputMassPos    = amr->patch[0][lv][PID]->ParMassPos_Copy;
+#     else
+      ParList         = amr->patch[0][lv][PID]->ParList_Copy;
+      UseInputMassPos = false;
+      InputMassPos    = NULL;
+#     endif
+   }
+
+// skip patches not in the target category
+   const bool ManyPar = ( amr->Par->DepositNParThread > 0  &&  NPar >= amr->Par->DepositNParThread );
+
+   if ( ManyPar != ManyParOnly )    return;
+
+#  ifdef DEBUG_PARTICLE
+   if ( amr->patch[0][lv][PID]->rho_ext == NULL  ||
+        amr->patch[0][lv][PID]->rho_ext[0][0][0] != RHO_EXT_NEED_INIT )
+      Aux_Error( ERROR_INFO, "lv %d, PID %d, rho_ext == NULL (or has been calculated already) !!\n", lv, PID );
+
+   if ( NPar <= 0 )
+      Aux_Error( ERROR_INFO, "NPar (%d) <= 0 (lv %d, PID %d) !!\n", NPar, lv, PID );
+
+   else
+   {
+      if ( UseInputMassPos )
+      {
+         for (int v=0; v<4; v++)
+         if ( InputMassPos[v] == NULL )
+         Aux_Error( ERROR_INFO, "InputMassPos[%d] == NULL for NPar (%d) > 0 (lv %d, PID %d) !!\n",
+                    v, NPar, lv, PID );
+      }
+
+      else if ( ParList == NULL )
+      Aux_Error( ERROR_INFO, "ParList == NULL for NPar (%d) > 0 (lv %d, PID %d) !!\n",
+                 NPar, lv, PID );
+   }
+#  endif // #ifdef DEBUG_PARTICLE
+
+// set the left edge of rho_ext[]
+   const double RhoExtGhostPhySize = RHOEXT_GHOST_SIZE*dh;
+   for (int d=0; d<3; d++)    EdgeL[d] = amr->patch[0][lv][PID]->EdgeL[d] - RhoExtGhostPhySize;
+
+
+// deposit particle mass onto grids (**from particles in their home patch**)
+// --> don't have to worry about the periodicity (even for external buffer patches) here since
+//     (1) all input particles should be close to the target patches even with position prediction
+//     (2) amr->patch[0][lv][PID]->EdgeL/R already assumes periodicity for external buffer patches
+//     --> Periodic_No, CheckFarAway_No
+// --> remember to initialize rho_ext[] as zero (by InitZero_Yes)
+   Par_MassAssignment( ParList, NPar, amr->Par->Interp, amr->patch[0][lv][PID]->rho_ext[0][0], RHOEXT_NXT,
+                       EdgeL, dh, (amr->Par->PredictPos && !UseInputMassPos), PrepTime, InitZero_Yes,
+                       Periodic_No, NULL, UnitDens_No, CheckFarAway_No, UseInputMassPos, InputMassPos );
+
+} // FUNCTION : ParMassAssignment_RhoExt
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Prepare_PatchData_InitParticleDensityArray
 // Description :  Initialize rho_ext[] by setting rho_ext[0][0][0] = RHO_EXT_NEED_INIT
 //
-// Note        :  1. Currently this function is called by Gra_AdvanceDt(), Main(), and Output_DumpData_Total()
+// Note        :  1. Currently this function is called by Gra_AdvanceDt(), Output_DumpData_Total(),
+//                   Output_DumpData_Total_HDF5(), and Output_BasePowerSpectrum()
 //                2. Apply to all (real and buffer) patches with rho_ext[] allocated already
 //                3. Do nothing if rho_ext == NULL. In this case, rho_ext[] will be allocated and initialized
 //                   as rho_ext[0][0][0] == RHO_EXT_NEED_INIT when calling Prepare_PatchData()
 //                4. rho_ext[] is always stored in Sg==0
+//                5. For PAR_DENS_CACHE, rho_ext[] is NOT reset if it was deposited at the same PrepTime and with the
+//                   same PredictPos since the last particle update
+//                   --> Particle mass is deposited only once per level per time and shared by the Poisson solver
+//                       and the particle density outputs
+//                   --> Patches not deposited yet are still marked as RHO_EXT_NEED_INIT and will be deposited
+//                       by Prepare_PatchData() on demand
+//                   --> See Prepare_PatchData_InvalidateParticleDensityArray() for invalidating the cache
 //
-// Parameter   :  lv : Target refinement level
+// Parameter   :  lv         : Target refinement level
+//                PredictPos : PredictPos passed to Par_CollectParticle2OneLevel() for the same level
+//                             --> For LOAD_BALANCE, the positions of particles collected from other patches are
+//                                 predicted by Par_LB_CollectParticle2OneLevel() instead of Par_MassAssignment()
+//                PrepTime   : PrepTime passed to Prepare_PatchData() for the same level
 //-------------------------------------------------------------------------------------------------------
-void Prepare_PatchData_InitParticleDensityArray( const int lv )
+void Prepare_PatchData_InitParticleDensityArray( const int lv, const bool PredictPos, const double PrepTime )
 {
 
+// set flag to true to indicate that this function has been called
+   ParDensArray_Initialized = true;
+
+
+// reuse the cached particle density if applicable
+   if ( amr->Par->DensCache )
+   {
+      if ( DensCache[lv].Valid  &&  DensCache[lv].PredictPos == PredictPos  &&  DensCache[lv].PrepTime == PrepTime )
+         return;
+
+      DensCache[lv].Valid      = true;
+      DensCache[lv].PredictPos = PredictPos;
+      DensCache[lv].PrepTime   = PrepTime;
+   }
+
+
 // apply to buffer patches as well
    for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
    {
@@ -2758,9 +3182,6 @@ void Prepare_PatchData_InitParticleDensityArray( const int lv )
          amr->patch[0][lv][PID]->rho_ext[0][0][0] = RHO_EXT_NEED_INIT;
    }
 
-// set flag to true to indicate that this function has been called
-   ParDensArray_Initialized = true;
-
 } // FUNCTION : Prepare_PatchData_InitParticleDensityArray
 
 
@@ -2769,9 +3190,10 @@ void Prepare_PatchData_InitParticleDensityArray( const int lv )
 // Function    :  Prepare_PatchData_FreeParticleDensityArray
 // Description :  Free rho_ext[] allocated by Prepare_PatchData() temporarily for storing the partice mass density
 //
-// Note        :  1. Currently this function is called by Gra_AdvanceDt(), Main(), and Output_DumpData_Total()
+// Note        :  1. Currently this function is called by Gra_AdvanceDt(), Output_DumpData_Total(),
+//                   Output_DumpData_Total_HDF5(), and Output_BasePowerSpectrum()
 //                2. Apply to buffer patches as well
-//                3. Do not free memory if OPT__REUSE_MEMORY is on
+//                3. Do not free memory if OPT__REUSE_MEMORY or PAR_DENS_CACHE is on
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -2779,21 +3201,37 @@ void Prepare_PatchData_FreeParticleDensityArray( const int lv )
 {
 
 // free memory for all patches (both real and buffer) if OPT__REUSE_MEMORY is off
-   if ( ! OPT__REUSE_MEMORY )
+// --> keep rho_ext[] for PAR_DENS_CACHE
+   if ( ! OPT__REUSE_MEMORY  &&  ! amr->Par->DensCache )
    for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
    {
-      if ( amr->patch[0][lv][PID]->rho_ext != NULL )
-      {
-         delete [] amr->patch[0][lv][PID]->rho_ext;
-
-         amr->patch[0][lv][PID]->rho_ext = NULL;
-      }
+      if ( amr->patch[0][lv][PID]->rho_ext != NULL )   amr->patch[0][lv][PID]->ddelete();
    }
 
 // set flag to false to indicate that Prepare_PatchData_InitParticleDensityArray() has not been called
    ParDensArray_Initialized = false;
 
 } // FUNCTION : Prepare_PatchData_FreeParticleDensityArray
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_InvalidateParticleDensityArray
+// Description :  Invalidate the particle density cached in rho_ext[] for PAR_DENS_CACHE
+//
+// Note        :  1. Invoked by Par_CollectParticle2OneLevel_InvalidateCache(), which must be called before
+//                   moving, adding, or removing any particle and before modifying the patch hierarchy
+//                2. Apply to all levels
+//                3. rho_ext[] will be reset by the next call to Prepare_PatchData_InitParticleDensityArray()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_InvalidateParticleDensityArray()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)  DensCache[lv].Valid = false;
+
+} // FUNCTION : Prepare_PatchData_InvalidateParticleDensityArray
 #endif // #ifdef PARTICLE
 
 
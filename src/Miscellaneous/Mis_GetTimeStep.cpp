@@ -2,6 +2,9 @@
 
 extern double (*Mis_GetTimeStep_User_Ptr)( const int lv, const double dTime_dt );
 
+static double GetSubStepWork( const int lv, const double dTime );
+static double OptimizeSubStep( const int lv, const double dTime_CFL, const double dTime_SyncFaLv, int &NSubStep );
+
 
 
 
@@ -18,6 +21,10 @@ extern double (*Mis_GetTimeStep_User_Ptr)( const int lv, const double dTime_dt )
 //                       in the comoving coordinates, back to dt in EvolveLevel()
 //                2. For OPT__DT_USER, the function pointer "Mis_GetTimeStep_User_Ptr" must be set by a
 //                   test problem initializer
+//                3. For OPT__DT_OPT_SUBSTEP, the number of sub-steps is chosen by OptimizeSubStep() instead of the
+//                   DT__SYNC_PARENT_LV and DT__SYNC_CHILDREN_LV adjustments
+//                   --> The chosen number of sub-steps remaining to synchronize with the parent level is recorded
+//                       in the column "NSubStep" of "Record__TimeStep"
 //
 // Parameter   :  lv                : Target refinement level
 //                dTime_SyncFaLv    : dt to synchronize lv and lv-1
@@ -202,7 +209,21 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
 
 // 2.3 synchronize with the parent level
 // --> increase dt at the current level by a small factor in order to synchronize with the parent level
-   if ( OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE )
+// --> or choose the number of sub-steps minimizing the total work for OPT__DT_OPT_SUBSTEP, which also replaces step 2.4
+   int NSubStep = 1;
+
+   if ( OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE  &&  OPT__DT_OPT_SUBSTEP )
+   {
+      if ( lv > 0  &&  dTime_SyncFaLv <= 0.0 )
+         Aux_Error( ERROR_INFO, "dTime_SyncFaLv (%20.14e) <= 0.0, something is wrong !!\n", dTime_SyncFaLv );
+
+      dTime_min = OptimizeSubStep( lv, dTime_min, dTime_SyncFaLv, NSubStep );
+
+      dTime[NdTime] = dTime_SyncFaLv;
+      sprintf( dTime_Name[NdTime++], "%s", "Sync_FaLv" );
+   }
+
+   else if ( OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE )
    {
       if ( lv > 0 )
       {
@@ -224,7 +245,7 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
 //     (these additional sub-steps usually have much smaller time-steps compared to the CFL condition)
 // --> note that we do not apply this adjustment when this level is going to synchronize with its parent level
 //     (i.e., dTime_min == dTime_SyncFaLv)
-   if ( OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE  &&  DT__SYNC_CHILDREN_LV > 0.0 )
+   if ( OPT__DT_LEVEL == DT_LEVEL_FLEXIBLE  &&  DT__SYNC_CHILDREN_LV > 0.0  &&  !OPT__DT_OPT_SUBSTEP )
    {
       const bool   Try2SyncSon     = ( lv < TOP_LEVEL  &&  NPatchTotal[lv+1] > 0  &&  dTime_min != dTime_SyncFaLv );
       const double dTime_SyncSonLv = ( Try2SyncSon ) ? 2.0*dTime_AllLv[lv+1] : NULL_REAL;
@@ -271,6 +292,9 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
          if ( AUTO_REDUCE_DT )
          fprintf( File, "  %13s", "AutoRedDt" );
 
+         if ( OPT__DT_OPT_SUBSTEP )
+         fprintf( File, "  %13s", "NSubStep" );
+
          fprintf( File, "\n" );
       }
 
@@ -288,6 +312,9 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
       if ( AUTO_REDUCE_DT )
       fprintf( File, "  %13.7e", AutoReduceDtCoeff );
 
+      if ( OPT__DT_OPT_SUBSTEP )
+      fprintf( File, "  %13d", NSubStep );
+
       fprintf( File, "\n" );
 
       fclose( File );
@@ -315,3 +342,105 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
    return dTime_min;
 
 } // FUNCTION : Mis_GetTimeStep
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetSubStepWork
+// Description :  Estimate the work of advancing the target level and all finer levels over a time interval
+//
+// Note        :  1. Each level takes the minimum number of equal sub-steps allowed by its latest time-step
+//                   dTime_AllLv[] (stretched by DT__SYNC_PARENT_LV)
+//                   --> Assuming that dt at the finer levels won't change much in the next sub-step, as in
+//                       step 2.4 of Mis_GetTimeStep()
+//                2. Work of each sub-step = NPatchTotal[lv] + DT__SUBSTEP_OVERHEAD
+//                   --> DT__SUBSTEP_OVERHEAD accounts for the fixed cost of each sub-step such as the
+//                       buffer-data exchange, in units of the cost of advancing one patch
+//
+// Parameter   :  lv    : Target refinement level
+//                dTime : Physical time interval
+//
+// Return      :  Work in units of the cost of advancing one patch
+//-------------------------------------------------------------------------------------------------------
+double GetSubStepWork( const int lv, const double dTime )
+{
+
+   if ( lv > TOP_LEVEL  ||  NPatchTotal[lv] == 0  ||  dTime_AllLv[lv] <= 0.0 )   return 0.0;
+
+   const double NSub = fmax(  ceil( dTime/( (1.0+DT__SYNC_PARENT_LV)*dTime_AllLv[lv] ) ), 1.0  );
+
+   return NSub*(  (double)NPatchTotal[lv] + DT__SUBSTEP_OVERHEAD + GetSubStepWork( lv+1, dTime/NSub )  );
+
+} // FUNCTION : GetSubStepWork
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  OptimizeSubStep
+// Description :  Choose the time-step at the target level to minimize the total work of this and all finer levels
+//
+// Note        :  1. For OPT__DT_OPT_SUBSTEP
+//                2. lv > 0: split the remaining interval to synchronize with the parent level into NSubStep equal
+//                   sub-steps
+//                   --> NSubStep is chosen within [NMin, 2*NMin] to minimize the total work estimated by
+//                       GetSubStepWork(), where NMin is the minimum number allowed by dTime_CFL stretched by
+//                       DT__SYNC_PARENT_LV
+//                   --> Larger NSubStep may reduce the work of the finer levels when their sub-steps fit better
+//                3. lv == 0: compare dTime_CFL with the largest multiple of the time-step at level 1 below it and
+//                   choose the one with the lower work per unit time
+//                4. Re-evaluated at every sub-step so that it adapts to the variation of dt
+//
+// Parameter   :  lv             : Target refinement level
+//                dTime_CFL      : Minimum dt of all criteria at this level
+//                dTime_SyncFaLv : dt to synchronize lv and lv-1 (only for lv > 0)
+//                NSubStep       : Chosen number of sub-steps to synchronize with the parent level (1 for lv == 0)
+//
+// Return      :  Time-step at lv
+//-------------------------------------------------------------------------------------------------------
+double OptimizeSubStep( const int lv, const double dTime_CFL, const double dTime_SyncFaLv, int &NSubStep )
+{
+
+   const double WorkThisLv = (double)NPatchTotal[lv] + DT__SUBSTEP_OVERHEAD;
+
+   NSubStep = 1;
+
+// base level: compare the work per unit time
+   if ( lv == 0 )
+   {
+      const double dTime_Son = ( lv < TOP_LEVEL  &&  NPatchTotal[lv+1] > 0 ) ? dTime_AllLv[lv+1] : 0.0;
+      const double NFit      = ( dTime_Son > 0.0 ) ? floor( dTime_CFL/dTime_Son ) : 0.0;
+
+      if ( NFit < 1.0 )    return dTime_CFL;
+
+      const double dTime_Fit = NFit*dTime_Son;
+      const double Rate_CFL  = ( WorkThisLv + GetSubStepWork(lv+1, dTime_CFL) ) / dTime_CFL;
+      const double Rate_Fit  = ( WorkThisLv + GetSubStepWork(lv+1, dTime_Fit) ) / dTime_Fit;
+
+      return ( Rate_Fit < Rate_CFL ) ? dTime_Fit : dTime_CFL;
+   }
+
+
+// refinement levels: choose the number of sub-steps
+   const double NMin_dbl = fmax(  ceil( dTime_SyncFaLv/( (1.0+DT__SYNC_PARENT_LV)*dTime_CFL ) ), 1.0  );
+
+   if ( NMin_dbl > (double)(__INT_MAX__/2) )
+      Aux_Error( ERROR_INFO, "too many sub-steps (%13.7e) at level %d !!\n", NMin_dbl, lv );
+
+   const int NMin     = (int)NMin_dbl;
+   double    WorkBest = HUGE_NUMBER;
+
+   for (int N=NMin; N<=2*NMin; N++)
+   {
+      const double Work = N*(  WorkThisLv + GetSubStepWork( lv+1, dTime_SyncFaLv/N )  );
+
+      if ( Work < WorkBest )
+      {
+         WorkBest = Work;
+         NSubStep = N;
+      }
+   }
+
+// return dTime_SyncFaLv exactly for the last sub-step to synchronize with the parent level
+   return ( NSubStep == 1 ) ? dTime_SyncFaLv : dTime_SyncFaLv/NSubStep;
+
+} // FUNCTION : OptimizeSubStep
@@ -0,0 +1,148 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_CheckTableSpacing
+// Description :  Check whether the x coordinates of an interpolation table are uniformly or logarithmically
+//                uniformly spaced
+//
+// Note        :  1. Should be called once after loading a table (e.g., by Aux_LoadTable()), and the result is
+//                   passed to Mis_InterpolateFromTable_Uniform() for all subsequent queries
+//                2. Table_x must be strictly increasing for TABLE_SPACING_LINEAR/LOG
+//                   --> Return TABLE_SPACING_NONE otherwise
+//                3. Each point may deviate from the exact spacing by up to "Tolerance" of the spacing
+//                   --> Mis_InterpolateFromTable_Uniform() corrects the estimated index so that these small
+//                       departures (e.g., from the limited number of digits in a table file) never change the result
+//                4. Linear spacing is preferred when both apply
+//                5. Explicit template instantiation is put in the end of this file
+//
+// Parameter   :  N       : Number of elements in Table_x
+//                Table_x : Interpolation table x
+//
+// Return      :  TABLE_SPACING_LINEAR/LOG/NONE
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+TableSpacing_t Mis_CheckTableSpacing( const int N, const T Table_x[] )
+{
+
+   const double Tolerance = 1.0e-3;
+
+   if ( N < 2  ||  Table_x == NULL )   return TABLE_SPACING_NONE;
+
+   for (int t=0; t<N-1; t++)
+      if ( Table_x[t+1] <= Table_x[t] )   return TABLE_SPACING_NONE;
+
+
+// linear spacing
+   const double dx = ( (double)Table_x[N-1] - (double)Table_x[0] ) / (N-1);
+   bool Uniform = true;
+
+   for (int t=1; t<N-1; t++)
+   {
+      if (  fabs( (double)Table_x[t] - ( (double)Table_x[0] + t*dx ) ) > Tolerance*dx  )
+      {
+         Uniform = false;
+         break;
+      }
+   }
+
+   if ( Uniform )    return TABLE_SPACING_LINEAR;
+
+
+// logarithmic spacing
+   if ( Table_x[0] <= (T)0 )  return TABLE_SPACING_NONE;
+
+   const double LogX0 = log( (double)Table_x[0] );
+   const double dLogX = ( log( (double)Table_x[N-1] ) - LogX0 ) / (N-1);
+
+   for (int t=1; t<N-1; t++)
+      if (  fabs( log( (double)Table_x[t] ) - ( LogX0 + t*dLogX ) ) > Tolerance*dLogX  )
+         return TABLE_SPACING_NONE;
+
+   return TABLE_SPACING_LOG;
+
+} // FUNCTION : Mis_CheckTableSpacing
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_InterpolateFromTable_Uniform
+// Description :  Same as Mis_InterpolateFromTable() but compute the table index directly for a table with
+//                uniform or logarithmically uniform spacing instead of performing a binary search
+//
+// Note        :  1. Spacing must be obtained by Mis_CheckTableSpacing() on the same Table_x
+//                   --> Fall back to Mis_InterpolateFromTable() for TABLE_SPACING_NONE
+//                2. Return exactly the same value as Mis_InterpolateFromTable() since the estimated index is
+//                   shifted until Table_x[Idx] <= x < Table_x[Idx+1]
+//                3. Explicit template instantiation is put in the end of this file
+//
+// Parameter   :  N        : Number of elements in the interpolation tables Table_x and Table_y
+//                           --> Must be >= 2
+//                Table_x  : Interpolation table x
+//                Table_y  : Interpolation table y
+//                x        : Target point x for interpolation
+//                Spacing  : Spacing of Table_x returned by Mis_CheckTableSpacing()
+//
+// Return      :  y(x)      if x lies in the range Table_x[0] <= x < Table_x[N-1]
+//                NULL_REAL if x lies outside the above range
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+T Mis_InterpolateFromTable_Uniform( const int N, const T Table_x[], const T Table_y[], const T x,
+                                    const TableSpacing_t Spacing )
+{
+
+   if ( Spacing != TABLE_SPACING_LINEAR  &&  Spacing != TABLE_SPACING_LOG )
+      return Mis_InterpolateFromTable( N, Table_x, Table_y, x );
+
+
+// initial check
+#  ifdef GAMER_DEBUG
+   if ( N <= 1 )           Aux_Error( ERROR_INFO, "incorrect input parameter \"N (%d) <= 1\" !!\n", N );
+   if ( Table_x == NULL )  Aux_Error( ERROR_INFO, "Table_x == NULL !!\n" );
+   if ( Table_y == NULL )  Aux_Error( ERROR_INFO, "Table_y == NULL !!\n" );
+#  endif
+
+
+// check whether the target x lies within the accepted range
+   if ( x < Table_x[0]  ||  x >= Table_x[N-1] )    return NULL_REAL;
+
+
+// estimate the table index from the spacing
+   double s;
+
+   if ( Spacing == TABLE_SPACING_LINEAR )
+      s = ( (double)x - (double)Table_x[0] ) / ( (double)Table_x[N-1] - (double)Table_x[0] ) * (N-1);
+   else
+      s = log( (double)x/(double)Table_x[0] ) / log( (double)Table_x[N-1]/(double)Table_x[0] ) * (N-1);
+
+   int IdxL = (int)s;
+   IdxL = MAX( IdxL, 0   );
+   IdxL = MIN( IdxL, N-2 );
+
+// correct the round-off errors and the small departures from the exact spacing allowed by Mis_CheckTableSpacing()
+   while ( IdxL > 0    &&  x <  Table_x[IdxL  ] )    IdxL --;
+   while ( IdxL < N-2  &&  x >= Table_x[IdxL+1] )    IdxL ++;
+
+
+// linear interpolation
+   const T xL = Table_x[IdxL  ];
+   const T xR = Table_x[IdxL+1];
+   const T yL = Table_y[IdxL  ];
+   const T yR = Table_y[IdxL+1];
+
+   return yL + (yR-yL)/(xR-xL)*(x-xL);
+
+} // FUNCTION : Mis_InterpolateFromTable_Uniform
+
+
+
+// explicit template instantiation
+template TableSpacing_t Mis_CheckTableSpacing <float>  ( const int N, const float  Table_x[] );
+template TableSpacing_t Mis_CheckTableSpacing <double> ( const int N, const double Table_x[] );
+
+template float  Mis_InterpolateFromTable_Uniform <float>  ( const int N, const float  Table_x[], const float  Table_y[],
+                                                            const float  x, const TableSpacing_t Spacing );
+template double Mis_InterpolateFromTable_Uniform <double> ( const int N, const double Table_x[], const double Table_y[],
+                                                            const double x, const TableSpacing_t Spacing );
@@ -0,0 +1,222 @@
+#include "GAMER.h"
+#include <sys/mman.h>
+
+// size and alignment of each slab (in bytes)
+// --> a multiple of the 2 MB huge page on x86-64 so that transparent huge pages can back the entire slab
+#define PATCH_ARENA_SLAB_SIZE    ( 2L*1024L*1024L )
+
+// minimum number of blocks in a slab (= two patch groups) for the large arrays (e.g., fluid[] with many passive scalars)
+#define PATCH_ARENA_MIN_NBLOCK   16
+
+// blocks are padded to a multiple of the cache-line size
+#define PATCH_ARENA_ALIGN        64
+
+
+// free list of each arena (i.e., each field type, level, and sandglass)
+// --> the address of the next free block is stored in the first bytes of each free block
+static void  *Arena_FreeList[PATCH_ARENA_NTYPE][2*NLEVEL];
+
+// all slabs allocated so far (released only by Mis_PatchArena_End())
+static void **Arena_Slab     = NULL;
+static int    Arena_NSlab    = 0;
+static int    Arena_MaxNSlab = 0;
+
+static long GetBlockSize( const int Type );
+static void AllocateSlab( const int Type, const int ArenaID );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchArena_Alloc
+// Description :  Allocate a patch field array from the arena of the target field type, level, and sandglass
+//
+// Note        :  1. Invoked by the allocation methods of patch_t (e.g., hnew(), gnew()) for OPT__PATCH_ARENA
+//                2. All blocks of the same field type have the same size, so a block can be freed to any arena of
+//                   the same type
+//                   --> Necessary since the field pointers can be swapped between different patches, levels, and
+//                       sandglasses (e.g., in Refine() and LB_Refine_AllocateNewPatch())
+//                3. A new slab is allocated only when the free list is empty
+//                   --> Blocks of a new slab are handed out in the order of increasing address so that the patches
+//                       of a patch group allocated consecutively by amr->pnew() are contiguous in memory
+//                4. Arena index = 2*lv + Sg
+//
+// Parameter   :  Type    : Field type (PATCH_ARENA_FLU/MAG/POT/POT_EXT/DE_STATUS/RHO_EXT)
+//                ArenaID : Arena index
+//
+// Return      :  Pointer to the allocated block
+//-------------------------------------------------------------------------------------------------------
+void *Mis_PatchArena_Alloc( const int Type, const int ArenaID )
+{
+
+#  ifdef GAMER_DEBUG
+// return explicitly after Aux_Error() so that the free list below is never indexed out of range
+   if ( Type < 0  ||  Type >= PATCH_ARENA_NTYPE  ||  ArenaID < 0  ||  ArenaID >= 2*NLEVEL )
+   {
+      Aux_Error( ERROR_INFO, "incorrect parameter Type = %d or ArenaID = %d !!\n", Type, ArenaID );
+      return NULL;
+   }
+#  endif
+
+   void *Ptr = NULL;
+
+#  pragma omp critical( PatchArena )
+   {
+      if ( Arena_FreeList[Type][ArenaID] == NULL )    AllocateSlab( Type, ArenaID );
+
+      Ptr                           = Arena_FreeList[Type][ArenaID];
+      Arena_FreeList[Type][ArenaID] = *(void**)Ptr;
+   }
+
+   return Ptr;
+
+} // FUNCTION : Mis_PatchArena_Alloc
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchArena_Free
+// Description :  Return a patch field array allocated by Mis_PatchArena_Alloc() to the arena
+//
+// Note        :  1. Do nothing if Ptr == NULL
+//                2. Memory is never returned to the system until Mis_PatchArena_End()
+//                   --> The arena size is bounded by the peak number of patches, and slabs are not fragmented by
+//                       other allocations in long runs
+//
+// Parameter   :  Type    : Field type
+//                ArenaID : Arena index (= 2*lv + Sg)
+//                Ptr     : Pointer to the block to be freed
+//-------------------------------------------------------------------------------------------------------
+void Mis_PatchArena_Free( const int Type, const int ArenaID, void *Ptr )
+{
+
+   if ( Ptr == NULL )   return;
+
+#  pragma omp critical( PatchArena )
+   {
+      *(void**)Ptr                  = Arena_FreeList[Type][ArenaID];
+      Arena_FreeList[Type][ArenaID] = Ptr;
+   }
+
+} // FUNCTION : Mis_PatchArena_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchArena_End
+// Description :  Release all slabs
+//
+// Note        :  1. Invoked by End_MemFree() after deleting all patches
+//                2. Do nothing if OPT__PATCH_ARENA is off
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_PatchArena_End()
+{
+
+   for (int s=0; s<Arena_NSlab; s++)   free( Arena_Slab[s] );
+
+   free( Arena_Slab );
+
+   Arena_Slab     = NULL;
+   Arena_NSlab    = 0;
+   Arena_MaxNSlab = 0;
+
+   for (int t=0; t<PATCH_ARENA_NTYPE; t++)
+   for (int a=0; a<2*NLEVEL; a++)
+      Arena_FreeList[t][a] = NULL;
+
+} // FUNCTION : Mis_PatchArena_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetBlockSize
+// Description :  Return the size of a block (in bytes) of the target field type
+//
+// Note        :  Padded to a multiple of PATCH_ARENA_ALIGN
+//
+// Parameter   :  Type : Field type
+//-------------------------------------------------------------------------------------------------------
+long GetBlockSize( const int Type )
+{
+
+   long Size = 0;
+
+   switch ( Type )
+   {
+      case PATCH_ARENA_FLU       :  Size = sizeof(real)*NCOMP_TOTAL*CUBE(PS1);         break;
+#     ifdef MHD
+      case PATCH_ARENA_MAG       :  Size = sizeof(real)*NCOMP_MAG*PS1P1*SQR(PS1);      break;
+#     endif
+#     ifdef GRAVITY
+      case PATCH_ARENA_POT       :  Size = sizeof(real)*CUBE(PS1);                     break;
+#     ifdef STORE_POT_GHOST
+      case PATCH_ARENA_POT_EXT   :  Size = sizeof(real)*CUBE(GRA_NXT);                 break;
+#     endif
+#     endif
+#     ifdef DUAL_ENERGY
+      case PATCH_ARENA_DE_STATUS :  Size = sizeof(char)*CUBE(PS1);                     break;
+#     endif
+#     ifdef PARTICLE
+      case PATCH_ARENA_RHO_EXT   :  Size = sizeof(real)*CUBE(RHOEXT_NXT);              break;
+#     endif
+      default                    :  Aux_Error( ERROR_INFO, "unsupported patch arena type (%d) !!\n", Type );
+   }
+
+   return ( Size + PATCH_ARENA_ALIGN - 1 ) / PATCH_ARENA_ALIGN * PATCH_ARENA_ALIGN;
+
+} // FUNCTION : GetBlockSize
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AllocateSlab
+// Description :  Allocate a new slab and push all its blocks to the free list of the target arena
+//
+// Note        :  1. Slab size is a multiple of PATCH_ARENA_SLAB_SIZE and is aligned to PATCH_ARENA_SLAB_SIZE
+//                   --> Request transparent huge pages by madvise(MADV_HUGEPAGE) to reduce the TLB misses when
+//                       accessing many patches (e.g., in Prepare_PatchData())
+//                   --> Silently fall back to normal pages if huge pages are unavailable
+//                2. Memory is not touched here so that each page is first touched by the thread initializing it
+//
+// Parameter   :  Type    : Field type
+//                ArenaID : Arena index
+//-------------------------------------------------------------------------------------------------------
+void AllocateSlab( const int Type, const int ArenaID )
+{
+
+   const long BlockSize = GetBlockSize( Type );
+   const long MinSize   = MAX( PATCH_ARENA_SLAB_SIZE, PATCH_ARENA_MIN_NBLOCK*BlockSize );
+   const long SlabSize  = ( MinSize + PATCH_ARENA_SLAB_SIZE - 1 ) / PATCH_ARENA_SLAB_SIZE * PATCH_ARENA_SLAB_SIZE;
+   const long NBlock    = SlabSize / BlockSize;
+
+   void *Slab = NULL;
+
+   if ( posix_memalign( &Slab, PATCH_ARENA_SLAB_SIZE, SlabSize ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to allocate a patch arena slab of %ld bytes (type %d, arena %d) !!\n",
+                 SlabSize, Type, ArenaID );
+
+#  ifdef MADV_HUGEPAGE
+   madvise( Slab, SlabSize, MADV_HUGEPAGE );
+#  endif
+
+// record the slab
+   if ( Arena_NSlab == Arena_MaxNSlab )
+   {
+      Arena_MaxNSlab = MAX( 2*Arena_MaxNSlab, 64 );
+      Arena_Slab     = (void**)realloc( Arena_Slab, Arena_MaxNSlab*sizeof(void*) );
+   }
+
+   Arena_Slab[ Arena_NSlab ++ ] = Slab;
+
+// push blocks in the order of decreasing address so that they are popped in the order of increasing address
+   char *Block = (char*)Slab + (NBlock-1)*BlockSize;
+
+   for (long b=0; b<NBlock; b++, Block-=BlockSize)
+   {
+      *(void**)Block                = Arena_FreeList[Type][ArenaID];
+      Arena_FreeList[Type][ArenaID] = Block;
+   }
+
+} // FUNCTION : AllocateSlab
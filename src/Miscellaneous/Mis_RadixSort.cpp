@@ -0,0 +1,221 @@
+#include "GAMER.h"
+
+static inline ulong RadixKey( const int    Value );
+static inline ulong RadixKey( const long   Value );
+static inline ulong RadixKey( const ulong  Value );
+static inline ulong RadixKey( const float  Value );
+static inline ulong RadixKey( const double Value );
+
+static const int RADIX_NBIT     = 8;                 // number of bits sorted in each pass
+static const int RADIX_NBUCKET  = 1<<RADIX_NBIT;     // number of buckets in each pass
+static const int RADIX_OMP_MIN  = 1<<15;             // minimum array size to use OpenMP
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_RadixSort
+// Description :  Use the LSD radix sort to sort the input array into ascending numerical order
+//                --> An index table will also be constructed if "IdxTable != NULL"
+//
+// Note        :  1. Drop-in replacement of Mis_Heapsort() for large arrays
+//                   --> Cost is O(N) instead of O(N log N) and the passes are parallelized with OpenMP
+//                       for N >= RADIX_OMP_MIN
+//                2. Stable sort: elements with the same value retain their original order in IdxTable[]
+//                   --> IdxTable[] can therefore differ from Mis_Heapsort() only for duplicate values
+//                3. Each pass sorts RADIX_NBIT bits of the keys returned by RadixKey(), which map the input
+//                   values (including negative integers and floating-point numbers) to unsigned integers
+//                   with the same ordering
+//                   --> Passes for which all keys have the same digit are skipped
+//                4. Overloaded with different types
+//                   --> Explicit template instantiation is put in the end of this file
+//
+// Parameter   :  N        :  Size of Array
+//                Array    :  Array to be sorted into ascending numerical order
+//                IdxTable :  Index table
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+void Mis_RadixSort( const int N, T Array[], int IdxTable[] )
+{
+
+   if ( N <= 0 )  return;
+
+
+   const int NPass = sizeof(T)*8/RADIX_NBIT;
+   const int NMaxThread =
+#  ifdef OPENMP
+                          ( N >= RADIX_OMP_MIN ) ? omp_get_max_threads() : 1;
+#  else
+                          1;
+#  endif
+
+   ulong *Key_In   = new ulong [N];
+   ulong *Key_Out  = new ulong [N];
+   int   *Idx_In   = new int   [N];
+   int   *Idx_Out  = new int   [N];
+   T     *Array_In = new T     [N];
+   int  (*Hist)[RADIX_NBUCKET] = new int [NMaxThread][RADIX_NBUCKET];
+   bool   SkipPass;
+
+
+#  pragma omp parallel num_threads( NMaxThread )
+   {
+#     ifdef OPENMP
+      const int TID     = omp_get_thread_num();
+      const int NThread = omp_get_num_threads();
+#     else
+      const int TID     = 0;
+      const int NThread = 1;
+#     endif
+
+//    each thread works on a contiguous chunk of the array to keep the sort stable
+      const int t_start = (long)N*(TID  )/NThread;
+      const int t_end   = (long)N*(TID+1)/NThread;
+
+//    1. convert values to the sorting keys
+      for (int t=t_start; t<t_end; t++)
+      {
+         Key_In  [t] = RadixKey( Array[t] );
+         Idx_In  [t] = t;
+         Array_In[t] = Array[t];
+      }
+
+
+//    2. sort RADIX_NBIT bits in each pass from the least significant bits
+      for (int p=0; p<NPass; p++)
+      {
+         const int Shift = p*RADIX_NBIT;
+
+//       2-1. histogram of the current digit in each thread
+         for (int b=0; b<RADIX_NBUCKET; b++)    Hist[TID][b] = 0;
+
+         for (int t=t_start; t<t_end; t++)      Hist[TID][ ( Key_In[t] >> Shift ) & (RADIX_NBUCKET-1) ] ++;
+
+#        pragma omp barrier
+
+//       2-2. exclusive prefix sum over (bucket, thread) to get the output offsets
+//            --> skip this pass if all keys share the same digit
+#        pragma omp single
+         {
+            SkipPass = false;
+
+            for (int b=0; b<RADIX_NBUCKET; b++)
+            {
+               int NInBucket = 0;
+               for (int r=0; r<NThread; r++)    NInBucket += Hist[r][b];
+
+               if ( NInBucket == N )
+               {
+                  SkipPass = true;
+                  break;
+               }
+            }
+
+            if ( !SkipPass )
+            {
+               int Offset = 0;
+
+               for (int b=0; b<RADIX_NBUCKET; b++)
+               for (int r=0; r<NThread; r++)
+               {
+                  const int Tmp = Hist[r][b];
+                  Hist[r][b] = Offset;
+                  Offset    += Tmp;
+               }
+            }
+         } // OpenMP single (with an implicit barrier)
+
+//       2-3. scatter the keys and indices to their new positions
+         if ( !SkipPass )
+         {
+            for (int t=t_start; t<t_end; t++)
+            {
+               const int Pos = Hist[TID][ ( Key_In[t] >> Shift ) & (RADIX_NBUCKET-1) ] ++;
+
+               Key_Out[Pos] = Key_In[t];
+               Idx_Out[Pos] = Idx_In[t];
+            }
+
+#           pragma omp barrier
+
+#           pragma omp single
+            {
+               Aux_SwapPointer( (void**)&Key_In, (void**)&Key_Out );
+               Aux_SwapPointer( (void**)&Idx_In, (void**)&Idx_Out );
+            }
+         } // if ( !SkipPass )
+      } // for (int p=0; p<NPass; p++)
+
+
+//    3. reorder the input array and store the index table
+      for (int t=t_start; t<t_end; t++)
+      {
+         Array[t] = Array_In[ Idx_In[t] ];
+
+         if ( IdxTable != NULL )    IdxTable[t] = Idx_In[t];
+      }
+   } // OpenMP parallel region
+
+
+   delete [] Key_In;
+   delete [] Key_Out;
+   delete [] Idx_In;
+   delete [] Idx_Out;
+   delete [] Array_In;
+   delete [] Hist;
+
+} // FUNCTION : Mis_RadixSort
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RadixKey
+// Description :  Map the input value to an unsigned integer key with the same ordering for Mis_RadixSort()
+//
+// Note        :  1. Signed integers : flip the sign bit
+//                2. Floating-point  : flip all bits for negative numbers and only the sign bit otherwise
+//                3. Overloaded with different types
+//
+// Parameter   :  Value : Input value
+//
+// Return      :  Sorting key
+//-------------------------------------------------------------------------------------------------------
+inline ulong RadixKey( const int Value )
+{
+   return (ulong)( (unsigned int)Value ^ 0x80000000U );
+}
+
+inline ulong RadixKey( const long Value )
+{
+   return (ulong)Value ^ ( 1UL << 63 );
+}
+
+inline ulong RadixKey( const ulong Value )
+{
+   return Value;
+}
+
+inline ulong RadixKey( const float Value )
+{
+   unsigned int Bit;
+   memcpy( &Bit, &Value, sizeof(float) );
+
+   return (ulong)(  ( Bit & 0x80000000U ) ? ~Bit : ( Bit | 0x80000000U )  );
+}
+
+inline ulong RadixKey( const double Value )
+{
+   ulong Bit;
+   memcpy( &Bit, &Value, sizeof(double) );
+
+   return ( Bit & ( 1UL << 63 ) ) ? ~Bit : ( Bit | ( 1UL << 63 ) );
+}
+
+
+
+// explicit template instantiation
+template void Mis_RadixSort <int>    ( const int N, int    Array[], int IdxTable[] );
+template void Mis_RadixSort <long>   ( const int N, long   Array[], int IdxTable[] );
+template void Mis_RadixSort <ulong>  ( const int N, ulong  Array[], int IdxTable[] );
+template void Mis_RadixSort <float>  ( const int N, float  Array[], int IdxTable[] );
+template void Mis_RadixSort <double> ( const int N, double Array[], int IdxTable[] );
@@ -0,0 +1,128 @@
+#include "GAMER.h"
+
+static const int REPROSUM_NFOLD = 3;   // number of error-free extraction folds
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_ReproducibleSum
+// Description :  Sum up the input arrays over all MPI ranks such that the result is independent of both the
+//                summation order and the number of MPI ranks
+//
+// Note        :  1. Pre-rounding algorithm (Demmel & Nguyen 2015)
+//                   --> Each value is split into x = q_1 + q_2 + ... + q_NFOLD + residual, where q_k is rounded
+//                       to a grid shared by all ranks (determined by the global maximum |x| and the global
+//                       number of values), so that the sum of q_k over all values is EXACT in double precision
+//                   --> Exact sums do not depend on the summation order, the OpenMP threads, or the MPI
+//                       reduction tree, and thus a plain MPI_Allreduce() suffices
+//                   --> Residuals are dropped, giving a relative error of ~(N*2^-51)^NFOLD*MaxAbs/|Sum|
+//                2. Replace the approach of gathering all values to one rank and sorting them, which is serial
+//                   and O(N log N)
+//                3. Must be invoked by all ranks
+//                4. Overloaded with different types
+//                   --> Explicit template instantiation is put in the end of this file
+//
+// Parameter   :  N               : Size of Array on this rank
+//                Array           : Array to be summed up
+//                SkipNonPositive : Skip values <= 0 (e.g., inactive and massless particles)
+//
+// Return      :  Sum over all ranks (identical on all ranks)
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+double Mis_ReproducibleSum( const long N, const T Array[], const bool SkipNonPositive )
+{
+
+// 1. get the global maximum magnitude and number of values
+   double MaxAbs_Local=0.0, MaxAbs_All;
+   long   NValue_Local=0,   NValue_All;
+
+   for (long t=0; t<N; t++)
+   {
+      if ( SkipNonPositive  &&  Array[t] <= (T)0 )    continue;
+
+      MaxAbs_Local = fmax( MaxAbs_Local, fabs( (double)Array[t] ) );
+      NValue_Local ++;
+   }
+
+   MPI_Allreduce( &MaxAbs_Local, &MaxAbs_All, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( &NValue_Local, &NValue_All, 1, MPI_LONG,   MPI_SUM, MPI_COMM_WORLD );
+
+   if ( MaxAbs_All == 0.0 )   return 0.0;
+
+
+// 2. set the extractor of each fold
+// --> for Sigma = 1.5*2^K with N*MaxAbs < 2^(K-1), Sigma+x lies in [2^K, 2^(K+1)) for all x and the
+//     extracted q = (Sigma+x)-Sigma is a multiple of 2^(K-52) whose sum over N values never exceeds 2^(K+1)
+// --> the residual of each fold is bounded by 2^(K-53), which sets the magnitude of the next fold
+   int    ExpMax, ExpN, K, NFold=0;
+   double Sigma[REPROSUM_NFOLD];
+
+   frexp( MaxAbs_All,         &ExpMax );
+   frexp( (double)NValue_All, &ExpN   );
+
+   K = ExpMax + ExpN + 1;
+
+   for (int f=0; f<REPROSUM_NFOLD; f++)
+   {
+//    stop before the grid spacing becomes subnormal
+      if ( K-52 < __DBL_MIN_EXP__ )  break;
+
+      Sigma[f] = 1.5*ldexp( 1.0, K );
+      NFold ++;
+
+      K += ExpN - 51;
+   }
+
+
+// 3. extract and sum up all folds on this rank
+// --> "volatile" prevents the compiler from simplifying (Sigma+x)-Sigma to x
+   double Sum_Local[REPROSUM_NFOLD], Sum_All[REPROSUM_NFOLD];
+
+   for (int f=0; f<REPROSUM_NFOLD; f++)   Sum_Local[f] = 0.0;
+
+#  pragma omp parallel
+   {
+      double Sum_Thread[REPROSUM_NFOLD];
+
+      for (int f=0; f<NFold; f++)   Sum_Thread[f] = 0.0;
+
+#     pragma omp for schedule( static )
+      for (long t=0; t<N; t++)
+      {
+         if ( SkipNonPositive  &&  Array[t] <= (T)0 )    continue;
+
+         double Residual = (double)Array[t];
+
+         for (int f=0; f<NFold; f++)
+         {
+            volatile double Tmp = Sigma[f] + Residual;
+            const    double q   = Tmp - Sigma[f];
+
+            Sum_Thread[f] += q;
+            Residual      -= q;
+         }
+      }
+
+//    exact sums --> the order of threads does not matter
+#     pragma omp critical
+      for (int f=0; f<NFold; f++)   Sum_Local[f] += Sum_Thread[f];
+   } // OpenMP parallel region
+
+
+// 4. sum over all ranks (exact) and combine the folds in a fixed order
+   MPI_Allreduce( Sum_Local, Sum_All, REPROSUM_NFOLD, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   double Sum = 0.0;
+
+   for (int f=NFold-1; f>=0; f--)   Sum += Sum_All[f];
+
+   return Sum;
+
+} // FUNCTION : Mis_ReproducibleSum
+
+
+
+// explicit template instantiation
+template double Mis_ReproducibleSum <float>  ( const long N, const float  Array[], const bool SkipNonPositive );
+template double Mis_ReproducibleSum <double> ( const long N, const double Array[], const bool SkipNonPositive );
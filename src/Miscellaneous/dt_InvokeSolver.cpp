@@ -1,7 +1,12 @@
 #include "GAMER.h"
+#include "CUFLU.h"
 
 double dt_min_for_solver;
 
+#if ( MODEL == HYDRO  &&  !defined MHD )
+static real GetMaxCFL_ByProduct( const int lv );
+#endif
+
 
 
 
@@ -11,6 +16,10 @@ double dt_min_for_solver;
 //
 // Note        :  1. Invoked by Mis_GetTimeStep()
 //                2. The global variable "dt_min_for_solver" will be set by dt_Close()
+//                3. For OPT__DT_FLU_BYPRODUCT, the fluid dt is obtained from the maximum CFL speed of each patch
+//                   recorded by Flu_Close() (i.e., patch_t::dt_MaxCFL)
+//                   --> Skip dt_Prepare_Flu() and the dt solver
+//                   --> Only the patches without a valid record are re-evaluated (see GetMaxCFL_ByProduct())
 //
 // Parameter   :  TSolver : Target dt solver
 //                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
@@ -26,6 +35,18 @@ double dt_InvokeSolver( const Solver_t TSolver, const int lv )
 
 
 // invoke the target dt solver
+#  if ( MODEL == HYDRO  &&  !defined MHD )
+   if ( TSolver == DT_FLU_SOLVER  &&  OPT__DT_FLU_BYPRODUCT )
+   {
+//    adopt the same precision and operation order as CPU/CUFLU_dtSolver_HydroCFL()
+      const real dhSafety = (real)( (Step==0)?DT__FLUID_INIT:DT__FLUID )*(real)amr->dh[lv];
+      const real MaxCFL   = GetMaxCFL_ByProduct( lv );
+
+      if ( MaxCFL > (real)0.0 )  dt_min_for_solver = (double)( dhSafety/MaxCFL );
+   }
+
+   else
+#  endif
    InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
 
 
@@ -37,3 +58,103 @@ double dt_InvokeSolver( const Solver_t TSolver, const int lv )
    return dt_min_all_rank;
 
 } // FUNCTION : dt_InvokeSolver
+
+
+
+#if ( MODEL == HYDRO  &&  !defined MHD )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_GetCFLSpeed_Hydro
+// Description :  Return the CFL speed of a single cell
+//
+// Note        :  1. Invoked by Flu_Close() and GetMaxCFL_ByProduct() for OPT__DT_FLU_BYPRODUCT
+//                2. Adopt the same CFL speed as CPU/CUFLU_dtSolver_HydroCFL() so that the resulting dt is identical
+//                   to that of the dt solver
+//
+// Parameter   :  fluid : Conserved variables of the target cell (including passive scalars)
+//
+// Return      :  CFL speed
+//-------------------------------------------------------------------------------------------------------
+real dt_GetCFLSpeed_Hydro( const real fluid[] )
+{
+
+   const bool CheckMinPres_Yes = true;
+   const real MinPres          = (real)MIN_PRES;
+
+   real _Rho, Vx, Vy, Vz, Pres, a2, CFLx, CFLy, CFLz;
+
+  _Rho  = (real)1.0 / fluid[DENS];
+   Vx   = FABS( fluid[MOMX] )*_Rho;
+   Vy   = FABS( fluid[MOMY] )*_Rho;
+   Vz   = FABS( fluid[MOMZ] )*_Rho;
+   Pres = Hydro_Con2Pres( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY], fluid+NCOMP_FLUID,
+                          CheckMinPres_Yes, MinPres, NULL_REAL,
+                          EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
+   a2   = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr_CPUPtr, fluid[DENS], Pres, fluid+NCOMP_FLUID, EoS_AuxArray );
+
+   CFLx = SQRT( a2 ) + Vx;
+   CFLy = SQRT( a2 ) + Vy;
+   CFLz = SQRT( a2 ) + Vz;
+
+#  if   ( FLU_SCHEME == RTVD  ||  FLU_SCHEME == CTU )
+   return FMAX(  FMAX( CFLx, CFLy ), CFLz  );
+#  elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+   return CFLx + CFLy + CFLz;
+#  endif
+
+} // FUNCTION : dt_GetCFLSpeed_Hydro
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMaxCFL_ByProduct
+// Description :  Get the maximum CFL speed of all real patches at level "lv" for OPT__DT_FLU_BYPRODUCT
+//
+// Note        :  1. Invoked by dt_InvokeSolver()
+//                2. Adopt the CFL speed recorded by Flu_Close() (i.e., patch_t::dt_MaxCFL) for most patches
+//                3. Re-evaluate the CFL speed directly from the latest fluid data for
+//                   (1) Patches that have not been updated by the fluid solver since they were allocated
+//                       (e.g., newly refined patches) --> dt_MaxCFL is reset by patch_t::Activate()
+//                   (2) Patches with sons, whose data are updated by the restriction operation
+//                   (3) Patches whose sons have been removed since the latest fluid update
+//                       --> dt_MaxCFL is reset by Refine()
+//                   (4) Patches corrected by the flux fix-up operation since the latest fluid update
+//                       --> dt_MaxCFL is reset by Flu_FixUp_Flux()
+//
+// Parameter   :  lv : Target refinement level
+//
+// Return      :  Maximum CFL speed
+//-------------------------------------------------------------------------------------------------------
+real GetMaxCFL_ByProduct( const int lv )
+{
+
+   const int FluSg = amr->FluSg[lv];
+
+   real MaxCFL = (real)0.0;
+
+#  pragma omp parallel for reduction( max:MaxCFL ) schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      const patch_t *Patch = amr->patch[0][lv][PID];
+
+      if ( Patch->son == -1  &&  Patch->dt_MaxCFL >= (real)0.0 )
+         MaxCFL = FMAX( Patch->dt_MaxCFL, MaxCFL );
+
+      else
+      {
+         const real *FluPtr = amr->patch[FluSg][lv][PID]->fluid[0][0][0];
+
+         for (int t=0; t<CUBE(PS1); t++)
+         {
+            real fluid[NCOMP_TOTAL];
+
+            for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = FluPtr[ v*CUBE(PS1) + t ];
+
+            MaxCFL = FMAX( dt_GetCFLSpeed_Hydro(fluid), MaxCFL );
+         }
+      }
+   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+   return MaxCFL;
+
+} // FUNCTION : GetMaxCFL_ByProduct
+#endif // #if ( MODEL == HYDRO  &&  !defined MHD )
@@ -23,7 +23,7 @@ void Hydro_Rotate3D( real InOut[], const int XYZ, const bool Forward, const int
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                     real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
@@ -34,7 +34,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const EoS_DP2E_t EoS_DensPres2Eint,
                                const EoS_DP2C_t EoS_DensPres2CSqr,
                                const double EoS_AuxArray[] );
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+void Hydro_ComputeFlux( const real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
@@ -47,7 +47,8 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const double EoS_AuxArray[] );
+                           const double EoS_AuxArray[], const bool FuseExtAcc, const double g_Corner[],
+                           const double TimeOld, const double TimeNew, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
 #ifdef MHD
 void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
                           const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
@@ -61,6 +62,17 @@ void MHD_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out
                          const real g_FC_B_In[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                          const real g_EC_Ele[][ CUBE(N_EC_ELE) ],
                          const real dt, const real dh, const int NOut, const int NEle, const int Offset_B_In );
+#ifdef MHD_CT_FUSED
+void MHD_ComputeElectric_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out,
+                                         const real g_FC_B_In[][ FLU_NXT_P1*SQR(FLU_NXT) ],
+                                         const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                         const real g_PriVar[][ CUBE(FLU_NXT) ],
+                                         const int NOut, const int NFlux, const int NPri, const int OffsetPri,
+                                         const int Offset_B_In, const real dt_Ele, const real dt_Mag, const real dh,
+                                         const bool DumpIntEle, real g_IntEle[][NCOMP_ELE][ PS2P1*PS2 ],
+                                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[], const double Time,
+                                         const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
+#endif
 void MHD_HalfStepPrimitive( const real g_Flu_In[][ CUBE(FLU_NXT) ],
                             const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                   real g_PriVar_Out[][ CUBE(FLU_NXT) ],
@@ -73,7 +85,7 @@ void MHD_HalfStepPrimitive( const real g_Flu_In[][ CUBE(FLU_NXT) ],
 
 // internal functions
 GPU_DEVICE
-void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
+void Hydro_TGradientCorrection(       real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
                                 const real g_FC_Flux  [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                                 const real g_FC_B_In  [][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
@@ -119,6 +131,9 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                                                        vanLeer + generalized MinMod/extrema-preserving) limiter
 //                MinMod_Coeff           : Coefficient of the generalized MinMod limiter
 //                Time                   : Current physical time                                     (for UNSPLIT_GRAVITY only)
+//                TimeNew                : Physical time after update                                (for FuseExtAcc only)
+//                FuseExtAcc             : Apply the corrector step of the external acceleration in
+//                                         Hydro_FullStepUpdate() (for UNSPLIT_GRAVITY only)
 //                GravityType            : Types of gravity --> self-gravity, external gravity, both (for UNSPLIT_GRAVITY only)
 //                ExtAcc_Func            : Function pointer to the external acceleration routine     (for UNSPLIT_GRAVITY only)
 //                c_ExtAcc_AuxArray      : Auxiliary array for adding external acceleration          (for UNSPLIT_GRAVITY and CPU only)
@@ -159,14 +174,15 @@ void CUFLU_FluidSolver_CTU(
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+         real_fc g_FC_Var      [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff,
@@ -186,7 +202,7 @@ void CPU_FluidSolver_CTU(
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+         real_fc g_FC_Var      [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
@@ -194,7 +210,8 @@ void CPU_FluidSolver_CTU(
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const double c_ExtAcc_AuxArray[],
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
@@ -239,7 +256,7 @@ void CPU_FluidSolver_CTU(
 #     endif
 #     endif // #ifdef __CUDACC__ ... else ...
 
-      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
+      real_fc (*const g_FC_Var_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
       real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
       real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [array_idx];
       real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
@@ -323,6 +340,13 @@ void CPU_FluidSolver_CTU(
 //          --> must update B field before Hydro_FullStepUpdate() since the latter requires
 //              the updated magnetic energy when adopting the dual-energy formalism
 #        ifdef MHD
+#        ifdef MHD_CT_FUSED
+         MHD_ComputeElectric_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
+                                             g_Mag_Array_In[P], g_FC_Flux_1PG, g_PriVar_Half_1PG, PS2, N_FL_FLUX,
+                                             N_HF_VAR, 0, FLU_GHOST_SIZE, dt, dt, dh, StoreElectric, g_Ele_Array[P],
+                                             CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                             Time, GravityType, ExtAcc_Func, c_ExtAcc_AuxArray );
+#        else
          MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
                               N_HF_VAR, 0, dt, dh, StoreElectric, g_Ele_Array[P],
                               CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
@@ -331,12 +355,14 @@ void CPU_FluidSolver_CTU(
          MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
                              g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
 #        endif
+#        endif
 
 
 //       8. full-step evolution of the fluid data
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
                                g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx, c_EoS_AuxArray );
+                               NormPassive, NNorm, c_NormIdx, c_EoS_AuxArray, FuseExtAcc, g_Corner_Array[P],
+                               Time, TimeNew, ExtAcc_Func, c_ExtAcc_AuxArray );
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -352,6 +378,11 @@ void CPU_FluidSolver_CTU(
 // Note        :  1. Ref: (a) Stone et al., ApJS, 178, 137 (2008)
 //                        (b) Gardiner & Stone, J. Comput. Phys., 227, 4123 (2008)
 //                2. Assuming "N_FC_VAR == N_HF_FLUX"
+//                3. Only the half-step fluxes are required for pure hydro
+//                   --> The cell-centered primitive variables computed by Hydro_DataReconstruction() are reused
+//                       for the divergence(B) source terms in MHD and are never recomputed here
+//                4. CPU pure-hydro solver corrects a whole pencil of faces along x at a time (see CTU_TGRAD_PENCIL
+//                   in CUFLU.h) so that the loop over faces can be vectorized
 //
 // Parameter   :  g_FC_Var     : Array to store the input and output face-centered conserved variables
 //                               --> Accessed with the stride N_FC_VAR
@@ -366,7 +397,7 @@ void CPU_FluidSolver_CTU(
 //                MinDens/Eint : Density and internal energy floors
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
-void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
+void Hydro_TGradientCorrection(       real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
                                 const real g_FC_Flux  [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                                 const real g_FC_B_In  [][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
@@ -415,6 +446,59 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
       const int size_k  = ( N_FC_VAR - 2*nskip[2] );
       const int size_ij = size_i*size_j;
 
+#     ifdef CTU_TGRAD_PENCIL
+//    CPU: one pencil of faces along x at a time
+      for (int k0=0; k0<size_k; k0++)
+      for (int j0=0; j0<size_j; j0++)
+      {
+         const int idx_fc_var = IDX321( nskip[0], j0+nskip[1], k0+nskip[2], N_FC_VAR, N_FC_VAR );
+
+//       1. calculate the transverse fluid flux gradients and update the corresponding face-centered fluid variables
+//          --> assuming N_FC_VAR == N_HF_FLUX
+         for (int v=0; v<NCOMP_TOTAL; v++)
+         {
+                  real_fc *FC_VarL = g_FC_Var [faceL][v] + idx_fc_var;
+                  real_fc *FC_VarR = g_FC_Var [faceR][v] + idx_fc_var;
+            const real    *FluxR1  = g_FC_Flux[TDir1][v] + idx_fc_var;
+            const real    *FluxR2  = g_FC_Flux[TDir2][v] + idx_fc_var;
+            const real    *FluxL1  = FluxR1 - didx_flux[TDir1];
+            const real    *FluxL2  = FluxR2 - didx_flux[TDir2];
+
+#           pragma omp simd
+            for (int i0=0; i0<size_i; i0++)
+            {
+               const real TGrad1  = FluxR1[i0] - FluxL1[i0];
+               const real TGrad2  = FluxR2[i0] - FluxL2[i0];
+               const real Correct = -dt_dh2*( TGrad1 + TGrad2 );
+
+               FC_VarL[i0] += Correct;
+               FC_VarR[i0] += Correct;
+            }
+         }
+
+//       2. apply density and internal energy floors
+         for (int f=0; f<2; f++)
+         {
+            real_fc (*const FC_Var)[ CUBE(N_FC_VAR) ] = g_FC_Var[ faceL + f ];
+
+            for (int i0=0; i0<size_i; i0++)
+            {
+               const int  idx  = idx_fc_var + i0;
+               const real Emag = NULL_REAL;
+
+               FC_Var[0][idx] = FMAX( FC_Var[0][idx], MinDens );
+               FC_Var[4][idx] = Hydro_CheckMinEintInEngy( FC_Var[0][idx], FC_Var[1][idx], FC_Var[2][idx], FC_Var[3][idx],
+                                                          FC_Var[4][idx], MinEint, Emag );
+#              if ( NCOMP_PASSIVE > 0 )
+               for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+               FC_Var[v][idx] = FMAX( FC_Var[v][idx], TINY_NUMBER );
+#              endif
+            }
+         }
+      } // j0, k0
+
+#     else // #ifdef CTU_TGRAD_PENCIL
+
       CGPU_LOOP( idx0, size_i*size_j*size_k )
       {
 //       i/j/k0 start from zero
@@ -588,6 +672,7 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
          }
 
       } // CGPU_LOOP( idx0, size_i*size_j*size_k )
+#     endif // #ifdef CTU_TGRAD_PENCIL ... else ...
    } // for (int d=0; d<3; d++)
 
 
@@ -34,7 +34,7 @@
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                     real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
@@ -45,7 +45,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const EoS_DP2E_t EoS_DensPres2Eint,
                                const EoS_DP2C_t EoS_DensPres2CSqr,
                                const double EoS_AuxArray[] );
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+void Hydro_ComputeFlux( const real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
@@ -58,7 +58,8 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const double EoS_AuxArray[] );
+                           const double EoS_AuxArray[], const bool FuseExtAcc, const double g_Corner[],
+                           const double TimeOld, const double TimeNew, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
 #if   ( RSOLVER == EXACT )
 void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                 const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
@@ -99,6 +100,17 @@ void MHD_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out
                          const real g_FC_B_In[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                          const real g_EC_Ele[][ CUBE(N_EC_ELE) ],
                          const real dt, const real dh, const int NOut, const int NEle, const int Offset_B_In );
+#ifdef MHD_CT_FUSED
+void MHD_ComputeElectric_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out,
+                                         const real g_FC_B_In[][ FLU_NXT_P1*SQR(FLU_NXT) ],
+                                         const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                         const real g_PriVar[][ CUBE(FLU_NXT) ],
+                                         const int NOut, const int NFlux, const int NPri, const int OffsetPri,
+                                         const int Offset_B_In, const real dt_Ele, const real dt_Mag, const real dh,
+                                         const bool DumpIntEle, real g_IntEle[][NCOMP_ELE][ PS2P1*PS2 ],
+                                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[], const double Time,
+                                         const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
+#endif
 #endif // #ifdef MHD
 #endif // #if ( FLU_SCHEME == MHM_RP )
 
@@ -172,6 +184,9 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                                                        vanLeer + generalized MinMod/extrema-preserving) limiter
 //                MinMod_Coeff           : Coefficient of the generalized MinMod limiter
 //                Time                   : Current physical time                                     (for UNSPLIT_GRAVITY only)
+//                TimeNew                : Physical time after update                                (for FuseExtAcc only)
+//                FuseExtAcc             : Apply the corrector step of the external acceleration in
+//                                         Hydro_FullStepUpdate() (for UNSPLIT_GRAVITY only)
 //                GravityType            : Types of gravity --> self-gravity, external gravity, both (for UNSPLIT_GRAVITY only)
 //                ExtAcc_Func            : Function pointer to the external acceleration routine     (for UNSPLIT_GRAVITY only)
 //                c_ExtAcc_AuxArray      : Auxiliary array for adding external acceleration          (for UNSPLIT_GRAVITY and CPU only)
@@ -212,14 +227,15 @@ void CUFLU_FluidSolver_MHM(
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+         real_fc g_FC_Var      [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff,
@@ -239,7 +255,7 @@ void CPU_FluidSolver_MHM(
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+         real_fc g_FC_Var      [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
@@ -247,7 +263,8 @@ void CPU_FluidSolver_MHM(
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-   const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
    const double c_ExtAcc_AuxArray[],
    const real MinDens, const real MinPres, const real MinEint,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
@@ -295,7 +312,7 @@ void CPU_FluidSolver_MHM(
 #     endif
 #     endif // #ifdef __CUDACC__ ... else ...
 
-      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
+      real_fc (*const g_FC_Var_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
       real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
       real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [array_idx];
       real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
@@ -369,6 +386,12 @@ void CPU_FluidSolver_MHM(
 
 //       1-a-3. evaluate electric field and update B field at the half time-step
 #        ifdef MHD
+#        ifdef MHD_CT_FUSED
+         MHD_ComputeElectric_UpdateMagnetic( g_FC_Mag_Half_1PG[0], g_FC_Mag_Half_1PG[1], g_FC_Mag_Half_1PG[2],
+                                             g_Mag_Array_In[P], g_Flux_Half_1PG, g_PriVar_1PG, N_HF_VAR, N_HF_FLUX,
+                                             FLU_NXT, 0, 1, dt, (real)0.5*dt, dh, StoreElectric_No, NULL,
+                                             CorrHalfVel_No, NULL, NULL, NULL_REAL, GRAVITY_NONE, NULL, NULL );
+#        else
          MHD_ComputeElectric( g_EC_Ele_1PG, g_Flux_Half_1PG, g_PriVar_1PG, N_HF_ELE, N_HF_FLUX,
                               FLU_NXT, 0, dt, dh, StoreElectric_No, NULL,
                               CorrHalfVel_No, NULL, NULL, NULL_REAL, GRAVITY_NONE, NULL, NULL );
@@ -376,6 +399,7 @@ void CPU_FluidSolver_MHM(
          MHD_UpdateMagnetic( g_FC_Mag_Half_1PG[0], g_FC_Mag_Half_1PG[1], g_FC_Mag_Half_1PG[2],
                              g_Mag_Array_In[P], g_EC_Ele_1PG, (real)0.5*dt, dh, N_HF_VAR, N_HF_ELE, 1 );
 #        endif
+#        endif
 
 
 //       1-a-4. evaluate the half-step solutions
@@ -426,6 +450,13 @@ void CPU_FluidSolver_MHM(
 //          --> must update B field before Hydro_FullStepUpdate() since the latter requires
 //              the updated magnetic energy when adopting the dual-energy formalism
 #        ifdef MHD
+#        ifdef MHD_CT_FUSED
+         MHD_ComputeElectric_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
+                                             g_Mag_Array_In[P], g_FC_Flux_1PG, g_PriVar_Half_1PG, PS2, N_FL_FLUX,
+                                             N_HF_VAR, LR_GHOST_SIZE, FLU_GHOST_SIZE, dt, dt, dh, StoreElectric, g_Ele_Array[P],
+                                             CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                             Time, GravityType, ExtAcc_Func, c_ExtAcc_AuxArray );
+#        else
          MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
                               N_HF_VAR, LR_GHOST_SIZE, dt, dh, StoreElectric, g_Ele_Array[P],
                               CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
@@ -434,12 +465,14 @@ void CPU_FluidSolver_MHM(
          MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
                              g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
 #        endif
+#        endif
 
 
 //       4. full-step evolution
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
                                g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx, c_EoS_AuxArray );
+                               NormPassive, NNorm, c_NormIdx, c_EoS_AuxArray, FuseExtAcc, g_Corner_Array[P],
+                               Time, TimeNew, ExtAcc_Func, c_ExtAcc_AuxArray );
 
       } // loop over all patch groups
    } // OpenMP parallel region
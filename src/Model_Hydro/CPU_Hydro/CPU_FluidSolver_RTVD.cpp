@@ -182,7 +182,13 @@ void CPU_FluidSolver_RTVD(
 // Function    :  CPU_AdvanceX
 // Description :  Use CPU to advance a single patch group by one time-step in the x direction
 //
-// Note        :  Based on the TVD scheme
+// Note        :  1. Based on the TVD scheme
+//                2. Advance a block of RTVD_NPENCIL pencils (i.e., columns along x) at a time
+//                   --> Local arrays are organized as [variable][cell][pencil] so that the loops over pencils
+//                       can be vectorized and the whole block stays in cache
+//                   --> Pressure and energy floors are applied in separate loops since they invoke external
+//                       functions
+//                   --> Each pencil is computed by the same floating-point operations as advancing it alone
 //
 // Parameter   :  u                 : Input fluid array
 //                dt                : Time interval to advance solution
@@ -213,27 +219,40 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
    const int  k_start          = k_skip;
    const int  j_end            = FLU_NXT-j_skip;
    const int  k_end            = FLU_NXT-k_skip;
+   const int  NPencil_j        = j_end - j_start;
+   const int  NPencil          = NPencil_j*( k_end - k_start );
 
 // set local variables
-   real ux     [5][FLU_NXT];              // one column of u in x direction
-   real u_half [5][FLU_NXT];              // u in the midpoint
-   real flux   [5][FLU_NXT];              // flux defined in the right-hand surface of cell
-   real cu     [5][FLU_NXT];              // freezing speed c * u
-   real cw     [5][FLU_NXT];              // freezing speed c * w ( == flux defined in the center of cell )
-   real RLflux [5][FLU_NXT];              // right/left-moving flux ( defined in the right-hand surface of cell )
-   real c;                                // freezing speed ( == abs(vx) + sound speed )
-   real _rho, vx, p;                      // one over rho, velocity in x direction, pressure
+// --> the last dimension is the pencil index within a block of pencils
+   real ux     [5][FLU_NXT][RTVD_NPENCIL];    // RTVD_NPENCIL columns of u in x direction
+   real u_half [5][FLU_NXT][RTVD_NPENCIL];    // u in the midpoint
+   real flux   [5][FLU_NXT][RTVD_NPENCIL];    // flux defined in the right-hand surface of cell
+   real cu     [5][FLU_NXT][RTVD_NPENCIL];    // freezing speed c * u
+   real cw     [5][FLU_NXT][RTVD_NPENCIL];    // freezing speed c * w ( == flux defined in the center of cell )
+   real RLflux [5][FLU_NXT][RTVD_NPENCIL];    // right/left-moving flux ( defined in the right-hand surface of cell )
+   real pres      [FLU_NXT][RTVD_NPENCIL];    // pressure
+   int  j_pen[RTVD_NPENCIL], k_pen[RTVD_NPENCIL];  // j/k indices of each pencil
+
+
+   for (int n0=0; n0<NPencil; n0+=RTVD_NPENCIL)
+   {
+      const int NP = MIN( RTVD_NPENCIL, NPencil-n0 );
 
-   int ip, im;
-   real Temp;
+      for (int n=0; n<NP; n++)
+      {
+         j_pen[n] = j_start + (n0+n)%NPencil_j;
+         k_pen[n] = k_start + (n0+n)/NPencil_j;
+      }
 
 
-   for (int k=k_start; k<k_end; k++)
-   for (int j=j_start; j<j_end; j++)
-   {
+//    copy NP columns of data from u to ux
+      for (int n=0; n<NP; n++)
+      for (int v=0; v<5; v++)
+      {
+         const real *u_col = &u[v][ to1D(k_pen[n],j_pen[n],0) ];
 
-//    copy one column of data from u to ux
-      for (int v=0; v<5; v++)    memcpy( ux[v], &u[v][to1D(k,j,0)], FLU_NXT*sizeof(real) );
+         for (int i=0; i<FLU_NXT; i++)    ux[v][i][n] = u_col[i];
+      }
 
 
 //    a. Evaluate the half-step values of fluid variables
@@ -241,35 +260,44 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
 
 //    (a1). set variables defined in the center of cell
       for (int i=0; i<FLU_NXT; i++)
+      for (int n=0; n<NP; n++)
       {
-         _rho = (real)1.0 / ux[0][i];
-         vx   = _rho * ux[1][i];
-         p    = Hydro_Con2Pres( ux[0][i], ux[1][i], ux[2][i], ux[3][i], ux[4][i], Passive,
-                                CheckMinPres_Yes, MinPres, NULL_REAL, EoS_DensEint2Pres, EoS_AuxArray, NULL );
+         pres[i][n] = Hydro_Con2Pres( ux[0][i][n], ux[1][i][n], ux[2][i][n], ux[3][i][n], ux[4][i][n], Passive,
+                                      CheckMinPres_Yes, MinPres, NULL_REAL, EoS_DensEint2Pres, EoS_AuxArray, NULL );
 
 #        ifdef CHECK_NEGATIVE_IN_FLUID
-         if ( Hydro_CheckNegative(p) )
+         if ( Hydro_CheckNegative(pres[i][n]) )
             Aux_Message( stderr, "ERROR : invalid pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         p, __FILE__, __LINE__, __FUNCTION__ );
+                         pres[i][n], __FILE__, __LINE__, __FUNCTION__ );
 
-         if ( Hydro_CheckNegative(ux[0][i]) )
+         if ( Hydro_CheckNegative(ux[0][i][n]) )
             Aux_Message( stderr, "ERROR : invalid density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         ux[0][i], __FILE__, __LINE__, __FUNCTION__ );
+                         ux[0][i][n], __FILE__, __LINE__, __FUNCTION__ );
 #        endif
+      }
 
-         c    = FABS( vx ) + SQRT(  EoS_DensPres2CSqr( ux[0][i], p, Passive, EoS_AuxArray )  );
-
-         cw[0][i] = ux[1][i];
-         cw[1][i] = ux[1][i] * vx + p;
-         cw[2][i] = ux[2][i] * vx;
-         cw[3][i] = ux[3][i] * vx;
-         cw[4][i] = ( ux[4][i] + p ) * vx;
-
-         cu[0][i] = c*ux[0][i];
-         cu[1][i] = c*ux[1][i];
-         cu[2][i] = c*ux[2][i];
-         cu[3][i] = c*ux[3][i];
-         cu[4][i] = c*ux[4][i];
+      for (int i=0; i<FLU_NXT; i++)
+      {
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+         {
+            const real _rho = (real)1.0 / ux[0][i][n];
+            const real vx   = _rho * ux[1][i][n];
+            const real p    = pres[i][n];
+            const real c    = FABS( vx ) + SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, ux[0][i][n], p, Passive, EoS_AuxArray )  );
+
+            cw[0][i][n] = ux[1][i][n];
+            cw[1][i][n] = ux[1][i][n] * vx + p;
+            cw[2][i][n] = ux[2][i][n] * vx;
+            cw[3][i][n] = ux[3][i][n] * vx;
+            cw[4][i][n] = ( ux[4][i][n] + p ) * vx;
+
+            cu[0][i][n] = c*ux[0][i][n];
+            cu[1][i][n] = c*ux[1][i][n];
+            cu[2][i][n] = c*ux[2][i][n];
+            cu[3][i][n] = c*ux[3][i][n];
+            cu[4][i][n] = c*ux[4][i][n];
+         }
       } // for (int i=0; i<FLU_NXT; i++)
 
 
@@ -277,8 +305,11 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
       for (int v=0; v<5; v++)
       for (int i=0; i<FLU_NXT-1; i++)
       {
-         ip = i+1;
-         flux[v][i] = (real)0.5*(  ( cu[v][i]+cw[v][i] ) - ( cu[v][ip]-cw[v][ip] )  );
+         const int ip = i+1;
+
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+            flux[v][i][n] = (real)0.5*(  ( cu[v][i][n]+cw[v][i][n] ) - ( cu[v][ip][n]-cw[v][ip][n] )  );
       }
 
 
@@ -286,17 +317,21 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
       for (int v=0; v<5; v++)
       for (int i=1; i<FLU_NXT-1; i++)
       {
-         im = i-1;
-         u_half[v][i] = ux[v][i] - _dx*dt_half*( flux[v][i]-flux[v][im] ) ;
+         const int im = i-1;
+
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+            u_half[v][i][n] = ux[v][i][n] - _dx*dt_half*( flux[v][i][n]-flux[v][im][n] ) ;
       }
 
 
 //    (a4). apply density and internal energy floors
       for (int i=1; i<FLU_NXT-1; i++)
+      for (int n=0; n<NP; n++)
       {
-         u_half[0][i] = FMAX( u_half[0][i], MinDens );
-         u_half[4][i] = Hydro_CheckMinEintInEngy( u_half[0][i], u_half[1][i], u_half[2][i], u_half[3][i], u_half[4][i],
-                                                  MinEint, NULL_REAL );
+         u_half[0][i][n] = FMAX( u_half[0][i][n], MinDens );
+         u_half[4][i][n] = Hydro_CheckMinEintInEngy( u_half[0][i][n], u_half[1][i][n], u_half[2][i][n], u_half[3][i][n],
+                                                     u_half[4][i][n], MinEint, NULL_REAL );
       }
 
 
@@ -306,54 +341,71 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
 
 //    (b1). reset variables defined in the center of cell at the intermidate state
       for (int i=1; i<FLU_NXT-1; i++)
+      for (int n=0; n<NP; n++)
       {
-         _rho = (real)1.0 / u_half[0][i];
-         vx   = _rho * u_half[1][i];
-         p    = Hydro_Con2Pres( u_half[0][i], u_half[1][i], u_half[2][i], u_half[3][i], u_half[4][i], Passive,
-                                CheckMinPres_Yes, MinPres, NULL_REAL, EoS_DensEint2Pres, EoS_AuxArray, NULL );
+         pres[i][n] = Hydro_Con2Pres( u_half[0][i][n], u_half[1][i][n], u_half[2][i][n], u_half[3][i][n], u_half[4][i][n],
+                                      Passive, CheckMinPres_Yes, MinPres, NULL_REAL, EoS_DensEint2Pres, EoS_AuxArray, NULL );
 
 #        ifdef CHECK_NEGATIVE_IN_FLUID
-         if ( Hydro_CheckNegative(p) )
+         if ( Hydro_CheckNegative(pres[i][n]) )
             Aux_Message( stderr, "ERROR : invalid pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         p, __FILE__, __LINE__, __FUNCTION__ );
+                         pres[i][n], __FILE__, __LINE__, __FUNCTION__ );
 
-         if ( Hydro_CheckNegative(u_half[0][i]) )
+         if ( Hydro_CheckNegative(u_half[0][i][n]) )
             Aux_Message( stderr, "ERROR : invalid density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         u_half[0][i], __FILE__, __LINE__, __FUNCTION__ );
+                         u_half[0][i][n], __FILE__, __LINE__, __FUNCTION__ );
 #        endif
-
-         c    = FABS( vx ) + SQRT(  EoS_DensPres2CSqr( u_half[0][i], p, Passive, EoS_AuxArray )  );
-
-         cw[0][i] = u_half[1][i];
-         cw[1][i] = u_half[1][i] * vx + p;
-         cw[2][i] = u_half[2][i] * vx;
-         cw[3][i] = u_half[3][i] * vx;
-         cw[4][i] = ( u_half[4][i] + p ) * vx;
-
-         cu[0][i] = c*u_half[0][i];
-         cu[1][i] = c*u_half[1][i];
-         cu[2][i] = c*u_half[2][i];
-         cu[3][i] = c*u_half[3][i];
-         cu[4][i] = c*u_half[4][i];
       }
 
+      for (int i=1; i<FLU_NXT-1; i++)
+      {
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+         {
+            const real _rho = (real)1.0 / u_half[0][i][n];
+            const real vx   = _rho * u_half[1][i][n];
+            const real p    = pres[i][n];
+            const real c    = FABS( vx ) + SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, u_half[0][i][n], p, Passive, EoS_AuxArray )  );
+
+            cw[0][i][n] = u_half[1][i][n];
+            cw[1][i][n] = u_half[1][i][n] * vx + p;
+            cw[2][i][n] = u_half[2][i][n] * vx;
+            cw[3][i][n] = u_half[3][i][n] * vx;
+            cw[4][i][n] = ( u_half[4][i][n] + p ) * vx;
+
+            cu[0][i][n] = c*u_half[0][i][n];
+            cu[1][i][n] = c*u_half[1][i][n];
+            cu[2][i][n] = c*u_half[2][i][n];
+            cu[3][i][n] = c*u_half[3][i][n];
+            cu[4][i][n] = c*u_half[4][i][n];
+         }
+      } // for (int i=1; i<FLU_NXT-1; i++)
+
 
 //    (b2). set the right-moving flux defined in the right-hand surface by the TVD scheme
       for (int v=0; v<5; v++)
       for (int i=1; i<FLU_NXT-2; i++)
-         RLflux[v][i] = (real)0.5*( cu[v][i] + cw[v][i] );
-
+      {
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+            RLflux[v][i][n] = (real)0.5*( cu[v][i][n] + cw[v][i][n] );
+      }
 
       for (int v=0; v<5; v++)
       for (int i=2; i<FLU_NXT-3; i++)
       {
-         im = i-1; ip = i+1;
+         const int im = i-1;
+         const int ip = i+1;
 
-         flux[v][i] = RLflux[v][i];
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+         {
+            const real Temp = ( RLflux[v][ip][n]-RLflux[v][i][n] ) * ( RLflux[v][i][n]-RLflux[v][im][n] );
 
-         Temp = ( RLflux[v][ip]-RLflux[v][i] ) * ( RLflux[v][i]-RLflux[v][im] );
+            flux[v][i][n] = RLflux[v][i][n];
 
-         if ( Temp > (real)0.0 )    flux[v][i] += Temp / ( RLflux[v][ip]-RLflux[v][im] );
+            if ( Temp > (real)0.0 )    flux[v][i][n] += Temp / ( RLflux[v][ip][n]-RLflux[v][im][n] );
+         }
       }
 
 
@@ -361,21 +413,28 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
       for (int v=0; v<5; v++)
       for (int i=1; i<FLU_NXT-2; i++)
       {
-         ip = i+1;
-         RLflux[v][i] = (real)0.5*( cu[v][ip] - cw[v][ip] );
+         const int ip = i+1;
+
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+            RLflux[v][i][n] = (real)0.5*( cu[v][ip][n] - cw[v][ip][n] );
       }
 
       for (int v=0; v<5; v++)
       for (int i=2; i<FLU_NXT-3; i++)
       {
-         im = i-1;
-         ip = i+1;
+         const int im = i-1;
+         const int ip = i+1;
 
-         flux[v][i] -= RLflux[v][i];
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+         {
+            const real Temp = ( RLflux[v][im][n]-RLflux[v][i][n] ) * ( RLflux[v][i][n]-RLflux[v][ip][n] );
 
-         Temp = ( RLflux[v][im]-RLflux[v][i] ) * ( RLflux[v][i]-RLflux[v][ip] );
+            flux[v][i][n] -= RLflux[v][i][n];
 
-         if ( Temp > (real)0.0 )    flux[v][i] -= Temp / ( RLflux[v][im]-RLflux[v][ip] );
+            if ( Temp > (real)0.0 )    flux[v][i][n] -= Temp / ( RLflux[v][im][n]-RLflux[v][ip][n] );
+         }
       }
 
 
@@ -383,31 +442,36 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
       for (int v=0; v<5; v++)
       for (int i=3; i<FLU_NXT-3; i++)
       {
-         im = i-1;
-         ux[v][i] -= _dx*dt*( flux[v][i] - flux[v][im] );
+         const int im = i-1;
+
+#        pragma omp simd
+         for (int n=0; n<NP; n++)
+            ux[v][i][n] -= _dx*dt*( flux[v][i][n] - flux[v][im][n] );
       }
 
 
 //    (b5). apply density and internal energy floors
       for (int i=3; i<FLU_NXT-3; i++)
+      for (int n=0; n<NP; n++)
       {
-         ux[0][i] = FMAX( ux[0][i], MinDens );
-         ux[4][i] = Hydro_CheckMinEintInEngy( ux[0][i], ux[1][i], ux[2][i], ux[3][i], ux[4][i],
-                                              MinEint, NULL_REAL );
+         ux[0][i][n] = FMAX( ux[0][i][n], MinDens );
+         ux[4][i][n] = Hydro_CheckMinEintInEngy( ux[0][i][n], ux[1][i][n], ux[2][i][n], ux[3][i][n], ux[4][i][n],
+                                                 MinEint, NULL_REAL );
       }
 
 
 //    (b6). check negative density and energy
 #     ifdef CHECK_NEGATIVE_IN_FLUID
       for (int i=3; i<FLU_NXT-3; i++)
+      for (int n=0; n<NP; n++)
       {
-         if ( Hydro_CheckNegative(ux[0][i]) )
+         if ( Hydro_CheckNegative(ux[0][i][n]) )
             Aux_Message( stderr, "ERROR : invalid density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         ux[0][i], __FILE__, __LINE__, __FUNCTION__ );
+                         ux[0][i][n], __FILE__, __LINE__, __FUNCTION__ );
 
-         if ( Hydro_CheckNegative(ux[4][i]) )
+         if ( Hydro_CheckNegative(ux[4][i][n]) )
             Aux_Message( stderr, "ERROR : invalid energy (%14.7e) at file <%s>, line <%d>, function <%s>\n",
-                         ux[4][i], __FILE__, __LINE__, __FUNCTION__ );
+                         ux[4][i][n], __FILE__, __LINE__, __FUNCTION__ );
       }
 #     endif
 
@@ -415,24 +479,34 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
 
 //    c. Save results
 //-----------------------------------------------------------------------------
+      for (int n=0; n<NP; n++)
+      {
+         const int j = j_pen[n];
+         const int k = k_pen[n];
+
+//       (c1). save the final result back to array u
+         for (int v=0; v<5; v++)
+         {
+            real *u_col = &u[v][ to1D(k,j,0) ];
 
-//    (c1). save the final result back to array u
-      for (int v=0; v<5; v++)    memcpy( &u[v][to1D(k,j,3)], ux[v]+3, (FLU_NXT-6)*sizeof(real) );
+            for (int i=3; i<FLU_NXT-3; i++)  u_col[i] = ux[v][i][n];
+         }
 
 
-//    (c2). save the flux required by the flux-correction operation
-      if ( StoreFlux )
-      if (  ( j>=3 && j<FLU_NXT-3 ) && ( k>=3 && k<FLU_NXT-3 )  )
-      {
-         for (int v=0; v<5; v++)
+//       (c2). save the flux required by the flux-correction operation
+         if ( StoreFlux )
+         if (  ( j>=3 && j<FLU_NXT-3 ) && ( k>=3 && k<FLU_NXT-3 )  )
          {
-            u[v][ to1D(k,j,        2) ] = flux[v][          2];
-            u[v][ to1D(k,j,FLU_NXT-3) ] = flux[v][FLU_NXT - 4];
-            u[v][ to1D(k,j,        0) ] = flux[v][FLU_NXT/2-1];
+            for (int v=0; v<5; v++)
+            {
+               u[v][ to1D(k,j,        2) ] = flux[v][          2][n];
+               u[v][ to1D(k,j,FLU_NXT-3) ] = flux[v][FLU_NXT - 4][n];
+               u[v][ to1D(k,j,        0) ] = flux[v][FLU_NXT/2-1][n];
+            }
          }
-      }
+      } // for (int n=0; n<NP; n++)
 
-   } // for (int j=j_start; j<j_end; j++) ... for (int k=k_start; k<k_end; k++)
+   } // for (int n0=0; n0<NPencil; n0+=RTVD_NPENCIL)
 
 } // FUNCTION : CPU_AdvanceX
 
@@ -447,7 +521,7 @@ void CPU_AdvanceX( real u[][ CUBE(FLU_NXT) ], const real dt, const real dx,
 void TransposeXY( real u[][ CUBE(FLU_NXT) ] )
 {
 
-   real (*u_xy)[FLU_NXT*FLU_NXT] = new real [5][FLU_NXT*FLU_NXT];
+   real u_xy[5][FLU_NXT*FLU_NXT];   // one x-y plane only --> no need to allocate it on the heap
    int ID;
 
    for (int k=0; k<FLU_NXT; k++)
@@ -467,8 +541,6 @@ void TransposeXY( real u[][ CUBE(FLU_NXT) ] )
       for (int v=0; v<5; v++)    memcpy( &u[v][to1D(k,0,0)], u_xy[v], FLU_NXT*FLU_NXT*sizeof(real) );
    }
 
-   delete [] u_xy;
-
 } // FUNCTION : TrasposeXY
 
 
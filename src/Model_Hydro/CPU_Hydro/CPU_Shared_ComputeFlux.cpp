@@ -24,6 +24,12 @@
 # include "CUFLU_Shared_RiemannSolver_HLLD.cu"
 #endif
 
+#if   ( RSOLVER_HYBRID == ROE )
+# include "CUFLU_Shared_RiemannSolver_Roe.cu"
+#elif ( RSOLVER_HYBRID == HLLE )
+# include "CUFLU_Shared_RiemannSolver_HLLE.cu"
+#endif
+
 #else // #ifdef __CUDACC__
 
 #if   ( RSOLVER == EXACT )
@@ -48,9 +54,59 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
                                const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
 #endif
 
+#if   ( RSOLVER_HYBRID == ROE )
+void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                              const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                              const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#elif ( RSOLVER_HYBRID == HLLE )
+void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#endif
+
+#ifdef RSOLVER_BATCH
+#if   ( RSOLVER_ALL == ROE )
+void Hydro_RiemannSolver_Roe_Batch( const int XYZ, const int NBatch, real_fc Flux_Out[][N_FC_VAR],
+                                    const real_fc L_In[][N_FC_VAR], const real_fc R_In[][N_FC_VAR],
+                                    const real_fc MinDens, const real_fc MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                    const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#elif ( RSOLVER_ALL == HLLE )
+void Hydro_RiemannSolver_HLLE_Batch( const int XYZ, const int NBatch, real_fc Flux_Out[][N_FC_VAR],
+                                     const real_fc L_In[][N_FC_VAR], const real_fc R_In[][N_FC_VAR],
+                                     const real_fc MinPres, const double EoS_AuxArray[] );
+#elif ( RSOLVER_ALL == HLLC )
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NBatch, real_fc Flux_Out[][N_FC_VAR],
+                                     const real_fc L_In[][N_FC_VAR], const real_fc R_In[][N_FC_VAR],
+                                     const real_fc MinPres, const double EoS_AuxArray[] );
+#endif
+#endif // #ifdef RSOLVER_BATCH
+
+// number of interfaces solved by RSOLVER_HYBRID/RSOLVER (declared in Main.cpp)
+#ifdef RSOLVER_HYBRID
+extern long NRSolverHybrid[2];
+#endif
+
 #endif // #ifdef __CUDACC__ ... else ...
 
 
+// internal functions
+GPU_DEVICE
+static void Hydro_StoreIntFlux( const int d, const int i_flux, const int j_flux, const int k_flux, const real Flux_1Face[],
+                                real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] );
+#ifdef UNSPLIT_GRAVITY
+GPU_DEVICE
+static void Hydro_CorrHalfVel_1Face( real ConVar_L[], real ConVar_R[], const int d, const int i_fc, const int j_fc, const int k_fc,
+                                     const real g_Pot_USG[], const double CrShift[], const real dt, const real dh,
+                                     const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+                                     const double ExtAcc_AuxArray[] );
+#endif
+#ifdef RSOLVER_HYBRID
+GPU_DEVICE
+static bool Hydro_HybridRSolver_Flag( const real L[], const real R[], const real MinPres,
+                                      const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray[] );
+#endif
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -73,6 +129,16 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                   --> Option "DumpIntFlux"
 //                6. For the unsplitting scheme in gravity (i.e., UNSPLIT_GRAVITY), this function also corrects the half-step
 //                   velocity by gravity when CorrHalfVel==true
+//                7. When RSOLVER_BATCH is on (CPU only; see CUFLU.h), fluxes are computed one row along x at a time
+//                   by the batched Riemann solvers (e.g., Hydro_RiemannSolver_Roe_Batch())
+//                8. g_FC_Var[] is stored in real_fc, which is single precision for MIXED_PRECISION
+//                   --> g_FC_Flux[] is always stored in real
+//                9. For RSOLVER_HYBRID, RSOLVER is used only for the interfaces flagged by Hydro_HybridRSolver_Flag()
+//                   and RSOLVER_HYBRID is used for all other interfaces
+//                   --> With RSOLVER_BATCH, all interfaces are solved by the batched RSOLVER_HYBRID first and then
+//                       the flagged interfaces are re-solved by the scalar RSOLVER
+//                   --> The numbers of interfaces solved by the two solvers are accumulated in NRSolverHybrid[]
+//                       (CPU only)
 //
 // Parameter   :  g_FC_Var          : Array storing the input face-centered conserved variables
 //                g_FC_Flux         : Array to store the output face-centered fluxes
@@ -98,7 +164,7 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                EoS_AuxArray      : Auxiliary array for the EoS routines
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+void Hydro_ComputeFlux( const real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
@@ -134,13 +200,22 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
    real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
 
+// structure-of-arrays buffers for solving a whole row of interfaces by the batched Riemann solvers
+#  ifdef RSOLVER_BATCH
+   real_fc Row_L[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR], Row_R[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR], Row_Flux[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR];
+#  endif
+
+// number of interfaces solved by RSOLVER_HYBRID (NFace_Hybrid[0]) and RSOLVER (NFace_Hybrid[1])
+#  ifdef RSOLVER_HYBRID
+   long NFace_Hybrid[2] = { 0, 0 };
+#  ifdef RSOLVER_BATCH
+   bool Row_Flag[N_FC_VAR];
+#  endif
+#  endif
+
 #  ifdef UNSPLIT_GRAVITY
-   const real   GraConst    = -(real)0.5*dt/dh;
-   const int    didx_usg[3] = { 1, USG_NXT_F, SQR(USG_NXT_F) };
    const int    fc_ghost    = ( N_FC_VAR - PS2 )/2;         // number of ghost zones on each side for g_FC_Var[]
    const int    idx_fc2usg  = USG_GHOST_SIZE_F - fc_ghost;  // index difference between g_FC_Var[] and g_Pot_USG[]
-   const double dh_half     = 0.5*(double)dh;               // always use double precision to calculate the cell position
-   const real   dt_half     = (real)0.5*dt;
 
    double CrShift[3];
 
@@ -171,17 +246,6 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
       const int faceL = 2*d;
       const int faceR = faceL+1;
 
-#     ifdef UNSPLIT_GRAVITY
-      int d1, d2, d3;
-
-      if ( CorrHalfVel )
-      {
-         d1 =  d;
-         d2 = (d+1)%3;
-         d3 = (d+2)%3;
-      }
-#     endif
-
       int idx_fc_s[3], idx_flux_e[3];
 
       switch ( d )
@@ -199,6 +263,122 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                   break;
       }
 
+#     ifdef RSOLVER_BATCH
+//    CPU with RSOLVER_BATCH: solve one row of interfaces along x at a time
+      for (int k_flux=0; k_flux<idx_flux_e[2]; k_flux++)
+      for (int j_flux=0; j_flux<idx_flux_e[1]; j_flux++)
+      {
+         const int j_fc = j_flux + idx_fc_s[1];
+         const int k_fc = k_flux + idx_fc_s[2];
+
+//       load the left/right states of the target row
+         for (int i_flux=0; i_flux<idx_flux_e[0]; i_flux++)
+         {
+            const int i_fc   = i_flux + idx_fc_s[0];
+            const int idx_fc = IDX321( i_fc, j_fc, k_fc, N_FC_VAR, N_FC_VAR );
+
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+            {
+               ConVar_L[v] = g_FC_Var[faceR][v][ idx_fc            ];
+               ConVar_R[v] = g_FC_Var[faceL][v][ idx_fc+didx_fc[d] ];
+            }
+
+//          1. correct the half-step velocity by gravity
+#           ifdef UNSPLIT_GRAVITY
+            if ( CorrHalfVel )
+               Hydro_CorrHalfVel_1Face( ConVar_L, ConVar_R, d, i_fc, j_fc, k_fc, g_Pot_USG, CrShift,
+                                        dt, dh, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+#           endif
+
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+            {
+               Row_L[v][i_flux] = ConVar_L[v];
+               Row_R[v][i_flux] = ConVar_R[v];
+            }
+         } // for (int i_flux=0; i_flux<idx_flux_e[0]; i_flux++)
+
+
+//       2. invoke the batched Riemann solver
+//       2-1. flag the interfaces to be re-solved by RSOLVER for RSOLVER_HYBRID
+//            --> same as Hydro_HybridRSolver_Flag() for pure hydro with EOS_GAMMA
+#        ifdef RSOLVER_HYBRID
+         const real_fc PJump    = (real_fc)RSOLVER_HYBRID_PJUMP;
+         const real_fc Gamma_m1 = (real_fc)EOS_AUX_GAMMA_M1(EoS_AuxArray);
+         int NFlag = 0;
+
+#        pragma omp simd reduction( +:NFlag )
+         for (int i_flux=0; i_flux<idx_flux_e[0]; i_flux++)
+         {
+            real_fc P_L, P_R;
+
+            P_L = (  Row_L[4][i_flux] - (real_fc)0.5*( SQR(Row_L[1][i_flux]) + SQR(Row_L[2][i_flux]) + SQR(Row_L[3][i_flux]) )
+                                        / Row_L[0][i_flux]  )*Gamma_m1;
+            P_R = (  Row_R[4][i_flux] - (real_fc)0.5*( SQR(Row_R[1][i_flux]) + SQR(Row_R[2][i_flux]) + SQR(Row_R[3][i_flux]) )
+                                        / Row_R[0][i_flux]  )*Gamma_m1;
+            P_L = FMAX_SIMD( P_L, (real_fc)MinPres );
+            P_R = FMAX_SIMD( P_R, (real_fc)MinPres );
+
+            Row_Flag[i_flux]  = (  FABS( P_L - P_R ) > PJump*FMIN_SIMD( P_L, P_R )  );
+            NFlag            += Row_Flag[i_flux];
+         }
+
+         NFace_Hybrid[0] += idx_flux_e[0] - NFlag;
+         NFace_Hybrid[1] += NFlag;
+#        endif // #ifdef RSOLVER_HYBRID
+
+//       2-2. solve all interfaces in the target row
+#        if   ( RSOLVER_ALL == ROE )
+         Hydro_RiemannSolver_Roe_Batch ( d, idx_flux_e[0], Row_Flux, Row_L, Row_R, MinDens, MinPres,
+                                         EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#        elif ( RSOLVER_ALL == HLLE )
+         Hydro_RiemannSolver_HLLE_Batch( d, idx_flux_e[0], Row_Flux, Row_L, Row_R, MinPres, EoS_AuxArray );
+#        elif ( RSOLVER_ALL == HLLC )
+         Hydro_RiemannSolver_HLLC_Batch( d, idx_flux_e[0], Row_Flux, Row_L, Row_R, MinPres, EoS_AuxArray );
+#        else
+#        error : ERROR : unsupported Riemann solver for RSOLVER_BATCH (ROE/HLLE/HLLC) !!
+#        endif
+
+
+         for (int i_flux=0; i_flux<idx_flux_e[0]; i_flux++)
+         {
+            const int idx_flux = IDX321( i_flux, j_flux, k_flux, NFlux, NFlux );
+
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   Flux_1Face[v] = Row_Flux[v][i_flux];
+
+//          2-3. re-solve the flagged interfaces by the scalar RSOLVER for RSOLVER_HYBRID
+#           ifdef RSOLVER_HYBRID
+            if ( Row_Flag[i_flux] )
+            {
+               for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+               {
+                  ConVar_L[v] = Row_L[v][i_flux];
+                  ConVar_R[v] = Row_R[v][i_flux];
+               }
+
+#              if   ( RSOLVER == EXACT )
+               Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#              elif ( RSOLVER == ROE )
+               Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#              elif ( RSOLVER == HLLE )
+               Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#              elif ( RSOLVER == HLLC )
+               Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#              else
+#              error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC) !!
+#              endif
+            }
+#           endif // #ifdef RSOLVER_HYBRID
+
+//          3. store the fluxes of all cells in g_FC_Flux[]
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
+
+//          4. store the inter-patch fluxes in g_IntFlux[]
+            if ( DumpIntFlux )   Hydro_StoreIntFlux( d, i_flux, j_flux, k_flux, Flux_1Face, g_IntFlux );
+         }
+      } // j,k
+
+#     else // #ifdef RSOLVER_BATCH
+
       const int size_ij = idx_flux_e[0]*idx_flux_e[1];
       CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
       {
@@ -222,59 +402,32 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 //       1. correct the half-step velocity by gravity
 #        ifdef UNSPLIT_GRAVITY
          if ( CorrHalfVel )
-         {
-            real   Acc[3], Enki_L, Enki_R;
-            double xyz[3];
-
-            Acc[0] = (real)0.0;
-            Acc[1] = (real)0.0;
-            Acc[2] = (real)0.0;
-
-//          external gravity
-            if ( GravityType == GRAVITY_EXTERNAL  ||  GravityType == GRAVITY_BOTH )
-            {
-//             xyz[]: face-centered coordinates
-               xyz[0]  = CrShift[0] + (double)(i_fc*dh);
-               xyz[1]  = CrShift[1] + (double)(j_fc*dh);
-               xyz[2]  = CrShift[2] + (double)(k_fc*dh);
-               xyz[d] += dh_half;
-
-               ExtAcc_Func( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
-
-               for (int t=0; t<3; t++)    Acc[t] *= dt_half;
-            }
-
-//          self-gravity
-            if ( GravityType == GRAVITY_SELF  ||  GravityType == GRAVITY_BOTH )
-            {
-               const int idx_usg = IDX321( i_fc+idx_fc2usg, j_fc+idx_fc2usg, k_fc+idx_fc2usg, USG_NXT_F, USG_NXT_F );
-
-               Acc[d1] +=            GraConst*( g_Pot_USG[ idx_usg+didx_usg[d1] ] - g_Pot_USG[ idx_usg                           ] );
-               Acc[d2] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d2] ] + g_Pot_USG[ idx_usg+didx_usg[d2]+didx_usg[d1] ]
-                                               -g_Pot_USG[ idx_usg-didx_usg[d2] ] - g_Pot_USG[ idx_usg-didx_usg[d2]+didx_usg[d1] ] );
-               Acc[d3] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d3] ] + g_Pot_USG[ idx_usg+didx_usg[d3]+didx_usg[d1] ]
-                                               -g_Pot_USG[ idx_usg-didx_usg[d3] ] - g_Pot_USG[ idx_usg-didx_usg[d3]+didx_usg[d1] ] );
-            }
-
-//          store the "non"-kinetic energy (i.e. total energy - kinetic energy)
-            Enki_L = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            Enki_R = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+            Hydro_CorrHalfVel_1Face( ConVar_L, ConVar_R, d, i_fc, j_fc, k_fc, g_Pot_USG, CrShift,
+                                     dt, dh, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+#        endif
 
-//          advance velocity by gravity
-            for (int t=0; t<3; t++)
-            {
-               ConVar_L[t+1] += ConVar_L[0]*Acc[t];
-               ConVar_R[t+1] += ConVar_R[0]*Acc[t];
-            }
 
-//          update total energy density with the non-kinetic energy fixed
-            ConVar_L[4] = Enki_L + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            ConVar_R[4] = Enki_R + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
+//       2. invoke Riemann solver
+//       --> RSOLVER_HYBRID: use RSOLVER only for the interfaces flagged by the pressure-jump detector
+#        ifdef RSOLVER_HYBRID
+         if (  ! Hydro_HybridRSolver_Flag( ConVar_L, ConVar_R, MinPres, EoS_DensEint2Pres, EoS_AuxArray )  )
+         {
+#           if   ( RSOLVER_HYBRID == ROE )
+            Hydro_RiemannSolver_Roe ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#           elif ( RSOLVER_HYBRID == HLLE )
+            Hydro_RiemannSolver_HLLE( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+#           else
+#           error : ERROR : unsupported RSOLVER_HYBRID (ROE/HLLE) !!
+#           endif
+
+            NFace_Hybrid[0] ++;
+         }
 
+         else
+         {
+         NFace_Hybrid[1] ++;
+#        endif // #ifdef RSOLVER_HYBRID
 
-//       2. invoke Riemann solver
 #        if   ( RSOLVER == EXACT  &&  !defined MHD )
          Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
 #        elif ( RSOLVER == ROE )
@@ -289,6 +442,10 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 #        error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
 #        endif
 
+#        ifdef RSOLVER_HYBRID
+         } // if ( ! Hydro_HybridRSolver_Flag() ) ... else ...
+#        endif
+
 
 //       3. store the fluxes of all cells in g_FC_Flux[]
 //       --> including the magnetic components since they are required for CT
@@ -296,64 +453,22 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 //       4. store the inter-patch fluxes in g_IntFlux[]
-//       --> no need to store the magnetic components since this array is only for the flux fix-up operation
-         if ( DumpIntFlux )
-         {
-            int int_face, int_idx;
+         if ( DumpIntFlux )   Hydro_StoreIntFlux( d, i_flux, j_flux, k_flux, Flux_1Face, g_IntFlux );
+      } // i,j,k
 
-//          we have assumed N_FC_VAR=PS2+2 for pure hydro
-//          --> for MHD, one additional flux is evaluated along each transverse direction for computing the CT electric field
-//          --> must exclude it when storing the inter-patch fluxes
-            if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
-               {
-                  int_face = i_flux/PS1;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + j_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + j_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
+#     endif // #ifdef RSOLVER_BATCH ... else ...
+   } // for (int d=0; d<3; d++)
 
-            else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
-               {
-                  int_face = j_flux/PS1 + 3;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
 
-            else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
-#              endif
-               {
-                  int_face = k_flux/PS1 + 6;
-#                 ifdef MHD
-                  int_idx  = (j_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (j_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
-         } // if ( DumpIntFlux )
-      } // i,j,k
-   } // for (int d=0; d<3; d++)
+// accumulate the numbers of interfaces solved by RSOLVER_HYBRID and RSOLVER
+// --> not supported by GPU yet
+#  if ( defined RSOLVER_HYBRID  &&  !defined __CUDACC__ )
+   for (int t=0; t<2; t++)
+   {
+#     pragma omp atomic
+      NRSolverHybrid[t] += NFace_Hybrid[t];
+   }
+#  endif
 
 
 #  ifdef __CUDACC__
@@ -364,6 +479,217 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 
+#ifdef RSOLVER_HYBRID
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_HybridRSolver_Flag
+// Description :  Pressure-jump detector of the hybrid Riemann solver
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() for RSOLVER_HYBRID
+//                2. Flag an interface if |P_L-P_R| > RSOLVER_HYBRID_PJUMP*min(P_L,P_R), where P_L/R are the
+//                   total pressures (i.e., including the magnetic pressure for MHD) of the left/right states
+//                3. The batched version is implemented directly in Hydro_ComputeFlux()
+//
+// Parameter   :  L/R               : Left/right states (conserved variables)
+//                MinPres           : Pressure floor
+//                EoS_DensEint2Pres : EoS routine to compute the gas pressure
+//                EoS_AuxArray      : Auxiliary array for the EoS routines
+//
+// Return      :  true  --> solve this interface by RSOLVER
+//                false --> solve this interface by RSOLVER_HYBRID
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+bool Hydro_HybridRSolver_Flag( const real L[], const real R[], const real MinPres,
+                               const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray[] )
+{
+
+   const bool CheckMinPres_Yes = true;
+
+#  ifdef MHD
+   const real Emag_L = (real)0.5*( SQR(L[MAG_OFFSET+0]) + SQR(L[MAG_OFFSET+1]) + SQR(L[MAG_OFFSET+2]) );
+   const real Emag_R = (real)0.5*( SQR(R[MAG_OFFSET+0]) + SQR(R[MAG_OFFSET+1]) + SQR(R[MAG_OFFSET+2]) );
+#  else
+   const real Emag_L = NULL_REAL;
+   const real Emag_R = NULL_REAL;
+#  endif
+
+   real P_L, P_R;
+
+   P_L = Hydro_Con2Pres( L[0], L[1], L[2], L[3], L[4], L+NCOMP_FLUID, CheckMinPres_Yes, MinPres, Emag_L,
+                         EoS_DensEint2Pres, EoS_AuxArray, NULL );
+   P_R = Hydro_Con2Pres( R[0], R[1], R[2], R[3], R[4], R+NCOMP_FLUID, CheckMinPres_Yes, MinPres, Emag_R,
+                         EoS_DensEint2Pres, EoS_AuxArray, NULL );
+
+// total pressure
+#  ifdef MHD
+   P_L += Emag_L;
+   P_R += Emag_R;
+#  endif
+
+   return (  FABS( P_L - P_R ) > (real)RSOLVER_HYBRID_PJUMP*FMIN( P_L, P_R )  );
+
+} // FUNCTION : Hydro_HybridRSolver_Flag
+#endif // #ifdef RSOLVER_HYBRID
+
+
+
+#ifdef UNSPLIT_GRAVITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_CorrHalfVel_1Face
+// Description :  Correct the half-step velocity of the left and right states of one interface by gravity
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() for UNSPLIT_GRAVITY
+//                2. Total energy is updated with the non-kinetic energy fixed
+//
+// Parameter   :  ConVar_L/R      : Left/right states to be corrected
+//                d               : Target spatial direction : (0/1/2) --> (x/y/z)
+//                i/j/k_fc        : Array indices of the left state in g_FC_Var[]
+//                CrShift         : Central coordinates of the 0th cell in g_FC_Var[]
+//                Others          : See Hydro_ComputeFlux()
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+void Hydro_CorrHalfVel_1Face( real ConVar_L[], real ConVar_R[], const int d, const int i_fc, const int j_fc, const int k_fc,
+                              const real g_Pot_USG[], const double CrShift[], const real dt, const real dh,
+                              const double Time, const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+                              const double ExtAcc_AuxArray[] )
+{
+
+   const real   GraConst    = -(real)0.5*dt/dh;
+   const int    didx_usg[3] = { 1, USG_NXT_F, SQR(USG_NXT_F) };
+   const int    fc_ghost    = ( N_FC_VAR - PS2 )/2;         // number of ghost zones on each side for g_FC_Var[]
+   const int    idx_fc2usg  = USG_GHOST_SIZE_F - fc_ghost;  // index difference between g_FC_Var[] and g_Pot_USG[]
+   const double dh_half     = 0.5*(double)dh;               // always use double precision to calculate the cell position
+   const real   dt_half     = (real)0.5*dt;
+   const int    d1          =  d;
+   const int    d2          = (d+1)%3;
+   const int    d3          = (d+2)%3;
+
+   real   Acc[3], Enki_L, Enki_R;
+   double xyz[3];
+
+   Acc[0] = (real)0.0;
+   Acc[1] = (real)0.0;
+   Acc[2] = (real)0.0;
+
+// external gravity
+   if ( GravityType == GRAVITY_EXTERNAL  ||  GravityType == GRAVITY_BOTH )
+   {
+//    xyz[]: face-centered coordinates
+      xyz[0]  = CrShift[0] + (double)(i_fc*dh);
+      xyz[1]  = CrShift[1] + (double)(j_fc*dh);
+      xyz[2]  = CrShift[2] + (double)(k_fc*dh);
+      xyz[d] += dh_half;
+
+      ExtAcc_Func( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
+
+      for (int t=0; t<3; t++)    Acc[t] *= dt_half;
+   }
+
+// self-gravity
+   if ( GravityType == GRAVITY_SELF  ||  GravityType == GRAVITY_BOTH )
+   {
+      const int idx_usg = IDX321( i_fc+idx_fc2usg, j_fc+idx_fc2usg, k_fc+idx_fc2usg, USG_NXT_F, USG_NXT_F );
+
+      Acc[d1] +=            GraConst*( g_Pot_USG[ idx_usg+didx_usg[d1] ] - g_Pot_USG[ idx_usg                           ] );
+      Acc[d2] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d2] ] + g_Pot_USG[ idx_usg+didx_usg[d2]+didx_usg[d1] ]
+                                      -g_Pot_USG[ idx_usg-didx_usg[d2] ] - g_Pot_USG[ idx_usg-didx_usg[d2]+didx_usg[d1] ] );
+      Acc[d3] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d3] ] + g_Pot_USG[ idx_usg+didx_usg[d3]+didx_usg[d1] ]
+                                      -g_Pot_USG[ idx_usg-didx_usg[d3] ] - g_Pot_USG[ idx_usg-didx_usg[d3]+didx_usg[d1] ] );
+   }
+
+// store the "non"-kinetic energy (i.e. total energy - kinetic energy)
+   Enki_L = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+   Enki_R = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+
+// advance velocity by gravity
+   for (int t=0; t<3; t++)
+   {
+      ConVar_L[t+1] += ConVar_L[0]*Acc[t];
+      ConVar_R[t+1] += ConVar_R[0]*Acc[t];
+   }
+
+// update total energy density with the non-kinetic energy fixed
+   ConVar_L[4] = Enki_L + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+   ConVar_R[4] = Enki_R + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+
+} // FUNCTION : Hydro_CorrHalfVel_1Face
+#endif // #ifdef UNSPLIT_GRAVITY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_StoreIntFlux
+// Description :  Store the inter-patch fluxes of one interface in g_IntFlux[]
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() when DumpIntFlux is on
+//                2. No need to store the magnetic components since g_IntFlux[] is only for the flux fix-up operation
+//                3. We have assumed N_FC_VAR=PS2+2 for pure hydro
+//                   --> For MHD, one additional flux is evaluated along each transverse direction for computing
+//                       the CT electric field, which must be excluded when storing the inter-patch fluxes
+//
+// Parameter   :  d          : Target spatial direction : (0/1/2) --> (x/y/z)
+//                i/j/k_flux : Array indices of the target flux (see Hydro_ComputeFlux())
+//                Flux_1Face : Input flux
+//                g_IntFlux  : Array to store the inter-patch fluxes
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+void Hydro_StoreIntFlux( const int d, const int i_flux, const int j_flux, const int k_flux, const real Flux_1Face[],
+                         real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] )
+{
+
+   int int_face, int_idx;
+
+   if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#     endif
+      {
+         int_face = i_flux/PS1;
+#        ifdef MHD
+         int_idx  = (k_flux-1)*PS2 + j_flux-1;
+#        else
+         int_idx  = (k_flux  )*PS2 + j_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+   else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#     endif
+      {
+         int_face = j_flux/PS1 + 3;
+#        ifdef MHD
+         int_idx  = (k_flux-1)*PS2 + i_flux-1;
+#        else
+         int_idx  = (k_flux  )*PS2 + i_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+   else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
+#     endif
+      {
+         int_face = k_flux/PS1 + 6;
+#        ifdef MHD
+         int_idx  = (j_flux-1)*PS2 + i_flux-1;
+#        else
+         int_idx  = (j_flux  )*PS2 + i_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+} // FUNCTION : Hydro_StoreIntFlux
+
+
+
 #endif // #if ( MODEL == HYDRO  &&  (FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU) )
 
 
@@ -21,6 +21,16 @@ static real dE_Upwind( const real FC_Ele_L, const real FC_Ele_R, const real FC_M
                        const real V_L1, const real V_L2, const real V_R1, const real V_R2,
                        const real B_L1, const real B_L2, const real B_R1, const real B_R2,
                        const real dt_dh );
+GPU_DEVICE
+static real MHD_ComputeElectric_OneEdge( const int d, const int i_ele, const int j_ele, const int k_ele,
+                                         const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                         const real g_PriVar[][ CUBE(FLU_NXT) ],
+                                         const int NFlux, const int NPri, const int OffsetPri, const real dt, const real dh,
+                                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[], const double Time,
+                                         const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
+GPU_DEVICE
+static void StoreInterPatchElectric( real g_IntEle[][NCOMP_ELE][ PS2P1*PS2 ], const int d,
+                                     const int i_ele, const int j_ele, const int k_ele, const real Ele );
 #ifdef UNSPLIT_GRAVITY
 GPU_DEVICE
 void UpdateVelocityByGravity( real &v1, real &v2, const int TDir1, const int TDir2,
@@ -105,6 +115,11 @@ void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
 
       if (  ( GravityType == GRAVITY_EXTERNAL || GravityType == GRAVITY_BOTH )  &&  g_Corner == NULL  )
          printf( "ERROR : g_Corner == NULL !!\n" );
+
+      const int idx_pri2usg = USG_GHOST_SIZE_F - ( NPri - PS2 )/2;   // index difference between g_PriVar[] and g_Pot_USG[]
+      if ( idx_pri2usg + OffsetPri < 1 )
+         printf( "ERROR : idx_pri2usg (%d) + OffsetPri (%d) < 1 (USG_GHOST_SIZE_F %d, NPri %d) !!\n",
+                 idx_pri2usg, OffsetPri, USG_GHOST_SIZE_F, NPri );
    }
 #  else
    if ( CorrHalfVel )
@@ -113,11 +128,92 @@ void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
 #  endif // #ifdef GAMER_DEBUG
 
 
-   const int  NEleM1       = NEle - 1;
+   const int NEleM1 = NEle - 1;
+
+   for (int d=0; d<3; d++)
+   {
+      int idx_ele_e[2];
+
+      switch ( d )
+      {
+         case 0 : idx_ele_e[0] = NEleM1;  idx_ele_e[1] = NEle;    break;
+         case 1 : idx_ele_e[0] = NEle;    idx_ele_e[1] = NEleM1;  break;
+         case 2 : idx_ele_e[0] = NEle;    idx_ele_e[1] = NEle;    break;
+      }
+
+      const int size_ij = idx_ele_e[0]*idx_ele_e[1];
+      CGPU_LOOP( idx0, NEleM1*SQR(NEle)  )
+      {
+         const int  i_ele   = idx0 % idx_ele_e[0];
+         const int  j_ele   = idx0 % size_ij / idx_ele_e[0];
+         const int  k_ele   = idx0 / size_ij;
+         const int  idx_ele = IDX321( i_ele, j_ele, k_ele, NEle, NEle );
+
+         const real Ele_Out = MHD_ComputeElectric_OneEdge( d, i_ele, j_ele, k_ele, g_FC_Flux, g_PriVar, NFlux, NPri, OffsetPri,
+                                                           dt, dh, CorrHalfVel, g_Pot_USG, g_Corner, Time,
+                                                           GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+
+//       store the electric field of all cells in g_EC_Ele[]
+         g_EC_Ele[d][idx_ele] = Ele_Out;
+
+//       store the inter-patch electric field in g_IntEle[]
+         if ( DumpIntEle )    StoreInterPatchElectric( g_IntEle, d, i_ele, j_ele, k_ele, Ele_Out );
+      } // CGPU_LOOP( idx0, NEleM1*SQR(NEle) )
+   } // for ( int d=0; d<3; d++)
+
+
+#  ifdef __CUDACC__
+   __syncthreads();
+#  endif
+
+} // FUNCTION : MHD_ComputeElectric
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MHD_ComputeElectric_OneEdge
+// Description :  Compute the edge-centered electric field of a single edge
+//
+// Note        :  1. Invoked by MHD_ComputeElectric() and MHD_ComputeElectric_UpdateMagnetic()
+//                2. EMF-d( i_ele, j_ele, k_ele ) is defined at the lower-left edge center of
+//                   g_PriVar( i_ele+OffsetPri+1, j_ele+OffsetPri+1, k_ele+OffsetPri+1 )
+//                3. See MHD_ComputeElectric() for the other parameters
+//
+// Parameter   :  d           : Direction of the electric field (0/1/2 --> x/y/z)
+//                i/j/k_ele   : Array indices of the target edge
+//
+// Return      :  Edge-centered electric field
+//------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+real MHD_ComputeElectric_OneEdge( const int d, const int i_ele, const int j_ele, const int k_ele,
+                                  const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                  const real g_PriVar[][ CUBE(FLU_NXT) ],
+                                  const int NFlux, const int NPri, const int OffsetPri, const real dt, const real dh,
+                                  const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[], const double Time,
+                                  const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] )
+{
+
    const int  didx_flux[3] = { 1, NFlux, SQR(NFlux) };
    const int  didx_pri [3] = { 1, NPri,  SQR(NPri)  };
    const real dt_dh        = dt / dh;
 
+   const int  TDir1        = (d+1)%3;             // transverse direction 1
+   const int  TDir2        = (d+2)%3;             // transverse direction 2
+   const int  TV1          = TDir1 + 1;           // velocity component along the transverse direction 1
+   const int  TV2          = TDir2 + 1;           // velocity component along the transverse direction 2
+   const int  TB1          = TDir1 + MAG_OFFSET;  // B flux   component along the transverse direction 1
+   const int  TB2          = TDir2 + MAG_OFFSET;  // B flux   component along the transverse direction 2
+
+   const int  i_flux       = i_ele + ( d == 0 );
+   const int  j_flux       = j_ele + ( d == 1 );
+   const int  k_flux       = k_ele + ( d == 2 );
+   const int  idx_flux     = IDX321( i_flux, j_flux, k_flux, NFlux, NFlux );
+
+   const int  i_pri        = i_flux + OffsetPri;
+   const int  j_pri        = j_flux + OffsetPri;
+   const int  k_pri        = k_flux + OffsetPri;
+   const int  idx_pri      = IDX321( i_pri, j_pri, k_pri, NPri, NPri );
+
 #  ifdef UNSPLIT_GRAVITY
    const double dh_f8       = (double)dh;
    const real   GraConst    = -(real)0.25*dt_dh;
@@ -128,251 +224,210 @@ void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
    int    ijk_usg[3];
    double Corner_USG[3];   // central coordinates of the 0th cell in g_Pot_USG[]
    if (  CorrHalfVel  &&  ( GravityType == GRAVITY_EXTERNAL || GravityType == GRAVITY_BOTH )  )
-      for (int d=0; d<3; d++)    Corner_USG[d] = g_Corner[d] - dh_f8*USG_GHOST_SIZE_F;
-
-// check
-#  ifdef GAMER_DEBUG
-   if ( CorrHalfVel  &&  idx_pri2usg + OffsetPri < 1 )
-         printf( "ERROR : idx_pri2usg (%d) + OffsetPri (%d) < 1 (USG_GHOST_SIZE_F %d, NPri %d) !!\n",
-                 idx_pri2usg, OffsetPri, USG_GHOST_SIZE_F, NPri );
+      for (int t=0; t<3; t++)    Corner_USG[t] = g_Corner[t] - dh_f8*USG_GHOST_SIZE_F;
 #  endif
+
+   real D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2;
+   int  idx_L, idx_R;
+   real Ele_Out;
+
+// compute the edge-centered electric field
+   Ele_Out = ( - g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ]
+               - g_FC_Flux[TDir1][TB2][ idx_flux                    ]
+               + g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ]
+               + g_FC_Flux[TDir2][TB1][ idx_flux                    ] );
+
+
+   idx_L = idx_pri;
+   idx_R = idx_L + didx_pri[TDir2];
+   D_L   = g_PriVar[  0][ idx_L ];
+   V_L1  = g_PriVar[TV1][ idx_L ];
+   V_L2  = g_PriVar[TV2][ idx_L ];
+   B_L1  = g_PriVar[TB1][ idx_L ];
+   B_L2  = g_PriVar[TB2][ idx_L ];
+   D_R   = g_PriVar[  0][ idx_R ];
+   V_R1  = g_PriVar[TV1][ idx_R ];
+   V_R2  = g_PriVar[TV2][ idx_R ];
+   B_R1  = g_PriVar[TB1][ idx_R ];
+   B_R2  = g_PriVar[TB2][ idx_R ];
+
+// correct the half-step velocity by gravity for the unsplitting scheme
+#  ifdef UNSPLIT_GRAVITY
+   if ( CorrHalfVel )
+   {
+      ijk_usg[0] = i_pri + idx_pri2usg;
+      ijk_usg[1] = j_pri + idx_pri2usg;
+      ijk_usg[2] = k_pri + idx_pri2usg;
+      UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+
+      ijk_usg[TDir2] ++;
+      UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+   } // if ( CorrHalfVel )
 #  endif // #ifdef UNSPLIT_GRAVITY
 
+   Ele_Out += dE_Upwind( -g_FC_Flux[TDir1][TB2][ idx_flux                    ],
+                         -g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ],
+                          g_FC_Flux[TDir2][  0][ idx_flux                    ],
+                         D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
+
+
+   idx_L = idx_pri + didx_pri[TDir1];
+   idx_R = idx_L   + didx_pri[TDir2];
+   D_L   = g_PriVar[  0][ idx_L ];
+   V_L1  = g_PriVar[TV1][ idx_L ];
+   V_L2  = g_PriVar[TV2][ idx_L ];
+   B_L1  = g_PriVar[TB1][ idx_L ];
+   B_L2  = g_PriVar[TB2][ idx_L ];
+   D_R   = g_PriVar[  0][ idx_R ];
+   V_R1  = g_PriVar[TV1][ idx_R ];
+   V_R2  = g_PriVar[TV2][ idx_R ];
+   B_R1  = g_PriVar[TB1][ idx_R ];
+   B_R2  = g_PriVar[TB2][ idx_R ];
+
+// correct the half-step velocity by gravity for the unsplitting scheme
+#  ifdef UNSPLIT_GRAVITY
+   if ( CorrHalfVel )
+   {
+      ijk_usg[0] = i_pri + idx_pri2usg;
+      ijk_usg[1] = j_pri + idx_pri2usg;
+      ijk_usg[2] = k_pri + idx_pri2usg;
+      ijk_usg[TDir1] ++;
+      UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+
+      ijk_usg[TDir2] ++;
+      UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+   } // if ( CorrHalfVel )
+#  endif // #ifdef UNSPLIT_GRAVITY
 
-   for (int d=0; d<3; d++)
+   Ele_Out += dE_Upwind( -g_FC_Flux[TDir1][TB2][ idx_flux                    ],
+                         -g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ],
+                          g_FC_Flux[TDir2][  0][ idx_flux + didx_flux[TDir1] ],
+                         D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
+
+
+   idx_L = idx_pri;
+   idx_R = idx_L + didx_pri[TDir1];
+   D_L   = g_PriVar[  0][ idx_L ];
+   V_L1  = g_PriVar[TV1][ idx_L ];
+   V_L2  = g_PriVar[TV2][ idx_L ];
+   B_L1  = g_PriVar[TB1][ idx_L ];
+   B_L2  = g_PriVar[TB2][ idx_L ];
+   D_R   = g_PriVar[  0][ idx_R ];
+   V_R1  = g_PriVar[TV1][ idx_R ];
+   V_R2  = g_PriVar[TV2][ idx_R ];
+   B_R1  = g_PriVar[TB1][ idx_R ];
+   B_R2  = g_PriVar[TB2][ idx_R ];
+
+// correct the half-step velocity by gravity for the unsplitting scheme
+#  ifdef UNSPLIT_GRAVITY
+   if ( CorrHalfVel )
    {
-      const int TDir1 = (d+1)%3;             // transverse direction 1
-      const int TDir2 = (d+2)%3;             // transverse direction 2
-      const int TV1   = TDir1 + 1;           // velocity component along the transverse direction 1
-      const int TV2   = TDir2 + 1;           // velocity component along the transverse direction 2
-      const int TB1   = TDir1 + MAG_OFFSET;  // B flux   component along the transverse direction 1
-      const int TB2   = TDir2 + MAG_OFFSET;  // B flux   component along the transverse direction 2
+      ijk_usg[0] = i_pri + idx_pri2usg;
+      ijk_usg[1] = j_pri + idx_pri2usg;
+      ijk_usg[2] = k_pri + idx_pri2usg;
+      UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+
+      ijk_usg[TDir1] ++;
+      UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+   } // if ( CorrHalfVel )
+#  endif // #ifdef UNSPLIT_GRAVITY
 
-      int idx_ele_e[2], idx_flux_s[3];
+   Ele_Out += dE_Upwind( +g_FC_Flux[TDir2][TB1][ idx_flux                    ],
+                         +g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ],
+                          g_FC_Flux[TDir1][  0][ idx_flux                    ],
+                         D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
+
+
+   idx_L = idx_pri + didx_pri[TDir2];
+   idx_R = idx_L   + didx_pri[TDir1];
+   D_L   = g_PriVar[  0][ idx_L ];
+   V_L1  = g_PriVar[TV1][ idx_L ];
+   V_L2  = g_PriVar[TV2][ idx_L ];
+   B_L1  = g_PriVar[TB1][ idx_L ];
+   B_L2  = g_PriVar[TB2][ idx_L ];
+   D_R   = g_PriVar[  0][ idx_R ];
+   V_R1  = g_PriVar[TV1][ idx_R ];
+   V_R2  = g_PriVar[TV2][ idx_R ];
+   B_R1  = g_PriVar[TB1][ idx_R ];
+   B_R2  = g_PriVar[TB2][ idx_R ];
+
+// correct the half-step velocity by gravity for the unsplitting scheme
+#  ifdef UNSPLIT_GRAVITY
+   if ( CorrHalfVel )
+   {
+      ijk_usg[0] = i_pri + idx_pri2usg;
+      ijk_usg[1] = j_pri + idx_pri2usg;
+      ijk_usg[2] = k_pri + idx_pri2usg;
+      ijk_usg[TDir2] ++;
+      UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+
+      ijk_usg[TDir1] ++;
+      UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
+                               GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+   } // if ( CorrHalfVel )
+#  endif // #ifdef UNSPLIT_GRAVITY
 
-      switch ( d )
-      {
-         case 0 : idx_ele_e [0] = NEleM1;  idx_ele_e [1] = NEle;
-                  idx_flux_s[0] = 1;       idx_flux_s[1] = 0;       idx_flux_s[2] = 0;
-                  break;
+   Ele_Out += dE_Upwind( +g_FC_Flux[TDir2][TB1][ idx_flux                    ],
+                         +g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ],
+                          g_FC_Flux[TDir1][  0][ idx_flux + didx_flux[TDir2] ],
+                         D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
 
-         case 1 : idx_ele_e [0] = NEle;    idx_ele_e [1] = NEleM1;
-                  idx_flux_s[0] = 0;       idx_flux_s[1] = 1;       idx_flux_s[2] = 0;
-                  break;
 
-         case 2 : idx_ele_e [0] = NEle;    idx_ele_e [1] = NEle;
-                  idx_flux_s[0] = 0;       idx_flux_s[1] = 0;       idx_flux_s[2] = 1;
-                  break;
-      }
+   Ele_Out *= (real)0.25;
 
-      const int size_ij = idx_ele_e[0]*idx_ele_e[1];
-      CGPU_LOOP( idx0, NEleM1*SQR(NEle)  )
-      {
-         const int i_ele    = idx0 % idx_ele_e[0];
-         const int j_ele    = idx0 % size_ij / idx_ele_e[0];
-         const int k_ele    = idx0 / size_ij;
-         const int idx_ele  = IDX321( i_ele, j_ele, k_ele, NEle, NEle );
-
-         const int i_flux   = i_ele + idx_flux_s[0];
-         const int j_flux   = j_ele + idx_flux_s[1];
-         const int k_flux   = k_ele + idx_flux_s[2];
-         const int idx_flux = IDX321( i_flux, j_flux, k_flux, NFlux, NFlux );
-
-         const int i_pri    = i_flux + OffsetPri;
-         const int j_pri    = j_flux + OffsetPri;
-         const int k_pri    = k_flux + OffsetPri;
-         const int idx_pri  = IDX321( i_pri, j_pri, k_pri, NPri, NPri );
-
-         real D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2;
-         int  idx_L, idx_R;
-         real Ele_Out;
-
-//       compute the edge-centered electric field
-         Ele_Out = ( - g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ]
-                     - g_FC_Flux[TDir1][TB2][ idx_flux                    ]
-                     + g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ]
-                     + g_FC_Flux[TDir2][TB1][ idx_flux                    ] );
-
-
-         idx_L = idx_pri;
-         idx_R = idx_L + didx_pri[TDir2];
-         D_L   = g_PriVar[  0][ idx_L ];
-         V_L1  = g_PriVar[TV1][ idx_L ];
-         V_L2  = g_PriVar[TV2][ idx_L ];
-         B_L1  = g_PriVar[TB1][ idx_L ];
-         B_L2  = g_PriVar[TB2][ idx_L ];
-         D_R   = g_PriVar[  0][ idx_R ];
-         V_R1  = g_PriVar[TV1][ idx_R ];
-         V_R2  = g_PriVar[TV2][ idx_R ];
-         B_R1  = g_PriVar[TB1][ idx_R ];
-         B_R2  = g_PriVar[TB2][ idx_R ];
-
-//       correct the half-step velocity by gravity for the unsplitting scheme
-#        ifdef UNSPLIT_GRAVITY
-         if ( CorrHalfVel )
-         {
-            ijk_usg[0] = i_pri + idx_pri2usg;
-            ijk_usg[1] = j_pri + idx_pri2usg;
-            ijk_usg[2] = k_pri + idx_pri2usg;
-            UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-
-            ijk_usg[TDir2] ++;
-            UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
-
-         Ele_Out += dE_Upwind( -g_FC_Flux[TDir1][TB2][ idx_flux                    ],
-                               -g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ],
-                                g_FC_Flux[TDir2][  0][ idx_flux                    ],
-                               D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
-
-
-         idx_L = idx_pri + didx_pri[TDir1];
-         idx_R = idx_L   + didx_pri[TDir2];
-         D_L   = g_PriVar[  0][ idx_L ];
-         V_L1  = g_PriVar[TV1][ idx_L ];
-         V_L2  = g_PriVar[TV2][ idx_L ];
-         B_L1  = g_PriVar[TB1][ idx_L ];
-         B_L2  = g_PriVar[TB2][ idx_L ];
-         D_R   = g_PriVar[  0][ idx_R ];
-         V_R1  = g_PriVar[TV1][ idx_R ];
-         V_R2  = g_PriVar[TV2][ idx_R ];
-         B_R1  = g_PriVar[TB1][ idx_R ];
-         B_R2  = g_PriVar[TB2][ idx_R ];
-
-//       correct the half-step velocity by gravity for the unsplitting scheme
-#        ifdef UNSPLIT_GRAVITY
-         if ( CorrHalfVel )
-         {
-            ijk_usg[0] = i_pri + idx_pri2usg;
-            ijk_usg[1] = j_pri + idx_pri2usg;
-            ijk_usg[2] = k_pri + idx_pri2usg;
-            ijk_usg[TDir1] ++;
-            UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-
-            ijk_usg[TDir2] ++;
-            UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
-
-         Ele_Out += dE_Upwind( -g_FC_Flux[TDir1][TB2][ idx_flux                    ],
-                               -g_FC_Flux[TDir1][TB2][ idx_flux + didx_flux[TDir2] ],
-                                g_FC_Flux[TDir2][  0][ idx_flux + didx_flux[TDir1] ],
-                               D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
-
-
-         idx_L = idx_pri;
-         idx_R = idx_L + didx_pri[TDir1];
-         D_L   = g_PriVar[  0][ idx_L ];
-         V_L1  = g_PriVar[TV1][ idx_L ];
-         V_L2  = g_PriVar[TV2][ idx_L ];
-         B_L1  = g_PriVar[TB1][ idx_L ];
-         B_L2  = g_PriVar[TB2][ idx_L ];
-         D_R   = g_PriVar[  0][ idx_R ];
-         V_R1  = g_PriVar[TV1][ idx_R ];
-         V_R2  = g_PriVar[TV2][ idx_R ];
-         B_R1  = g_PriVar[TB1][ idx_R ];
-         B_R2  = g_PriVar[TB2][ idx_R ];
-
-//       correct the half-step velocity by gravity for the unsplitting scheme
-#        ifdef UNSPLIT_GRAVITY
-         if ( CorrHalfVel )
-         {
-            ijk_usg[0] = i_pri + idx_pri2usg;
-            ijk_usg[1] = j_pri + idx_pri2usg;
-            ijk_usg[2] = k_pri + idx_pri2usg;
-            UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-
-            ijk_usg[TDir1] ++;
-            UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
-
-         Ele_Out += dE_Upwind( +g_FC_Flux[TDir2][TB1][ idx_flux                    ],
-                               +g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ],
-                                g_FC_Flux[TDir1][  0][ idx_flux                    ],
-                               D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
-
-
-         idx_L = idx_pri + didx_pri[TDir2];
-         idx_R = idx_L   + didx_pri[TDir1];
-         D_L   = g_PriVar[  0][ idx_L ];
-         V_L1  = g_PriVar[TV1][ idx_L ];
-         V_L2  = g_PriVar[TV2][ idx_L ];
-         B_L1  = g_PriVar[TB1][ idx_L ];
-         B_L2  = g_PriVar[TB2][ idx_L ];
-         D_R   = g_PriVar[  0][ idx_R ];
-         V_R1  = g_PriVar[TV1][ idx_R ];
-         V_R2  = g_PriVar[TV2][ idx_R ];
-         B_R1  = g_PriVar[TB1][ idx_R ];
-         B_R2  = g_PriVar[TB2][ idx_R ];
-
-//       correct the half-step velocity by gravity for the unsplitting scheme
-#        ifdef UNSPLIT_GRAVITY
-         if ( CorrHalfVel )
-         {
-            ijk_usg[0] = i_pri + idx_pri2usg;
-            ijk_usg[1] = j_pri + idx_pri2usg;
-            ijk_usg[2] = k_pri + idx_pri2usg;
-            ijk_usg[TDir2] ++;
-            UpdateVelocityByGravity( V_L1, V_L2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+   return Ele_Out;
 
-            ijk_usg[TDir1] ++;
-            UpdateVelocityByGravity( V_R1, V_R2, TDir1, TDir2, ijk_usg[0], ijk_usg[1], ijk_usg[2], dt_half, dh_f8,
-                                     GraConst, g_Pot_USG, Corner_USG, Time, GravityType, ExtAcc_Func, ExtAcc_AuxArray );
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
+} // FUNCTION : MHD_ComputeElectric_OneEdge
 
-         Ele_Out += dE_Upwind( +g_FC_Flux[TDir2][TB1][ idx_flux                    ],
-                               +g_FC_Flux[TDir2][TB1][ idx_flux + didx_flux[TDir1] ],
-                                g_FC_Flux[TDir1][  0][ idx_flux + didx_flux[TDir2] ],
-                               D_L, D_R, V_L1, V_L2, V_R1, V_R2, B_L1, B_L2, B_R1, B_R2, dt_dh );
 
 
-         Ele_Out *= (real)0.25;
+//-------------------------------------------------------------------------------------------------------
+// Function    :  StoreInterPatchElectric
+// Description :  Store the electric field at the patch boundaries in g_IntEle[]
+//
+// Note        :  1. Invoked by MHD_ComputeElectric() and MHD_ComputeElectric_UpdateMagnetic() for the option "DumpIntEle"
+//                2. See MHD_ComputeElectric() for the structure of g_IntEle[]
+//
+// Parameter   :  g_IntEle  : Array to store the inter-patch electric field
+//                d         : Direction of the electric field (0/1/2 --> x/y/z)
+//                i/j/k_ele : Array indices of the target edge
+//                Ele       : Electric field to be stored
+//
+// Return      :  g_IntEle[]
+//------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+void StoreInterPatchElectric( real g_IntEle[][NCOMP_ELE][ PS2P1*PS2 ], const int d,
+                              const int i_ele, const int j_ele, const int k_ele, const real Ele )
+{
 
-//       store the electric field of all cells in g_EC_Ele[]
-         g_EC_Ele[d][idx_ele] = Ele_Out;
+// sanity check: this function assumes N_FL_ELE == PS2+1
+#  if ( N_FL_ELE != PS2+1 )
+#     error : ERROR : N_FL_ELE != PS2+1 !!
+#  endif
 
-//       store the inter-patch electric field in g_IntEle[]
-         if ( DumpIntEle )
-         {
-//          sanity check: this function assumes N_FL_ELE == PS2+1
-#           if ( N_FL_ELE != PS2+1 )
-#              error : ERROR : N_FL_ELE != PS2+1 !!
-#           endif
-
-            if      ( d == 0 ) {
-               if ( j_ele == 0 || j_ele == PS1 || j_ele == PS2 )  g_IntEle[ 3 + j_ele/PS1 ][1][ i_ele*PS2P1 + k_ele ] = Ele_Out;
-               if ( k_ele == 0 || k_ele == PS1 || k_ele == PS2 )  g_IntEle[ 6 + k_ele/PS1 ][0][ j_ele*PS2   + i_ele ] = Ele_Out;
-            } // d == 0
-
-            else if ( d == 1 ) {
-               if ( k_ele == 0 || k_ele == PS1 || k_ele == PS2 )  g_IntEle[ 6 + k_ele/PS1 ][1][ j_ele*PS2P1 + i_ele ] = Ele_Out;
-               if ( i_ele == 0 || i_ele == PS1 || i_ele == PS2 )  g_IntEle[ 0 + i_ele/PS1 ][0][ k_ele*PS2   + j_ele ] = Ele_Out;
-            } // d == 1
-
-            else {
-               if ( i_ele == 0 || i_ele == PS1 || i_ele == PS2 )  g_IntEle[ 0 + i_ele/PS1 ][1][ k_ele*PS2P1 + j_ele ] = Ele_Out;
-               if ( j_ele == 0 || j_ele == PS1 || j_ele == PS2 )  g_IntEle[ 3 + j_ele/PS1 ][0][ i_ele*PS2   + k_ele ] = Ele_Out;
-            } // d == 2
-         } // if ( DumpIntEle )
-      } // CGPU_LOOP( idx_ele, idx_ele_e[0]*idx_ele_e[1]*idx_ele_e[2] )
-   } // for ( int d=0; d<3; d++)
+   if      ( d == 0 ) {
+      if ( j_ele == 0 || j_ele == PS1 || j_ele == PS2 )  g_IntEle[ 3 + j_ele/PS1 ][1][ i_ele*PS2P1 + k_ele ] = Ele;
+      if ( k_ele == 0 || k_ele == PS1 || k_ele == PS2 )  g_IntEle[ 6 + k_ele/PS1 ][0][ j_ele*PS2   + i_ele ] = Ele;
+   } // d == 0
 
+   else if ( d == 1 ) {
+      if ( k_ele == 0 || k_ele == PS1 || k_ele == PS2 )  g_IntEle[ 6 + k_ele/PS1 ][1][ j_ele*PS2P1 + i_ele ] = Ele;
+      if ( i_ele == 0 || i_ele == PS1 || i_ele == PS2 )  g_IntEle[ 0 + i_ele/PS1 ][0][ k_ele*PS2   + j_ele ] = Ele;
+   } // d == 1
 
-#  ifdef __CUDACC__
-   __syncthreads();
-#  endif
+   else {
+      if ( i_ele == 0 || i_ele == PS1 || i_ele == PS2 )  g_IntEle[ 0 + i_ele/PS1 ][1][ k_ele*PS2P1 + j_ele ] = Ele;
+      if ( j_ele == 0 || j_ele == PS1 || j_ele == PS2 )  g_IntEle[ 3 + j_ele/PS1 ][0][ i_ele*PS2   + k_ele ] = Ele;
+   } // d == 2
 
-} // FUNCTION : MHD_ComputeElectric
+} // FUNCTION : StoreInterPatchElectric
 
 
 
@@ -585,6 +640,119 @@ void MHD_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out
 
 
 
+#ifdef MHD_CT_FUSED
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MHD_ComputeElectric_UpdateMagnetic
+// Description :  Compute the edge-centered electric field and update the face-centered B field in a single pass
+//
+// Note        :  1. Equivalent to MHD_ComputeElectric() followed by MHD_UpdateMagnetic() but without storing
+//                   the electric field of all edges in g_EC_Ele[]
+//                   --> Sweep through the output x-y planes and only keep the electric field of two adjacent
+//                       planes in a local array so that it stays in cache
+//                   --> Results are identical to the unfused version
+//                2. CPU only (see MHD_CT_FUSED in CUFLU.h)
+//                3. Assume NEle == NOut+1 for the electric field
+//                4. dt_Ele and dt_Mag are the time intervals passed to MHD_ComputeElectric() and MHD_UpdateMagnetic(),
+//                   respectively
+//                5. See MHD_ComputeElectric() and MHD_UpdateMagnetic() for the other parameters
+//
+// Return      :  g_FC_B_Out[], g_IntEle[]
+//------------------------------------------------------------------------------------------------------
+void MHD_ComputeElectric_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out,
+                                         const real g_FC_B_In[][ FLU_NXT_P1*SQR(FLU_NXT) ],
+                                         const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                         const real g_PriVar[][ CUBE(FLU_NXT) ],
+                                         const int NOut, const int NFlux, const int NPri, const int OffsetPri,
+                                         const int Offset_B_In, const real dt_Ele, const real dt_Mag, const real dh,
+                                         const bool DumpIntEle, real g_IntEle[][NCOMP_ELE][ PS2P1*PS2 ],
+                                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[], const double Time,
+                                         const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] )
+{
+
+   const int  NEle   = NOut + 1;
+   const int  NOutP1 = NOut + 1;
+   const real dt_dh  = dt_Mag / dh;
+
+// electric field on two adjacent x-y planes: Ele[k%2][x/y/z][j][i]
+   real Ele[2][NCOMP_MAG][ SQR(N_EC_ELE) ];
+
+
+   for (int k=0; k<=NOut; k++)
+   {
+      const int kc = k%2;     // current  plane
+      const int km = 1 - kc;  // previous plane
+
+//    1. electric field on the plane k
+//       --> Ex/Ey/Ez have NOut elements along x/y/z, respectively
+      for (int d=0; d<3; d++)
+      {
+         if ( d == 2  &&  k == NOut )  continue;
+
+         const int ie = ( d == 0 ) ? NOut : NEle;
+         const int je = ( d == 1 ) ? NOut : NEle;
+
+         for (int j=0; j<je; j++)
+         for (int i=0; i<ie; i++)
+         {
+            const real Ele_Out = MHD_ComputeElectric_OneEdge( d, i, j, k, g_FC_Flux, g_PriVar, NFlux, NPri, OffsetPri,
+                                                              dt_Ele, dh, CorrHalfVel, g_Pot_USG, g_Corner, Time,
+                                                              GravityType, ExtAcc_Func, ExtAcc_AuxArray );
+            Ele[kc][d][ j*NEle + i ] = Ele_Out;
+
+            if ( DumpIntEle )    StoreInterPatchElectric( g_IntEle, d, i, j, k, Ele_Out );
+         }
+      } // for (int d=0; d<3; d++)
+
+
+//    2. Bz on the plane k
+      for (int j=0; j<NOut; j++)
+      for (int i=0; i<NOut; i++)
+      {
+         const int  idx_out = IDX321( i, j, k, NOut, NOut );
+         const int  idx_in  = IDX321( i+Offset_B_In, j+Offset_B_In, k+Offset_B_In, FLU_NXT, FLU_NXT );
+         const int  idx_ele = j*NEle + i;
+         const real dE1     = Ele[kc][0][ idx_ele + NEle ] - Ele[kc][0][idx_ele];
+         const real dE2     = Ele[kc][1][ idx_ele + 1    ] - Ele[kc][1][idx_ele];
+
+         g_FC_Bz_Out[idx_out] = g_FC_B_In[2][idx_in] + dt_dh*( dE1 - dE2 );
+      }
+
+
+//    3. Bx and By on the plane k-1
+      if ( k == 0 )  continue;
+
+      const int kk = k - 1;
+
+      for (int j=0; j<NOut; j++)
+      for (int i=0; i<NOutP1; i++)
+      {
+         const int  idx_out = IDX321( i, j, kk, NOutP1, NOut );
+         const int  idx_in  = IDX321( i+Offset_B_In, j+Offset_B_In, kk+Offset_B_In, FLU_NXT_P1, FLU_NXT );
+         const int  idx_ele = j*NEle + i;
+         const real dE1     = Ele[kc][1][idx_ele       ] - Ele[km][1][idx_ele];
+         const real dE2     = Ele[km][2][idx_ele + NEle] - Ele[km][2][idx_ele];
+
+         g_FC_Bx_Out[idx_out] = g_FC_B_In[0][idx_in] + dt_dh*( dE1 - dE2 );
+      }
+
+      for (int j=0; j<NOutP1; j++)
+      for (int i=0; i<NOut; i++)
+      {
+         const int  idx_out = IDX321( i, j, kk, NOut, NOutP1 );
+         const int  idx_in  = IDX321( i+Offset_B_In, j+Offset_B_In, kk+Offset_B_In, FLU_NXT, FLU_NXT_P1 );
+         const int  idx_ele = j*NEle + i;
+         const real dE1     = Ele[km][2][idx_ele + 1] - Ele[km][2][idx_ele];
+         const real dE2     = Ele[kc][0][idx_ele    ] - Ele[km][0][idx_ele];
+
+         g_FC_By_Out[idx_out] = g_FC_B_In[1][idx_in] + dt_dh*( dE1 - dE2 );
+      }
+   } // for (int k=0; k<=NOut; k++)
+
+} // FUNCTION : MHD_ComputeElectric_UpdateMagnetic
+#endif // #ifdef MHD_CT_FUSED
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  MHD_HalfStepPrimitive
 // Description :  Evaluate the half-step cell-centered primitive variables
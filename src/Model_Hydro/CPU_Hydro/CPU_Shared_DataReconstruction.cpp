@@ -24,6 +24,14 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
                     const double EoS_AuxArray[], real* const EintOut );
 void Hydro_Pri2Con( const real In[], real Out[], const bool NormPassive, const int NNorm, const int NormIdx[],
                     const EoS_DP2E_t EoS_DensPres2Eint, const double EoS_AuxArray[], const real* const EintIn );
+#ifdef CON2PRI_BATCH
+void Hydro_Con2Pri_Batch( const real g_ConVar[][ CUBE(FLU_NXT) ], real g_PriVar[][ CUBE(FLU_NXT) ],
+                          real g_EintOut[], const int NCell, const real MinPres,
+                          const bool NormPassive, const int NNorm, const int NormIdx[],
+                          const bool JeansMinPres, const real JeansMinPres_Coeff,
+                          const EoS_DE2P_t EoS_DensEint2Pres, const EoS_DP2E_t EoS_DensPres2Eint,
+                          const double EoS_AuxArray[] );
+#endif
 #if ( FLU_SCHEME == MHM )
 void Hydro_Con2Flux( const int XYZ, real Flux[], const real In[], const real MinPres,
                      const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray[],
@@ -60,6 +68,13 @@ static void Hydro_HancockPredict( real fc[][NCOMP_LR], const real dt, const real
                                   const real MinDens, const real MinPres, const real MinEint,
                                   const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray[] );
 #endif
+#ifdef LR_SLOPE_FUSED
+static void Hydro_LimitSlope_Plane( const real g_PriVar[][ CUBE(FLU_NXT) ], const int NIn, const int k_slope,
+                                    const int XYZ, real Slope[][NCOMP_LR][N_SLOPE_PPM],
+                                    const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                                    real LEigenVec[][NWAVE], real REigenVec[][NWAVE],
+                                    const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] );
+#endif
 #ifdef CHAR_RECONSTRUCTION
 GPU_DEVICE
 static void Hydro_Pri2Char( real InOut[], const real Dens, const real Pres, const real LEigenVec[][NWAVE], const int XYZ,
@@ -120,7 +135,7 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                g_Slope_PPM        : Array to store the x/y/z slopes for the PPM reconstruction
 //                                     --> Should contain NCOMP_LR variables
 //                                         --> Store internal energy as the last variable when LR_EINT is on
-//                                     --> Useless for PLM
+//                                     --> Useless for PLM and for PPM with LR_SLOPE_FUSED (i.e., CPU)
 //                Con2Pri            : Convert conserved variables in g_ConVar[] to primitive variables and
 //                                     store the results in g_PriVar[]
 //                NIn                : Size of g_PriVar[] along each direction
@@ -152,7 +167,7 @@ GPU_DEVICE
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                     real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
@@ -263,6 +278,21 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 // 0. conserved --> primitive variables
    if ( Con2Pri )
    {
+#     ifdef CON2PRI_BATCH
+#     ifdef LR_EINT
+      real *g_EintOut = g_PriVar[NCOMP_TOTAL_PLUS_MAG];  // store Eint in the last variable
+#     else
+      real *g_EintOut = NULL;
+#     endif
+
+      Hydro_Con2Pri_Batch( g_ConVar, g_PriVar, g_EintOut, CUBE(NIn), MinPres, NormPassive, NNorm, NormIdx,
+                           JeansMinPres, JeansMinPres_Coeff, EoS_DensEint2Pres, EoS_DensPres2Eint, EoS_AuxArray );
+
+#     ifdef LR_EINT
+      for (int idx=0; idx<CUBE(NIn); idx++)   g_EintOut[idx] = Hydro_CheckMinEint( g_EintOut[idx], MinEint );
+#     endif
+
+#     else // #ifdef CON2PRI_BATCH
       real ConVar_1Cell[NCOMP_TOTAL_PLUS_MAG], PriVar_1Cell[NCOMP_TOTAL_PLUS_MAG];
 #     ifdef LR_EINT
       real Eint;
@@ -294,6 +324,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
       } // CGPU_LOOP( idx, CUBE(NIn) )
+#     endif // #ifdef CON2PRI_BATCH ... else ...
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -641,7 +672,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 // Function    :  Hydro_DataReconstruction
 // Description :  Reconstruct the face-centered variables by the piecewise-parabolic method (PPM)
 //
-// Note        :  See the PLM routine
+// Note        :  1. See the PLM routine
+//                2. For LR_SLOPE_FUSED in CUFLU.h (i.e., CPU), the monotonic slopes are evaluated plane by plane
+//                   along z right before they are needed and are stored in a local sliding window instead of
+//                   g_Slope_PPM[]
+//                   --> The x/y slopes are only kept for the current plane and the z slopes for the current
+//                       and two adjacent planes
+//                   --> g_Slope_PPM[] is not accessed at all and can be NULL
 //
 // Parameter   :  See the PLM routine
 //------------------------------------------------------------------------------------------------------
@@ -649,7 +686,7 @@ GPU_DEVICE
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                     real_fc g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
@@ -692,7 +729,9 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 
    const int  didx_cc   [3]  = { 1, NIn, SQR(NIn) };
+#  ifndef LR_SLOPE_FUSED
    const int  didx_slope[3]  = { 1, N_SLOPE_PPM, SQR(N_SLOPE_PPM) };
+#  endif
 
 #  if ( FLU_SCHEME == CTU )
    const real dt_dh2         = (real)0.5*dt/dh;
@@ -774,6 +813,21 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 // 0. conserved --> primitive variables
    if ( Con2Pri )
    {
+#     ifdef CON2PRI_BATCH
+#     ifdef LR_EINT
+      real *g_EintOut = g_PriVar[NCOMP_TOTAL_PLUS_MAG];  // store Eint in the last variable
+#     else
+      real *g_EintOut = NULL;
+#     endif
+
+      Hydro_Con2Pri_Batch( g_ConVar, g_PriVar, g_EintOut, CUBE(NIn), MinPres, NormPassive, NNorm, NormIdx,
+                           JeansMinPres, JeansMinPres_Coeff, EoS_DensEint2Pres, EoS_DensPres2Eint, EoS_AuxArray );
+
+#     ifdef LR_EINT
+      for (int idx=0; idx<CUBE(NIn); idx++)   g_EintOut[idx] = Hydro_CheckMinEint( g_EintOut[idx], MinEint );
+#     endif
+
+#     else // #ifdef CON2PRI_BATCH
       real ConVar_1Cell[NCOMP_TOTAL_PLUS_MAG], PriVar_1Cell[NCOMP_TOTAL_PLUS_MAG];
 #     ifdef LR_EINT
       real Eint;
@@ -805,6 +859,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
       } // CGPU_LOOP( idx, CUBE(NIn) )
+#     endif // #ifdef CON2PRI_BATCH ... else ...
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -812,7 +867,16 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    } // if ( Con2Pri )
 
 
-// 1. evaluate the monotonic slope of all cells
+#  ifdef LR_SLOPE_FUSED
+// 1. CPU: sliding window of the monotonic slopes
+//    --> Slope_XY[d][j][v][i]: x/y slopes of the current plane
+//    --> Slope_Z [k%3][j][v][i]: z slopes of the current and two adjacent planes
+   real Slope_XY[2][N_SLOPE_PPM][NCOMP_LR][N_SLOPE_PPM];
+   real Slope_Z [3][N_SLOPE_PPM][NCOMP_LR][N_SLOPE_PPM];
+
+#  else // #ifdef LR_SLOPE_FUSED
+
+// 1. GPU: evaluate the monotonic slope of all cells in advance
    const int N_SLOPE_PPM2 = SQR( N_SLOPE_PPM );
    CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
    {
@@ -851,6 +915,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
       } // for (int d=0; d<3; d++)
    } // CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+#  endif // #ifdef LR_SLOPE_FUSED ... else ...
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -864,7 +929,27 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    int idx_B[NCOMP_MAG];
 #  endif
 
+#  ifdef LR_SLOPE_FUSED
+   for (int k_plane=0; k_plane<N_FC_VAR; k_plane++)
+   {
+//    evaluate the slopes required by the cells on the plane k_plane, which lie on the slope planes k_plane ... k_plane+2
+//    --> the z slopes on the slope planes k_plane and k_plane+1 have been evaluated in the previous iterations
+      if ( k_plane == 0 )
+      for (int k_slope=0; k_slope<2; k_slope++)
+         Hydro_LimitSlope_Plane( g_PriVar, NIn, k_slope, 2, Slope_Z[k_slope], LR_Limiter, MinMod_Coeff,
+                                 LEigenVec, REigenVec, EoS_DensPres2CSqr, EoS_AuxArray );
+
+      Hydro_LimitSlope_Plane( g_PriVar, NIn, k_plane+2, 2, Slope_Z[ (k_plane+2)%3 ], LR_Limiter, MinMod_Coeff,
+                              LEigenVec, REigenVec, EoS_DensPres2CSqr, EoS_AuxArray );
+
+      for (int d=0; d<2; d++)
+      Hydro_LimitSlope_Plane( g_PriVar, NIn, k_plane+1, d, Slope_XY[d], LR_Limiter, MinMod_Coeff,
+                              LEigenVec, REigenVec, EoS_DensPres2CSqr, EoS_AuxArray );
+
+   for (int idx_fc=k_plane*N_FC_VAR2; idx_fc<(k_plane+1)*N_FC_VAR2; idx_fc++)
+#  else
    CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+#  endif
    {
       const int i_fc      = idx_fc%N_FC_VAR;
       const int j_fc      = idx_fc%N_FC_VAR2/N_FC_VAR;
@@ -878,7 +963,15 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       const int i_slope   = i_fc + 1;   // because N_SLOPE_PPM = N_FC_VAR + 2
       const int j_slope   = j_fc + 1;
       const int k_slope   = k_fc + 1;
+#     ifdef LR_SLOPE_FUSED
+//    slopes of the left/central/right cells along x/y/z in the sliding window
+      const real (*const SlopeL[3])[N_SLOPE_PPM] = { Slope_XY[0][j_slope  ], Slope_XY[1][j_slope-1], Slope_Z[ (k_slope-1)%3 ][j_slope] };
+      const real (*const SlopeC[3])[N_SLOPE_PPM] = { Slope_XY[0][j_slope  ], Slope_XY[1][j_slope  ], Slope_Z[ (k_slope  )%3 ][j_slope] };
+      const real (*const SlopeR[3])[N_SLOPE_PPM] = { Slope_XY[0][j_slope  ], Slope_XY[1][j_slope+1], Slope_Z[ (k_slope+1)%3 ][j_slope] };
+      const int  di_slope[3] = { 1, 0, 0 };
+#     else
       const int idx_slope = IDX321( i_slope, j_slope, k_slope, N_SLOPE_PPM, N_SLOPE_PPM );
+#     endif
 
 #     ifdef MHD
 //    assuming that g_FC_B[] is accessed with the strides NIn/NIn+1 along the transverse/longitudinal directions
@@ -913,8 +1006,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          const int faceR      = faceL+1;
          const int idx_ccL    = idx_cc - didx_cc[d];
          const int idx_ccR    = idx_cc + didx_cc[d];
+#        ifdef LR_SLOPE_FUSED
+         const int i_slopeL   = i_slope - di_slope[d];
+         const int i_slopeR   = i_slope + di_slope[d];
+#        else
          const int idx_slopeL = idx_slope - didx_slope[d];
          const int idx_slopeR = idx_slope + didx_slope[d];
+#        endif
 
          for (int v=0; v<NCOMP_LR; v++)
          {
@@ -926,9 +1024,15 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
             cc_R  = g_PriVar[v][idx_ccR];
             cc_C  = cc_C_ncomp[v];
 
+#           ifdef LR_SLOPE_FUSED
+            dcc_L = SlopeL[d][v][i_slopeL];
+            dcc_R = SlopeR[d][v][i_slopeR];
+            dcc_C = SlopeC[d][v][i_slope ];
+#           else
             dcc_L = g_Slope_PPM[d][v][idx_slopeL];
             dcc_R = g_Slope_PPM[d][v][idx_slopeR];
             dcc_C = g_Slope_PPM[d][v][idx_slope ];
+#           endif
 
             fc_L  = (real)0.5*( cc_C + cc_L ) - (real)1.0/(real)6.0*( dcc_C - dcc_L );
             fc_R  = (real)0.5*( cc_C + cc_R ) - (real)1.0/(real)6.0*( dcc_R - dcc_C );
@@ -1210,6 +1314,10 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
    } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
 
+#  ifdef LR_SLOPE_FUSED
+   } // for (int k_plane=0; k_plane<N_FC_VAR; k_plane++)
+#  endif
+
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -1303,7 +1411,7 @@ void Hydro_Pri2Char( real InOut[], const real Dens, const real Pres, const real
 
 // b. pure hydro
 #  else // #ifdef MHD
-   const real  a2 = EoS_DensPres2CSqr( Dens, Pres, Passive, EoS_AuxArray );
+   const real  a2 = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Dens, Pres, Passive, EoS_AuxArray );
    const real _a2 = (real)1.0 / a2;
    const real _a  = SQRT( _a2 );
 
@@ -1374,7 +1482,7 @@ void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, const real
 
 
 // primitive --> characteristic
-   const real a2 = EoS_DensPres2CSqr( Dens, Pres, Passive, EoS_AuxArray );
+   const real a2 = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Dens, Pres, Passive, EoS_AuxArray );
 
 // a. MHD
 #  ifdef MHD
@@ -1472,7 +1580,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 
    const real  Rho = CC_Var[0];
    const real _Rho = (real)1.0/Rho;
-   const real  a2  = EoS_DensPres2CSqr( Rho, CC_Var[4], Passive, EoS_AuxArray );
+   const real  a2  = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho, CC_Var[4], Passive, EoS_AuxArray );
    const real  a   = SQRT( a2 );
    const real _a   = (real)1.0/a;
    const real _a2  = _a*_a;
@@ -1871,6 +1979,78 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 
 
 
+#ifdef LR_SLOPE_FUSED
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_LimitSlope_Plane
+// Description :  Evaluate the monotonic slopes along the target direction of all cells on an x-y plane
+//                of the PPM slope array
+//
+// Note        :  1. CPU only and enabled by LR_SLOPE_FUSED in CUFLU.h
+//                   --> Invoked by Hydro_DataReconstruction() (PPM) for filling its sliding window of slopes
+//                2. Cell (i,j) on the slope plane k_slope corresponds to the cell (i,j,k)+NGhost-1 in g_PriVar[]
+//                   --> Same as g_Slope_PPM[] in the unfused reconstruction
+//
+// Parameter   :  g_PriVar          : Array storing the input cell-centered primitive variables
+//                NIn               : Size of g_PriVar[] along each direction
+//                k_slope           : Target slope plane
+//                XYZ               : Target spatial direction : (0/1/2) --> (x/y/z)
+//                Slope             : Array to store the output monotonic slopes with the layout [j][v][i]
+//                LR_Limiter        : Slope limiter (see Hydro_LimitSlope())
+//                MinMod_Coeff      : Coefficient of the generalized MinMod limiter
+//                L/REigenVec       : Left/right eigenvector matrices --> for MHD with CHAR_RECONSTRUCTION only
+//                EoS_DensPres2CSqr : EoS routine to compute the sound speed square
+//                EoS_AuxArray      : Auxiliary array for the EoS routines
+//-------------------------------------------------------------------------------------------------------
+void Hydro_LimitSlope_Plane( const real g_PriVar[][ CUBE(FLU_NXT) ], const int NIn, const int k_slope,
+                             const int XYZ, real Slope[][NCOMP_LR][N_SLOPE_PPM],
+                             const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                             real LEigenVec[][NWAVE], real REigenVec[][NWAVE],
+                             const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] )
+{
+
+   const int NGhost     = LR_GHOST_SIZE;
+   const int didx_cc[3] = { 1, NIn, SQR(NIn) };
+   const int k_cc       = NGhost - 1 + k_slope;
+
+   for (int j_slope=0; j_slope<N_SLOPE_PPM; j_slope++)
+   {
+      const int j_cc    = NGhost - 1 + j_slope;
+      const int idx_cc0 = IDX321( NGhost-1, j_cc, k_cc, NIn, NIn );
+
+      for (int i_slope=0; i_slope<N_SLOPE_PPM; i_slope++)
+      {
+         const int idx_cc  = idx_cc0 + i_slope;
+         const int idx_ccL = idx_cc - didx_cc[XYZ];
+         const int idx_ccR = idx_cc + didx_cc[XYZ];
+
+//       cc_C/L/R: cell-centered variables of the Central/Left/Right cells
+         real cc_C[NCOMP_LR], cc_L[NCOMP_LR], cc_R[NCOMP_LR], Slope_Limiter[NCOMP_LR];
+
+         for (int v=0; v<NCOMP_LR; v++)
+         {
+            cc_C[v] = g_PriVar[v][idx_cc ];
+            cc_L[v] = g_PriVar[v][idx_ccL];
+            cc_R[v] = g_PriVar[v][idx_ccR];
+         }
+
+#        if ( defined MHD  &&  defined CHAR_RECONSTRUCTION )
+         real EigenVal[NWAVE];
+         MHD_GetEigenSystem( cc_C, EigenVal, LEigenVec, REigenVec, EoS_DensPres2CSqr, EoS_AuxArray, XYZ );
+#        endif
+
+         Hydro_LimitSlope( cc_L, cc_C, cc_R, LR_Limiter, MinMod_Coeff, XYZ,
+                           LEigenVec, REigenVec, Slope_Limiter,
+                           EoS_DensPres2CSqr, EoS_AuxArray );
+
+         for (int v=0; v<NCOMP_LR; v++)   Slope[j_slope][v][i_slope] = Slope_Limiter[v];
+      } // for (int i_slope=0; i_slope<N_SLOPE_PPM; i_slope++)
+   } // for (int j_slope=0; j_slope<N_SLOPE_PPM; j_slope++)
+
+} // FUNCTION : Hydro_LimitSlope_Plane
+#endif // #ifdef LR_SLOPE_FUSED
+
+
+
 #if ( FLU_SCHEME == MHM )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_HancockPredict
@@ -155,7 +155,7 @@ real Hydro_Con2Entropy( const real Dens, const real MomX, const real MomY, const
 // --> note that DE_ENPY only works with EOS_GAMMA, which does not involve passive scalars
    Pres = Hydro_Con2Pres( Dens, MomX, MomY, MomZ, Engy, NULL, CheckMinPres_No, NULL_REAL, Emag,
                           EoS_DensEint2Pres, EoS_AuxArray, NULL );
-   Enpy = Hydro_DensPres2Entropy( Dens, Pres, EoS_AuxArray[1] );
+   Enpy = Hydro_DensPres2Entropy( Dens, Pres, EOS_AUX_GAMMA_M1(EoS_AuxArray) );
 
    return Enpy;
 
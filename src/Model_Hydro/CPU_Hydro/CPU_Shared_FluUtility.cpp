@@ -192,7 +192,7 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
 
 //    recompute internal energy to be consistent with the updated pressure
       if ( EintOut != NULL  &&  Out[4] != Pres0 )
-         *EintOut = EoS_DensPres2Eint( Out[0], Out[4], In+NCOMP_FLUID, EoS_AuxArray );
+         *EintOut = EOS_DENSPRES2EINT( EoS_DensPres2Eint, Out[0], Out[4], In+NCOMP_FLUID, EoS_AuxArray );
    }
 
 
@@ -216,6 +216,154 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
 
 
 
+#ifdef CON2PRI_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Con2Pri_Batch_Fast
+// Description :  Fast path of Hydro_Con2Pri_Batch(), which converts all cells without applying any floor
+//
+// Note        :  1. Invoked by Hydro_Con2Pri_Batch()
+//                2. Whether to store the internal energy is a template parameter so that the loop over cells
+//                   contains no branches
+//
+// Parameter   :  See Hydro_Con2Pri_Batch()
+//
+// Return      :  Number of cells whose pressure does not exceed MinPres or JeansCoeff*Dens^2 or is NaN
+//-------------------------------------------------------------------------------------------------------
+template <bool StoreEint>
+static int Hydro_Con2Pri_Batch_Fast( const real g_ConVar[][ CUBE(FLU_NXT) ], real g_PriVar[][ CUBE(FLU_NXT) ],
+                                     real g_EintOut[], const int NCell, const real MinPres, const real JeansCoeff,
+                                     const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray[] )
+{
+
+   const real *Con_Dens = g_ConVar[DENS];
+   const real *Con_MomX = g_ConVar[MOMX];
+   const real *Con_MomY = g_ConVar[MOMY];
+   const real *Con_MomZ = g_ConVar[MOMZ];
+   const real *Con_Engy = g_ConVar[ENGY];
+         real *Pri_Dens = g_PriVar[0];
+         real *Pri_VelX = g_PriVar[1];
+         real *Pri_VelY = g_PriVar[2];
+         real *Pri_VelZ = g_PriVar[3];
+         real *Pri_Pres = g_PriVar[4];
+
+   int NFail = 0;
+
+#  pragma omp simd reduction( +:NFail )
+   for (int t=0; t<NCell; t++)
+   {
+      const real Dens = Con_Dens[t];
+      const real _Rho = (real)1.0/Dens;
+      const real MomX = Con_MomX[t];
+      const real MomY = Con_MomY[t];
+      const real MomZ = Con_MomZ[t];
+      const real Eint = Con_Engy[t] - (real)0.5*( SQR(MomX) + SQR(MomY) + SQR(MomZ) ) / Dens;
+      const real Pres = EOS_DENSEINT2PRES( EoS_DensEint2Pres, Dens, Eint, NULL, EoS_AuxArray );
+
+      Pri_Dens[t] = Dens;
+      Pri_VelX[t] = MomX*_Rho;
+      Pri_VelY[t] = MomY*_Rho;
+      Pri_VelZ[t] = MomZ*_Rho;
+      Pri_Pres[t] = Pres;
+
+      if ( StoreEint )  g_EintOut[t] = Eint;
+
+//    both floors leave the pressure unchanged only if it is larger than them (which also excludes NaN)
+      NFail += (  ( Pres > MinPres ) & ( Pres > JeansCoeff*SQR(Dens) )  ) ? 0 : 1;
+   }
+
+   return NFail;
+
+} // FUNCTION : Hydro_Con2Pri_Batch_Fast
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Con2Pri_Batch
+// Description :  Conserved variables --> primitive variables for a contiguous array of cells
+//
+// Note        :  1. CPU only and enabled by CON2PRI_BATCH in CUFLU.h
+//                   --> Pure hydro with EOS_GAMMA only
+//                2. Two passes
+//                   (1) Convert all cells without any floor by Hydro_Con2Pri_Batch_Fast() so that the loop can be
+//                       vectorized
+//                       --> Also count the cells whose pressure does not exceed MinPres (and the Jeans pressure floor
+//                           for JeansMinPres) or is NaN
+//                   (2) Only if any cell fails the check above, invoke Hydro_Con2Pri() for these cells to
+//                       overwrite their results
+//                   --> Results are identical to applying Hydro_Con2Pri() to each cell
+//                3. Passive scalars are converted in separate loops
+//                4. g_ConVar[] and g_PriVar[] must NOT point to the same array
+//
+// Parameter   :  g_ConVar  : Array storing the input conserved variables with the layout [NCOMP_TOTAL][NCell]
+//                g_PriVar  : Array to store the output primitive variables with the layout [NCOMP_TOTAL][NCell]
+//                g_EintOut : Array to store the output internal energy (see EintOut in Hydro_Con2Pri())
+//                            --> Do nothing if it is NULL
+//                NCell     : Number of cells
+//                Others    : See Hydro_Con2Pri()
+//
+// Return      :  g_PriVar[], g_EintOut[] (optional)
+//-------------------------------------------------------------------------------------------------------
+void Hydro_Con2Pri_Batch( const real g_ConVar[][ CUBE(FLU_NXT) ], real g_PriVar[][ CUBE(FLU_NXT) ],
+                          real g_EintOut[], const int NCell, const real MinPres,
+                          const bool NormPassive, const int NNorm, const int NormIdx[],
+                          const bool JeansMinPres, const real JeansMinPres_Coeff,
+                          const EoS_DE2P_t EoS_DensEint2Pres, const EoS_DP2E_t EoS_DensPres2Eint,
+                          const double EoS_AuxArray[] )
+{
+
+// a zero coefficient reduces the Jeans pressure floor to Pres > 0, which is already required by MinPres >= 0
+   const real JeansCoeff = ( JeansMinPres ) ? JeansMinPres_Coeff : (real)0.0;
+
+
+// 1. fast path: convert all cells without applying any floor
+   const int NFail = ( g_EintOut == NULL )
+                   ? Hydro_Con2Pri_Batch_Fast <false> ( g_ConVar, g_PriVar, g_EintOut, NCell, MinPres, JeansCoeff,
+                                                        EoS_DensEint2Pres, EoS_AuxArray )
+                   : Hydro_Con2Pri_Batch_Fast <true > ( g_ConVar, g_PriVar, g_EintOut, NCell, MinPres, JeansCoeff,
+                                                        EoS_DensEint2Pres, EoS_AuxArray );
+
+
+// passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   for (int t=0; t<NCell; t++)   g_PriVar[v][t] = g_ConVar[v][t];
+
+   if ( NormPassive )
+   for (int v=0; v<NNorm; v++)
+   {
+      const int idx = NCOMP_FLUID + NormIdx[v];
+
+      for (int t=0; t<NCell; t++)   g_PriVar[idx][t] *= (real)1.0/g_ConVar[DENS][t];
+   }
+#  endif
+
+
+// 2. slow path: redo the cells that require the pressure floors
+   if ( NFail > 0 )
+   {
+      for (int t=0; t<NCell; t++)
+      {
+         const real Pres = g_PriVar[4][t];
+
+         if (  Pres > MinPres  &&  Pres > JeansCoeff*SQR(g_PriVar[0][t])  )   continue;
+
+         real Con_1Cell[NCOMP_TOTAL], Pri_1Cell[NCOMP_TOTAL];
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   Con_1Cell[v] = g_ConVar[v][t];
+
+         Hydro_Con2Pri( Con_1Cell, Pri_1Cell, MinPres, NormPassive, NNorm, NormIdx,
+                        JeansMinPres, JeansMinPres_Coeff, EoS_DensEint2Pres, EoS_DensPres2Eint, EoS_AuxArray,
+                        (g_EintOut==NULL)?NULL:g_EintOut+t );
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_PriVar[v][t] = Pri_1Cell[v];
+      }
+   } // if ( NFail > 0 )
+
+} // FUNCTION : Hydro_Con2Pri_Batch
+#endif // #ifdef CON2PRI_BATCH
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_Pri2Con
 // Description :  Primitive variables --> conserved variables
@@ -277,7 +425,7 @@ void Hydro_Pri2Con( const real In[], real Out[], const bool NormPassive, const i
    const real Bz = In[ MAG_OFFSET + 2 ];
    Emag   = (real)0.5*( SQR(Bx) + SQR(By) + SQR(Bz) );
 #  endif
-   Eint   = ( EintIn == NULL ) ? EoS_DensPres2Eint( In[0], In[4], Out+NCOMP_FLUID, EoS_AuxArray ) : *EintIn;
+   Eint   = ( EintIn == NULL ) ? EOS_DENSPRES2EINT( EoS_DensPres2Eint, In[0], In[4], Out+NCOMP_FLUID, EoS_AuxArray ) : *EintIn;
    Out[4] = Hydro_ConEint2Etot( Out[0], Out[1], Out[2], Out[3], Eint, Emag );
 
 
@@ -527,7 +675,7 @@ real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const re
    real Eint, Pres;
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag );
-   Pres = EoS_DensEint2Pres( Dens, Eint, Passive, EoS_AuxArray );
+   Pres = EOS_DENSEINT2PRES( EoS_DensEint2Pres, Dens, Eint, Passive, EoS_AuxArray );
 
    if ( CheckMinPres )   Pres = Hydro_CheckMinPres( Pres, MinPres );
 
@@ -31,6 +31,21 @@
 //
 // Note        :  1. This function is shared by MHM, MHM_RP, and CTU schemes
 //                2. Invoke dual-energy check if DualEnergySwitch is on
+//                3. Passive scalars are updated and floored in a separate loop before updating the other fluid
+//                   variables
+//                   --> Their fluxes are simply the mass flux times the upwind mass fractions, which have been
+//                       computed by the Riemann solvers already
+//                   --> The inner loop over cells does not depend on the other fluid variables and can thus be
+//                       vectorized for any NCOMP_PASSIVE
+//                   --> The updated passive scalars are temporarily stored in g_Output and then reloaded for
+//                       normalization and the dual-energy formalism (i.e., ENPY) in the main loop
+//                   --> Each cell is accessed by the same thread in both loops, so no synchronization is required
+//                4. Apply the corrector step of the external acceleration for UNSPLIT_GRAVITY if FuseExtAcc is on
+//                   --> Replace the separate gravity solver for OPT__USG_FUSE_EXT_ACC
+//                   --> Same update as CPU_HydroGravitySolver() but applied before the dual-energy fix, which then
+//                       handles the consistency between the updated total energy and the dual-energy variable
+//                   --> Not applicable to self-gravity since the potential at the new time is unknown until the
+//                       updated density is available
 //
 // Parameter   :  g_Input          : Array storing the input fluid data
 //                g_Output         : Array to store the updated fluid data
@@ -52,22 +67,68 @@
 //                                   --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                EoS_AuxArray     : Auxiliary array for the EoS routines
 //                                   --> Only for obtaining Gamma used by the dual-energy formalism
+//                FuseExtAcc       : Apply the corrector step of the external acceleration (for UNSPLIT_GRAVITY only)
+//                g_Corner         : Array storing the physical corner coordinates of the patch group (for FuseExtAcc only)
+//                TimeOld/New      : Physical time before/after update                                 (for FuseExtAcc only)
+//                ExtAcc_Func      : Function pointer to the external acceleration routine              (for FuseExtAcc only)
+//                ExtAcc_AuxArray  : Auxiliary array for adding external acceleration                   (for FuseExtAcc only)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const double EoS_AuxArray[] )
+                           const double EoS_AuxArray[], const bool FuseExtAcc, const double g_Corner[],
+                           const double TimeOld, const double TimeNew, ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] )
 {
 
    const int  didx_flux[3] = { 1, N_FL_FLUX, SQR(N_FL_FLUX) };
    const real dt_dh        = dt/dh;
 
-   real dFlux[3][NCOMP_TOTAL], Output_1Cell[NCOMP_TOTAL], Emag;
+   real dFlux[3][NCOMP_FLUID], Output_1Cell[NCOMP_TOTAL], Emag;
 
 
    const int size_ij = SQR(PS2);
+
+
+// 0. update and floor passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+      const real *g_Input_v = g_Input [v];
+            real *g_Out_v   = g_Output[v];
+
+#     ifdef __CUDACC__
+      CGPU_LOOP( idx_out, CUBE(PS2) )
+#     else
+#     pragma omp simd
+      for (int idx_out=0; idx_out<CUBE(PS2); idx_out++)
+#     endif
+      {
+         const int i_out    = idx_out % PS2;
+         const int j_out    = idx_out % size_ij / PS2;
+         const int k_out    = idx_out / size_ij;
+
+#        ifdef MHD
+         const int idx_flux = IDX321( i_out+1, j_out+1, k_out+1, N_FL_FLUX, N_FL_FLUX );
+         const real dF0     = g_Flux[0][v][idx_flux] - g_Flux[0][v][ idx_flux - didx_flux[0] ];
+         const real dF1     = g_Flux[1][v][idx_flux] - g_Flux[1][v][ idx_flux - didx_flux[1] ];
+         const real dF2     = g_Flux[2][v][idx_flux] - g_Flux[2][v][ idx_flux - didx_flux[2] ];
+#        else
+         const int idx_flux = IDX321( i_out, j_out, k_out, N_FL_FLUX, N_FL_FLUX );
+         const real dF0     = g_Flux[0][v][ idx_flux + didx_flux[0] ] - g_Flux[0][v][idx_flux];
+         const real dF1     = g_Flux[1][v][ idx_flux + didx_flux[1] ] - g_Flux[1][v][idx_flux];
+         const real dF2     = g_Flux[2][v][ idx_flux + didx_flux[2] ] - g_Flux[2][v][idx_flux];
+#        endif
+
+         const int idx_in   = IDX321( i_out+FLU_GHOST_SIZE, j_out+FLU_GHOST_SIZE, k_out+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT );
+
+         g_Out_v[idx_out] = FMAX( g_Input_v[idx_in] - dt_dh*( dF0 + dF1 + dF2 ), TINY_NUMBER );
+      }
+   } // for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+#  endif // #if ( NCOMP_PASSIVE > 0 )
+
+
    CGPU_LOOP( idx_out, CUBE(PS2) )
    {
       const int i_out    = idx_out % PS2;
@@ -93,8 +154,9 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
 
 //    1. calculate flux difference to update the fluid data
+//    --> passive scalars have been updated in step 0
       for (int d=0; d<3; d++)
-      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int v=0; v<NCOMP_FLUID; v++)
       {
 #        ifdef MHD
          dFlux[d][v] = g_Flux[d][v][idx_flux] - g_Flux[d][v][ idx_flux - didx_flux[d] ];
@@ -103,7 +165,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 #        endif
       }
 
-      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int v=0; v<NCOMP_FLUID; v++)
          Output_1Cell[v] = g_Input[v][idx_in] - dt_dh*( dFlux[0][v] + dFlux[1][v] + dFlux[2][v] );
 
 
@@ -127,19 +189,82 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 #     endif // #ifdef BAROTROPIC_EOS
 
 
-//    2. floor and normalize passive scalars
+//    2. apply the corrector step of the external acceleration for UNSPLIT_GRAVITY
+//    --> the predictor step has been applied to the half-step velocity in Hydro_ComputeFlux()
+#     ifdef UNSPLIT_GRAVITY
+      if ( FuseExtAcc )
+      {
+         const double x = g_Corner[0] + (double)(i_out*dh);
+         const double y = g_Corner[1] + (double)(j_out*dh);
+         const double z = g_Corner[2] + (double)(k_out*dh);
+
+         real acc_old[3], acc_new[3];
+
+         ExtAcc_Func( acc_old, x, y, z, TimeOld, ExtAcc_AuxArray );
+         ExtAcc_Func( acc_new, x, y, z, TimeNew, ExtAcc_AuxArray );
+         for (int d=0; d<3; d++)
+         {
+            acc_old[d] *= dt;
+            acc_new[d] *= dt;
+         }
+
+         const real rho_old = g_Input[DENS][idx_in];
+         const real px_old  = g_Input[MOMX][idx_in];
+         const real py_old  = g_Input[MOMY][idx_in];
+         const real pz_old  = g_Input[MOMZ][idx_in];
+         const real rho_new = Output_1Cell[DENS];
+
+//       backup the original non-kinetic energy so that we can restore it later if necessary
+//       --> not required by the dual-energy formalism, which will correct the internal energy in step 4
+#        ifndef DUAL_ENERGY
+         const real _rho2   = (real)0.5/rho_new;
+         const real Enki_in = Output_1Cell[ENGY] - _rho2*( SQR(Output_1Cell[MOMX]) + SQR(Output_1Cell[MOMY]) +
+                                                            SQR(Output_1Cell[MOMZ]) );
+#        endif
+
+//       update the momentum density
+         const real px_new  = Output_1Cell[MOMX] + (real)0.5*( rho_old*acc_old[0] + rho_new*acc_new[0] );
+         const real py_new  = Output_1Cell[MOMY] + (real)0.5*( rho_old*acc_old[1] + rho_new*acc_new[1] );
+         const real pz_new  = Output_1Cell[MOMZ] + (real)0.5*( rho_old*acc_old[2] + rho_new*acc_new[2] );
+
+//       update the total energy density
+         real Etot_out = Output_1Cell[ENGY] + (real)0.5*( px_old*acc_old[0] + py_old*acc_old[1] + pz_old*acc_old[2] +
+                                                          px_new*acc_new[0] + py_new*acc_new[1] + pz_new*acc_new[2] );
+
+//       restore the original internal energy if the updated value becomes smaller than the threshold
+#        ifndef DUAL_ENERGY
+         const real Ekin_out = _rho2*( SQR(px_new) + SQR(py_new) + SQR(pz_new) );
+#        ifdef MHD
+         Emag = MHD_GetCellCenteredBEnergy( g_FC_B[MAGX], g_FC_B[MAGY], g_FC_B[MAGZ],
+                                            PS2, PS2, PS2, i_out, j_out, k_out );
+#        else
+         Emag = (real)0.0;
+#        endif
+         if ( Etot_out - Ekin_out - Emag < MinEint )  Etot_out = Enki_in + Ekin_out;
+#        endif
+
+         Output_1Cell[MOMX] = px_new;
+         Output_1Cell[MOMY] = py_new;
+         Output_1Cell[MOMZ] = pz_new;
+         Output_1Cell[ENGY] = Etot_out;
+      } // if ( FuseExtAcc )
+#     endif // #ifdef UNSPLIT_GRAVITY
+
+
+//    3. reload the floored passive scalars and normalize them
 #     if ( NCOMP_PASSIVE > 0 )
-      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Output_1Cell[v] = FMAX( Output_1Cell[v], TINY_NUMBER );
+      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Output_1Cell[v] = g_Output[v][idx_out];
 
       if ( NormPassive )
          Hydro_NormalizePassive( Output_1Cell[DENS], Output_1Cell+NCOMP_FLUID, NNorm, NormIdx );
 #     endif
 
 
-//    3. apply the dual-energy formalism to correct the internal energy
+//    4. apply the dual-energy formalism to correct the internal energy
 //    --> currently, even when UNSPLIT_GRAVITY is on (which would update the internal energy), we still invoke
 //        Hydro_DualEnergyFix() here and will fix the internal energy in the gravity solver for cells updated
 //        by the dual-energy formalism (i.e., for cells with their dual-energy status marked as DE_UPDATED_BY_DUAL)
+//        --> except for FuseExtAcc, for which the gravity update has been applied in step 2
 //    --> this feature might be modified in the future
 #     ifdef DUAL_ENERGY
 //    B field must be updated in advance
@@ -155,15 +280,15 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
       Hydro_DualEnergyFix( Output_1Cell[DENS], Output_1Cell[MOMX], Output_1Cell[MOMY], Output_1Cell[MOMZ],
                            Output_1Cell[ENGY], Output_1Cell[ENPY], g_DE_Status[idx_out],
-                           EoS_AuxArray[1], EoS_AuxArray[2], CheckMinPres_No, NULL_REAL, DualEnergySwitch, Emag );
+                           EOS_AUX_GAMMA_M1(EoS_AuxArray), EOS_AUX__GAMMA_M1(EoS_AuxArray), CheckMinPres_No, NULL_REAL, DualEnergySwitch, Emag );
 #     endif // #ifdef DUAL_ENERGY
 
 
-//    4. store results to the output array
+//    5. store results to the output array
       for (int v=0; v<NCOMP_TOTAL; v++)   g_Output[v][idx_out] = Output_1Cell[v];
 
 
-//    5. check the negative density and energy
+//    6. check the negative density and energy
 #     ifdef CHECK_NEGATIVE_IN_FLUID
       if ( Hydro_CheckNegative(Output_1Cell[DENS]) )
          printf( "WARNING : invalid density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
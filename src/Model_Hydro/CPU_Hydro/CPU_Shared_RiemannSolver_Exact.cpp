@@ -5,9 +5,10 @@
 
 #include "CUFLU.h"
 
+// the CPU version is always compiled for pure hydro (including FLU_SCHEME == RTVD) since it is also used by
+// OPT__1ST_FLUX_CORR_SCHEME=RSOLVER_1ST_EXACT
 #if (  MODEL == HYDRO  &&  \
-       ( RSOLVER == EXACT || CHECK_INTERMEDIATE == EXACT )  &&  \
-       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
+       (  RSOLVER == EXACT  ||  CHECK_INTERMEDIATE == EXACT  ||  ( !defined __CUDACC__ && !defined MHD )  )  )
 
 
 
@@ -30,9 +31,9 @@ void Hydro_Rotate3D( real InOut[], const int XYZ, const bool Forward, const int
 
 // internal functions (GPU_DEVICE is defined in CUFLU.h)
 GPU_DEVICE static real Solve_f( const real rho,const real p,const real p_star,const real Gamma );
-#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+GPU_DEVICE static bool Solve_PStar_Newton( real &p_star, const real L[], const real R[], const real Gamma );
+GPU_DEVICE static real Solve_PStar_Bisection( const real L[], const real R[], const real Gamma );
 GPU_DEVICE static void Set_Flux( real flux[], const real val[], const real Gamma );
-#endif
 
 
 
@@ -44,6 +45,11 @@ GPU_DEVICE static void Set_Flux( real flux[], const real val[], const real Gamma
 // Note        :  1. Input data should be primitive variables
 //                2. This function is shared by MHM, MHM_RP, and CTU schemes
 //                3. Currently it does NOT check the minimum density and pressure criteria
+//                4. Star-region pressure is solved by the Newton-Raphson iteration with an adaptive initial guess
+//                   (see Solve_PStar_Newton()), which falls back to the bisection method (see Solve_PStar_Bisection())
+//                   when it fails (e.g., for the vacuum-generating states)
+//                   --> Ref: E. F. Toro, Riemann Solvers and Numerical Methods for Fluid Dynamics, Sec. 4.3 and 9.5
+//                5. Also used by OPT__1ST_FLUX_CORR_SCHEME=RSOLVER_1ST_EXACT in Flu_Close()
 //
 // Parameter   :  XYZ               : Target spatial direction : (0/1/2) --> (x/y/z)
 //                Flux_Out          : Output array to store the average flux along t axis
@@ -73,8 +79,8 @@ void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[
 #  endif // #ifdef GAMER_DEBUG
 
 
-   const real Gamma           = EoS_AuxArray[0];      // only support constant-gamma EoS (i.e., EOS_GAMMA)
-   const real Gamma_m1        = EoS_AuxArray[1];
+   const real Gamma           = EOS_AUX_GAMMA(EoS_AuxArray);      // only support constant-gamma EoS (i.e., EOS_GAMMA)
+   const real Gamma_m1        = EOS_AUX_GAMMA_M1(EoS_AuxArray);
    const real Gamma_p1        = Gamma + (real)1.0;
    const real c               = Gamma_m1 / Gamma_p1;
    const bool NormPassive_No  = false;                // no need to convert passive scalars to mass fraction
@@ -103,80 +109,8 @@ void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[
 
 
 // solution of pressure
-   {
-      const real du = R[1] - L[1];
-
-      real f;
-      real f_L;
-      real f_R;
-      real bound[2];
-      real compare[2];
-
-      bound[0] = FMIN( L[4], R[4] );
-      bound[1] = FMAX( L[4], R[4] );
-
-      for (int i=0; i<2; i++)
-          {
-             f_L = Solve_f( L[0], L[4], bound[i], Gamma );
-             f_R = Solve_f( R[0], R[4], bound[i], Gamma );
-
-             compare[i] = f_L + f_R + du;
-          }
-
-      if( compare[0]*compare[1] > (real)0.0 )
-      {
-        if( compare[0] > (real)0.0 )
-        {
-           bound[1] = bound[0];
-           bound[0] = (real)0.0;
-        }
-        else if( compare[1] < (real)0.0 )
-        {
-           bool Continue;
-
-           bound[0] = bound[1];
-           bound[1] = (real)2.0*bound[0];
-
-           do
-           {
-              for (int i=0; i<2; i++)
-              {
-                 f_L = Solve_f( L[0], L[4], bound[i], Gamma );
-                 f_R = Solve_f( R[0], R[4], bound[i], Gamma );
-
-                 compare[i] = f_L + f_R + du;
-              }
-
-              Continue = ( compare[0]*compare[1] > (real)0.0 );
-
-              if ( Continue )
-              {
-                 bound[0] = bound[1];
-                 bound[1] = bound[0]*(real)2.0;
-              }
-           }
-           while ( Continue );
-        }
-      }
-
-//    search p_star
-      do
-      {
-         L_star[4] = (real)0.5 * ( bound[0] + bound[1] );
-
-         if (  ( L_star[4] == bound[0] )  ||  ( L_star[4] == bound[1] )  )    break;
-         else
-         {
-            f_L = Solve_f( L[0], L[4], L_star[4], Gamma );
-            f_R = Solve_f( R[0], R[4], L_star[4], Gamma );
-            f   = f_L + f_R + du;
-
-            if ( f > (real)0.0 )    bound[1] = L_star[4];
-            else                    bound[0] = L_star[4];
-         }
-      }
-      while ( FABS(f) >= MAX_ERROR );
-   }
+   if (  ! Solve_PStar_Newton( L_star[4], L, R, Gamma )  )
+      L_star[4] = Solve_PStar_Bisection( L, R, Gamma );
 
    R_star[4] = L_star[4];
 
@@ -425,7 +359,267 @@ real Solve_f( const real rho, const real p, const real p_star, const real Gamma
 
 
 
-#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Solve_PStar_Newton
+// Description :  Solve the star-region pressure by the Newton-Raphson iteration
+//
+// Note        :  1. Initial guess is chosen adaptively from the primitive-variable (PVRS), two-rarefaction (TRRS),
+//                   and two-shock (TSRS) approximate Riemann solvers
+//                   --> Usually converge in 2-3 iterations
+//                2. All gamma exponents are computed once in advance, and each side requires only a single POW()
+//                   per iteration for a rarefaction since p^(-G2) = p^G1/p
+//                3. Converge when either the relative pressure change or the residual is smaller than MAX_ERROR,
+//                   or when the residual stops decreasing on the left of the solution (i.e., reaching the round-off level)
+//                4. Return false for the vacuum-generating states and when the iteration fails to converge within
+//                   EXACT_NEWTON_MAXITER iterations
+//                   --> p_star is then undefined and the caller should switch to Solve_PStar_Bisection()
+//
+// Parameter   :  p_star : Star-region pressure to be returned
+//                L/R    : Left/right primitive variables rotated to the x direction
+//                Gamma  : Ratio of specific heats
+//
+// Return      :  p_star, true/false <-> converged/failed
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+bool Solve_PStar_Newton( real &p_star, const real L[], const real R[], const real Gamma )
+{
+
+#  define EXACT_NEWTON_MAXITER   20
+
+   const real G1 = (real)0.5*( Gamma - (real)1.0 )/Gamma;
+   const real G4 = (real)2.0/( Gamma - (real)1.0 );
+   const real G5 = (real)2.0/( Gamma + (real)1.0 );
+   const real G6 = ( Gamma - (real)1.0 )/( Gamma + (real)1.0 );
+   const real G7 = (real)0.5*( Gamma - (real)1.0 );
+
+   const real a_L  = SQRT( Gamma*L[4]/L[0] );
+   const real a_R  = SQRT( Gamma*R[4]/R[0] );
+   const real du   = R[1] - L[1];
+   const real A_L  = G5/L[0];
+   const real A_R  = G5/R[0];
+   const real B_L  = G6*L[4];
+   const real B_R  = G6*R[4];
+   const real _ra_L = (real)1.0/( L[0]*a_L );
+   const real _ra_R = (real)1.0/( R[0]*a_R );
+
+
+// 1. no positive solution for the vacuum-generating states
+   if ( G4*( a_L + a_R ) <= du )    return false;
+
+
+// 2. adaptive initial guess
+   const real Q_User = (real)2.0;
+   const real p_min  = FMIN( L[4], R[4] );
+   const real p_max  = FMAX( L[4], R[4] );
+   const real p_pv   = FMAX(  (real)0.0, (real)0.5*( L[4] + R[4] ) - (real)0.125*du*( L[0] + R[0] )*( a_L + a_R )  );
+
+   real p;
+
+// 2-1. PVRS for smooth flows
+   if ( p_max/p_min <= Q_User  &&  p_pv >= p_min  &&  p_pv <= p_max )
+      p = p_pv;
+
+// 2-2. TRRS for two rarefactions
+   else if ( p_pv < p_min )
+   {
+      const real pq   = POW( L[4]/R[4], G1 );
+      const real u_m  = ( pq*L[1]/a_L + R[1]/a_R + G4*( pq - (real)1.0 ) ) / ( pq/a_L + (real)1.0/a_R );
+      const real pt_L = (real)1.0 + G7*( L[1] - u_m )/a_L;
+      const real pt_R = (real)1.0 + G7*( u_m - R[1] )/a_R;
+
+      p = (real)0.5*(  L[4]*POW( pt_L, (real)1.0/G1 ) + R[4]*POW( pt_R, (real)1.0/G1 )  );
+   }
+
+// 2-3. TSRS otherwise
+   else
+   {
+      const real ge_L = SQRT( A_L/( B_L + p_pv ) );
+      const real ge_R = SQRT( A_R/( B_R + p_pv ) );
+
+      p = ( ge_L*L[4] + ge_R*R[4] - du )/( ge_L + ge_R );
+   }
+
+   if ( p <= (real)0.0 )   p = (real)0.5*p_min;
+
+
+// 3. Newton-Raphson iteration
+// --> once an iterate lies on the left of the solution (i.e., f<0), all subsequent iterates stay on the left since
+//     f_L+f_R is monotonically increasing and concave, and |f| thus decreases monotonically until reaching the
+//     round-off level
+   real f_old     = HUGE_NUMBER;
+   bool ReachLeft = false;
+
+   for (int iter=0; iter<EXACT_NEWTON_MAXITER; iter++)
+   {
+      real f_L, f_R, df_L, df_R;
+
+      if ( p > L[4] )
+      {
+         const real qrt = SQRT( A_L/( B_L + p ) );
+         f_L  = ( p - L[4] )*qrt;
+         df_L = (  (real)1.0 - (real)0.5*( p - L[4] )/( B_L + p )  )*qrt;
+      }
+      else
+      {
+         const real prat = p/L[4];
+         const real pg   = POW( prat, G1 );
+         f_L  = G4*a_L*( pg - (real)1.0 );
+         df_L = _ra_L*pg/prat;
+      }
+
+      if ( p > R[4] )
+      {
+         const real qrt = SQRT( A_R/( B_R + p ) );
+         f_R  = ( p - R[4] )*qrt;
+         df_R = (  (real)1.0 - (real)0.5*( p - R[4] )/( B_R + p )  )*qrt;
+      }
+      else
+      {
+         const real prat = p/R[4];
+         const real pg   = POW( prat, G1 );
+         f_R  = G4*a_R*( pg - (real)1.0 );
+         df_R = _ra_R*pg/prat;
+      }
+
+      const real f = f_L + f_R + du;
+
+//    (a) same residual criterion as Solve_PStar_Bisection()
+      if ( FABS(f) < MAX_ERROR )
+      {
+         p_star = p;
+         return true;
+      }
+
+//    (b) |f| stops decreasing after reaching the left of the solution
+//        --> round-off level reached for the ill-conditioned cases (e.g., strong rarefactions)
+//        --> return the previous iterate
+      if ( ReachLeft  &&  FABS(f) >= FABS(f_old) )    return true;
+
+      if ( f < (real)0.0 )    ReachLeft = true;
+
+      f_old  = f;
+      p_star = p;
+
+      real p_new = p - f/( df_L + df_R );
+
+//    Newton steps can only overshoot to negative pressure from the right of the solution
+      if ( p_new <= (real)0.0 )   p_new = (real)0.5*p;
+
+//    (c) relative pressure change
+      const bool Converged = (  (real)2.0*FABS( p_new - p ) <= MAX_ERROR*( p_new + p )  );
+
+      p = p_new;
+
+      if ( Converged )
+      {
+         p_star = p;
+         return true;
+      }
+   } // for (int iter=0; iter<EXACT_NEWTON_MAXITER; iter++)
+
+   return false;
+
+#  undef EXACT_NEWTON_MAXITER
+
+} // FUNCTION : Solve_PStar_Newton
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Solve_PStar_Bisection
+// Description :  Solve the star-region pressure by the bisection method
+//
+// Note        :  1. Robust but slow --> only used when Solve_PStar_Newton() fails
+//
+// Parameter   :  L/R   : Left/right primitive variables rotated to the x direction
+//                Gamma : Ratio of specific heats
+//
+// Return      :  Star-region pressure
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+real Solve_PStar_Bisection( const real L[], const real R[], const real Gamma )
+{
+
+   const real du = R[1] - L[1];
+
+   real f;
+   real f_L;
+   real f_R;
+   real p_star;
+   real bound[2];
+   real compare[2];
+
+   bound[0] = FMIN( L[4], R[4] );
+   bound[1] = FMAX( L[4], R[4] );
+
+   for (int i=0; i<2; i++)
+   {
+      f_L = Solve_f( L[0], L[4], bound[i], Gamma );
+      f_R = Solve_f( R[0], R[4], bound[i], Gamma );
+
+      compare[i] = f_L + f_R + du;
+   }
+
+   if( compare[0]*compare[1] > (real)0.0 )
+   {
+      if( compare[0] > (real)0.0 )
+      {
+         bound[1] = bound[0];
+         bound[0] = (real)0.0;
+      }
+      else if( compare[1] < (real)0.0 )
+      {
+         bool Continue;
+
+         bound[0] = bound[1];
+         bound[1] = (real)2.0*bound[0];
+
+         do
+         {
+            for (int i=0; i<2; i++)
+            {
+               f_L = Solve_f( L[0], L[4], bound[i], Gamma );
+               f_R = Solve_f( R[0], R[4], bound[i], Gamma );
+
+               compare[i] = f_L + f_R + du;
+            }
+
+            Continue = ( compare[0]*compare[1] > (real)0.0 );
+
+            if ( Continue )
+            {
+               bound[0] = bound[1];
+               bound[1] = bound[0]*(real)2.0;
+            }
+         }
+         while ( Continue );
+      }
+   }
+
+// search p_star
+   do
+   {
+      p_star = (real)0.5 * ( bound[0] + bound[1] );
+
+      if (  ( p_star == bound[0] )  ||  ( p_star == bound[1] )  )    break;
+      else
+      {
+         f_L = Solve_f( L[0], L[4], p_star, Gamma );
+         f_R = Solve_f( R[0], R[4], p_star, Gamma );
+         f   = f_L + f_R + du;
+
+         if ( f > (real)0.0 )    bound[1] = p_star;
+         else                    bound[0] = p_star;
+      }
+   }
+   while ( FABS(f) >= MAX_ERROR );
+
+   return p_star;
+
+} // FUNCTION : Solve_PStar_Bisection
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Set_Flux
 // Description :  Set the flux function evaluated at the given state
@@ -449,11 +643,10 @@ void Set_Flux( real flux[], const real val[], const real Gamma )
                      + val[4]/Gamma_m1 + val[4]  );
 
 } // FUNCTION : Set_Flux
-#endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 
 
 
-#endif // #if ( MODEL == HYDRO  &&  ( RSOLVER == EXACT || CHECK_INTE == EXACT ) && ( SCHEME == MHM/MHM_RP/CTU ) )
+#endif // #if ( MODEL == HYDRO  &&  ( RSOLVER == EXACT || CHECK_INTE == EXACT || CPU hydro ) )
 
 
 
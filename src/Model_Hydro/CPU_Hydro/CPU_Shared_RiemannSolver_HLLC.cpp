@@ -94,8 +94,8 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
                            EoS_DensEint2Pres, EoS_AuxArray, NULL );
    P_R   = Hydro_Con2Pres( R[0], R[1], R[2], R[3], R[4], R+NCOMP_FLUID, CheckMinPres_Yes, MinPres, Emag,
                            EoS_DensEint2Pres, EoS_AuxArray, NULL );
-   Cs_L  = SQRT(  EoS_DensPres2CSqr( L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray )  );
-   Cs_R  = SQRT(  EoS_DensPres2CSqr( R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray )  );
+   Cs_L  = SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray )  );
+   Cs_R  = SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray )  );
 
 #  ifdef CHECK_NEGATIVE_IN_FLUID
    if ( Hydro_CheckNegative(P_L) )
@@ -135,9 +135,9 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
 #     error : ERROR : HLL_WAVESPEED_ROE only works with EOS_GAMMA !!
 #  endif
 
-   const real Gamma    = (real)EoS_AuxArray[0];
-   const real Gamma_m1 = (real)EoS_AuxArray[1];
-   const real _Gamma   = (real)EoS_AuxArray[3];
+   const real Gamma    = (real)EOS_AUX_GAMMA(EoS_AuxArray);
+   const real Gamma_m1 = (real)EOS_AUX_GAMMA_M1(EoS_AuxArray);
+   const real _Gamma   = (real)EOS_AUX__GAMMA(EoS_AuxArray);
 
    real V2_Roe, Cs2_Roe, Cs_Roe, TempRho, TempPres;
 
@@ -177,8 +177,8 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
 // for EOS_GAMMA/EOS_ISOTHERMAL, the calculations of Gamma_SL/R can be greatly simplified
 // --> results should be exactly the same except for round-off errors
 #  if   ( EOS == EOS_GAMMA )
-   Gamma_SL    = (real)EoS_AuxArray[0];
-   Gamma_SR    = (real)EoS_AuxArray[0];
+   Gamma_SL    = (real)EOS_AUX_GAMMA(EoS_AuxArray);
+   Gamma_SR    = (real)EOS_AUX_GAMMA(EoS_AuxArray);
 #  elif ( EOS == EOS_ISOTHERMAL )
    Gamma_SL    = ONE;
    Gamma_SR    = ONE;
@@ -193,8 +193,8 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
    Rho_SR      = FMAX( Rho_SR, MinDens );
    _P          = ONE / P_PVRS;
 // see Eq. [9.8] in Toro 1999 for passive scalars
-   Gamma_SL    = EoS_DensPres2CSqr( Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray )*Rho_SL*_P;
-   Gamma_SR    = EoS_DensPres2CSqr( Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray )*Rho_SR*_P;
+   Gamma_SL    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray )*Rho_SL*_P;
+   Gamma_SR    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray )*Rho_SR*_P;
 #  endif // EOS
 
    q_L = ( P_PVRS <= P_L ) ? ONE : SQRT(  ONE + _TWO*( Gamma_SL + ONE )/Gamma_SL*( P_PVRS/P_L - ONE )  );
@@ -325,6 +325,159 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
 
 
 
+#ifdef RSOLVER_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLC_Batch
+// Description :  Batched version of Hydro_RiemannSolver_HLLC() for solving NBatch interfaces at a time
+//
+// Note        :  1. CPU only and enabled by RSOLVER_BATCH in CUFLU.h
+//                   --> Only support EOS_GAMMA and HLL_WAVESPEED_DAVIS
+//                2. Input and output arrays are organized as structure-of-arrays (i.e., [NCOMP][NBatch])
+//                   so that the loop over interfaces can be vectorized by the compiler
+//                3. Follow exactly the same order of floating-point operations as Hydro_RiemannSolver_HLLC()
+//                   --> The EoS routines are inlined assuming EOS_GAMMA
+//                   --> Spatial rotation is replaced by index mapping
+//                   --> Branches on the sign of V_S are replaced by selections
+//                4. All arithmetic is done in real_fc, which is single precision for MIXED_PRECISION
+//                   --> Results are identical to the scalar solver only when real_fc == real
+//
+// Parameter   :  XYZ          : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NBatch       : Number of interfaces to be solved (<= N_FC_VAR)
+//                Flux_Out     : Array to store the output fluxes
+//                L/R_In       : Input left/right states (conserved variables)
+//                MinPres      : Pressure floor
+//                EoS_AuxArray : Auxiliary array for the EoS routines
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NBatch, real_fc Flux_Out[][N_FC_VAR],
+                                     const real_fc L_In[][N_FC_VAR], const real_fc R_In[][N_FC_VAR],
+                                     const real_fc MinPres, const double EoS_AuxArray[] )
+{
+
+   const real_fc ZERO     = (real_fc)0.0;
+   const real_fc ONE      = (real_fc)1.0;
+   const real_fc _TWO     = (real_fc)0.5;
+   const real_fc Gamma    = (real_fc)EOS_AUX_GAMMA(EoS_AuxArray);
+   const real_fc Gamma_m1 = (real_fc)EOS_AUX_GAMMA_M1(EoS_AuxArray);
+
+// index mapping of the normal and transverse momentum components (equivalent to Hydro_Rotate3D())
+   const int  Mn  = 1 + (XYZ  )%3;
+   const int  Mt1 = 1 + (XYZ+1)%3;
+   const int  Mt2 = 1 + (XYZ+2)%3;
+
+
+#  if ( NCOMP_PASSIVE > 0 )
+   int  Pas_Upwind_L[N_FC_VAR];
+   real_fc Pas_Vx      [N_FC_VAR];
+#  endif
+
+
+#  pragma omp simd
+   for (int n=0; n<NBatch; n++)
+   {
+//    1. load the rotated left/right states
+      const real_fc L0 = L_In[0  ][n];
+      const real_fc L1 = L_In[Mn ][n];
+      const real_fc L2 = L_In[Mt1][n];
+      const real_fc L3 = L_In[Mt2][n];
+      const real_fc L4 = L_In[4  ][n];
+      const real_fc R0 = R_In[0  ][n];
+      const real_fc R1 = R_In[Mn ][n];
+      const real_fc R2 = R_In[Mt1][n];
+      const real_fc R3 = R_In[Mt2][n];
+      const real_fc R4 = R_In[4  ][n];
+
+
+//    2. estimate the maximum wave speeds
+      const real_fc _RhoL = ONE / L0;
+      const real_fc _RhoR = ONE / R0;
+      const real_fc u_L   = _RhoL*L1;
+      const real_fc u_R   = _RhoR*R1;
+      real_fc P_L, P_R;
+
+      P_L = ( L4 - _TWO*( SQR(L1) + SQR(L2) + SQR(L3) ) / L0 )*Gamma_m1;
+      P_R = ( R4 - _TWO*( SQR(R1) + SQR(R2) + SQR(R3) ) / R0 )*Gamma_m1;
+      P_L = ( P_L == P_L ) ? FMAX_SIMD( P_L, MinPres ) : P_L;
+      P_R = ( P_R == P_R ) ? FMAX_SIMD( P_R, MinPres ) : P_R;
+
+      const real_fc Cs_L = SQRT( Gamma * P_L / L0 );
+      const real_fc Cs_R = SQRT( Gamma * P_R / R0 );
+      const real_fc W_L1 = u_L - Cs_L;
+      const real_fc W_L2 = u_R - Cs_R;
+      const real_fc W_R1 = u_L + Cs_L;
+      const real_fc W_R2 = u_R + Cs_R;
+      const real_fc W_L  = FMIN_SIMD( W_L1, W_L2 );
+      const real_fc W_R  = FMAX_SIMD( W_R1, W_R2 );
+
+
+//    3. evaluate the star-region velocity (V_S) and pressure (P_S)
+      const real_fc temp1_L = +L0*(  ( W_L1 < W_L2 ) ? Cs_L : (u_L-u_R)+Cs_R  );
+      const real_fc temp1_R = -R0*(  ( W_R2 > W_R1 ) ? Cs_R : (u_L-u_R)+Cs_L  );
+      const real_fc temp2   = ONE / ( temp1_L - temp1_R );
+      const real_fc V_S     = temp2*( P_L - P_R + temp1_L*u_L - temp1_R*u_R );
+      real_fc       P_S     = temp2*(  temp1_L*( P_R + temp1_R*u_R ) - temp1_R*( P_L + temp1_L*u_L )  );
+
+      P_S = ( P_S == P_S ) ? FMAX_SIMD( P_S, MinPres ) : P_S;
+
+
+//    4. evaluate the weightings of the left/right fluxes and contact wave
+//    --> V_S>=0>=MaxV for the left state and V_S<0<=MaxV for the right state
+//        --> V_S-MaxV==0 if and only if V_S==MaxV==0, which can only happen for the left state
+      const bool Upwind_L        = ( V_S >= ZERO );
+      const real_fc MaxV            = ( Upwind_L ) ? FMIN_SIMD( W_L, ZERO ) : FMAX_SIMD( W_R, ZERO );
+      const real_fc V_S_minus_MaxV  = V_S - MaxV;
+      const bool BothZero        = ( V_S_minus_MaxV == ZERO );
+      const real_fc temp4           = ONE / V_S_minus_MaxV;
+      const real_fc Coeff_LR        = ( BothZero ) ? ONE  :  temp4*V_S;
+      const real_fc Coeff_S         = ( BothZero ) ? ZERO : -temp4*MaxV*P_S;
+
+      const real_fc S0 = ( Upwind_L ) ? L0  : R0;
+      const real_fc S1 = ( Upwind_L ) ? L1  : R1;
+      const real_fc S2 = ( Upwind_L ) ? L2  : R2;
+      const real_fc S3 = ( Upwind_L ) ? L3  : R3;
+      const real_fc S4 = ( Upwind_L ) ? L4  : R4;
+      const real_fc P  = ( Upwind_L ) ? P_L : P_R;
+      const real_fc u  = ( Upwind_L ) ? u_L : u_R;
+
+
+//    5. evaluate the HLLC fluxes
+      Flux_Out[0  ][n] = Coeff_LR*( S1                 - MaxV*S0 );
+      Flux_Out[Mn ][n] = Coeff_LR*( ( u*S1 + P )       - MaxV*S1 ) + Coeff_S;
+      Flux_Out[Mt1][n] = Coeff_LR*( u*S2               - MaxV*S2 );
+      Flux_Out[Mt2][n] = Coeff_LR*( u*S3               - MaxV*S3 );
+      Flux_Out[4  ][n] = Coeff_LR*( u*( S4 + P )       - MaxV*S4 ) + Coeff_S*V_S;
+
+
+//    6. record the upwind direction and velocity for the passive scalars
+#     if ( NCOMP_PASSIVE > 0 )
+      const real_fc FluxDens = Flux_Out[FLUX_DENS][n];
+
+      Pas_Upwind_L[n] = ( FluxDens >= ZERO );
+      Pas_Vx      [n] = FluxDens*( ( Pas_Upwind_L[n] ) ? _RhoL : _RhoR );
+#     endif
+   } // for (int n=0; n<NBatch; n++)
+
+
+// 7. evaluate the fluxes of passive scalars
+//    --> done in a separate loop so that the loop over interfaces can be vectorized for any NCOMP_PASSIVE
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int n=0; n<NBatch; n++)
+      {
+         const real_fc Pas_L = L_In[v][n];
+         const real_fc Pas_R = R_In[v][n];
+
+         Flux_Out[v][n] = ( ( Pas_Upwind_L[n] ) ? Pas_L : Pas_R )*Pas_Vx[n];
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLC_Batch
+#endif // #ifdef RSOLVER_BATCH
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
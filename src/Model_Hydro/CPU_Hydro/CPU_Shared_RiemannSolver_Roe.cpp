@@ -100,7 +100,7 @@ void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[],
    Hydro_Rotate3D( R, XYZ, true, MAG_OFFSET );
 
 // longitudinal B field in the left and right states should be the same
-#  ifdef GAMER_DEBUG
+#  if ( defined GAMER_DEBUG  &&  defined MHD )
    if ( L[MAG_OFFSET] != R[MAG_OFFSET] )
       printf( "ERROR : BxL (%24.17e) != BxR (%24.17e) for XYZ %d at file <%s>, line <%d>, function <%s>!!\n",
               L[MAG_OFFSET], R[MAG_OFFSET], XYZ, __FILE__, __LINE__, __FUNCTION__ );
@@ -111,8 +111,8 @@ void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[],
    const real ZERO             = (real)0.0;
    const real ONE              = (real)1.0;
    const real _TWO             = (real)0.5;
-   const real Gamma            = EoS_AuxArray[0];    // only support constant-gamma EoS (i.e., EOS_GAMMA)
-   const real Gamma_m1         = EoS_AuxArray[1];
+   const real Gamma            = EOS_AUX_GAMMA(EoS_AuxArray);    // only support constant-gamma EoS (i.e., EOS_GAMMA)
+   const real Gamma_m1         = EOS_AUX_GAMMA_M1(EoS_AuxArray);
    const bool CheckMinPres_Yes = true;
 #  ifdef MHD
    const real TWO              = (real)2.0;
@@ -704,6 +704,250 @@ void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[],
 
 
 
+#ifdef RSOLVER_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_Roe_Batch
+// Description :  Batched version of Hydro_RiemannSolver_Roe() for solving NBatch interfaces at a time
+//
+// Note        :  1. CPU only and enabled by RSOLVER_BATCH in CUFLU.h
+//                   --> Only support pure hydro and EOS_GAMMA
+//                2. Input and output arrays are organized as structure-of-arrays (i.e., [NCOMP][NBatch])
+//                   so that the loop over interfaces can be vectorized by the compiler
+//                3. Follow exactly the same order of floating-point operations as Hydro_RiemannSolver_Roe()
+//                   --> Spatial rotation is replaced by index mapping
+//                   --> Early returns for the supersonic flows are replaced by selections
+//                4. Interfaces failing the intermediate-state check (CHECK_INTERMEDIATE) are recorded and
+//                   then re-solved by the scalar solver Hydro_RiemannSolver_Roe(), which invokes the
+//                   substitute Riemann solver
+//                5. All arithmetic is done in real_fc, which is single precision for MIXED_PRECISION
+//                   --> Results are identical to the scalar solver only when real_fc == real
+//
+// Parameter   :  XYZ               : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NBatch            : Number of interfaces to be solved (<= N_FC_VAR)
+//                Flux_Out          : Array to store the output fluxes
+//                L/R_In            : Input left/right states (conserved variables)
+//                MinDens/Pres      : Density and pressure floors
+//                EoS_DensEint2Pres : EoS routine to compute the gas pressure     (for the scalar fallback only)
+//                EoS_DensPres2CSqr : EoS routine to compute the sound speed square (for the scalar fallback only)
+//                EoS_AuxArray      : Auxiliary array for the EoS routines
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_Roe_Batch( const int XYZ, const int NBatch, real_fc Flux_Out[][N_FC_VAR],
+                                    const real_fc L_In[][N_FC_VAR], const real_fc R_In[][N_FC_VAR],
+                                    const real_fc MinDens, const real_fc MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                    const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray[] )
+{
+
+   const real_fc ZERO     = (real_fc)0.0;
+   const real_fc ONE      = (real_fc)1.0;
+   const real_fc _TWO     = (real_fc)0.5;
+   const real_fc Gamma    = EOS_AUX_GAMMA(EoS_AuxArray);
+   const real_fc Gamma_m1 = EOS_AUX_GAMMA_M1(EoS_AuxArray);
+
+// index mapping of the normal and transverse momentum components (equivalent to Hydro_Rotate3D())
+   const int  Mn  = 1 + (XYZ  )%3;
+   const int  Mt1 = 1 + (XYZ+1)%3;
+   const int  Mt2 = 1 + (XYZ+2)%3;
+   const int  idx_rot[NWAVE] = { 0, Mn, Mt1, Mt2, 4 };
+
+#  ifdef CHECK_INTERMEDIATE
+   bool Fallback[N_FC_VAR];
+#  endif
+
+
+#  if ( NCOMP_PASSIVE > 0 )
+   int  Pas_Upwind_L[N_FC_VAR];
+   real_fc Pas_Vx      [N_FC_VAR];
+#  endif
+
+
+#  pragma omp simd
+   for (int n=0; n<NBatch; n++)
+   {
+      real_fc L[NWAVE], R[NWAVE];
+
+//    1. load the rotated left/right states
+      for (int v=0; v<NWAVE; v++)
+      {
+         L[v] = L_In[ idx_rot[v] ][n];
+         R[v] = R_In[ idx_rot[v] ][n];
+      }
+
+
+//    2. evaluate the average values
+      const real_fc _RhoL = ONE / L[0];
+      const real_fc _RhoR = ONE / R[0];
+      real_fc PL, PR;
+
+      PL = ( L[4] - _TWO*( SQR(L[1]) + SQR(L[2]) + SQR(L[3]) ) / L[0] )*Gamma_m1;
+      PR = ( R[4] - _TWO*( SQR(R[1]) + SQR(R[2]) + SQR(R[3]) ) / R[0] )*Gamma_m1;
+      PL = ( PL == PL ) ? FMAX_SIMD( PL, MinPres ) : PL;
+      PR = ( PR == PR ) ? FMAX_SIMD( PR, MinPres ) : PR;
+
+      const real_fc HL              = _RhoL*( L[4] + PL );
+      const real_fc HR              = _RhoR*( R[4] + PR );
+      const real_fc RhoL_sqrt       = SQRT( L[0] );
+      const real_fc RhoR_sqrt       = SQRT( R[0] );
+      const real_fc Rho             = RhoL_sqrt*RhoR_sqrt;
+      const real_fc _Rho            = ONE/Rho;
+      const real_fc _RhoL_sqrt      = ONE/RhoL_sqrt;
+      const real_fc _RhoR_sqrt      = ONE/RhoR_sqrt;
+      const real_fc _RhoLR_sqrt_sum = ONE/(RhoL_sqrt + RhoR_sqrt);
+      const real_fc u               = _RhoLR_sqrt_sum*( _RhoL_sqrt*L[1] + _RhoR_sqrt*R[1] );
+      const real_fc v               = _RhoLR_sqrt_sum*( _RhoL_sqrt*L[2] + _RhoR_sqrt*R[2] );
+      const real_fc w               = _RhoLR_sqrt_sum*( _RhoL_sqrt*L[3] + _RhoR_sqrt*R[3] );
+      const real_fc V2              = u*u + v*v + w*w;
+      const real_fc H               = _RhoLR_sqrt_sum*(  RhoL_sqrt*HL   +  RhoR_sqrt*HR   );
+      real_fc GammaP_Rho;
+
+      GammaP_Rho = Gamma_m1*( H - _TWO*V2 );
+      GammaP_Rho = GammaP_Rho*Rho/Gamma;
+      GammaP_Rho = Gamma*_Rho*(  ( GammaP_Rho == GammaP_Rho ) ? FMAX_SIMD( GammaP_Rho, MinPres ) : GammaP_Rho  );
+
+      const real_fc a2 = GammaP_Rho;
+      const real_fc a  = SQRT( a2 );
+
+
+//    3. evaluate the eigenvalues
+      const real_fc EigenVal[NWAVE] = { u-a, u, u, u, u+a };
+
+
+//    4. evaluate the left and right fluxes
+      real_fc Flux_L[NWAVE], Flux_R[NWAVE];
+      const real_fc Vx_L = _RhoL*L[1];
+      const real_fc Vx_R = _RhoR*R[1];
+
+      Flux_L[0] = L[1];
+      Flux_L[1] = Vx_L*L[1] + PL;
+      Flux_L[2] = Vx_L*L[2];
+      Flux_L[3] = Vx_L*L[3];
+      Flux_L[4] = Vx_L*( L[4] + PL );
+
+      Flux_R[0] = R[1];
+      Flux_R[1] = Vx_R*R[1] + PR;
+      Flux_R[2] = Vx_R*R[2];
+      Flux_R[3] = Vx_R*R[3];
+      Flux_R[4] = Vx_R*( R[4] + PR );
+
+
+//    5. supersonic flows --> upwind fluxes
+      const bool Super_L = ( EigenVal[0]       >= ZERO );
+      const bool Super_R = ( EigenVal[NWAVE-1] <= ZERO ) & !Super_L;
+
+
+//    6. evaluate the eigenvectors
+      const real_fc REigenVec[NWAVE][NWAVE] =
+         {  {   ONE,     ONE, ZERO, ZERO,   ONE },
+            {   u-a,       u, ZERO, ZERO,   u+a },
+            {     v,       v,  ONE, ZERO,     v },
+            {     w,       w, ZERO,  ONE,     w },
+            { H-u*a, _TWO*V2,    v,    w, H+u*a }  };
+
+
+//    7. evaluate the amplitudes along different characteristics (eigenvectors)
+      real_fc Jump[NWAVE], Amp[NWAVE];
+
+      for (int t=0; t<NWAVE; t++)   Jump[t] = R[t] - L[t];
+
+      Amp[2] = Jump[2] - v*Jump[0];
+      Amp[3] = Jump[3] - w*Jump[0];
+      Amp[1] = Gamma_m1/a2*( Jump[0]*(H-SQR(u)) + u*Jump[1] - Jump[4] + v*Amp[2] + w*Amp[3] );
+      Amp[0] = _TWO/a*( Jump[0]*(u+a) - Jump[1] - a*Amp[1] );
+      Amp[4] = Jump[0] - Amp[0] - Amp[1];
+
+
+//    8. verify that the density and pressure in the intermediate states are positive
+#     ifdef CHECK_INTERMEDIATE
+      real_fc I_States[NWAVE];
+      bool Failed = false;
+
+      for (int t=0; t<NWAVE; t++)   I_States[t] = L[t];
+
+      for (int t=0; t<NWAVE-1; t++)
+      {
+         for (int s=0; s<NWAVE; s++)   I_States[s] += Amp[t]*REigenVec[s][t];
+
+         const real_fc I_Pres = ( I_States[4] - _TWO*( SQR(I_States[1]) + SQR(I_States[2]) + SQR(I_States[3]) ) / I_States[0] )*Gamma_m1;
+
+         Failed |= (  ( EigenVal[t+1] > EigenVal[t] ) & ( ( I_States[0] <= ZERO ) | ( I_Pres <= ZERO ) )  );
+      }
+
+      Fallback[n] = Failed & !Super_L & !Super_R;
+#     endif
+
+
+//    9. evaluate the Roe fluxes
+      for (int t=0; t<NWAVE; t++)   Amp[t] *= FABS( EigenVal[t] );
+
+      real_fc Flux_Roe[NWAVE];
+
+      for (int s=0; s<NWAVE; s++)
+      {
+         Flux_Roe[s] = Flux_L[s] + Flux_R[s];
+
+         for (int t=0; t<NWAVE; t++)   Flux_Roe[s] -= Amp[t]*REigenVec[s][t];
+
+         Flux_Roe[s] *= _TWO;
+      }
+
+      for (int s=0; s<NWAVE; s++)
+         Flux_Out[ idx_rot[s] ][n] = ( Super_L ) ? Flux_L[s] : ( Super_R ) ? Flux_R[s] : Flux_Roe[s];
+
+
+//    10. record the upwind direction and velocity for the passive scalars
+#     if ( NCOMP_PASSIVE > 0 )
+//    --> always upwind for the supersonic flows, where FluxDens*_RhoL/R reduces to Vx_L/R
+      const real_fc FluxDens = ( Super_L ) ? Flux_L[0] : ( Super_R ) ? Flux_R[0] : Flux_Roe[0];
+      const bool Upwind_L = (  ( Super_L ) ? ONE : ( Super_R ) ? -ONE : FluxDens  ) >= ZERO;
+
+      Pas_Upwind_L[n] = Upwind_L;
+      Pas_Vx      [n] = FluxDens*( ( Upwind_L ) ? _RhoL : _RhoR );
+#     endif
+   } // for (int n=0; n<NBatch; n++)
+
+
+// 11. evaluate the fluxes of passive scalars
+//    --> done in a separate loop so that the loop over interfaces can be vectorized for any NCOMP_PASSIVE
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int n=0; n<NBatch; n++)
+      {
+         const real_fc Pas_L = L_In[v][n];
+         const real_fc Pas_R = R_In[v][n];
+
+         Flux_Out[v][n] = ( ( Pas_Upwind_L[n] ) ? Pas_L : Pas_R )*Pas_Vx[n];
+      }
+   }
+#  endif
+
+
+// 12. re-solve the interfaces failing the intermediate-state check by the scalar solver
+#  ifdef CHECK_INTERMEDIATE
+   for (int n=0; n<NBatch; n++)
+   {
+      if ( !Fallback[n] )  continue;
+
+      real    L_1Face[NCOMP_TOTAL_PLUS_MAG], R_1Face[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
+
+      for (int s=0; s<NCOMP_TOTAL_PLUS_MAG; s++)
+      {
+         L_1Face[s] = L_In[s][n];
+         R_1Face[s] = R_In[s][n];
+      }
+
+      Hydro_RiemannSolver_Roe( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                               EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray );
+
+      for (int s=0; s<NCOMP_TOTAL_PLUS_MAG; s++)   Flux_Out[s][n] = Flux_1Face[s];
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_Roe_Batch
+#endif // #ifdef RSOLVER_BATCH
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
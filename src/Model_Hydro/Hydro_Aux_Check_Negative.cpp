@@ -62,7 +62,7 @@ void Hydro_Aux_Check_Negative( const int lv, const int Mode, const char *comment
             for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
 
 #           if ( DUAL_ENERGY == DE_ENPY )
-            Pres = Hydro_DensEntropy2Pres( Fluid[DENS], Fluid[ENPY], EoS_AuxArray[1], CheckMinPres_No, NULL_REAL );
+            Pres = Hydro_DensEntropy2Pres( Fluid[DENS], Fluid[ENPY], EOS_AUX_GAMMA_M1(EoS_AuxArray), CheckMinPres_No, NULL_REAL );
 #           else
 #           ifdef MHD
             const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
@@ -101,17 +101,12 @@ void BC_Outflow_xm( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int i_ref = GhostSize;  // reference i index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  i_ref = GhostSize;  // reference i index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k][j][i_ref];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_xm
 
@@ -131,17 +126,12 @@ void BC_Outflow_xp( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int i_ref = ArraySizeX - GhostSize - 1;    // reference i index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  i_ref = ArraySizeX - GhostSize - 1;    // reference i index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k][j][i_ref];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_xp
 
@@ -161,17 +151,12 @@ void BC_Outflow_ym( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int j_ref = GhostSize;  // reference j index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  j_ref = GhostSize;  // reference j index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k][j_ref][i];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_ym
 
@@ -191,17 +176,12 @@ void BC_Outflow_yp( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int j_ref = ArraySizeY - GhostSize - 1;    // reference j index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  j_ref = ArraySizeY - GhostSize - 1;    // reference j index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k][j_ref][i];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_yp
 
@@ -221,17 +201,12 @@ void BC_Outflow_zm( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int k_ref = GhostSize;  // reference k index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  k_ref = GhostSize;  // reference k index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k_ref][j][i];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_zm
 
@@ -251,16 +226,11 @@ void BC_Outflow_zp( real *Array, const int NVar, const int GhostSize, const int
                     const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int k_ref = ArraySizeZ - GhostSize - 1;    // reference k index
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  k_ref = ArraySizeZ - GhostSize - 1;    // reference k index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 // set the boundary values
    for (int v=0; v<NVar; v++)
-   for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-   for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-   for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-      Array3D[v][k][j][i] = Array3D[v][k_ref][j][i];
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, false, (real)+1.0 );
 
 } // FUNCTION : BC_Outflow_zp
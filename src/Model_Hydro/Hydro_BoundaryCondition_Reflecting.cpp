@@ -133,67 +133,26 @@ void BC_Reflecting_xm( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int i_ref = 2*GhostSize-1;    // reference i index
-   int TFluVarIdx, ii;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  i_ref = 2*GhostSize-1;    // reference i index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMX )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = -Array3D[v][k][j][ii];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
+      const real Sign = ( TFluVarIdxList[v] == MOMX ) ? -1.0 : +1.0;
 
-            Array3D[v][k][j][i] = Array3D[v][k][j][ii];
-
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELX )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = -Array3D[v][k][j][ii];
-
-         }}}
-      }
+      const real Sign = ( TDerVarList[v2] == _VELX ) ? -1.0 : +1.0;
 
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = Array3D[v][k][j][ii];
-
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_xm
 
@@ -215,67 +174,26 @@ void BC_Reflecting_xp( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int i_ref = 2*( ArraySizeX - GhostSize ) - 1;    // reference i index
-   int TFluVarIdx, ii;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  i_ref = 2*( ArraySizeX - GhostSize ) - 1;    // reference i index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMX )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = -Array3D[v][k][j][ii];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = Array3D[v][k][j][ii];
+      const real Sign = ( TFluVarIdxList[v] == MOMX ) ? -1.0 : +1.0;
 
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELX )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = -Array3D[v][k][j][ii];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {  ii = i_ref - i;
-
-            Array3D[v][k][j][i] = Array3D[v][k][j][ii];
+      const real Sign = ( TDerVarList[v2] == _VELX ) ? -1.0 : +1.0;
 
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 0, i_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_xp
 
@@ -297,67 +215,26 @@ void BC_Reflecting_ym( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int j_ref = 2*GhostSize-1;    // reference j index
-   int TFluVarIdx, jj;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  j_ref = 2*GhostSize-1;    // reference j index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMY )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][k][jj][i];
+      const real Sign = ( TFluVarIdxList[v] == MOMY ) ? -1.0 : +1.0;
 
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][k][jj][i];
-
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELY )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][k][jj][i];
+      const real Sign = ( TDerVarList[v2] == _VELY ) ? -1.0 : +1.0;
 
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][k][jj][i];
-
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_ym
 
@@ -379,67 +256,26 @@ void BC_Reflecting_yp( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int j_ref = 2*( ArraySizeY - GhostSize ) - 1;  // reference j index
-   int TFluVarIdx, jj;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  j_ref = 2*( ArraySizeY - GhostSize ) - 1;  // reference j index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMY )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][k][jj][i];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
+      const real Sign = ( TFluVarIdxList[v] == MOMY ) ? -1.0 : +1.0;
 
-            Array3D[v][k][j][i] = Array3D[v][k][jj][i];
-
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELY )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][k][jj][i];
-
-         }}}
-      }
+      const real Sign = ( TDerVarList[v2] == _VELY ) ? -1.0 : +1.0;
 
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {  jj = j_ref - j;
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][k][jj][i];
-
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 1, j_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_yp
 
@@ -461,67 +297,26 @@ void BC_Reflecting_zm( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int k_ref = 2*GhostSize-1;    // reference k index
-   int TFluVarIdx, kk;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  k_ref = 2*GhostSize-1;    // reference k index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMZ )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][kk][j][i];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][kk][j][i];
+      const real Sign = ( TFluVarIdxList[v] == MOMZ ) ? -1.0 : +1.0;
 
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELZ )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][kk][j][i];
-
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][kk][j][i];
+      const real Sign = ( TDerVarList[v2] == _VELZ ) ? -1.0 : +1.0;
 
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_zm
 
@@ -543,67 +338,26 @@ void BC_Reflecting_zp( real *Array, const int NVar_Flu, const int TFluVarIdxList
                        const int ArraySizeZ, const int Idx_Start[], const int Idx_End[] )
 {
 
-   const int k_ref = 2*( ArraySizeZ - GhostSize ) - 1;  // reference k index
-   int TFluVarIdx, kk;
-
-// 1D array -> 3D array
-   real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
+   const int  k_ref = 2*( ArraySizeZ - GhostSize ) - 1;  // reference k index
+   const long NCell = (long)ArraySizeX*ArraySizeY*ArraySizeZ;
 
 
 // set the boundary values
    for (int v=0; v<NVar_Flu; v++)
    {
-      TFluVarIdx = TFluVarIdxList[v];
-
-      if ( TFluVarIdx == MOMZ )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][kk][j][i];
+      const real Sign = ( TFluVarIdxList[v] == MOMZ ) ? -1.0 : +1.0;
 
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][kk][j][i];
-
-         }}}
-      }
-   } // for (int v=0; v<NVar_Flu; v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, true, Sign );
+   }
 
 
 // derived variables
    for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
    {
-      if ( TDerVarList[v2] == _VELZ )
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = -Array3D[v][kk][j][i];
+      const real Sign = ( TDerVarList[v2] == _VELZ ) ? -1.0 : +1.0;
 
-         }}}
-      }
-
-      else
-      {
-         for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)    {  kk = k_ref - k;
-         for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)    {
-         for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)    {
-
-            Array3D[v][k][j][i] = Array3D[v][kk][j][i];
-
-         }}}
-      }
-   } // for (int v2=0, v=NVar_Flu; v2<NVar_Der; v2++, v++)
+      Flu_BoundaryCondition_FillSlab( Array+v*NCell, ArraySizeX, ArraySizeY, Idx_Start, Idx_End, 2, k_ref, true, Sign );
+   }
 
 } // FUNCTION : BC_Reflecting_zp
 
@@ -10,8 +10,21 @@ static void Init_Function_User_Template( real fluid[], const double x, const dou
 void (*Init_Function_User_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                                 const int lv, double AuxArray[] ) = NULL;
 
+// declare as static so that other functions cannot invoke it directly and must use the function pointer
+static void Init_Function_Batch_User_Template( real fluid[], const int NCell, const double x[], const double y[],
+                                               const double z[], const double Time, const int lv, double AuxArray[] );
+
+// this optional function pointer may be set by a test problem initializer to replace Init_Function_User_Ptr
+void (*Init_Function_Batch_User_Ptr)( real fluid[], const int NCell, const double x[], const double y[],
+                                      const double z[], const double Time, const int lv, double AuxArray[] ) = NULL;
+
 extern bool (*Flu_ResetByUser_Func_Ptr)( real fluid[], const double x, const double y, const double z, const double Time,
                                          const int lv, double AuxArray[] );
+extern bool (*Flu_ResetByUser_Batch_Ptr)( real fluid[], bool Reset[], const int NCell, const double x[], const double y[],
+                                          const double z[], const double Time, const int lv, double AuxArray[] );
+
+static void SetFluidIC( real Fluid[], const int NCell, const double x[], const double y[], const double z[],
+                        const int lv );
 
 #ifdef MHD
 // declare as static so that other functions cannot invoke it directly and must use the function pointer
@@ -102,6 +115,58 @@ void Init_Function_User_Template( real fluid[], const double x, const double y,
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_Function_Batch_User_Template
+// Description :  Function template to initialize the fluid field of multiple cells at once
+//
+// Note        :  1. Invoked by Hydro_Init_ByFunction_AssignData() using the function pointer
+//                   "Init_Function_Batch_User_Ptr", which may be set by a test problem initializer
+//                   --> Optional. Init_Function_User_Ptr will be invoked for each cell if it is NULL.
+//                2. Must set the same fluid field as Init_Function_User_Ptr but works on arrays so that it can be
+//                   vectorized by the compiler
+//                   --> The output array is stored as fluid[NCOMP_TOTAL][NCell]
+//                3. Same thread-safety and energy requirements as Init_Function_User_Template()
+//
+// Parameter   :  fluid    : Fluid field to be initialized
+//                NCell    : Number of target cells
+//                x/y/z    : Target physical coordinates of each cell
+//                Time     : Target physical time
+//                lv       : Target refinement level
+//                AuxArray : Auxiliary array
+//
+// Return      :  fluid
+//-------------------------------------------------------------------------------------------------------
+void Init_Function_Batch_User_Template( real fluid[], const int NCell, const double x[], const double y[],
+                                        const double z[], const double Time, const int lv, double AuxArray[] )
+{
+
+   real *Dens = fluid + DENS*NCell;
+   real *MomX = fluid + MOMX*NCell;
+   real *MomY = fluid + MOMY*NCell;
+   real *MomZ = fluid + MOMZ*NCell;
+   real *Engy = fluid + ENGY*NCell;
+
+// only the operations free of function calls can be vectorized
+   for (int t=0; t<NCell; t++)
+   {
+      Dens[t] = 1.0 + 0.2*exp( -SQR(x[t]-0.5*amr->BoxSize[0]) );
+      MomX[t] = 0.0;
+      MomY[t] = 0.0;
+      MomZ[t] = 0.0;
+   }
+
+   for (int t=0; t<NCell; t++)
+   {
+      const real Pres = 1.0;
+      const real Eint = EoS_DensPres2Eint_CPUPtr( Dens[t], Pres, NULL, EoS_AuxArray );
+
+      Engy[t] = Hydro_ConEint2Etot( Dens[t], MomX[t], MomY[t], MomZ[t], Eint, (real)0.0 );
+   }
+
+} // FUNCTION : Init_Function_Batch_User_Template
+
+
+
 #ifdef MHD
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_Function_BField_User_Template
@@ -146,6 +211,14 @@ void Init_Function_BField_User_Template( real magnetic[], const double x, const
 //                       do not support OpenMP
 //                       (e.g., they may not be thread-safe or may involve a random number generator for which
 //                       all threads would share the same random seed when adopting OpenMP)
+//                4. Fluid field is set by Init_Function_Batch_User_Ptr for all cells in a patch at once if it is set
+//                   --> See SetFluidIC()
+//                5. INIT_SUBSAMPLING_TOL > 0.0 enables adaptive sub-sampling for INIT_SUBSAMPLING_NCELL > 1
+//                   --> Evaluate the fluid field at the cell centers first, including one layer of cells outside
+//                       the patch
+//                   --> Only sub-sample cells whose density or total energy differs from any of the six neighbors
+//                       by more than a relative tolerance INIT_SUBSAMPLING_TOL, and adopt the cell-center values
+//                       for the other cells
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -160,8 +233,8 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
       Aux_Error( ERROR_INFO, "Init_Function_BField_User_Ptr == NULL !!\n" );
 #  endif
 
-   if ( OPT__RESET_FLUID  &&  Flu_ResetByUser_Func_Ptr == NULL )
-      Aux_Error( ERROR_INFO, "Flu_ResetByUser_Func_Ptr == NULL for OPT__RESET_FLUID !!\n" );
+   if ( OPT__RESET_FLUID  &&  Flu_ResetByUser_Func_Ptr == NULL  &&  Flu_ResetByUser_Batch_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "Flu_ResetByUser_Func_Ptr and Flu_ResetByUser_Batch_Ptr are both NULL for OPT__RESET_FLUID !!\n" );
 
 
 // set the number of OpenMP threads
@@ -176,6 +249,9 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
 #  ifdef MHD
    const double _NSub2   = 1.0/SQR(NSub);
 #  endif
+   const bool   Adaptive = ( NSub > 1  &&  INIT_SUBSAMPLING_TOL > 0.0 );
+   const int    NGhost   = ( Adaptive ) ? 1 : 0;
+   const int    NCellG   = CUBE( PS1+2*NGhost );
 
 
 #  ifdef MHD
@@ -185,7 +261,18 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
 
 #  endif
 
-#  pragma omp parallel for schedule( runtime ) num_threads( OMP_NThread )
+#  pragma omp parallel num_threads( OMP_NThread )
+   {
+
+// per-thread arrays for SetFluidIC()
+   real   (*Fluid)[ CUBE(PS1) ] = new real   [NCOMP_TOTAL][ CUBE(PS1) ];
+   real    *Fluid_Sub           = new real   [ NCOMP_TOTAL*NCellG ];
+   double  *x_Sub               = new double [NCellG];
+   double  *y_Sub               = new double [NCellG];
+   double  *z_Sub               = new double [NCellG];
+   int     *SubList             = new int    [ CUBE(PS1) ];
+
+#  pragma omp for schedule( runtime )
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
 //    1. set the magnetic field
@@ -235,29 +322,111 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
 
 
 //    2. set the fluid field
-      real fluid[NCOMP_TOTAL], fluid_sub[NCOMP_TOTAL];
+      const double *EdgeL = amr->patch[0][lv][PID]->EdgeL;
+      int NCell_Sub;
+
+//    2-1. evaluate the cell-center values (including one layer of cells outside the patch) for the adaptive sub-sampling
+//         and record the cells to be sub-sampled
+      if ( Adaptive )
+      {
+         const int  NG  = PS1 + 2*NGhost;
+         const real Tol = (real)INIT_SUBSAMPLING_TOL;
+         const int  dIdx[3] = { 1, NG, SQR(NG) };
+
+         int t = 0;
+         for (int k=-NGhost; k<PS1+NGhost; k++)
+         for (int j=-NGhost; j<PS1+NGhost; j++)
+         for (int i=-NGhost; i<PS1+NGhost; i++)
+         {
+            x_Sub[t] = EdgeL[0] + (i+0.5)*dh;
+            y_Sub[t] = EdgeL[1] + (j+0.5)*dh;
+            z_Sub[t] = EdgeL[2] + (k+0.5)*dh;
+            t ++;
+         }
+
+         SetFluidIC( Fluid_Sub, NCellG, x_Sub, y_Sub, z_Sub, lv );
+
+         NCell_Sub = 0;
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+         {
+            const int tg = IDX321( i+NGhost, j+NGhost, k+NGhost, NG, NG );
+            const int t  = IDX321( i, j, k, PS1, PS1 );
+
+            bool Steep = false;
+
+            for (int d=0; d<3  &&  !Steep; d++)
+            for (int s=-1; s<=1  &&  !Steep; s+=2)
+            {
+               const int tn = tg + s*dIdx[d];
+
+               for (int v=0; v<2; v++)
+               {
+                  const int  Var = ( v == 0 ) ? DENS : ENGY;
+                  const real fc  = Fluid_Sub[ Var*NCellG + tg ];
+                  const real fn  = Fluid_Sub[ Var*NCellG + tn ];
+
+                  if (  FABS( fc - fn ) > Tol*FMAX( FABS(fc), FABS(fn) )  )   Steep = true;
+               }
+            }
+
+            if ( Steep )   SubList[ NCell_Sub ++ ] = t;
+            else
+               for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][t] = Fluid_Sub[ v*NCellG + tg ];
+         }
+      } // if ( Adaptive )
 
-      for (int k=0; k<PS1; k++)  {  const double z0 = amr->patch[0][lv][PID]->EdgeL[2] + k*dh + 0.5*dh_sub;
-      for (int j=0; j<PS1; j++)  {  const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + j*dh + 0.5*dh_sub;
-      for (int i=0; i<PS1; i++)  {  const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + i*dh + 0.5*dh_sub;
+      else
+      {
+         NCell_Sub = CUBE( PS1 );
 
-         for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = (real)0.0;
+         for (int t=0; t<NCell_Sub; t++)  SubList[t] = t;
+      }
+
+
+//    2-2. sub-sample the target cells
+      if ( NCell_Sub > 0 )
+      {
+         for (int s=0; s<NCell_Sub; s++)
+         for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][ SubList[s] ] = (real)0.0;
+
+         for (int kk=0; kk<NSub; kk++)
+         for (int jj=0; jj<NSub; jj++)
+         for (int ii=0; ii<NSub; ii++)
+         {
+            for (int s=0; s<NCell_Sub; s++)
+            {
+               const int t = SubList[s];
+               const int i = t % PS1;
+               const int j = t % SQR(PS1) / PS1;
+               const int k = t / SQR(PS1);
+
+               x_Sub[s] = ( EdgeL[0] + i*dh + 0.5*dh_sub ) + ii*dh_sub;
+               y_Sub[s] = ( EdgeL[1] + j*dh + 0.5*dh_sub ) + jj*dh_sub;
+               z_Sub[s] = ( EdgeL[2] + k*dh + 0.5*dh_sub ) + kk*dh_sub;
+            }
 
-         for (int kk=0; kk<NSub; kk++)    {  const double z = z0 + kk*dh_sub;
-         for (int jj=0; jj<NSub; jj++)    {  const double y = y0 + jj*dh_sub;
-         for (int ii=0; ii<NSub; ii++)    {  const double x = x0 + ii*dh_sub;
+            SetFluidIC( Fluid_Sub, NCell_Sub, x_Sub, y_Sub, z_Sub, lv );
 
-            Init_Function_User_Ptr( fluid_sub, x, y, z, Time[lv], lv, NULL );
+            for (int s=0; s<NCell_Sub; s++)
+            for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][ SubList[s] ] += Fluid_Sub[ v*NCell_Sub + s ];
+         }
 
-//          modify the initial condition if required
-            if ( OPT__RESET_FLUID )
-               Flu_ResetByUser_Func_Ptr( fluid_sub, x, y, z, Time[lv], lv, NULL );
+         for (int s=0; s<NCell_Sub; s++)
+         for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[v][ SubList[s] ] *= _NSub3;
+      } // if ( NCell_Sub > 0 )
 
-            for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] += fluid_sub[v];
 
-         }}}
+//    2-3. apply various corrections to each cell
+      real fluid[NCOMP_TOTAL];
 
-         for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] *= _NSub3;
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+      {
+         for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = Fluid[v][ IDX321(i,j,k,PS1,PS1) ];
 
 
 //       add the magnetic energy
@@ -292,11 +461,82 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
 
          for (int v=0; v<NCOMP_TOTAL; v++)   amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i] = fluid[v];
 
-      }}} // i,j,k
+      } // i,j,k
    } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
 
+   delete [] Fluid;
+   delete [] Fluid_Sub;
+   delete [] x_Sub;
+   delete [] y_Sub;
+   delete [] z_Sub;
+   delete [] SubList;
+
+   } // end of OpenMP parallel region
+
 } // FUNCTION : Hydro_Init_ByFunction_AssignData
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetFluidIC
+// Description :  Evaluate the initial fluid field at the given coordinates
+//
+// Note        :  1. Invoked by Hydro_Init_ByFunction_AssignData()
+//                2. Invoke Init_Function_Batch_User_Ptr for all cells at once if it is set. Otherwise, invoke
+//                   Init_Function_User_Ptr for each cell.
+//                3. Also apply Flu_ResetByUser_Batch_Ptr to all cells at once or Flu_ResetByUser_Func_Ptr to each
+//                   cell for OPT__RESET_FLUID
+//
+// Parameter   :  Fluid : Array to store the output fluid field with the layout [NCOMP_TOTAL][NCell]
+//                NCell : Number of target cells
+//                x/y/z : Target physical coordinates of each cell
+//                lv    : Target refinement level
+//
+// Return      :  Fluid
+//-------------------------------------------------------------------------------------------------------
+void SetFluidIC( real Fluid[], const int NCell, const double x[], const double y[], const double z[],
+                 const int lv )
+{
+
+   real fluid_1cell[NCOMP_TOTAL];
+
+   if ( Init_Function_Batch_User_Ptr != NULL )
+      Init_Function_Batch_User_Ptr( Fluid, NCell, x, y, z, Time[lv], lv, NULL );
+
+   else
+   {
+      for (int t=0; t<NCell; t++)
+      {
+         Init_Function_User_Ptr( fluid_1cell, x[t], y[t], z[t], Time[lv], lv, NULL );
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[ v*NCell + t ] = fluid_1cell[v];
+      }
+   }
+
+// modify the initial condition if required
+   if ( OPT__RESET_FLUID  &&  Flu_ResetByUser_Batch_Ptr != NULL )
+   {
+      bool *Reset = new bool [NCell];
+
+      Flu_ResetByUser_Batch_Ptr( Fluid, Reset, NCell, x, y, z, Time[lv], lv, NULL );
+
+      delete [] Reset;
+   }
+
+   else if ( OPT__RESET_FLUID )
+   {
+      for (int t=0; t<NCell; t++)
+      {
+         for (int v=0; v<NCOMP_TOTAL; v++)   fluid_1cell[v] = Fluid[ v*NCell + t ];
+
+         Flu_ResetByUser_Func_Ptr( fluid_1cell, x[t], y[t], z[t], Time[lv], lv, NULL );
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   Fluid[ v*NCell + t ] = fluid_1cell[v];
+      }
+   }
+
+} // FUNCTION : SetFluidIC
+
+
+
 #endif // #if ( MODEL == HYDRO )
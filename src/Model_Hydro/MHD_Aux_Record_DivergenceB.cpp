@@ -0,0 +1,94 @@
+#include "GAMER.h"
+
+#ifdef MHD
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MHD_Aux_Record_DivergenceB
+// Description :  Record the divergence of the B field updated by the fluid solver on each level
+//
+// Note        :  1. div(B) is accumulated in MHD_DivB_Max/Sqr/NCell[] by Flu_Close()->RecordDivB() as a by-product
+//                   of the fluid solver and is thus cheap enough to be always on
+//                   --> Adopt the same normalization as MHD_Aux_Check_DivergenceB()
+//                   --> But B field modified after the fluid solver (e.g., restriction and electric field fix-up)
+//                       is not covered, for which one still needs OPT__CK_DIVERGENCE_B
+//                2. Results are recorded in the file "Record__DivB_ByProduct"
+//                   --> L2 and maximum errors of all fluid updates on each level since the last record
+//-------------------------------------------------------------------------------------------------------
+void MHD_Aux_Record_DivergenceB()
+{
+
+   const char FileName[] = "Record__DivB_ByProduct";
+   static bool FirstTime = true;
+
+   double Max_AllRank[NLEVEL], Sqr_AllRank[NLEVEL];
+   long   NCell_AllRank[NLEVEL];
+   FILE  *File = NULL;
+
+
+// collect data from all ranks
+   MPI_Reduce( MHD_DivB_Max,   Max_AllRank,   NLEVEL, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( MHD_DivB_Sqr,   Sqr_AllRank,   NLEVEL, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( MHD_DivB_NCell, NCell_AllRank, NLEVEL, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// only rank 0 needs to take a note
+   if ( MPI_Rank == 0 )
+   {
+//    header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         File = fopen( FileName, "a" );
+
+         fprintf( File, "#%13s %9s %13s", "Time", "Step", "MaxAllLv" );
+         for (int lv=0; lv<NLEVEL; lv++)  fprintf( File, "  %11s%2d %11s%2d", "L2_Lv", lv, "Max_Lv", lv );
+
+         fprintf( File, "\n" );
+
+         fclose( File );
+      }
+
+
+//    L2 and maximum errors on each level
+      double MaxAllLv=0.0, L2;
+
+      for (int lv=0; lv<NLEVEL; lv++)  MaxAllLv = MAX( MaxAllLv, Max_AllRank[lv] );
+
+      File = fopen( FileName, "a" );
+
+      fprintf( File, "%14.7e %9ld %13.7e", Time[0], Step, MaxAllLv );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         L2 = ( NCell_AllRank[lv] == 0 ) ? 0.0 : sqrt( Sqr_AllRank[lv]/NCell_AllRank[lv] );
+
+         fprintf( File, "  %13.7e %13.7e", L2, Max_AllRank[lv] );
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+
+   } // if ( MPI_Rank == 0 )
+
+
+// reset the accumulators
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      MHD_DivB_Max  [lv] = 0.0;
+      MHD_DivB_Sqr  [lv] = 0.0;
+      MHD_DivB_NCell[lv] = 0;
+   }
+
+} // FUNCTION : MHD_Aux_Record_DivergenceB
+
+
+
+#endif // #ifdef MHD
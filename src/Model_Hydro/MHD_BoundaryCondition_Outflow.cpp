@@ -125,36 +125,30 @@ void BC_Outflow_xm( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagX[k][j][i] = MagX[k][j][i_ref];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 0, i_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k][j][i_ref];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 0, i_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j][i_ref];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 0, i_ref, false, (real)+1.0 );
 
             break;
          }
@@ -191,36 +185,30 @@ void BC_Outflow_xp( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0]+1, Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1,   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2];   k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1];   j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]+1; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k][j][i_ref_n];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 0, i_ref_n, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k][j][i_ref_t];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 0, i_ref_t, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j][i_ref_t];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 0, i_ref_t, false, (real)+1.0 );
 
             break;
          }
@@ -256,36 +244,30 @@ void BC_Outflow_ym( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k][j_ref][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 1, j_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagY[k][j][i] = MagY[k][j_ref][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 1, j_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j_ref][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 1, j_ref, false, (real)+1.0 );
 
             break;
          }
@@ -322,36 +304,30 @@ void BC_Outflow_yp( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k][j_ref_t][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 1, j_ref_t, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1]+1, Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1,   Idx_End[2]   };
 
-            for (int k=Idx_Start[2];   k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]+1; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0];   i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k][j_ref_n][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 1, j_ref_n, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j_ref_t][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 1, j_ref_t, false, (real)+1.0 );
 
             break;
          }
@@ -387,36 +363,30 @@ void BC_Outflow_zm( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k_ref][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 2, k_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k_ref][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 2, k_ref, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagZ[k][j][i] = MagZ[k_ref][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 2, k_ref, false, (real)+1.0 );
 
             break;
          }
@@ -453,36 +423,30 @@ void BC_Outflow_zp( real **Array, const int NVar, const int TVarIdxList[], const
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k_ref_t][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 2, k_ref_t, false, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k_ref_t][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 2, k_ref_t, false, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2]+1 };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1   };
 
-            for (int k=Idx_Start[2]+1; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1];   j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0];   i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k_ref_n][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 2, k_ref_n, false, (real)+1.0 );
 
             break;
          }
@@ -126,36 +126,30 @@ void BC_Reflecting_xm( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagX[k][j][i] = -MagX[k][j][i_ref_n-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 0, i_ref_n, true, (real)-1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k][j][i_ref_t-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 0, i_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j][i_ref_t-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 0, i_ref_t, true, (real)+1.0 );
 
             break;
          }
@@ -192,36 +186,30 @@ void BC_Reflecting_xp( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0]+1, Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1,   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2];   k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1];   j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]+1; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = -MagX[k][j][i_ref_n-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 0, i_ref_n, true, (real)-1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k][j][i_ref_t-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 0, i_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j][i_ref_t-i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 0, i_ref_t, true, (real)+1.0 );
 
             break;
          }
@@ -258,36 +246,30 @@ void BC_Reflecting_ym( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k][j_ref_t-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 1, j_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagY[k][j][i] = -MagY[k][j_ref_n-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 1, j_ref_n, true, (real)-1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j_ref_t-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 1, j_ref_t, true, (real)+1.0 );
 
             break;
          }
@@ -324,36 +306,30 @@ void BC_Reflecting_yp( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k][j_ref_t-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 1, j_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1]+1, Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1,   Idx_End[2]   };
 
-            for (int k=Idx_Start[2];   k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]+1; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0];   i<=Idx_End[0];   i++)
-               MagY[k][j][i] = -MagY[k][j_ref_n-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 1, j_ref_n, true, (real)-1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1 };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = MagZ[k][j_ref_t-j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 1, j_ref_t, true, (real)+1.0 );
 
             break;
          }
@@ -390,36 +366,30 @@ void BC_Reflecting_zm( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k_ref_t-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 2, k_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k_ref_t-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 2, k_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2]; k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]; i++)
-               MagZ[k][j][i] = -MagZ[k_ref_n-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 2, k_ref_n, true, (real)-1.0 );
 
             break;
          }
@@ -456,36 +426,30 @@ void BC_Reflecting_zp( real **Array, const int NVar, const int TVarIdxList[], co
       {
          case MAGX:
          {
-            real (*MagX)[ArraySizeY][ArraySizeX+1] = ( real (*)[ArraySizeY][ArraySizeX+1] )Array[MAGX];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0]+1, Idx_End[1],   Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0]+1; i++)
-               MagX[k][j][i] = MagX[k_ref_t-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGX], ArraySizeX+1, ArraySizeY, Start, End, 2, k_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGY:
          {
-            real (*MagY)[ArraySizeY+1][ArraySizeX] = ( real (*)[ArraySizeY+1][ArraySizeX] )Array[MAGY];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2] };
+            const int End  [3] = { Idx_End[0],   Idx_End[1]+1, Idx_End[2]   };
 
-            for (int k=Idx_Start[2]; k<=Idx_End[2];   k++)
-            for (int j=Idx_Start[1]; j<=Idx_End[1]+1; j++)
-            for (int i=Idx_Start[0]; i<=Idx_End[0];   i++)
-               MagY[k][j][i] = MagY[k_ref_t-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGY], ArraySizeX, ArraySizeY+1, Start, End, 2, k_ref_t, true, (real)+1.0 );
 
             break;
          }
 
          case MAGZ:
          {
-            real (*MagZ)[ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeY][ArraySizeX] )Array[MAGZ];
+            const int Start[3] = { Idx_Start[0], Idx_Start[1], Idx_Start[2]+1 };
+            const int End  [3] = { Idx_End[0],   Idx_End[1],   Idx_End[2]+1   };
 
-            for (int k=Idx_Start[2]+1; k<=Idx_End[2]+1; k++)
-            for (int j=Idx_Start[1];   j<=Idx_End[1];   j++)
-            for (int i=Idx_Start[0];   i<=Idx_End[0];   i++)
-               MagZ[k][j][i] = -MagZ[k_ref_n-k][j][i];
+            Flu_BoundaryCondition_FillSlab( Array[MAGZ], ArraySizeX, ArraySizeY, Start, End, 2, k_ref_n, true, (real)-1.0 );
 
             break;
          }
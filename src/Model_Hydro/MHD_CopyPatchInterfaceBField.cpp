@@ -79,6 +79,11 @@ void MHD_CopyPatchInterfaceBField( const int lv, const int PID, const int SibID,
       for (int n=0; n<PS1; n++)  SibMagPtr[ n*Bdidx_n ] = MagPtr[ n*Bdidx_n ];
    }
 
+// the cached magnetic energy for OPT__EMAG_CACHE no longer applies
+// --> use atomic since different source patches may share the same sibling patch
+#  pragma omp atomic write
+   amr->patch[MagSg][lv][SibPID]->emag_valid = false;
+
 } // FUNCTION : MHD_CopyPatchInterfaceBField
 
 
@@ -66,6 +66,9 @@ void MHD_FixUp_Electric( const int lv )
 //       skip the faces not adjacent to the coarse-fine boundaries
          if ( EPtr == NULL )  continue;
 
+//       the cached magnetic energy for OPT__EMAG_CACHE no longer applies
+         amr->patch[MagSg][lv][PID]->emag_valid = false;
+
 
 //       2-1. set array indices
          const int xyz = s / 2;           // (0,0,1,1,2,2): face direction
@@ -154,6 +157,8 @@ void MHD_FixUp_Electric( const int lv )
 //       skip the edges not adjacent to the coarse-fine boundaries
          if ( EPtr == NULL )  continue;
 
+         amr->patch[MagSg][lv][PID]->emag_valid = false;
+
 
 //       3-1. set array indices
          const int e   = s - 6;           // 0 ~ 11 (edge index)
@@ -60,6 +60,8 @@ void MHD_GetCellCenteredBFieldInPatch( real B_CC[], const int lv, const int PID,
 //                of a given cell in a given patch
 //
 // Note        :  1. Invoke MHD_GetCellCenteredBEnergy() defined in CPU/CUFLU_Shared_FluUtility.cpp
+//                2. Return the value cached by MHD_SetCellCenteredBEnergyCache() directly if available
+//                   --> For OPT__EMAG_CACHE only
 //
 // Parameter   :  lv    : Target AMR level
 //                PID   : Target patch index
@@ -91,9 +93,24 @@ real MHD_GetCellCenteredBEnergyInPatch( const int lv, const int PID, const int i
 
 
 // FC = face-centered
-   const real *Bx_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGX];
-   const real *By_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGY];
-   const real *Bz_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGZ];
+   const patch_t *Patch = amr->patch[MagSg][lv][PID];
+   const real    *Bx_FC = Patch->magnetic[MAGX];
+   const real    *By_FC = Patch->magnetic[MAGY];
+   const real    *Bz_FC = Patch->magnetic[MAGZ];
+
+// use the cached magnetic energy if it is still consistent with magnetic[]
+   if ( Patch->emag_valid )
+   {
+#     ifdef GAMER_DEBUG
+      const real Emag = MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+
+      if ( Patch->emag[k][j][i] != Emag )
+         Aux_Error( ERROR_INFO, "inconsistent emag cache (lv %d, PID %d, MagSg %d, ijk %d %d %d, cache %14.7e != %14.7e) !!\n",
+                    lv, PID, MagSg, i, j, k, Patch->emag[k][j][i], Emag );
+#     endif
+
+      return Patch->emag[k][j][i];
+   }
 
    return MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
 
@@ -101,4 +118,49 @@ real MHD_GetCellCenteredBEnergyInPatch( const int lv, const int PID, const int i
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MHD_SetCellCenteredBEnergyCache
+// Description :  Compute and cache the cell-centered magnetic energy of all cells in a given patch
+//
+// Note        :  1. For OPT__EMAG_CACHE only
+//                2. Invoked by Flu_Close() right after storing the updated B field so that the subsequent
+//                   calls to MHD_GetCellCenteredBEnergyInPatch() (e.g., gravity solver, flagging, and data output)
+//                   no longer recompute it
+//                3. The cache is discarded whenever magnetic[] is modified outside the fluid solver
+//                   (i.e., patch_t::emag_valid is reset to false)
+//                4. emag[] is allocated here on demand
+//
+// Parameter   :  lv    : Target AMR level
+//                PID   : Target patch index
+//                MagSg : Sandglass of the magnetic field data
+//-------------------------------------------------------------------------------------------------------
+void MHD_SetCellCenteredBEnergyCache( const int lv, const int PID, const int MagSg )
+{
+
+   patch_t *Patch = amr->patch[MagSg][lv][PID];
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( Patch->magnetic == NULL )
+      Aux_Error( ERROR_INFO, "magnetic == NULL (lv %d, PID %d, MagSg %d) !!\n", lv, PID, MagSg );
+#  endif
+
+
+   if ( Patch->emag == NULL )    Patch->emag = new real [PS1][PS1][PS1];
+
+   const real *Bx_FC = Patch->magnetic[MAGX];
+   const real *By_FC = Patch->magnetic[MAGY];
+   const real *Bz_FC = Patch->magnetic[MAGZ];
+
+   for (int k=0; k<PS1; k++)
+   for (int j=0; j<PS1; j++)
+   for (int i=0; i<PS1; i++)
+      Patch->emag[k][j][i] = MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+
+   Patch->emag_valid = true;
+
+} // FUNCTION : MHD_SetCellCenteredBEnergyCache
+
+
+
 #endif // #if ( MODEL == HYDRO  &&  defined MHD )
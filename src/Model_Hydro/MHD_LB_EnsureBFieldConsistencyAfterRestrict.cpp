@@ -52,6 +52,8 @@ void MHD_LB_EnsureBFieldConsistencyAfterRestrict( const int lv )
    const int MagSg        = amr->MagSg[lv];
 
 // iterate over all buffer patches to be corrected
+// --> each iteration only updates the interfaces of its own destination patch
+#  pragma omp parallel for schedule( runtime )
    for (int DesBufPID=amr->NPatchComma[lv][1]; DesBufPID<amr->NPatchComma[lv][3]; DesBufPID++)
    {
 //    for the **destination** patches (i.e., patches to be corrected), skip the **non-leaf** buffer patches
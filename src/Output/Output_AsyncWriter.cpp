@@ -0,0 +1,214 @@
+#include "GAMER.h"
+
+#ifdef SUPPORT_HDF5
+
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+
+// write request staged by Output_Async_Push()
+struct AsyncReq_t
+{
+   long  Offset;     // byte offset in the target file
+   long  NElement;   // number of elements in Buf
+   real *Buf;        // staged data (freed by the I/O thread)
+};
+
+static char        Async_FileName[MAX_STRING];
+static AsyncReq_t *Async_Req     = NULL;
+static int         Async_NReq    = 0;
+static int         Async_MaxNReq = 0;
+static bool        Async_Running = false;
+static long        Async_NFail   = 0;      // number of failed I/O operations (set by the I/O thread)
+static int         Async_ErrNo   = 0;      // errno of the first failure (set by the I/O thread)
+static pthread_t   Async_Thread;
+
+static void *Async_Writer( void *Arg );
+static void  Async_Fail( const int ErrNo );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_Async_Push
+// Description :  Stage a contiguous block of data to be written to the target file by the background I/O thread
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5() when OPT__OUTPUT_ASYNC is on
+//                2. Buf must be allocated by "new real []" and is owned by the I/O thread afterwards
+//                   --> The caller must not access Buf after calling this function
+//                3. All requests staged between two calls of Output_Async_Start() must target the same file
+//                4. Data are written as raw bytes to the given offset, which must have been allocated in the
+//                   file in advance (e.g., by H5Pset_alloc_time(H5D_ALLOC_TIME_EARLY))
+//
+// Parameter   :  FileName : Target file name
+//                Offset   : Byte offset in the target file
+//                NElement : Number of elements in Buf
+//                Buf      : Data to be written
+//-------------------------------------------------------------------------------------------------------
+void Output_Async_Push( const char *FileName, const long Offset, const long NElement, real *Buf )
+{
+
+   if ( Async_Running )    Aux_Error( ERROR_INFO, "cannot stage data while the I/O thread is running !!\n" );
+
+   if ( NElement <= 0 )
+   {
+      delete [] Buf;
+      return;
+   }
+
+   if ( Async_NReq == 0 )
+      strncpy( Async_FileName, FileName, MAX_STRING-1 );
+
+   else if ( strcmp( Async_FileName, FileName ) != 0 )
+      Aux_Error( ERROR_INFO, "inconsistent target files (\"%s\" != \"%s\") !!\n", Async_FileName, FileName );
+
+   if ( Async_NReq >= Async_MaxNReq )
+   {
+      Async_MaxNReq = ( Async_MaxNReq == 0 ) ? 64 : 2*Async_MaxNReq;
+      Async_Req     = (AsyncReq_t*)realloc( Async_Req, Async_MaxNReq*sizeof(AsyncReq_t) );
+   }
+
+   Async_Req[Async_NReq].Offset   = Offset;
+   Async_Req[Async_NReq].NElement = NElement;
+   Async_Req[Async_NReq].Buf      = Buf;
+   Async_NReq ++;
+
+} // FUNCTION : Output_Async_Push
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_Async_Start
+// Description :  Launch the background I/O thread to write all data staged by Output_Async_Push()
+//
+// Note        :  1. Return immediately so that the simulation can continue while the data are being written
+//                2. The I/O thread only calls POSIX I/O routines
+//                   --> Neither MPI (initialized with MPI_THREAD_SERIALIZED) nor HDF5 (not thread-safe) is
+//                       invoked by the I/O thread
+//                3. Output_Async_Wait() must be invoked before staging the next snapshot and before terminating
+//                   the program
+//-------------------------------------------------------------------------------------------------------
+void Output_Async_Start()
+{
+
+   if ( Async_Running )    Aux_Error( ERROR_INFO, "the I/O thread is already running !!\n" );
+
+   if ( Async_NReq == 0 )  return;
+
+   Async_NFail = 0;
+   Async_ErrNo = 0;
+
+   if ( pthread_create( &Async_Thread, NULL, Async_Writer, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to create the I/O thread !!\n" );
+
+   Async_Running = true;
+
+} // FUNCTION : Output_Async_Start
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_Async_Wait
+// Description :  Wait until the background I/O thread finishes writing the staged data
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5() before staging a new snapshot (i.e., at most one
+//                   snapshot is in flight, which bounds the memory consumption of the staging buffers) and by
+//                   End_GAMER()
+//                2. Do nothing if the I/O thread is not running
+//-------------------------------------------------------------------------------------------------------
+void Output_Async_Wait()
+{
+
+   if ( !Async_Running )   return;
+
+   if ( pthread_join( Async_Thread, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to join the I/O thread !!\n" );
+
+   Async_Running = false;
+
+   if ( Async_NFail > 0 )
+      Aux_Error( ERROR_INFO, "%ld asynchronous open/write/fsync/close operation(s) on \"%s\" failed (%s) !!\n",
+                 Async_NFail, Async_FileName, strerror(Async_ErrNo) );
+
+} // FUNCTION : Output_Async_Wait
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Async_Writer
+// Description :  Work function of the background I/O thread
+//
+// Note        :  1. Write and free all staged requests and then reset the request list
+//                2. Failures of open(), pwrite(), fsync(), and close() are counted in Async_NFail and reported
+//                   by Output_Async_Wait() through Aux_Error()
+//                   --> pwrite() interrupted by a signal is retried
+//-------------------------------------------------------------------------------------------------------
+void *Async_Writer( void *Arg )
+{
+
+   const int File = open( Async_FileName, O_WRONLY );
+
+   if ( File < 0 )   Async_Fail( errno );
+
+   for (int r=0; r<Async_NReq; r++)
+   {
+      const char *Ptr  = (const char*)Async_Req[r].Buf;
+      long        Left = Async_Req[r].NElement*sizeof(real);
+      long        Pos  = Async_Req[r].Offset;
+
+      while ( File >= 0  &&  Left > 0 )
+      {
+         const ssize_t NWrite = pwrite( File, Ptr, Left, Pos );
+
+         if ( NWrite < 0  &&  errno == EINTR )  continue;
+
+         if ( NWrite <= 0 )
+         {
+            Async_Fail( ( NWrite < 0 ) ? errno : EIO );
+            break;
+         }
+
+         Ptr  += NWrite;
+         Pos  += NWrite;
+         Left -= NWrite;
+      }
+
+      delete [] Async_Req[r].Buf;
+   }
+
+   if ( File >= 0 )
+   {
+      if ( fsync( File ) != 0 )  Async_Fail( errno );
+      if ( close( File ) != 0 )  Async_Fail( errno );
+   }
+
+   Async_NReq = 0;
+
+   return NULL;
+
+} // FUNCTION : Async_Writer
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Async_Fail
+// Description :  Record a failed I/O operation of the background I/O thread
+//
+// Note        :  1. Only the errno of the first failure is kept for the error message of Output_Async_Wait()
+//
+// Parameter   :  ErrNo : errno of the failed operation
+//-------------------------------------------------------------------------------------------------------
+void Async_Fail( const int ErrNo )
+{
+
+   if ( Async_NFail == 0 )    Async_ErrNo = ErrNo;
+
+   Async_NFail ++;
+
+} // FUNCTION : Async_Fail
+
+
+
+#endif // #ifdef SUPPORT_HDF5
@@ -6,7 +6,8 @@
 //#define DIMENSIONLESS_FORM
 
 
-static void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total );
+static void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total, const bool UseCache );
+static void BinBasePowerSpectrum( const real *RhoK, const int j_start, const int dj, double *PS_local, long *Count_local );
 
 #ifdef SERIAL
 extern rfftwnd_plan     FFTW_Plan_PS;
@@ -14,6 +15,19 @@ extern rfftwnd_plan     FFTW_Plan_PS;
 extern rfftwnd_mpi_plan FFTW_Plan_PS;
 #endif
 
+extern int   FFTW_local_nz, FFTW_local_z_start, FFTW_local_ny_after_transpose, FFTW_local_y_start_after_transpose;
+extern int   FFTW_total_local_size, FFTW_NRecvSlice;
+extern int  *FFTW_List_z_start;
+extern real *FFTW_RhoK, *FFTW_RecvBuf;
+extern long *FFTW_RecvBuf_SIdx;
+extern double *FFTW_PS_Local;
+extern long   *FFTW_PS_Count;
+
+// power spectrum binned by the base-level Poisson solver on this rank (stored in FFTW_PS_Local/Count)
+// --> PS_Cache_Hash records the hash of the density from which it was computed
+static bool  PS_Cache_Valid = false;
+static ulong PS_Cache_Hash  = 0;
+
 
 
 
@@ -21,6 +35,11 @@ extern rfftwnd_mpi_plan FFTW_Plan_PS;
 // Function    :  Output_BasePowerSpectrum
 // Description :  Evaluate and output the base-level power spectrum by FFT
 //
+// Note        :  1. For the periodic BC, use the slab workspace allocated by Init_FFTW() and reuse the power
+//                   spectrum already binned by the base-level Poisson solver if the density is unchanged
+//                   --> See Output_BasePowerSpectrum_SaveCache()
+//                   --> The forward FFT and the associated transpose are skipped in that case
+//
 // Parameter   :  FileName : Name of the output file
 //-------------------------------------------------------------------------------------------------------
 void Output_BasePowerSpectrum( const char *FileName )
@@ -33,43 +52,63 @@ void Output_BasePowerSpectrum( const char *FileName )
    const int Nx_Padded   = NX0_TOT[0]/2+1;
    const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
+// FFTW_Plan_PS is identical to FFTW_Plan for the periodic BC, for which the shared slab workspace can be used
+   const bool UseWorkspace = ( OPT__BC_POT == BC_POT_PERIODIC );
+
 // get the array indices using by FFTW
    int local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
+   int NRecvSlice, *List_z_start=NULL;
 
-#  ifdef SERIAL
-   local_nz                      = FFT_Size[2];
-   local_z_start                 = 0;
-   local_ny_after_transpose      = NULL_INT;
-   local_y_start_after_transpose = NULL_INT;
-   total_local_size              = 2*Nx_Padded*FFT_Size[1]*FFT_Size[2];
-#  else
-   rfftwnd_mpi_local_sizes( FFTW_Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
-                            &local_y_start_after_transpose, &total_local_size );
-#  endif
+   if ( UseWorkspace )
+   {
+      local_nz                      = FFTW_local_nz;
+      local_ny_after_transpose      = FFTW_local_ny_after_transpose;
+      local_y_start_after_transpose = FFTW_local_y_start_after_transpose;
+      total_local_size              = FFTW_total_local_size;
+      NRecvSlice                    = FFTW_NRecvSlice;
+      List_z_start                  = FFTW_List_z_start;
+   }
+
+   else
+   {
+#     ifdef SERIAL
+      local_nz                      = FFT_Size[2];
+      local_z_start                 = 0;
+      local_ny_after_transpose      = NULL_INT;
+      local_y_start_after_transpose = NULL_INT;
+      total_local_size              = 2*Nx_Padded*FFT_Size[1]*FFT_Size[2];
+#     else
+      rfftwnd_mpi_local_sizes( FFTW_Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
+                               &local_y_start_after_transpose, &total_local_size );
+#     endif
 
-// collect "local_nz" from all ranks and set the corresponding list "List_z_start"
-   int List_nz     [MPI_NRank  ];   // slab thickness of each rank in the FFTW slab decomposition
-   int List_z_start[MPI_NRank+1];   // starting z coordinate of each rank in the FFTW slab decomposition
+//    collect "local_nz" from all ranks and set the corresponding list "List_z_start"
+      int List_nz[MPI_NRank];                // slab thickness of each rank in the FFTW slab decomposition
+      List_z_start = new int [MPI_NRank+1];  // starting z coordinate of each rank in the FFTW slab decomposition
 
-   MPI_Allgather( &local_nz, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
+      MPI_Allgather( &local_nz, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
 
-   List_z_start[0] = 0;
-   for (int r=0; r<MPI_NRank; r++)  List_z_start[r+1] = List_z_start[r] + List_nz[r];
+      List_z_start[0] = 0;
+      for (int r=0; r<MPI_NRank; r++)  List_z_start[r+1] = List_z_start[r] + List_nz[r];
 
-   if ( List_z_start[MPI_NRank] != FFT_Size[2] )
-      Aux_Error( ERROR_INFO, "List_z_start[%d] (%d) != expectation (%d) !!\n",
-                 MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
+      if ( List_z_start[MPI_NRank] != FFT_Size[2] )
+         Aux_Error( ERROR_INFO, "List_z_start[%d] (%d) != expectation (%d) !!\n",
+                    MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
 
+      NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+   } // if ( UseWorkspace ) ... else ...
 
-// 2. allocate memory
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
 
+// 2. allocate memory
    double *PS_total     = NULL;
-   real   *RhoK         = new real [ total_local_size ];                         // array storing both density and potential
-   real   *SendBuf      = new real [ amr->NPatchComma[0][1]*CUBE(PS1) ];         // MPI send buffer for density and potential
-   real   *RecvBuf      = new real [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];         // MPI recv buffer for density and potentia
-   long   *SendBuf_SIdx = new long [ amr->NPatchComma[0][1]*PS1 ];               // MPI send buffer for 1D coordinate in slab
-   long   *RecvBuf_SIdx = new long [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];// MPI recv buffer for 1D coordinate in slab
+   real   *RhoK         = ( UseWorkspace ) ? FFTW_RhoK                                    // array storing density
+                                           : new real [ total_local_size ];
+   real   *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];             // MPI send buffer for density
+   real   *RecvBuf      = ( UseWorkspace ) ? FFTW_RecvBuf                                 // MPI recv buffer for density
+                                           : new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];
+   long   *SendBuf_SIdx = new long [ amr->NPatchComma[0][1]*PS1 ];                         // MPI send buffer for 1D coordinate in slab
+   long   *RecvBuf_SIdx = ( UseWorkspace ) ? FFTW_RecvBuf_SIdx                            // MPI recv buffer for 1D coordinate in slab
+                                           : new long [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];
 
    int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
    int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
@@ -93,7 +132,7 @@ void Output_BasePowerSpectrum( const char *FileName )
    const bool FaSibBufPatch    = NULL_BOOL;
 #  endif
 
-   Prepare_PatchData_InitParticleDensityArray( 0 );
+   Prepare_PatchData_InitParticleDensityArray( 0, PredictPos, Time[0] );
 
    Par_CollectParticle2OneLevel( 0, PredictPos, Time[0], SibBufPatch, FaSibBufPatch, JustCountNPar_No,
                                  TimingSendPar_No );
@@ -106,7 +145,19 @@ void Output_BasePowerSpectrum( const char *FileName )
 
 
 // 5. evaluate the base-level power spectrum by FFT
-   GetBasePowerSpectrum( RhoK, local_y_start_after_transpose, local_ny_after_transpose, PS_total );
+// 5-1. check whether the power spectrum binned by the last base-level Poisson solver can be reused
+//      --> it must be valid on all ranks
+   int UseCache_local, UseCache;
+
+   UseCache_local = ( UseWorkspace  &&  PS_Cache_Valid  &&  Output_BasePowerSpectrum_HashDens(RhoK) == PS_Cache_Hash );
+
+   MPI_Allreduce( &UseCache_local, &UseCache, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD );
+
+// the cache can be used at most once
+   PS_Cache_Valid = false;
+
+// 5-2. skip the forward FFT if the cache is available
+   GetBasePowerSpectrum( RhoK, local_y_start_after_transpose, local_ny_after_transpose, PS_total, UseCache );
 
 
 // 6. output the power spectrum
@@ -130,11 +181,15 @@ void Output_BasePowerSpectrum( const char *FileName )
 
 
 // 7. free memory
-   delete [] RhoK;
+   if ( !UseWorkspace )
+   {
+      delete [] RhoK;
+      delete [] RecvBuf;
+      delete [] RecvBuf_SIdx;
+      delete [] List_z_start;
+   }
    delete [] SendBuf;
-   delete [] RecvBuf;
    delete [] SendBuf_SIdx;
-   delete [] RecvBuf_SIdx;
    if ( MPI_Rank == 0 )    delete [] PS_total;
 
 // free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
@@ -161,14 +216,18 @@ void Output_BasePowerSpectrum( const char *FileName )
 //                j_start     : Starting j index
 //                dj          : Size of array in the j (y) direction after the forward FFT
 //                PS_total    : Power spectrum summed over all MPI ranks
+//                UseCache    : Use the power spectrum binned by the base-level Poisson solver (FFTW_PS_Local/Count)
+//                              instead of transforming RhoK
 //
 // Return      :  PS_total
 //-------------------------------------------------------------------------------------------------------
-void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total )
+void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total, const bool UseCache )
 {
 
 // check
    if ( MPI_Rank == 0  &&  PS_total == NULL )   Aux_Error( ERROR_INFO, "PS_total == NULL at the root rank !!\n" );
+   if ( UseCache  &&  ( FFTW_PS_Local == NULL || FFTW_PS_Count == NULL ) )
+      Aux_Error( ERROR_INFO, "FFTW_PS_Local/Count == NULL for UseCache !!\n" );
 
 
    const int Nx        = NX0_TOT[0];
@@ -176,22 +235,98 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
    const int Nz        = NX0_TOT[2];
    const int Nx_Padded = Nx/2 + 1;
 
-   fftw_complex *cdata=NULL;
    double PS_local[Nx_Padded];
    long   Count_local[Nx_Padded], Count_total[Nx_Padded];
-   int    bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
 
 
-// forward FFT
-#  ifdef SERIAL
-   rfftwnd_one_real_to_complex( FFTW_Plan_PS, RhoK, NULL );
-#  else
-   rfftwnd_mpi( FFTW_Plan_PS, 1, RhoK, NULL, FFTW_TRANSPOSED_ORDER );
+   if ( UseCache )
+   {
+      for (int b=0; b<Nx_Padded; b++)
+      {
+         PS_local   [b] = FFTW_PS_Local[b];
+         Count_local[b] = FFTW_PS_Count[b];
+      }
+   }
+
+   else
+   {
+//    forward FFT
+#     ifdef SERIAL
+      rfftwnd_one_real_to_complex( FFTW_Plan_PS, RhoK, NULL );
+#     else
+      rfftwnd_mpi( FFTW_Plan_PS, 1, RhoK, NULL, FFTW_TRANSPOSED_ORDER );
+#     endif
+
+//    estimate the power spectrum
+      BinBasePowerSpectrum( RhoK, j_start, dj, PS_local, Count_local );
+   }
+
+
+// sum over all ranks
+   MPI_Reduce( PS_local,    PS_total,    Nx_Padded, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Count_local, Count_total, Nx_Padded, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// normalization: SQR(AveRho) accounts for Delta=Rho/AveRho
+// --> we have assumed that the total mass in the simulation is conserved (since we don't recalculate it here)
+   const double Coeff = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2] / SQR( (double)Nx*(double)Ny*(double)Nz*AveDensity_Init );
+   double Norm;
+
+#  ifdef DIMENSIONLESS_FORM
+   const double k0 = 2.0*M_PI/amr->BoxSize[0];     // assuming cubic box
+   double WaveK;
 #  endif
 
+   if ( MPI_Rank == 0 )
+   {
+      for (int b=0; b<Nx_Padded; b++)
+      {
+//       average
+         PS_total[b] /= (double)Count_total[b];
+
+//       normalization
+#        ifdef DIMENSIONLESS_FORM
+         WaveK        = b*k0;
+         Norm         = Coeff*CUBE(WaveK)/(2.0*M_PI*M_PI);     // dimensionless power spectrum
+#        else
+         Norm         = Coeff;                                 // dimensional power spectrum [Mpc^3/h^3]
+#        endif
+         PS_total[b] *= Norm;
+      }
+   }
+
+} // FUNCTION : GetBasePowerSpectrum
+
 
-// the data are now complex, so typecast a pointer
-   cdata = (fftw_complex*) RhoK;
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BinBasePowerSpectrum
+// Description :  Bin the power of the base-level density in the k space on this rank
+//
+// Note        :  1. Invoked by GetBasePowerSpectrum() and Output_BasePowerSpectrum_SaveCache()
+//                2. Slab decomposition of FFTW_Plan_PS is assumed
+//
+// Parameter   :  RhoK        : Array storing the density in the k space (i.e., after the forward FFT)
+//                j_start     : Starting j index
+//                dj          : Size of array in the j (y) direction after the forward FFT
+//                PS_local    : Power summed over all modes in each bin on this rank
+//                Count_local : Number of modes in each bin on this rank
+//
+// Return      :  PS_local, Count_local
+//-------------------------------------------------------------------------------------------------------
+void BinBasePowerSpectrum( const real *RhoK, const int j_start, const int dj, double *PS_local, long *Count_local )
+{
+
+   const int Nx        = NX0_TOT[0];
+   const int Ny        = NX0_TOT[1];
+   const int Nz        = NX0_TOT[2];
+   const int Nx_Padded = Nx/2 + 1;
+
+   int bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
+
+
+// the data are complex, so typecast a pointer
+   const fftw_complex *cdata = (const fftw_complex*) RhoK;
 
 
 // set up the dimensionless wave number coefficients according to the FFTW data format
@@ -248,41 +383,119 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
       } // i,j,k
    } // i,j,k
 
+} // FUNCTION : BinBasePowerSpectrum
 
-// sum over all ranks
-   MPI_Reduce( PS_local,    PS_total,    Nx_Padded, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
-   MPI_Reduce( Count_local, Count_total, Nx_Padded, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
 
 
-// normalization: SQR(AveRho) accounts for Delta=Rho/AveRho
-// --> we have assumed that the total mass in the simulation is conserved (since we don't recalculate it here)
-   const double Coeff = amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2] / SQR( (double)Nx*(double)Ny*(double)Nz*AveDensity_Init );
-   double Norm;
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum_IsPending
+// Description :  Predict whether Output_BasePowerSpectrum() will be invoked right after the base-level Poisson
+//                solver at the given physical time
+//
+// Note        :  1. Invoked by CPU_PoissonSolver_FFT() to decide whether to bin the power spectrum for
+//                   Output_BasePowerSpectrum()
+//                2. Only a hint for avoiding unnecessary work
+//                   --> Output_BasePowerSpectrum() always validates the cache by comparing the density hash
+//                   --> Data dumps triggered manually or at the end of the run are not predicted and simply
+//                       fall back to a separate FFT
+//                3. The result must be the same on all ranks
+//
+// Parameter   :  PrepTime : Physical time of the density passed to the base-level Poisson solver
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool Output_BasePowerSpectrum_IsPending( const double PrepTime )
+{
 
-#  ifdef DIMENSIONLESS_FORM
-   const double k0 = 2.0*M_PI/amr->BoxSize[0];     // assuming cubic box
-   double WaveK;
-#  endif
+   if ( !OPT__OUTPUT_BASEPS  ||  OPT__BC_POT != BC_POT_PERIODIC )  return false;
 
-   if ( MPI_Rank == 0 )
+   switch ( OPT__OUTPUT_MODE )
    {
-      for (int b=0; b<Nx_Padded; b++)
-      {
-//       average
-         PS_total[b] /= (double)Count_total[b];
+//    the base-level Poisson solver is invoked either during the initialization (before "Step" is incremented)
+//    or during the evolution of step "Step" (after which "Step" is incremented)
+      case OUTPUT_CONST_STEP :
+         return (  Step%OUTPUT_STEP == 0  ||  (Step+1)%OUTPUT_STEP == 0  );
+
+//    adopt the same tolerance as Output_DumpData()
+      case OUTPUT_CONST_DT :
+      case OUTPUT_USE_TABLE :
+         return (   ( PrepTime != 0.0 && fabs( (PrepTime-DumpTime)/PrepTime ) < 1.0e-8  )
+                 || ( PrepTime == 0.0 && fabs(  PrepTime-DumpTime           ) < 1.0e-12 )   );
+
+      default :
+         return false;
+   }
 
-//       normalization
-#        ifdef DIMENSIONLESS_FORM
-         WaveK        = b*k0;
-         Norm         = Coeff*CUBE(WaveK)/(2.0*M_PI*M_PI);     // dimensionless power spectrum
-#        else
-         Norm         = Coeff;                                 // dimensional power spectrum [Mpc^3/h^3]
-#        endif
-         PS_total[b] *= Norm;
+} // FUNCTION : Output_BasePowerSpectrum_IsPending
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum_HashDens
+// Description :  Compute a 64-bit FNV-1a hash of the base-level density stored in the shared slab of this rank
+//
+// Note        :  1. Only the cells covered by the simulation domain are hashed (i.e., the padding in the x
+//                   direction is excluded)
+//                2. Must be invoked before the forward FFT
+//
+// Parameter   :  RhoK : Array storing the density in the shared slab layout (see Init_FFTW())
+//
+// Return      :  Hash value
+//-------------------------------------------------------------------------------------------------------
+ulong Output_BasePowerSpectrum_HashDens( const real *RhoK )
+{
+
+   const int  Nx_Padded = 2*( NX0_TOT[0]/2 + 1 );
+   const int  Nz_Local  = MIN( FFTW_local_nz, NX0_TOT[2]-FFTW_local_z_start );
+   const long RowSize   = (long)NX0_TOT[0]*sizeof(real);
+
+   ulong Hash = 14695981039346656037UL;
+   const unsigned char *Byte;
+
+   for (int k=0; k<Nz_Local;   k++)
+   for (int j=0; j<NX0_TOT[1]; j++)
+   {
+      Byte = (const unsigned char*)( RhoK + ((long)k*NX0_TOT[1] + j)*Nx_Padded );
+
+      for (long b=0; b<RowSize; b++)
+      {
+         Hash ^= (ulong)Byte[b];
+         Hash *= 1099511628211UL;
       }
    }
 
-} // FUNCTION : GetBasePowerSpectrum
+   return Hash;
+
+} // FUNCTION : Output_BasePowerSpectrum_HashDens
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum_SaveCache
+// Description :  Bin the power spectrum of the density transformed by the base-level Poisson solver for the
+//                next Output_BasePowerSpectrum()
+//
+// Note        :  1. Invoked by FFT_Periodic() right after the forward FFT when Output_BasePowerSpectrum_IsPending()
+//                   returns true
+//                2. Results are stored in FFTW_PS_Local/Count allocated by Init_FFTW()
+//
+// Parameter   :  RhoK     : Array storing the density in the k space
+//                j_start  : Starting j index
+//                dj       : Size of array in the j (y) direction after the forward FFT
+//                DensHash : Hash of the density before the forward FFT (see Output_BasePowerSpectrum_HashDens())
+//-------------------------------------------------------------------------------------------------------
+void Output_BasePowerSpectrum_SaveCache( const real *RhoK, const int j_start, const int dj, const ulong DensHash )
+{
+
+   if ( FFTW_PS_Local == NULL  ||  FFTW_PS_Count == NULL )
+      Aux_Error( ERROR_INFO, "FFTW_PS_Local/Count == NULL !!\n" );
+
+   BinBasePowerSpectrum( RhoK, j_start, dj, FFTW_PS_Local, FFTW_PS_Count );
+
+   PS_Cache_Hash  = DensHash;
+   PS_Cache_Valid = true;
+
+} // FUNCTION : Output_BasePowerSpectrum_SaveCache
 
 
 
@@ -0,0 +1,165 @@
+#include "GAMER.h"
+
+
+// fixed length of each column label in the file header
+#define BINTABLE_LABEL_LEN    32
+
+// maximum number of bytes packed and written by each rank at a time
+#define BINTABLE_CHUNK_SIZE   ( 64L*1024L*1024L )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BinaryTable
+// Description :  Write a distributed table to a single binary file in parallel
+//
+// Note        :  1. Binary counterpart of the ASCII outputs of Output_DumpData_Part() and Par_Output_TextFile()
+//                   --> Used when OPT__OUTPUT_TEXT_BINARY is on
+//                2. File layout (native endianness):
+//                      char   Magic[8]                          = "GAMERTBL"
+//                      int    Version                           = 1
+//                      int    SizeElement                       : number of bytes per table element (4/8)
+//                      int    NCol                              : number of columns
+//                      int    LabelLen                          = 32
+//                      long   NRow                              : number of rows of all ranks
+//                      long   Step
+//                      double Time
+//                      char   Label[NCol][LabelLen]
+//                      (data) Table[NRow][NCol]                 : row-major, rank 0 first
+//                   --> For example, numpy.fromfile( ..., offset=48+NCol*32 ).reshape( NRow, NCol )
+//                3. Rows of each rank are written to a contiguous segment of the file
+//                   --> Collective MPI-IO writes of at most BINTABLE_CHUNK_SIZE bytes per rank per call
+//                   --> Avoid the rank-by-rank fprintf() of the ASCII outputs
+//                4. Pack( Row0, NRowPack, Buf ) must copy NRowPack rows starting from the local row Row0 to Buf
+//                   --> Invoked with increasing Row0 so that it can walk through the local data sequentially
+//
+// Parameter   :  FileName    : Name of the output file
+//                NCol        : Number of columns
+//                Label       : Column labels
+//                SizeElement : Number of bytes per element
+//                NRow        : Number of rows in this rank
+//                Pack        : Function packing the rows of this rank
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Output_BinaryTable( const char *FileName, const int NCol, const char *const *Label, const int SizeElement,
+                         const long NRow, void (*Pack)( const long Row0, const long NRowPack, char *Buf ) )
+{
+
+// check
+   if ( NCol <= 0 )     Aux_Error( ERROR_INFO, "NCol (%d) <= 0 !!\n", NCol );
+   if ( NRow < 0 )      Aux_Error( ERROR_INFO, "NRow (%ld) < 0 !!\n", NRow );
+   if ( Pack == NULL )  Aux_Error( ERROR_INFO, "Pack == NULL !!\n" );
+
+   if ( MPI_Rank == 0  &&  Aux_CheckFileExist(FileName) )
+      Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+
+// 1. get the number of rows of all ranks
+   const long RowSize = (long)NCol*SizeElement;
+   long *NRow_AllRank = new long [MPI_NRank];
+   long  NRow_Total   = 0;
+
+   MPI_Allgather( &NRow, 1, MPI_LONG, NRow_AllRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)  NRow_Total += NRow_AllRank[r];
+
+
+// 2. prepare the header
+   const char Magic[8]   = { 'G', 'A', 'M', 'E', 'R', 'T', 'B', 'L' };
+   const int  Version    = 1;
+   const int  LabelLen   = BINTABLE_LABEL_LEN;
+   const long HeaderSize = sizeof(Magic) + 4*sizeof(int) + 2*sizeof(long) + sizeof(double) + (long)NCol*LabelLen;
+   char *Header = new char [HeaderSize];
+   char *Ptr    = Header;
+
+   memset( Header, 0, HeaderSize );
+
+   memcpy( Ptr, Magic,        sizeof(Magic)  );  Ptr += sizeof(Magic);
+   memcpy( Ptr, &Version,     sizeof(int)    );  Ptr += sizeof(int);
+   memcpy( Ptr, &SizeElement, sizeof(int)    );  Ptr += sizeof(int);
+   memcpy( Ptr, &NCol,        sizeof(int)    );  Ptr += sizeof(int);
+   memcpy( Ptr, &LabelLen,    sizeof(int)    );  Ptr += sizeof(int);
+   memcpy( Ptr, &NRow_Total,  sizeof(long)   );  Ptr += sizeof(long);
+   memcpy( Ptr, &Step,        sizeof(long)   );  Ptr += sizeof(long);
+   memcpy( Ptr, &Time[0],     sizeof(double) );  Ptr += sizeof(double);
+
+   for (int c=0; c<NCol; c++)
+   {
+      strncpy( Ptr, Label[c], LabelLen-1 );
+      Ptr += LabelLen;
+   }
+
+
+// 3. write data
+// --> all ranks must call the collective write the same number of times
+   const long NRowChunk = MAX( BINTABLE_CHUNK_SIZE/RowSize, 1L );
+   const long NChunk    = ( NRow + NRowChunk - 1 ) / NRowChunk;
+   long NChunk_Max;
+   char *Buf = new char [ MIN(NRow,NRowChunk)*RowSize + 1 ];
+
+   MPI_Allreduce( &NChunk, &NChunk_Max, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+#  ifdef SERIAL
+   FILE *File = fopen( FileName, "wb" );
+
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+
+   if ( fwrite( Header, 1, HeaderSize, File ) != (size_t)HeaderSize )
+      Aux_Error( ERROR_INFO, "failed to write the header of the file \"%s\" !!\n", FileName );
+
+   for (long t=0; t<NChunk_Max; t++)
+   {
+      const long Row0     = t*NRowChunk;
+      const long NRowPack = MIN( NRowChunk, NRow-Row0 );
+
+      Pack( Row0, NRowPack, Buf );
+
+      if ( fwrite( Buf, 1, NRowPack*RowSize, File ) != (size_t)(NRowPack*RowSize) )
+         Aux_Error( ERROR_INFO, "failed to write the file \"%s\" !!\n", FileName );
+   }
+
+   fclose( File );
+
+#  else
+   MPI_File   File;
+   MPI_Status Status;
+   long       Row0_ThisRank = 0;
+
+   for (int r=0; r<MPI_Rank; r++)   Row0_ThisRank += NRow_AllRank[r];
+
+   if (  MPI_File_open( MPI_COMM_WORLD, (char*)FileName, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &File )
+         != MPI_SUCCESS  )
+      Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+
+// truncate any existing file
+   MPI_File_set_size( File, 0 );
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( MPI_File_write_at( File, 0, Header, HeaderSize, MPI_BYTE, &Status ) != MPI_SUCCESS )
+         Aux_Error( ERROR_INFO, "failed to write the header of the file \"%s\" !!\n", FileName );
+   }
+
+   for (long t=0; t<NChunk_Max; t++)
+   {
+      const long       Row0     = t*NRowChunk;
+      const long       NRowPack = MAX( MIN( NRowChunk, NRow-Row0 ), 0L );
+      const MPI_Offset Offset   = HeaderSize + ( Row0_ThisRank + MIN(Row0,NRow) )*RowSize;
+
+      if ( NRowPack > 0 )  Pack( Row0, NRowPack, Buf );
+
+      if ( MPI_File_write_at_all( File, Offset, Buf, (int)(NRowPack*RowSize), MPI_BYTE, &Status ) != MPI_SUCCESS )
+         Aux_Error( ERROR_INFO, "failed to write the file \"%s\" !!\n", FileName );
+   }
+
+   MPI_File_close( &File );
+#  endif // #ifdef SERIAL ... else ...
+
+
+   delete [] NRow_AllRank;
+   delete [] Header;
+   delete [] Buf;
+
+} // FUNCTION : Output_BinaryTable
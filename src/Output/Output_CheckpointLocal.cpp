@@ -0,0 +1,299 @@
+#include "GAMER.h"
+#include "CkptLocal_Typedef.h"
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef LOAD_BALANCE
+
+static long Pack_ThisRank( char *&Buf );
+static void WriteFile( const char *FileName, const char *Buf, const long Size );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_CheckpointLocal
+// Description :  Write a diskless-style checkpoint: each rank stores its own real patches and particles, together
+//                with a replica of another rank, in the node-local directory CKPT_LOCAL_DIR
+//
+// Note        :  1. Enabled by OPT__CKPT_LOCAL and invoked by main() every OPT__CKPT_LOCAL root-level steps and
+//                   by Output_DumpData() for the manual dumps of OPT__MANUAL_CONTROL
+//                2. Data are serialized into a single memory buffer (i.e., no HDF5 and no global file), which is
+//                   copied to the replica host by MPI and then written to
+//                      CKPT_LOCAL_DIR/Rank_XXXXXX    : checkpoint of this rank
+//                      CKPT_LOCAL_DIR/Replica_XXXXXX : replica of the checkpoint of rank XXXXXX
+//                   --> The replica host is half of the ranks apart (see CKPT_LOCAL_REPLICA_HOST()) so that the
+//                       checkpoint of a failed node can be recovered from another node
+//                3. Files are first written to "*.tmp" and then renamed so that an interrupted checkpoint never
+//                   corrupts the previous one
+//                4. Reloaded by Init_ByRestart_Local() for OPT__RESTART_LOCAL, which requires the same executable
+//                   and number of ranks
+//                5. Must be invoked by all ranks at the end of a root-level step when all levels are synchronized
+//-------------------------------------------------------------------------------------------------------
+void Output_CheckpointLocal()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step %ld) ... ", __FUNCTION__, Step );
+
+   const double Time_Start = MPI_Wtime();
+   const int    Host       = CKPT_LOCAL_REPLICA_HOST ( MPI_Rank, MPI_NRank );
+   const int    Owner      = CKPT_LOCAL_REPLICA_OWNER( MPI_Rank, MPI_NRank );
+
+
+// 1. serialize the data of this rank
+   char *Buf  = NULL;
+   const long Size = Pack_ThisRank( Buf );
+
+
+// 2. send the checkpoint to the replica host and receive the checkpoint of the replica owner
+   long  RecvSize;
+   char *RecvBuf = NULL;
+
+   MPI_Sendrecv( &Size, 1, MPI_LONG, Host, 0, &RecvSize, 1, MPI_LONG, Owner, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+
+   RecvBuf = new char [RecvSize];
+
+   Output_CkptLocal_Exchange( Buf, Size, Host, RecvBuf, RecvSize, Owner );
+
+
+// 3. write both checkpoints to the node-local directory
+   char FileName[2*MAX_STRING];
+
+   if (  mkdir( CKPT_LOCAL_DIR, 0755 ) != 0  &&  errno != EEXIST  )
+      Aux_Error( ERROR_INFO, "failed to create the directory \"%s\" !!\n", CKPT_LOCAL_DIR );
+
+   sprintf( FileName, "%s/Rank_%06d", CKPT_LOCAL_DIR, MPI_Rank );
+   WriteFile( FileName, Buf, Size );
+
+   sprintf( FileName, "%s/Replica_%06d", CKPT_LOCAL_DIR, Owner );
+   WriteFile( FileName, RecvBuf, RecvSize );
+
+   delete [] Buf;
+   delete [] RecvBuf;
+
+
+   MPI_Barrier( MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done (%.3f s)\n", MPI_Wtime()-Time_Start );
+
+} // FUNCTION : Output_CheckpointLocal
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_CkptLocal_Exchange
+// Description :  Send a byte buffer to one rank and receive another byte buffer from (possibly) another rank
+//
+// Note        :  1. Invoked by Output_CheckpointLocal() and Init_ByRestart_Local()
+//                2. Buffers are split into chunks of at most 1 GiB to avoid the int overflow of MPI counts
+//                3. Use non-blocking communication so that the pattern is deadlock-free even when all ranks
+//                   send and receive at the same time
+//                4. SendSize and RecvSize can be zero
+//
+// Parameter   :  SendBuf  : Buffer to be sent
+//                SendSize : Number of bytes to be sent
+//                SendRank : Target rank to send data
+//                RecvBuf  : Buffer to store the received data
+//                RecvSize : Number of bytes to be received
+//                RecvRank : Target rank to receive data
+//-------------------------------------------------------------------------------------------------------
+void Output_CkptLocal_Exchange( const char *SendBuf, const long SendSize, const int SendRank,
+                                char *RecvBuf, const long RecvSize, const int RecvRank )
+{
+
+   const long ChunkSize = 1L << 30;
+   const int  NSend     = (int)( ( SendSize + ChunkSize - 1 ) / ChunkSize );
+   const int  NRecv     = (int)( ( RecvSize + ChunkSize - 1 ) / ChunkSize );
+
+   MPI_Request *Req = new MPI_Request [ NSend + NRecv ];
+
+   for (int c=0; c<NRecv; c++)
+      MPI_Irecv( RecvBuf+c*ChunkSize, (int)MIN( ChunkSize, RecvSize-c*ChunkSize ), MPI_BYTE, RecvRank, c,
+                 MPI_COMM_WORLD, Req+c );
+
+   for (int c=0; c<NSend; c++)
+      MPI_Isend( (void*)( SendBuf+c*ChunkSize ), (int)MIN( ChunkSize, SendSize-c*ChunkSize ), MPI_BYTE, SendRank, c,
+                 MPI_COMM_WORLD, Req+NRecv+c );
+
+   MPI_Waitall( NSend+NRecv, Req, MPI_STATUSES_IGNORE );
+
+   delete [] Req;
+
+} // FUNCTION : Output_CkptLocal_Exchange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pack_ThisRank
+// Description :  Serialize the real patches and particles of this rank into a single buffer
+//
+// Note        :  1. See CkptLocal_Typedef.h for the data layout
+//                2. Buf is allocated here and must be freed by the caller
+//
+// Parameter   :  Buf : Buffer to store the serialized data
+//
+// Return      :  Buf, number of bytes in Buf
+//-------------------------------------------------------------------------------------------------------
+long Pack_ThisRank( char *&Buf )
+{
+
+   const long FluSize = NCOMP_TOTAL*CUBE(PS1)*sizeof(real);
+#  ifdef MHD
+   const long MagSize = NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real);
+#  endif
+
+
+// 1. set the header
+   CkptLocal_t Header;
+
+   memset( &Header, 0, sizeof(CkptLocal_t) );
+
+   Header.Magic      = CKPT_LOCAL_MAGIC;
+   Header.Version    = CKPT_LOCAL_VERSION;
+   Header.NRank      = MPI_NRank;
+   Header.Rank       = MPI_Rank;
+   Header.NLevel     = NLEVEL;
+   Header.PatchSize  = PS1;
+   Header.NCompTotal = NCOMP_TOTAL;
+   Header.NCompMag   = NCOMP_MAG;
+#  ifdef PARTICLE
+   Header.NParAtt    = PAR_NATT_TOTAL;
+#  endif
+   Header.SizeReal   = sizeof(real);
+   Header.DumpID     = DumpID;
+   Header.Step       = Step;
+#  ifdef PARTICLE
+   Header.NPar_AllRank    = amr->Par->NPar_Active_AllRank;
+#  endif
+#  ifdef GRAVITY
+   Header.AveDensity_Init = AveDensity_Init;
+#  endif
+
+   Header.Size = sizeof(CkptLocal_t) + NLEVEL*( MPI_NRank + 1 )*sizeof(long);
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NReal = amr->NPatchComma[lv][1];
+
+      Header.Time          [lv] = Time          [lv];
+      Header.dTime_AllLv   [lv] = dTime_AllLv   [lv];
+      Header.AdvanceCounter[lv] = AdvanceCounter[lv];
+      Header.NPatchTotal   [lv] = NPatchTotal   [lv];
+      Header.NReal         [lv] = NReal;
+      Header.NParLv        [lv] = 0;
+
+#     ifdef PARTICLE
+      for (int PID=0; PID<NReal; PID++)   Header.NParLv[lv] += amr->patch[0][lv][PID]->NPar;
+#     endif
+
+      Header.Size += NReal*( 3*sizeof(int) + FluSize );
+#     ifdef MHD
+      Header.Size += NReal*MagSize;
+#     endif
+#     ifdef PARTICLE
+      Header.Size += NReal*sizeof(int) + Header.NParLv[lv]*PAR_NATT_TOTAL*sizeof(real);
+#     endif
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 2. serialize data
+   Buf = new char [Header.Size];
+
+   char *Ptr = Buf;
+
+   memcpy( Ptr, &Header, sizeof(CkptLocal_t) );
+   Ptr += sizeof(CkptLocal_t);
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NReal = Header.NReal[lv];
+
+      for (int PID=0; PID<NReal; PID++)
+      {
+         memcpy( Ptr, amr->patch[0][lv][PID]->corner, 3*sizeof(int) );
+         Ptr += 3*sizeof(int);
+      }
+
+#     ifdef PARTICLE
+      for (int PID=0; PID<NReal; PID++)
+      {
+         memcpy( Ptr, &amr->patch[0][lv][PID]->NPar, sizeof(int) );
+         Ptr += sizeof(int);
+      }
+#     endif
+
+      for (int PID=0; PID<NReal; PID++)
+      {
+         memcpy( Ptr, amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, FluSize );
+         Ptr += FluSize;
+      }
+
+#     ifdef MHD
+      for (int PID=0; PID<NReal; PID++)
+      {
+         memcpy( Ptr, amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, MagSize );
+         Ptr += MagSize;
+      }
+#     endif
+
+#     ifdef PARTICLE
+      for (int v=0; v<PAR_NATT_TOTAL; v++)
+      {
+         real *ParAtt = (real*)Ptr;
+
+         for (int PID=0; PID<NReal; PID++)
+         for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+            *ParAtt ++ = amr->Par->Attribute[v][ amr->patch[0][lv][PID]->ParList[p] ];
+
+         Ptr += Header.NParLv[lv]*sizeof(real);
+      }
+#     endif
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      memcpy( Ptr, amr->LB->CutPoint[lv], ( MPI_NRank + 1 )*sizeof(long) );
+      Ptr += ( MPI_NRank + 1 )*sizeof(long);
+   }
+
+   if ( Ptr - Buf != Header.Size )
+      Aux_Error( ERROR_INFO, "serialized size (%ld) != expect (%ld) !!\n", (long)(Ptr-Buf), Header.Size );
+
+   return Header.Size;
+
+} // FUNCTION : Pack_ThisRank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteFile
+// Description :  Write a buffer to "FileName.tmp" and then rename it to "FileName"
+//
+// Parameter   :  FileName : Target file name
+//                Buf      : Data to be written
+//                Size     : Number of bytes in Buf
+//-------------------------------------------------------------------------------------------------------
+void WriteFile( const char *FileName, const char *Buf, const long Size )
+{
+
+   char FileName_Tmp[2*MAX_STRING+4];
+   sprintf( FileName_Tmp, "%s.tmp", FileName );
+
+   FILE *File = fopen( FileName_Tmp, "wb" );
+
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName_Tmp );
+
+   if (  (long)fwrite( Buf, 1, Size, File ) != Size  ||  fflush( File ) != 0  ||  fsync( fileno(File) ) != 0  )
+      Aux_Error( ERROR_INFO, "failed to write the file \"%s\" !!\n", FileName_Tmp );
+
+   fclose( File );
+
+   if ( rename( FileName_Tmp, FileName ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to rename the file \"%s\" !!\n", FileName_Tmp );
+
+} // FUNCTION : WriteFile
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -13,6 +13,8 @@ extern void (*Output_User_Ptr)();
 //
 // Note        :  1. For OUTPUT_USER, the function pointer "Output_User_Ptr" must be set by a
 //                   test problem initializer
+//                2. For OPT__CKPT_LOCAL, manual dumps triggered by OPT__MANUAL_CONTROL write the node-local
+//                   checkpoints by Output_CheckpointLocal() instead
 //
 // Parameter   :  Stage : 0 : beginning of the run
 //                        1 : during the evolution
@@ -176,6 +178,16 @@ void Output_DumpData( const int Stage )
 // enable this functionality only if OPT__MANUAL_CONTROL is on
    if ( OPT__MANUAL_CONTROL )    Output_DumpManually( OutputData_RunTime );
 
+// write the node-local checkpoints instead of the regular outputs for manual dumps if OPT__CKPT_LOCAL is on
+#  ifdef LOAD_BALANCE
+   if ( OutputData_RunTime  &&  !OutputData  &&  OPT__CKPT_LOCAL > 0 )
+   {
+      Output_CheckpointLocal();
+
+      OutputData_RunTime = false;
+   }
+#  endif
+
 
 // output data
    if ( OutputData || OutputData_RunTime )
@@ -185,8 +197,13 @@ void Output_DumpData( const int Stage )
       if ( OPT__CORR_AFTER_ALL_SYNC == CORR_AFTER_SYNC_BEFORE_DUMP  &&  Stage != 0 )  Flu_CorrAfterAllSync();
 
       if ( OPT__OUTPUT_TOTAL )            Output_DumpData_Total( FileName_Total );
-      if ( OPT__OUTPUT_PART  )            Output_DumpData_Part( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
-                                                                OUTPUT_PART_Y, OUTPUT_PART_Z, FileName_Part );
+      if ( OPT__OUTPUT_PART  )
+      {
+         if ( OPT__OUTPUT_TEXT_BINARY )   Output_DumpData_Part_Binary( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
+                                                                       OUTPUT_PART_Y, OUTPUT_PART_Z, FileName_Part );
+         else                             Output_DumpData_Part       ( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
+                                                                       OUTPUT_PART_Y, OUTPUT_PART_Z, FileName_Part );
+      }
       if ( OPT__OUTPUT_USER )
       {
          if ( Output_User_Ptr != NULL )   Output_User_Ptr();
@@ -197,8 +214,17 @@ void Output_DumpData( const int Stage )
       if ( OPT__OUTPUT_BASEPS )           Output_BasePowerSpectrum( FileName_PS );
 #     endif
 #     ifdef PARTICLE
-      if ( OPT__OUTPUT_PAR_TEXT )         Par_Output_TextFile( FileName_Particle );
+      if ( OPT__OUTPUT_PAR_TEXT )
+      {
+         if ( OPT__OUTPUT_TEXT_BINARY )   Par_Output_BinaryFile( FileName_Particle );
+         else                             Par_Output_TextFile  ( FileName_Particle );
+      }
+#     endif
+#     ifdef TIMING
+      if ( OPT__TRACE )                   Aux_Trace_Dump();
 #     endif
+      if ( OPT__MEMORY_POOL == 2 )        Aux_Record_MemoryPool();
+      if ( OPT__INIT_REFINE_MAP == 2 )    Aux_Record_RefineMap();
 
       Write_DumpRecord();
 
@@ -2,6 +2,17 @@
 
 static void WriteFile( FILE *File, const int lv, const int PID, const int i, const int j, const int k,
                        const int ii, const int jj, const int kk );
+static void FillRow( double *Row, const int lv, const int PID, const int i, const int j, const int k,
+                     const int ii, const int jj, const int kk );
+static void CheckPart( const OptOutputPart_t Part, const double x, const double y, const double z );
+static long SelectCell( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                        const double z, FILE *File, double *Table );
+static int  GetLabel( const char **Label );
+static void Pack_Table( const long Row0, const long NRowPack, char *Buf );
+
+// table of the selected cells and number of columns for Output_DumpData_Part_Binary()
+static double *Part_Table = NULL;
+static int     Part_NCol  = 0;
 
 
 
@@ -36,6 +47,135 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ...\n", __FUNCTION__, DumpID );
 
 
+// check the input parameters and synchronization
+   CheckPart( Part, x, y, z );
+
+
+// check if the file already exists
+   if ( MPI_Rank == 0 )
+   {
+      if ( Aux_CheckFileExist(FileName) )
+      {
+         Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+         FILE *Temp = fopen( FileName, "w" );
+         fclose( Temp );
+      }
+   }
+
+
+   for (int TargetMPIRank=0; TargetMPIRank<MPI_NRank; TargetMPIRank++)
+   {
+      if ( MPI_Rank == TargetMPIRank )
+      {
+         FILE *File = fopen( FileName, "a" );
+
+//       output header
+         if ( TargetMPIRank == 0 )
+         {
+            fprintf( File, "#%10s %10s %10s %20s %20s %20s", "i", "j", "k", "x", "y", "z" );
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            fprintf( File, "%14s", FieldLabel[v] );
+
+#           ifdef MHD
+            for (int v=0; v<NCOMP_MAG; v++)
+            fprintf( File, "%14s", MagLabel[v] );
+
+            fprintf( File, "%14s", "MagEngy" );
+#           endif
+
+#           ifdef GRAVITY
+            if ( OPT__OUTPUT_POT )
+            fprintf( File, "%14s", PotLabel );
+#           endif
+
+//          other derived fields
+#           if ( MODEL == HYDRO )
+            fprintf( File, "%14s", "Pressure" );
+#           endif
+
+            fprintf( File, "\n" );
+         } // if ( TargetMPIRank == 0 )
+
+
+//       output data
+         SelectCell( Part, BaseOnly, x, y, z, File, NULL );
+
+         fclose( File );
+
+      } // if ( MPI_Rank == TargetMPIRank )
+
+      MPI_Barrier( MPI_COMM_WORLD );
+
+   } // for (int TargetMPIRank=0; TargetMPIRank<MPI_NRank; TargetMPIRank++)
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+
+} // FUNCTION : Output_DumpData_Part
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_DumpData_Part_Binary
+// Description :  Binary counterpart of Output_DumpData_Part()
+//
+// Note        :  1. Used for the runtime option "OPT__OUTPUT_PART" when "OPT__OUTPUT_TEXT_BINARY" is on
+//                2. Select the same cells and output the same columns as Output_DumpData_Part()
+//                   --> But all columns, including the cell indices, are stored in double precision
+//                3. All ranks write to a single file in parallel by Output_BinaryTable()
+//                   --> See Output_BinaryTable() for the file layout
+//
+// Parameter   :  See Output_DumpData_Part()
+//-------------------------------------------------------------------------------------------------------
+void Output_DumpData_Part_Binary( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                                  const double z, const char *FileName )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ...\n", __FUNCTION__, DumpID );
+
+
+// check the input parameters and synchronization
+   CheckPart( Part, x, y, z );
+
+
+// collect the target cells
+   Part_NCol = GetLabel( NULL );
+
+   const char **Label = new const char* [Part_NCol];
+   const long   NRow  = SelectCell( Part, BaseOnly, x, y, z, NULL, NULL );
+
+   GetLabel( Label );
+
+   Part_Table = new double [ NRow*Part_NCol + 1 ];
+
+   SelectCell( Part, BaseOnly, x, y, z, NULL, Part_Table );
+
+
+// write the file
+   Output_BinaryTable( FileName, Part_NCol, Label, sizeof(double), NRow, Pack_Table );
+
+
+   delete [] Label;
+   delete [] Part_Table;
+   Part_Table = NULL;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+
+} // FUNCTION : Output_DumpData_Part_Binary
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckPart
+// Description :  Check the input parameters of Output_DumpData_Part() and Output_DumpData_Part_Binary()
+//
+// Parameter   :  See Output_DumpData_Part()
+//-------------------------------------------------------------------------------------------------------
+void CheckPart( const OptOutputPart_t Part, const double x, const double y, const double z )
+{
+
 // check the input parameters
    if ( Part != OUTPUT_XY  &&  Part != OUTPUT_YZ  &&  Part != OUTPUT_XZ  &&
         Part != OUTPUT_X   &&  Part != OUTPUT_Y   &&  Part != OUTPUT_Z   &&  Part != OUTPUT_DIAG )
@@ -61,21 +201,29 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
    for (int lv=1; lv<NLEVEL; lv++)
       if ( NPatchTotal[lv] != 0 )   Mis_CompareRealValue( Time[0], Time[lv], __FUNCTION__, true );
 
+} // FUNCTION : CheckPart
 
-// check if the file already exists
-   if ( MPI_Rank == 0 )
-   {
-      if ( Aux_CheckFileExist(FileName) )
-      {
-         Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
 
-         FILE *Temp = fopen( FileName, "w" );
-         fclose( Temp );
-      }
-   }
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SelectCell
+// Description :  Find the cells on the target slice/line in this rank
+//
+// Note        :  1. Write each cell to File if File != NULL
+//                2. Store each cell in Table[NCell][Part_NCol] if Table != NULL
+//
+// Parameter   :  Part/BaseOnly/x/y/z : See Output_DumpData_Part()
+//                File                : Output file (or NULL)
+//                Table               : Output table (or NULL)
+//
+// Return      :  Number of the selected cells
+//-------------------------------------------------------------------------------------------------------
+long SelectCell( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                 const double z, FILE *File, double *Table )
+{
 
    const double dh_min = amr->dh[NLEVEL-1];
+   long         NCell  = 0;
    const int    NLv    = ( BaseOnly ) ? 1 : NLEVEL;
 
    int     ii, jj, kk, scale;
@@ -101,109 +249,144 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
    }
 
 
-   for (int TargetMPIRank=0; TargetMPIRank<MPI_NRank; TargetMPIRank++)
+   for (int lv=0; lv<NLv; lv++)
    {
-      if ( MPI_Rank == TargetMPIRank )
-      {
-         FILE *File = fopen( FileName, "a" );
+      dh    = amr->dh   [lv];
+      scale = amr->scale[lv];
 
-//       output header
-         if ( TargetMPIRank == 0 )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+//             output the patch data only if it has no son (if the option "BaseOnly" is turned off)
+         if ( amr->patch[0][lv][PID]->son == -1  ||  BaseOnly )
          {
-            fprintf( File, "#%10s %10s %10s %20s %20s %20s", "i", "j", "k", "x", "y", "z" );
+            Corner = amr->patch[0][lv][PID]->corner;
+            EdgeL  = amr->patch[0][lv][PID]->EdgeL;
+            EdgeR  = amr->patch[0][lv][PID]->EdgeR;
 
-            for (int v=0; v<NCOMP_TOTAL; v++)
-            fprintf( File, "%14s", FieldLabel[v] );
+            if ( Part == OUTPUT_DIAG ) // (+1,+1,+1) diagonal
+            {
+               if ( Corner[0] == Corner[1]  &&  Corner[0] == Corner[2] )
+               {
+                  for (int k=0; k<PS1; k++)
+                  {
+                     kk = Corner[2] + k*scale;
 
-#           ifdef MHD
-            for (int v=0; v<NCOMP_MAG; v++)
-            fprintf( File, "%14s", MagLabel[v] );
+                     if ( File  != NULL )    WriteFile( File, lv, PID, k, k, k, kk, kk, kk );
+                     if ( Table != NULL )    FillRow( Table+NCell*Part_NCol, lv, PID, k, k, k, kk, kk, kk );
+                     NCell ++;
+                  }
+               }
+            } // if ( Part == OUTPUT_DIAG )
 
-            fprintf( File, "%14s", "MagEngy" );
-#           endif
 
-#           ifdef GRAVITY
-            if ( OPT__OUTPUT_POT )
-            fprintf( File, "%14s", PotLabel );
-#           endif
+            else // x/y/z lines || xy/yz/xz slices
+            {
+//                   check whether the patch corner is within the target range
+               if (  !Check_x  ||  ( EdgeL[0]<=x && EdgeR[0]>x )  )
+               if (  !Check_y  ||  ( EdgeL[1]<=y && EdgeR[1]>y )  )
+               if (  !Check_z  ||  ( EdgeL[2]<=z && EdgeR[2]>z )  )
+               {
+//                      check whether the cell is within the target range
+                  for (int k=0; k<PS1; k++)  {  kk = Corner[2] + k*scale;  zz = kk*dh_min;
+                                                if ( Check_z && ( zz>z || zz+dh<=z ) )    continue;
 
-//          other derived fields
-#           if ( MODEL == HYDRO )
-            fprintf( File, "%14s", "Pressure" );
-#           endif
+                  for (int j=0; j<PS1; j++)  {  jj = Corner[1] + j*scale;  yy = jj*dh_min;
+                                                if ( Check_y && ( yy>y || yy+dh<=y ) )    continue;
 
-            fprintf( File, "\n" );
-         } // if ( TargetMPIRank == 0 )
+                  for (int i=0; i<PS1; i++)  {  ii = Corner[0] + i*scale;  xx = ii*dh_min;
+                                                if ( Check_x && ( xx>x || xx+dh<=x ) )    continue;
 
+                     if ( File  != NULL )    WriteFile( File, lv, PID, i, j, k, ii, jj, kk );
+                     if ( Table != NULL )    FillRow( Table+NCell*Part_NCol, lv, PID, i, j, k, ii, jj, kk );
+                     NCell ++;
 
-//       output data
-         for (int lv=0; lv<NLv; lv++)
-         {
-            dh    = amr->dh   [lv];
-            scale = amr->scale[lv];
+                  }}}
+               } // if patch corner is within the target range
 
-            for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-            {
-//             output the patch data only if it has no son (if the option "BaseOnly" is turned off)
-               if ( amr->patch[0][lv][PID]->son == -1  ||  BaseOnly )
-               {
-                  Corner = amr->patch[0][lv][PID]->corner;
-                  EdgeL  = amr->patch[0][lv][PID]->EdgeL;
-                  EdgeR  = amr->patch[0][lv][PID]->EdgeR;
+            } // if ( Part == OUTPUT_DIAG ... else ... )
+         } // if ( amr->patch[0][lv][PID]->son == -1 )
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   } // for (int lv=0; lv<NLv; lv++)
 
-                  if ( Part == OUTPUT_DIAG ) // (+1,+1,+1) diagonal
-                  {
-                     if ( Corner[0] == Corner[1]  &&  Corner[0] == Corner[2] )
-                     {
-                        for (int k=0; k<PS1; k++)
-                        {
-                           kk = Corner[2] + k*scale;
 
-                           WriteFile( File, lv, PID, k, k, k, kk, kk, kk );
-                        }
-                     }
-                  } // if ( Part == OUTPUT_DIAG )
+   return NCell;
 
+} // FUNCTION : SelectCell
 
-                  else // x/y/z lines || xy/yz/xz slices
-                  {
-//                   check whether the patch corner is within the target range
-                     if (  !Check_x  ||  ( EdgeL[0]<=x && EdgeR[0]>x )  )
-                     if (  !Check_y  ||  ( EdgeL[1]<=y && EdgeR[1]>y )  )
-                     if (  !Check_z  ||  ( EdgeL[2]<=z && EdgeR[2]>z )  )
-                     {
-//                      check whether the cell is within the target range
-                        for (int k=0; k<PS1; k++)  {  kk = Corner[2] + k*scale;  zz = kk*dh_min;
-                                                      if ( Check_z && ( zz>z || zz+dh<=z ) )    continue;
 
-                        for (int j=0; j<PS1; j++)  {  jj = Corner[1] + j*scale;  yy = jj*dh_min;
-                                                      if ( Check_y && ( yy>y || yy+dh<=y ) )    continue;
 
-                        for (int i=0; i<PS1; i++)  {  ii = Corner[0] + i*scale;  xx = ii*dh_min;
-                                                      if ( Check_x && ( xx>x || xx+dh<=x ) )    continue;
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLabel
+// Description :  Get the column labels of Output_DumpData_Part_Binary()
+//
+// Note        :  1. Must be consistent with FillRow()
+//
+// Parameter   :  Label : Array to store the column labels (or NULL)
+//
+// Return      :  Number of columns
+//-------------------------------------------------------------------------------------------------------
+int GetLabel( const char **Label )
+{
 
-                           WriteFile( File, lv, PID, i, j, k, ii, jj, kk );
+   const char *Coord[6] = { "i", "j", "k", "x", "y", "z" };
+   int NCol = 0;
 
-                        }}}
-                     } // if patch corner is within the target range
+   for (int d=0; d<6; d++)
+   {
+      if ( Label != NULL )    Label[NCol] = Coord[d];
+      NCol ++;
+   }
 
-                  } // if ( Part == OUTPUT_DIAG ... else ... )
-               } // if ( amr->patch[0][lv][PID]->son == -1 )
-            } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-         } // for (int lv=0; lv<NLv; lv++)
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      if ( Label != NULL )    Label[NCol] = FieldLabel[v];
+      NCol ++;
+   }
 
-         fclose( File );
+#  ifdef MHD
+   for (int v=0; v<NCOMP_MAG; v++)
+   {
+      if ( Label != NULL )    Label[NCol] = MagLabel[v];
+      NCol ++;
+   }
 
-      } // if ( MPI_Rank == TargetMPIRank )
+   if ( Label != NULL )    Label[NCol] = "MagEngy";
+   NCol ++;
+#  endif
 
-      MPI_Barrier( MPI_COMM_WORLD );
+#  ifdef GRAVITY
+   if ( OPT__OUTPUT_POT )
+   {
+      if ( Label != NULL )    Label[NCol] = PotLabel;
+      NCol ++;
+   }
+#  endif
 
-   } // for (int TargetMPIRank=0; TargetMPIRank<MPI_NRank; TargetMPIRank++)
+#  if ( MODEL == HYDRO )
+   if ( Label != NULL )    Label[NCol] = "Pressure";
+   NCol ++;
+#  endif
 
+   return NCol;
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+} // FUNCTION : GetLabel
 
-} // FUNCTION : Output_DumpData_Part
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pack_Table
+// Description :  Copy rows of Part_Table to the write buffer of Output_BinaryTable()
+//
+// Parameter   :  Row0     : First row to be copied
+//                NRowPack : Number of rows to be copied
+//                Buf      : Write buffer
+//-------------------------------------------------------------------------------------------------------
+void Pack_Table( const long Row0, const long NRowPack, char *Buf )
+{
+
+   memcpy( Buf, Part_Table+Row0*Part_NCol, NRowPack*Part_NCol*sizeof(double) );
+
+} // FUNCTION : Pack_Table
 
 
 
@@ -265,3 +448,71 @@ void WriteFile( FILE *File, const int lv, const int PID, const int i, const int
    fprintf( File, "\n" );
 
 } // FUNCTION : WriteFile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FillRow
+// Description :  Binary counterpart of WriteFile()
+//
+// Note        :  1. Must be consistent with GetLabel()
+//
+// Parameter   :  Row      : Row to be filled
+//                Others   : See WriteFile()
+//-------------------------------------------------------------------------------------------------------
+void FillRow( double *Row, const int lv, const int PID, const int i, const int j, const int k,
+              const int ii, const int jj, const int kk )
+{
+
+   const double dh_min  = amr->dh[TOP_LEVEL];
+   const double scale_2 = 0.5*amr->scale[lv];
+   int  NCol = 0;
+   real u[NCOMP_TOTAL];
+
+   for (int v=0; v<NCOMP_TOTAL; v++)   u[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
+
+// cell indices and coordinates
+   Row[ NCol ++ ] = ii;
+   Row[ NCol ++ ] = jj;
+   Row[ NCol ++ ] = kk;
+   Row[ NCol ++ ] = (ii+scale_2)*dh_min;
+   Row[ NCol ++ ] = (jj+scale_2)*dh_min;
+   Row[ NCol ++ ] = (kk+scale_2)*dh_min;
+
+// all variables in the fluid array
+   for (int v=0; v<NCOMP_TOTAL; v++)   Row[ NCol ++ ] = u[v];
+
+// magnetic field
+#  if ( MODEL == HYDRO )
+#  ifdef MHD
+   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
+   real B[3];
+   MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, amr->MagSg[lv] );
+   Row[ NCol ++ ] = B[MAGX];
+   Row[ NCol ++ ] = B[MAGY];
+   Row[ NCol ++ ] = B[MAGZ];
+   Row[ NCol ++ ] = Emag;
+#  else
+   const real Emag = NULL_REAL;
+#  endif
+#  endif // # if ( MODEL == HYDRO )
+
+// potential
+#  ifdef GRAVITY
+   if ( OPT__OUTPUT_POT )
+   Row[ NCol ++ ] = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[k][j][i];
+#  endif
+
+// other derived fields
+#  if ( MODEL == HYDRO )
+   const bool CheckMinPres_No = false;
+   Row[ NCol ++ ] = Hydro_Con2Pres( u[DENS], u[MOMX], u[MOMY], u[MOMZ], u[ENGY], u+NCOMP_FLUID,
+                                    CheckMinPres_No, NULL_REAL, Emag,
+                                    EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
+#  endif
+
+#  ifdef GAMER_DEBUG
+   if ( NCol != Part_NCol )   Aux_Error( ERROR_INFO, "NCol (%d) != Part_NCol (%d) !!\n", NCol, Part_NCol );
+#  endif
+
+} // FUNCTION : FillRow
@@ -0,0 +1,343 @@
+#ifdef SUPPORT_HDF5
+
+#include "GAMER.h"
+#include "HDF5_Typedef.h"
+
+static void WriteAttribute( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int N,
+                            const void *Data );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_DumpData_Sub_HDF5
+// Description :  Output the grid data of selected levels, fields, and region in the HDF5 format
+//
+// Note        :  1. Enabled by OUTPUT_SUB_STEP and invoked by main() every OUTPUT_SUB_STEP root-level steps
+//                   --> Lightweight output for frequent dumps (e.g., movies) independent of the regular snapshots
+//                2. Output all patches at levels OUTPUT_SUB_LV_MIN ~ OUTPUT_SUB_LV_MAX overlapping with the box
+//                   [OUTPUT_SUB_EDGEL, OUTPUT_SUB_EDGER]
+//                   --> Data of entire patches are stored (i.e., not trimmed to the box)
+//                3. Output the fluid fields specified by the bitwise mask OUTPUT_SUB_FIELD (e.g., _DENS|_ENGY)
+//                   --> Magnetic field, potential, and particles are not supported
+//                4. File structure
+//                      Sub_XXXXXXXXX (XXXXXXXXX = Step)
+//                         attributes: Time, Step, BoxSize, EdgeL, EdgeR, LvMin, LvMax, dh[NLEVEL]
+//                         /LvYY/Corner      : int  [NPatch][3] (scale indices)
+//                         /LvYY/Leaf        : int  [NPatch]    (1/0 --> leaf/non-leaf patch)
+//                         /LvYY/FieldLabel  : real [NPatch][PS1][PS1][PS1]
+//                   --> Groups and datasets are created only for levels with at least one selected patch
+//                5. All ranks write concurrently with collective MPI-IO for OPT__OUTPUT_MPIIO if HDF5 supports
+//                   parallel I/O. Otherwise ranks write one at a time as Output_DumpData_Total_HDF5().
+//-------------------------------------------------------------------------------------------------------
+void Output_DumpData_Sub_HDF5()
+{
+
+   char FileName[MAX_STRING];
+   sprintf( FileName, "Sub_%09ld", Step );
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (FileName = %s) ... ", __FUNCTION__, FileName );
+
+
+// 1. set the target fields
+   const long FieldMask = ( OUTPUT_SUB_FIELD < 0 ) ? _TOTAL : OUTPUT_SUB_FIELD;
+
+   int NField = 0, FieldIdx[NCOMP_TOTAL];
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+      if ( FieldMask & (1L<<v) )    FieldIdx[ NField ++ ] = v;
+
+
+// 2. select the patches overlapping with the target box at each level
+   const int LvMin = OUTPUT_SUB_LV_MIN;
+   const int LvMax = MIN( OUTPUT_SUB_LV_MAX, NLEVEL-1 );
+
+   int  NSel_ThisRank[NLEVEL];
+   int *SelPID       [NLEVEL];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NSel_ThisRank[lv] = 0;
+      SelPID       [lv] = NULL;
+
+      if ( lv < LvMin  ||  lv > LvMax )   continue;
+
+      SelPID[lv] = new int [ amr->NPatchComma[lv][1] ];
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         const patch_t *Patch = amr->patch[0][lv][PID];
+         bool Overlap = true;
+
+         for (int d=0; d<3; d++)
+            if ( Patch->EdgeR[d] <= OUTPUT_SUB_EDGEL[d]  ||  Patch->EdgeL[d] >= OUTPUT_SUB_EDGER[d] )   Overlap = false;
+
+         if ( Overlap )    SelPID[lv][ NSel_ThisRank[lv] ++ ] = PID;
+      }
+   }
+
+
+// 3. get the offset of this rank and the total number of selected patches at each level
+   int *NSel_AllRank = new int [ MPI_NRank*NLEVEL ];
+   int  NSel_Offset[NLEVEL], NSel_Total[NLEVEL];
+
+   MPI_Allgather( NSel_ThisRank, NLEVEL, MPI_INT, NSel_AllRank, NLEVEL, MPI_INT, MPI_COMM_WORLD );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NSel_Offset[lv] = 0;
+      NSel_Total [lv] = 0;
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         if ( r < MPI_Rank )  NSel_Offset[lv] += NSel_AllRank[ r*NLEVEL + lv ];
+         NSel_Total[lv] += NSel_AllRank[ r*NLEVEL + lv ];
+      }
+   }
+
+   delete [] NSel_AllRank;
+
+
+// 4. set the file-access and data-transfer property lists
+   hid_t  H5_FileAccPropList  = H5P_DEFAULT;
+   hid_t  H5_DataXferPropList = H5P_DEFAULT;
+   herr_t H5_Status;
+
+#  ifdef H5_HAVE_PARALLEL
+   const bool MPIIO = OPT__OUTPUT_MPIIO;
+
+   if ( MPIIO )
+   {
+      H5_FileAccPropList  = H5Pcreate( H5P_FILE_ACCESS );
+      H5_Status           = H5Pset_fapl_mpio( H5_FileAccPropList, MPI_COMM_WORLD, MPI_INFO_NULL );
+      H5_DataXferPropList = H5Pcreate( H5P_DATASET_XFER );
+      H5_Status           = H5Pset_dxpl_mpio( H5_DataXferPropList, H5FD_MPIO_COLLECTIVE );
+   }
+#  else
+   const bool MPIIO = false;
+#  endif
+
+   const int NWriteRound = ( MPIIO ) ? 1 : MPI_NRank;
+
+
+// 5. create the file, attributes, and datasets (by rank 0 only)
+   if ( MPI_Rank == 0 )
+   {
+      const hid_t H5_FileID = H5Fcreate( FileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to create the HDF5 file \"%s\" !!\n", FileName );
+
+      const double Time0 = Time[0];
+
+      WriteAttribute( H5_FileID, "Time",    H5T_NATIVE_DOUBLE, 1,      &Time0            );
+      WriteAttribute( H5_FileID, "Step",    H5T_NATIVE_LONG,   1,      &Step             );
+      WriteAttribute( H5_FileID, "BoxSize", H5T_NATIVE_DOUBLE, 3,       amr->BoxSize     );
+      WriteAttribute( H5_FileID, "EdgeL",   H5T_NATIVE_DOUBLE, 3,       OUTPUT_SUB_EDGEL );
+      WriteAttribute( H5_FileID, "EdgeR",   H5T_NATIVE_DOUBLE, 3,       OUTPUT_SUB_EDGER );
+      WriteAttribute( H5_FileID, "LvMin",   H5T_NATIVE_INT,    1,      &LvMin            );
+      WriteAttribute( H5_FileID, "LvMax",   H5T_NATIVE_INT,    1,      &LvMax            );
+      WriteAttribute( H5_FileID, "dh",      H5T_NATIVE_DOUBLE, NLEVEL,  amr->dh          );
+
+      for (int lv=LvMin; lv<=LvMax; lv++)
+      {
+         if ( NSel_Total[lv] == 0 )    continue;
+
+         char GroupName[MAX_STRING];
+         sprintf( GroupName, "Lv%02d", lv );
+
+         const hid_t H5_GroupID = H5Gcreate( H5_FileID, GroupName, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", GroupName );
+
+         const hsize_t H5_Dims_Cr   [2] = { (hsize_t)NSel_Total[lv], 3 };
+         const hsize_t H5_Dims_Leaf [1] = { (hsize_t)NSel_Total[lv] };
+         const hsize_t H5_Dims_Field[4] = { (hsize_t)NSel_Total[lv], PS1, PS1, PS1 };
+
+         const hid_t H5_SpaceID_Cr    = H5Screate_simple( 2, H5_Dims_Cr,    NULL );
+         const hid_t H5_SpaceID_Leaf  = H5Screate_simple( 1, H5_Dims_Leaf,  NULL );
+         const hid_t H5_SpaceID_Field = H5Screate_simple( 4, H5_Dims_Field, NULL );
+
+         hid_t H5_SetID;
+
+         H5_SetID  = H5Dcreate( H5_GroupID, "Corner", H5T_NATIVE_INT, H5_SpaceID_Cr, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Corner" );
+         H5_Status = H5Dclose( H5_SetID );
+
+         H5_SetID  = H5Dcreate( H5_GroupID, "Leaf", H5T_NATIVE_INT, H5_SpaceID_Leaf, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Leaf" );
+         H5_Status = H5Dclose( H5_SetID );
+
+         for (int f=0; f<NField; f++)
+         {
+            H5_SetID  = H5Dcreate( H5_GroupID, FieldLabel[ FieldIdx[f] ], H5T_GAMER_REAL, H5_SpaceID_Field,
+                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+            if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldLabel[ FieldIdx[f] ] );
+            H5_Status = H5Dclose( H5_SetID );
+         }
+
+         H5_Status = H5Sclose( H5_SpaceID_Cr );
+         H5_Status = H5Sclose( H5_SpaceID_Leaf );
+         H5_Status = H5Sclose( H5_SpaceID_Field );
+         H5_Status = H5Gclose( H5_GroupID );
+      } // for (int lv=LvMin; lv<=LvMax; lv++)
+
+      H5_Status = H5Fclose( H5_FileID );
+   } // if ( MPI_Rank == 0 )
+
+
+// 6. write data level by level
+   real *FieldBuf = NULL;
+   int  *CrBuf    = NULL;
+   int  *LeafBuf  = NULL;
+
+   for (int lv=LvMin; lv<=LvMax; lv++)
+   {
+      if ( NSel_Total[lv] == 0 )    continue;
+
+      const int NSel = NSel_ThisRank[lv];
+
+//    6-1. prepare the corner and leaf tables
+      CrBuf    = new int  [ 3*NSel ];
+      LeafBuf  = new int  [   NSel ];
+      FieldBuf = new real [ NSel*CUBE(PS1) ];
+
+      for (int t=0; t<NSel; t++)
+      {
+         const patch_t *Patch = amr->patch[0][lv][ SelPID[lv][t] ];
+
+         for (int d=0; d<3; d++)    CrBuf[ 3*t + d ] = Patch->corner[d];
+
+         LeafBuf[t] = ( Patch->son == -1 );
+      }
+
+      char GroupName[MAX_STRING];
+      sprintf( GroupName, "Lv%02d", lv );
+
+//    6-2. write data by one rank at a time (or by all ranks at once for MPIIO)
+      if ( MPIIO )   MPI_Barrier( MPI_COMM_WORLD );
+
+      for (int TRank=0; TRank<NWriteRound; TRank++)
+      {
+         if ( MPIIO  ||  MPI_Rank == TRank )
+         {
+            if ( !MPIIO )  SyncHDF5File( FileName );
+
+            const hid_t H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+            const hid_t H5_GroupID = H5Gopen( H5_FileID, GroupName, H5P_DEFAULT );
+            if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", GroupName );
+
+            const hsize_t H5_Offset[4] = { (hsize_t)NSel_Offset[lv], 0, 0, 0 };
+            const hsize_t H5_Count [4] = { (hsize_t)NSel, 3, PS1, PS1 };
+            const hsize_t H5_MemDims_Cr   [2] = { (hsize_t)MAX( NSel, 1 ), 3 };
+            const hsize_t H5_MemDims_Leaf [1] = { (hsize_t)MAX( NSel, 1 ) };
+            const hsize_t H5_MemDims_Field[4] = { (hsize_t)MAX( NSel, 1 ), PS1, PS1, PS1 };
+                  hsize_t H5_Count_Field  [4] = { (hsize_t)NSel, PS1, PS1, PS1 };
+
+            hid_t H5_SetID, H5_SpaceID_File, H5_SpaceID_Mem;
+
+//          empty selections are required for the collective I/O of ranks without any selected patch
+//          corner
+            H5_SetID        = H5Dopen( H5_GroupID, "Corner", H5P_DEFAULT );
+            H5_SpaceID_File = H5Dget_space( H5_SetID );
+            H5_SpaceID_Mem  = H5Screate_simple( 2, H5_MemDims_Cr, NULL );
+            if ( NSel > 0 )   H5_Status = H5Sselect_hyperslab( H5_SpaceID_File, H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+            else            { H5_Status = H5Sselect_none( H5_SpaceID_File );  H5_Status = H5Sselect_none( H5_SpaceID_Mem ); }
+            H5_Status = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5_SpaceID_Mem, H5_SpaceID_File, H5_DataXferPropList, CrBuf );
+            if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" (lv %d) !!\n", "Corner", lv );
+            H5_Status = H5Sclose( H5_SpaceID_Mem );
+            H5_Status = H5Sclose( H5_SpaceID_File );
+            H5_Status = H5Dclose( H5_SetID );
+
+//          leaf flag
+            H5_SetID        = H5Dopen( H5_GroupID, "Leaf", H5P_DEFAULT );
+            H5_SpaceID_File = H5Dget_space( H5_SetID );
+            H5_SpaceID_Mem  = H5Screate_simple( 1, H5_MemDims_Leaf, NULL );
+            if ( NSel > 0 )   H5_Status = H5Sselect_hyperslab( H5_SpaceID_File, H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+            else            { H5_Status = H5Sselect_none( H5_SpaceID_File );  H5_Status = H5Sselect_none( H5_SpaceID_Mem ); }
+            H5_Status = H5Dwrite( H5_SetID, H5T_NATIVE_INT, H5_SpaceID_Mem, H5_SpaceID_File, H5_DataXferPropList, LeafBuf );
+            if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" (lv %d) !!\n", "Leaf", lv );
+            H5_Status = H5Sclose( H5_SpaceID_Mem );
+            H5_Status = H5Sclose( H5_SpaceID_File );
+            H5_Status = H5Dclose( H5_SetID );
+
+//          fields
+            for (int f=0; f<NField; f++)
+            {
+               const int v = FieldIdx[f];
+
+               for (int t=0; t<NSel; t++)
+                  memcpy( FieldBuf + t*CUBE(PS1), amr->patch[ amr->FluSg[lv] ][lv][ SelPID[lv][t] ]->fluid[v],
+                          CUBE(PS1)*sizeof(real) );
+
+               H5_SetID        = H5Dopen( H5_GroupID, FieldLabel[v], H5P_DEFAULT );
+               H5_SpaceID_File = H5Dget_space( H5_SetID );
+               H5_SpaceID_Mem  = H5Screate_simple( 4, H5_MemDims_Field, NULL );
+               if ( NSel > 0 )   H5_Status = H5Sselect_hyperslab( H5_SpaceID_File, H5S_SELECT_SET, H5_Offset, NULL, H5_Count_Field, NULL );
+               else            { H5_Status = H5Sselect_none( H5_SpaceID_File );  H5_Status = H5Sselect_none( H5_SpaceID_Mem ); }
+               H5_Status = H5Dwrite( H5_SetID, H5T_GAMER_REAL, H5_SpaceID_Mem, H5_SpaceID_File, H5_DataXferPropList, FieldBuf );
+               if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" (lv %d) !!\n", FieldLabel[v], lv );
+               H5_Status = H5Sclose( H5_SpaceID_Mem );
+               H5_Status = H5Sclose( H5_SpaceID_File );
+               H5_Status = H5Dclose( H5_SetID );
+            }
+
+            H5_Status = H5Gclose( H5_GroupID );
+            H5_Status = H5Fclose( H5_FileID );
+         } // if ( MPIIO  ||  MPI_Rank == TRank )
+
+         if ( !MPIIO )  MPI_Barrier( MPI_COMM_WORLD );
+      } // for (int TRank=0; TRank<NWriteRound; TRank++)
+
+      delete [] CrBuf;
+      delete [] LeafBuf;
+      delete [] FieldBuf;
+   } // for (int lv=LvMin; lv<=LvMax; lv++)
+
+
+// 7. free resources
+   for (int lv=0; lv<NLEVEL; lv++)  delete [] SelPID[lv];
+
+#  ifdef H5_HAVE_PARALLEL
+   if ( MPIIO )
+   {
+      H5_Status = H5Pclose( H5_FileAccPropList );
+      H5_Status = H5Pclose( H5_DataXferPropList );
+   }
+#  endif
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Output_DumpData_Sub_HDF5
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteAttribute
+// Description :  Write a 1D attribute to the target HDF5 object
+//
+// Parameter   :  H5_LocID  : Target HDF5 object
+//                Name      : Attribute name
+//                H5_TypeID : HDF5 datatype
+//                N         : Number of elements
+//                Data      : Attribute data
+//-------------------------------------------------------------------------------------------------------
+void WriteAttribute( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int N, const void *Data )
+{
+
+   const hsize_t H5_Dims   = N;
+   const hid_t   H5_Space  = H5Screate_simple( 1, &H5_Dims, NULL );
+   const hid_t   H5_AttrID = H5Acreate( H5_LocID, Name, H5_TypeID, H5_Space, H5P_DEFAULT, H5P_DEFAULT );
+
+   if ( H5_AttrID < 0 )    Aux_Error( ERROR_INFO, "failed to create the attribute \"%s\" !!\n", Name );
+
+   if ( H5Awrite( H5_AttrID, H5_TypeID, Data ) < 0 )
+      Aux_Error( ERROR_INFO, "failed to write the attribute \"%s\" !!\n", Name );
+
+   H5Aclose( H5_AttrID );
+   H5Sclose( H5_Space );
+
+} // FUNCTION : WriteAttribute
+
+
+
+#endif // #ifdef SUPPORT_HDF5
@@ -16,11 +16,15 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total (FormatVersion = 2220)
+// Function    :  Output_DumpData_Total (FormatVersion = 2230)
 // Description :  Output all simulation data in the binary form, which can be used as a restart file
 //
 // Note        :  1. This output format is deprecated and is mainly used for debugging only
 //                   --> Use HDF5 format instead (OPT__OUTPUT_TOTAL = 1)
+//                2. The file offset of the patch data at each level and a patch index storing the corner and son
+//                   of all patches are recorded so that Init_ByRestart() can locate the patches of each rank
+//                   without scanning the patch data
+//                   --> The patch index is appended after the particle data
 //
 // Parameter   :  FileName : Name of the output file
 //
@@ -38,6 +42,7 @@ Procedure for outputting new variables:
 //                2203 : 2018/12/27 --> replace GRA_BLOCK_SIZE_Z by GRA_BLOCK_SIZE
 //                2210 : 2019/06/07 --> support MHD
 //                2220 : 2020/08/25 --> output EOS
+//                2230 : 2026/10/15 --> output FileOffset_Level[] and FileOffset_PatchIdx and append the patch index
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total( const char *FileName )
 {
@@ -91,6 +96,7 @@ void Output_DumpData_Total( const char *FileName )
 
    FILE *File = NULL;
    long ExpectFileSize;
+   long FileOffset_Level[NLEVEL], FileOffset_PatchIdx;
 #  ifdef PARTICLE
    long FileOffset_Particle;
 #  endif
@@ -166,23 +172,30 @@ void Output_DumpData_Total( const char *FileName )
 
       for (int lv=0; lv<NLEVEL; lv++)
       {
+         FileOffset_Level[lv] = ExpectFileSize;    // file offset at the beginning of the patch data at lv
+
          ExpectFileSize += (long)NPatchTotal[lv]*4*sizeof(int);      // 4 = corner(3) + son(1)
          ExpectFileSize += (long)NDataPatch_Total[lv]*PatchDataSize;
+#        ifdef PARTICLE
+         ExpectFileSize += (long)NDataPatch_Total[lv]*2*sizeof(long);   // 2 = NPar + starting particle index (leaf patches only)
+#        endif
       }
 
 #     ifdef PARTICLE
-      for (int lv=0; lv<NLEVEL; lv++)
-         ExpectFileSize += (long)NDataPatch_Total[lv]*2*sizeof(long);   // 2 = NPar + starting particle index (leaf patches only)
-
       FileOffset_Particle = ExpectFileSize;  // file offset at the beginning of particle data
 
       ExpectFileSize += (long)PAR_NATT_STORED*amr->Par->NPar_Active_AllRank*sizeof(real);
 #     endif
 
+      FileOffset_PatchIdx = ExpectFileSize;  // file offset at the beginning of the patch index
+
+      for (int lv=0; lv<NLEVEL; lv++)
+         ExpectFileSize += (long)NPatchTotal[lv]*4*sizeof(int);      // 4 = corner(3) + son(1)
+
 
 //    a. output the information of data format
 //    =================================================================================================
-      const long FormatVersion = 2220;
+      const long FormatVersion = 2230;
       const long CheckCode     = 123456789;
 
       fseek( File, HeaderOffset_Format, SEEK_SET );
@@ -382,7 +395,7 @@ void Output_DumpData_Total( const char *FileName )
 #     endif
 
       const int nlevel               = NLEVEL;
-      const int max_patch            = MAX_PATCH;
+      const int max_patch            = NULL_INT;   // no longer a compile-time limit (see PatchTable.h)
 
       fwrite( &model,                     sizeof(int),                     1,             File );
       fwrite( &gravity,                   sizeof(bool),                    1,             File );
@@ -735,6 +748,8 @@ void Output_DumpData_Total( const char *FileName )
       fwrite( &NParAllRank,               sizeof(long),                    1,             File );
       fwrite( &FileOffset_Particle,       sizeof(long),                    1,             File );
       fwrite( dTime_AllLv,                sizeof(double),             NLEVEL,             File );
+      fwrite( FileOffset_Level,           sizeof(long),               NLEVEL,             File );
+      fwrite( &FileOffset_PatchIdx,       sizeof(long),                    1,             File );
 
 
 //    move the file position indicator to the end of the header ==> prepare to output patch data
@@ -784,7 +799,7 @@ void Output_DumpData_Total( const char *FileName )
 #     ifdef PARTICLE
       if ( OPT__OUTPUT_PAR_DENS != PAR_OUTPUT_DENS_NONE )
       {
-         Prepare_PatchData_InitParticleDensityArray( lv );
+         Prepare_PatchData_InitParticleDensityArray( lv, PredictParPos_No, Time[lv] );
 
          Par_CollectParticle2OneLevel( lv, PredictParPos_No, NULL_REAL, SibBufPatch, FaSibBufPatch, JustCountNPar_No,
                                        TimingSendPar_No );
@@ -1005,6 +1020,36 @@ void Output_DumpData_Total( const char *FileName )
 #  endif // #ifdef PARTICLE
 
 
+// h. output the patch index (i.e., the corner and son of all patches in the same order as the patch data)
+// =================================================================================================
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      int *PatchIdxBuf = new int [ 4*amr->NPatchComma[lv][1] ];
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         PatchIdxBuf[ 4*PID + 0 ] = amr->patch[0][lv][PID]->corner[0];
+         PatchIdxBuf[ 4*PID + 1 ] = amr->patch[0][lv][PID]->corner[1];
+         PatchIdxBuf[ 4*PID + 2 ] = amr->patch[0][lv][PID]->corner[2];
+         PatchIdxBuf[ 4*PID + 3 ] = amr->patch[0][lv][PID]->son;
+      }
+
+      for (int TargetMPIRank=0; TargetMPIRank<MPI_NRank; TargetMPIRank++)
+      {
+         if ( MPI_Rank == TargetMPIRank )
+         {
+            File = fopen( FileName, "ab" );
+            fwrite( PatchIdxBuf, sizeof(int), 4*amr->NPatchComma[lv][1], File );
+            fclose( File );
+         }
+
+         MPI_Barrier( MPI_COMM_WORLD );
+      }
+
+      delete [] PatchIdxBuf;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
 // check the file size
    if ( MPI_Rank == 0 )
    {
@@ -2,6 +2,7 @@
 
 #include "GAMER.h"
 #include "HDF5_Typedef.h"
+#include "SnapshotIndex_Typedef.h"
 #include <ctime>
 
 void FillIn_KeyInfo  (   KeyInfo_t &KeyInfo   );
@@ -13,6 +14,11 @@ static void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
 static void GetCompound_Makefile ( hid_t &H5_TypeID );
 static void GetCompound_SymConst ( hid_t &H5_TypeID );
 static void GetCompound_InputPara( hid_t &H5_TypeID );
+static long GetDatasetOffset( const hid_t H5_SetID, const char *SetName );
+static hid_t GetCompressPropList( const int NDim, const hsize_t ChunkDims[] );
+static void WriteSnapshotIndex( const char *FileName, const int NField, const char (*FieldName)[MAX_STRING],
+                                const long *LBIdxList, const int (*CrList)[3], const int GID_LvStart[] );
+static long GetMortonKey( const int lv, const int Corner[] );
 
 
 
@@ -69,7 +75,7 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2417)
+// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2418)
 // Description :  Output all simulation data in the HDF5 format, which can be used as a restart file
 //                or loaded by YT
 //
@@ -106,6 +112,28 @@ Procedure for outputting new variables:
 //                        --> Currently we store different attributes in separate datasets
 //                        --> Particles are stored in the order of their associated GIDs as well, but the order of
 //                            particles in the same patch is not specified
+//                11. For OPT__OUTPUT_MPIIO, all ranks write the grid and particle data concurrently by collective
+//                    MPI-IO (H5Pset_fapl_mpio() and H5FD_MPIO_COLLECTIVE) instead of one rank at a time
+//                    --> Rank r writes to the offset given by the prefix sum of NPatchComma[lv][1] (and NPar_Lv[lv])
+//                        over ranks < r, and thus the file layout is identical to the rank-by-rank output
+//                    --> The file info and tree are still written by rank 0 alone
+//                    --> Require HDF5 built with parallel support (i.e., H5_HAVE_PARALLEL). Otherwise the
+//                        rank-by-rank output is adopted.
+//                12. For OPT__OUTPUT_ASYNC, the grid and particle data are copied to staging buffers and written by
+//                    a background I/O thread (see Output_AsyncWriter.cpp) while the simulation continues
+//                    --> Rank 0 creates the datasets with H5D_ALLOC_TIME_EARLY and broadcasts their file offsets
+//                        so that each rank can write its data as raw bytes without reopening the file by HDF5
+//                    --> The file info and tree are still written synchronously by rank 0
+//                    --> This function first waits for the previous snapshot to be completed
+//                13. For OPT__OUTPUT_COMPRESS > 0, the grid and particle datasets are chunked and compressed by
+//                    deflate (optionally preceded by shuffle)
+//                    --> Chunk size = OPT__OUTPUT_CHUNK_NPATCH patches for the grid data and the same number of
+//                        elements for the particle data
+//                    --> Decompression is done transparently by HDF5 when reading (e.g., Init_ByRestart_HDF5())
+//                    --> The tree datasets are not compressed
+//                14. For OPT__OUTPUT_INDEX, rank 0 writes a sidecar index "FileName.idx" (see WriteSnapshotIndex())
+//                    --> Allow analysis tools to memory-map the snapshot and load only the patches overlapping
+//                        a query box (see tool/analysis/gamer_snapshot_index)
 //
 // Parameter   :  FileName : Name of the output file
 //
@@ -187,6 +215,26 @@ Procedure for outputting new variables:
 //                2415 : 2020/09/08 --> output OPT__LAST_RESORT_FLOOR
 //                2416 : 2020/09/08 --> output BAROTROPIC_EOS
 //                2417 : 2020/09/09 --> output ISO_TEMP
+//                2418 : 2026/10/14 --> output MIXED_PRECISION, OPT__DT_FLU_BYPRODUCT, OPT__GHOST_CACHE,
+//                                      OPT__INT_TIME_LAZY, OPT__REGRID_LAZY, LB_INPUT__MEASURED_COST,
+//                                      OPT__LB_INCREMENTAL, OPT__LB_COUPLE_LEVEL, LBCurve in KeyInfo_t,
+//                                      OPT__LB_DERIVED_TYPE, PAR_COMPRESS_MPI, OPT__LB_DIST_GRAPH, OPT__FFT_PENCIL,
+//                                      SOR_TOLERATED_ERROR, OPT__POT_WARM_START, OPT__RECORD_POI_ITER,
+//                                      POT_LEVEL_NSWEEP, OPT__USG_POT_EXT, EXT_POT_TABLE_NAME/NPOINT/DH/EDGEL,
+//                                      PAR_SORT_INTERVAL, PAR_DEPOSIT_NPAR_THREAD, PAR_COLLECT_CACHE, PAR_MAX_SUBCYCLE,
+//                                      PAR_SR_ACC/SOFTEN/RADIUS, PAR_FREEZE_FLU_RATIO, OPT__OUTPUT_MPIIO,
+//                                      OPT__OUTPUT_ASYNC, OPT__OUTPUT_COMPRESS/SHUFFLE/CHUNK_NPATCH, OPT__RESTART_BULK,
+//                                      OPT__CKPT_LOCAL, OPT__RESTART_LOCAL, OUTPUT_SUB_*, OPT__OUTPUT_TEXT_BINARY,
+//                                      OUTPUT_UG_*, OPT__OUTPUT_INDEX, OPT__TRACE, TRACE_NEVENT, OPT__TIMING_COUNTER,
+//                                      OPT__RECORD_TELEMETRY, OPT__RECORD_PATCH_COST, OPT__PATCH_ARENA,
+//                                      OPT__FIRST_TOUCH, INIT_SUBSAMPLING_TOL, OPT__INIT_REFINE_MAP, OPT__GFUNC_CACHE,
+//                                      OPT__DT_OPT_SUBSTEP, DT__SUBSTEP_OVERHEAD, GRACKLE_ZERO_COPY,
+//                                      GRACKLE_SCREEN_TCOOL, LB_INPUT__CHE_WEIGHT, EOS_TABLE_NAME, YT_STEP, YT_ASYNC*,
+//                                      OUTPUT_DIAG_*, OPT__RECORD_DIVB, OPT__EMAG_CACHE, OPT__MPI_PROGRESS,
+//                                      OPT__SG_ON_DEMAND, OPT__RECORD_CONSERVATION, PAR_DENS_CACHE,
+//                                      OPT__USG_FUSE_EXT_ACC, OPT__ADAPTIVE_NPGROUP, OPT__CK_FLU_OUTPUT,
+//                                      OPT__FLAG_FLU_BYPRODUCT, OPT__PREP_COST_ORDER, OPT__RECORD_LEVEL_PS, LEVEL_PS_*,
+//                                      AUTO_REDUCE_DT_LOCAL, OPT__FROZEN_REGION, and FROZEN_REGION_*
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total_HDF5( const char *FileName )
 {
@@ -199,6 +247,10 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       if ( NPatchTotal[lv] != 0 )   Mis_CompareRealValue( Time[0], Time[lv], __FUNCTION__, true );
 
 
+// wait for the previous asynchronous snapshot to be completed before staging a new one
+   if ( OPT__OUTPUT_ASYNC )   Output_Async_Wait();
+
+
 // check if the target file already exists
    if ( Aux_CheckFileExist(FileName)  &&  MPI_Rank == 0 )
       Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
@@ -261,6 +313,69 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 // 2-3. create the "scalar" dataspace
    H5_SpaceID_Scalar = H5Screate( H5S_SCALAR );
 
+// 2-4. set the file-access and data-transfer property lists for the grid and particle data
+//      --> collective MPI-IO for OPT__OUTPUT_MPIIO
+   hid_t H5_FileAccPropList  = H5P_DEFAULT;
+   hid_t H5_DataXferPropList = H5P_DEFAULT;
+
+#  ifdef H5_HAVE_PARALLEL
+   const bool MPIIO = OPT__OUTPUT_MPIIO;
+#  else
+   const bool MPIIO = false;
+
+   if ( OPT__OUTPUT_MPIIO  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : HDF5 does not support parallel I/O --> OPT__OUTPUT_MPIIO is disabled !!\n" );
+#  endif
+
+#  ifdef H5_HAVE_PARALLEL
+   if ( MPIIO )
+   {
+      H5_FileAccPropList  = H5Pcreate( H5P_FILE_ACCESS );
+      H5_Status           = H5Pset_fapl_mpio( H5_FileAccPropList, MPI_COMM_WORLD, MPI_INFO_NULL );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the MPI-IO file driver !!\n" );
+
+      H5_DataXferPropList = H5Pcreate( H5P_DATASET_XFER );
+      H5_Status           = H5Pset_dxpl_mpio( H5_DataXferPropList, H5FD_MPIO_COLLECTIVE );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the collective MPI-IO transfer mode !!\n" );
+   }
+#  endif
+
+// 2-5. allocate the grid and particle datasets at creation for OPT__OUTPUT_ASYNC so that their file offsets
+//      are known in advance
+   const bool ASYNC = OPT__OUTPUT_ASYNC;
+
+   if ( ASYNC )
+   {
+      H5_Status = H5Pset_alloc_time( H5_DataCreatePropList, H5D_ALLOC_TIME_EARLY );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the early allocation time !!\n" );
+   }
+
+// 2-6. check the compression filters for OPT__OUTPUT_COMPRESS
+   bool Compress = ( OPT__OUTPUT_COMPRESS > 0 );
+
+   if ( Compress  &&  !H5Zfilter_avail(H5Z_FILTER_DEFLATE) )
+   {
+      Compress = false;
+
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : HDF5 does not support deflate --> OPT__OUTPUT_COMPRESS is disabled !!\n" );
+   }
+
+// parallel writes to the compressed datasets require HDF5 >= 1.10.2
+#  if ( defined H5_HAVE_PARALLEL  &&  !H5_VERSION_GE( 1, 10, 2 ) )
+   if ( Compress  &&  MPIIO )
+   {
+      Compress = false;
+
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : HDF5 < 1.10.2 does not support compression with OPT__OUTPUT_MPIIO"
+                              " --> OPT__OUTPUT_COMPRESS is disabled !!\n" );
+   }
+#  endif
+
+// all ranks write at once for MPIIO and ASYNC
+   const int NWriteRound = ( MPIIO || ASYNC ) ? 1 : MPI_NRank;
+
 
 
 // 3. output the simulation information
@@ -405,7 +520,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 // sort list and get the corresponding index table (for calculating GID later)
    for (int lv=0; lv<NLEVEL; lv++)
-      Mis_Heapsort( NPatchTotal[lv], LBIdxList_Sort[lv], LBIdxList_Sort_IdxTable[lv] );
+      Mis_RadixSort( NPatchTotal[lv], LBIdxList_Sort[lv], LBIdxList_Sort_IdxTable[lv] );
 
 
 // 4-3. store the local tree
@@ -729,10 +844,13 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    char (*FieldName)[MAX_STRING]     = NULL;
    real (*FieldData)[PS1][PS1][PS1]  = NULL;
 
+   long *AsyncOffset_Field           = NULL;   // file offsets of the field datasets for ASYNC
+
 #  ifdef MHD
    const int FCMagSizeOnePatch = sizeof(real)*PS1P1*SQR(PS1);
    char FCMagName[NCOMP_MAG][MAX_STRING];
    real (*FCMagData)[PS1P1*SQR(PS1)] = NULL;
+   long AsyncOffset_FCMag[NCOMP_MAG];
 #  endif
 
 // 5-0. determine variable indices
@@ -785,6 +903,8 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 // 5-2. initialize the "GridData" group and the datasets of all fields and magnetic field
+   if ( ASYNC )   AsyncOffset_Field = new long [NFieldOut];
+
    H5_SetDims_Field[0] = NPatchAllLv;
    H5_SetDims_Field[1] = PS1;
    H5_SetDims_Field[2] = PS1;
@@ -818,12 +938,23 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_GroupID_GridData = H5Gcreate( H5_FileID, "GridData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
       if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "GridData" );
 
+//    set the chunked and compressed layout
+      hid_t H5_DataCreatePropList_Field = H5_DataCreatePropList;
+
+      if ( Compress )
+      {
+         const hsize_t ChunkDims[4] = { (hsize_t)MIN( OPT__OUTPUT_CHUNK_NPATCH, NPatchAllLv ), PS1, PS1, PS1 };
+
+         H5_DataCreatePropList_Field = GetCompressPropList( 4, ChunkDims );
+      }
+
 //    create the datasets of all fields
       for (int v=0; v<NFieldOut; v++)
       {
          H5_SetID_Field = H5Dcreate( H5_GroupID_GridData, FieldName[v], H5T_GAMER_REAL, H5_SpaceID_Field,
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_Field, H5P_DEFAULT );
          if ( H5_SetID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldName[v] );
+         if ( ASYNC )   AsyncOffset_Field[v] = GetDatasetOffset( H5_SetID_Field, FieldName[v] );
          H5_Status = H5Dclose( H5_SetID_Field );
       }
 
@@ -831,18 +962,45 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 #     ifdef MHD
       for (int v=0; v<NCOMP_MAG; v++)
       {
+         hid_t H5_DataCreatePropList_FCMag = H5_DataCreatePropList;
+
+         if ( Compress )
+         {
+            hsize_t ChunkDims[4];
+
+            ChunkDims[0] = MIN( OPT__OUTPUT_CHUNK_NPATCH, NPatchAllLv );
+            for (int t=1; t<4; t++)
+            ChunkDims[t] = ( 3-t == v ) ? PS1P1 : PS1;
+
+            H5_DataCreatePropList_FCMag = GetCompressPropList( 4, ChunkDims );
+         }
+
          H5_SetID_FCMag = H5Dcreate( H5_GroupID_GridData, FCMagName[v], H5T_GAMER_REAL, H5_SpaceID_FCMag[v],
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_FCMag, H5P_DEFAULT );
          if ( H5_SetID_FCMag < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FCMagName[v] );
+         if ( ASYNC )   AsyncOffset_FCMag[v] = GetDatasetOffset( H5_SetID_FCMag, FCMagName[v] );
          H5_Status = H5Dclose( H5_SetID_FCMag );
+
+         if ( Compress )   H5_Status = H5Pclose( H5_DataCreatePropList_FCMag );
       }
 #     endif
 
+      if ( Compress )   H5_Status = H5Pclose( H5_DataCreatePropList_Field );
+
 //    close the file and group
       H5_Status = H5Gclose( H5_GroupID_GridData );
       H5_Status = H5Fclose( H5_FileID );
    } // if ( MPI_Rank == 0 )
 
+// broadcast the dataset offsets for ASYNC
+   if ( ASYNC )
+   {
+      MPI_Bcast( AsyncOffset_Field, NFieldOut, MPI_LONG, 0, MPI_COMM_WORLD );
+#     ifdef MHD
+      MPI_Bcast( AsyncOffset_FCMag, NCOMP_MAG, MPI_LONG, 0, MPI_COMM_WORLD );
+#     endif
+   }
+
 
 // 5-3. start to dump data (serial instead of parallel)
 #  ifdef PARTICLE
@@ -871,26 +1029,32 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 #     ifdef PARTICLE
       if ( OPT__OUTPUT_PAR_DENS != PAR_OUTPUT_DENS_NONE )
       {
-         Prepare_PatchData_InitParticleDensityArray( lv );
+         Prepare_PatchData_InitParticleDensityArray( lv, PredictParPos_No, Time[lv] );
 
          Par_CollectParticle2OneLevel( lv, PredictParPos_No, NULL_REAL, SibBufPatch, FaSibBufPatch, JustCountNPar_No,
                                        TimingSendPar_No );
       }
 #     endif
 
-      for (int TRank=0; TRank<MPI_NRank; TRank++)
+//    the file must be closed by rank 0 before being reopened collectively
+      if ( MPIIO )   MPI_Barrier( MPI_COMM_WORLD );
+
+      for (int TRank=0; TRank<NWriteRound; TRank++)
       {
-         if ( MPI_Rank == TRank )
+         if ( MPIIO  ||  ASYNC  ||  MPI_Rank == TRank )
          {
-//          HDF5 file must be synchronized before being written by the next rank
-            SyncHDF5File( FileName );
+//          reopen the file and group (unnecessary for ASYNC since data are only staged here)
+            if ( !ASYNC )
+            {
+//             HDF5 file must be synchronized before being written by the next rank
+               if ( !MPIIO )  SyncHDF5File( FileName );
 
-//          reopen the file and group
-            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+               H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+               if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
 
-            H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
-            if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+               H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
+               if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+            }
 
 
 //          5-3-1. dump cell-centered data
@@ -915,7 +1079,15 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             H5_Count_Field [2] = PS1;
             H5_Count_Field [3] = PS1;
 
-            H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_SET, H5_Offset_Field, NULL, H5_Count_Field, NULL );
+//          ranks without patches still participate in the collective write with empty selections
+            if ( amr->NPatchComma[lv][1] == 0 )
+            {
+               H5_Status = H5Sselect_none( H5_SpaceID_Field );
+               H5_Status = H5Sselect_none( H5_MemID_Field );
+            }
+
+            else
+               H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_SET, H5_Offset_Field, NULL, H5_Count_Field, NULL );
             if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
 
 
@@ -983,12 +1155,24 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-3-1-4. write data to disk
-               H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldName[v], H5P_DEFAULT );
+//             --> for ASYNC, hand over the buffer to the I/O thread and allocate a new one for the next field
+               if ( ASYNC )
+               {
+                  Output_Async_Push( FileName, AsyncOffset_Field[v] + (long)GID_Offset[lv]*FieldSizeOnePatch,
+                                     (long)amr->NPatchComma[lv][1]*CUBE(PS1), FieldData[0][0][0] );
+
+                  FieldData = new real [ amr->NPatchComma[lv][1] ][PS1][PS1][PS1];
+               }
+
+               else
+               {
+                  H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldName[v], H5P_DEFAULT );
 
-               H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT, FieldData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+                  H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5_DataXferPropList, FieldData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
 
-               H5_Status = H5Dclose( H5_SetID_Field );
+                  H5_Status = H5Dclose( H5_SetID_Field );
+               }
             } // for (int v=0; v<NFieldOut; v++)
 
 
@@ -1012,10 +1196,10 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 #           ifdef MHD
 //          5-3-2-0. allocate memory
 //                   --> output one B component at one level in one rank at a time
-            FCMagData = new real [ amr->NPatchComma[lv][1] ][ PS1P1*SQR(PS1) ];
-
             for (int v=0; v<NCOMP_MAG; v++)
             {
+               FCMagData = new real [ amr->NPatchComma[lv][1] ][ PS1P1*SQR(PS1) ];
+
 //             5-3-2-1. determine the memory space
                H5_MemDims_FCMag[0] = amr->NPatchComma[lv][1];
                for (int t=1; t<4; t++)
@@ -1035,7 +1219,14 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                for (int t=1; t<4; t++)
                H5_Count_FCMag [t] = ( 3-t == v ) ? PS1P1 : PS1;
 
-               H5_Status = H5Sselect_hyperslab( H5_SpaceID_FCMag[v], H5S_SELECT_SET, H5_Offset_FCMag, NULL, H5_Count_FCMag, NULL );
+               if ( amr->NPatchComma[lv][1] == 0 )
+               {
+                  H5_Status = H5Sselect_none( H5_SpaceID_FCMag[v] );
+                  H5_Status = H5Sselect_none( H5_MemID_FCMag );
+               }
+
+               else
+                  H5_Status = H5Sselect_hyperslab( H5_SpaceID_FCMag[v], H5S_SELECT_SET, H5_Offset_FCMag, NULL, H5_Count_FCMag, NULL );
                if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field !!\n" );
 
 
@@ -1045,27 +1236,38 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-3-2-4. write data to disk
-               H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, FCMagName[v], H5P_DEFAULT );
+//             --> for ASYNC, hand over the buffer to the I/O thread
+               if ( ASYNC )
+                  Output_Async_Push( FileName, AsyncOffset_FCMag[v] + (long)GID_Offset[lv]*FCMagSizeOnePatch,
+                                     (long)amr->NPatchComma[lv][1]*PS1P1*SQR(PS1), FCMagData[0] );
 
-               H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5P_DEFAULT, FCMagData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+               else
+               {
+                  H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, FCMagName[v], H5P_DEFAULT );
 
-               H5_Status = H5Dclose( H5_SetID_FCMag );
-               H5_Status = H5Sclose( H5_MemID_FCMag );
-            } // for (int v=0; v<NCOMP_MAG; v++)
+                  H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5_DataXferPropList, FCMagData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
 
+                  H5_Status = H5Dclose( H5_SetID_FCMag );
 
-//          5-3-2-5.free resource
-            delete [] FCMagData;
+//                5-3-2-5. free resource
+                  delete [] FCMagData;
+               }
+
+               H5_Status = H5Sclose( H5_MemID_FCMag );
+            } // for (int v=0; v<NCOMP_MAG; v++)
 #           endif // #ifdef MHD
 
-            H5_Status = H5Gclose( H5_GroupID_GridData );
-            H5_Status = H5Fclose( H5_FileID );
-         } // if ( MPI_Rank == TRank )
+            if ( !ASYNC )
+            {
+               H5_Status = H5Gclose( H5_GroupID_GridData );
+               H5_Status = H5Fclose( H5_FileID );
+            }
+         } // if ( MPIIO  ||  ASYNC  ||  MPI_Rank == TRank )
 
          MPI_Barrier( MPI_COMM_WORLD );
 
-      } // for (int TRank=0; TRank<MPI_NRank; TRank++)
+      } // for (int TRank=0; TRank<NWriteRound; TRank++)
    } // for (int lv=0; lv<NLEVEL; lv++)
 
    H5_Status = H5Sclose( H5_SpaceID_Field );
@@ -1087,6 +1289,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    long  GParID_Offset[NLEVEL];  // GParID = global particle index (==> unique for each particle)
    long  NParLv_AllRank[NLEVEL];
    long  MaxNPar1Lv, NParInBuf, ParID;
+   long  AsyncOffset_ParData[PAR_NATT_STORED];   // file offsets of the particle datasets for ASYNC
 
 
 // 6-1. initialize variables
@@ -1128,37 +1331,64 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_GroupID_Particle = H5Gcreate( H5_FileID, "Particle", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
       if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Particle" );
 
+//    set the chunked and compressed layout
+//    --> empty datasets cannot be chunked
+      const bool CompressPar = ( Compress  &&  amr->Par->NPar_Active_AllRank > 0 );
+      hid_t H5_DataCreatePropList_Par = H5_DataCreatePropList;
+
+      if ( CompressPar )
+      {
+         const hsize_t ChunkDims[1] = { (hsize_t)MIN( (long)OPT__OUTPUT_CHUNK_NPATCH*CUBE(PS1), amr->Par->NPar_Active_AllRank ) };
+
+         H5_DataCreatePropList_Par = GetCompressPropList( 1, ChunkDims );
+      }
+
 //    create the datasets of all particle attributes
       for (int v=0; v<PAR_NATT_STORED; v++)
       {
          H5_SetID_ParData = H5Dcreate( H5_GroupID_Particle, ParAttLabel[v], H5T_GAMER_REAL, H5_SpaceID_ParData,
-                                       H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                       H5P_DEFAULT, H5_DataCreatePropList_Par, H5P_DEFAULT );
          if ( H5_SetID_ParData < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", ParAttLabel[v] );
+         if ( ASYNC  &&  amr->Par->NPar_Active_AllRank > 0 )
+            AsyncOffset_ParData[v] = GetDatasetOffset( H5_SetID_ParData, ParAttLabel[v] );
          H5_Status = H5Dclose( H5_SetID_ParData );
       }
 
+      if ( CompressPar )   H5_Status = H5Pclose( H5_DataCreatePropList_Par );
+
 //    close the file and group
       H5_Status = H5Gclose( H5_GroupID_Particle );
       H5_Status = H5Fclose( H5_FileID );
    } // if ( MPI_Rank == 0 )
 
+// broadcast the dataset offsets for ASYNC
+// --> empty datasets have no storage and will not be accessed
+   if ( ASYNC  &&  amr->Par->NPar_Active_AllRank > 0 )
+      MPI_Bcast( AsyncOffset_ParData, PAR_NATT_STORED, MPI_LONG, 0, MPI_COMM_WORLD );
+
 
 // 6-3. start to dump particle data (one level, one rank, and one attribute at a time)
 //      --> note that particles must be outputted in the same order as their associated patches
+//      --> all ranks write at once for MPIIO and ASYNC
+   if ( MPIIO )   MPI_Barrier( MPI_COMM_WORLD );
+
    for (int lv=0; lv<NLEVEL; lv++)
-   for (int TRank=0; TRank<MPI_NRank; TRank++)
+   for (int TRank=0; TRank<NWriteRound; TRank++)
    {
-      if ( MPI_Rank == TRank )
+      if ( MPIIO  ||  ASYNC  ||  MPI_Rank == TRank )
       {
-//       HDF5 file must be synchronized before being written by the next rank
-         SyncHDF5File( FileName );
+//       reopen the file and group (unnecessary for ASYNC since data are only staged here)
+         if ( !ASYNC )
+         {
+//          HDF5 file must be synchronized before being written by the next rank
+            if ( !MPIIO )  SyncHDF5File( FileName );
 
-//       reopen the file and group
-         H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-         if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
 
-         H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
-         if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+            H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
+            if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+         }
 
 
 //       6-3-1. determine the memory space
@@ -1171,7 +1401,15 @@ void Output_DumpData_Total_HDF5( const char *FileName )
          H5_Offset_ParData[0] = GParID_Offset[lv];
          H5_Count_ParData [0] = amr->Par->NPar_Lv[lv];
 
-         H5_Status = H5Sselect_hyperslab( H5_SpaceID_ParData, H5S_SELECT_SET, H5_Offset_ParData, NULL, H5_Count_ParData, NULL );
+//       ranks without particles still participate in the collective write with empty selections
+         if ( amr->Par->NPar_Lv[lv] == 0 )
+         {
+            H5_Status = H5Sselect_none( H5_SpaceID_ParData );
+            H5_Status = H5Sselect_none( H5_MemID_ParData );
+         }
+
+         else
+            H5_Status = H5Sselect_hyperslab( H5_SpaceID_ParData, H5S_SELECT_SET, H5_Offset_ParData, NULL, H5_Count_ParData, NULL );
          if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the particle data !!\n" );
 
 
@@ -1197,24 +1435,42 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //          6-3-4. write data to disk
-            H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
+//          --> for ASYNC, hand over the buffer to the I/O thread and allocate a new one for the next attribute
+            if ( ASYNC )
+            {
+               if ( NParInBuf > 0 )
+               {
+                  Output_Async_Push( FileName, AsyncOffset_ParData[v] + GParID_Offset[lv]*(long)sizeof(real),
+                                     NParInBuf, ParBuf1v1Lv );
+
+                  ParBuf1v1Lv = new real [MaxNPar1Lv];
+               }
+            }
+
+            else
+            {
+               H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
 
-            H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL, H5_MemID_ParData, H5_SpaceID_ParData, H5P_DEFAULT, ParBuf1v1Lv );
-            if ( H5_Status < 0 )
-               Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
+               H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL, H5_MemID_ParData, H5_SpaceID_ParData, H5_DataXferPropList, ParBuf1v1Lv );
+               if ( H5_Status < 0 )
+                  Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
 
-            H5_Status = H5Dclose( H5_SetID_ParData );
+               H5_Status = H5Dclose( H5_SetID_ParData );
+            }
          } // for (int v=0; v<PAR_NATT_STORED; v++)
 
 //       free resource
          H5_Status = H5Sclose( H5_MemID_ParData );
-         H5_Status = H5Gclose( H5_GroupID_Particle );
-         H5_Status = H5Fclose( H5_FileID );
-      } // if ( MPI_Rank == TRank )
+         if ( !ASYNC )
+         {
+            H5_Status = H5Gclose( H5_GroupID_Particle );
+            H5_Status = H5Fclose( H5_FileID );
+         }
+      } // if ( MPIIO  ||  ASYNC  ||  MPI_Rank == TRank )
 
       MPI_Barrier( MPI_COMM_WORLD );
 
-   } // for (int TRank=0; TRank<MPI_NRank; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
+   } // for (int TRank=0; TRank<NWriteRound; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
 
    H5_Status = H5Sclose( H5_SpaceID_ParData );
 
@@ -1325,16 +1581,28 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 
-// 8. close all HDF5 objects and free memory
+// 8. write the sidecar index for random-access analysis
+   if ( OPT__OUTPUT_INDEX  &&  MPI_Rank == 0 )
+      WriteSnapshotIndex( FileName, NFieldOut, FieldName, LBIdxList_AllLv, CrList_AllLv, GID_LvStart );
+
+
+
+// 9. close all HDF5 objects and free memory
    H5_Status = H5Tclose( H5_TypeID_Com_KeyInfo );
    H5_Status = H5Tclose( H5_TypeID_Com_Makefile );
    H5_Status = H5Tclose( H5_TypeID_Com_SymConst );
    H5_Status = H5Tclose( H5_TypeID_Com_InputPara );
    H5_Status = H5Sclose( H5_SpaceID_Scalar );
    H5_Status = H5Pclose( H5_DataCreatePropList );
+   if ( MPIIO )
+   {
+      H5_Status = H5Pclose( H5_FileAccPropList );
+      H5_Status = H5Pclose( H5_DataXferPropList );
+   }
 
    delete [] NPatchAllRank;
    delete [] FieldName;
+   delete [] AsyncOffset_Field;
 
    if ( MPI_Rank == 0 )
    {
@@ -1364,7 +1632,19 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    }
 
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+
+// 10. launch the I/O thread to write the staged data for ASYNC
+// --> wait until rank 0 has closed the file
+   if ( ASYNC )
+   {
+      MPI_Barrier( MPI_COMM_WORLD );
+
+      Output_Async_Start();
+   }
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... %s\n", __FUNCTION__, DumpID,
+                                        ( ASYNC ) ? "staged" : "done" );
 
 } // FUNCTION : Output_DumpData_Total_HDF5
 
@@ -1384,7 +1664,7 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo )
 
    const time_t CalTime = time( NULL );   // calendar time
 
-   KeyInfo.FormatVersion        = 2417;
+   KeyInfo.FormatVersion        = 2418;
    KeyInfo.Model                = MODEL;
    KeyInfo.NLevel               = NLEVEL;
    KeyInfo.NCompFluid           = NCOMP_FLUID;
@@ -1418,6 +1698,11 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo )
 #  else
    KeyInfo.Magnetohydrodynamics = 0;
 #  endif
+#  endif
+#  ifdef LOAD_BALANCE
+   KeyInfo.LBCurve              = OPT__LB_CURVE;
+#  else
+   KeyInfo.LBCurve              = LB_CURVE_HILBERT;
 #  endif
 
    for (int d=0; d<3; d++)
@@ -1515,6 +1800,12 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.Float8                 = 0;
 #  endif
 
+#  ifdef MIXED_PRECISION
+   Makefile.MixedPrecision         = 1;
+#  else
+   Makefile.MixedPrecision         = 0;
+#  endif
+
 #  ifdef SERIAL
    Makefile.Serial                 = 1;
 #  else
@@ -1572,7 +1863,7 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.RandomNumber           = RANDOM_NUMBER;
 
    Makefile.NLevel                 = NLEVEL;
-   Makefile.MaxPatch               = MAX_PATCH;
+   Makefile.MaxPatch               = NULL_INT;    // no longer a compile-time limit (see PatchTable.h)
 
 
 // model-dependent options
@@ -1931,6 +2222,18 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Par_PredictPos          = amr->Par->PredictPos;
    InputPara.Par_RemoveCell          = amr->Par->RemoveCell;
    InputPara.Par_GhostSize           = amr->Par->GhostSize;
+   InputPara.Par_SortInterval        = amr->Par->SortInterval;
+   InputPara.Par_DepositNParThread   = amr->Par->DepositNParThread;
+   InputPara.Par_CollectCache        = amr->Par->CollectCache;
+   InputPara.Par_DensCache           = amr->Par->DensCache;
+   InputPara.Par_MaxSubCycle         = amr->Par->MaxSubCycle;
+   InputPara.Par_ShortRangeAcc       = amr->Par->ShortRangeAcc;
+   InputPara.Par_SR_Soften           = amr->Par->SR_Soften;
+   InputPara.Par_SR_Radius           = amr->Par->SR_Radius;
+   InputPara.Par_FreezeFluRatio      = amr->Par->FreezeFluRatio;
+#  ifdef LOAD_BALANCE
+   InputPara.Par_CompressMPI         = amr->Par->CompressMPI;
+#  endif
    for (int v=0; v<PAR_NATT_TOTAL; v++)
    InputPara.ParAttLabel[v]          = ParAttLabel[v];
 #  endif
@@ -1964,13 +2267,23 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Dt__SyncChildrenLv      = DT__SYNC_CHILDREN_LV;
    InputPara.Opt__DtUser             = OPT__DT_USER;
    InputPara.Opt__DtLevel            = OPT__DT_LEVEL;
+   InputPara.Opt__DtOptSubStep       = OPT__DT_OPT_SUBSTEP;
+   InputPara.Dt__SubStepOverhead     = DT__SUBSTEP_OVERHEAD;
    InputPara.Opt__RecordDt           = OPT__RECORD_DT;
    InputPara.AutoReduceDt            = AUTO_REDUCE_DT;
    InputPara.AutoReduceDtFactor      = AUTO_REDUCE_DT_FACTOR;
    InputPara.AutoReduceDtFactorMin   = AUTO_REDUCE_DT_FACTOR_MIN;
+#  if ( MODEL == HYDRO )
+   InputPara.Opt__DtFluByproduct     = OPT__DT_FLU_BYPRODUCT;
+   InputPara.AutoReduceDtLocal       = AUTO_REDUCE_DT_LOCAL;
+   InputPara.Opt__FrozenRegion       = OPT__FROZEN_REGION;
+   InputPara.FrozenRegion_NStep      = FROZEN_REGION_NSTEP;
+   InputPara.FrozenRegion_Tol        = FROZEN_REGION_TOL;
+#  endif
 
 // domain refinement
    InputPara.RegridCount             = REGRID_COUNT;
+   InputPara.Opt__RegridLazy         = OPT__REGRID_LAZY;
    InputPara.FlagBufferSize          = FLAG_BUFFER_SIZE;
    InputPara.FlagBufferSizeMaxM1Lv   = FLAG_BUFFER_SIZE_MAXM1_LV;
    InputPara.FlagBufferSizeMaxM2Lv   = FLAG_BUFFER_SIZE_MAXM2_LV;
@@ -1997,6 +2310,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__Flag_LohnerForm    = OPT__FLAG_LOHNER_FORM;
    InputPara.Opt__Flag_User          = OPT__FLAG_USER;
    InputPara.Opt__Flag_Region        = OPT__FLAG_REGION;
+   InputPara.Opt__Flag_FluByproduct  = OPT__FLAG_FLU_BYPRODUCT;
 #  ifdef PARTICLE
    InputPara.Opt__Flag_NParPatch     = OPT__FLAG_NPAR_PATCH;
    InputPara.Opt__Flag_NParCell      = OPT__FLAG_NPAR_CELL;
@@ -2009,6 +2323,9 @@ void FillIn_InputPara( InputPara_t &InputPara )
 #  endif
    InputPara.Opt__ReuseMemory        = OPT__REUSE_MEMORY;
    InputPara.Opt__MemoryPool         = OPT__MEMORY_POOL;
+   InputPara.Opt__PatchArena         = OPT__PATCH_ARENA;
+   InputPara.Opt__FirstTouch         = OPT__FIRST_TOUCH;
+   InputPara.Opt__SG_OnDemand        = OPT__SG_ON_DEMAND;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2017,6 +2334,15 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.LB_Par_Weight           = amr->LB->Par_Weight;
 #  endif
    InputPara.Opt__RecordLoadBalance  = OPT__RECORD_LOAD_BALANCE;
+   InputPara.LB_MeasuredCost         = amr->LB->Cost_EMA;
+#  ifdef SUPPORT_GRACKLE
+   InputPara.LB_Che_Weight           = amr->LB->Che_Weight;
+#  endif
+   InputPara.Opt__LB_Incremental     = OPT__LB_INCREMENTAL;
+   InputPara.Opt__LB_CoupleLevel     = OPT__LB_COUPLE_LEVEL;
+   InputPara.Opt__LB_DerivedType     = OPT__LB_DERIVED_TYPE;
+   InputPara.Opt__LB_DistGraph       = OPT__LB_DIST_GRAPH;
+   InputPara.Opt__MPI_Progress       = OPT__MPI_PROGRESS;
 #  endif
    InputPara.Opt__MinimizeMPIBarrier = OPT__MINIMIZE_MPI_BARRIER;
 
@@ -2025,6 +2351,9 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Gamma                   = GAMMA;
    InputPara.MolecularWeight         = MOLECULAR_WEIGHT;
    InputPara.IsoTemp                 = ISO_TEMP;
+#  if ( EOS == EOS_TABULAR )
+   InputPara.EoS_TableName           = EOS_TABLE_NAME;
+#  endif
    InputPara.MinMod_Coeff            = MINMOD_COEFF;
    InputPara.Opt__LR_Limiter         = OPT__LR_LIMITER;
    InputPara.Opt__1stFluxCorr        = OPT__1ST_FLUX_CORR;
@@ -2045,6 +2374,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
 // fluid solvers in different models
    InputPara.Flu_GPU_NPGroup         = FLU_GPU_NPGROUP;
    InputPara.GPU_NStream             = GPU_NSTREAM;
+   InputPara.Opt__AdaptiveNPGroup    = OPT__ADAPTIVE_NPGROUP;
    InputPara.Opt__FixUp_Flux         = OPT__FIXUP_FLUX;
 #  ifdef MHD
    InputPara.Opt__FixUp_Electric     = OPT__FIXUP_ELECTRIC;
@@ -2090,6 +2420,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.SOR_Omega               = SOR_OMEGA;
    InputPara.SOR_MaxIter             = SOR_MAX_ITER;
    InputPara.SOR_MinIter             = SOR_MIN_ITER;
+   InputPara.SOR_ToleratedError      = SOR_TOLERATED_ERROR;
 #  elif ( POT_SCHEME == MG )
    InputPara.MG_MaxIter              = MG_MAX_ITER;
    InputPara.MG_NPreSmooth           = MG_NPRE_SMOOTH;
@@ -2100,7 +2431,23 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__GraP5Gradient      = OPT__GRA_P5_GRADIENT;
    InputPara.Opt__GravityType        = OPT__GRAVITY_TYPE;
    InputPara.Opt__ExternalPot        = OPT__EXTERNAL_POT;
+   InputPara.Opt__USG_PotExt         = OPT__USG_POT_EXT;
+   InputPara.ExtPotTable_Name        = EXT_POT_TABLE_NAME;
+   for (int d=0; d<3; d++)
+   InputPara.ExtPotTable_NPoint[d]   = EXT_POT_TABLE_NPOINT[d];
+   InputPara.ExtPotTable_dh          = EXT_POT_TABLE_DH;
+   for (int d=0; d<3; d++)
+   InputPara.ExtPotTable_EdgeL[d]    = EXT_POT_TABLE_EDGEL[d];
+   InputPara.Opt__USG_FuseExtAcc     = OPT__USG_FUSE_EXT_ACC;
    InputPara.Opt__GravityExtraMass   = OPT__GRAVITY_EXTRA_MASS;
+   InputPara.Opt__FFT_Pencil         = OPT__FFT_PENCIL;
+   InputPara.Opt__PotWarmStart       = OPT__POT_WARM_START;
+   InputPara.Opt__RecordPoiIter      = OPT__RECORD_POI_ITER;
+   InputPara.Pot_LevelNSweep         = POT_LEVEL_NSWEEP;
+   InputPara.Opt__GFuncCache         = OPT__GFUNC_CACHE;
+   InputPara.Opt__RecordLevelPS      = OPT__RECORD_LEVEL_PS;
+   InputPara.LevelPS_Lv              = LEVEL_PS_LV;
+   InputPara.LevelPS_Interlace       = LEVEL_PS_INTERLACE;
 #  endif
 
 // Grackle
@@ -2119,6 +2466,8 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Grackle_CIE_Cooling     = GRACKLE_CIE_COOLING;
    InputPara.Grackle_H2_OpaApprox    = GRACKLE_H2_OPA_APPROX;
    InputPara.Che_GPU_NPGroup         = CHE_GPU_NPGROUP;
+   InputPara.Grackle_ZeroCopy        = GRACKLE_ZERO_COPY;
+   InputPara.Grackle_ScreenTCool     = GRACKLE_SCREEN_TCOOL;
 #  endif
 
 // star formation
@@ -2137,6 +2486,8 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__Init               = OPT__INIT;
    InputPara.RestartLoadNRank        = RESTART_LOAD_NRANK;
    InputPara.Opt__RestartReset       = OPT__RESTART_RESET;
+   InputPara.Opt__RestartBulk        = OPT__RESTART_BULK;
+   InputPara.Opt__RestartLocal       = OPT__RESTART_LOCAL;
    InputPara.Opt__UM_IC_Level        = OPT__UM_IC_LEVEL;
    InputPara.Opt__UM_IC_NVar         = OPT__UM_IC_NVAR;
    InputPara.Opt__UM_IC_Format       = OPT__UM_IC_FORMAT;
@@ -2145,14 +2496,17 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__UM_IC_LoadNRank    = OPT__UM_IC_LOAD_NRANK;
    InputPara.Opt__InitRestrict       = OPT__INIT_RESTRICT;
    InputPara.Opt__InitGridWithOMP    = OPT__INIT_GRID_WITH_OMP;
+   InputPara.Opt__InitRefineMap      = OPT__INIT_REFINE_MAP;
    InputPara.Opt__GPUID_Select       = OPT__GPUID_SELECT;
    InputPara.Init_Subsampling_NCell  = INIT_SUBSAMPLING_NCELL;
+   InputPara.Init_Subsampling_Tol    = INIT_SUBSAMPLING_TOL;
 #  ifdef MHD
    InputPara.Opt__InitBFieldByFile   = OPT__INIT_BFIELD_BYFILE;
 #  endif
 
 // interpolation schemes
    InputPara.Opt__Int_Time           = OPT__INT_TIME;
+   InputPara.Opt__Int_TimeLazy       = OPT__INT_TIME_LAZY;
 #  if ( MODEL == ELBDM )
    InputPara.Opt__Int_Phase          = OPT__INT_PHASE;
 #  endif
@@ -2161,6 +2515,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
 #  ifdef MHD
    InputPara.Opt__Mag_IntScheme      = OPT__MAG_INT_SCHEME;
    InputPara.Opt__RefMag_IntScheme   = OPT__REF_MAG_INT_SCHEME;
+   InputPara.Opt__EMagCache          = OPT__EMAG_CACHE;
 #  endif
 #  ifdef GRAVITY
    InputPara.Opt__Pot_IntScheme      = OPT__POT_INT_SCHEME;
@@ -2170,6 +2525,8 @@ void FillIn_InputPara( InputPara_t &InputPara )
 #  endif
    InputPara.IntMonoCoeff            = INT_MONO_COEFF;
    InputPara.IntOppSign0thOrder      = INT_OPP_SIGN_0TH_ORDER;
+   InputPara.Opt__GhostCache         = OPT__GHOST_CACHE;
+   InputPara.Opt__PrepCostOrder      = OPT__PREP_COST_ORDER;
 
 // data dump
    InputPara.Opt__Output_Total       = OPT__OUTPUT_TOTAL;
@@ -2196,18 +2553,61 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Output_PartY            = OUTPUT_PART_Y;
    InputPara.Output_PartZ            = OUTPUT_PART_Z;
    InputPara.InitDumpID              = INIT_DUMPID;
+   InputPara.Opt__Output_MPIIO       = OPT__OUTPUT_MPIIO;
+   InputPara.Opt__Output_Async       = OPT__OUTPUT_ASYNC;
+   InputPara.Opt__Output_Compress    = OPT__OUTPUT_COMPRESS;
+   InputPara.Opt__Output_Shuffle     = OPT__OUTPUT_SHUFFLE;
+   InputPara.Opt__Output_ChunkNPatch = OPT__OUTPUT_CHUNK_NPATCH;
+   InputPara.Opt__Output_Index       = OPT__OUTPUT_INDEX;
+   InputPara.Opt__CkptLocal          = OPT__CKPT_LOCAL;
+   InputPara.Output_Sub_Step         = OUTPUT_SUB_STEP;
+   InputPara.Output_Sub_LvMin        = OUTPUT_SUB_LV_MIN;
+   InputPara.Output_Sub_LvMax        = OUTPUT_SUB_LV_MAX;
+   InputPara.Output_Sub_Field        = OUTPUT_SUB_FIELD;
+   for (int d=0; d<3; d++)
+   InputPara.Output_Sub_EdgeL[d]     = OUTPUT_SUB_EDGEL[d];
+   for (int d=0; d<3; d++)
+   InputPara.Output_Sub_EdgeR[d]     = OUTPUT_SUB_EDGER[d];
+   InputPara.Output_UG_Step          = OUTPUT_UG_STEP;
+   InputPara.Output_UG_Lv            = OUTPUT_UG_LV;
+   for (int d=0; d<3; d++)
+   InputPara.Output_UG_EdgeL[d]      = OUTPUT_UG_EDGEL[d];
+   for (int d=0; d<3; d++)
+   InputPara.Output_UG_EdgeR[d]      = OUTPUT_UG_EDGER[d];
+   InputPara.Output_Diag_Step        = OUTPUT_DIAG_STEP;
+   InputPara.Output_Diag_Field       = OUTPUT_DIAG_FIELD;
+   InputPara.Output_Diag_ProjLv      = OUTPUT_DIAG_PROJ_LV;
+   InputPara.Output_Diag_ProfRMax    = OUTPUT_DIAG_PROF_RMAX;
+   InputPara.Output_Diag_ProfLogR    = OUTPUT_DIAG_PROF_LOGR;
+   InputPara.Output_Diag_PhaseNBin   = OUTPUT_DIAG_PHASE_NBIN;
+   InputPara.Opt__Output_TextBinary  = OPT__OUTPUT_TEXT_BINARY;
 
 // miscellaneous
    InputPara.Opt__Verbose            = OPT__VERBOSE;
    InputPara.Opt__TimingBarrier      = OPT__TIMING_BARRIER;
    InputPara.Opt__TimingBalance      = OPT__TIMING_BALANCE;
    InputPara.Opt__TimingMPI          = OPT__TIMING_MPI;
+   InputPara.Opt__Trace              = OPT__TRACE;
+   InputPara.Trace_NEvent            = TRACE_NEVENT;
+   InputPara.Opt__TimingCounter      = OPT__TIMING_COUNTER;
    InputPara.Opt__RecordNote         = OPT__RECORD_NOTE;
    InputPara.Opt__RecordUnphy        = OPT__RECORD_UNPHY;
    InputPara.Opt__RecordMemory       = OPT__RECORD_MEMORY;
    InputPara.Opt__RecordPerformance  = OPT__RECORD_PERFORMANCE;
+   InputPara.Opt__RecordTelemetry    = OPT__RECORD_TELEMETRY;
+   InputPara.Opt__RecordPatchCost    = OPT__RECORD_PATCH_COST;
+   InputPara.Opt__RecordConservation = OPT__RECORD_CONSERVATION;
    InputPara.Opt__ManualControl      = OPT__MANUAL_CONTROL;
    InputPara.Opt__RecordUser         = OPT__RECORD_USER;
+#  ifdef SUPPORT_LIBYT
+   InputPara.Yt_Step                 = YT_STEP;
+   InputPara.Yt_Async                = YT_ASYNC;
+   InputPara.Yt_AsyncNCore           = YT_ASYNC_NCORE;
+   InputPara.Yt_AsyncMaxMem          = YT_ASYNC_MAX_MEM;
+#  endif
+#  ifdef MHD
+   InputPara.Opt__RecordDivB         = OPT__RECORD_DIVB;
+#  endif
    InputPara.Opt__OptimizeAggressive = OPT__OPTIMIZE_AGGRESSIVE;
 
 // simulation checks
@@ -2219,6 +2619,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__Ck_Finite          = OPT__CK_FINITE;
    InputPara.Opt__Ck_PatchAllocate   = OPT__CK_PATCH_ALLOCATE;
    InputPara.Opt__Ck_FluxAllocate    = OPT__CK_FLUX_ALLOCATE;
+   InputPara.Opt__Ck_FluOutput       = OPT__CK_FLU_OUTPUT;
 #  if ( MODEL == HYDRO )
    InputPara.Opt__Ck_Negative        = OPT__CK_NEGATIVE;
 #  endif
@@ -2324,6 +2725,7 @@ void GetCompound_KeyInfo( hid_t &H5_TypeID )
 #  if ( MODEL == HYDRO )
    H5Tinsert( H5_TypeID, "Magnetohydrodynamics", HOFFSET(KeyInfo_t,Magnetohydrodynamics), H5T_NATIVE_INT          );
 #  endif
+   H5Tinsert( H5_TypeID, "LBCurve",              HOFFSET(KeyInfo_t,LBCurve             ), H5T_NATIVE_INT          );
 
    H5Tinsert( H5_TypeID, "Step",                 HOFFSET(KeyInfo_t,Step                ), H5T_NATIVE_LONG         );
    H5Tinsert( H5_TypeID, "AdvanceCounter",       HOFFSET(KeyInfo_t,AdvanceCounter      ), H5_TypeID_Arr_NLvLong   );
@@ -2382,6 +2784,7 @@ void GetCompound_Makefile( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Timing",                 HOFFSET(Makefile_t,Timing                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "TimingSolver",           HOFFSET(Makefile_t,TimingSolver           ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Float8",                 HOFFSET(Makefile_t,Float8                 ), H5T_NATIVE_INT );
+   H5Tinsert( H5_TypeID, "MixedPrecision",         HOFFSET(Makefile_t,MixedPrecision         ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Serial",                 HOFFSET(Makefile_t,Serial                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "LoadBalance",            HOFFSET(Makefile_t,LoadBalance            ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "OverlapMPI",             HOFFSET(Makefile_t,OverlapMPI             ), H5T_NATIVE_INT );
@@ -2581,6 +2984,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 #  endif
 
    const hid_t   H5_TypeID_Arr_3Int          = H5Tarray_create( H5T_NATIVE_INT,    1, &H5_ArrDims_3Var      );
+   const hid_t   H5_TypeID_Arr_3Double       = H5Tarray_create( H5T_NATIVE_DOUBLE, 1, &H5_ArrDims_3Var      );
    const hid_t   H5_TypeID_Arr_6Int          = H5Tarray_create( H5T_NATIVE_INT,    1, &H5_ArrDims_6Var      );
 #  if ( NCOMP_PASSIVE > 0 )
    const hid_t   H5_TypeID_Arr_NPassive      = H5Tarray_create( H5T_NATIVE_INT,    1, &H5_ArrDims_NPassive  );
@@ -2653,6 +3057,18 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Par_PredictPos",          HOFFSET(InputPara_t,Par_PredictPos         ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_RemoveCell",          HOFFSET(InputPara_t,Par_RemoveCell         ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Par_GhostSize",           HOFFSET(InputPara_t,Par_GhostSize          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_SortInterval",        HOFFSET(InputPara_t,Par_SortInterval       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_DepositNParThread",   HOFFSET(InputPara_t,Par_DepositNParThread  ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_CollectCache",        HOFFSET(InputPara_t,Par_CollectCache       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_DensCache",           HOFFSET(InputPara_t,Par_DensCache          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_MaxSubCycle",         HOFFSET(InputPara_t,Par_MaxSubCycle        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_ShortRangeAcc",       HOFFSET(InputPara_t,Par_ShortRangeAcc      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_SR_Soften",           HOFFSET(InputPara_t,Par_SR_Soften          ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Par_SR_Radius",           HOFFSET(InputPara_t,Par_SR_Radius          ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Par_FreezeFluRatio",      HOFFSET(InputPara_t,Par_FreezeFluRatio     ), H5T_NATIVE_DOUBLE  );
+#  ifdef LOAD_BALANCE
+   H5Tinsert( H5_TypeID, "Par_CompressMPI",         HOFFSET(InputPara_t,Par_CompressMPI        ), H5T_NATIVE_INT     );
+#  endif
 
 // store the name of all particle attributes
    for (int v=0; v<PAR_NATT_TOTAL; v++)
@@ -2694,14 +3110,24 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Dt__SyncChildrenLv",      HOFFSET(InputPara_t,Dt__SyncChildrenLv     ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Opt__DtUser",             HOFFSET(InputPara_t,Opt__DtUser            ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__DtLevel",            HOFFSET(InputPara_t,Opt__DtLevel           ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__DtOptSubStep",       HOFFSET(InputPara_t,Opt__DtOptSubStep      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Dt__SubStepOverhead",     HOFFSET(InputPara_t,Dt__SubStepOverhead    ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Opt__RecordDt",           HOFFSET(InputPara_t,Opt__RecordDt          ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "AutoReduceDt",            HOFFSET(InputPara_t,AutoReduceDt           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactor",      HOFFSET(InputPara_t,AutoReduceDtFactor     ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactorMin",   HOFFSET(InputPara_t,AutoReduceDtFactorMin  ), H5T_NATIVE_DOUBLE  );
+#  if ( MODEL == HYDRO )
+   H5Tinsert( H5_TypeID, "Opt__DtFluByproduct",     HOFFSET(InputPara_t,Opt__DtFluByproduct    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "AutoReduceDtLocal",       HOFFSET(InputPara_t,AutoReduceDtLocal      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__FrozenRegion",       HOFFSET(InputPara_t,Opt__FrozenRegion      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "FrozenRegion_NStep",      HOFFSET(InputPara_t,FrozenRegion_NStep     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "FrozenRegion_Tol",        HOFFSET(InputPara_t,FrozenRegion_Tol       ), H5T_NATIVE_DOUBLE  );
+#  endif
 
 
 // domain refinement
    H5Tinsert( H5_TypeID, "RegridCount",             HOFFSET(InputPara_t,RegridCount            ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RegridLazy",         HOFFSET(InputPara_t,Opt__RegridLazy        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "FlagBufferSize",          HOFFSET(InputPara_t,FlagBufferSize         ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "FlagBufferSizeMaxM1Lv",   HOFFSET(InputPara_t,FlagBufferSizeMaxM1Lv  ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "FlagBufferSizeMaxM2Lv",   HOFFSET(InputPara_t,FlagBufferSizeMaxM2Lv  ), H5T_NATIVE_INT     );
@@ -2728,6 +3154,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__Flag_LohnerForm",    HOFFSET(InputPara_t,Opt__Flag_LohnerForm   ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__Flag_User",          HOFFSET(InputPara_t,Opt__Flag_User         ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__Flag_Region",        HOFFSET(InputPara_t,Opt__Flag_Region       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Flag_FluByproduct",  HOFFSET(InputPara_t,Opt__Flag_FluByproduct ), H5T_NATIVE_INT     );
 #  ifdef PARTICLE
    H5Tinsert( H5_TypeID, "Opt__Flag_NParPatch",     HOFFSET(InputPara_t,Opt__Flag_NParPatch    ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__Flag_NParCell",      HOFFSET(InputPara_t,Opt__Flag_NParCell     ), H5T_NATIVE_INT     );
@@ -2740,6 +3167,9 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 #  endif
    H5Tinsert( H5_TypeID, "Opt__ReuseMemory",        HOFFSET(InputPara_t,Opt__ReuseMemory       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__MemoryPool",         HOFFSET(InputPara_t,Opt__MemoryPool        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PatchArena",         HOFFSET(InputPara_t,Opt__PatchArena        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__FirstTouch",         HOFFSET(InputPara_t,Opt__FirstTouch        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__SG_OnDemand",        HOFFSET(InputPara_t,Opt__SG_OnDemand       ), H5T_NATIVE_INT     );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2748,6 +3178,15 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "LB_Par_Weight",           HOFFSET(InputPara_t,LB_Par_Weight          ), H5T_NATIVE_DOUBLE  );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__RecordLoadBalance",  HOFFSET(InputPara_t,Opt__RecordLoadBalance ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "LB_MeasuredCost",         HOFFSET(InputPara_t,LB_MeasuredCost        ), H5T_NATIVE_DOUBLE  );
+#  ifdef SUPPORT_GRACKLE
+   H5Tinsert( H5_TypeID, "LB_Che_Weight",           HOFFSET(InputPara_t,LB_Che_Weight          ), H5T_NATIVE_DOUBLE  );
+#  endif
+   H5Tinsert( H5_TypeID, "Opt__LB_Incremental",     HOFFSET(InputPara_t,Opt__LB_Incremental    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_CoupleLevel",     HOFFSET(InputPara_t,Opt__LB_CoupleLevel    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_DerivedType",     HOFFSET(InputPara_t,Opt__LB_DerivedType    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_DistGraph",       HOFFSET(InputPara_t,Opt__LB_DistGraph      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__MPI_Progress",       HOFFSET(InputPara_t,Opt__MPI_Progress      ), H5T_NATIVE_INT     );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__MinimizeMPIBarrier", HOFFSET(InputPara_t,Opt__MinimizeMPIBarrier), H5T_NATIVE_INT     );
 
@@ -2756,6 +3195,9 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Gamma",                   HOFFSET(InputPara_t,Gamma                  ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MolecularWeight",         HOFFSET(InputPara_t,MolecularWeight        ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "IsoTemp",                 HOFFSET(InputPara_t,IsoTemp                ), H5T_NATIVE_DOUBLE  );
+#  if ( EOS == EOS_TABULAR )
+   H5Tinsert( H5_TypeID, "EoS_TableName",           HOFFSET(InputPara_t,EoS_TableName          ), H5_TypeID_VarStr   );
+#  endif
    H5Tinsert( H5_TypeID, "MinMod_Coeff",            HOFFSET(InputPara_t,MinMod_Coeff           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Opt__LR_Limiter",         HOFFSET(InputPara_t,Opt__LR_Limiter        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorr",        HOFFSET(InputPara_t,Opt__1stFluxCorr       ), H5T_NATIVE_INT     );
@@ -2776,6 +3218,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 // fluid solvers in different models
    H5Tinsert( H5_TypeID, "Flu_GPU_NPGroup",         HOFFSET(InputPara_t,Flu_GPU_NPGroup        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "GPU_NStream",             HOFFSET(InputPara_t,GPU_NStream            ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__AdaptiveNPGroup",    HOFFSET(InputPara_t,Opt__AdaptiveNPGroup   ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__FixUp_Flux",         HOFFSET(InputPara_t,Opt__FixUp_Flux        ), H5T_NATIVE_INT     );
 #  ifdef MHD
    H5Tinsert( H5_TypeID, "Opt__FixUp_Electric",     HOFFSET(InputPara_t,Opt__FixUp_Electric    ), H5T_NATIVE_INT     );
@@ -2833,6 +3276,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "SOR_Omega",               HOFFSET(InputPara_t,SOR_Omega              ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "SOR_MaxIter",             HOFFSET(InputPara_t,SOR_MaxIter            ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "SOR_MinIter",             HOFFSET(InputPara_t,SOR_MinIter            ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "SOR_ToleratedError",      HOFFSET(InputPara_t,SOR_ToleratedError     ), H5T_NATIVE_DOUBLE  );
 #  elif ( POT_SCHEME == MG )
    H5Tinsert( H5_TypeID, "MG_MaxIter",              HOFFSET(InputPara_t,MG_MaxIter             ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "MG_NPreSmooth",           HOFFSET(InputPara_t,MG_NPreSmooth          ), H5T_NATIVE_INT     );
@@ -2843,7 +3287,21 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__GraP5Gradient",      HOFFSET(InputPara_t,Opt__GraP5Gradient     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__GravityType",        HOFFSET(InputPara_t,Opt__GravityType       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__ExternalPot",        HOFFSET(InputPara_t,Opt__ExternalPot       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__USG_PotExt",         HOFFSET(InputPara_t,Opt__USG_PotExt        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "ExtPotTable_Name",        HOFFSET(InputPara_t,ExtPotTable_Name       ), H5_TypeID_VarStr   );
+   H5Tinsert( H5_TypeID, "ExtPotTable_NPoint",      HOFFSET(InputPara_t,ExtPotTable_NPoint     ), H5_TypeID_Arr_3Int );
+   H5Tinsert( H5_TypeID, "ExtPotTable_dh",          HOFFSET(InputPara_t,ExtPotTable_dh         ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "ExtPotTable_EdgeL",       HOFFSET(InputPara_t,ExtPotTable_EdgeL      ), H5_TypeID_Arr_3Double );
+   H5Tinsert( H5_TypeID, "Opt__USG_FuseExtAcc",     HOFFSET(InputPara_t,Opt__USG_FuseExtAcc    ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__GravityExtraMass",   HOFFSET(InputPara_t,Opt__GravityExtraMass  ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__FFT_Pencil",         HOFFSET(InputPara_t,Opt__FFT_Pencil        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PotWarmStart",       HOFFSET(InputPara_t,Opt__PotWarmStart      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RecordPoiIter",      HOFFSET(InputPara_t,Opt__RecordPoiIter     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Pot_LevelNSweep",         HOFFSET(InputPara_t,Pot_LevelNSweep        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__GFuncCache",         HOFFSET(InputPara_t,Opt__GFuncCache        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RecordLevelPS",      HOFFSET(InputPara_t,Opt__RecordLevelPS     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "LevelPS_Lv",              HOFFSET(InputPara_t,LevelPS_Lv             ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "LevelPS_Interlace",       HOFFSET(InputPara_t,LevelPS_Interlace      ), H5T_NATIVE_INT     );
 #  endif
 
 // Grackle
@@ -2862,6 +3320,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Grackle_CIE_Cooling",     HOFFSET(InputPara_t,Grackle_CIE_Cooling    ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Grackle_H2_OpaApprox",    HOFFSET(InputPara_t,Grackle_H2_OpaApprox   ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Che_GPU_NPGroup",         HOFFSET(InputPara_t,Che_GPU_NPGroup        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Grackle_ZeroCopy",        HOFFSET(InputPara_t,Grackle_ZeroCopy       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Grackle_ScreenTCool",     HOFFSET(InputPara_t,Grackle_ScreenTCool    ), H5T_NATIVE_DOUBLE  );
 #  endif
 
 // star formation
@@ -2880,6 +3340,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__Init",               HOFFSET(InputPara_t,Opt__Init              ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "RestartLoadNRank",        HOFFSET(InputPara_t,RestartLoadNRank       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RestartReset",       HOFFSET(InputPara_t,Opt__RestartReset      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RestartBulk",        HOFFSET(InputPara_t,Opt__RestartBulk       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RestartLocal",       HOFFSET(InputPara_t,Opt__RestartLocal      ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_Level",        HOFFSET(InputPara_t,Opt__UM_IC_Level       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_NVar",         HOFFSET(InputPara_t,Opt__UM_IC_NVar        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_Format",       HOFFSET(InputPara_t,Opt__UM_IC_Format      ), H5T_NATIVE_INT     );
@@ -2888,14 +3350,17 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__UM_IC_LoadNRank",    HOFFSET(InputPara_t,Opt__UM_IC_LoadNRank   ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__InitRestrict",       HOFFSET(InputPara_t,Opt__InitRestrict      ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__InitGridWithOMP",    HOFFSET(InputPara_t,Opt__InitGridWithOMP   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__InitRefineMap",      HOFFSET(InputPara_t,Opt__InitRefineMap     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__GPUID_Select",       HOFFSET(InputPara_t,Opt__GPUID_Select      ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Init_Subsampling_NCell",  HOFFSET(InputPara_t,Init_Subsampling_NCell ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Init_Subsampling_Tol",    HOFFSET(InputPara_t,Init_Subsampling_Tol   ), H5T_NATIVE_DOUBLE  );
 #  ifdef MHD
    H5Tinsert( H5_TypeID, "Opt__InitBFieldByFile",   HOFFSET(InputPara_t,Opt__InitBFieldByFile  ), H5T_NATIVE_INT     );
 #  endif
 
 // interpolation schemes
    H5Tinsert( H5_TypeID, "Opt__Int_Time",           HOFFSET(InputPara_t,Opt__Int_Time          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Int_TimeLazy",       HOFFSET(InputPara_t,Opt__Int_TimeLazy      ), H5T_NATIVE_INT     );
 #  if ( MODEL == ELBDM )
    H5Tinsert( H5_TypeID, "Opt__Int_Phase",          HOFFSET(InputPara_t,Opt__Int_Phase         ), H5T_NATIVE_INT     );
 #  endif
@@ -2904,6 +3369,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 #  ifdef MHD
    H5Tinsert( H5_TypeID, "Opt__Mag_IntScheme",      HOFFSET(InputPara_t,Opt__Mag_IntScheme     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RefMag_IntScheme",   HOFFSET(InputPara_t,Opt__RefMag_IntScheme  ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__EMagCache",          HOFFSET(InputPara_t,Opt__EMagCache         ), H5T_NATIVE_INT     );
 #  endif
 #  ifdef GRAVITY
    H5Tinsert( H5_TypeID, "Opt__Pot_IntScheme",      HOFFSET(InputPara_t,Opt__Pot_IntScheme     ), H5T_NATIVE_INT     );
@@ -2913,6 +3379,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 #  endif
    H5Tinsert( H5_TypeID, "IntMonoCoeff",            HOFFSET(InputPara_t,IntMonoCoeff           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "IntOppSign0thOrder",      HOFFSET(InputPara_t,IntOppSign0thOrder     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__GhostCache",         HOFFSET(InputPara_t,Opt__GhostCache        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PrepCostOrder",      HOFFSET(InputPara_t,Opt__PrepCostOrder     ), H5T_NATIVE_INT     );
 
 // data dump
    H5Tinsert( H5_TypeID, "Opt__Output_Total",       HOFFSET(InputPara_t,Opt__Output_Total      ), H5T_NATIVE_INT     );
@@ -2939,18 +3407,57 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Output_PartY",            HOFFSET(InputPara_t,Output_PartY           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Output_PartZ",            HOFFSET(InputPara_t,Output_PartZ           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "InitDumpID",              HOFFSET(InputPara_t,InitDumpID             ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_MPIIO",       HOFFSET(InputPara_t,Opt__Output_MPIIO      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_Async",       HOFFSET(InputPara_t,Opt__Output_Async      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_Compress",    HOFFSET(InputPara_t,Opt__Output_Compress   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_Shuffle",     HOFFSET(InputPara_t,Opt__Output_Shuffle    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_ChunkNPatch", HOFFSET(InputPara_t,Opt__Output_ChunkNPatch), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_Index",       HOFFSET(InputPara_t,Opt__Output_Index      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__CkptLocal",          HOFFSET(InputPara_t,Opt__CkptLocal         ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Sub_Step",         HOFFSET(InputPara_t,Output_Sub_Step        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Sub_LvMin",        HOFFSET(InputPara_t,Output_Sub_LvMin       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Sub_LvMax",        HOFFSET(InputPara_t,Output_Sub_LvMax       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Sub_Field",        HOFFSET(InputPara_t,Output_Sub_Field       ), H5T_NATIVE_LONG    );
+   H5Tinsert( H5_TypeID, "Output_Sub_EdgeL",        HOFFSET(InputPara_t,Output_Sub_EdgeL       ), H5_TypeID_Arr_3Double );
+   H5Tinsert( H5_TypeID, "Output_Sub_EdgeR",        HOFFSET(InputPara_t,Output_Sub_EdgeR       ), H5_TypeID_Arr_3Double );
+   H5Tinsert( H5_TypeID, "Output_UG_Step",          HOFFSET(InputPara_t,Output_UG_Step         ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_UG_Lv",            HOFFSET(InputPara_t,Output_UG_Lv           ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_UG_EdgeL",         HOFFSET(InputPara_t,Output_UG_EdgeL        ), H5_TypeID_Arr_3Double );
+   H5Tinsert( H5_TypeID, "Output_UG_EdgeR",         HOFFSET(InputPara_t,Output_UG_EdgeR        ), H5_TypeID_Arr_3Double );
+   H5Tinsert( H5_TypeID, "Output_Diag_Step",        HOFFSET(InputPara_t,Output_Diag_Step       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Diag_Field",       HOFFSET(InputPara_t,Output_Diag_Field      ), H5T_NATIVE_LONG    );
+   H5Tinsert( H5_TypeID, "Output_Diag_ProjLv",      HOFFSET(InputPara_t,Output_Diag_ProjLv     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Output_Diag_ProfRMax",    HOFFSET(InputPara_t,Output_Diag_ProfRMax   ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Output_Diag_ProfLogR",    HOFFSET(InputPara_t,Output_Diag_ProfLogR   ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Output_Diag_PhaseNBin",   HOFFSET(InputPara_t,Output_Diag_PhaseNBin  ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Output_TextBinary",  HOFFSET(InputPara_t,Opt__Output_TextBinary ), H5T_NATIVE_INT     );
 
 // miscellaneous
    H5Tinsert( H5_TypeID, "Opt__Verbose",            HOFFSET(InputPara_t,Opt__Verbose           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__TimingBarrier",      HOFFSET(InputPara_t,Opt__TimingBarrier     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__TimingBalance",      HOFFSET(InputPara_t,Opt__TimingBalance     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__TimingMPI",          HOFFSET(InputPara_t,Opt__TimingMPI         ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Trace",              HOFFSET(InputPara_t,Opt__Trace             ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Trace_NEvent",            HOFFSET(InputPara_t,Trace_NEvent           ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__TimingCounter",      HOFFSET(InputPara_t,Opt__TimingCounter     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordNote",         HOFFSET(InputPara_t,Opt__RecordNote        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordUnphy",        HOFFSET(InputPara_t,Opt__RecordUnphy       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordMemory",       HOFFSET(InputPara_t,Opt__RecordMemory      ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordPerformance",  HOFFSET(InputPara_t,Opt__RecordPerformance ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RecordTelemetry",    HOFFSET(InputPara_t,Opt__RecordTelemetry   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RecordPatchCost",    HOFFSET(InputPara_t,Opt__RecordPatchCost   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RecordConservation", HOFFSET(InputPara_t,Opt__RecordConservation), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__ManualControl",      HOFFSET(InputPara_t,Opt__ManualControl     ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__RecordUser",         HOFFSET(InputPara_t,Opt__RecordUser        ), H5T_NATIVE_INT     );
+#  ifdef SUPPORT_LIBYT
+   H5Tinsert( H5_TypeID, "Yt_Step",                 HOFFSET(InputPara_t,Yt_Step                ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Yt_Async",                HOFFSET(InputPara_t,Yt_Async               ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Yt_AsyncNCore",           HOFFSET(InputPara_t,Yt_AsyncNCore          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Yt_AsyncMaxMem",          HOFFSET(InputPara_t,Yt_AsyncMaxMem         ), H5T_NATIVE_DOUBLE  );
+#  endif
+#  ifdef MHD
+   H5Tinsert( H5_TypeID, "Opt__RecordDivB",         HOFFSET(InputPara_t,Opt__RecordDivB        ), H5T_NATIVE_INT     );
+#  endif
    H5Tinsert( H5_TypeID, "Opt__OptimizeAggressive", HOFFSET(InputPara_t,Opt__OptimizeAggressive), H5T_NATIVE_INT     );
 
 // simulation checks
@@ -2962,6 +3469,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__Ck_Finite",          HOFFSET(InputPara_t,Opt__Ck_Finite         ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__Ck_PatchAllocate",   HOFFSET(InputPara_t,Opt__Ck_PatchAllocate  ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__Ck_FluxAllocate",    HOFFSET(InputPara_t,Opt__Ck_FluxAllocate   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__Ck_FluOutput",       HOFFSET(InputPara_t,Opt__Ck_FluOutput      ), H5T_NATIVE_INT     );
 #  if ( MODEL == HYDRO )
    H5Tinsert( H5_TypeID, "Opt__Ck_Negative",        HOFFSET(InputPara_t,Opt__Ck_Negative       ), H5T_NATIVE_INT     );
 #  endif
@@ -3000,6 +3508,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 
 // free memory
    H5_Status = H5Tclose( H5_TypeID_Arr_3Int          );
+   H5_Status = H5Tclose( H5_TypeID_Arr_3Double       );
    H5_Status = H5Tclose( H5_TypeID_Arr_6Int          );
 #  if ( NCOMP_PASSIVE > 0 )
    H5_Status = H5Tclose( H5_TypeID_Arr_NPassive      );
@@ -3016,4 +3525,256 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetDatasetOffset
+// Description :  Return the byte offset of the target dataset in the file for OPT__OUTPUT_ASYNC
+//
+// Note        :  1. The dataset must be contiguous and allocated at creation (i.e., H5D_ALLOC_TIME_EARLY)
+//                   --> The raw bytes written by the I/O thread would corrupt a chunked dataset, whose chunks
+//                       are not stored consecutively in the file
+//
+// Parameter   :  H5_SetID : HDF5 dataset ID
+//                SetName  : Dataset name (for the error message only)
+//
+// Return      :  Byte offset of the dataset
+//-------------------------------------------------------------------------------------------------------
+long GetDatasetOffset( const hid_t H5_SetID, const char *SetName )
+{
+
+   const hid_t        H5_PropList = H5Dget_create_plist( H5_SetID );
+   const H5D_layout_t H5_Layout   = H5Pget_layout( H5_PropList );
+
+   H5Pclose( H5_PropList );
+
+   if ( H5_Layout != H5D_CONTIGUOUS )
+      Aux_Error( ERROR_INFO, "dataset \"%s\" is not contiguous (layout %d) !!\n", SetName, (int)H5_Layout );
+
+   const haddr_t Offset = H5Dget_offset( H5_SetID );
+
+   if ( Offset == HADDR_UNDEF )
+      Aux_Error( ERROR_INFO, "failed to get the file offset of the dataset \"%s\" !!\n", SetName );
+
+   return (long)Offset;
+
+} // FUNCTION : GetDatasetOffset
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetCompressPropList
+// Description :  Create the dataset-creation property list for the chunked and compressed grid and particle
+//                data
+//
+// Note        :  1. Filters are set by OPT__OUTPUT_SHUFFLE and OPT__OUTPUT_COMPRESS (deflate level)
+//                2. The returned property list must be closed manually
+//
+// Parameter   :  NDim      : Number of dimensions of the target dataset
+//                ChunkDims : Chunk size along each dimension
+//
+// Return      :  HDF5 property list ID
+//-------------------------------------------------------------------------------------------------------
+hid_t GetCompressPropList( const int NDim, const hsize_t ChunkDims[] )
+{
+
+   const hid_t H5_PropList = H5Pcreate( H5P_DATASET_CREATE );
+   herr_t      H5_Status;
+
+   H5_Status = H5Pset_fill_time( H5_PropList, H5D_FILL_TIME_NEVER );
+   H5_Status = H5Pset_chunk( H5_PropList, NDim, ChunkDims );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the chunk size !!\n" );
+
+   if ( OPT__OUTPUT_SHUFFLE )
+   {
+      H5_Status = H5Pset_shuffle( H5_PropList );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the shuffle filter !!\n" );
+   }
+
+   H5_Status = H5Pset_deflate( H5_PropList, OPT__OUTPUT_COMPRESS );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the deflate filter !!\n" );
+
+   return H5_PropList;
+
+} // FUNCTION : GetCompressPropList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteSnapshotIndex
+// Description :  Write the sidecar index of the HDF5 snapshot for OPT__OUTPUT_INDEX
+//
+// Note        :  1. Only invoked by rank 0 after the snapshot has been created
+//                2. File layout of "FileName.idx" (native endianness):
+//                      char   Magic[8]                   = "GAMERIDX"
+//                      int    Version                    = 1
+//                      int    NLevel
+//                      int    PatchSize
+//                      int    SizeReal                   : 4/8 for single/double precision
+//                      int    NField                     : number of cell-centered fields in "GridData"
+//                      int    LabelLen                   = 32
+//                      long   Step
+//                      double Time
+//                      double BoxSize[3]
+//                      double dh_Finest                  : cell size on the finest level (i.e., the unit of Corner)
+//                      long   NPatch[NLevel]             : number of patches on each level
+//                      long   GID0[NLevel]               : GID of the first patch on each level
+//                      long   Scale[NLevel]              : cell size on each level in the unit of dh_Finest
+//                      char   Label[NField][LabelLen]
+//                      long   FieldOffset[NField]        : byte offset of each field dataset in the snapshot
+//                                                          (-1 if the dataset is not contiguous, e.g., compressed)
+//                      SnapIdxRecord_t Record[NPatch]    : records of all levels (see SnapshotIndex_Typedef.h)
+//                   --> All sections are 8-byte aligned so that the file can be memory-mapped directly
+//                3. The face-centered magnetic field and particles are not indexed
+//                4. For OPT__OUTPUT_ASYNC, the dataset offsets are valid even though the grid data may still be
+//                   being written by the I/O thread
+//
+// Parameter   :  FileName    : Name of the snapshot
+//                NField      : Number of cell-centered fields
+//                FieldName   : Names of the cell-centered fields
+//                LBIdxList   : LB_Idx of all patches sorted by GID
+//                CrList      : Corner of all patches sorted by GID
+//                GID_LvStart : GID of the first patch on each level
+//-------------------------------------------------------------------------------------------------------
+void WriteSnapshotIndex( const char *FileName, const int NField, const char (*FieldName)[MAX_STRING],
+                         const long *LBIdxList, const int (*CrList)[3], const int GID_LvStart[] )
+{
+
+// 1. get the file offsets of all field datasets
+   long  *FieldOffset = new long [NField];
+   hid_t  H5_FileID, H5_SetID;
+   herr_t H5_Status;
+   char   SetName[MAX_STRING];
+
+   H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+   if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+   for (int v=0; v<NField; v++)
+   {
+      sprintf( SetName, "GridData/%s", FieldName[v] );
+
+      H5_SetID = H5Dopen( H5_FileID, SetName, H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", SetName );
+
+      const haddr_t Offset = H5Dget_offset( H5_SetID );
+      FieldOffset[v] = ( Offset == HADDR_UNDEF ) ? -1L : (long)Offset;
+
+      H5_Status = H5Dclose( H5_SetID );
+   }
+
+   H5_Status = H5Fclose( H5_FileID );
+
+
+// 2. construct the records sorted by the Morton key on each level
+   const int NPatchAllLv = GID_LvStart[TOP_LEVEL] + NPatchTotal[TOP_LEVEL];
+   SnapIdxRecord_t *Record = new SnapIdxRecord_t [ NPatchAllLv + 1 ];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int  NP     = NPatchTotal[lv];
+      const int  GID0   = GID_LvStart[lv];
+      long      *Key    = new long [ NP + 1 ];
+      int       *IdxTab = new int  [ NP + 1 ];
+
+      for (int t=0; t<NP; t++)   Key[t] = GetMortonKey( lv, CrList[GID0+t] );
+
+      Mis_Heapsort( NP, Key, IdxTab );
+
+      for (int t=0; t<NP; t++)
+      {
+         const int GID = GID0 + IdxTab[t];
+
+         Record[GID0+t].Key   = Key[t];
+         Record[GID0+t].LBIdx = LBIdxList[GID];
+         Record[GID0+t].GID   = GID;
+         for (int d=0; d<3; d++)    Record[GID0+t].Corner[d] = CrList[GID][d];
+      }
+
+      delete [] Key;
+      delete [] IdxTab;
+   }
+
+
+// 3. write the index file
+   char IdxFileName[MAX_STRING];
+   sprintf( IdxFileName, "%s%s", FileName, SNAPIDX_SUFFIX );
+
+   FILE *File = fopen( IdxFileName, "wb" );
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", IdxFileName );
+
+   const int  Int[6] = { SNAPIDX_VERSION, NLEVEL, PS1, (int)sizeof(real), NField, SNAPIDX_LABEL_LEN };
+   const long Step_  = Step;
+   const double dh_Finest = amr->dh[TOP_LEVEL];
+   long NPatch_Lv[NLEVEL], GID0_Lv[NLEVEL], Scale_Lv[NLEVEL];
+   char Label[SNAPIDX_LABEL_LEN];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NPatch_Lv[lv] = NPatchTotal[lv];
+      GID0_Lv  [lv] = GID_LvStart[lv];
+      Scale_Lv [lv] = amr->scale [lv];
+   }
+
+   fwrite( SNAPIDX_MAGIC,  sizeof(char),   8,      File );
+   fwrite( Int,            sizeof(int),    6,      File );
+   fwrite( &Step_,         sizeof(long),   1,      File );
+   fwrite( &Time[0],       sizeof(double), 1,      File );
+   fwrite( amr->BoxSize,   sizeof(double), 3,      File );
+   fwrite( &dh_Finest,     sizeof(double), 1,      File );
+   fwrite( NPatch_Lv,      sizeof(long),   NLEVEL, File );
+   fwrite( GID0_Lv,        sizeof(long),   NLEVEL, File );
+   fwrite( Scale_Lv,       sizeof(long),   NLEVEL, File );
+
+   for (int v=0; v<NField; v++)
+   {
+      memset( Label, 0, SNAPIDX_LABEL_LEN );
+      strncpy( Label, FieldName[v], SNAPIDX_LABEL_LEN-1 );
+      fwrite( Label, sizeof(char), SNAPIDX_LABEL_LEN, File );
+   }
+
+   fwrite( FieldOffset,    sizeof(long),   NField, File );
+
+   if ( fwrite( Record, sizeof(SnapIdxRecord_t), NPatchAllLv, File ) != (size_t)NPatchAllLv )
+      Aux_Error( ERROR_INFO, "failed to write the file \"%s\" !!\n", IdxFileName );
+
+   fclose( File );
+
+
+   delete [] FieldOffset;
+   delete [] Record;
+
+} // FUNCTION : WriteSnapshotIndex
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMortonKey
+// Description :  Return the Morton key of the patch corner for WriteSnapshotIndex()
+//
+// Note        :  1. Corner is converted to the unit of the patch size on the target level
+//                2. Bits of x/y/z are interleaved with x in the least significant bit
+//
+// Parameter   :  lv     : Target refinement level
+//                Corner : Patch corner in the unit of the finest cell
+//
+// Return      :  Morton key
+//-------------------------------------------------------------------------------------------------------
+long GetMortonKey( const int lv, const int Corner[] )
+{
+
+   const int PatchScale = PS1*amr->scale[lv];
+   long Key = 0;
+
+   for (int d=0; d<3; d++)
+   {
+      const long Idx = Corner[d] / PatchScale;
+
+      for (int b=0; b<SNAPIDX_KEY_NBIT; b++)
+         if ( Idx & (1L<<b) )    Key |= 1L << ( 3*b + d );
+   }
+
+   return Key;
+
+} // FUNCTION : GetMortonKey
+
+
+
 #endif // #ifdef SUPPORT_HDF5
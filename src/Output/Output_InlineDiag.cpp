@@ -0,0 +1,709 @@
+#ifdef SUPPORT_HDF5
+
+#include "GAMER.h"
+#include "HDF5_Typedef.h"
+
+static void Diag_Projection( const int NField, const int FieldIdx[], double *Proj[], const long NPix[] );
+#if ( MODEL == HYDRO )
+static void Diag_Phase( const int NBin, double *Hist, double LogDensRange[], double LogPresRange[] );
+static real CellPres( const int lv, const int PID, const int i, const int j, const int k, real Passive[] );
+#endif
+#ifdef PARTICLE
+static void Diag_ParProfile( const Profile_t *Prof, double *ParDens, double *ParVelR, long *ParNPar );
+#endif
+static void WriteAttribute( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int N,
+                            const void *Data );
+static void WriteDataset( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int NDim,
+                          const hsize_t Dims[], const void *Data );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_InlineDiag
+// Description :  Compute projections, radial profiles, and phase histograms from the live AMR hierarchy
+//                and store them in a small HDF5 file
+//
+// Note        :  1. Enabled by OUTPUT_DIAG_STEP and invoked by main() every OUTPUT_DIAG_STEP root-level steps
+//                   --> Replace the post-processing of regular snapshots for frequent diagnostics
+//                2. Fluid fields are specified by the bitwise mask OUTPUT_DIAG_FIELD (e.g., _DENS|_ENGY)
+//                3. Projections
+//                   --> Line integrals of the target fields along x/y/z over the entire box using the leaf patches
+//                   --> Resolution is set by the cell size on level OUTPUT_DIAG_PROJ_LV
+//                       --> Finer cells are area-averaged and coarser cells are spread over multiple pixels
+//                4. Radial profiles
+//                   --> Volume-weighted profiles of the target fields centered at the box center by Aux_ComputeProfile()
+//                   --> Log bins with the inner bin size amr->dh[MAX_LEVEL] up to OUTPUT_DIAG_PROF_RMAX
+//                       and the bin ratio OUTPUT_DIAG_PROF_LOGR
+//                   --> PARTICLE: also compute the particle mass density and mass-weighted radial velocity
+//                5. Phase histogram (HYDRO only)
+//                   --> Mass-weighted 2D histogram of log10(density) and log10(pressure) of all leaf cells
+//                       with OUTPUT_DIAG_PHASE_NBIN^2 bins (0=off)
+//                   --> Bin ranges are set by the global minimum and maximum values
+//                6. Support hybrid OpenMP/MPI parallelization
+//                   --> Results are reduced to and written by the root rank only
+//                7. File structure
+//                      Diag_XXXXXXXXX (XXXXXXXXX = Step)
+//                         attributes: Time, Step, BoxSize, Center, ProjLv, ProjNPix[3]
+//                         /Projection/{x,y,z}/FieldLabel : double [NPix_2][NPix_1] (1/2 = other two axes)
+//                         /Profile/Radius, Weight, NCell, FieldLabel : [NBin]
+//                                 /ParDens, ParVelR, ParNPar         : [NBin] (PARTICLE only)
+//                         /Phase/Hist                    : double [NBin_Dens][NBin_Pres]
+//                               /LogDensRange, LogPresRange : double [2]
+//-------------------------------------------------------------------------------------------------------
+void Output_InlineDiag()
+{
+
+   char FileName[MAX_STRING];
+   sprintf( FileName, "Diag_%09ld", Step );
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (FileName = %s) ... ", __FUNCTION__, FileName );
+
+
+// 1. set the target fields
+   const long FieldMask = ( OUTPUT_DIAG_FIELD < 0 ) ? _TOTAL : OUTPUT_DIAG_FIELD;
+
+   int NField = 0, FieldIdx[NCOMP_TOTAL];
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+      if ( FieldMask & (1L<<v) )    FieldIdx[ NField ++ ] = v;
+
+
+// 2. projections
+   long    NPix[3];
+   double *Proj[3];
+
+   for (int d=0; d<3; d++)    NPix[d] = (long)NX0_TOT[d]*( 1L << OUTPUT_DIAG_PROJ_LV );
+
+   for (int a=0; a<3; a++)
+   {
+      const int d1 = ( a == 0 ) ? 1 : 0;
+      const int d2 = ( a == 2 ) ? 1 : 2;
+
+      Proj[a] = new double [ NField*NPix[d1]*NPix[d2] ];
+   }
+
+   Diag_Projection( NField, FieldIdx, Proj, NPix );
+
+
+// 3. radial profiles
+   const double r_max = ( OUTPUT_DIAG_PROF_RMAX > 0.0 ) ? OUTPUT_DIAG_PROF_RMAX
+                                                         : 0.5*MIN( amr->BoxSize[0], MIN( amr->BoxSize[1], amr->BoxSize[2] ) );
+   Profile_t  *Prof_Buf = new Profile_t  [NField];
+   Profile_t **Prof     = new Profile_t* [NField];
+   long        TVar[NCOMP_TOTAL];
+
+   for (int f=0; f<NField; f++)
+   {
+      Prof[f] = Prof_Buf + f;
+      TVar[f] = BIDX( FieldIdx[f] );
+   }
+
+// keep the empty bins so that the bins of the particle profiles are consistent
+   if ( NField > 0 )
+   Aux_ComputeProfile( Prof, amr->BoxCenter, r_max, amr->dh[MAX_LEVEL], true, OUTPUT_DIAG_PROF_LOGR, false,
+                       TVar, NField, -1, -1, PATCH_LEAF, -1.0 );
+
+#  ifdef PARTICLE
+   const int NBin_Par = ( NField > 0 ) ? Prof[0]->NBin : 0;
+   double   *ParDens  = new double [NBin_Par];
+   double   *ParVelR  = new double [NBin_Par];
+   long     *ParNPar  = new long   [NBin_Par];
+
+   if ( NField > 0 )    Diag_ParProfile( Prof[0], ParDens, ParVelR, ParNPar );
+#  endif
+
+
+// 4. phase histogram
+#  if ( MODEL == HYDRO )
+   const int NBin_Phase = OUTPUT_DIAG_PHASE_NBIN;
+   double   *Phase      = new double [ SQR(NBin_Phase) ];
+   double    LogDensRange[2], LogPresRange[2];
+
+   if ( NBin_Phase > 0 )   Diag_Phase( NBin_Phase, Phase, LogDensRange, LogPresRange );
+#  endif
+
+
+// 5. write the file by the root rank
+   if ( MPI_Rank == 0 )
+   {
+      const hid_t H5_FileID = H5Fcreate( FileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to create the HDF5 file \"%s\" !!\n", FileName );
+
+      const double Time0 = Time[0];
+      hid_t  H5_GroupID, H5_SubGroupID;
+      herr_t H5_Status;
+
+      WriteAttribute( H5_FileID, "Time",     H5T_NATIVE_DOUBLE, 1,     &Time0               );
+      WriteAttribute( H5_FileID, "Step",     H5T_NATIVE_LONG,   1,     &Step                );
+      WriteAttribute( H5_FileID, "BoxSize",  H5T_NATIVE_DOUBLE, 3,      amr->BoxSize        );
+      WriteAttribute( H5_FileID, "Center",   H5T_NATIVE_DOUBLE, 3,      amr->BoxCenter      );
+      WriteAttribute( H5_FileID, "ProjLv",   H5T_NATIVE_INT,    1,     &OUTPUT_DIAG_PROJ_LV );
+      WriteAttribute( H5_FileID, "ProjNPix", H5T_NATIVE_LONG,   3,      NPix                );
+
+//    5-1. projections
+      const char *AxisName[3] = { "x", "y", "z" };
+
+      H5_GroupID = H5Gcreate( H5_FileID, "Projection", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Projection" );
+
+      for (int a=0; a<3; a++)
+      {
+         const int     d1      = ( a == 0 ) ? 1 : 0;
+         const int     d2      = ( a == 2 ) ? 1 : 2;
+         const hsize_t Dims[2] = { (hsize_t)NPix[d2], (hsize_t)NPix[d1] };
+
+         H5_SubGroupID = H5Gcreate( H5_GroupID, AxisName[a], H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_SubGroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", AxisName[a] );
+
+         for (int f=0; f<NField; f++)
+            WriteDataset( H5_SubGroupID, FieldLabel[ FieldIdx[f] ], H5T_NATIVE_DOUBLE, 2, Dims,
+                          Proj[a] + f*NPix[d1]*NPix[d2] );
+
+         H5_Status = H5Gclose( H5_SubGroupID );
+      }
+
+      H5_Status = H5Gclose( H5_GroupID );
+
+//    5-2. profiles
+      if ( NField > 0 )
+      {
+         const hsize_t Dims[1] = { (hsize_t)Prof[0]->NBin };
+
+         H5_GroupID = H5Gcreate( H5_FileID, "Profile", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Profile" );
+
+         WriteDataset( H5_GroupID, "Radius", H5T_NATIVE_DOUBLE, 1, Dims, Prof[0]->Radius );
+         WriteDataset( H5_GroupID, "Weight", H5T_NATIVE_DOUBLE, 1, Dims, Prof[0]->Weight );
+         WriteDataset( H5_GroupID, "NCell",  H5T_NATIVE_LONG,   1, Dims, Prof[0]->NCell  );
+
+         for (int f=0; f<NField; f++)
+            WriteDataset( H5_GroupID, FieldLabel[ FieldIdx[f] ], H5T_NATIVE_DOUBLE, 1, Dims, Prof[f]->Data );
+
+#        ifdef PARTICLE
+         WriteDataset( H5_GroupID, "ParDens", H5T_NATIVE_DOUBLE, 1, Dims, ParDens );
+         WriteDataset( H5_GroupID, "ParVelR", H5T_NATIVE_DOUBLE, 1, Dims, ParVelR );
+         WriteDataset( H5_GroupID, "ParNPar", H5T_NATIVE_LONG,   1, Dims, ParNPar );
+#        endif
+
+         H5_Status = H5Gclose( H5_GroupID );
+      }
+
+//    5-3. phase histogram
+#     if ( MODEL == HYDRO )
+      if ( NBin_Phase > 0 )
+      {
+         const hsize_t Dims_Hist [2] = { (hsize_t)NBin_Phase, (hsize_t)NBin_Phase };
+         const hsize_t Dims_Range[1] = { 2 };
+
+         H5_GroupID = H5Gcreate( H5_FileID, "Phase", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Phase" );
+
+         WriteDataset( H5_GroupID, "Hist",         H5T_NATIVE_DOUBLE, 2, Dims_Hist,  Phase        );
+         WriteDataset( H5_GroupID, "LogDensRange", H5T_NATIVE_DOUBLE, 1, Dims_Range, LogDensRange );
+         WriteDataset( H5_GroupID, "LogPresRange", H5T_NATIVE_DOUBLE, 1, Dims_Range, LogPresRange );
+
+         H5_Status = H5Gclose( H5_GroupID );
+      }
+#     endif
+
+      H5_Status = H5Fclose( H5_FileID );
+   } // if ( MPI_Rank == 0 )
+
+
+// 6. free resources
+   for (int a=0; a<3; a++)    delete [] Proj[a];
+
+   delete [] Prof;
+   delete [] Prof_Buf;
+
+#  ifdef PARTICLE
+   delete [] ParDens;
+   delete [] ParVelR;
+   delete [] ParNPar;
+#  endif
+
+#  if ( MODEL == HYDRO )
+   delete [] Phase;
+#  endif
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Output_InlineDiag
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_Projection
+// Description :  Compute the line integrals of the target fields along x/y/z
+//
+// Note        :  1. Invoked by Output_InlineDiag()
+//                2. Pixel size is set by the cell size on level OUTPUT_DIAG_PROJ_LV
+//                3. Result along the axis a is stored in Proj[a][f][p2][p1], where p1/p2 are the pixel
+//                   indices along the other two axes in ascending order
+//                   --> Only the root rank receives the reduced results
+//
+// Parameter   :  NField   : Number of target fields
+//                FieldIdx : Integer indices of the target fields
+//                Proj     : Projection arrays to be returned
+//                NPix     : Number of pixels along x/y/z
+//-------------------------------------------------------------------------------------------------------
+void Diag_Projection( const int NField, const int FieldIdx[], double *Proj[], const long NPix[] )
+{
+
+   const int PLv = OUTPUT_DIAG_PROJ_LV;
+
+   for (int a=0; a<3; a++)
+   {
+      const int d1 = ( a == 0 ) ? 1 : 0;
+      const int d2 = ( a == 2 ) ? 1 : 2;
+
+      for (long t=0; t<NField*NPix[d1]*NPix[d2]; t++)    Proj[a][t] = 0.0;
+   }
+
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int    FluSg     = amr->FluSg[lv];
+      const int    dLv       = lv - PLv;
+      const int    NSub      = ( dLv < 0 ) ? 1<<(-dLv) : 1;            // number of pixels covered by a cell along one axis
+      const double AreaRatio = ( dLv > 0 ) ? 1.0/double( 1L<<(2*dLv) ) : 1.0;  // cell area / pixel area
+      const double dl        = amr->dh[lv]*AreaRatio;
+
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+         const real (*FluidPtr)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+         long Idx0[3];
+
+         for (int d=0; d<3; d++)    Idx0[d] = amr->patch[0][lv][PID]->corner[d] / amr->scale[lv];
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+         {
+            const long Idx[3] = { Idx0[0]+i, Idx0[1]+j, Idx0[2]+k };
+
+            for (int a=0; a<3; a++)
+            {
+               const int  d1   = ( a == 0 ) ? 1 : 0;
+               const int  d2   = ( a == 2 ) ? 1 : 2;
+               const long NImg = NPix[d1]*NPix[d2];
+
+               for (int f=0; f<NField; f++)
+               {
+                  const double Val = FluidPtr[ FieldIdx[f] ][k][j][i]*dl;
+                  double      *Img = Proj[a] + f*NImg;
+
+                  if ( dLv >= 0 )
+                  {
+                     const long p = ( Idx[d2] >> dLv )*NPix[d1] + ( Idx[d1] >> dLv );
+#                    pragma omp atomic
+                     Img[p] += Val;
+                  }
+
+                  else
+                  {
+                     for (int s2=0; s2<NSub; s2++)
+                     for (int s1=0; s1<NSub; s1++)
+                     {
+                        const long p = ( Idx[d2]*NSub + s2 )*NPix[d1] + ( Idx[d1]*NSub + s1 );
+#                       pragma omp atomic
+                        Img[p] += Val;
+                     }
+                  }
+               } // for (int f=0; f<NField; f++)
+            } // for (int a=0; a<3; a++)
+         } // i,j,k
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// collect data from all ranks (in-place reduction)
+#  ifndef SERIAL
+   for (int a=0; a<3; a++)
+   {
+      const int d1    = ( a == 0 ) ? 1 : 0;
+      const int d2    = ( a == 2 ) ? 1 : 2;
+      const int Count = NField*NPix[d1]*NPix[d2];
+
+      if ( MPI_Rank == 0 )
+         MPI_Reduce( MPI_IN_PLACE, Proj[a], Count, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      else
+         MPI_Reduce( Proj[a],      NULL,    Count, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   }
+#  endif
+
+} // FUNCTION : Diag_Projection
+
+
+
+#if ( MODEL == HYDRO )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_Phase
+// Description :  Compute the mass-weighted phase histogram of log10(density) and log10(pressure)
+//
+// Note        :  1. Invoked by Output_InlineDiag()
+//                2. Use all leaf cells
+//                3. Bin ranges are set by the global minimum and maximum values, which requires an extra pass
+//                   --> Cells with non-positive density or pressure are skipped
+//                4. Only the root rank receives the reduced histogram
+//
+// Parameter   :  NBin         : Number of bins along each dimension
+//                Hist         : Histogram to be returned with the shape [NBin(dens)][NBin(pres)]
+//                LogDensRange : Range of log10(density) to be returned
+//                LogPresRange : Range of log10(pressure) to be returned
+//-------------------------------------------------------------------------------------------------------
+void Diag_Phase( const int NBin, double *Hist, double LogDensRange[], double LogPresRange[] )
+{
+
+#  ifdef OPENMP
+   const int NT = OMP_NTHREAD;   // number of OpenMP threads
+#  else
+   const int NT = 1;
+#  endif
+
+   double **OMP_Hist = NULL;
+
+   Aux_AllocateArray2D( OMP_Hist, NT, SQR(NBin) );
+
+
+// 1. get the bin ranges
+   double Min[2] = { +HUGE_NUMBER, +HUGE_NUMBER };
+   double Max[2] = { -HUGE_NUMBER, -HUGE_NUMBER };
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+#     pragma omp parallel
+      {
+         real   *Passive = new real [NCOMP_PASSIVE];
+         double  Min_OMP[2] = { +HUGE_NUMBER, +HUGE_NUMBER };
+         double  Max_OMP[2] = { -HUGE_NUMBER, -HUGE_NUMBER };
+
+#        pragma omp for schedule( runtime )
+         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         {
+            if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               const real Dens = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[DENS][k][j][i];
+               const real Pres = CellPres( lv, PID, i, j, k, Passive );
+
+               if ( Dens <= (real)0.0  ||  Pres <= (real)0.0 )    continue;
+
+               const double LogVal[2] = { log10( (double)Dens ), log10( (double)Pres ) };
+
+               for (int t=0; t<2; t++)
+               {
+                  Min_OMP[t] = fmin( Min_OMP[t], LogVal[t] );
+                  Max_OMP[t] = fmax( Max_OMP[t], LogVal[t] );
+               }
+            }
+         }
+
+#        pragma omp critical
+         {
+            for (int t=0; t<2; t++)
+            {
+               Min[t] = fmin( Min[t], Min_OMP[t] );
+               Max[t] = fmax( Max[t], Max_OMP[t] );
+            }
+         }
+
+         delete [] Passive;
+      } // OpenMP parallel region
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   double Min_AllRank[2], Max_AllRank[2];
+
+   MPI_Allreduce( Min, Min_AllRank, 2, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
+   MPI_Allreduce( Max, Max_AllRank, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+
+// avoid zero-width ranges
+   for (int t=0; t<2; t++)
+   {
+      Min[t] = Min_AllRank[t];
+      Max[t] = Max_AllRank[t];
+
+      if ( Max[t] <= Min[t] )
+      {
+         Min[t] -= 0.5;
+         Max[t] += 0.5;
+      }
+   }
+
+   LogDensRange[0] = Min[0];
+   LogDensRange[1] = Max[0];
+   LogPresRange[0] = Min[1];
+   LogPresRange[1] = Max[1];
+
+   const double _dDens = NBin/( Max[0] - Min[0] );
+   const double _dPres = NBin/( Max[1] - Min[1] );
+
+
+// 2. fill the histogram
+#  pragma omp parallel
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+
+      real *Passive = new real [NCOMP_PASSIVE];
+
+      for (int b=0; b<SQR(NBin); b++)  OMP_Hist[TID][b] = 0.0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const double dv = CUBE( amr->dh[lv] );
+
+#        pragma omp for schedule( runtime )
+         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         {
+            if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               const real Dens = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[DENS][k][j][i];
+               const real Pres = CellPres( lv, PID, i, j, k, Passive );
+
+               if ( Dens <= (real)0.0  ||  Pres <= (real)0.0 )    continue;
+
+               const int bd = MIN(  int( ( log10((double)Dens) - Min[0] )*_dDens ), NBin-1  );
+               const int bp = MIN(  int( ( log10((double)Pres) - Min[1] )*_dPres ), NBin-1  );
+
+               OMP_Hist[TID][ bd*NBin + bp ] += Dens*dv;
+            }
+         }
+      } // for (int lv=0; lv<NLEVEL; lv++)
+
+      delete [] Passive;
+   } // OpenMP parallel region
+
+
+// 3. sum over all OpenMP threads and ranks
+   for (int b=0; b<SQR(NBin); b++)
+   {
+      Hist[b] = OMP_Hist[0][b];
+
+      for (int t=1; t<NT; t++)   Hist[b] += OMP_Hist[t][b];
+   }
+
+   Aux_DeallocateArray2D( OMP_Hist );
+
+#  ifndef SERIAL
+   if ( MPI_Rank == 0 )
+      MPI_Reduce( MPI_IN_PLACE, Hist, SQR(NBin), MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   else
+      MPI_Reduce( Hist,         NULL, SQR(NBin), MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+#  endif
+
+} // FUNCTION : Diag_Phase
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CellPres
+// Description :  Return the gas pressure of the target cell
+//
+// Parameter   :  lv, PID, i, j, k : Target cell
+//                Passive          : Work array for the passive scalars
+//-------------------------------------------------------------------------------------------------------
+real CellPres( const int lv, const int PID, const int i, const int j, const int k, real Passive[] )
+{
+
+   const real (*FluidPtr)[PS1][PS1][PS1] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
+   const bool CheckMinPres_No = false;
+
+   for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = FluidPtr[ NCOMP_FLUID+v ][k][j][i];
+
+#  ifdef MHD
+   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
+#  else
+   const real Emag = NULL_REAL;
+#  endif
+
+   return Hydro_Con2Pres( FluidPtr[DENS][k][j][i], FluidPtr[MOMX][k][j][i], FluidPtr[MOMY][k][j][i],
+                          FluidPtr[MOMZ][k][j][i], FluidPtr[ENGY][k][j][i], Passive,
+                          CheckMinPres_No, NULL_REAL, Emag,
+                          EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
+
+} // FUNCTION : CellPres
+#endif // #if ( MODEL == HYDRO )
+
+
+
+#ifdef PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_ParProfile
+// Description :  Compute the radial profiles of the particle mass density and mass-weighted radial velocity
+//
+// Note        :  1. Invoked by Output_InlineDiag()
+//                2. Adopt the same log bins as the input fluid profile
+//                   --> Right edge of bin b = dr_min*LogBinRatio^b, where the inner edge of bin 0 is zero
+//                3. Only the root rank receives the reduced profiles
+//
+// Parameter   :  Prof    : Fluid profile providing the radial bins
+//                ParDens : Particle mass density to be returned
+//                ParVelR : Mass-weighted particle radial velocity to be returned
+//                ParNPar : Number of particles to be returned
+//-------------------------------------------------------------------------------------------------------
+void Diag_ParProfile( const Profile_t *Prof, double *ParDens, double *ParVelR, long *ParNPar )
+{
+
+   const int    NBin     = Prof->NBin;
+   const double LogRatio = log( Prof->LogBinRatio );
+   const double dr_min   = Prof->MaxRadius / pow( Prof->LogBinRatio, NBin-1 );
+   const double r_max2   = SQR( Prof->MaxRadius );
+   const real  *Pos[3]   = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+   const real  *Vel[3]   = { amr->Par->VelX, amr->Par->VelY, amr->Par->VelZ };
+   const double HalfBox[3]  = { 0.5*amr->BoxSize[0], 0.5*amr->BoxSize[1], 0.5*amr->BoxSize[2] };
+   const bool   Periodic[3] = { OPT__BC_FLU[0] == BC_FLU_PERIODIC,
+                                OPT__BC_FLU[2] == BC_FLU_PERIODIC,
+                                OPT__BC_FLU[4] == BC_FLU_PERIODIC };
+
+   for (int b=0; b<NBin; b++)
+   {
+      ParDens[b] = 0.0;
+      ParVelR[b] = 0.0;
+      ParNPar[b] = 0;
+   }
+
+// particles are few compared to cells --> serial loop
+   for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)
+   {
+      const real Mass = amr->Par->Mass[p];
+
+      if ( Mass < (real)0.0 )    continue;
+
+      double dr[3], r2=0.0, vr=0.0;
+
+      for (int d=0; d<3; d++)
+      {
+         dr[d] = Pos[d][p] - amr->BoxCenter[d];
+
+         if ( Periodic[d] )
+         {
+            if      ( dr[d] > +HalfBox[d] )   dr[d] -= amr->BoxSize[d];
+            else if ( dr[d] < -HalfBox[d] )   dr[d] += amr->BoxSize[d];
+         }
+
+         r2 += SQR( dr[d] );
+      }
+
+      if ( r2 >= r_max2 )  continue;
+
+      const double r   = sqrt( r2 );
+      const int    bin = ( r < dr_min ) ? 0 : MIN( int( log(r/dr_min)/LogRatio ) + 1, NBin-1 );
+
+      if ( r > 0.0 )
+         for (int d=0; d<3; d++)    vr += Vel[d][p]*dr[d]/r;
+
+      ParDens[bin] += Mass;
+      ParVelR[bin] += Mass*vr;
+      ParNPar[bin] ++;
+   }
+
+#  ifndef SERIAL
+   if ( MPI_Rank == 0 )
+   {
+      MPI_Reduce( MPI_IN_PLACE, ParDens, NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      MPI_Reduce( MPI_IN_PLACE, ParVelR, NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      MPI_Reduce( MPI_IN_PLACE, ParNPar, NBin, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   }
+
+   else
+   {
+      MPI_Reduce( ParDens,      NULL,    NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      MPI_Reduce( ParVelR,      NULL,    NBin, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+      MPI_Reduce( ParNPar,      NULL,    NBin, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   }
+#  endif
+
+// convert mass to density and momentum to velocity
+   if ( MPI_Rank == 0 )
+   {
+      for (int b=0; b<NBin; b++)
+      {
+         const double r_in  = ( b == 0 ) ? 0.0 : dr_min*pow( Prof->LogBinRatio, b-1 );
+         const double r_out = dr_min*pow( Prof->LogBinRatio, b );
+
+         if ( ParNPar[b] > 0L )  ParVelR[b] /= ParDens[b];
+
+         ParDens[b] /= 4.0/3.0*M_PI*( CUBE(r_out) - CUBE(r_in) );
+      }
+   }
+
+} // FUNCTION : Diag_ParProfile
+#endif // #ifdef PARTICLE
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteAttribute
+// Description :  Write a 1D attribute to the target HDF5 object
+//
+// Parameter   :  H5_LocID  : Target HDF5 object
+//                Name      : Attribute name
+//                H5_TypeID : HDF5 datatype
+//                N         : Number of elements
+//                Data      : Attribute data
+//-------------------------------------------------------------------------------------------------------
+void WriteAttribute( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int N, const void *Data )
+{
+
+   const hsize_t H5_Dims   = N;
+   const hid_t   H5_Space  = H5Screate_simple( 1, &H5_Dims, NULL );
+   const hid_t   H5_AttrID = H5Acreate( H5_LocID, Name, H5_TypeID, H5_Space, H5P_DEFAULT, H5P_DEFAULT );
+
+   if ( H5_AttrID < 0 )    Aux_Error( ERROR_INFO, "failed to create the attribute \"%s\" !!\n", Name );
+
+   if ( H5Awrite( H5_AttrID, H5_TypeID, Data ) < 0 )
+      Aux_Error( ERROR_INFO, "failed to write the attribute \"%s\" !!\n", Name );
+
+   H5Aclose( H5_AttrID );
+   H5Sclose( H5_Space );
+
+} // FUNCTION : WriteAttribute
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteDataset
+// Description :  Create and write a dataset to the target HDF5 object
+//
+// Parameter   :  H5_LocID  : Target HDF5 object
+//                Name      : Dataset name
+//                H5_TypeID : HDF5 datatype
+//                NDim      : Number of dimensions
+//                Dims      : Size of each dimension
+//                Data      : Dataset data
+//-------------------------------------------------------------------------------------------------------
+void WriteDataset( const hid_t H5_LocID, const char *Name, const hid_t H5_TypeID, const int NDim,
+                   const hsize_t Dims[], const void *Data )
+{
+
+   const hid_t H5_Space = H5Screate_simple( NDim, Dims, NULL );
+   const hid_t H5_SetID = H5Dcreate( H5_LocID, Name, H5_TypeID, H5_Space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+   if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", Name );
+
+   if ( H5Dwrite( H5_SetID, H5_TypeID, H5S_ALL, H5S_ALL, H5P_DEFAULT, Data ) < 0 )
+      Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" !!\n", Name );
+
+   H5Dclose( H5_SetID );
+   H5Sclose( H5_Space );
+
+} // FUNCTION : WriteDataset
+
+
+
+#endif // #ifdef SUPPORT_HDF5
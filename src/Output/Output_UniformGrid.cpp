@@ -0,0 +1,401 @@
+#include "GAMER.h"
+
+
+// fixed length of each field label in the file header
+#define UG_LABEL_LEN    32
+
+// number of patch groups prepared by Prepare_PatchData() at a time
+#define UG_NPG_BATCH    64
+
+static bool GetOverlap( const int lv, const int PID, const int TLv, const long Idx0[], const long NCell[],
+                        long Lo[], long Hi[] );
+static real MinMod( const real L, const real R );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_UniformGrid
+// Description :  Output a uniform-resolution cube extracted from the live AMR hierarchy
+//
+// Note        :  1. Invoked by main() every OUTPUT_UG_STEP steps
+//                   --> Replace the post-processing by tool/analysis/gamer_extract_uniform
+//                2. Target level and region are set by OUTPUT_UG_LV and OUTPUT_UG_EDGEL/R
+//                   --> Region is snapped to the cells on level OUTPUT_UG_LV
+//                3. Data of each cell are taken from the finest patch covering it up to OUTPUT_UG_LV
+//                   --> Patches on OUTPUT_UG_LV store the restricted data of their descendants
+//                   --> Leaf patches below OUTPUT_UG_LV are interpolated with MinMod-limited linear slopes,
+//                       which conserves the cell averages and avoids new extrema
+//                   --> Ghost zones required by the slopes are prepared by Prepare_PatchData(), which
+//                       interpolates across coarse-fine boundaries and applies the fluid boundary conditions
+//                4. Each rank only handles its own patches and all ranks write a single file in parallel
+//                   --> Collective MPI-IO with an indexed file view per rank (fwrite() for SERIAL)
+//                5. File layout (native endianness):
+//                      char   Magic[8]                          = "GAMERUGD"
+//                      int    Version                           = 1
+//                      int    SizeReal                          : 4/8 for single/double precision
+//                      int    NField                            : number of fields (= NCOMP_TOTAL)
+//                      int    LabelLen                          = 32
+//                      int    Lv                                : target level
+//                      int    Padding
+//                      long   NCell[3]                          : number of cells along x/y/z
+//                      long   Step
+//                      double Time
+//                      double dh                                : cell size
+//                      double EdgeL[3]                          : left edge of the snapped region
+//                      char   Label[NField][LabelLen]
+//                      (data) Data[NField][NCell[2]][NCell[1]][NCell[0]]
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Output_UniformGrid()
+{
+
+   const int TLv = OUTPUT_UG_LV;
+   char FileName[MAX_STRING];
+
+   sprintf( FileName, "UniformGrid_%09ld", Step );
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step = %ld) ...\n", __FUNCTION__, Step );
+
+
+// check
+   if ( TLv < 0  ||  TLv > TOP_LEVEL )
+      Aux_Error( ERROR_INFO, "incorrect OUTPUT_UG_LV (%d) !!\n", TLv );
+
+   for (int lv=1; lv<=TLv; lv++)
+      if ( NPatchTotal[lv] != 0 )   Mis_CompareRealValue( Time[0], Time[lv], __FUNCTION__, true );
+
+
+// 1. target region in the cell indices on TLv
+   const double dh = amr->dh[TLv];
+   long   Idx0[3], NCell[3];
+   double EdgeL[3];
+
+   for (int d=0; d<3; d++)
+   {
+      const long NCell_Box = (long)NX0_TOT[d]*( 1L << TLv );
+      const long Idx1      = MIN( (long)ceil( OUTPUT_UG_EDGER[d]/dh ), NCell_Box );
+
+      Idx0 [d] = MAX( (long)floor( OUTPUT_UG_EDGEL[d]/dh ), 0L );
+      NCell[d] = Idx1 - Idx0[d];
+      EdgeL[d] = Idx0[d]*dh;
+
+      if ( NCell[d] <= 0 )
+         Aux_Error( ERROR_INFO, "empty region along %d (OUTPUT_UG_EDGEL = %14.7e, OUTPUT_UG_EDGER = %14.7e) !!\n",
+                    d, OUTPUT_UG_EDGEL[d], OUTPUT_UG_EDGER[d] );
+   }
+
+   const long NCell_Total = NCell[0]*NCell[1]*NCell[2];
+
+
+// 2. count the cells and rows (contiguous x segments) of this rank
+   long Lo[3], Hi[3];
+   long NCell_Local = 0;
+   long NRow_Local  = 0;
+
+   for (int lv=0; lv<=TLv; lv++)
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      if ( !GetOverlap( lv, PID, TLv, Idx0, NCell, Lo, Hi ) )  continue;
+
+      NCell_Local += ( Hi[0] - Lo[0] )*( Hi[1] - Lo[1] )*( Hi[2] - Lo[2] );
+      NRow_Local  +=                   ( Hi[1] - Lo[1] )*( Hi[2] - Lo[2] );
+   }
+
+   if ( NRow_Local > __INT_MAX__ )
+      Aux_Error( ERROR_INFO, "number of rows in rank %d (%ld) exceeds INT_MAX !!\n", MPI_Rank, NRow_Local );
+
+
+// 3. fill the local data level by level
+   const int  PGS                = PS1 + 2;      // patch size with one ghost cell on each side
+   const int  PGS3               = CUBE( PGS );
+   const bool IntPhase_No        = false;
+   const bool DE_Consistency_No  = false;
+   const real MinDens_No         = -1.0;
+   const real MinPres_No         = -1.0;
+
+   real *Data    = new real [ NCOMP_TOTAL*NCell_Local + 1 ];
+   long *RowDisp = new long [ NRow_Local + 1 ];     // element displacement of each row in each field of the file
+   long *RowMem  = new long [ NRow_Local + 1 ];     // element displacement of each row in each field of Data[]
+   int  *RowLen  = new int  [ NRow_Local + 1 ];
+   real *Prep    = new real [ 8*UG_NPG_BATCH*NCOMP_TOTAL*PGS3 ];
+   long  Cell    = 0;
+   long  Row     = 0;
+
+   for (int lv=0; lv<=TLv; lv++)
+   {
+      const int    Ratio     = 1 << ( TLv - lv );
+      const int    NPG_Total = amr->NPatchComma[lv][1] / 8;
+      const double _Ratio    = 1.0 / Ratio;
+      int *PID0_List = new int [ NPG_Total + 1 ];
+      int  NPG       = 0;
+
+//    3-1. collect the patch groups containing at least one target patch
+      for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         if ( GetOverlap( lv, PID0+LocalID, TLv, Idx0, NCell, Lo, Hi ) )
+         {
+            PID0_List[ NPG ++ ] = PID0;
+            break;
+         }
+      }
+
+//    3-2. prepare the data with ghost zones batch by batch
+      for (int PG0=0; PG0<NPG; PG0+=UG_NPG_BATCH)
+      {
+         const int NPG_Batch = MIN( UG_NPG_BATCH, NPG-PG0 );
+
+         Prepare_PatchData( lv, Time[lv], Prep, NULL, 1, NPG_Batch, PID0_List+PG0, _TOTAL, _NONE,
+                            OPT__REF_FLU_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_26, IntPhase_No,
+                            OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, DE_Consistency_No );
+
+         for (int t=0; t<8*NPG_Batch; t++)
+         {
+            const int PID = PID0_List[ PG0 + t/8 ] + t%8;
+
+            if ( !GetOverlap( lv, PID, TLv, Idx0, NCell, Lo, Hi ) )  continue;
+
+            const int  *Corner = amr->patch[0][lv][PID]->corner;
+            const long  NX     = Hi[0] - Lo[0];
+            const real *Prep_t = Prep + (long)t*NCOMP_TOTAL*PGS3;
+
+            for (long k=Lo[2]; k<Hi[2]; k++)
+            for (long j=Lo[1]; j<Hi[1]; j++)
+            {
+               RowDisp[Row] = ( k*NCell[1] + j )*NCell[0] + Lo[0];
+               RowMem [Row] = Cell;
+               RowLen [Row] = NX;
+               Row ++;
+
+               for (long i=Lo[0]; i<Hi[0]; i++)
+               {
+//                cell indices on TLv relative to the patch corner --> coarse-cell indices and offsets
+                  const long   fi  = Idx0[0] + i - Corner[0]/amr->scale[TLv];
+                  const long   fj  = Idx0[1] + j - Corner[1]/amr->scale[TLv];
+                  const long   fk  = Idx0[2] + k - Corner[2]/amr->scale[TLv];
+                  const int    ci  = fi/Ratio + 1;
+                  const int    cj  = fj/Ratio + 1;
+                  const int    ck  = fk/Ratio + 1;
+                  const real   dx  = ( fi%Ratio + 0.5 )*_Ratio - 0.5;
+                  const real   dy  = ( fj%Ratio + 0.5 )*_Ratio - 0.5;
+                  const real   dz  = ( fk%Ratio + 0.5 )*_Ratio - 0.5;
+                  const int    idx = ( ck*PGS + cj )*PGS + ci;
+
+                  for (int v=0; v<NCOMP_TOTAL; v++)
+                  {
+                     const real *u  = Prep_t + v*PGS3;
+                     real        uf = u[idx];
+
+                     if ( Ratio > 1 )
+                     {
+                        uf += dx*MinMod( u[idx] - u[idx-1        ], u[idx+1        ] - u[idx] );
+                        uf += dy*MinMod( u[idx] - u[idx-PGS      ], u[idx+PGS      ] - u[idx] );
+                        uf += dz*MinMod( u[idx] - u[idx-SQR(PGS) ], u[idx+SQR(PGS) ] - u[idx] );
+                     }
+
+                     Data[ v*NCell_Local + Cell ] = uf;
+                  }
+
+                  Cell ++;
+               } // i
+            } // j, k
+         } // for (int t=0; t<8*NPG_Batch; t++)
+      } // for (int PG0=0; PG0<NPG; PG0+=UG_NPG_BATCH)
+
+      delete [] PID0_List;
+   } // for (int lv=0; lv<=TLv; lv++)
+
+   if ( Cell != NCell_Local  ||  Row != NRow_Local )
+      Aux_Error( ERROR_INFO, "inconsistent number of cells (%ld != %ld) or rows (%ld != %ld) !!\n",
+                 Cell, NCell_Local, Row, NRow_Local );
+
+
+// 4. prepare the header
+   const char Magic[8]   = { 'G', 'A', 'M', 'E', 'R', 'U', 'G', 'D' };
+   const int  Int[6]     = { 1, (int)sizeof(real), NCOMP_TOTAL, UG_LABEL_LEN, TLv, 0 };
+   const long HeaderSize = sizeof(Magic) + sizeof(Int) + 4*sizeof(long) + 5*sizeof(double) + NCOMP_TOTAL*UG_LABEL_LEN;
+   char *Header = new char [HeaderSize];
+   char *Ptr    = Header;
+
+   memset( Header, 0, HeaderSize );
+
+   memcpy( Ptr, Magic,    sizeof(Magic)    );  Ptr += sizeof(Magic);
+   memcpy( Ptr, Int,      sizeof(Int)      );  Ptr += sizeof(Int);
+   memcpy( Ptr, NCell,    3*sizeof(long)   );  Ptr += 3*sizeof(long);
+   memcpy( Ptr, &Step,    sizeof(long)     );  Ptr += sizeof(long);
+   memcpy( Ptr, &Time[0], sizeof(double)   );  Ptr += sizeof(double);
+   memcpy( Ptr, &dh,      sizeof(double)   );  Ptr += sizeof(double);
+   memcpy( Ptr, EdgeL,    3*sizeof(double) );  Ptr += 3*sizeof(double);
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      const size_t LabelLen = MIN( strlen(FieldLabel[v]), (size_t)(UG_LABEL_LEN-1) );
+
+      memcpy( Ptr, FieldLabel[v], LabelLen );
+      Ptr[LabelLen] = '\0';
+      Ptr += UG_LABEL_LEN;
+   }
+
+
+// 5. write the file
+#  ifdef SERIAL
+   FILE *File = fopen( FileName, "wb" );
+
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+
+   fwrite( Header, 1, HeaderSize, File );
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   for (long r=0; r<NRow_Local; r++)
+   {
+      fseek( File, HeaderSize + ( v*NCell_Total + RowDisp[r] )*sizeof(real), SEEK_SET );
+
+      if ( fwrite( Data+v*NCell_Local+RowMem[r], sizeof(real), RowLen[r], File ) != (size_t)RowLen[r] )
+         Aux_Error( ERROR_INFO, "failed to write the file \"%s\" !!\n", FileName );
+   }
+
+   fclose( File );
+
+#  else
+
+// 5-1. construct the file and memory datatypes
+// --> displacements of the file view must be monotonically increasing
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
+   int      *Order    = new int      [ NRow_Local + 1 ];
+   int      *Len      = new int      [ NRow_Local + 1 ];
+   MPI_Aint *FileDisp = new MPI_Aint [ NRow_Local + 1 ];
+   MPI_Aint *MemDisp  = new MPI_Aint [ NRow_Local + 1 ];
+   MPI_Datatype FileType, MemType;
+
+   Mis_Heapsort( (int)NRow_Local, RowDisp, Order );
+
+   for (long r=0; r<NRow_Local; r++)
+   {
+      Len     [r] = RowLen[ Order[r] ];
+      FileDisp[r] = (MPI_Aint)RowDisp[r]*sizeof(real);
+      MemDisp [r] = (MPI_Aint)RowMem[ Order[r] ]*sizeof(real);
+   }
+
+   MPI_Type_create_hindexed( (int)NRow_Local, Len, FileDisp, RealType, &FileType );
+   MPI_Type_create_hindexed( (int)NRow_Local, Len, MemDisp,  RealType, &MemType  );
+   MPI_Type_commit( &FileType );
+   MPI_Type_commit( &MemType  );
+
+
+// 5-2. collective write field by field
+   MPI_File   File;
+   MPI_Status Status;
+
+   if (  MPI_File_open( MPI_COMM_WORLD, FileName, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &File )
+         != MPI_SUCCESS  )
+      Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+
+   MPI_File_set_size( File, 0 );
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( MPI_File_write_at( File, 0, Header, HeaderSize, MPI_BYTE, &Status ) != MPI_SUCCESS )
+         Aux_Error( ERROR_INFO, "failed to write the header of the file \"%s\" !!\n", FileName );
+   }
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      const MPI_Offset Disp = HeaderSize + (MPI_Offset)v*NCell_Total*sizeof(real);
+
+      MPI_File_set_view( File, Disp, RealType, FileType, (char*)"native", MPI_INFO_NULL );
+
+      if ( MPI_File_write_all( File, Data+v*NCell_Local, 1, MemType, &Status ) != MPI_SUCCESS )
+         Aux_Error( ERROR_INFO, "failed to write the field %d of the file \"%s\" !!\n", v, FileName );
+   }
+
+   MPI_File_close( &File );
+
+   MPI_Type_free( &FileType );
+   MPI_Type_free( &MemType  );
+
+   delete [] Order;
+   delete [] Len;
+   delete [] FileDisp;
+   delete [] MemDisp;
+#  endif // #ifdef SERIAL ... else ...
+
+
+   delete [] Data;
+   delete [] RowDisp;
+   delete [] RowMem;
+   delete [] RowLen;
+   delete [] Prep;
+   delete [] Header;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (Step = %ld) ... done\n", __FUNCTION__, Step );
+
+} // FUNCTION : Output_UniformGrid
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetOverlap
+// Description :  Check whether the target patch contributes to the uniform grid and, if so, return the
+//                overlapping index range
+//
+// Note        :  1. Patches on TLv and leaf patches below TLv contribute
+//                   --> They do not overlap with each other
+//
+// Parameter   :  lv       : Target refinement level
+//                PID      : Target patch ID
+//                TLv      : Level of the uniform grid
+//                Idx0     : Left edge of the uniform grid in the cell indices on TLv
+//                NCell    : Size of the uniform grid
+//                Lo/Hi    : Overlapping index range [Lo,Hi) relative to Idx0
+//
+// Return      :  true/false --> contribute/not contribute
+//-------------------------------------------------------------------------------------------------------
+bool GetOverlap( const int lv, const int PID, const int TLv, const long Idx0[], const long NCell[],
+                 long Lo[], long Hi[] )
+{
+
+   if ( lv < TLv  &&  amr->patch[0][lv][PID]->son != -1 )  return false;
+
+   const int *Corner = amr->patch[0][lv][PID]->corner;
+   const long Width  = (long)PS1 << ( TLv - lv );
+
+   for (int d=0; d<3; d++)
+   {
+      const long PatchIdx0 = Corner[d]/amr->scale[TLv] - Idx0[d];
+
+      Lo[d] = MAX( PatchIdx0,       0L       );
+      Hi[d] = MIN( PatchIdx0+Width, NCell[d] );
+
+      if ( Lo[d] >= Hi[d] )   return false;
+   }
+
+   return true;
+
+} // FUNCTION : GetOverlap
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MinMod
+// Description :  MinMod limiter
+//
+// Parameter   :  L/R : Left/right differences
+//
+// Return      :  Limited slope
+//-------------------------------------------------------------------------------------------------------
+real MinMod( const real L, const real R )
+{
+
+   if ( L*R <= (real)0.0 )    return (real)0.0;
+
+   return ( FABS(L) < FABS(R) ) ? L : R;
+
+} // FUNCTION : MinMod
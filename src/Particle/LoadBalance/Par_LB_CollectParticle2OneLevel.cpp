@@ -375,7 +375,7 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
                             SendBuf_ParDataEachPatch, NSendParTotal, RecvBuf_NPatchEachRank, RecvBuf_NParEachPatch,
                             RecvBuf_LBIdxEachPatch, RecvBuf_ParDataEachPatch, NRecvPatchTotal, NRecvParTotal,
                             Exchange_NPatchEachRank_Yes, Exchange_LBIdxEachRank_Yes, Exchange_ParDataEachRank,
-                            Timer[0], Timer_Comment );
+                            amr->Par->CompressMPI & PAR_COMPRESS_MPI_COLLECT_LV, Timer[0], Timer_Comment );
 
 // 2-2. free memory
    delete [] SendBuf_NPatchEachRank;
@@ -620,7 +620,8 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
 // Function    :  Par_LB_CollectParticle2OneLevel_FreeMemory
 // Description :  Release the memory allocated by Par_LB_CollectParticle2OneLevel
 //
-// Note        :  1. Invoded by Par_CollectParticle2OneLevel_FreeMemory
+// Note        :  1. Invoded by Par_CollectParticle2OneLevel_FreeMemory() and
+//                   Par_CollectParticle2OneLevel_InvalidateCache()
 //
 // Parameter   :  lv            : Target refinement level
 //                SibBufPatch   : true --> Release memory for sibling-buffer patches at lv as well
@@ -693,26 +694,8 @@ void Par_LB_CollectParticle2OneLevel_FreeMemory( const int lv, const bool SibBuf
       amr->patch[0][FaLv][FaPID]->NPar_Copy = -1;
    }
 
-
-// check: if we do everthing correctly, no patches (either real or buffer patches) at lv and lv-1
-//        should have ParMassPos_Copy allocated
-#  ifdef DEBUG_PARTICLE
-   for (int TLv=lv; (TLv>=lv-1 && TLv>=0); TLv--)
-   {
-//    loop over all real and buffer patches
-      for (int PID=0; PID<amr->num[TLv]; PID++)
-      {
-         for (int v=0; v<NParAtt; v++)
-         if ( amr->patch[0][TLv][PID]->ParMassPos_Copy[v] != NULL )
-            Aux_Error( ERROR_INFO, "lv %d, PID %d, v %d, ParMassPos_Copy != NULL !!\n",
-                       TLv, PID, v );
-
-         if ( amr->patch[0][TLv][PID]->NPar_Copy != -1 )
-            Aux_Error( ERROR_INFO, "lv %d, PID %d, NPar_Copy = %d != -1 !!\n",
-                       TLv, PID, amr->patch[0][TLv][PID]->NPar_Copy );
-      }
-   }
-#  endif // #ifdef DEBUG_PARTICLE
+// note that checking whether all patches at lv and lv-1 have been released is done by the caller
+// --> since for PAR_COLLECT_CACHE the collections at other levels may share these patches until all levels are released
 
 } // FUNCTION : Par_LB_CollectParticle2OneLevel_FreeMemory
 
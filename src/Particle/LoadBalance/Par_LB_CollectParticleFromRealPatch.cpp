@@ -274,7 +274,7 @@ void Par_LB_CollectParticleFromRealPatch( const int lv,
       SendBuf_NPatchEachRank, SendBuf_NParEachPatch, SendBuf_LBIdxEachRank, SendBuf_ParDataEachPatch, NSendParTotal,
       RecvBuf_NPatchEachRank, RecvBuf_NParEachPatch, RecvBuf_LBIdxEachRank, RecvBuf_ParDataEachPatch,
       NRecvPatchTotal, NRecvParTotal, Exchange_NPatchEachRank_No, Exchange_LBIdxEachRank_No, Exchange_ParDataEachRank_Yes,
-      Timer, Timer_Comment );
+      amr->Par->CompressMPI & PAR_COMPRESS_MPI_COLLECT_REAL, Timer, Timer_Comment );
 
 #  ifdef DEBUG_PARTICLE
    if ( NRecvPatchTotal != Buff_NPatchTotal )
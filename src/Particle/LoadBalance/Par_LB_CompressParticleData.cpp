@@ -0,0 +1,173 @@
+#include "GAMER.h"
+
+#if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+
+
+// accumulated number of bytes before and after compression for PAR_COMPRESS_MPI
+// --> reported and reset by Aux_Record_Timing()
+double Par_CompressMPI_RawByte  = 0.0;
+double Par_CompressMPI_SentByte = 0.0;
+
+static const int PackBits_MaxLiteral = 128;   // maximum number of bytes in a literal block
+static const int PackBits_MinRun     = 3;     // minimum number of identical bytes in a run block
+static const int PackBits_MaxRun     = 130;   // maximum number of identical bytes in a run block
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_LB_CompressParticleData_Bound
+// Description :  Return the maximum number of bytes returned by Par_LB_CompressParticleData()
+//
+// Parameter   :  NPar    : Number of particles
+//                NParAtt : Number of particle attributes
+//-------------------------------------------------------------------------------------------------------
+long Par_LB_CompressParticleData_Bound( const long NPar, const int NParAtt )
+{
+
+   const long NByte = NPar*NParAtt*(long)sizeof(real);
+
+   return NByte + NByte/PackBits_MaxLiteral + 1;
+
+} // FUNCTION : Par_LB_CompressParticleData_Bound
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_LB_CompressParticleData
+// Description :  Losslessly compress the particle data sent by Par_LB_SendParticleData()
+//
+// Note        :  1. Input format: [ParID][ParAttribute]
+//                2. Procedure:
+//                   (1) byte shuffle: group byte b of attribute v of all particles together
+//                       --> Attributes shared by most particles (e.g., mass, time, and type) and the sign, exponent,
+//                           and leading mantissa bytes of positions and velocities become long runs
+//                   (2) run-length encoding (PackBits): each block starts with a control byte c
+//                       --> c <  128 : c+1 literal bytes follow
+//                           c >= 128 : the next byte is repeated c-125 times
+//                3. Output never exceeds Par_LB_CompressParticleData_Bound()
+//
+// Parameter   :  Data    : Particle data to be compressed
+//                NPar    : Number of particles
+//                NParAtt : Number of particle attributes
+//                Out     : Compressed data
+//                Work    : Work array with at least NPar*NParAtt*sizeof(real) bytes
+//
+// Return      :  Number of bytes stored in Out
+//-------------------------------------------------------------------------------------------------------
+long Par_LB_CompressParticleData( const real *Data, const long NPar, const int NParAtt, char *Out, char *Work )
+{
+
+   const int  NBytePerVar = sizeof(real);
+   const long NByte       = NPar*NParAtt*NBytePerVar;
+   const unsigned char *In = (const unsigned char*)Data;
+   unsigned char *Shuffle  = (unsigned char*)Work;
+   unsigned char *Dest     = (unsigned char*)Out;
+
+
+// 1. byte shuffle
+   long t = 0;
+   for (int v=0; v<NParAtt; v++)
+   for (int b=0; b<NBytePerVar; b++)
+   for (long p=0; p<NPar; p++)
+      Shuffle[ t ++ ] = In[ ( p*NParAtt + v )*NBytePerVar + b ];
+
+
+// 2. PackBits
+   long i = 0, o = 0;
+
+   while ( i < NByte )
+   {
+//    2-1. run block
+      long Run = 1;
+      while ( i+Run < NByte  &&  Run < PackBits_MaxRun  &&  Shuffle[i+Run] == Shuffle[i] )   Run ++;
+
+      if ( Run >= PackBits_MinRun )
+      {
+         Dest[ o ++ ] = (unsigned char)( Run + 125 );
+         Dest[ o ++ ] = Shuffle[i];
+         i += Run;
+         continue;
+      }
+
+//    2-2. literal block: stop before the next run
+      long NLit = 0;
+      while ( i+NLit < NByte  &&  NLit < PackBits_MaxLiteral )
+      {
+         if ( i+NLit+2 < NByte  &&  Shuffle[i+NLit] == Shuffle[i+NLit+1]  &&  Shuffle[i+NLit] == Shuffle[i+NLit+2] )
+            break;
+
+         NLit ++;
+      }
+
+      Dest[ o ++ ] = (unsigned char)( NLit - 1 );
+      memcpy( Dest+o, Shuffle+i, NLit );
+      o += NLit;
+      i += NLit;
+   } // while ( i < NByte )
+
+   return o;
+
+} // FUNCTION : Par_LB_CompressParticleData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_LB_DecompressParticleData
+// Description :  Inverse of Par_LB_CompressParticleData()
+//
+// Parameter   :  In      : Compressed data
+//                NByteIn : Number of bytes in In
+//                NPar    : Number of particles
+//                NParAtt : Number of particle attributes
+//                Data    : Decompressed particle data with the format [ParID][ParAttribute]
+//                Work    : Work array with at least NPar*NParAtt*sizeof(real) bytes
+//-------------------------------------------------------------------------------------------------------
+void Par_LB_DecompressParticleData( const char *In, const long NByteIn, const long NPar, const int NParAtt,
+                                    real *Data, char *Work )
+{
+
+   const int  NBytePerVar = sizeof(real);
+   const long NByte       = NPar*NParAtt*NBytePerVar;
+   const unsigned char *Src = (const unsigned char*)In;
+   unsigned char *Shuffle   = (unsigned char*)Work;
+   unsigned char *Out       = (unsigned char*)Data;
+
+
+// 1. PackBits
+   long i = 0, o = 0;
+
+   while ( i < NByteIn )
+   {
+      const int c = Src[ i ++ ];
+
+      if ( c < 128 )
+      {
+         memcpy( Shuffle+o, Src+i, c+1 );
+         i += c + 1;
+         o += c + 1;
+      }
+
+      else
+      {
+         memset( Shuffle+o, Src[ i ++ ], c-125 );
+         o += c - 125;
+      }
+   }
+
+   if ( o != NByte )
+      Aux_Error( ERROR_INFO, "number of decompressed bytes (%ld) != expected (%ld) !!\n", o, NByte );
+
+
+// 2. byte unshuffle
+   long t = 0;
+   for (int v=0; v<NParAtt; v++)
+   for (int b=0; b<NBytePerVar; b++)
+   for (long p=0; p<NPar; p++)
+      Out[ ( p*NParAtt + v )*NBytePerVar + b ] = Shuffle[ t ++ ];
+
+} // FUNCTION : Par_LB_DecompressParticleData
+
+
+
+#endif // #if ( defined PARTICLE  &&  defined LOAD_BALANCE )
@@ -114,7 +114,8 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
 
 // 1. get the number of particles to be sent
-   int *SendBuf_NParEachPatch = new int [Send_NPatchTotal];
+   int  *SendBuf_NParEachPatch   = new int  [Send_NPatchTotal];
+   long *SendBuf_OffsetEachPatch = new long [Send_NPatchTotal];   // offset of each patch in the send buffer
 
    int PID, NParThisPatch, NSendParTotal = 0;
 
@@ -130,21 +131,40 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
                     NParThisPatch, lv, PID );
 #     endif
 
-      NSendParTotal            += NParThisPatch;
-      SendBuf_NParEachPatch[t]  = NParThisPatch;
+      SendBuf_OffsetEachPatch[t]  = (long)NSendParTotal*PAR_NATT_TOTAL;
+      NSendParTotal              += NParThisPatch;
+      SendBuf_NParEachPatch  [t]  = NParThisPatch;
    } // for (int t=0; t<Send_NPatchTotal; t++)
 
 
 // 2. prepare the particle data to be sent (and then remove these particles from this rank)
+// --> Send_PIDList[] is sorted by target rank, and thus the send buffer is already contiguous for each rank
    const bool RemoveAllPar_Yes = true;
 
 // reuse the MPI send buffer declared in LB_GetBufferData for better MPI performance
    real *SendBuf_ParDataEachPatch = LB_GetBufferData_MemAllocate_Send( NSendParTotal*PAR_NATT_TOTAL );
 
-   real *SendPtr = SendBuf_ParDataEachPatch;
-   long *ParList = NULL;
-   long  ParID;
+// 2-1. store particle data into the MPI send buffer
+// --> the offset of each patch is known in advance, so different patches can be packed in parallel
+#  pragma omp parallel for schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+   for (int t=0; t<Send_NPatchTotal; t++)
+   {
+      const int   NPar    = SendBuf_NParEachPatch[t];
+      const long *ParList = amr->patch[0][lv][ Send_PIDList[t] ]->ParList;
+      real       *SendPtr = SendBuf_ParDataEachPatch + SendBuf_OffsetEachPatch[t];
+
+#     ifdef DEBUG_PARTICLE
+      if ( NPar > 0  &&  ParList == NULL )
+         Aux_Error( ERROR_INFO, "ParList == NULL for NParThisPatch (%d) > 0 (lv %d, PID %d) !!\n",
+                    NPar, lv, Send_PIDList[t] );
+#     endif
 
+      for (int p=0; p<NPar; p++)
+      for (int v=0; v<PAR_NATT_TOTAL; v++)   *SendPtr++ = amr->Par->Attribute[v][ ParList[p] ];
+   }
+
+// 2-2. remove these particles from the particle repository and the send patches of this rank
+// --> no OpenMP since RemoveOneParticle() modifies the global variables NPar_Active/Inactive
    for (int t=0; t<Send_NPatchTotal; t++)
    {
       PID           = Send_PIDList         [t];
@@ -153,26 +173,9 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 //    skip patches with no particles
       if ( NParThisPatch == 0 )  continue;
 
-      ParList = amr->patch[0][lv][PID]->ParList;
-
-#     ifdef DEBUG_PARTICLE
-      if ( ParList == NULL )
-         Aux_Error( ERROR_INFO, "ParList == NULL for NParThisPatch (%d) > 0 (lv %d, PID %d) !!\n",
-                    NParThisPatch, lv, PID );
-#     endif
-
       for (int p=0; p<NParThisPatch; p++)
-      {
-         ParID = ParList[p];
-
-//       2-1. store particle data into the MPI send buffer
-         for (int v=0; v<PAR_NATT_TOTAL; v++)   *SendPtr++ = amr->Par->Attribute[v][ParID];
-
-//       2-2. remove this particle from the particle repository of this rank
-         amr->Par->RemoveOneParticle( ParID, PAR_INACTIVE_MPI );
-      }
+         amr->Par->RemoveOneParticle( amr->patch[0][lv][PID]->ParList[p], PAR_INACTIVE_MPI );
 
-//    2-3. remove all particles in this send patch
       amr->patch[0][lv][PID]->RemoveParticle( NULL_INT, NULL, &amr->Par->NPar_Lv[lv], RemoveAllPar_Yes );
    } // for (int t=0; t<Send_NPatchTotal; t++)
 
@@ -199,7 +202,7 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
       SendBuf_NPatchEachRank, SendBuf_NParEachPatch, SendBuf_LBIdxEachRank, SendBuf_ParDataEachPatch, NSendParTotal,
       RecvBuf_NPatchEachRank, RecvBuf_NParEachPatch, RecvBuf_LBIdxEachRank, RecvBuf_ParDataEachPatch,
       NRecvPatchTotal, NRecvParTotal, Exchange_NPatchEachRank_No, Exchange_LBIdxEachRank_No, Exchange_ParDataEachRank_Yes,
-      Timer, Timer_Comment );
+      amr->Par->CompressMPI & PAR_COMPRESS_MPI_EXCHANGE, Timer, Timer_Comment );
 
 #  ifdef DEBUG_PARTICLE
    if ( NRecvPatchTotal != Recv_NPatchTotal )
@@ -209,6 +212,7 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
 // free the send buffer in advance to save memory
    delete [] SendBuf_NParEachPatch;
+   delete [] SendBuf_OffsetEachPatch;
 
 
 // 4. store the received particle data to the particle repository and link to each recv patch
@@ -223,34 +227,36 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
    NewParIDList = new long [NParThisPatch_Max];
 
+// enlarge the particle repository only once for all received particles
+   amr->Par->Reserve( NRecvParTotal );
+
 
    for (int t=0; t<Recv_NPatchTotal; t++)
    {
       NParThisPatch = RecvBuf_NParEachPatch[t];
 
 //    4-2. add particles to the particle repository
+      amr->Par->AddParticles( NParThisPatch, RecvPtr, NewParIDList );
+      RecvPtr += (long)NParThisPatch*PAR_NATT_TOTAL;
+
+//    we do not transfer inactive particles
+#     ifdef DEBUG_PARTICLE
       for (int p=0; p<NParThisPatch; p++)
       {
-         ParID    = amr->Par->AddOneParticle( RecvPtr );
-         RecvPtr += PAR_NATT_TOTAL;
+         const long ParID = NewParIDList[p];
 
-//       store the new particle index
-         NewParIDList[p] = ParID;
-
-//       we do not transfer inactive particles
-#        ifdef DEBUG_PARTICLE
          if ( amr->Par->Attribute[PAR_MASS][ParID] < (real)0.0 )
             Aux_Error( ERROR_INFO, "Find inactive particle (ParID %d, Mass %14.7e) !!\n",
                        ParID, amr->Par->Attribute[PAR_MASS][ParID] );
-#        endif
       }
+#     endif
 
 //    4-3. add particles to the recv patch
       PID = Recv_PIDList[t];
 
 #     ifdef DEBUG_PARTICLE
 //    do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//    may change after calling amr->Par->AddOneParticle
+//    may change after calling amr->Par->AddParticles()
       const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
       char Comment[100];
       sprintf( Comment, "%s", __FUNCTION__ );
@@ -3,6 +3,10 @@
 #if ( defined PARTICLE  &&  defined LOAD_BALANCE )
 
 
+// defined in Par_LB_CompressParticleData.cpp
+extern double Par_CompressMPI_RawByte;
+extern double Par_CompressMPI_SentByte;
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -19,6 +23,9 @@
 //                   Par_LB_ExchangeParticleBetweenPatch()
 //                   --> Par_LB_ExchangeParticleBetweenPatch() is called by
 //                       Par_PassParticle2Sibling() and Par_PassParticle2Son_MultiPatch()
+//                5. Particle attributes can be compressed losslessly by Par_LB_CompressParticleData()
+//                   --> Enabled for each caller by PAR_COMPRESS_MPI
+//                   --> Number of bytes before and after compression is reported in Record__Timing
 //
 // Parameter   :  NParAtt                  : Number of particle attributes to be sent
 //                SendBuf_NPatchEachRank   : MPI send buffer --> number of patches sent to each rank
@@ -40,6 +47,7 @@
 //                                                   --> RecvBuf_LBIdxEachPatch will NOT be allocated
 //                                                   --> Useful in Par_LB_CollectParticleFromRealPatch.cpp
 //                Exchange_ParDataEachRank : true  : Exchange SendBuf_ParDataEachPatch to get RecvBuf_ParDataEachPatch
+//                Compress                 : true  : Compress SendBuf_ParDataEachPatch before sending
 //                Timer                    : Timer used by the options "TIMING" and "OPT__TIMING_MPI"
 //                                           --> Do nothing if Timer == NULL
 //                Timer_Comment            : String used by "OPT__TIMING_MPI"
@@ -54,7 +62,7 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
                               int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
                               real *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, int &NRecvParTotal,
                               const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
-                              const bool Exchange_ParDataEachRank, Timer_t *Timer, const char *Timer_Comment )
+                              const bool Exchange_ParDataEachRank, const bool Compress, Timer_t *Timer, const char *Timer_Comment )
 {
 
 // check
@@ -187,13 +195,95 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
       RecvBuf_ParDataEachPatch = LB_GetBufferData_MemAllocate_Recv( NRecvParTotal*NParAtt );
 
 //    exchange data
-#     ifdef FLOAT8
-      MPI_Alltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_DOUBLE,
-                     RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_DOUBLE, MPI_COMM_WORLD );
-#     else
-      MPI_Alltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_FLOAT,
-                     RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_FLOAT,  MPI_COMM_WORLD );
-#     endif
+      if ( Compress )
+      {
+         int *SendCount_Byte = new int [MPI_NRank];
+         int *RecvCount_Byte = new int [MPI_NRank];
+         int *SendDisp_Byte  = new int [MPI_NRank];
+         int *RecvDisp_Byte  = new int [MPI_NRank];
+
+//       compress the data sent to each rank
+//       --> the compressed data of each rank start at the maximum possible offset
+         long SendBound = 0;
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            if ( SendBound > __INT_MAX__ )
+               Aux_Error( ERROR_INFO, "compressed send buffer offset (%ld) exceeds the maximum integer !!\n", SendBound );
+
+            SendDisp_Byte[r] = (int)SendBound;
+            SendBound       += Par_LB_CompressParticleData_Bound( SendCount_ParDataEachPatch[r]/NParAtt, NParAtt );
+         }
+
+         char *SendBuf_Byte = new char [SendBound];
+         char *SendWork     = new char [ ( (long)SendDisp_ParDataEachPatch[MPI_NRank-1] +
+                                            SendCount_ParDataEachPatch[MPI_NRank-1] )*sizeof(real) ];
+
+#        pragma omp parallel for schedule( runtime )
+         for (int r=0; r<MPI_NRank; r++)
+            SendCount_Byte[r] = (int)Par_LB_CompressParticleData( SendBuf_ParDataEachPatch + SendDisp_ParDataEachPatch[r],
+                                                                  SendCount_ParDataEachPatch[r]/NParAtt, NParAtt,
+                                                                  SendBuf_Byte + SendDisp_Byte[r],
+                                                                  SendWork + (long)SendDisp_ParDataEachPatch[r]*sizeof(real) );
+
+         delete [] SendWork;
+
+//       record the number of bytes sent to other ranks
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            if ( r == MPI_Rank )    continue;
+
+            Par_CompressMPI_RawByte  += (double)SendCount_ParDataEachPatch[r]*sizeof(real);
+            Par_CompressMPI_SentByte += (double)SendCount_Byte[r];
+         }
+
+//       exchange the compressed data
+         MPI_Alltoall( SendCount_Byte, 1, MPI_INT, RecvCount_Byte, 1, MPI_INT, MPI_COMM_WORLD );
+
+         long RecvNByte = 0;
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            if ( RecvNByte > __INT_MAX__ )
+               Aux_Error( ERROR_INFO, "compressed recv buffer offset (%ld) exceeds the maximum integer !!\n", RecvNByte );
+
+            RecvDisp_Byte[r] = (int)RecvNByte;
+            RecvNByte       += RecvCount_Byte[r];
+         }
+
+         char *RecvBuf_Byte = new char [RecvNByte];
+
+         MPI_Alltoallv( SendBuf_Byte, SendCount_Byte, SendDisp_Byte, MPI_BYTE,
+                        RecvBuf_Byte, RecvCount_Byte, RecvDisp_Byte, MPI_BYTE, MPI_COMM_WORLD );
+
+         delete [] SendBuf_Byte;
+
+//       decompress the data received from each rank
+         char *RecvWork = new char [ (long)NRecvParTotal*NParAtt*sizeof(real) ];
+
+#        pragma omp parallel for schedule( runtime )
+         for (int r=0; r<MPI_NRank; r++)
+            Par_LB_DecompressParticleData( RecvBuf_Byte + RecvDisp_Byte[r], RecvCount_Byte[r],
+                                           RecvCount_ParDataEachPatch[r]/NParAtt, NParAtt,
+                                           RecvBuf_ParDataEachPatch + RecvDisp_ParDataEachPatch[r],
+                                           RecvWork + (long)RecvDisp_ParDataEachPatch[r]*sizeof(real) );
+
+         delete [] RecvWork;
+         delete [] RecvBuf_Byte;
+         delete [] SendCount_Byte;
+         delete [] RecvCount_Byte;
+         delete [] SendDisp_Byte;
+         delete [] RecvDisp_Byte;
+      } // if ( Compress )
+
+      else
+      {
+#        ifdef FLOAT8
+         MPI_Alltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_DOUBLE,
+                        RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_DOUBLE, MPI_COMM_WORLD );
+#        else
+         MPI_Alltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_FLOAT,
+                        RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_FLOAT,  MPI_COMM_WORLD );
+#        endif
+      } // if ( Compress ) ... else ...
 
 //    free memory
       delete [] SendCount_ParDataEachPatch;
@@ -37,6 +37,10 @@ void Par_Aux_Check_Particle( const char *comment )
    int     PassCheck[NCheck];
 
 
+// release the particles collected by Par_CollectParticle2OneLevel() for Check 10
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // initialize the check list
    for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)   ParHome[p] = false;
 
@@ -26,6 +26,10 @@ void Par_Aux_InitCheck()
    real *Pos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after removing particles
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // 1. all active particles should lie within the simulation domain
 //    --> periodicity should be taken care of in the initial condition, not here
    for (long ParID=0; ParID<amr->Par->NPar_AcPlusInac; ParID++)
@@ -5,12 +5,37 @@
 # ifndef LOAD_BALANCE
 static void CollectParticle( const int FaLv, const int FaPID, int &NPar_SoFar, long *ParList );
 #endif
+static bool CollectCache_Match( const int FaLv, const bool PredictPos, const double TargetTime,
+                                const bool SibBufPatch, const bool FaSibBufPatch, const bool JustCountNPar );
+static void CollectCache_Free( const int FaLv );
+static void FreeCollection( const int FaLv, const bool SibBufPatch, const bool FaSibBufPatch );
+#ifdef DEBUG_PARTICLE
+static void CheckCollectionFreed( const int lv_min, const int lv_max );
+#endif
 
 // flag (declared in Prepare_PatchData.cpp) for checking whether Par_CollectParticle2OneLevel() has been called before
 // preparing either _PAR_DENS or _TOTAL_DENS data in Prepare_PatchData()
 extern bool Particle_Collected;
 
 
+// cache of the collected particles for PAR_COLLECT_CACHE
+// --> one entry for each level recording the options of the collection still stored in NPar_Copy, ParList_Copy[],
+//     and ParMassPos_Copy[]
+// --> an entry is reused as long as no particle has been moved since then (i.e., no call to
+//     Par_CollectParticle2OneLevel_InvalidateCache())
+struct CollectCache_t
+{
+   bool   Valid;
+   bool   PredictPos;
+   double TargetTime;
+   bool   SibBufPatch;
+   bool   FaSibBufPatch;
+   bool   JustCountNPar;
+};
+
+static CollectCache_t CollectCache[NLEVEL];
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -50,6 +75,10 @@ extern bool Particle_Collected;
 //                   --> Do NOT collect particle indices
 //                       --> ParList_Copy will NOT be allocated
 //                   --> Particle count is stored in NPar_Copy
+//                9. For PAR_COLLECT_CACHE, the previous collection at FaLv is reused if no particle has been moved
+//                   since then and it covers all the data requested here
+//                   --> Skip both the tree traversal and the MPI exchange of Par_LB_CollectParticle2OneLevel()
+//                   --> See CollectCache_Match() for the criteria
 //
 // Parameter   :  FaLv          : Target refinement leve
 //                PredictPos    : true --> Predict particle position to TargetTime (for LOAD_BALANCE only)
@@ -75,6 +104,35 @@ void Par_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, const
    Particle_Collected = true;
 
 
+// reuse the cached collection if applicable
+   if ( amr->Par->CollectCache )
+   {
+      if (  CollectCache_Match( FaLv, PredictPos, TargetTime, SibBufPatch, FaSibBufPatch, JustCountNPar )  )  return;
+
+//    release the outdated collection at FaLv
+      CollectCache_Free( FaLv );
+
+//    release the collections at adjacent levels sharing the same buffer patches
+//    --> sibling-buffer patches at FaLv may also be the father-sibling-buffer patches of FaLv+1
+#     ifdef LOAD_BALANCE
+      if ( SibBufPatch  &&  FaLv+1 < NLEVEL  &&  CollectCache[FaLv+1].FaSibBufPatch )  CollectCache_Free( FaLv+1 );
+      if ( FaSibBufPatch  &&  FaLv > 0  &&  CollectCache[FaLv-1].SibBufPatch )          CollectCache_Free( FaLv-1 );
+#     endif
+
+      CollectCache[FaLv].Valid         = true;
+      CollectCache[FaLv].PredictPos    = PredictPos;
+      CollectCache[FaLv].TargetTime    = TargetTime;
+#     ifdef LOAD_BALANCE
+      CollectCache[FaLv].SibBufPatch   = SibBufPatch;
+      CollectCache[FaLv].FaSibBufPatch = FaSibBufPatch;
+#     else
+      CollectCache[FaLv].SibBufPatch   = false;
+      CollectCache[FaLv].FaSibBufPatch = false;
+#     endif
+      CollectCache[FaLv].JustCountNPar = JustCountNPar;
+   } // if ( amr->Par->CollectCache )
+
+
 // call the parallel version instead
 #  ifdef LOAD_BALANCE
 // note that if SibBufPatch or FaSibBufPatch is on, we need to call Par_LB_CollectParticle2OneLevel
@@ -174,6 +232,8 @@ void Par_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, const
 // Note        :  1. Invoded by Gra_AdvanceDt (and Main when DEBUG is on)
 //                2. For LOAD_BALANCE, this function will call the alternative function
 //                   "Par_LB_CollectParticle2OneLevel_FreeMemory"
+//                3. Do nothing but reset Particle_Collected for PAR_COLLECT_CACHE
+//                   --> Memory is released by Par_CollectParticle2OneLevel_InvalidateCache() instead
 //
 // Parameter   :  FaLv          : Target refinement leve
 //                SibBufPatch   : true --> Release memory for sibling-buffer patches at FaLv as well (for LOAD_BALANCE only)
@@ -190,6 +250,128 @@ void Par_CollectParticle2OneLevel_FreeMemory( const int FaLv, const bool SibBufP
    Particle_Collected = false;
 
 
+// keep the collection for PAR_COLLECT_CACHE
+   if ( amr->Par->CollectCache )    return;
+
+
+   FreeCollection( FaLv, SibBufPatch, FaSibBufPatch );
+
+// check: if we do everthing correctly, no patches (either real or buffer patches) at FaLv and FaLv-1
+//        should have particles collected
+#  ifdef DEBUG_PARTICLE
+   CheckCollectionFreed( MAX(FaLv-1,0), FaLv );
+#  endif
+
+} // FUNCTION : Par_CollectParticle2OneLevel_FreeMemory
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_CollectParticle2OneLevel_InvalidateCache
+// Description :  Release the collections cached by Par_CollectParticle2OneLevel() for PAR_COLLECT_CACHE
+//
+// Note        :  1. Must be called before moving, adding, or removing any particle and before modifying the
+//                   patch hierarchy
+//                   --> Currently invoked by Par_UpdateParticle(), Par_PassParticle2Sibling(),
+//                       Par_PassParticle2Son_MultiPatch(), Par_FindHomePatch_UniformGrid(), Par_SortByPatch(),
+//                       Par_Synchronize(), Par_Synchronize_Restore(), Par_Aux_Check_Particle(),
+//                       Par_Aux_InitCheck(), SF_CreateStar(), Refine(), Init_Refine(), LB_Init_Refine(),
+//                       LB_Init_LoadBalance(), and End_MemFree()
+//                   --> User-defined routines modifying particles must call it as well
+//                2. Must be invoked by all ranks since the cache decides whether to skip the MPI exchange in
+//                   Par_LB_CollectParticle2OneLevel()
+//                3. Release all levels since particles at one level are collected by all coarser levels
+//                4. Also invalidate the particle density cached in rho_ext[] for PAR_DENS_CACHE
+//                5. Do nothing else if PAR_COLLECT_CACHE is off
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Par_CollectParticle2OneLevel_InvalidateCache()
+{
+
+   Prepare_PatchData_InvalidateParticleDensityArray();
+
+   if ( !amr->Par->CollectCache )   return;
+
+   for (int lv=0; lv<NLEVEL; lv++)  CollectCache_Free( lv );
+
+#  ifdef DEBUG_PARTICLE
+   CheckCollectionFreed( 0, TOP_LEVEL );
+#  endif
+
+} // FUNCTION : Par_CollectParticle2OneLevel_InvalidateCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CollectCache_Match
+// Description :  Check whether the cached collection at FaLv covers all the data requested by
+//                Par_CollectParticle2OneLevel()
+//
+// Note        :  1. JustCountNPar only requires NPar_Copy of real patches, which is set by any collection
+//                2. For LOAD_BALANCE, ParMassPos_Copy[] stores the predicted particle positions, and the
+//                   sibling-buffer and father-sibling-buffer patches must have been collected if requested
+//                3. For non-LOAD_BALANCE, ParList_Copy[] does not depend on the other options
+//
+// Parameter   :  See Par_CollectParticle2OneLevel()
+//
+// Return      :  true/false --> reuse/do not reuse the cached collection
+//-------------------------------------------------------------------------------------------------------
+bool CollectCache_Match( const int FaLv, const bool PredictPos, const double TargetTime,
+                         const bool SibBufPatch, const bool FaSibBufPatch, const bool JustCountNPar )
+{
+
+   const CollectCache_t *Cache = CollectCache + FaLv;
+
+   if ( !Cache->Valid )          return false;
+   if ( JustCountNPar )          return true;
+   if ( Cache->JustCountNPar )   return false;
+
+#  ifdef LOAD_BALANCE
+   if ( SibBufPatch    &&  !Cache->SibBufPatch   )    return false;
+   if ( FaSibBufPatch  &&  !Cache->FaSibBufPatch )    return false;
+   if ( PredictPos != Cache->PredictPos )             return false;
+   if ( PredictPos  &&  TargetTime != Cache->TargetTime )   return false;
+#  endif
+
+   return true;
+
+} // FUNCTION : CollectCache_Match
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CollectCache_Free
+// Description :  Release the cached collection at FaLv (if any)
+//
+// Parameter   :  FaLv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void CollectCache_Free( const int FaLv )
+{
+
+   if ( !CollectCache[FaLv].Valid )    return;
+
+   FreeCollection( FaLv, CollectCache[FaLv].SibBufPatch, CollectCache[FaLv].FaSibBufPatch );
+
+   CollectCache[FaLv].Valid         = false;
+   CollectCache[FaLv].SibBufPatch   = false;
+   CollectCache[FaLv].FaSibBufPatch = false;
+
+} // FUNCTION : CollectCache_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FreeCollection
+// Description :  Release the memory allocated by Par_CollectParticle2OneLevel() at FaLv
+//
+// Parameter   :  See Par_CollectParticle2OneLevel_FreeMemory()
+//-------------------------------------------------------------------------------------------------------
+void FreeCollection( const int FaLv, const bool SibBufPatch, const bool FaSibBufPatch )
+{
+
 #  ifdef LOAD_BALANCE
 
    Par_LB_CollectParticle2OneLevel_FreeMemory( FaLv, SibBufPatch, FaSibBufPatch );
@@ -210,7 +392,40 @@ void Par_CollectParticle2OneLevel_FreeMemory( const int FaLv, const bool SibBufP
 
 #  endif // #ifdef LOAD_BALANCE ... else ...
 
-} // FUNCTION : Par_CollectParticle2OneLevel_FreeMemory
+} // FUNCTION : FreeCollection
+
+
+
+#ifdef DEBUG_PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckCollectionFreed
+// Description :  Check that no patches (either real or buffer patches) at lv_min <= lv <= lv_max have
+//                particles collected
+//
+// Parameter   :  lv_min/max : Target range of refinement levels
+//-------------------------------------------------------------------------------------------------------
+void CheckCollectionFreed( const int lv_min, const int lv_max )
+{
+
+   for (int lv=lv_min; lv<=lv_max; lv++)
+   for (int PID=0; PID<amr->num[lv]; PID++)
+   {
+#     ifdef LOAD_BALANCE
+      for (int v=0; v<4; v++)
+      if ( amr->patch[0][lv][PID]->ParMassPos_Copy[v] != NULL )
+         Aux_Error( ERROR_INFO, "lv %d, PID %d, v %d, ParMassPos_Copy != NULL !!\n", lv, PID, v );
+#     else
+      if ( amr->patch[0][lv][PID]->ParList_Copy != NULL )
+         Aux_Error( ERROR_INFO, "lv %d, PID %d, ParList_Copy != NULL !!\n", lv, PID );
+#     endif
+
+      if ( amr->patch[0][lv][PID]->NPar_Copy != -1 )
+         Aux_Error( ERROR_INFO, "lv %d, PID %d, NPar_Copy = %d != -1 !!\n",
+                    lv, PID, amr->patch[0][lv][PID]->NPar_Copy );
+   }
+
+} // FUNCTION : CheckCollectionFreed
+#endif // #ifdef DEBUG_PARTICLE
 
 
 
@@ -249,9 +464,9 @@ void CollectParticle( const int FaLv, const int FaPID, int &NPar_SoFar, long *Pa
 //       search over all grandsons recursively
          if ( amr->patch[0][SonLv][SonPID]->son != -1 )  CollectParticle( SonLv, SonPID, NPar_SoFar, ParList );
 
-         else
-            for (int p=0; p<amr->patch[0][SonLv][SonPID]->NPar; p++)
-               ParList[ NPar_SoFar ++ ] = amr->patch[0][SonLv][SonPID]->ParList[p];
+//       include particles temporarily residing in non-leaf sons to be consistent with Par_CountParticleInDescendant()
+         for (int p=0; p<amr->patch[0][SonLv][SonPID]->NPar; p++)
+            ParList[ NPar_SoFar ++ ] = amr->patch[0][SonLv][SonPID]->ParList[p];
       }
    }
 
@@ -2,13 +2,24 @@
 
 #ifdef PARTICLE
 
+#ifdef DEBUG_PARTICLE
+static int CountParticleInDescendant_Recursive( const int FaLv, const int FaPID );
+#endif
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Par_CountParticleInDescendant
 // Description :  Count the number of particles in all descendants (sons, grandsons, ...) of the target patch
 //
-// Note        :  This function will search over all descendants recursively
+// Note        :  1. Return the descendant count patch_t::NPar_Desc maintained incrementally by
+//                   Par_UpdateDescendantCount()
+//                   --> O(1) instead of searching over all descendants recursively
+//                   --> The recursive count is still performed to validate NPar_Desc when DEBUG_PARTICLE is on
+//                2. For SERIAL only
+//                   --> For LOAD_BALANCE, descendants may live in other ranks and particles must be counted by
+//                       Par_LB_CollectParticle2OneLevel() instead
 //
 // Parameter   :  FaLv  : Father patch level
 //                FaPID : Father patch ID
@@ -21,8 +32,86 @@ int Par_CountParticleInDescendant( const int FaLv, const int FaPID )
 // check
 #  ifdef DEBUG_PARTICLE
    if ( FaLv < 0  ||  FaLv > TOP_LEVEL )  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "FaLv", FaLv );
+
+#  ifdef LOAD_BALANCE
+   Aux_Error( ERROR_INFO, "this function does NOT support LOAD_BALANCE !!\n" );
 #  endif
+#  endif
+
+
+   const int NPar_Sum = ( amr->patch[0][FaLv][FaPID]->son == -1 ) ? 0 : amr->patch[0][FaLv][FaPID]->NPar_Desc;
+
+#  ifdef DEBUG_PARTICLE
+   const int NPar_Check = CountParticleInDescendant_Recursive( FaLv, FaPID );
+
+   if ( NPar_Sum != NPar_Check )
+      Aux_Error( ERROR_INFO, "NPar_Desc (%d) != number of particles in descendants (%d) (FaLv %d, FaPID %d) !!\n",
+                 NPar_Sum, NPar_Check, FaLv, FaPID );
+#  endif
+
+   return NPar_Sum;
+
+} // FUNCTION : Par_CountParticleInDescendant
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_UpdateDescendantCount
+// Description :  Update the descendant particle count (patch_t::NPar_Desc) of all ancestors (father, grandfather,
+//                ...) of the target patch
+//
+// Note        :  1. Must be invoked whenever particles are added to or removed from a patch by
+//                   patch_t::AddParticle() or patch_t::RemoveParticle()
+//                   --> Passing particles from father to sons (or vice versa) thus updates only NPar_Desc of the
+//                       father since the contributions to the other ancestors cancel out
+//                2. Thread-safe
+//                3. Do nothing for LOAD_BALANCE
+//                   --> See Par_CountParticleInDescendant()
+//
+// Parameter   :  lv    : Target refinement level
+//                PID   : Target patch index
+//                dNPar : Number of particles added to (> 0) or removed from (< 0) the target patch
+//-------------------------------------------------------------------------------------------------------
+void Par_UpdateDescendantCount( const int lv, const int PID, const int dNPar )
+{
 
+#  ifndef LOAD_BALANCE
+   if ( dNPar == 0 )    return;
+
+   int FaPID = amr->patch[0][lv][PID]->father;
+
+   for (int FaLv=lv-1; FaLv>=0; FaLv--)
+   {
+#     ifdef DEBUG_PARTICLE
+      if ( FaPID < 0 )  Aux_Error( ERROR_INFO, "FaPID = %d < 0 (lv %d, PID %d, FaLv %d) !!\n", FaPID, lv, PID, FaLv );
+#     endif
+
+#     pragma omp atomic
+      amr->patch[0][FaLv][FaPID]->NPar_Desc += dNPar;
+
+      FaPID = amr->patch[0][FaLv][FaPID]->father;
+   }
+#  endif // #ifndef LOAD_BALANCE
+
+} // FUNCTION : Par_UpdateDescendantCount
+
+
+
+#ifdef DEBUG_PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CountParticleInDescendant_Recursive
+// Description :  Count the number of particles in all descendants of the target patch by searching over all
+//                descendants recursively
+//
+// Note        :  1. Invoked by Par_CountParticleInDescendant() to validate NPar_Desc
+//
+// Parameter   :  FaLv  : Father patch level
+//                FaPID : Father patch ID
+//
+// Return      :  NPar_Sum
+//-------------------------------------------------------------------------------------------------------
+int CountParticleInDescendant_Recursive( const int FaLv, const int FaPID )
+{
 
    const int SonPID0 = amr->patch[0][FaLv][FaPID]->son;
    const int SonLv   = FaLv + 1;
@@ -35,14 +124,18 @@ int Par_CountParticleInDescendant( const int FaLv, const int FaPID )
       for (int SonPID=SonPID0; SonPID<SonPID0+8; SonPID++)
       {
 //       search over all descendants recursively
-         if ( amr->patch[0][SonLv][SonPID]->son != -1 )  NPar_Sum += Par_CountParticleInDescendant( SonLv, SonPID );
-         else                                            NPar_Sum += amr->patch[0][SonLv][SonPID]->NPar;
+//       --> include NPar of non-leaf patches since NPar_Desc counts particles waiting for the velocity correction
+//           in the non-leaf descendants as well
+         NPar_Sum += amr->patch[0][SonLv][SonPID]->NPar;
+
+         if ( amr->patch[0][SonLv][SonPID]->son != -1 )  NPar_Sum += CountParticleInDescendant_Recursive( SonLv, SonPID );
       }
    }
 
    return NPar_Sum;
 
-} // FUNCTION : Par_CountParticleInDescendant
+} // FUNCTION : CountParticleInDescendant_Recursive
+#endif // #ifdef DEBUG_PARTICLE
 
 
 
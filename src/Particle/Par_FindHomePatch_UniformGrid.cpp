@@ -52,6 +52,10 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly,
 #  endif
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after redistributing particles
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // record the number of old particles before it is overwritten by SendParticle2HomeRank()
    const long NOldPar = ( OldParOnly ) ? 0 : amr->Par->NPar_AcPlusInac;
 
@@ -66,24 +70,12 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly,
    const real *Pos[3]    = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
    const int   NReal     = amr->NPatchComma[lv][1];
 
-   real TParPos[3];
-
-   long *HomeLBIdx          = new long [NTarPar];
-   int  *HomeLBIdx_IdxTable = new int  [NTarPar];
-   int  *HomePID            = new int  [NTarPar];
-   int  *MatchIdx           = new int  [NTarPar];
-
-// get the load-balance index of the particle's home patch
-   for (long t=0; t<NTarPar; t++)
-   {
-      for (int d=0; d<3; d++)    TParPos[d] = Pos[d][ NewParID0 + t ];
-      HomeLBIdx[t] = ParPos2LBIdx( lv, TParPos );
-   }
-
-// sort the LBIdx list
-   Mis_Heapsort( NTarPar, HomeLBIdx, HomeLBIdx_IdxTable );
+   int  *HomePID         = new int  [NTarPar];
+   int  *NNewPar_Patch   = new int  [NReal];
+   long *ParOffset_Patch = new long [NReal+1];
+   long *ParIDList       = new long [NTarPar];
 
-// construct and sort the LBIdx list of all real patches
+// 2-1. construct and sort the LBIdx list of all real patches
 // --> do not use amr->LB->IdxList_Real[] since it may not be constructed yet
    long *RealPatchLBIdx          = new long [NReal];
    int  *RealPatchLBIdx_IdxTable = new int  [NReal];
@@ -92,48 +84,49 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly,
 
    Mis_Heapsort( NReal, RealPatchLBIdx, RealPatchLBIdx_IdxTable );
 
-// LBIdx --> home (real) patch indices
-   Mis_Matching_int( NReal, RealPatchLBIdx, NTarPar, HomeLBIdx, MatchIdx );
-
-// check: every particle must have a home patch
-#  ifdef DEBUG_PARTICLE
+// 2-2. get the load-balance index of the particle's home patch and look it up in the sorted patch list
+// --> avoid sorting all particles, which dominates the cost when there are many more particles than patches
+#  pragma omp parallel for schedule( static )
    for (long t=0; t<NTarPar; t++)
    {
-      if ( MatchIdx[t] == -1 )
+      real TParPos[3];
+
+      for (int d=0; d<3; d++)    TParPos[d] = Pos[d][ NewParID0 + t ];
+
+      const long HomeLBIdx = ParPos2LBIdx( lv, TParPos );
+      const int  MatchIdx  = Mis_BinarySearch( RealPatchLBIdx, 0, NReal-1, HomeLBIdx );
+
+//    check: every particle must have a home patch
+#     ifdef DEBUG_PARTICLE
+      if ( MatchIdx == -1 )
       {
-         const long ParID = NewParID0 + HomeLBIdx_IdxTable[t];
+         const long ParID = NewParID0 + t;
 
          Aux_Error( ERROR_INFO, "lv %d, ParID %ld, ParPos (%14.7e, %14.7e, %14.7e) --> found no home patch !!\n",
                     lv, ParID, Pos[0][ParID], Pos[1][ParID], Pos[2][ParID] );
       }
-   }
-#  endif
-
-// record the home patch indices
-   for (long t=0; t<NTarPar; t++)
-   {
-      const long t0  = HomeLBIdx_IdxTable[t];
-      const int  PID = RealPatchLBIdx_IdxTable[ MatchIdx[t] ];
+#     endif
 
-      HomePID[t0] = PID;
+      HomePID[t] = RealPatchLBIdx_IdxTable[MatchIdx];
    }
 
 
 // 3. count the number of particles in each patch and allocate the particle list
-   if ( OldParOnly )
-   for (int PID=0; PID<NReal; PID++)   amr->patch[0][lv][PID]->ParListSize = 0;
+   for (int PID=0; PID<NReal; PID++)   NNewPar_Patch[PID] = 0;
 
-   for (long t=0; t<NTarPar; t++)
-      amr->patch[0][lv][ HomePID[t] ]->ParListSize ++;
+   for (long t=0; t<NTarPar; t++)      NNewPar_Patch[ HomePID[t] ] ++;
 
    for (int PID=0; PID<NReal; PID++)
    {
       if ( OldParOnly )
       {
          free( amr->patch[0][lv][PID]->ParList );
-         amr->patch[0][lv][PID]->ParList = NULL;
+         amr->patch[0][lv][PID]->ParList     = NULL;
+         amr->patch[0][lv][PID]->ParListSize = 0;
       }
 
+      amr->patch[0][lv][PID]->ParListSize += NNewPar_Patch[PID];
+
       if ( amr->patch[0][lv][PID]->ParListSize > 0 )
       {
 //       use realloc to preserve the old particle list for OldParOnly
@@ -144,27 +137,45 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly,
 
 
 // 4. associate particles with their home patches
+// 4-1. bucket sort the particle IDs by their home patches
+// --> particles of each patch remain in ascending order of particle IDs
+   ParOffset_Patch[0] = 0;
+   for (int PID=0; PID<NReal; PID++)   ParOffset_Patch[PID+1] = ParOffset_Patch[PID] + NNewPar_Patch[PID];
+
+   for (long t=0; t<NTarPar; t++)      ParIDList[ ParOffset_Patch[ HomePID[t] ] ++ ] = NewParID0 + t;
+
+// 4-2. add particles to their home patches patch by patch
+// --> ParOffset_Patch[PID] now points to the end of the particles of PID
    if ( OldParOnly )    amr->Par->NPar_Lv[lv] = 0;
 
-// no OpenMP since AddParticle() will modify amr->Par->NPar_Lv[]
-   for (long t=0; t<NTarPar; t++)
+   long NPar_Lv_Add = 0;
+
+#  pragma omp parallel for schedule( runtime ) reduction( +:NPar_Lv_Add )
+   for (int PID=0; PID<NReal; PID++)
    {
-      const long ParID = NewParID0 + t;
-      const int  PID   = HomePID[t];
+      const int NNewPar = NNewPar_Patch[PID];
+
+      if ( NNewPar == 0 )  continue;
+
+      const long *ParIDList_Patch = ParIDList + ParOffset_Patch[PID] - NNewPar;
 
 #     ifdef DEBUG_PARTICLE
-      amr->patch[0][lv][PID]->AddParticle( 1, &ParID, &amr->Par->NPar_Lv[lv],
+      amr->patch[0][lv][PID]->AddParticle( NNewPar, ParIDList_Patch, &NPar_Lv_Add,
                                            Pos, amr->Par->NPar_AcPlusInac, __FUNCTION__ );
 #     else
-      amr->patch[0][lv][PID]->AddParticle( 1, &ParID, &amr->Par->NPar_Lv[lv] );
+      amr->patch[0][lv][PID]->AddParticle( NNewPar, ParIDList_Patch, &NPar_Lv_Add );
 #     endif
+
+      Par_UpdateDescendantCount( lv, PID, NNewPar );
    }
 
+   amr->Par->NPar_Lv[lv] += NPar_Lv_Add;
+
 
-   delete [] HomeLBIdx;
-   delete [] HomeLBIdx_IdxTable;
    delete [] HomePID;
-   delete [] MatchIdx;
+   delete [] NNewPar_Patch;
+   delete [] ParOffset_Patch;
+   delete [] ParIDList;
    delete [] RealPatchLBIdx;
    delete [] RealPatchLBIdx_IdxTable;
 
@@ -219,50 +230,91 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly,
       Pos[2] = NewParAtt[PAR_POSZ];
    }
 
-   for (int r=0; r<MPI_NRank; r++)  Send_Count[r] = 0;
-
 
-// 1. get the target MPI rank of each particle
+// 1. get the target MPI rank of each particle and bucket sort particles by their target ranks
+// --> each thread handles a contiguous chunk of particles so that the send order is the same as a serial loop
+//     (i.e., ascending order of particle IDs for each target rank)
    const long NTarPar = ( OldParOnly ) ? amr->Par->NPar_AcPlusInac : NNewPar;
 
-   int *TRank = new int [NTarPar];
-   real TParPos[3];
-   long LBIdx;
+   int  *TRank        = new int  [NTarPar];
+   long *Count_Thread = new long [ (long)OMP_NTHREAD*MPI_NRank ];
+   long *SendList     = NULL;   // particle IDs sorted by their target ranks
 
-   for (long ParID=0; ParID<NTarPar; ParID++)
+#  pragma omp parallel
    {
-//    TRank is set to -1 for inactive particles
-      if ( Mass[ParID] < (real)0.0 )
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+      long *Count = Count_Thread + (long)TID*MPI_NRank;
+
+      for (int r=0; r<MPI_NRank; r++)  Count[r] = 0;
+
+//    1-1. get the target rank and count the particles sent to each rank by this thread
+#     pragma omp for schedule( static )
+      for (long ParID=0; ParID<NTarPar; ParID++)
       {
-         TRank[ParID] = -1;
-         continue;
-      }
+//       TRank is set to -1 for inactive particles
+         if ( Mass[ParID] < (real)0.0 )
+         {
+            TRank[ParID] = -1;
+            continue;
+         }
+
+//       get the load-balance index of the particle's home patch
+         real TParPos[3];
+         for (int d=0; d<3; d++)    TParPos[d] = Pos[d][ParID];
+         const long LBIdx = ParPos2LBIdx( lv, TParPos );
+
+//       record the home rank
+#        ifdef SERIAL
+         TRank[ParID] = 0;
+#        else
+         TRank[ParID] = LB_Index2Rank( lv, LBIdx, CHECK_ON );
+#        endif
+         Count[ TRank[ParID] ] ++;
+      } // for (long ParID=0; ParID<NTarPar; ParID++)
+
+//    1-2. set the send counts and convert the counts of each thread into its offsets in the send list
+#     pragma omp single
+      {
+         long Disp = 0;
 
-//    get the load-balance index of the particle's home patch
-      for (int d=0; d<3; d++)    TParPos[d] = Pos[d][ParID];
-      LBIdx = ParPos2LBIdx( lv, TParPos );
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            Send_Disp[r] = (int)Disp;
 
-//    record the home patch
-#     ifdef SERIAL
-      TRank[ParID] = 0;
-#     else
-      TRank[ParID] = LB_Index2Rank( lv, LBIdx, CHECK_ON );
-#     endif
-      Send_Count[ TRank[ParID] ] ++;
-   } // for (long ParID=0; ParID<NTarPar; ParID++)
+            for (int t=0; t<OMP_NTHREAD; t++)
+            {
+               const long NThisThread = Count_Thread[ (long)t*MPI_NRank + r ];
+               Count_Thread[ (long)t*MPI_NRank + r ] = Disp;
+               Disp += NThisThread;
+            }
+
+            Send_Count[r] = int( Disp - Send_Disp[r] );
+         }
+
+         SendList = new long [Disp];
+      } // implicit barrier
+
+//    1-3. record the particle IDs in the send list
+//    --> must adopt the same schedule as step 1-1
+#     pragma omp for schedule( static )
+      for (long ParID=0; ParID<NTarPar; ParID++)
+         if ( TRank[ParID] != -1 )  SendList[ Count[ TRank[ParID] ] ++ ] = ParID;
+   } // end of OpenMP parallel region
+
+   delete [] TRank;
+   delete [] Count_Thread;
 
 
 // 2. construct the MPI send and recv data list
    MPI_Alltoall( Send_Count, 1, MPI_INT, Recv_Count, 1, MPI_INT, MPI_COMM_WORLD );
 
-   Send_Disp[0] = 0;
    Recv_Disp[0] = 0;
 
-   for (int r=1; r<MPI_NRank; r++)
-   {
-      Send_Disp[r] = Send_Disp[r-1] + Send_Count[r-1];
-      Recv_Disp[r] = Recv_Disp[r-1] + Recv_Count[r-1];
-   }
+   for (int r=1; r<MPI_NRank; r++)  Recv_Disp[r] = Recv_Disp[r-1] + Recv_Count[r-1];
 
    Send_Count_Sum = Send_Disp[ MPI_NRank-1 ] + Send_Count[ MPI_NRank-1 ];
    Recv_Count_Sum = Recv_Disp[ MPI_NRank-1 ] + Recv_Count[ MPI_NRank-1 ];
@@ -277,8 +329,6 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly,
    const long NOldPar            = ( OldParOnly ) ?       NULL_INT : amr->Par->NPar_AcPlusInac;
    const long UpdatedParListSize = ( OldParOnly ) ? Recv_Count_Sum : amr->Par->NPar_AcPlusInac + Recv_Count_Sum;
 
-   int Offset[MPI_NRank];
-
    real *SendBuf = new real [Send_Count_Sum];
    real *RecvBuf = NULL;
 
@@ -293,14 +343,11 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly,
 
    for (int v=0; v<PAR_NATT_TOTAL; v++)
    {
-//    3-2. initialize the array offsets of all target ranks
-      for (int r=0; r<MPI_NRank; r++)  Offset[r] = Send_Disp[r];
+//    3-2. prepare send buffer (inactive particles are already excluded from the send list)
+#     pragma omp parallel for schedule( static )
+      for (long p=0; p<Send_Count_Sum; p++)  SendBuf[p] = SendAttPtr[v][ SendList[p] ];
 
-//    3-3. prepare send buffer (skip inactive particles)
-      for (long ParID=0; ParID<NTarPar; ParID++)
-         if ( TRank[ParID] != -1 )  SendBuf[ Offset[TRank[ParID]] ++ ] = SendAttPtr[v][ParID];
-
-//    3-4. free/allocate the old/new particle arrays and set the recv buffer
+//    3-3. free/allocate the old/new particle arrays and set the recv buffer
       if ( OldParOnly )
       {
          free( SendAttPtr[v] );
@@ -315,7 +362,7 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly,
          RecvBuf            = *(OldAttPtrPtr[v]) + NOldPar;
       }
 
-//    3-5. redistribute data
+//    3-4. redistribute data
 #     ifdef FLOAT8
       MPI_Alltoallv( SendBuf, Send_Count, Send_Disp, MPI_DOUBLE, RecvBuf, Recv_Count, Recv_Disp, MPI_DOUBLE, MPI_COMM_WORLD );
 #     else
@@ -378,7 +425,7 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly,
 
 
 // free memory
-   delete [] TRank;
+   delete [] SendList;
    delete [] SendBuf;
 
 } // FUNCTION : SendParticle2HomeRank
@@ -18,6 +18,10 @@
 //                   --> We convert dt back to the physical time interval, which equals "delta(scale_factor)"
 //                       in the comoving coordinates, in Mis_GetTimeStep()
 //                2. Particle acceleration criterion is used only when DT__PARACC > 0.0
+//                3. For PAR_MAX_SUBCYCLE > 0, the particle acceleration criterion is relaxed by a factor of
+//                   2^PAR_MAX_SUBCYCLE since Par_UpdateParticle() sub-cycles the particles requiring smaller
+//                   time-steps
+//                   --> The particle velocity criterion is not affected
 //
 // Parameter   :  dt_vel : Evolution time-step estimated from the particle velocity
 //                         --> Call-by-reference
@@ -144,6 +148,10 @@ void Par_GetTimeStep_VelAcc( double &dt_vel, double &dt_acc, const int lv )
    if ( UseAcc )
    dt_acc *= DT__PARACC;
 
+// relax the particle acceleration criterion for the sub-cycling in Par_UpdateParticle()
+   if ( UseAcc  &&  amr->Par->MaxSubCycle > 0 )
+   dt_acc *= (double)( 1 << amr->Par->MaxSubCycle );
+
 } // FUNCTION : Par_GetTimeStep_VelAcc
 
 
@@ -3,6 +3,10 @@
 #ifdef PARTICLE
 
 
+// maximum number of bytes read by each rank at a time
+#define PAR_IC_CHUNK_SIZE     ( 64L*1024L*1024L )
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -28,6 +32,9 @@
 //                       --> In this case, the PAR_IC file should exclude the partice mass data
 //                8. For LOAD_BALANCE, the number of particles in each rank must be set in advance
 //                   --> Currently it's set by Init_Parallelization()
+//                9. Each rank reads its own contiguous segment of the file in parallel (by MPI-IO when SERIAL
+//                   is off) and the data of PAR_IC_FORMAT_ATT_ID are loaded directly into Par->Attribute[]
+//                   --> Particles are then sent to their home ranks at once by Par_FindHomePatch_UniformGrid()
 //
 // Parameter   :  None
 //
@@ -84,75 +91,110 @@ void Par_Init_ByFile()
    for (int r=0; r<MPI_Rank; r++)   FileOffset = FileOffset + long(NParAttPerLoad)*NPar_EachRank[r]*sizeof(real);
 
 
-// load data
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... " );
-
-   real *ParData_ThisRank = new real [ NParThisRank*NParAtt ];
+// map the attributes on the disk to the particle attributes
+// --> assuming that the orders of the particle attributes stored on the disk and in Par->Attribute[] are the same
+   int AttIdx[7];
 
-// note that fread() may fail for large files if sizeof(size_t) == 4 instead of 8
-   FILE *File = fopen( FileName, "rb" );
-
-   for (int v=0; v<NParAtt; v+=NParAttPerLoad)
+   for (int v_in=0, v_out=0; v_in<NParAtt; v_in++, v_out++)
    {
-      fseek( File, FileOffset+v*NParAllRank*sizeof(real), SEEK_SET );
-      fread( ParData_ThisRank+v*NParThisRank, sizeof(real), long(NParAttPerLoad)*NParThisRank, File );
+//    skip the particle mass
+      if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
+
+      AttIdx[v_in] = v_out;
    }
 
-   fclose( File );
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+// load data
+// --> each rank reads its contiguous segment of the file by at most PAR_IC_CHUNK_SIZE bytes at a time
+//     (by collective MPI-IO reads when SERIAL is off)
+// --> PAR_IC_FORMAT_ATT_ID: read directly into Par->Attribute[] without any intermediate buffer
+//     PAR_IC_FORMAT_ID_ATT: read into a temporary buffer and then transpose to Par->Attribute[]
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... " );
 
+   const long NParChunk = MAX( PAR_IC_CHUNK_SIZE/long(NParAttPerLoad*sizeof(real)), 1L );
+   const long NChunk    = ( NParThisRank + NParChunk - 1 ) / NParChunk;
+   long  NChunk_Max;
+   real *Buf = ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT ) ? new real [ MIN(NParThisRank,NParChunk)*NParAtt + 1 ]
+                                                                 : NULL;
 
-// store data into the particle repository
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Storing data into particle repository ... " );
+// all ranks must call the collective read the same number of times
+   MPI_Allreduce( &NChunk, &NChunk_Max, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
 
-   real *ParData1 = new real [NParAtt];
+#  ifdef SERIAL
+   FILE *File = fopen( FileName, "rb" );
 
-   for (long p=0; p<NParThisRank; p++)
-   {
-//    collect data for the target particle
-//    [id][att]
-      if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
-         memcpy( ParData1, ParData_ThisRank+p*NParAtt, NParAtt*sizeof(real) );
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+#  else
+   MPI_File   File;
+   MPI_Status Status;
 
-//    [att][id]
-      else
-      {
-         for (int v=0; v<NParAtt; v++)
-            ParData1[v] = ParData_ThisRank[ v*NParThisRank + p ];
-      }
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
 
-//    assuming that the orders of the particle attributes stored on the disk and in Par->Attribute[] are the same
-      if ( SingleParMass )
-      {
-//       assign the same mass to all particles
-         amr->Par->Attribute[PAR_MASS][p] = amr->Par->ParICMass;
+   if (  MPI_File_open( MPI_COMM_WORLD, (char*)FileName, MPI_MODE_RDONLY, MPI_INFO_NULL, &File ) != MPI_SUCCESS  )
+      Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName );
+#  endif
 
-         for (int v_in=0, v_out=0; v_in<NParAtt; v_in++, v_out++)
+   for (int v=0; v<NParAtt; v+=NParAttPerLoad)
+   {
+      for (long t=0; t<NChunk_Max; t++)
+      {
+         const long Par0     = MIN( t*NParChunk, NParThisRank );
+         const long NParLoad = MIN( NParChunk, NParThisRank-Par0 );
+         const long NLoad    = NParLoad*NParAttPerLoad;
+         const long Offset   = FileOffset + long(v)*NParAllRank*sizeof(real) + Par0*NParAttPerLoad*sizeof(real);
+         real      *Data     = ( Buf == NULL ) ? amr->Par->Attribute[ AttIdx[v] ] + Par0 : Buf;
+
+#        ifdef SERIAL
+         if ( NLoad > 0 )
          {
-//          skip the particle mass
-            if ( v_out == PAR_MASS )    v_out ++;
+            fseek( File, Offset, SEEK_SET );
 
-            amr->Par->Attribute[v_out][p] = ParData1[v_in];
+            if ( fread( Data, sizeof(real), NLoad, File ) != (size_t)NLoad )
+               Aux_Error( ERROR_INFO, "failed to read the file \"%s\" !!\n", FileName );
          }
-      }
+#        else
+         if ( MPI_File_read_at_all( File, Offset, Data, (int)NLoad, RealType, &Status ) != MPI_SUCCESS )
+            Aux_Error( ERROR_INFO, "failed to read the file \"%s\" !!\n", FileName );
+#        endif
 
-      else
-      {
-         for (int v=0; v<NParAtt; v++)
-            amr->Par->Attribute[v][p] = ParData1[v];
-      }
+//       [id][att] --> [att][id]
+         if ( Buf != NULL )
+         {
+#           pragma omp parallel for schedule( static )
+            for (long p=0; p<NParLoad; p++)
+            for (int  v_in=0; v_in<NParAtt; v_in++)
+               amr->Par->Attribute[ AttIdx[v_in] ][ Par0 + p ] = Buf[ p*NParAtt + v_in ];
+         }
+      } // for (long t=0; t<NChunk_Max; t++)
+   } // for (int v=0; v<NParAtt; v+=NParAttPerLoad)
 
-//    synchronize all particles to the physical time at the base level
-      amr->Par->Time[p] = Time[0];
-   }
+#  ifdef SERIAL
+   fclose( File );
+#  else
+   MPI_File_close( &File );
+#  endif
 
-   delete [] ParData_ThisRank;
-   delete [] ParData1;
+   delete [] Buf;
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 
+// set the remaining particle attributes
+#  pragma omp parallel for schedule( static )
+   for (long p=0; p<NParThisRank; p++)
+   {
+//    assign the same mass to all particles
+      if ( SingleParMass )    amr->Par->Attribute[PAR_MASS][p] = amr->Par->ParICMass;
+
+//    synchronize all particles to the physical time at the base level
+      amr->Par->Time[p] = Time[0];
+   }
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : Par_Init_ByFile
@@ -119,7 +119,7 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 // 2. set up attribute arrays, copy particle position since they might be modified during the position prediction
    real *Mass   = NULL;
    real *Pos[3] = { NULL, NULL, NULL };
-   long  ParID, Idx;
+   long  ParID;
 
    if ( UseInputMassPos )
    {
@@ -161,15 +161,22 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
 
 // 4. deposit particle mass
+// --> particles are split across all OpenMP threads if NPar >= PAR_DEPOSIT_NPAR_THREAD and this function is not
+//     invoked in a parallel region (e.g., see Prepare_PatchData())
+//     --> each thread deposits mass onto its own density array, which are summed up in a fixed order later
+#  ifdef OPENMP
+   const int    NThread   = ( amr->Par->DepositNParThread > 0  &&  NPar >= amr->Par->DepositNParThread  &&
+                              !omp_in_parallel() ) ? OMP_NTHREAD : 1;
+#  else
+   const int    NThread   = 1;
+#  endif
+   const long   RhoSize3D = CUBE( (long)RhoSize );
    const double _dh       = 1.0 / dh;
    const double _dh3      = CUBE(_dh);
    const double Ghost_Phy = amr->Par->GhostSize*dh;
 
-   real (*Rho3D)[RhoSize][RhoSize] = ( real (*)[RhoSize][RhoSize] )Rho;
-
-   int  idx[3];      // array index for Rho
-   real ParDens;     // mass density of the cloud
-   real EdgeWithGhostL[3], EdgeWithGhostR[3], PeriodicSize_Phy[3];
+   real *Rho_Thread = ( NThread > 1 ) ? new real [ (NThread-1)*RhoSize3D ] : NULL;
+   real  EdgeWithGhostL[3], EdgeWithGhostR[3], PeriodicSize_Phy[3];
 
    for (int d=0; d<3; d++)
    {
@@ -181,206 +188,254 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
    }
 
 
-   switch ( IntScheme )
+#  pragma omp parallel num_threads( NThread ) if ( NThread > 1 )
    {
-//    4.1 NGP
-      case ( PAR_INTERP_NGP ):
-      {
-         for (long p=0; p<NPar; p++)
-         {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.1.0 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-//          4.1.1 calculate the nearest grid index
-            for (int d=0; d<3; d++)
-            {
-               idx[d] = (int)FLOOR( ( Pos[d][Idx] - EdgeL[d] )*_dh );
-
-//             periodicity
-               if ( Periodic[d] )
-               {
-                  idx[d] = ( idx[d] + PeriodicSize[d] ) % PeriodicSize[d];
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
 
-#                 ifdef DEBUG_PARTICLE
-                  if ( idx[d] < 0  ||  idx[d] >= PeriodicSize[d] )
-                     Aux_Error( ERROR_INFO, "incorrect idx[%d] = %d (PeriodicSize = %d) !!\n",
-                                d, idx[d], PeriodicSize[d] );
-#                 endif
-               }
-            }
+//    thread 0 deposits mass onto Rho[] directly
+      real *Rho_TID = ( TID == 0 ) ? Rho : Rho_Thread + (TID-1)*RhoSize3D;
 
-//          4.1.2 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+      real (*Rho3D)[RhoSize][RhoSize] = ( real (*)[RhoSize][RhoSize] )Rho_TID;
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = Mass[Idx]*_dh3;
+      if ( TID > 0 )
+         for (long t=0; t<RhoSize3D; t++)    Rho_TID[t] = (real)0.0;
 
-            if (  WithinRho( idx, RhoSize )  )
-               Rho3D[ idx[2] ][ idx[1] ][ idx[0] ] += ParDens;
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_NGP
-      break;
+      long Idx;         // particle index in Mass[] and Pos[]
+      int  idx[3];      // array index for Rho
+      real ParDens;     // mass density of the cloud
 
 
-//    4.2 CIC
-      case ( PAR_INTERP_CIC ):
+      switch ( IntScheme )
       {
-         int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
-         double dr      [3];     // distance to the center of the left cell
-         double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
-
-         for (long p=0; p<NPar; p++)
+//       4.1 NGP
+         case ( PAR_INTERP_NGP ):
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.2.0 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-            for (int d=0; d<3; d++)
+#              pragma omp for schedule( static )
+            for (long p=0; p<NPar; p++)
             {
-//             4.2.1 calculate the array index of the left and right cells
-               dr      [d]  = ( Pos[d][Idx] - EdgeL[d] )*_dh - 0.5;
-               idxLR[0][d]  = (int)FLOOR( dr[d] );
-               idxLR[1][d]  = idxLR[0][d] + 1;
-               dr      [d] -= (double)idxLR[0][d];
-
-//             periodicity
-               if ( Periodic[d] )
+#              ifdef BITWISE_REPRODUCIBILITY
+               Idx = Sort_IdxTable[p];
+#              else
+               Idx = p;
+#              endif
+
+//             4.1.0 discard particles far away from the target region
+               if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
+                                                        Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
+                  continue;
+
+//             4.1.1 calculate the nearest grid index
+               for (int d=0; d<3; d++)
                {
-                  for (int t=0; t<2; t++)
+                  idx[d] = (int)FLOOR( ( Pos[d][Idx] - EdgeL[d] )*_dh );
+
+//                periodicity
+                  if ( Periodic[d] )
                   {
-                     idxLR[t][d] = ( idxLR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+                     idx[d] = ( idx[d] + PeriodicSize[d] ) % PeriodicSize[d];
 
 #                    ifdef DEBUG_PARTICLE
-                     if ( idxLR[t][d] < 0  ||  idxLR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLR[t][d], PeriodicSize[d] );
+                     if ( idx[d] < 0  ||  idx[d] >= PeriodicSize[d] )
+                        Aux_Error( ERROR_INFO, "incorrect idx[%d] = %d (PeriodicSize = %d) !!\n",
+                                   d, idx[d], PeriodicSize[d] );
 #                    endif
                   }
                }
 
-//             4.2.2 get the weighting of the nearby 8 cells
-               Frac[0][d] = 1.0 - dr[d];
-               Frac[1][d] =       dr[d];
-            } // for (int d=0; d<3; d++)
-
-//          4.2.3 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+//             4.1.2 assign mass if within Rho[]
+//             check inactive particles (which have negative mass)
+#              ifdef DEBUG_PARTICLE
+               if ( Mass[Idx] < (real)0.0 )
+                  Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
+#              endif
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = Mass[Idx]*_dh3;
-
-            for (int k=0; k<2; k++) {  idx[2] = idxLR[k][2];
-            for (int j=0; j<2; j++) {  idx[1] = idxLR[j][1];
-            for (int i=0; i<2; i++) {  idx[0] = idxLR[i][0];
+               if ( UnitDens )   ParDens = (real)1.0;
+               else              ParDens = Mass[Idx]*_dh3;
 
                if (  WithinRho( idx, RhoSize )  )
-                  Rho3D[ idx[2] ][ idx[1] ][ idx[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
-
-            }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_CIC
-      break;
+                  Rho3D[ idx[2] ][ idx[1] ][ idx[0] ] += ParDens;
+            } // for (long p=0; p<NPar; p++)
+         } // PAR_INTERP_NGP
+         break;
 
 
-//    4.3 TSC
-      case ( PAR_INTERP_TSC ):
-      {
-         int    idxLCR[3][3];    // array index of the left (idxLCR[0][d]), central (idxLCR[1][d]) and right (idxLCR[2][d]) cells
-         double dr       [3];    // distance to the left edge of the central cell
-         double Frac  [3][3];    // weighting of the left (Frac[0][d]), central (Frac[1][d]) and right (Frac[2][d]) cells
-
-         for (long p=0; p<NPar; p++)
+//       4.2 CIC
+         case ( PAR_INTERP_CIC ):
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.3.0 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-            for (int d=0; d<3; d++)
+            int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
+            double dr      [3];     // distance to the center of the left cell
+            double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
+            bool   Inside[2][3];     // whether idxLR[t][d] lies within Rho[]
+
+#              pragma omp for schedule( static )
+            for (long p=0; p<NPar; p++)
             {
-//             4.3.1 calculate the array index of the left, central, and right cells
-               dr       [d]  = ( Pos[d][Idx] - EdgeL[d] )*_dh;
-               idxLCR[1][d]  = (int)FLOOR( dr[d] );
-               idxLCR[0][d]  = idxLCR[1][d] - 1;
-               idxLCR[2][d]  = idxLCR[1][d] + 1;
-               dr       [d] -= (double)idxLCR[1][d];
-
-//             periodicity
-               if ( Periodic[d] )
+#              ifdef BITWISE_REPRODUCIBILITY
+               Idx = Sort_IdxTable[p];
+#              else
+               Idx = p;
+#              endif
+
+//             4.2.0 discard particles far away from the target region
+               if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
+                                                        Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
+                  continue;
+
+               for (int d=0; d<3; d++)
                {
-                  for (int t=0; t<3; t++)
+//                4.2.1 calculate the array index of the left and right cells
+                  dr      [d]  = ( Pos[d][Idx] - EdgeL[d] )*_dh - 0.5;
+                  idxLR[0][d]  = (int)FLOOR( dr[d] );
+                  idxLR[1][d]  = idxLR[0][d] + 1;
+                  dr      [d] -= (double)idxLR[0][d];
+
+//                periodicity
+                  if ( Periodic[d] )
                   {
-                     idxLCR[t][d] = ( idxLCR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
-
-#                    ifdef DEBUG_PARTICLE
-                     if ( idxLCR[t][d] < 0  ||  idxLCR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLCR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLCR[t][d], PeriodicSize[d] );
-#                    endif
+                     for (int t=0; t<2; t++)
+                     {
+                        idxLR[t][d] = ( idxLR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+
+#                       ifdef DEBUG_PARTICLE
+                        if ( idxLR[t][d] < 0  ||  idxLR[t][d] >= PeriodicSize[d] )
+                           Aux_Error( ERROR_INFO, "incorrect idxLR[%d][%d] = %d (PeriodicSize = %d) !!\n",
+                                      t, d, idxLR[t][d], PeriodicSize[d] );
+#                       endif
+                     }
                   }
-               }
 
-//             4.3.2 get the weighting of the nearby 27 cells
-               Frac[0][d] = 0.5*SQR( 1.0 - dr[d] );
-               Frac[1][d] = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
-               Frac[2][d] = 0.5*SQR( dr[d] );
-            } // for (int d=0; d<3; d++)
+//                4.2.2 get the weighting of the nearby 8 cells
+                  Frac[0][d] = 1.0 - dr[d];
+                  Frac[1][d] =       dr[d];
+               } // for (int d=0; d<3; d++)
 
-//          4.3.3 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+//             4.2.3 assign mass if within Rho[]
+//             check inactive particles (which have negative mass)
+#              ifdef DEBUG_PARTICLE
+               if ( Mass[Idx] < (real)0.0 )
+                  Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
+#              endif
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = Mass[Idx]*_dh3;
+               if ( UnitDens )   ParDens = (real)1.0;
+               else              ParDens = Mass[Idx]*_dh3;
 
-            for (int k=0; k<3; k++) {  idx[2] = idxLCR[k][2];
-            for (int j=0; j<3; j++) {  idx[1] = idxLCR[j][1];
-            for (int i=0; i<3; i++) {  idx[0] = idxLCR[i][0];
+//             check whether each index lies within Rho[] once per dimension instead of calling WithinRho() for all
+//             8 cells, which is equivalent since Rho[] is a cube and the cells form a tensor product
+               for (int d=0; d<3; d++)
+               for (int t=0; t<2; t++)
+                  Inside[t][d] = ( idxLR[t][d] >= 0  &&  idxLR[t][d] < RhoSize );
 
-               if (  WithinRho( idx, RhoSize )  )
-                  Rho3D[ idx[2] ][ idx[1] ][ idx[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
-            }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_TSC
-      break;
+               for (int k=0; k<2; k++) {  if ( !Inside[k][2] )  continue;
+               for (int j=0; j<2; j++) {  if ( !Inside[j][1] )  continue;
+               for (int i=0; i<2; i++) {  if ( !Inside[i][0] )  continue;
+
+                  Rho3D[ idxLR[k][2] ][ idxLR[j][1] ][ idxLR[i][0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
+
+               }}}
+            } // for (long p=0; p<NPar; p++)
+         } // PAR_INTERP_CIC
+         break;
+
+
+//       4.3 TSC
+         case ( PAR_INTERP_TSC ):
+         {
+            int    idxLCR[3][3];    // array index of the left (idxLCR[0][d]), central (idxLCR[1][d]) and right (idxLCR[2][d]) cells
+            double dr       [3];    // distance to the left edge of the central cell
+            double Frac  [3][3];    // weighting of the left (Frac[0][d]), central (Frac[1][d]) and right (Frac[2][d]) cells
+            bool   Inside[3][3];    // whether idxLCR[t][d] lies within Rho[]
 
-      default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
-   } // switch ( IntScheme )
+#              pragma omp for schedule( static )
+            for (long p=0; p<NPar; p++)
+            {
+#              ifdef BITWISE_REPRODUCIBILITY
+               Idx = Sort_IdxTable[p];
+#              else
+               Idx = p;
+#              endif
+
+//             4.3.0 discard particles far away from the target region
+               if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
+                                                        Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
+                  continue;
+
+               for (int d=0; d<3; d++)
+               {
+//                4.3.1 calculate the array index of the left, central, and right cells
+                  dr       [d]  = ( Pos[d][Idx] - EdgeL[d] )*_dh;
+                  idxLCR[1][d]  = (int)FLOOR( dr[d] );
+                  idxLCR[0][d]  = idxLCR[1][d] - 1;
+                  idxLCR[2][d]  = idxLCR[1][d] + 1;
+                  dr       [d] -= (double)idxLCR[1][d];
+
+//                periodicity
+                  if ( Periodic[d] )
+                  {
+                     for (int t=0; t<3; t++)
+                     {
+                        idxLCR[t][d] = ( idxLCR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+
+#                       ifdef DEBUG_PARTICLE
+                        if ( idxLCR[t][d] < 0  ||  idxLCR[t][d] >= PeriodicSize[d] )
+                           Aux_Error( ERROR_INFO, "incorrect idxLCR[%d][%d] = %d (PeriodicSize = %d) !!\n",
+                                      t, d, idxLCR[t][d], PeriodicSize[d] );
+#                       endif
+                     }
+                  }
+
+//                4.3.2 get the weighting of the nearby 27 cells
+                  Frac[0][d] = 0.5*SQR( 1.0 - dr[d] );
+                  Frac[1][d] = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
+                  Frac[2][d] = 0.5*SQR( dr[d] );
+               } // for (int d=0; d<3; d++)
+
+//             4.3.3 assign mass if within Rho[]
+//             check inactive particles (which have negative mass)
+#              ifdef DEBUG_PARTICLE
+               if ( Mass[Idx] < (real)0.0 )
+                  Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
+#              endif
+
+               if ( UnitDens )   ParDens = (real)1.0;
+               else              ParDens = Mass[Idx]*_dh3;
+
+//             check whether each index lies within Rho[] once per dimension instead of calling WithinRho() for all
+//             27 cells, which is equivalent since Rho[] is a cube and the cells form a tensor product
+               for (int d=0; d<3; d++)
+               for (int t=0; t<3; t++)
+                  Inside[t][d] = ( idxLCR[t][d] >= 0  &&  idxLCR[t][d] < RhoSize );
+
+               for (int k=0; k<3; k++) {  if ( !Inside[k][2] )  continue;
+               for (int j=0; j<3; j++) {  if ( !Inside[j][1] )  continue;
+               for (int i=0; i<3; i++) {  if ( !Inside[i][0] )  continue;
+
+                  Rho3D[ idxLCR[k][2] ][ idxLCR[j][1] ][ idxLCR[i][0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
+               }}}
+            } // for (long p=0; p<NPar; p++)
+         } // PAR_INTERP_TSC
+         break;
+
+         default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
+      } // switch ( IntScheme )
+   } // OpenMP parallel region
+
+
+// 5. sum up the density arrays of all threads
+   if ( NThread > 1 )
+   {
+#     pragma omp parallel for schedule( static ) num_threads( NThread )
+      for (long t=0; t<RhoSize3D; t++)
+      for (int TID=1; TID<NThread; TID++)    Rho[t] += Rho_Thread[ (TID-1)*RhoSize3D + t ];
+
+      delete [] Rho_Thread;
+   }
 
 
-// 5. free memory
+// 6. free memory
    if ( !UseInputMassPos )
    {
       delete [] Mass;
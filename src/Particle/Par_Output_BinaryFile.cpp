@@ -0,0 +1,89 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+static void Pack_Particle( const long Row0, const long NRowPack, char *Buf );
+
+// index of the next particle to be examined by Pack_Particle()
+static long Pack_ParIdx = 0;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_Output_BinaryFile
+// Description :  Binary counterpart of Par_Output_TextFile()
+//
+// Note        :  1. Used for the runtime option "OPT__OUTPUT_PAR_TEXT" when "OPT__OUTPUT_TEXT_BINARY" is on
+//                2. Output all attributes of all active particles in the precision of real
+//                3. All ranks write to a single file in parallel by Output_BinaryTable()
+//                   --> See Output_BinaryTable() for the file layout
+//                   --> Particles are packed chunk by chunk so that no full copy of the particle attributes
+//                       is required
+//
+// Parameter   :  FileName : Output file name
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Par_Output_BinaryFile( const char *FileName )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ...\n", __FUNCTION__, DumpID );
+
+
+// count the number of active particles in this rank
+   long NPar_Active = 0;
+
+   for (long p=0; p<amr->Par->NPar_AcPlusInac; p++)
+      if ( amr->Par->Mass[p] >= 0.0 )  NPar_Active ++;
+
+
+// write the file
+   const char *Label[PAR_NATT_TOTAL];
+
+   for (int v=0; v<PAR_NATT_TOTAL; v++)   Label[v] = ParAttLabel[v];
+
+   Pack_ParIdx = 0;
+
+   Output_BinaryTable( FileName, PAR_NATT_TOTAL, Label, sizeof(real), NPar_Active, Pack_Particle );
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+
+} // FUNCTION : Par_Output_BinaryFile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pack_Particle
+// Description :  Copy the attributes of the next NRowPack active particles to the write buffer of
+//                Output_BinaryTable()
+//
+// Note        :  1. Inactive particles are skipped
+//                2. Rows are requested sequentially, so Row0 is not used
+//
+// Parameter   :  Row0     : First row to be copied
+//                NRowPack : Number of rows to be copied
+//                Buf      : Write buffer
+//-------------------------------------------------------------------------------------------------------
+void Pack_Particle( const long Row0, const long NRowPack, char *Buf )
+{
+
+   real *Row = (real*)Buf;
+
+   for (long t=0; t<NRowPack; t++)
+   {
+      while ( amr->Par->Mass[Pack_ParIdx] < 0.0 )  Pack_ParIdx ++;
+
+      for (int v=0; v<PAR_NATT_TOTAL; v++)   Row[v] = amr->Par->Attribute[v][Pack_ParIdx];
+
+      Row += PAR_NATT_TOTAL;
+      Pack_ParIdx ++;
+   }
+
+} // FUNCTION : Pack_Particle
+
+
+
+#endif // #ifdef PARTICLE
@@ -68,12 +68,18 @@ void Par_PassParticle2Father( const int FaLv, const int FaPID )
    amr->patch[0][FaLv][FaPID]->AddParticle( NParSon, ParListSon, &amr->Par->NPar_Lv[FaLv] );
 #  endif
 
+   Par_UpdateDescendantCount( FaLv, FaPID, NParSon );
+
 
 // 4. remove particles in all sons
 //###NOTE : No OpenMP since RemoveParticle will modify amr->Par->NPar_Lv[]
    const bool RemoveAllParticle = true;
    for (int SonPID=SonPID0; SonPID<SonPID0+8; SonPID++)
+   {
+      Par_UpdateDescendantCount( SonLv, SonPID, -amr->patch[0][SonLv][SonPID]->NPar );
+
       amr->patch[0][SonLv][SonPID]->RemoveParticle( NULL_INT, NULL, &amr->Par->NPar_Lv[SonLv], RemoveAllParticle );
+   }
 
 
 // free memory
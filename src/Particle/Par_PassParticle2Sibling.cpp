@@ -6,6 +6,8 @@
 extern Timer_t *Timer_Par_MPI[NLEVEL][6];
 #endif
 
+static const int PAR_ESCP_REMOVE = -2;    // target sibling of particles removed for lying outside the active region
+
 
 
 
@@ -36,7 +38,6 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
    const int    FaLv             = lv - 1;
    const bool   RemoveAllPar_No  = false;
    const int    MirSib[26]       = { 1,0,3,2,5,4,9,8,7,6,13,12,11,10,17,16,15,14,25,24,23,22,21,20,19,18 };
-   const double GuessEscapeRatio = 0.5*( CUBE(PS1) - CUBE(PS1-2) )/CUBE(PS1);
    const int    SibID[3][3][3]   = {  { {18, 10, 19}, {14,  4, 16}, {20, 11, 21} },
                                       { { 6,  2,  7}, { 0, -1,  1}, { 8,  3,  9} },
                                       { {22, 12, 23}, {15,  5, 17}, {24, 13, 25} }  };
@@ -48,11 +49,15 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
    real *ParPos[3]               = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
 
    int     NPar_Remove_Tot=0;
-   int     NPar, NGuess, NPar_Remove, ArraySize[26], ijk[3], Side, TSib, SibPID, FaPID, FaSib, FaSibPID;
+   int     NPar, NPar_Remove, NPar_Escp_Tot, ijk[3], Side, TSib, SibPID, FaPID, FaSib, FaSibPID;
    long    ParID;
-   int    *RemoveParList;
+   int    *RemoveParList, *TSibList;
+   long   *ParList_Escp_Buf;
    double *EdgeL, *EdgeR;
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after passing particles
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
 // check if the periodic BC is applied to all directions
    bool PeriodicAllDir = true;
    for (int t=0; t<6; t++)
@@ -64,7 +69,8 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
       }
    }
 
-#  pragma omp parallel private( NPar, NGuess, NPar_Remove, ArraySize, ijk, TSib, ParID, RemoveParList, EdgeL, EdgeR )
+#  pragma omp parallel private( NPar, NPar_Remove, NPar_Escp_Tot, ijk, TSib, ParID, RemoveParList, TSibList, \
+                                 ParList_Escp_Buf, EdgeL, EdgeR )
    {
 
 #  pragma omp for reduction( +:NPar_Remove_Tot ) schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
@@ -80,31 +86,27 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
       if ( NPar == 0 )  continue;
 
 
-//    1. allocate memory for the escaping particle list
-      NGuess = MAX( 1, int(NPar*GuessEscapeRatio/26) );
+//    1. count the escaping particles of each target sibling patch
+//       --> record the target sibling of each particle in TSibList[] so that we don't need to recompute it
+//           when scattering the particles into ParList_Escp[] in step 2
+      TSibList = new int [NPar];
 
       for (int s=0; s<26; s++)
       {
-         ArraySize                           [s] = NGuess;
          amr->patch[0][lv][PID]->NPar_Escp   [s] = 0;
-         amr->patch[0][lv][PID]->ParList_Escp[s] = NULL;    // allocate only when necessary (==> better performance)
+         amr->patch[0][lv][PID]->ParList_Escp[s] = NULL;
       }
 
-
-//    2. record the escaping particles
-      RemoveParList = new int [NPar];
-      NPar_Remove   = 0;
-
       for (int p=0; p<NPar; p++)
       {
          ParID = amr->patch[0][lv][PID]->ParList[p];
 
          for (int d=0; d<3; d++)
          {
-//          2-1. check if particles lie outside the patch
+//          1-1. check if particles lie outside the patch
             ijk[d] = ( ParPos[d][ParID] < EdgeL[d] ) ? 0 : (ParPos[d][ParID] < EdgeR[d]) ? 1 : 2;
 
-//          2-2. reset particle position for periodic B.C.
+//          1-2. reset particle position for periodic B.C.
 //               --> note that EdgeL/R in amr->patch always assumes periodicity
 //               --> OK when calling patch->AddParticle() in the debug mode
             if ( OPT__BC_FLU[2*d] == BC_FLU_PERIODIC  &&  ijk[d] != 1 )
@@ -144,14 +146,14 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
             } // if ( OPT__BC_FLU[2*d] == BC_FLU_PERIODIC  &&  ijk[d] != 1 )
          } // for (int d=0; d<3; d++)
 
-         TSib = SibID[ ijk[2] ][ ijk[1] ][ ijk[0] ];
+         TSib        = SibID[ ijk[2] ][ ijk[1] ][ ijk[0] ];
+         TSibList[p] = TSib;
 
 
-//       2-3. remove particles lying outside the active region for non-periodic B.C. (by setting mass as PAR_INACTIVE_OUTSIDE)
+//       1-3. remove particles lying outside the active region for non-periodic B.C. (by setting mass as PAR_INACTIVE_OUTSIDE)
          if (  !PeriodicAllDir  &&  !Par_WithinActiveRegion( ParPos[0][ParID], ParPos[1][ParID], ParPos[2][ParID] )  )
          {
-            RemoveParList[ NPar_Remove ++ ] = p;
-            NPar_Remove_Tot ++;
+            TSibList[p] = PAR_ESCP_REMOVE;
 
 //          use OpenMP critical construct since RemoveOneParticle will modify NPar_Active/Inactive, which are global variables
 //          --> note that the order of which thread calls RemoveOneParticle() is nondeterministic and may change from run to run
@@ -167,25 +169,10 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
          }
 
 
-//       2-4. deal with escaping particles (i.e., particles lying outside the patch but still within the active region)
+//       1-4. deal with escaping particles (i.e., particles lying outside the patch but still within the active region)
          else if ( TSib != -1 )
          {
-            RemoveParList[ NPar_Remove ++ ] = p;
-            NPar_Remove_Tot ++;
-
-//          allocate ParList_Escp if it's not allocated yet
-            if ( amr->patch[0][lv][PID]->ParList_Escp[TSib] == NULL )
-               amr->patch[0][lv][PID]->ParList_Escp[TSib] = (long*)malloc( ArraySize[TSib]*sizeof(long) );
-
-//          make sure that there is enough memory
-            if ( amr->patch[0][lv][PID]->NPar_Escp[TSib] >= ArraySize[TSib] )
-            {
-               ArraySize[TSib] += NGuess;
-               amr->patch[0][lv][PID]->ParList_Escp[TSib] = (long*)realloc( amr->patch[0][lv][PID]->ParList_Escp[TSib],
-                                                                            ArraySize[TSib]*sizeof(long) );
-            }
-
-            amr->patch[0][lv][PID]->ParList_Escp[TSib][ amr->patch[0][lv][PID]->NPar_Escp[TSib] ++ ] = ParID;
+            amr->patch[0][lv][PID]->NPar_Escp[TSib] ++;
 
 #           ifdef DEBUG_PARTICLE
             if ( amr->Par->Mass[ParID] < 0.0 )
@@ -212,8 +199,49 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
       } // for (int p=0; p<NPar; p++)
 
 
+//    2. scatter the escaping particles into a single contiguous array
+//       --> ParList_Escp[s] points to the segment of sibling s given by the prefix sum of NPar_Escp[]
+//       --> replace the per-sibling malloc/realloc, which was invoked repeatedly for patches with many escaping particles
+      NPar_Escp_Tot = 0;
+      for (int s=0; s<26; s++)   NPar_Escp_Tot += amr->patch[0][lv][PID]->NPar_Escp[s];
+
+      ParList_Escp_Buf = ( NPar_Escp_Tot > 0 ) ? (long*)malloc( NPar_Escp_Tot*sizeof(long) ) : NULL;
+
+      if ( ParList_Escp_Buf != NULL )
+      {
+         long *Ptr = ParList_Escp_Buf;
+
+         for (int s=0; s<26; s++)
+         {
+            amr->patch[0][lv][PID]->ParList_Escp[s]  = Ptr;
+            Ptr                                     += amr->patch[0][lv][PID]->NPar_Escp[s];
+            amr->patch[0][lv][PID]->NPar_Escp   [s]  = 0;     // reset as the counter of the scatter below
+         }
+      }
+
+      RemoveParList = new int [NPar];
+      NPar_Remove   = 0;
+
+      for (int p=0; p<NPar; p++)
+      {
+         TSib = TSibList[p];
+
+         if ( TSib == -1 )    continue;
+
+         RemoveParList[ NPar_Remove ++ ] = p;
+
+         if ( TSib != PAR_ESCP_REMOVE )
+            amr->patch[0][lv][PID]->ParList_Escp[TSib][ amr->patch[0][lv][PID]->NPar_Escp[TSib] ++ ]
+               = amr->patch[0][lv][PID]->ParList[p];
+      }
+
+      NPar_Remove_Tot += NPar_Remove;
+      delete [] TSibList;
+
+
 //    3. remove the escaping particles (set amr->Par->NPar_Lv later due to OpenMP)
       amr->patch[0][lv][PID]->RemoveParticle( NPar_Remove, RemoveParList, NULL, RemoveAllPar_No );
+      Par_UpdateDescendantCount( lv, PID, -NPar_Remove );
       delete [] RemoveParList;
 
    } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
@@ -255,6 +283,8 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
                                                     amr->patch[0][lv][SibPID]->ParList_Escp[ MirSib[s] ],
                                                    &amr->Par->NPar_Lv[lv] );
 #              endif
+
+               Par_UpdateDescendantCount( lv, PID, amr->patch[0][lv][SibPID]->NPar_Escp[ MirSib[s] ] );
             }
          } // for (int s=0; s<26; s++)
 
@@ -320,6 +350,8 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
                                                         amr->patch[0][lv][PID]->ParList_Escp[s],
                                                        &amr->Par->NPar_Lv[FaLv] );
 #           endif
+
+            Par_UpdateDescendantCount( FaLv, FaSibPID, amr->patch[0][lv][PID]->NPar_Escp[s] );
          }
       } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++); for (int s=0; s<26; s++)
    } // if ( NPar_Remove_Tot > 0 )
@@ -381,11 +413,15 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
 
 
 // 9. free memory
+// --> ParList_Escp[0] points to the start of the contiguous array allocated in step 2
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-   for (int s=0; s<26; s++)
    {
-      if ( amr->patch[0][lv][PID]->ParList_Escp[s] != NULL )   free( amr->patch[0][lv][PID]->ParList_Escp[s] );
+      if ( amr->patch[0][lv][PID]->ParList_Escp[0] != NULL )   free( amr->patch[0][lv][PID]->ParList_Escp[0] );
+   }
 
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   for (int s=0; s<26; s++)
+   {
       amr->patch[0][lv][PID]->ParList_Escp[s] = NULL;
       amr->patch[0][lv][PID]->NPar_Escp   [s] = -1;      // -1: indicate that it has not been calculated yet
    }
@@ -67,6 +67,10 @@ void Par_PassParticle2Son_MultiPatch( const int FaLv, const ParPass2Son_t Mode,
    if ( FaLv == TOP_LEVEL  ||  NPatchTotal[SonLv] == 0 )    return;
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after passing particles
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 #  ifdef DEBUG_PARTICLE
    if ( Mode != PAR_PASS2SON_EVOLVE  &&  Mode != PAR_PASS2SON_GENERAL )
       Aux_Error( ERROR_INFO, "unsupported mode = %d !!\n", Mode );
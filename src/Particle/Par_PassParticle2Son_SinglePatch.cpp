@@ -84,12 +84,15 @@ void Par_PassParticle2Son_SinglePatch( const int FaLv, const int FaPID )
 #     else
       amr->patch[0][SonLv][SonPID]->AddParticle( NNewForSon[LocalID], NewListForSon[LocalID], &amr->Par->NPar_Lv[SonLv] );
 #     endif
+
+      Par_UpdateDescendantCount( SonLv, SonPID, NNewForSon[LocalID] );
    }
 
 
 // 4. remove particles in the father patch
 //###NOTE : No OpenMP since RemoveParticle will modify amr->Par->NPar_Lv[]
    const bool RemoveAllParticle = true;
+   Par_UpdateDescendantCount( FaLv, FaPID, -amr->patch[0][FaLv][FaPID]->NPar );
    amr->patch[0][FaLv][FaPID]->RemoveParticle( NULL_INT, NULL, &amr->Par->NPar_Lv[FaLv], RemoveAllParticle );
 
 
@@ -40,33 +40,39 @@ void Par_PredictPos( const long NPar, const long *ParList, real *ParPosX, real *
 #  endif
 
 
-   long ParID;
-   real dt;
+   const real *ParTime   = amr->Par->Time;
+   const real *ParVel[3] = { amr->Par->VelX, amr->Par->VelY, amr->Par->VelZ };
 
+#  ifdef DEBUG_PARTICLE
    for (long p=0; p<NPar; p++)
    {
-      ParID = ParList[p];
+      const long ParID = ParList[p];
 
-#     ifdef DEBUG_PARTICLE
       if ( ParID < 0  ||  ParID >= amr->Par->NPar_AcPlusInac )
          Aux_Error( ERROR_INFO, "ParID (%ld) lies outside the accepted range (0 <= ParID < %ld) !!\n",
                     ParID, amr->Par->NPar_AcPlusInac );
 
       if ( amr->Par->Mass[ParID] < (real)0.0 )
          Aux_Error( ERROR_INFO, "Found inactive particle (ParID %ld, Mass %14.7e) !!\n", ParID, amr->Par->Mass[ParID] );
-#     endif
+   }
+#  endif
 
-//    skip particles waiting for velocity correction (they should already be synchronized with TargetTime)
-      if ( amr->Par->Time[ParID] < (real)0.0 )  continue;
 
-      dt = (real)TargetTime - amr->Par->Time[ParID];
+// branch-free loop for vectorization
+#  pragma omp simd
+   for (long p=0; p<NPar; p++)
+   {
+      const long ParID = ParList[p];
+
+//    skip particles waiting for velocity correction (they should already be synchronized with TargetTime)
+      const real dt = ( ParTime[ParID] < (real)0.0 ) ? (real)0.0 : (real)TargetTime - ParTime[ParID];
 
 //    note that we do not consider periodicity here
 //    --> ParPos[] may lie outside the simulation box
 //    --> caller function is reponsible for taking care of the periodicity
-      ParPosX[p] += amr->Par->VelX[ParID]*dt;
-      ParPosY[p] += amr->Par->VelY[ParID]*dt;
-      ParPosZ[p] += amr->Par->VelZ[ParID]*dt;
+      ParPosX[p] += ParVel[0][ParID]*dt;
+      ParPosY[p] += ParVel[1][ParID]*dt;
+      ParPosZ[p] += ParVel[2][ParID]*dt;
    } // for (long p=0; p<NPar; p++)
 
 } // FUNCTION : Par_PredictPos
@@ -0,0 +1,253 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+static void GetParticleList( const int lv, const int PID, int &NPar, long *&ParList, real **&MassPos );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_ShortRangeAcc
+// Description :  Compute the short-range correction to the particle acceleration interpolated from the mesh
+//                potential
+//
+// Note        :  1. Enabled by PAR_SR_ACC and invoked by Par_UpdateParticle()
+//                2. P3M-like correction by direct summation over the particles within R = PAR_SR_RADIUS*dh[lv]
+//                      dAcc_i = -G*sum_j m_j*(x_i-x_j)*[ (r_ij^2+eps^2)^(-3/2) - R^(-3) ]   for r_ij < R
+//                   where eps = PAR_SR_SOFTEN
+//                   --> The mesh force between two particles is modelled as that of a homogeneous sphere of
+//                       radius R, which becomes Newtonian for r >= R, and thus the correction is truncated at R
+//                   --> Particles with eps < R then feel the force softened by eps instead of the cell size
+//                3. Neighbouring particles are taken from the home patch and its 26 sibling patches at lv
+//                   --> R must not exceed the patch size (i.e., PAR_SR_RADIUS <= PS1)
+//                   --> Particles in the non-leaf and buffer patches must be collected in advance by
+//                       Par_CollectParticle2OneLevel() with SibBufPatch on
+//                   --> Particles in the coarser patches adjacent to lv are ignored
+//                4. Compute the correction for all particles in the real patches at lv
+//                   --> Particles are not required to be synchronized. The current positions are used.
+//                5. Periodic images are taken into account by the minimum image convention if
+//                   OPT__BC_POT == BC_POT_PERIODIC
+//
+// Parameter   :  lv    : Target refinement level
+//                SRAcc : Array to store the acceleration correction of each particle
+//                        --> Indexed by particle ID with a size of amr->Par->NPar_AcPlusInac for each component
+//
+// Return      :  SRAcc[]
+//-------------------------------------------------------------------------------------------------------
+void Par_ShortRangeAcc( const int lv, real *SRAcc[3] )
+{
+
+// check
+#  ifdef DEBUG_PARTICLE
+   if ( amr->Par->SR_Radius <= 0.0  ||  amr->Par->SR_Radius > PS1 )
+      Aux_Error( ERROR_INFO, "incorrect PAR_SR_RADIUS (%14.7e) !!\n", amr->Par->SR_Radius );
+
+   for (int d=0; d<3; d++)
+      if ( SRAcc[d] == NULL )    Aux_Error( ERROR_INFO, "SRAcc[%d] == NULL !!\n", d );
+#  endif
+
+
+   const double dh        = amr->dh[lv];
+   const double R         = amr->Par->SR_Radius*dh;
+   const double R2        = SQR( R );
+   const double _R3       = 1.0/CUBE( R );
+   const double Soften2   = SQR( amr->Par->SR_Soften );
+   const double HalfWidth = 0.5*PS1*dh + R;      // neighbours further than HalfWidth from the patch center are skipped
+   const bool   Periodic  = ( OPT__BC_POT == BC_POT_PERIODIC );
+   const real  *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+   const real  *ParMass   = amr->Par->Mass;
+
+
+#  pragma omp parallel
+   {
+      int     NNb_Max = 0;
+      double *NbMass  = NULL;    // mass of the neighbouring particles
+      double *NbPos   = NULL;    // position of the neighbouring particles relative to the patch center [NNb][3]
+
+#     pragma omp for schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         const int NPar = amr->patch[0][lv][PID]->NPar;
+
+         if ( NPar == 0 )  continue;
+
+         double Center[3];
+         for (int d=0; d<3; d++)    Center[d] = 0.5*( amr->patch[0][lv][PID]->EdgeL[d] + amr->patch[0][lv][PID]->EdgeR[d] );
+
+
+//       1. gather the particles in the home and sibling patches lying close enough to this patch
+//       1-1. upper bound of the number of neighbours
+         int   NNb_Tot = 0, NParNb, SibPID;
+         long *ParListNb;
+         real **MassPosNb;
+
+         for (int s=-1; s<26; s++)
+         {
+            SibPID = ( s == -1 ) ? PID : amr->patch[0][lv][PID]->sibling[s];
+
+            if ( SibPID < 0 )    continue;
+
+            GetParticleList( lv, SibPID, NParNb, ParListNb, MassPosNb );
+            NNb_Tot += NParNb;
+         }
+
+         if ( NNb_Tot > NNb_Max )
+         {
+            delete [] NbMass;
+            delete [] NbPos;
+
+            NNb_Max = NNb_Tot;
+            NbMass  = new double [  NNb_Max];
+            NbPos   = new double [3*NNb_Max];
+         }
+
+//       1-2. record the mass and relative position of each neighbour
+         int NNb = 0;
+
+         for (int s=-1; s<26; s++)
+         {
+            SibPID = ( s == -1 ) ? PID : amr->patch[0][lv][PID]->sibling[s];
+
+            if ( SibPID < 0 )    continue;
+
+            GetParticleList( lv, SibPID, NParNb, ParListNb, MassPosNb );
+
+            for (int p=0; p<NParNb; p++)
+            {
+               double Mass, dr[3];
+               bool   Skip = false;
+
+//             MassPosNb is only used by LOAD_BALANCE (see GetParticleList())
+#              ifdef LOAD_BALANCE
+               if ( ParListNb != NULL )
+#              endif
+               {
+                  const long ParID = ParListNb[p];
+
+                  Mass = ParMass[ParID];
+                  for (int d=0; d<3; d++)    dr[d] = ParPos[d][ParID] - Center[d];
+               }
+
+#              ifdef LOAD_BALANCE
+               else
+               {
+                  Mass = MassPosNb[0][p];
+                  for (int d=0; d<3; d++)    dr[d] = MassPosNb[d+1][p] - Center[d];
+               }
+#              endif
+
+               for (int d=0; d<3; d++)
+               {
+                  if ( Periodic )
+                  {
+                     if      ( dr[d] > +0.5*amr->BoxSize[d] )   dr[d] -= amr->BoxSize[d];
+                     else if ( dr[d] < -0.5*amr->BoxSize[d] )   dr[d] += amr->BoxSize[d];
+                  }
+
+                  if ( fabs(dr[d]) > HalfWidth )  Skip = true;
+               }
+
+               if ( Skip  ||  Mass <= 0.0 )  continue;
+
+               NbMass[NNb] = Mass;
+               for (int d=0; d<3; d++)    NbPos[ 3*NNb + d ] = dr[d];
+               NNb ++;
+            } // for (int p=0; p<NParNb; p++)
+         } // for (int s=-1; s<26; s++)
+
+
+//       2. direct summation for all particles in this patch
+//       --> the particle itself contributes nothing since dr = 0
+         for (int p=0; p<NPar; p++)
+         {
+            const long ParID = amr->patch[0][lv][PID]->ParList[p];
+
+            double Pos[3], Acc[3] = { 0.0, 0.0, 0.0 };
+
+            for (int d=0; d<3; d++)
+            {
+               Pos[d] = ParPos[d][ParID] - Center[d];
+
+               if ( Periodic )
+               {
+                  if      ( Pos[d] > +0.5*amr->BoxSize[d] )  Pos[d] -= amr->BoxSize[d];
+                  else if ( Pos[d] < -0.5*amr->BoxSize[d] )  Pos[d] += amr->BoxSize[d];
+               }
+            }
+
+            for (int t=0; t<NNb; t++)
+            {
+               const double dx = Pos[0] - NbPos[ 3*t + 0 ];
+               const double dy = Pos[1] - NbPos[ 3*t + 1 ];
+               const double dz = Pos[2] - NbPos[ 3*t + 2 ];
+               const double r2 = SQR(dx) + SQR(dy) + SQR(dz);
+
+               if ( r2 >= R2 )   continue;
+
+               const double _r3_Soften = 1.0/( (r2+Soften2)*sqrt(r2+Soften2) );
+               const double Factor     = -NEWTON_G*NbMass[t]*( _r3_Soften - _R3 );
+
+               Acc[0] += Factor*dx;
+               Acc[1] += Factor*dy;
+               Acc[2] += Factor*dz;
+            }
+
+            for (int d=0; d<3; d++)    SRAcc[d][ParID] = (real)Acc[d];
+         } // for (int p=0; p<NPar; p++)
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+      delete [] NbMass;
+      delete [] NbPos;
+   } // OpenMP parallel region
+
+} // FUNCTION : Par_ShortRangeAcc
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetParticleList
+// Description :  Return the particles associated with the target patch
+//
+// Note        :  1. Leaf real patches   : NPar and ParList
+//                   Other patches       : NPar_Copy and ParList_Copy (or ParMassPos_Copy for LOAD_BALANCE)
+//                   --> See the notes in Par_CollectParticle2OneLevel()
+//                2. Exactly one of ParList and MassPos is set to non-NULL when NPar > 0
+//
+// Parameter   :  lv      : Target refinement level
+//                PID     : Target patch index
+//                NPar    : Number of particles
+//                ParList : Particle IDs
+//                MassPos : Particle mass and position [4][NPar]
+//
+// Return      :  NPar, ParList, MassPos
+//-------------------------------------------------------------------------------------------------------
+void GetParticleList( const int lv, const int PID, int &NPar, long *&ParList, real **&MassPos )
+{
+
+   patch_t *Patch = amr->patch[0][lv][PID];
+
+   if ( PID < amr->NPatchComma[lv][1]  &&  Patch->son == -1 )
+   {
+      NPar    = Patch->NPar;
+      ParList = Patch->ParList;
+      MassPos = NULL;
+   }
+
+   else
+   {
+      NPar    = MAX( Patch->NPar_Copy, 0 );
+#     ifdef LOAD_BALANCE
+      ParList = NULL;
+      MassPos = Patch->ParMassPos_Copy;
+#     else
+      ParList = Patch->ParList_Copy;
+      MassPos = NULL;
+#     endif
+   }
+
+} // FUNCTION : GetParticleList
+
+
+
+#endif // #ifdef PARTICLE
@@ -0,0 +1,96 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_SortByPatch
+// Description :  Reorder the particle repository so that particles belonging to the same patch are stored
+//                contiguously
+//
+// Note        :  1. Particles are sorted first by level and then by the space-filling-curve index of their home
+//                   patches (i.e., patch->LB_Idx)
+//                   --> ParList[] of each patch becomes a contiguous range of particle IDs, and consecutive
+//                       patches access consecutive memory in Par_MassAssignment(), Par_UpdateParticle(), and
+//                       the particle exchange routines
+//                2. Inactive particles are moved to the end of the repository and InactiveParList[] is updated
+//                   accordingly
+//                3. Enabled by PAR_SORT_INTERVAL and invoked by main() every PAR_SORT_INTERVAL root-level steps
+//                   --> Must be invoked when no particle is temporarily stored in ParList_Copy[] or ParList_Escp[]
+//                4. The particle attributes are not modified, and thus the results are bitwise identical unless
+//                   the order of summation over particles matters (e.g., the mass assignment)
+//-------------------------------------------------------------------------------------------------------
+void Par_SortByPatch()
+{
+
+   const long NPar_AcPlusInac = amr->Par->NPar_AcPlusInac;
+
+   long *OldID = new long [NPar_AcPlusInac];
+   long  NewID = 0;
+
+
+// ParList_Copy[] collected by Par_CollectParticle2OneLevel() no longer applies after reordering
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
+// 1. active particles: loop over all real patches sorted by LB_Idx level by level
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NReal = amr->NPatchComma[lv][1];
+
+      long *LB_Idx   = new long [NReal];
+      int  *IdxTable = new int  [NReal];
+
+      for (int PID=0; PID<NReal; PID++)   LB_Idx[PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+      Mis_Heapsort( NReal, LB_Idx, IdxTable );
+
+      for (int t=0; t<NReal; t++)
+      {
+         patch_t *Patch = amr->patch[0][lv][ IdxTable[t] ];
+
+         for (int p=0; p<Patch->NPar; p++)
+         {
+#           ifdef DEBUG_PARTICLE
+            if ( NewID >= NPar_AcPlusInac )
+               Aux_Error( ERROR_INFO, "NewID (%ld) >= NPar_AcPlusInac (%ld) !!\n", NewID, NPar_AcPlusInac );
+#           endif
+
+            OldID[NewID]      = Patch->ParList[p];
+            Patch->ParList[p] = NewID ++;
+         }
+      }
+
+      delete [] LB_Idx;
+      delete [] IdxTable;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   if ( NewID != amr->Par->NPar_Active )
+      Aux_Error( ERROR_INFO, "number of particles in all patches (%ld) != NPar_Active (%ld) !!\n",
+                 NewID, amr->Par->NPar_Active );
+
+
+// 2. inactive particles
+   for (long t=0; t<amr->Par->NPar_Inactive; t++)
+   {
+      OldID[NewID]                 = amr->Par->InactiveParList[t];
+      amr->Par->InactiveParList[t] = NewID ++;
+   }
+
+   if ( NewID != NPar_AcPlusInac )
+      Aux_Error( ERROR_INFO, "number of sorted particles (%ld) != NPar_AcPlusInac (%ld) !!\n",
+                 NewID, NPar_AcPlusInac );
+
+
+// 3. reorder the repository
+   amr->Par->ReorderRepo( OldID );
+
+   delete [] OldID;
+
+} // FUNCTION : Par_SortByPatch
+
+
+
+#endif // #ifdef PARTICLE
@@ -53,6 +53,10 @@ int Par_Synchronize( const double SyncTime, const ParSync_t SyncOption )
    if ( SyncTime == CurrentSyncTime )  return 2;
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after synchronization
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // allocate the backup array
    long MemUnit, MemSize;
 
@@ -157,6 +161,10 @@ void Par_Synchronize_Restore( const double SyncTime )
    if ( Backup_NPar < 0 )  Aux_Error( ERROR_INFO, "backup arrays have NOT been allocated !!\n" );
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after restoration
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // restore particle attributes (position, velocity, and time)
    real *ParTime   =   amr->Par->Time;
    real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
@@ -6,6 +6,11 @@
 #   error : ERROR : GRAVITY is not defined !!
 #endif
 
+static void InterpolateAcc( const ParInterp_t IntScheme, const real *Acc, const int AccSize, const int ParGhost,
+                            const double EdgeL[], const double EdgeR[], const double _dh, const real Pos[],
+                            const bool AllowOutside, real Acc_Out[] );
+static int  GetNSubCycle( const real dt, const real Acc[], const double dh );
+
 
 
 
@@ -39,6 +44,24 @@
 //                   --> Particle position, velocity, and time are not modified at all
 //                   --> Use "TimeNew" to determine the target time
 //                   --> StoreAcc must be on, and UseStoredAcc must be off
+//                9. For PAR_MAX_SUBCYCLE > 0, the KDK prediction step advances each particle by N = 2^n (n <=
+//                   PAR_MAX_SUBCYCLE) sub-steps of dt/N so that each sub-step satisfies the particle acceleration
+//                   criterion of that particle alone (see GetNSubCycle())
+//                   --> Consecutive sub-steps are combined as K-D-(K+K)-D-...-D, and the last K operation is left
+//                       to the correction step as usual (particle time is set to -0.5*dt/N)
+//                   --> Intermediate kicks adopt the acceleration interpolated at the intermediate positions from
+//                       the potential at TimeOld (i.e., the potential is assumed constant within one level step)
+//                   --> The level time-step and the fluid solver are not affected
+//                   --> Does not work with UseStoredAcc
+//               10. For PAR_SR_ACC, the short-range correction computed by Par_ShortRangeAcc() is added to the
+//                   acceleration interpolated from the potential
+//                   --> It is included in the stored acceleration for StoreAcc and thus not recomputed for UseStoredAcc
+//               11. Particles in each patch are updated in two passes
+//                   --> The first pass computes the time-step and acceleration of each particle
+//                   --> The second pass applies the kick-drift operations by branch-free loops vectorized with
+//                       "omp simd" (except for the sub-cycling of PAR_MAX_SUBCYCLE)
+//                   --> The number of updated particles and the elapsed time are accumulated in ParUpdate_NPar
+//                       and ParUpdate_Time for Aux_Record_Performance()
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach (also used by PAR_UPSTEP_ACC_ONLY)
@@ -53,6 +76,7 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
                          const bool StoreAcc, const bool UseStoredAcc )
 {
 
+   const long   Time_Start        = ThreadTimer_t::GetNanoSec();
    const ParInterp_t IntScheme    = amr->Par->Interp;
    const bool   IntPhase_No       = false;
    const bool   DE_Consistency_No = false;
@@ -78,6 +102,34 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
 #  endif
    real *ParTime   = amr->Par->Time;
 
+   const bool SubCycle = ( amr->Par->MaxSubCycle > 0  &&  amr->Par->Integ == PAR_INTEG_KDK  &&
+                           UpdateStep == PAR_UPSTEP_PRED  &&  !UseStoredAcc );
+
+
+// short-range correction to the mesh acceleration for PAR_SR_ACC
+// --> must be computed before updating any particle since it requires the positions of the nearby particles
+   real *SRAcc[3] = { NULL, NULL, NULL };
+
+   if ( amr->Par->ShortRangeAcc  &&  !UseStoredAcc )
+   {
+      const bool PredictPos_No    = false;
+      const bool SibBufPatch_Yes  = true;
+      const bool FaSibBufPatch_No = false;
+      const bool JustCountNPar_No = false;
+      const bool TimingSendPar_No = false;
+
+      for (int d=0; d<3; d++)    SRAcc[d] = new real [ amr->Par->NPar_AcPlusInac ];
+
+      Par_CollectParticle2OneLevel( lv, PredictPos_No, NULL_REAL, SibBufPatch_Yes, FaSibBufPatch_No, JustCountNPar_No,
+                                    TimingSendPar_No );
+      Par_ShortRangeAcc( lv, SRAcc );
+      Par_CollectParticle2OneLevel_FreeMemory( lv, SibBufPatch_Yes, FaSibBufPatch_No );
+   }
+
+
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after updating their positions
+   if ( UpdateStep != PAR_UPSTEP_ACC_ONLY )  Par_CollectParticle2OneLevel_InvalidateCache();
+
 
 // determine PotSg for STORE_POT_GHOST
 #  ifdef STORE_POT_GHOST
@@ -164,6 +216,8 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
 
 
 // OpenMP parallel region
+   long NUpdate = 0;    // number of particles updated on this rank
+
 #  pragma omp parallel
    {
 
@@ -175,8 +229,10 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
    real (*Acc3D)[AccSize][AccSize][AccSize] = ( real (*)[AccSize][AccSize][AccSize] )Acc;
 
    bool   GotYou;
-   long   ParID;
-   real   Acc_Temp[3], dt, dt_half;
+   int    NParBuf = 0;
+   long   ParID, NUpdate_Thread = 0;
+   real   Acc_Temp[3], Pos_Temp[3], dt, dt_half;
+   real  *AccBuf[3] = { NULL, NULL, NULL }, *dtBuf = NULL;   // acceleration and time-step of each particle in one patch
    double PhyCorner_ExtAcc[3], PhyCorner_ExtPot[3], x, y, z;
 
 
@@ -322,301 +378,475 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
          } // if ( !UseStoredAcc )
 
 
-         for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+         const int   NPar    = amr->patch[0][lv][PID]->NPar;
+         const long *ParList = amr->patch[0][lv][PID]->ParList;
+
+//       allocate the per-thread buffers storing the acceleration and time-step of each particle
+         if ( NPar > NParBuf )
          {
-            ParID = amr->patch[0][lv][PID]->ParList[p];
+            for (int d=0; d<3; d++)
+            {
+               delete [] AccBuf[d];
+               AccBuf[d] = new real [NPar];
+            }
+
+            delete [] dtBuf;
+            dtBuf   = new real [NPar];
+            NParBuf = NPar;
+         }
+
+         for (int p=0; p<NPar; p++)
+         {
+            ParID = ParList[p];
 
 //          determine time-step and skip particles with zero or negative time-step
+//          --> set dtBuf[] and AccBuf[] to zero for the skipped particles so that the update kernels in step 5
+//              leave them intact
             if ( UpdateStep == PAR_UPSTEP_PRED )
             {
 //             it's crucial to first calculate dt here and skip particles with dt <= (real)0.0 (including the equal sign)
 //             since later on we select particles with negative particle time (which has been set to -dt), with equal sign
 //             excluded, for the velocity correction
-               dt      = (real)TimeNew - ParTime[ParID];
-               dt_half = (real)0.5*dt;
-
-               if ( dt <= (real)0.0 )  continue;
+               dt       = (real)TimeNew - ParTime[ParID];
+               dtBuf[p] = dt;
             }
 
             else if ( UpdateStep == PAR_UPSTEP_CORR )
             {
 //             during the prediction step, we store particle time as -0.5*dt (which must be < 0.0) to indicate that
 //             these particles require velocity correction
-               dt_half = -ParTime[ParID];
-
-               if ( dt_half <= (real)0.0 )   continue;
+               dt_half  = -ParTime[ParID];
+               dtBuf[p] = dt_half;
             }
 
             else if ( UpdateStep == PAR_UPSTEP_ACC_ONLY )
             {
-               dt      = NULL_REAL;    // useless
-               dt_half = NULL_REAL;    // useless
+               dtBuf[p] = (real)1.0;   // useless but must be positive
             }
 
-
-//          4. calculate acceleration at the particle position
-            switch ( IntScheme ) {
-
-//          4.1 NGP
-            case ( PAR_INTERP_NGP ):
+            if ( dtBuf[p] <= (real)0.0 )
             {
-               int idx[3];
-
-//             calculate the nearest grid index
-               if ( !UseStoredAcc )
-               for (int d=0; d<3; d++)
-               {
-                  idx[d] = int( ( ParPos[d][ParID] - amr->patch[0][lv][PID]->EdgeL[d] )*_dh );
-
-//                prevent from round-off errors (especially for NGP and TSC)
-                  if ( idx[d] < 0 )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeL[d], NULL, false )  )
-                     Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idx %d) !!\n",
-                                d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeL[d], idx[d] );
-#                    endif
-
-                     idx[d] = 0;
-                  }
-
-                  else if ( idx[d] >= AccSize )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeR[d], NULL, false )  )
-                        Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idx %d) !!\n",
-                                   d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeR[d], idx[d] );
-#                    endif
-
-                     idx[d] = AccSize - 1;
-                  }
-               } // for (int d=0; d<3; d++)
+               dtBuf[p] = (real)0.0;
+               for (int d=0; d<3; d++)    AccBuf[d][p] = (real)0.0;
 
-//             calculate acceleration
-               for (int d=0; d<3; d++)
-               {
-#                 ifdef STORE_PAR_ACC
-                  if ( UseStoredAcc )
-                     Acc_Temp[d] = ParAcc[d][ParID];
-                  else
-#                 endif
-                     Acc_Temp[d] = Acc3D[d][ idx[2] ][ idx[1] ][ idx[0] ];
+               continue;
+            }
 
-#                 ifdef STORE_PAR_ACC
-                  if ( StoreAcc )   ParAcc[d][ParID] = Acc_Temp[d];
-#                 endif
-               }
-            } // PAR_INTERP_NGP
-            break;
+            if ( UpdateStep != PAR_UPSTEP_ACC_ONLY )  NUpdate_Thread ++;
 
 
-//          4.2 CIC
-            case ( PAR_INTERP_CIC ):
+//          4. calculate acceleration at the particle position
+#           ifdef STORE_PAR_ACC
+            if ( UseStoredAcc )
+               for (int d=0; d<3; d++)    Acc_Temp[d] = ParAcc[d][ParID];
+            else
+#           endif
             {
-               int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
-               double dr      [3];     // distance to the center of the left cell
-               double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
+               for (int d=0; d<3; d++)    Pos_Temp[d] = ParPos[d][ParID];
 
-               if ( !UseStoredAcc )
-               for (int d=0; d<3; d++)
-               {
-//                calculate the array index of the left and right cells
-                  dr      [d] = ( ParPos[d][ParID] - amr->patch[0][lv][PID]->EdgeL[d] )*_dh + ParGhost - 0.5;
-                  idxLR[0][d] = int( dr[d] );
-                  idxLR[1][d] = idxLR[0][d] + 1;
-
-//                prevent from round-off errors
-//                (CIC should be clear off this issue unless round-off erros are comparable to dh)
-                  if ( idxLR[0][d] < 0 )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeL[d], NULL, false )  )
-                     Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idxL %d, idxR %d) !!\n",
-                                d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeL[d], idxLR[0][d], idxLR[1][d] );
-#                    endif
-
-                     idxLR[0][d] = 0;
-                     idxLR[1][d] = 1;
-                  }
+               InterpolateAcc( IntScheme, Acc, AccSize, ParGhost, amr->patch[0][lv][PID]->EdgeL,
+                               amr->patch[0][lv][PID]->EdgeR, _dh, Pos_Temp, false, Acc_Temp );
 
-                  else if ( idxLR[1][d] >= AccSize )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeR[d], NULL, false )  )
-                     Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idxL %d, idxR %d) !!\n",
-                                d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeR[d], idxLR[0][d], idxLR[1][d] );
-#                    endif
-
-                     idxLR[0][d] = AccSize - 2;
-                     idxLR[1][d] = AccSize - 1;
-                  }
+               if ( SRAcc[0] != NULL )
+                  for (int d=0; d<3; d++)    Acc_Temp[d] += SRAcc[d][ParID];
+            }
 
-//                get the weighting of the nearby 8 cells
-                  dr     [d] -= (double)idxLR[0][d];
-                  Frac[0][d]  = 1.0 - dr[d];
-                  Frac[1][d]  =       dr[d];
-               } // for (int d=0; d<3; d++)
+#           ifdef STORE_PAR_ACC
+            if ( StoreAcc )
+               for (int d=0; d<3; d++)    ParAcc[d][ParID] = Acc_Temp[d];
+#           endif
 
-//             calculate acceleration
-               for (int d=0; d<3; d++)
-               {
-#                 ifdef STORE_PAR_ACC
-                  if ( UseStoredAcc )
-                     Acc_Temp[d] = ParAcc[d][ParID];
-                  else
-#                 endif
-                  {
-                     Acc_Temp[d] = (real)0.0;
+            for (int d=0; d<3; d++)    AccBuf[d][p] = Acc_Temp[d];
+         } // for (int p=0; p<NPar; p++)
 
-                     for (int k=0; k<2; k++)
-                     for (int j=0; j<2; j++)
-                     for (int i=0; i<2; i++)
-                     Acc_Temp[d] += Acc3D[d][ idxLR[k][2] ][ idxLR[j][1] ][ idxLR[i][0] ]
-                                   *Frac[i][0]*Frac[j][1]*Frac[k][2];
-                  }
 
-#                 ifdef STORE_PAR_ACC
-                  if ( StoreAcc )   ParAcc[d][ParID] = Acc_Temp[d];
-#                 endif
-               }
-            } // PAR_INTERP_CIC
-            break;
+//       5. update particles
+//       --> use branch-free kernels vectorized by "omp simd" except for the sub-cycling
+//           --> particles in ParList[] are distinct, and thus the scattered stores do not conflict
+//           --> skipped particles have dtBuf[] == 0.0 and keep their original time
+//       5.0 nothing to do if we only want to store particle acceleration
+         if ( UpdateStep == PAR_UPSTEP_ACC_ONLY )     continue;
 
 
-//          4.3 TSC
-            case ( PAR_INTERP_TSC ):
+//       5.1 Euler method
+         else if ( amr->Par->Integ == PAR_INTEG_EULER )
+         {
+#           pragma omp simd
+            for (int p=0; p<NPar; p++)
             {
-               int    idxLCR[3][3];    // array index of the left/central/right cells (idxLCR[0/1/2][d])
-               double dr       [3];    // distance to the left edge of the central cell
-               double Frac  [3][3];    // weighting of the left/central/right cells (Frac[0/1/2][d])
+               const long ID   = ParList[p];
+               const real dt_p = dtBuf[p];
 
-               if ( !UseStoredAcc )
                for (int d=0; d<3; d++)
                {
-//                calculate the array index of the left, central, and right cells
-                  dr       [d] = ( ParPos[d][ParID] - amr->patch[0][lv][PID]->EdgeL[d] )*_dh + ParGhost;
-                  idxLCR[1][d] = int( dr[d] );
-                  idxLCR[0][d] = idxLCR[1][d] - 1;
-                  idxLCR[2][d] = idxLCR[1][d] + 1;
-
-//                prevent from round-off errors (especially for NGP and TSC)
-                  if ( idxLCR[0][d] < 0 )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeL[d], NULL, false )  )
-                     Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idxL %d, idxR %d) !!\n",
-                                d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeL[d], idxLCR[0][d], idxLCR[2][d] );
-#                    endif
-
-                     idxLCR[0][d] = 0;
-                     idxLCR[1][d] = 1;
-                     idxLCR[2][d] = 2;
-                  }
+                  ParPos[d][ID] += ParVel[d][ID]*dt_p;   // update position first
+                  ParVel[d][ID] += AccBuf[d][p] *dt_p;
+               }
 
-                  else if ( idxLCR[2][d] >= AccSize )
-                  {
-#                    ifdef DEBUG_PARTICLE
-                     if (  ! Mis_CompareRealValue( ParPos[d][ParID], (real)amr->patch[0][lv][PID]->EdgeR[d], NULL, false )  )
-                     Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idxL %d, idxR %d) !!\n",
-                                d, ParPos[d][ParID], amr->patch[0][lv][PID]->EdgeR[d], idxLCR[0][d], idxLCR[2][d] );
-#                    endif
-
-                     idxLCR[0][d] = AccSize - 3;
-                     idxLCR[1][d] = AccSize - 2;
-                     idxLCR[2][d] = AccSize - 1;
-                  }
+               ParTime[ID] = ( dt_p > (real)0.0 ) ? (real)TimeNew : ParTime[ID];
+            }
+         }
 
-//                get the weighting of the nearby 27 cells
-                  dr     [d] -= (double)idxLCR[1][d];
-                  Frac[0][d]  = 0.5*SQR( 1.0 - dr[d] );
-                  Frac[1][d]  = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
-                  Frac[2][d]  = 0.5*SQR( dr[d] );
-               } // for (int d=0; d<3; d++)
 
-//             calculate acceleration
-               for (int d=0; d<3; d++)
+//       5.2 KDK scheme
+         else if ( amr->Par->Integ == PAR_INTEG_KDK )
+         {
+//          5.2.1 KDK prediction with sub-cycling
+            if ( UpdateStep == PAR_UPSTEP_PRED  &&  SubCycle )
+            {
+               for (int p=0; p<NPar; p++)
                {
-#                 ifdef STORE_PAR_ACC
-                  if ( UseStoredAcc )
-                     Acc_Temp[d] = ParAcc[d][ParID];
-                  else
-#                 endif
-                  {
-                     Acc_Temp[d] = (real)0.0;
+                  ParID = ParList[p];
+                  dt    = dtBuf[p];
 
-                     for (int k=0; k<3; k++)
-                     for (int j=0; j<3; j++)
-                     for (int i=0; i<3; i++)
-                     Acc_Temp[d] += Acc3D[d][ idxLCR[k][2] ][ idxLCR[j][1] ][ idxLCR[i][0] ]
-                                   *Frac[i][0]*Frac[j][1]*Frac[k][2];
-                  }
+                  if ( dt <= (real)0.0 )  continue;
 
-#                 ifdef STORE_PAR_ACC
-                  if ( StoreAcc )   ParAcc[d][ParID] = Acc_Temp[d];
-#                 endif
-               }
-            } // PAR_INTERP_TSC
-            break;
+                  for (int d=0; d<3; d++)    Acc_Temp[d] = AccBuf[d][p];
 
+//                sub-cycle particles with large acceleration for PAR_MAX_SUBCYCLE
+                  const int  NSub        = GetNSubCycle( dt, Acc_Temp, dh );
+                  const real dt_sub      = dt/NSub;
+                  const real dt_sub_half = (real)0.5*dt_sub;
 
-            default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
-            } // switch ( IntScheme )
+                  for (int s=0; s<NSub; s++)
+                  {
+//                   combine the last K operation of the previous sub-step with the first one of this sub-step
+                     real dt_kick = dt_sub_half;
 
+                     if ( s > 0 )
+                     {
+                        for (int d=0; d<3; d++)    Pos_Temp[d] = ParPos[d][ParID];
 
-//          5. update particles
-//          5.0 nothing to do if we only want to store particle acceleration
-            if ( UpdateStep == PAR_UPSTEP_ACC_ONLY )     continue;
+                        InterpolateAcc( IntScheme, Acc, AccSize, ParGhost, amr->patch[0][lv][PID]->EdgeL,
+                                        amr->patch[0][lv][PID]->EdgeR, _dh, Pos_Temp, true, Acc_Temp );
 
+//                      short-range correction is not updated within one level step
+                        if ( SRAcc[0] != NULL )
+                           for (int d=0; d<3; d++)    Acc_Temp[d] += SRAcc[d][ParID];
 
-//          5.1 Euler method
-            else if ( amr->Par->Integ == PAR_INTEG_EULER )
-            {
-               for (int d=0; d<3; d++)
-               {
-                  ParPos[d][ParID] += ParVel  [d][ParID]*dt;   // update position first
-                  ParVel[d][ParID] += Acc_Temp[d]       *dt;
-               }
+                        dt_kick = dt_sub;
+                     }
 
-               ParTime[ParID] = TimeNew;
-            }
+                     for (int d=0; d<3; d++)
+                     {
+                        ParVel[d][ParID] += Acc_Temp[d]       *dt_kick; // predict velocity for 0.5*dt_sub (or dt_sub if s > 0)
+                        ParPos[d][ParID] += ParVel  [d][ParID]*dt_sub;  // update position by the half-step velocity for a full dt_sub
+                     }
+                  }
 
+                  ParTime[ParID] = -dt_sub_half;   // negative --> indicating that it requires velocity correction
+               } // for (int p=0; p<NPar; p++)
+            }
 
-//          5.2 KDK scheme
-            else if ( amr->Par->Integ == PAR_INTEG_KDK )
+//          5.2.2 KDK prediction
+            else if ( UpdateStep == PAR_UPSTEP_PRED )
             {
-//             5.2.1 KDK prediction
-               if ( UpdateStep == PAR_UPSTEP_PRED )
+#              pragma omp simd
+               for (int p=0; p<NPar; p++)
                {
+                  const long ID        = ParList[p];
+                  const real dt_p      = dtBuf[p];
+                  const real dt_half_p = (real)0.5*dt_p;
+
                   for (int d=0; d<3; d++)
                   {
-                     ParVel[d][ParID] += Acc_Temp[d]       *dt_half; // predict velocity for 0.5*dt
-                     ParPos[d][ParID] += ParVel  [d][ParID]*dt;      // update position by the half-step velocity for a full dt
+                     ParVel[d][ID] += AccBuf[d][p] *dt_half_p;    // predict velocity for 0.5*dt
+                     ParPos[d][ID] += ParVel[d][ID]*dt_p;         // update position by the half-step velocity
                   }
 
-                  ParTime[ParID] = -dt_half;   // negative --> indicating that it requires velocity correction
+//                negative --> indicating that it requires velocity correction
+                  ParTime[ID] = ( dt_p > (real)0.0 ) ? -dt_half_p : ParTime[ID];
                }
+            }
 
-//             5.2.2 KDK correction for velocity
-               else // UpdateStep == PAR_UPSTEP_CORR
+//          5.2.3 KDK correction for velocity
+            else // UpdateStep == PAR_UPSTEP_CORR
+            {
+#              pragma omp simd
+               for (int p=0; p<NPar; p++)
                {
+                  const long ID        = ParList[p];
+                  const real dt_half_p = dtBuf[p];
+
                   for (int d=0; d<3; d++)
-                     ParVel[d][ParID] += Acc_Temp[d]*dt_half;     // correct velocity for 0.5*dt
+                     ParVel[d][ID] += AccBuf[d][p]*dt_half_p;     // correct velocity for 0.5*dt
 
-                  ParTime[ParID] = TimeNew;
+                  ParTime[ID] = ( dt_half_p > (real)0.0 ) ? (real)TimeNew : ParTime[ID];
                }
-            } // amr->Par->Integ
-         } // for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)`
+            }
+         } // amr->Par->Integ
       } // for (int PID=PID0, P=0; PID<PID0+8; PID++, P++)
    } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
 
 // 6. free memory
    delete [] Pot;
    delete [] Acc;
+   delete [] dtBuf;
+   for (int d=0; d<3; d++)    delete [] AccBuf[d];
+
+#  pragma omp atomic
+   NUpdate += NUpdate_Thread;
 
    } // end of OpenMP parallel region
 
+   for (int d=0; d<3; d++)    delete [] SRAcc[d];
+
+
+// 7. record the number of updated particles and the elapsed time for Aux_Record_Performance()
+   if ( UpdateStep != PAR_UPSTEP_ACC_ONLY )
+   {
+      ParUpdate_NPar += NUpdate;
+      ParUpdate_Time += 1.0e-9*( ThreadTimer_t::GetNanoSec() - Time_Start );
+   }
+
 } // FUNCTION : Par_UpdateParticle
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InterpolateAcc
+// Description :  Interpolate the acceleration at the target position from the cell-centered acceleration
+//                array of one patch
+//
+// Note        :  1. Invoked by Par_UpdateParticle()
+//                2. Cells outside the acceleration array are replaced by the nearest cells inside the array
+//                   --> For the particle position at the beginning of the step, this only happens because of
+//                       the round-off errors, which is verified when DEBUG_PARTICLE is on
+//                   --> For the intermediate positions of sub-cycling (AllowOutside == true), particles may
+//                       travel beyond the ghost zones, for which the acceleration of the boundary cells is adopted
+//
+// Parameter   :  IntScheme    : Particle interpolation scheme (PAR_INTERP_NGP/CIC/TSC)
+//                Acc          : Cell-centered acceleration array with the size [3][AccSize][AccSize][AccSize]
+//                AccSize      : Size of Acc[] along each direction
+//                ParGhost     : Number of ghost zones of Acc[]
+//                EdgeL/R      : Left/right edges of the target patch
+//                _dh          : Inverse of the cell size
+//                Pos          : Target position
+//                AllowOutside : Allow Pos[] to lie outside Acc[] (see Note 2)
+//                Acc_Out      : Interpolated acceleration
+//
+// Return      :  Acc_Out[]
+//-------------------------------------------------------------------------------------------------------
+void InterpolateAcc( const ParInterp_t IntScheme, const real *Acc, const int AccSize, const int ParGhost,
+                     const double EdgeL[], const double EdgeR[], const double _dh, const real Pos[],
+                     const bool AllowOutside, real Acc_Out[] )
+{
+
+   const real (*Acc3D)[AccSize][AccSize][AccSize] = ( const real (*)[AccSize][AccSize][AccSize] )Acc;
+
+   switch ( IntScheme ) {
+
+// 1 NGP
+   case ( PAR_INTERP_NGP ):
+   {
+      int idx[3];
+
+//    calculate the nearest grid index
+      for (int d=0; d<3; d++)
+      {
+         idx[d] = int( ( Pos[d] - EdgeL[d] )*_dh );
+
+//       prevent from round-off errors (especially for NGP and TSC)
+         if ( idx[d] < 0 )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeL[d], NULL, false )  )
+            Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idx %d) !!\n",
+                       d, Pos[d], EdgeL[d], idx[d] );
+#           endif
+
+            idx[d] = 0;
+         }
+
+         else if ( idx[d] >= AccSize )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeR[d], NULL, false )  )
+               Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idx %d) !!\n",
+                          d, Pos[d], EdgeR[d], idx[d] );
+#           endif
+
+            idx[d] = AccSize - 1;
+         }
+      } // for (int d=0; d<3; d++)
+
+//    calculate acceleration
+      for (int d=0; d<3; d++)    Acc_Out[d] = Acc3D[d][ idx[2] ][ idx[1] ][ idx[0] ];
+   } // PAR_INTERP_NGP
+   break;
+
+
+// 2 CIC
+   case ( PAR_INTERP_CIC ):
+   {
+      int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
+      double dr      [3];     // distance to the center of the left cell
+      double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
+
+      for (int d=0; d<3; d++)
+      {
+//       calculate the array index of the left and right cells
+         dr      [d] = ( Pos[d] - EdgeL[d] )*_dh + ParGhost - 0.5;
+         idxLR[0][d] = int( dr[d] );
+         idxLR[1][d] = idxLR[0][d] + 1;
+
+//       prevent from round-off errors
+//       (CIC should be clear off this issue unless round-off erros are comparable to dh)
+         if ( idxLR[0][d] < 0 )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeL[d], NULL, false )  )
+            Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idxL %d, idxR %d) !!\n",
+                       d, Pos[d], EdgeL[d], idxLR[0][d], idxLR[1][d] );
+#           endif
+
+            idxLR[0][d] = 0;
+            idxLR[1][d] = 1;
+         }
+
+         else if ( idxLR[1][d] >= AccSize )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeR[d], NULL, false )  )
+            Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idxL %d, idxR %d) !!\n",
+                       d, Pos[d], EdgeR[d], idxLR[0][d], idxLR[1][d] );
+#           endif
+
+            idxLR[0][d] = AccSize - 2;
+            idxLR[1][d] = AccSize - 1;
+         }
+
+//       get the weighting of the nearby 8 cells
+         dr     [d] -= (double)idxLR[0][d];
+
+//       positions outside the array adopt the boundary cells
+         if ( AllowOutside )  dr[d] = MIN( MAX( dr[d], 0.0 ), 1.0 );
+
+         Frac[0][d]  = 1.0 - dr[d];
+         Frac[1][d]  =       dr[d];
+      } // for (int d=0; d<3; d++)
+
+//    calculate acceleration
+      for (int d=0; d<3; d++)
+      {
+         Acc_Out[d] = (real)0.0;
+
+         for (int k=0; k<2; k++)
+         for (int j=0; j<2; j++)
+         for (int i=0; i<2; i++)
+         Acc_Out[d] += Acc3D[d][ idxLR[k][2] ][ idxLR[j][1] ][ idxLR[i][0] ]
+                      *Frac[i][0]*Frac[j][1]*Frac[k][2];
+      }
+   } // PAR_INTERP_CIC
+   break;
+
+
+// 3 TSC
+   case ( PAR_INTERP_TSC ):
+   {
+      int    idxLCR[3][3];    // array index of the left/central/right cells (idxLCR[0/1/2][d])
+      double dr       [3];    // distance to the left edge of the central cell
+      double Frac  [3][3];    // weighting of the left/central/right cells (Frac[0/1/2][d])
+
+      for (int d=0; d<3; d++)
+      {
+//       calculate the array index of the left, central, and right cells
+         dr       [d] = ( Pos[d] - EdgeL[d] )*_dh + ParGhost;
+         idxLCR[1][d] = int( dr[d] );
+         idxLCR[0][d] = idxLCR[1][d] - 1;
+         idxLCR[2][d] = idxLCR[1][d] + 1;
+
+//       prevent from round-off errors (especially for NGP and TSC)
+         if ( idxLCR[0][d] < 0 )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeL[d], NULL, false )  )
+            Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeL %14.7e, idxL %d, idxR %d) !!\n",
+                       d, Pos[d], EdgeL[d], idxLCR[0][d], idxLCR[2][d] );
+#           endif
+
+            idxLCR[0][d] = 0;
+            idxLCR[1][d] = 1;
+            idxLCR[2][d] = 2;
+         }
+
+         else if ( idxLCR[2][d] >= AccSize )
+         {
+#           ifdef DEBUG_PARTICLE
+            if (  !AllowOutside  &&  ! Mis_CompareRealValue( Pos[d], (real)EdgeR[d], NULL, false )  )
+            Aux_Error( ERROR_INFO, "index outside the acc array (pos[%d] %14.7e, EdgeR %14.7e, idxL %d, idxR %d) !!\n",
+                       d, Pos[d], EdgeR[d], idxLCR[0][d], idxLCR[2][d] );
+#           endif
+
+            idxLCR[0][d] = AccSize - 3;
+            idxLCR[1][d] = AccSize - 2;
+            idxLCR[2][d] = AccSize - 1;
+         }
+
+//       get the weighting of the nearby 27 cells
+         dr     [d] -= (double)idxLCR[1][d];
+
+//       positions outside the array adopt the boundary cells
+         if ( AllowOutside )  dr[d] = MIN( MAX( dr[d], 0.0 ), 1.0 );
+
+         Frac[0][d]  = 0.5*SQR( 1.0 - dr[d] );
+         Frac[1][d]  = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
+         Frac[2][d]  = 0.5*SQR( dr[d] );
+      } // for (int d=0; d<3; d++)
+
+//    calculate acceleration
+      for (int d=0; d<3; d++)
+      {
+         Acc_Out[d] = (real)0.0;
+
+         for (int k=0; k<3; k++)
+         for (int j=0; j<3; j++)
+         for (int i=0; i<3; i++)
+         Acc_Out[d] += Acc3D[d][ idxLCR[k][2] ][ idxLCR[j][1] ][ idxLCR[i][0] ]
+                      *Frac[i][0]*Frac[j][1]*Frac[k][2];
+      }
+   } // PAR_INTERP_TSC
+   break;
+
+
+   default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
+   } // switch ( IntScheme )
+
+} // FUNCTION : InterpolateAcc
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetNSubCycle
+// Description :  Return the number of sub-cycles of a particle for PAR_MAX_SUBCYCLE
+//
+// Note        :  1. Smallest power of two N such that dt/N satisfies the particle acceleration criterion
+//                   DT__PARACC*(dh/a_max)^0.5 adopted by Par_GetTimeStep_VelAcc()
+//                2. N <= 2^PAR_MAX_SUBCYCLE
+//
+// Parameter   :  dt  : Level time-step
+//                Acc : Particle acceleration
+//                dh  : Cell size
+//
+// Return      :  Number of sub-cycles
+//-------------------------------------------------------------------------------------------------------
+int GetNSubCycle( const real dt, const real Acc[], const double dh )
+{
+
+   const int  NSubMax = 1 << amr->Par->MaxSubCycle;
+   const real AccMax  = MAX(  MAX( FABS(Acc[0]), FABS(Acc[1]) ), FABS(Acc[2])  );
+
+   if ( AccMax == (real)0.0 )    return 1;
+
+   const double dt_acc = DT__PARACC*sqrt( dh/AccMax );
+   int NSub = 1;
+
+   while ( NSub < NSubMax  &&  dt > NSub*dt_acc )  NSub *= 2;
+
+   return NSub;
+
+} // FUNCTION : GetNSubCycle
+
+
+
 #endif // #ifdef PARTICLE
@@ -0,0 +1,139 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flag_RecordFlagMask
+// Description :  Evaluate the refinement criteria of a patch just updated by the fluid solver and record the
+//                results in patch_t::FlagMask for OPT__FLAG_FLU_BYPRODUCT
+//
+// Note        :  1. Invoked by Flu_Close() right after copying the output of the fluid solver to the patch
+//                   pointers so that the fluid data are still in cache
+//                   --> Flag_Real() adopts FlagMask directly instead of sweeping over the fluid data again
+//                       if the patch has not been modified since then (see Flag_Real())
+//                2. Bit "s" (0<=s<26) of FlagMask indicates that the sibling patch "s" must be flagged due to the
+//                   flag buffer, and bit 26 indicates that the patch itself must be flagged
+//                   --> Exactly the same patches flagged by the cell loop in Flag_Real()
+//                3. Only support the refinement criteria depending solely on the fluid data of the target patch
+//                   --> Checked by Aux_Check_Parameter()
+//                4. Do not check the proper-nesting condition here, which is left to Flag_Real()
+//
+// Parameter   :  lv  : Target refinement level
+//                PID : Target patch index
+//                Sg  : Sandglass storing the updated fluid data
+//-------------------------------------------------------------------------------------------------------
+void Flag_RecordFlagMask( const int lv, const int PID, const int Sg )
+{
+
+   const int SibID_Array[3][3][3] = {  { {18, 10, 19}, {14,   4, 16}, {20, 11, 21} },
+                                       { { 6,  2,  7}, { 0,  26,  1}, { 8,  3,  9} },
+                                       { {22, 12, 23}, {15,   5, 17}, {24, 13, 25} }  };    // sibling indices
+   const int  FlagBuf             = ( lv == MAX_LEVEL-1 ) ? FLAG_BUFFER_SIZE_MAXM1_LV :
+                                    ( lv == MAX_LEVEL-2 ) ? FLAG_BUFFER_SIZE_MAXM2_LV :
+                                                            FLAG_BUFFER_SIZE;
+   const int  FlagMask_All        = ( 1 << 27 ) - 1;
+   const real dv                  = CUBE( amr->dh[lv] );
+   const real JeansCoeff          = NULL_REAL;   // OPT__FLAG_JEANS requires GRAVITY
+
+   const real (*Fluid)[PS1][PS1][PS1] = amr->patch[Sg][lv][PID]->fluid;
+   real Vel[3][PS1][PS1][PS1], Pres[PS1][PS1][PS1];
+   int  FlagMask = 0;
+
+
+// skip all cell-based refinement criteria for patches outside the regions allowed to be refined
+   if (  lv >= MAX_LEVEL  ||  ( OPT__FLAG_REGION && !Flag_Region_Patch(lv, PID) )  )
+   {
+      amr->patch[0][lv][PID]->FlagMask = FlagMask;
+      return;
+   }
+
+
+// evaluate velocity
+   if ( OPT__FLAG_VORTICITY )
+   {
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+      {
+         const real _Dens = (real)1.0 / Fluid[DENS][k][j][i];
+
+         Vel[0][k][j][i] = Fluid[MOMX][k][j][i]*_Dens;
+         Vel[1][k][j][i] = Fluid[MOMY][k][j][i]*_Dens;
+         Vel[2][k][j][i] = Fluid[MOMZ][k][j][i]*_Dens;
+      }
+   }
+
+
+// evaluate pressure
+// --> must be consistent with Flag_Real()
+   if ( OPT__FLAG_PRES_GRADIENT )
+   {
+      const bool CheckMinPres_Yes = true;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+      {
+#        ifdef DUAL_ENERGY
+
+#        if   ( DUAL_ENERGY == DE_ENPY )
+         Pres[k][j][i] = Hydro_DensEntropy2Pres( Fluid[DENS][k][j][i], Fluid[ENPY][k][j][i],
+                                                 EoS_AuxArray[1], CheckMinPres_Yes, MIN_PRES );
+#        elif ( DUAL_ENERGY == DE_EINT )
+#        error : DE_EINT is NOT supported yet !!
+#        endif
+
+#        else // #ifdef DUAL_ENERGY
+
+         const real Emag = NULL_REAL;
+#        if ( EOS != EOS_GAMMA  &&  EOS != EOS_ISOTHERMAL  &&  NCOMP_PASSIVE > 0 )
+         real Passive[NCOMP_PASSIVE];
+         for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = Fluid[ NCOMP_FLUID + v ][k][j][i];
+#        else
+         const real *Passive = NULL;
+#        endif
+
+         Pres[k][j][i] = Hydro_Con2Pres( Fluid[DENS][k][j][i], Fluid[MOMX][k][j][i], Fluid[MOMY][k][j][i],
+                                         Fluid[MOMZ][k][j][i], Fluid[ENGY][k][j][i], Passive,
+                                         CheckMinPres_Yes, MIN_PRES, Emag,
+                                         EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
+#        endif // #ifdef DUAL_ENERGY ... else ...
+      } // k,j,i
+   } // if ( OPT__FLAG_PRES_GRADIENT )
+
+
+// loop over all cells within the target patch
+   for (int k=0; k<PS1; k++)  {  const int k_start = ( k - FlagBuf < 0    ) ? 0 : 1;
+                                 const int k_end   = ( k + FlagBuf >= PS1 ) ? 2 : 1;
+   for (int j=0; j<PS1; j++)  {  const int j_start = ( j - FlagBuf < 0    ) ? 0 : 1;
+                                 const int j_end   = ( j + FlagBuf >= PS1 ) ? 2 : 1;
+   for (int i=0; i<PS1; i++)  {  const int i_start = ( i - FlagBuf < 0    ) ? 0 : 1;
+                                 const int i_end   = ( i + FlagBuf >= PS1 ) ? 2 : 1;
+
+      if (  Flag_Check( lv, PID, i, j, k, dv, Fluid, NULL, NULL, Vel, Pres, NULL, NULL, NULL, 0, NULL, NULL, JeansCoeff )  )
+      {
+//       record itself and the sibling patches according to the size of FlagBuf
+         for (int kk=k_start; kk<=k_end; kk++)
+         for (int jj=j_start; jj<=j_end; jj++)
+         for (int ii=i_start; ii<=i_end; ii++)
+            FlagMask |= ( 1 << SibID_Array[kk][jj][ii] );
+
+//       no need to check the remaining cells once all patches are flagged
+         if ( FlagMask == FlagMask_All )
+         {
+            amr->patch[0][lv][PID]->FlagMask = FlagMask;
+            return;
+         }
+      }
+   }}} // k, j, i
+
+   amr->patch[0][lv][PID]->FlagMask = FlagMask;
+
+} // FUNCTION : Flag_RecordFlagMask
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -2,6 +2,9 @@
 
 void Flag_Grandson( const int lv, const int PID, const int LocalID );
 void Prepare_for_Lohner( const OptLohnerForm_t Form, const real *Var1D, real *Ave1D, real *Slope1D, const int NVar );
+static inline void SetFlagMap( unsigned int *FlagMap, const int PID );
+
+static const int FlagMap_NBit = 8*sizeof(unsigned int);  // number of patches recorded by one word of the flag bitmap
 
 
 
@@ -15,6 +18,15 @@ void Prepare_for_Lohner( const OptLohnerForm_t Form, const real *Var1D, real *Av
 //                   (FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, FLAG_BUFFER_SIZE_MAXM2_LV) and the grandson check
 //                3. To add new refinement criteria, please edit Flag_Check()
 //                4. Prepare_for_Lohner() is defined in Flag_Lohner.cpp
+//                5. Each OpenMP thread records its flags in its own bitmap (FlagMap), which are merged into
+//                   patch_t::flag afterwards when applying the proper-nesting constraint
+//                   --> no data race when different threads flag the same sibling patch
+//                6. For OPT__FLAG_FLU_BYPRODUCT, adopt the refinement flags evaluated by Flu_Close() (i.e.,
+//                   patch_t::FlagMask) instead of going through all cells again for the patches not modified
+//                   since the fluid update
+//                   --> Patches with sons or with any sibling having sons may have been modified by the restriction
+//                       and flux fix-up operations
+//                   --> FlagMask is consumed here so that it will never be adopted twice
 //
 // Parameter   :  lv        : Target refinement level to be flagged
 //                UseLBFunc : Use the load-balance alternative functions for the grandson check and exchanging
@@ -31,11 +43,6 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       Aux_Error( ERROR_INFO, "function <%s> should NOT be applied to the finest level\" !!\n", __FUNCTION__ );
 
 
-// initialize all flags as false
-#  pragma omp parallel for schedule( static )
-   for (int PID=0; PID<amr->num[lv]; PID++)  amr->patch[0][lv][PID]->flag = false;
-
-
    const int SibID_Array[3][3][3]     = {  { {18, 10, 19}, {14,   4, 16}, {20, 11, 21} },
                                            { { 6,  2,  7}, { 0, 999,  1}, { 8,  3,  9} },
                                            { {22, 12, 23}, {15,   5, 17}, {24, 13, 25} }  };    // sibling indices
@@ -103,6 +110,18 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
    Lohner_Stride = Lohner_NVar*Lohner_NCell*Lohner_NCell*Lohner_NCell;  // stride of array for one patch
 
 
+// allocate the per-thread flag bitmaps (one bit per patch including the buffer patches)
+// --> all flags are initialized as false by each thread in the OpenMP parallel region below
+#  ifdef OPENMP
+   const int NThread = OMP_NTHREAD;
+#  else
+   const int NThread = 1;
+#  endif
+   const int FlagMap_NWord = ( amr->num[lv] + FlagMap_NBit - 1 ) / FlagMap_NBit;
+
+   unsigned int *FlagMap = new unsigned int [ (long)NThread*FlagMap_NWord ];
+
+
 // collect particles to **real** patches at lv
 #  ifdef PARTICLE
    if ( OPT__FLAG_NPAR_CELL  ||  OPT__FLAG_PAR_MASS_CELL )
@@ -117,9 +136,17 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #  endif
 
 
-//###ISSUE: use atomic ??
 #  pragma omp parallel
    {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+      unsigned int *FlagMap_TID = FlagMap + (long)TID*FlagMap_NWord;
+
+      memset( FlagMap_TID, 0, FlagMap_NWord*sizeof(unsigned int) );
+
       const real (*Fluid)[PS1][PS1][PS1] = NULL;
       real (*Pot )[PS1][PS1]             = NULL;
       real (*MagCC)[PS1][PS1][PS1]       = NULL;
@@ -166,8 +193,19 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #     pragma omp for schedule( runtime )
       for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
       {
+//       find the patches lying entirely outside the regions allowed to be refined for OPT__FLAG_REGION
+//       --> no need to prepare any data for the cell-based refinement criteria of these patches
+         bool RegionOut[8], RegionOut_All = OPT__FLAG_REGION;
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            RegionOut[LocalID] = ( OPT__FLAG_REGION  &&  !Flag_Region_Patch(lv, PID0+LocalID) );
+            RegionOut_All     &= RegionOut[LocalID];
+         }
+
+
 //       prepare the ghost-zone data for Lohner
-         if ( Lohner_NVar > 0 )
+         if ( Lohner_NVar > 0  &&  !RegionOut_All )
             Prepare_PatchData( lv, Time[lv], Lohner_Var, NULL, Lohner_NGhost, NPG, &PID0, Lohner_TVar, _NONE,
                                Lohner_IntScheme, INT_NONE, UNIT_PATCH, NSIDE_26, IntPhase_No, OPT__BC_FLU, OPT__BC_POT,
                                MinDens, MinPres, DE_Consistency_No );
@@ -178,6 +216,9 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
          {
             PID = PID0 + LocalID;
 
+            const int FlagMask = amr->patch[0][lv][PID]->FlagMask;
+            amr->patch[0][lv][PID]->FlagMask = -1;
+
 //          check the proper-nesting condition
             ProperNesting = true;
 
@@ -213,17 +254,46 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 //          do flag check only if 26 siblings all exist (proper-nesting constraint)
             if ( ProperNesting )
             {
-               NextPatch = false;
+//             skip all cell-based refinement criteria for patches outside the regions allowed to be refined
+               NextPatch = RegionOut[LocalID];
                Fluid     = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
 #              ifdef GRAVITY
                Pot       = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot;
 #              endif
 
 
+//             adopt the refinement flags evaluated by Flu_Close() for OPT__FLAG_FLU_BYPRODUCT
+               if ( OPT__FLAG_FLU_BYPRODUCT  &&  FlagMask >= 0  &&  !NextPatch )
+               {
+                  bool Modified = ( amr->patch[0][lv][PID]->son != -1 );
+
+                  for (int sib=0; sib<26  &&  !Modified; sib++)
+                  {
+                     SibPID = amr->patch[0][lv][PID]->sibling[sib];
+
+                     if ( SibPID >= 0  &&  amr->patch[0][lv][SibPID]->son != -1 )   Modified = true;
+                  }
+
+                  if ( !Modified )
+                  {
+                     if ( FlagMask & (1<<26) )  SetFlagMap( FlagMap_TID, PID );
+
+                     for (int sib=0; sib<26; sib++)
+                     {
+                        SibPID = amr->patch[0][lv][PID]->sibling[sib];
+
+                        if (  ( FlagMask & (1<<sib) )  &&  SibPID >= 0  )  SetFlagMap( FlagMap_TID, SibPID );
+                     }
+
+                     NextPatch = true;
+                  }
+               } // if ( OPT__FLAG_FLU_BYPRODUCT  &&  FlagMask >= 0  &&  !NextPatch )
+
+
 #              if ( MODEL == HYDRO )
 #              ifdef MHD
 //             evaluate cell-centered B field
-               if ( OPT__FLAG_CURRENT || NeedPres )
+               if (  ( OPT__FLAG_CURRENT || NeedPres )  &&  !NextPatch  )
                {
                   real MagCC_1Cell[NCOMP_MAG];
 
@@ -235,12 +305,12 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 
                      for (int v=0; v<NCOMP_MAG; v++)  MagCC[v][k][j][i] = MagCC_1Cell[v];
                   }
-               } // if ( OPT__FLAG_CURRENT || NeedPres )
+               } // if (  ( OPT__FLAG_CURRENT || NeedPres )  &&  !NextPatch  )
 #              endif // #ifdef MHD
 
 
 //             evaluate velocity
-               if ( OPT__FLAG_VORTICITY )
+               if ( OPT__FLAG_VORTICITY  &&  !NextPatch )
                {
                   for (int k=0; k<PS1; k++)
                   for (int j=0; j<PS1; j++)
@@ -252,11 +322,11 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                      Vel[1][k][j][i] = Fluid[MOMY][k][j][i]*_Dens;
                      Vel[2][k][j][i] = Fluid[MOMZ][k][j][i]*_Dens;
                   }
-               } // if ( OPT__FLAG_VORTICITY )
+               } // if ( OPT__FLAG_VORTICITY  &&  !NextPatch )
 
 
 //             evaluate pressure
-               if ( NeedPres )
+               if ( NeedPres  &&  !NextPatch )
                {
                   const bool CheckMinPres_Yes = true;
 
@@ -296,19 +366,19 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                                                      EoS_DensEint2Pres_CPUPtr, EoS_AuxArray, NULL );
 #                    endif // #ifdef DUAL_ENERGY ... else ...
                   } // k,j,i
-               } // if ( NeedPres )
+               } // if ( NeedPres  &&  !NextPatch )
 #              endif // #if ( MODEL == HYDRO )
 
 
 //             evaluate the averages and slopes along x/y/z for Lohner
-               if ( Lohner_NVar > 0 )
+               if ( Lohner_NVar > 0  &&  !NextPatch )
                   Prepare_for_Lohner( OPT__FLAG_LOHNER_FORM, Lohner_Var+LocalID*Lohner_Stride, Lohner_Ave, Lohner_Slope,
                                       Lohner_NVar );
 
 
 //             count the number of particles and/or particle mass density on each cell
 #              ifdef PARTICLE
-               if ( OPT__FLAG_NPAR_CELL  ||  OPT__FLAG_PAR_MASS_CELL )
+               if (  ( OPT__FLAG_NPAR_CELL || OPT__FLAG_PAR_MASS_CELL )  &&  !NextPatch  )
                {
                   long  *ParList = NULL;
                   int    NParThisPatch;
@@ -387,7 +457,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                                       amr->patch[0][lv][PID]->EdgeL, amr->dh[lv], PredictPos_No, NULL_REAL,
                                       InitZero_Yes, Periodic_No, NULL, UnitDens_No,  CheckFarAway_No,
                                       UseInputMassPos, InputMassPos );
-               } // if ( OPT__FLAG_NPAR_CELL  ||  OPT__FLAG_PAR_MASS_CELL )
+               } // if (  ( OPT__FLAG_NPAR_CELL || OPT__FLAG_PAR_MASS_CELL )  &&  !NextPatch  )
 #              endif // #ifdef PARTICLE
 
 
@@ -410,7 +480,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                                                         ParCount, ParDens, JeansCoeff )  )
                   {
 //                   flag itself
-                     amr->patch[0][lv][PID]->flag = true;
+                     SetFlagMap( FlagMap_TID, PID );
 
 //                   flag sibling patches according to the size of FlagBuf
                      for (int kk=k_start; kk<=k_end; kk++)
@@ -433,7 +503,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #                          endif
 
 //                         note that we can have SibPID <= SIB_OFFSET_NONPERIODIC when OPT__NO_FLAG_NEAR_BOUNDARY == false
-                           if ( SibPID >= 0 )   amr->patch[0][lv][SibPID]->flag = true;
+                           if ( SibPID >= 0 )   SetFlagMap( FlagMap_TID, SibPID );
                         }
                      }
 
@@ -463,7 +533,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
                   if ( NParThisPatch > NParFlag )
                   {
 //                   flag itself
-                     amr->patch[0][lv][PID]->flag = true;
+                     SetFlagMap( FlagMap_TID, PID );
 
 //                   flag all siblings for OPT__FLAG_NPAR_PATCH == 2
                      if ( OPT__FLAG_NPAR_PATCH == 2 )
@@ -482,7 +552,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #                          endif
 
 //                         note that we can have SibPID <= SIB_OFFSET_NONPERIODIC when OPT__NO_FLAG_NEAR_BOUNDARY == false
-                           if ( SibPID >= 0 )   amr->patch[0][lv][SibPID]->flag = true;
+                           if ( SibPID >= 0 )   SetFlagMap( FlagMap_TID, SibPID );
                         }
                      }
                   } // if ( NParThisPatch > NParFlag )
@@ -513,11 +583,25 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #  endif
 
 
-// apply the proper-nesting constraint again (should also apply to the buffer patches)
+// merge the per-thread flag bitmaps into patch_t::flag and apply the proper-nesting constraint again
+// (should also apply to the buffer patches)
 // --> necessary because of the flag buffers
 #  pragma omp parallel for schedule( runtime )
    for (int PID=0; PID<amr->num[lv]; PID++)
    {
+      const int          Word = PID / FlagMap_NBit;
+      const unsigned int Mask = 1U << ( PID % FlagMap_NBit );
+      bool Flag = false;
+
+      for (int t=0; t<NThread; t++)
+         if ( FlagMap[ (long)t*FlagMap_NWord + Word ] & Mask )
+         {
+            Flag = true;
+            break;
+         }
+
+      amr->patch[0][lv][PID]->flag = Flag;
+
       for (int sib=0; sib<26; sib++)
       {
 //       do not check if sibling[]<-1 to allow for refinement around boundaries first
@@ -546,6 +630,8 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       }
    } // for (int PID=0; PID<amr->num[lv]; PID++)
 
+   delete [] FlagMap;
+
 
 // invoke the load-balance functions
 #  ifdef LOAD_BALANCE
@@ -794,3 +880,21 @@ void Flag_Grandson( const int lv, const int PID, const int LocalID )
    } // switch ( LocalID )
 
 } // FUNCTION : Flag_Grandson
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetFlagMap
+// Description :  Flag patch "PID" in the flag bitmap of a single OpenMP thread
+//
+// Note        :  1. Invoked by Flag_Real()
+//
+// Parameter   :  FlagMap : Flag bitmap of the target thread
+//                PID     : Target patch ID
+//-------------------------------------------------------------------------------------------------------
+inline void SetFlagMap( unsigned int *FlagMap, const int PID )
+{
+
+   FlagMap[ PID / FlagMap_NBit ] |= 1U << ( PID % FlagMap_NBit );
+
+} // FUNCTION : SetFlagMap
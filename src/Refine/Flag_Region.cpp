@@ -7,8 +7,10 @@
 // Function    :  Flag_Region
 // Description :  Check if the element (i,j,k) of the input patch is within the regions allowed to be refined
 //
-// Note        :  To use this functionality, please turn on the option "OPT__FLAG_REGION" and then specify the
-//                target regions in this file
+// Note        :  1. To use this functionality, please turn on the option "OPT__FLAG_REGION" and then specify the
+//                   target regions in this file
+//                2. Also specify the same regions in Flag_Region_Patch() to let Flag_Real() skip the patches lying
+//                   entirely outside these regions
 //
 // Parameter   :  i,j,k       : Indices of the target element in the patch ptr[0][lv][PID]
 //                lv          : Refinement level of the target patch
@@ -45,3 +47,53 @@ bool Flag_Region( const int i, const int j, const int k, const int lv, const int
 
 } // FUNCTION : Flag_Region
 
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flag_Region_Patch
+// Description :  Check if any element of the input patch can be within the regions allowed to be refined
+//
+// Note        :  1. Invoked by Flag_Real() for OPT__FLAG_REGION before preparing any data for the cell-based
+//                   refinement criteria
+//                   --> Patches returning false will skip all cell-based refinement criteria
+//                   --> OPT__FLAG_NPAR_PATCH is not restricted by OPT__FLAG_REGION and will still be checked
+//                2. Must be conservative: return false only if Flag_Region() returns false for ALL cells in this
+//                   patch
+//                   --> The default is to always return true, which only disables this optimization
+//
+// Parameter   :  lv  : Refinement level of the target patch
+//                PID : ID of the target patch
+//
+// Return      :  "true/false"  if the input patch "may/does not" overlap with the regions allowed for refinement
+//-------------------------------------------------------------------------------------------------------
+bool Flag_Region_Patch( const int lv, const int PID )
+{
+
+   const double *EdgeL = amr->patch[0][lv][PID]->EdgeL;  // left and right edges of the target patch
+   const double *EdgeR = amr->patch[0][lv][PID]->EdgeR;
+
+   bool Overlap = true;
+
+
+// put the target region below
+// ##########################################################################################################
+/*
+// Example : sphere --> check the distance between the sphere center and the closest point of the patch
+   const double Center[3] = { 0.5*amr->BoxSize[0], 0.5*amr->BoxSize[1], 0.5*amr->BoxSize[2] };
+   const double MaxR      = 1.0;
+   double dR2 = 0.0;
+
+   for (int d=0; d<3; d++)
+   {
+      if      ( Center[d] < EdgeL[d] )  dR2 += SQR( EdgeL[d] - Center[d] );
+      else if ( Center[d] > EdgeR[d] )  dR2 += SQR( Center[d] - EdgeR[d] );
+   }
+
+   Overlap = dR2 <= SQR( MaxR );
+*/
+// ##########################################################################################################
+
+
+   return Overlap;
+
+} // FUNCTION : Flag_Region_Patch
@@ -24,6 +24,28 @@ void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 {
 
+// the maximum CFL speed recorded by Flu_Close() for OPT__DT_FLU_BYPRODUCT no longer applies to the patches
+// whose sons may be removed here since their data have been updated by the restriction operation
+// --> new patches at lv+1 have dt_MaxCFL < 0 already (see patch_t::Activate())
+   if ( OPT__DT_FLU_BYPRODUCT )
+   {
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         if ( amr->patch[0][lv][PID]->son != -1 )  amr->patch[0][lv][PID]->dt_MaxCFL = (real)-1.0;
+   }
+
+// the ghost zones cached by Prepare_PatchData() no longer apply to the new patches
+   if ( lv+1 < NLEVEL )
+   {
+      Prepare_PatchData_FreeGhostCache( lv+1 );
+      Prepare_PatchData_InvalidateGhostCache( lv+1 );
+   }
+
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after refinement
+#  ifdef PARTICLE
+   Par_CollectParticle2OneLevel_InvalidateCache();
+#  endif
+
+
 // invoke the load-balance refine function
 #  ifdef LOAD_BALANCE
    if ( UseLBFunc == USELB_YES )
@@ -77,18 +99,12 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int CStart_Flu[3] = { CGhost_Flu, CGhost_Flu, CGhost_Flu };
    const int CSize_Flu3[3] = { CSize_Flu, CSize_Flu, CSize_Flu };
 
-   real Flu_CData[NCOMP_TOTAL][CSize_Flu][CSize_Flu][CSize_Flu];  // coarse-grid fluid array for interpolation
-   real Flu_FData[NCOMP_TOTAL][FSize_CC ][FSize_CC ][FSize_CC ];  // fine-grid fluid array storing the interpolation result
-
 #  ifdef GRAVITY
    int NSide_Pot, CGhost_Pot;
    Int_Table( OPT__REF_POT_INT_SCHEME, NSide_Pot, CGhost_Pot );
 
    const int CSize_Pot     = PS1 + 2*CGhost_Pot;
    const int CStart_Pot[3] = { CGhost_Pot, CGhost_Pot, CGhost_Pot };
-
-   real Pot_CData[CSize_Pot][CSize_Pot][CSize_Pot];   // coarse-grid potential array for interpolation
-   real Pot_FData[FSize_CC ][FSize_CC ][FSize_CC ];   // fine-grid potential array storing the interpolation result
 #  endif
 
 #  ifdef MHD
@@ -110,13 +126,6 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                                    { CSize_Mag_T, CSize_Mag_N, CSize_Mag_T },
                                    { CSize_Mag_T, CSize_Mag_T, CSize_Mag_N }  };
 
-   real Mag_CData[NCOMP_MAG][ CSize_Mag_N*SQR(CSize_Mag_T) ];  // coarse-grid B field array for interpolation
-   real Mag_FData[NCOMP_MAG][ PS2P1*SQR(PS2) ];                // fine-grid B field array storing the interpolation result
-
-   real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
-
    bool *JustRefined = new bool [ amr->num[lv] ];
    for (int PID=0; PID<amr->num[lv]; PID++)  JustRefined[PID] = false;
 #  endif // #ifdef MHD
@@ -199,11 +208,16 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 // c. check the refinement flags for all real patches at level "lv"
 // ------------------------------------------------------------------------------------------------
 
-// (c1) construct new child patches (allocate one patch group at a time)
+// (c1) construct new child patches
 //      --> note that we must do this BEFORE deallocating any child patch to retain high-resolution
 //          B field on the boundaries of newly allocated patches
+//      --> allocate all new patch groups first so that the spatial interpolation, which dominates the cost
+//          (especially the divergence-free B field interpolation in MHD), can be applied to all new patch
+//          groups of this level at once with OpenMP
 // ================================================================================================
-//#  pragma omp parallel for private( ??? )
+   int  NNewFa    = 0;
+   int *NewFaList = new int [ amr->NPatchComma[lv][1] ];
+
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
       patch_t *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
@@ -231,8 +245,42 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          JustRefined[PID] = true;
 #        endif
 
+         NewFaList[ NNewFa ++ ] = PID;
+      } // if ( Pedigree->flag  &&  Pedigree->son == -1 )
+   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+
+// (c1.3) assign data to all new patch groups by spatial interpolation
+//        --> different patch groups only read data at lv and the existing (i.e., not just refined) patches at lv+1
+//            and write to their own child patches, and thus can be processed in parallel
+//        --> JustRefined[] has been set for all new patch groups above, so the coarse-fine interfaces identified
+//            in (c1.3.3) are the same as those obtained by refining one patch group at a time
+#  pragma omp parallel
+   {
+      real Flu_CData[NCOMP_TOTAL][CSize_Flu][CSize_Flu][CSize_Flu];  // coarse-grid fluid array for interpolation
+      real Flu_FData[NCOMP_TOTAL][FSize_CC ][FSize_CC ][FSize_CC ];  // fine-grid fluid array storing the interpolation result
+
+#     ifdef GRAVITY
+      real Pot_CData[CSize_Pot][CSize_Pot][CSize_Pot];   // coarse-grid potential array for interpolation
+      real Pot_FData[FSize_CC ][FSize_CC ][FSize_CC ];   // fine-grid potential array storing the interpolation result
+#     endif
+
+#     ifdef MHD
+      real Mag_CData[NCOMP_MAG][ CSize_Mag_N*SQR(CSize_Mag_T) ];  // coarse-grid B field array for interpolation
+      real Mag_FData[NCOMP_MAG][ PS2P1*SQR(PS2) ];                // fine-grid B field array storing the interpolation result
+
+      real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
+#     endif
+
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NNewFa; t++)
+      {
+         const int PID     = NewFaList[t];
+         patch_t *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
+
 
-//       (c1.3) assign data to child patches by spatial interpolation
 //       (c1.3.1) fill up the central region of CData
          int i_out, j_out, k_out;
 
@@ -723,9 +771,9 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 #        else // #if ( MODEL == ELBDM )
 
-         for (int v=0; v<NCOMP_TOTAL; v++)
-         Interpolate( &Flu_CData[v][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[v][0][0][0],
-                      FSize_CC3, FStart_CC, 1, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, Monotonicity,
+//       interpolate all components of the whole patch group at once to share the temporary arrays in Interpolate()
+         Interpolate( &Flu_CData[0][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[0][0][0][0],
+                      FSize_CC3, FStart_CC, NCOMP_TOTAL, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, Monotonicity,
                       INT_OPP_SIGN_0TH_ORDER );
 
 #        endif // #if ( MODEL == ELBDM ) ... else
@@ -835,7 +883,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 //       (c1.3.5) copy data from XXX_FData[] to patch pointers
          for (int LocalID=0; LocalID<8; LocalID++)
          {
-            const int SonPID = amr->num[lv+1] - 8 + LocalID;
+            const int SonPID = Pedigree->son + LocalID;
 
             offset_in[0] = TABLE_02( LocalID, 'x', 0, PS1 );
             offset_in[1] = TABLE_02( LocalID, 'y', 0, PS1 );
@@ -906,14 +954,20 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
             }
 #           endif
          } // for (int LocalID=0; LocalID<8; LocalID++)
+      } // for (int t=0; t<NNewFa; t++)
 
+#     ifdef MHD
+      for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
+#     endif
+   } // OpenMP parallel region
 
-//       (c1.4) pass particles from father to son
-#        ifdef PARTICLE
-         Par_PassParticle2Son_SinglePatch( lv, PID );
-#        endif
-      } // if ( Pedigree->flag  &&  Pedigree->son == -1 )
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+// (c1.4) pass particles from father to son
+#  ifdef PARTICLE
+   for (int t=0; t<NNewFa; t++)  Par_PassParticle2Son_SinglePatch( lv, NewFaList[t] );
+#  endif
+
+   delete [] NewFaList;
 
 
 // (c2) remove unflagged child patches (deallocate one patch group at a time)
@@ -979,7 +1033,6 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 // free memory
 #  ifdef MHD
-   for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
    delete [] JustRefined;
 #  endif
 
@@ -1043,6 +1096,57 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Refine_CheckFlagChange
+// Description :  Check whether Refine() will allocate or deallocate any patch at level "lv+1"
+//
+// Note        :  1. Used by OPT__REGRID_LAZY to skip Refine() when the refinement state of all patches at
+//                   level "lv" remains the same
+//                   --> a patch changes its state if it is flagged without son or unflagged with son
+//                   --> Refine() would then only rebuild the buffer patches, sibling relations, flux arrays, and
+//                       MPI lists at "lv+1", which would all remain the same
+//                2. Must be invoked after flagging (i.e., after Flag_Buffer() or LB_ExchangeFlaggedBuffer())
+//                3. Return the same result on all MPI ranks
+//                4. Only check real patches when using the load-balance functions since LB_Refine() only
+//                   refers to the flags of real patches
+//
+// Parameter   :  lv        : Target refinement level to be refined
+//                UseLBFunc : Whether Refine() will invoke the load-balance alternative functions
+//
+// Return      :  true  --> at least one patch on at least one rank changes its refinement state
+//                false --> otherwise
+//-------------------------------------------------------------------------------------------------------
+bool Refine_CheckFlagChange( const int lv, const UseLBFunc_t UseLBFunc )
+{
+
+// always refine the finest level to let Refine() deal with it
+   if ( lv == NLEVEL-1 )   return true;
+
+
+#  ifdef LOAD_BALANCE
+   const int NPatch = ( UseLBFunc == USELB_YES ) ? amr->NPatchComma[lv][1] : amr->NPatchComma[lv][27];
+#  else
+   const int NPatch = amr->NPatchComma[lv][27];
+#  endif
+
+   int Change_Local = 0, Change_AllRank;
+
+#  pragma omp parallel for reduction( |:Change_Local ) schedule( static )
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      const patch_t *Pedigree = amr->patch[0][lv][PID];
+
+      if ( Pedigree->flag != ( Pedigree->son != -1 ) )   Change_Local = 1;
+   }
+
+   MPI_Allreduce( &Change_Local, &Change_AllRank, 1, MPI_INT, MPI_BOR, MPI_COMM_WORLD );
+
+   return ( Change_AllRank != 0 );
+
+} // FUNCTION : Refine_CheckFlagChange
+
+
+
 #if ( MODEL == ELBDM  &&  defined GAMER_DEBUG )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  ELBDM_GetPhase_DebugOnly
@@ -0,0 +1,453 @@
+#include "CUPOT.h"
+
+#ifdef GRAVITY
+
+
+
+// index of each column in UserArray[]
+#define EXT_TABLE_AUX_EDGEL    0     // [0-2]: left edge of a 3D table or center of a radial table
+#define EXT_TABLE_AUX_DH       3     // grid spacing (dh for a 3D table and dr for a radial table)
+#define EXT_TABLE_AUX_NPOINT   4     // [4-6]: number of points along x/y/z (NPOINT_Y/Z = 1 for a radial table)
+#define EXT_TABLE_AUX_RADIAL   7     // 1.0/0.0 --> radial/3D table
+#define EXT_TABLE_AUX_R0       8     // radius of the first point of a radial table
+
+
+static int ExtTable_Stencil( int Idx[], real Weight[], const double x, const double y, const double z,
+                             const double UserArray[] );
+static real ExtTable_Fetch( const int Idx );
+
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  ExtPot_Tabular
+// Description :  Calculate the external potential at the given coordinates by interpolating the table
+//                loaded from EXT_POT_TABLE_NAME
+//
+// Note        :  1. Auxiliary array UserArray[] is set by Init_ExtPotAuxArray_Tabular()
+//                2. Trilinear (3D table) or linear (radial table) interpolation
+//                3. Positions outside the table are clamped to the table edge
+//                4. Time-independent
+//
+// Return      :  External potential at (x,y,z)
+//-----------------------------------------------------------------------------------------
+static real ExtPot_Tabular( const double x, const double y, const double z, const double Time, const double UserArray[] )
+{
+
+   int  Idx[8];
+   real Weight[8], Pot=(real)0.0;
+
+   const int NStencil = ExtTable_Stencil( Idx, Weight, x, y, z, UserArray );
+
+   for (int t=0; t<NStencil; t++)   Pot += Weight[t]*ExtTable_Fetch( Idx[t] );
+
+   return Pot;
+
+} // FUNCTION : ExtPot_Tabular
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  ExtAcc_Tabular
+// Description :  Calculate the external acceleration at the given coordinates by interpolating the table
+//                loaded from EXT_POT_TABLE_NAME
+//
+// Note        :  1. Auxiliary array UserArray[] is set by Init_ExtAccAuxArray_Tabular()
+//                2. Acceleration is evaluated at each table point from the potential by second-order finite
+//                   difference in advance and then interpolated the same way as ExtPot_Tabular()
+//                3. Time-independent
+//
+// Parameter   :  Acc       : Array to store the output external acceleration
+//                x/y/z     : Target spatial coordinates
+//                Time      : Current physical time
+//                UserArray : User-provided auxiliary array
+//
+// Return      :  External acceleration Acc[] at (x,y,z)
+//-----------------------------------------------------------------------------------------
+static void ExtAcc_Tabular( real Acc[], const double x, const double y, const double z, const double Time,
+                            const double UserArray[] )
+{
+
+   const int NPoint = (int)UserArray[EXT_TABLE_AUX_NPOINT+0]*(int)UserArray[EXT_TABLE_AUX_NPOINT+1]*
+                      (int)UserArray[EXT_TABLE_AUX_NPOINT+2];
+
+   int  Idx[8];
+   real Weight[8];
+
+   const int NStencil = ExtTable_Stencil( Idx, Weight, x, y, z, UserArray );
+
+// radial table: table stores the radial acceleration
+   if ( UserArray[EXT_TABLE_AUX_RADIAL] != 0.0 )
+   {
+      const real dx = (real)( x - UserArray[EXT_TABLE_AUX_EDGEL+0] );
+      const real dy = (real)( y - UserArray[EXT_TABLE_AUX_EDGEL+1] );
+      const real dz = (real)( z - UserArray[EXT_TABLE_AUX_EDGEL+2] );
+      const real r  = SQRT( dx*dx + dy*dy + dz*dz );
+
+      real Acc_r = (real)0.0;
+
+      for (int t=0; t<NStencil; t++)   Acc_r += Weight[t]*ExtTable_Fetch( NPoint + Idx[t] );
+
+      if ( r > (real)0.0 )
+      {
+         const real Acc_r_r = Acc_r / r;
+
+         Acc[0] = Acc_r_r*dx;
+         Acc[1] = Acc_r_r*dy;
+         Acc[2] = Acc_r_r*dz;
+      }
+
+      else
+         Acc[0] = Acc[1] = Acc[2] = (real)0.0;
+   }
+
+// 3D table: table stores all three components
+   else
+   {
+      for (int d=0; d<3; d++)
+      {
+         Acc[d] = (real)0.0;
+
+         for (int t=0; t<NStencil; t++)   Acc[d] += Weight[t]*ExtTable_Fetch( (d+1)*NPoint + Idx[t] );
+      }
+   }
+
+} // FUNCTION : ExtAcc_Tabular
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  ExtTable_Stencil
+// Description :  Return the table indices and weights for interpolating the table at the given coordinates
+//
+// Note        :  1. 8 points for a 3D table and 2 points for a radial table
+//                2. Indices are relative to the beginning of each table component
+//
+// Parameter   :  Idx       : Array to store the table indices
+//                Weight    : Array to store the interpolation weights
+//                x/y/z     : Target spatial coordinates
+//                UserArray : Auxiliary array set by Init_ExtPot/AccAuxArray_Tabular()
+//
+// Return      :  Number of stencil points, Idx[], Weight[]
+//-----------------------------------------------------------------------------------------
+int ExtTable_Stencil( int Idx[], real Weight[], const double x, const double y, const double z,
+                      const double UserArray[] )
+{
+
+   const double _dh = 1.0 / UserArray[EXT_TABLE_AUX_DH];
+
+// radial table
+   if ( UserArray[EXT_TABLE_AUX_RADIAL] != 0.0 )
+   {
+      const int    NR = (int)UserArray[EXT_TABLE_AUX_NPOINT];
+      const double dx = x - UserArray[EXT_TABLE_AUX_EDGEL+0];
+      const double dy = y - UserArray[EXT_TABLE_AUX_EDGEL+1];
+      const double dz = z - UserArray[EXT_TABLE_AUX_EDGEL+2];
+
+      double s = ( sqrt(dx*dx + dy*dy + dz*dz) - UserArray[EXT_TABLE_AUX_R0] )*_dh;
+      s = fmax( 0.0, fmin(s, (double)(NR-1)) );
+
+      Idx   [0] = MIN( (int)s, NR-2 );
+      Idx   [1] = Idx[0] + 1;
+      Weight[1] = (real)( s - Idx[0] );
+      Weight[0] = (real)1.0 - Weight[1];
+
+      return 2;
+   }
+
+// 3D table
+   else
+   {
+      const double Pos[3] = { x, y, z };
+      int  N[3], i[3];
+      real w[3];
+
+      for (int d=0; d<3; d++)
+      {
+         N[d] = (int)UserArray[EXT_TABLE_AUX_NPOINT+d];
+
+         double s = ( Pos[d] - UserArray[EXT_TABLE_AUX_EDGEL+d] )*_dh;
+         s = fmax( 0.0, fmin(s, (double)(N[d]-1)) );
+
+         i[d] = MIN( (int)s, N[d]-2 );
+         w[d] = (real)( s - i[d] );
+      }
+
+      for (int t=0; t<8; t++)
+      {
+         const int tx = t&1;
+         const int ty = (t>>1)&1;
+         const int tz = (t>>2)&1;
+
+         Idx   [t] = ( (i[2]+tz)*N[1] + (i[1]+ty) )*N[0] + (i[0]+tx);
+         Weight[t] = ( (tx) ? w[0] : (real)1.0-w[0] )*
+                     ( (ty) ? w[1] : (real)1.0-w[1] )*
+                     ( (tz) ? w[2] : (real)1.0-w[2] );
+      }
+
+      return 8;
+   }
+
+} // FUNCTION : ExtTable_Stencil
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  ExtTable_Fetch
+// Description :  Fetch one element of the table
+//
+// Parameter   :  Idx : Target index
+//
+// Return      :  Table element
+//-----------------------------------------------------------------------------------------
+real ExtTable_Fetch( const int Idx )
+{
+
+   return ExtPotTable[Idx];
+
+} // FUNCTION : ExtTable_Fetch
+
+
+
+// =============================
+// get the CPU function pointers
+// =============================
+
+static ExtPot_t ExtPot_Ptr = ExtPot_Tabular;
+static ExtAcc_t ExtAcc_Ptr = ExtAcc_Tabular;
+
+//-----------------------------------------------------------------------------------------
+// Function    :  SetCPUExtPot_Tabular, SetCPUExtAcc_Tabular
+// Description :  Return the function pointers to the CPU external potential/acceleration routines
+//
+// Note        :  1. To enable these routines, link to the function pointers "SetCPUExtPot_Ptr" and/or
+//                   "SetCPUExtAcc_Ptr" in a test problem initializer as follows:
+//
+//                      void SetCPUExtPot_Tabular( ExtPot_t &CPUExtPot_Ptr );
+//
+//                      ...
+//
+//                      SetCPUExtPot_Ptr = SetCPUExtPot_Tabular;
+//
+//                   --> Then they will be invoked by Init_ExtAccPot()
+//                2. Not supported by the GPU solvers yet
+//
+// Parameter   :  CPUExtPot_Ptr, CPUExtAcc_Ptr (call-by-reference)
+//
+// Return      :  CPUExtPot_Ptr, CPUExtAcc_Ptr
+//-----------------------------------------------------------------------------------------
+void SetCPUExtPot_Tabular( ExtPot_t &CPUExtPot_Ptr )
+{
+   CPUExtPot_Ptr = ExtPot_Ptr;
+}
+
+void SetCPUExtAcc_Tabular( ExtAcc_t &CPUExtAcc_Ptr )
+{
+   CPUExtAcc_Ptr = ExtAcc_Ptr;
+}
+
+
+
+// table dimensions set by Init_ExtTable()
+static int    ExtTable_NPoint[3];
+static double ExtTable_dh, ExtTable_R0;
+
+static void Init_ExtTable();
+static void Init_ExtTableAuxArray( double AuxArray[] );
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ExtPotAuxArray_Tabular / Init_ExtAccAuxArray_Tabular
+// Description :  Load the table and set the auxiliary arrays ExtPot_AuxArray[] / ExtAcc_AuxArray[] used by
+//                ExtPot_Tabular() / ExtAcc_Tabular()
+//
+// Note        :  1. To adopt these routines, link to the function pointers "Init_ExtPotAuxArray_Ptr" and/or
+//                   "Init_ExtAccAuxArray_Ptr" in a test problem initializer as follows:
+//
+//                      void Init_ExtPotAuxArray_Tabular( double AuxArray[] );
+//
+//                      ...
+//
+//                      Init_ExtPotAuxArray_Ptr = Init_ExtPotAuxArray_Tabular;
+//
+//                   --> Then they will be invoked by Init_ExtAccPot()
+//                2. The same table is shared by the external potential and acceleration
+//                3. AuxArray[] has the size of EXT_POT/ACC_NAUX_MAX defined in Macro.h (default = 10)
+//
+// Parameter   :  AuxArray : Array to be filled up
+//
+// Return      :  AuxArray[]
+//-------------------------------------------------------------------------------------------------------
+void Init_ExtPotAuxArray_Tabular( double AuxArray[] )
+{
+   Init_ExtTable();
+   Init_ExtTableAuxArray( AuxArray );
+}
+
+void Init_ExtAccAuxArray_Tabular( double AuxArray[] )
+{
+   Init_ExtTable();
+   Init_ExtTableAuxArray( AuxArray );
+}
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ExtTable
+// Description :  Load the external potential table and evaluate the acceleration at each table point
+//
+// Note        :  1. Invoked by Init_ExtPot/AccAuxArray_Tabular()
+//                   --> Only load the table once
+//                2. Two table types are supported
+//                   (1) 3D table   : EXT_POT_TABLE_NPOINT_X/Y/Z > 0
+//                                    --> one column of EXT_POT_TABLE_NPOINT_X*Y*Z potential values
+//                                        with x varying fastest
+//                                    --> point (i,j,k) locates at EXT_POT_TABLE_EDGEL + (i,j,k)*EXT_POT_TABLE_DH
+//                   (2) radial table: EXT_POT_TABLE_NPOINT_X/Y/Z <= 0
+//                                    --> two columns (radius, potential) with a constant radial spacing
+//                                    --> radius is measured from EXT_POT_TABLE_EDGEL
+//                3. Tables are loaded by Aux_LoadTable() and stored in ExtPotTable[] as
+//                   [potential, acceleration] for each point, where acceleration includes three components for
+//                   a 3D table and one radial component for a radial table
+//-------------------------------------------------------------------------------------------------------
+void Init_ExtTable()
+{
+
+#  ifdef GPU
+   Aux_Error( ERROR_INFO, "tabulated external potential/acceleration is not supported by the GPU solvers yet !!\n" );
+#  endif
+
+   if ( ExtPotTable != NULL )    return;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the external potential table \"%s\" ...\n", EXT_POT_TABLE_NAME );
+
+   if ( !Aux_CheckFileExist(EXT_POT_TABLE_NAME) )
+      Aux_Error( ERROR_INFO, "external potential table \"%s\" does not exist !!\n", EXT_POT_TABLE_NAME );
+
+
+   const bool RowMajor_No  = false;
+   const bool AllocMem_Yes = true;
+   const bool Radial       = ( EXT_POT_TABLE_NPOINT[0] <= 0  ||  EXT_POT_TABLE_NPOINT[1] <= 0  ||
+                               EXT_POT_TABLE_NPOINT[2] <= 0 );
+
+   double *Table = NULL;
+
+// radial table
+   if ( Radial )
+   {
+      const int  NCol    = 2;
+      const int  TCol[2] = { 0, 1 };
+      const int  NR      = Aux_LoadTable( Table, EXT_POT_TABLE_NAME, NCol, TCol, RowMajor_No, AllocMem_Yes );
+      const double *r    = Table;
+      const double *Pot  = Table + NR;
+
+      if ( NR < 2 )  Aux_Error( ERROR_INFO, "radial table \"%s\" has fewer than 2 rows !!\n", EXT_POT_TABLE_NAME );
+
+      const double dr = ( r[NR-1] - r[0] ) / ( NR - 1 );
+
+      if ( dr <= 0.0 )  Aux_Error( ERROR_INFO, "radius in \"%s\" must be in ascending order !!\n", EXT_POT_TABLE_NAME );
+
+      for (int t=1; t<NR; t++)
+      {
+         if (  fabs( r[t] - r[t-1] - dr ) > 1.0e-6*dr  )
+            Aux_Error( ERROR_INFO, "radius in \"%s\" is not evenly spaced (row %d) !!\n", EXT_POT_TABLE_NAME, t );
+      }
+
+      ExtTable_NPoint[0] = NR;
+      ExtTable_NPoint[1] = 1;
+      ExtTable_NPoint[2] = 1;
+      ExtTable_dh        = dr;
+      ExtTable_R0        = r[0];
+      ExtPotTable_Size      = 2*NR;
+      ExtPotTable           = new real [ExtPotTable_Size];
+
+      for (int t=0; t<NR; t++)
+      {
+         const int tL = ( t == 0    ) ? t : t-1;
+         const int tR = ( t == NR-1 ) ? t : t+1;
+
+         ExtPotTable[     t] = (real)Pot[t];
+         ExtPotTable[NR + t] = (real)(  -( Pot[tR] - Pot[tL] ) / ( (tR-tL)*dr )  );
+      }
+   } // if ( Radial )
+
+// 3D table
+   else
+   {
+      const int  NCol    = 1;
+      const int  TCol[1] = { 0 };
+      const int *N       = EXT_POT_TABLE_NPOINT;
+      const long NPoint  = (long)N[0]*N[1]*N[2];
+      const int  NRow    = Aux_LoadTable( Table, EXT_POT_TABLE_NAME, NCol, TCol, RowMajor_No, AllocMem_Yes );
+
+      for (int d=0; d<3; d++)
+         if ( N[d] < 2 )   Aux_Error( ERROR_INFO, "EXT_POT_TABLE_NPOINT[%d] (%d) < 2 !!\n", d, N[d] );
+
+      if ( NRow != NPoint )
+         Aux_Error( ERROR_INFO, "number of rows in \"%s\" (%d) != EXT_POT_TABLE_NPOINT_X*Y*Z (%ld) !!\n",
+                    EXT_POT_TABLE_NAME, NRow, NPoint );
+
+      if ( EXT_POT_TABLE_DH <= 0.0 )
+         Aux_Error( ERROR_INFO, "EXT_POT_TABLE_DH (%14.7e) <= 0.0 !!\n", EXT_POT_TABLE_DH );
+
+      for (int d=0; d<3; d++)    ExtTable_NPoint[d] = N[d];
+      ExtTable_dh   = EXT_POT_TABLE_DH;
+      ExtTable_R0   = 0.0;
+      ExtPotTable_Size = 4*NPoint;
+      ExtPotTable      = new real [ExtPotTable_Size];
+
+      const long Stride[3] = { 1, N[0], (long)N[0]*N[1] };
+
+#     pragma omp parallel for schedule( static )
+      for (int k=0; k<N[2]; k++)
+      for (int j=0; j<N[1]; j++)
+      for (int i=0; i<N[0]; i++)
+      {
+         const int  ijk[3] = { i, j, k };
+         const long Idx    = k*Stride[2] + j*Stride[1] + i;
+
+         ExtPotTable[Idx] = (real)Table[Idx];
+
+         for (int d=0; d<3; d++)
+         {
+            const long IdxL = ( ijk[d] == 0      ) ? Idx : Idx - Stride[d];
+            const long IdxR = ( ijk[d] == N[d]-1 ) ? Idx : Idx + Stride[d];
+
+            ExtPotTable[ (d+1)*NPoint + Idx ] = (real)(  -( Table[IdxR] - Table[IdxL] ) /
+                                                          ( (IdxR-IdxL)/Stride[d]*EXT_POT_TABLE_DH )  );
+         }
+      }
+   } // if ( Radial ) ... else ...
+
+   delete [] Table;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the external potential table \"%s\" ... done\n", EXT_POT_TABLE_NAME );
+
+} // FUNCTION : Init_ExtTable
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ExtTableAuxArray
+// Description :  Set the auxiliary array used by ExtPot_Tabular() and ExtAcc_Tabular()
+//
+// Parameter   :  AuxArray : Array to be filled up
+//
+// Return      :  AuxArray[]
+//-------------------------------------------------------------------------------------------------------
+void Init_ExtTableAuxArray( double AuxArray[] )
+{
+
+   for (int d=0; d<3; d++)
+   {
+      AuxArray[ EXT_TABLE_AUX_EDGEL  + d ] = EXT_POT_TABLE_EDGEL[d];
+      AuxArray[ EXT_TABLE_AUX_NPOINT + d ] = (double)ExtTable_NPoint[d];
+   }
+
+   AuxArray[EXT_TABLE_AUX_DH    ] = ExtTable_dh;
+   AuxArray[EXT_TABLE_AUX_RADIAL] = ( ExtTable_NPoint[1] == 1  &&  ExtTable_NPoint[2] == 1 ) ? 1.0 : 0.0;
+   AuxArray[EXT_TABLE_AUX_R0    ] = ExtTable_R0;
+
+} // FUNCTION : Init_ExtTableAuxArray
+
+#endif // #ifdef GRAVITY
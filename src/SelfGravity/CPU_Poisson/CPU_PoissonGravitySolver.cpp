@@ -10,7 +10,8 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
                             const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                   real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                             const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
-                            const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme );
+                            const real Omega, const real Tolerated_Error, const real Poi_Coeff,
+                            const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum );
 
 #elif ( POT_SCHEME == MG  )
 void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
@@ -18,7 +19,7 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
                                  real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                            const int NPatchGroup, const real dh_Min, const int Max_Iter, const int NPre_Smooth,
                            const int NPost_Smooth, const real Tolerated_Error, const real Poi_Coeff,
-                           const IntScheme_t IntScheme );
+                           const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum );
 #endif // POT_SCHEME
 
 
@@ -72,6 +73,7 @@ void CPU_ELBDMGravitySolver(       real Flu_Array[][GRA_NIN][PATCH_SIZE][PATCH_S
 //                SOR_Min_Iter         : Minimum number of iterations for SOR
 //                SOR_Max_Iter         : Maximum number of iterations for SOR
 //                SOR_Omega            : Over-relaxation parameter
+//                SOR_Tolerated_Error  : Maximum tolerated relative residual for SOR (<= 0.0 --> disabled)
 //                MG_Max_Iter          : Maximum number of iterations for multigrid
 //                MG_NPre_Smooth       : Number of pre-smoothing steps for multigrid
 //                MG_NPos_tSmooth      : Number of post-smoothing steps for multigrid
@@ -91,6 +93,10 @@ void CPU_ELBDMGravitySolver(       real Flu_Array[][GRA_NIN][PATCH_SIZE][PATCH_S
 //                TimeOld              : Physical time at the previous step (for the external gravity solver in UNSPLIT_GRAVITY)
 //                ExtPot               : Add the external potential
 //                MinEint              : Internal energy floor
+//                WarmStart            : Use h_Pot_Array_Out as the initial guess of the Poisson solver
+//                                       --> see Poi_Prepare_WarmStart()
+//                Poi_NIter            : Number of iterations of the Poisson solver summed over all patches
+//                                       (NULL --> do not count)
 //
 // Useless parameters in HYDRO : ELBDM_Eta, ELBDM_Lambda
 // Useless parameters in ELBDM : P5_Gradient
@@ -107,12 +113,13 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
                                      char h_DE_Array     [][PS1][PS1][PS1],
                                const real h_Emag_Array   [][PS1][PS1][PS1],
                                const int NPatchGroup, const real dt, const real dh, const int SOR_Min_Iter,
-                               const int SOR_Max_Iter, const real SOR_Omega, const int MG_Max_Iter,
-                               const int MG_NPre_Smooth, const int MG_NPost_Smooth, const real MG_Tolerated_Error,
-                               const real Poi_Coeff, const IntScheme_t IntScheme, const bool P5_Gradient,
-                               const real ELBDM_Eta, const real ELBDM_Lambda, const bool Poisson, const bool GraAcc,
-                               const OptGravityType_t GravityType, const double TimeNew, const double TimeOld,
-                               const bool ExtPot, const real MinEint )
+                               const int SOR_Max_Iter, const real SOR_Omega, const real SOR_Tolerated_Error,
+                               const int MG_Max_Iter, const int MG_NPre_Smooth, const int MG_NPost_Smooth,
+                               const real MG_Tolerated_Error, const real Poi_Coeff, const IntScheme_t IntScheme,
+                               const bool P5_Gradient, const real ELBDM_Eta, const real ELBDM_Lambda,
+                               const bool Poisson, const bool GraAcc, const OptGravityType_t GravityType,
+                               const double TimeNew, const double TimeOld, const bool ExtPot, const real MinEint,
+                               const bool WarmStart, long *Poi_NIter )
 {
 
 // check
@@ -152,14 +159,14 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
 #     if   ( POT_SCHEME == SOR )
 
       CPU_PoissonSolver_SOR( h_Rho_Array, h_Pot_Array_In, h_Pot_Array_Out, NPatchGroup, dh,
-                             SOR_Min_Iter, SOR_Max_Iter, SOR_Omega,
-                             Poi_Coeff, IntScheme );
+                             SOR_Min_Iter, SOR_Max_Iter, SOR_Omega, SOR_Tolerated_Error,
+                             Poi_Coeff, IntScheme, WarmStart, Poi_NIter );
 
 #     elif ( POT_SCHEME == MG  )
 
       CPU_PoissonSolver_MG ( h_Rho_Array, h_Pot_Array_In, h_Pot_Array_Out, NPatchGroup, dh,
                              MG_Max_Iter, MG_NPre_Smooth, MG_NPost_Smooth, MG_Tolerated_Error,
-                             Poi_Coeff, IntScheme );
+                             Poi_Coeff, IntScheme, WarmStart, Poi_NIter );
 
 #     else
 
@@ -4,9 +4,11 @@
 
 
 
-static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size );
+static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size,
+                          const bool SavePS );
 static void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const int RhoK_Size );
 static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
+static void GetBaseLevelDensity( const int PID0, real Dens[][PS1][PS1][PS1], const double PrepTime );
 
 #ifdef SERIAL
 extern rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;
@@ -14,6 +16,12 @@ extern rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;
 extern rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv;
 #endif
 
+extern int   FFTW_local_nz, FFTW_local_z_start, FFTW_local_ny_after_transpose, FFTW_local_y_start_after_transpose;
+extern int   FFTW_total_local_size, FFTW_NRecvSlice;
+extern int  *FFTW_List_z_start;
+extern real *FFTW_RhoK, *FFTW_RecvBuf;
+extern long *FFTW_RecvBuf_SIdx;
+
 extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, const double z, const double Time,
                                                const int lv, double AuxArray[] );
 
@@ -89,48 +97,11 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 
 
 // 2. prepare the temporary send buffer and record lists
-   const OptPotBC_t  PotBC_None        = BC_POT_NONE;
-   const IntScheme_t IntScheme         = INT_NONE;
-   const NSide_t     NSide_None        = NSIDE_00;
-   const bool        IntPhase_No       = false;
-   const bool        DE_Consistency_No = false;
-   const real        MinDens_No        = -1.0;
-   const real        MinPres_No        = -1.0;
-   const int         GhostSize         = 0;
-   const int         NPG               = 1;
-
-   real (*Dens)[PS1][PS1][PS1] = new real [8*NPG][PS1][PS1][PS1];
+   real (*Dens)[PS1][PS1][PS1] = new real [8][PS1][PS1][PS1];
 
    for (int PID0=0; PID0<amr->NPatchComma[0][1]; PID0+=8)
    {
-//    even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
-//    for depositing particle mass onto grids.
-//    also note that we do not check minimum density here since no ghost zones are required
-      Prepare_PatchData( 0, PrepTime, Dens[0][0][0], NULL, GhostSize, NPG, &PID0, _TOTAL_DENS, _NONE,
-                         IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
-                         MinDens_No, MinPres_No, DE_Consistency_No );
-
-
-//    add extra mass source for gravity if required
-      if ( OPT__GRAVITY_EXTRA_MASS )
-      {
-         const double dh = amr->dh[0];
-
-         for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
-         {
-            const double x0 = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
-            const double y0 = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
-            const double z0 = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
-
-            double x, y, z;
-
-            for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
-            for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
-            for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
-               Dens[LocalID][k][j][i] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[0], 0, NULL );
-            }}}
-         }
-      }
+      GetBaseLevelDensity( PID0, Dens, PrepTime );
 
 
 //    copy data to the send buffer
@@ -292,6 +263,63 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetBaseLevelDensity
+// Description :  Prepare the total density (including particles and extra mass) of eight base-level patches
+//
+// Note        :  1. Invoked by Patch2Slab() and Patch2Pencil()
+//                2. No ghost zones are prepared
+//
+// Parameter   :  PID0     : Patch ID of the first patch in the target patch group
+//                Dens     : Array to store the output density
+//                PrepTime : Physical time for preparing the density field
+//-------------------------------------------------------------------------------------------------------
+void GetBaseLevelDensity( const int PID0, real Dens[][PS1][PS1][PS1], const double PrepTime )
+{
+
+   const OptPotBC_t  PotBC_None        = BC_POT_NONE;
+   const IntScheme_t IntScheme         = INT_NONE;
+   const NSide_t     NSide_None        = NSIDE_00;
+   const bool        IntPhase_No       = false;
+   const bool        DE_Consistency_No = false;
+   const real        MinDens_No        = -1.0;
+   const real        MinPres_No        = -1.0;
+   const int         GhostSize         = 0;
+   const int         NPG               = 1;
+
+// even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
+// for depositing particle mass onto grids.
+// also note that we do not check minimum density here since no ghost zones are required
+   Prepare_PatchData( 0, PrepTime, Dens[0][0][0], NULL, GhostSize, NPG, &PID0, _TOTAL_DENS, _NONE,
+                      IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
+                      MinDens_No, MinPres_No, DE_Consistency_No );
+
+
+// add extra mass source for gravity if required
+   if ( OPT__GRAVITY_EXTRA_MASS )
+   {
+      const double dh = amr->dh[0];
+
+      for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+      {
+         const double x0 = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
+         const double y0 = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
+         const double z0 = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
+
+         double x, y, z;
+
+         for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
+         for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
+         for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+            Dens[LocalID][k][j][i] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[0], 0, NULL );
+         }}}
+      }
+   }
+
+} // FUNCTION : GetBaseLevelDensity
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  ZIndex2Rank
 // Description :  Return the MPI rank which the input z coordinates belongs to in the FFTW slab decomposition
@@ -438,6 +466,230 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
 
 
 
+#ifndef SERIAL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Patch2Pencil
+// Description :  Patch-based data --> x-pencil domain decomposition (for density)
+//
+// Note        :  1. Counterpart of Patch2Slab() for OPT__FFT_PENCIL
+//                2. Data are exchanged in units of patch rows (PS1 cells along x) since the owner of a cell in the
+//                   x-pencil decomposition depends on both its y and z coordinates
+//                   --> See FFT_Pencil_GetRank()
+//                3. Only support the periodic BC
+//
+// Parameter   :  RhoK           : In-place FFT array
+//                SendBuf_Rho    : Sending MPI buffer of density
+//                RecvBuf_Rho    : Receiving MPI buffer of density
+//                SendBuf_PIdx   : Sending MPI buffer of 1D coordinate in pencil
+//                RecvBuf_PIdx   : Receiving MPI buffer of 1D coordinate in pencil
+//                List_PID       : PID of each patch row sent to each rank
+//                List_kj        : Local (z,y) coordinates of each patch row sent to each rank (k*PS1+j)
+//                List_NSend_Rho : Size of density data sent to each rank
+//                List_NRecv_Rho : Size of density data received from each rank
+//                FFT_Size       : Size of the FFT operation
+//                NRecvRow       : Total number of patch rows received from other ranks
+//                PrepTime       : Physical time for preparing the density field
+//-------------------------------------------------------------------------------------------------------
+void Patch2Pencil( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf_PIdx, long *RecvBuf_PIdx,
+                   int **List_PID, int **List_kj, int *List_NSend_Rho, int *List_NRecv_Rho,
+                   const int FFT_Size[], const long NRecvRow, const double PrepTime )
+{
+
+// check
+   if ( OPT__GRAVITY_EXTRA_MASS  &&  Poi_AddExtraMassForGravity_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "Poi_AddExtraMassForGravity_Ptr == NULL for OPT__GRAVITY_EXTRA_MASS !!\n" );
+
+
+   const int NxPad  = 2*(FFT_Size[0]/2+1);   // padded pencil size in the x direction
+   const int Scale0 = amr->scale[0];
+
+   int  Cr[3], TRank, List_NSend_PIdx[MPI_NRank], List_NRecv_PIdx[MPI_NRank];
+   int  List_y_start[MPI_NRank], List_ny[MPI_NRank], List_z_start[MPI_NRank], List_nz[MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+      FFT_Pencil_GetLayout( FFT_Size, r, List_y_start[r], List_ny[r], List_z_start[r], List_nz[r] );
+
+
+// 1. count the number of patch rows sent to each rank
+   for (int r=0; r<MPI_NRank; r++)  List_NSend_PIdx[r] = 0;
+
+   for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
+   {
+      for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+         List_NSend_PIdx[ FFT_Pencil_GetRank( FFT_Size, Cr[1]+j, Cr[2]+k ) ] ++;
+   }
+
+
+// 2. calculate the displacement and allocate the record lists
+   int Send_Disp_Rho[MPI_NRank], Recv_Disp_Rho[MPI_NRank], Send_Disp_PIdx[MPI_NRank], Recv_Disp_PIdx[MPI_NRank];
+   int Counter[MPI_NRank];
+
+   MPI_Alltoall( List_NSend_PIdx, 1, MPI_INT, List_NRecv_PIdx, 1, MPI_INT, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      List_NSend_Rho[r] = List_NSend_PIdx[r]*PS1;
+      List_NRecv_Rho[r] = List_NRecv_PIdx[r]*PS1;
+      List_PID      [r] = (int*)malloc( List_NSend_PIdx[r]*sizeof(int) );
+      List_kj       [r] = (int*)malloc( List_NSend_PIdx[r]*sizeof(int) );
+      Counter       [r] = 0;
+   }
+
+   Send_Disp_PIdx[0] = 0;
+   Recv_Disp_PIdx[0] = 0;
+   Send_Disp_Rho [0] = 0;
+   Recv_Disp_Rho [0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_Disp_PIdx[r] = Send_Disp_PIdx[r-1] + List_NSend_PIdx[r-1];
+      Recv_Disp_PIdx[r] = Recv_Disp_PIdx[r-1] + List_NRecv_PIdx[r-1];
+      Send_Disp_Rho [r] = Send_Disp_Rho [r-1] + List_NSend_Rho [r-1];
+      Recv_Disp_Rho [r] = Recv_Disp_Rho [r-1] + List_NRecv_Rho [r-1];
+   }
+
+// check
+#  ifdef GAMER_DEBUG
+   const long NRecv_Total = (long)Recv_Disp_PIdx[MPI_NRank-1] + List_NRecv_PIdx[MPI_NRank-1];
+
+   if ( NRecv_Total != NRecvRow )   Aux_Error( ERROR_INFO, "NRecv_Total = %ld != expected value = %ld !!\n",
+                                               NRecv_Total, NRecvRow );
+#  endif
+
+
+// 3. prepare the send buffer and record lists directly in the order of target ranks
+   real (*Dens)[PS1][PS1][PS1] = new real [8][PS1][PS1][PS1];
+   int   y, z, idx;
+
+   for (int PID0=0; PID0<amr->NPatchComma[0][1]; PID0+=8)
+   {
+      GetBaseLevelDensity( PID0, Dens, PrepTime );
+
+      for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+      {
+         for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+
+         for (int k=0; k<PS1; k++)  {  z = Cr[2] + k;
+         for (int j=0; j<PS1; j++)  {  y = Cr[1] + j;
+
+            TRank = FFT_Pencil_GetRank( FFT_Size, y, z );
+            idx   = Send_Disp_PIdx[TRank] + Counter[TRank];
+
+            List_PID    [TRank][ Counter[TRank] ] = PID;
+            List_kj     [TRank][ Counter[TRank] ] = k*PS1 + j;
+            SendBuf_PIdx[idx] = ( (long)(z-List_z_start[TRank])*List_ny[TRank] + (y-List_y_start[TRank]) )*NxPad + Cr[0];
+
+            memcpy( SendBuf_Rho + (long)idx*PS1, Dens[LocalID][k][j], PS1*sizeof(real) );
+
+            Counter[TRank] ++;
+         }}
+      }
+   }
+
+   delete [] Dens;
+
+
+// 4. exchange data by MPI
+   MPI_Alltoallv( SendBuf_PIdx, List_NSend_PIdx, Send_Disp_PIdx, MPI_LONG,
+                  RecvBuf_PIdx, List_NRecv_PIdx, Recv_Disp_PIdx, MPI_LONG,   MPI_COMM_WORLD );
+
+#  ifdef FLOAT8
+   MPI_Alltoallv( SendBuf_Rho,  List_NSend_Rho,  Send_Disp_Rho,  MPI_DOUBLE,
+                  RecvBuf_Rho,  List_NRecv_Rho,  Recv_Disp_Rho,  MPI_DOUBLE, MPI_COMM_WORLD );
+#  else
+   MPI_Alltoallv( SendBuf_Rho,  List_NSend_Rho,  Send_Disp_Rho,  MPI_FLOAT,
+                  RecvBuf_Rho,  List_NRecv_Rho,  Recv_Disp_Rho,  MPI_FLOAT,  MPI_COMM_WORLD );
+#  endif
+
+
+// 5. store the received density to the padded array "RhoK"
+   for (long t=0; t<NRecvRow; t++)
+      memcpy( RhoK + RecvBuf_PIdx[t], RecvBuf_Rho + t*PS1, PS1*sizeof(real) );
+
+} // FUNCTION : Patch2Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil2Patch
+// Description :  x-pencil domain decomposition --> patch-based data (for potential)
+//
+// Note        :  1. Counterpart of Slab2Patch() for OPT__FFT_PENCIL
+//
+// Parameter   :  RhoK       : In-place FFT array
+//                SendBuf    : Sending MPI buffer of potential
+//                RecvBuf    : Receiving MPI buffer of potential
+//                SaveSg     : Sandglass to store the updated data
+//                List_PIdx  : 1D coordinate in pencil
+//                List_PID   : PID of each patch row sent to each rank
+//                List_kj    : Local (z,y) coordinates of each patch row sent to each rank (k*PS1+j)
+//                List_NSend : Size of potential data sent to each rank
+//                List_NRecv : Size of potential data received from each rank
+//                NSendRow   : Total number of patch rows to be sent to other ranks
+//-------------------------------------------------------------------------------------------------------
+void Pencil2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_PIdx,
+                   int **List_PID, int **List_kj, int *List_NSend, int *List_NRecv, const long NSendRow )
+{
+
+// 1. store the evaluated potential to the send buffer
+   for (long t=0; t<NSendRow; t++)
+      memcpy( SendBuf + t*PS1, RhoK + List_PIdx[t], PS1*sizeof(real) );
+
+
+// 2. calculate the displacement and exchange data by MPI
+   int Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank];
+
+   Send_Disp[0] = 0;
+   Recv_Disp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_Disp[r] = Send_Disp[r-1] + List_NSend[r-1];
+      Recv_Disp[r] = Recv_Disp[r-1] + List_NRecv[r-1];
+   }
+
+#  ifdef FLOAT8
+   MPI_Alltoallv( SendBuf, List_NSend, Send_Disp, MPI_DOUBLE,
+                  RecvBuf, List_NRecv, Recv_Disp, MPI_DOUBLE, MPI_COMM_WORLD );
+#  else
+   MPI_Alltoallv( SendBuf, List_NSend, Send_Disp, MPI_FLOAT,
+                  RecvBuf, List_NRecv, Recv_Disp, MPI_FLOAT,  MPI_COMM_WORLD );
+#  endif
+
+
+// 3. store the received potential data to different patch objects
+   int   PID, kj, NRecvRow;
+   real *RecvPtr = RecvBuf;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NRecvRow = List_NRecv[r]/PS1;
+
+      for (int t=0; t<NRecvRow; t++)
+      {
+         PID = List_PID[r][t];
+         kj  = List_kj [r][t];
+
+         memcpy( amr->patch[SaveSg][0][PID]->pot[ kj/PS1 ][ kj%PS1 ], RecvPtr, PS1*sizeof(real) );
+
+         RecvPtr += PS1;
+      }
+   }
+
+
+// free memory
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      free( List_PID[r] );
+      free( List_kj [r] );
+   }
+
+} // FUNCTION : Pencil2Patch
+#endif // #ifndef SERIAL
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  FFT_Periodic
 // Description :  Evaluate the gravitational potential by FFT for the periodic BC
@@ -450,8 +702,11 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
 //                j_start   : Starting j index
 //                dj        : Size of array in the j (y) direction after the forward FFT
 //                RhoK_Size : Size of the array "RhoK"
+//                SavePS    : Bin the power spectrum right after the forward FFT for Output_BasePowerSpectrum()
+//                            --> See Output_BasePowerSpectrum_SaveCache()
 //-------------------------------------------------------------------------------------------------------
-void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size )
+void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size,
+                   const bool SavePS )
 {
 
    const int Nx        = NX0_TOT[0];
@@ -463,6 +718,10 @@ void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const in
    fftw_complex *cdata;
 
 
+// hash the density so that Output_BasePowerSpectrum() can verify that it is unchanged
+   const ulong DensHash = ( SavePS ) ? Output_BasePowerSpectrum_HashDens( RhoK ) : 0;
+
+
 // forward FFT
 #  ifdef SERIAL
    rfftwnd_one_real_to_complex( FFTW_Plan, RhoK, NULL );
@@ -471,6 +730,10 @@ void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const in
 #  endif
 
 
+// bin the power spectrum before the density is overwritten
+   if ( SavePS )  Output_BasePowerSpectrum_SaveCache( RhoK, j_start, dj, DensHash );
+
+
 // the data are now complex, so typecast a pointer
    cdata = (fftw_complex*) RhoK;
 
@@ -615,7 +878,9 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const i
 // Function    :  CPU_PoissonSolver_FFT
 // Description :  Evaluate the base-level potential by FFT
 //
-// Note        :  Work with both periodic and isolated BC's
+// Note        :  1. Work with both periodic and isolated BC's
+//                2. Use the pencil decomposition instead of the FFTW slab decomposition when OPT__FFT_PENCIL is on
+//                   --> Periodic BC only
 //
 // Parameter   :  Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
 //                SaveSg    : Sandglass to store the updated data
@@ -627,47 +892,65 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
 // determine the FFT size (the zero-padding method is adopted for the isolated BC)
    int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
-   if ( OPT__BC_POT == BC_POT_ISOLATED )
-      for (int d=0; d<3; d++)    FFT_Size[d] *= 2;
 
+// pencil decomposition
+#  ifndef SERIAL
+   if ( OPT__FFT_PENCIL )
+   {
+      int y_start, ny, z_start, nz;
 
-// get the array indices using by FFTW
-   int local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
+      FFT_Pencil_GetLayout( FFT_Size, MPI_Rank, y_start, ny, z_start, nz );
 
-#  ifdef SERIAL
-   local_nz                      = FFT_Size[2];
-   local_z_start                 = 0;
-   local_ny_after_transpose      = NULL_INT;
-   local_y_start_after_transpose = NULL_INT;
-   total_local_size              = 2*(FFT_Size[0]/2+1)*FFT_Size[1]*FFT_Size[2];
-#  else
-   rfftwnd_mpi_local_sizes( FFTW_Plan, &local_nz, &local_z_start, &local_ny_after_transpose,
-                            &local_y_start_after_transpose, &total_local_size );
-#  endif
+      const long NRecvRow = (long)ny*nz*NX0_TOT[0]/PS1;
+      const long NSendRow = (long)amr->NPatchComma[0][1]*SQR(PS1);
 
+      real *RhoK         = new real [ (long)nz*ny*2*(FFT_Size[0]/2+1) ];   // array storing both density and potential
+      real *SendBuf      = new real [ NSendRow*PS1 ];                       // MPI send buffer for density and potential
+      real *RecvBuf      = new real [ NRecvRow*PS1 ];                       // MPI recv buffer for density and potential
+      long *SendBuf_PIdx = new long [ NSendRow ];                           // MPI send buffer for 1D coordinate in pencil
+      long *RecvBuf_PIdx = new long [ NRecvRow ];                           // MPI recv buffer for 1D coordinate in pencil
 
-// collect "local_nz" from all ranks and set the corresponding list "List_z_start"
-   int List_nz     [MPI_NRank  ];   // slab thickness of each rank in the FFTW slab decomposition
-   int List_z_start[MPI_NRank+1];   // starting z coordinate of each rank in the FFTW slab decomposition
+      int  *List_PID    [MPI_NRank];   // PID of each patch row sent to each rank
+      int  *List_kj     [MPI_NRank];   // local (z,y) coordinates of each patch row sent to each rank
+      int   List_NSend  [MPI_NRank];   // size of data (density/potential) sent to each rank
+      int   List_NRecv  [MPI_NRank];   // size of data (density/potential) received from each rank
 
-   MPI_Allgather( &local_nz, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
+      Patch2Pencil( RhoK, SendBuf, RecvBuf, SendBuf_PIdx, RecvBuf_PIdx, List_PID, List_kj, List_NSend, List_NRecv,
+                    FFT_Size, NRecvRow, PrepTime );
 
-   List_z_start[0] = 0;
-   for (int r=0; r<MPI_NRank; r++)  List_z_start[r+1] = List_z_start[r] + List_nz[r];
+      FFT_Pencil_Periodic( RhoK, Poi_Coeff, amr->dh[0] );
+
+      Pencil2Patch( RhoK, RecvBuf, SendBuf, SaveSg, RecvBuf_PIdx, List_PID, List_kj, List_NRecv, List_NSend, NRecvRow );
+
+      delete [] RhoK;
+      delete [] SendBuf;
+      delete [] RecvBuf;
+      delete [] SendBuf_PIdx;
+      delete [] RecvBuf_PIdx;
+
+      return;
+   } // if ( OPT__FFT_PENCIL )
+#  endif // #ifndef SERIAL
+
+   if ( OPT__BC_POT == BC_POT_ISOLATED )
+      for (int d=0; d<3; d++)    FFT_Size[d] *= 2;
 
-   if ( List_z_start[MPI_NRank] != FFT_Size[2] )
-      Aux_Error( ERROR_INFO, "List_z_start[%d] (%d) != expectation (%d) !!\n",
-                 MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
 
+// get the array indices using by FFTW (which are set by Init_FFTW())
+   const int  local_nz                      = FFTW_local_nz;
+   const int  local_ny_after_transpose      = FFTW_local_ny_after_transpose;
+   const int  local_y_start_after_transpose = FFTW_local_y_start_after_transpose;
+   const int  total_local_size              = FFTW_total_local_size;
+   const int  NRecvSlice                    = FFTW_NRecvSlice;
+   const int *List_z_start                  = FFTW_List_z_start;
 
-// allocate memory (properly taking into account the zero-padding regions, where no data need to be exchanged)
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
 
-   real *RhoK         = new real [ total_local_size ];                           // array storing both density and potential
+// allocate memory (only the buffers depending on the number of patches; the others are shared workspace allocated by Init_FFTW())
+   real *RhoK         = FFTW_RhoK;                                               // array storing both density and potential
    real *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];     // MPI send buffer for density and potential
-   real *RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];     // MPI recv buffer for density and potentia
+   real *RecvBuf      = FFTW_RecvBuf;                                            // MPI recv buffer for density and potential
    long *SendBuf_SIdx = new long [ amr->NPatchComma[0][1]*PS1 ];                 // MPI send buffer for 1D coordinate in slab
-   long *RecvBuf_SIdx = new long [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];  // MPI recv buffer for 1D coordinate in slab
+   long *RecvBuf_SIdx = FFTW_RecvBuf_SIdx;                                       // MPI recv buffer for 1D coordinate in slab
 
    int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
    int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
@@ -687,7 +970,8 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
 
 // evaluate potential by FFT
    if      ( OPT__BC_POT == BC_POT_PERIODIC )
-      FFT_Periodic( RhoK, Poi_Coeff, local_y_start_after_transpose, local_ny_after_transpose, total_local_size );
+      FFT_Periodic( RhoK, Poi_Coeff, local_y_start_after_transpose, local_ny_after_transpose, total_local_size,
+                    Output_BasePowerSpectrum_IsPending(PrepTime) );
 
    else if ( OPT__BC_POT == BC_POT_ISOLATED )
       FFT_Isolated( RhoK, GreenFuncK, Poi_Coeff, total_local_size );
@@ -701,11 +985,8 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
                local_nz, FFT_Size, NRecvSlice );
 
 
-   delete [] RhoK;
    delete [] SendBuf;
-   delete [] RecvBuf;
    delete [] SendBuf_SIdx;
-   delete [] RecvBuf_SIdx;
 
 } // FUNCTION : CPU_PoissonSolver_FFT
 
@@ -0,0 +1,725 @@
+#include "GAMER.h"
+
+#if ( defined GRAVITY  &&  !defined SERIAL )
+
+
+
+// FFT size and the 2D process grid of the pencil decomposition
+// --> rank = pz*Pencil_NProc[0] + py, where (py, pz) = (Pencil_Coord[0], Pencil_Coord[1])
+static int      Pencil_N    [3];
+static int      Pencil_NProc[2];
+static int      Pencil_Coord[2];
+static MPI_Comm Pencil_Comm_Row;    // ranks with the same pz --> x <-> y transposes
+static MPI_Comm Pencil_Comm_Col;    // ranks with the same py --> y <-> z transposes
+
+static rfftw_plan Pencil_Plan_X, Pencil_Plan_X_Inv;
+static fftw_plan  Pencil_Plan_Y, Pencil_Plan_Y_Inv, Pencil_Plan_Z, Pencil_Plan_Z_Inv;
+
+static void Forward_XYZ( real *RhoK, const int N[], const rfftw_plan Plan_X, const fftw_plan Plan_Y, const fftw_plan Plan_Z,
+                         fftw_complex *Cplx_Y, fftw_complex *Cplx_Z, fftw_real *HC );
+static void Transpose_XY( const int N[], const fftw_complex *In, fftw_complex *Out, const bool Inverse );
+static void Transpose_YZ( const int N[], const fftw_complex *In, fftw_complex *Out, const bool Inverse );
+static void Alltoallv_Complex( fftw_complex *SendBuf, const long *SendCount, fftw_complex *RecvBuf, const long *RecvCount,
+                               const int NProc, const MPI_Comm Comm );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_BlockStart / FFT_Pencil_BlockOwner
+// Description :  Block distribution of N elements to P ranks
+//
+// Note        :  1. Rank p owns the elements [ BlockStart(N,P,p) ... BlockStart(N,P,p+1)-1 ]
+//                2. BlockOwner() returns the rank owning the element i
+//-------------------------------------------------------------------------------------------------------
+int FFT_Pencil_BlockStart( const int N, const int P, const int p )
+{
+   return (int)( (long)N*p/P );
+}
+
+int FFT_Pencil_BlockOwner( const int N, const int P, const int i )
+{
+   return (int)(  ( (long)P*(i+1) - 1 ) / N  );
+}
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Init
+// Description :  Construct the process grid, sub-communicators, and 1D FFTW plans of the pencil decomposition
+//
+// Note        :  1. Invoked by Init_FFTW() when OPT__FFT_PENCIL is on
+//                2. Three layouts are used (N[] = FFT_Size[], Nxh = N[0]/2+1, and block p of M = elements owned by
+//                   rank p when distributing M elements):
+//                   x-pencil : y  in block py of N[1], z in block pz of N[2], all x --> [z][y][2*Nxh] (padded real)
+//                   y-pencil : kx in block py of Nxh,  z in block pz of N[2], all y --> [z][kx][y]    (complex)
+//                   z-pencil : kx in block py of Nxh,  y in block pz of N[1], all z --> [kx][y][z]    (complex)
+//                   --> All ranks own data as long as Pencil_NProc[0] <= MIN(N[1],Nxh) and Pencil_NProc[1] <= MIN(N[1],N[2])
+//                       --> Up to O(N^2) ranks share the FFT instead of N[2] ranks in the slab decomposition
+//                3. The x <-> y and y <-> z transposes only involve the Pencil_NProc[0] ranks in a row and
+//                   the Pencil_NProc[1] ranks in a column, respectively
+//
+// Parameter   :  FFT_Size : Size of the FFT operation
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Init( const int FFT_Size[] )
+{
+
+   for (int d=0; d<3; d++)    Pencil_N[d] = FFT_Size[d];
+
+   const int Nxh = Pencil_N[0]/2 + 1;
+
+
+// 1. process grid
+// --> MPI_Dims_create() returns non-increasing dimensions, and the larger one is assigned to z
+//     since MIN(N[1],N[2]) > MIN(N[1],Nxh) for cubic boxes
+   int Dims[2] = { 0, 0 };
+   MPI_Dims_create( MPI_NRank, 2, Dims );
+
+   Pencil_NProc[0] = Dims[1];
+   Pencil_NProc[1] = Dims[0];
+   Pencil_Coord[0] = MPI_Rank % Pencil_NProc[0];
+   Pencil_Coord[1] = MPI_Rank / Pencil_NProc[0];
+
+   if (  MPI_Rank == 0  &&
+         ( Pencil_NProc[0] > MIN(Pencil_N[1],Nxh) || Pencil_NProc[1] > MIN(Pencil_N[1],Pencil_N[2]) )  )
+      Aux_Message( stderr, "WARNING : some ranks own no data in the pencil FFT (process grid = %d x %d, FFT size = %d x %d x %d) !!\n",
+                   Pencil_NProc[0], Pencil_NProc[1], Pencil_N[0], Pencil_N[1], Pencil_N[2] );
+
+
+// 2. sub-communicators
+// --> the rank in Pencil_Comm_Row/Col is py/pz
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil_Coord[1], Pencil_Coord[0], &Pencil_Comm_Row );
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil_Coord[0], Pencil_Coord[1], &Pencil_Comm_Col );
+
+
+// 3. 1D plans
+   Pencil_Plan_X     = rfftw_create_plan( Pencil_N[0], FFTW_REAL_TO_COMPLEX, FFTW_ESTIMATE );
+   Pencil_Plan_X_Inv = rfftw_create_plan( Pencil_N[0], FFTW_COMPLEX_TO_REAL, FFTW_ESTIMATE );
+   Pencil_Plan_Y     = fftw_create_plan ( Pencil_N[1], FFTW_FORWARD,         FFTW_ESTIMATE | FFTW_IN_PLACE );
+   Pencil_Plan_Y_Inv = fftw_create_plan ( Pencil_N[1], FFTW_BACKWARD,        FFTW_ESTIMATE | FFTW_IN_PLACE );
+   Pencil_Plan_Z     = fftw_create_plan ( Pencil_N[2], FFTW_FORWARD,         FFTW_ESTIMATE | FFTW_IN_PLACE );
+   Pencil_Plan_Z_Inv = fftw_create_plan ( Pencil_N[2], FFTW_BACKWARD,        FFTW_ESTIMATE | FFTW_IN_PLACE );
+
+} // FUNCTION : FFT_Pencil_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_End
+// Description :  Free the resources allocated by FFT_Pencil_Init()
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_End()
+{
+
+   rfftw_destroy_plan( Pencil_Plan_X     );
+   rfftw_destroy_plan( Pencil_Plan_X_Inv );
+   fftw_destroy_plan ( Pencil_Plan_Y     );
+   fftw_destroy_plan ( Pencil_Plan_Y_Inv );
+   fftw_destroy_plan ( Pencil_Plan_Z     );
+   fftw_destroy_plan ( Pencil_Plan_Z_Inv );
+
+   MPI_Comm_free( &Pencil_Comm_Row );
+   MPI_Comm_free( &Pencil_Comm_Col );
+
+} // FUNCTION : FFT_Pencil_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_GetLayout
+// Description :  Return the x-pencil layout of the target rank
+//
+// Note        :  1. FFT size N[] can differ from that passed to FFT_Pencil_Init() since the process grid does not
+//                   depend on it (e.g., see Aux_Record_LevelPowerSpectrum())
+//
+// Parameter   :  N       : Size of the FFT operation
+//                Rank    : Target MPI rank
+//                y_start : Starting y coordinate
+//                ny      : Number of y coordinates
+//                z_start : Starting z coordinate
+//                nz      : Number of z coordinates
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_GetLayout( const int N[], const int Rank, int &y_start, int &ny, int &z_start, int &nz )
+{
+
+   const int py = Rank % Pencil_NProc[0];
+   const int pz = Rank / Pencil_NProc[0];
+
+   y_start = FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py   );
+   ny      = FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py+1 ) - y_start;
+   z_start = FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz   );
+   nz      = FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz+1 ) - z_start;
+
+} // FUNCTION : FFT_Pencil_GetLayout
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_GetLayout_K
+// Description :  Return the z-pencil layout of this rank (i.e., the layout returned by FFT_Pencil_Forward())
+//
+// Parameter   :  N        : Size of the FFT operation
+//                kx_start : Starting kx coordinate
+//                nkx      : Number of kx coordinates
+//                y_start  : Starting y (ky) coordinate
+//                ny       : Number of y (ky) coordinates
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_GetLayout_K( const int N[], int &kx_start, int &nkx, int &y_start, int &ny )
+{
+
+   const int Nxh = N[0]/2 + 1;
+
+   kx_start = FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], Pencil_Coord[0]   );
+   nkx      = FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], Pencil_Coord[0]+1 ) - kx_start;
+   y_start  = FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], Pencil_Coord[1]   );
+   ny       = FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], Pencil_Coord[1]+1 ) - y_start;
+
+} // FUNCTION : FFT_Pencil_GetLayout_K
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_GetRank
+// Description :  Return the MPI rank owning the x row (y,z) in the x-pencil layout of the FFT size N[]
+//-------------------------------------------------------------------------------------------------------
+int FFT_Pencil_GetRank( const int N[], const int y, const int z )
+{
+
+   const int py = FFT_Pencil_BlockOwner( N[1], Pencil_NProc[0], y );
+   const int pz = FFT_Pencil_BlockOwner( N[2], Pencil_NProc[1], z );
+
+   return pz*Pencil_NProc[0] + py;
+
+} // FUNCTION : FFT_Pencil_GetRank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Periodic
+// Description :  Evaluate the gravitational potential by the pencil-decomposed FFT for the periodic BC
+//
+// Note        :  1. Same Green's function and normalization as FFT_Periodic() in CPU_PoissonSolver_FFT.cpp
+//                   --> Results agree with the slab decomposition to round-off errors
+//                2. Procedure:
+//                   x-pencil : real-to-complex FFT in x
+//                   --> Transpose_XY() --> y-pencil : complex FFT in y
+//                   --> Transpose_YZ() --> z-pencil : complex FFT in z, divide by -k^2, inverse FFT in z
+//                   --> Transpose_YZ() --> y-pencil : inverse FFT in y
+//                   --> Transpose_XY() --> x-pencil : complex-to-real FFT in x
+//
+// Parameter   :  RhoK      : x-pencil array [z][y][2*(N[0]/2+1)] storing the input density and output potential
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//                dh        : Cell size
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Periodic( real *RhoK, const real Poi_Coeff, const real dh )
+{
+
+   const int Nx  = Pencil_N[0];
+   const int Ny  = Pencil_N[1];
+   const int Nz  = Pencil_N[2];
+   const int Nxh = Nx/2 + 1;
+   const int py  = Pencil_Coord[0];
+   const int pz  = Pencil_Coord[1];
+
+   const int ny_x = FFT_Pencil_BlockStart( Ny,  Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( Ny,  Pencil_NProc[0], py );
+   const int nz_x = FFT_Pencil_BlockStart( Nz,  Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( Nz,  Pencil_NProc[1], pz );
+   const int kx0  = FFT_Pencil_BlockStart( Nxh, Pencil_NProc[0], py   );
+   const int nkx  = FFT_Pencil_BlockStart( Nxh, Pencil_NProc[0], py+1 ) - kx0;
+   const int y0_z = FFT_Pencil_BlockStart( Ny,  Pencil_NProc[1], pz   );
+   const int ny_z = FFT_Pencil_BlockStart( Ny,  Pencil_NProc[1], pz+1 ) - y0_z;
+
+   const int NRow_X = ny_x*nz_x;
+   const int NRow_Y = nkx*nz_x;
+   const int NRow_Z = nkx*ny_z;
+
+   fftw_complex *Cplx_X = (fftw_complex*)RhoK;
+   fftw_complex *Cplx_Y = new fftw_complex [ (long)NRow_Y*Ny + 1 ];
+   fftw_complex *Cplx_Z = new fftw_complex [ (long)NRow_Z*Nz + 1 ];
+   fftw_real    *HC     = new fftw_real    [ (long)NRow_X*Nx + 1 ];   // half-complex output of rfftw
+
+
+// 1-2. forward FFT in x, y, and z
+   Forward_XYZ( RhoK, Pencil_N, Pencil_Plan_X, Pencil_Plan_Y, Pencil_Plan_Z, Cplx_Y, Cplx_Z, HC );
+
+
+// 3. divide the Rho_K by -k^2
+   real *sinkx2 = new real [nkx];
+   real *sinky2 = new real [ny_z];
+   real *sinkz2 = new real [Nz];
+   real  k, Deno;
+
+   for (int i=0; i<nkx; i++) {   k         = 2.0*M_PI/Nx*(kx0+i);
+                                 sinkx2[i] = SQR(  SIN( (real)0.5*k )  );   }
+   for (int j=0; j<ny_z; j++){   const int jj = y0_z + j;
+                                 k         = ( jj <= Ny/2 ) ? 2.0*M_PI/Ny*jj : 2.0*M_PI/Ny*(jj-Ny);
+                                 sinky2[j] = SQR(  SIN( (real)0.5*k )  );   }
+   for (int kk=0; kk<Nz; kk++) { k         = ( kk <= Nz/2 ) ? 2.0*M_PI/Nz*kk : 2.0*M_PI/Nz*(kk-Nz);
+                                 sinkz2[kk]= SQR(  SIN( (real)0.5*k )  );   }
+
+   for (int i=0; i<nkx;  i++)
+   for (int j=0; j<ny_z; j++)
+   for (int kk=0; kk<Nz; kk++)
+   {
+      const long ID = ( (long)i*ny_z + j )*Nz + kk;
+
+//    this form is more consistent with the "second-order discrete" Laplacian operator
+      Deno = -4.0 * ( sinkx2[i] + sinky2[j] + sinkz2[kk] );
+
+//    remove the DC mode
+      if ( Deno == 0.0 )
+      {
+         Cplx_Z[ID].re = 0.0;
+         Cplx_Z[ID].im = 0.0;
+      }
+
+      else
+      {
+         Cplx_Z[ID].re = Cplx_Z[ID].re * Poi_Coeff / Deno;
+         Cplx_Z[ID].im = Cplx_Z[ID].im * Poi_Coeff / Deno;
+      }
+   }
+
+   delete [] sinkx2;
+   delete [] sinky2;
+   delete [] sinkz2;
+
+
+// 4. backward FFT in z and y
+   fftw( Pencil_Plan_Z_Inv, NRow_Z, Cplx_Z, 1, Nz, NULL, 0, 0 );
+   Transpose_YZ( Pencil_N, Cplx_Z, Cplx_Y, true );
+
+   fftw( Pencil_Plan_Y_Inv, NRow_Y, Cplx_Y, 1, Ny, NULL, 0, 0 );
+   Transpose_XY( Pencil_N, Cplx_Y, Cplx_X, true );
+
+
+// 5. backward FFT in x
+   for (int t=0; t<NRow_X; t++)
+   {
+      fftw_real          *HC_Row   = HC     + (long)t*Nx;
+      const fftw_complex *Cplx_Row = Cplx_X + (long)t*Nxh;
+
+      for (int i=0; i<Nxh; i++)
+      {
+         HC_Row[i] = Cplx_Row[i].re;
+         if ( i != 0  &&  2*i != Nx )  HC_Row[ Nx-i ] = Cplx_Row[i].im;
+      }
+   }
+
+   rfftw( Pencil_Plan_X_Inv, NRow_X, HC, 1, Nx, RhoK, 1, 2*Nxh );
+
+
+// 6. normalization
+   const real norm = dh*dh / ( (real)Nx*Ny*Nz );
+
+   for (int t=0; t<NRow_X; t++)
+   for (int i=0; i<Nx; i++)
+      RhoK[ (long)t*2*Nxh + i ] *= norm;
+
+
+   delete [] Cplx_Y;
+   delete [] Cplx_Z;
+   delete [] HC;
+
+} // FUNCTION : FFT_Pencil_Periodic
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Forward
+// Description :  Forward real-to-complex FFT of an x-pencil array by the pencil decomposition
+//
+// Note        :  1. FFT size N[] can differ from that passed to FFT_Pencil_Init() (e.g., the effective resolution
+//                   of a refined level for Aux_Record_LevelPowerSpectrum())
+//                   --> The process grid and sub-communicators are shared, while the 1D plans are created here
+//                       unless N[] matches the size of the Poisson solver
+//                2. RhoK is overwritten by the intermediate x-pencil complex data
+//                3. Returned z-pencil array [kx][y][z] must be freed by the caller
+//                   --> Use FFT_Pencil_GetLayout_K() to get its layout
+//                4. No normalization is applied
+//
+// Parameter   :  RhoK : x-pencil array [z][y][2*(N[0]/2+1)] storing the input real data
+//                N    : Size of the FFT operation
+//
+// Return      :  z-pencil complex array
+//-------------------------------------------------------------------------------------------------------
+fftw_complex* FFT_Pencil_Forward( real *RhoK, const int N[] )
+{
+
+   const int Nxh = N[0]/2 + 1;
+   const int py  = Pencil_Coord[0];
+   const int pz  = Pencil_Coord[1];
+
+   const int ny_x = FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py );
+   const int nz_x = FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz );
+   const int nkx  = FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], py );
+   const int ny_z = FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], pz );
+
+   const bool SameSize = ( N[0] == Pencil_N[0]  &&  N[1] == Pencil_N[1]  &&  N[2] == Pencil_N[2] );
+
+   rfftw_plan Plan_X;
+   fftw_plan  Plan_Y, Plan_Z;
+
+   if ( SameSize )
+   {
+      Plan_X = Pencil_Plan_X;
+      Plan_Y = Pencil_Plan_Y;
+      Plan_Z = Pencil_Plan_Z;
+   }
+
+   else
+   {
+      Plan_X = rfftw_create_plan( N[0], FFTW_REAL_TO_COMPLEX, FFTW_ESTIMATE );
+      Plan_Y = fftw_create_plan ( N[1], FFTW_FORWARD,         FFTW_ESTIMATE | FFTW_IN_PLACE );
+      Plan_Z = fftw_create_plan ( N[2], FFTW_FORWARD,         FFTW_ESTIMATE | FFTW_IN_PLACE );
+   }
+
+   fftw_complex *Cplx_Y = new fftw_complex [ (long)nkx*nz_x*N[1] + 1 ];
+   fftw_complex *Cplx_Z = new fftw_complex [ (long)nkx*ny_z*N[2] + 1 ];
+   fftw_real    *HC     = new fftw_real    [ (long)ny_x*nz_x*N[0] + 1 ];
+
+   Forward_XYZ( RhoK, N, Plan_X, Plan_Y, Plan_Z, Cplx_Y, Cplx_Z, HC );
+
+   delete [] Cplx_Y;
+   delete [] HC;
+
+   if ( !SameSize )
+   {
+      rfftw_destroy_plan( Plan_X );
+      fftw_destroy_plan ( Plan_Y );
+      fftw_destroy_plan ( Plan_Z );
+   }
+
+   return Cplx_Z;
+
+} // FUNCTION : FFT_Pencil_Forward
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Forward_XYZ
+// Description :  Forward FFT from the x-pencil real array to the z-pencil complex array
+//
+// Note        :  1. Shared by FFT_Pencil_Periodic() and FFT_Pencil_Forward()
+//                2. RhoK is overwritten by the x-pencil complex data [z][y][kx], and Cplx_Y stores the y-pencil data
+//
+// Parameter   :  RhoK   : x-pencil array [z][y][2*(N[0]/2+1)] storing the input real data
+//                N      : Size of the FFT operation
+//                Plan_X : 1D real-to-complex plan of size N[0]
+//                Plan_Y : 1D in-place complex plan of size N[1]
+//                Plan_Z : 1D in-place complex plan of size N[2]
+//                Cplx_Y : y-pencil work array
+//                Cplx_Z : z-pencil output array
+//                HC     : Work array for the half-complex output of rfftw
+//-------------------------------------------------------------------------------------------------------
+void Forward_XYZ( real *RhoK, const int N[], const rfftw_plan Plan_X, const fftw_plan Plan_Y, const fftw_plan Plan_Z,
+                  fftw_complex *Cplx_Y, fftw_complex *Cplx_Z, fftw_real *HC )
+{
+
+   const int Nx  = N[0];
+   const int Nxh = Nx/2 + 1;
+   const int py  = Pencil_Coord[0];
+   const int pz  = Pencil_Coord[1];
+
+   const int ny_x = FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( N[1], Pencil_NProc[0], py );
+   const int nz_x = FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz );
+   const int nkx  = FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( Nxh,  Pencil_NProc[0], py );
+   const int ny_z = FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( N[1], Pencil_NProc[1], pz );
+
+   const int NRow_X = ny_x*nz_x;
+   const int NRow_Y = nkx*nz_x;
+   const int NRow_Z = nkx*ny_z;
+
+   fftw_complex *Cplx_X = (fftw_complex*)RhoK;
+
+
+// 1. forward FFT in x
+// --> convert the half-complex output ( r0, r1, r2, ..., r(n/2), i((n+1)/2-1), ..., i2, i1 ) to complex numbers
+   rfftw( Plan_X, NRow_X, RhoK, 1, 2*Nxh, HC, 1, Nx );
+
+   for (int t=0; t<NRow_X; t++)
+   {
+      const fftw_real *HC_Row   = HC     + (long)t*Nx;
+      fftw_complex    *Cplx_Row = Cplx_X + (long)t*Nxh;
+
+      for (int i=0; i<Nxh; i++)
+      {
+         Cplx_Row[i].re = HC_Row[i];
+         Cplx_Row[i].im = ( i == 0  ||  2*i == Nx ) ? (fftw_real)0.0 : HC_Row[ Nx-i ];
+      }
+   }
+
+
+// 2. forward FFT in y and z
+   Transpose_XY( N, Cplx_X, Cplx_Y, false );
+   fftw( Plan_Y, NRow_Y, Cplx_Y, 1, N[1], NULL, 0, 0 );
+
+   Transpose_YZ( N, Cplx_Y, Cplx_Z, false );
+   fftw( Plan_Z, NRow_Z, Cplx_Z, 1, N[2], NULL, 0, 0 );
+
+} // FUNCTION : Forward_XYZ
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Transpose_XY
+// Description :  x-pencil [z][y][kx] <--> y-pencil [z][kx][y] within the row communicator
+//
+// Parameter   :  N       : Size of the FFT operation
+//                In      : Input array
+//                Out     : Output array
+//                Inverse : false/true --> x-pencil to y-pencil / y-pencil to x-pencil
+//-------------------------------------------------------------------------------------------------------
+void Transpose_XY( const int N[], const fftw_complex *In, fftw_complex *Out, const bool Inverse )
+{
+
+   const int  Ny    = N[1];
+   const int  Nxh   = N[0]/2 + 1;
+   const int  NProc = Pencil_NProc[0];
+   const int  py    = Pencil_Coord[0];
+   const int  pz    = Pencil_Coord[1];
+   const int  nz    = FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz+1 ) - FFT_Pencil_BlockStart( N[2], Pencil_NProc[1], pz );
+   const int  ny_x  = FFT_Pencil_BlockStart( Ny,  NProc, py+1 ) - FFT_Pencil_BlockStart( Ny,  NProc, py );
+   const int  nkx   = FFT_Pencil_BlockStart( Nxh, NProc, py+1 ) - FFT_Pencil_BlockStart( Nxh, NProc, py );
+   const long NData = (long)nz*MAX( ny_x*Nxh, nkx*Ny );
+
+   long *Count_X = new long [NProc];   // number of complex numbers exchanged by the x-pencil side with each rank
+   long *Count_Y = new long [NProc];   // number of complex numbers exchanged by the y-pencil side with each rank
+
+   for (int q=0; q<NProc; q++)
+   {
+      Count_X[q] = (long)nz*ny_x*( FFT_Pencil_BlockStart( Nxh, NProc, q+1 ) - FFT_Pencil_BlockStart( Nxh, NProc, q ) );
+      Count_Y[q] = (long)nz*nkx *( FFT_Pencil_BlockStart( Ny,  NProc, q+1 ) - FFT_Pencil_BlockStart( Ny,  NProc, q ) );
+   }
+
+   fftw_complex *SendBuf = new fftw_complex [ NData + 1 ];
+   fftw_complex *RecvBuf = new fftw_complex [ NData + 1 ];
+   long t = 0;
+
+
+// x-pencil --> y-pencil
+   if ( !Inverse )
+   {
+      for (int q=0; q<NProc; q++)
+      {
+         const int kx0_q = FFT_Pencil_BlockStart( Nxh, NProc, q   );
+         const int kx1_q = FFT_Pencil_BlockStart( Nxh, NProc, q+1 );
+
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_x; j++)
+         for (int i=kx0_q; i<kx1_q; i++)
+            SendBuf[ t ++ ] = In[ ( (long)k*ny_x + j )*Nxh + i ];
+      }
+
+      Alltoallv_Complex( SendBuf, Count_X, RecvBuf, Count_Y, NProc, Pencil_Comm_Row );
+
+      t = 0;
+      for (int q=0; q<NProc; q++)
+      {
+         const int y0_q = FFT_Pencil_BlockStart( Ny, NProc, q   );
+         const int y1_q = FFT_Pencil_BlockStart( Ny, NProc, q+1 );
+
+         for (int k=0; k<nz; k++)
+         for (int j=y0_q; j<y1_q; j++)
+         for (int i=0; i<nkx; i++)
+            Out[ ( (long)k*nkx + i )*Ny + j ] = RecvBuf[ t ++ ];
+      }
+   }
+
+// y-pencil --> x-pencil
+   else
+   {
+      for (int q=0; q<NProc; q++)
+      {
+         const int y0_q = FFT_Pencil_BlockStart( Ny, NProc, q   );
+         const int y1_q = FFT_Pencil_BlockStart( Ny, NProc, q+1 );
+
+         for (int k=0; k<nz; k++)
+         for (int j=y0_q; j<y1_q; j++)
+         for (int i=0; i<nkx; i++)
+            SendBuf[ t ++ ] = In[ ( (long)k*nkx + i )*Ny + j ];
+      }
+
+      Alltoallv_Complex( SendBuf, Count_Y, RecvBuf, Count_X, NProc, Pencil_Comm_Row );
+
+      t = 0;
+      for (int q=0; q<NProc; q++)
+      {
+         const int kx0_q = FFT_Pencil_BlockStart( Nxh, NProc, q   );
+         const int kx1_q = FFT_Pencil_BlockStart( Nxh, NProc, q+1 );
+
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_x; j++)
+         for (int i=kx0_q; i<kx1_q; i++)
+            Out[ ( (long)k*ny_x + j )*Nxh + i ] = RecvBuf[ t ++ ];
+      }
+   }
+
+
+   delete [] Count_X;
+   delete [] Count_Y;
+   delete [] SendBuf;
+   delete [] RecvBuf;
+
+} // FUNCTION : Transpose_XY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Transpose_YZ
+// Description :  y-pencil [z][kx][y] <--> z-pencil [kx][y][z] within the column communicator
+//
+// Parameter   :  N       : Size of the FFT operation
+//                In      : Input array
+//                Out     : Output array
+//                Inverse : false/true --> y-pencil to z-pencil / z-pencil to y-pencil
+//-------------------------------------------------------------------------------------------------------
+void Transpose_YZ( const int N[], const fftw_complex *In, fftw_complex *Out, const bool Inverse )
+{
+
+   const int  Ny    = N[1];
+   const int  Nz    = N[2];
+   const int  Nxh   = N[0]/2 + 1;
+   const int  NProc = Pencil_NProc[1];
+   const int  py    = Pencil_Coord[0];
+   const int  pz    = Pencil_Coord[1];
+   const int  nkx   = FFT_Pencil_BlockStart( Nxh, Pencil_NProc[0], py+1 ) - FFT_Pencil_BlockStart( Nxh, Pencil_NProc[0], py );
+   const int  nz_y  = FFT_Pencil_BlockStart( Nz, NProc, pz+1 ) - FFT_Pencil_BlockStart( Nz, NProc, pz );
+   const int  ny_z  = FFT_Pencil_BlockStart( Ny, NProc, pz+1 ) - FFT_Pencil_BlockStart( Ny, NProc, pz );
+   const long NData = (long)nkx*MAX( nz_y*Ny, ny_z*Nz );
+
+   long *Count_Y = new long [NProc];   // number of complex numbers exchanged by the y-pencil side with each rank
+   long *Count_Z = new long [NProc];   // number of complex numbers exchanged by the z-pencil side with each rank
+
+   for (int q=0; q<NProc; q++)
+   {
+      Count_Y[q] = (long)nkx*nz_y*( FFT_Pencil_BlockStart( Ny, NProc, q+1 ) - FFT_Pencil_BlockStart( Ny, NProc, q ) );
+      Count_Z[q] = (long)nkx*ny_z*( FFT_Pencil_BlockStart( Nz, NProc, q+1 ) - FFT_Pencil_BlockStart( Nz, NProc, q ) );
+   }
+
+   fftw_complex *SendBuf = new fftw_complex [ NData + 1 ];
+   fftw_complex *RecvBuf = new fftw_complex [ NData + 1 ];
+   long t = 0;
+
+
+// y-pencil --> z-pencil
+   if ( !Inverse )
+   {
+      for (int q=0; q<NProc; q++)
+      {
+         const int y0_q = FFT_Pencil_BlockStart( Ny, NProc, q   );
+         const int y1_q = FFT_Pencil_BlockStart( Ny, NProc, q+1 );
+
+         for (int k=0; k<nz_y; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=y0_q; j<y1_q; j++)
+            SendBuf[ t ++ ] = In[ ( (long)k*nkx + i )*Ny + j ];
+      }
+
+      Alltoallv_Complex( SendBuf, Count_Y, RecvBuf, Count_Z, NProc, Pencil_Comm_Col );
+
+      t = 0;
+      for (int q=0; q<NProc; q++)
+      {
+         const int z0_q = FFT_Pencil_BlockStart( Nz, NProc, q   );
+         const int z1_q = FFT_Pencil_BlockStart( Nz, NProc, q+1 );
+
+         for (int k=z0_q; k<z1_q; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=0; j<ny_z; j++)
+            Out[ ( (long)i*ny_z + j )*Nz + k ] = RecvBuf[ t ++ ];
+      }
+   }
+
+// z-pencil --> y-pencil
+   else
+   {
+      for (int q=0; q<NProc; q++)
+      {
+         const int z0_q = FFT_Pencil_BlockStart( Nz, NProc, q   );
+         const int z1_q = FFT_Pencil_BlockStart( Nz, NProc, q+1 );
+
+         for (int k=z0_q; k<z1_q; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=0; j<ny_z; j++)
+            SendBuf[ t ++ ] = In[ ( (long)i*ny_z + j )*Nz + k ];
+      }
+
+      Alltoallv_Complex( SendBuf, Count_Z, RecvBuf, Count_Y, NProc, Pencil_Comm_Col );
+
+      t = 0;
+      for (int q=0; q<NProc; q++)
+      {
+         const int y0_q = FFT_Pencil_BlockStart( Ny, NProc, q   );
+         const int y1_q = FFT_Pencil_BlockStart( Ny, NProc, q+1 );
+
+         for (int k=0; k<nz_y; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=y0_q; j<y1_q; j++)
+            Out[ ( (long)k*nkx + i )*Ny + j ] = RecvBuf[ t ++ ];
+      }
+   }
+
+
+   delete [] Count_Y;
+   delete [] Count_Z;
+   delete [] SendBuf;
+   delete [] RecvBuf;
+
+} // FUNCTION : Transpose_YZ
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Alltoallv_Complex
+// Description :  MPI_Alltoallv() of complex numbers stored contiguously in the order of the destination rank
+//
+// Parameter   :  SendBuf   : Send buffer
+//                SendCount : Number of complex numbers sent to each rank
+//                RecvBuf   : Recv buffer
+//                RecvCount : Number of complex numbers received from each rank
+//                NProc     : Number of ranks in Comm
+//                Comm      : Target communicator
+//-------------------------------------------------------------------------------------------------------
+void Alltoallv_Complex( fftw_complex *SendBuf, const long *SendCount, fftw_complex *RecvBuf, const long *RecvCount,
+                        const int NProc, const MPI_Comm Comm )
+{
+
+#  ifdef FLOAT8
+   const MPI_Datatype RealType = MPI_DOUBLE;
+#  else
+   const MPI_Datatype RealType = MPI_FLOAT;
+#  endif
+
+   int *Send_Count = new int [NProc];
+   int *Send_Disp  = new int [NProc];
+   int *Recv_Count = new int [NProc];
+   int *Recv_Disp  = new int [NProc];
+
+   long Send_Disp_Long = 0, Recv_Disp_Long = 0;
+
+   for (int q=0; q<NProc; q++)
+   {
+      if ( 2*( Send_Disp_Long + SendCount[q] ) > __INT_MAX__  ||  2*( Recv_Disp_Long + RecvCount[q] ) > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "pencil FFT transpose buffer exceeds the maximum integer --> use more MPI ranks !!\n" );
+
+      Send_Count[q] = 2*SendCount[q];
+      Recv_Count[q] = 2*RecvCount[q];
+      Send_Disp [q] = 2*Send_Disp_Long;
+      Recv_Disp [q] = 2*Recv_Disp_Long;
+
+      Send_Disp_Long += SendCount[q];
+      Recv_Disp_Long += RecvCount[q];
+   }
+
+   MPI_Alltoallv( SendBuf, Send_Count, Send_Disp, RealType, RecvBuf, Recv_Count, Recv_Disp, RealType, Comm );
+
+   delete [] Send_Count;
+   delete [] Send_Disp;
+   delete [] Recv_Count;
+   delete [] Recv_Disp;
+
+} // FUNCTION : Alltoallv_Complex
+
+
+
+#endif // #if ( defined GRAVITY  &&  !defined SERIAL )
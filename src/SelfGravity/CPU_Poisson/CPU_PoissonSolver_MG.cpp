@@ -23,11 +23,13 @@ static void Prolongate_and_Correct( const real *CData_1D, real *FData_1D, const
 // Function    :  CPU_PoissonSolver_MG
 // Description :  Use CPU to solve the Poisson equation by the multigrid scheme
 //
-// Note        :  Reference : Numerical Recipes, Chapter 20.6
+// Note        :  1. Reference : Numerical Recipes, Chapter 20.6
+//                2. For WarmStart, the patch interior of the initial guess is taken from Pot_Array_Out, which must
+//                   be filled by Poi_Prepare_WarmStart() in advance
 //
 // Parameter   :  Rho_Array         : Array to store the input density 
 //                Pot_Array_In      : Array to store the input "coarse-grid" potential for interpolation
-//                Pot_Array_Out     : Array to store the output potential
+//                Pot_Array_Out     : Array to store the output potential (and the initial guess for WarmStart)
 //                NPatchGroup       : Number of patch groups evaluated at a time
 //                dh_Min            : Grid size of the input data
 //                Max_Iter          : Maximum number of iterations for multigrid
@@ -39,13 +41,15 @@ static void Prolongate_and_Correct( const real *CData_1D, real *FData_1D, const
 //                                    --> currently supported schemes include
 //                                        INT_CQUAD : conservative quadratic interpolation 
 //                                        INT_QUAD  : quadratic interpolation 
+//                WarmStart         : Use the potential stored in Pot_Array_Out as the initial guess of the patch interior
+//                NIter_Sum         : Number of V-cycles summed over all patches (NULL --> do not count)
 //-------------------------------------------------------------------------------------------------------
 void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
                            const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                  real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                            const int NPatchGroup, const real dh_Min, const int Max_Iter, const int NPre_Smooth,
                            const int NPost_Smooth, const real Tolerated_Error, const real Poi_Coeff,
-                           const IntScheme_t IntScheme )
+                           const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum )
 {
 
    const int  NPatch    = NPatchGroup*8;
@@ -84,7 +88,9 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
    }
 
 
-#  pragma omp parallel
+   long NIter_All = 0;
+
+#  pragma omp parallel reduction( +:NIter_All )
    {
       int ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, Iter, x, y, z, Count, Idx;
       real Slope_x, Slope_y, Slope_z, C2_Slope[13], Error;
@@ -261,6 +267,20 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
                Sol[0][ Count ++ ] = Pot_Array_Int[k][j][i];
          }
 
+//       replace the patch interior by the previous potential for the warm start
+         if ( WarmStart )
+         {
+            real (*Sol_3D)[RHO_NXT+2][RHO_NXT+2] = ( real(*)[RHO_NXT+2][RHO_NXT+2] )Sol[0];
+
+            for (int k=GRA_GHOST_SIZE; k<GRA_GHOST_SIZE+PS1; k++)    {  K = k + POT_GHOST_SIZE - GRA_GHOST_SIZE;
+            for (int j=GRA_GHOST_SIZE; j<GRA_GHOST_SIZE+PS1; j++)    {  J = j + POT_GHOST_SIZE - GRA_GHOST_SIZE;
+            for (int i=GRA_GHOST_SIZE; i<GRA_GHOST_SIZE+PS1; i++)    {  I = i + POT_GHOST_SIZE - GRA_GHOST_SIZE;
+
+               Sol_3D[K][J][I] = Pot_Array_Out[P][k][j][i];
+
+            }}}
+         }
+
          for (int k=0; k<RHO_NXT; k++)    {  kp = k + 1;
          for (int j=0; j<RHO_NXT; j++)    {  jp = j + 1;
          for (int i=0; i<RHO_NXT; i++)    {  ip = i + 1;
@@ -331,6 +351,8 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
             Aux_Message( stderr, "(error = %13.7e)\n", Error );
          }
 
+         NIter_All += Iter;
+
 
 //       d. copy data : Sol[0] --> Pot_Array_Out
 // ------------------------------------------------------------------------------------------------------------
@@ -361,6 +383,9 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
 
    } // OpenMP parallel region
 
+
+   if ( NIter_Sum != NULL )   *NIter_Sum += NIter_All;
+
 } // FUNCTION : CPU_PoissonSolver_MG
 
 
@@ -17,26 +17,35 @@
 //
 // Note        :  1. Reference : Numerical Recipes, Chapter 20.5
 //                2. Typically, the number of iterations required to reach round-off errors is 20 ~ 25 (single precision)
+//                3. For WarmStart, the patch interior of the initial guess is taken from Pot_Array_Out, which must
+//                   be filled by Poi_Prepare_WarmStart() in advance
+//                   --> The ghost zones are still interpolated from the coarse-grid potential and serve as the B.C.
 //
 // Parameter   :  Rho_Array      : Array to store the input density
 //                Pot_Array_In   : Array to store the input "coarse-grid" potential for interpolation
-//                Pot_Array_Out  : Array to store the output potential
+//                Pot_Array_Out  : Array to store the output potential (and the initial guess for WarmStart)
 //                NPatchGroup    : Number of patch groups evaluated at a time
 //                dh             : Grid size
 //                Min_Iter       : Minimum # of iterations for SOR
 //                Max_Iter       : Maximum # of iterations for SOR
 //                Omega          : Over-relaxation parameter
+//                Tolerated_Error: Terminate the iteration once the 1-norm of the residual relative to that of the
+//                                 source term drops below it (even if Iter < Min_Iter)
+//                                 --> Disabled if <= 0.0
 //                Poi_Coeff      : Coefficient in front of the RHS in the Poisson eq.
 //                IntScheme      : Interpolation scheme for potential
 //                                 --> currently supported schemes include
 //                                     INT_CQUAD : conservative quadratic interpolation
 //                                     INT_QUAD  : quadratic interpolation
+//                WarmStart      : Use the potential stored in Pot_Array_Out as the initial guess of the patch interior
+//                NIter_Sum      : Number of iterations summed over all patches (NULL --> do not count)
 //-------------------------------------------------------------------------------------------------------
 void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
                             const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                   real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                             const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
-                            const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme )
+                            const real Omega, const real Tolerated_Error, const real Poi_Coeff,
+                            const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum )
 {
 
    const int  NPatch    = NPatchGroup*8;
@@ -47,12 +56,15 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
    const real Const_512 = (real)1.0/(real)512.0;
    const real Mp[3]     = { (real)-3.0/32.0, (real)+30.0/32.0, (real)+5.0/32.0 };
    const real Mm[3]     = { (real)+5.0/32.0, (real)+30.0/32.0, (real)-3.0/32.0 };
+   const int  Disp_Out  = POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;   // index displacement: Pot_Array_Out --> Pot_Array_Int
 
-#  pragma omp parallel
+   long NIter_All = 0;
+
+#  pragma omp parallel reduction( +:NIter_All )
    {
       int i_start, i_start_pass, i_start_k;     // i_start_(pass,k) : record the i_start in the (pass,k) loop
       int ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, Iter, x, y, z;
-      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual;
+      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual, Source_Total;
 
 //    array to store the interpolated "fine-grid" potential (as the initial guess and the B.C.)
       real (*Pot_Array_Int)[POT_NXT_INT][POT_NXT_INT] = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT];
@@ -195,9 +207,32 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
          } // switch ( IntScheme )
 
 
+//       replace the patch interior by the previous potential for the warm start
+         if ( WarmStart )
+         {
+            for (int k=GRA_GHOST_SIZE; k<GRA_GHOST_SIZE+PS1; k++)    {  K = k + Disp_Out;
+            for (int j=GRA_GHOST_SIZE; j<GRA_GHOST_SIZE+PS1; j++)    {  J = j + Disp_Out;
+            for (int i=GRA_GHOST_SIZE; i<GRA_GHOST_SIZE+PS1; i++)    {  I = i + Disp_Out;
+
+               Pot_Array_Int[K][J][I] = Pot_Array_Out[P][k][j][i];
+
+            }}}
+         }
+
+
 
 //       b. use the SOR scheme to evaluate potential (store in the Pot_Array_Int array)
 // ------------------------------------------------------------------------------------------------------------
+//       1-norm of the source term for the convergence criterion
+         Source_Total = (real)0.0;
+
+         if ( Tolerated_Error > (real)0.0 )
+         {
+            for (int k=0; k<RHO_NXT; k++)
+            for (int j=0; j<RHO_NXT; j++)
+            for (int i=0; i<RHO_NXT; i++)    Source_Total += FABS( Const*Rho_Array[P][k][j][i] );
+         }
+
          Residual_Total_Old = __FLT_MAX__;
 
          for (Iter=0; Iter<Max_Iter; Iter++)
@@ -256,6 +291,13 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
             } // for (int pass=0; pass<2; pass++)
 
 
+//          terminate the SOR iteration if the total residual is small enough
+            if ( Tolerated_Error > (real)0.0  &&  Residual_Total <= Tolerated_Error*Source_Total )
+            {
+               Iter++;
+               break;
+            }
+
 //          terminate the SOR iteration if the total residual begins to grow
 //          we set the minimum number of iterations because usually the total residual will grow at the first step
             if (  Iter+1 >= Min_Iter  &&  Residual_Total > Residual_Total_Old )
@@ -273,12 +315,14 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
             Aux_Message( stderr, "WARNING : Rank = %2d, Patch %6d exceeds Max_Iter in the SOR iteration !!\n",
                          MPI_Rank, P );
 
+         NIter_All += Iter;
+
 
 //       c. copy data : Pot_Array_Int --> Pot_Array_Out
 // ------------------------------------------------------------------------------------------------------------
-         for (int k=0; k<GRA_NXT; k++)    {  K = k + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
-         for (int j=0; j<GRA_NXT; j++)    {  J = j + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
-         for (int i=0; i<GRA_NXT; i++)    {  I = i + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+         for (int k=0; k<GRA_NXT; k++)    {  K = k + Disp_Out;
+         for (int j=0; j<GRA_NXT; j++)    {  J = j + Disp_Out;
+         for (int i=0; i<GRA_NXT; i++)    {  I = i + Disp_Out;
 
             Pot_Array_Out[P][k][j][i] = Pot_Array_Int[K][J][I];
 
@@ -291,6 +335,9 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
    } // OpenMP parallel region
 
+
+   if ( NIter_Sum != NULL )   *NIter_Sum += NIter_All;
+
 } // FUNCTION : CPU_PoissonSolver_SOR
 
 
@@ -20,11 +20,21 @@ extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const dou
 // Note        :  1. Poisson solver : lv = 0 : invoke CPU_PoissonSolver_FFT()
 //                                    lv > 0 : invoke InvokeSolver()
 //                2. Gravity solver : invoke InvokeSolver()
+//                   --> The Poisson and Gravity solvers at lv > 0 are invoked separately when POT_LEVEL_NSWEEP > 0
+//                       so that Poi_LevelRelax() can be applied in between
+//                   --> They are also invoked separately at lv > 0 when OverlapMPI is on, for which the Poisson solver
+//                       first advances the patch groups whose potential must be sent to other ranks, then exchanges
+//                       their potential by LB_GetBufferData_Start/Finish() while advancing the remaining patch groups,
+//                       and finally the Gravity solver advances all patch groups with the complete buffer patches
+//                       --> Overlap_Sync is ignored in this case
 //                3. The updated potential and fluid variables will be stored in the same sandglass
 //                4. PotSg at lv=0 will be updated here, but PotSg at at lv>0 and FluSg at lv>=0 will NOT be updated
 //                   (they will be updated in EvolveLevel instead)
 //                   --> It is because the lv-0 Poisson and Gravity solvers are invoked separately, and Gravity solver
 //                       needs to call Prepare_PatchData to get the updated potential
+//                5. The Gravity solver is skipped for OPT__USG_FUSE_EXT_ACC since the fluid solver has already
+//                   applied the external acceleration
+//                   --> Flu_ResetByUser_API_Ptr() and the FluSg update at lv=0 are still done here
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -72,6 +82,14 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 #  endif
 
 
+// skip the Gravity solver if the external acceleration has been applied by the fluid solver
+#  ifdef UNSPLIT_GRAVITY
+   const bool GraSolver = Gravity  &&  !OPT__USG_FUSE_EXT_ACC;
+#  else
+   const bool GraSolver = Gravity;
+#  endif
+
+
 // initialize the particle density array (rho_ext) and collect particles to the target level
 #  ifdef PARTICLE
    const bool TimingSendPar_Yes = Timing;
@@ -88,7 +106,7 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 
    if ( Poisson )
    {
-      TIMING_FUNC(   Prepare_PatchData_InitParticleDensityArray( lv ),
+      TIMING_FUNC(   Prepare_PatchData_InitParticleDensityArray( lv, PredictPos, TimeNew ),
                      Timer_Par_Collect[lv],   Timing   );
 
       TIMING_FUNC(   Par_CollectParticle2OneLevel( lv, PredictPos, TimeNew, SibBufPatch, FaSibBufPatch,
@@ -128,6 +146,7 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 //                                    OverlapMPI, Overlap_Sync ),
 //                      Timer_Gra_Advance[lv],   Timing  );
 
+         if ( GraSolver )
          TIMING_FUNC(   InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
                                       false, false ),
                         Timer_Gra_Advance[lv],   Timing   );
@@ -155,11 +174,50 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 
    else // lv > 0
    {
-      if      (  Poisson  &&  !Gravity )
+//    invoke the Poisson and Gravity solvers separately for the level-wide relaxation since the Gravity solver
+//    must see the relaxed potential
+//    --> also for OverlapMPI since the Gravity solver must wait for the potential of the buffer patches
+      const bool LevelRelax = ( Poisson  &&  POT_LEVEL_NSWEEP > 0 );
+
+      if      (  Poisson  &&  ( !Gravity || LevelRelax || OverlapMPI )  )
+      {
+         if ( OverlapMPI )
+         {
+#           ifdef LOAD_BALANCE
+//          advance patches whose potential needs to be sent
+            InvokeSolver( POISSON_SOLVER,          lv, TimeNew, TimeOld, NULL_REAL, Poi_Coeff, NULL_INT,   NULL_INT, SaveSg_Pot,
+                          true, true );
+
+//          transfer their potential while advancing patches not needed to be sent
+//          --> the Poisson solver only accesses the coarse-grid potential and the density at lv, neither of which
+//              is affected by the transfer
+            LB_GetBufferData_Start ( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf );
+
+            InvokeSolver( POISSON_SOLVER,          lv, TimeNew, TimeOld, NULL_REAL, Poi_Coeff, NULL_INT,   NULL_INT, SaveSg_Pot,
+                          true, false );
+
+            LB_GetBufferData_Finish( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf );
+
+//          allow the Gravity solver to locate the updated potential
+            amr->PotSgTime[lv][SaveSg_Pot] = TimeNew;
+#           else
+            Aux_Error( ERROR_INFO, "MPI overlapping is NOT supported if LOAD_BALANCE is off !!\n" );
+#           endif
+         }
+
+         else
          InvokeSolver( POISSON_SOLVER,             lv, TimeNew, TimeOld, NULL_REAL, Poi_Coeff, NULL_INT,   NULL_INT, SaveSg_Pot,
-                       OverlapMPI, Overlap_Sync );
+                       false, false );
+
+         if ( LevelRelax )
+         Poi_LevelRelax( lv, TimeNew, Poi_Coeff, SaveSg_Pot );
+
+         if ( Gravity )
+         InvokeSolver( GRAVITY_SOLVER,             lv, TimeNew, TimeOld, dt,        NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
+                       false, false );
+      }
 
-      else if ( !Poisson  &&   Gravity )
+      else if ( !Poisson  &&   GraSolver )
          InvokeSolver( GRAVITY_SOLVER,             lv, TimeNew, TimeOld, dt,        NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
                        OverlapMPI, Overlap_Sync );
 
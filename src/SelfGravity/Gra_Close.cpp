@@ -50,6 +50,8 @@ void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_N
 
 //       for the dual-energy formalism only
 #        ifdef DUAL_ENERGY
+         char DE_Uniform = h_DE_Array_G[N][0][0][0];
+
          for (int k=0; k<PATCH_SIZE; k++)
          for (int j=0; j<PATCH_SIZE; j++)
          for (int i=0; i<PATCH_SIZE; i++)
@@ -57,6 +59,8 @@ void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_N
 //          update the dual-energy status (which is always stored in Sg=0)
             amr->patch[0][lv][PID]->de_status[k][j][i] = h_DE_Array_G[N][k][j][i];
 
+            if ( h_DE_Array_G[N][k][j][i] != DE_Uniform )   DE_Uniform = DE_STATUS_MIXED;
+
 //          correct the dual-energy variable to be consistent with the updated internal energy
 //          --> only necessary for cells with the dual-energy status labelled as DE_UPDATED_BY_ETOT_GRA
 //              since for all other cases we fix the internal energy in the gravity solver
@@ -83,6 +87,8 @@ void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_N
             }
 #           endif // #ifdef UNSPLIT_GRAVITY
          } // i,j,k
+
+         amr->patch[0][lv][PID]->de_uniform = DE_Uniform;
 #        endif // #ifdef DUAL_ENERGY
 
 #        elif ( MODEL == ELBDM )
@@ -45,7 +45,12 @@ void Gra_Prepare_Flu( const int lv, real h_Flu_Array_G[][GRA_NIN][PS1][PS1][PS1]
             h_Flu_Array_G[N][v][k][j][i] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
 
 //       dual-energy status (which is always stored in Sg=0)
+//       --> use memset() for patches with a uniform status
 #        ifdef DUAL_ENERGY
+         if ( amr->patch[0][lv][PID]->de_uniform != DE_STATUS_MIXED )
+            memset( h_DE_Array_G[N], amr->patch[0][lv][PID]->de_uniform, CUBE(PS1)*sizeof(char) );
+
+         else
          for (int k=0; k<PS1; k++)
          for (int j=0; j<PS1; j++)
          for (int i=0; i<PS1; i++)
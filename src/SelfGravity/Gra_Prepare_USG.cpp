@@ -16,6 +16,8 @@
 //                   --> Data at the **current** time-step should already be prepared by the original Gravity solver
 //                3. Still need "PrepTime" to determine whether temporal interpolation is required for the
 //                   **Lv=lv-1** data
+//                4. Potential is copied from pot_ext[] directly when OPT__USG_POT_EXT is on and pot_ext[] is
+//                   applicable (see Poi_PotExtSg())
 //
 // Parameter   :  lv                : Target refinement level
 //                PrepTime          : Target physical time to prepare the coarse-grid data
@@ -36,9 +38,18 @@ void Gra_Prepare_USG( const int lv, const double PrepTime,
 
 // prepare potential
    if ( OPT__GRAVITY_TYPE == GRAVITY_SELF  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH )
-   Prepare_PatchData( lv, PrepTime, &h_Pot_Array_USG_G[0][0][0][0], NULL, USG_GHOST_SIZE_G, NPG, PID0_List,
-                      _POTE, _NONE, OPT__GRA_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_06, IntPhase_No,
-                      OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+   {
+#     ifdef STORE_POT_GHOST
+      const int PotExtSg = Poi_PotExtSg( lv, PrepTime, USG_GHOST_SIZE_G, NPG, PID0_List );
+
+      if ( PotExtSg != -1 )
+      Poi_Prepare_PotExt( lv, PotExtSg, &h_Pot_Array_USG_G[0][0][0][0], USG_GHOST_SIZE_G, NPG, PID0_List, UNIT_PATCH );
+      else
+#     endif
+      Prepare_PatchData( lv, PrepTime, &h_Pot_Array_USG_G[0][0][0][0], NULL, USG_GHOST_SIZE_G, NPG, PID0_List,
+                         _POTE, _NONE, OPT__GRA_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_06, IntPhase_No,
+                         OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+   }
 
 // prepare density + momentum
 // --> we do not check minimum density here since no ghost zones are required
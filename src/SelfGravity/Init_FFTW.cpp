@@ -10,12 +10,29 @@ rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;    // PS : plan for cal
 rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;
 #endif
 
+// slab decomposition of FFTW_Plan and the workspace with fixed sizes shared by CPU_PoissonSolver_FFT() and
+// Output_BasePowerSpectrum() (for the periodic BC where FFTW_Plan_PS == FFTW_Plan)
+int   FFTW_local_nz, FFTW_local_z_start, FFTW_local_ny_after_transpose, FFTW_local_y_start_after_transpose;
+int   FFTW_total_local_size, FFTW_NRecvSlice;
+int  *FFTW_List_z_start = NULL;  // starting z coordinate of each rank --> [MPI_NRank+1]
+real *FFTW_RhoK         = NULL;  // in-place FFT array --> [FFTW_total_local_size]
+real *FFTW_RecvBuf      = NULL;  // MPI recv buffer of density/potential --> [NX0_TOT[0]*NX0_TOT[1]*FFTW_NRecvSlice]
+long *FFTW_RecvBuf_SIdx = NULL;  // MPI recv buffer of 1D coordinate in slab --> [NX0_TOT[0]*NX0_TOT[1]*FFTW_NRecvSlice/SQR(PS1)]
+
+// power spectrum binned by the base-level Poisson solver for Output_BasePowerSpectrum() --> [NX0_TOT[0]/2+1]
+double *FFTW_PS_Local = NULL;
+long   *FFTW_PS_Count = NULL;
+
 
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_FFTW
 // Description :  Create the FFTW plans 
+//
+// Note        :  1. Also record the slab decomposition of FFTW_Plan and allocate the workspace with fixed sizes
+//                   shared by CPU_PoissonSolver_FFT() and Output_BasePowerSpectrum()
+//                   --> Avoid reallocating the slab-sized arrays in every base-level Poisson solve
 //-------------------------------------------------------------------------------------------------------
 void Init_FFTW()
 {
@@ -72,6 +89,52 @@ void Init_FFTW()
       FFTW_Plan_PS = FFTW_Plan;
 
 
+// record the slab decomposition of FFTW_Plan and allocate the shared workspace
+#  ifdef SERIAL
+   FFTW_local_nz                      = FFT_Size[2];
+   FFTW_local_z_start                 = 0;
+   FFTW_local_ny_after_transpose      = NULL_INT;
+   FFTW_local_y_start_after_transpose = NULL_INT;
+   FFTW_total_local_size              = 2*(FFT_Size[0]/2+1)*FFT_Size[1]*FFT_Size[2];
+#  else
+   rfftwnd_mpi_local_sizes( FFTW_Plan, &FFTW_local_nz, &FFTW_local_z_start, &FFTW_local_ny_after_transpose,
+                            &FFTW_local_y_start_after_transpose, &FFTW_total_local_size );
+#  endif
+
+   int *List_nz = new int [MPI_NRank];
+   FFTW_List_z_start = new int [MPI_NRank+1];
+
+   MPI_Allgather( &FFTW_local_nz, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
+
+   FFTW_List_z_start[0] = 0;
+   for (int r=0; r<MPI_NRank; r++)  FFTW_List_z_start[r+1] = FFTW_List_z_start[r] + List_nz[r];
+
+   if ( FFTW_List_z_start[MPI_NRank] != FFT_Size[2] )
+      Aux_Error( ERROR_INFO, "FFTW_List_z_start[%d] (%d) != expectation (%d) !!\n",
+                 MPI_NRank, FFTW_List_z_start[MPI_NRank], FFT_Size[2] );
+
+   delete [] List_nz;
+
+// exclude the zero-padding regions, where no data need to be exchanged
+   FFTW_NRecvSlice = MIN( FFTW_List_z_start[MPI_Rank]+FFTW_local_nz, NX0_TOT[2] ) - MIN( FFTW_List_z_start[MPI_Rank], NX0_TOT[2] );
+
+   FFTW_RhoK         = new real [ FFTW_total_local_size ];
+   FFTW_RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*FFTW_NRecvSlice ];
+   FFTW_RecvBuf_SIdx = new long [ (long)NX0_TOT[0]*NX0_TOT[1]*FFTW_NRecvSlice/SQR(PS1) ];
+
+   if ( OPT__OUTPUT_BASEPS  &&  OPT__BC_POT == BC_POT_PERIODIC )
+   {
+      FFTW_PS_Local = new double [ NX0_TOT[0]/2+1 ];
+      FFTW_PS_Count = new long   [ NX0_TOT[0]/2+1 ];
+   }
+
+
+// create the pencil decomposition for the self-gravity solver
+#  ifndef SERIAL
+   if ( OPT__FFT_PENCIL )  FFT_Pencil_Init( FFT_Size );
+#  endif
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" ); 
 
 } // FUNCTION : Init_FFTW
@@ -80,7 +143,7 @@ void Init_FFTW()
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  End_FFTW
-// Description :  Delete the FFTW plans 
+// Description :  Delete the FFTW plans and free the workspace allocated by Init_FFTW()
 //-------------------------------------------------------------------------------------------------------
 void End_FFTW()
 {
@@ -99,8 +162,18 @@ void End_FFTW()
 
    rfftwnd_mpi_destroy_plan( FFTW_Plan     );
    rfftwnd_mpi_destroy_plan( FFTW_Plan_Inv );
+
+   if ( OPT__FFT_PENCIL )
+   FFT_Pencil_End();
 #  endif
 
+   delete [] FFTW_List_z_start;  FFTW_List_z_start = NULL;
+   delete [] FFTW_RhoK;          FFTW_RhoK         = NULL;
+   delete [] FFTW_RecvBuf;       FFTW_RecvBuf      = NULL;
+   delete [] FFTW_RecvBuf_SIdx;  FFTW_RecvBuf_SIdx = NULL;
+   delete [] FFTW_PS_Local;      FFTW_PS_Local     = NULL;
+   delete [] FFTW_PS_Count;      FFTW_PS_Count     = NULL;
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_FFTW
@@ -8,6 +8,26 @@ extern rfftwnd_plan     FFTW_Plan;
 extern rfftwnd_mpi_plan FFTW_Plan;
 #endif
 
+// header of the Green's function cache file for OPT__GFUNC_CACHE
+// --> followed by the number of elements on each rank (long[NRank]) and then the data of all ranks in order
+#define GFUNC_CACHE_MAGIC     0x4746554B
+
+struct GFuncCacheHeader_t
+{
+   int    Magic;           // GFUNC_CACHE_MAGIC after the file is complete and 0 while it is being written
+   int    FFT_Size[3];
+   int    NRank;
+   int    SizeofReal;
+   double Coeff0;
+   double NewtonG;
+   double dh0;
+};
+
+static void GetCacheFileName( char *FileName, const int FFT_Size[] );
+static bool LoadGreenFuncK( const int FFT_Size[], const long LocalSize );
+static void SaveGreenFuncK( const int FFT_Size[], const long LocalSize );
+static void SetCacheHeader( GFuncCacheHeader_t &Header, const int FFT_Size[] );
+
 
 
 
@@ -18,6 +38,10 @@ extern rfftwnd_mpi_plan FFTW_Plan;
 // Note        :  1. We only need to calculate it once during the initialization stage
 //                2. The zero-padding method is implemented
 //                3. Slab decomposition is assumed in FFTW
+//                4. OPT__GFUNC_CACHE: load the k-space Green's function from the cache file written by the previous
+//                   run with the same grid size, number of ranks, GFUNC_COEFF0, NEWTON_G, and floating-point precision
+//                   --> Recompute and overwrite the cache file if it does not exist or any of them differs
+//                   --> Each rank reads and writes its own slab of the shared file concurrently
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -62,6 +86,13 @@ void Init_GreenFuncK()
 
    GreenFuncK = new real [ total_local_size ];
 
+   if ( OPT__GFUNC_CACHE  &&  LoadGreenFuncK( FFT_Size, total_local_size ) )
+   {
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done (loaded from the cache)\n", __FUNCTION__ );
+
+      return;
+   }
+
    for (int k=0; k<local_nz; k++)   {  kk = k + local_z_start;
                                        z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
    for (int j=0; j<local_ny; j++)   {  y  = ( j  <= NX0_TOT[1] ) ? j *dh0 : (FFT_Size[1]-j )*dh0;
@@ -88,10 +119,222 @@ void Init_GreenFuncK()
 #  endif
 
 
+// 5. store the Green's function for the next run
+   if ( OPT__GFUNC_CACHE )   SaveGreenFuncK( FFT_Size, total_local_size );
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : Init_GreenFuncK
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetCacheFileName
+// Description :  Return the name of the Green's function cache file, which is keyed by the base-level grid size and
+//                the number of MPI ranks (i.e., the slab decomposition)
+//
+// Parameter   :  FileName : Output file name
+//                FFT_Size : Size of the zero-padded FFT
+//-------------------------------------------------------------------------------------------------------
+void GetCacheFileName( char *FileName, const int FFT_Size[] )
+{
+
+   sprintf( FileName, "GreenFuncK_%dx%dx%d_NRank%d", FFT_Size[0]/2, FFT_Size[1]/2, FFT_Size[2]/2, MPI_NRank );
+
+} // FUNCTION : GetCacheFileName
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCacheHeader
+// Description :  Set the header of the Green's function cache file for the current run
+//
+// Parameter   :  Header   : Header to be set
+//                FFT_Size : Size of the zero-padded FFT
+//-------------------------------------------------------------------------------------------------------
+void SetCacheHeader( GFuncCacheHeader_t &Header, const int FFT_Size[] )
+{
+
+   memset( &Header, 0, sizeof(GFuncCacheHeader_t) );
+
+   Header.Magic      = GFUNC_CACHE_MAGIC;
+   for (int d=0; d<3; d++)
+   Header.FFT_Size[d] = FFT_Size[d];
+   Header.NRank      = MPI_NRank;
+   Header.SizeofReal = sizeof(real);
+   Header.Coeff0     = GFUNC_COEFF0;
+   Header.NewtonG    = NEWTON_G;
+   Header.dh0        = amr->dh[0];
+
+} // FUNCTION : SetCacheHeader
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadGreenFuncK
+// Description :  Load the k-space Green's function of this rank from the cache file
+//
+// Note        :  1. All ranks must succeed, or the Green's function is recomputed by all ranks since the FFT is
+//                   collective
+//                2. The number of elements of all ranks is compared to validate the slab decomposition
+//
+// Parameter   :  FFT_Size  : Size of the zero-padded FFT
+//                LocalSize : Number of elements on this rank
+//
+// Return      :  true  --> GreenFuncK[] is loaded
+//                false --> cache is missing or does not apply
+//-------------------------------------------------------------------------------------------------------
+bool LoadGreenFuncK( const int FFT_Size[], const long LocalSize )
+{
+
+   char FileName[MAX_STRING];
+   GetCacheFileName( FileName, FFT_Size );
+
+   GFuncCacheHeader_t Header_Expect, Header;
+   SetCacheHeader( Header_Expect, FFT_Size );
+
+   long *LocalSize_AllRank = new long [MPI_NRank];
+   long *LocalSize_File    = new long [MPI_NRank];
+
+   MPI_Allgather( &LocalSize, 1, MPI_LONG, LocalSize_AllRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   int   Success = false;
+   FILE *File    = ( Aux_CheckFileExist(FileName) ) ? fopen( FileName, "rb" ) : NULL;
+
+   if ( File != NULL )
+   {
+      if (  fread( &Header, sizeof(GFuncCacheHeader_t), 1, File ) == 1  &&
+            memcmp( &Header, &Header_Expect, sizeof(GFuncCacheHeader_t) ) == 0  &&
+            fread( LocalSize_File, sizeof(long), MPI_NRank, File ) == (size_t)MPI_NRank  &&
+            memcmp( LocalSize_File, LocalSize_AllRank, MPI_NRank*sizeof(long) ) == 0  )
+      {
+         long Offset = sizeof(GFuncCacheHeader_t) + MPI_NRank*sizeof(long);
+
+         for (int r=0; r<MPI_Rank; r++)   Offset += LocalSize_AllRank[r]*sizeof(real);
+
+         if (  fseek( File, Offset, SEEK_SET ) == 0  &&
+               fread( GreenFuncK, sizeof(real), LocalSize, File ) == (size_t)LocalSize  )
+            Success = true;
+      }
+
+      fclose( File );
+   }
+
+   delete [] LocalSize_AllRank;
+   delete [] LocalSize_File;
+
+   int Success_AllRank;
+   MPI_Allreduce( &Success, &Success_AllRank, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+
+   if ( !Success_AllRank  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "   Cache file \"%s\" does not exist or does not apply --> recompute it\n", FileName );
+
+   return Success_AllRank;
+
+} // FUNCTION : LoadGreenFuncK
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SaveGreenFuncK
+// Description :  Store the k-space Green's function of all ranks in the cache file
+//
+// Note        :  1. Rank 0 creates the file with an invalid header, all ranks then write their own data at the
+//                   corresponding offset, and finally rank 0 validates the header
+//                   --> An incomplete file left by an interrupted run is never loaded
+//                2. Failing to write the cache is not fatal
+//
+// Parameter   :  FFT_Size  : Size of the zero-padded FFT
+//                LocalSize : Number of elements on this rank
+//-------------------------------------------------------------------------------------------------------
+void SaveGreenFuncK( const int FFT_Size[], const long LocalSize )
+{
+
+   char FileName[MAX_STRING];
+   GetCacheFileName( FileName, FFT_Size );
+
+   GFuncCacheHeader_t Header;
+   SetCacheHeader( Header, FFT_Size );
+
+   long *LocalSize_AllRank = new long [MPI_NRank];
+
+   MPI_Allgather( &LocalSize, 1, MPI_LONG, LocalSize_AllRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+
+// 1. create the file with an invalid header
+   int Created = false;
+
+   if ( MPI_Rank == 0 )
+   {
+      FILE *File = fopen( FileName, "wb" );
+
+      if ( File != NULL )
+      {
+         const int Magic = Header.Magic;
+
+         Header.Magic = 0;
+         fwrite( &Header, sizeof(GFuncCacheHeader_t), 1, File );
+         fwrite( LocalSize_AllRank, sizeof(long), MPI_NRank, File );
+         Header.Magic = Magic;
+
+         fclose( File );
+         Created = true;
+      }
+   }
+
+   MPI_Bcast( &Created, 1, MPI_INT, 0, MPI_COMM_WORLD );
+
+   if ( !Created )
+   {
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : cannot create the Green's function cache file \"%s\" !!\n", FileName );
+
+      delete [] LocalSize_AllRank;
+      return;
+   }
+
+
+// 2. write the data of all ranks concurrently
+   long Offset = sizeof(GFuncCacheHeader_t) + MPI_NRank*sizeof(long);
+
+   for (int r=0; r<MPI_Rank; r++)   Offset += LocalSize_AllRank[r]*sizeof(real);
+
+   int   Success = false;
+   FILE *File    = fopen( FileName, "r+b" );
+
+   if ( File != NULL )
+   {
+      if (  fseek( File, Offset, SEEK_SET ) == 0  &&
+            fwrite( GreenFuncK, sizeof(real), LocalSize, File ) == (size_t)LocalSize  )
+         Success = true;
+
+      if ( fclose( File ) != 0 )    Success = false;
+   }
+
+   int Success_AllRank;
+   MPI_Allreduce( &Success, &Success_AllRank, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+
+
+// 3. validate the header
+   if ( MPI_Rank == 0 )
+   {
+      File = ( Success_AllRank ) ? fopen( FileName, "r+b" ) : NULL;
+
+      if ( File != NULL )
+      {
+         fwrite( &Header, sizeof(GFuncCacheHeader_t), 1, File );
+         fclose( File );
+      }
+
+      else
+         Aux_Message( stderr, "WARNING : failed to write the Green's function cache file \"%s\" !!\n", FileName );
+   }
+
+   delete [] LocalSize_AllRank;
+
+} // FUNCTION : SaveGreenFuncK
+
+
+
 #endif // #ifdef GRAVITY
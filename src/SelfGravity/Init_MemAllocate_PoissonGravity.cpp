@@ -43,6 +43,28 @@ void Init_MemAllocate_PoissonGravity( const int Pot_NPG )
       h_Pot_Array_T    [t] = new real   [Pot_NP][ CUBE(GRA_NXT) ];
    }
 
+
+// record the memory consumption for Aux_GetMemInfo()
+   long HostSize = Pot_NP*( sizeof(*h_Rho_Array_P[0]) + sizeof(*h_Pot_Array_P_In[0]) + sizeof(*h_Pot_Array_P_Out[0])
+                          + sizeof(*h_Flu_Array_G[0]) + sizeof(*h_Pot_Array_T[0]) );
+
+#  ifdef UNSPLIT_GRAVITY
+   HostSize += Pot_NP*( sizeof(*h_Pot_Array_USG_G[0]) + sizeof(*h_Flu_Array_USG_G[0]) );
+#  endif
+
+   if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
+   HostSize += Pot_NP*sizeof(*h_Corner_Array_G[0]);
+
+#  ifdef DUAL_ENERGY
+   HostSize += Pot_NP*sizeof(*h_DE_Array_G[0]);
+#  endif
+
+#  ifdef MHD
+   HostSize += Pot_NP*sizeof(*h_Emag_Array_G[0]);
+#  endif
+
+   Aux_GetMemInfo_AddSolver( 2*HostSize );
+
 } // FUNCTION : Init_MemAllocate_PoissonGravity
 
 
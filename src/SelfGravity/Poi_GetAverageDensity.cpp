@@ -19,9 +19,10 @@ extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, c
 //             :  2. For the Poisson solver with the isolated BC in the comoving frames, the UNITY will be
 //                   subtracted from the total density at each cell when solving the Poisson equation at
 //                   all levels in order to be consistent with the Poisson eq. in the comoving frame
-//                3. For bitwise reproducibility (i.e., when BITWISE_REPRODUCIBILITY is enabled), we perform
-//                   summation in a deterministic order to ensure that the round-off errors will be the same
-//                   in runs with different numbers of MPI ranks
+//                3. For bitwise reproducibility (i.e., when BITWISE_REPRODUCIBILITY is enabled), we use
+//                   Mis_ReproducibleSum() to ensure that the round-off errors will be the same in runs with
+//                   different numbers of MPI ranks
+//                   --> No need to gather and sort all patches and particles on one rank
 //                4. Include both the fluid and particles's mass
 //
 // Parameter   :  None
@@ -53,42 +54,13 @@ void Poi_GetAverageDensity()
 // ==================================================================================================
 #  ifdef BITWISE_REPRODUCIBILITY
 
-// only use rank 0 for summation in the debug mode
-   const int NP[3]  = { NX0_TOT[0]/PATCH_SIZE, NX0_TOT[1]/PATCH_SIZE, NX0_TOT[2]/PATCH_SIZE };
-   const int PScale = PATCH_SIZE * amr->scale[0];
+// sum up the density of each patch in a fixed order and then sum over all patches by Mis_ReproducibleSum(),
+// whose result is independent of the summation order and the number of MPI ranks
+   double *Rho_Local = new double [ amr->NPatchComma[0][1] ];
 
-//###NOTE : actually "int" is enoughly for Cr1D_Local and Cr1D_All. If they do need "long" or "ulong", then
-//          at least Cr1D_IdxTable and other looping indices will need "long or ulong" as well since base-level
-//          patches fill the entire box
-   int     Cr3D[3], NPatch_All[MPI_NRank], Disp[MPI_NRank];
-   int     NPatch_Sum    = 0;
-   double *Rho_All       = NULL;
-   long   *Cr1D_All      = NULL;
-   int    *Cr1D_IdxTable = NULL;
-   double *Rho_Local     = new double [ amr->NPatchComma[0][1] ];
-   long   *Cr1D_Local    = new long   [ amr->NPatchComma[0][1] ];
-
-   MPI_Gather( &amr->NPatchComma[0][1], 1, MPI_INT, NPatch_All, 1, MPI_INT, 0, MPI_COMM_WORLD );
-
-   if ( MPI_Rank == 0 )
-   {
-      for (int r=0; r<MPI_NRank; r++)  NPatch_Sum += NPatch_All[r];
-
-      Disp[0] = 0;
-      for (int r=1; r<MPI_NRank; r++)  Disp[r] = Disp[r-1] + NPatch_All[r-1];
-
-      Rho_All       = new double [NPatch_Sum];
-      Cr1D_All      = new long   [NPatch_Sum];
-      Cr1D_IdxTable = new int    [NPatch_Sum];
-   }
-
-// prepare density and 1D-corner arrays
    for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
    {
-      for (int d=0; d<3; d++)    Cr3D[d] = amr->patch[0][0][PID]->corner[d]/PScale;
-
-      Cr1D_Local[PID] = ( (long)Cr3D[2]*NP[1] + (long)Cr3D[1] )*NP[0] + (long)Cr3D[0];
-      Rho_Local [PID] = 0.0;
+      Rho_Local[PID] = 0.0;
 
       for (int k=0; k<PS1; k++)
       for (int j=0; j<PS1; j++)
@@ -113,88 +85,19 @@ void Poi_GetAverageDensity()
       }
    } // for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
 
-// gather data
-   MPI_Gatherv( Cr1D_Local, amr->NPatchComma[0][1], MPI_LONG,   Cr1D_All, NPatch_All, Disp, MPI_LONG,
-                0, MPI_COMM_WORLD );
-
-   MPI_Gatherv( Rho_Local,  amr->NPatchComma[0][1], MPI_DOUBLE, Rho_All,  NPatch_All, Disp, MPI_DOUBLE,
-                0, MPI_COMM_WORLD );
-
-   if ( MPI_Rank == 0 )
-   {
-//    sort
-      Mis_Heapsort( NPatch_Sum, Cr1D_All, Cr1D_IdxTable );
+   AveDensity_Init  = Mis_ReproducibleSum( amr->NPatchComma[0][1], Rho_Local, false );
+   AveDensity_Init /= (double)NX0_TOT[0]*NX0_TOT[1]*NX0_TOT[2];
 
-//    get average density
-      for (int t=0; t<NPatch_Sum; t++)    AveDensity_Init += Rho_All[ Cr1D_IdxTable[t] ];
-      AveDensity_Init /= (double)NX0_TOT[0]*NX0_TOT[1]*NX0_TOT[2];
-   }
+   delete [] Rho_Local;
 
 // add particle mass
+// --> skip inactive and massless particles
 #  ifdef PARTICLE
-   long    NPar_AcPlusInac_AllRank[MPI_NRank], NPar_AcPlusInac_Sum;
-   int     Count[MPI_NRank];
-   double  ParMassSum;
-   real   *ParMass_AllRank = NULL;
-
-// get the total number of active + inactive particles in each rank
-   MPI_Gather( &amr->Par->NPar_AcPlusInac, 1, MPI_LONG, NPar_AcPlusInac_AllRank, 1, MPI_LONG, 0, MPI_COMM_WORLD );
-
-   if ( MPI_Rank == 0 )
-   {
-      NPar_AcPlusInac_Sum = 0;
-      for (int r=0; r<MPI_NRank; r++)  NPar_AcPlusInac_Sum += NPar_AcPlusInac_AllRank[r];
+   const double ParMassSum = Mis_ReproducibleSum( amr->Par->NPar_AcPlusInac, amr->Par->Mass, true );
 
-      ParMass_AllRank = new real [NPar_AcPlusInac_Sum];
-
-//    here we have assumed that "integer" type is enough !!
-      for (int r=0; r<MPI_NRank; r++)  Count[r] = NPar_AcPlusInac_AllRank[r];
-
-      Disp[0] = 0;
-      for (int r=1; r<MPI_NRank; r++)  Disp[r] = Disp[r-1] + Count[r-1];
-   }
-
-// collect particle mass from all ranks
-#  ifdef FLOAT8
-   MPI_Gatherv( amr->Par->Mass, amr->Par->NPar_AcPlusInac, MPI_DOUBLE,
-                ParMass_AllRank, Count, Disp, MPI_DOUBLE, 0, MPI_COMM_WORLD );
-#  else
-   MPI_Gatherv( amr->Par->Mass, amr->Par->NPar_AcPlusInac, MPI_FLOAT,
-                ParMass_AllRank, Count, Disp, MPI_FLOAT,  0, MPI_COMM_WORLD );
+   AveDensity_Init += ParMassSum / ( amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2] );
 #  endif
 
-   if ( MPI_Rank == 0 )
-   {
-//    sort
-      Mis_Heapsort( NPar_AcPlusInac_Sum, ParMass_AllRank, NULL );
-
-//    add average particle density
-      ParMassSum = 0.0;
-      for (long p=0; p<NPar_AcPlusInac_Sum; p++)
-      {
-//       skip inactive and massless particles
-         if ( ParMass_AllRank[p] > (real)0.0 )  ParMassSum += (double)ParMass_AllRank[p];
-      }
-
-      AveDensity_Init += ParMassSum / ( amr->BoxSize[0]*amr->BoxSize[1]*amr->BoxSize[2] );
-
-      delete [] ParMass_AllRank;
-   }
-#  endif // #ifdef PARTICLE
-
-// broadcast
-   MPI_Bcast( &AveDensity_Init, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
-
-// free memory
-   delete [] Rho_Local;
-   delete [] Cr1D_Local;
-   if ( MPI_Rank == 0 )
-   {
-      delete [] Rho_All;
-      delete [] Cr1D_All;
-      delete [] Cr1D_IdxTable;
-   }
-
 
 // 2. for general cases
 // ==================================================================================================
@@ -0,0 +1,135 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_LevelRelax
+// Description :  Relax the potential over all patches at the target refined level as a whole
+//
+// Note        :  1. Invoked by Gra_AdvanceDt() after the patch-group Poisson solver when POT_LEVEL_NSWEEP > 0
+//                2. The patch-group solver only sees the coarse-grid potential as its Dirichlet boundary
+//                   condition, which leads to mismatches across adjacent patch groups. Here each sweep
+//                   (a) exchanges the potential of the buffer patches, (b) prepares the potential with one ghost
+//                   zone by Prepare_PatchData(), which takes sibling patches (on any rank) where available and
+//                   interpolates from lv-1 only at the coarse-fine interfaces, and (c) applies one red-black
+//                   Gauss-Seidel iteration to the interior of each patch
+//                   --> All patches at lv are thus coupled with each other following the actual AMR geometry
+//                3. The discretization is the same 7-point Laplacian adopted by the SOR and multigrid solvers
+//                4. PotSgTime[lv][SaveSg_Pot] is set to PrepTime so that Prepare_PatchData() can locate the
+//                   target sandglass
+//                5. The buffer patches (and pot_ext[] if STORE_POT_GHOST is on) are updated on return
+//
+// Parameter   :  lv         : Target refinement level (>0)
+//                PrepTime   : Target physical time of the potential
+//                Poi_Coeff  : Coefficient in front of the RHS in the Poisson eq.
+//                SaveSg_Pot : Sandglass storing the potential to be relaxed
+//-------------------------------------------------------------------------------------------------------
+void Poi_LevelRelax( const int lv, const double PrepTime, const double Poi_Coeff, const int SaveSg_Pot )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( lv == 0 )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+#  endif
+
+
+   const bool   IntPhase_No       = false;
+   const bool   DE_Consistency_No = false;
+   const real   MinDens_No        = -1.0;
+   const real   MinPres_No        = -1.0;
+   const int    NPG               = amr->NPatchComma[lv][1] / 8;
+   const int    NPG_Chunk         = MAX( 1, POT_GPU_NPGROUP );
+   const int    PotGhost          = 1;
+   const int    PotSize           = PS1 + 2*PotGhost;
+   const real   RhoCoeff          = Poi_Coeff*SQR( amr->dh[lv] );
+   const real   One_Six           = (real)1.0/(real)6.0;
+
+   int  *PID0_List = new int  [NPG];
+   real (*Rho)[PS1][PS1][PS1]                  = new real [8*NPG][PS1][PS1][PS1];
+   real (*Pot)[PotSize][PotSize][PotSize]       = new real [8*NPG][PotSize][PotSize][PotSize];
+   real (*Rho_Chunk)[RHO_NXT][RHO_NXT][RHO_NXT] = new real [8*NPG_Chunk][RHO_NXT][RHO_NXT][RHO_NXT];
+
+   for (int TID=0; TID<NPG; TID++)  PID0_List[TID] = 8*TID;
+
+   amr->PotSgTime[lv][SaveSg_Pot] = PrepTime;
+
+
+// 1. prepare the density (without ghost zones) once for all sweeps
+   for (int PG0=0; PG0<NPG; PG0+=NPG_Chunk)
+   {
+      const int NPG_Now = MIN( NPG_Chunk, NPG-PG0 );
+
+      Poi_Prepare_Rho( lv, PrepTime, Rho_Chunk, NPG_Now, PID0_List+PG0 );
+
+#     pragma omp parallel for schedule( static )
+      for (int P=0; P<8*NPG_Now; P++)
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+         Rho[ 8*PG0 + P ][k][j][i] = RhoCoeff*Rho_Chunk[P][ k+RHO_GHOST_SIZE ][ j+RHO_GHOST_SIZE ][ i+RHO_GHOST_SIZE ];
+   }
+
+
+// 2. level-wide sweeps
+   for (int Sweep=0; Sweep<POT_LEVEL_NSWEEP; Sweep++)
+   {
+//    2-1. collect the potential of the buffer patches
+      Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
+
+
+//    2-2. prepare the potential of all patches before updating any of them
+      for (int PG0=0; PG0<NPG; PG0+=NPG_Chunk)
+      {
+         const int NPG_Now = MIN( NPG_Chunk, NPG-PG0 );
+
+         Prepare_PatchData( lv, PrepTime, &Pot[8*PG0][0][0][0], NULL, PotGhost, NPG_Now, PID0_List+PG0, _POTE, _NONE,
+                            OPT__POT_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_06, IntPhase_No,
+                            OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+      }
+
+
+//    2-3. one red-black Gauss-Seidel iteration on each patch and store the results
+#     pragma omp parallel for schedule( static )
+      for (int P=0; P<8*NPG; P++)
+      {
+         for (int Color=0; Color<2; Color++)
+         for (int k=PotGhost; k<PS1+PotGhost; k++)
+         for (int j=PotGhost; j<PS1+PotGhost; j++)
+         for (int i=PotGhost+(j+k+Color)%2; i<PS1+PotGhost; i+=2)
+         {
+            Pot[P][k][j][i] = One_Six*(  Pot[P][k][j][i-1] + Pot[P][k][j][i+1] + Pot[P][k][j-1][i] + Pot[P][k][j+1][i]
+                                       + Pot[P][k-1][j][i] + Pot[P][k+1][j][i]
+                                       - Rho[P][k-PotGhost][j-PotGhost][i-PotGhost]  );
+         }
+
+         real (*PotPatch)[PS1][PS1] = amr->patch[SaveSg_Pot][lv][P]->pot;
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+            PotPatch[k][j][i] = Pot[P][ k+PotGhost ][ j+PotGhost ][ i+PotGhost ];
+      } // for (int P=0; P<8*NPG; P++)
+   } // for (int Sweep=0; Sweep<POT_LEVEL_NSWEEP; Sweep++)
+
+
+// 3. update the buffer patches and the potential with ghost zones
+   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
+
+#  ifdef STORE_POT_GHOST
+   Poi_StorePotWithGhostZone( lv, SaveSg_Pot, true );
+#  endif
+
+
+   delete [] PID0_List;
+   delete [] Rho;
+   delete [] Pot;
+   delete [] Rho_Chunk;
+
+} // FUNCTION : Poi_LevelRelax
+
+
+
+#endif // #ifdef GRAVITY
@@ -0,0 +1,138 @@
+#include "GAMER.h"
+
+#if ( defined GRAVITY  &&  defined STORE_POT_GHOST  &&  defined UNSPLIT_GRAVITY )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_PotExtSg
+// Description :  Return the potential sandglass whose pot_ext[] can replace Prepare_PatchData() for preparing
+//                the potential at the target time
+//
+// Note        :  1. Enabled by OPT__USG_POT_EXT
+//                2. pot_ext[] is filled by Poi_Close() right after the Poisson solver (or by
+//                   Poi_StorePotWithGhostZone()), and thus already holds the potential with GRA_GHOST_SIZE
+//                   ghost zones at PotSgTime[lv][PotSg]
+//                   --> No need to collect the potential from sibling and coarse-grid patches again
+//                3. Return -1 if pot_ext[] is not applicable, which includes
+//                   (a) the number of ghost zones required exceeds GRA_GHOST_SIZE
+//                   (b) neither sandglass matches PrepTime (i.e., temporal interpolation is required)
+//                   (c) any target patch has pot_ext[0][0][0] == POT_EXT_NEED_INIT
+//
+// Parameter   :  lv        : Target refinement level
+//                PrepTime  : Target physical time
+//                GhostSize : Number of ghost zones required
+//                NPG       : Number of patch groups prepared at a time
+//                PID0_List : List recording the patch indices with LocalID==0 to be udpated
+//
+// Return      :  Target sandglass (0/1) or -1
+//-------------------------------------------------------------------------------------------------------
+int Poi_PotExtSg( const int lv, const double PrepTime, const int GhostSize, const int NPG, const int *PID0_List )
+{
+
+   if ( !OPT__USG_POT_EXT  ||  GhostSize > GRA_GHOST_SIZE )  return -1;
+
+   int PotSg = -1;
+
+   for (int Sg=0; Sg<2; Sg++)
+   {
+      if (  Mis_CompareRealValue( PrepTime, amr->PotSgTime[lv][Sg], NULL, false )  )
+      {
+         PotSg = Sg;
+         break;
+      }
+   }
+
+   if ( PotSg == -1 )   return -1;
+
+   for (int TID=0; TID<NPG; TID++)
+   for (int PID=PID0_List[TID]; PID<PID0_List[TID]+8; PID++)
+      if ( amr->patch[PotSg][lv][PID]->pot_ext[0][0][0] == POT_EXT_NEED_INIT )   return -1;
+
+   return PotSg;
+
+} // FUNCTION : Poi_PotExtSg
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_Prepare_PotExt
+// Description :  Fill up the input potential array of the gravity/fluid solvers from pot_ext[]
+//
+// Note        :  1. Invoked by Gra_Prepare_USG() and Flu_Prepare() only if Poi_PotExtSg() returns a valid
+//                   sandglass
+//                2. Array layout is the same as Prepare_PatchData() with the same PrepUnit
+//                   --> UNIT_PATCH      : (PS1+2*GhostSize)^3 per patch
+//                       UNIT_PATCHGROUP : (PS2+2*GhostSize)^3 per patch group, where each cell is taken from the
+//                                         nearest local patch, whose pot_ext[] covers the ghost zones of the
+//                                         patch group as long as GhostSize <= GRA_GHOST_SIZE
+//
+// Parameter   :  lv        : Target refinement level
+//                PotSg     : Target potential sandglass returned by Poi_PotExtSg()
+//                h_Pot     : Host array to store the prepared potential
+//                GhostSize : Number of ghost zones to be prepared
+//                NPG       : Number of patch groups prepared at a time
+//                PID0_List : List recording the patch indices with LocalID==0 to be udpated
+//                PrepUnit  : UNIT_PATCH/UNIT_PATCHGROUP
+//-------------------------------------------------------------------------------------------------------
+void Poi_Prepare_PotExt( const int lv, const int PotSg, real *h_Pot, const int GhostSize, const int NPG,
+                         const int *PID0_List, const PrepUnit_t PrepUnit )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( GhostSize > GRA_GHOST_SIZE )
+      Aux_Error( ERROR_INFO, "GhostSize (%d) > GRA_GHOST_SIZE (%d) !!\n", GhostSize, GRA_GHOST_SIZE );
+
+   if ( PrepUnit != UNIT_PATCH  &&  PrepUnit != UNIT_PATCHGROUP )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "PrepUnit", PrepUnit );
+#  endif
+
+
+   const int Shift = GRA_GHOST_SIZE - GhostSize;
+
+   if ( PrepUnit == UNIT_PATCH )
+   {
+      const int PotSize = PS1 + 2*GhostSize;
+
+#     pragma omp parallel for schedule( runtime )
+      for (int TID=0; TID<NPG; TID++)
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID = PID0_List[TID] + LocalID;
+         const real (*PotExt)[GRA_NXT][GRA_NXT] = amr->patch[PotSg][lv][PID]->pot_ext;
+         real *Pot = h_Pot + (long)( 8*TID + LocalID )*CUBE( PotSize );
+
+         for (int k=0; k<PotSize; k++)
+         for (int j=0; j<PotSize; j++)
+            memcpy( Pot + ( k*PotSize + j )*PotSize, &PotExt[ k+Shift ][ j+Shift ][Shift], PotSize*sizeof(real) );
+      }
+   }
+
+   else // UNIT_PATCHGROUP
+   {
+      const int PotSize          = PS2 + 2*GhostSize;
+      const int LocalID[2][2][2] = { 0, 1, 2, 4, 3, 6, 5, 7 };
+
+#     pragma omp parallel for schedule( runtime )
+      for (int TID=0; TID<NPG; TID++)
+      {
+         real *Pot = h_Pot + (long)TID*CUBE( PotSize );
+         int  ii, jj, kk, PX, PY, PZ;
+
+         for (int k=0; k<PotSize; k++)  {  kk = k - GhostSize;  PZ = ( kk < PS1 ) ? 0 : 1;  kk += GRA_GHOST_SIZE - PZ*PS1;
+         for (int j=0; j<PotSize; j++)  {  jj = j - GhostSize;  PY = ( jj < PS1 ) ? 0 : 1;  jj += GRA_GHOST_SIZE - PY*PS1;
+         for (int i=0; i<PotSize; i++)  {  ii = i - GhostSize;  PX = ( ii < PS1 ) ? 0 : 1;  ii += GRA_GHOST_SIZE - PX*PS1;
+
+            Pot[ ( k*PotSize + j )*PotSize + i ] = amr->patch[PotSg][lv][ PID0_List[TID] + LocalID[PZ][PY][PX] ]->pot_ext[kk][jj][ii];
+
+         }}}
+      } // for (int TID=0; TID<NPG; TID++)
+   } // if ( PrepUnit == UNIT_PATCH ) ... else ...
+
+} // FUNCTION : Poi_Prepare_PotExt
+
+
+
+#endif // #if ( defined GRAVITY  &&  defined STORE_POT_GHOST  &&  defined UNSPLIT_GRAVITY )
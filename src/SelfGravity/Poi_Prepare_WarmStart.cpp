@@ -0,0 +1,83 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_UseWarmStart
+// Description :  Check whether the Poisson solver at the target level can be seeded with the potential of
+//                the previous step
+//
+// Note        :  1. Enabled by OPT__POT_WARM_START
+//                2. Only applicable when advancing the potential to a time later than the one stored in the
+//                   current sandglass
+//                   --> The stored potential may not be initialized yet when solving the Poisson equation at the
+//                       same time (e.g., during the initialization)
+//                3. The potential stored in the other sandglass is not used for temporal extrapolation since it
+//                   is not guaranteed to be valid for patches allocated after the previous update (e.g., by
+//                   refinement)
+//
+// Parameter   :  lv       : Target refinement level
+//                PrepTime : Target physical time of the Poisson solver
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool Poi_UseWarmStart( const int lv, const double PrepTime )
+{
+
+   if ( !OPT__POT_WARM_START  ||  lv == 0 )  return false;
+
+   const double PotTime = amr->PotSgTime[lv][ amr->PotSg[lv] ];
+
+   return (  PotTime >= 0.0  &&  PrepTime > PotTime  &&  !Mis_CompareRealValue( PrepTime, PotTime, NULL, false )  );
+
+} // FUNCTION : Poi_UseWarmStart
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_Prepare_WarmStart
+// Description :  Fill up the patch interior of h_Pot_Array_P_Out with the potential of the previous step as the
+//                initial guess of the Poisson solver
+//
+// Note        :  1. Invoked by InvokeSolver() only if Poi_UseWarmStart() returns true
+//                2. Ghost zones of h_Pot_Array_P_Out are not filled since they are always interpolated from the
+//                   coarse-grid potential by the Poisson solver
+//
+// Parameter   :  lv                : Target refinement level
+//                h_Pot_Array_P_Out : Host array to store the initial guess
+//                NPG               : Number of patch groups prepared at a time
+//                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
+//-------------------------------------------------------------------------------------------------------
+void Poi_Prepare_WarmStart( const int lv, real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                            const int NPG, const int *PID0_List )
+{
+
+   const int PotSg = amr->PotSg[lv];
+
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int PID0 = PID0_List[TID];
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int N   = 8*TID + LocalID;
+         const int PID = PID0 + LocalID;
+         const real (*Pot)[PS1][PS1] = amr->patch[PotSg][lv][PID]->pot;
+
+         for (int k=0, kk=GRA_GHOST_SIZE; k<PS1; k++, kk++)
+         for (int j=0, jj=GRA_GHOST_SIZE; j<PS1; j++, jj++)
+         for (int i=0, ii=GRA_GHOST_SIZE; i<PS1; i++, ii++)
+            h_Pot_Array_P_Out[N][kk][jj][ii] = Pot[k][j][i];
+      }
+   } // for (int TID=0; TID<NPG; TID++)
+
+} // FUNCTION : Poi_Prepare_WarmStart
+
+
+
+#endif // #ifdef GRAVITY
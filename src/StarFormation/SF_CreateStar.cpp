@@ -29,6 +29,10 @@ void SF_CreateStar( const int lv, const real TimeNew, const real dt )
    if ( lv < SF_CREATE_STAR_MIN_LEVEL )   return;
 
 
+// particles collected by Par_CollectParticle2OneLevel() no longer apply after creating new particles
+   Par_CollectParticle2OneLevel_InvalidateCache();
+
+
 // initialiez the random number generators the first time this function is called
    static bool FirstTime = true;
 
@@ -17,6 +17,14 @@
 //                3. One must invoke Buf_GetBufferData( ..., _TOTAL, ... ) after calling this function
 //                4. Currently this function does not check whether the cell mass exceeds the Jeans mass
 //                   --> Ref: "jeanmass" in star_maker_ssn.F of Enzo
+//                5. No OpenMP critical construct is used
+//                   --> New particles are first stored in the staging array of each thread and then added to the
+//                       particle repository and their home patches in parallel after assigning all IDs at once
+//                   --> With DetRandom, random numbers are reset for each patch and drawn in a fixed cell order,
+//                       so the new particles do not depend on the number of OpenMP threads
+//                   --> With DetRandom and RANDOM_NUMBER == RNG_PHILOX, random numbers are further keyed by
+//                       (time, patch, cell) using the stateless RandomNumber_t::GetValue_Counter(), so they also
+//                       do not depend on the order in which cells are examined
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Current physical time (after advancing solution by dt)
@@ -74,6 +82,17 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    const real   Eff_times_dt   = Efficiency*dt;
 // const real   GraConst       = ( OPT__GRA_P5_GRADIENT ) ? -1.0/(12.0*dh) : -1.0/(2.0*dh);
    const real   GraConst       = ( false                ) ? -1.0/(12.0*dh) : -1.0/(2.0*dh); // P5 is NOT supported yet
+   const int    NReal          = amr->NPatchComma[lv][1];
+
+
+// new particles are first collected in the staging array of each thread and then added to the particle repository
+// after the OpenMP parallel region, which avoids the OpenMP critical construct and fixes the order of particle IDs
+   int   *NNewPar_Patch    = new int  [NReal];   // number of new particles in each patch
+   int   *StageTID_Patch   = new int  [NReal];   // thread storing the new particles of each patch
+   long  *StageIdx_Patch   = new long [NReal];   // index of the first new particle of each patch in the staging array
+   real **Stage_Thread     = new real* [OMP_NTHREAD];
+
+   for (int t=0; t<OMP_NTHREAD; t++)   Stage_Thread[t] = NULL;
 
 
 // start of OpenMP parallel region
@@ -95,10 +114,18 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 #  endif
 
    const int MaxNewParPerPatch = CUBE(PS1);
-   real   (*NewParAtt)[PAR_NATT_TOTAL] = new real [MaxNewParPerPatch][PAR_NATT_TOTAL];
-   long    *NewParID                   = new long [MaxNewParPerPatch];
+   real   (*NewParAtt)[PAR_NATT_TOTAL] = NULL;
 
-   int NNewPar;
+   int  NNewPar;
+#  if ( RANDOM_NUMBER == RNG_PHILOX )
+   long RSeed_Time = NULL_INT;
+#  endif
+   real *Stage     = NULL;   // staging array of this thread with the layout [StageSize][PAR_NATT_TOTAL]
+   long  StageSize = 0;
+   long  NStage    = 0;
+   double Src[NCOMP_TOTAL];  // gas removed by this thread for OPT__RECORD_CONSERVATION
+
+   for (int v=0; v<NCOMP_TOTAL; v++)   Src[v] = 0.0;
 
 
 // loop over all real patches
@@ -106,8 +133,10 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 // --> bitwise reproducibility will still break when running with different numbers of OpenMP threads and/or MPI ranks
 //     unless both BITWISE_REPRODUCIBILITY and SF_CREATE_STAR_DET_RANDOM are enabled
 #  pragma omp for schedule( static )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   for (int PID=0; PID<NReal; PID++)
    {
+      NNewPar_Patch[PID] = 0;
+
 //    skip non-leaf patches
       if ( amr->patch[0][lv][PID]->son != -1 )  continue;
 
@@ -119,8 +148,12 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
       {
 //       the factor "1.0e6" in the end is just to make random seeds at different times more different, especially for
 //       extremely small time-step
+#        if ( RANDOM_NUMBER == RNG_PHILOX )
+         RSeed_Time = SF_CREATE_STAR_RSEED + long(TimeNew*UNIT_T/Const_yr*1.0e6);
+#        else
          const long RSeed = SF_CREATE_STAR_RSEED + amr->patch[0][lv][PID]->LB_Idx + long(TimeNew*UNIT_T/Const_yr*1.0e6);
          RNG->SetSeed( TID, RSeed );
+#        endif
       }
 
 
@@ -133,6 +166,15 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
       z0      = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
       NNewPar = 0;
 
+//    allocate enough memory in the staging array to store the new particles of this patch
+      if ( NStage + MaxNewParPerPatch > StageSize )
+      {
+         StageSize = MAX( NStage + MaxNewParPerPatch, (long)ceil(PARREPO_GROWTH_FACTOR*StageSize) );
+         Stage     = (real*)realloc( Stage, StageSize*PAR_NATT_TOTAL*sizeof(real) );
+      }
+
+      NewParAtt = ( real (*)[PAR_NATT_TOTAL] )( Stage + NStage*PAR_NATT_TOTAL );
+
       for (int k=0; k<PS1; k++)
       for (int j=0; j<PS1; j++)
       for (int i=0; i<PS1; i++)
@@ -166,7 +208,13 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
             const double Min = 0.0;
             const double Max = 1.0;
 
+#           if ( RANDOM_NUMBER == RNG_PHILOX )
+            double Random = ( DetRandom ) ? RandomNumber_t::GetValue_Counter( RSeed_Time, amr->patch[0][lv][PID]->LB_Idx,
+                                                                              (k*PS1 + j)*PS1 + i, Min, Max )
+                                          : RNG->GetValue( TID, Min, Max );
+#           else
             double Random = RNG->GetValue( TID, Min, Max );
+#           endif
 
             if ( (real)Random < StarMass*_MinStarMass )  StarMFrac = MinStarMass / GasMass;
             else                                         continue;
@@ -276,48 +324,101 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 //       ===========================================================================================================
          GasMFracLeft = (real)1.0 - StarMFrac;
 
+         if ( OPT__RECORD_CONSERVATION )
+         for (int v=0; v<NCOMP_TOTAL; v++)   Src[v] -= StarMFrac*fluid[v][k][j][i]*dv;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v][k][j][i] *= GasMFracLeft;
       } // i,j,k
 
 
 
-//    4. create new star particles
+//    4. record the new star particles of this patch in the staging array
 //    ===========================================================================================================
-//    use OpenMP critical construct since both amr->Par->AddOneParticle() and amr->patch[0][lv][PID]->AddParticle()
-//    will modify some global variables
-//    --> note that the order of which thread calls amr->Par->AddOneParticle() is nondeterministic and may change from run to run
-//        --> order of particles stored in the particle repository (i.e., their particle ID) may change from run to run
-//        --> particle text file may change from run to run since it's dumped according to the order of particle ID
-//    --> but it's not an issue since the actual data of each particle will not be affected
-#     pragma omp critical
-      {
-//       4-1. add particles to the particle repository
-         for (int p=0; p<NNewPar; p++)
-            NewParID[p] = amr->Par->AddOneParticle( NewParAtt[p] );
+      NNewPar_Patch [PID] = NNewPar;
+      StageTID_Patch[PID] = TID;
+      StageIdx_Patch[PID] = NStage;
 
+      NStage += NNewPar;
+   } // for (int PID=0; PID<NReal; PID++)
 
-//       4-2. add particles to the patch
-#        ifdef DEBUG_PARTICLE
-//       do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//       may change after calling amr->Par->AddOneParticle()
-         const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
-         char Comment[100];
-         sprintf( Comment, "%s", __FUNCTION__ );
+   Stage_Thread[TID] = Stage;
 
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv],
-                                              ParPos, amr->Par->NPar_AcPlusInac, Comment );
-#        else
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv] );
-#        endif
-      } // pragma omp critical
+// accumulate the gas removed by all threads for tracking the conserved variables incrementally
+   if ( OPT__RECORD_CONSERVATION )
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp atomic
+      Cons_Src[v] += Src[v];
+   }
+
+   } // end of OpenMP parallel region
+
+
+// 5. add the new star particles to the particle repository and their home patches
+// --> particle IDs are assigned patch by patch so that their order is independent of the number of OpenMP threads
+// --> the attributes and particle lists of different patches are then filled in parallel
+// 5-1. offset of the new particles of each patch
+   long *NewParOffset_Patch = new long [NReal+1];
+
+   NewParOffset_Patch[0] = 0;
+   for (int PID=0; PID<NReal; PID++)   NewParOffset_Patch[PID+1] = NewParOffset_Patch[PID] + NNewPar_Patch[PID];
+
+   const long NNewPar_Total = NewParOffset_Patch[NReal];
+
+
+// 5-2. allocate the IDs of all new particles at once
+   long *NewParID = new long [NNewPar_Total];
+
+   amr->Par->AllocateParticleIDs( NNewPar_Total, NewParID );
+
+
+// 5-3. set the particle attributes and add particles to their home patches
+// --> do not set the attribute pointers too early since they may change after calling AllocateParticleIDs()
+   real *ParAtt[PAR_NATT_TOTAL];
+   for (int v=0; v<PAR_NATT_TOTAL; v++)   ParAtt[v] = amr->Par->Attribute[v];
+
+   long NPar_Lv_Add = 0;
+
+#  pragma omp parallel for schedule( static ) reduction( +:NPar_Lv_Add )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const int NNewPar = NNewPar_Patch[PID];
+
+      if ( NNewPar == 0 )  continue;
+
+      const long *NewParID_Patch  = NewParID + NewParOffset_Patch[PID];
+      const real *NewParAtt_Patch = Stage_Thread[ StageTID_Patch[PID] ] + StageIdx_Patch[PID]*PAR_NATT_TOTAL;
+
+      for (int p=0; p<NNewPar; p++)
+      for (int v=0; v<PAR_NATT_TOTAL; v++)
+         ParAtt[v][ NewParID_Patch[p] ] = NewParAtt_Patch[ p*PAR_NATT_TOTAL + v ];
+
+#     ifdef DEBUG_PARTICLE
+      const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+      char Comment[100];
+      sprintf( Comment, "%s", __FUNCTION__ );
+
+      amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID_Patch, &NPar_Lv_Add,
+                                           ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#     else
+      amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID_Patch, &NPar_Lv_Add );
+#     endif
+
+      Par_UpdateDescendantCount( lv, PID, NNewPar );
+   } // for (int PID=0; PID<NReal; PID++)
+
+   amr->Par->NPar_Lv[lv] += NPar_Lv_Add;
 
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
 
 // free memory
-   delete [] NewParAtt;
-   delete [] NewParID;
+   for (int t=0; t<OMP_NTHREAD; t++)   free( Stage_Thread[t] );
 
-   } // end of OpenMP parallel region
+   delete [] NNewPar_Patch;
+   delete [] StageTID_Patch;
+   delete [] StageIdx_Patch;
+   delete [] Stage_Thread;
+   delete [] NewParOffset_Patch;
+   delete [] NewParID;
 
 
 // get the total number of active particles in all MPI ranks
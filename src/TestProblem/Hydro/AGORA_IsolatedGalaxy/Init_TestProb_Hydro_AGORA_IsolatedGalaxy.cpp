@@ -31,6 +31,7 @@ static double  AGORA_HaloGasDens;               // halo gas mass density
 static double  AGORA_HaloGasPres;               // halo gas pressure
 static double *AGORA_VcProf = NULL;             // circular velocity radial profile [radius, velocity]
 static int     AGORA_VcProf_NBin;               // number of radial bin in AGORA_VcProf
+static TableSpacing_t AGORA_VcProf_Spacing;     // radial spacing of AGORA_VcProf (for Mis_InterpolateFromTable_Uniform)
 // =======================================================================================
 
 
@@ -228,6 +229,8 @@ void SetParameter()
          Prof_R[b] *= Const_kpc / UNIT_L;
          Prof_V[b] *= Const_km  / UNIT_V;
       }
+
+      AGORA_VcProf_Spacing = Mis_CheckTableSpacing( AGORA_VcProf_NBin, Prof_R );
    }
 
 
@@ -337,7 +340,7 @@ void SetGridIC( real fluid[], const double x, const double y, const double z, co
       const double *Prof_R = AGORA_VcProf + 0*AGORA_VcProf_NBin;
       const double *Prof_V = AGORA_VcProf + 1*AGORA_VcProf_NBin;
 
-      if (  ( DiskGasVel = Mis_InterpolateFromTable(AGORA_VcProf_NBin, Prof_R, Prof_V, r) ) == NULL_REAL  )
+      if (  ( DiskGasVel = Mis_InterpolateFromTable_Uniform(AGORA_VcProf_NBin, Prof_R, Prof_V, r, AGORA_VcProf_Spacing) ) == NULL_REAL  )
          Aux_Error( ERROR_INFO, "interpolation failed at radius %13.7e !!\n", r );
 
       Dens  = DiskGasDens;
@@ -15,6 +15,11 @@ static double Blast_BField;        // magnetic field strength along the diagonal
 #endif
 // =======================================================================================
 
+#if ( MODEL == HYDRO )
+static void SetGridIC_Batch( real fluid[], const int NCell, const double x[], const double y[], const double z[],
+                             const double Time, const int lv, double AuxArray[] );
+#endif
+
 
 
 
@@ -208,6 +213,46 @@ void SetGridIC( real fluid[], const double x, const double y, const double z, co
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetGridIC_Batch
+// Description :  Batched version of SetGridIC() for multiple cells at once
+//
+// Note        :  1. Set to Init_Function_Batch_User_Ptr and invoked by Hydro_Init_ByFunction_AssignData()
+//                2. The total energy only takes two values, which are computed once
+//                   --> The remaining loop over cells can be vectorized
+//
+// Parameter   :  fluid    : Fluid field to be initialized with the layout [NCOMP_TOTAL][NCell]
+//                NCell    : Number of target cells
+//                x/y/z    : Physical coordinates of each cell
+//                Others   : See SetGridIC()
+//
+// Return      :  fluid
+//-------------------------------------------------------------------------------------------------------
+void SetGridIC_Batch( real fluid[], const int NCell, const double x[], const double y[], const double z[],
+                      const double Time, const int lv, double AuxArray[] )
+{
+
+// same operations as SetGridIC()
+   const real Eint_Exp = EoS_DensPres2Eint_CPUPtr( Blast_Dens_Bg, Blast_Pres_Exp, NULL, EoS_AuxArray );
+   const real Eint_Bg  = EoS_DensPres2Eint_CPUPtr( Blast_Dens_Bg, Blast_Pres_Bg,  NULL, EoS_AuxArray );
+   const real Etot_Exp = Hydro_ConEint2Etot( Blast_Dens_Bg, 0.0, 0.0, 0.0, Eint_Exp, 0.0 );
+   const real Etot_Bg  = Hydro_ConEint2Etot( Blast_Dens_Bg, 0.0, 0.0, 0.0, Eint_Bg,  0.0 );
+
+   for (int t=0; t<NCell; t++)
+   {
+      const double r = SQRT( SQR(x[t]-Blast_Center[0]) + SQR(y[t]-Blast_Center[1]) + SQR(z[t]-Blast_Center[2]) );
+
+      fluid[ DENS*NCell + t ] = Blast_Dens_Bg;
+      fluid[ MOMX*NCell + t ] = 0.0;
+      fluid[ MOMY*NCell + t ] = 0.0;
+      fluid[ MOMZ*NCell + t ] = 0.0;
+      fluid[ ENGY*NCell + t ] = ( r <= Blast_Radius ) ? Etot_Exp : Etot_Bg;
+   }
+
+} // FUNCTION : SetGridIC_Batch
+
+
+
 #ifdef MHD
 //-------------------------------------------------------------------------------------------------------
 // Function    :  SetBFieldIC
@@ -266,6 +311,7 @@ void Init_TestProb_Hydro_BlastWave()
 
 // set the function pointers of various problem-specific routines
    Init_Function_User_Ptr        = SetGridIC;
+   Init_Function_Batch_User_Ptr  = SetGridIC_Batch;
 #  ifdef MHD
    Init_Function_BField_User_Ptr = SetBFieldIC;
 #  endif
@@ -19,6 +19,8 @@ static double *Merger_Prof1 = NULL;       // radial profiles [gas mass density/g
 static double *Merger_Prof2 = NULL;       // radial profiles [gas mass density/gas pressure/radius] of cluster 2
 static int     Merger_NBin1;              // number of radial bins of cluster 1
 static int     Merger_NBin2;              // number of radial bins of cluster 2
+static TableSpacing_t Merger_Spacing1;    // radial spacing of cluster 1 (for Mis_InterpolateFromTable_Uniform)
+static TableSpacing_t Merger_Spacing2;    // radial spacing of cluster 2 (for Mis_InterpolateFromTable_Uniform)
 // =======================================================================================
 
 
@@ -169,6 +171,8 @@ void SetParameter()
          Table_R[b] /= UNIT_L;
       }
 
+      Merger_Spacing1 = Mis_CheckTableSpacing( Merger_NBin1, Table_R );
+
 //    cluster 2
       if ( Merger_Coll ) {
       Merger_NBin2 = Aux_LoadTable( Merger_Prof2, Merger_File_Prof2, NCol, Col, RowMajor_No, AllocMem_Yes );
@@ -184,6 +188,8 @@ void SetParameter()
          Table_P[b] /= UNIT_P;
          Table_R[b] /= UNIT_L;
       }
+
+      Merger_Spacing2 = Mis_CheckTableSpacing( Merger_NBin2, Table_R );
       } // if ( Merger_Coll )
    } // if ( OPT__INIT != INIT_BY_RESTART )
 
@@ -274,10 +280,10 @@ void SetGridIC( real fluid[], const double x, const double y, const double z, co
 //    for each cell, we sum up the density and pressure from each halo and then calculate the weighted velocity
       r1    = sqrt( SQR(x-ClusterCenter1[0]) + SQR(y-ClusterCenter1[1]) + SQR(z-ClusterCenter1[2]) );
       r2    = sqrt( SQR(x-ClusterCenter2[0]) + SQR(y-ClusterCenter2[1]) + SQR(z-ClusterCenter2[2]) );
-      Dens1 = Mis_InterpolateFromTable( Merger_NBin1, Table_R1, Table_D1, r1 );
-      Dens2 = Mis_InterpolateFromTable( Merger_NBin2, Table_R2, Table_D2, r2 );
-      Pres1 = Mis_InterpolateFromTable( Merger_NBin1, Table_R1, Table_P1, r1 );
-      Pres2 = Mis_InterpolateFromTable( Merger_NBin2, Table_R2, Table_P2, r2 );
+      Dens1 = Mis_InterpolateFromTable_Uniform( Merger_NBin1, Table_R1, Table_D1, r1, Merger_Spacing1 );
+      Dens2 = Mis_InterpolateFromTable_Uniform( Merger_NBin2, Table_R2, Table_D2, r2, Merger_Spacing2 );
+      Pres1 = Mis_InterpolateFromTable_Uniform( Merger_NBin1, Table_R1, Table_P1, r1, Merger_Spacing1 );
+      Pres2 = Mis_InterpolateFromTable_Uniform( Merger_NBin2, Table_R2, Table_P2, r2, Merger_Spacing2 );
       Vel   = ( Merger_Coll_BulkVel1*Dens1 + Merger_Coll_BulkVel2*Dens2 ) / ( Dens1 + Dens2 );
 
       if ( Dens1 == NULL_REAL  ||  Pres1 == NULL_REAL )
@@ -298,11 +304,11 @@ void SetGridIC( real fluid[], const double x, const double y, const double z, co
       double r;
 
       r    = sqrt( SQR(x-BoxCenter[0]) + SQR(y-BoxCenter[1]) + SQR(z-BoxCenter[2]) );
-      Dens = Mis_InterpolateFromTable( Merger_NBin1, Table_R1, Table_D1, r );
+      Dens = Mis_InterpolateFromTable_Uniform( Merger_NBin1, Table_R1, Table_D1, r, Merger_Spacing1 );
       MomX = 0.0;
       MomY = 0.0;
       MomZ = 0.0;
-      Pres = Mis_InterpolateFromTable( Merger_NBin1, Table_R1, Table_P1, r );
+      Pres = Mis_InterpolateFromTable_Uniform( Merger_NBin1, Table_R1, Table_P1, r, Merger_Spacing1 );
 
       if ( Dens == NULL_REAL  ||  Pres == NULL_REAL )
          Aux_Error( ERROR_INFO, "interpolation failed at radius %13.7e (probably outside the input table)!!\n", r );
@@ -415,6 +415,43 @@ bool Flu_ResetByUser_CollidingJets( real fluid[], const double x, const double y
    return false;
 
 } // FUNCTION : Flu_ResetByUser_CollidingJets
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_ResetByUser_Patch_CollidingJets
+// Description :  Check whether a patch may intersect the jet sources
+//
+// Note        :  1. Invoked by "Flu_ResetByUser_API()" using the function pointer "Flu_ResetByUser_Patch_Ptr"
+//                2. Reject patches whose shortest distance to all jet centers exceeds Jet_MaxDis[]
+//                   --> Consistent with the distance check in Flu_ResetByUser_CollidingJets()
+//
+// Parameter   :  EdgeL/R : Left and right edges of the target patch
+//                Time    : Target physical time
+//                lv      : Target refinement level
+//
+// Return      :  true  : The target patch may intersect the jet sources
+//                false : The target patch does not intersect any jet source
+//-------------------------------------------------------------------------------------------------------
+bool Flu_ResetByUser_Patch_CollidingJets( const double EdgeL[], const double EdgeR[], const double Time, const int lv )
+{
+
+   for (int n=0; n<Jet_NJet; n++)
+   {
+      double Dis2 = 0.0;
+
+      for (int d=0; d<3; d++)
+      {
+         if      ( Jet_Cen[n][d] < EdgeL[d] )   Dis2 += SQR( EdgeL[d] - Jet_Cen[n][d] );
+         else if ( Jet_Cen[n][d] > EdgeR[d] )   Dis2 += SQR( Jet_Cen[n][d] - EdgeR[d] );
+      }
+
+      if ( Dis2 <= SQR(Jet_MaxDis[n]) )   return true;
+   }
+
+   return false;
+
+} // FUNCTION : Flu_ResetByUser_Patch_CollidingJets
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -444,9 +481,10 @@ void Init_TestProb_Hydro_CollidingJets()
    SetParameter();
 
 
-   Init_Function_User_Ptr   = SetGridIC;
-   Flu_ResetByUser_Func_Ptr = Flu_ResetByUser_CollidingJets;
-   End_User_Ptr             = End_CollidingJets;
+   Init_Function_User_Ptr    = SetGridIC;
+   Flu_ResetByUser_Func_Ptr  = Flu_ResetByUser_CollidingJets;
+   Flu_ResetByUser_Patch_Ptr = Flu_ResetByUser_Patch_CollidingJets;
+   End_User_Ptr              = End_CollidingJets;
 #  endif // #if ( MODEL == HYDRO )
 
 
@@ -279,10 +279,13 @@ void Init_TestProb_Template()
    Flag_User_Ptr                  = NULL; // option: OPT__FLAG_USER;          example: Refine/Flag_User.cpp
    Mis_GetTimeStep_User_Ptr       = NULL; // option: OPT__DT_USER;            example: Miscellaneous/Mis_GetTimeStep_User.cpp
    BC_User_Ptr                    = NULL; // option: OPT__BC_FLU_*=4;         example: TestProblem/ELBDM/ExtPot/Init_TestProb_ELBDM_ExtPot.cpp --> BC()
+   BC_User_Batch_Ptr              = NULL; // option: OPT__BC_FLU_*=4;         example: Fluid/Flu_BoundaryCondition_User.cpp --> BC_User_Batch_Template()
 #  ifdef MHD
    BC_BField_User_Ptr             = NULL; // option: OPT__BC_FLU_*=4;
 #  endif
    Flu_ResetByUser_Func_Ptr       = NULL; // option: OPT__RESET_FLUID;        example: Fluid/Flu_ResetByUser.cpp
+   Flu_ResetByUser_Batch_Ptr      = NULL; // option: OPT__RESET_FLUID;        example: Fluid/Flu_ResetByUser.cpp --> Flu_ResetByUser_Batch_Template()
+   Flu_ResetByUser_Patch_Ptr      = NULL; // option: OPT__RESET_FLUID;        example: Fluid/Flu_ResetByUser.cpp --> Flu_ResetByUser_Patch_Template()
    Output_User_Ptr                = NULL; // option: OPT__OUTPUT_USER;        example: TestProblem/Hydro/AcousticWave/Init_TestProb_Hydro_AcousticWave.cpp --> OutputError()
    Aux_Record_User_Ptr            = NULL; // option: OPT__RECORD_USER;        example: Auxiliary/Aux_Record_User.cpp
    Init_User_Ptr                  = NULL; // option: none;                    example: none
@@ -11,21 +11,29 @@
 //
 // Note        :  1. One must call YT_SetParameter() before invoking this function
 //                2. Invoked by YT_Inline()
+//                3. Grid[] only stores the local patches, which are ordered by level first and then by PID
+//                4. If Snapshot != NULL, the field data are first copied into Snapshot[] so that libyt can
+//                   access them while the simulation continues (i.e., YT_ASYNC)
+//                   --> Snapshot[] must have the size NPatchLocalAllLv*NField*CUBE(PS1)
+//                   --> Otherwise libyt accesses the patch data directly without any copy
 //
-// Parameter   :  Grid       : libyt grid object
+// Parameter   :  Grid       : libyt grid objects of all local patches
 //                GID_Offset : Global patch index offset at each refinement level for this rank
 //                NField     : Number of fields (e.g., density, momentum-x, ...)
 //                FieldLabel : Labels of all fields
+//                Snapshot   : Buffer for storing a copy of the field data (NULL --> no copy)
 //
 // Return      :  None
 //-------------------------------------------------------------------------------------------------------
-void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char **FieldLabel )
+void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char **FieldLabel, real *Snapshot )
 {
 
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
 // loop over all patches at all levels
+   int LocalID = 0;
+
    for (int lv=0; lv<NLEVEL; lv++)
    {
       const int FaLv  = lv - 1;
@@ -41,44 +49,58 @@ void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char
 
          for (int d=0; d<3; d++)
          {
-            Grid[GID].left_edge [d] = amr->patch[0][lv][PID]->EdgeL[d];
-            Grid[GID].right_edge[d] = amr->patch[0][lv][PID]->EdgeR[d];
-            Grid[GID].dimensions[d] = PATCH_SIZE;
+            Grid[LocalID].left_edge [d] = amr->patch[0][lv][PID]->EdgeL[d];
+            Grid[LocalID].right_edge[d] = amr->patch[0][lv][PID]->EdgeR[d];
+            Grid[LocalID].dimensions[d] = PATCH_SIZE;
          }
 
 #        ifdef PARTICLE
-         Grid[GID].particle_count = amr->patch[0][lv][PID]->NPar;
+         Grid[LocalID].particle_count = amr->patch[0][lv][PID]->NPar;
 #        else
-         Grid[GID].particle_count = 0;
+         Grid[LocalID].particle_count = 0;
 #        endif
-         Grid[GID].id             = GID;
+         Grid[LocalID].id             = GID;
 //###ISSUE: do not support parallelism
 //          --> see Output/Output_DumpData_Total_HDF5.cpp for the parallel implementation
-         Grid[GID].parent_id      = ( amr->patch[0][lv][PID]->father < 0 ) ? -1 : amr->patch[0][lv][PID]->father + GID_Offset[FaLv];
-         Grid[GID].level          = lv;
+         Grid[LocalID].parent_id      = ( amr->patch[0][lv][PID]->father < 0 ) ? -1 : amr->patch[0][lv][PID]->father + GID_Offset[FaLv];
+         Grid[LocalID].level          = lv;
 
 
 //       2. set pointers pointing to different field data
 //          --> "field_data" pointer array must be pre-allocated
          for (int v=0; v<NCOMP_TOTAL; v++)
-         Grid[GID].field_data[v]           = amr->patch[FluSg][lv][PID]->fluid[v];
+         Grid[LocalID].field_data[v]           = amr->patch[FluSg][lv][PID]->fluid[v];
 #        ifdef GRAVITY
-         Grid[GID].field_data[NCOMP_TOTAL] = amr->patch[PotSg][lv][PID]->pot;
+         Grid[LocalID].field_data[NCOMP_TOTAL] = amr->patch[PotSg][lv][PID]->pot;
 #        endif
 
+//          --> replace them by the snapshot copies if requested
+         if ( Snapshot != NULL )
+         {
+            for (int v=0; v<NField; v++)
+            {
+               real *Copy = Snapshot + ( (long)LocalID*NField + v )*CUBE(PS1);
+
+               memcpy( Copy, Grid[LocalID].field_data[v], CUBE(PS1)*sizeof(real) );
+               Grid[LocalID].field_data[v] = Copy;
+            }
+         }
+
 
 //       3. set other field parameters
-         Grid[GID].num_fields   = NField;
-         Grid[GID].field_labels = (const char **)FieldLabel;
+         Grid[LocalID].num_fields   = NField;
+         Grid[LocalID].field_labels = (const char **)FieldLabel;
 #        ifdef FLOAT8
-         Grid[GID].field_ftype  = YT_DOUBLE;
+         Grid[LocalID].field_ftype  = YT_DOUBLE;
 #        else
-         Grid[GID].field_ftype  = YT_FLOAT;
+         Grid[LocalID].field_ftype  = YT_FLOAT;
 #        endif
 
 
 //       4. send this patch to libyt
-         if ( yt_add_grid( &Grid[GID] ) != YT_SUCCESS )  Aux_Error( ERROR_INFO, "yt_add_grid() failed !!\n" );
+         if ( yt_add_grid( &Grid[LocalID] ) != YT_SUCCESS )  Aux_Error( ERROR_INFO, "yt_add_grid() failed !!\n" );
+
+         LocalID ++;
 
       } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    } // for (int lv=0; lv<NLEVEL; lv++)
@@ -21,6 +21,9 @@ void YT_End()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// complete the ongoing asynchronous analysis first
+   YT_Inline_Wait();
+
    if ( yt_finalize() != YT_SUCCESS )   Aux_Error( ERROR_INFO, "yt_finalize() failed !!\n" );
 
 
@@ -2,8 +2,24 @@
 
 #ifdef SUPPORT_LIBYT
 
+#include <pthread.h>
+
 void YT_SetParameter( const int NPatchAllLv );
-void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char **FieldLabelForYT );
+void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char **FieldLabelForYT, real *Snapshot );
+
+
+// resources of the ongoing asynchronous analysis (freed by YT_Inline_Wait())
+static bool      YT_Async_Running = false;
+static int       YT_Async_Status  = YT_SUCCESS;   // return value of yt_inline() (set by the analysis thread)
+static int       YT_Async_NField  = 0;
+static char    **YT_Async_Label   = NULL;
+static void    **YT_Async_Data    = NULL;
+static yt_grid  *YT_Async_Grid    = NULL;
+static real     *YT_Async_Snap    = NULL;
+static pthread_t YT_Async_Thread;
+
+static void *YT_Async_Run( void *Arg );
+static void YT_FreeResource( const int NField, char **FieldLabelForYT, void **FieldData, yt_grid *Grid, real *Snapshot );
 
 
 
@@ -17,6 +33,14 @@ void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char
 //                   1-2. YT_AddAllGrid   --> invoke yt_add_grid() for all patches
 //                   1-3. yt_inline()
 //                2. This function is invoked by main() directly
+//                3. Each rank only allocates the libyt grid objects of its own patches
+//                   --> The field data are passed by pointers without any copy
+//                4. Analysis is performed every YT_STEP root-level steps
+//                5. YT_ASYNC: the field data of all local patches are copied into a snapshot buffer and yt_inline()
+//                   is invoked by a separate thread so that the simulation can continue during the analysis
+//                   --> The OpenMP threads of the main loop are reduced by YT_ASYNC_NCORE until the analysis ends
+//                   --> Fall back to the synchronous mode if the snapshot exceeds YT_ASYNC_MAX_MEM on any rank
+//                   --> The previous analysis is always completed before starting a new one
 //
 // Parameter   :  None
 //
@@ -25,14 +49,24 @@ void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char
 void YT_Inline()
 {
 
+   if ( Step % YT_STEP != 0 )    return;
+
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// 0. libyt can only process one analysis at a time
+   YT_Inline_Wait();
+
+
 // 1. gather the number of patches at different MPI ranks and set the corresponding GID offset
    int (*NPatchAllRank)[NLEVEL] = new int [MPI_NRank][NLEVEL];
-   int NPatchLocal[NLEVEL], NPatchAllLv=0, GID_Offset[NLEVEL];
+   int NPatchLocal[NLEVEL], NPatchAllLv=0, NPatchLocalAllLv=0, GID_Offset[NLEVEL];
 
-   for (int lv=0; lv<NLEVEL; lv++)  NPatchLocal[lv] = amr->NPatchComma[lv][1];
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NPatchLocal[lv]   = amr->NPatchComma[lv][1];
+      NPatchLocalAllLv += NPatchLocal[lv];
+   }
 
    MPI_Allgather( NPatchLocal, NLEVEL, MPI_INT, NPatchAllRank[0], NLEVEL, MPI_INT, MPI_COMM_WORLD );
 
@@ -69,24 +103,73 @@ void YT_Inline()
    sprintf( FieldLabelForYT[NCOMP_TOTAL], PotLabel );
 #  endif
 
-// 3-3. prepare all patches for libyt
-   yt_grid *Grid = new yt_grid [NPatchAllLv];
+// 3-3. prepare all local patches for libyt
+//      --> allocate the field pointers of all local patches at once
+   yt_grid *Grid      = new yt_grid [NPatchLocalAllLv];
+   void   **FieldData = new void*   [ (long)NPatchLocalAllLv*NField ];
+
+   for (int t=0; t<NPatchLocalAllLv; t++)    Grid[t].field_data = FieldData + (long)t*NField;
+
+// 3-4. allocate the snapshot buffer for the asynchronous mode
+   bool  Async    = YT_ASYNC;
+   real *Snapshot = NULL;
+
+   if ( Async )
+   {
+      const long   SnapSize     = (long)NPatchLocalAllLv*NField*CUBE(PS1);
+      const double SnapMB       = (double)SnapSize*sizeof(real)/1024.0/1024.0;
+      int          Exceed_Local = ( SnapMB > YT_ASYNC_MAX_MEM ), Exceed_AllRank;
+
+      MPI_Allreduce( &Exceed_Local, &Exceed_AllRank, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD );
+
+      if ( Exceed_AllRank )
+      {
+         Async = false;
+
+         if ( MPI_Rank == 0 )
+            Aux_Message( stderr, "WARNING : snapshot exceeds YT_ASYNC_MAX_MEM (%13.7e MB) --> perform synchronous yt analysis !!\n",
+                         YT_ASYNC_MAX_MEM );
+      }
+
+      else
+         Snapshot = new real [SnapSize];
+   }
 
-   for (int GID=0; GID<NPatchAllLv; GID++)   Grid[GID].field_data = new void* [NField];
+   YT_AddAllGrid( Grid, GID_Offset, NField, FieldLabelForYT, Snapshot );
 
-   YT_AddAllGrid( Grid, GID_Offset, NField, FieldLabelForYT );
+   delete [] NPatchAllRank;
 
 
 // 4. perform yt inline analysis
-   if ( yt_inline() != YT_SUCCESS )    Aux_Error( ERROR_INFO, "yt_inline() failed !!\n" );
+   if ( Async )
+   {
+//    4-1. keep all resources alive until YT_Inline_Wait()
+      YT_Async_NField = NField;
+      YT_Async_Label  = FieldLabelForYT;
+      YT_Async_Data   = FieldData;
+      YT_Async_Grid   = Grid;
+      YT_Async_Snap   = Snapshot;
+      YT_Async_Status = YT_SUCCESS;
+
+//    4-2. reserve cores for the analysis thread
+#     ifdef OPENMP
+      omp_set_num_threads( MAX( OMP_NTHREAD-YT_ASYNC_NCORE, 1 ) );
+#     endif
+
+      if ( pthread_create( &YT_Async_Thread, NULL, YT_Async_Run, NULL ) != 0 )
+         Aux_Error( ERROR_INFO, "pthread_create() failed !!\n" );
+
+      YT_Async_Running = true;
+   }
+
+   else
+   {
+      if ( yt_inline() != YT_SUCCESS )    Aux_Error( ERROR_INFO, "yt_inline() failed !!\n" );
 
 
 // 5. free resource
-   delete [] NPatchAllRank;
-   for (int v=0; v<NField; v++)  delete [] FieldLabelForYT[v];
-   delete [] FieldLabelForYT;
-   for (int GID=0; GID<NPatchAllLv; GID++)   delete [] Grid[GID].field_data;
-   delete [] Grid;
+      YT_FreeResource( NField, FieldLabelForYT, FieldData, Grid, Snapshot );
+   }
 
 
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
@@ -95,4 +178,84 @@ void YT_Inline()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  YT_Inline_Wait
+// Description :  Wait for the ongoing asynchronous yt inline analysis to finish and free its resources
+//
+// Note        :  1. Invoked by YT_Inline() and YT_End()
+//                2. Do nothing if there is no ongoing analysis
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void YT_Inline_Wait()
+{
+
+   if ( !YT_Async_Running )   return;
+
+   if ( pthread_join( YT_Async_Thread, NULL ) != 0 )  Aux_Error( ERROR_INFO, "pthread_join() failed !!\n" );
+
+   YT_Async_Running = false;
+
+#  ifdef OPENMP
+   omp_set_num_threads( OMP_NTHREAD );
+#  endif
+
+   if ( YT_Async_Status != YT_SUCCESS )   Aux_Error( ERROR_INFO, "yt_inline() failed !!\n" );
+
+   YT_FreeResource( YT_Async_NField, YT_Async_Label, YT_Async_Data, YT_Async_Grid, YT_Async_Snap );
+
+   YT_Async_Label = NULL;
+   YT_Async_Data  = NULL;
+   YT_Async_Grid  = NULL;
+   YT_Async_Snap  = NULL;
+
+} // FUNCTION : YT_Inline_Wait
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  YT_Async_Run
+// Description :  Thread function performing the asynchronous yt inline analysis
+//
+// Note        :  1. Launched by YT_Inline()
+//                2. Must not call Aux_Error() --> failure is reported by YT_Inline_Wait()
+//
+// Parameter   :  Arg : Useless
+//-------------------------------------------------------------------------------------------------------
+void *YT_Async_Run( void *Arg )
+{
+
+   YT_Async_Status = yt_inline();
+
+   return NULL;
+
+} // FUNCTION : YT_Async_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  YT_FreeResource
+// Description :  Free the resources allocated by YT_Inline()
+//
+// Parameter   :  NField          : Number of fields
+//                FieldLabelForYT : Field labels
+//                FieldData       : Field pointers of all local patches
+//                Grid            : libyt grid objects of all local patches
+//                Snapshot        : Snapshot buffer (can be NULL)
+//-------------------------------------------------------------------------------------------------------
+void YT_FreeResource( const int NField, char **FieldLabelForYT, void **FieldData, yt_grid *Grid, real *Snapshot )
+{
+
+   for (int v=0; v<NField; v++)  delete [] FieldLabelForYT[v];
+   delete [] FieldLabelForYT;
+   delete [] FieldData;
+   delete [] Grid;
+   delete [] Snapshot;
+
+} // FUNCTION : YT_FreeResource
+
+
+
 #endif // #ifdef SUPPORT_LIBYT
@@ -1,4 +1,4 @@
-#include "ExtractProfile.h"
+#include "GAMER_Analysis.h"
 #include <cstdarg>
 
 
@@ -1,4 +1,4 @@
-#include "ExtractUniform.h"
+#include "GAMER_Analysis.h"
 
 
 
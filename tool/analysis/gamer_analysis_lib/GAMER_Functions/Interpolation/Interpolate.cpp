@@ -1,4 +1,4 @@
-#include "ExtractUniform.h"
+#include "GAMER_Analysis.h"
 
 
 void Int_MinMod1D  ( const real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
@@ -5,16 +5,56 @@
 #include <cstring>
 #include <unistd.h>
 #include <stdarg.h>
+#include <cfloat>
 #include "TypeDef.h"
 
+#ifdef OPENMP
+#  include <omp.h>
+#endif
+
 using namespace std;
 
 #define ERROR_INFO         __FILE__, __LINE__, __FUNCTION__
 
+// number of bins of the relative-error histograms in the streaming mode
+// --> bin 0: identical, 1: <1e-16, 2~17: [1e-16,1e-15) ... [1e-1,1), 18: >=1, 19: NaN/Inf
+#define HIST_NBIN          20
+
+// maximum number of grid components compared in the streaming mode and the maximum number of cells per component
+#define NCOMP_CMP_MAX      ( NCOMP_TOTAL + 2 + 2*NCOMP_MAG )
+#define NCELL_CMP_MAX      ( PS1P1*SQR(PS1) )
+
+
+// error statistics of a single component in the streaming mode
+struct ErrStat_t
+{
+   double MaxAbsErr, MaxRelErr;
+   long   NCell, NFail, Hist[HIST_NBIN];
+};
+
+// data layout of a single component in the streaming mode
+struct CompInfo_t
+{
+   int  Label;          // component index printed in the output file
+   int  NCell;          // number of cells
+   int  NX, NY;         // array dimensions along x and y for converting the 1D index to (i,j,k)
+   long Offset1;        // offset (in number of real) within the patch data block of input 1
+   long Offset2;        // offset (in number of real) within the patch data block of input 2
+   char Name[16];       // component name
+};
+
+// corner and index of a leaf patch for matching patches by corner coordinates in the streaming mode
+struct CrPID_t
+{
+   int Cr[3];
+   int PID;
+};
+
 void ReadOption( int argc, char **argv );
 void CheckParameter();
 void LoadData( GAMER_t &patch, const char *FileName_In, bool &WithPot, int &WithParDens, bool &WithPar,
-               int &NParVarOut, long &NPar, real **&ParData, bool &WithMagCC, bool &WithMagFC );
+               int &NParVarOut, long &NPar, real **&ParData, bool &WithMagCC, bool &WithMagFC,
+               const bool LoadGrid, long &HeaderSize, int *NPatchTotal );
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 void Aux_AllocateArray2D( real** &Array, const int J, const int I );
 void Aux_DeallocateArray2D( real** &Array );
@@ -25,8 +65,15 @@ void Load_Parameter_After_2000( FILE *File, const int FormatVersion, bool &WithP
                                 const long HeaderOffset_Makefile, const long HeaderOffset_Constant,
                                 const long HeaderOffset_Parameter, int *NX0_Tot, int *NGPU_X,
                                 bool &WithPar, int &NParVarOut, bool &WithMagCC, bool &WithMagFC );
+void CheckGridInfo( const int *NPatch1, const int *NPatch2 );
 void CompareGridData();
+void CompareGridData_Stream();
 void CompareParticleData();
+long GetPatchDataSize( const bool WithPot, const int WithParDens, const bool WithMagCC, const bool WithMagFC );
+void ScanLeafPatch( const char *FileName, const long HeaderSize, const int *NPatchTotal, const bool WithPar,
+                    const long PatchDataSize, int *NLeaf, int (**Corner)[3], long **Offset );
+void CompareOneComp( const real *Data1, const real *Data2, const int NCell, ErrStat_t &Stat, long &NFail );
+int  CompareCorner( const void *a, const void *b );
 void SortParticle( const long NPar, const real *PosX, const real *PosY, const real *PosZ, const real *VelX, long *IdxTable );
 
 GAMER_t  patch1, patch2;
@@ -36,6 +83,12 @@ bool     WithMagCC1, WithMagCC2, WithMagFC1, WithMagFC2;
 
 double   TolErr     = __FLT_MIN__;
 bool     UseCorner  = false;
+bool     Stream     = false;
+int      ChunkSize  = 1024;
+int      OMP_NThread= -1;
+
+long     HeaderSize1=-1, HeaderSize2=-1;
+int      NPatchTotal1[NLEVEL], NPatchTotal2[NLEVEL];
 
 bool     WithPar1=false, WithPar2=false;
 int      WithParDens1=0, WithParDens2=0;
@@ -55,7 +108,7 @@ void ReadOption( int argc, char **argv )
 
    int c;
 
-   while( (c = getopt(argc, argv, "hci:j:o:e:")) != -1 )
+   while( (c = getopt(argc, argv, "hcsi:j:o:e:n:t:")) != -1 )
       switch(c)
       {
          case 'i': FileName_In1  = optarg;
@@ -68,11 +121,23 @@ void ReadOption( int argc, char **argv )
                    break;
          case 'c': UseCorner     = true;
                    break;
+         case 's': Stream        = true;
+                   break;
+         case 'n': ChunkSize     = atoi(optarg);
+                   break;
+         case 't': OMP_NThread   = atoi(optarg);
+                   break;
          case 'h':
          case '?': cerr << endl << "usage: " << argv[0]
                         << " [-h (for help)] [-i Input FileName1] [-j Input FileName2] [-o Output FileName]"
                         << endl << "                          "
                         << " [-e Tolerant Error] [-c (compare patches with the same corner coordinates) [off]]"
+                        << endl << "                          "
+                        << " [-s (streaming mode: load and compare patches chunk by chunk) [off]]"
+                        << endl << "                          "
+                        << " [-n number of patches per chunk in the streaming mode [1024]]"
+                        << endl << "                          "
+                        << " [-t number of OpenMP threads in the streaming mode [omp_get_max_threads]]"
                         << endl
                         << endl << endl;
                    exit( 1 );
@@ -115,6 +180,12 @@ void CheckParameter()
       cerr << "WARNING : please provide the tolerant error (-e Tolerant Error) !!" << endl;
    }
 
+   if ( Stream  &&  ChunkSize <= 0 )
+   {
+      cerr << "ERROR : number of patches per chunk (-n) must be positive !!" << endl;
+      exit( 1 );
+   }
+
    if ( UseCorner == false )
    {
       cerr << "WARNING : please make sure that the order of patches storing in the input files are the same."
@@ -130,22 +201,24 @@ void CheckParameter()
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  CompareGridData
-// Description :  Compare the grid data between two files
+// Function    :  CheckGridInfo
+// Description :  Verify that the grid data of the two inputs can be compared
+//
+// Note        :  1. Shared by CompareGridData() and CompareGridData_Stream()
+//                2. UseCorner may be turned on automatically
+//
+// Parameter   :  NPatch1/2 : Number of leaf patches at each level in the two inputs
 //-------------------------------------------------------------------------------------------------------
-void CompareGridData()
+void CheckGridInfo( const int *NPatch1, const int *NPatch2 )
 {
 
-   cout << "CompareGridData ... " << endl;
-
-
 // verify that the total number of patches at each level of patch1 and patch2 are the same
    for (int lv=0; lv<NLEVEL; lv++)
    {
-      if ( patch1.num[lv] != patch2.num[lv] )
+      if ( NPatch1[lv] != NPatch2[lv] )
       {
          fprintf( stderr, "ERROR : patch1.num[%d] (%d) != patch2.num[%d] (%d) !!\n",
-                  lv, patch1.num[lv], lv, patch2.num[lv] );
+                  lv, NPatch1[lv], lv, NPatch2[lv] );
          exit( 1 );
       }
    }
@@ -210,6 +283,23 @@ void CompareGridData()
       exit( -1 );
    }
 
+} // FUNCTION : CheckGridInfo
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CompareGridData
+// Description :  Compare the grid data between two files
+//-------------------------------------------------------------------------------------------------------
+void CompareGridData()
+{
+
+   cout << "CompareGridData ... " << endl;
+
+
+// check the consistency between the two inputs
+   CheckGridInfo( patch1.num, patch2.num );
+
 
 // compare data
    double Data1, Data2, AbsErr, RelErr;
@@ -405,6 +495,540 @@ void CompareGridData()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CompareGridData_Stream
+// Description :  Compare the grid data between two files in the streaming mode
+//
+// Note        :  1. Enabled by the option "-s"
+//                2. Only the corner and file offset of each leaf patch are kept in memory. The patch data
+//                   are loaded level by level in chunks of "ChunkSize" patches (option "-n") and then compared
+//                   by OpenMP threads
+//                   --> Memory consumption is independent of the snapshot size
+//                3. Patches are matched by their order in the files or by their corner coordinates (option "-c")
+//                   --> The latter uses a sorted corner table instead of the linear search in CompareGridData()
+//                4. The cells exceeding the tolerant error are recorded in the same format as CompareGridData()
+//                   --> But they are grouped by component within each patch
+//                5. The maximum absolute/relative errors and the histogram of relative errors of each component
+//                   are appended to the output file
+//-------------------------------------------------------------------------------------------------------
+void CompareGridData_Stream()
+{
+
+   cout << "CompareGridData_Stream ... " << endl;
+
+
+// 1. record the corner and file offset of all leaf patches
+   const long PatchDataSize1 = GetPatchDataSize( WithPot1, WithParDens1, WithMagCC1, WithMagFC1 );
+   const long PatchDataSize2 = GetPatchDataSize( WithPot2, WithParDens2, WithMagCC2, WithMagFC2 );
+
+   int    NLeaf1[NLEVEL], NLeaf2[NLEVEL];
+   int  (*Corner1[NLEVEL])[3], (*Corner2[NLEVEL])[3];
+   long  *Offset1[NLEVEL], *Offset2[NLEVEL];
+
+   ScanLeafPatch( FileName_In1, HeaderSize1, NPatchTotal1, WithPar1, PatchDataSize1, NLeaf1, Corner1, Offset1 );
+   ScanLeafPatch( FileName_In2, HeaderSize2, NPatchTotal2, WithPar2, PatchDataSize2, NLeaf2, Corner2, Offset2 );
+
+   CheckGridInfo( NLeaf1, NLeaf2 );
+
+
+// 2. set the components to be compared
+   const int CC = CUBE( PS1 );
+
+   CompInfo_t Comp[NCOMP_CMP_MAX];
+   long       Off1=0, Off2=0;
+   int        NComp=0;
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+   {
+      Comp[NComp].Label   = v;
+      Comp[NComp].NCell   = CC;
+      Comp[NComp].NX      = PS1;
+      Comp[NComp].NY      = PS1;
+      Comp[NComp].Offset1 = Off1;
+      Comp[NComp].Offset2 = Off2;
+      sprintf( Comp[NComp].Name, "Fluid%d", v );
+      NComp ++;
+      Off1 += CC;
+      Off2 += CC;
+   }
+
+   if ( WithPot1  ||  WithPot2 )
+   {
+      Comp[NComp].Label   = 1000;
+      Comp[NComp].NCell   = CC;
+      Comp[NComp].NX      = PS1;
+      Comp[NComp].NY      = PS1;
+      Comp[NComp].Offset1 = Off1;
+      Comp[NComp].Offset2 = Off2;
+      sprintf( Comp[NComp].Name, "Pot" );
+      if ( WithPot1 && WithPot2 )   NComp ++;
+      if ( WithPot1 )   Off1 += CC;
+      if ( WithPot2 )   Off2 += CC;
+   }
+
+   if ( WithParDens1  ||  WithParDens2 )
+   {
+      Comp[NComp].Label   = 1001;
+      Comp[NComp].NCell   = CC;
+      Comp[NComp].NX      = PS1;
+      Comp[NComp].NY      = PS1;
+      Comp[NComp].Offset1 = Off1;
+      Comp[NComp].Offset2 = Off2;
+      sprintf( Comp[NComp].Name, "ParDens" );
+      if ( WithParDens1 > 0  &&  WithParDens1 == WithParDens2 )   NComp ++;
+      if ( WithParDens1 )  Off1 += CC;
+      if ( WithParDens2 )  Off2 += CC;
+   }
+
+   if ( WithMagCC1  ||  WithMagCC2 )
+   {
+      for (int v=0; v<NCOMP_MAG; v++)
+      {
+         Comp[NComp].Label   = 2000 + v;
+         Comp[NComp].NCell   = CC;
+         Comp[NComp].NX      = PS1;
+         Comp[NComp].NY      = PS1;
+         Comp[NComp].Offset1 = Off1;
+         Comp[NComp].Offset2 = Off2;
+         sprintf( Comp[NComp].Name, "MagCC%d", v );
+         if ( WithMagCC1 && WithMagCC2 )  NComp ++;
+         if ( WithMagCC1 )    Off1 += CC;
+         if ( WithMagCC2 )    Off2 += CC;
+      }
+   }
+
+// WithMagFC1 == WithMagFC2 has been verified by CheckGridInfo()
+   if ( WithMagFC1 )
+   {
+      for (int v=0; v<NCOMP_MAG; v++)
+      {
+         Comp[NComp].Label   = 2003 + v;
+         Comp[NComp].NCell   = PS1P1*SQR(PS1);
+         Comp[NComp].NX      = ( v == 0 ) ? PS1P1 : PS1;
+         Comp[NComp].NY      = ( v == 1 ) ? PS1P1 : PS1;
+         Comp[NComp].Offset1 = Off1;
+         Comp[NComp].Offset2 = Off2;
+         sprintf( Comp[NComp].Name, "MagFC%d", v );
+         NComp ++;
+         Off1 += PS1P1*SQR(PS1);
+         Off2 += PS1P1*SQR(PS1);
+      }
+   }
+
+
+// 3. allocate the chunk buffers
+   const long NReal1 = PatchDataSize1/sizeof(real);
+   const long NReal2 = PatchDataSize2/sizeof(real);
+
+   real *Buf1      = new real [ (long)ChunkSize*NReal1 ];
+   real *Buf2      = new real [ (long)ChunkSize*NReal2 ];
+   int  *PairID    = new int  [ ChunkSize ];
+   long *NFailPID  = new long [ ChunkSize ];
+
+   ErrStat_t Stat[NCOMP_CMP_MAX];
+
+   for (int c=0; c<NComp; c++)
+   {
+      Stat[c].MaxAbsErr = 0.0;
+      Stat[c].MaxRelErr = 0.0;
+      Stat[c].NCell     = 0;
+      Stat[c].NFail     = 0;
+      for (int b=0; b<HIST_NBIN; b++)  Stat[c].Hist[b] = 0;
+   }
+
+
+// 4. compare data
+   FILE *File  = fopen( FileName_Out, "w" );
+   FILE *File1 = fopen( FileName_In1, "rb" );
+   FILE *File2 = fopen( FileName_In2, "rb" );
+
+   fprintf( File, "%5s%8s%8s  (%3s,%3s,%3s )%6s%16s%16s%16s%16s\n",
+                  "Level", "PID1", "PID2", "i", "j", "k", "Comp", "Data1", "Data2", "AbsErr", "RelErr" );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      cout << "  Comparing level " << lv << " ... " << flush;
+
+//    4-1. match patches by corner coordinates using the sorted corner table of input 2
+      CrPID_t *Sort2  = NULL;
+      bool    *Check2 = new bool [ NLeaf2[lv] ];
+
+      for (int PID2=0; PID2<NLeaf2[lv]; PID2++)    Check2[PID2] = false;
+
+      if ( UseCorner )
+      {
+         Sort2 = new CrPID_t [ NLeaf2[lv] ];
+
+         for (int PID2=0; PID2<NLeaf2[lv]; PID2++)
+         {
+            for (int d=0; d<3; d++)    Sort2[PID2].Cr[d] = Corner2[lv][PID2][d];
+            Sort2[PID2].PID = PID2;
+         }
+
+         qsort( Sort2, NLeaf2[lv], sizeof(CrPID_t), CompareCorner );
+      }
+
+
+      for (int PID1_Start=0; PID1_Start<NLeaf1[lv]; PID1_Start+=ChunkSize)
+      {
+         const int NPatch = ( PID1_Start+ChunkSize <= NLeaf1[lv] ) ? ChunkSize : NLeaf1[lv]-PID1_Start;
+
+//       4-2. load the data of one chunk
+         for (int t=0; t<NPatch; t++)
+         {
+            const int PID1 = PID1_Start + t;
+
+            if ( UseCorner )
+            {
+               CrPID_t Key;
+               for (int d=0; d<3; d++)    Key.Cr[d] = Corner1[lv][PID1][d];
+
+               const CrPID_t *Match = (CrPID_t*)bsearch( &Key, Sort2, NLeaf2[lv], sizeof(CrPID_t), CompareCorner );
+
+               PairID[t] = ( Match == NULL ) ? -1 : Match->PID;
+            }
+
+            else
+               PairID[t] = PID1;
+
+            if ( PairID[t] < 0 )
+            {
+               fprintf( stderr, "WARNING : patch %5d at level %d in input 1 has NOT been checked !!\n", PID1, lv );
+               continue;
+            }
+
+            fseek( File1, Offset1[lv][PID1     ], SEEK_SET );
+            fseek( File2, Offset2[lv][PairID[t]], SEEK_SET );
+
+            fread( Buf1+t*NReal1, sizeof(real), NReal1, File1 );
+            fread( Buf2+t*NReal2, sizeof(real), NReal2, File2 );
+
+            Check2[ PairID[t] ] = true;
+         }
+
+//       4-3. compare data in parallel
+#        pragma omp parallel
+         {
+            ErrStat_t Stat_OMP[NCOMP_CMP_MAX];
+
+            for (int c=0; c<NComp; c++)
+            {
+               Stat_OMP[c].MaxAbsErr = 0.0;
+               Stat_OMP[c].MaxRelErr = 0.0;
+               Stat_OMP[c].NCell     = 0;
+               Stat_OMP[c].NFail     = 0;
+               for (int b=0; b<HIST_NBIN; b++)  Stat_OMP[c].Hist[b] = 0;
+            }
+
+#           pragma omp for schedule( static )
+            for (int t=0; t<NPatch; t++)
+            {
+               NFailPID[t] = 0;
+
+               if ( PairID[t] < 0 )    continue;
+
+               for (int c=0; c<NComp; c++)
+                  CompareOneComp( Buf1+t*NReal1+Comp[c].Offset1, Buf2+t*NReal2+Comp[c].Offset2, Comp[c].NCell,
+                                  Stat_OMP[c], NFailPID[t] );
+            }
+
+//          the reduction operations (max and sum) do not depend on the order of threads
+#           pragma omp critical
+            {
+               for (int c=0; c<NComp; c++)
+               {
+                  Stat[c].MaxAbsErr = fmax( Stat[c].MaxAbsErr, Stat_OMP[c].MaxAbsErr );
+                  Stat[c].MaxRelErr = fmax( Stat[c].MaxRelErr, Stat_OMP[c].MaxRelErr );
+                  Stat[c].NCell    += Stat_OMP[c].NCell;
+                  Stat[c].NFail    += Stat_OMP[c].NFail;
+                  for (int b=0; b<HIST_NBIN; b++)  Stat[c].Hist[b] += Stat_OMP[c].Hist[b];
+               }
+            }
+         } // OpenMP parallel region
+
+//       4-4. record the cells exceeding the tolerant error (usually only a few patches)
+         for (int t=0; t<NPatch; t++)
+         {
+            if ( NFailPID[t] == 0 )    continue;
+
+            const int PID1 = PID1_Start + t;
+            const int PID2 = PairID[t];
+
+            for (int c=0; c<NComp; c++)
+            {
+               const real *Data1 = Buf1 + t*NReal1 + Comp[c].Offset1;
+               const real *Data2 = Buf2 + t*NReal2 + Comp[c].Offset2;
+
+               for (int idx=0; idx<Comp[c].NCell; idx++)
+               {
+                  const double D1     = Data1[idx];
+                  const double D2     = Data2[idx];
+                  const double AbsErr = D1 - D2;
+                  const double RelErr = AbsErr / ( 0.5*(D1+D2) );
+
+                  if ( D1 == 0.0  &&  D2 == 0.0 )  continue;
+
+                  if ( fabs( RelErr ) >= TolErr  ||  !isfinite( RelErr )  )
+                  {
+                     const int i =   idx %  Comp[c].NX;
+                     const int j = ( idx /  Comp[c].NX ) % Comp[c].NY;
+                     const int k =   idx / (Comp[c].NX*Comp[c].NY);
+
+                     fprintf( File, "%5d%8d%8d  (%3d,%3d,%3d )%6d%16.7e%16.7e%16.7e%16.7e\n",
+                              lv, PID1, PID2, i, j, k, Comp[c].Label, D1, D2, AbsErr, RelErr );
+                  }
+               }
+            }
+         } // for (int t=0; t<NPatch; t++)
+      } // for (int PID1_Start=0; PID1_Start<NLeaf1[lv]; PID1_Start+=ChunkSize)
+
+
+//    4-5. verify that all patches in input 2 have been checked
+      for (int PID2=0; PID2<NLeaf2[lv]; PID2++)
+         if ( !Check2[PID2] )
+            fprintf( stderr, "WARNING : patch %5d at level %d in input 2 has NOT been checked !!\n", PID2, lv );
+
+      delete [] Sort2;
+      delete [] Check2;
+
+      cout << "done" << endl;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   fclose( File1 );
+   fclose( File2 );
+
+
+// 5. record the error statistics of each component
+   fprintf( File, "\n\n" );
+   fprintf( File, "=============================================================================================================\n" );
+   fprintf( File, "Error statistics of each component (RelErr = AbsErr/average)\n" );
+   fprintf( File, "Histogram bins of |RelErr|: Same, <1e-16, [1e-16,1e-15), ..., [1e-01,1e+00), >=1e+00, NaN/Inf\n" );
+   fprintf( File, "%-8s%6s%14s%14s%14s%14s", "Name", "Comp", "NCell", "NFail", "MaxAbsErr", "MaxRelErr" );
+   for (int b=0; b<HIST_NBIN; b++)
+   {
+      if      ( b == 0           )  fprintf( File, "%12s", "Same" );
+      else if ( b == 1           )  fprintf( File, "%12s", "<1e-16" );
+      else if ( b == HIST_NBIN-2 )  fprintf( File, "%12s", ">=1e+00" );
+      else if ( b == HIST_NBIN-1 )  fprintf( File, "%12s", "NaN/Inf" );
+      else                          fprintf( File, "%9s%+03d", "1e", b-18 );
+   }
+   fprintf( File, "\n" );
+
+   for (int c=0; c<NComp; c++)
+   {
+      fprintf( File, "%-8s%6d%14ld%14ld%14.7e%14.7e", Comp[c].Name, Comp[c].Label, Stat[c].NCell, Stat[c].NFail,
+               Stat[c].MaxAbsErr, Stat[c].MaxRelErr );
+      for (int b=0; b<HIST_NBIN; b++)  fprintf( File, "%12ld", Stat[c].Hist[b] );
+      fprintf( File, "\n" );
+
+      fprintf( stdout, "   %-8s : MaxAbsErr = %14.7e, MaxRelErr = %14.7e, NFail = %ld/%ld\n",
+               Comp[c].Name, Stat[c].MaxAbsErr, Stat[c].MaxRelErr, Stat[c].NFail, Stat[c].NCell );
+   }
+
+   fclose( File );
+
+
+// 6. free memory
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] Corner1[lv];
+      delete [] Corner2[lv];
+      delete [] Offset1[lv];
+      delete [] Offset2[lv];
+   }
+
+   delete [] Buf1;
+   delete [] Buf2;
+   delete [] PairID;
+   delete [] NFailPID;
+
+
+   cout << "CompareGridData_Stream ... done" << endl;
+
+} // FUNCTION : CompareGridData_Stream
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CompareOneComp
+// Description :  Compare a single component of one patch and accumulate the error statistics
+//
+// Note        :  1. Cells with Data1 == Data2 == 0 are regarded as identical, consistent with CompareGridData()
+//                2. The error evaluation is vectorized by "omp simd" and the histogram is accumulated afterwards
+//                3. Invoked by multiple OpenMP threads --> Stat must be thread-private
+//
+// Parameter   :  Data1/2 : Data of the two inputs
+//                NCell   : Number of cells
+//                Stat    : Error statistics to be accumulated
+//                NFail   : Number of cells exceeding the tolerant error to be accumulated
+//-------------------------------------------------------------------------------------------------------
+void CompareOneComp( const real *Data1, const real *Data2, const int NCell, ErrStat_t &Stat, long &NFail )
+{
+
+   double RelErr[NCELL_CMP_MAX];
+   double MaxAbsErr = Stat.MaxAbsErr;
+   double MaxRelErr = Stat.MaxRelErr;
+   long   NFailNow  = 0;
+
+#  pragma omp simd reduction( max:MaxAbsErr, MaxRelErr ) reduction( +:NFailNow )
+   for (int t=0; t<NCell; t++)
+   {
+      const double D1       = Data1[t];
+      const double D2       = Data2[t];
+      const bool   BothZero = ( D1 == 0.0  &&  D2 == 0.0 );
+      const double AbsErr   = fabs( D1 - D2 );
+      const double Err      = ( BothZero ) ? 0.0 : AbsErr / fabs( 0.5*(D1+D2) );
+
+//    NaN fails all comparisons and Inf exceeds DBL_MAX --> both are excluded from the maximum errors
+      if ( AbsErr <= DBL_MAX  &&  AbsErr > MaxAbsErr )   MaxAbsErr = AbsErr;
+      if ( Err    <= DBL_MAX  &&  Err    > MaxRelErr )   MaxRelErr = Err;
+      if ( !BothZero  &&  !( Err < TolErr ) )            NFailNow ++;
+
+      RelErr[t] = Err;
+   }
+
+   for (int t=0; t<NCell; t++)
+   {
+      int Bin;
+
+      if      ( RelErr[t] == 0.0 )            Bin = 0;
+      else if ( !( RelErr[t] <= DBL_MAX ) )   Bin = HIST_NBIN - 1;
+      else
+      {
+         Bin = (int)floor( log10(RelErr[t]) ) + 18;
+         if ( Bin < 1           )  Bin = 1;
+         if ( Bin > HIST_NBIN-2 )  Bin = HIST_NBIN - 2;
+      }
+
+      Stat.Hist[Bin] ++;
+   }
+
+   Stat.MaxAbsErr  = MaxAbsErr;
+   Stat.MaxRelErr  = MaxRelErr;
+   Stat.NCell     += NCell;
+   Stat.NFail     += NFailNow;
+   NFail          += NFailNow;
+
+} // FUNCTION : CompareOneComp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPatchDataSize
+// Description :  Return the size (in bytes) of the data stored in each leaf patch
+//
+// Parameter   :  WithPot/WithParDens/WithMagCC/WithMagFC : Fields stored in the file
+//-------------------------------------------------------------------------------------------------------
+long GetPatchDataSize( const bool WithPot, const int WithParDens, const bool WithMagCC, const bool WithMagFC )
+{
+
+   int  NGridVar = NCOMP_TOTAL;
+   long Size;
+
+   if ( WithPot )       NGridVar ++;
+   if ( WithParDens )   NGridVar ++;
+   if ( WithMagCC )     NGridVar += NCOMP_MAG;
+
+   Size  = CUBE(PATCH_SIZE)*NGridVar*sizeof(real);
+   if ( WithMagFC )
+   Size += PS1P1*SQR(PS1)*NCOMP_MAG*sizeof(real);
+
+   return Size;
+
+} // FUNCTION : GetPatchDataSize
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ScanLeafPatch
+// Description :  Record the corner and the file offset of the data of all leaf patches without loading the data
+//
+// Note        :  1. Corner[lv] and Offset[lv] are allocated here --> must be deallocated manually later
+//                2. Leaf patches are indexed by their order in the file, consistent with the PID in LoadData()
+//
+// Parameter   :  FileName      : Name of the input file
+//                HeaderSize    : Total size of all headers (i.e., offset of the first patch)
+//                NPatchTotal   : Total number of patches at each level
+//                WithPar       : true --> the file stores particles
+//                PatchDataSize : Size of the data of each leaf patch
+//                NLeaf         : Number of leaf patches at each level
+//                Corner        : Corner of each leaf patch at each level
+//                Offset        : File offset of the data of each leaf patch at each level
+//-------------------------------------------------------------------------------------------------------
+void ScanLeafPatch( const char *FileName, const long HeaderSize, const int *NPatchTotal, const bool WithPar,
+                    const long PatchDataSize, int *NLeaf, int (**Corner)[3], long **Offset )
+{
+
+   fprintf( stdout, "   Scanning leaf patches in %s ...\n", FileName );
+
+
+   FILE *File = fopen( FileName, "rb" );
+
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "input file \"%s\" does not exist !!\n", FileName );
+
+   int LoadCorner[3], LoadSon;
+
+   fseek( File, HeaderSize, SEEK_SET );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NLeaf [lv] = 0;
+      Corner[lv] = new int  [ NPatchTotal[lv] ][3];
+      Offset[lv] = new long [ NPatchTotal[lv] ];
+
+      for (int LoadPID=0; LoadPID<NPatchTotal[lv]; LoadPID++)
+      {
+         fread(  LoadCorner, sizeof(int), 3, File );
+         fread( &LoadSon,    sizeof(int), 1, File );
+
+         if ( LoadSon == -1 )
+         {
+//          skip particle info
+            if ( WithPar ) fseek( File, 2*sizeof(long), SEEK_CUR );
+
+            for (int d=0; d<3; d++)    Corner[lv][ NLeaf[lv] ][d] = LoadCorner[d];
+
+            Offset[lv][ NLeaf[lv] ] = ftell( File );
+            NLeaf [lv] ++;
+
+            fseek( File, PatchDataSize, SEEK_CUR );
+         }
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   fclose( File );
+
+
+   fprintf( stdout, "   Scanning leaf patches in %s ... done\n", FileName );
+
+} // FUNCTION : ScanLeafPatch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CompareCorner
+// Description :  Comparison function of the patch corners for qsort() and bsearch()
+//
+// Note        :  Corners are ordered by z, y, and then x
+//-------------------------------------------------------------------------------------------------------
+int CompareCorner( const void *a, const void *b )
+{
+
+   const int *Cr1 = ( (const CrPID_t*)a )->Cr;
+   const int *Cr2 = ( (const CrPID_t*)b )->Cr;
+
+   for (int d=2; d>=0; d--)
+   {
+      if ( Cr1[d] < Cr2[d] )  return -1;
+      if ( Cr1[d] > Cr2[d] )  return +1;
+   }
+
+   return 0;
+
+} // FUNCTION : CompareCorner
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  CompareParticleData
 // Description :  Compare the particle data between two files
@@ -631,9 +1255,14 @@ void SortParticle( const long NPar, const real *PosX, const real *PosY, const re
 //                ParData     : Particle data array (allocated here --> must be dallocated manually later)
 //                WithMagCC   : true --> the loaded data contain cell-centered magnetic field
 //                WithMagFC   : true --> the loaded data contain face-centered magnetic field
+//                LoadGrid    : true  --> load the grid data into "patch"
+//                              false --> skip the grid data (for the streaming mode)
+//                HeaderSize  : Total size of all headers
+//                NPatchTotal : Total number of patches at each level
 //-------------------------------------------------------------------------------------------------------
 void LoadData( GAMER_t &patch, const char *FileName_In, bool &WithPot, int &WithParDens, bool &WithPar,
-               int &NParVarOut, long &NPar, real **&ParData, bool &WithMagCC, bool &WithMagFC )
+               int &NParVarOut, long &NPar, real **&ParData, bool &WithMagCC, bool &WithMagFC,
+               const bool LoadGrid, long &HeaderSize, int *NPatchTotal )
 {
 
    fprintf( stdout, "Loading data %s ...\n", FileName_In );
@@ -757,7 +1386,7 @@ void LoadData( GAMER_t &patch, const char *FileName_In, bool &WithPot, int &With
 
 // load information necessary for restart
    long   AdvanceCounter[NLEVEL];
-   int    NPatchTotal[NLEVEL], NDataPatch_Total[NLEVEL], DumpID;
+   int    NDataPatch_Total[NLEVEL], DumpID;
    long   Step, FileOffset_Particle;
    double Time[NLEVEL];
 
@@ -813,6 +1442,11 @@ void LoadData( GAMER_t &patch, const char *FileName_In, bool &WithPot, int &With
       ExpectSize += (long)NParVarOut*NPar*sizeof(real);
    }
 
+// patch index appended after the particle data since version 2230
+   if ( FormatVersion >= 2230 )
+   for (int lv=0; lv<NLEVEL; lv++)
+      ExpectSize += (long)NPatchTotal[lv]*4*sizeof(int);       // 4 = corner(3) + son(1)
+
    fseek( File, 0, SEEK_END );
    InputSize = ftell( File );
 
@@ -824,12 +1458,16 @@ void LoadData( GAMER_t &patch, const char *FileName_In, bool &WithPot, int &With
    fprintf( stdout, "   Loading simulation information ... done\n" );
 
 
-// d. load the simulation data
+   HeaderSize = HeaderSize_Total;
+
+
+// d. load the simulation data (the streaming mode loads them later chunk by chunk)
 // =================================================================================================
    int  LoadCorner[3], LoadSon, PID;
 
    fseek( File, HeaderSize_Total, SEEK_SET );
 
+   if ( LoadGrid )
    for (int lv=0; lv<NLEVEL; lv++)
    {
       fprintf( stdout, "   Loading grid data at level %2d ... ", lv );
@@ -1425,10 +2063,18 @@ int main( int argc, char ** argv )
 
    CheckParameter();
 
-   LoadData( patch1, FileName_In1, WithPot1, WithParDens1, WithPar1, NParVarOut1, NPar1, ParData1, WithMagCC1, WithMagFC1 );
-   LoadData( patch2, FileName_In2, WithPot2, WithParDens2, WithPar2, NParVarOut2, NPar2, ParData2, WithMagCC2, WithMagFC2 );
+#  ifdef OPENMP
+   if ( OMP_NThread <= 0 )    OMP_NThread = omp_get_max_threads();
+   omp_set_num_threads( OMP_NThread );
+#  endif
+
+   LoadData( patch1, FileName_In1, WithPot1, WithParDens1, WithPar1, NParVarOut1, NPar1, ParData1, WithMagCC1, WithMagFC1,
+             !Stream, HeaderSize1, NPatchTotal1 );
+   LoadData( patch2, FileName_In2, WithPot2, WithParDens2, WithPar2, NParVarOut2, NPar2, ParData2, WithMagCC2, WithMagFC2,
+             !Stream, HeaderSize2, NPatchTotal2 );
 
-   CompareGridData();
+   if ( Stream )  CompareGridData_Stream();
+   else           CompareGridData();
    CompareParticleData();
 
    Aux_DeallocateArray2D( ParData1 );
@@ -26,7 +26,10 @@ typedef float  real;
 
 
 // patch size (number of cells of a single patch in the x/y/z directions)
+// --> must match the PATCH_SIZE adopted by GAMER (which can be set in the Makefile)
+#ifndef PATCH_SIZE
 #define PATCH_SIZE         8
+#endif
 #define PS1                PATCH_SIZE
 #define PS1P1              ( PS1 + 1 )
 
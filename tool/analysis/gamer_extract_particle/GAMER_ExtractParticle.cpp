@@ -0,0 +1,1045 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+#include <stdarg.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/time.h>
+#include "hdf5.h"
+
+#ifdef OPENMP
+#  include <omp.h>
+#endif
+
+#define ERROR_INFO         __FILE__, __LINE__, __FUNCTION__
+
+#define MAX_STRING         512
+#define MAX_NCUT           8         // maximum number of attribute cuts (-a)
+#define NPATCH_BLOCK       1048576   // number of patches loaded at a time when scanning the tree
+#define NPAR_PIECE         262144    // maximum number of particles read by a single pread() call
+#define NPAR_OUT_CHUNK     1048576   // maximum HDF5 chunk size of the output datasets
+
+#define MIN( a, b )        (  ( (a) < (b) ) ? (a) : (b)  )
+#define MAX( a, b )        (  ( (a) > (b) ) ? (a) : (b)  )
+
+
+// contiguous range of particles on disk belonging to the selected patches
+struct ParRange_t
+{
+   long Start;       // index of the first particle in the "Particle" datasets
+   long NPar;        // number of particles
+   bool Inside;      // all patches lie inside the target box --> no position check is required
+};
+
+// contiguous piece of the particles loaded in one chunk
+struct Piece_t
+{
+   long Src;         // index of the first particle on disk
+   long Dst;         // index of the first particle in the chunk buffer
+   long NPar;        // number of particles
+};
+
+// particle attribute stored in the input file
+struct ParAtt_t
+{
+   char   Name[MAX_STRING];
+   hid_t  SetID_In;  // input dataset
+   hid_t  SetID_Out; // output dataset
+   hid_t  TypeID;    // native memory datatype
+   size_t Size;      // number of bytes per element
+   long   Offset;    // file offset for the raw reads (-1 --> use H5Dread)
+   bool   Select;    // required by the selection (i.e., positions and attributes in "-a")
+   bool   Loaded;    // already loaded for the current chunk
+   char  *Buf;       // chunk buffer for the attributes required by the selection (NULL --> use the shared buffer)
+};
+
+// attribute cut (-a Name:Min:Max)
+struct ParCut_t
+{
+   char   Name[MAX_STRING];
+   double Min, Max;
+   int    AttIdx;
+};
+
+
+void ReadOption( int argc, char **argv );
+void CheckParameter();
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+double GetTime();
+void LoadKeyInfo( const hid_t H5_SetID, const hid_t H5_TypeID, const char *Name, void *Ptr, const hid_t H5_MemTypeID );
+void GetRangeList( const hid_t H5_FileID, const int NLevel, const int PatchSize, const int *NPatch,
+                   const double *CellSize, const long NParTot );
+void AddRange( const long Start, const long NPar, const bool Inside );
+void OpenParAtt( const hid_t H5_FileID, const hid_t H5_GroupID_Out );
+void LoadParAtt( const ParAtt_t &Att, char *Buf, const int NPiece, const Piece_t *Piece );
+void AppendParAtt( const hid_t H5_SetID, const hid_t H5_TypeID, const long NOut, const long NSel, const void *Buf );
+void ExtractParticle( const hid_t H5_GroupID_Out, long &NLoadTot, long &NSelTot );
+
+
+char       *FileName_In = NULL, *FileName_Out = NULL;
+double      EdgeL[3]    = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+double      EdgeR[3]    = { +DBL_MAX, +DBL_MAX, +DBL_MAX };
+int         LvMin       = 0;
+int         LvMax       = INT_MAX;
+long        ChunkSize   = 4194304;
+int         OMP_NThread = -1;
+bool        OutputGPID  = false;
+int         NCut        = 0;
+ParCut_t    Cut[MAX_NCUT];
+
+int         File_In     = -1;
+int         NAtt        = 0;
+ParAtt_t   *Att         = NULL;
+int         PosIdx[3]   = { -1, -1, -1 };
+long        NRange      = 0;
+long        MemRange    = 0;
+ParRange_t *Range       = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadOption
+// Description :  Read options from the command line
+//-------------------------------------------------------------------------------------------------------
+void ReadOption( int argc, char **argv )
+{
+
+   int c;
+
+   while( (c = getopt(argc, argv, "hgi:o:x:y:z:X:Y:Z:l:L:a:n:t:")) != -1 )
+      switch(c)
+      {
+         case 'i': FileName_In  = optarg;
+                   break;
+         case 'o': FileName_Out = optarg;
+                   break;
+         case 'x': EdgeL[0]     = atof(optarg);
+                   break;
+         case 'y': EdgeL[1]     = atof(optarg);
+                   break;
+         case 'z': EdgeL[2]     = atof(optarg);
+                   break;
+         case 'X': EdgeR[0]     = atof(optarg);
+                   break;
+         case 'Y': EdgeR[1]     = atof(optarg);
+                   break;
+         case 'Z': EdgeR[2]     = atof(optarg);
+                   break;
+         case 'l': LvMin        = atoi(optarg);
+                   break;
+         case 'L': LvMax        = atoi(optarg);
+                   break;
+         case 'n': ChunkSize    = atol(optarg);
+                   break;
+         case 't': OMP_NThread  = atoi(optarg);
+                   break;
+         case 'g': OutputGPID   = true;
+                   break;
+         case 'a':
+         {
+            if ( NCut >= MAX_NCUT )
+               Aux_Error( ERROR_INFO, "number of attribute cuts exceeds the limit (%d) !!\n", MAX_NCUT );
+
+            char *Sep1 = strchr( optarg, ':' );
+            char *Sep2 = ( Sep1 == NULL ) ? NULL : strchr( Sep1+1, ':' );
+
+            if ( Sep2 == NULL  ||  Sep1-optarg >= MAX_STRING )
+               Aux_Error( ERROR_INFO, "incorrect format of the attribute cut \"%s\" (Name:Min:Max) !!\n", optarg );
+
+            strncpy( Cut[NCut].Name, optarg, Sep1-optarg );
+            Cut[NCut].Name[ Sep1-optarg ] = '\0';
+            Cut[NCut].Min    = ( Sep1[1] == ':'  ) ? -DBL_MAX : atof( Sep1+1 );
+            Cut[NCut].Max    = ( Sep2[1] == '\0' ) ? +DBL_MAX : atof( Sep2+1 );
+            Cut[NCut].AttIdx = -1;
+            NCut ++;
+            break;
+         }
+         case 'h':
+         case '?': fprintf( stderr, "\nusage: %s [-h (for help)] [-i input HDF5 snapshot] [-o output HDF5 file]\n", argv[0] );
+                   fprintf( stderr, "          [-x/y/z left edge of the target box [-inf]] [-X/Y/Z right edge of the target box [+inf]]\n" );
+                   fprintf( stderr, "          [-l/L minimum/maximum level of the home patches [0/NLevel-1]]\n" );
+                   fprintf( stderr, "          [-a attribute cut Name:Min:Max (e.g., ParMass:1.0e-3:, up to %d cuts) [none]]\n", MAX_NCUT );
+                   fprintf( stderr, "          [-g (also store the particle indices in the input file as \"ParGID\") [off]]\n" );
+                   fprintf( stderr, "          [-n number of particles loaded per chunk [4194304]]\n" );
+                   fprintf( stderr, "          [-t number of OpenMP threads [omp_get_max_threads]]\n\n" );
+                   exit( 1 );
+      }
+
+} // FUNCTION : ReadOption
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckParameter
+// Description :  Verify the input parameters
+//-------------------------------------------------------------------------------------------------------
+void CheckParameter()
+{
+
+   if ( FileName_In == NULL )    Aux_Error( ERROR_INFO, "please provide the name of the input file (-i) !!\n" );
+
+   if ( FileName_Out == NULL )   Aux_Error( ERROR_INFO, "please provide the name of the output file (-o) !!\n" );
+
+   if ( access( FileName_Out, F_OK ) == 0 )
+      Aux_Error( ERROR_INFO, "output file \"%s\" already exists !!\n", FileName_Out );
+
+   for (int d=0; d<3; d++)
+      if ( EdgeL[d] >= EdgeR[d] )
+         Aux_Error( ERROR_INFO, "left edge (%14.7e) >= right edge (%14.7e) along %c !!\n", EdgeL[d], EdgeR[d], 'x'+d );
+
+   if ( LvMin < 0  ||  LvMin > LvMax )
+      Aux_Error( ERROR_INFO, "incorrect level range (%d ~ %d) !!\n", LvMin, LvMax );
+
+   if ( ChunkSize <= 0 )   Aux_Error( ERROR_INFO, "ChunkSize (%ld) <= 0 !!\n", ChunkSize );
+
+   for (int c=0; c<NCut; c++)
+      if ( Cut[c].Min > Cut[c].Max )
+         Aux_Error( ERROR_INFO, "Min (%14.7e) > Max (%14.7e) for the attribute cut \"%s\" !!\n",
+                    Cut[c].Min, Cut[c].Max, Cut[c].Name );
+
+#  ifdef OPENMP
+   const int OMP_Max_NThread = omp_get_max_threads();
+
+   if ( OMP_NThread <= 0 )
+   {
+      OMP_NThread = OMP_Max_NThread;
+      fprintf( stdout, "NOTE : parameter \"%s\" is set to the default value = %d\n", "OMP_NThread", OMP_NThread );
+   }
+
+   omp_set_num_threads( OMP_NThread );
+#  else
+   OMP_NThread = 1;
+#  endif
+
+} // FUNCTION : CheckParameter
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadKeyInfo
+// Description :  Load a single member of the compound dataset "Info/KeyInfo"
+//
+// Parameter   :  H5_SetID     : HDF5 dataset ID of "KeyInfo"
+//                H5_TypeID    : HDF5 datatype ID of "KeyInfo"
+//                Name         : Name of the target member
+//                Ptr          : Pointer to store the loaded data
+//                H5_MemTypeID : HDF5 memory datatype of the target member
+//-------------------------------------------------------------------------------------------------------
+void LoadKeyInfo( const hid_t H5_SetID, const hid_t H5_TypeID, const char *Name, void *Ptr, const hid_t H5_MemTypeID )
+{
+
+   if ( H5Tget_member_index( H5_TypeID, Name ) < 0 )
+      Aux_Error( ERROR_INFO, "target member \"%s\" does not exist in \"KeyInfo\" !!\n", Name );
+
+   const hid_t H5_TypeID_Load = H5Tcreate( H5T_COMPOUND, H5Tget_size(H5_MemTypeID) );
+   H5Tinsert( H5_TypeID_Load, Name, 0, H5_MemTypeID );
+
+   if ( H5Dread( H5_SetID, H5_TypeID_Load, H5S_ALL, H5S_ALL, H5P_DEFAULT, Ptr ) < 0 )
+      Aux_Error( ERROR_INFO, "failed to load the member \"%s\" in \"KeyInfo\" !!\n", Name );
+
+   H5Tclose( H5_TypeID_Load );
+
+} // FUNCTION : LoadKeyInfo
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AddRange
+// Description :  Append a contiguous range of particles to the list "Range"
+//
+// Note        :  Merge with the last range if they are adjacent on disk and share the same "Inside" flag
+//
+// Parameter   :  Start  : Index of the first particle on disk
+//                NPar   : Number of particles
+//                Inside : Whether the particles lie inside the target box for sure
+//-------------------------------------------------------------------------------------------------------
+void AddRange( const long Start, const long NPar, const bool Inside )
+{
+
+   if ( NRange > 0 )
+   {
+      ParRange_t &Last = Range[ NRange-1 ];
+
+      if ( Last.Start+Last.NPar == Start  &&  Last.Inside == Inside )
+      {
+         Last.NPar += NPar;
+         return;
+      }
+   }
+
+   if ( NRange == MemRange )
+   {
+      MemRange = MAX( 2*MemRange, 1024L );
+      Range    = (ParRange_t*)realloc( Range, MemRange*sizeof(ParRange_t) );
+
+      if ( Range == NULL )    Aux_Error( ERROR_INFO, "failed to allocate memory for %ld ranges !!\n", MemRange );
+   }
+
+   Range[NRange].Start  = Start;
+   Range[NRange].NPar   = NPar;
+   Range[NRange].Inside = Inside;
+   NRange ++;
+
+} // FUNCTION : AddRange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetRangeList
+// Description :  Construct the list of particle ranges on disk associated with the patches overlapping
+//                the target box and within the target levels
+//
+// Note        :  1. Particles are stored in the order of the GIDs of their home patches, and thus the prefix
+//                   sum of "Tree/NPar" gives the offset of each patch in the "Particle" datasets
+//                2. "Tree/Corner" and "Tree/NPar" are loaded NPATCH_BLOCK patches at a time so that the
+//                   memory consumption does not scale with the number of patches
+//
+// Parameter   :  H5_FileID : HDF5 file ID of the input file
+//                NLevel    : Number of AMR levels in the input file
+//                PatchSize : Number of cells along each direction in a single patch
+//                NPatch    : Number of patches at each level
+//                CellSize  : Cell size at each level
+//                NParTot   : Total number of particles for validation
+//-------------------------------------------------------------------------------------------------------
+void GetRangeList( const hid_t H5_FileID, const int NLevel, const int PatchSize, const int *NPatch,
+                   const double *CellSize, const long NParTot )
+{
+
+   hid_t   H5_SetID_Cr, H5_SetID_NPar, H5_AttID_Cvt2Phy, H5_SpaceID_Cr, H5_SpaceID_NPar, H5_MemID_Cr, H5_MemID_NPar;
+   hsize_t H5_Offset[2], H5_Count[2];
+   double  Cvt2Phy;
+
+   H5_SetID_Cr   = H5Dopen( H5_FileID, "Tree/Corner", H5P_DEFAULT );
+   H5_SetID_NPar = H5Dopen( H5_FileID, "Tree/NPar",   H5P_DEFAULT );
+   if ( H5_SetID_Cr   < 0 )    Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Corner" );
+   if ( H5_SetID_NPar < 0 )    Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/NPar" );
+
+   H5_AttID_Cvt2Phy = H5Aopen( H5_SetID_Cr, "Cvt2Phy", H5P_DEFAULT );
+   if ( H5_AttID_Cvt2Phy < 0 )   Aux_Error( ERROR_INFO, "failed to open the attribute \"%s\" !!\n", "Cvt2Phy" );
+   H5Aread( H5_AttID_Cvt2Phy, H5T_NATIVE_DOUBLE, &Cvt2Phy );
+   H5Aclose( H5_AttID_Cvt2Phy );
+
+   H5_SpaceID_Cr   = H5Dget_space( H5_SetID_Cr   );
+   H5_SpaceID_NPar = H5Dget_space( H5_SetID_NPar );
+
+   long NPatchAllLv = 0;
+   long GID_LvStart[NLevel+1];
+
+   for (int lv=0; lv<NLevel; lv++)
+   {
+      GID_LvStart[lv] = NPatchAllLv;
+      NPatchAllLv    += NPatch[lv];
+   }
+   GID_LvStart[NLevel] = NPatchAllLv;
+
+   int (*Corner)[3] = new int [NPATCH_BLOCK][3];
+   int  *NParList   = new int [NPATCH_BLOCK];
+   long  ParStart   = 0;
+   int   lv         = 0;
+
+   for (long GID0=0; GID0<NPatchAllLv; GID0+=NPATCH_BLOCK)
+   {
+      const long NLoad = MIN( (long)NPATCH_BLOCK, NPatchAllLv-GID0 );
+
+      H5_Offset[0] = GID0;    H5_Offset[1] = 0;
+      H5_Count [0] = NLoad;   H5_Count [1] = 3;
+
+      H5_MemID_Cr   = H5Screate_simple( 2, H5_Count, NULL );
+      H5_MemID_NPar = H5Screate_simple( 1, H5_Count, NULL );
+
+      H5Sselect_hyperslab( H5_SpaceID_Cr,   H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+      H5Sselect_hyperslab( H5_SpaceID_NPar, H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+
+      if ( H5Dread( H5_SetID_Cr,   H5T_NATIVE_INT, H5_MemID_Cr,   H5_SpaceID_Cr,   H5P_DEFAULT, Corner   ) < 0 )
+         Aux_Error( ERROR_INFO, "failed to load the dataset \"%s\" !!\n", "Tree/Corner" );
+      if ( H5Dread( H5_SetID_NPar, H5T_NATIVE_INT, H5_MemID_NPar, H5_SpaceID_NPar, H5P_DEFAULT, NParList ) < 0 )
+         Aux_Error( ERROR_INFO, "failed to load the dataset \"%s\" !!\n", "Tree/NPar" );
+
+      H5Sclose( H5_MemID_Cr   );
+      H5Sclose( H5_MemID_NPar );
+
+      for (long t=0; t<NLoad; t++)
+      {
+         const long GID  = GID0 + t;
+         const int  NPar = NParList[t];
+
+         while ( GID >= GID_LvStart[lv+1] )  lv ++;
+
+         if ( NPar == 0 )  continue;
+
+         if ( lv >= LvMin  &&  lv <= LvMax )
+         {
+            const double PatchWidth = PatchSize*CellSize[lv];
+
+            bool Overlap = true, Inside = true;
+
+            for (int d=0; d<3; d++)
+            {
+               const double PatchL = Corner[t][d]*Cvt2Phy;
+               const double PatchR = PatchL + PatchWidth;
+
+               if ( PatchR <= EdgeL[d]  ||  PatchL >= EdgeR[d] )  Overlap = false;
+               if ( PatchL <  EdgeL[d]  ||  PatchR >  EdgeR[d] )  Inside  = false;
+            }
+
+            if ( Overlap )    AddRange( ParStart, NPar, Inside );
+         }
+
+         ParStart += NPar;
+      } // for (long t=0; t<NLoad; t++)
+   } // for (long GID0=0; GID0<NPatchAllLv; GID0+=NPATCH_BLOCK)
+
+   if ( ParStart != NParTot )
+      Aux_Error( ERROR_INFO, "sum of \"Tree/NPar\" (%ld) != Par_NPar (%ld) !!\n", ParStart, NParTot );
+
+   delete [] Corner;
+   delete [] NParList;
+
+   H5Sclose( H5_SpaceID_Cr   );
+   H5Sclose( H5_SpaceID_NPar );
+   H5Dclose( H5_SetID_Cr     );
+   H5Dclose( H5_SetID_NPar   );
+
+} // FUNCTION : GetRangeList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  OpenParAtt
+// Description :  Open all particle attributes in the input file and create the corresponding output datasets
+//
+// Note        :  1. Attributes stored in contiguous datasets with the native byte order are read directly
+//                   from their file offsets by OpenMP threads (see LoadParAtt())
+//                   --> Chunked (e.g., compressed) datasets are read by H5Dread instead
+//                2. Output datasets are extendible and share the datatypes of the input datasets
+//
+// Parameter   :  H5_FileID      : HDF5 file ID of the input file
+//                H5_GroupID_Out : HDF5 group ID of "Particle" in the output file
+//-------------------------------------------------------------------------------------------------------
+void OpenParAtt( const hid_t H5_FileID, const hid_t H5_GroupID_Out )
+{
+
+   const hid_t H5_GroupID_In = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
+   if ( H5_GroupID_In < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+
+   H5G_info_t H5_GroupInfo;
+   H5Gget_info( H5_GroupID_In, &H5_GroupInfo );
+
+   NAtt = H5_GroupInfo.nlinks;
+   Att  = new ParAtt_t [NAtt];
+
+   const hsize_t H5_Dims_Out[1]    = { 0 };
+   const hsize_t H5_MaxDims_Out[1] = { H5S_UNLIMITED };
+   const hsize_t H5_Chunk_Out[1]   = { (hsize_t)MIN( ChunkSize, (long)NPAR_OUT_CHUNK ) };
+   const hid_t   H5_SpaceID_Out    = H5Screate_simple( 1, H5_Dims_Out, H5_MaxDims_Out );
+   const hid_t   H5_PropID_Out     = H5Pcreate( H5P_DATASET_CREATE );
+   H5Pset_chunk( H5_PropID_Out, 1, H5_Chunk_Out );
+
+   for (int v=0; v<NAtt; v++)
+   {
+      H5Lget_name_by_idx( H5_GroupID_In, ".", H5_INDEX_NAME, H5_ITER_INC, v, Att[v].Name, MAX_STRING, H5P_DEFAULT );
+
+      Att[v].SetID_In = H5Dopen( H5_GroupID_In, Att[v].Name, H5P_DEFAULT );
+      if ( Att[v].SetID_In < 0 )    Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", Att[v].Name );
+
+      const hid_t H5_TypeID_File = H5Dget_type( Att[v].SetID_In );
+      Att[v].TypeID = H5Tget_native_type( H5_TypeID_File, H5T_DIR_ASCEND );
+      Att[v].Size   = H5Tget_size( Att[v].TypeID );
+      Att[v].Select = false;
+      Att[v].Buf    = NULL;
+
+//    raw reads require the file and memory datatypes to be identical
+      const haddr_t H5_Addr = H5Dget_offset( Att[v].SetID_In );
+      Att[v].Offset = ( H5_Addr != HADDR_UNDEF  &&  H5Tequal( H5_TypeID_File, Att[v].TypeID ) > 0 ) ? (long)H5_Addr : -1L;
+
+      Att[v].SetID_Out = H5Dcreate( H5_GroupID_Out, Att[v].Name, H5_TypeID_File, H5_SpaceID_Out,
+                                    H5P_DEFAULT, H5_PropID_Out, H5P_DEFAULT );
+      if ( Att[v].SetID_Out < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", Att[v].Name );
+
+      H5Tclose( H5_TypeID_File );
+
+      if      ( strcmp( Att[v].Name, "ParPosX" ) == 0 )   PosIdx[0] = v;
+      else if ( strcmp( Att[v].Name, "ParPosY" ) == 0 )   PosIdx[1] = v;
+      else if ( strcmp( Att[v].Name, "ParPosZ" ) == 0 )   PosIdx[2] = v;
+
+      for (int c=0; c<NCut; c++)
+         if ( strcmp( Att[v].Name, Cut[c].Name ) == 0 )   Cut[c].AttIdx = v;
+   } // for (int v=0; v<NAtt; v++)
+
+   H5Pclose( H5_PropID_Out );
+   H5Sclose( H5_SpaceID_Out );
+   H5Gclose( H5_GroupID_In );
+
+
+// check and allocate the buffers of the attributes required by the selection
+   for (int d=0; d<3; d++)
+   {
+      if ( PosIdx[d] < 0 )    Aux_Error( ERROR_INFO, "particle attribute \"ParPos%c\" does not exist !!\n", 'X'+d );
+
+      Att[ PosIdx[d] ].Select = true;
+   }
+
+   for (int c=0; c<NCut; c++)
+   {
+      if ( Cut[c].AttIdx < 0 )
+         Aux_Error( ERROR_INFO, "particle attribute \"%s\" in \"-a\" does not exist !!\n", Cut[c].Name );
+
+      Att[ Cut[c].AttIdx ].Select = true;
+   }
+
+   for (int v=0; v<NAtt; v++)
+   {
+      if ( !Att[v].Select )   continue;
+
+      if ( H5Tget_class( Att[v].TypeID ) != H5T_FLOAT  ||  ( Att[v].Size != sizeof(float)  &&  Att[v].Size != sizeof(double) ) )
+         Aux_Error( ERROR_INFO, "particle attribute \"%s\" used for selection is not float or double !!\n", Att[v].Name );
+
+      Att[v].Buf = new char [ ChunkSize*Att[v].Size ];
+   }
+
+} // FUNCTION : OpenParAtt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadParAtt
+// Description :  Load a particle attribute of all pieces in the current chunk
+//
+// Note        :  1. Pieces are read concurrently by OpenMP threads with pread() if the raw file offset of
+//                   the dataset is available
+//                   --> The HDF5 library is not invoked inside the OpenMP parallel region
+//                2. Otherwise, each piece is read by H5Dread
+//
+// Parameter   :  Att    : Target particle attribute
+//                Buf    : Buffer to store the loaded data
+//                NPiece : Number of pieces
+//                Piece  : Piece list
+//-------------------------------------------------------------------------------------------------------
+void LoadParAtt( const ParAtt_t &Att, char *Buf, const int NPiece, const Piece_t *Piece )
+{
+
+   if ( Att.Offset >= 0 )
+   {
+#     pragma omp parallel for schedule( dynamic )
+      for (int t=0; t<NPiece; t++)
+      {
+         char  *Ptr    = Buf + Piece[t].Dst*Att.Size;
+         long   NByte  = Piece[t].NPar*Att.Size;
+         off_t  Offset = Att.Offset + Piece[t].Src*Att.Size;
+
+         while ( NByte > 0 )
+         {
+            const ssize_t NRead = pread( File_In, Ptr, NByte, Offset );
+
+            if ( NRead <= 0 )    Aux_Error( ERROR_INFO, "failed to read \"%s\" from \"%s\" !!\n", Att.Name, FileName_In );
+
+            Ptr    += NRead;
+            NByte  -= NRead;
+            Offset += NRead;
+         }
+      }
+   } // if ( Att.Offset >= 0 )
+
+   else
+   {
+      const hid_t H5_SpaceID = H5Dget_space( Att.SetID_In );
+
+      for (int t=0; t<NPiece; t++)
+      {
+         const hsize_t H5_Offset[1] = { (hsize_t)Piece[t].Src  };
+         const hsize_t H5_Count [1] = { (hsize_t)Piece[t].NPar };
+         const hid_t   H5_MemID     = H5Screate_simple( 1, H5_Count, NULL );
+
+         H5Sselect_hyperslab( H5_SpaceID, H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+
+         if ( H5Dread( Att.SetID_In, Att.TypeID, H5_MemID, H5_SpaceID, H5P_DEFAULT, Buf+Piece[t].Dst*Att.Size ) < 0 )
+            Aux_Error( ERROR_INFO, "failed to read \"%s\" from \"%s\" !!\n", Att.Name, FileName_In );
+
+         H5Sclose( H5_MemID );
+      }
+
+      H5Sclose( H5_SpaceID );
+   } // if ( Att.Offset >= 0 ) ... else ...
+
+} // FUNCTION : LoadParAtt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AppendParAtt
+// Description :  Append the selected particles to an extendible output dataset
+//
+// Parameter   :  H5_SetID  : HDF5 dataset ID of the output dataset
+//                H5_TypeID : HDF5 memory datatype of the input buffer
+//                NOut      : Number of particles already stored in the dataset
+//                NSel      : Number of particles to be appended
+//                Buf       : Input buffer
+//-------------------------------------------------------------------------------------------------------
+void AppendParAtt( const hid_t H5_SetID, const hid_t H5_TypeID, const long NOut, const long NSel, const void *Buf )
+{
+
+   const hsize_t H5_Dims  [1] = { (hsize_t)(NOut+NSel) };
+   const hsize_t H5_Offset[1] = { (hsize_t)NOut };
+   const hsize_t H5_Count [1] = { (hsize_t)NSel };
+
+   H5Dset_extent( H5_SetID, H5_Dims );
+
+   const hid_t H5_SpaceID = H5Dget_space( H5_SetID );
+   const hid_t H5_MemID   = H5Screate_simple( 1, H5_Count, NULL );
+
+   H5Sselect_hyperslab( H5_SpaceID, H5S_SELECT_SET, H5_Offset, NULL, H5_Count, NULL );
+
+   if ( H5Dwrite( H5_SetID, H5_TypeID, H5_MemID, H5_SpaceID, H5P_DEFAULT, Buf ) < 0 )
+      Aux_Error( ERROR_INFO, "failed to write the output file \"%s\" !!\n", FileName_Out );
+
+   H5Sclose( H5_MemID );
+   H5Sclose( H5_SpaceID );
+
+} // FUNCTION : AppendParAtt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetValue
+// Description :  Return the value of a floating-point particle attribute in double precision
+//-------------------------------------------------------------------------------------------------------
+inline double GetValue( const ParAtt_t &Att, const long p )
+{
+   return ( Att.Size == sizeof(float) ) ? (double)( (float*)Att.Buf )[p] : ( (double*)Att.Buf )[p];
+}
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ExtractParticle
+// Description :  Extract the selected particles chunk by chunk
+//
+// Note        :  1. Each chunk loads at most "ChunkSize" particles from the ranges in "Range"
+//                2. Positions are checked only for the ranges not entirely inside the target box, and the
+//                   remaining attributes are loaded only if at least one particle in the chunk is selected
+//
+// Parameter   :  H5_GroupID_Out : HDF5 group ID of "Particle" in the output file
+//                NLoadTot       : Total number of particles loaded
+//                NSelTot        : Total number of particles selected
+//-------------------------------------------------------------------------------------------------------
+void ExtractParticle( const hid_t H5_GroupID_Out, long &NLoadTot, long &NSelTot )
+{
+
+   hid_t H5_SetID_GPID = -1;
+
+   if ( OutputGPID )
+   {
+      const hsize_t H5_Dims   [1] = { 0 };
+      const hsize_t H5_MaxDims[1] = { H5S_UNLIMITED };
+      const hsize_t H5_Chunk  [1] = { (hsize_t)MIN( ChunkSize, (long)NPAR_OUT_CHUNK ) };
+      const hid_t   H5_SpaceID    = H5Screate_simple( 1, H5_Dims, H5_MaxDims );
+      const hid_t   H5_PropID     = H5Pcreate( H5P_DATASET_CREATE );
+      H5Pset_chunk( H5_PropID, 1, H5_Chunk );
+
+      H5_SetID_GPID = H5Dcreate( H5_GroupID_Out, "ParGID", H5T_NATIVE_LONG, H5_SpaceID, H5P_DEFAULT, H5_PropID, H5P_DEFAULT );
+      if ( H5_SetID_GPID < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "ParGID" );
+
+      H5Pclose( H5_PropID );
+      H5Sclose( H5_SpaceID );
+   }
+
+   size_t MaxSize = sizeof(long);
+   for (int v=0; v<NAtt; v++)    MaxSize = MAX( MaxSize, Att[v].Size );
+
+   const long MaxNPiece = NRange + ChunkSize/NPAR_PIECE + 1;
+
+   Piece_t *Piece   = new Piece_t [MaxNPiece];
+   char    *Mask    = new char    [ChunkSize];
+   long    *SelIdx  = new long    [ChunkSize];
+   long    *SelGID  = ( OutputGPID ) ? new long [ChunkSize] : NULL;
+   char    *LoadBuf = new char    [ ChunkSize*MaxSize ];
+   char    *SelBuf  = new char    [ ChunkSize*MaxSize ];
+
+   long RangeIdx = 0, RangeDisp = 0, NOut = 0, NRemain = 0;
+   int  Progress = 0;
+
+   for (long r=0; r<NRange; r++)    NRemain += Range[r].NPar;
+
+   const long NParInRange = NRemain;
+
+   NLoadTot = 0;
+   NSelTot  = 0;
+
+   while ( RangeIdx < NRange )
+   {
+//    1. collect the pieces of this chunk and initialize the selection mask
+//       --> Mask = 1/0/2 : selected/not selected/position check required
+      int  NPiece    = 0;
+      long NLoad     = 0;
+      bool CheckPos  = false;
+
+      while ( RangeIdx < NRange  &&  NLoad < ChunkSize )
+      {
+         const ParRange_t &R = Range[RangeIdx];
+         const long NPar     = MIN( R.NPar-RangeDisp, MIN( ChunkSize-NLoad, (long)NPAR_PIECE ) );
+
+         Piece[NPiece].Src  = R.Start + RangeDisp;
+         Piece[NPiece].Dst  = NLoad;
+         Piece[NPiece].NPar = NPar;
+         NPiece ++;
+
+         memset( Mask+NLoad, ( R.Inside ) ? 1 : 2, NPar );
+         if ( !R.Inside )  CheckPos = true;
+
+         NLoad     += NPar;
+         RangeDisp += NPar;
+
+         if ( RangeDisp == R.NPar )
+         {
+            RangeIdx  ++;
+            RangeDisp = 0;
+         }
+      }
+
+
+//    2. load the attributes required by the selection
+//       --> positions are not required if all ranges in this chunk lie inside the target box
+      for (int v=0; v<NAtt; v++)    Att[v].Loaded = false;
+
+      for (int c=0; c<NCut; c++)
+      {
+         ParAtt_t &A = Att[ Cut[c].AttIdx ];
+
+         if ( !A.Loaded )
+         {
+            LoadParAtt( A, A.Buf, NPiece, Piece );
+            A.Loaded = true;
+         }
+      }
+
+      if ( CheckPos )
+      for (int d=0; d<3; d++)
+      {
+         ParAtt_t &A = Att[ PosIdx[d] ];
+
+         if ( !A.Loaded )
+         {
+            LoadParAtt( A, A.Buf, NPiece, Piece );
+            A.Loaded = true;
+         }
+      }
+
+
+//    3. apply the box and attribute cuts
+      if ( CheckPos  ||  NCut > 0 )
+      {
+#        pragma omp parallel for schedule( static )
+         for (long p=0; p<NLoad; p++)
+         {
+            if ( Mask[p] == 2 )
+            {
+               Mask[p] = 1;
+
+               for (int d=0; d<3; d++)
+               {
+                  const double Pos = GetValue( Att[ PosIdx[d] ], p );
+
+                  if ( Pos < EdgeL[d]  ||  Pos >= EdgeR[d] )
+                  {
+                     Mask[p] = 0;
+                     break;
+                  }
+               }
+            }
+
+            if ( Mask[p] )
+            for (int c=0; c<NCut; c++)
+            {
+               const double Value = GetValue( Att[ Cut[c].AttIdx ], p );
+
+               if ( Value < Cut[c].Min  ||  Value > Cut[c].Max )
+               {
+                  Mask[p] = 0;
+                  break;
+               }
+            }
+         } // for (long p=0; p<NLoad; p++)
+      } // if ( CheckPos  ||  NCut > 0 )
+
+
+//    4. record the indices of the selected particles
+      long NSel = 0;
+
+      for (int t=0; t<NPiece; t++)
+      for (long p=0; p<Piece[t].NPar; p++)
+      {
+         const long Idx = Piece[t].Dst + p;
+
+         if ( Mask[Idx] )
+         {
+            if ( OutputGPID )    SelGID[NSel] = Piece[t].Src + p;
+
+            SelIdx[ NSel ++ ] = Idx;
+         }
+      }
+
+
+//    5. load, compact, and store all attributes
+//       --> skip loading if no particle is selected
+      if ( NSel > 0 )
+      {
+         for (int v=0; v<NAtt; v++)
+         {
+            char        *Buf  = ( Att[v].Select ) ? Att[v].Buf : LoadBuf;
+            const size_t Size = Att[v].Size;
+
+            if ( !Att[v].Loaded )   LoadParAtt( Att[v], Buf, NPiece, Piece );
+
+            if ( NSel < NLoad )
+            {
+#              pragma omp parallel for schedule( static )
+               for (long s=0; s<NSel; s++)   memcpy( SelBuf+s*Size, Buf+SelIdx[s]*Size, Size );
+
+               Buf = SelBuf;
+            }
+
+            AppendParAtt( Att[v].SetID_Out, Att[v].TypeID, NOut, NSel, Buf );
+         } // for (int v=0; v<NAtt; v++)
+
+         if ( OutputGPID )    AppendParAtt( H5_SetID_GPID, H5T_NATIVE_LONG, NOut, NSel, SelGID );
+
+         NOut += NSel;
+      } // if ( NSel > 0 )
+
+      NLoadTot += NLoad;
+      NSelTot  += NSel;
+      NRemain  -= NLoad;
+
+
+//    6. report the progress every 10 percent
+      while ( Progress < 10  &&  NRemain <= (10-Progress-1)*NParInRange/10 )
+      {
+         Progress ++;
+         fprintf( stdout, "   %3d%% completed (loaded %ld, selected %ld)\n", 10*Progress, NLoadTot, NSelTot );
+         fflush( stdout );
+      }
+   } // while ( RangeIdx < NRange )
+
+   if ( OutputGPID )    H5Dclose( H5_SetID_GPID );
+
+   delete [] Piece;
+   delete [] Mask;
+   delete [] SelIdx;
+   delete [] SelGID;
+   delete [] LoadBuf;
+   delete [] SelBuf;
+
+} // FUNCTION : ExtractParticle
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Error
+// Description :  Output the error messages and force the program to be terminated
+//
+// Note        :  Use the variable argument lists provided in "cstdarg"
+//
+// Parameter   :  File     : Name of the file where error occurs
+//                Line     : Line number where error occurs
+//                Func     : Name of the function where error occurs
+//                Format   : Output format
+//                ...      : Arguments in vfprintf
+//-------------------------------------------------------------------------------------------------------
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... )
+{
+
+// flush all previous messages
+   fflush( stdout ); fflush( stdout ); fflush( stdout );
+   fflush( stderr ); fflush( stderr ); fflush( stderr );
+
+
+// output error messages
+   va_list Arg;
+   va_start( Arg, Format );
+
+   fprintf ( stderr, "********************************************************************************\n" );
+   fprintf ( stderr, "ERROR : " );
+   vfprintf    ( stderr, Format, Arg );
+   fprintf ( stderr, "        file <%s>, line <%d>, function <%s>\n", File, Line, Func );
+   fprintf ( stderr, "********************************************************************************\n" );
+
+   va_end( Arg );
+
+
+// terminate the program
+   exit( EXIT_FAILURE );
+
+} // FUNCTION : Aux_Error
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetTime
+// Description :  Return the wall-clock time in seconds
+//-------------------------------------------------------------------------------------------------------
+double GetTime()
+{
+
+   timeval tv;
+   gettimeofday( &tv, NULL );
+
+   return tv.tv_sec + 1.0e-6*tv.tv_usec;
+
+} // FUNCTION : GetTime
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char ** argv )
+{
+
+   ReadOption( argc, argv );
+
+   CheckParameter();
+
+   const double Time0 = GetTime();
+
+
+// 1. load the simulation information
+   const hid_t H5_FileID = H5Fopen( FileName_In, H5F_ACC_RDONLY, H5P_DEFAULT );
+   if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the input file \"%s\" !!\n", FileName_In );
+
+   if ( H5Lexists( H5_FileID, "Particle", H5P_DEFAULT ) <= 0 )
+      Aux_Error( ERROR_INFO, "no particle data can be found in \"%s\" !!\n", FileName_In );
+
+   const hid_t H5_SetID_KeyInfo  = H5Dopen( H5_FileID, "Info/KeyInfo", H5P_DEFAULT );
+   if ( H5_SetID_KeyInfo < 0 )   Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Info/KeyInfo" );
+   const hid_t H5_TypeID_KeyInfo = H5Dget_type( H5_SetID_KeyInfo );
+
+   int    NLevel, PatchSize;
+   long   Step, NParTot;
+   double BoxSize[3];
+
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "NLevel",    &NLevel,    H5T_NATIVE_INT  );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "PatchSize", &PatchSize, H5T_NATIVE_INT  );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "Step",      &Step,      H5T_NATIVE_LONG );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "Par_NPar",  &NParTot,   H5T_NATIVE_LONG );
+
+   int    *NPatch   = new int    [NLevel];
+   double *CellSize = new double [NLevel];
+   double *Time     = new double [NLevel];
+
+   const hsize_t H5_Dims_NLv[1] = { (hsize_t)NLevel };
+   const hsize_t H5_Dims_3  [1] = { 3 };
+   const hid_t   H5_TypeID_NLvInt = H5Tarray_create( H5T_NATIVE_INT,    1, H5_Dims_NLv );
+   const hid_t   H5_TypeID_NLvDbl = H5Tarray_create( H5T_NATIVE_DOUBLE, 1, H5_Dims_NLv );
+   const hid_t   H5_TypeID_3Dbl   = H5Tarray_create( H5T_NATIVE_DOUBLE, 1, H5_Dims_3   );
+
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "NPatch",   NPatch,   H5_TypeID_NLvInt );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "CellSize", CellSize, H5_TypeID_NLvDbl );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "Time",     Time,     H5_TypeID_NLvDbl );
+   LoadKeyInfo( H5_SetID_KeyInfo, H5_TypeID_KeyInfo, "BoxSize",  BoxSize,  H5_TypeID_3Dbl   );
+
+   H5Tclose( H5_TypeID_NLvInt );
+   H5Tclose( H5_TypeID_NLvDbl );
+   H5Tclose( H5_TypeID_3Dbl   );
+   H5Tclose( H5_TypeID_KeyInfo );
+   H5Dclose( H5_SetID_KeyInfo );
+
+   LvMax = MIN( LvMax, NLevel-1 );
+
+   fprintf( stdout, "%-20s : %s\n",       "Input file",        FileName_In      );
+   fprintf( stdout, "%-20s : %20.14e\n",  "Time",              Time[0]          );
+   fprintf( stdout, "%-20s : %ld\n",      "Step",              Step             );
+   fprintf( stdout, "%-20s : %ld\n",      "# of particles",    NParTot          );
+   fprintf( stdout, "%-20s : %13.7e %13.7e %13.7e\n", "Box size", BoxSize[0], BoxSize[1], BoxSize[2] );
+   fprintf( stdout, "%-20s : [%13.7e, %13.7e) x [%13.7e, %13.7e) x [%13.7e, %13.7e)\n", "Target box",
+            EdgeL[0], EdgeR[0], EdgeL[1], EdgeR[1], EdgeL[2], EdgeR[2] );
+   fprintf( stdout, "%-20s : %d ~ %d\n",  "Target levels",     LvMin, LvMax     );
+   for (int c=0; c<NCut; c++)
+   fprintf( stdout, "%-20s : %13.7e <= %s <= %13.7e\n", "Attribute cut", Cut[c].Min, Cut[c].Name, Cut[c].Max );
+   fprintf( stdout, "%-20s : %ld\n",      "Chunk size",        ChunkSize        );
+   fprintf( stdout, "%-20s : %d\n",       "# of OpenMP threads", OMP_NThread    );
+
+
+// 2. find the particle ranges of the selected patches
+   GetRangeList( H5_FileID, NLevel, PatchSize, NPatch, CellSize, NParTot );
+
+   long NParInRange = 0;
+   for (long r=0; r<NRange; r++)    NParInRange += Range[r].NPar;
+
+   fprintf( stdout, "%-20s : %ld particles in %ld contiguous ranges\n", "Candidates", NParInRange, NRange );
+
+
+// 3. prepare the output file
+   const hid_t H5_FileID_Out = H5Fcreate( FileName_Out, H5F_ACC_EXCL, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_FileID_Out < 0 )   Aux_Error( ERROR_INFO, "failed to create the output file \"%s\" !!\n", FileName_Out );
+
+   const hid_t H5_GroupID_Out = H5Gcreate( H5_FileID_Out, "Particle", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+   if ( H5_GroupID_Out < 0 )  Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Particle" );
+
+   OpenParAtt( H5_FileID, H5_GroupID_Out );
+
+   int NRaw = 0;
+   for (int v=0; v<NAtt; v++)    if ( Att[v].Offset >= 0 )  NRaw ++;
+
+   fprintf( stdout, "%-20s : %d (%d read by pread)\n", "# of attributes", NAtt, NRaw );
+
+   File_In = open( FileName_In, O_RDONLY );
+   if ( File_In < 0 )   Aux_Error( ERROR_INFO, "failed to open the input file \"%s\" !!\n", FileName_In );
+
+
+// 4. extract particles
+   long NLoadTot, NSelTot;
+
+   ExtractParticle( H5_GroupID_Out, NLoadTot, NSelTot );
+
+
+// 5. record the simulation information as attributes of the root group
+   const hid_t H5_SpaceID_Scalar = H5Screate( H5S_SCALAR );
+   hid_t       H5_AttID;
+
+   H5_AttID = H5Acreate( H5_FileID_Out, "Time",     H5T_NATIVE_DOUBLE, H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT );
+   H5Awrite( H5_AttID, H5T_NATIVE_DOUBLE, &Time[0] );
+   H5Aclose( H5_AttID );
+
+   H5_AttID = H5Acreate( H5_FileID_Out, "Step",     H5T_NATIVE_LONG,   H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT );
+   H5Awrite( H5_AttID, H5T_NATIVE_LONG, &Step );
+   H5Aclose( H5_AttID );
+
+   H5_AttID = H5Acreate( H5_FileID_Out, "Par_NPar", H5T_NATIVE_LONG,   H5_SpaceID_Scalar, H5P_DEFAULT, H5P_DEFAULT );
+   H5Awrite( H5_AttID, H5T_NATIVE_LONG, &NSelTot );
+   H5Aclose( H5_AttID );
+
+   H5Sclose( H5_SpaceID_Scalar );
+
+
+// 6. clean up
+   close( File_In );
+
+   for (int v=0; v<NAtt; v++)
+   {
+      H5Dclose( Att[v].SetID_In  );
+      H5Dclose( Att[v].SetID_Out );
+      H5Tclose( Att[v].TypeID    );
+      delete [] Att[v].Buf;
+   }
+
+   H5Gclose( H5_GroupID_Out );
+   H5Fclose( H5_FileID_Out );
+   H5Fclose( H5_FileID );
+
+   delete [] Att;
+   delete [] NPatch;
+   delete [] CellSize;
+   delete [] Time;
+   free( Range );
+
+   fprintf( stdout, "%-20s : %ld loaded, %ld selected\n", "Particles", NLoadTot, NSelTot );
+   fprintf( stdout, "%-20s : %.3f s\n", "Elapsed time", GetTime()-Time0 );
+   fprintf( stdout, "Program terminated successfully\n" );
+
+   return 0;
+
+} // FUNCTION : main
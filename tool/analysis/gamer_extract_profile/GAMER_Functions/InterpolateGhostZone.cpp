@@ -355,11 +355,11 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData[], const in
 
 //    interpolate density 
       Interpolate( CData_Dens, CSize, CStart, CRange, FData_Dens, FSize, FStart, 1, IntScheme, 
-                   PhaseUnwrapping_No, EnsureMonotonicity_Yes );
+                   PhaseUnwrapping_No, EnsureMonotonicity_Yes, INT_MONO_COEFF );
 
 //    interpolate phase
       Interpolate( CData_Real, CSize, CStart, CRange, FData_Real, FSize, FStart, 1, IntScheme, 
-                   PhaseUnwrapping_Yes, EnsureMonotonicity_No );
+                   PhaseUnwrapping_Yes, EnsureMonotonicity_No, INT_MONO_COEFF );
    } // if ( IntPhase )
 
 // c2. interpolation on real/imag parts in ELBDM
@@ -367,7 +367,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData[], const in
    {
       for (int v=0; v<NVar_Flu; v++)
       Interpolate( CData+CSize3D*v, CSize, CStart, CRange, IntData+FSize3D*v, FSize, FStart, 1, 
-                   IntScheme, PhaseUnwrapping_No, Monotonicity[v] );
+                   IntScheme, PhaseUnwrapping_No, Monotonicity[v], INT_MONO_COEFF );
    } // if ( IntPhase ) ... else ...
 
 // retrieve real and imaginary parts when phase interpolation is adopted
@@ -399,7 +399,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData[], const in
 // c3. interpolation on original variables
    for (int v=0; v<NVar_Flu; v++)
       Interpolate( CData+CSize3D*v, CSize, CStart, CRange, IntData+FSize3D*v, FSize, FStart, 1, 
-                   IntScheme, PhaseUnwrapping_No, Monotonicity[v] );
+                   IntScheme, PhaseUnwrapping_No, Monotonicity[v], INT_MONO_COEFF );
 
 #  endif // #if ( MODEL == ELBDM ) ... else 
 
@@ -409,7 +409,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData[], const in
    if ( PrepPot )
    {
       Interpolate( CData+CSize3D*NVar_SoFar, CSize, CStart, CRange, IntData+FSize3D*NVar_SoFar, FSize, FStart, 1, 
-                   IntScheme, PhaseUnwrapping_No, EnsureMonotonicity_No );
+                   IntScheme, PhaseUnwrapping_No, EnsureMonotonicity_No, INT_MONO_COEFF );
       NVar_SoFar ++;
    }
 
@@ -417,7 +417,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData[], const in
    if ( PrepParDens )
    {
       Interpolate( CData+CSize3D*NVar_SoFar, CSize, CStart, CRange, IntData+FSize3D*NVar_SoFar, FSize, FStart, 1, 
-                   IntScheme, PhaseUnwrapping_No, EnsureMonotonicity_No );
+                   IntScheme, PhaseUnwrapping_No, EnsureMonotonicity_No, INT_MONO_COEFF );
       NVar_SoFar ++;
    }
 
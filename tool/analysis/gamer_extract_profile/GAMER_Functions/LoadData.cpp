@@ -284,6 +284,11 @@ void LoadData()
       ExpectSize += (long)NParVarOut*NPar*sizeof(real);
    }
 
+// patch index appended after the particle data since version 2230
+   if ( FormatVersion >= 2230 )
+   for (int lv=0; lv<NLEVEL; lv++)
+      ExpectSize += (long)NPatchTotal[lv]*4*sizeof(int);       // 4 = corner(3) + son(1)
+
    fseek( File, 0, SEEK_END );
    InputSize = ftell( File );
 
@@ -375,15 +380,7 @@ void LoadData()
 
 
 // set up the "mapped" sphere center for the periodic B.C.
-   const double HalfBox[3] = { 0.5*amr.BoxScale[0], 0.5*amr.BoxScale[1], 0.5*amr.BoxScale[2] };
-
-   if ( Periodic )
-      for (int d=0; d<3; d++)
-         Center_Map[d] = ( Center[d] > HalfBox[d] ) ? Center[d]-2.0*HalfBox[d] : Center[d]+2.0*HalfBox[d];
-
-   else
-      for (int d=0; d<3; d++)
-         Center_Map[d] = Center[d];
+   SetCenterMap();
 
 
 // set up the candidate box --> only patches with cells inside the candidate box will be allocated
@@ -590,26 +587,7 @@ void LoadData()
 
 // g. set the shell width and other parameters
 // =================================================================================================
-   if ( LogBin > 1.0 )
-   {
-      ShellWidth = GetMinShellWidth( Center, Center_Map );
-
-      if ( GetNShell > 0.0 )  ShellWidth *= GetNShell;   // minimum shell width in the log bin
-
-      NShell = int( log(MaxRadius/ShellWidth)/log(LogBin) ) + 2;
-   }
-
-   else  // linear bin
-   {
-      if ( GetNShell > 0.0 )
-      {
-         ShellWidth = GetNShell * GetMinShellWidth( Center, Center_Map );
-         NShell     = (int)ceil( MaxRadius / ShellWidth );
-      }
-
-      else
-         ShellWidth = MaxRadius / (double)NShell;
-   }
+   SetShellWidth();
 
 // always output additional grid data if they exist
    OutputPot     = LoadPot;
@@ -1336,7 +1314,9 @@ void LoadOnePatchGroup( FILE *File, const int lv, const int LoadPID0, const bool
 // Function    :  CheckWithinTargetRegion
 // Description :  Check whether the input corners are within the target region
 //
-// Note        :  Work with both periodic and non-periodic BC.
+// Note        :  1. Work with both periodic and non-periodic BC.
+//                2. Always return true when a list of sphere centers is given (-C)
+//                   --> All patches are loaded just once and shared by all spheres
 //
 // Parameter   :  Periodic    : True/False <--> Periodic/Non-periodic
 //                CrL         : Left corner of the input range
@@ -1352,6 +1332,8 @@ bool CheckWithinTargetRegion( const bool Periodic, const int CrL[3], const int C
                               const int CanMax_y2, const int CanMin_y2, const int CanMax_z2, const int CanMin_z2 )
 {
 
+   if ( FileName_Center != NULL )   return true;
+
    bool Within = false;
 
    if ( Periodic )
@@ -304,15 +304,7 @@ void LoadData_HDF5( const char *FileName )
 
 
 // 2-4. set up the "mapped" sphere center for the periodic B.C.
-   const double HalfBox[3] = { 0.5*amr.BoxScale[0], 0.5*amr.BoxScale[1], 0.5*amr.BoxScale[2] };
-
-   if ( Periodic )
-      for (int d=0; d<3; d++)
-         Center_Map[d] = ( Center[d] > HalfBox[d] ) ? Center[d]-2.0*HalfBox[d] : Center[d]+2.0*HalfBox[d];
-
-   else
-      for (int d=0; d<3; d++)
-         Center_Map[d] = Center[d];
+   SetCenterMap();
 
 
 // 2-5. set up the candidate box --> only patches with cells inside the candidate box will be allocated
@@ -528,26 +520,7 @@ void LoadData_HDF5( const char *FileName )
 
 
 // 6. set the shell width and other parameters
-   if ( LogBin > 1.0 )
-   {
-      ShellWidth = GetMinShellWidth( Center, Center_Map );
-
-      if ( GetNShell > 0.0 )  ShellWidth *= GetNShell;   // minimum shell width in the log bin
-
-      NShell = int( log(MaxRadius/ShellWidth)/log(LogBin) ) + 2;
-   }
-
-   else  // linear bin
-   {
-      if ( GetNShell > 0.0 )
-      {
-         ShellWidth = GetNShell * GetMinShellWidth( Center, Center_Map );
-         NShell     = (int)ceil( MaxRadius / ShellWidth );
-      }
-
-      else
-         ShellWidth = MaxRadius / (double)NShell;
-   }
+   SetShellWidth();
 
 
    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
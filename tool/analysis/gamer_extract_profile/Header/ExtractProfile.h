@@ -10,6 +10,9 @@
 #include <cmath>
 #include <cstdio>
 #include <unistd.h>
+#ifndef SERIAL
+#include <mpi.h>
+#endif
 
 using namespace std;
 
@@ -18,6 +21,15 @@ using namespace std;
 #include "Global.h"
 #include "Prototype.h"
 
+#ifdef OPENMP
+#  include <omp.h>
+#endif
+
+#ifdef SERIAL
+#  define MPI_Exit() \
+   {  cout << flush; fprintf( stderr, "\nProgram termination ...... rank %d\n\n", MyRank ); exit(-1);   }
+#endif
+
 
 
 #endif // #ifndef __SPHEREANALYSIS_H__
@@ -9,13 +9,24 @@ void ReadOption( int argc, char **argv );
 void CheckParameter();
 void SetMaxRhoPos( const int AveN );
 void End();
+void End_ShellAve();
 void Init_ShellAve();
+void Init_TargetPatchGroup();
+void Init_Center( const int c, const bool UseMaxRhoPos_R_Auto );
+void LoadCenterList();
+void SetCenterMap();
+void SetShellWidth();
+double GetMinDist( const int lv, const int PID, const double TCen[], const double TCen_Map[] );
 void Output_ShellAve();
 void ShellAverage();
 void GetRMS();
 void GetMaxRho();
 double GetMinShellWidth( const double TCen[], const double TCen_Map[] );
 void GetR( const int n, double &R, double &dR );
+#ifndef SERIAL
+void Init_MPI( int *argc, char ***argv );
+void MPI_Exit();
+#endif
 
 // GAMER functions
 void LoadData();
@@ -36,7 +47,8 @@ void Prepare_PatchData( const int lv, real *h_Input_Array, const int GhostSize,
 void Int_Table( const IntScheme_t IntScheme, int &NSide, int &NGhost );
 void Interpolate( real CData [], const int CSize[3], const int CStart[3], const int CRange[3],
                   real FData [], const int FSize[3], const int FStart[3], 
-                  const int NComp, const IntScheme_t IntScheme, const bool UnwrapPhase, const bool Monotonic );
+                  const int NComp, const IntScheme_t IntScheme, const bool UnwrapPhase, const bool Monotonic,
+                  const real MonoCoeff );
 void Output_Patch( const int lv, const int PID, const char *comment );
 #if ( MODEL == ELBDM )
 real ELBDM_UnwrapPhase( const real Phase_Ref, const real Phase_Wrapped );
@@ -101,6 +101,11 @@ typedef float  real;
 #define IDX321( i, j, k, Ni, Nj )   (  ( (k)*(Nj) + (j) )*(Ni) + (i)  )
 
 
+// sibling index offset for the non-periodic B.C.
+// --> not used by this tool since the non-periodic B.C. is not supported, but required by "SiblingSearch"
+#define SIB_OFFSET_NONPERIODIC   ( -100 )
+
+
 // macro for the function "Aux_Error"
 #define ERROR_INFO         __FILE__, __LINE__, __FUNCTION__
 
@@ -24,6 +24,16 @@ int         OutputParDens     = 0;        // output particle density on grids (0
 bool        InputScale        = false;    // true --> input cell scales instead of coordinates
 bool        UseTree           = false;    // true --> use the tree file to improve the I/O performance
 bool        NeedGhost         = false;    // treu --> ghost zones are required (--> need to construct the octree structure)
+int         OMP_NThread       = -1;       // number of OpenMP threads (<=0 -> default = omp_get_max_threads)
+int         MyRank            = 0;        // MPI rank
+int         NRank             = 1;        // total number of MPI ranks
+
+// variables for multiple sphere centers
+char       *FileName_Center   = NULL;     // input file storing the list of sphere centers (and radii)
+int         NCenter           = 0;        // number of sphere centers in the list (0 -> single center set by -x/y/z)
+double    (*CenterList)[4]    = NULL;     // [NCenter][x/y/z/radius] of each sphere (radius <= 0 -> set by -r)
+int        *TargetPG[NLEVEL];             // PID0 of the patch groups intersecting the target sphere at each level
+int         NTargetPG[NLEVEL];            // number of patch groups in TargetPG
 
 // variables for the mode "shell average"
 double      **Average         = NULL;     // the shell average in each shell ( HYDRO : rho, v_r, v_t, engy, pres, pot )
@@ -144,6 +154,9 @@ void GetMaxRho()
       {
          if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
 
+//       skip patches lying completely outside the target sphere
+         if ( GetMinDist( lv, PID, Center, Center_Map ) >= MaxRadius )                 continue;
+
          for (int k=0; k<PATCH_SIZE; k++) {  zz = amr.patch[lv][PID]->corner[2] + (k+0.5)*scale;
                                              z1 = zz - Center    [2];
                                              z2 = zz - Center_Map[2];
@@ -250,7 +263,6 @@ void GetRMS()
 
 #  if   ( MODEL == HYDRO )
    const int NGhost = 0;
-   real rho, vx, vy, vz, vr, vt, egy, pres, Pot, ParDens;
 
 #  elif ( MODEL == MHD )
 #  warning : WAIT MHD !!!
@@ -260,9 +272,7 @@ void GetRMS()
    const real _Eta   = 1.0/ELBDM_ETA;
    const real _2Eta  = 0.5*_Eta;
    const real _2Eta2 = _Eta*_2Eta;
-   real Dens, Real, Imag, Pot, _Dens, ParDens;
-   real Ek_Lap, Ek_Gra, GradR[3], GradI[3], LapR, LapI, _2dh, _dh2;
-   real v[3], w[3], vr, vr_abs, vt_abs, wr, wr_abs, wt_abs, GradD[3];
+   real _2dh, _dh2;
 
 #  else
 #  error : ERROR : unsupported MODEL !!
@@ -276,14 +286,24 @@ void GetRMS()
    const int NPG       = 1;
    const NSide_t NSide = NSIDE_26;
 
-   int    ShellID, Var, i, j, k, im, jm, km, ip, jp, kp, POTE, PAR_DENS, NextIdx;
+   int    POTE, PAR_DENS, NextIdx;
    long   TVar;
-   double Radius, scale, dv;
-   double x, x1, x2, y, y1, y2, z, z1, z2;   // (x,y,z) : relative coordinates to the vector "Center"
-   real   pass[NCOMP_PASSIVE];
+   double scale, dv;
+
 
-   real *Field1D = new real [NPG*8*NIn*ArraySize*ArraySize*ArraySize];
-   real (*Field)[NIn][ArraySize][ArraySize][ArraySize] = ( real(*)[NIn][ArraySize][ArraySize][ArraySize] )Field1D;
+// allocate the thread-private arrays for accumulating data in each shell
+// --> merged in the order of thread IDs at the end so that the results are reproducible for a fixed number of threads
+   double ***OMP_RMS = new double **[OMP_NThread];
+
+   for (int TID=0; TID<OMP_NThread; TID++)
+   {
+      OMP_RMS[TID]    = new double *[NShell];
+      OMP_RMS[TID][0] = new double  [NShell*NOut];
+
+      for (int n=1; n<NShell; n++)  OMP_RMS[TID][n] = OMP_RMS[TID][0] + n*NOut;
+
+      for (int t=0; t<NShell*NOut; t++)   OMP_RMS[TID][0][t] = 0.0;
+   }
 
 
 // determine the target variables
@@ -305,198 +325,229 @@ void GetRMS()
 
       cout << "   Level " << lv << " ... ";
 
-      for (int PID0=0; PID0<amr.num[lv]; PID0+=8)
+#     pragma omp parallel
       {
-//       skip useless patches
-         if ( amr.patch[lv][PID0+0]->fluid == NULL  &&  amr.patch[lv][PID0+1]->fluid == NULL  &&
-              amr.patch[lv][PID0+2]->fluid == NULL  &&  amr.patch[lv][PID0+3]->fluid == NULL  &&
-              amr.patch[lv][PID0+4]->fluid == NULL  &&  amr.patch[lv][PID0+5]->fluid == NULL  &&
-              amr.patch[lv][PID0+6]->fluid == NULL  &&  amr.patch[lv][PID0+7]->fluid == NULL    )  continue;
+#        ifdef OPENMP
+         const int TID = omp_get_thread_num();
+#        else
+         const int TID = 0;
+#        endif
 
-         if ( amr.patch[lv][PID0+0]->son != -1  &&  amr.patch[lv][PID0+1]->son != -1  &&
-              amr.patch[lv][PID0+2]->son != -1  &&  amr.patch[lv][PID0+3]->son != -1  &&
-              amr.patch[lv][PID0+4]->son != -1  &&  amr.patch[lv][PID0+5]->son != -1  &&
-              amr.patch[lv][PID0+6]->son != -1  &&  amr.patch[lv][PID0+7]->son != -1    )    continue;
+#        if   ( MODEL == HYDRO )
+         real rho, vx, vy, vz, vr, vt, egy, pres, Pot, ParDens;
 
+#        elif ( MODEL == ELBDM )
+         real Dens, Real, Imag, Pot, _Dens, ParDens;
+         real Ek_Lap, Ek_Gra, GradR[3], GradI[3], LapR, LapI;
+         real v[3], w[3], vr, vr_abs, vt_abs, wr, wr_abs, wt_abs, GradD[3];
+#        endif // MODEL
 
-//       prepare data with ghost zones
-         Prepare_PatchData( lv, Field[0][0][0][0], NGhost, NPG, &PID0, TVar, IntScheme, NSide, ELBDM_IntPhase );
+         int    ShellID, Var, i, j, k, im, jm, km, ip, jp, kp;
+         double Radius;
+         double x, x1, x2, y, y1, y2, z, z1, z2;   // (x,y,z) : relative coordinates to the vector "Center"
+         real   pass[NCOMP_PASSIVE];
 
+         real *Field1D = new real [NPG*8*NIn*ArraySize*ArraySize*ArraySize];
+         real (*Field)[NIn][ArraySize][ArraySize][ArraySize] = ( real(*)[NIn][ArraySize][ArraySize][ArraySize] )Field1D;
 
-//       evaluate the shell average
-         for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+//       loop over all patch groups intersecting the target sphere (see Init_TargetPatchGroup)
+#        pragma omp for schedule( static, 1 )
+         for (int t=0; t<NTargetPG[lv]; t++)
          {
-            if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
-
-            for (int kk=0; kk<PATCH_SIZE; kk++) {  z1 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center    [2];
-                                                   z2 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center_Map[2];
-                                                   z  = ( fabs(z1) <= fabs(z2) ) ? z1 : z2;
-                                                   k  = kk + NGhost;   km = k - 1;   kp = k + 1;
-            for (int jj=0; jj<PATCH_SIZE; jj++) {  y1 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center    [1];
-                                                   y2 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center_Map[1];
-                                                   y  = ( fabs(y1) <= fabs(y2) ) ? y1 : y2;
-                                                   j  = jj + NGhost;   jm = j - 1;   jp = j + 1;
-            for (int ii=0; ii<PATCH_SIZE; ii++) {  x1 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center    [0];
-                                                   x2 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center_Map[0];
-                                                   x  = ( fabs(x1) <= fabs(x2) ) ? x1 : x2;
-                                                   i  = ii + NGhost;   im = i - 1;   ip = i + 1;
-
-               Radius = sqrt( x*x + y*y + z*z );
-
-               if ( Radius < MaxRadius )
-               {
-                  if ( LogBin > 1.0 )  ShellID = ( Radius < ShellWidth ) ? 0 : int( log(Radius/ShellWidth)/log(LogBin) ) + 1;
-                  else                 ShellID = int( Radius / ShellWidth );
+            const int PID0 = TargetPG[lv][t];
 
-                  if ( ShellID >= NShell )
-                  {
-                     cerr << "ERROR : ShellID >= NShell !!" << endl;
-                     exit( 1 );
-                  }
-
-#                 if   ( MODEL == HYDRO )
-//                evaluate the values on the shell
-                  rho     = Field[p][DENS    ][k][j][i];
-                  vx      = Field[p][MOMX    ][k][j][i] / rho;
-                  vy      = Field[p][MOMY    ][k][j][i] / rho;
-                  vz      = Field[p][MOMZ    ][k][j][i] / rho;
-                  egy     = Field[p][ENGY    ][k][j][i];
-
-                  for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
-                  pass[u] = Field[p][uu      ][k][j][i];
-
-                  if ( OutputPot )
-                  Pot     = Field[p][POTE    ][k][j][i];
+//          prepare data with ghost zones
+            Prepare_PatchData( lv, Field[0][0][0][0], NGhost, NPG, &PID0, TVar, IntScheme, NSide, ELBDM_IntPhase );
 
-                  if ( OutputParDens )
-                  ParDens = Field[p][PAR_DENS][k][j][i];
 
-                  pres = (GAMMA-1.0) * ( egy - 0.5*rho*(vx*vx + vy*vy + vz*vz) );
-                  vr   = ( x*vx + y*vy + z*vz ) / Radius;
-                  vt   = sqrt( fabs(vx*vx + vy*vy + vz*vz - vr*vr) );
+   //       evaluate the shell average
+            for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+            {
+               if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
+
+               for (int kk=0; kk<PATCH_SIZE; kk++) {  z1 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center    [2];
+                                                      z2 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center_Map[2];
+                                                      z  = ( fabs(z1) <= fabs(z2) ) ? z1 : z2;
+                                                      k  = kk + NGhost;   km = k - 1;   kp = k + 1;
+               for (int jj=0; jj<PATCH_SIZE; jj++) {  y1 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center    [1];
+                                                      y2 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center_Map[1];
+                                                      y  = ( fabs(y1) <= fabs(y2) ) ? y1 : y2;
+                                                      j  = jj + NGhost;   jm = j - 1;   jp = j + 1;
+               for (int ii=0; ii<PATCH_SIZE; ii++) {  x1 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center    [0];
+                                                      x2 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center_Map[0];
+                                                      x  = ( fabs(x1) <= fabs(x2) ) ? x1 : x2;
+                                                      i  = ii + NGhost;   im = i - 1;   ip = i + 1;
+
+                  Radius = sqrt( x*x + y*y + z*z );
+
+                  if ( Radius < MaxRadius )
+                  {
+                     if ( LogBin > 1.0 )  ShellID = ( Radius < ShellWidth ) ? 0 : int( log(Radius/ShellWidth)/log(LogBin) ) + 1;
+                     else                 ShellID = int( Radius / ShellWidth );
 
+                     if ( ShellID >= NShell )
+                     {
+                        cerr << "ERROR : ShellID >= NShell !!" << endl;
+                        exit( 1 );
+                     }
 
-//                evalute the square of deviation on the shell
-                  Var = 0;
-                  RMS[ShellID][Var] += dv*pow( double(rho    )-Average[ShellID][Var], 2.0 );    Var++;
-                  RMS[ShellID][Var] += dv*pow( double(vr     )-Average[ShellID][Var], 2.0 );    Var++;
-                  RMS[ShellID][Var] += dv*pow( double(vt     )-Average[ShellID][Var], 2.0 );    Var++;
-                  RMS[ShellID][Var] += dv*pow( double(egy    )-Average[ShellID][Var], 2.0 );    Var++;
-                  RMS[ShellID][Var] += dv*pow( double(pres   )-Average[ShellID][Var], 2.0 );    Var++;
+   #                 if   ( MODEL == HYDRO )
+   //                evaluate the values on the shell
+                     rho     = Field[p][DENS    ][k][j][i];
+                     vx      = Field[p][MOMX    ][k][j][i] / rho;
+                     vy      = Field[p][MOMY    ][k][j][i] / rho;
+                     vz      = Field[p][MOMZ    ][k][j][i] / rho;
+                     egy     = Field[p][ENGY    ][k][j][i];
 
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  RMS[ShellID][Var] += dv*pow( double(pass[v])-Average[ShellID][Var], 2.0 );    Var++; }
+                     for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
+                     pass[u] = Field[p][uu      ][k][j][i];
 
-                  if ( OutputPot ) {
-                  RMS[ShellID][Var] += dv*pow( double(Pot    )-Average[ShellID][Var], 2.0 );    Var++; }
+                     if ( OutputPot )
+                     Pot     = Field[p][POTE    ][k][j][i];
 
-                  if ( OutputParDens ) {
-                  RMS[ShellID][Var] += dv*pow( double(ParDens)-Average[ShellID][Var], 2.0 );    Var++; }
+                     if ( OutputParDens )
+                     ParDens = Field[p][PAR_DENS][k][j][i];
 
-#                 elif ( MODEL == MHD )
-#                 warning : WAIT MHD !!!
+                     pres = (GAMMA-1.0) * ( egy - 0.5*rho*(vx*vx + vy*vy + vz*vz) );
+                     vr   = ( x*vx + y*vy + z*vz ) / Radius;
+                     vt   = sqrt( fabs(vx*vx + vy*vy + vz*vz - vr*vr) );
 
-#                 elif ( MODEL == ELBDM )
-                  Dens    = Field[p][DENS    ][k][j][i];
-                  Real    = Field[p][REAL    ][k][j][i];
-                  Imag    = Field[p][IMAG    ][k][j][i];
 
-                  for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
-                  pass[u] = Field[p][uu      ][k][j][i];
+   //                evalute the square of deviation on the shell
+                     Var = 0;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(rho    )-Average[ShellID][Var], 2.0 );    Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(vr     )-Average[ShellID][Var], 2.0 );    Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(vt     )-Average[ShellID][Var], 2.0 );    Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(egy    )-Average[ShellID][Var], 2.0 );    Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(pres   )-Average[ShellID][Var], 2.0 );    Var++;
 
-                  if ( OutputPot )
-                  Pot     = Field[p][POTE    ][k][j][i];
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(pass[v])-Average[ShellID][Var], 2.0 );    Var++; }
 
-                  if ( OutputParDens )
-                  ParDens = Field[p][PAR_DENS][k][j][i];
+                     if ( OutputPot ) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Pot    )-Average[ShellID][Var], 2.0 );    Var++; }
 
-                  if ( ELBDM_GetVir )
-                  {
-                     GradD[0] = _2dh*( Field[p][DENS][k ][j ][ip] - Field[p][DENS][k ][j ][im] );
-                     GradD[1] = _2dh*( Field[p][DENS][k ][jp][i ] - Field[p][DENS][k ][jm][i ] );
-                     GradD[2] = _2dh*( Field[p][DENS][kp][j ][i ] - Field[p][DENS][km][j ][i ] );
+                     if ( OutputParDens ) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(ParDens)-Average[ShellID][Var], 2.0 );    Var++; }
 
-                     GradR[0] = _2dh*( Field[p][REAL][k ][j ][ip] - Field[p][REAL][k ][j ][im] );
-                     GradR[1] = _2dh*( Field[p][REAL][k ][jp][i ] - Field[p][REAL][k ][jm][i ] );
-                     GradR[2] = _2dh*( Field[p][REAL][kp][j ][i ] - Field[p][REAL][km][j ][i ] );
+   #                 elif ( MODEL == MHD )
+   #                 warning : WAIT MHD !!!
 
-                     GradI[0] = _2dh*( Field[p][IMAG][k ][j ][ip] - Field[p][IMAG][k ][j ][im] );
-                     GradI[1] = _2dh*( Field[p][IMAG][k ][jp][i ] - Field[p][IMAG][k ][jm][i ] );
-                     GradI[2] = _2dh*( Field[p][IMAG][kp][j ][i ] - Field[p][IMAG][km][j ][i ] );
+   #                 elif ( MODEL == ELBDM )
+                     Dens    = Field[p][DENS    ][k][j][i];
+                     Real    = Field[p][REAL    ][k][j][i];
+                     Imag    = Field[p][IMAG    ][k][j][i];
 
-                     LapR     = ( Field[p][REAL][k ][j ][ip] + Field[p][REAL][k ][jp][i ] + Field[p][REAL][kp][j ][i ] +
-                                  Field[p][REAL][k ][j ][im] + Field[p][REAL][k ][jm][i ] + Field[p][REAL][km][j ][i ] -
-                                  6.0*Real )*_dh2;
-                     LapI     = ( Field[p][IMAG][k ][j ][ip] + Field[p][IMAG][k ][jp][i ] + Field[p][IMAG][kp][j ][i ] +
-                                  Field[p][IMAG][k ][j ][im] + Field[p][IMAG][k ][jm][i ] + Field[p][IMAG][km][j ][i ] -
-                                  6.0*Imag )*_dh2;
+                     for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
+                     pass[u] = Field[p][uu      ][k][j][i];
 
-                     Ek_Lap = -_2Eta2*( Real*LapR + Imag*LapI );
-                     Ek_Gra = +_2Eta2*( SQR(GradR[0]) + SQR(GradR[1]) + SQR(GradR[2]) +
-                                        SQR(GradI[0]) + SQR(GradI[1]) + SQR(GradI[2])   );
+                     if ( OutputPot )
+                     Pot     = Field[p][POTE    ][k][j][i];
 
-                     _Dens  = 1.0 / Dens;
+                     if ( OutputParDens )
+                     ParDens = Field[p][PAR_DENS][k][j][i];
 
-                     for (int d=0; d<3; d++)
+                     if ( ELBDM_GetVir )
                      {
-                        v[d] = _Eta*_Dens*( Real*GradI[d] - Imag*GradR[d] );
-                        w[d] = _2Eta*_Dens*GradD[d];
-                     }
-
-                     vr     = ( x*v[0] + y*v[1] + z*v[2] ) / Radius;
-                     vr_abs = fabs( vr );
-                     vt_abs = sqrt(  fabs( v[0]*v[0] + v[1]*v[1] + v[2]*v[2] - vr*vr )  );
-
-                     wr     = ( x*w[0] + y*w[1] + z*w[2] ) / Radius;
-                     wr_abs = fabs( wr );
-                     wt_abs = sqrt(  fabs( w[0]*w[0] + w[1]*w[1] + w[2]*w[2] - wr*wr )  );
-                  } // if ( ELBDM_GetVir )
-
-
-//                evalute the square of deviation on the shell
-                  Var = 0;
-                  RMS[ShellID][Var] += dv*pow( double(Dens   )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(Real   )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(Imag   )-Average[ShellID][Var], 2.0 );  Var++;
-
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  RMS[ShellID][Var] += dv*pow( double(pass[v])-Average[ShellID][Var], 2.0 );  Var++; }
-
-                  if ( OutputPot   ) {
-                  RMS[ShellID][Var] += dv*pow( double(Pot    )-Average[ShellID][Var], 2.0 );  Var++; }
-
-                  if ( OutputParDens ) {
-                  RMS[ShellID][Var] += dv*pow( double(ParDens)-Average[ShellID][Var], 2.0 );  Var++; }
-
-                  if ( ELBDM_GetVir ) {
-                  RMS[ShellID][Var] += dv*pow( double(Ek_Lap )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(Ek_Gra )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(vr     )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(vr_abs )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(vt_abs )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(wr     )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(wr_abs )-Average[ShellID][Var], 2.0 );  Var++;
-                  RMS[ShellID][Var] += dv*pow( double(wt_abs )-Average[ShellID][Var], 2.0 );  Var++; }
-
-#                 else
-#                 error : ERROR : unsupported MODEL !!
-#                 endif // MODEL
-
-               } // if ( Radius < MaxRadius )
-            }}} // kk, jj, ii
-         } // for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
-      } // for (int PID0=0; PID0<amr.num[lv]; PID0+=8)
+                        GradD[0] = _2dh*( Field[p][DENS][k ][j ][ip] - Field[p][DENS][k ][j ][im] );
+                        GradD[1] = _2dh*( Field[p][DENS][k ][jp][i ] - Field[p][DENS][k ][jm][i ] );
+                        GradD[2] = _2dh*( Field[p][DENS][kp][j ][i ] - Field[p][DENS][km][j ][i ] );
+
+                        GradR[0] = _2dh*( Field[p][REAL][k ][j ][ip] - Field[p][REAL][k ][j ][im] );
+                        GradR[1] = _2dh*( Field[p][REAL][k ][jp][i ] - Field[p][REAL][k ][jm][i ] );
+                        GradR[2] = _2dh*( Field[p][REAL][kp][j ][i ] - Field[p][REAL][km][j ][i ] );
+
+                        GradI[0] = _2dh*( Field[p][IMAG][k ][j ][ip] - Field[p][IMAG][k ][j ][im] );
+                        GradI[1] = _2dh*( Field[p][IMAG][k ][jp][i ] - Field[p][IMAG][k ][jm][i ] );
+                        GradI[2] = _2dh*( Field[p][IMAG][kp][j ][i ] - Field[p][IMAG][km][j ][i ] );
+
+                        LapR     = ( Field[p][REAL][k ][j ][ip] + Field[p][REAL][k ][jp][i ] + Field[p][REAL][kp][j ][i ] +
+                                     Field[p][REAL][k ][j ][im] + Field[p][REAL][k ][jm][i ] + Field[p][REAL][km][j ][i ] -
+                                     6.0*Real )*_dh2;
+                        LapI     = ( Field[p][IMAG][k ][j ][ip] + Field[p][IMAG][k ][jp][i ] + Field[p][IMAG][kp][j ][i ] +
+                                     Field[p][IMAG][k ][j ][im] + Field[p][IMAG][k ][jm][i ] + Field[p][IMAG][km][j ][i ] -
+                                     6.0*Imag )*_dh2;
+
+                        Ek_Lap = -_2Eta2*( Real*LapR + Imag*LapI );
+                        Ek_Gra = +_2Eta2*( SQR(GradR[0]) + SQR(GradR[1]) + SQR(GradR[2]) +
+                                           SQR(GradI[0]) + SQR(GradI[1]) + SQR(GradI[2])   );
+
+                        _Dens  = 1.0 / Dens;
+
+                        for (int d=0; d<3; d++)
+                        {
+                           v[d] = _Eta*_Dens*( Real*GradI[d] - Imag*GradR[d] );
+                           w[d] = _2Eta*_Dens*GradD[d];
+                        }
+
+                        vr     = ( x*v[0] + y*v[1] + z*v[2] ) / Radius;
+                        vr_abs = fabs( vr );
+                        vt_abs = sqrt(  fabs( v[0]*v[0] + v[1]*v[1] + v[2]*v[2] - vr*vr )  );
+
+                        wr     = ( x*w[0] + y*w[1] + z*w[2] ) / Radius;
+                        wr_abs = fabs( wr );
+                        wt_abs = sqrt(  fabs( w[0]*w[0] + w[1]*w[1] + w[2]*w[2] - wr*wr )  );
+                     } // if ( ELBDM_GetVir )
+
+
+   //                evalute the square of deviation on the shell
+                     Var = 0;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Dens   )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Real   )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Imag   )-Average[ShellID][Var], 2.0 );  Var++;
+
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(pass[v])-Average[ShellID][Var], 2.0 );  Var++; }
+
+                     if ( OutputPot   ) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Pot    )-Average[ShellID][Var], 2.0 );  Var++; }
+
+                     if ( OutputParDens ) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(ParDens)-Average[ShellID][Var], 2.0 );  Var++; }
+
+                     if ( ELBDM_GetVir ) {
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Ek_Lap )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(Ek_Gra )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(vr     )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(vr_abs )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(vt_abs )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(wr     )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(wr_abs )-Average[ShellID][Var], 2.0 );  Var++;
+                     OMP_RMS[TID][ShellID][Var] += dv*pow( double(wt_abs )-Average[ShellID][Var], 2.0 );  Var++; }
+
+   #                 else
+   #                 error : ERROR : unsupported MODEL !!
+   #                 endif // MODEL
+
+                  } // if ( Radius < MaxRadius )
+               }}} // kk, jj, ii
+            } // for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+         } // for (int t=0; t<NTargetPG[lv]; t++)
+
+         delete [] Field1D;
+      } // OpenMP parallel region
 
       cout << "done" << endl;
 
    } // for (int lv=0; lv<NLEVEL; lv++)
 
 
+// merge the thread-private data
+   for (int TID=0; TID<OMP_NThread; TID++)
+   for (int n=0; n<NShell; n++)
+   for (int v=0; v<NOut; v++)    RMS[n][v] += OMP_RMS[TID][n][v];
+
+
 // get the root-mean-square at each level
    for (int n=0; n<NShell; n++)
    for (int v=0; v<NOut; v++)    RMS[n][v] = sqrt( RMS[n][v]/Volume[n] );
 
-   delete [] Field1D;
+   for (int TID=0; TID<OMP_NThread; TID++)
+   {
+      delete [] OMP_RMS[TID][0];
+      delete [] OMP_RMS[TID];
+   }
+   delete [] OMP_RMS;
 
 } // FUNCTION : GetRMS
 
@@ -514,7 +565,6 @@ void ShellAverage()
 
 #  if   ( MODEL == HYDRO )
    const int NGhost = 0;
-   real px, py, pz, pr, pt, vr, vt, pres, rho, egy, Pot, ParDens;
 
 #  elif ( MODEL == MHD )
 #  warning : WAIT MHD !!!
@@ -525,9 +575,7 @@ void ShellAverage()
    const real _2Eta  = 0.5*_Eta;
    const real _2Eta2 = _Eta*_2Eta;
    const real _Eta2  = _Eta*_Eta;
-   real Dens, Real, Imag, Pot, _Dens, ParDens;
-   real Ek_Lap, Ek_Gra, GradR[3], GradI[3], LapR, LapI, _2dh, _dh2, dv_Eta;
-   real v[3], w[3], vr, vr1, vr2, vt1, vt2, wr, wr1, wr2, wt1, wt2, GradD[3], dR_dr, dI_dr;
+   real _2dh, _dh2, dv_Eta;
 
 #  else
 #  error : ERROR : unsupported MODEL !!
@@ -541,14 +589,76 @@ void ShellAverage()
    const int NPG       = 1;
    const NSide_t NSide = NSIDE_26;
 
-   int    ShellID, Var, i, j, k, im, jm, km, ip, jp, kp, POTE, PAR_DENS, NextIdx;
+   int    POTE, PAR_DENS, NextIdx;
    long   TVar;
-   double Radius, scale, dv;
-   double x, x1, x2, y, y1, y2, z, z1, z2;   // (x,y,z) : relative coordinates to the vector "Center"
-   real   pass[NCOMP_PASSIVE];
+   double scale, dv;
+
+
+// allocate the thread-private arrays for accumulating data in each shell
+// --> merged in the order of thread IDs at the end so that the results are reproducible for a fixed number of threads
+   double ***OMP_Average = new double **[OMP_NThread];
+   real   ***OMP_Max     = new real   **[OMP_NThread];
+   real   ***OMP_Min     = new real   **[OMP_NThread];
+   double  **OMP_Volume  = new double  *[OMP_NThread];
+   long    **OMP_NCount  = new long    *[OMP_NThread];
+#  if ( MODEL == ELBDM )
+   typedef double (*Mom_t)[3];
+   Mom_t    *OMP_ELBDM_Mom     = new Mom_t    [OMP_NThread];
+   double  **OMP_ELBDM_RhoUr2  = new double  *[OMP_NThread];
+   double  **OMP_ELBDM_dRho_dr = new double  *[OMP_NThread];
+   double  **OMP_ELBDM_LapRho  = new double  *[OMP_NThread];
+#  endif
+
+   for (int TID=0; TID<OMP_NThread; TID++)
+   {
+      OMP_Average[TID]    = new double *[NShell];
+      OMP_Max    [TID]    = new real   *[NShell];
+      OMP_Min    [TID]    = new real   *[NShell];
+      OMP_Average[TID][0] = new double  [NShell*NOut];
+      OMP_Max    [TID][0] = new real    [NShell*NOut];
+      OMP_Min    [TID][0] = new real    [NShell*NOut];
+      OMP_Volume [TID]    = new double  [NShell];
+      OMP_NCount [TID]    = new long    [NShell];
+
+      for (int n=1; n<NShell; n++)
+      {
+         OMP_Average[TID][n] = OMP_Average[TID][0] + n*NOut;
+         OMP_Max    [TID][n] = OMP_Max    [TID][0] + n*NOut;
+         OMP_Min    [TID][n] = OMP_Min    [TID][0] + n*NOut;
+      }
 
-   real *Field1D = new real [NPG*8*NIn*ArraySize*ArraySize*ArraySize];
-   real (*Field)[NIn][ArraySize][ArraySize][ArraySize] = ( real(*)[NIn][ArraySize][ArraySize][ArraySize] )Field1D;
+      for (int n=0; n<NShell; n++)
+      {
+         for (int v=0; v<NOut; v++)
+         {
+            OMP_Average[TID][n][v] = 0.0;
+            OMP_Max    [TID][n][v] = -__FLT_MAX__;
+            OMP_Min    [TID][n][v] = +__FLT_MAX__;
+         }
+
+         OMP_Volume[TID][n] = 0.0;
+         OMP_NCount[TID][n] = 0;
+      }
+
+#     if ( MODEL == ELBDM )
+      if ( ELBDM_GetVir )
+      {
+         OMP_ELBDM_Mom    [TID] = new double [NShell][3];
+         OMP_ELBDM_RhoUr2 [TID] = new double [NShell];
+         OMP_ELBDM_dRho_dr[TID] = new double [NShell];
+         OMP_ELBDM_LapRho [TID] = new double [NShell];
+
+         for (int n=0; n<NShell; n++)
+         {
+            for (int d=0; d<3; d++)    OMP_ELBDM_Mom[TID][n][d] = 0.0;
+
+            OMP_ELBDM_RhoUr2 [TID][n] = 0.0;
+            OMP_ELBDM_dRho_dr[TID][n] = 0.0;
+            OMP_ELBDM_LapRho [TID][n] = 0.0;
+         }
+      }
+#     endif
+   } // for (int TID=0; TID<OMP_NThread; TID++)
 
 
 // determine the target variables
@@ -571,297 +681,377 @@ void ShellAverage()
 
       cout << "   Level " << lv << " ... ";
 
-      for (int PID0=0; PID0<amr.num[lv]; PID0+=8)
+#     pragma omp parallel
       {
-//       skip useless patches
-         if ( amr.patch[lv][PID0+0]->fluid == NULL  &&  amr.patch[lv][PID0+1]->fluid == NULL  &&
-              amr.patch[lv][PID0+2]->fluid == NULL  &&  amr.patch[lv][PID0+3]->fluid == NULL  &&
-              amr.patch[lv][PID0+4]->fluid == NULL  &&  amr.patch[lv][PID0+5]->fluid == NULL  &&
-              amr.patch[lv][PID0+6]->fluid == NULL  &&  amr.patch[lv][PID0+7]->fluid == NULL    )  continue;
+#        ifdef OPENMP
+         const int TID = omp_get_thread_num();
+#        else
+         const int TID = 0;
+#        endif
 
-         if ( amr.patch[lv][PID0+0]->son != -1  &&  amr.patch[lv][PID0+1]->son != -1  &&
-              amr.patch[lv][PID0+2]->son != -1  &&  amr.patch[lv][PID0+3]->son != -1  &&
-              amr.patch[lv][PID0+4]->son != -1  &&  amr.patch[lv][PID0+5]->son != -1  &&
-              amr.patch[lv][PID0+6]->son != -1  &&  amr.patch[lv][PID0+7]->son != -1    )    continue;
+#        if   ( MODEL == HYDRO )
+         real px, py, pz, pr, pt, vr, vt, pres, rho, egy, Pot, ParDens;
 
+#        elif ( MODEL == ELBDM )
+         real Dens, Real, Imag, Pot, _Dens, ParDens;
+         real Ek_Lap, Ek_Gra, GradR[3], GradI[3], LapR, LapI;
+         real v[3], w[3], vr, vr1, vr2, vt1, vt2, wr, wr1, wr2, wt1, wt2, GradD[3], dR_dr, dI_dr;
+#        endif // MODEL
 
-//       prepare data with ghost zones
-         Prepare_PatchData( lv, Field[0][0][0][0], NGhost, NPG, &PID0, TVar, IntScheme, NSide, ELBDM_IntPhase );
+         int    ShellID, Var, i, j, k, im, jm, km, ip, jp, kp;
+         double Radius;
+         double x, x1, x2, y, y1, y2, z, z1, z2;   // (x,y,z) : relative coordinates to the vector "Center"
+         real   pass[NCOMP_PASSIVE];
 
+         real *Field1D = new real [NPG*8*NIn*ArraySize*ArraySize*ArraySize];
+         real (*Field)[NIn][ArraySize][ArraySize][ArraySize] = ( real(*)[NIn][ArraySize][ArraySize][ArraySize] )Field1D;
 
-//       evaluate the shell average
-         for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+//       loop over all patch groups intersecting the target sphere (see Init_TargetPatchGroup)
+#        pragma omp for schedule( static, 1 )
+         for (int t=0; t<NTargetPG[lv]; t++)
          {
-            if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
-
-            for (int kk=0; kk<PATCH_SIZE; kk++) {  z1 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center    [2];
-                                                   z2 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center_Map[2];
-                                                   z  = ( fabs(z1) <= fabs(z2) ) ? z1 : z2;
-                                                   k  = kk + NGhost;   km = k - 1;   kp = k + 1;
-            for (int jj=0; jj<PATCH_SIZE; jj++) {  y1 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center    [1];
-                                                   y2 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center_Map[1];
-                                                   y  = ( fabs(y1) <= fabs(y2) ) ? y1 : y2;
-                                                   j  = jj + NGhost;   jm = j - 1;   jp = j + 1;
-            for (int ii=0; ii<PATCH_SIZE; ii++) {  x1 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center    [0];
-                                                   x2 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center_Map[0];
-                                                   x  = ( fabs(x1) <= fabs(x2) ) ? x1 : x2;
-                                                   i  = ii + NGhost;   im = i - 1;   ip = i + 1;
-
-               Radius = sqrt( x*x + y*y + z*z );
-
-               if ( Radius < MaxRadius )
-               {
-                  if ( LogBin > 1.0 )  ShellID = ( Radius < ShellWidth ) ? 0 : int( log(Radius/ShellWidth)/log(LogBin) ) + 1;
-                  else                 ShellID = int( Radius / ShellWidth );
+            const int PID0 = TargetPG[lv][t];
+
+//          prepare data with ghost zones
+            Prepare_PatchData( lv, Field[0][0][0][0], NGhost, NPG, &PID0, TVar, IntScheme, NSide, ELBDM_IntPhase );
+
 
-                  if ( ShellID >= NShell )
+   //       evaluate the shell average
+            for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+            {
+               if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
+
+               for (int kk=0; kk<PATCH_SIZE; kk++) {  z1 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center    [2];
+                                                      z2 = amr.patch[lv][PID]->corner[2] + (kk+0.5)*scale - Center_Map[2];
+                                                      z  = ( fabs(z1) <= fabs(z2) ) ? z1 : z2;
+                                                      k  = kk + NGhost;   km = k - 1;   kp = k + 1;
+               for (int jj=0; jj<PATCH_SIZE; jj++) {  y1 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center    [1];
+                                                      y2 = amr.patch[lv][PID]->corner[1] + (jj+0.5)*scale - Center_Map[1];
+                                                      y  = ( fabs(y1) <= fabs(y2) ) ? y1 : y2;
+                                                      j  = jj + NGhost;   jm = j - 1;   jp = j + 1;
+               for (int ii=0; ii<PATCH_SIZE; ii++) {  x1 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center    [0];
+                                                      x2 = amr.patch[lv][PID]->corner[0] + (ii+0.5)*scale - Center_Map[0];
+                                                      x  = ( fabs(x1) <= fabs(x2) ) ? x1 : x2;
+                                                      i  = ii + NGhost;   im = i - 1;   ip = i + 1;
+
+                  Radius = sqrt( x*x + y*y + z*z );
+
+                  if ( Radius < MaxRadius )
                   {
-                     cerr << "ERROR : ShellID >= NShell !!" << endl;
-                     exit( 1 );
-                  }
+                     if ( LogBin > 1.0 )  ShellID = ( Radius < ShellWidth ) ? 0 : int( log(Radius/ShellWidth)/log(LogBin) ) + 1;
+                     else                 ShellID = int( Radius / ShellWidth );
 
-#                 if   ( MODEL == HYDRO )
-//                evaluate the values on the shell
-                  rho     = Field[p][DENS    ][k][j][i];
-                  px      = Field[p][MOMX    ][k][j][i];
-                  py      = Field[p][MOMY    ][k][j][i];
-                  pz      = Field[p][MOMZ    ][k][j][i];
-                  egy     = Field[p][ENGY    ][k][j][i];
+                     if ( ShellID >= NShell )
+                     {
+                        cerr << "ERROR : ShellID >= NShell !!" << endl;
+                        exit( 1 );
+                     }
 
-                  for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
-                  pass[u] = Field[p][uu      ][k][j][i];
+   #                 if   ( MODEL == HYDRO )
+   //                evaluate the values on the shell
+                     rho     = Field[p][DENS    ][k][j][i];
+                     px      = Field[p][MOMX    ][k][j][i];
+                     py      = Field[p][MOMY    ][k][j][i];
+                     pz      = Field[p][MOMZ    ][k][j][i];
+                     egy     = Field[p][ENGY    ][k][j][i];
 
-                  if ( OutputPot )
-                  Pot     = Field[p][POTE    ][k][j][i];
+                     for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
+                     pass[u] = Field[p][uu      ][k][j][i];
 
-                  if ( OutputParDens )
-                  ParDens = Field[p][PAR_DENS][k][j][i];
+                     if ( OutputPot )
+                     Pot     = Field[p][POTE    ][k][j][i];
 
-                  pr   = ( x*px + y*py + z*pz ) / Radius;
-                  pt   = sqrt( fabs(px*px + py*py + pz*pz - pr*pr) );
-                  pres = (GAMMA-1.0) * ( egy - 0.5*(px*px + py*py + pz*pz)/rho );
-                  vr   = pr/rho;
-                  vt   = pt/rho;
+                     if ( OutputParDens )
+                     ParDens = Field[p][PAR_DENS][k][j][i];
 
+                     pr   = ( x*px + y*py + z*pz ) / Radius;
+                     pt   = sqrt( fabs(px*px + py*py + pz*pz - pr*pr) );
+                     pres = (GAMMA-1.0) * ( egy - 0.5*(px*px + py*py + pz*pz)/rho );
+                     vr   = pr/rho;
+                     vt   = pt/rho;
 
-//                sum up values at the same shell
-                  Var = 0;
-                  Average[ShellID][Var++] += (double)(dv*rho     );
-                  Average[ShellID][Var++] += (double)(dv*pr      );
-                  Average[ShellID][Var++] += (double)(dv*pt      );
-                  Average[ShellID][Var++] += (double)(dv*egy     );
-                  Average[ShellID][Var++] += (double)(dv*pres    );
 
-                  for (int v=0; v<NCOMP_PASSIVE; v++)
-                  Average[ShellID][Var++] += (double)(dv*pass[v] );
+   //                sum up values at the same shell
+                     Var = 0;
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*rho     );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*pr      );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*pt      );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*egy     );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*pres    );
 
-                  if ( OutputPot )
-                  Average[ShellID][Var++] += (double)(dv*Pot     );
+                     for (int v=0; v<NCOMP_PASSIVE; v++)
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*pass[v] );
 
-                  if ( OutputParDens )
-                  Average[ShellID][Var++] += (double)(dv*ParDens );
+                     if ( OutputPot )
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Pot     );
 
+                     if ( OutputParDens )
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*ParDens );
 
-//                store the maximum and minimum values
-                  Var = 0;
-                  if ( rho     > Max[ShellID][Var] )  Max[ShellID][Var] = rho;       Var++;
-                  if ( vr      > Max[ShellID][Var] )  Max[ShellID][Var] = vr;        Var++;
-                  if ( vt      > Max[ShellID][Var] )  Max[ShellID][Var] = vt;        Var++;
-                  if ( egy     > Max[ShellID][Var] )  Max[ShellID][Var] = egy;       Var++;
-                  if ( pres    > Max[ShellID][Var] )  Max[ShellID][Var] = pres;      Var++;
 
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  if ( pass[v] > Max[ShellID][Var] )  Max[ShellID][Var] = pass[v];   Var++; }
+   //                store the maximum and minimum values
+                     Var = 0;
+                     if ( rho     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = rho;       Var++;
+                     if ( vr      > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = vr;        Var++;
+                     if ( vt      > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = vt;        Var++;
+                     if ( egy     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = egy;       Var++;
+                     if ( pres    > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = pres;      Var++;
 
-                  if ( OutputPot ) {
-                  if ( Pot     > Max[ShellID][Var] )  Max[ShellID][Var] = Pot;       Var++; }
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     if ( pass[v] > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = pass[v];   Var++; }
 
-                  if ( OutputParDens ) {
-                  if ( ParDens > Max[ShellID][Var] )  Max[ShellID][Var] = ParDens;   Var++; }
+                     if ( OutputPot ) {
+                     if ( Pot     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Pot;       Var++; }
 
+                     if ( OutputParDens ) {
+                     if ( ParDens > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = ParDens;   Var++; }
 
-                  Var = 0;
-                  if ( rho     < Min[ShellID][Var] )  Min[ShellID][Var] = rho;      Var++;
-                  if ( vr      < Min[ShellID][Var] )  Min[ShellID][Var] = vr;       Var++;
-                  if ( vt      < Min[ShellID][Var] )  Min[ShellID][Var] = vt;       Var++;
-                  if ( egy     < Min[ShellID][Var] )  Min[ShellID][Var] = egy;      Var++;
-                  if ( pres    < Min[ShellID][Var] )  Min[ShellID][Var] = pres;     Var++;
 
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  if ( pass[v] < Min[ShellID][Var] )  Min[ShellID][Var] = pass[v];  Var++; }
+                     Var = 0;
+                     if ( rho     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = rho;      Var++;
+                     if ( vr      < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = vr;       Var++;
+                     if ( vt      < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = vt;       Var++;
+                     if ( egy     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = egy;      Var++;
+                     if ( pres    < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = pres;     Var++;
 
-                  if ( OutputPot ) {
-                  if ( Pot     < Min[ShellID][Var] )  Min[ShellID][Var] = Pot;      Var++; }
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     if ( pass[v] < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = pass[v];  Var++; }
 
-                  if ( OutputParDens ) {
-                  if ( ParDens < Min[ShellID][Var] )  Min[ShellID][Var] = ParDens;  Var++; }
+                     if ( OutputPot ) {
+                     if ( Pot     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Pot;      Var++; }
 
-#                 elif ( MODEL == MHD )
-#                 warning : WAIT MHD !!!
+                     if ( OutputParDens ) {
+                     if ( ParDens < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = ParDens;  Var++; }
 
-#                 elif ( MODEL == ELBDM )
-//                evaluate the values on the shell
-                  Dens    = Field[p][DENS    ][k][j][i];
-                  Real    = Field[p][REAL    ][k][j][i];
-                  Imag    = Field[p][IMAG    ][k][j][i];
+   #                 elif ( MODEL == MHD )
+   #                 warning : WAIT MHD !!!
 
-                  for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
-                  pass[u] = Field[p][uu      ][k][j][i];
+   #                 elif ( MODEL == ELBDM )
+   //                evaluate the values on the shell
+                     Dens    = Field[p][DENS    ][k][j][i];
+                     Real    = Field[p][REAL    ][k][j][i];
+                     Imag    = Field[p][IMAG    ][k][j][i];
 
-                  if ( OutputPot )
-                  Pot     = Field[p][POTE    ][k][j][i];
+                     for (int u=0, uu=NCOMP_FLUID; u<NCOMP_PASSIVE; u++, uu++)
+                     pass[u] = Field[p][uu      ][k][j][i];
 
-                  if ( OutputParDens )
-                  ParDens = Field[p][PAR_DENS][k][j][i];
+                     if ( OutputPot )
+                     Pot     = Field[p][POTE    ][k][j][i];
 
-                  if ( ELBDM_GetVir )
-                  {
-                     GradD[0] = _2dh*( Field[p][DENS][k ][j ][ip] - Field[p][DENS][k ][j ][im] );
-                     GradD[1] = _2dh*( Field[p][DENS][k ][jp][i ] - Field[p][DENS][k ][jm][i ] );
-                     GradD[2] = _2dh*( Field[p][DENS][kp][j ][i ] - Field[p][DENS][km][j ][i ] );
+                     if ( OutputParDens )
+                     ParDens = Field[p][PAR_DENS][k][j][i];
 
-                     GradR[0] = _2dh*( Field[p][REAL][k ][j ][ip] - Field[p][REAL][k ][j ][im] );
-                     GradR[1] = _2dh*( Field[p][REAL][k ][jp][i ] - Field[p][REAL][k ][jm][i ] );
-                     GradR[2] = _2dh*( Field[p][REAL][kp][j ][i ] - Field[p][REAL][km][j ][i ] );
+                     if ( ELBDM_GetVir )
+                     {
+                        GradD[0] = _2dh*( Field[p][DENS][k ][j ][ip] - Field[p][DENS][k ][j ][im] );
+                        GradD[1] = _2dh*( Field[p][DENS][k ][jp][i ] - Field[p][DENS][k ][jm][i ] );
+                        GradD[2] = _2dh*( Field[p][DENS][kp][j ][i ] - Field[p][DENS][km][j ][i ] );
+
+                        GradR[0] = _2dh*( Field[p][REAL][k ][j ][ip] - Field[p][REAL][k ][j ][im] );
+                        GradR[1] = _2dh*( Field[p][REAL][k ][jp][i ] - Field[p][REAL][k ][jm][i ] );
+                        GradR[2] = _2dh*( Field[p][REAL][kp][j ][i ] - Field[p][REAL][km][j ][i ] );
+
+                        GradI[0] = _2dh*( Field[p][IMAG][k ][j ][ip] - Field[p][IMAG][k ][j ][im] );
+                        GradI[1] = _2dh*( Field[p][IMAG][k ][jp][i ] - Field[p][IMAG][k ][jm][i ] );
+                        GradI[2] = _2dh*( Field[p][IMAG][kp][j ][i ] - Field[p][IMAG][km][j ][i ] );
+
+                        LapR     = ( Field[p][REAL][k ][j ][ip] + Field[p][REAL][k ][jp][i ] + Field[p][REAL][kp][j ][i ] +
+                                     Field[p][REAL][k ][j ][im] + Field[p][REAL][k ][jm][i ] + Field[p][REAL][km][j ][i ] -
+                                     6.0*Real )*_dh2;
+                        LapI     = ( Field[p][IMAG][k ][j ][ip] + Field[p][IMAG][k ][jp][i ] + Field[p][IMAG][kp][j ][i ] +
+                                     Field[p][IMAG][k ][j ][im] + Field[p][IMAG][k ][jm][i ] + Field[p][IMAG][km][j ][i ] -
+                                     6.0*Imag )*_dh2;
+
+                        Ek_Lap = -_2Eta2*( Real*LapR + Imag*LapI );
+                        Ek_Gra = +_2Eta2*( SQR(GradR[0]) + SQR(GradR[1]) + SQR(GradR[2]) +
+                                           SQR(GradI[0]) + SQR(GradI[1]) + SQR(GradI[2])   );
+
+                        _Dens  = 1.0 / Dens;
+
+                        for (int d=0; d<3; d++)
+                        {
+                           v[d] = _Eta*_Dens*( Real*GradI[d] - Imag*GradR[d] );
+                           w[d] = _2Eta*_Dens*GradD[d];
+                        }
+
+                        vr  = ( x*v[0] + y*v[1] + z*v[2] ) / Radius;
+                        vr2 = vr*vr;
+                        vt2 = fabs( v[0]*v[0] + v[1]*v[1] + v[2]*v[2] - vr2 );
+                        vr1 = fabs( vr );
+                        vt1 = sqrt( vt2 );
+
+                        wr  = ( x*w[0] + y*w[1] + z*w[2] ) / Radius;
+                        wr2 = wr*wr;
+                        wt2 = fabs( w[0]*w[0] + w[1]*w[1] + w[2]*w[2] - wr2 );
+                        wr1 = fabs( wr );
+                        wt1 = sqrt( wt2 );
+                     } // if ( ELBDM_GetVir )
+
+
+   //                sum up values at the same shell
+                     Var = 0;
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens     );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Real     );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Imag     );
+
+                     for (int v=0; v<NCOMP_PASSIVE; v++)
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*pass[v] );
+
+                     if ( OutputPot )
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Pot      );
+
+                     if ( OutputParDens )
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*ParDens  );
+
+                     if ( ELBDM_GetVir ) {
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Ek_Lap   );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Ek_Gra   );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*vr  );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*vr2 );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*vt2 );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*wr  );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*wr2 );
+                     OMP_Average[TID][ShellID][Var++] += (double)(dv*Dens*wt2 );
+
+                     for (int d=0; d<3; d++)    OMP_ELBDM_Mom[TID][ShellID][d] += (double)( Real*GradI[d] - Imag*GradR[d] )*dv_Eta;
+
+                     dR_dr                            = ( x*GradR[0] + y*GradR[1] + z*GradR[2] ) / Radius;
+                     dI_dr                            = ( x*GradI[0] + y*GradI[1] + z*GradI[2] ) / Radius;
+                     OMP_ELBDM_RhoUr2 [TID][ShellID] += (double)dv*( SQR(dR_dr) + SQR(dI_dr) )*_Eta2;
+                     OMP_ELBDM_dRho_dr[TID][ShellID] += (double)dv*( x*GradD[0] + y*GradD[1] + z*GradD[2] ) / Radius;
+                     OMP_ELBDM_LapRho [TID][ShellID] += (double)dv*( Field[p][DENS][k ][j ][ip] + Field[p][DENS][k ][jp][i ] +
+                                                                     Field[p][DENS][kp][j ][i ] + Field[p][DENS][k ][j ][im] +
+                                                                     Field[p][DENS][k ][jm][i ] + Field[p][DENS][km][j ][i ] -
+                                                                     6.0*Dens )*_dh2; }
+
+
+   //                store the maximum and minimum values
+                     Var = 0;
+                     if ( Dens    > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Dens;     Var++;
+                     if ( Real    > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Real;     Var++;
+                     if ( Imag    > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Imag;     Var++;
+
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     if ( pass[v] > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = pass[v];  Var++; }
+
+                     if ( OutputPot   ) {
+                     if ( Pot     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Pot;      Var++; }
+
+                     if ( OutputParDens ) {
+                     if ( ParDens > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = ParDens;  Var++; }
+
+                     if ( ELBDM_GetVir ) {
+                     if ( Ek_Lap  > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Ek_Lap;   Var++;
+                     if ( Ek_Gra  > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = Ek_Gra;   Var++;
+                     if ( vr      > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = vr;       Var++;
+                     if ( vr1     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = vr1;      Var++;
+                     if ( vt1     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = vt1;      Var++;
+                     if ( wr      > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = wr;       Var++;
+                     if ( wr1     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = wr1;      Var++;
+                     if ( wt1     > OMP_Max[TID][ShellID][Var] )  OMP_Max[TID][ShellID][Var] = wt1;      Var++; }
+
+                     Var = 0;
+                     if ( Dens    < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Dens;     Var++;
+                     if ( Real    < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Real;     Var++;
+                     if ( Imag    < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Imag;     Var++;
+
+                     for (int v=0; v<NCOMP_PASSIVE; v++) {
+                     if ( pass[v] < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = pass[v];  Var++; }
+
+                     if ( OutputPot     ) {
+                     if ( Pot     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Pot;      Var++; }
+
+                     if ( OutputParDens ) {
+                     if ( ParDens < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = ParDens;  Var++; }
+
+                     if ( ELBDM_GetVir ) {
+                     if ( Ek_Lap  < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Ek_Lap;   Var++;
+                     if ( Ek_Gra  < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = Ek_Gra;   Var++;
+                     if ( vr      < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = vr;       Var++;
+                     if ( vr1     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = vr1;      Var++;
+                     if ( vt1     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = vt1;      Var++;
+                     if ( wr      < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = wr;       Var++;
+                     if ( wr1     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = wr1;      Var++;
+                     if ( wt1     < OMP_Min[TID][ShellID][Var] )  OMP_Min[TID][ShellID][Var] = wt1;      Var++; }
+
+   #                 else
+   #                 error : ERROR : unsupported MODEL !!
+   #                 endif // MODEL
+
+                     OMP_Volume[TID][ShellID] += dv;
+                     OMP_NCount[TID][ShellID] ++;
+
+                  } // if ( Radius < MaxRadius )
+               }}} // kk, jj, ii
+            } // for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
+         } // for (int t=0; t<NTargetPG[lv]; t++)
+
+         delete [] Field1D;
+      } // OpenMP parallel region
 
-                     GradI[0] = _2dh*( Field[p][IMAG][k ][j ][ip] - Field[p][IMAG][k ][j ][im] );
-                     GradI[1] = _2dh*( Field[p][IMAG][k ][jp][i ] - Field[p][IMAG][k ][jm][i ] );
-                     GradI[2] = _2dh*( Field[p][IMAG][kp][j ][i ] - Field[p][IMAG][km][j ][i ] );
+      cout << "done" << endl;
 
-                     LapR     = ( Field[p][REAL][k ][j ][ip] + Field[p][REAL][k ][jp][i ] + Field[p][REAL][kp][j ][i ] +
-                                  Field[p][REAL][k ][j ][im] + Field[p][REAL][k ][jm][i ] + Field[p][REAL][km][j ][i ] -
-                                  6.0*Real )*_dh2;
-                     LapI     = ( Field[p][IMAG][k ][j ][ip] + Field[p][IMAG][k ][jp][i ] + Field[p][IMAG][kp][j ][i ] +
-                                  Field[p][IMAG][k ][j ][im] + Field[p][IMAG][k ][jm][i ] + Field[p][IMAG][km][j ][i ] -
-                                  6.0*Imag )*_dh2;
+   } // for (int lv=0; lv<NLEVEL; lv++)
 
-                     Ek_Lap = -_2Eta2*( Real*LapR + Imag*LapI );
-                     Ek_Gra = +_2Eta2*( SQR(GradR[0]) + SQR(GradR[1]) + SQR(GradR[2]) +
-                                        SQR(GradI[0]) + SQR(GradI[1]) + SQR(GradI[2])   );
 
-                     _Dens  = 1.0 / Dens;
+// merge the thread-private data
+   for (int TID=0; TID<OMP_NThread; TID++)
+   {
+      for (int n=0; n<NShell; n++)
+      {
+         for (int v=0; v<NOut; v++)
+         {
+            Average[n][v] += OMP_Average[TID][n][v];
+            Max    [n][v]  = MAX( Max[n][v], OMP_Max[TID][n][v] );
+            Min    [n][v]  = MIN( Min[n][v], OMP_Min[TID][n][v] );
+         }
 
-                     for (int d=0; d<3; d++)
-                     {
-                        v[d] = _Eta*_Dens*( Real*GradI[d] - Imag*GradR[d] );
-                        w[d] = _2Eta*_Dens*GradD[d];
-                     }
+         Volume[n] += OMP_Volume[TID][n];
+         NCount[n] += OMP_NCount[TID][n];
 
-                     vr  = ( x*v[0] + y*v[1] + z*v[2] ) / Radius;
-                     vr2 = vr*vr;
-                     vt2 = fabs( v[0]*v[0] + v[1]*v[1] + v[2]*v[2] - vr2 );
-                     vr1 = fabs( vr );
-                     vt1 = sqrt( vt2 );
-
-                     wr  = ( x*w[0] + y*w[1] + z*w[2] ) / Radius;
-                     wr2 = wr*wr;
-                     wt2 = fabs( w[0]*w[0] + w[1]*w[1] + w[2]*w[2] - wr2 );
-                     wr1 = fabs( wr );
-                     wt1 = sqrt( wt2 );
-                  } // if ( ELBDM_GetVir )
-
-
-//                sum up values at the same shell
-                  Var = 0;
-                  Average[ShellID][Var++] += (double)(dv*Dens     );
-                  Average[ShellID][Var++] += (double)(dv*Real     );
-                  Average[ShellID][Var++] += (double)(dv*Imag     );
-
-                  for (int v=0; v<NCOMP_PASSIVE; v++)
-                  Average[ShellID][Var++] += (double)(dv*pass[v] );
-
-                  if ( OutputPot )
-                  Average[ShellID][Var++] += (double)(dv*Pot      );
-
-                  if ( OutputParDens )
-                  Average[ShellID][Var++] += (double)(dv*ParDens  );
-
-                  if ( ELBDM_GetVir ) {
-                  Average[ShellID][Var++] += (double)(dv*Ek_Lap   );
-                  Average[ShellID][Var++] += (double)(dv*Ek_Gra   );
-                  Average[ShellID][Var++] += (double)(dv*Dens*vr  );
-                  Average[ShellID][Var++] += (double)(dv*Dens*vr2 );
-                  Average[ShellID][Var++] += (double)(dv*Dens*vt2 );
-                  Average[ShellID][Var++] += (double)(dv*Dens*wr  );
-                  Average[ShellID][Var++] += (double)(dv*Dens*wr2 );
-                  Average[ShellID][Var++] += (double)(dv*Dens*wt2 );
-
-                  for (int d=0; d<3; d++)    ELBDM_Mom[ShellID][d] += (double)( Real*GradI[d] - Imag*GradR[d] )*dv_Eta;
-
-                  dR_dr                   = ( x*GradR[0] + y*GradR[1] + z*GradR[2] ) / Radius;
-                  dI_dr                   = ( x*GradI[0] + y*GradI[1] + z*GradI[2] ) / Radius;
-                  ELBDM_RhoUr2 [ShellID] += (double)dv*( SQR(dR_dr) + SQR(dI_dr) )*_Eta2;
-                  ELBDM_dRho_dr[ShellID] += (double)dv*( x*GradD[0] + y*GradD[1] + z*GradD[2] ) / Radius;
-                  ELBDM_LapRho [ShellID] += (double)dv*( Field[p][DENS][k ][j ][ip] + Field[p][DENS][k ][jp][i ] +
-                                                         Field[p][DENS][kp][j ][i ] + Field[p][DENS][k ][j ][im] +
-                                                         Field[p][DENS][k ][jm][i ] + Field[p][DENS][km][j ][i ] -
-                                                         6.0*Dens )*_dh2; }
-
-
-//                store the maximum and minimum values
-                  Var = 0;
-                  if ( Dens    > Max[ShellID][Var] )  Max[ShellID][Var] = Dens;     Var++;
-                  if ( Real    > Max[ShellID][Var] )  Max[ShellID][Var] = Real;     Var++;
-                  if ( Imag    > Max[ShellID][Var] )  Max[ShellID][Var] = Imag;     Var++;
-
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  if ( pass[v] > Max[ShellID][Var] )  Max[ShellID][Var] = pass[v];  Var++; }
-
-                  if ( OutputPot   ) {
-                  if ( Pot     > Max[ShellID][Var] )  Max[ShellID][Var] = Pot;      Var++; }
-
-                  if ( OutputParDens ) {
-                  if ( ParDens > Max[ShellID][Var] )  Max[ShellID][Var] = ParDens;  Var++; }
-
-                  if ( ELBDM_GetVir ) {
-                  if ( Ek_Lap  > Max[ShellID][Var] )  Max[ShellID][Var] = Ek_Lap;   Var++;
-                  if ( Ek_Gra  > Max[ShellID][Var] )  Max[ShellID][Var] = Ek_Gra;   Var++;
-                  if ( vr      > Max[ShellID][Var] )  Max[ShellID][Var] = vr;       Var++;
-                  if ( vr1     > Max[ShellID][Var] )  Max[ShellID][Var] = vr1;      Var++;
-                  if ( vt1     > Max[ShellID][Var] )  Max[ShellID][Var] = vt1;      Var++;
-                  if ( wr      > Max[ShellID][Var] )  Max[ShellID][Var] = wr;       Var++;
-                  if ( wr1     > Max[ShellID][Var] )  Max[ShellID][Var] = wr1;      Var++;
-                  if ( wt1     > Max[ShellID][Var] )  Max[ShellID][Var] = wt1;      Var++; }
-
-                  Var = 0;
-                  if ( Dens    < Min[ShellID][Var] )  Min[ShellID][Var] = Dens;     Var++;
-                  if ( Real    < Min[ShellID][Var] )  Min[ShellID][Var] = Real;     Var++;
-                  if ( Imag    < Min[ShellID][Var] )  Min[ShellID][Var] = Imag;     Var++;
-
-                  for (int v=0; v<NCOMP_PASSIVE; v++) {
-                  if ( pass[v] < Min[ShellID][Var] )  Min[ShellID][Var] = pass[v];  Var++; }
-
-                  if ( OutputPot     ) {
-                  if ( Pot     < Min[ShellID][Var] )  Min[ShellID][Var] = Pot;      Var++; }
-
-                  if ( OutputParDens ) {
-                  if ( ParDens < Min[ShellID][Var] )  Min[ShellID][Var] = ParDens;  Var++; }
-
-                  if ( ELBDM_GetVir ) {
-                  if ( Ek_Lap  < Min[ShellID][Var] )  Min[ShellID][Var] = Ek_Lap;   Var++;
-                  if ( Ek_Gra  < Min[ShellID][Var] )  Min[ShellID][Var] = Ek_Gra;   Var++;
-                  if ( vr      < Min[ShellID][Var] )  Min[ShellID][Var] = vr;       Var++;
-                  if ( vr1     < Min[ShellID][Var] )  Min[ShellID][Var] = vr1;      Var++;
-                  if ( vt1     < Min[ShellID][Var] )  Min[ShellID][Var] = vt1;      Var++;
-                  if ( wr      < Min[ShellID][Var] )  Min[ShellID][Var] = wr;       Var++;
-                  if ( wr1     < Min[ShellID][Var] )  Min[ShellID][Var] = wr1;      Var++;
-                  if ( wt1     < Min[ShellID][Var] )  Min[ShellID][Var] = wt1;      Var++; }
-
-#                 else
-#                 error : ERROR : unsupported MODEL !!
-#                 endif // MODEL
-
-                  Volume[ShellID] += dv;
-                  NCount[ShellID] ++;
-
-               } // if ( Radius < MaxRadius )
-            }}} // kk, jj, ii
-         } // for (int PID=PID0, p=0; PID<PID0+8; PID++, p++)
-      } // for (int PID0=0; PID0<amr.num[lv]; PID0+=8)
+#        if ( MODEL == ELBDM )
+         if ( ELBDM_GetVir )
+         {
+            for (int d=0; d<3; d++)    ELBDM_Mom[n][d] += OMP_ELBDM_Mom[TID][n][d];
 
-      cout << "done" << endl;
+            ELBDM_RhoUr2 [n] += OMP_ELBDM_RhoUr2 [TID][n];
+            ELBDM_dRho_dr[n] += OMP_ELBDM_dRho_dr[TID][n];
+            ELBDM_LapRho [n] += OMP_ELBDM_LapRho [TID][n];
+         }
+#        endif
+      } // for (int n=0; n<NShell; n++)
 
-   } // for (int lv=0; lv<NLEVEL; lv++)
+      delete [] OMP_Average[TID][0];
+      delete [] OMP_Max    [TID][0];
+      delete [] OMP_Min    [TID][0];
+      delete [] OMP_Average[TID];
+      delete [] OMP_Max    [TID];
+      delete [] OMP_Min    [TID];
+      delete [] OMP_Volume [TID];
+      delete [] OMP_NCount [TID];
+
+#     if ( MODEL == ELBDM )
+      if ( ELBDM_GetVir )
+      {
+         delete [] OMP_ELBDM_Mom    [TID];
+         delete [] OMP_ELBDM_RhoUr2 [TID];
+         delete [] OMP_ELBDM_dRho_dr[TID];
+         delete [] OMP_ELBDM_LapRho [TID];
+      }
+#     endif
+   } // for (int TID=0; TID<OMP_NThread; TID++)
+
+   delete [] OMP_Average;
+   delete [] OMP_Max;
+   delete [] OMP_Min;
+   delete [] OMP_Volume;
+   delete [] OMP_NCount;
+#  if ( MODEL == ELBDM )
+   delete [] OMP_ELBDM_Mom;
+   delete [] OMP_ELBDM_RhoUr2;
+   delete [] OMP_ELBDM_dRho_dr;
+   delete [] OMP_ELBDM_LapRho;
+#  endif
 
 
 // get the average values
@@ -914,8 +1104,6 @@ void ShellAverage()
 #  endif // MODEL
 
 
-   delete [] Field1D;
-
 } // FUNCTION : ShellAverage
 
 
@@ -930,7 +1118,7 @@ void ReadOption( int argc, char **argv )
 
    int c;
 
-   while ( (c = getopt(argc, argv, "hpsSMPVTDcgi:o:n:x:y:z:r:t:m:a:L:R:u:I:e:G:")) != -1 )
+   while ( (c = getopt(argc, argv, "hpsSMPVTDcgi:o:n:x:y:z:r:t:m:a:L:R:u:I:e:G:C:N:")) != -1 )
    {
       switch ( c )
       {
@@ -988,6 +1176,10 @@ void ReadOption( int argc, char **argv )
                    break;
          case 'G': NewtonG          = atof(optarg);
                    break;
+         case 'C': FileName_Center  = optarg;
+                   break;
+         case 'N': OMP_NThread      = atoi(optarg);
+                   break;
          case 'h':
          case '?': cerr << endl << "usage: " << argv[0]
                         << " [-h (for help)] [-i input fileName] [-o suffix to the output file [none]]"
@@ -1026,6 +1218,10 @@ void ReadOption( int argc, char **argv )
                         << endl << "                             "
                         << " [-T (load the tree file) [off]] [-e tree file]"
                         << endl << "                             "
+                        << " [-C file of sphere centers \"x y z [radius]\" (one sphere per line) [off]]"
+                        << endl << "                             "
+                        << " [-N number of OpenMP threads [omp_get_max_threads]]"
+                        << endl << "                             "
                         << " [-S (turn on the mode \"shell average\") [off]]"
                         << endl << "                             "
                         << " [-M (turn on the mode \"maximum density\") [off]]"
@@ -1055,6 +1251,18 @@ void ReadOption( int argc, char **argv )
       exit( 1 );
    }
 
+   if ( FileName_Center != NULL  &&  !Aux_CheckFileExist(FileName_Center) )
+   {
+      fprintf( stderr, "ERROR : the input center file \"%s\" does not exist (-C center file) !!\n", FileName_Center );
+      exit( 1 );
+   }
+
+   if ( NRank > 1  &&  FileName_Center == NULL )
+   {
+      fprintf( stderr, "ERROR : MPI ranks are parallelized over sphere centers --> please provide -C center file !!\n" );
+      exit( 1 );
+   }
+
    if ( NeedGhost  &&  UseTree )
    {
       fprintf( stderr, "ERROR : currently the option \"UseTree\" does not work when ghost zones are required !!\n" );
@@ -1110,6 +1318,29 @@ void ReadOption( int argc, char **argv )
       Aux_Message( stderr, "WARNING : pressure is computed by constant-gamma EoS !!\n" );
 #  endif
 
+
+// set up OpenMP
+#  ifdef OPENMP
+   const int OMP_Max_NThread = omp_get_max_threads();
+
+   if ( OMP_NThread <= 0 )
+   {
+      OMP_NThread = OMP_Max_NThread;
+
+      if ( MyRank == 0 )  fprintf( stdout, "NOTE : parameter \"%s\" is set to the default value = %d\n",
+                                   "OMP_NThread", OMP_NThread );
+   }
+
+   else if ( OMP_NThread > OMP_Max_NThread   &&  MyRank == 0 )
+      fprintf( stderr, "WARNING : OMP_NThread (%d) > omp_get_max_threads (%d) !!\n", OMP_NThread, OMP_Max_NThread );
+
+   omp_set_num_threads( OMP_NThread );
+   omp_set_nested( false );
+
+#  else
+   OMP_NThread = 1;
+#  endif // #ifdef OPENMP ... else ...
+
 } // FUNCTION : ReadOption
 
 
@@ -1143,6 +1374,9 @@ double GetMinShellWidth( const double TCen[], const double TCen_Map[] )
       {
          if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
 
+//       skip patches that cannot contain any cell closer than the current minimum distance
+         if ( GetMinDist( lv, PID, TCen, TCen_Map ) >= r_min )                         continue;
+
          for (int k=0; k<PATCH_SIZE; k++) {  zz = amr.patch[lv][PID]->corner[2] + (k+0.5)*scale;
                                              z1 = zz - TCen    [2];
                                              z2 = zz - TCen_Map[2];
@@ -1608,30 +1842,69 @@ void End()
       for (int PID=0; PID<NPatch; PID++)  amr.pdelete( lv, PID );
    }
 
+   End_ShellAve();
+
+   if ( BaseP         != NULL )  delete [] BaseP;
+   if ( tree          != NULL )  delete tree;
+   if ( CenterList    != NULL )  delete [] CenterList;
+
+} // FUNCTION : End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  End_ShellAve
+// Description :  Deallocate memory for the mode "shell average" and the list of target patch groups
+//
+// Note        :  Invoked for each sphere center when a list of sphere centers is given (-C)
+//-------------------------------------------------------------------------------------------------------
+void End_ShellAve()
+{
+
    if ( NCount        != NULL )  delete [] NCount;
    if ( Volume        != NULL )  delete [] Volume;
 
-   if ( Average[0]    != NULL )  delete [] Average[0];
-   if ( RMS    [0]    != NULL )  delete [] RMS    [0];
-   if ( Max    [0]    != NULL )  delete [] Max    [0];
-   if ( Min    [0]    != NULL )  delete [] Min    [0];
-
-   if ( Average       != NULL )  delete [] Average;
-   if ( RMS           != NULL )  delete [] RMS;
-   if ( Max           != NULL )  delete [] Max;
-   if ( Min           != NULL )  delete [] Min;
+   if ( Average       != NULL )
+   {
+      delete [] Average[0];
+      delete [] RMS    [0];
+      delete [] Max    [0];
+      delete [] Min    [0];
+
+      delete [] Average;
+      delete [] RMS;
+      delete [] Max;
+      delete [] Min;
+   }
 
 #  if ( MODEL == ELBDM )
    if ( ELBDM_Mom     != NULL )  delete [] ELBDM_Mom;
    if ( ELBDM_RhoUr2  != NULL )  delete [] ELBDM_RhoUr2;
    if ( ELBDM_dRho_dr != NULL )  delete [] ELBDM_dRho_dr;
    if ( ELBDM_LapRho  != NULL )  delete [] ELBDM_LapRho;
+
+   ELBDM_Mom     = NULL;
+   ELBDM_RhoUr2  = NULL;
+   ELBDM_dRho_dr = NULL;
+   ELBDM_LapRho  = NULL;
 #  endif
 
-   if ( BaseP         != NULL )  delete [] BaseP;
-   if ( tree          != NULL )  delete tree;
+   NCount  = NULL;
+   Volume  = NULL;
+   Average = NULL;
+   RMS     = NULL;
+   Max     = NULL;
+   Min     = NULL;
 
-} // FUNCTION : End
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      if ( TargetPG[lv] != NULL )   delete [] TargetPG[lv];
+
+      TargetPG [lv] = NULL;
+      NTargetPG[lv] = 0;
+   }
+
+} // FUNCTION : End_ShellAve
 
 
 
@@ -1745,6 +2018,10 @@ void SetMaxRhoPos( const int AveN )
    int    PeakOutside_Lv;
    int    MaxRho_Lv[AveN];
 
+// all patches are loaded for a list of sphere centers (-C)
+// --> only check cells inside the target sphere to avoid reporting other density peaks in the simulation box
+   const double PeakOutside_MaxR = ( NCenter > 0 ) ? MaxRadius : __FLT_MAX__;
+
 
 // initialize the array recording the maximum density
    for (int t=0; t<AveN; t++)    MaxRho[t] = MinRho;
@@ -1759,6 +2036,9 @@ void SetMaxRhoPos( const int AveN )
       {
          if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
 
+//       skip patches lying completely outside the target region
+         if ( GetMinDist( lv, PID, Center, Center_Map ) > UseMaxRhoPos_R )             continue;
+
          for (int k=0; k<PATCH_SIZE; k++) {  z   = amr.patch[lv][PID]->corner[2] + (k+0.5)*scale;
                                              dz1 = z - Center    [2];
                                              dz2 = z - Center_Map[2];
@@ -1813,6 +2093,8 @@ void SetMaxRhoPos( const int AveN )
       {
          if ( amr.patch[lv][PID]->fluid == NULL  ||  amr.patch[lv][PID]->son != -1 )   continue;
 
+         if ( GetMinDist( lv, PID, Center, Center_Map ) >= PeakOutside_MaxR )          continue;
+
          for (int k=0; k<PATCH_SIZE; k++) {  z   = amr.patch[lv][PID]->corner[2] + (k+0.5)*scale;
                                              dz1 = z - Center    [2];
                                              dz2 = z - Center_Map[2];
@@ -1831,7 +2113,7 @@ void SetMaxRhoPos( const int AveN )
 
             Radius = sqrt( dx*dx + dy*dy + dz*dz );
 
-            if ( Rho > MinRho  &&  Radius > UseMaxRhoPos_R )
+            if ( Rho > MinRho  &&  Radius > UseMaxRhoPos_R  &&  Radius < PeakOutside_MaxR )
             {
                if ( PeakOutside_First )
                {
@@ -1855,7 +2137,7 @@ void SetMaxRhoPos( const int AveN )
                   PeakOutside_R      = Radius;
                   PeakOutside_MaxRho = Rho;
                }
-            } // if ( Rho > MinRho  &&  Radius > UseMaxRhoPos_R )
+            } // if ( Rho > MinRho  &&  Radius > UseMaxRhoPos_R  &&  Radius < PeakOutside_MaxR )
          }}} // i, j, k
       } // for (int PID=0; PID<amr.num[lv]; PID++)
    } // for (int lv=0; lv<NLEVEL; lv++)
@@ -1933,19 +2215,26 @@ void SetMaxRhoPos( const int AveN )
    printf( "   ===================================================================================\n" );
 
 
-// remove the allocated patches (because the candidate box may be wrong due to the incorrect sphere center)
-   int NPatch;
+// all patches have been loaded for a list of sphere centers --> just update the mapped sphere center
+   if ( NCenter > 0 )
+      SetCenterMap();
 
-   for (int lv=NLEVEL-1; lv>=0; lv--)
+   else
    {
-      NPatch = amr.num[lv];
+//    remove the allocated patches (because the candidate box may be wrong due to the incorrect sphere center)
+      int NPatch;
 
-      for (int PID=0; PID<NPatch; PID++)  amr.pdelete( lv, PID );
-   }
+      for (int lv=NLEVEL-1; lv>=0; lv--)
+      {
+         NPatch = amr.num[lv];
+
+         for (int PID=0; PID<NPatch; PID++)  amr.pdelete( lv, PID );
+      }
 
 
-// reload the patches with the new sphere center
-   LoadData();
+//    reload the patches with the new sphere center
+      LoadData();
+   }
 
 
    cout << "SetMaxRhoPos ... done" << endl;
@@ -2002,6 +2291,18 @@ void TakeNote( int argc, char **argv )
    printf( "SUPPORT_HDF5     = %14s\n",     "OFF"                     );
 #  endif
 
+#  ifdef OPENMP
+   printf( "OPENMP           = %14s\n",     "ON"                      );
+#  else
+   printf( "OPENMP           = %14s\n",     "OFF"                     );
+#  endif
+
+#  ifdef SERIAL
+   printf( "SERIAL           = %14s\n",     "ON"                      );
+#  else
+   printf( "SERIAL           = %14s\n",     "OFF"                     );
+#  endif
+
    printf( "NCOMP_FLUID      = %14d\n",     NCOMP_FLUID               );
    printf( "NCOMP_PASSIVE    = %14d\n",     NCOMP_PASSIVE             );
    printf( "DumpID           = %14d\n",     DumpID                    );
@@ -2049,6 +2350,10 @@ void TakeNote( int argc, char **argv )
    printf( "ELBDM_ETA        = %14.7e\n",   ELBDM_ETA );
 #  endif
    printf( "INT_MONO_COEFF   = %14.7e\n",   INT_MONO_COEFF );
+   printf( "OMP_NThread      = %14d\n",     OMP_NThread                 );
+   printf( "NRank            = %14d\n",     NRank                       );
+   printf( "NCenter          = %14d\n",     NCenter                     );
+   printf( "FileName_Center  =  %s\n",      FileName_Center             );
    printf( "GetAvePot        =  %s\n",      (GetAvePot)?"YES":"NO"      );
    if ( GetAvePot )
    printf( "NewtonG          = %14.7e\n",   NewtonG                     );
@@ -2256,6 +2561,284 @@ void GetR( const int n, double &r, double &dr )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCenterMap
+// Description :  Set up the "mapped" sphere center for the periodic B.C.
+//
+// Note        :  1. Periodic     BC: Center_Map == Center mapped by periodicity
+//                   Non-periodic BC: Center_Map == Center
+//                2. Must be invoked whenever the sphere center is changed
+//-------------------------------------------------------------------------------------------------------
+void SetCenterMap()
+{
+
+   const double HalfBox[3] = { 0.5*amr.BoxScale[0], 0.5*amr.BoxScale[1], 0.5*amr.BoxScale[2] };
+
+   if ( Periodic )
+      for (int d=0; d<3; d++)
+         Center_Map[d] = ( Center[d] > HalfBox[d] ) ? Center[d]-2.0*HalfBox[d] : Center[d]+2.0*HalfBox[d];
+
+   else
+      for (int d=0; d<3; d++)
+         Center_Map[d] = Center[d];
+
+} // FUNCTION : SetCenterMap
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetShellWidth
+// Description :  Set the shell width and the number of shells of the target sphere
+//
+// Note        :  Must be invoked after the sphere center and radius are set
+//-------------------------------------------------------------------------------------------------------
+void SetShellWidth()
+{
+
+   if ( LogBin > 1.0 )
+   {
+      ShellWidth = GetMinShellWidth( Center, Center_Map );
+
+      if ( GetNShell > 0.0 )  ShellWidth *= GetNShell;   // minimum shell width in the log bin
+
+      NShell = int( log(MaxRadius/ShellWidth)/log(LogBin) ) + 2;
+   }
+
+   else  // linear bin
+   {
+      if ( GetNShell > 0.0 )
+      {
+         ShellWidth = GetNShell * GetMinShellWidth( Center, Center_Map );
+         NShell     = (int)ceil( MaxRadius / ShellWidth );
+      }
+
+      else
+         ShellWidth = MaxRadius / (double)NShell;
+   }
+
+} // FUNCTION : SetShellWidth
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMinDist
+// Description :  Return the lower bound of the distances between the target sphere center and all cells in
+//                the target patch
+//
+// Note        :  1. Estimated from the patch corner so that patches lying completely outside the target sphere
+//                   can be skipped without looping over their cells
+//                2. Periodicity is taken into account in the same way as the cell-by-cell calculation (i.e., the
+//                   closer one of TCen and TCen_Map is chosen in each direction)
+//                   --> The returned value never exceeds the distance of any cell computed cell-by-cell
+//
+// Parameter   :  lv       : Target refinement level
+//                PID      : Target patch index
+//                TCen     : Center of the targeted sphere
+//                TCen_Map : Center of the mapped targeted sphere (useful only if Periodic is enabled)
+//-------------------------------------------------------------------------------------------------------
+double GetMinDist( const int lv, const int PID, const double TCen[], const double TCen_Map[] )
+{
+
+   const double scale = (double)amr.scale[lv];
+
+   double CenL, CenR, d1, d2, Dist2=0.0;
+
+   for (int d=0; d<3; d++)
+   {
+//    coordinates of the first and last cell centers along d
+      CenL   = amr.patch[lv][PID]->corner[d] + 0.5*scale;
+      CenR   = amr.patch[lv][PID]->corner[d] + (PATCH_SIZE-0.5)*scale;
+
+      d1     = MAX(  MAX( CenL-TCen    [d], TCen    [d]-CenR ), 0.0  );
+      d2     = MAX(  MAX( CenL-TCen_Map[d], TCen_Map[d]-CenR ), 0.0  );
+
+      Dist2 += SQR(  MIN( d1, d2 )  );
+   }
+
+   return sqrt( Dist2 );
+
+} // FUNCTION : GetMinDist
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_TargetPatchGroup
+// Description :  Record the patch groups intersecting the target sphere at each level
+//
+// Note        :  1. A patch group is recorded if it contains at least one leaf patch with data and with
+//                   GetMinDist() < MaxRadius
+//                   --> ShellAverage and GetRMS only loop over these patch groups
+//                2. Results are stored in TargetPG[lv][0 ... NTargetPG[lv]-1] in the ascending order of PID0
+//                3. Memory is freed by End_ShellAve
+//-------------------------------------------------------------------------------------------------------
+void Init_TargetPatchGroup()
+{
+
+   cout << "Init_TargetPatchGroup ... " << flush;
+
+
+   int PID;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      TargetPG [lv] = new int [ amr.num[lv]/8 ];
+      NTargetPG[lv] = 0;
+
+      for (int PID0=0; PID0<amr.num[lv]; PID0+=8)
+      {
+         for (PID=PID0; PID<PID0+8; PID++)
+         {
+            if ( amr.patch[lv][PID]->fluid != NULL  &&  amr.patch[lv][PID]->son == -1  &&
+                 GetMinDist( lv, PID, Center, Center_Map ) < MaxRadius )
+               break;
+         }
+
+         if ( PID < PID0+8 )  TargetPG[lv][ NTargetPG[lv] ++ ] = PID0;
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+   cout << "done" << endl;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+      if ( NTargetPG[lv] > 0 )   printf( "   Lv %2d: %10d patch groups\n", lv, NTargetPG[lv] );
+
+} // FUNCTION : Init_TargetPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadCenterList
+// Description :  Load the list of sphere centers from the file "FileName_Center"
+//
+// Note        :  1. Each line stores "x y z [radius]" of one sphere
+//                   --> Lines not starting with three numbers (e.g., comments starting with '#') are skipped
+//                   --> Radius <= 0 or not provided --> use the sphere radius set by "-r"
+//                2. Coordinates and radii are in the same units as "-x/y/z/r" (i.e., cell scales if "-s" is on)
+//                3. Must be invoked after LoadData, which loads all patches once for all spheres when
+//                   FileName_Center is set (see CheckWithinTargetRegion)
+//-------------------------------------------------------------------------------------------------------
+void LoadCenterList()
+{
+
+   cout << "LoadCenterList ... " << flush;
+
+
+   const int    MaxLine = 1024;
+   const double _dh_min = ( InputScale ) ? 1.0 : 1.0/amr.dh[NLEVEL-1];
+
+   char   Line[MaxLine];
+   double Tmp[4];
+
+   FILE *File = fopen( FileName_Center, "r" );
+
+   if ( File == NULL )
+      Aux_Error( ERROR_INFO, "the input center file \"%s\" does not exist !!\n", FileName_Center );
+
+
+// count the number of sphere centers
+   NCenter = 0;
+
+   while ( fgets( Line, MaxLine, File ) != NULL )
+      if ( sscanf( Line, "%lf%lf%lf", Tmp, Tmp+1, Tmp+2 ) == 3 )   NCenter ++;
+
+   if ( NCenter == 0 )
+      Aux_Error( ERROR_INFO, "no sphere center is found in the file \"%s\" !!\n", FileName_Center );
+
+
+// load the sphere centers and convert them to cell scales
+   CenterList = new double [NCenter][4];
+
+   rewind( File );
+
+   for (int c=0; c<NCenter; )
+   {
+      if ( fgets( Line, MaxLine, File ) == NULL )
+         Aux_Error( ERROR_INFO, "failed to reload the file \"%s\" !!\n", FileName_Center );
+
+      Tmp[3] = -1.0;
+
+      if ( sscanf( Line, "%lf%lf%lf%lf", Tmp, Tmp+1, Tmp+2, Tmp+3 ) < 3 )  continue;
+
+      for (int d=0; d<3; d++)    CenterList[c][d] = Tmp[d]*_dh_min;
+
+      CenterList[c][3] = ( Tmp[3] > 0.0 ) ? Tmp[3]*_dh_min : MaxRadius;
+
+      c ++;
+   }
+
+   fclose( File );
+
+
+   cout << "done (" << NCenter << " sphere centers)" << endl;
+
+} // FUNCTION : LoadCenterList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_Center
+// Description :  Set the sphere center and radius to the target sphere in the list of sphere centers
+//
+// Parameter   :  c                   : Index of the target sphere in CenterList
+//                UseMaxRhoPos_R_Auto : Set UseMaxRhoPos_R to the radius of the target sphere (i.e., -R is not set)
+//-------------------------------------------------------------------------------------------------------
+void Init_Center( const int c, const bool UseMaxRhoPos_R_Auto )
+{
+
+   for (int d=0; d<3; d++)    Center[d] = CenterList[c][d];
+
+   MaxRadius = CenterList[c][3];
+
+   if ( UseMaxRhoPos_R_Auto )    UseMaxRhoPos_R = MaxRadius;
+
+   SetCenterMap();
+
+   printf( "\n   ===================================================================================\n" );
+   printf( "   Sphere %d/%d: center (%13.7e, %13.7e, %13.7e), radius %13.7e\n", c, NCenter,
+           Center[0]*amr.dh[NLEVEL-1], Center[1]*amr.dh[NLEVEL-1], Center[2]*amr.dh[NLEVEL-1],
+           MaxRadius*amr.dh[NLEVEL-1] );
+   printf( "   ===================================================================================\n" );
+
+} // FUNCTION : Init_Center
+
+
+
+#ifndef SERIAL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_MPI
+// Description :  Initialize MPI and parameters for parallelization
+//
+// Note        :  MPI ranks are parallelized over the spheres in the list of sphere centers
+//-------------------------------------------------------------------------------------------------------
+void Init_MPI( int *argc, char ***argv )
+{
+
+   if ( MPI_Init( argc, argv ) != MPI_SUCCESS )
+   {
+      cerr << "MPI_Init failed !!" << endl;
+      exit( 1 );
+   }
+
+   if ( MPI_Comm_rank( MPI_COMM_WORLD, &MyRank ) != MPI_SUCCESS )
+   {
+      cerr << "MPI_Comm_rank failed !!" << endl;
+      exit( 1 );
+   }
+
+   if ( MPI_Comm_size( MPI_COMM_WORLD, &NRank ) != MPI_SUCCESS )
+   {
+      cerr << "MPI_Comm_size failed !!" << endl;
+      exit( 1 );
+   }
+
+   if ( MyRank == 0 )   cout << "Init_MPI ... done" << endl;
+
+} // FUNCTION : Init_MPI
+#endif
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  main
 // Description :
@@ -2263,33 +2846,71 @@ void GetR( const int n, double &r, double &dr )
 int main( int argc, char ** argv )
 {
 
+#  ifndef SERIAL
+   Init_MPI( &argc, &argv );
+#  endif
+
    ReadOption( argc, argv );
 
+// the maximum radius for UseMaxRhoPos follows the radius of each sphere if it is not set by -R
+   const bool UseMaxRhoPos_R_Auto = ( UseMaxRhoPos_R <= 0.0 );
+
    if ( UseTree )    LoadTree();
 
    LoadData();
 
-   if ( UseMaxRhoPos > 0 )    SetMaxRhoPos( UseMaxRhoPos );
-
-   TakeNote( argc, argv );
+   if ( FileName_Center != NULL )   LoadCenterList();
 
-   CheckParameter();
 
-   if ( Mode_MaxRho )   GetMaxRho();
+// loop over all target spheres (distributed to MPI ranks in a round-robin fashion)
+   const int  MaxString = 512;
+   const int  NSphere   = ( NCenter > 0 ) ? NCenter : 1;
+   char      *Suffix_In = Suffix;
+   char       Suffix_Center[MaxString];
 
-   if ( Mode_ShellAve )
+   for (int c=MyRank; c<NSphere; c+=NRank)
    {
-      Init_ShellAve();
+//    set the sphere center and radius (which have been set by LoadData for a single sphere)
+      if ( NCenter > 0 )
+      {
+         Init_Center( c, UseMaxRhoPos_R_Auto );
 
-      ShellAverage();
+         sprintf( Suffix_Center, "%s_C%06d", (Suffix_In==NULL)?"":Suffix_In, c );
+         Suffix = Suffix_Center;
+      }
 
-      GetRMS();
+      if ( UseMaxRhoPos > 0 )    SetMaxRhoPos( UseMaxRhoPos );
 
-      Output_ShellAve();
-   }
+      if ( NCenter > 0 )         SetShellWidth();
+
+      TakeNote( argc, argv );
+
+      CheckParameter();
+
+      if ( Mode_MaxRho )   GetMaxRho();
+
+      if ( Mode_ShellAve )
+      {
+         Init_ShellAve();
+
+         Init_TargetPatchGroup();
+
+         ShellAverage();
+
+         GetRMS();
+
+         Output_ShellAve();
+
+         End_ShellAve();
+      }
+   } // for (int c=MyRank; c<NSphere; c+=NRank)
 
    End();
 
+#  ifndef SERIAL
+   MPI_Finalize();
+#  endif
+
 
    cout << "Program terminated successfully" << endl;
 
@@ -287,6 +287,11 @@ void LoadData()
       ExpectSize += (long)NParVarOut*NPar*sizeof(real);
    }
 
+// patch index appended after the particle data since version 2230
+   if ( FormatVersion >= 2230 )
+   for (int lv=0; lv<NLEVEL; lv++)
+      ExpectSize += (long)NPatchTotal[lv]*4*sizeof(int);       // 4 = corner(3) + son(1)
+
    fseek( File, 0, SEEK_END );
    InputSize = ftell( File );
 
@@ -419,10 +419,15 @@ void LoadData_HDF5( const char *FileName )
    if ( H5_MemID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemDims_Field" );
 
 
-// load data in one rank at a time
-   for (int TRank=0; TRank<NGPU; TRank++)
+// load data by NLoadRank ranks at a time
+// --> each rank only reads the patches within its own sub-domain, so by default all ranks load data concurrently
+//     and the number of concurrent readers can be reduced by the option "-L" to avoid overloading the file system
+   const int NLoadRank_Now = ( NLoadRank <= 0  ||  NLoadRank > NGPU ) ? NGPU : NLoadRank;
+   const int NLoadGroup    = ( NGPU + NLoadRank_Now - 1 ) / NLoadRank_Now;
+
+   for (int TGroup=0; TGroup<NLoadGroup; TGroup++)
    {
-      if ( MyRank == TRank )
+      if ( MyRank/NLoadRank_Now == TGroup )
       {
 //       4-3. open the target datasets just once
          H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
@@ -477,10 +482,10 @@ void LoadData_HDF5( const char *FileName )
          if ( OutputParDens )                H5_Status = H5Dclose( H5_SetID_Field[NCOMP_TOTAL+1] );
          H5_Status = H5Gclose( H5_GroupID_GridData );
          H5_Status = H5Fclose( H5_FileID );
-      } // if ( MyRank == TargetRank )
+      } // if ( MyRank/NLoadRank_Now == TGroup )
 
       MPI_Barrier( MPI_COMM_WORLD );
-   } // for (int TargetRank=0; TargetRank<NGPU; TargetRank++)
+   } // for (int TGroup=0; TGroup<NLoadGroup; TGroup++)
 
 // free HDF5 objects
    H5_Status = H5Sclose( H5_SpaceID_Field );
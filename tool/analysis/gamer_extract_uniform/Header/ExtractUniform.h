@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <unistd.h>
 #include <cstdio>
+#include <climits>
 #ifndef SERIAL
 #include <mpi.h>
 #endif
@@ -0,0 +1,11 @@
+#ifndef __GAMER_ANALYSIS_H__
+#define __GAMER_ANALYSIS_H__
+
+
+
+// header included by the shared sources in "gamer_analysis_lib"
+#include "ExtractUniform.h"
+
+
+
+#endif // #ifndef __GAMER_ANALYSIS_H__
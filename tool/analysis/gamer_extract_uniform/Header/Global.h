@@ -8,6 +8,7 @@ extern AMR_t      amr;
 extern ParaVar_t  ParaVar;
 extern double     GAMMA, MU, H0;
 extern int        NX0_TOT[3], NX0[3], MyRank, MyRank_X[3], SibRank[26], NGPU, NGPU_X[3], TargetLevel, DumpID;
+extern int        NLoadRank;
 extern int        *BaseP, *BounP_IDMap[NLEVEL][26], SendP_NList[NLEVEL][26], *SendP_IDList[NLEVEL][26];
 extern int        RecvP_NList[NLEVEL][26], *RecvP_IDList[NLEVEL][26], NPatchComma[NLEVEL][28];
 extern int        TargetX[3], X[3], NLoad, NOut, ShiftScale[3], ExtBC;
@@ -32,6 +32,7 @@ double      PhyCoord_Start[3] = { WRONG, WRONG, WRONG };    // starting physical
 double      PhyCoord_Size [3] = { WRONG, WRONG, WRONG };    // targeted size in physical coordinates
 double      OutCoord_Start[3] = { WRONG, WRONG, WRONG };    // real starting physical coordinates independent of Shift2Center
 int         NGPU_X[3]         = { 1, 1, 1 };                // number of MPI ranks in each direction
+int         NLoadRank         = -1;                         // number of MPI ranks loading data concurrently (<=0 --> all)
 int         CanBuf            = WRONG;                      // buffer size for the candidate box
 int         NLoad             = NCOMP_TOTAL;                // number of variables loaded from the input file
 int         NOut              = NCOMP_TOTAL;                // number of variables to be outputted
@@ -78,7 +79,7 @@ void ReadOption( int argc, char **argv )
    double Temp_Size [3] = { WRONG, WRONG, WRONG };
    int c;
 
-   while ( (c = getopt(argc, argv, "hPUdvVTscwki:o:l:n:x:y:z:X:Y:Z:p:q:r:I:m:t:e:B:u:f:")) != -1 )
+   while ( (c = getopt(argc, argv, "hPUdvVTscwki:o:l:n:x:y:z:X:Y:Z:p:q:r:I:m:t:e:B:u:f:L:")) != -1 )
    {
       switch ( c )
       {
@@ -113,6 +114,8 @@ void ReadOption( int argc, char **argv )
                    break;
          case 'r': NGPU_X[2]       = atoi(optarg);
                    break;
+         case 'L': NLoadRank       = atoi(optarg);
+                   break;
 #        endif
          case 'I': IntScheme       = (IntScheme_t)atoi(optarg);
                    break;
@@ -156,6 +159,8 @@ void ReadOption( int argc, char **argv )
 #                       ifndef SERIAL
                         << endl << "                             "
                         << " [-p/q/r # of ranks in the x/y/z directions [1,1,1]]"
+                        << endl << "                             "
+                        << " [-L # of ranks loading data concurrently (<=0: all) [all]]"
 #                       endif
 #                       if   ( MODEL == HYDRO  ||  MODEL == MHD )
                         << endl << "                             "
@@ -393,12 +398,6 @@ void ReadOption( int argc, char **argv )
    }
 #  endif
 
-   if (  ( OutputFormat == 2 || OutputFormat == 3 )  &&  ( NGPU_X[0] != 1 || NGPU_X[1] != 1 )  )
-   {
-      cerr << "ERROR : only slab decomposition is allowed (-p 1 -q 1 -r NP) for the HDF5 and C-binary output formats !!" << endl;
-      exit( 1 );
-   }
-
    if ( ExtBC < 0  ||  ExtBC > 1 )
    {
       cerr << "ERROR : incorrect ExtBC input (-B 0/1) !!" << endl;
@@ -521,6 +520,7 @@ void TakeNote( int argc, char *argv[] )
    cout << "NGPU_X[0]         = " << NGPU_X[0]                            << endl;
    cout << "NGPU_X[1]         = " << NGPU_X[1]                            << endl;
    cout << "NGPU_X[2]         = " << NGPU_X[2]                            << endl;
+   cout << "NLoadRank         = " << NLoadRank                            << endl;
 
    cout << "----------------------------------------------------------"   << endl;
    cout << "TargetLv          = " << TargetLevel                          << endl;
@@ -760,11 +760,32 @@ void Output()
 
 
 
-// 3. initialize the HDF5 output
+// 3. set the global array size of the output data and the offset and size of the sub-array of this rank
+//    --> for the projection modes, only the ranks with MyRank_X[ProjDir] == 0 hold the projected data after "SumOverRanks"
+//    --> ranks not overlapping with the target domain have Out_MySize[d] == 0 and thus output nothing
+   const bool OutputRank = (      OutputXYZ  < 4
+                              ||  OutputXYZ == 7
+                              || ( OutputXYZ == 4 && MyRank_X[0] == 0 )
+                              || ( OutputXYZ == 5 && MyRank_X[1] == 0 )
+                              || ( OutputXYZ == 6 && MyRank_X[2] == 0 )  );
+   int  Out_Size[3], Out_MyOffset[3], Out_MySize[3];
+   bool Out_Empty = false;
+
+   for (int d=0; d<3; d++)
+   {
+      Out_Size    [d] = ( OutputXYZ == 4+d ) ? 1 : Idx_Size[d];
+      Out_MySize  [d] = ( OutputRank ) ? Idx_MySize[d] : 0;
+      Out_MyOffset[d] = ( Out_MySize[d] > 0  &&  OutputXYZ != 4+d ) ? Idx_MyStart[d]-Idx_Start[d] : 0;
+
+      if ( Out_MySize[d] <= 0 )  Out_Empty = true;
+   }
+
+
+
+// 4. initialize the HDF5 output
 #  ifdef SUPPORT_HDF5
    hid_t   H5_FileID, H5_GroupID_Data, H5_SpaceID_Data;
    herr_t  H5_Status;
-   int     Idx_AllRankSizeZ[NGPU];
 
    if ( OutputFormat == 2 )
    {
@@ -772,9 +793,9 @@ void Output()
       hsize_t H5_SetDims_Data[3];
 
 //    create the data space
-      H5_SetDims_Data[0] = ( OutputXYZ == 6 ) ? 1 : Idx_Size[2];
-      H5_SetDims_Data[1] = ( OutputXYZ == 5 ) ? 1 : Idx_Size[1];
-      H5_SetDims_Data[2] = ( OutputXYZ == 4 ) ? 1 : Idx_Size[0];
+      H5_SetDims_Data[0] = Out_Size[2];
+      H5_SetDims_Data[1] = Out_Size[1];
+      H5_SetDims_Data[2] = Out_Size[0];
 
       H5_SpaceID_Data = H5Screate_simple( 3, H5_SetDims_Data, NULL );
       if ( H5_SpaceID_Data < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_SpaceID_Data" );
@@ -824,32 +845,24 @@ void Output()
          H5_Status = H5Gclose( H5_GroupID_Data );
          H5_Status = H5Fclose( H5_FileID );
       } // if ( MyRank == 0 )
-
-//    get the array size of all ranks (assuming slab decomposition)
-      MPI_Allgather( &Idx_MySize[2], 1, MPI_INT, Idx_AllRankSizeZ, 1, MPI_INT, MPI_COMM_WORLD );
    } // if ( OutputFormat == 2 )
 #  endif // #ifdef SUPPORT_HDF5
 
 
 
-// 3. output data
+// 5. output data
+// 5-1. text file --> all components will be outputted to the same file
+//      --> one rank at a time since each line records its own coordinates
    int    ii, jj, kk;
    long   ID;
    double x, y, z;
    real   u[NOut];
 
-   for (int TargetRank=0; TargetRank<NGPU; TargetRank++)
+   if ( OutputFormat == 1 )
    {
-//    for the output-slice operation, the useless rank will NOT output any data because one of the Idx_MySize[x]
-//    will be equal to zero
-      if (   MyRank == TargetRank  &&  (      OutputXYZ  < 4
-                                         ||   OutputXYZ == 7
-                                         || ( OutputXYZ == 4 && MyRank_X[0] == 0 )
-                                         || ( OutputXYZ == 5 && MyRank_X[1] == 0 )
-                                         || ( OutputXYZ == 6 && MyRank_X[2] == 0 )  )   )
+      for (int TargetRank=0; TargetRank<NGPU; TargetRank++)
       {
-//       3-1. text file --> all components will be outputted to the same file
-         if ( OutputFormat == 1 )
+         if ( MyRank == TargetRank  &&  OutputRank )
          {
             FILE *File = fopen( FileName_Out, "a" );
 
@@ -929,95 +942,162 @@ void Output()
             }}} // i,j,k
 
             fclose( File );
-         } // if ( OutputFormat == 1 )
+         } // if ( MyRank == TargetRank  &&  OutputRank )
 
+         MPI_Barrier( MPI_COMM_WORLD );
+      } // for (int TargetRank=0; TargetRank<NGPU; TargetRank++)
+   } // if ( OutputFormat == 1 )
 
-//       3-2. HDF5 file --> different components will be outputted to different datasets in the same file
-#        ifdef SUPPORT_HDF5
-         else if ( OutputFormat == 2 )
-         {
-            hid_t   H5_MemID_Data;
-            hsize_t H5_MemDims_Data[3], H5_Count_Data[3], H5_Offset_Data[3];
 
-//          HDF5 file must be synchronized before being written by the next rank
-            SyncHDF5File( FileName_Out );
+// 5-2. HDF5 file --> different components will be outputted to different datasets in the same file
+//      --> each rank writes its own hyperslab of the global array, which works for arbitrary 3D decompositions
+//      --> all ranks write collectively if HDF5 is built with parallel I/O support and one rank at a time otherwise
+#  ifdef SUPPORT_HDF5
+   else if ( OutputFormat == 2 )
+   {
+      hid_t   H5_MemID_Data, H5_FileAccPropList, H5_DataXferPropList;
+      hsize_t H5_MemDims_Data[3], H5_Count_Data[3], H5_Offset_Data[3];
 
-//          reopen the file and group
-            H5_FileID = H5Fopen( FileName_Out, H5F_ACC_RDWR, H5P_DEFAULT );
-            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName_Out );
+//    set the memory space and the subset of the dataspace
+//    --> use a dummy memory space and empty selections for ranks without any data
+      for (int d=0; d<3; d++)
+      {
+         H5_MemDims_Data[2-d] = ( Out_Empty ) ? 1 : Out_MySize[d];
+         H5_Offset_Data [2-d] = Out_MyOffset[d];
+         H5_Count_Data  [2-d] = Out_MySize  [d];
+      }
 
-            H5_GroupID_Data = H5Gopen( H5_FileID, "Data", H5P_DEFAULT );
-            if ( H5_GroupID_Data < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Data" );
+      H5_MemID_Data = H5Screate_simple( 3, H5_MemDims_Data, NULL );
+      if ( H5_MemID_Data < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID_Data" );
 
-//          set the memory space
-            H5_MemDims_Data[0] = Idx_MySize[2];
-            H5_MemDims_Data[1] = Idx_MySize[1];
-            H5_MemDims_Data[2] = Idx_MySize[0];
+      if ( Out_Empty )
+      {
+         H5_Status = H5Sselect_none( H5_MemID_Data );
+         H5_Status = H5Sselect_none( H5_SpaceID_Data );
+      }
 
-            H5_MemID_Data = H5Screate_simple( 3, H5_MemDims_Data, NULL );
-            if ( H5_MemID_Data < 0 )  Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID_Data" );
+      else
+      {
+         H5_Status = H5Sselect_hyperslab( H5_SpaceID_Data, H5S_SELECT_SET, H5_Offset_Data, NULL, H5_Count_Data, NULL );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab !!\n" );
+      }
+
+#     if ( defined H5_HAVE_PARALLEL  &&  !defined SERIAL )
+//    open the file with the MPI-IO driver and write data collectively
+      H5_FileAccPropList  = H5Pcreate( H5P_FILE_ACCESS );
+      H5_Status           = H5Pset_fapl_mpio( H5_FileAccPropList, MPI_COMM_WORLD, MPI_INFO_NULL );
+      H5_DataXferPropList = H5Pcreate( H5P_DATASET_XFER );
+      H5_Status           = H5Pset_dxpl_mpio( H5_DataXferPropList, H5FD_MPIO_COLLECTIVE );
+
+      const int NWriteRound = 1;
+#     else
+      H5_FileAccPropList  = H5P_DEFAULT;
+      H5_DataXferPropList = H5P_DEFAULT;
 
-//          set the subset of the dataspace
-            H5_Offset_Data[0] = 0;
-            H5_Offset_Data[1] = 0;
-            H5_Offset_Data[2] = 0;
-            for (int r=0; r<MyRank; r++)  H5_Offset_Data[0] += Idx_AllRankSizeZ[r];
+      const int NWriteRound = NGPU;
+#     endif
+
+      for (int TargetRank=0; TargetRank<NWriteRound; TargetRank++)
+      {
+         if ( NWriteRound == 1  ||  ( MyRank == TargetRank && !Out_Empty )  )
+         {
+//          HDF5 file must be synchronized before being written by the next rank
+            if ( NWriteRound > 1 )  SyncHDF5File( FileName_Out );
 
-            H5_Count_Data [0] = Idx_MySize[2];
-            H5_Count_Data [1] = Idx_MySize[1];
-            H5_Count_Data [2] = Idx_MySize[0];
+//          reopen the file and group
+            H5_FileID = H5Fopen( FileName_Out, H5F_ACC_RDWR, H5_FileAccPropList );
+            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName_Out );
 
-            H5_Status = H5Sselect_hyperslab( H5_SpaceID_Data, H5S_SELECT_SET, H5_Offset_Data, NULL, H5_Count_Data, NULL );
-            if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab !!\n" );
+            H5_GroupID_Data = H5Gopen( H5_FileID, "Data", H5P_DEFAULT );
+            if ( H5_GroupID_Data < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Data" );
 
 //          write data to disk (one field at a time)
             for (int v=0; v<NOut; v++)
             {
                hid_t H5_SetID_Data = H5Dopen( H5_GroupID_Data, FieldName[v], H5P_DEFAULT );
-               H5_Status           = H5Dwrite( H5_SetID_Data, H5T_GAMER_REAL, H5_MemID_Data, H5_SpaceID_Data, H5P_DEFAULT,
-                                               OutputArray+(long)v*Size1v );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to output the field \"%s\" !!\n", FieldName );
+               H5_Status           = H5Dwrite( H5_SetID_Data, H5T_GAMER_REAL, H5_MemID_Data, H5_SpaceID_Data,
+                                               H5_DataXferPropList, OutputArray+(long)v*Size1v );
+               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to output the field \"%s\" !!\n", FieldName[v] );
                H5_Status = H5Dclose( H5_SetID_Data );
             }
 
-            H5_Status = H5Sclose( H5_MemID_Data );
             H5_Status = H5Gclose( H5_GroupID_Data );
             H5_Status = H5Fclose( H5_FileID );
-         } // else if ( OutputFormat == 2 )
-#        endif // #ifdef SUPPORT_HDF5
+         } // if ( NWriteRound == 1  ||  ( MyRank == TargetRank && !Out_Empty )  )
 
+         if ( NWriteRound > 1 )  MPI_Barrier( MPI_COMM_WORLD );
+      } // for (int TargetRank=0; TargetRank<NWriteRound; TargetRank++)
 
-//       3-3. C-binary file --> different components will be outputted to different files
-         else if ( OutputFormat == 3 )
-         {
-            for (int v=0; v<NOut; v++)
-            {
-               FILE *File = fopen( FileName_Out_Binary[v], "ab" );
+#     if ( defined H5_HAVE_PARALLEL  &&  !defined SERIAL )
+      H5_Status = H5Pclose( H5_FileAccPropList );
+      H5_Status = H5Pclose( H5_DataXferPropList );
+#     endif
+      H5_Status = H5Sclose( H5_MemID_Data );
+      H5_Status = H5Sclose( H5_SpaceID_Data );
+   } // else if ( OutputFormat == 2 )
+#  endif // #ifdef SUPPORT_HDF5
 
-               fwrite( OutputArray+(long)v*Size1v, sizeof(real), Size1v, File );
 
-               fclose( File );
-            }
-         } // else if ( OutputFormat == 3 )
+// 5-3. C-binary file --> different components will be outputted to different files
+   else if ( OutputFormat == 3 )
+   {
+#     ifdef SERIAL
+//    the only rank holds the entire array
+      for (int v=0; v<NOut; v++)
+      {
+         FILE *File = fopen( FileName_Out_Binary[v], "wb" );
 
+         fwrite( OutputArray+(long)v*Size1v, sizeof(real), Size1v, File );
 
-         else
-            Aux_Error( ERROR_INFO, "unsupported output format !!\n" );
+         fclose( File );
+      }
 
-      } // ( MyRank == TargetRank  &&  ... )
+#     else
+//    all ranks write their sub-arrays collectively by MPI-IO, which works for arbitrary 3D decompositions
+//    --> ranks without any data simply participate in the collective calls with zero count
+#     ifdef FLOAT8
+      const MPI_Datatype MPI_GAMER_REAL = MPI_DOUBLE;
+#     else
+      const MPI_Datatype MPI_GAMER_REAL = MPI_FLOAT;
+#     endif
 
-      MPI_Barrier( MPI_COMM_WORLD );
+      if ( Size1v > (long)INT_MAX )
+         Aux_Error( ERROR_INFO, "array size of rank %d (%ld) exceeds the maximum integer --> use more ranks !!\n",
+                    MyRank, Size1v );
 
-   } // for (int TargetRank=0; TargetRank<NGPU; TargetRank++)
+      int          MPI_Size   [3] = { Out_Size    [2], Out_Size    [1], Out_Size    [0] };
+      int          MPI_SubSize[3] = { Out_MySize  [2], Out_MySize  [1], Out_MySize  [0] };
+      int          MPI_Start  [3] = { Out_MyOffset[2], Out_MyOffset[1], Out_MyOffset[0] };
+      const int    NWrite         = ( Out_Empty ) ? 0 : (int)Size1v;
+      MPI_Datatype MPI_FileType;
+      MPI_File     File;
 
+      if ( Out_Empty )
+         MPI_FileType = MPI_GAMER_REAL;
+      else
+      {
+         MPI_Type_create_subarray( 3, MPI_Size, MPI_SubSize, MPI_Start, MPI_ORDER_C, MPI_GAMER_REAL, &MPI_FileType );
+         MPI_Type_commit( &MPI_FileType );
+      }
 
-// close all HDF5 objects
-#  ifdef SUPPORT_HDF5
-   if ( OutputFormat == 2 )
-   {
-      H5_Status = H5Sclose( H5_SpaceID_Data );
-   }
-#  endif
+      for (int v=0; v<NOut; v++)
+      {
+         if (  MPI_File_open( MPI_COMM_WORLD, FileName_Out_Binary[v], MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                              MPI_INFO_NULL, &File ) != MPI_SUCCESS  )
+            Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", FileName_Out_Binary[v] );
+
+         MPI_File_set_view( File, 0, MPI_GAMER_REAL, MPI_FileType, (char*)"native", MPI_INFO_NULL );
+         MPI_File_write_all( File, OutputArray+(long)v*Size1v, NWrite, MPI_GAMER_REAL, MPI_STATUS_IGNORE );
+         MPI_File_close( &File );
+      }
+
+      if ( !Out_Empty )    MPI_Type_free( &MPI_FileType );
+#     endif // #ifdef SERIAL ... else ...
+   } // else if ( OutputFormat == 3 )
+
+
+   else
+      Aux_Error( ERROR_INFO, "unsupported output format !!\n" );
 
 
    if ( MyRank == 0 )   cout << "Output ... done" << endl;
@@ -0,0 +1,112 @@
+#include "SnapshotIndex.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <float.h>
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Example of the reader API in SnapshotIndex.h
+//                --> Report the patches on a given level overlapping a query box and the minimum, maximum,
+//                    and average values of a given field in these patches
+//
+// Usage       :  GAMER_QueryIndex -i Data_000000 -l 2 -x 0.1 -y 0.1 -z 0.1 -X 0.2 -Y 0.2 -Z 0.2 -f Dens
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+
+   char  *FileName = NULL;
+   char   FieldName[64] = "Dens";
+   int    lv = 0, c;
+   double EdgeL[3] = { 0.0, 0.0, 0.0 };
+   double EdgeR[3] = { DBL_MAX, DBL_MAX, DBL_MAX };
+
+   while (  ( c = getopt( argc, argv, "hi:l:x:y:z:X:Y:Z:f:" ) ) != -1  )
+   {
+      switch ( c )
+      {
+         case 'i': FileName = optarg;                          break;
+         case 'l': lv       = atoi( optarg );                  break;
+         case 'x': EdgeL[0] = atof( optarg );                  break;
+         case 'y': EdgeL[1] = atof( optarg );                  break;
+         case 'z': EdgeL[2] = atof( optarg );                  break;
+         case 'X': EdgeR[0] = atof( optarg );                  break;
+         case 'Y': EdgeR[1] = atof( optarg );                  break;
+         case 'Z': EdgeR[2] = atof( optarg );                  break;
+         case 'f': strncpy( FieldName, optarg, 63 );           break;
+         case 'h':
+         case '?': fprintf( stderr, "usage: %s -i FileName [-l level] [-x/y/z left edge] [-X/Y/Z right edge] "
+                                    "[-f field]\n", argv[0] );
+                   exit( 1 );
+      }
+   }
+
+   if ( FileName == NULL )
+   {
+      fprintf( stderr, "ERROR : please provide the snapshot name by \"-i\" !!\n" );
+      exit( 1 );
+   }
+
+
+// open the snapshot and its index
+   SnapIdx_t Idx;
+
+   if ( !SnapIdx_Open( Idx, FileName ) )  exit( 1 );
+
+   const int FieldIdx = SnapIdx_GetFieldIdx( Idx, FieldName );
+
+   if ( FieldIdx < 0 )
+   {
+      fprintf( stderr, "ERROR : field \"%s\" is not found !!\n", FieldName );
+      exit( 1 );
+   }
+
+   for (int d=0; d<3; d++)    if ( EdgeR[d] > Idx.BoxSize[d] )   EdgeR[d] = Idx.BoxSize[d];
+
+
+// query the patches
+   const long NMax = ( lv >= 0  &&  lv < Idx.NLevel ) ? Idx.NPatch[lv] : 0;
+   const SnapIdxRecord_t **Match = new const SnapIdxRecord_t* [ NMax + 1 ];
+   const long NMatch = SnapIdx_Query( Idx, lv, EdgeL, EdgeR, Match, NMax );
+
+
+// load only the matched patches
+   const int NCell = Idx.PatchSize*Idx.PatchSize*Idx.PatchSize;
+   double Min = DBL_MAX, Max = -DBL_MAX, Sum = 0.0;
+
+   for (long t=0; t<NMatch; t++)
+   {
+      const void *Data = SnapIdx_GetPatchData( Idx, FieldIdx, Match[t]->GID );
+
+      if ( Data == NULL )
+      {
+         fprintf( stderr, "ERROR : field \"%s\" cannot be memory-mapped (compressed?) !!\n", FieldName );
+         exit( 1 );
+      }
+
+      for (int i=0; i<NCell; i++)
+      {
+         const double Value = ( Idx.SizeReal == 4 ) ? ((const float*)Data)[i] : ((const double*)Data)[i];
+
+         if ( Value < Min )   Min = Value;
+         if ( Value > Max )   Max = Value;
+         Sum += Value;
+      }
+   }
+
+   printf( "Time %20.14e   Step %ld   Level %d   NPatch %ld / %ld\n", Idx.Time, Idx.Step, lv, NMatch, NMax );
+
+   if ( NMatch > 0 )
+   printf( "%s : min %20.14e   max %20.14e   average %20.14e\n", FieldName, Min, Max, Sum/(NMatch*NCell) );
+
+
+   delete [] Match;
+   SnapIdx_Close( Idx );
+
+   return 0;
+
+} // FUNCTION : main
@@ -0,0 +1,299 @@
+#include "SnapshotIndex.h"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static void *MapFile( const char *FileName, size_t &Size );
+static long  GetMortonKey( const long Idx[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SnapIdx_Open
+// Description :  Memory-map the snapshot "SnapshotName" and its index "SnapshotName.idx"
+//
+// Note        :  1. Only the pages actually accessed are loaded by the operating system
+//                2. Must be closed by SnapIdx_Close()
+//
+// Parameter   :  Idx          : Index to be initialized
+//                SnapshotName : Name of the HDF5 snapshot
+//
+// Return      :  true/false --> success/failure
+//-------------------------------------------------------------------------------------------------------
+bool SnapIdx_Open( SnapIdx_t &Idx, const char *SnapshotName )
+{
+
+   char IdxName[1024];
+   sprintf( IdxName, "%s.idx", SnapshotName );
+
+   memset( &Idx, 0, sizeof(SnapIdx_t) );
+
+   Idx.IdxMap  = MapFile( IdxName,      Idx.IdxSize  );
+   Idx.DataMap = MapFile( SnapshotName, Idx.DataSize );
+
+   if ( Idx.IdxMap == NULL  ||  Idx.DataMap == NULL )
+   {
+      SnapIdx_Close( Idx );
+      return false;
+   }
+
+
+// parse the header
+   const char *Ptr = (const char*)Idx.IdxMap;
+   int Int[6];
+
+   if ( strncmp( Ptr, SNAPIDX_MAGIC, 8 ) != 0 )
+   {
+      fprintf( stderr, "ERROR : \"%s\" is not a snapshot index !!\n", IdxName );
+      SnapIdx_Close( Idx );
+      return false;
+   }
+   Ptr += 8;
+
+   memcpy( Int, Ptr, sizeof(Int) );    Ptr += sizeof(Int);
+
+   if ( Int[0] != SNAPIDX_VERSION )
+   {
+      fprintf( stderr, "ERROR : unsupported index version %d (expect %d) !!\n", Int[0], SNAPIDX_VERSION );
+      SnapIdx_Close( Idx );
+      return false;
+   }
+
+   Idx.NLevel    = Int[1];
+   Idx.PatchSize = Int[2];
+   Idx.SizeReal  = Int[3];
+   Idx.NField    = Int[4];
+   Idx.LabelLen  = Int[5];
+
+   memcpy( &Idx.Step,      Ptr, sizeof(long)     );  Ptr += sizeof(long);
+   memcpy( &Idx.Time,      Ptr, sizeof(double)   );  Ptr += sizeof(double);
+   memcpy(  Idx.BoxSize,   Ptr, 3*sizeof(double) );  Ptr += 3*sizeof(double);
+   memcpy( &Idx.dh_Finest, Ptr, sizeof(double)   );  Ptr += sizeof(double);
+
+   Idx.NPatch      = (const long*)Ptr;              Ptr += Idx.NLevel*sizeof(long);
+   Idx.GID0        = (const long*)Ptr;              Ptr += Idx.NLevel*sizeof(long);
+   Idx.Scale       = (const long*)Ptr;              Ptr += Idx.NLevel*sizeof(long);
+   Idx.Label       = Ptr;                           Ptr += Idx.NField*Idx.LabelLen;
+   Idx.FieldOffset = (const long*)Ptr;              Ptr += Idx.NField*sizeof(long);
+   Idx.Record      = (const SnapIdxRecord_t*)Ptr;
+
+   return true;
+
+} // FUNCTION : SnapIdx_Open
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SnapIdx_Close
+// Description :  Unmap the files opened by SnapIdx_Open()
+//
+// Parameter   :  Idx : Target index
+//-------------------------------------------------------------------------------------------------------
+void SnapIdx_Close( SnapIdx_t &Idx )
+{
+
+   if ( Idx.IdxMap  != NULL )    munmap( Idx.IdxMap,  Idx.IdxSize  );
+   if ( Idx.DataMap != NULL )    munmap( Idx.DataMap, Idx.DataSize );
+
+   Idx.IdxMap  = NULL;
+   Idx.DataMap = NULL;
+
+} // FUNCTION : SnapIdx_Close
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SnapIdx_GetFieldIdx
+// Description :  Return the index of the target field (e.g., "Dens")
+//
+// Parameter   :  Idx       : Target index
+//                FieldName : Target field name
+//
+// Return      :  Field index (-1 if not found)
+//-------------------------------------------------------------------------------------------------------
+int SnapIdx_GetFieldIdx( const SnapIdx_t &Idx, const char *FieldName )
+{
+
+   for (int v=0; v<Idx.NField; v++)
+      if ( strncmp( Idx.Label+v*Idx.LabelLen, FieldName, Idx.LabelLen ) == 0 )   return v;
+
+   return -1;
+
+} // FUNCTION : SnapIdx_GetFieldIdx
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SnapIdx_Query
+// Description :  Find all patches on level lv overlapping the box [EdgeL, EdgeR)
+//
+// Note        :  1. Binary search the records within the Morton-key range of the box and then check the
+//                   overlap of each of them
+//                2. Return the total number of the matched patches, which may exceed MaxMatch
+//                   --> Only the first MaxMatch records are stored in Match[]
+//
+// Parameter   :  Idx      : Target index
+//                lv       : Target level
+//                EdgeL/R  : Query box in physical coordinates
+//                Match    : Array to store the pointers to the matched records
+//                MaxMatch : Size of Match[]
+//
+// Return      :  Number of the matched patches
+//-------------------------------------------------------------------------------------------------------
+long SnapIdx_Query( const SnapIdx_t &Idx, const int lv, const double EdgeL[], const double EdgeR[],
+                    const SnapIdxRecord_t **Match, const long MaxMatch )
+{
+
+   if ( lv < 0  ||  lv >= Idx.NLevel  ||  Idx.NPatch[lv] == 0 )   return 0;
+
+   const long   PatchScale = Idx.PatchSize*Idx.Scale[lv];
+   const double PatchSize  = PatchScale*Idx.dh_Finest;
+   long Lo[3], Hi[3];
+
+// box in the unit of the patch size on lv
+   for (int d=0; d<3; d++)
+   {
+      Lo[d] = (long)floor( EdgeL[d]/PatchSize );
+      Hi[d] = (long)ceil ( EdgeR[d]/PatchSize ) - 1;
+
+      if ( Lo[d] < 0 )  Lo[d] = 0;
+      if ( Hi[d] < Lo[d] )    return 0;
+   }
+
+   const long KeyMin = GetMortonKey( Lo );
+   const long KeyMax = GetMortonKey( Hi );
+   const SnapIdxRecord_t *Rec = Idx.Record + Idx.GID0[lv];
+
+// binary search the first record with Key >= KeyMin
+   long L = 0, R = Idx.NPatch[lv];
+
+   while ( L < R )
+   {
+      const long M = ( L + R ) / 2;
+
+      if ( Rec[M].Key < KeyMin )    L = M + 1;
+      else                          R = M;
+   }
+
+// check all records within [KeyMin, KeyMax]
+   long NMatch = 0;
+
+   for (long t=L; t<Idx.NPatch[lv]  &&  Rec[t].Key<=KeyMax; t++)
+   {
+      bool Inside = true;
+
+      for (int d=0; d<3; d++)
+      {
+         const long P = Rec[t].Corner[d] / PatchScale;
+
+         if ( P < Lo[d]  ||  P > Hi[d] )  Inside = false;
+      }
+
+      if ( Inside )
+      {
+         if ( NMatch < MaxMatch )   Match[NMatch] = Rec + t;
+         NMatch ++;
+      }
+   }
+
+   return NMatch;
+
+} // FUNCTION : SnapIdx_Query
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SnapIdx_GetPatchData
+// Description :  Return the pointer to the data of the target field of the target patch in the
+//                memory-mapped snapshot
+//
+// Note        :  1. Data are stored as real[PatchSize][PatchSize][PatchSize] with x being the fastest index,
+//                   where real is float/double for SizeReal = 4/8
+//                2. Return NULL if the field dataset is not contiguous (e.g., compressed)
+//
+// Parameter   :  Idx      : Target index
+//                FieldIdx : Target field index (see SnapIdx_GetFieldIdx())
+//                GID      : Target patch GID
+//
+// Return      :  Pointer to the patch data
+//-------------------------------------------------------------------------------------------------------
+const void *SnapIdx_GetPatchData( const SnapIdx_t &Idx, const int FieldIdx, const int GID )
+{
+
+   if ( FieldIdx < 0  ||  FieldIdx >= Idx.NField  ||  Idx.FieldOffset[FieldIdx] < 0 )  return NULL;
+
+   const long PatchBytes = (long)Idx.PatchSize*Idx.PatchSize*Idx.PatchSize*Idx.SizeReal;
+   const long Offset     = Idx.FieldOffset[FieldIdx] + GID*PatchBytes;
+
+   if ( Offset + PatchBytes > (long)Idx.DataSize )  return NULL;
+
+   return (const char*)Idx.DataMap + Offset;
+
+} // FUNCTION : SnapIdx_GetPatchData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MapFile
+// Description :  Memory-map the target file in the read-only mode
+//
+// Parameter   :  FileName : Target file
+//                Size     : File size to be returned
+//
+// Return      :  Mapped address (NULL on failure)
+//-------------------------------------------------------------------------------------------------------
+void *MapFile( const char *FileName, size_t &Size )
+{
+
+   const int File = open( FileName, O_RDONLY );
+   struct stat Stat;
+
+   if ( File < 0  ||  fstat( File, &Stat ) != 0 )
+   {
+      fprintf( stderr, "ERROR : failed to open the file \"%s\" !!\n", FileName );
+      if ( File >= 0 )  close( File );
+      return NULL;
+   }
+
+   Size = Stat.st_size;
+
+   void *Map = mmap( NULL, Size, PROT_READ, MAP_SHARED, File, 0 );
+   close( File );
+
+   if ( Map == MAP_FAILED )
+   {
+      fprintf( stderr, "ERROR : failed to map the file \"%s\" !!\n", FileName );
+      return NULL;
+   }
+
+   return Map;
+
+} // FUNCTION : MapFile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMortonKey
+// Description :  Return the Morton key of the patch indices (consistent with GAMER's WriteSnapshotIndex())
+//
+// Parameter   :  Idx : Patch indices along x/y/z
+//
+// Return      :  Morton key
+//-------------------------------------------------------------------------------------------------------
+long GetMortonKey( const long Idx[] )
+{
+
+   long Key = 0;
+
+   for (int d=0; d<3; d++)
+   for (int b=0; b<SNAPIDX_KEY_NBIT; b++)
+      if ( Idx[d] & (1L<<b) )    Key |= 1L << ( 3*b + d );
+
+   return Key;
+
+} // FUNCTION : GetMortonKey
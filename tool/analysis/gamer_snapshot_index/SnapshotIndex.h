@@ -0,0 +1,58 @@
+#ifndef __SNAPSHOTINDEX_H__
+#define __SNAPSHOTINDEX_H__
+
+
+/*===========================================================================
+Reader API of the sidecar index of the GAMER HDF5 snapshots (OPT__OUTPUT_INDEX)
+--> Memory-map the snapshot and its index, and access only the patches
+    overlapping a query box without the HDF5 library
+--> The file format is described in WriteSnapshotIndex() in
+    src/Output/Output_DumpData_Total_HDF5.cpp
+===========================================================================*/
+
+#include <cstddef>
+
+
+#define SNAPIDX_MAGIC         "GAMERIDX"
+#define SNAPIDX_VERSION       1
+#define SNAPIDX_KEY_NBIT      21
+
+
+// index record of a single patch (must be consistent with include/SnapshotIndex_Typedef.h)
+struct SnapIdxRecord_t
+{
+   long Key;            // Morton key of the patch corner
+   long LBIdx;          // load-balance index
+   int  GID;            // global patch index in the snapshot
+   int  Corner[3];      // patch corner in the unit of the finest cell
+};
+
+
+// memory-mapped snapshot and index
+struct SnapIdx_t
+{
+   int     NLevel, PatchSize, SizeReal, NField, LabelLen;
+   long    Step;
+   double  Time, BoxSize[3], dh_Finest;
+   const long  *NPatch;             // [NLevel]
+   const long  *GID0;               // [NLevel]
+   const long  *Scale;              // [NLevel]
+   const char  *Label;              // [NField][LabelLen]
+   const long  *FieldOffset;        // [NField]
+   const SnapIdxRecord_t *Record;   // [NPatch of all levels]
+
+   void   *IdxMap, *DataMap;
+   size_t  IdxSize, DataSize;
+};
+
+
+bool        SnapIdx_Open( SnapIdx_t &Idx, const char *SnapshotName );
+void        SnapIdx_Close( SnapIdx_t &Idx );
+int         SnapIdx_GetFieldIdx( const SnapIdx_t &Idx, const char *FieldName );
+long        SnapIdx_Query( const SnapIdx_t &Idx, const int lv, const double EdgeL[], const double EdgeR[],
+                           const SnapIdxRecord_t **Match, const long MaxMatch );
+const void *SnapIdx_GetPatchData( const SnapIdx_t &Idx, const int FieldIdx, const int GID );
+
+
+
+#endif // #ifndef __SNAPSHOTINDEX_H__
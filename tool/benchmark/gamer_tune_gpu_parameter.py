@@ -0,0 +1,162 @@
+import argparse
+import itertools
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+
+# load the command-line parameters
+parser = argparse.ArgumentParser( description='Tune FLU_GPU_NPGROUP, POT_GPU_NPGROUP, and GPU_NSTREAM by short trial runs' )
+
+parser.add_argument( '-e', action='store', required=False, type=str, dest='exe',
+                     help='GAMER executable [%(default)s]', default='./gamer' )
+parser.add_argument( '-d', action='store', required=False, type=str, dest='dir_in',
+                     help='directory containing the Input__* files of the target run [%(default)s]', default='.' )
+parser.add_argument( '-s', action='store', required=False, type=int, dest='nstep',
+                     help='number of root-level steps of each trial run [%(default)d]', default=10 )
+parser.add_argument( '-k', action='store', required=False, type=int, dest='nskip',
+                     help='number of initial steps excluded from the timing [%(default)d]', default=2 )
+parser.add_argument( '--flu', action='store', required=False, type=str, dest='flu_npg',
+                     help='comma-separated candidates of FLU_GPU_NPGROUP [%(default)s]', default='-1' )
+parser.add_argument( '--pot', action='store', required=False, type=str, dest='pot_npg',
+                     help='comma-separated candidates of POT_GPU_NPGROUP [%(default)s]', default='-1' )
+parser.add_argument( '--stream', action='store', required=False, type=str, dest='nstream',
+                     help='comma-separated candidates of GPU_NSTREAM [%(default)s]', default='-1' )
+parser.add_argument( '-m', action='store', required=False, type=str, dest='mpirun',
+                     help='launcher prefix, e.g., "mpirun -np 4" [none]', default='' )
+parser.add_argument( '-w', action='store', required=False, type=str, dest='dir_work',
+                     help='scratch directory of the trial runs [%(default)s]', default='Tune__GPU_Parameter' )
+parser.add_argument( '-o', action='store', required=False, type=str, dest='filename_out',
+                     help='output parameter file with the best configuration [%(default)s]', default='Input__Parameter.tuned' )
+
+args=parser.parse_args()
+
+# check
+assert args.nstep >= 1,          '-s (%d) < 1' % (args.nstep)
+assert args.nskip >= 0,          '-k (%d) < 0' % (args.nskip)
+assert args.nskip < args.nstep,  '-k (%d) >= -s (%d)' % (args.nskip, args.nstep)
+assert os.path.isfile( args.exe ),                                  'executable "%s" does not exist' % (args.exe)
+assert os.path.isfile( os.path.join(args.dir_in, 'Input__Parameter') ), 'Input__Parameter does not exist in "%s"' % (args.dir_in)
+
+candidates = { 'FLU_GPU_NPGROUP' : [ int(v) for v in args.flu_npg.split(',') ],
+               'POT_GPU_NPGROUP' : [ int(v) for v in args.pot_npg.split(',') ],
+               'GPU_NSTREAM'     : [ int(v) for v in args.nstream.split(',') ] }
+names = [ 'FLU_GPU_NPGROUP', 'POT_GPU_NPGROUP', 'GPU_NSTREAM' ]
+tags  = [ 'FLU', 'POT', 'NSTREAM' ]
+
+
+
+#--------------------------------------------------------------------------------------------------
+# set_parameter: replace the value of a runtime parameter and append it if absent (only when append=True)
+#--------------------------------------------------------------------------------------------------
+def set_parameter( lines, name, value, append=True ):
+   pattern = re.compile( r'^%s\s+\S+\s*(.*)$' % name )
+   for i in range( len(lines) ):
+      m = pattern.match( lines[i] )
+      if m:
+         lines[i] = ( '%-28s %-12s %s' % (name, str(value), m.group(1)) ).rstrip() + '\n'
+         return
+   if append:
+      lines.append( '%-28s %-12s\n' % (name, str(value)) )
+
+
+#--------------------------------------------------------------------------------------------------
+# load_performance: return the total number of updated cells and the elapsed time in Record__Performance
+#                   excluding the first nskip steps
+#--------------------------------------------------------------------------------------------------
+def load_performance( filename, nskip ):
+   ncell = 0.0
+   time  = 0.0
+   step  = 0
+   for line in open( filename ):
+      if line.startswith( '#' ):
+         continue
+      col = line.split()
+      step += 1
+      if step <= nskip:
+         continue
+      ncell += float( col[4] )
+      time  += float( col[5] )
+   return ncell, time
+
+
+
+# load the baseline parameter file
+lines_in = open( os.path.join(args.dir_in, 'Input__Parameter') ).readlines()
+
+if os.path.isdir( args.dir_work ):
+   shutil.rmtree( args.dir_work )
+os.makedirs( args.dir_work )
+
+
+# take note
+File_Log = open( os.path.join(args.dir_work, 'Record__Tune'), 'w' )
+
+File_Log.write( '#Command-line arguments:\n' )
+File_Log.write( '#-------------------------------------------------------------------\n' )
+File_Log.write( '#' )
+for t in range( len(sys.argv) ):
+   File_Log.write( ' %s' % str(sys.argv[t]) )
+File_Log.write( '\n' )
+File_Log.write( '#-------------------------------------------------------------------\n\n' )
+File_Log.write( '#%15s  %15s  %15s  %13s  %13s\n' % ('FLU_GPU_NPGROUP', 'POT_GPU_NPGROUP', 'GPU_NSTREAM', 'ElapsedTime', 'Perf_Overall') )
+
+
+# run all trial configurations
+best_perf   = -1.0
+best_config = None
+
+for config in itertools.product( *[ candidates[n] for n in names ] ):
+   tag      = '_'.join( '%s%d' % (t, v) for t, v in zip(tags, config) )
+   dir_case = os.path.join( args.dir_work, tag )
+   os.makedirs( dir_case )
+
+   for f in os.listdir( args.dir_in ):
+      if f.startswith( 'Input__' ):
+         shutil.copy( os.path.join(args.dir_in, f), dir_case )
+
+   lines = list( lines_in )
+   for n, v in zip( names, config ):
+      set_parameter( lines, n, v, append=(v > 0) )
+   set_parameter( lines, 'END_STEP',                args.nstep )
+   set_parameter( lines, 'OPT__RECORD_PERFORMANCE', 1 )
+   set_parameter( lines, 'OPT__OUTPUT_TOTAL',       0, append=False )
+   set_parameter( lines, 'OPT__OUTPUT_PART',        0, append=False )
+   set_parameter( lines, 'OPT__OUTPUT_USER',        0, append=False )
+   open( os.path.join(dir_case, 'Input__Parameter'), 'w' ).writelines( lines )
+
+   cmd = args.mpirun.split() + [ os.path.abspath(args.exe) ]
+   ret = subprocess.call( cmd, cwd=dir_case, stdout=open(os.path.join(dir_case, 'log'), 'w'), stderr=subprocess.STDOUT )
+
+   if ret != 0  or  not os.path.isfile( os.path.join(dir_case, 'Record__Performance') ):
+      print( '%-40s : FAILED (see %s)' % (tag, os.path.join(dir_case, 'log')) )
+      File_Log.write( '#%15d  %15d  %15d  %13s  %13s\n' % (config + ('FAILED', 'FAILED')) )
+      continue
+
+   ncell, time = load_performance( os.path.join(dir_case, 'Record__Performance'), args.nskip )
+   perf        = ncell/time if time > 0.0 else 0.0
+
+   print( '%-40s : %13.6e cells/sec' % (tag, perf) )
+   File_Log.write( ' %15d  %15d  %15d  %13.6e  %13.6e\n' % (config + (time, perf)) )
+
+   if perf > best_perf:
+      best_perf   = perf
+      best_config = config
+
+assert best_config is not None, 'all trial runs failed'
+
+
+# record the best configuration
+File_Log.write( '\n#Best: ' + '  '.join( '%s = %d' % (n, v) for n, v in zip(names, best_config) ) +
+                '  (%13.6e cells/sec)\n' % best_perf )
+File_Log.close()
+
+lines = list( lines_in )
+for n, v in zip( names, best_config ):
+   set_parameter( lines, n, v, append=(v > 0) )
+open( args.filename_out, 'w' ).writelines( lines )
+
+print( 'Best configuration : ' + '  '.join( '%s = %d' % (n, v) for n, v in zip(names, best_config) ) )
+print( '                     --> stored in "%s" (copy it to Input__Parameter)' % args.filename_out )
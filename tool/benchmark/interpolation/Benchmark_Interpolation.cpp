@@ -0,0 +1,209 @@
+#include "GAMER.h"
+#include <stdarg.h>
+#include <sys/time.h>
+
+void Interpolate( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                  real FData[], const int FSize[3], const int FStart[3],
+                  const int NComp, const IntScheme_t IntScheme, const bool UnwrapPhase, const bool Monotonic[],
+                  const bool OppSign0thOrder );
+void Int_Table( const IntScheme_t IntScheme, int &NSide, int &NGhost );
+
+
+// global variables required by the interpolation routines
+double INT_MONO_COEFF = 2.0;
+
+
+// target interpolation schemes and coarse-grid shapes
+// --> the shapes mimic the coarse-fine ghost zones of a patch group in InterpolateGhostZone() (face, edge, and corner
+//     with GhostSize = 3 padded to 4) and the new patch group in Refine() (a whole coarse patch)
+static const int         NScheme = 7;
+static const IntScheme_t SchemeList[NScheme] = { INT_MINMOD3D, INT_MINMOD1D, INT_VANLEER, INT_CQUAD, INT_QUAD,
+                                                 INT_CQUAR, INT_QUAR };
+static const char       *SchemeName[NScheme] = { "MINMOD3D", "MINMOD1D", "VANLEER", "CQUAD", "QUAD", "CQUAR", "QUAR" };
+
+static const int         NShape = 4;
+static const int         ShapeRange[NShape][3] = { { 2, PS1, PS1 }, { 2, 2, PS1 }, { 2, 2, 2 }, { PS1, PS1, PS1 } };
+static const char       *ShapeName [NShape]    = { "GZ-face", "GZ-edge", "GZ-corner", "Refine" };
+
+static void ReadOption( int argc, char **argv, int &NIter, int &NComp, bool &Mono, bool &OppSign0thOrder );
+static double GetTime();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Time all spatial interpolation schemes in Interpolate() on patch-group-like shapes
+//
+// Note        :  1. Report the wall-clock time per fine-grid cell and per component
+//                2. Also report a checksum of the interpolation results to verify that an optimized
+//                   implementation still returns identical results
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char **argv )
+{
+
+   int  NIter           = 20000;
+   int  NComp           = NCOMP_TOTAL;
+   bool Mono            = true;
+   bool OppSign0thOrder = false;
+
+   ReadOption( argc, argv, NIter, NComp, Mono, OppSign0thOrder );
+
+   bool *Monotonic = new bool [NComp];
+   for (int v=0; v<NComp; v++)   Monotonic[v] = Mono;
+
+   printf( "# NIter %d, NComp %d, Monotonic %d, OppSign0thOrder %d, FLOAT8 %s\n",
+           NIter, NComp, Mono, OppSign0thOrder,
+#          ifdef FLOAT8
+           "on"
+#          else
+           "off"
+#          endif
+         );
+   printf( "# %-10s %-10s %14s %14s %24s\n", "Scheme", "Shape", "Time(s)", "ns/cell/comp", "Checksum" );
+
+
+   for (int s=0; s<NScheme; s++)
+   for (int t=0; t<NShape;  t++)
+   {
+      int NSide, NGhost, CSize[3], CStart[3], FSize[3], FStart[3];
+      const int *CRange = ShapeRange[t];
+
+      Int_Table( SchemeList[s], NSide, NGhost );
+
+      for (int d=0; d<3; d++)
+      {
+         CSize [d] = CRange[d] + 2*NGhost;
+         CStart[d] = NGhost;
+         FSize [d] = 2*CRange[d];
+         FStart[d] = 0;
+      }
+
+      const int CSize3D = CSize[0]*CSize[1]*CSize[2];
+      const int FSize3D = FSize[0]*FSize[1]*FSize[2];
+
+      real *CData0 = new real [ NComp*CSize3D ];
+      real *CData  = new real [ NComp*CSize3D ];
+      real *FData  = new real [ NComp*FSize3D ];
+
+//    smooth positive data with a discontinuity to exercise both the smooth and the limited branches
+      for (int v=0; v<NComp; v++)
+      for (int k=0; k<CSize[2]; k++)
+      for (int j=0; j<CSize[1]; j++)
+      for (int i=0; i<CSize[0]; i++)
+      {
+         const int    idx = ( (v*CSize[2] + k)*CSize[1] + j )*CSize[0] + i;
+         const double x   = 0.37*i + 0.23*j + 0.11*k + 0.5*v;
+
+         CData0[idx] = (real)( 2.0 + sin(x) + 0.3*cos(2.1*x) + ( (i+j+k)%7 == 0 ? 1.0 : 0.0 ) );
+      }
+
+//    CData[] may be modified by the interpolation routines (e.g., phase unwrapping) --> restore it every time
+      const double t0 = GetTime();
+
+      for (int n=0; n<NIter; n++)
+      {
+         memcpy( CData, CData0, NComp*CSize3D*sizeof(real) );
+
+         Interpolate( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp, SchemeList[s], false, Monotonic,
+                      OppSign0thOrder );
+      }
+
+      const double t1 = GetTime();
+
+//    checksum: FNV-1a hash of the raw bytes of the last result
+      unsigned long Hash = 14695981039346656037UL;
+      const unsigned char *Byte = (const unsigned char *)FData;
+      for (long b=0; b<(long)NComp*FSize3D*sizeof(real); b++)
+      {
+         Hash ^= Byte[b];
+         Hash *= 1099511628211UL;
+      }
+
+      printf( "  %-10s %-10s %14.6e %14.4f %24lu\n", SchemeName[s], ShapeName[t], t1-t0,
+              (t1-t0)*1.0e9/( (double)NIter*NComp*FSize3D ), Hash );
+
+      delete [] CData0;
+      delete [] CData;
+      delete [] FData;
+   } // for s, t
+
+   delete [] Monotonic;
+
+   return 0;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadOption
+// Description :  Load the command-line options
+//-------------------------------------------------------------------------------------------------------
+void ReadOption( int argc, char **argv, int &NIter, int &NComp, bool &Mono, bool &OppSign0thOrder )
+{
+
+   int c;
+
+   while ( (c = getopt(argc, argv, "hn:c:mo")) != -1 )
+      switch ( c )
+      {
+         case 'n': NIter           = atoi( optarg );
+                   break;
+         case 'c': NComp           = atoi( optarg );
+                   break;
+         case 'm': Mono            = false;
+                   break;
+         case 'o': OppSign0thOrder = true;
+                   break;
+         case 'h':
+         case '?': fprintf( stderr, "\nusage: %s [-h (for help)] [-n number of iterations [20000]]\n"
+                                    "          [-c number of components [NCOMP_TOTAL]] [-m (disable monotonicity) [on]]\n"
+                                    "          [-o (enable OppSign0thOrder) [off]]\n\n", argv[0] );
+                   exit( 1 );
+      }
+
+   if ( NIter <= 0 )    { fprintf( stderr, "ERROR : NIter (%d) <= 0 !!\n", NIter );    exit( 1 ); }
+   if ( NComp <= 0 )    { fprintf( stderr, "ERROR : NComp (%d) <= 0 !!\n", NComp );    exit( 1 ); }
+
+} // FUNCTION : ReadOption
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetTime
+// Description :  Return the wall-clock time in seconds
+//-------------------------------------------------------------------------------------------------------
+double GetTime()
+{
+
+   struct timeval tv;
+   gettimeofday( &tv, NULL );
+
+   return tv.tv_sec + 1.0e-6*tv.tv_usec;
+
+} // FUNCTION : GetTime
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Error
+// Description :  Minimal replacement of the GAMER error handler
+//-------------------------------------------------------------------------------------------------------
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... )
+{
+
+   va_list Arg;
+   va_start( Arg, Format );
+
+   fprintf( stderr, "********************************************************************************\n" );
+   fprintf( stderr, "ERROR : " );
+   vfprintf( stderr, Format, Arg );
+   fprintf( stderr, "        file <%s>, line <%d>, function <%s>\n", File, Line, Func );
+   fprintf( stderr, "********************************************************************************\n" );
+
+   va_end( Arg );
+
+   exit( 1 );
+
+} // FUNCTION : Aux_Error
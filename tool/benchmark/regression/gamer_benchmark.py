@@ -0,0 +1,265 @@
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+
+# benchmark configurations
+# --> dir   : test problem directory under example/test_problem
+#     flags : compilation options required by the test problem (for reference only; see README.txt)
+#     param : runtime parameters overwriting those in Input__Parameter
+#     extra : files not shipped with GAMER that must be present in the test problem directory
+benchmarks = {
+   'Riemann'          : { 'dir'   : 'Hydro/Riemann',
+                          'flags' : 'MODEL=HYDRO',
+                          'param' : { 'NX0_TOT_X' : 256, 'NX0_TOT_Y' : 32, 'NX0_TOT_Z' : 32, 'MAX_LEVEL' : 2 },
+                          'extra' : [] },
+   'BlastWave'        : { 'dir'   : 'Hydro/BlastWave',
+                          'flags' : 'MODEL=HYDRO',
+                          'param' : { 'MAX_LEVEL' : 3 },
+                          'extra' : [] },
+   'MHD_ABC'          : { 'dir'   : 'Hydro/MHD_ABC',
+                          'flags' : 'MODEL=HYDRO, MHD',
+                          'param' : {},
+                          'extra' : [] },
+   'Plummer'          : { 'dir'   : 'Hydro/Plummer',
+                          'flags' : 'MODEL=HYDRO, GRAVITY, PARTICLE',
+                          'param' : {},
+                          'extra' : [] },
+   'JeansInstability' : { 'dir'   : 'Hydro/JeansInstability',
+                          'flags' : 'MODEL=HYDRO, GRAVITY',
+                          'param' : {},
+                          'extra' : [] },
+   'AGORA'            : { 'dir'   : 'Hydro/AGORA_IsolatedGalaxy',
+                          'flags' : 'MODEL=HYDRO, GRAVITY, PARTICLE, DUAL_ENERGY, SUPPORT_GRACKLE',
+                          'param' : {},
+                          'extra' : [ 'vcirc.dat', 'halo.dat', 'disk.dat', 'bulge.dat', 'CloudyData_UVB=HM2012.h5' ] },
+}
+names_all = [ 'Riemann', 'BlastWave', 'MHD_ABC', 'Plummer', 'JeansInstability', 'AGORA' ]
+
+# runtime parameters shared by all benchmarks to make them deterministic and free of I/O
+param_common = { 'OPT__RECORD_PERFORMANCE' : 1,
+                 'OPT__TIMING_BARRIER'     : 1,
+                 'OPT__OUTPUT_TOTAL'       : 0,
+                 'OPT__OUTPUT_PART'        : 0,
+                 'OPT__OUTPUT_USER'        : 0,
+                 'OPT__OUTPUT_BASEPS'      : 0,
+                 'OPT__OUTPUT_RESTART'     : 0,
+                 'OPT__TRACE'              : 0 }
+
+
+# load the command-line parameters
+parser = argparse.ArgumentParser( description='Run the fixed-size GAMER benchmarks and compare the performance with a baseline' )
+
+parser.add_argument( '-e', action='store', required=False, type=str, dest='exe',
+                     help='GAMER executable [%(default)s]', default='./gamer' )
+parser.add_argument( '-b', action='store', required=False, type=str, dest='bench',
+                     help='comma-separated benchmarks (%s) [all]' % ','.join(names_all), default=','.join(names_all) )
+parser.add_argument( '-s', action='store', required=False, type=int, dest='nstep',
+                     help='number of root-level steps of each benchmark [%(default)d]', default=10 )
+parser.add_argument( '-k', action='store', required=False, type=int, dest='nskip',
+                     help='number of initial steps excluded from the timing [%(default)d]', default=2 )
+parser.add_argument( '-t', action='store', required=False, type=int, dest='nthread',
+                     help='number of OpenMP threads (<=0: keep the value in Input__Parameter) [%(default)d]', default=-1 )
+parser.add_argument( '-m', action='store', required=False, type=str, dest='mpirun',
+                     help='launcher prefix, e.g., "mpirun -np 4" [none]', default='' )
+parser.add_argument( '-g', action='store', required=False, type=str, dest='dir_gamer',
+                     help='root directory of GAMER [%(default)s]',
+                     default=os.path.abspath( os.path.join(os.path.dirname(__file__), '../../..') ) )
+parser.add_argument( '-w', action='store', required=False, type=str, dest='dir_work',
+                     help='scratch directory of the benchmark runs [%(default)s]', default='Benchmark__Run' )
+parser.add_argument( '-o', action='store', required=False, type=str, dest='filename_out',
+                     help='output JSON file [%(default)s]', default='Benchmark.json' )
+parser.add_argument( '-c', action='store', required=False, type=str, dest='filename_base',
+                     help='baseline JSON file to be compared with [none]', default=None )
+parser.add_argument( '-r', action='store', required=False, type=float, dest='tolerance',
+                     help='maximum allowed fractional slowdown relative to the baseline [%(default).2f]', default=0.05 )
+
+args=parser.parse_args()
+
+# check
+names = args.bench.split( ',' )
+assert args.nstep >= 1,          '-s (%d) < 1' % (args.nstep)
+assert args.nskip >= 0,          '-k (%d) < 0' % (args.nskip)
+assert args.nskip < args.nstep,  '-k (%d) >= -s (%d)' % (args.nskip, args.nstep)
+assert args.tolerance >= 0.0,    '-r (%f) < 0.0' % (args.tolerance)
+assert os.path.isfile( args.exe ),  'executable "%s" does not exist' % (args.exe)
+for n in names:
+   assert n in benchmarks,  'unknown benchmark "%s" (available: %s)' % (n, ','.join(names_all))
+if args.filename_base is not None:
+   assert os.path.isfile( args.filename_base ),  'baseline "%s" does not exist' % (args.filename_base)
+
+
+
+#--------------------------------------------------------------------------------------------------
+# set_parameter: replace the value of a runtime parameter and append it if absent
+#--------------------------------------------------------------------------------------------------
+def set_parameter( lines, name, value ):
+   pattern = re.compile( r'^%s\s+\S+\s*(.*)$' % name )
+   for i in range( len(lines) ):
+      m = pattern.match( lines[i] )
+      if m:
+         lines[i] = ( '%-28s %-12s %s' % (name, str(value), m.group(1)) ).rstrip() + '\n'
+         return
+   lines.append( '%-28s %-12s\n' % (name, str(value)) )
+
+
+#--------------------------------------------------------------------------------------------------
+# load_performance: return the number of steps, cell updates, particle updates, and elapsed time
+#                   in Record__Performance excluding the first nskip steps
+#                   --> columns are located by their labels since the particle columns are optional
+#--------------------------------------------------------------------------------------------------
+def load_performance( filename, nskip ):
+   label = None
+   nstep = 0
+   ncell = 0.0
+   npar  = 0.0
+   etime = 0.0
+   for line in open( filename ):
+      if line.startswith( '#' ):
+         label = line[1:].split()
+         continue
+      col = dict( zip(label, line.split()) )
+      nstep += 1
+      if nstep <= nskip:
+         continue
+      ncell += float( col['NUpdate_Cell'] )
+      etime += float( col['ElapsedTime'] )
+      if 'NUpdate_Par' in col:
+         npar += float( col['NUpdate_Par'] )
+   return nstep, ncell, npar, etime
+
+
+#--------------------------------------------------------------------------------------------------
+# load_timing: return the time of each phase in the "Summary" tables of Record__Timing summed over all
+#              steps excluding the first nskip steps
+#              --> return an empty dictionary if GAMER is compiled without TIMING
+#--------------------------------------------------------------------------------------------------
+def load_timing( filename, nskip ):
+   phase = {}
+   if not os.path.isfile( filename ):
+      return phase
+   lines = open( filename ).readlines()
+   nstep = 0
+   for i in range( len(lines) ):
+      if not lines[i].startswith( 'Summary' ):
+         continue
+      nstep += 1
+      if nstep <= nskip:
+         continue
+      label = lines[i+2].split()
+      value = lines[i+3].split()[1:]
+      for l, v in zip( label, value ):
+         phase[l] = phase.get( l, 0.0 ) + float( v )
+   return phase
+
+
+
+# run all benchmarks
+if os.path.isdir( args.dir_work ):
+   shutil.rmtree( args.dir_work )
+os.makedirs( args.dir_work )
+
+result = { 'format'  : 1,
+           'date'    : time.strftime( '%Y-%m-%d %H:%M:%S' ),
+           'host'    : platform.node(),
+           'exe'     : os.path.abspath( args.exe ),
+           'mpirun'  : args.mpirun,
+           'nstep'   : args.nstep,
+           'nskip'   : args.nskip,
+           'nthread' : args.nthread,
+           'bench'   : {} }
+
+for n in names:
+   bench    = benchmarks[n]
+   dir_prob = os.path.join( args.dir_gamer, 'example/test_problem', bench['dir'] )
+   dir_case = os.path.join( args.dir_work, n )
+   entry    = { 'status' : 'ok', 'flags' : bench['flags'] }
+   result['bench'][n] = entry
+
+   missing = [ f for f in bench['extra'] if not os.path.isfile( os.path.join(dir_prob, f) ) ]
+   if missing:
+      entry['status'] = 'skipped'
+      print( '%-20s : SKIPPED (missing %s in %s; see its README)' % (n, ', '.join(missing), dir_prob) )
+      continue
+
+   shutil.copytree( dir_prob, dir_case )
+
+   lines = open( os.path.join(dir_case, 'Input__Parameter') ).readlines()
+   for p, v in list( param_common.items() ) + list( bench['param'].items() ):
+      set_parameter( lines, p, v )
+   set_parameter( lines, 'END_STEP', args.nstep )
+   if args.nthread > 0:
+      set_parameter( lines, 'OMP_NTHREAD', args.nthread )
+   open( os.path.join(dir_case, 'Input__Parameter'), 'w' ).writelines( lines )
+
+   cmd = args.mpirun.split() + [ os.path.abspath(args.exe) ]
+   ret = subprocess.call( cmd, cwd=dir_case, stdout=open(os.path.join(dir_case, 'log'), 'w'), stderr=subprocess.STDOUT )
+
+   if ret != 0  or  not os.path.isfile( os.path.join(dir_case, 'Record__Performance') ):
+      entry['status'] = 'failed'
+      print( '%-20s : FAILED (see %s; required compilation options: %s)' % (n, os.path.join(dir_case, 'log'), bench['flags']) )
+      continue
+
+   nstep, ncell, npar, etime = load_performance( os.path.join(dir_case, 'Record__Performance'), args.nskip )
+
+   if nstep <= args.nskip  or  etime <= 0.0:
+      entry['status'] = 'failed'
+      print( '%-20s : FAILED (only %d steps completed)' % (n, nstep) )
+      continue
+
+   entry['nstep']             = nstep
+   entry['elapsed_time']      = etime
+   entry['cells_per_sec']     = ncell/etime
+   entry['particles_per_sec'] = npar/etime
+   entry['phase_time']        = load_timing( os.path.join(dir_case, 'Record__Timing'), args.nskip )
+
+   if nstep < args.nstep:
+      print( '%-20s : WARNING : the run ended after %d < %d steps (END_T reached)' % (n, nstep, args.nstep) )
+
+   print( '%-20s : %13.6e cells/sec  %13.6e particles/sec  %10.3f sec' %
+          (n, entry['cells_per_sec'], entry['particles_per_sec'], etime) )
+
+
+# record the results
+json.dump( result, open(args.filename_out, 'w'), indent=3, sort_keys=True )
+print( 'Results are stored in "%s"' % args.filename_out )
+
+
+# compare with the baseline
+# --> return a nonzero exit code if any benchmark is slower than the baseline by more than the tolerance
+if args.filename_base is not None:
+   base      = json.load( open(args.filename_base) )
+   regressed = []
+
+   print( '' )
+   print( '%-20s   %-17s  %13s  %13s  %8s' % ('Benchmark', 'Metric', 'Baseline', 'Current', 'Ratio') )
+
+   for n in names:
+      if result['bench'][n]['status'] != 'ok'  or  n not in base['bench']  or  base['bench'][n]['status'] != 'ok':
+         continue
+
+      for metric in [ 'cells_per_sec', 'particles_per_sec' ]:
+         old = base  ['bench'][n][metric]
+         new = result['bench'][n][metric]
+         if old <= 0.0:
+            continue
+
+         ratio = new/old
+         flag  = ''
+         if ratio < 1.0 - args.tolerance:
+            flag = '  <-- REGRESSION'
+            regressed.append( n )
+
+         print( '%-20s   %-17s  %13.6e  %13.6e  %8.4f%s' % (n, metric, old, new, ratio, flag) )
+
+   if regressed:
+      print( 'Performance regression detected in: %s' % ', '.join( sorted(set(regressed)) ) )
+      sys.exit( 1 )
+   else:
+      print( 'No performance regression detected (tolerance = %.2f)' % args.tolerance )
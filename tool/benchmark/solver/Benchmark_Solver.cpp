@@ -0,0 +1,520 @@
+#include "GAMER.h"
+#include "CUFLU.h"
+#ifdef GRAVITY
+#include "CUPOT.h"
+#endif
+#include <stdarg.h>
+#include <sys/time.h>
+
+#if ( MODEL != HYDRO )
+#  error : ERROR : only MODEL == HYDRO is supported !!
+#endif
+
+
+// fluid solver prototypes
+#if   ( FLU_SCHEME == RTVD )
+void CPU_FluidSolver_RTVD(
+   real Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
+   real Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
+   real Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],
+   const double Corner_Array[][3],
+   const real Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+   const int NPatchGroup, const real dt, const real dh,
+   const bool StoreFlux, const bool XYZ,
+   const real MinDens, const real MinPres, const real MinEint,
+   const EoS_DE2P_t EoS_DensEint2Pres_Func,
+   const EoS_DP2E_t EoS_DensPres2Eint_Func,
+   const EoS_DP2C_t EoS_DensPres2CSqr_Func,
+   const double c_EoS_AuxArray[] );
+#else
+#if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+void CPU_FluidSolver_MHM(
+#elif ( FLU_SCHEME == CTU )
+void CPU_FluidSolver_CTU(
+#endif
+   const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
+         real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
+   const real   g_Mag_Array_In [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_Mag_Array_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+         char   g_DE_Array_Out [][ CUBE(PS2) ],
+         real   g_Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],
+         real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
+   const double g_Corner_Array [][3],
+   const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+         real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
+         real_fc g_FC_Var      [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
+   const int NPatchGroup, const real dt, const real dh,
+   const bool StoreFlux, const bool StoreElectric,
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+   const double Time, const double TimeNew, const bool FuseExtAcc,
+   const OptGravityType_t GravityType, ExtAcc_t ExtAcc_Func,
+   const double c_ExtAcc_AuxArray[],
+   const real MinDens, const real MinPres, const real MinEint,
+   const real DualEnergySwitch, const bool NormPassive, const int NNorm,
+   const int c_NormIdx[],
+   const bool JeansMinPres, const real JeansMinPres_Coeff,
+   const EoS_DE2P_t EoS_DensEint2Pres_Func,
+   const EoS_DP2E_t EoS_DensPres2Eint_Func,
+   const EoS_DP2C_t EoS_DensPres2CSqr_Func,
+   const double c_EoS_AuxArray[] );
+#endif // FLU_SCHEME
+
+// Poisson solver prototypes
+#ifdef GRAVITY
+#if   ( POT_SCHEME == SOR )
+void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
+                            const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
+                                  real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                            const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
+                            const real Omega, const real Tolerated_Error, const real Poi_Coeff,
+                            const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum );
+#elif ( POT_SCHEME == MG  )
+void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
+                           const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
+                                 real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
+                           const int NPatchGroup, const real dh_Min, const int Max_Iter, const int NPre_Smooth,
+                           const int NPost_Smooth, const real Tolerated_Error, const real Poi_Coeff,
+                           const IntScheme_t IntScheme, const bool WarmStart, long *NIter_Sum );
+#endif // POT_SCHEME
+#endif // #ifdef GRAVITY
+
+void EoS_Init_Gamma();
+
+
+// global variables required by the solvers
+int        MPI_Rank = 0;
+double     GAMMA    = 5.0/3.0;
+double     EoS_AuxArray[EOS_NAUX_MAX];
+EoS_DE2P_t EoS_DensEint2Pres_CPUPtr = NULL;
+EoS_DP2E_t EoS_DensPres2Eint_CPUPtr = NULL;
+EoS_DP2C_t EoS_DensPres2CSqr_CPUPtr = NULL;
+
+
+// maximum number of entries in the lists of patch groups and threads
+#define NLIST_MAX    32
+
+static void ReadOption( int argc, char **argv, int &NIter, int NPG_List[], int &NNPG, int NThread_List[], int &NNThread,
+                        bool &RunFlu, bool &RunPoi );
+static int ReadList( const char *Str, int List[] );
+static void Bench_Fluid( const int NIter, const int NPG, const int NThread );
+#ifdef GRAVITY
+static void Bench_Poisson( const int NIter, const int NPG, const int NThread );
+#endif
+static unsigned long Checksum( const void *Data, const long Size );
+static double GetTime();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Time the CPU fluid and Poisson solvers on synthetic data without the AMR driver
+//
+// Note        :  1. The solvers are compiled directly from the GAMER source tree with the options in the Makefile
+//                   --> Schemes (e.g., FLU_SCHEME, LR_SCHEME, RSOLVER, POT_SCHEME) are selected at compile time
+//                2. Loop over the numbers of patch groups per solver call (i.e., FLU_GPU_NPGROUP/POT_GPU_NPGROUP)
+//                   and OpenMP threads given on the command line
+//                3. Report the wall-clock time per cell update and a checksum of the output arrays to verify
+//                   that an optimized implementation still returns identical results
+//                4. The input arrays are filled once and reused for all iterations, so the first iteration
+//                   is excluded from the timing as a warm-up
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char **argv )
+{
+
+   int  NIter = 10;
+   int  NPG_List[NLIST_MAX], NThread_List[NLIST_MAX];
+   int  NNPG = 0, NNThread = 0;
+   bool RunFlu = true, RunPoi = true;
+
+   ReadOption( argc, argv, NIter, NPG_List, NNPG, NThread_List, NNThread, RunFlu, RunPoi );
+
+   EoS_Init_Gamma();
+
+   printf( "# NIter %d, FLOAT8 %s, OMP_MAX_THREAD %d\n", NIter,
+#          ifdef FLOAT8
+           "on",
+#          else
+           "off",
+#          endif
+           omp_get_max_threads() );
+   printf( "# %-8s %8s %8s %14s %14s %24s\n", "Solver", "NPGroup", "NThread", "Time(s)", "ns/cell", "Checksum" );
+
+   for (int p=0; p<NNPG;     p++)
+   for (int t=0; t<NNThread; t++)
+   {
+      if ( RunFlu )  Bench_Fluid  ( NIter, NPG_List[p], NThread_List[t] );
+#     ifdef GRAVITY
+      if ( RunPoi )  Bench_Poisson( NIter, NPG_List[p], NThread_List[t] );
+#     endif
+   }
+
+   return 0;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid
+// Description :  Time the CPU fluid solver
+//
+// Note        :  1. Input: a smooth random-phase flow plus a weak density jump to exercise both the smooth and
+//                   the limited branches of the data reconstruction
+//                2. Per-thread scratch arrays are allocated as in Init_MemAllocate_Fluid()
+//
+// Parameter   :  NIter   : Number of timed solver calls
+//                NPG     : Number of patch groups per call
+//                NThread : Number of OpenMP threads
+//-------------------------------------------------------------------------------------------------------
+void Bench_Fluid( const int NIter, const int NPG, const int NThread )
+{
+
+   const real   dh        = (real)1.0/64.0;
+   const real   dt        = (real)0.1*dh;
+   const real   MinDens   = (real)1.0e-10;
+   const real   MinPres   = (real)1.0e-10;
+   const real   MinEint   = (real)1.0e-10;
+   const int    NScratch  = MAX( NPG, NThread );
+   const long   NOut      = (long)NPG*FLU_NOUT*CUBE(PS2);
+
+   real (*Flu_In )[FLU_NIN ][ CUBE(FLU_NXT) ] = new real [NPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real (*Flu_Out)[FLU_NOUT][ CUBE(PS2)     ] = new real [NPG][FLU_NOUT][ CUBE(PS2)     ];
+   real (*Flux   )[9][NFLUX_TOTAL][ SQR(PS2) ] = new real [NPG][9][NFLUX_TOTAL][ SQR(PS2) ];
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   real   (*PriVar   )   [NCOMP_LR            ][ CUBE(FLU_NXT)     ] = new real    [NScratch]   [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
+   real   (*Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = new real    [NScratch][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
+   real_fc(*FC_Var   )[6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = new real_fc [NScratch][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
+   real   (*FC_Flux  )[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = new real    [NScratch][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
+#  endif
+
+
+// set the input data
+   for (int P=0; P<NPG; P++)
+   for (int k=0; k<FLU_NXT; k++)
+   for (int j=0; j<FLU_NXT; j++)
+   for (int i=0; i<FLU_NXT; i++)
+   {
+      const int    idx  = IDX321( i, j, k, FLU_NXT, FLU_NXT );
+      const double x    = 0.31*i + 0.17*j + 0.07*k + 0.9*P;
+      const double Dens = 1.0 + 0.3*sin(x) + ( (i+j)%11 == 0 ? 0.5 : 0.0 );
+      const double VelX = 0.5*cos(1.3*x);
+      const double VelY = 0.4*sin(0.7*x);
+      const double VelZ = 0.3*cos(0.5*x);
+      const double Pres = 1.0 + 0.2*cos(x);
+
+      Flu_In[P][DENS][idx] = (real)Dens;
+      Flu_In[P][MOMX][idx] = (real)( Dens*VelX );
+      Flu_In[P][MOMY][idx] = (real)( Dens*VelY );
+      Flu_In[P][MOMZ][idx] = (real)( Dens*VelZ );
+      Flu_In[P][ENGY][idx] = (real)( Pres/(GAMMA-1.0) + 0.5*Dens*( SQR(VelX) + SQR(VelY) + SQR(VelZ) ) );
+
+      for (int v=NCOMP_FLUID; v<FLU_NIN; v++)   Flu_In[P][v][idx] = (real)( 0.1*Dens );
+   }
+
+
+// run the solver
+// --> RTVD modifies the input array, so its results are only meaningful for the first call
+   omp_set_num_threads( NThread );
+
+   double t0 = 0.0;
+
+   for (int n=0; n<=NIter; n++)
+   {
+      if ( n == 1 )  t0 = GetTime();
+
+#     if   ( FLU_SCHEME == RTVD )
+      CPU_FluidSolver_RTVD( (real(*)[NCOMP_TOTAL][ CUBE(FLU_NXT) ])Flu_In, (real(*)[NCOMP_TOTAL][ CUBE(PS2) ])Flu_Out,
+                            (real(*)[9][NCOMP_TOTAL][ SQR(PS2) ])Flux, NULL, NULL,
+                            NPG, dt, dh, true, ( n%2 == 0 ), MinDens, MinPres, MinEint,
+                            EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+#     else
+#     if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+      CPU_FluidSolver_MHM(
+#     elif ( FLU_SCHEME == CTU )
+      CPU_FluidSolver_CTU(
+#     endif
+                           (real(*)[NCOMP_TOTAL][ CUBE(FLU_NXT) ])Flu_In, (real(*)[NCOMP_TOTAL][ CUBE(PS2) ])Flu_Out,
+                           NULL, NULL, NULL, (real(*)[9][NCOMP_TOTAL][ SQR(PS2) ])Flux, NULL, NULL, NULL,
+                           PriVar, Slope_PPM, FC_Var, FC_Flux, NULL, NULL,
+                           NPG, dt, dh, true, false, VL_GMINMOD, (real)2.0,
+                           0.0, 0.0, false, GRAVITY_NONE, NULL, NULL, MinDens, MinPres, MinEint,
+                           (real)NULL_REAL, false, 0, NULL, false, (real)NULL_REAL,
+                           EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr, EoS_DensPres2CSqr_CPUPtr, EoS_AuxArray );
+#     endif
+   }
+
+   const double t1 = GetTime();
+
+   printf( "  %-8s %8d %8d %14.6e %14.4f %24lu\n", "Fluid", NPG, NThread, t1-t0,
+           (t1-t0)*1.0e9/( (double)NIter*NPG*CUBE(PS2) ), Checksum( Flu_Out, NOut*sizeof(real) ) );
+
+
+   delete [] Flu_In;
+   delete [] Flu_Out;
+   delete [] Flux;
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   delete [] PriVar;
+   delete [] Slope_PPM;
+   delete [] FC_Var;
+   delete [] FC_Flux;
+#  endif
+
+} // FUNCTION : Bench_Fluid
+
+
+
+#ifdef GRAVITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson
+// Description :  Time the CPU Poisson solver
+//
+// Note        :  1. Input: a smooth density field with a compact overdensity and a zero initial potential
+//                2. The numbers of iterations are fixed (Min_Iter = Max_Iter for SOR and zero tolerance for MG)
+//                   so that the timing does not depend on the convergence rate
+//
+// Parameter   :  NIter   : Number of timed solver calls
+//                NPG     : Number of patch groups per call
+//                NThread : Number of OpenMP threads
+//-------------------------------------------------------------------------------------------------------
+void Bench_Poisson( const int NIter, const int NPG, const int NThread )
+{
+
+   const int  NP       = 8*NPG;
+   const real dh       = (real)1.0/64.0;
+   const real Poi_Coeff = (real)( 4.0*M_PI );
+   const long NOut     = (long)NP*CUBE(GRA_NXT);
+
+   real (*Rho_In)[RHO_NXT][RHO_NXT][RHO_NXT] = new real [NP][RHO_NXT][RHO_NXT][RHO_NXT];
+   real (*Pot_In)[POT_NXT][POT_NXT][POT_NXT] = new real [NP][POT_NXT][POT_NXT][POT_NXT];
+   real (*Pot_Out)[GRA_NXT][GRA_NXT][GRA_NXT] = new real [NP][GRA_NXT][GRA_NXT][GRA_NXT];
+   long NIter_Sum = 0;
+
+
+// set the input data
+   for (int P=0; P<NP; P++)
+   {
+      for (int k=0; k<RHO_NXT; k++)
+      for (int j=0; j<RHO_NXT; j++)
+      for (int i=0; i<RHO_NXT; i++)
+      {
+         const double r2 = SQR(i-0.5*RHO_NXT) + SQR(j-0.5*RHO_NXT) + SQR(k-0.5*RHO_NXT);
+
+         Rho_In[P][k][j][i] = (real)( 1.0 + 0.2*sin(0.3*i + 0.2*j + 0.1*k + P) + 5.0*exp(-r2/4.0) );
+      }
+
+      for (int k=0; k<POT_NXT; k++)
+      for (int j=0; j<POT_NXT; j++)
+      for (int i=0; i<POT_NXT; i++)
+         Pot_In[P][k][j][i] = (real)0.0;
+   }
+
+
+// run the solver
+   omp_set_num_threads( NThread );
+
+   double t0 = 0.0;
+
+   for (int n=0; n<=NIter; n++)
+   {
+      if ( n == 1 )  t0 = GetTime();
+
+#     if   ( POT_SCHEME == SOR )
+      CPU_PoissonSolver_SOR( Rho_In, Pot_In, Pot_Out, NPG, dh, 60, 60, (real)1.69, (real)0.0, Poi_Coeff,
+                             INT_CQUAD, false, &NIter_Sum );
+#     elif ( POT_SCHEME == MG )
+      CPU_PoissonSolver_MG ( Rho_In, Pot_In, Pot_Out, NPG, dh, 10, 3, 3, (real)0.0, Poi_Coeff,
+                             INT_CQUAD, false, &NIter_Sum );
+#     endif
+   }
+
+   const double t1 = GetTime();
+
+   printf( "  %-8s %8d %8d %14.6e %14.4f %24lu\n", "Poisson", NPG, NThread, t1-t0,
+           (t1-t0)*1.0e9/( (double)NIter*NP*CUBE(PS1) ), Checksum( Pot_Out, NOut*sizeof(real) ) );
+
+
+   delete [] Rho_In;
+   delete [] Pot_In;
+   delete [] Pot_Out;
+
+} // FUNCTION : Bench_Poisson
+#endif // #ifdef GRAVITY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadOption
+// Description :  Load the command-line options
+//-------------------------------------------------------------------------------------------------------
+void ReadOption( int argc, char **argv, int &NIter, int NPG_List[], int &NNPG, int NThread_List[], int &NNThread,
+                 bool &RunFlu, bool &RunPoi )
+{
+
+   int c;
+
+   while ( (c = getopt(argc, argv, "hn:g:t:s:")) != -1 )
+      switch ( c )
+      {
+         case 'n': NIter    = atoi( optarg );
+                   break;
+         case 'g': NNPG     = ReadList( optarg, NPG_List );
+                   break;
+         case 't': NNThread = ReadList( optarg, NThread_List );
+                   break;
+         case 's': RunFlu   = ( strstr(optarg, "flu") != NULL );
+                   RunPoi   = ( strstr(optarg, "poi") != NULL );
+                   break;
+         case 'h':
+         case '?': fprintf( stderr, "\nusage: %s [-h (for help)] [-n number of timed iterations [10]]\n"
+                                    "          [-g comma-separated numbers of patch groups per call [8,32,128]]\n"
+                                    "          [-t comma-separated numbers of OpenMP threads [1,max]]\n"
+                                    "          [-s solvers (flu,poi) [flu,poi]]\n\n", argv[0] );
+                   exit( 1 );
+      }
+
+// default lists
+   if ( NNPG == 0 )
+   {
+      NPG_List[0] = 8;
+      NPG_List[1] = 32;
+      NPG_List[2] = 128;
+      NNPG        = 3;
+   }
+
+   if ( NNThread == 0 )
+   {
+      NThread_List[0] = 1;
+      NNThread        = 1;
+
+      if ( omp_get_max_threads() > 1 )
+      {
+         NThread_List[1] = omp_get_max_threads();
+         NNThread        = 2;
+      }
+   }
+
+   if ( NIter <= 0 )    { fprintf( stderr, "ERROR : NIter (%d) <= 0 !!\n", NIter );    exit( 1 ); }
+
+   for (int t=0; t<NNPG; t++)
+      if ( NPG_List[t] <= 0 )       { fprintf( stderr, "ERROR : NPGroup (%d) <= 0 !!\n", NPG_List[t] );        exit( 1 ); }
+
+   for (int t=0; t<NNThread; t++)
+      if ( NThread_List[t] <= 0 )   { fprintf( stderr, "ERROR : NThread (%d) <= 0 !!\n", NThread_List[t] );    exit( 1 ); }
+
+} // FUNCTION : ReadOption
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadList
+// Description :  Parse a comma-separated list of integers
+//
+// Return      :  Number of entries, List[]
+//-------------------------------------------------------------------------------------------------------
+int ReadList( const char *Str, int List[] )
+{
+
+   int  N = 0;
+   char Buf[MAX_STRING];
+
+   strncpy( Buf, Str, MAX_STRING-1 );
+   Buf[MAX_STRING-1] = '\0';
+
+   for (char *Token=strtok(Buf, ","); Token!=NULL  &&  N<NLIST_MAX; Token=strtok(NULL, ","))
+      List[ N ++ ] = atoi( Token );
+
+   return N;
+
+} // FUNCTION : ReadList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Checksum
+// Description :  FNV-1a hash of the raw bytes of an array
+//-------------------------------------------------------------------------------------------------------
+unsigned long Checksum( const void *Data, const long Size )
+{
+
+   unsigned long Hash = 14695981039346656037UL;
+   const unsigned char *Byte = (const unsigned char *)Data;
+
+   for (long b=0; b<Size; b++)
+   {
+      Hash ^= Byte[b];
+      Hash *= 1099511628211UL;
+   }
+
+   return Hash;
+
+} // FUNCTION : Checksum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetTime
+// Description :  Return the wall-clock time in seconds
+//-------------------------------------------------------------------------------------------------------
+double GetTime()
+{
+
+   struct timeval tv;
+   gettimeofday( &tv, NULL );
+
+   return tv.tv_sec + 1.0e-6*tv.tv_usec;
+
+} // FUNCTION : GetTime
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Error
+// Description :  Minimal replacement of the GAMER error handler
+//-------------------------------------------------------------------------------------------------------
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... )
+{
+
+   va_list Arg;
+   va_start( Arg, Format );
+
+   fprintf( stderr, "********************************************************************************\n" );
+   fprintf( stderr, "ERROR : " );
+   vfprintf( stderr, Format, Arg );
+   fprintf( stderr, "        file <%s>, line <%d>, function <%s>\n", File, Line, Func );
+   fprintf( stderr, "********************************************************************************\n" );
+
+   va_end( Arg );
+
+   exit( 1 );
+
+} // FUNCTION : Aux_Error
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Message
+// Description :  Minimal replacement of the GAMER message handler
+//
+// Note        :  Messages to stderr are discarded since the Poisson solvers warn about non-convergence in every
+//                patch, which is expected for the fixed numbers of iterations adopted here
+//-------------------------------------------------------------------------------------------------------
+void Aux_Message( FILE *Type, const char *Format, ... )
+{
+
+   if ( Type == stderr )   return;
+
+   va_list Arg;
+   va_start( Arg, Format );
+
+   vfprintf( Type, Format, Arg );
+   fflush( Type );
+
+   va_end( Arg );
+
+} // FUNCTION : Aux_Message
@@ -0,0 +1,226 @@
+#include "GAMER.h"
+#include <stdarg.h>
+#include <sys/time.h>
+
+void  LB_SFC_Init();
+ulong LB_Hilbert_c2i( ulong const coord[], const uint nBits );
+ulong LB_Hilbert_c2i_Table( ulong const coord[], const uint nBits );
+ulong LB_Morton_c2i( ulong const coord[], const uint nBits );
+
+
+// target encoders
+typedef ulong (*Encoder_t)( ulong const coord[], const uint nBits );
+
+static const int       NEncoder = 3;
+static const Encoder_t EncoderList[NEncoder] = { LB_Hilbert_c2i, LB_Hilbert_c2i_Table, LB_Morton_c2i };
+static const char     *EncoderName[NEncoder] = { "Hilbert-bitwise", "Hilbert-table", "Morton-table" };
+
+static void ReadOption( int argc, char **argv, int &NCoord, int &NBits, int &NBitsGrid, int &NRank );
+static double GetTime();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Compare the space-filling-curve encoders used by LB_Corner2Index()
+//
+// Note        :  1. Report the encoding throughput of random coordinates and a checksum of the indices
+//                   --> The two Hilbert encoders must return the same checksum
+//                2. Report the communication volume of a uniform grid of (2^NBitsGrid)^3 patches evenly
+//                   distributed to NRank ranks along each curve
+//                   --> Volume is measured by the number of sibling buffer patches (26 directions, periodic B.C.)
+//                       summed over all ranks, which is the number of patches exchanged by the sibling
+//                       ghost-zone lists in LB_RecordExchangeDataPatchID()
+//                   --> Also report the number of patch faces shared by different ranks
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char **argv )
+{
+
+   int NCoord    = 1<<22;
+   int NBits     = 10;
+   int NBitsGrid = 5;
+   int NRank     = 64;
+
+   ReadOption( argc, argv, NCoord, NBits, NBitsGrid, NRank );
+
+   LB_SFC_Init();
+
+
+// 1. encoding throughput
+   ulong (*Coord)[3] = new ulong [NCoord][3];
+
+   srand( 12345 );
+   for (int t=0; t<NCoord; t++)
+   for (int d=0; d<3; d++)
+      Coord[t][d] = ( ( (ulong)rand() << 31 ) ^ (ulong)rand() ) & ( (1UL<<NBits) - 1UL );
+
+   printf( "# NCoord %d, NBits %d\n", NCoord, NBits );
+   printf( "# %-16s %14s %14s %24s\n", "Encoder", "Time(s)", "ns/index", "Checksum" );
+
+   for (int e=0; e<NEncoder; e++)
+   {
+      ulong Checksum = 0;
+
+      const double t0 = GetTime();
+
+      for (int t=0; t<NCoord; t++)  Checksum = Checksum*1099511628211UL + EncoderList[e]( Coord[t], NBits );
+
+      const double t1 = GetTime();
+
+      printf( "  %-16s %14.6e %14.4f %24lu\n", EncoderName[e], t1-t0, (t1-t0)*1.0e9/NCoord, Checksum );
+   }
+
+   delete [] Coord;
+
+
+// 2. communication volume
+   const int  NSide = 1 << NBitsGrid;
+   const long NPatch = (long)NSide*NSide*NSide;
+   int *Rank = new int [NPatch];
+
+   printf( "\n# NPatch %d^3, NRank %d\n", NSide, NRank );
+   printf( "# %-16s %16s %16s %16s\n", "Encoder", "BufferPatch", "BufferPatch/Max", "CrossRankFace" );
+
+   for (int e=1; e<NEncoder; e++)
+   {
+//    both curves map the (2^NBitsGrid)^3 patches to [0 ... NPatch-1] one-to-one
+//    --> evenly distribute the indices to all ranks
+      for (int k=0; k<NSide; k++)
+      for (int j=0; j<NSide; j++)
+      for (int i=0; i<NSide; i++)
+      {
+         const ulong Cr[3] = { (ulong)i, (ulong)j, (ulong)k };
+         const long  Idx   = EncoderList[e]( Cr, NBitsGrid );
+
+         Rank[ ( (long)k*NSide + j )*NSide + i ] = (int)( Idx*NRank/NPatch );
+      }
+
+//    count the distinct remote sibling patches of each rank
+//    --> the same remote patch may be the sibling of several local patches
+      long  NBuffer_Sum = 0, NBuffer_Max = 0, NFace = 0;
+      int  *Mark = new int [NPatch];
+
+      for (long p=0; p<NPatch; p++)    Mark[p] = -1;
+
+      for (int r=0; r<NRank; r++)
+      {
+         long NBuffer = 0;
+
+         for (int k=0; k<NSide; k++)
+         for (int j=0; j<NSide; j++)
+         for (int i=0; i<NSide; i++)
+         {
+            if ( Rank[ ( (long)k*NSide + j )*NSide + i ] != r )   continue;
+
+            for (int dk=-1; dk<=1; dk++)
+            for (int dj=-1; dj<=1; dj++)
+            for (int di=-1; di<=1; di++)
+            {
+               const int  ii  = ( i + di + NSide ) % NSide;
+               const int  jj  = ( j + dj + NSide ) % NSide;
+               const int  kk  = ( k + dk + NSide ) % NSide;
+               const long Sib = ( (long)kk*NSide + jj )*NSide + ii;
+
+               if ( Rank[Sib] == r )   continue;
+
+               if ( Mark[Sib] != r )
+               {
+                  Mark[Sib] = r;
+                  NBuffer ++;
+               }
+
+               if ( abs(di) + abs(dj) + abs(dk) == 1 )   NFace ++;
+            }
+         }
+
+         NBuffer_Sum += NBuffer;
+         NBuffer_Max  = MAX( NBuffer_Max, NBuffer );
+      } // for (int r=0; r<NRank; r++)
+
+      printf( "  %-16s %16ld %16ld %16ld\n", EncoderName[e], NBuffer_Sum, NBuffer_Max, NFace/2 );
+
+      delete [] Mark;
+   } // for (int e=1; e<NEncoder; e++)
+
+   delete [] Rank;
+
+   return 0;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadOption
+// Description :  Load the command-line options
+//-------------------------------------------------------------------------------------------------------
+void ReadOption( int argc, char **argv, int &NCoord, int &NBits, int &NBitsGrid, int &NRank )
+{
+
+   int c;
+
+   while ( (c = getopt(argc, argv, "hn:b:g:r:")) != -1 )
+      switch ( c )
+      {
+         case 'n': NCoord    = atoi( optarg );
+                   break;
+         case 'b': NBits     = atoi( optarg );
+                   break;
+         case 'g': NBitsGrid = atoi( optarg );
+                   break;
+         case 'r': NRank     = atoi( optarg );
+                   break;
+         case 'h':
+         case '?': fprintf( stderr, "\nusage: %s [-h (for help)] [-n number of random coordinates [4194304]]\n"
+                                    "          [-b number of bits per coordinate [10]] [-g log2(number of patches per side) [5]]\n"
+                                    "          [-r number of ranks [64]]\n\n", argv[0] );
+                   exit( 1 );
+      }
+
+   if ( NCoord <= 0 )                     { fprintf( stderr, "ERROR : NCoord (%d) <= 0 !!\n", NCoord );                 exit( 1 ); }
+   if ( NBits < 1  ||  NBits > 21 )       { fprintf( stderr, "ERROR : NBits (%d) is not within [1, 21] !!\n", NBits );  exit( 1 ); }
+   if ( NBitsGrid < 1  ||  NBitsGrid > 8 ){ fprintf( stderr, "ERROR : NBitsGrid (%d) is not within [1, 8] !!\n", NBitsGrid ); exit( 1 ); }
+   if ( NRank <= 0 )                      { fprintf( stderr, "ERROR : NRank (%d) <= 0 !!\n", NRank );                   exit( 1 ); }
+
+} // FUNCTION : ReadOption
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetTime
+// Description :  Return the wall-clock time in seconds
+//-------------------------------------------------------------------------------------------------------
+double GetTime()
+{
+
+   struct timeval tv;
+   gettimeofday( &tv, NULL );
+
+   return tv.tv_sec + 1.0e-6*tv.tv_usec;
+
+} // FUNCTION : GetTime
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Error
+// Description :  Minimal replacement of the GAMER error handler
+//-------------------------------------------------------------------------------------------------------
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... )
+{
+
+   va_list Arg;
+   va_start( Arg, Format );
+
+   fprintf( stderr, "********************************************************************************\n" );
+   fprintf( stderr, "ERROR : " );
+   vfprintf( stderr, Format, Arg );
+   fprintf( stderr, "        file <%s>, line <%d>, function <%s>\n", File, Line, Func );
+   fprintf( stderr, "********************************************************************************\n" );
+
+   va_end( Arg );
+
+   exit( 1 );
+
+} // FUNCTION : Aux_Error